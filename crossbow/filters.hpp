@@ -4,6 +4,8 @@
 #include <cstdint>
 #include <utility>
 
+#include "../shared/dsp/one_pole.h"
+
 
 
 
@@ -35,9 +37,7 @@ struct OnePoleTPT {
     // Process one sample; returns {lp, hp}
     inline std::pair<float, float> process(float x) {
         // v = (x - s) * g/(1+g)
-        const float v  = (x - s) * (tpt_g * tpt_inv);
-        const float lp = v + s;
-        s = lp + v;                 // state update (integrator)
+        const float lp = kernels::onePoleTPT(s, x, tpt_g * tpt_inv);
         const float hp = x - lp;    // complementary HP
         return { lp, hp };
     }
@@ -46,9 +46,7 @@ struct OnePoleTPT {
     inline void processBlock(const float* in, float* outLP, float* outHP, int n) {
         for (int i = 0; i < n; ++i) {
             const float xi = in[i];
-            const float v  = (xi - s) * (tpt_g * tpt_inv);
-            const float lp = v + s;
-            s = lp + v;
+            const float lp = kernels::onePoleTPT(s, xi, tpt_g * tpt_inv);
             outLP[i] = lp;
             outHP[i] = xi - lp;
         }
@@ -121,10 +119,7 @@ struct OnePoleHighShelfBLT {
 
     inline float process(float x) {
         // Transposed Direct Form II (one state), modulation-stable
-        float y = b0 * x + s1;
-        s1 = b1 * x - a1 * y;
-        // tiny DC blocker against subnormal build-up (optional)
-        return y;
+        return kernels::firstOrderTDF2(s1, x, b0, b1, a1);
     }
 
     void processBlock(const float* in, float* out, int N) {
@@ -135,11 +130,7 @@ private:
     void updateCoeffs() {
         // prewarp (bilinear): g = tan(pi*fc/fs)
         const float g = fast_tan(float(M_PI) * (fcHz / sampleRate));
-
-        const float denom = 1.0f + g + 1e-30f; // keep safe
-        a1 = (g - 1.0f) / denom;               // feedback
-        b0 = (A + g) / denom;
-        b1 = -(A - g) / denom;
+        kernels::highShelfBLT(g, A, b0, b1, a1);
 
         // simple denormal guard on state if coeffs change wildly
         if (std::abs(s1) < 1e-30f) s1 = 0.0f;
@@ -181,9 +172,7 @@ struct OnePoleLowShelfBLT {
     void reset() { s1 = 0.0f; }
 
     inline float process(float x) {
-        float y = b0 * x + s1;
-        s1 = b1 * x - a1 * y;
-        return y;
+        return kernels::firstOrderTDF2(s1, x, b0, b1, a1);
     }
 
     void processBlock(const float* in, float* out, int N) {
@@ -193,13 +182,7 @@ struct OnePoleLowShelfBLT {
 private:
     void updateCoeffs() {
         const float g = fast_tan(float(M_PI) * (fcHz / sampleRate)); // prewarp
-        const float d = 1.0f + g + 1e-30f;
-
-        // --------- ONLY THESE LINES DIFFER FROM HS ----------
-        a1 = (g - 1.0f) / d;
-        b0 = (1.0f + A * g) / d;
-        b1 = (A * g - 1.0f) / d;
-        // -----------------------------------------------------
+        kernels::lowShelfBLT(g, A, b0, b1, a1);
 
         if (std::abs(s1) < 1e-30f) s1 = 0.0f; // denormal guard
     }
@@ -0,0 +1,510 @@
+// harness.cpp - One binary for the crossbow DSP checks and benchmarks
+//
+// Every building block in latediff_tank.hpp registers its checks (pass/fail,
+// ported from the standalone test_*.cpp programs) and its benchmarks (timed
+// after a warmup, best and median of several repeats, in ns/sample). Results
+// print as a table, or as JSON/CSV for tracking over time.
+//
+// Compile: g++ -O2 -std=c++17 harness.cpp -o harness
+//
+// Usage:   ./harness [--json | --csv] [--filter text] [--tests | --benches]
+//                    [--samples N] [--repeats R]
+//   --filter   only names containing text
+//   --samples  samples per timed run (default 1000000)
+//   --repeats  timed runs per benchmark (default 5), after one warmup run
+// Exit status is 1 if any check fails.
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+#include "latediff_tank.hpp"
+
+static const float SR = 48000.0f;
+
+// ======================= Registry ==========================================
+struct Check {
+    bool pass{true};
+    std::string detail;   // first failure, or a one-line summary
+    void expect(bool ok, const char* fmt, double a = 0.0, double b = 0.0) {
+        if (ok || !pass) return;
+        pass = false;
+        char buf[160];
+        std::snprintf(buf, sizeof(buf), fmt, a, b);
+        detail = buf;
+    }
+};
+
+// A benchmark's setup builds its state and returns the kernel: run n samples,
+// return something derived from the output so it can't be optimized away
+using Kernel = std::function<float(int)>;
+
+struct Entry {
+    const char* name;
+    std::function<Check()> test;       // set for checks
+    std::function<Kernel()> setup;     // set for benchmarks
+};
+
+static std::vector<Entry>& registry() { static std::vector<Entry> r; return r; }
+
+struct Register {
+    Register(const char* name, std::function<Check()> test) { registry().push_back({name, test, nullptr}); }
+    Register(const char* name, std::function<Kernel()> setup) { registry().push_back({name, nullptr, setup}); }
+};
+
+#define HARNESS_JOIN2(a, b) a##b
+#define HARNESS_JOIN(a, b) HARNESS_JOIN2(a, b)
+#define TEST(name) \
+    static Check HARNESS_JOIN(test_, __LINE__)(); \
+    static Register HARNESS_JOIN(reg_, __LINE__)(name, std::function<Check()>(HARNESS_JOIN(test_, __LINE__))); \
+    static Check HARNESS_JOIN(test_, __LINE__)()
+#define BENCH(name) \
+    static Kernel HARNESS_JOIN(bench_, __LINE__)(); \
+    static Register HARNESS_JOIN(reg_, __LINE__)(name, std::function<Kernel()>(HARNESS_JOIN(bench_, __LINE__))); \
+    static Kernel HARNESS_JOIN(bench_, __LINE__)()
+
+// Seeded noise in [-1, 1), cycled through by the benchmarks
+static const std::vector<float>& noise() {
+    static std::vector<float> n = [] {
+        std::vector<float> v(4096);
+        unsigned int seed = 1;
+        for (float& x : v) {
+            seed = seed * 1664525u + 1013904223u;
+            x = float(seed >> 8) / 8388608.0f - 1.0f;
+        }
+        return v;
+    }();
+    return n;
+}
+
+static bool approx(float a, float b, float eps) {
+    return std::fabs(a - b) <= eps * std::max(1.0f, std::max(std::fabs(a), std::fabs(b)));
+}
+
+// Magnitude in dB of a BiLin1P section at f Hz
+static float shelf_dB(const Coeff& c, float f) {
+    const double w = 2.0 * M_PI * f / SR;
+    const double nr = c.b0 + c.b1 * std::cos(w), ni = -c.b1 * std::sin(w);
+    const double dr = 1.0 - c.a1 * std::cos(w), di = c.a1 * std::sin(w);
+    return float(10.0 * std::log10((nr * nr + ni * ni) / (dr * dr + di * di)));
+}
+
+// Render the tank's impulse response after a 1 s preroll. The standalone
+// tests took 250 ms, which leaves the delay times 3% short of their targets
+// (5 half-lives of the 50 ms glide), enough to move the first echo out of
+// the window the echo check looks in
+static std::vector<float> tank_ir(float Sz, float Dffs, float RT60, float HB, int samples) {
+    LateDiffTank tank(SR);
+    tank.clear();
+    for (int i = 0; i < int(1.0f * SR); ++i) tank.process(0.f, Sz, Dffs, RT60, 8000.f, HB, 200.f, 0.f);
+    std::vector<float> y(static_cast<size_t>(samples));
+    for (int n = 0; n < samples; ++n) y[n] = tank.process(n == 0 ? 1.f : 0.f, Sz, Dffs, RT60, 8000.f, HB, 200.f, 0.f);
+    return y;
+}
+
+// ======================= Checks ============================================
+TEST("db2lin matches 10^(dB/20)") {
+    Check c;
+    float worst = 0.f;
+    for (float dB = -144.f; dB <= 24.f; dB += 0.25f) {
+        const float ref = std::pow(10.0f, dB / 20.0f);
+        worst = std::max(worst, std::fabs(db2lin(dB) - ref) / ref);
+    }
+    c.expect(worst < 2e-6f, "rel error %.2e", worst);
+    return c;
+}
+
+// test_rt60_to_af.cpp
+TEST("rt60_to_AF decay, floor and clamp") {
+    Check c;
+    const float AF = rt60_to_AF(0.037f, 1.8f);
+    c.expect(approx(std::pow(AF, 1.8f / 0.037f), 0.001f, 1e-4f), "amplitude after RT60 %g", std::pow(AF, 1.8f / 0.037f));
+    c.expect(approx(rt60_to_AF(0.05f, 2.0f), std::pow(10.0f, -1.5f / 20.0f), 1e-6f), "closed form %g", rt60_to_AF(0.05f, 2.0f));
+    c.expect(approx(rt60_to_AF(1.0f, 0.3f), db2lin(-144.f), 1e-6f), "floor %g", rt60_to_AF(1.0f, 0.3f));
+    c.expect(approx(rt60_to_AF(0.05f, 0.0f), db2lin(-144.f), 1e-6f), "zero RT clamp %g", rt60_to_AF(0.05f, 0.0f));
+    return c;
+}
+
+// test_tanapprox.cpp / test_warp.cpp: the 5th-order fit over the warp range
+TEST("tanApprox error within prewarp range") {
+    Check c;
+    float worst = 0.f, worstWide = 0.f;
+    for (float x = -0.25f; x <= 0.25f; x += 0.001f) worst = std::max(worst, std::fabs(tanApprox(x) - std::tan(x)));
+    for (float x = -0.8f; x <= 0.8f; x += 0.001f) worstWide = std::max(worstWide, std::fabs(tanApprox(x) - std::tan(x)));
+    c.expect(worst < 5e-5f, "|x| <= 0.25 error %.2e", worst);
+    c.expect(worstWide < 2e-2f, "|x| <= 0.8 error %.2e", worstWide);
+    return c;
+}
+
+// test_clipdelay_intfract.cpp
+TEST("clipDelay and intfract") {
+    Check c;
+    c.expect(clipDelay(-3.f) == 0.f, "clip low %g", clipDelay(-3.f));
+    c.expect(clipDelay(192123.4f) == 191998.f, "clip high %g", clipDelay(192123.4f));
+    for (float x : {0.f, 0.25f, 17.5f, 1234.75f, 191997.2f}) {
+        auto [i, f] = intfract(x);
+        c.expect(i == std::floor(x) && f >= 0.f && f < 1.f && i + f == x, "intfract(%g) fract %g", x, f);
+    }
+    return c;
+}
+
+TEST("interp4 hits samples and lines") {
+    Check c;
+    c.expect(interp4(3.f, -1.f, 7.f, 2.f, 0.f) == -1.f, "t=0 gives %g", interp4(3.f, -1.f, 7.f, 2.f, 0.f));
+    for (float t = 0.f; t <= 1.f; t += 0.125f)
+        c.expect(approx(interp4(-1.f, 0.f, 1.f, 2.f, t), t, 1e-6f), "ramp at t=%g gives %g", t, interp4(-1.f, 0.f, 1.f, 2.f, t));
+    return c;
+}
+
+// test_delay_h.cpp: an integer delay returns the impulse unchanged
+TEST("DelayH integer delay") {
+    Check c;
+    for (int d : {1, 37, 480, 47999}) {
+        DelayH delay;
+        delay.setSR(SR);
+        int at = -1;
+        float peak = 0.f;
+        for (int n = 0; n <= d + 4; ++n) {
+            const float y = delay.process(n == 0 ? 1.f : 0.f, float(d) / SR, SR);
+            if (std::fabs(y) > peak) { peak = std::fabs(y); at = n; }
+        }
+        c.expect(at == d && approx(peak, 1.f, 1e-4f), "delay %g samples peaks at %g", d, at);
+    }
+    return c;
+}
+
+// test_SetBL_LS.cpp / test_highshelf_plot.cpp: shelf gains at DC and Nyquist
+TEST("setBL_LS / setBL_HS shelf gains") {
+    Check c;
+    for (float dB : {-12.f, -6.f, -3.f, 3.f, 6.f}) {
+        const Coeff ls = setBL_LS(200.f, dB, SR);
+        const Coeff hs = setBL_HS(4000.f, dB, SR);
+        c.expect(std::fabs(shelf_dB(ls, 1.f) - dB) < 0.05f, "LS DC gain %g for %g dB", shelf_dB(ls, 1.f), dB);
+        c.expect(std::fabs(shelf_dB(ls, 23999.f)) < 0.05f, "LS Nyquist gain %g for %g dB", shelf_dB(ls, 23999.f), dB);
+        c.expect(std::fabs(shelf_dB(hs, 1.f)) < 0.05f, "HS DC gain %g for %g dB", shelf_dB(hs, 1.f), dB);
+        c.expect(std::fabs(shelf_dB(hs, 23999.f) - dB) < 0.1f, "HS Nyquist gain %g for %g dB", shelf_dB(hs, 23999.f), dB);
+    }
+    return c;
+}
+
+// test_diffuser.cpp: feedforward -Dffs, echo at T, bounded with feedback
+TEST("Diffuser feedforward, timing and stability") {
+    Check c;
+    const float T = 0.01f;
+    for (float Dffs : {0.1f, 0.5f, 0.9f}) {
+        Diffuser d(SR);
+        float first = 0.f, peak = 0.f, worst = 0.f;
+        int at = -1;
+        for (int n = 0; n < 48000; ++n) {
+            const float y = d.process(n == 0 ? 1.f : 0.f, T, Dffs, 8000.f, 0.f, 200.f, 0.f);
+            if (n == 0) first = y;
+            else if (n < 600 && std::fabs(y) > peak) { peak = std::fabs(y); at = n; }
+            if (!std::isfinite(y)) worst = INFINITY;
+            else worst = std::max(worst, std::fabs(y));
+        }
+        c.expect(approx(first, -Dffs, 1e-3f), "first sample %g for Dffs %g", first, Dffs);
+        c.expect(std::abs(at - int(T * SR)) <= 2, "echo at %g, expected %g", at, T * SR);
+        c.expect(worst <= 1.5f, "peak %g for Dffs %g", worst, Dffs);
+    }
+    return c;
+}
+
+// test_latediff_tank.cpp: with Dffs = 0 and flat shelves, successive echoes
+// shrink by the loop's rt60_to_AF. The delays are fractional, so the cubic
+// read spreads each echo differently on every pass and its peak wanders;
+// its taps sum to one, so the echo's area (sum over the window) does not
+TEST("LateDiffTank echo ratios follow RT60") {
+    Check c;
+    const float Sz = 40.f, RT60 = 1.5f;
+    const float T1 = p2t(Sz + 9.f), T2 = p2t(Sz + 6.f), T3 = p2t(Sz + 3.f), T4 = p2t(Sz);
+    const float AF = rt60_to_AF(T4, RT60);
+    const std::vector<float> y = tank_ir(Sz, 0.f, RT60, 0.f, int((T1 + T2 + T3 + 6 * T4 + 0.2f) * SR));
+    auto argmax = [&](int a, int b) {
+        a = std::max(0, a); b = std::min(b, int(y.size()));
+        int k = a;
+        for (int i = a; i < b; ++i) if (std::fabs(y[i]) > std::fabs(y[k])) k = i;
+        return k;
+    };
+    auto area = [&](int center) {
+        double sum = 0.0;
+        for (int i = std::max(0, center - 100); i < std::min(center + 100, int(y.size())); ++i) sum += y[i];
+        return float(sum);
+    };
+    const int first = int(std::round((T1 + T2 + T3) * SR));
+    const int hop = int(std::round((T1 + T2 + T3 + T4) * SR));
+    int center = argmax(first - 8, first + 192);
+    float previous = area(center);
+    for (int k = 1; k <= 5; ++k) {
+        center = argmax(center + hop - 100, center + hop + 100);
+        const float amp = area(center);
+        const float ratio = amp / previous;
+        c.expect(approx(ratio, AF, 4e-3f), "echo ratio %g, expected %g", ratio, AF);
+        previous = amp;
+    }
+    return c;
+}
+
+// test_latediff_energy.cpp: Schroeder T30 (-5 to -35 dB) within 50% of the
+// decay the loop gain sets. The gain is rt60_to_AF of the feedback delay T4
+// alone (see the echo check) but is applied once per trip round the whole
+// loop, so the tail takes RT60 * loop / T4 to fall 60 dB
+TEST("LateDiffTank Schroeder RT60") {
+    Check c;
+    const float Sz = 40.f, RT60 = 1.5f;
+    const float loop = p2t(Sz + 9.f) + p2t(Sz + 6.f) + p2t(Sz + 3.f) + p2t(Sz);
+    const float expected = RT60 * loop / p2t(Sz);
+    std::vector<float> y = tank_ir(Sz, 0.7f, RT60, -3.f, int(3.f * expected * SR));
+    double sum = 0.0;
+    bool finite = true;
+    for (int i = int(y.size()) - 1; i >= 0; --i) { finite &= std::isfinite(y[i]); sum += double(y[i]) * y[i]; y[i] = float(sum); }
+    c.expect(finite, "output not finite");
+    if (!c.pass) return c;
+    int a = -1, b = -1;
+    for (int i = 0; i < int(y.size()); ++i) {
+        const double dB = 10.0 * std::log10(std::max(double(y[i]), 1e-30) / sum);
+        if (a < 0 && dB <= -5.0) a = i;
+        if (dB <= -35.0) { b = i; break; }
+    }
+    // 30 dB of decay in (b - a) samples, extrapolated to 60 dB
+    const float t30 = (a >= 0 && b > a) ? 2.f * float(b - a) / SR : NAN;
+    c.expect(std::fabs(t30 - expected) / expected < 0.5f, "T30 %g s, expected %g s", t30, expected);
+    return c;
+}
+
+// test_realistic_params.cpp: the musical presets stay bounded
+TEST("LateDiffTank realistic presets stable") {
+    Check c;
+    const struct { float size, RT60, HB; } presets[] = {
+        {0.2f, 0.5f, -3.f}, {0.5f, 1.5f, -3.f}, {0.8f, 2.5f, -4.f}, {0.4f, 1.2f, -1.f}, {0.1f, 0.3f, -2.f},
+    };
+    for (const auto& p : presets) {
+        const float Sz = 48.f - 72.f * p.size + 2.5f;
+        const float Dffs = std::sqrt(std::sqrt(std::sqrt(p.size)));
+        const std::vector<float> y = tank_ir(Sz, Dffs, p.RT60, p.HB, 96000);
+        float worst = 0.f;
+        for (float v : y) worst = std::isfinite(v) ? std::max(worst, std::fabs(v)) : INFINITY;
+        c.expect(worst <= 100.f, "size %g peaks at %g", p.size, worst);
+    }
+    return c;
+}
+
+// ======================= Benchmarks ========================================
+// Same comparison as bench_db2amp.cpp
+BENCH("db2lin (expf)") {
+    return [](int n) {
+        const std::vector<float>& x = noise();
+        float s = 0.f;
+        for (int i = 0; i < n; ++i) s += db2lin(60.f * x[i & 4095]);
+        return s;
+    };
+}
+
+BENCH("powf(10, dB/20)") {
+    return [](int n) {
+        const std::vector<float>& x = noise();
+        float s = 0.f;
+        for (int i = 0; i < n; ++i) s += std::pow(10.0f, 3.f * x[i & 4095]);
+        return s;
+    };
+}
+
+BENCH("rt60_to_AF") {
+    return [](int n) {
+        const std::vector<float>& x = noise();
+        float s = 0.f;
+        for (int i = 0; i < n; ++i) s += rt60_to_AF(0.05f + 0.04f * x[i & 4095], 1.5f);
+        return s;
+    };
+}
+
+BENCH("p2t") {
+    return [](int n) {
+        const std::vector<float>& x = noise();
+        float s = 0.f;
+        for (int i = 0; i < n; ++i) s += p2t(24.f * x[i & 4095]);
+        return s;
+    };
+}
+
+BENCH("tanApprox") {
+    return [](int n) {
+        const std::vector<float>& x = noise();
+        float s = 0.f;
+        for (int i = 0; i < n; ++i) s += tanApprox(0.8f * x[i & 4095]);
+        return s;
+    };
+}
+
+// Both shelves' coefficients, as the diffuser recomputes them per sample
+BENCH("setBL_HS + setBL_LS") {
+    return [](int n) {
+        const std::vector<float>& x = noise();
+        float s = 0.f;
+        for (int i = 0; i < n; ++i) {
+            const float g = 6.f * x[i & 4095];
+            s += setBL_HS(4000.f, g, SR).b0 + setBL_LS(200.f, g, SR).b1;
+        }
+        return s;
+    };
+}
+
+BENCH("BiLin1P") {
+    auto f = std::make_shared<BiLin1P>();
+    f->setCoeffs(setBL_HS(4000.f, -3.f, SR));
+    return [f](int n) {
+        const std::vector<float>& x = noise();
+        float s = 0.f;
+        for (int i = 0; i < n; ++i) s += f->process(x[i & 4095]);
+        return s;
+    };
+}
+
+BENCH("DelayH (modulated)") {
+    auto d = std::make_shared<DelayH>();
+    d->setSR(SR);
+    return [d](int n) {
+        const std::vector<float>& x = noise();
+        float s = 0.f;
+        for (int i = 0; i < n; ++i) s += d->process(x[i & 4095], 0.05f + 0.0005f * x[(i + 7) & 4095], SR);
+        return s;
+    };
+}
+
+BENCH("LFO8Parabolic") {
+    auto lfo = std::make_shared<LFO8Parabolic>();
+    lfo->setSR(SR);
+    return [lfo](int n) {
+        float s = 0.f;
+        for (int i = 0; i < n; ++i) s += lfo->process(0.63f)[3];
+        return s;
+    };
+}
+
+BENCH("Diffuser") {
+    auto d = std::make_shared<Diffuser>(SR);
+    return [d](int n) {
+        const std::vector<float>& x = noise();
+        float s = 0.f;
+        for (int i = 0; i < n; ++i) s += d->process(0.1f * x[i & 4095], 0.03f, 0.7f, 8000.f, -3.f, 200.f, 0.f);
+        return s;
+    };
+}
+
+// Size 0.5 with light diffusion under sustained noise
+BENCH("LateDiffTank") {
+    auto t = std::make_shared<LateDiffTank>(SR);
+    return [t](int n) {
+        const std::vector<float>& x = noise();
+        float s = 0.f;
+        for (int i = 0; i < n; ++i) s += t->process(0.1f * x[i & 4095], 12.f, 0.3f, 1.5f, 8000.f, -3.f, 200.f, 0.f);
+        return s;
+    };
+}
+
+// ======================= Runner ============================================
+struct Result {
+    const char* name;
+    bool isTest;
+    Check check;
+    double nsMin{0.0}, nsMedian{0.0};
+};
+
+static std::string json_escape(const std::string& s) {
+    std::string out;
+    for (char ch : s) {
+        if (ch == '"' || ch == '\\') out += '\\';
+        out += ch;
+    }
+    return out;
+}
+
+int main(int argc, char** argv) {
+    enum { TEXT, JSON, CSV } format = TEXT;
+    const char* filter = nullptr;
+    bool runTests = true, runBenches = true;
+    int samples = 1000000, repeats = 5;
+    for (int i = 1; i < argc; ++i) {
+        const char* a = argv[i];
+        if (!std::strcmp(a, "--json")) format = JSON;
+        else if (!std::strcmp(a, "--csv")) format = CSV;
+        else if (!std::strcmp(a, "--tests")) runBenches = false;
+        else if (!std::strcmp(a, "--benches")) runTests = false;
+        else if (!std::strcmp(a, "--filter") && i + 1 < argc) filter = argv[++i];
+        else if (!std::strcmp(a, "--samples") && i + 1 < argc) samples = std::max(1, std::atoi(argv[++i]));
+        else if (!std::strcmp(a, "--repeats") && i + 1 < argc) repeats = std::max(1, std::atoi(argv[++i]));
+        else {
+            std::fprintf(stderr, "usage: harness [--json | --csv] [--filter text] [--tests | --benches]"
+                                 " [--samples N] [--repeats R]\n");
+            return 2;
+        }
+    }
+
+    std::vector<Result> results;
+    volatile float sink = 0.f;
+    for (const Entry& e : registry()) {
+        if (filter && !std::strstr(e.name, filter)) continue;
+        Result r{e.name, bool(e.test), {}};
+        if (e.test) {
+            if (!runTests) continue;
+            r.check = e.test();
+        } else {
+            if (!runBenches) continue;
+            Kernel kernel = e.setup();
+            sink = sink + kernel(samples);   // warmup
+            std::vector<double> ns;
+            for (int k = 0; k < repeats; ++k) {
+                const auto t0 = std::chrono::steady_clock::now();
+                sink = sink + kernel(samples);
+                const auto t1 = std::chrono::steady_clock::now();
+                ns.push_back(std::chrono::duration<double, std::nano>(t1 - t0).count() / samples);
+            }
+            std::sort(ns.begin(), ns.end());
+            r.nsMin = ns.front();
+            r.nsMedian = ns[ns.size() / 2];
+        }
+        results.push_back(r);
+        if (format == TEXT) {
+            if (r.isTest)
+                std::printf("test   %-44s %s%s%s\n", r.name, r.check.pass ? "PASS" : "FAIL",
+                            r.check.detail.empty() ? "" : "  ", r.check.detail.c_str());
+            else
+                std::printf("bench  %-44s %9.2f ns/sample  (median %.2f)\n", r.name, r.nsMin, r.nsMedian);
+        }
+    }
+
+    int failed = 0;
+    for (const Result& r : results) failed += (r.isTest && !r.check.pass) ? 1 : 0;
+
+    if (format == JSON) {
+        std::printf("{\n  \"sample_rate\": %g,\n  \"samples\": %d,\n  \"repeats\": %d,\n  \"failed\": %d,\n  \"results\": [\n",
+                    SR, samples, repeats, failed);
+        for (size_t i = 0; i < results.size(); ++i) {
+            const Result& r = results[i];
+            if (r.isTest)
+                std::printf("    {\"name\": \"%s\", \"kind\": \"test\", \"pass\": %s, \"detail\": \"%s\"}",
+                            json_escape(r.name).c_str(), r.check.pass ? "true" : "false",
+                            json_escape(r.check.detail).c_str());
+            else
+                std::printf("    {\"name\": \"%s\", \"kind\": \"bench\", \"ns_per_sample\": %.3f, \"ns_per_sample_median\": %.3f}",
+                            json_escape(r.name).c_str(), r.nsMin, r.nsMedian);
+            std::printf("%s\n", i + 1 < results.size() ? "," : "");
+        }
+        std::printf("  ]\n}\n");
+    } else if (format == CSV) {
+        std::printf("name,kind,pass,ns_per_sample,ns_per_sample_median,detail\n");
+        for (const Result& r : results) {
+            if (r.isTest)
+                std::printf("\"%s\",test,%d,,,\"%s\"\n", r.name, r.check.pass ? 1 : 0, r.check.detail.c_str());
+            else
+                std::printf("\"%s\",bench,,%.3f,%.3f,\n", r.name, r.nsMin, r.nsMedian);
+        }
+    } else {
+        std::printf("\n%d checks failed\n", failed);
+    }
+    return failed ? 1 : 0;
+}
@@ -2,6 +2,10 @@
 #include <algorithm>
 #include <array>
 #include <cmath>
+#include <vector>
+
+#include "eight_phase.hpp"   // fracf, wrap_tri, par_shape, PhaseAcc, LFO8Parabolic
+#include "../shared/dsp/allpass.h"
 
 inline float mapSize01ToLTsemi(float u01) noexcept {
     // size' = size*100; LTSize = 48 - (size' * 0.72) == 48 - 72*size
@@ -9,60 +13,6 @@ inline float mapSize01ToLTsemi(float u01) noexcept {
     return 48.0f - 72.0f * u01;  // semitones in [+48 … -24]
 }
 
-// ===== 8-phase LFO =========================================================
-// frac(x) in [0,1)
-inline float fracf(float x) noexcept { return x - floorf(x); }
-
-// Triangle distance to nearest integer in [0, 0.5]
-inline float wrap_tri(float p) noexcept {
-    float f = fracf(p);
-    return f <= 0.5f ? f : (1.0f - f);
-}
-
-// Parabolic “raised-cosine” shaper on [0, 0.5] → [0, 1]
-inline float par_shape(float t) noexcept {
-    // y = t * (8 - 16*t) = 1 - 16*(t - 0.25)^2
-    return t * (8.0f - 16.0f * t);
-}
-
-// Phase accumulator with smoothable Hz input outside this class.
-// p is kept in [0,1).
-struct PhaseAcc {
-    float p{0.f}, sr{48000.f};
-    void setSR(float s){ sr = s > 1.f ? s : 1.f; }
-    inline float step(float hz){
-        p += hz / sr;
-        p -= floorf(p);
-        return p;
-    }
-};
-
-// 8-phase LFO: outputs 8 parabolic “cosine-like” waves in [-1, +1]
-struct LFO8Parabolic {
-    PhaseAcc ph;
-    float depth{1.0f};
-    // phase offsets: 0, 1/8, 2/8, 3/8, 4/8, 5/8, 6/8, 7/8
-    static constexpr float offs[8] = {
-        0.0f, 0.125f, 0.25f, 0.375f, 0.5f, 0.625f, 0.75f, 0.875f
-    };
-
-    void setSR(float s){ ph.setSR(s); }
-    void reset(float p0=0.f){ ph.p = fracf(p0); }
-
-    // Advance with frequency (Hz) and compute all 8 outputs.
-    // Returns an array of 8 floats in [-depth, +depth].
-    std::array<float,8> process(float hz){
-        float p = ph.step(hz);
-        std::array<float,8> y{};
-        for (int i = 0; i < 8; ++i) {
-            float t = wrap_tri(p + offs[i]);     // [0,0.5]
-            float u = par_shape(t);              // [0,1]
-            y[i] = depth * (2.0f*u - 1.0f);      // → [-1,1] then scale
-        }
-        return y;
-    }
-};
-
 // ===== dB -> linear =========================================================
 inline float db2lin(float dB) noexcept { return expf(0.11512925464970229f * dB); }
 
@@ -95,7 +45,7 @@ inline float rt60_to_AF(float DT_sec, float RT60_sec) noexcept {
 
 // ===== Your DelayH / Shelves / Diffuser (paste from your post) =============
 // (BEGIN paste region)
-inline float clipDelay(float x) { return std::clamp(x, 0.0f, 192000.0f - 2.0f); }
+inline float clipDelay(float x, int N = 192000) { return std::clamp(x, 0.0f, float(N) - 2.0f); }
 inline std::pair<float,float> intfract(float x){ float i; float f = modff(x, &i); return {i,f}; }
 inline float interp4(float xm1,float x0,float x1,float x2,float t){
     float a0 = -0.5f*xm1 + 1.5f*x0 - 1.5f*x1 + 0.5f*x2;
@@ -103,13 +53,20 @@ inline float interp4(float xm1,float x0,float x1,float x2,float t){
     float a2 = -0.5f*xm1 + 0.5f*x1;
     return ((a0*t + a1)*t + a2)*t + x0;
 }
+// Longest delay in seconds: the original 192000 samples at 48 kHz, now
+// scaled with the sample rate (setSR) instead of fixed
+constexpr float kDelayHMaxSeconds = 4.0f;
 struct DelayH {
-    static constexpr int N = 192000;
-    std::array<float,N> buf{}; int w=0;
-    void clear(){ buf.fill(0.f); w=0; }
+    int N = 192000;
+    std::vector<float> buf = std::vector<float>(192000, 0.f); int w=0;
+    void setSR(float SR){
+        N = std::max(4, int(std::ceil(kDelayHMaxSeconds * SR)));
+        buf.assign(size_t(N), 0.f); w=0;
+    }
+    void clear(){ std::fill(buf.begin(), buf.end(), 0.f); w=0; }
     inline float process(float in, float T, float SR){
         buf[w] = in;
-        float dSmps = clipDelay(T * SR);
+        float dSmps = clipDelay(T * SR, N);
         float r = float(w) - dSmps;
         while (r < 0.f) r += float(N);
         while (r >= float(N)) r -= float(N);
@@ -120,6 +77,22 @@ struct DelayH {
         if (++w >= N) w = 0;
         return y;
     }
+    // Read T behind the next write, ahead of writing it (an allpass around
+    // the line needs the read first). At least 2 samples, so the cubic's
+    // taps never reach the slot about to be written
+    inline float read(float T, float SR) const {
+        float dSmps = std::max(clipDelay(T * SR, N), 2.0f);
+        float r = float(w) - dSmps;
+        while (r < 0.f) r += float(N);
+        auto [iFloat,t] = intfract(r);
+        int i0 = int(iFloat);
+        auto at = [&](int idx)->float{ if (idx<0) idx+=N; else if (idx>=N) idx-=N; return buf[idx]; };
+        return interp4(at(i0-1), at(i0), at(i0+1), at(i0+2), t);
+    }
+    inline void write(float in){
+        buf[w] = in;
+        if (++w >= N) w = 0;
+    }
 };
 
 inline float clipF(float F_hz, float SR) {
@@ -163,22 +136,24 @@ struct BiLin1P {
     inline float process(float x){ float y = b0*x + b1*x1 + a1*y1; x1=x; y1=y; return y; }
 };
 
-// Frequency-dependent allpass diffuser from your post
+// Frequency-dependent allpass diffuser from your post. The line is read
+// before it is written (kernels::allpassStep); the post fed the previous
+// output back in front of the delay, and that extra z^-1 made each
+// diffuser a comb that ran away at high Dffs
 struct Diffuser {
-    DelayH delay; BiLin1P hs, ls; float fb_state{0.f}; float SR{48000.f};
-    Diffuser(float sampleRate=48000.f): SR(sampleRate) {}
-    void clear(){ delay.clear(); hs.reset(); ls.reset(); fb_state=0.f; }
+    DelayH delay; BiLin1P hs, ls; float SR{48000.f};
+    Diffuser(float sampleRate=48000.f): SR(sampleRate) { delay.setSR(SR); }
+    void setSampleRate(float sampleRate){ SR = sampleRate; delay.setSR(SR); clear(); }
+    void clear(){ delay.clear(); hs.reset(); ls.reset(); }
     inline float process(float in, float T, float Dffs, float HF,float HB,float LF,float LB){
-        float P = fb_state * Dffs;
-        float z = in + P;
-        float delayed = delay.process(z, T, SR);
+        float delayed = delay.read(T, SR);
         hs.setCoeffs(setBL_HS(HF, HB, SR));
         float hs_out = hs.process(delayed);
         ls.setCoeffs(setBL_LS(LF, LB, SR));
         float x = ls.process(hs_out);
-        float m = in * (-Dffs);
-        float out = x + m;
-        fb_state = out;
+        float feed;
+        float out = kernels::allpassStep(in, x, Dffs, feed);
+        delay.write(feed);
         return out;
     }
 };
@@ -210,7 +185,8 @@ struct LateDiffTank {
 
     void setSampleRate(float sr){
         SR = std::max(1.f, sr);
-        d1.SR = SR; d2.SR = SR; d3.SR = SR;
+        d1.setSampleRate(SR); d2.setSampleRate(SR); d3.setSampleRate(SR);
+        fbDelay.setSR(SR);
         s1.setSR(SR); s2.setSR(SR); s3.setSR(SR); s4.setSR(SR);
         s1.setHalf(0.05f); s2.setHalf(0.05f); s3.setHalf(0.05f); s4.setHalf(0.05f);
         fbDelay.clear(); fbHS.reset(); fbLS.reset();
@@ -232,6 +208,19 @@ struct LateDiffTank {
                          float Sz, float Dffs, float RT60,
                          float hfHz, float hb_dB, float lfHz, float lb_dB,
                          float M1=0.f, float M2=0.f, float M3=0.f, float M4=0.f)
+    {
+        return processWithFeedback(x, fbSample, Sz, Dffs, RT60, hfHz, hb_dB, lfHz, lb_dB, M1, M2, M3, M4);
+    }
+
+    // Same, with the feedback taken from outside: a stereo pair swaps
+    // feedback (each side gets the other's fbSample from the previous
+    // sample), a figure-eight whose cross-coupling decays with the RT60
+    // gain. Adding each side's output to the other's input on top of its
+    // own feedback runs away
+    inline float processWithFeedback(float x, float feedback,
+                                     float Sz, float Dffs, float RT60,
+                                     float hfHz, float hb_dB, float lfHz, float lb_dB,
+                                     float M1=0.f, float M2=0.f, float M3=0.f, float M4=0.f)
     {
         HF = hfHz; HB = hb_dB; LF = lfHz; LB = lb_dB;
 
@@ -242,7 +231,7 @@ struct LateDiffTank {
         float T4 = s4.process(p2t(Sz + 0.0f)) + M4; // feedback delay time
 
         // ---- input node (external in + previous feedback)
-        float in = x + fbSample;
+        float in = x + feedback;
 
         // ---- three serial diffusers (frequency-dependent allpass)
         float y = d1.process(in, T1, Dffs, HF, HB, LF, LB);
@@ -21,13 +21,12 @@
 #define PREROLL_SEC 0.30f // unrecorded preroll to settle smoothers
 // ========================================================================
 
-// Stereo late-diffusion with 8-phase LFO + z^-1 cross-feedback
+// Stereo late-diffusion with 8-phase LFO + swapped feedback (figure-eight)
 struct StereoLateDiff {
     float SRf{float(SR)};
     LateDiffTank L{SRf}, R{SRf};
     LFO8Parabolic lfo;
     SmoothHalfLife sSize, sSym;
-    float zL{0.f}, zR{0.f};
 
     StereoLateDiff(){ setSampleRate(SRf); }
     void setSampleRate(float sr){
@@ -39,7 +38,6 @@ struct StereoLateDiff {
     }
     void clear(){
         L.clear(); R.clear(); lfo.reset(0.f);
-        zL = zR = 0.f;
         sSize.reset(0.f); sSym.reset(0.f);
     }
 
@@ -59,14 +57,12 @@ struct StereoLateDiff {
         const float M1 = MODA * ph[0], M2 = MODA * ph[1], M3 = MODA * ph[2], M4 = MODA * ph[3];
         const float M5 = MODA * ph[4], M6 = MODA * ph[5], M7 = MODA * ph[6], M8 = MODA * ph[7];
 
-        // Cross-feedback (one-sample delay, unity)
-        const float inLx = inL + zR;
-        const float inRx = inR + zL;
+        // Cross-feedback: each side takes the other's feedback in place of its own
+        const float fbL = L.fbSample, fbR = R.fbSample;
 
-        const float yL = L.process(inLx, SzL, DFFS, RT60, HF, HB, LF, LB, M1, M2, M3, M4);
-        const float yR = R.process(inRx, SzR, DFFS, RT60, HF, HB, LF, LB, M5, M6, M7, M8);
+        const float yL = L.processWithFeedback(inL, fbR, SzL, DFFS, RT60, HF, HB, LF, LB, M1, M2, M3, M4);
+        const float yR = R.processWithFeedback(inR, fbL, SzR, DFFS, RT60, HF, HB, LF, LB, M5, M6, M7, M8);
 
-        zL = yL; zR = yR;
         outL = yL; outR = yR;
     }
 };
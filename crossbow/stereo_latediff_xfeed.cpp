@@ -4,15 +4,13 @@
 
 #define SLD_DEMO  // Define to enable main() demo at bottom
 
-// Stereo late-diffusion with 8-phase LFO and cross-feedback (z^-1)
+// Stereo late-diffusion with 8-phase LFO and cross-feedback: the tanks swap
+// feedback paths (a figure-eight), so the coupling decays with the RT60 gain
 struct StereoLateDiff {
     float SR{48000.f};
     LateDiffTank L{SR}, R{SR};
     LFO8Parabolic lfo;
 
-    // z^-1 states for crossfeed (delayed by one sample)
-    float zL{0.f}, zR{0.f};
-
     // Parameter smoothers (to mirror your Smooth 50 ms)
     SmoothHalfLife sSize, sSym;
 
@@ -29,7 +27,6 @@ struct StereoLateDiff {
 
     void clear(){
         L.clear(); R.clear(); lfo.reset(0.f);
-        zL = zR = 0.f;
         sSize.reset(0.f); sSym.reset(0.f);
     }
 
@@ -64,18 +61,13 @@ struct StereoLateDiff {
         float M7 = modDepth_sec * ph[6];
         float M8 = modDepth_sec * ph[7];
 
-        // --- External cross-feedback (one-sample delay, unity gain)
-        // L input gets delayed right output; R input gets delayed left output.
-        float inLx = inL + zR;
-        float inRx = inR + zL;
+        // --- Cross-feedback: L takes R's feedback and R takes L's, both
+        // from the previous sample, in place of their own
+        const float fbL = L.fbSample, fbR = R.fbSample;
 
         // --- Process tanks
-        float yL = L.process(inLx, SzL, dffs, rt60_sec, hf, hb_dB, lf, lb_dB, M1, M2, M3, M4);
-        float yR = R.process(inRx, SzR, dffs, rt60_sec, hf, hb_dB, lf, lb_dB, M5, M6, M7, M8);
-
-        // --- Update z^-1 states AFTER using them this sample
-        zL = yL;
-        zR = yR;
+        float yL = L.processWithFeedback(inL, fbR, SzL, dffs, rt60_sec, hf, hb_dB, lf, lb_dB, M1, M2, M3, M4);
+        float yR = R.processWithFeedback(inR, fbL, SzR, dffs, rt60_sec, hf, hb_dB, lf, lb_dB, M5, M6, M7, M8);
 
         outL = yL;
         outR = yR;
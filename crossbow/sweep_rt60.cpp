@@ -0,0 +1,280 @@
+// sweep_rt60.cpp - Parallel parameter sweep for the LateDiff tank
+//
+// Renders the impulse response of every point of a parameter grid, spread over
+// all cores, and measures each one the way test_latediff_energy.cpp does
+// (Schroeder backward integration). One CSV row per point, in grid order.
+//
+// The tank's loop gain is rt60_to_AF of the feedback delay T4 alone, applied
+// once per trip round the whole loop (T1 + T2 + T3 + T4), so its tail falls
+// 60 dB in RT60 * loop / T4 rather than RT60. That figure is the loop_rt60
+// column; the render length and t30_error_pct are taken from it, as the
+// harness's Schroeder check does.
+//
+// Compile: g++ -O2 -std=c++17 -pthread sweep_rt60.cpp -o sweep_rt60
+//
+// Usage:   ./sweep_rt60 [param=list ...] [-j threads] [-o out.csv] [-l length]
+//   list is comma separated values (rt60=0.5,1.5,3) or start:stop:step
+//   (size=0.1:0.9:0.2). Parameters and their defaults when not swept:
+//     size  0.5    knob [0..1], mapped with mapSize01ToLTsemi
+//     dffs  0.7    diffusion [0..1]
+//     rt60  1.5    target RT60, seconds
+//     hf    8000   high shelf Hz      hb  -3   high shelf dB
+//     lf    200    low shelf Hz       lb   0   low shelf dB
+//     modf  0      LFO rate Hz        moda 0   delay modulation depth, seconds
+//   -j  worker threads (default: all cores)
+//   -o  CSV path (default: rt60_sweep.csv, "-" for stdout)
+//   -l  render length as a multiple of loop_rt60 (default 1.5, 1-60 s)
+//
+// Example: ./sweep_rt60 size=0.1:0.9:0.1 rt60=0.5,1,2,4 hb=-6,-3,0 -o tune.csv
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+#include "latediff_tank.hpp"
+
+static const float SR = 48000.0f;
+static const float PREROLL_SEC = 1.0f;    // settle the time smoothers (20 half-lives)
+static const float MIN_SECONDS = 1.0f;
+static const float MAX_SECONDS = 60.0f;
+
+// ======================= Grid ==============================================
+enum Param { SIZE, DFFS, RT60, HF, HB, LF, LB, MODF, MODA, NUM_PARAMS };
+
+static const char* const kNames[NUM_PARAMS] = {
+    "size", "dffs", "rt60", "hf", "hb", "lf", "lb", "modf", "moda"
+};
+static const float kDefaults[NUM_PARAMS] = {
+    0.5f, 0.7f, 1.5f, 8000.0f, -3.0f, 200.0f, 0.0f, 0.0f, 0.0f
+};
+
+struct Point { float v[NUM_PARAMS]; };
+
+// "a,b,c" or "start:stop:step"; false on a malformed list
+static bool parse_values(const char* text, std::vector<float>& out) {
+    out.clear();
+    if (std::strchr(text, ':')) {
+        float start, stop, step;
+        if (std::sscanf(text, "%f:%f:%f", &start, &stop, &step) != 3 || step <= 0.0f || stop < start)
+            return false;
+        // Count steps rather than accumulate, so the last value lands on stop
+        const int n = int(std::floor((stop - start) / step + 1e-4f)) + 1;
+        for (int i = 0; i < n; ++i) out.push_back(start + step * float(i));
+        return true;
+    }
+    std::string s(text);
+    size_t pos = 0;
+    while (pos <= s.size()) {
+        size_t comma = s.find(',', pos);
+        if (comma == std::string::npos) comma = s.size();
+        char* end = nullptr;
+        const std::string item = s.substr(pos, comma - pos);
+        const float v = std::strtof(item.c_str(), &end);
+        if (item.empty() || *end != '\0') return false;
+        out.push_back(v);
+        pos = comma + 1;
+    }
+    return !out.empty();
+}
+
+// Cartesian product, first parameter slowest (odometer over the axes)
+static std::vector<Point> expand(const std::vector<float> (&axes)[NUM_PARAMS]) {
+    size_t count = 1;
+    for (int p = 0; p < NUM_PARAMS; ++p) count *= axes[p].size();
+    std::vector<Point> points;
+    points.reserve(count);
+    size_t idx[NUM_PARAMS] = {};
+    for (size_t n = 0; n < count; ++n) {
+        Point pt;
+        for (int p = 0; p < NUM_PARAMS; ++p) pt.v[p] = axes[p][idx[p]];
+        points.push_back(pt);
+        for (int p = NUM_PARAMS - 1; p >= 0; --p) {
+            if (++idx[p] < axes[p].size()) break;
+            idx[p] = 0;
+        }
+    }
+    return points;
+}
+
+// ======================= Measurement =======================================
+struct Result {
+    bool  stable{true};
+    float loop_rt60{0.f};     // RT60 * loop / T4: the decay the loop gain sets
+    float seconds{0.f};
+    float peak{0.f};
+    float energy_1s{0.f};     // sum of squares over the first second
+    float t60_crossing{NAN};  // Schroeder curve reaches -60 dB (NaN if it doesn't)
+    float t30{NAN};           // -60 / slope of the -5..-35 dB fit
+    float t20{NAN};           // -60 / slope of the -5..-25 dB fit
+    float edt{NAN};           // -60 / slope of the 0..-10 dB fit
+    float edc_100ms{NAN}, edc_500ms{NAN}, edc_1s{NAN};   // Schroeder level, dB
+};
+
+// Slope (dB/s) of the least-squares line through edc between two levels
+static float fit_slope(const std::vector<float>& edc, float from_dB, float to_dB) {
+    int start = -1, end = -1;
+    for (int i = 0; i < (int)edc.size(); ++i) {
+        if (start < 0 && edc[i] <= from_dB) start = i;
+        if (edc[i] <= to_dB) { end = i; break; }
+    }
+    if (start < 0 || end - start < 2) return NAN;
+    double st = 0, sy = 0, stt = 0, sty = 0;
+    const int n = end - start;
+    for (int i = start; i < end; ++i) {
+        const double t = i / SR, y = edc[i];
+        st += t; sy += y; stt += t * t; sty += t * y;
+    }
+    return float((n * sty - st * sy) / (n * stt - st * st));
+}
+
+static float rt_from_slope(float slope) {
+    return (std::isfinite(slope) && slope < 0.f) ? -60.0f / slope : NAN;
+}
+
+// Render one point and measure it. ir is the worker's scratch buffer
+static Result measure(const Point& pt, float lengthFactor, std::vector<float>& ir) {
+    const float* v = pt.v;
+    const float Sz = mapSize01ToLTsemi(v[SIZE]);
+
+    LateDiffTank tank(SR);
+    LFO8Parabolic lfo;
+    lfo.setSR(SR);
+    tank.clear();
+
+    auto step = [&](float x) {
+        const auto ph = lfo.process(v[MODF]);
+        const float a = v[MODA];
+        return tank.process(x, Sz, v[DFFS], v[RT60], v[HF], v[HB], v[LF], v[LB],
+                            a * ph[0], a * ph[1], a * ph[2], a * ph[3]);
+    };
+
+    for (int i = 0; i < int(PREROLL_SEC * SR); ++i) step(0.f);
+
+    Result r;
+    const float T4 = p2t(Sz);
+    r.loop_rt60 = v[RT60] * (p2t(Sz + 9.f) + p2t(Sz + 6.f) + p2t(Sz + 3.f) + T4) / T4;
+    r.seconds = std::clamp(lengthFactor * r.loop_rt60, MIN_SECONDS, MAX_SECONDS);
+    const int total = int(r.seconds * SR);
+    ir.resize(size_t(total));
+    for (int n = 0; n < total; ++n) {
+        const float out = step(n == 0 ? 1.f : 0.f);
+        // Same runaway limit as test_realistic_params.cpp
+        if (!std::isfinite(out) || std::fabs(out) > 100.f) { r.stable = false; return r; }
+        ir[n] = out;
+        r.peak = std::max(r.peak, std::fabs(out));
+        if (n < int(SR)) r.energy_1s += out * out;
+    }
+
+    // Schroeder backward integration, in place, then dB re the total
+    double sum = 0.0;
+    for (int i = total - 1; i >= 0; --i) { sum += double(ir[i]) * ir[i]; ir[i] = float(sum); }
+    const double E0 = sum;
+    if (E0 <= 1e-20) return r;
+    for (int i = 0; i < total; ++i) ir[i] = float(10.0 * std::log10(std::max(double(ir[i]), 1e-30) / E0));
+
+    // Crossing, past the first 10 ms of onset
+    for (int i = std::max(1, int(0.01f * SR)); i < total; ++i) {
+        if (ir[i] <= -60.f) {
+            const float alpha = (-60.f - ir[i - 1]) / (ir[i] - ir[i - 1]);
+            r.t60_crossing = (float(i - 1) + alpha) / SR;
+            break;
+        }
+    }
+    r.t30 = rt_from_slope(fit_slope(ir, -5.f, -35.f));
+    r.t20 = rt_from_slope(fit_slope(ir, -5.f, -25.f));
+    r.edt = rt_from_slope(fit_slope(ir, 0.f, -10.f));
+    auto at = [&](float t) { const int i = int(t * SR); return i < total ? ir[i] : NAN; };
+    r.edc_100ms = at(0.1f);
+    r.edc_500ms = at(0.5f);
+    r.edc_1s = at(1.0f);
+    return r;
+}
+
+// ======================= Main ==============================================
+static void usage() {
+    std::fprintf(stderr,
+        "usage: sweep_rt60 [param=list ...] [-j threads] [-o out.csv] [-l length]\n"
+        "  params: size dffs rt60 hf hb lf lb modf moda\n"
+        "  list:   v1,v2,... or start:stop:step\n");
+}
+
+int main(int argc, char** argv) {
+    std::vector<float> axes[NUM_PARAMS];
+    for (int p = 0; p < NUM_PARAMS; ++p) axes[p] = {kDefaults[p]};
+    int threads = int(std::thread::hardware_concurrency());
+    std::string outPath = "rt60_sweep.csv";
+    float lengthFactor = 1.5f;
+
+    for (int i = 1; i < argc; ++i) {
+        const char* arg = argv[i];
+        if (!std::strcmp(arg, "-j") && i + 1 < argc) { threads = std::atoi(argv[++i]); continue; }
+        if (!std::strcmp(arg, "-o") && i + 1 < argc) { outPath = argv[++i]; continue; }
+        if (!std::strcmp(arg, "-l") && i + 1 < argc) { lengthFactor = std::strtof(argv[++i], nullptr); continue; }
+        const char* eq = std::strchr(arg, '=');
+        int p = NUM_PARAMS;
+        if (eq) {
+            for (p = 0; p < NUM_PARAMS; ++p) {
+                if (std::strlen(kNames[p]) == size_t(eq - arg) && !std::strncmp(arg, kNames[p], eq - arg)) break;
+            }
+        }
+        if (p == NUM_PARAMS || !parse_values(eq + 1, axes[p])) {
+            std::fprintf(stderr, "bad argument: %s\n", arg);
+            usage();
+            return 2;
+        }
+    }
+    threads = std::max(1, threads);
+    if (!(lengthFactor > 0.f)) lengthFactor = 1.5f;
+
+    const std::vector<Point> points = expand(axes);
+    std::vector<Result> results(points.size());
+    threads = std::min(threads, int(points.size()));
+    std::fprintf(stderr, "sweep_rt60: %zu points on %d threads\n", points.size(), threads);
+
+    // Workers pull the next point index; each keeps one IR buffer for all
+    // its points, and results land in grid order
+    std::atomic<size_t> next{0};
+    std::atomic<size_t> done{0};
+    const auto start = std::chrono::steady_clock::now();
+    auto worker = [&]() {
+        std::vector<float> ir;
+        for (size_t i; (i = next.fetch_add(1)) < points.size();) {
+            results[i] = measure(points[i], lengthFactor, ir);
+            const size_t d = done.fetch_add(1) + 1;
+            if (d % 16 == 0 || d == points.size())
+                std::fprintf(stderr, "\r  %zu / %zu", d, points.size());
+        }
+    };
+    std::vector<std::thread> pool;
+    for (int t = 1; t < threads; ++t) pool.emplace_back(worker);
+    worker();
+    for (auto& t : pool) t.join();
+    const double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    FILE* f = outPath == "-" ? stdout : std::fopen(outPath.c_str(), "w");
+    if (!f) { std::perror(outPath.c_str()); return 1; }
+    for (int p = 0; p < NUM_PARAMS; ++p) std::fprintf(f, "%s,", kNames[p]);
+    std::fprintf(f, "sz,loop_rt60,seconds,stable,peak,energy_1s,t60_crossing,t30,t20,edt,"
+                    "t30_error_pct,edc_100ms,edc_500ms,edc_1s\n");
+    for (size_t i = 0; i < points.size(); ++i) {
+        const float* v = points[i].v;
+        const Result& r = results[i];
+        for (int p = 0; p < NUM_PARAMS; ++p) std::fprintf(f, "%g,", v[p]);
+        const float err = 100.f * (r.t30 - r.loop_rt60) / r.loop_rt60;
+        std::fprintf(f, "%g,%g,%g,%d,%g,%g,%g,%g,%g,%g,%g,%g,%g,%g\n",
+                     mapSize01ToLTsemi(v[SIZE]), r.loop_rt60, r.seconds, r.stable ? 1 : 0, r.peak, r.energy_1s,
+                     r.t60_crossing, r.t30, r.t20, r.edt, err, r.edc_100ms, r.edc_500ms, r.edc_1s);
+    }
+    if (f != stdout) std::fclose(f);
+
+    int unstable = 0;
+    for (const Result& r : results) unstable += r.stable ? 0 : 1;
+    std::fprintf(stderr, "\n  %.1f s, %d unstable%s%s\n", elapsed, unstable,
+                 outPath == "-" ? "" : ", wrote ", outPath == "-" ? "" : outPath.c_str());
+    return 0;
+}
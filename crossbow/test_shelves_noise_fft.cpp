@@ -5,8 +5,8 @@
 #include <cmath>
 #include <cstdio>
 #include <vector>
-#include <complex>
 #include <utility>
+#include "../shared/dsp/real_fft.h"
 
 // ================= Core-faithful helpers =================
 static constexpr float kSR = 48000.0f;
@@ -80,40 +80,6 @@ struct BiLin1P {
     }
 };
 
-// ================= FFT =================
-struct FFT {
-    int N = 0;
-    std::vector<std::complex<double>> tw;
-    void init(int n){
-        N = n; tw.resize(N);
-        const double twoPiOverN = -2.0*M_PI/N;
-        for(int k=0;k<N;++k) tw[k] = std::polar(1.0, twoPiOverN*k);
-    }
-    void run(std::vector<std::complex<double>>& a) const {
-        // bit-reverse
-        int j=0;
-        for(int i=1;i<N;i++){
-            int bit = N>>1;
-            for(; j&bit; bit>>=1) j ^= bit;
-            j ^= bit;
-            if(i<j) std::swap(a[i],a[j]);
-        }
-        for(int len=2; len<=N; len<<=1){
-            int half=len>>1; int step=N/len;
-            for(int i=0;i<N;i+=len){
-                int k=0;
-                for(int j2=0;j2<half;++j2){
-                    auto u = a[i+j2];
-                    auto v = a[i+j2+half] * tw[k];
-                    a[i+j2]      = u + v;
-                    a[i+j2+half] = u - v;
-                    k += step;
-                }
-            }
-        }
-    }
-};
-
 // ================= ASCII plot =================
 static void ascii_plot(const char* title,
                        const std::vector<double>& dB,
@@ -172,17 +138,14 @@ int main(){
         }
         
         // FFT to get frequency response
-        std::vector<std::complex<double>> H(N);
-        for(int n=0; n<N; ++n) H[n] = std::complex<double>(h[n], 0.0);
-        
-        FFT fft;
-        fft.init(N);
-        fft.run(H);
+        std::vector<float> re(N/2 + 1), im(N/2 + 1);
+        kernels::RealFFT fft(N);
+        fft.forward(h.data(), re.data(), im.data());
         
         // Convert to magnitude in dB (one-sided spectrum)
         std::vector<double> mag_db(N/2 + 1);
         for(int k=0; k<=N/2; ++k){
-            double mag = std::abs(H[k]);
+            double mag = std::hypot((double)re[k], (double)im[k]);
             mag_db[k] = 20.0 * std::log10(std::max(mag, 1e-20));
         }
         
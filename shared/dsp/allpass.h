@@ -0,0 +1,24 @@
+// Allpass step shared by the late-diffusion tanks in wakefield and crossbow.
+//
+// A Schroeder allpass around a delay line, with whatever filtering the
+// caller runs on the line's output: the caller reads the line, passes the
+// read in here and writes feed back into the line. The read has to come
+// before the write. Feeding back the previous sample's output instead puts
+// an extra z^-1 in the loop, which turns the allpass into a comb with gain
+// up to (1 + g) / (1 - g).
+//
+// Templated like one_pole.h: float, double or a GCC vector of lanes, with a
+// scalar or per-lane gain.
+#pragma once
+
+namespace kernels {
+
+// out = delayed - g * in; feed = in + g * out
+template <typename T, typename K>
+inline T allpassStep(T in, T delayed, K g, T& feed) {
+    const T out = delayed - in * g;
+    feed = in + out * g;
+    return out;
+}
+
+} // namespace kernels
@@ -0,0 +1,62 @@
+// 8-phase parabolic LFO shared by the crossbow tank and its tests, in float
+// or double. wakefield's LateDiffTank runs its own control-rate copy.
+#pragma once
+#include <array>
+#include <cmath>
+
+namespace kernels {
+
+// frac(x) in [0,1)
+template <typename T>
+inline T frac(T x) noexcept { return x - std::floor(x); }
+
+// Triangle distance to nearest integer in [0, 0.5]
+template <typename T>
+inline T wrapTri(T p) noexcept {
+    const T f = frac(p);
+    return f <= T(0.5) ? f : (T(1) - f);
+}
+
+// Parabolic "raised-cosine" shaper on [0, 0.5] -> [0, 1]
+template <typename T>
+inline T parShape(T t) noexcept {
+    // y = t * (8 - 16*t) = 1 - 16*(t - 0.25)^2
+    return t * (T(8) - T(16) * t);
+}
+
+// Phase accumulator with smoothable Hz input outside this class.
+// p is kept in [0,1).
+template <typename T>
+struct PhaseAcc {
+    T p{0}, sr{48000};
+    void setSR(T s) { sr = s > T(1) ? s : T(1); }
+    inline T step(T hz) {
+        p += hz / sr;
+        p -= std::floor(p);
+        return p;
+    }
+};
+
+// 8-phase LFO: outputs 8 parabolic "cosine-like" waves in [-depth, +depth],
+// phase offsets 0, 1/8, ..., 7/8
+template <typename T>
+struct LFO8Parabolic {
+    PhaseAcc<T> ph;
+    T depth{1};
+
+    void setSR(T s) { ph.setSR(s); }
+    void reset(T p0 = T(0)) { ph.p = frac(p0); }
+
+    // Advance with frequency (Hz) and compute all 8 outputs
+    std::array<T, 8> process(T hz) {
+        const T p = ph.step(hz);
+        std::array<T, 8> y{};
+        for (int i = 0; i < 8; ++i) {
+            const T u = parShape(wrapTri(p + T(i) * T(0.125)));
+            y[i] = depth * (T(2) * u - T(1));
+        }
+        return y;
+    }
+};
+
+} // namespace kernels
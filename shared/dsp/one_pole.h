@@ -0,0 +1,95 @@
+// First-order kernels shared by wakefield, crossbow and lung.
+//
+// Each kernel is one sample of one filter on caller-owned state, templated
+// on the sample type T and the coefficient type K:
+//
+//   float / double    the desktop and bench builds
+//   Lanes<T, N>::type N channels in one GCC vector, coefficients as scalars
+//   Q15 (q15.h)       lung on the RP2350, with Q15Gain coefficients (or
+//                     Q15LagWeights for the dual-MAC lag)
+//
+// The expressions keep the operation order of the filters they came from,
+// so a float caller is bit-identical to its old inline loop. Coefficient
+// design (prewarp, tan approximation) stays with each caller.
+#pragma once
+#include "q15.h"
+
+namespace kernels {
+
+// N lanes of T as a GCC vector; N == 1 is plain T
+template <typename T, int N>
+struct Lanes {
+    typedef T type __attribute__((vector_size(sizeof(T) * N)));
+};
+
+template <typename T>
+struct Lanes<T, 1> {
+    typedef T type;
+};
+
+// Exponential lag s += (x - s) * k, k in [0, 1]; returns the new state
+template <typename T, typename K>
+inline T onePoleLag(T& s, T x, K k) {
+    s = s + (x - s) * k;
+    return s;
+}
+
+// Q15 lag with packed weights: s * (32768 - k) + x * k, >> 15, which is one
+// SMLAD on {s, x} with the DSP extension. Bit-identical to the generic
+// form with Q15Gain k: s * 32768 is a whole multiple of 32768, so the
+// floor of the sum is s plus the floor of (x - s) * k / 32768
+inline Q15 onePoleLag(Q15& s, Q15 x, Q15LagWeights w) {
+    const uint32_t pair = (uint16_t)s.v | ((uint32_t)(uint16_t)x.v << 16);
+#if defined(__ARM_FEATURE_SIMD32)
+    const int32_t sum = __smlad(pair, w.v, 0);
+#else
+    const int32_t sum = (int32_t)(int16_t)(pair & 0xFFFF) * (int32_t)(w.v & 0xFFFF) +
+                        (int32_t)(int16_t)(pair >> 16) * (int32_t)(w.v >> 16);
+#endif
+    s = Q15((int16_t)(sum >> 15));
+    return s;
+}
+
+// Trapezoidal (TPT) integrator with k = g/(1+g); returns the lowpass,
+// x - lowpass is the complementary highpass
+template <typename T, typename K>
+inline T onePoleTPT(T& s, T x, K k) {
+    const T v = (x - s) * k;
+    const T lp = v + s;
+    s = lp + v;
+    return lp;
+}
+
+// First-order section in transposed direct form II (one state)
+template <typename T, typename K>
+inline T firstOrderTDF2(T& s1, T x, K b0, K b1, K a1) {
+    const T y = b0 * x + s1;
+    s1 = b1 * x - a1 * y;
+    return y;
+}
+
+// TPT integrator gain for a prewarped g = tan(pi*fc/fs)
+template <typename K>
+inline K tptGain(K g) {
+    return g * (K(1) / (K(1) + g));
+}
+
+// Bilinear one-pole shelves for a prewarped g; A is the linear gain of the
+// shelved band (high frequencies for the high shelf, DC for the low shelf)
+template <typename K>
+inline void highShelfBLT(K g, K A, K& b0, K& b1, K& a1) {
+    const K inv = K(1) / (K(1) + g + K(1e-30));
+    a1 = (g - K(1)) * inv;
+    b0 = (A + g) * inv;
+    b1 = -(A - g) * inv;
+}
+
+template <typename K>
+inline void lowShelfBLT(K g, K A, K& b0, K& b1, K& a1) {
+    const K inv = K(1) / (K(1) + g + K(1e-30));
+    a1 = (g - K(1)) * inv;
+    b0 = (K(1) + A * g) * inv;
+    b1 = (A * g - K(1)) * inv;
+}
+
+} // namespace kernels
@@ -0,0 +1,76 @@
+// Q15 fixed-point sample type for the shared kernels (one_pole.h).
+//
+// A Q15 is a 16-bit sample (-32768 .. 32767 for -1 .. 1). Differences widen
+// to 32 bits (Q15Diff) and are scaled by an unsigned 0 .. 32767 gain
+// (Q15Gain, >> 15) through a 64-bit product, then truncated back to 16 bits
+// when added to a sample. That is the arithmetic lung's ladder poles always
+// used, so a kernel written as s + (x - s) * k runs the same on float,
+// double and Q15.
+//
+// With the Armv8-M DSP extension (RP2350's Cortex-M33) the 16-bit SIMD
+// instructions come in through arm_acle.h; other targets use plain C with
+// the same results.
+#pragma once
+#include <stdint.h>
+#if defined(__ARM_FEATURE_SIMD32) || defined(__ARM_FEATURE_SAT)
+#include <arm_acle.h>
+#endif
+
+namespace kernels {
+
+struct Q15Diff {
+    int32_t v;
+};
+
+struct Q15Gain {
+    uint16_t v;
+};
+
+// A gain k of 1 .. 32767 packed with 32768 - k as two halfwords, the
+// weights of the dual-MAC lag in one_pole.h. Built once per gain change
+struct Q15LagWeights {
+    uint32_t v;
+
+    explicit Q15LagWeights(Q15Gain k) : v(((uint32_t)k.v << 16) | (32768u - k.v)) {}
+};
+
+struct Q15 {
+    int16_t v;
+
+    Q15() : v(0) {}
+    explicit Q15(int16_t raw) : v(raw) {}
+};
+
+inline Q15Diff operator-(Q15 a, Q15 b) {
+    return Q15Diff{(int32_t)a.v - (int32_t)b.v};
+}
+
+inline Q15Diff operator*(Q15Diff d, Q15Gain k) {
+    return Q15Diff{(int32_t)(((int64_t)d.v * (int64_t)k.v) >> 15)};
+}
+
+// Wraps like the int16_t assignment it replaces
+inline Q15 operator+(Q15 a, Q15Diff d) {
+    return Q15((int16_t)(a.v + (int16_t)d.v));
+}
+
+// A 32-bit intermediate clamped to the Q15 range (one SSAT where available)
+inline int16_t saturateQ15(int32_t v) {
+#if defined(__ARM_FEATURE_SAT)
+    return (int16_t)__ssat(v, 16);
+#else
+    if (v > 32767) v = 32767;
+    if (v < -32768) v = -32768;
+    return (int16_t)v;
+#endif
+}
+
+// a - b clamped to the Q15 range, for complementary (highpass) outputs
+inline Q15 subSaturate(Q15 a, Q15 b) {
+    int32_t r = (int32_t)a.v - (int32_t)b.v;
+    if (r > 32767) r = 32767;
+    if (r < -32768) r = -32768;
+    return Q15((int16_t)r);
+}
+
+} // namespace kernels
@@ -0,0 +1,234 @@
+// Real-input FFT shared by wakefield (convolution reverb, spectrum page,
+// latency probe) and the crossbow test tools.
+//
+// A transform of a power-of-two size n runs as an n/2-point complex FFT
+// plus a split step. The complex FFT works on planar arrays (real parts and
+// imaginary parts apart): bit reversal, a radix-2 stage when log2(n/2) is
+// odd, then radix-4 stages, each three complex multiplies per four points
+// where two radix-2 stages take four. From a quarter span of four up, the
+// butterflies run four at a time in GCC vectors, which build to SSE on x86
+// and NEON on ARM.
+//
+// Bit reversal, twiddles and split factors live in an FFTPlan, built once
+// per size and shared by every RealFFT of that size. Building one allocates
+// and takes a lock; transforms do neither.
+#pragma once
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace kernels {
+
+struct FFTPlan {
+    int n = 0;
+    int half = 0;
+    std::vector<uint32_t> bitReverse;       // half entries
+    // Radix-4 stages, smallest first: for quarter span q, q entries of each
+    // of W^2j, W^j and W^3j (W = e^(-2 pi i / 4q)) as re then im rows
+    struct Stage {
+        int quarter;
+        size_t offset;                      // Into twiddles
+    };
+    std::vector<Stage> stages;
+    bool radix2First = false;               // log2(half) odd
+    std::vector<float> twiddles;
+    std::vector<float> splitRe, splitIm;    // e^(-2 pi i k / n), k <= half
+
+    explicit FFTPlan(int size)
+        : n(size)
+        , half(size / 2)
+        , bitReverse(size / 2)
+        , splitRe(size / 2 + 1)
+        , splitIm(size / 2 + 1) {
+        int bits = 0;
+        while ((1 << bits) < half) {
+            ++bits;
+        }
+        for (int i = 0; i < half; ++i) {
+            uint32_t reversed = 0;
+            for (int b = 0; b < bits; ++b) {
+                reversed |= static_cast<uint32_t>((i >> b) & 1) << (bits - 1 - b);
+            }
+            bitReverse[i] = reversed;
+        }
+
+        radix2First = (bits & 1) != 0;
+        for (int q = radix2First ? 2 : 1; 4 * q <= half; q *= 4) {
+            stages.push_back({q, twiddles.size()});
+            const double step = -2.0 * M_PI / (4.0 * q);
+            const int powers[3] = {2, 1, 3};
+            for (int power : powers) {
+                for (int j = 0; j < q; ++j) {
+                    twiddles.push_back(static_cast<float>(std::cos(step * power * j)));
+                }
+                for (int j = 0; j < q; ++j) {
+                    twiddles.push_back(static_cast<float>(std::sin(step * power * j)));
+                }
+            }
+        }
+
+        for (int k = 0; k <= half; ++k) {
+            splitRe[k] = static_cast<float>(std::cos(-2.0 * M_PI * k / n));
+            splitIm[k] = static_cast<float>(std::sin(-2.0 * M_PI * k / n));
+        }
+    }
+
+    // The shared plan for a size, built on first use. Not for the audio
+    // thread
+    static std::shared_ptr<const FFTPlan> get(int size) {
+        static std::mutex mutex;
+        static std::map<int, std::shared_ptr<const FFTPlan>> plans;
+        std::lock_guard<std::mutex> lock(mutex);
+        std::shared_ptr<const FFTPlan>& plan = plans[size];
+        if (!plan) {
+            plan = std::make_shared<const FFTPlan>(size);
+        }
+        return plan;
+    }
+};
+
+// Spectra are planar: bins 0 .. n/2 in re[] and im[]. Owns its work
+// buffers, so one instance serves one thread; instances of one size share
+// their plan.
+class RealFFT {
+public:
+    explicit RealFFT(int size)
+        : plan(FFTPlan::get(size))
+        , workRe(size / 2)
+        , workIm(size / 2) {}
+    int size() const { return plan->n; }
+
+    // n samples -> n/2 + 1 bins
+    void forward(const float* in, float* re, float* im) {
+        const int half = plan->half;
+        const uint32_t* reverse = plan->bitReverse.data();
+        // Even samples in the real parts, odd ones in the imaginary parts,
+        // loaded in bit-reversed order
+        for (int m = 0; m < half; ++m) {
+            workRe[reverse[m]] = in[2 * m];
+            workIm[reverse[m]] = in[2 * m + 1];
+        }
+        transform(workRe.data(), workIm.data());
+
+        // Untangle the even and odd spectra and combine them
+        const float* sr = plan->splitRe.data();
+        const float* si = plan->splitIm.data();
+        for (int k = 0; k <= half; ++k) {
+            const int a = k == half ? 0 : k;
+            const int b = k == 0 ? 0 : half - k;
+            const float zr = workRe[a], zi = workIm[a];
+            const float cr = workRe[b], ci = -workIm[b];
+            const float evenR = 0.5f * (zr + cr), evenI = 0.5f * (zi + ci);
+            // (z - zc) * -i/2
+            const float oddR = 0.5f * (zi - ci), oddI = -0.5f * (zr - cr);
+            re[k] = evenR + sr[k] * oddR - si[k] * oddI;
+            im[k] = evenI + sr[k] * oddI + si[k] * oddR;
+        }
+    }
+
+    // n/2 + 1 bins -> n samples, scaled by n/2 (fold 2/n into one side)
+    void inverse(const float* re, const float* im, float* out) {
+        const int half = plan->half;
+        const uint32_t* reverse = plan->bitReverse.data();
+        const float* sr = plan->splitRe.data();
+        const float* si = plan->splitIm.data();
+        for (int k = 0; k < half; ++k) {
+            const float xr = re[k], xi = im[k];
+            const float cr = re[half - k], ci = -im[half - k];
+            const float evenR = 0.5f * (xr + cr), evenI = 0.5f * (xi + ci);
+            // (x - xc) / 2 * conj(split)
+            const float dr = 0.5f * (xr - cr), di = 0.5f * (xi - ci);
+            const float oddR = dr * sr[k] + di * si[k];
+            const float oddI = di * sr[k] - dr * si[k];
+            // Conjugated, so the forward transform runs the inverse
+            workRe[reverse[k]] = evenR - oddI;
+            workIm[reverse[k]] = -(evenI + oddR);
+        }
+        transform(workRe.data(), workIm.data());
+        for (int m = 0; m < half; ++m) {
+            out[2 * m] = workRe[m];
+            out[2 * m + 1] = -workIm[m];
+        }
+    }
+
+private:
+    typedef float Vec4 __attribute__((vector_size(16), aligned(4)));
+
+    std::shared_ptr<const FFTPlan> plan;
+    std::vector<float> workRe;
+    std::vector<float> workIm;
+
+    static inline Vec4 load(const float* p) {
+        Vec4 v;
+        std::memcpy(&v, p, sizeof(v));
+        return v;
+    }
+    static inline void store(float* p, Vec4 v) { std::memcpy(p, &v, sizeof(v)); }
+
+    // In-place forward complex FFT of input already in bit-reversed order
+    void transform(float* re, float* im) const {
+        const int half = plan->half;
+        if (plan->radix2First) {
+            for (int i = 0; i < half; i += 2) {
+                const float ur = re[i], ui = im[i];
+                re[i] = ur + re[i + 1];
+                im[i] = ui + im[i + 1];
+                re[i + 1] = ur - re[i + 1];
+                im[i + 1] = ui - im[i + 1];
+            }
+        }
+        for (const FFTPlan::Stage& stage : plan->stages) {
+            const int q = stage.quarter;
+            const float* w = plan->twiddles.data() + stage.offset;
+            for (int i = 0; i < half; i += 4 * q) {
+                if (q >= 4) {
+                    for (int j = 0; j < q; j += 4) {
+                        radix4<Vec4>(re + i + j, im + i + j, q, w + j, load, store);
+                    }
+                } else {
+                    for (int j = 0; j < q; ++j) {
+                        radix4<float>(re + i + j, im + i + j, q, w + j,
+                                      [](const float* p) { return *p; },
+                                      [](float* p, float v) { *p = v; });
+                    }
+                }
+            }
+        }
+    }
+
+    // One radix-4 butterfly (or four, in vectors) on points 0, q, 2q, 3q:
+    // b1 = W^2j x1, b2 = W^j x2, b3 = W^3j x3, then
+    //   y0 = x0 + b1 + (b2 + b3)    y2 = x0 + b1 - (b2 + b3)
+    //   y1 = x0 - b1 - i (b2 - b3)  y3 = x0 - b1 + i (b2 - b3)
+    template <typename T, typename Load, typename Store>
+    static inline void radix4(float* re, float* im, int q, const float* w, Load ld, Store st) {
+        const T w1r = ld(w), w1i = ld(w + q);
+        const T w2r = ld(w + 2 * q), w2i = ld(w + 3 * q);
+        const T w3r = ld(w + 4 * q), w3i = ld(w + 5 * q);
+        const T x0r = ld(re), x0i = ld(im);
+        const T x1r = ld(re + q), x1i = ld(im + q);
+        const T x2r = ld(re + 2 * q), x2i = ld(im + 2 * q);
+        const T x3r = ld(re + 3 * q), x3i = ld(im + 3 * q);
+        const T b1r = x1r * w1r - x1i * w1i, b1i = x1r * w1i + x1i * w1r;
+        const T b2r = x2r * w2r - x2i * w2i, b2i = x2r * w2i + x2i * w2r;
+        const T b3r = x3r * w3r - x3i * w3i, b3i = x3r * w3i + x3i * w3r;
+        const T sr = x0r + b1r, si = x0i + b1i;
+        const T dr = x0r - b1r, di = x0i - b1i;
+        const T pr = b2r + b3r, pi = b2i + b3i;
+        const T mr = b2r - b3r, mi = b2i - b3i;
+        st(re, sr + pr);
+        st(im, si + pi);
+        st(re + 2 * q, sr - pr);
+        st(im + 2 * q, si - pi);
+        st(re + q, dr + mi);
+        st(im + q, di - mr);
+        st(re + 3 * q, dr - mi);
+        st(im + 3 * q, di + mr);
+    }
+};
+
+} // namespace kernels
@@ -0,0 +1,97 @@
+// Denormal check: an impulse followed by silence through the reverb and the
+// filters, timed per one-second window with and without ScopedDenormalGuard.
+//
+//   ./denormal_bench [seconds]   (default 30 s of audio)
+//
+// With the guard, the per-block cost must stay flat while the tails decay
+// into the subnormal range; exits non-zero if the slowest window is more
+// than 2x the first one.
+#include "denormal_guard.h"
+#include "envelope.h"
+#include "filters.hpp"
+#include "reverb.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+namespace {
+
+constexpr float kSampleRate = 48000.0f;
+constexpr int kBlockSize = 256;
+constexpr int kBlocksPerWindow = static_cast<int>(kSampleRate) / kBlockSize;
+
+// Returns slowest / first window time (ns per block)
+double runOnce(bool guarded, int windows) {
+    GreyholeReverb reverb(kSampleRate);
+    reverb.setTailGateEnabled(false);  // Keep the DSP running through the tail
+    reverb.setParameters({0.3f, 0.3f, 0.2f, 1.0f, 0.5f, 0.5f, 0.1f, 2.0f});
+
+    OnePoleTPT lowpass(kSampleRate);
+    lowpass.setCutoff(200.0f);
+    Ladder8PoleZdf ladder(kSampleRate);
+    ladder.setCutoff(800.0f);
+    ladder.setResonance(0.3f);
+    Envelope envelope(kSampleRate);
+    envelope.setRelease(30.0f);
+    envelope.noteOn();
+
+    float left[kBlockSize];
+    float right[kBlockSize];
+    std::vector<double> windowNs;
+    float sink = 0.0f;
+
+    for (int w = 0; w < windows; ++w) {
+        auto start = std::chrono::steady_clock::now();
+        for (int b = 0; b < kBlocksPerWindow; ++b) {
+            // One impulse in the first block seeds every tail
+            if (w == 0 && b == 1) {
+                envelope.noteOff();
+            }
+            for (int i = 0; i < kBlockSize; ++i) {
+                float x = (w == 0 && b == 0 && i == 0) ? 1.0f : 0.0f;
+                float env = envelope.process();
+                left[i] = ladder.process(lowpass.process(x).first) + x * env;
+                right[i] = x;
+            }
+
+            if (guarded) {
+                ScopedDenormalGuard guard;
+                reverb.process(left, right, kBlockSize);
+            } else {
+                reverb.process(left, right, kBlockSize);
+            }
+            sink += left[kBlockSize - 1];
+        }
+        auto end = std::chrono::steady_clock::now();
+        windowNs.push_back(std::chrono::duration<double, std::nano>(end - start).count() / kBlocksPerWindow);
+    }
+
+    double first = windowNs[1];  // Window 0 includes cache warm-up
+    double slowest = *std::max_element(windowNs.begin() + 1, windowNs.end());
+    std::printf("%-10s first %8.0f ns/block  slowest %8.0f ns/block  ratio %5.2f  (sink %g)\n",
+                guarded ? "guarded" : "unguarded", first, slowest, slowest / first,
+                static_cast<double>(sink));
+    return slowest / first;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    int seconds = (argc > 1) ? std::atoi(argv[1]) : 30;
+    seconds = std::max(seconds, 3);
+
+    std::printf("Impulse then %d s of silence, %d-frame blocks (FTZ supported: %s)\n",
+                seconds, kBlockSize, ScopedDenormalGuard::isSupported() ? "yes" : "no");
+
+    runOnce(false, seconds);
+    double guardedRatio = runOnce(true, seconds);
+
+    if (ScopedDenormalGuard::isSupported() && guardedRatio > 2.0) {
+        std::printf("FAIL: guarded block time rose %.2fx during the tail\n", guardedRatio);
+        return 1;
+    }
+    std::printf("PASS\n");
+    return 0;
+}
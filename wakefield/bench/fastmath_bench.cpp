@@ -0,0 +1,145 @@
+// Accuracy and speed of fastmath.h against libm.
+//
+//   ./fastmath_bench [samples]   (default 4M per function)
+//
+// For each approximation, sweeps its stated domain, reports the worst error
+// against the double-precision libm result, and times a block loop of the
+// approximation vs the float libm call on a cache-resident block. Exits non-zero if any error exceeds
+// the bound documented in fastmath.h.
+#include "fastmath.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+namespace {
+
+struct Result {
+    bool ok = true;
+    float sink = 0.0f;
+};
+
+constexpr size_t kTimingBlock = 1024;  // Cache-resident, like one audio block
+
+// ns per call over a block of inputs spread across the domain, repeated
+template <typename Fn>
+double timeLoop(const std::vector<float>& xs, Fn fn, float& sink) {
+    float in[kTimingBlock];
+    float out[kTimingBlock];
+    const size_t stride = std::max<size_t>(1, xs.size() / kTimingBlock);
+    for (size_t i = 0; i < kTimingBlock; ++i) {
+        in[i] = xs[(i * stride) % xs.size()];
+    }
+    const size_t repeats = std::max<size_t>(1, xs.size() / kTimingBlock);
+
+    auto start = std::chrono::steady_clock::now();
+    for (size_t r = 0; r < repeats; ++r) {
+        for (size_t i = 0; i < kTimingBlock; ++i) {
+            out[i] = fn(in[i]);
+        }
+        sink = out[r % kTimingBlock];
+    }
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(end - start).count() /
+           static_cast<double>(repeats * kTimingBlock);
+}
+
+// Error is |fast - ref| / max(|ref|, floor): floor 0 gives relative error,
+// floor 1 gives absolute error for results within [-1, 1].
+template <typename Fast, typename Libm, typename Ref>
+void runCase(Result& result, size_t samples, const char* name, double lo, double hi,
+             bool geometric, double floor, double bound, Fast fast, Libm libm, Ref reference) {
+    std::vector<float> xs(samples);
+    for (size_t i = 0; i < samples; ++i) {
+        double u = (static_cast<double>(i) + 0.5) / static_cast<double>(samples);
+        xs[i] = static_cast<float>(geometric ? lo * std::pow(hi / lo, u) : lo + (hi - lo) * u);
+    }
+
+    double maxError = 0.0;
+    for (size_t i = 0; i < samples; ++i) {
+        const double ref = reference(static_cast<double>(xs[i]));
+        const double err = std::fabs(static_cast<double>(fast(xs[i])) - ref);
+        maxError = std::max(maxError, err / std::max(std::fabs(ref), floor));
+    }
+
+    const double libmNs = timeLoop(xs, libm, result.sink);
+    const double fastNs = timeLoop(xs, fast, result.sink);
+
+    const bool pass = maxError <= bound;
+    result.ok = result.ok && pass;
+    std::printf("%-14s %12.3g %10.1g %10.2f %10.2f %7.1fx%s\n",
+                name, maxError, bound, fastNs, libmNs, libmNs / fastNs, pass ? "" : "  FAIL");
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const size_t samples = (argc > 1) ? static_cast<size_t>(std::atoll(argv[1])) : 4000000u;
+
+    Result result;
+
+    std::printf("%-14s %12s %10s %10s %10s %8s\n",
+                "function", "max error", "bound", "fast ns", "libm ns", "speedup");
+
+    runCase(result, samples, "exp2", -125.0, 127.0, false, 0.0, 3e-7,
+            [](float x) { return fastmath::exp2(x); },
+            [](float x) { return std::exp2(x); },
+            [](double x) { return std::exp2(x); });
+    runCase(result, samples, "exp", -86.0, 88.0, false, 0.0, 5e-6,
+            [](float x) { return fastmath::exp(x); },
+            [](float x) { return std::exp(x); },
+            [](double x) { return std::exp(x); });
+    runCase(result, samples, "exp |x|<4", -4.0, 4.0, false, 0.0, 5e-7,
+            [](float x) { return fastmath::exp(x); },
+            [](float x) { return std::exp(x); },
+            [](double x) { return std::exp(x); });
+    runCase(result, samples, "log2", 1e-37, 1e37, true, 1.0, 2e-7,
+            [](float x) { return fastmath::log2(x); },
+            [](float x) { return std::log2(x); },
+            [](double x) { return std::log2(x); });
+    runCase(result, samples, "pow(x, 0.1)", 1e-6, 1.0, false, 0.0, 6e-7,
+            [](float x) { return fastmath::pow(x, 0.1f); },
+            [](float x) { return std::pow(x, 0.1f); },
+            [](double x) { return std::pow(x, static_cast<double>(0.1f)); });
+    runCase(result, samples, "pow(x, 10)", 0.25, 1.0, false, 0.0, 6e-6,
+            [](float x) { return fastmath::pow(x, 10.0f); },
+            [](float x) { return std::pow(x, 10.0f); },
+            [](double x) { return std::pow(x, 10.0); });
+    runCase(result, samples, "sinTurns", -1000.0, 1000.0, false, 1.0, 2e-7,
+            [](float t) { return fastmath::sinTurns(t); },
+            [](float t) { return std::sin(6.28318531f * t); },
+            [](double t) { return std::sin(2.0 * M_PI * t); });
+    runCase(result, samples, "cosTurns", -1000.0, 1000.0, false, 1.0, 2e-7,
+            [](float t) { return fastmath::cosTurns(t); },
+            [](float t) { return std::cos(6.28318531f * t); },
+            [](double t) { return std::cos(2.0 * M_PI * t); });
+    runCase(result, samples, "sin", -2.0 * M_PI, 2.0 * M_PI, false, 1.0, 5e-7,
+            [](float x) { return fastmath::sin(x); },
+            [](float x) { return std::sin(x); },
+            [](double x) { return std::sin(x); });
+    runCase(result, samples, "cos", -2.0 * M_PI, 2.0 * M_PI, false, 1.0, 5e-7,
+            [](float x) { return fastmath::cos(x); },
+            [](float x) { return std::cos(x); },
+            [](double x) { return std::cos(x); });
+    runCase(result, samples, "tanh", -12.0, 12.0, false, 1.0, 4e-7,
+            [](float x) { return fastmath::tanh(x); },
+            [](float x) { return std::tanh(x); },
+            [](double x) { return std::tanh(x); });
+    runCase(result, samples, "dB2amp", -120.0, 24.0, false, 0.0, 1e-6,
+            [](float dB) { return fastmath::dB2amp(dB); },
+            [](float dB) { return std::pow(10.0f, dB / 20.0f); },
+            [](double dB) { return std::pow(10.0, dB / 20.0); });
+    runCase(result, samples, "tanPi", 1e-6, 0.49, true, 0.0, 3e-7,
+            [](float x) { return fastmath::tanPi(x); },
+            [](float x) { return std::tan(3.14159265f * x); },
+            [](double x) { return std::tan(M_PI * x); });
+    runCase(result, samples, "tanPi > fs/4", 0.25, 0.49, false, 0.0, 3e-7,
+            [](float x) { return fastmath::tanPi(x); },
+            [](float x) { return std::tan(3.14159265f * x); },
+            [](double x) { return std::tan(M_PI * x); });
+
+    std::printf("(sink %g)\n", result.sink);
+    return result.ok ? 0 : 1;
+}
@@ -0,0 +1,404 @@
+// Golden-render regression check: renders every scenario in a directory
+// with the offline renderer (synth --render) and compares the output
+// against a stored golden WAV, and the speed against a stored baseline,
+// so optimization work cannot quietly change the sound or slow it down.
+//
+// A scenario is a text file, name.scenario, one option per line:
+//
+//   preset pad              # --preset (from the preset directory)
+//   replay pad_chords.wfs   # --replay, a --capture log (or: midi song.mid)
+//   seconds 12              # --seconds
+//   args --soa-voices       # further render options, passed as they are
+//
+// Relative replay/midi paths are taken from the scenario's directory. Next
+// to it live name.wav, the golden output, and name.perf, the baseline:
+//
+//   realtime 41.2           # realtime factor
+//   peak_us 812             # peak time per buffer
+//
+// A scenario fails when its output has another length or rate, when the
+// RMS of the difference exceeds --tolerance (dB relative to the golden's
+// RMS), when the realtime factor drops by more than --max-slowdown % or
+// when the peak buffer time grows by more than --max-peak %. Each scenario
+// renders --runs times and keeps the best figures; the output of the first
+// run is compared. --update writes the goldens and baselines instead.
+//
+//   ./golden_check scenario_dir [--synth ./synth] [--runs 3] [--update]
+//                  [--tolerance -90] [--max-slowdown 10] [--max-peak 25]
+//
+// Run it from the build directory: synth loads samples from ../samples.
+// Exits 0 when every scenario passes, 1 when one fails, 2 on bad usage.
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <dirent.h>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+
+struct Options {
+    std::string dir;
+    std::string synth = "./synth";
+    int runs = 3;
+    bool update = false;
+    double toleranceDb = -90.0;
+    double maxSlowdown = 10.0;      // Percent
+    double maxPeak = 25.0;          // Percent
+};
+
+struct Scenario {
+    std::string name;
+    std::string preset;
+    std::string replay;
+    std::string midi;
+    std::string seconds;
+    std::string args;
+};
+
+struct Perf {
+    double realtime = 0.0;
+    double peakUs = 0.0;
+};
+
+struct Wav {
+    uint32_t sampleRate = 0;
+    uint16_t channels = 0;
+    std::vector<float> samples;     // Interleaved
+};
+
+uint32_t readLe(const uint8_t* p, int bytes) {
+    uint32_t v = 0;
+    for (int i = bytes - 1; i >= 0; --i) {
+        v = (v << 8) | p[i];
+    }
+    return v;
+}
+
+// 32-bit float PCM, as synth --render writes it
+bool readWav(const std::string& path, Wav& wav) {
+    std::ifstream in(path, std::ios::binary);
+    if (!in) {
+        std::fprintf(stderr, "%s: cannot open\n", path.c_str());
+        return false;
+    }
+    std::vector<uint8_t> bytes((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    if (bytes.size() < 12 || std::memcmp(&bytes[0], "RIFF", 4) != 0 || std::memcmp(&bytes[8], "WAVE", 4) != 0) {
+        std::fprintf(stderr, "%s: not a WAV file\n", path.c_str());
+        return false;
+    }
+    bool formatOk = false;
+    for (size_t pos = 12; pos + 8 <= bytes.size();) {
+        const uint32_t size = readLe(&bytes[pos + 4], 4);
+        const uint8_t* body = &bytes[pos + 8];
+        if (pos + 8 + size > bytes.size()) {
+            break;
+        }
+        if (std::memcmp(&bytes[pos], "fmt ", 4) == 0 && size >= 16) {
+            formatOk = readLe(body, 2) == 3 && readLe(body + 14, 2) == 32;
+            wav.channels = static_cast<uint16_t>(readLe(body + 2, 2));
+            wav.sampleRate = readLe(body + 4, 4);
+        } else if (std::memcmp(&bytes[pos], "data", 4) == 0) {
+            if (!formatOk) {
+                std::fprintf(stderr, "%s: need 32-bit float PCM\n", path.c_str());
+                return false;
+            }
+            wav.samples.resize(size / sizeof(float));
+            std::memcpy(wav.samples.data(), body, wav.samples.size() * sizeof(float));
+            return true;
+        }
+        pos += 8 + size + (size & 1);
+    }
+    std::fprintf(stderr, "%s: no data chunk\n", path.c_str());
+    return false;
+}
+
+std::string quote(const std::string& s) {
+    std::string quoted = "'";
+    for (char c : s) {
+        quoted += c == '\'' ? std::string("'\\''") : std::string(1, c);
+    }
+    return quoted + "'";
+}
+
+std::string joinPath(const std::string& dir, const std::string& path) {
+    return path.empty() || path[0] == '/' ? path : dir + "/" + path;
+}
+
+bool readScenario(const std::string& path, Scenario& scenario) {
+    std::ifstream in(path);
+    if (!in) {
+        std::fprintf(stderr, "%s: cannot open\n", path.c_str());
+        return false;
+    }
+    std::string line;
+    int lineNumber = 0;
+    while (std::getline(in, line)) {
+        ++lineNumber;
+        line = line.substr(0, line.find('#'));
+        std::istringstream words(line);
+        std::string key;
+        if (!(words >> key)) {
+            continue;
+        }
+        std::string value;
+        std::getline(words >> std::ws, value);
+        while (!value.empty() && std::isspace(static_cast<unsigned char>(value.back()))) {
+            value.pop_back();
+        }
+        if (key == "preset") {
+            scenario.preset = value;
+        } else if (key == "replay") {
+            scenario.replay = value;
+        } else if (key == "midi") {
+            scenario.midi = value;
+        } else if (key == "seconds") {
+            scenario.seconds = value;
+        } else if (key == "args") {
+            scenario.args = value;
+        } else {
+            std::fprintf(stderr, "%s:%d: unknown key %s\n", path.c_str(), lineNumber, key.c_str());
+            return false;
+        }
+    }
+    return true;
+}
+
+bool readPerf(const std::string& path, Perf& perf) {
+    std::ifstream in(path);
+    std::string key;
+    double value;
+    bool realtime = false;
+    bool peak = false;
+    while (in >> key >> value) {
+        if (key == "realtime") {
+            perf.realtime = value;
+            realtime = true;
+        } else if (key == "peak_us") {
+            perf.peakUs = value;
+            peak = true;
+        }
+    }
+    return realtime && peak;
+}
+
+bool writePerf(const std::string& path, const Perf& perf) {
+    std::ofstream out(path);
+    out << "realtime " << perf.realtime << "\npeak_us " << perf.peakUs << "\n";
+    return static_cast<bool>(out);
+}
+
+// Runs synth --render for the scenario and reads the realtime factor and
+// peak buffer time from its report
+bool render(const Options& opt, const std::string& dir, const Scenario& scenario,
+            const std::string& outPath, Perf& perf) {
+    std::string command = quote(opt.synth) + " --render " + quote(outPath);
+    if (!scenario.preset.empty()) {
+        command += " --preset " + quote(scenario.preset);
+    }
+    if (!scenario.replay.empty()) {
+        command += " --replay " + quote(joinPath(dir, scenario.replay));
+    }
+    if (!scenario.midi.empty()) {
+        command += " --midi " + quote(joinPath(dir, scenario.midi));
+    }
+    if (!scenario.seconds.empty()) {
+        command += " --seconds " + quote(scenario.seconds);
+    }
+    if (!scenario.args.empty()) {
+        command += " " + scenario.args;
+    }
+    command += " 2>&1";
+
+    FILE* pipe = popen(command.c_str(), "r");
+    if (!pipe) {
+        std::fprintf(stderr, "%s: cannot run %s\n", scenario.name.c_str(), opt.synth.c_str());
+        return false;
+    }
+    std::string report;
+    char buf[512];
+    while (std::fgets(buf, sizeof(buf), pipe)) {
+        report += buf;
+    }
+    const int status = pclose(pipe);
+
+    // "Rendered out.wav: 12 s in 0.3 s (40x realtime)"
+    // "Per 256-frame buffer: mean 120 us, peak 800 us (15% of the deadline)"
+    const size_t factorEnd = report.find("x realtime)");
+    const size_t factorStart = factorEnd == std::string::npos ? factorEnd : report.rfind('(', factorEnd);
+    const size_t peakStart = report.find(", peak ");
+    if (status != 0 || factorStart == std::string::npos || peakStart == std::string::npos) {
+        std::fprintf(stderr, "%s: render failed:\n%s", scenario.name.c_str(), report.c_str());
+        return false;
+    }
+    perf.realtime = std::atof(report.c_str() + factorStart + 1);
+    perf.peakUs = std::atof(report.c_str() + peakStart + 7);
+    return true;
+}
+
+// RMS of (output - golden) relative to the golden's RMS, in dB
+double differenceDb(const Wav& output, const Wav& golden) {
+    double error = 0.0;
+    double signal = 0.0;
+    for (size_t i = 0; i < golden.samples.size(); ++i) {
+        const double d = static_cast<double>(output.samples[i]) - golden.samples[i];
+        error += d * d;
+        signal += static_cast<double>(golden.samples[i]) * golden.samples[i];
+    }
+    if (error == 0.0) {
+        return -INFINITY;
+    }
+    // A silent golden: compare against full scale instead
+    return 10.0 * std::log10(error / std::max(signal, static_cast<double>(golden.samples.size())));
+}
+
+bool copyFile(const std::string& from, const std::string& to) {
+    std::ifstream in(from, std::ios::binary);
+    std::ofstream out(to, std::ios::binary);
+    out << in.rdbuf();
+    return in && out;
+}
+
+bool parseArgs(int argc, char** argv, Options& opt) {
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        const bool hasValue = i + 1 < argc;
+        if (arg == "--update") {
+            opt.update = true;
+        } else if (arg == "--synth" && hasValue) {
+            opt.synth = argv[++i];
+        } else if (arg == "--runs" && hasValue) {
+            opt.runs = std::max(1, std::atoi(argv[++i]));
+        } else if (arg == "--tolerance" && hasValue) {
+            opt.toleranceDb = std::atof(argv[++i]);
+        } else if (arg == "--max-slowdown" && hasValue) {
+            opt.maxSlowdown = std::atof(argv[++i]);
+        } else if (arg == "--max-peak" && hasValue) {
+            opt.maxPeak = std::atof(argv[++i]);
+        } else if (opt.dir.empty() && arg[0] != '-') {
+            opt.dir = arg;
+        } else {
+            return false;
+        }
+    }
+    return !opt.dir.empty();
+}
+
+// Checks (or with --update, records) one scenario; true when it passes
+bool checkScenario(const Options& opt, const std::string& name) {
+    const std::string base = opt.dir + "/" + name;
+    Scenario scenario;
+    scenario.name = name;
+    if (!readScenario(base + ".scenario", scenario)) {
+        return false;
+    }
+
+    const std::string outPath = "golden_check_" + name + ".wav";
+    Perf best;
+    for (int run = 0; run < opt.runs; ++run) {
+        Perf perf;
+        if (!render(opt, opt.dir, scenario, run == 0 ? outPath : outPath + ".tmp", perf)) {
+            return false;
+        }
+        best.realtime = std::max(best.realtime, perf.realtime);
+        best.peakUs = run == 0 ? perf.peakUs : std::min(best.peakUs, perf.peakUs);
+    }
+    std::remove((outPath + ".tmp").c_str());
+
+    if (opt.update) {
+        const bool ok = copyFile(outPath, base + ".wav") && writePerf(base + ".perf", best);
+        std::remove(outPath.c_str());
+        std::printf("%-24s %s: %.1fx realtime, peak %.0f us\n", name.c_str(), ok ? "updated" : "NOT WRITTEN",
+                    best.realtime, best.peakUs);
+        return ok;
+    }
+
+    Wav output;
+    Wav golden;
+    Perf baseline;
+    if (!readWav(outPath, output) || !readWav(base + ".wav", golden)) {
+        return false;
+    }
+    std::remove(outPath.c_str());
+    if (!readPerf(base + ".perf", baseline)) {
+        std::fprintf(stderr, "%s.perf: missing or incomplete; run with --update\n", base.c_str());
+        return false;
+    }
+
+    bool pass = true;
+    std::string notes;
+    double diff = -INFINITY;
+    if (output.sampleRate != golden.sampleRate || output.channels != golden.channels ||
+        output.samples.size() != golden.samples.size()) {
+        pass = false;
+        notes += " [length or format differs]";
+    } else {
+        diff = differenceDb(output, golden);
+        if (diff > opt.toleranceDb) {
+            pass = false;
+            notes += " [output differs]";
+        }
+    }
+    const double slowdown = 100.0 * (1.0 - best.realtime / baseline.realtime);
+    const double peakGrowth = 100.0 * (best.peakUs / baseline.peakUs - 1.0);
+    if (slowdown > opt.maxSlowdown) {
+        pass = false;
+        notes += " [slower]";
+    }
+    if (peakGrowth > opt.maxPeak) {
+        pass = false;
+        notes += " [peak grew]";
+    }
+
+    std::printf("%-24s %s  diff %6.1f dB  %.1fx realtime (%+.1f%%)  peak %.0f us (%+.1f%%)%s\n", name.c_str(),
+                pass ? "PASS" : "FAIL", std::isinf(diff) ? -999.0 : diff, best.realtime, -slowdown, best.peakUs,
+                peakGrowth, notes.c_str());
+    return pass;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    Options opt;
+    if (!parseArgs(argc, argv, opt)) {
+        std::fprintf(stderr,
+                     "usage: %s scenario_dir [--synth ./synth] [--runs n] [--update]\n"
+                     "       [--tolerance dB] [--max-slowdown %%] [--max-peak %%]\n",
+                     argv[0]);
+        return 2;
+    }
+
+    std::vector<std::string> names;
+    if (DIR* dir = opendir(opt.dir.c_str())) {
+        while (dirent* entry = readdir(dir)) {
+            const std::string file = entry->d_name;
+            const size_t suffix = file.rfind(".scenario");
+            if (suffix != std::string::npos && suffix + 9 == file.size()) {
+                names.push_back(file.substr(0, suffix));
+            }
+        }
+        closedir(dir);
+    }
+    if (names.empty()) {
+        std::fprintf(stderr, "%s: no .scenario files\n", opt.dir.c_str());
+        return 2;
+    }
+    std::sort(names.begin(), names.end());
+
+    int failed = 0;
+    for (const std::string& name : names) {
+        if (!checkScenario(opt, name)) {
+            ++failed;
+        }
+    }
+    std::printf("%d of %zu scenarios %s\n", static_cast<int>(names.size()) - failed, names.size(),
+                opt.update ? "updated" : "passed");
+    return failed == 0 ? 0 : 1;
+}
@@ -0,0 +1,190 @@
+// Greyhole build comparison: table setup time, CPU per block and output difference
+// of every Greyhole DSP in the tree against the canonical one.
+//
+//   canonical  reverb/greyhole.cpp (Faust 2.81, constexpr prime table), what
+//              GreyholeReverb runs
+//   vector     reverb/greyhole_vec.cpp, with -DWAKEFIELD_REVERB_VEC=ON
+//   raw 2.37   reverb/greyhole_dsp.h (Faust 2.37 GreyholeRaw.dsp, prime table
+//              filled in classInit)
+//
+// dark-horizon/GreyholeRaw.cpp is the Faust 0.9.98 SuperCollider plugin of the
+// same .dsp (primes() from jprev.h instead of the waveform); it needs the SC
+// plugin headers and is listed but not run.
+//
+// Every build gets the same parameters and the same input: a 0.5 s noise
+// burst, then silence while the tail decays. Difference is the RMS of
+// (variant - canonical) relative to the canonical output, over both channels.
+//
+//   ./greyhole_compare [seconds]   (default 10 s of audio per variant)
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <math.h>
+#include <memory>
+#include <vector>
+
+namespace canonical {
+#include "greyhole.cpp"
+#ifdef WAKEFIELD_REVERB_VEC
+#include "greyhole_vec.cpp"
+#endif
+}
+
+// Same include guard as greyhole.cpp
+#undef __mydsp_H__
+namespace raw {
+#include "greyhole_dsp.h"
+}
+
+namespace {
+
+constexpr int kSampleRate = 48000;
+constexpr int kBlockSize = 256;
+constexpr float kBurstSeconds = 0.5f;
+
+struct Setting {
+    const char* label;
+    float value;
+};
+
+const Setting kSettings[] = {
+    {"delayTime", 0.2f}, {"damping", 0.3f}, {"size", 1.0f}, {"diffusion", 0.5f},
+    {"feedback", 0.7f}, {"modDepth", 0.1f}, {"modFreq", 2.0f},
+};
+
+// Sets each slider named in kSettings as buildUserInterface reports it. The
+// 2.37 UI has no openHorizontalBox or declare, so those two are not marked
+// override
+template <typename BaseUI>
+class SliderSetter : public BaseUI {
+public:
+    void openVerticalBox(const char*) override {}
+    void openHorizontalBox(const char*) {}
+    void closeBox() override {}
+    void declare(void*, const char*, const char*) {}
+
+    void addHorizontalSlider(const char* label, float* zone, float, float, float, float) override {
+        for (const Setting& s : kSettings) {
+            if (std::strcmp(label, s.label) == 0) *zone = s.value;
+        }
+    }
+};
+
+// Burst of seeded noise, then silence
+void fillInput(float* left, float* right, long firstFrame, int n) {
+    static unsigned int seed = 1;
+    if (firstFrame == 0) seed = 1;
+    const long burstFrames = static_cast<long>(kBurstSeconds * kSampleRate);
+    for (int i = 0; i < n; ++i) {
+        float l = 0.0f;
+        float r = 0.0f;
+        if (firstFrame + i < burstFrames) {
+            seed = seed * 1664525u + 1013904223u;
+            l = 0.5f * (static_cast<float>(seed >> 8) / 8388608.0f - 1.0f);
+            seed = seed * 1664525u + 1013904223u;
+            r = 0.5f * (static_cast<float>(seed >> 8) / 8388608.0f - 1.0f);
+        }
+        left[i] = l;
+        right[i] = r;
+    }
+}
+
+struct Result {
+    double classInitNanos = 0.0;
+    double blockNanos = 0.0;
+    std::vector<float> output;   // Interleaved stereo, for the comparison
+};
+
+template <typename DSP, typename BaseUI>
+Result run(double seconds) {
+    Result result;
+    const long totalBlocks = static_cast<long>(seconds * kSampleRate / kBlockSize);
+    result.output.resize(static_cast<size_t>(totalBlocks) * kBlockSize * 2);
+
+    // classInit is the static table setup init() runs before the per-instance
+    // work; with constexpr tables it is empty
+    auto initStart = std::chrono::steady_clock::now();
+    DSP::classInit(kSampleRate);
+    auto initEnd = std::chrono::steady_clock::now();
+    result.classInitNanos = std::chrono::duration<double, std::nano>(initEnd - initStart).count();
+
+    std::unique_ptr<DSP> dsp(new DSP());
+    dsp->init(kSampleRate);
+
+    SliderSetter<BaseUI> setter;
+    dsp->buildUserInterface(&setter);
+
+    std::vector<float> inL(kBlockSize), inR(kBlockSize), outL(kBlockSize), outR(kBlockSize);
+    float* inputs[2] = {inL.data(), inR.data()};
+    float* outputs[2] = {outL.data(), outR.data()};
+
+    double computeSeconds = 0.0;
+    for (long b = 0; b < totalBlocks; ++b) {
+        fillInput(inL.data(), inR.data(), b * kBlockSize, kBlockSize);
+        auto start = std::chrono::steady_clock::now();
+        dsp->compute(kBlockSize, inputs, outputs);
+        auto end = std::chrono::steady_clock::now();
+        computeSeconds += std::chrono::duration<double>(end - start).count();
+
+        float* out = result.output.data() + static_cast<size_t>(b) * kBlockSize * 2;
+        for (int i = 0; i < kBlockSize; ++i) {
+            out[2 * i] = outL[i];
+            out[2 * i + 1] = outR[i];
+        }
+    }
+    result.blockNanos = computeSeconds * 1e9 / static_cast<double>(totalBlocks);
+    return result;
+}
+
+void report(const char* name, const Result& r, const Result& reference) {
+    double diffEnergy = 0.0;
+    double refEnergy = 0.0;
+    float peak = 0.0f;
+    for (size_t i = 0; i < r.output.size(); ++i) {
+        const double d = static_cast<double>(r.output[i]) - reference.output[i];
+        diffEnergy += d * d;
+        refEnergy += static_cast<double>(reference.output[i]) * reference.output[i];
+        peak = std::max(peak, std::fabs(r.output[i] - reference.output[i]));
+    }
+    const double relative = refEnergy > 0.0 ? 10.0 * std::log10(std::max(diffEnergy, 1e-30) / refEnergy) : 0.0;
+    const double realtime = 1e9 * kBlockSize / kSampleRate / r.blockNanos;
+
+    char diff[48];
+    if (&r == &reference) {
+        std::snprintf(diff, sizeof(diff), "%s", "reference");
+    } else if (diffEnergy == 0.0) {
+        std::snprintf(diff, sizeof(diff), "%s", "bit-identical");
+    } else {
+        std::snprintf(diff, sizeof(diff), "%7.1f dB  peak %.2e", relative, static_cast<double>(peak));
+    }
+    std::printf("%-10s %9.0f ns %9.0f ns %7.1f ns %7.1fx   %s\n", name, r.classInitNanos, r.blockNanos,
+                r.blockNanos / kBlockSize, realtime, diff);
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    double seconds = (argc > 1) ? std::atof(argv[1]) : 10.0;
+    if (seconds <= kBurstSeconds) {
+        seconds = 10.0;
+    }
+
+    std::printf("Greyhole builds: %.0f s of 48 kHz stereo, %d-frame blocks\n\n", seconds, kBlockSize);
+    std::printf("%-10s %12s %12s %10s %8s   %s\n", "build", "classInit", "per block", "per frame", "speed",
+                "difference from canonical");
+
+    const Result reference = run<canonical::mydsp, canonical::UI>(seconds);
+    report("canonical", reference, reference);
+#ifdef WAKEFIELD_REVERB_VEC
+    report("vector", run<canonical::mydsp_vec, canonical::UI>(seconds), reference);
+#else
+    std::printf("%-10s not built (configure with -DWAKEFIELD_REVERB_VEC=ON)\n", "vector");
+#endif
+    report("raw 2.37", run<raw::mydsp, raw::UI>(seconds), reference);
+    std::printf("%-10s not built (SuperCollider plugin, dark-horizon/GreyholeRaw.cpp)\n", "sc 0.9.98");
+    return 0;
+}
@@ -0,0 +1,127 @@
+// Reverb throughput benchmark: samples/sec per compiled Greyhole variant and
+// for the LateDiff tank, at 48 kHz stereo with the same parameters, each at
+// the full and at half the sample rate; then the convolution engine with a
+// 4 s impulse response.
+//
+//   ./reverb_bench [seconds]   (default 10 s of audio per variant)
+//
+// Build with -DWAKEFIELD_REVERB_VEC=ON to include the vector variant.
+#include "reverb.h"
+#include "convolution.h"
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+namespace {
+
+constexpr float kSampleRate = 48000.0f;
+constexpr int kBlockSize = 256;
+
+const GreyholeReverb::Parameters kParameters = {0.5f, 0.5f, 0.3f, 0.5f, 0.7f, 0.5f, 0.1f, 2.0f};
+
+template <typename Reverb>
+double run(Reverb& reverb, const char* name, double seconds) {
+
+    std::vector<float> left(kBlockSize);
+    std::vector<float> right(kBlockSize);
+    const long totalBlocks = static_cast<long>(seconds * kSampleRate / kBlockSize);
+
+    // Decaying noise bursts keep the tank busy without going silent
+    unsigned int seed = 1;
+    auto noise = [&seed]() {
+        seed = seed * 1664525u + 1013904223u;
+        return static_cast<float>(seed >> 8) / 8388608.0f - 1.0f;
+    };
+
+    float checksum = 0.0f;
+    auto start = std::chrono::steady_clock::now();
+    for (long b = 0; b < totalBlocks; ++b) {
+        float gain = (b % 64 == 0) ? 0.5f : 0.0f;
+        for (int i = 0; i < kBlockSize; ++i) {
+            left[i] = noise() * gain;
+            right[i] = noise() * gain;
+        }
+        reverb.process(left.data(), right.data(), kBlockSize);
+        checksum += left[kBlockSize - 1] + right[kBlockSize - 1];
+    }
+    auto end = std::chrono::steady_clock::now();
+
+    double elapsed = std::chrono::duration<double>(end - start).count();
+    double frames = static_cast<double>(totalBlocks) * kBlockSize;
+    double framesPerSec = frames / elapsed;
+    std::printf("%-13s %10.0f frames/s  %6.1fx realtime  (checksum %g)\n",
+                name, framesPerSec, framesPerSec / kSampleRate, static_cast<double>(checksum));
+    return framesPerSec;
+}
+
+double runVariant(GreyholeReverb::Variant variant, double seconds, bool halfRate = false) {
+    GreyholeReverb reverb(kSampleRate, variant);
+    reverb.setParameters(kParameters);
+    reverb.setHalfRate(halfRate);
+    const std::string name = std::string(GreyholeReverb::variantName(variant)) + (halfRate ? " half" : "");
+    return run(reverb, name.c_str(), seconds);
+}
+
+double runLateDiff(double seconds, bool halfRate = false) {
+    LateDiffReverb reverb(kSampleRate);
+    reverb.setParameters(kParameters);
+    reverb.setHalfRate(halfRate);
+    return run(reverb, halfRate ? "latediff half" : "latediff", seconds);
+}
+
+double runConvolution(double seconds) {
+    ConvolutionReverb reverb(kSampleRate);
+    const size_t frames = static_cast<size_t>(4.0f * kSampleRate);
+    std::vector<float> left(frames);
+    std::vector<float> right(frames);
+    unsigned int seed = 7;
+    for (size_t i = 0; i < frames; ++i) {
+        const float envelope = std::pow(10.0f, -3.0f * static_cast<float>(i) / frames);
+        seed = seed * 1664525u + 1013904223u;
+        left[i] = (static_cast<float>(seed >> 8) / 8388608.0f - 1.0f) * envelope;
+        seed = seed * 1664525u + 1013904223u;
+        right[i] = (static_cast<float>(seed >> 8) / 8388608.0f - 1.0f) * envelope;
+    }
+    reverb.setImpulse(left.data(), right.data(), frames);
+    reverb.setParameters(kParameters);
+
+    // Until a whole IR length has gone in, only part of the FDL is summed
+    for (size_t done = 0; done < frames + kBlockSize; done += kBlockSize) {
+        for (int i = 0; i < kBlockSize; ++i) {
+            seed = seed * 1664525u + 1013904223u;
+            left[i] = right[i] = 0.1f * (static_cast<float>(seed >> 8) / 8388608.0f - 1.0f);
+        }
+        reverb.process(left.data(), right.data(), kBlockSize);
+    }
+    return run(reverb, "conv 4 s IR", seconds);
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    double seconds = (argc > 1) ? std::atof(argv[1]) : 10.0;
+    if (seconds <= 0.0) {
+        seconds = 10.0;
+    }
+
+    std::printf("Reverb benchmark: %.0f s of 48 kHz stereo, %d-frame blocks\n", seconds, kBlockSize);
+
+    double scalar = runVariant(GreyholeReverb::Variant::Scalar, seconds);
+    if (GreyholeReverb::isVariantAvailable(GreyholeReverb::Variant::Vector)) {
+        double vec = runVariant(GreyholeReverb::Variant::Vector, seconds);
+        std::printf("vector / scalar: %.2fx\n", vec / scalar);
+    } else {
+        std::printf("vector   not built (configure with -DWAKEFIELD_REVERB_VEC=ON)\n");
+    }
+    double scalarHalf = runVariant(GreyholeReverb::Variant::Scalar, seconds, true);
+    std::printf("half / full: %.2fx\n", scalarHalf / scalar);
+    double lateDiff = runLateDiff(seconds);
+    std::printf("latediff / scalar: %.2fx\n", lateDiff / scalar);
+    double lateDiffHalf = runLateDiff(seconds, true);
+    std::printf("half / full: %.2fx\n", lateDiffHalf / lateDiff);
+    runConvolution(seconds);
+    return 0;
+}
@@ -0,0 +1,1185 @@
+// DSP kernel benchmark: ns per sample for each building block of the synth,
+// from single oscillators up to the full Synth::process at 1/4/8 voices.
+//
+//   ./synth_bench [--seconds s] [--voice-threads n] [filter]   (default 2 s of audio per run)
+//   ./synth_bench [--wcet-seconds s] wcet                      (default 180 s)
+//
+// Every case is driven from fixed seeds, warmed up, then timed kRuns times
+// and the best run reported, so numbers are comparable between builds.
+// Where a kernel has a scalar and a block/SIMD path both are listed.
+// "ns/sample" is per mono sample (per stereo frame for the reverb, looper
+// and Synth cases); "x rt" is how many instances one core keeps up with at
+// 48 kHz. A filter argument runs only cases whose name contains it.
+// --voice-threads adds Synth cases rendered on n helper threads.
+//
+// "wcet" is a stress scene rather than a kernel: all voices, modulation
+// slots and FM routes, samplers crossfading, the ladder at full drive,
+// Greyhole at full size, four loops overdubbing and the sequencer on
+// 1/64 steps, each block timed on its own. It reports the mean, p99,
+// p99.9 and max block time against the deadline, which is what hardware
+// is sized against. It runs only when asked for by name.
+#include "synth.h"
+#include "voice_bank.h"
+#include "voice_filter_bank.h"
+#include "brainwave_osc.h"
+#include "sampler.h"
+#include "sample_bank.h"
+#include "envelope.h"
+#include "lfo.h"
+#include "chaos.h"
+#include "parameter_smoother.h"
+#include "param_morph.h"
+#include "filters.hpp"
+#include "oversampler.h"
+#include "reverb.h"
+#include "convolution.h"
+#include "looper.h"
+#include "markov.h"
+#include "loop_manager.h"
+#include "output_stage.h"
+#include "sequencer.h"
+#include "ui.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+// The UI sources linked in for Synth refer to these (defined in main.cpp for synth)
+LoopManager* loopManager = nullptr;
+Sequencer* sequencer = nullptr;
+
+namespace {
+
+constexpr float kSampleRate = 48000.0f;
+constexpr int kBlockSize = 256;
+constexpr int kRuns = 5;
+
+double gSeconds = 2.0;
+int gVoiceThreads = 0;
+const char* gFilter = nullptr;
+double gWorstCaseSeconds = 180.0;
+
+// Outputs are folded in here so no case can be optimized away
+volatile float gSink = 0.0f;
+
+struct Noise {
+    unsigned int seed;
+    explicit Noise(unsigned int s) : seed(s) {}
+    float operator()() {
+        seed = seed * 1664525u + 1013904223u;
+        return static_cast<float>(seed >> 8) / 8388608.0f - 1.0f;
+    }
+};
+
+bool selected(const char* name) {
+    return !gFilter || std::strstr(name, gFilter) != nullptr;
+}
+
+// Calls block() (which produces samplesPerCall samples) for gSeconds of audio
+// per run, after a quarter-length warmup. Returns the best ns per sample.
+template <typename Block>
+double measure(Block&& block, int framesPerCall, double samplesPerCall) {
+    const long calls = std::max(1L, static_cast<long>(gSeconds * kSampleRate / framesPerCall));
+    for (long c = 0; c < calls / 4 + 1; ++c) {
+        block();
+    }
+
+    double best = 1e30;
+    for (int run = 0; run < kRuns; ++run) {
+        auto start = std::chrono::steady_clock::now();
+        for (long c = 0; c < calls; ++c) {
+            block();
+        }
+        auto end = std::chrono::steady_clock::now();
+        double ns = std::chrono::duration<double, std::nano>(end - start).count();
+        best = std::min(best, ns / (static_cast<double>(calls) * samplesPerCall));
+    }
+    return best;
+}
+
+void report(const char* name, const char* variant, double nsPerSample) {
+    const double budgetNs = 1e9 / kSampleRate;
+    std::printf("%-22s %-14s %9.2f ns/sample %10.1fx rt\n",
+                name, variant, nsPerSample, budgetNs / nsPerSample);
+}
+
+// Per-sample kernel: sample() returns the next output
+template <typename Sample>
+void runScalar(const char* name, const char* variant, Sample&& sample) {
+    std::vector<float> out(kBlockSize);
+    double ns = measure([&]() {
+        for (int i = 0; i < kBlockSize; ++i) {
+            out[i] = sample();
+        }
+        gSink = gSink + out[kBlockSize - 1];
+    }, kBlockSize, kBlockSize);
+    report(name, variant, ns);
+}
+
+void benchOscillator() {
+    if (!selected("osc")) return;
+
+    for (int shape = 0; shape < 2; ++shape) {
+        BrainwaveOscillator osc;
+        osc.setMode(BrainwaveMode::FREE);
+        osc.setShape(shape == 0 ? BrainwaveShape::SAW : BrainwaveShape::PULSE);
+        osc.setFrequency(220.0f);
+        osc.setMorph(0.3f);
+        osc.setDuty(0.4f);
+        runScalar(shape == 0 ? "osc saw" : "osc pulse", "scalar",
+                  [&]() { return osc.process(kSampleRate); });
+    }
+
+    // All oscillators of one 8-voice bank per pass; reported per oscillator sample
+    const int lanes = std::min(MAX_VOICES, VoiceBank::kLanes);
+    std::vector<Voice> voices;
+    voices.reserve(lanes);  // Samplers point into themselves: never relocate
+    for (int v = 0; v < lanes; ++v) {
+        voices.emplace_back(kSampleRate);
+        voices[v].active = true;
+        for (int o = 0; o < OSCILLATORS_PER_VOICE; ++o) {
+            BrainwaveOscillator& osc = voices[v].oscillators[o];
+            osc.setMode(BrainwaveMode::FREE);
+            osc.setShape(o % 2 == 0 ? BrainwaveShape::SAW : BrainwaveShape::PULSE);
+            osc.setFrequency(110.0f * (1.0f + 0.13f * v) * (o + 1));
+            osc.setMorph(0.2f + 0.15f * o);
+            osc.setDuty(0.4f);
+        }
+    }
+    std::unique_ptr<VoiceBank> bank(new VoiceBank());
+    double ns = measure([&]() {
+        bank->render(voices.data(), lanes, kSampleRate, VOICE_BLOCK_SIZE);
+        gSink = gSink + bank->blockForVoice(0).osc[0][0];
+    }, VOICE_BLOCK_SIZE, static_cast<double>(VOICE_BLOCK_SIZE) * lanes * OSCILLATORS_PER_VOICE);
+    report("osc voice bank", VoiceBank::backendName(), ns);
+}
+
+void benchSampler() {
+    if (!selected("sampler")) return;
+
+    // Two seconds of a decaying chord, so loops cross real signal
+    std::vector<int16_t> pcm(static_cast<size_t>(2 * kSampleRate));
+    Noise noise(7);
+    for (size_t i = 0; i < pcm.size(); ++i) {
+        float t = static_cast<float>(i) / kSampleRate;
+        float s = 0.4f * std::sin(2.0f * 3.14159265f * 220.0f * t) +
+                  0.3f * std::sin(2.0f * 3.14159265f * 331.0f * t) + 0.05f * noise();
+        pcm[i] = static_cast<int16_t>(std::clamp(s, -1.0f, 1.0f) * 32767.0f);
+    }
+    SampleData data;
+    data.samples = pcm.data();
+    data.sampleCount = static_cast<uint32_t>(pcm.size());
+    data.sampleRate = static_cast<uint32_t>(kSampleRate);
+    data.ownsSamples = false;
+
+    // Slot settings, as Synth keeps them for every sampler of a slot
+    SamplerConfig config;
+    config.loopStartNorm = 0.1f;
+    config.loopLengthNorm = 0.5f;
+    config.crossfadeLengthNorm = 0.2f;
+    config.playbackSpeed = 1.37f;  // Non-integer speed exercises interpolation
+    config.mode = PlaybackMode::FORWARD;
+    config.level = 1.0f;
+    config.sample = &data;
+    config.prepare();
+
+    auto setup = [&](Sampler& sampler) {
+        sampler.setConfig(&config);
+        sampler.setSample(&data);
+        sampler.requestRestart();  // What a note-on does; starts the primary voice
+    };
+
+    Sampler scalar;
+    setup(scalar);
+    runScalar("sampler", "scalar", [&]() {
+        return scalar.process(kSampleRate, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, -1.0f, 60);
+    });
+
+    Sampler block;
+    setup(block);
+    SamplerModulation mod;
+    mod.sampleRate = kSampleRate;
+    mod.levelMod = 1.0f;  // Samplers are silent without an amp source
+    std::vector<float> out(kBlockSize);
+    double ns = measure([&]() {
+        block.processBlock(mod, out.data(), kBlockSize);
+        gSink = gSink + out[kBlockSize - 1];
+    }, kBlockSize, kBlockSize);
+    report("sampler", "block", ns);
+}
+
+void benchEnvelope() {
+    if (!selected("envelope")) return;
+
+    // Retrigger every 48 blocks (~256 ms) and release halfway, so the timed
+    // span covers every segment rather than a flat sustain
+    auto setup = [](Envelope& env) {
+        env.setAttack(0.01f);
+        env.setDecay(0.05f);
+        env.setSustain(0.6f);
+        env.setRelease(0.1f);
+        env.setAttackBend(0.3f);
+        env.setReleaseBend(0.7f);
+    };
+    auto gate = [](Envelope& env, long& blocks) {
+        long phase = blocks++ % 48;
+        if (phase == 0) env.noteOn();
+        if (phase == 24) env.noteOff();
+    };
+
+    Envelope scalar(kSampleRate);
+    setup(scalar);
+    long scalarBlocks = 0;
+    std::vector<float> out(kBlockSize);
+    double ns = measure([&]() {
+        gate(scalar, scalarBlocks);
+        for (int i = 0; i < kBlockSize; ++i) {
+            out[i] = scalar.process();
+        }
+        gSink = gSink + out[kBlockSize - 1];
+    }, kBlockSize, kBlockSize);
+    report("envelope", "scalar", ns);
+
+    Envelope block(kSampleRate);
+    setup(block);
+    long blockBlocks = 0;
+    ns = measure([&]() {
+        gate(block, blockBlocks);
+        block.processBlock(out.data(), kBlockSize);
+        gSink = gSink + out[kBlockSize - 1];
+    }, kBlockSize, kBlockSize);
+    report("envelope", "block", ns);
+}
+
+void benchModulators() {
+    if (selected("lfo")) {
+        LFO lfo;
+        lfo.setPeriod(0.5f);
+        lfo.setShape(0);
+        lfo.setMorph(0.3f);
+        lfo.setDuty(0.5f);
+        runScalar("lfo", "scalar", [&]() { return lfo.process(kSampleRate); });
+
+        // All four LFOs of the synth per pass, two of each shape, as
+        // processLFOs renders them; reported per LFO sample
+        LFO lfos[LFOBank::kLanes];
+        LFOBank bank;
+        for (int lane = 0; lane < LFOBank::kLanes; ++lane) {
+            for (LFO* l : {&lfos[lane], &bank[lane]}) {
+                l->setPeriod(0.5f + lane);
+                l->setShape(lane & 1);
+                l->setMorph(0.3f);
+                l->setDuty(0.5f);
+            }
+        }
+        std::vector<float> buffers(LFOBank::kLanes * kBlockSize);
+        float* out[LFOBank::kLanes];
+        for (int lane = 0; lane < LFOBank::kLanes; ++lane) {
+            out[lane] = buffers.data() + lane * kBlockSize;
+        }
+
+        double ns = measure([&]() {
+            for (int lane = 0; lane < LFOBank::kLanes; ++lane) {
+                lfos[lane].processBlock(kSampleRate, out[lane], kBlockSize);
+            }
+            gSink = gSink + buffers[kBlockSize - 1];
+        }, kBlockSize, LFOBank::kLanes * kBlockSize);
+        report("lfo x4", "scalar", ns);
+
+        ns = measure([&]() {
+            bank.processBlock(kSampleRate, out, kBlockSize, kBlockSize);
+            gSink = gSink + buffers[kBlockSize - 1];
+        }, kBlockSize, LFOBank::kLanes * kBlockSize);
+        report("lfo x4", "bank", ns);
+    }
+
+    if (selected("chaos")) {
+        ChaosGenerator clocked;
+        clocked.setSampleRate(kSampleRate);
+        clocked.setClockFrequency(200.0f);
+        runScalar("chaos clocked", "scalar", [&]() { return clocked.process(); });
+
+        ChaosGenerator fast;
+        fast.setSampleRate(kSampleRate);
+        fast.setFastMode(true);
+        runScalar("chaos fast", "scalar", [&]() { return fast.process(); });
+
+        // All four generators of the synth per pass, as processChaos renders
+        // them; reported per generator sample
+        for (int mode = 0; mode < 2; ++mode) {
+            const bool isFast = (mode == 1);
+            const char* name = isFast ? "chaos x4 fast" : "chaos x4 clocked";
+            ChaosGenerator generators[ChaosBank::kLanes];
+            ChaosBank bank;
+            bank.setSampleRate(kSampleRate);
+            for (int lane = 0; lane < ChaosBank::kLanes; ++lane) {
+                generators[lane].setSampleRate(kSampleRate);
+                generators[lane].setClockFrequency(200.0f);
+                generators[lane].setFastMode(isFast);
+                generators[lane].setInterpMode(lane % 3);
+                bank.setClockFrequency(lane, 200.0f);
+                bank.setFastMode(lane, isFast);
+                bank.setInterpMode(lane, lane % 3);
+            }
+
+            std::vector<float> xs(ChaosBank::kLanes * kBlockSize);
+            std::vector<float> ys(ChaosBank::kLanes * kBlockSize);
+            float* xOut[ChaosBank::kLanes];
+            float* yOut[ChaosBank::kLanes];
+            for (int lane = 0; lane < ChaosBank::kLanes; ++lane) {
+                xOut[lane] = xs.data() + lane * kBlockSize;
+                yOut[lane] = ys.data() + lane * kBlockSize;
+            }
+            const bool running[ChaosBank::kLanes] = {true, true, true, true};
+
+            double ns = measure([&]() {
+                for (int lane = 0; lane < ChaosBank::kLanes; ++lane) {
+                    generators[lane].processBlock(xOut[lane], yOut[lane], kBlockSize);
+                }
+                gSink = gSink + xs[kBlockSize - 1];
+            }, kBlockSize, ChaosBank::kLanes * kBlockSize);
+            report(name, "scalar", ns);
+
+            ns = measure([&]() {
+                bank.processBlock(xOut, yOut, running, kBlockSize);
+                gSink = gSink + xs[kBlockSize - 1];
+            }, kBlockSize, ChaosBank::kLanes * kBlockSize);
+            report(name, "bank", ns);
+        }
+    }
+
+    if (selected("smoothers")) {
+        // The callback's 22 smoothed parameters, one step per 256-frame
+        // buffer, with a target moving every 8th buffer; reported per buffer
+        // frame. "settled" is the bank once every target has been reached
+        constexpr int kParams = 22;
+        ParameterSmoother smoothers[kParams];
+        SmootherBank bank;
+        bank.setSmoothTime(0.01f, kSampleRate);
+        for (int i = 0; i < kParams; ++i) {
+            smoothers[i].setSmoothTime(0.01f, kSampleRate / kBlockSize);
+            smoothers[i].reset(0.5f);
+            bank.reset(i, 0.5f);
+        }
+        int call = 0;
+
+        double ns = measure([&]() {
+            const int moving = (call++ / 8) % kParams;
+            smoothers[moving].setTarget((call & 8) ? 0.25f : 0.75f);
+            float sum = 0.0f;
+            for (int i = 0; i < kParams; ++i) {
+                sum += smoothers[i].process();
+            }
+            gSink = gSink + sum;
+        }, kBlockSize, kBlockSize);
+        report("smoothers x22", "scalar", ns);
+
+        call = 0;
+        ns = measure([&]() {
+            const int moving = (call++ / 8) % kParams;
+            bank.setTarget(moving, (call & 8) ? 0.25f : 0.75f);
+            bank.advance(kBlockSize);
+            float sum = 0.0f;
+            for (int i = 0; i < kParams; ++i) {
+                sum += bank.value(i);
+            }
+            gSink = gSink + sum;
+        }, kBlockSize, kBlockSize);
+        report("smoothers x22", "bank", ns);
+
+        ns = measure([&]() {
+            bank.advance(kBlockSize);
+            gSink = gSink + bank.value(0);
+        }, kBlockSize, kBlockSize);
+        report("smoothers x22", "settled", ns);
+    }
+
+    if (selected("preset morph")) {
+        // One apply per 256-frame buffer with the position sweeping, as the
+        // callback does while a morph is active; reported per buffer frame.
+        // "22 fields" differs in the smoothed parameters only, "all fields"
+        // in every float of the block plus the oscillator and filter modes
+        SynthParamBlock a;
+        SynthParamBlock b;
+        b.attack = 0.5f;
+        b.decay = 0.3f;
+        b.sustain = 0.2f;
+        b.release = 1.0f;
+        b.masterVolume = 0.8f;
+        b.osc[0].freq = 220.0f;
+        b.osc[0].morph = 0.1f;
+        b.osc[0].duty = 0.3f;
+        b.reverbDelayTime = 0.2f;
+        b.reverbSize = 0.9f;
+        b.reverbDamping = 0.1f;
+        b.reverbMix = 0.6f;
+        b.reverbDecay = 0.8f;
+        b.reverbDiffusion = 0.7f;
+        b.reverbModDepth = 0.4f;
+        b.reverbModFreq = 0.5f;
+        b.filterCutoff = 5000.0f;
+        b.filterGain = 3.0f;
+        b.filterResonance = 0.9f;
+        b.filterDrive = 2.0f;
+        b.filterFeedbackHP = 80.0f;
+        b.overdubMix = 0.3f;
+
+        for (int pass = 0; pass < 2; ++pass) {
+            if (pass == 1) {
+                float nudge = 0.01f;
+                forEachParam(b, [&](auto& field) {
+                    if constexpr (std::is_same_v<std::decay_t<decltype(field)>, float>) {
+                        field += nudge;
+                        nudge += 0.01f;
+                    }
+                });
+                for (auto& osc : b.osc) {
+                    osc.mode = 2;
+                    osc.shape = 1;
+                }
+                b.filterType = 1;
+            }
+            static ParamMorph morph;
+            morph.prepare(a, b);
+            SynthParamBlock live = a;
+            int call = 0;
+            double ns = measure([&]() {
+                morph.apply(static_cast<float>(call++ & 255) / 255.0f, live);
+                gSink = gSink + live.filterCutoff;
+            }, kBlockSize, kBlockSize);
+            report("preset morph", pass == 0 ? "22 fields" : "all fields", ns);
+        }
+    }
+}
+
+void benchFilters() {
+    std::vector<float> in(kBlockSize);
+    std::vector<float> out(kBlockSize);
+    std::vector<float> out2(kBlockSize);
+    Noise noise(3);
+    for (float& x : in) {
+        x = 0.5f * noise();
+    }
+
+    if (selected("onepole")) {
+        OnePoleTPT scalar;
+        scalar.setSampleRate(kSampleRate);
+        scalar.setCutoff(1000.0f);
+        int i = 0;
+        runScalar("onepole", "scalar", [&]() {
+            auto [lp, hp] = scalar.process(in[i]);
+            i = (i + 1) % kBlockSize;
+            return lp + hp;
+        });
+
+        OnePoleTPT block;
+        block.setSampleRate(kSampleRate);
+        block.setCutoff(1000.0f);
+        double ns = measure([&]() {
+            block.processBlock(in.data(), out.data(), out2.data(), kBlockSize);
+            gSink = gSink + out[kBlockSize - 1] + out2[kBlockSize - 1];
+        }, kBlockSize, kBlockSize);
+        report("onepole", "block", ns);
+
+        // Per stereo frame, the cutoff sweeping 200 Hz - 5 kHz and back
+        OnePoleTPT glide;
+        glide.setSampleRate(kSampleRate);
+        glide.setCutoff(200.0f);
+        bool up = true;
+        ns = measure([&]() {
+            std::copy(in.begin(), in.end(), out.begin());
+            std::copy(in.begin(), in.end(), out2.begin());
+            glide.processStereoGlide(out.data(), out2.data(), kBlockSize, false, up ? 5000.0f : 200.0f);
+            up = !up;
+            gSink = gSink + out[kBlockSize - 1] + out2[kBlockSize - 1];
+        }, kBlockSize, kBlockSize);
+        report("onepole", "stereo glide", ns);
+    }
+
+    if (selected("ladder")) {
+        Ladder8PoleZdf ladder(kSampleRate);
+        ladder.setCutoff(800.0f);
+        ladder.setResonance(0.6f);
+        ladder.setDrive(0.3f);
+        int i = 0;
+        runScalar("ladder 8-pole", "scalar", [&]() {
+            float y = ladder.process(in[i]);
+            i = (i + 1) % kBlockSize;
+            return y;
+        });
+
+        // Per stereo frame, against two scalar ladders
+        Ladder8PoleZdf ladderR(kSampleRate);
+        ladderR.setCutoff(800.0f);
+        ladderR.setResonance(0.6f);
+        ladderR.setDrive(0.3f);
+        double ns = measure([&]() {
+            for (int k = 0; k < kBlockSize; ++k) {
+                out[k] = ladder.process(in[k]);
+                out2[k] = ladderR.process(in[k]);
+            }
+            gSink = gSink + out[kBlockSize - 1] + out2[kBlockSize - 1];
+        }, kBlockSize, kBlockSize);
+        report("ladder 8-pole", "stereo scalar", ns);
+
+        Ladder8PoleZdfX4 stereo(kSampleRate);
+        stereo.setCutoff(800.0f);
+        stereo.setResonance(0.6f);
+        stereo.setDrive(0.3f);
+        ns = measure([&]() {
+            std::copy(in.begin(), in.begin() + kBlockSize, out.begin());
+            std::copy(in.begin(), in.begin() + kBlockSize, out2.begin());
+            stereo.processStereo(out.data(), out2.data(), kBlockSize);
+            gSink = gSink + out[kBlockSize - 1] + out2[kBlockSize - 1];
+        }, kBlockSize, kBlockSize);
+        report("ladder 8-pole", "stereo x4", ns);
+
+        // The same ladder run at 2x and 4x through the oversampler,
+        // per engine-rate stereo frame
+        for (int factor = 2; factor <= 4; factor *= 2) {
+            Ladder8PoleZdfX4 wide(kSampleRate * factor);
+            wide.setCutoff(800.0f);
+            wide.setResonance(0.6f);
+            wide.setDrive(0.3f);
+            Oversampler oversampler;
+            oversampler.configure(factor, OversampleQuality::Normal);
+            ns = measure([&]() {
+                std::copy(in.begin(), in.begin() + kBlockSize, out.begin());
+                std::copy(in.begin(), in.begin() + kBlockSize, out2.begin());
+                oversampler.processStereo(out.data(), out2.data(), kBlockSize, [&](float* l, float* r, int m) {
+                    wide.processStereo(l, r, m);
+                });
+                gSink = gSink + out[kBlockSize - 1] + out2[kBlockSize - 1];
+            }, kBlockSize, kBlockSize);
+            report("ladder 8-pole", factor == 2 ? "stereo x4 2x" : "stereo x4 4x", ns);
+        }
+
+        // Per voice sample, a voice group's worth of ladders
+        constexpr int kVoices = VoiceFilterBank::kLanes;
+        std::vector<float> voiceIn(static_cast<size_t>(kVoices) * kBlockSize);
+        for (float& x : voiceIn) {
+            x = 0.5f * noise();
+        }
+        std::vector<float> voiceOut(voiceIn.size());
+        std::vector<Ladder8PoleZdf> voiceLadders(kVoices, Ladder8PoleZdf(kSampleRate));
+        for (int v = 0; v < kVoices; ++v) {
+            voiceLadders[v].setCutoff(400.0f + 150.0f * v);
+            voiceLadders[v].setResonance(0.6f);
+            voiceLadders[v].setDrive(0.3f);
+        }
+        ns = measure([&]() {
+            for (int v = 0; v < kVoices; ++v) {
+                for (int k = 0; k < kBlockSize; ++k) {
+                    voiceOut[v * kBlockSize + k] = voiceLadders[v].process(voiceIn[v * kBlockSize + k]);
+                }
+            }
+            gSink = gSink + voiceOut.back();
+        }, kBlockSize, static_cast<double>(kVoices) * kBlockSize);
+        report("ladder 8-pole", "8 voice scalar", ns);
+
+        VoiceFilterBank bank(kSampleRate);
+        bank.setMode(VoiceFilterBank::Mode::Ladder);
+        bank.setResonance(0.6f);
+        bank.setDrive(0.3f);
+        for (int v = 0; v < kVoices; ++v) {
+            bank.setCutoff(v, 400.0f + 150.0f * v);
+        }
+        bool active[kVoices];
+        std::fill(active, active + kVoices, true);
+        ns = measure([&]() {
+            std::copy(voiceIn.begin(), voiceIn.end(), voiceOut.begin());
+            for (int k = 0; k < kBlockSize; k += VOICE_BLOCK_SIZE) {
+                bank.process(voiceOut.data() + k, kBlockSize, kVoices, active,
+                             std::min(VOICE_BLOCK_SIZE, kBlockSize - k));
+            }
+            gSink = gSink + voiceOut.back();
+        }, kBlockSize, static_cast<double>(kVoices) * kBlockSize);
+        report("ladder 8-pole", "8 voice bank", ns);
+    }
+
+    if (selected("shelf")) {
+        OnePoleHighShelfBLT high;
+        high.setSampleRate(kSampleRate);
+        high.setCutoff(4000.0f);
+        high.setGainDb(6.0f);
+        double ns = measure([&]() {
+            high.processBlock(in.data(), out.data(), kBlockSize);
+            gSink = gSink + out[kBlockSize - 1];
+        }, kBlockSize, kBlockSize);
+        report("high shelf", "block", ns);
+
+        OnePoleLowShelfBLT low;
+        low.setSampleRate(kSampleRate);
+        low.setCutoff(200.0f);
+        low.setGainDb(-6.0f);
+        ns = measure([&]() {
+            low.processBlock(in.data(), out.data(), kBlockSize);
+            gSink = gSink + out[kBlockSize - 1];
+        }, kBlockSize, kBlockSize);
+        report("low shelf", "block", ns);
+
+        bool up = true;
+        ns = measure([&]() {
+            std::copy(in.begin(), in.end(), out.begin());
+            std::copy(in.begin(), in.end(), out2.begin());
+            high.processStereoGlide(out.data(), out2.data(), kBlockSize, up ? 8000.0f : 1000.0f);
+            up = !up;
+            gSink = gSink + out[kBlockSize - 1] + out2[kBlockSize - 1];
+        }, kBlockSize, kBlockSize);
+        report("high shelf", "stereo glide", ns);
+    }
+}
+
+void benchOversampler() {
+    if (!selected("oversample")) return;
+
+    std::vector<float> left(kBlockSize);
+    std::vector<float> right(kBlockSize);
+    std::vector<float> wide(static_cast<size_t>(kBlockSize) * Decimator::kMaxFactor);
+    Noise noise(9);
+    for (int i = 0; i < kBlockSize; ++i) {
+        left[i] = 0.5f * noise();
+        right[i] = 0.5f * noise();
+    }
+    for (float& x : wide) {
+        x = 0.5f * noise();
+    }
+
+    // Up and back down with nothing in between, per engine-rate stereo
+    // frame; then the mono decimator the voice FM path uses, per output sample
+    const char* qualities[] = {"draft", "normal", "high"};
+    for (int q = 0; q < 3; ++q) {
+        for (int factor = 2; factor <= 4; factor *= 2) {
+            char variant[32];
+            std::snprintf(variant, sizeof(variant), "%dx %s", factor, qualities[q]);
+
+            Oversampler oversampler;
+            oversampler.configure(factor, static_cast<OversampleQuality>(q));
+            double ns = measure([&]() {
+                oversampler.processStereo(left.data(), right.data(), kBlockSize, [](float*, float*, int) {});
+                gSink = gSink + left[kBlockSize - 1] + right[kBlockSize - 1];
+            }, kBlockSize, kBlockSize);
+            report("oversample stereo", variant, ns);
+
+            Decimator decimator;
+            decimator.configure(factor, static_cast<OversampleQuality>(q));
+            ns = measure([&]() {
+                decimator.process(wide.data(), left.data(), kBlockSize);
+                gSink = gSink + left[kBlockSize - 1];
+            }, kBlockSize, kBlockSize);
+            report("oversample decimate", variant, ns);
+        }
+    }
+}
+
+// Decaying noise bursts keep the tank busy without going silent
+template <typename Reverb>
+double measureReverb(Reverb& reverb) {
+    reverb.setParameters({0.5f, 0.5f, 0.3f, 0.5f, 0.7f, 0.5f, 0.1f, 2.0f});
+    std::vector<float> left(kBlockSize);
+    std::vector<float> right(kBlockSize);
+    Noise noise(1);
+    long blocks = 0;
+    return measure([&]() {
+        float gain = (blocks++ % 64 == 0) ? 0.5f : 0.0f;
+        for (int i = 0; i < kBlockSize; ++i) {
+            left[i] = noise() * gain;
+            right[i] = noise() * gain;
+        }
+        reverb.process(left.data(), right.data(), kBlockSize);
+        gSink = gSink + left[kBlockSize - 1] + right[kBlockSize - 1];
+    }, kBlockSize, kBlockSize);
+}
+
+void benchReverb() {
+    if (!selected("greyhole")) return;
+
+    const GreyholeReverb::Variant variants[] = {GreyholeReverb::Variant::Scalar,
+                                                GreyholeReverb::Variant::Vector};
+    for (GreyholeReverb::Variant variant : variants) {
+        if (!GreyholeReverb::isVariantAvailable(variant)) {
+            continue;
+        }
+        GreyholeReverb reverb(kSampleRate, variant);
+        report("greyhole", GreyholeReverb::variantName(variant), measureReverb(reverb));
+
+        const std::string half = std::string(GreyholeReverb::variantName(variant)) + " half";
+        reverb.setHalfRate(true);
+        report("greyhole", half.c_str(), measureReverb(reverb));
+    }
+}
+
+void benchLateDiff() {
+    if (!selected("latediff")) return;
+
+    // Same parameters and input as benchReverb, so the rows compare
+    LateDiffReverb reverb(kSampleRate);
+    report("latediff", "tank", measureReverb(reverb));
+    reverb.setHalfRate(true);
+    report("latediff", "tank half", measureReverb(reverb));
+}
+
+void benchConvolution() {
+    if (!selected("convolution")) return;
+
+    // The cost grows with the IR length; 4 s of decaying noise per side
+    ConvolutionReverb reverb(kSampleRate);
+    const size_t frames = static_cast<size_t>(4.0f * kSampleRate);
+    std::vector<float> left(frames);
+    std::vector<float> right(frames);
+    Noise noise(7);
+    for (size_t i = 0; i < frames; ++i) {
+        const float envelope = std::pow(10.0f, -3.0f * static_cast<float>(i) / frames);
+        left[i] = noise() * envelope;
+        right[i] = noise() * envelope;
+    }
+    reverb.setImpulse(left.data(), right.data(), frames);
+
+    // Until a whole IR length has gone in, only part of the FDL is summed
+    for (size_t done = 0; done < frames + kBlockSize; done += kBlockSize) {
+        for (int i = 0; i < kBlockSize; ++i) {
+            left[i] = 0.1f * noise();
+            right[i] = 0.1f * noise();
+        }
+        reverb.process(left.data(), right.data(), kBlockSize);
+    }
+    report("convolution", "4 s IR", measureReverb(reverb));
+}
+
+void benchLooper() {
+    if (!selected("looper")) return;
+
+    const uint32_t maxFrames = static_cast<uint32_t>(4 * kSampleRate);
+    const size_t chunks = (maxFrames + LoopChunkPool::kChunkMask) >> LoopChunkPool::kChunkShift;
+    std::vector<float> inL(kBlockSize);
+    std::vector<float> inR(kBlockSize);
+    std::vector<float> outL(kBlockSize);
+    std::vector<float> outR(kBlockSize);
+    Noise noise(5);
+    for (int i = 0; i < kBlockSize; ++i) {
+        inL[i] = 0.3f * noise();
+        inR[i] = 0.3f * noise();
+    }
+
+    const LoopChunkPool::Format formats[] = {LoopChunkPool::Format::Float32,
+                                             LoopChunkPool::Format::Float16};
+    for (LoopChunkPool::Format format : formats) {
+        const bool half = format == LoopChunkPool::Format::Float16;
+        LoopChunkPool pool(chunks, chunks, format);
+
+        // Record a two-second loop, then time playback and overdub
+        Looper looper;
+        looper.reset(&pool, maxFrames);
+        looper.pressRecPlay();
+        const int recordBlocks = static_cast<int>(2 * kSampleRate / kBlockSize);
+        for (int b = 0; b < recordBlocks; ++b) {
+            looper.processBlock(inL.data(), inR.data(), outL.data(), outR.data(), kBlockSize);
+        }
+        looper.pressRecPlay();
+
+        auto run = [&]() {
+            looper.processBlock(inL.data(), inR.data(), outL.data(), outR.data(), kBlockSize);
+            gSink = gSink + outL[kBlockSize - 1] + outR[kBlockSize - 1];
+        };
+        report("looper", half ? "play half" : "play", measure(run, kBlockSize, kBlockSize));
+        looper.pressOverdub();
+        report("looper", half ? "overdub half" : "overdub", measure(run, kBlockSize, kBlockSize));
+    }
+
+    // The manager's mix over all four loops: idle, then with
+    // one loop playing
+    LoopManager manager(kSampleRate);
+    auto mix = [&]() {
+        manager.processBlock(inL.data(), inR.data(), outL.data(), outR.data(), kBlockSize);
+        gSink = gSink + outL[kBlockSize - 1] + outR[kBlockSize - 1];
+    };
+    report("looper", "mix idle", measure(mix, kBlockSize, kBlockSize));
+    manager.getLoop(0)->pressRecPlay();
+    for (int b = 0; b < static_cast<int>(2 * kSampleRate / kBlockSize); ++b) {
+        manager.processBlock(inL.data(), inR.data(), outL.data(), outR.data(), kBlockSize);
+    }
+    manager.getLoop(0)->pressRecPlay();
+    report("looper", "mix 1 playing", measure(mix, kBlockSize, kBlockSize));
+}
+
+void benchOutput() {
+    if (!selected("output")) return;
+
+    // The device stage per stereo frame: limit only (planar float, rendered
+    // in place), then converted into each format, interleaved
+    std::vector<float> mixL(kBlockSize);
+    std::vector<float> mixR(kBlockSize);
+    std::vector<float> left(kBlockSize);
+    std::vector<float> right(kBlockSize);
+    std::vector<int32_t> device(2 * kBlockSize);
+    Noise noise(6);
+    for (int i = 0; i < kBlockSize; ++i) {
+        mixL[i] = 1.2f * noise();
+        mixR[i] = 1.2f * noise();
+    }
+    OutputStage stage;
+    auto run = [&](void* target) {
+        return [&, target]() {
+            std::copy(mixL.begin(), mixL.end(), left.begin());
+            std::copy(mixR.begin(), mixR.end(), right.begin());
+            stage.process(left.data(), right.data(), kBlockSize, target, kBlockSize);
+            gSink = gSink + left[kBlockSize - 1] + static_cast<float>(device[1]);
+        };
+    };
+    report("output", "limit", measure(run(nullptr), kBlockSize, kBlockSize));
+    const struct {
+        const char* name;
+        SampleFormat format;
+        bool dither;
+    } cases[] = {
+        {"float", SampleFormat::FLOAT32, false},
+        {"s32", SampleFormat::SINT32, false},
+        {"s24", SampleFormat::SINT24, false},
+        {"s16", SampleFormat::SINT16, false},
+        {"s16 dither", SampleFormat::SINT16, true},
+    };
+    for (const auto& c : cases) {
+        stage.setFormat(c.format, true);
+        stage.setDither(c.dither);
+        report("output", c.name, measure(run(device.data()), kBlockSize, kBlockSize));
+    }
+}
+
+void benchMarkov() {
+    if (!selected("markov")) return;
+
+    // Four octaves of chromatic states; reported per draw. "learning"
+    // reinforces every transition it takes, so each draw rebuilds a row
+    std::vector<int> notes;
+    for (int note = 36; note < 84; ++note) {
+        notes.push_back(note);
+    }
+    MarkovChain markov;
+    markov.initialize(notes);
+    markov.setOrbitingPattern(60);
+    rng::Stream rng(1);
+
+    double ns = measure([&]() {
+        int sum = 0;
+        for (int i = 0; i < kBlockSize; ++i) {
+            sum += markov.getNextState(rng);
+        }
+        gSink = gSink + sum;
+    }, kBlockSize, kBlockSize);
+    report("markov 48 states", "draw", ns);
+
+    ns = measure([&]() {
+        int sum = 0;
+        for (int i = 0; i < kBlockSize; ++i) {
+            sum += markov.getNextState(rng);
+            markov.reinforceLastTransition(0.01f);
+        }
+        gSink = gSink + sum;
+    }, kBlockSize, kBlockSize);
+    report("markov 48 states", "learning", ns);
+}
+
+void benchSynth() {
+    if (!selected("synth")) return;
+
+    struct Config {
+        int voices;
+        bool effects;
+    };
+    std::vector<Config> configs = {{1, false}, {4, false}, {8, false}, {8, true}};
+    if (MAX_VOICES > 8) {
+        configs.push_back({MAX_VOICES, false});
+        configs.push_back({MAX_VOICES, true});
+    }
+
+    for (const Config& config : configs) {
+        for (int variant = 0; variant < (gVoiceThreads > 0 ? 4 : 2); ++variant) {
+            const int soa = variant % 2;
+            const int threads = variant >= 2 ? gVoiceThreads : 0;
+            if (threads > 0 && config.voices < 4) {
+                continue;  // Renders inline anyway
+            }
+            std::unique_ptr<Synth> synth(new Synth(kSampleRate));
+            synth->setVoiceBankEnabled(soa != 0);
+            synth->setVoiceThreads(threads);
+            for (int o = 0; o < OSCILLATORS_PER_VOICE; ++o) {
+                synth->setOscillatorState(o, BrainwaveMode::KEY, o % 2, 440.0f, 0.2f + 0.15f * o,
+                                          0.4f, static_cast<float>(o + 1), 0.0f, 1.0f, 0.25f);
+            }
+            // Long release keeps every voice sounding for the whole run
+            synth->updateEnvelopeParameters(0.005f, 0.1f, 0.8f, 5.0f);
+            if (config.effects) {
+                synth->setFilterEnabled(true);
+                synth->updateFilterParameters(4, 1200.0f, 0.0f, 0.5f, 0.3f, 20.0f);
+                synth->setReverbEnabled(true);
+                synth->updateReverbParameters(0.5f, 0.5f, 0.3f, 0.5f, 0.7f, 0.5f, 0.1f, 2.0f);
+            }
+            for (int v = 0; v < config.voices; ++v) {
+                synth->noteOn(36 + (12 + 5 * v) % 72, 100);
+            }
+
+            std::vector<float> left(kBlockSize);
+            std::vector<float> right(kBlockSize);
+            double ns = measure([&]() {
+                synth->process(left.data(), right.data(), kBlockSize);
+                gSink = gSink + left[kBlockSize - 1] + right[kBlockSize - 1];
+            }, kBlockSize, kBlockSize);
+
+            char name[32];
+            std::snprintf(name, sizeof(name), "synth %d voice%s%s", config.voices,
+                          config.voices > 1 ? "s" : "", config.effects ? " +fx" : "");
+            char variantName[32];
+            std::snprintf(variantName, sizeof(variantName), "%s%s", soa ? "soa" : "scalar",
+                          threads > 0 ? " +threads" : "");
+            report(name, variantName, ns);
+        }
+    }
+
+    // Eight voices with OSC2 modulating OSC1 and OSC3 modulating itself, at
+    // the engine rate and with the FM path oversampled. The voices need the
+    // parameter link to see the FM routes
+    std::unique_ptr<SynthParameters> params(new SynthParameters());
+    SynthParamBlock block;
+    block.fmMatrix[0][1] = 0.02f;
+    block.fmMatrix[2][2] = 0.01f;
+    for (int factor = 1; factor <= 4; factor *= 2) {
+        std::unique_ptr<Synth> synth(new Synth(kSampleRate));
+        synth->setParams(params.get());
+        synth->setParameterBlock(&block);
+        synth->setOversampling(1, factor, OversampleQuality::Normal);
+        for (int o = 0; o < OSCILLATORS_PER_VOICE; ++o) {
+            synth->setOscillatorState(o, BrainwaveMode::KEY, o % 2, 440.0f, 0.2f + 0.15f * o,
+                                      0.4f, static_cast<float>(o + 1), 0.0f, 1.0f, 0.25f);
+        }
+        synth->updateEnvelopeParameters(0.005f, 0.1f, 0.8f, 5.0f);
+        for (int v = 0; v < 8 && v < MAX_VOICES; ++v) {
+            synth->noteOn(36 + (12 + 5 * v) % 72, 100);
+        }
+
+        std::vector<float> left(kBlockSize);
+        std::vector<float> right(kBlockSize);
+        double ns = measure([&]() {
+            synth->process(left.data(), right.data(), kBlockSize);
+            gSink = gSink + left[kBlockSize - 1] + right[kBlockSize - 1];
+        }, kBlockSize, kBlockSize);
+        report("synth 8 voices fm", factor == 1 ? "scalar" : (factor == 2 ? "scalar 2x" : "scalar 4x"), ns);
+    }
+}
+
+// Worst-case block: every stage the live callback can run, at its most
+// expensive setting, rendered block by block the way audioCallback does
+// (sequencer events split the block, loopers after the synth). Each block
+// is timed on its own and the distribution reported against the deadline,
+// since a missed block is what is heard, not the mean. Only run when the
+// filter names it; it renders gWorstCaseSeconds of audio
+void benchWorstCase() {
+    if (!gFilter || !std::strstr("wcet", gFilter)) return;
+
+    std::unique_ptr<SynthParameters> params(new SynthParameters());
+    SynthParamBlock block;
+    for (auto& row : block.fmMatrix) {
+        for (float& depth : row) {
+            depth = 0.01f;                      // Every oscillator and sampler into every other
+        }
+    }
+    std::unique_ptr<Synth> synth(new Synth(kSampleRate));
+    synth->setParams(params.get());
+    synth->setParameterBlock(&block);
+    synth->setOversampling(4, 4, OversampleQuality::High);
+    for (int o = 0; o < OSCILLATORS_PER_VOICE; ++o) {
+        synth->setOscillatorState(o, BrainwaveMode::KEY, o % 2, 440.0f, 0.2f + 0.15f * o,
+                                  0.4f, static_cast<float>(o + 1), 0.0f, 1.0f, 0.25f);
+    }
+    synth->updateEnvelopeParameters(0.005f, 0.1f, 0.8f, 5.0f);
+
+    // Ladder at full drive, Greyhole at full size
+    synth->setFilterEnabled(true);
+    synth->updateFilterParameters(4, 1200.0f, 0.0f, 0.9f, 15.0f, 20.0f);
+    synth->setReverbEnabled(true);
+    synth->setReverbType(static_cast<int>(ReverbType::GREYHOLE));
+    synth->updateReverbParameters(1.0f, 1.0f, 0.3f, 0.5f, 0.9f, 1.0f, 1.0f, 2.0f);
+
+    // Every sampler on a short loop that is all crossfade, interpolated
+    // with the widest kernel
+    const uint32_t sampleFrames = static_cast<uint32_t>(2 * kSampleRate);
+    int16_t* pcm = new int16_t[sampleFrames];
+    Noise noise(11);
+    for (uint32_t i = 0; i < sampleFrames; ++i) {
+        float t = static_cast<float>(i) / kSampleRate;
+        float s = 0.4f * std::sin(2.0f * 3.14159265f * 220.0f * t) +
+                  0.3f * std::sin(2.0f * 3.14159265f * 331.0f * t) + 0.05f * noise();
+        pcm[i] = static_cast<int16_t>(std::clamp(s, -1.0f, 1.0f) * 32767.0f);
+    }
+    SampleData* sample = new SampleData();
+    sample->samples = pcm;
+    sample->sampleCount = sampleFrames;
+    sample->sampleRate = static_cast<uint32_t>(kSampleRate);
+    sample->ownsSamples = true;
+    sample->name = "wcet";
+    sample->path = "wcet";
+    const int sampleIndex = synth->getSampleBank()->adoptSample(sample);
+    for (int s = 0; s < SAMPLERS_PER_VOICE; ++s) {
+        synth->setSamplerSample(s, sampleIndex);
+        synth->setSamplerLoopStart(s, 0.2f);
+        synth->setSamplerLoopLength(s, 0.02f);
+        synth->setSamplerCrossfadeLength(s, 1.0f);
+        synth->setSamplerPlaybackSpeed(s, 1.37f);
+        synth->setSamplerInterpolation(s, SamplerInterpolation::SINC);
+        synth->setSamplerLevel(s, 1.0f);
+    }
+
+    // All sixteen modulation slots routed, half from the per-voice envelope
+    for (int i = 0; i < kModulationSlotCount; ++i) {
+        ModulationSlot& slot = synth->getModulationSlots()[i];
+        slot.source = static_cast<int8_t>(i % 2 ? kEnvelopeModSourceIndex : (i / 2) % 4);
+        slot.curve = static_cast<int8_t>(i % 4);
+        slot.amount = 30;
+        slot.destination = static_cast<int8_t>((i * 4 + 1) % kClockTargetSequencerBase);
+        slot.type = static_cast<int8_t>(i % 2);
+    }
+
+    // Every sequencer track on every 1/64 step
+    Clock clock(kSampleRate);
+    synth->setClock(&clock);
+    Sequencer seq(&clock, synth.get());
+    sequencer = &seq;
+    for (int t = 0; t < seq.getTrackCount(); ++t) {
+        seq.setCurrentTrack(t);
+        seq.getCurrentTrack().setSubdivision(Subdivision::SIXTYFOURTH);
+        seq.setEuclideanPattern(16, 16, 0);
+        seq.generatePattern();
+    }
+    seq.finishPatternJobs();
+    seq.setTempo(120.0);
+    seq.play();
+
+    // All four loops recording for two seconds, then overdubbing
+    LoopManager loops(kSampleRate);
+    for (int l = 0; l < 4; ++l) {
+        loops.getLoop(l)->pressRecPlay();
+    }
+
+    EventSchedule schedule;
+    std::vector<float> synthL(kBlockSize);
+    std::vector<float> synthR(kBlockSize);
+    std::vector<float> outL(kBlockSize);
+    std::vector<float> outR(kBlockSize);
+    long notes = 0;
+    auto render = [&]() {
+        schedule.clear();
+        seq.process(kBlockSize, schedule);
+        synth->processLFOs(kSampleRate, kBlockSize);
+        synth->processChaos(kBlockSize);
+        for (unsigned int pos = 0; pos < static_cast<unsigned int>(kBlockSize);) {
+            schedule.dispatchThrough(pos, [&](const ScheduledEvent& event) {
+                if (event.type == ScheduledEvent::NOTE_ON) {
+                    synth->noteOn(event.note, event.velocity);
+                    ++notes;
+                } else {
+                    synth->noteOff(event.note);
+                }
+            });
+            const unsigned int end = std::min<uint32_t>(kBlockSize, schedule.nextFrame());
+            synth->process(synthL.data() + pos, synthR.data() + pos, end - pos);
+            loops.processBlock(synthL.data() + pos, synthR.data() + pos, outL.data() + pos,
+                               outR.data() + pos, end - pos);
+            pos = end;
+        }
+        synth->publishTelemetry();
+        gSink = gSink + outL[kBlockSize - 1] + outR[kBlockSize - 1];
+    };
+
+    // Untimed: voices filling, loops recorded, storage topped up as the UI
+    // loop does live
+    for (int v = 0; v < MAX_VOICES; ++v) {
+        synth->noteOn(36 + (12 + 5 * v) % 72, 100);
+    }
+    const int recordBlocks = static_cast<int>(2 * kSampleRate / kBlockSize);
+    for (int b = 0; b < recordBlocks; ++b) {
+        render();
+        loops.refillStorage();
+    }
+    for (int l = 0; l < 4; ++l) {
+        loops.getLoop(l)->pressRecPlay();
+    }
+    render();
+    for (int l = 0; l < 4; ++l) {
+        loops.getLoop(l)->pressOverdub();
+    }
+    notes = 0;
+
+    const long blocks = std::max(1L, static_cast<long>(gWorstCaseSeconds * kSampleRate / kBlockSize));
+    std::vector<double> us(static_cast<size_t>(blocks));
+    for (long b = 0; b < blocks; ++b) {
+        auto start = std::chrono::steady_clock::now();
+        render();
+        auto end = std::chrono::steady_clock::now();
+        us[b] = std::chrono::duration<double, std::micro>(end - start).count();
+        loops.refillStorage();
+    }
+    sequencer = nullptr;
+
+    double mean = 0.0;
+    for (double t : us) {
+        mean += t;
+    }
+    mean /= static_cast<double>(blocks);
+    std::sort(us.begin(), us.end());
+    auto quantile = [&](double q) {
+        return us[std::min(static_cast<size_t>(q * static_cast<double>(blocks)), us.size() - 1)];
+    };
+    const double deadline = 1e6 * kBlockSize / kSampleRate;
+    std::printf("wcet: %.0f s of audio, %ld blocks, %ld sequencer notes, %d voices, %d mod slots\n",
+                gWorstCaseSeconds, blocks, notes, MAX_VOICES, kModulationSlotCount);
+    const struct {
+        const char* name;
+        double value;
+    } rows[] = {{"mean", mean}, {"p99", quantile(0.99)}, {"p99.9", quantile(0.999)}, {"max", us.back()}};
+    for (const auto& row : rows) {
+        std::printf("%-22s %-14s %9.1f us/block %9.1f%% of %.0f us\n",
+                    "wcet block", row.name, row.value, 100.0 * row.value / deadline, deadline);
+    }
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--seconds") == 0 && i + 1 < argc) {
+            gSeconds = std::atof(argv[++i]);
+            if (gSeconds <= 0.0) {
+                gSeconds = 2.0;
+            }
+        } else if (std::strcmp(argv[i], "--voice-threads") == 0 && i + 1 < argc) {
+            gVoiceThreads = std::atoi(argv[++i]);
+        } else if (std::strcmp(argv[i], "--wcet-seconds") == 0 && i + 1 < argc) {
+            gWorstCaseSeconds = std::max(1.0, std::atof(argv[++i]));
+        } else {
+            gFilter = argv[i];
+        }
+    }
+
+    std::printf("synth_bench: %.0f Hz, %d-frame blocks, best of %d x %.1f s\n",
+                kSampleRate, kBlockSize, kRuns, gSeconds);
+    benchOscillator();
+    benchSampler();
+    benchEnvelope();
+    benchModulators();
+    benchFilters();
+    benchOversampler();
+    benchReverb();
+    benchLateDiff();
+    benchConvolution();
+    benchLooper();
+    benchOutput();
+    benchMarkov();
+    benchSynth();
+    benchWorstCase();
+    return 0;
+}
@@ -0,0 +1,246 @@
+// Regenerates brainwave/pico/wavetable_data.h from a wavetable WAV.
+//
+// The WAV holds single-cycle frames of a fixed length back to back
+// (16-bit mono). Each frame is band-limited with an FFT and stored at one
+// size per octave:
+//
+//   level 0   2^top_bits samples, harmonics 1 .. 2^(top_bits - 2)
+//   level k   half the samples and half the harmonics of level k - 1
+//
+// so every level is 4x oversampled for the sketch's linear interpolation,
+// and the oscillator picks the level from its phase increment so that no
+// partial passes Nyquist (WT_SAFE_INC_BITS). All levels of a frame are
+// stored together, level 0 first (wtcore::MipLayout in
+// pico/wavetable_core.h, which the sketch checks against). Samples are 12-bit offset binary
+// (0..4095, silence 2048) as the PWM takes them, scaled by one factor
+// for the whole table so band-limiting overshoot never clips.
+//
+// --pack12 stores two samples in three bytes instead of one int16_t each.
+//
+//   ./brainwave_wavetable_gen in.wav out.h [--frame-len 2048] [--top-bits 8]
+//                             [--levels 7] [--pack12]
+//
+// The checked-in table, from wakefield/ (after a CMake build in build/):
+//   build/brainwave_wavetable_gen brainwave/pico/brainwave_wavetable.wav
+//       brainwave/pico/wavetable_data.h --pack12
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+#include "../../shared/dsp/real_fft.h"
+
+namespace {
+
+struct Options {
+    const char* inPath = nullptr;
+    const char* outPath = nullptr;
+    int frameLen = 2048;
+    int topBits = 8;
+    int levels = 7;
+    bool pack12 = false;
+};
+
+uint32_t readLe(const uint8_t* p, int bytes) {
+    uint32_t v = 0;
+    for (int i = bytes - 1; i >= 0; --i) {
+        v = (v << 8) | p[i];
+    }
+    return v;
+}
+
+// 16-bit mono PCM samples of a RIFF/WAVE file, scaled to [-1, 1)
+bool readWav(const char* path, std::vector<double>& out) {
+    FILE* file = std::fopen(path, "rb");
+    if (!file) {
+        std::fprintf(stderr, "%s: cannot open\n", path);
+        return false;
+    }
+    std::vector<uint8_t> bytes;
+    uint8_t buf[65536];
+    size_t n;
+    while ((n = std::fread(buf, 1, sizeof(buf), file)) > 0) {
+        bytes.insert(bytes.end(), buf, buf + n);
+    }
+    std::fclose(file);
+
+    if (bytes.size() < 12 || std::memcmp(&bytes[0], "RIFF", 4) != 0 || std::memcmp(&bytes[8], "WAVE", 4) != 0) {
+        std::fprintf(stderr, "%s: not a WAV file\n", path);
+        return false;
+    }
+    bool formatOk = false;
+    for (size_t pos = 12; pos + 8 <= bytes.size();) {
+        const uint32_t size = readLe(&bytes[pos + 4], 4);
+        const uint8_t* body = &bytes[pos + 8];
+        if (pos + 8 + size > bytes.size()) {
+            break;
+        }
+        if (std::memcmp(&bytes[pos], "fmt ", 4) == 0 && size >= 16) {
+            formatOk = readLe(body, 2) == 1 && readLe(body + 2, 2) == 1 && readLe(body + 14, 2) == 16;
+        } else if (std::memcmp(&bytes[pos], "data", 4) == 0) {
+            if (!formatOk) {
+                std::fprintf(stderr, "%s: need 16-bit mono PCM\n", path);
+                return false;
+            }
+            out.resize(size / 2);
+            for (size_t i = 0; i < out.size(); ++i) {
+                out[i] = static_cast<int16_t>(readLe(body + 2 * i, 2)) / 32768.0;
+            }
+            return true;
+        }
+        pos += 8 + size + (size & 1);
+    }
+    std::fprintf(stderr, "%s: no data chunk\n", path);
+    return false;
+}
+
+bool parseArgs(int argc, char** argv, Options& opt) {
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        if (arg == "--pack12") {
+            opt.pack12 = true;
+        } else if ((arg == "--frame-len" || arg == "--top-bits" || arg == "--levels") && i + 1 < argc) {
+            const int v = std::atoi(argv[++i]);
+            (arg == "--frame-len" ? opt.frameLen : arg == "--top-bits" ? opt.topBits : opt.levels) = v;
+        } else if (!opt.inPath) {
+            opt.inPath = argv[i];
+        } else if (!opt.outPath) {
+            opt.outPath = argv[i];
+        } else {
+            return false;
+        }
+    }
+    if (!opt.inPath || !opt.outPath) {
+        return false;
+    }
+    if (opt.frameLen < 4 || (opt.frameLen & (opt.frameLen - 1)) != 0) {
+        std::fprintf(stderr, "--frame-len must be a power of 2\n");
+        return false;
+    }
+    // The smallest level needs 4 samples (one harmonic, 4x oversampled)
+    if (opt.topBits < 2 || (1 << opt.topBits) > opt.frameLen || opt.levels < 1 || opt.levels > opt.topBits - 1) {
+        std::fprintf(stderr, "need 2^top_bits <= frame length and 1 <= levels <= top_bits - 1\n");
+        return false;
+    }
+    return true;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    Options opt;
+    if (!parseArgs(argc, argv, opt)) {
+        std::fprintf(stderr, "usage: %s in.wav out.h [--frame-len N] [--top-bits N] [--levels N] [--pack12]\n",
+                     argv[0]);
+        return 2;
+    }
+
+    std::vector<double> wav;
+    if (!readWav(opt.inPath, wav)) {
+        return 1;
+    }
+    const int frames = static_cast<int>(wav.size() / opt.frameLen);
+    if (frames < 2) {
+        std::fprintf(stderr, "%s: fewer than 2 frames of %d samples\n", opt.inPath, opt.frameLen);
+        return 1;
+    }
+
+    const int topSize = 1 << opt.topBits;
+    const int span = 2 * topSize - ((2 * topSize) >> opt.levels);   // All levels of one frame
+
+    // Band-limit every frame at every level
+    std::vector<double> table(static_cast<size_t>(frames) * span);
+    kernels::RealFFT analysis(opt.frameLen);
+    std::vector<float> source(opt.frameLen);
+    std::vector<float> re(opt.frameLen / 2 + 1);
+    std::vector<float> im(opt.frameLen / 2 + 1);
+    std::vector<kernels::RealFFT> synthesis;
+    for (int level = 0; level < opt.levels; ++level) {
+        synthesis.emplace_back(topSize >> level);
+    }
+    // The inverse scales by size / 2; take out the forward's frame length too
+    const float gain = 2.0f / opt.frameLen;
+    std::vector<float> bandOut(topSize);
+    double peak = 0.0;
+    for (int f = 0; f < frames; ++f) {
+        for (int n = 0; n < opt.frameLen; ++n) {
+            source[n] = static_cast<float>(wav[static_cast<size_t>(f) * opt.frameLen + n]);
+        }
+        analysis.forward(source.data(), re.data(), im.data());
+
+        double* out = &table[static_cast<size_t>(f) * span];
+        for (int level = 0; level < opt.levels; ++level) {
+            const int size = topSize >> level;
+            const int maxHarmonic = size / 4;
+            std::vector<float> bandRe(size / 2 + 1, 0.0f);
+            std::vector<float> bandIm(size / 2 + 1, 0.0f);
+            for (int h = 1; h <= maxHarmonic; ++h) {     // DC dropped: silence is mid-scale
+                bandRe[h] = re[h] * gain;
+                bandIm[h] = im[h] * gain;
+            }
+            synthesis[level].inverse(bandRe.data(), bandIm.data(), bandOut.data());
+            for (int n = 0; n < size; ++n) {
+                out[n] = bandOut[n];
+                peak = std::max(peak, std::abs(out[n]));
+            }
+            out += size;
+        }
+    }
+    const double scale = peak > 0.0 ? 2047.0 / peak : 0.0;
+
+    std::vector<uint16_t> samples(table.size());
+    for (size_t i = 0; i < table.size(); ++i) {
+        const long v = std::lround(2048.0 + table[i] * scale);
+        samples[i] = static_cast<uint16_t>(std::min(std::max(v, 0L), 4095L));
+    }
+
+    FILE* out = std::fopen(opt.outPath, "w");
+    if (!out) {
+        std::fprintf(stderr, "%s: cannot write\n", opt.outPath);
+        return 1;
+    }
+    const char* inName = std::strrchr(opt.inPath, '/') ? std::strrchr(opt.inPath, '/') + 1 : opt.inPath;
+    std::fprintf(out,
+        "// Generated by brainwave/gen_wavetable.cpp from %s; do not edit.\n"
+        "//   --frame-len %d --top-bits %d --levels %d%s\n"
+        "#pragma once\n"
+        "#include <stdint.h>\n\n"
+        "#define WT_FRAMES      %d\n"
+        "#define WT_TOP_BITS    %d      // Level 0: %d samples, harmonics 1..%d\n"
+        "#define WT_LEVELS      %d      // Level k: WT_TOP_BITS - k bits, half the harmonics of k - 1\n"
+        "#define WT_FRAME_SPAN  %d    // Samples per frame, all levels\n"
+        "#define WT_PACKED12    %d      // 1: two samples per three bytes\n\n"
+        "// Level k of a frame starts this many samples into it\n"
+        "#define WT_LEVEL_OFFSET(k) (2 * (1 << WT_TOP_BITS) - ((2 * (1 << WT_TOP_BITS)) >> (k)))\n\n"
+        "// Level 0 is alias-free while the phase increment (2^32 = one cycle per\n"
+        "// sample) is below 2^WT_SAFE_INC_BITS; each level doubles that\n"
+        "#define WT_SAFE_INC_BITS %d\n\n",
+        inName, opt.frameLen, opt.topBits, opt.levels, opt.pack12 ? " --pack12" : "",
+        frames, opt.topBits, topSize, topSize / 4, opt.levels, span, opt.pack12 ? 1 : 0,
+        31 - (opt.topBits - 2));
+
+    if (opt.pack12) {
+        std::fprintf(out, "const uint8_t wavetable[%zu] PROGMEM = {\n", samples.size() / 2 * 3);
+        for (size_t i = 0; i < samples.size(); i += 2) {
+            const uint16_t a = samples[i];
+            const uint16_t b = samples[i + 1];
+            std::fprintf(out, "%d,%d,%d,%s", a & 0xFF, (a >> 8) | ((b & 0x0F) << 4), b >> 4,
+                         (i / 2) % 8 == 7 ? "\n" : "");
+        }
+    } else {
+        std::fprintf(out, "const uint16_t wavetable[%zu] PROGMEM = {\n", samples.size());
+        for (size_t i = 0; i < samples.size(); ++i) {
+            std::fprintf(out, "%d,%s", samples[i], i % 16 == 15 ? "\n" : "");
+        }
+    }
+    std::fprintf(out, "};\n");
+    std::fclose(out);
+
+    std::printf("%d frames x %d samples (%d levels), scale %.4f, %zu bytes of table\n",
+                frames, span, opt.levels, scale / 2047.0,
+                opt.pack12 ? samples.size() / 2 * 3 : samples.size() * 2);
+    return 0;
+}
@@ -1,4 +1,5 @@
 #include "DACless.h"
+#include "audio_profiler.h"
 #include <hardware/adc.h>
 #include <hardware/pwm.h>
 #include <hardware/dma.h>
@@ -13,37 +14,26 @@
 // Static registry of instances (no dynamic allocation)
 DAClessAudio* DAClessAudio::instances_[DAClessAudio::MAX_INSTANCES] = {nullptr};
 uint DAClessAudio::instanceCount_ = 0;
+DAClessAudio* DAClessAudio::channelOwner_[NUM_DMA_CHANNELS] = {nullptr};
 
 // Compatibility globals (point to first/active instance)
 float audio_rate = 0;
 volatile uint16_t* out_buf_ptr = nullptr;
 const volatile uint16_t* adc_results_buf = nullptr;
 
-// Helper to find instance by DMA channel
-DAClessAudio* DAClessAudio::findInstanceByDmaChannel(uint channel) {
-    for (uint i = 0; i < instanceCount_; i++) {
-        DAClessAudio* inst = instances_[i];
-        if (inst && (inst->dmaA_ == channel || inst->dmaB_ == channel)) {
-            return inst;
-        }
-    }
-    return nullptr;
-}
-
-// Global IRQ handler that routes to the correct instance
-void dma_irq1_handler() {
+// Global IRQ handler that routes to the correct instance (runs from RAM)
+void __not_in_flash_func(dma_irq1_handler)() {
     uint32_t pending = dma_hw->ints1;
+    dma_hw->ints1 = pending;  // Clear everything we are about to handle
     
-    // Check all possible DMA channels (RP2040 has 12)
-    for (uint ch = 0; ch < 12; ch++) {
-        if (pending & (1u << ch)) {
-            dma_hw->ints1 = 1u << ch;  // Clear interrupt
-            
-            // Find which instance owns this channel and pass the channel number
-            DAClessAudio* inst = DAClessAudio::findInstanceByDmaChannel(ch);
-            if (inst) {
-                inst->handleDmaIrq(ch);
-            }
+    // Visit only the pending channels, lowest first
+    while (pending) {
+        uint ch = __builtin_ctz(pending);
+        pending &= pending - 1;
+        
+        DAClessAudio* inst = DAClessAudio::channelOwner_[ch];
+        if (inst) {
+            inst->handleDmaIrq(ch);
         }
     }
 }
@@ -83,6 +73,12 @@ DAClessAudio::DAClessAudio(const DAClessConfig& cfg) : cfg_(cfg),
 
 // Destructor
 DAClessAudio::~DAClessAudio() {
+    // Stop routing IRQs here before the channels are torn down
+    uint32_t save = save_and_disable_interrupts();
+    if (dmaA_ != -1u) channelOwner_[dmaA_] = nullptr;
+    if (dmaB_ != -1u) channelOwner_[dmaB_] = nullptr;
+    restore_interrupts(save);
+    
     // Stop and release DMA channels
     if (dmaA_ != -1u) {
         dma_channel_abort(dmaA_);
@@ -102,7 +98,7 @@ DAClessAudio::~DAClessAudio() {
     }
     
     // Remove from registry (protect against concurrent access)
-    uint32_t save = save_and_disable_interrupts();
+    save = save_and_disable_interrupts();
     for (uint i = 0; i < instanceCount_; i++) {
         if (instances_[i] == this) {
             // Shift remaining instances down
@@ -129,6 +125,14 @@ void DAClessAudio::begin() {
         adc_results_buf = adcBuf_;
     }
     
+#ifdef AUDIO_PROFILE
+    // One sample is 2^pwmBits clocks (clkdiv 1); ping-pong, so the block
+    // being filled plays after the other one
+    if (instances_[0] == this) {
+        prof_init((1u << cfg_.pwmBits) * cfg_.blockSize, 2);
+    }
+#endif
+    
     // Set up hardware
     setupInterpolators();
     configurePWM_DMA();
@@ -163,7 +167,7 @@ uint16_t DAClessAudio::getADC(uint8_t channel) const {
     return adcBuf_[channel];
 }
 
-void DAClessAudio::handleDmaIrq(uint channel) {
+void __not_in_flash_func(DAClessAudio::handleDmaIrq)(uint channel) {
     // Determine which buffer just started playing and prepare the other
     if (channel == dmaA_) {
         outBufPtr_ = pwmBufA_;
@@ -178,6 +182,7 @@ void DAClessAudio::handleDmaIrq(uint channel) {
     
     // Call appropriate callback to fill the buffer
     if (bufReady_) {
+        PROF_BLOCK_BEGIN();
         if (blockCb_) {
             // Use block callback
             blockCb_(userPtr_, const_cast<uint16_t*>(outBufPtr_));
@@ -194,9 +199,48 @@ void DAClessAudio::handleDmaIrq(uint channel) {
             }
         }
         bufReady_ = false;
+        PROF_SECTION(PROF_SEC_RENDER);
+        PROF_BLOCK_END();
+        recordSlack(channel);
     }
 }
 
+// The other channel is playing, and the samples it has left are the slack;
+// if this one is already busy, the DMA reached the buffer before we did.
+// Positions come from the read address, which wraps on the aligned buffer
+void __not_in_flash_func(DAClessAudio::recordSlack)(uint channel) {
+    const uint other = (channel == dmaA_) ? dmaB_ : dmaA_;
+    const uint32_t mask = cfg_.blockSize * sizeof(uint16_t) - 1u;
+    const int32_t cyclesPerSample = 1 << cfg_.pwmBits;     // Wrap 2^bits - 1, clkdiv 1
+    int32_t slack = 0;                                     // Neither busy: ours starts now
+    if (dma_channel_is_busy(channel)) {
+        const uint32_t played = (dma_hw->ch[channel].read_addr & mask) / sizeof(uint16_t);
+        slack = -(int32_t)played * cyclesPerSample;
+    } else if (dma_channel_is_busy(other)) {
+        const uint32_t played = (dma_hw->ch[other].read_addr & mask) / sizeof(uint16_t);
+        slack = (int32_t)(cfg_.blockSize - played) * cyclesPerSample;
+    }
+    if (slack < 0) {
+        underruns_ = underruns_ + 1u;
+        PROF_EVENT(PROF_EV_UNDERRUN);
+    } else if (slack < (int32_t)(cfg_.blockSize / 4u) * cyclesPerSample) {
+        nearMisses_ = nearMisses_ + 1u;
+        PROF_EVENT(PROF_EV_NEAR_MISS);
+    }
+    if (slack < slackMin_) slackMin_ = slack;
+    healthBlocks_ = healthBlocks_ + 1u;
+    PROF_OUTPUT_SLACK(slack);
+}
+
+DAClessAudio::Health DAClessAudio::getHealth() const {
+    Health h;
+    h.blocks = healthBlocks_;
+    h.underruns = underruns_;
+    h.nearMisses = nearMisses_;
+    h.slackMin = slackMin_;
+    return h;
+}
+
 void DAClessAudio::setupInterpolators() {
     // Configure hardware interpolators for efficient linear interpolation
     // NOTE: These are global hardware resources shared between all instances.
@@ -234,6 +278,8 @@ void DAClessAudio::configurePWM_DMA() {
 
     dmaA_ = dma_claim_unused_channel(true);
     dmaB_ = dma_claim_unused_channel(true);
+    channelOwner_[dmaA_] = this;
+    channelOwner_[dmaB_] = this;
     
     // Calculate size bits for ring buffer
     uint size_bytes = cfg_.blockSize * sizeof(uint16_t);
@@ -43,6 +43,18 @@ public:
     // Get configuration
     const DAClessConfig& getConfig() const { return cfg_; }
     
+    // Output health, counted by the DMA IRQ after each render since begin():
+    // the slack is the cycles left before the DMA plays the buffer just
+    // filled, negative when it got there first (an underrun, part of the
+    // buffer played stale). Under a quarter block of slack is a near miss
+    struct Health {
+        uint32_t blocks;
+        uint32_t underruns;
+        uint32_t nearMisses;
+        int32_t  slackMin;     // Cycles (INT32_MAX before the first block)
+    };
+    Health getHealth() const;
+    
     // Public access to buffers for compatibility (read-only)
     const volatile uint16_t* getOutBufPtr() const { return outBufPtr_; }
     const volatile uint16_t* getAdcBuffer() const { return adcBuf_; }
@@ -68,6 +80,12 @@ private:
     volatile uint16_t* outBufPtr_ = nullptr; // Pointer to current audio output buffer
     volatile bool      bufReady_  = false;   // Set true when buffer is ready to fill
     
+    // Output health (IRQ writes, any core reads)
+    volatile uint32_t healthBlocks_ = 0;
+    volatile uint32_t underruns_    = 0;
+    volatile uint32_t nearMisses_   = 0;
+    volatile int32_t  slackMin_     = INT32_MAX;
+    
     // For callbacks
     SampleCallback  sampleCb_ = nullptr;
     BlockCallback   blockCb_  = nullptr;
@@ -78,6 +96,7 @@ private:
     void configurePWM_DMA();
     void configureADC_DMA();
     void handleDmaIrq(uint channel); // Called when DMA transfer finishes for this instance
+    void recordSlack(uint channel);  // After a render into the channel's buffer
     
     // Helper to calculate DMA ring buffer size bits
     static uint calculateRingBits(uint bufferSizeBytes);
@@ -86,7 +105,10 @@ private:
     static constexpr uint MAX_INSTANCES = 4;
     static DAClessAudio* instances_[MAX_INSTANCES];
     static uint instanceCount_;
-    static DAClessAudio* findInstanceByDmaChannel(uint channel);
+    // Owner of each DMA channel whose completion IRQ we route, by channel
+    // number; filled when the channels are claimed, so the IRQ looks it up
+    // instead of scanning instances_
+    static DAClessAudio* channelOwner_[NUM_DMA_CHANNELS];
     
     // Friend function for IRQ handler
     friend void dma_irq1_handler();
@@ -0,0 +1,197 @@
+/**
+ * @file audio_profiler.h
+ * @brief Cycle-accurate profiler for the audio render interrupt
+ *
+ * Compiled in only with AUDIO_PROFILE defined (e.g. in build_opt.h); the
+ * PROF_* macros below are empty otherwise, so a normal build carries no
+ * cost. Printing from the audio core is what got the old debug polls
+ * disabled, so the two halves are split by core:
+ *
+ * **Audio core (DMA IRQ)**: PROF_BLOCK_BEGIN/PROF_SECTION/PROF_BLOCK_END
+ * timestamp each block with the SysTick counter (processor clock, so one
+ * count is one cycle) and fold the figures into RAM accumulators: min,
+ * mean and max per section and per block, the smallest DMA slack, a load
+ * histogram and event counters. A few loads, adds and compares per block.
+ *
+ * **Other core**: prof_stream() asks the IRQ for its accumulators, which
+ * it hands over (and resets) at the end of the next block, then writes
+ * them out as one binary frame. The IRQ never waits on the reader.
+ *
+ * ## Figures
+ *
+ * - **Sections**: cycles from the previous mark (block start or section)
+ *   to each PROF_SECTION: ADC update, render, second layer, effects. lung
+ *   renders its two sample layers into a mix and then runs the effects, so
+ *   the render section is layer 0 and the layer section layer 1; the block
+ *   figures are their combined budget. brainwave's render is all of it
+ * - **Block**: cycles from PROF_BLOCK_BEGIN to PROF_BLOCK_END
+ * - **DMA slack**: budget - block, where the budget is how long the DMA
+ *   takes to reach the block being rendered; negative means an underrun
+ * - **Output slack**: the smallest the output driver measured after a
+ *   render, from where the DMA actually was (so IRQ entry latency counts):
+ *   cycles until it reached the block just rendered, negative when it got
+ *   there first. PROF_OUTPUT_SLACK reports it; zero if the driver does not
+ * - **Histogram**: block time in sixteenths of one block period, the last
+ *   bin collecting everything from 15/16 up
+ * - **Events**: counts of crossfades, reset triggers and (lung) layer
+ *   blocks where a voice read outside its prefetch window, and blocks
+ *   whose effects core 1 had not finished when the next was handed over
+ *   (built with AUDIO_FX_CORE1; the effects section is then only the clamp
+ *   and hand-off). The output drivers add underruns and near misses as
+ *   they count them for the always-on health figures (DACless.h)
+ *
+ * ## Frame format (little-endian)
+ *
+ *     u8  'A', 'P', version (2), payload bytes
+ *     u32 blocks, period_cycles, budget_cycles
+ *     u32 min, mean, max       for each section, then for the block
+ *     i32 slack_min
+ *     i32 output_slack_min
+ *     u16 overruns
+ *     u16 events[PROF_EV_COUNT]
+ *     u16 histogram[PROF_HIST_BINS]
+ *     u8  sum of the payload bytes, mod 256
+ *
+ * The SysTick counter is 24 bits, so a single span must be under 2^24
+ * cycles (~110 ms at 150 MHz); blocks are far shorter. prof_init() leaves
+ * an already running SysTick (an RTOS tick) alone, and spans crossing its
+ * reload then read wrong, so profile without one.
+ *
+ * The lung and brainwave sketches each carry a copy of this file and
+ * audio_profiler.cpp (Arduino builds one folder); keep them identical.
+ * Sections and events a firmware does not use report zeros.
+ */
+
+#pragma once
+#include <stdint.h>
+
+enum ProfSection : uint8_t {
+  PROF_SEC_ADC = 0,      // Control input update
+  PROF_SEC_RENDER,       // Render (lung: sample layer 0 and the block's increments)
+  PROF_SEC_LAYER,        // Second sample layer (lung)
+  PROF_SEC_EFFECTS,      // Effects and output conversion (lung)
+  PROF_SEC_COUNT
+};
+
+enum ProfEvent : uint8_t {
+  PROF_EV_XFADE = 0,     // Loop crossfade started
+  PROF_EV_RESET,         // Reset trigger handled
+  PROF_EV_PREFETCH_MISS, // A voice read PSRAM outside its SRAM window (lung)
+  PROF_EV_FX_LATE,       // Core 1 still on the last block's effects (lung, AUDIO_FX_CORE1)
+  PROF_EV_UNDERRUN,      // The DMA reached a block before its render was done
+  PROF_EV_NEAR_MISS,     // A render finished with under the driver's near-miss slack
+  PROF_EV_COUNT
+};
+
+#define PROF_HIST_BINS 16
+#define PROF_FRAME_VERSION 5       // 2: layer and effects sections, 3: prefetch misses, 4: late effects,
+                                   // 5: output slack, underruns and near misses
+
+#ifdef AUDIO_PROFILE
+
+#include <Arduino.h>
+#include <pico.h>
+#include <hardware/structs/systick.h>
+#include <hardware/sync.h>
+
+struct ProfStat {
+  uint32_t min;
+  uint32_t max;
+  uint64_t sum;
+};
+
+struct ProfAccum {
+  ProfStat sections[PROF_SEC_COUNT];
+  ProfStat block;
+  uint32_t blocks;
+  int32_t  slack_min;
+  int32_t  output_slack_min;
+  uint16_t overruns;
+  uint16_t events[PROF_EV_COUNT];
+  uint16_t histogram[PROF_HIST_BINS];
+};
+
+// IRQ-side state; use the macros, not these
+extern ProfAccum         g_prof;
+extern uint32_t          g_prof_block_start;
+extern uint32_t          g_prof_mark;
+extern uint32_t          g_prof_budget;
+extern uint32_t          g_prof_period;
+extern uint32_t          g_prof_bin_scale;     // 2^32 * PROF_HIST_BINS / period
+extern volatile uint8_t  g_prof_request;       // Reader: hand over the accumulators
+extern volatile uint8_t  g_prof_ready;         // IRQ: the report is filled
+void prof_handover(void);
+
+// Start SysTick (if not running) and clear the accumulators.
+// period_cycles: one audio block at the output rate, in CPU cycles
+// ring_blocks:   output buffers in the DMA ring; the block being rendered
+//                plays again after ring_blocks - 1 others
+void prof_init(uint32_t period_cycles, uint32_t ring_blocks);
+
+// Other core: request a report and, once the IRQ has handed one over,
+// write it as a binary frame. Call every few hundred milliseconds
+void prof_stream(Print& out);
+
+static inline uint32_t prof_now(void) {
+  return systick_hw->cvr;                      // Counts down
+}
+
+static inline uint32_t prof_since(uint32_t then, uint32_t now) {
+  return (then - now) & 0x00FFFFFFu;          // 24-bit down counter
+}
+
+static inline void prof_stat_add(ProfStat& s, uint32_t v) {
+  if (v < s.min) s.min = v;
+  if (v > s.max) s.max = v;
+  s.sum += v;
+}
+
+static inline void prof_block_begin(void) {
+  g_prof_block_start = g_prof_mark = prof_now();
+}
+
+static inline void prof_section(ProfSection sec) {
+  const uint32_t now = prof_now();
+  prof_stat_add(g_prof.sections[sec], prof_since(g_prof_mark, now));
+  g_prof_mark = now;
+}
+
+static inline void prof_event(ProfEvent ev) {
+  if (g_prof.events[ev] != 0xFFFFu) g_prof.events[ev]++;
+}
+
+static inline void prof_output_slack(int32_t cycles) {
+  if (cycles < g_prof.output_slack_min) g_prof.output_slack_min = cycles;
+}
+
+static inline void prof_block_end(void) {
+  const uint32_t cycles = prof_since(g_prof_block_start, prof_now());
+  prof_stat_add(g_prof.block, cycles);
+  g_prof.blocks++;
+
+  const int32_t slack = (int32_t)g_prof_budget - (int32_t)cycles;
+  if (slack < g_prof.slack_min) g_prof.slack_min = slack;
+  if (slack < 0 && g_prof.overruns != 0xFFFFu) g_prof.overruns++;
+
+  uint32_t bin = (uint32_t)(((uint64_t)cycles * g_prof_bin_scale) >> 32);   // no divide
+  if (bin >= PROF_HIST_BINS) bin = PROF_HIST_BINS - 1;
+  if (g_prof.histogram[bin] != 0xFFFFu) g_prof.histogram[bin]++;
+
+  if (g_prof_request && !g_prof_ready) prof_handover();
+}
+
+#define PROF_BLOCK_BEGIN()  prof_block_begin()
+#define PROF_SECTION(sec)   prof_section(sec)
+#define PROF_EVENT(ev)      prof_event(ev)
+#define PROF_BLOCK_END()    prof_block_end()
+#define PROF_OUTPUT_SLACK(c) prof_output_slack(c)
+
+#else
+
+#define PROF_BLOCK_BEGIN()  do {} while (0)
+#define PROF_SECTION(sec)   do {} while (0)
+#define PROF_EVENT(ev)      do {} while (0)
+#define PROF_BLOCK_END()    do {} while (0)
+#define PROF_OUTPUT_SLACK(c) do {} while (0)
+
+#endif // AUDIO_PROFILE
@@ -1,9 +1,13 @@
 #include <Arduino.h>
 #include "DACless.h"
+#include "audio_profiler.h"
 #include <Wire.h>
 #include <Adafruit_GFX.h>
 #include <Adafruit_SSD1306.h>
 #include <elapsedMillis.h>
+#include "pico/multicore.h"
+#include "hardware/interp.h"
+#include "hardware/irq.h"
 
 // ---- Display Config ----
 #define SCREEN_WIDTH 128
@@ -21,32 +25,69 @@ volatile int live_display_index = 0;
 volatile bool live_display_ready = false;
 
 // ---- Morph Filter ----
+// Moving average over 2^Bits readings: the index wraps with a mask and the
+// mean is a shift. The window starts full of the first reading
+template <int Bits>
 class MovingAverageFilter {
 public:
-    MovingAverageFilter(size_t window_size = 8)
-        : _window_size(window_size), _sum(0), _index(0), _count(0)
-    {
-        _buffer = new uint16_t[_window_size]();
-    }
-    ~MovingAverageFilter() { delete[] _buffer; }
     uint16_t process(uint16_t in) {
-        _sum -= _buffer[_index];
+        if (!_primed) {
+            for (uint32_t i = 0; i < kSize; ++i) _buffer[i] = in;
+            _sum = (uint32_t)in << Bits;
+            _primed = true;
+        }
+        _sum += (uint32_t)in - _buffer[_index];
         _buffer[_index] = in;
-        _sum += in;
-        _index = (_index + 1) % _window_size;
-        if (_count < _window_size) ++_count;
-        return _sum / _count;
+        _index = (_index + 1) & (kSize - 1);
+        return _sum >> Bits;
     }
 private:
-    size_t _window_size;
-    uint16_t* _buffer;
-    uint32_t _sum;
-    size_t _index;
-    size_t _count;
+    static constexpr uint32_t kSize = 1u << Bits;
+    uint16_t _buffer[kSize] = {};
+    uint32_t _sum = 0;
+    uint32_t _index = 0;
+    bool _primed = false;
 };
 
 // ---- Wavetable ----
-#include "sampledata.h" // Must provide brainwavetable[256*2048] as int16_t array
+// Generated by ../gen_wavetable.cpp: WT_FRAMES frames, each band-limited at
+// WT_LEVELS octave-spaced sizes, 12-bit samples (optionally packed)
+#include "wavetable_data.h"
+#include "wavetable_core.h"
+
+// Same layout and reads as the desktop oscillator; samples go through the
+// hardware interpolator, once within each frame and once between the two
+// frames, so a sample is bilinear in phase and morph. Only interp0 has a
+// blend mode, so both go through it
+typedef wtcore::MipLayout<WT_TOP_BITS, WT_LEVELS> WtLayout;
+static_assert(WtLayout::kFrameSpan == WT_FRAME_SPAN, "wavetable_data.h layout");
+static_assert(WtLayout::kSafeIncBits == WT_SAFE_INC_BITS, "wavetable_data.h layout");
+
+struct InterpSample : wtcore::Q12Sample {
+    static inline sample_t lerp(sample_t a, sample_t b, frac_t f) { return interpolate(a, b, f); }
+    static inline sample_t blend(sample_t a, sample_t b, frac_t f) { return interpolate(a, b, f); }
+};
+typedef wtcore::WavetableCore<WtLayout, InterpSample> WtCore;
+
+// The two frames being morphed, at the current level, copied out of flash
+// when the morph or level changes; the render reads only these
+static uint16_t wt_frame_a[WtLayout::kTopSize];
+static uint16_t wt_frame_b[WtLayout::kTopSize];
+static int wt_loaded_a = -1, wt_loaded_b = -1, wt_loaded_level = -1;
+
+static void wt_load_frame(int frame, int level, uint16_t* dst) {
+    const uint32_t first = (uint32_t)frame * WtLayout::kFrameSpan + WtLayout::levelOffset(level);
+    const int size = WtLayout::levelSize(level);
+#if WT_PACKED12
+    const uint8_t* p = &wavetable[first / 2 * 3];   // Levels start on even samples
+    for (int n = 0; n < size; n += 2, p += 3) {
+        dst[n]     = p[0] | ((p[1] & 0x0F) << 8);
+        dst[n + 1] = (p[1] >> 4) | (p[2] << 4);
+    }
+#else
+    memcpy(dst, &wavetable[first], size * sizeof(uint16_t));
+#endif
+}
 
 // ---- DACless Config ----
 #define PIN_PWM 6  // Default: GP6
@@ -63,7 +104,7 @@ DAClessAudio audio(dcfg);
 #define PWM_RESOLUTION (1 << 12) // 4096 for 12 bits
 
 // ---- Morph Filter ----
-MovingAverageFilter morphFilter(8);
+MovingAverageFilter<3> morphFilter;
 
 // ---- ADC Index Definitions ----
 #define ADC_FREQ 0
@@ -95,6 +136,30 @@ volatile int lfo_speed_index = 0;
 volatile float debug_last_freq = 0.0f;
 elapsedMillis debug_millis = 0;
 
+// ---- Second Voice (core 1) ----
+// In oscillator mode a second voice, detuned up by 2^-VOICE2_DETUNE_SHIFT of
+// the pitch (~7 cents), is rendered on core 1 in parallel with the first.
+// Core 0's block callback fills voice2_job and posts a word through the SIO
+// FIFO; core 1's FIFO IRQ (which interrupts the display loop) renders into
+// voice2_buf with its own interpolators and sets voice2_done. Core 0 renders
+// its voice meanwhile, then waits at most voice2_wait_us for core 1 before
+// summing; a late block plays voice 1 alone and counts in voice2_late.
+// A job is only posted while core 1 is idle, so a block that gets summed
+// never has its frames reloaded under it; voice2_done starts false so nothing enters the FIFO
+// (which the core 1 launch uses) until core 1 is listening.
+#define VOICE2_DETUNE_SHIFT 8
+struct Voice2Job {
+    uint32_t phase_increment;
+    int level;
+    int32_t morph_from;     // The block's morph ramp (renderVoice)
+    int32_t morph_step;
+};
+static Voice2Job voice2_job;
+static uint16_t voice2_buf[AUDIO_BLOCK_SIZE];
+static volatile bool voice2_done = false;
+static uint32_t voice2_wait_us = 0;
+volatile uint32_t voice2_late = 0;
+
 
 // ---- Forward Declarations ----
 void build_pitch_lut(float base_freq, float sample_rate);
@@ -103,6 +168,7 @@ void pollOctaveSwitch();
 void updateLFOSwitch();
 void displayTask();
 void audioBlockCallback(void* userdata, uint16_t* out_buf);
+void voice2Core1Init();
 
 // ---- Build pitch LUT ----
 void build_pitch_lut(float base_freq, float sample_rate) {
@@ -174,6 +240,51 @@ void updateLFOSwitch() {
     last_state = current_state;
 }
 
+// ---- Voice Render ----
+// One block of the morphed wavetable, on whichever core calls it (each has
+// its own interpolators). The morph between the two frames (Q16) ramps by
+// morph_step a sample from morph_from, so it moves a step of the
+// interpolator's Q8 fraction at a time instead of jumping once a block
+static inline void renderVoice(uint16_t* out, uint32_t& phase, uint32_t phase_increment,
+                               int level, int32_t morph_from, int32_t morph_step) {
+    int32_t morph = morph_from;
+    for (int i = 0; i < AUDIO_BLOCK_SIZE; ++i) {
+        phase += phase_increment;
+        morph += morph_step;
+        out[i] = WtCore::readMorph(wt_frame_a, wt_frame_b, phase, level, (uint16_t)(morph >> 8));
+    }
+}
+
+// ---- Second Voice IRQ (core 1) ----
+static void __not_in_flash_func(voice2FifoIrq)() {
+    static uint32_t phase_accum = 0;
+    while (multicore_fifo_rvalid()) {
+        (void)sio_hw->fifo_rd;
+        __dmb();
+        renderVoice(voice2_buf, phase_accum, voice2_job.phase_increment,
+                    voice2_job.level, voice2_job.morph_from, voice2_job.morph_step);
+        __dmb();
+        voice2_done = true;
+    }
+    multicore_fifo_clear_irq();
+}
+
+// Runs on core 1: its interp0 set up as DAClessAudio sets core 0's,
+// and the FIFO IRQ routed to voice2FifoIrq
+void voice2Core1Init() {
+    interp_config cfg = interp_default_config();
+    interp_config_set_blend(&cfg, true);
+    interp_set_config(interp0, 0, &cfg);
+    cfg = interp_default_config();
+    interp_set_config(interp0, 1, &cfg);
+
+    multicore_fifo_drain();
+    multicore_fifo_clear_irq();
+    irq_set_exclusive_handler(SIO_IRQ_PROC1, voice2FifoIrq);
+    irq_set_enabled(SIO_IRQ_PROC1, true);
+    voice2_done = true;
+}
+
 // ---- Audio Block Callback ----
 void audioBlockCallback(void* userdata, uint16_t* out_buf) {
     static uint32_t phase_accum = 0;
@@ -205,33 +316,67 @@ void audioBlockCallback(void* userdata, uint16_t* out_buf) {
     }
     debug_last_freq = freq;
 
-    for (int i = 0; i < dcfg.blockSize; ++i) {
-        phase_accum += phase_increment;
-
-        // ---- Morphing and wavetable code ----
-        uint16_t raw_morph = adc_buf[ADC_MORPH];
-        uint16_t smoothed_morph = morphFilter.process(raw_morph);
-        float morph_pos = map(smoothed_morph, 0, 4095, 0.0f, 255.0f);
-
-        uint16_t frame_a = floor(morph_pos);
-        uint16_t frame_b = min(frame_a + 1, 255U);
-        float morph_frac = morph_pos - frame_a;
-
-        uint16_t index_0 = phase_accum >> 21;
-        uint16_t mu_scaled = (phase_accum >> 13) & 0xFF;
-        int32_t offset_a = (frame_a * 2048) + index_0;
-        int32_t offset_b = (frame_b * 2048) + index_0;
+    // ---- Morph and band limit, once per block ----
+    // The ADC buffer only changes between blocks; the morph ramps across
+    // the block from where the last one left it (measured from this
+    // block's first frame, clamped to the pair of frames loaded)
+    static uint32_t last_morph_q16 = 0;
+    uint16_t smoothed_morph = morphFilter.process(adc_buf[ADC_MORPH]);
+    uint32_t morph_q16 = (uint32_t)(((uint64_t)smoothed_morph * ((WT_FRAMES - 1) << 16)) / 4095u);
+    int frame_a = morph_q16 >> 16;
+    int frame_b = min(frame_a + 1, WT_FRAMES - 1);
+    int32_t morph_to = morph_q16 & 0xFFFF;
+    int32_t morph_from = constrain((int32_t)(last_morph_q16 - ((uint32_t)frame_a << 16)), 0, 0xFFFF);
+    int32_t morph_step = (morph_to - morph_from) / AUDIO_BLOCK_SIZE;
+    morph_from = morph_to - morph_step * AUDIO_BLOCK_SIZE;
+    last_morph_q16 = morph_q16;
+
+    int level = WtLayout::levelForIncrement(phase_increment);
+    if (level != wt_loaded_level || frame_a != wt_loaded_a) {
+        wt_load_frame(frame_a, level, wt_frame_a);
+    }
+    if (level != wt_loaded_level || frame_b != wt_loaded_b) {
+        wt_load_frame(frame_b, level, wt_frame_b);
+    }
+    wt_loaded_a = frame_a;
+    wt_loaded_b = frame_b;
+    wt_loaded_level = level;
+
+    // ---- Hand voice 2 to core 1 ----
+    bool voice2 = false;
+    if (!sw_lfo_flag && voice2_done) {
+        uint32_t inc2 = phase_increment + (phase_increment >> VOICE2_DETUNE_SHIFT);
+        voice2_job.phase_increment = inc2;
+        voice2_job.level = level;   // The loaded frames; the detune is well inside its headroom
+        voice2_job.morph_from = morph_from;
+        voice2_job.morph_step = morph_step;
+        voice2_done = false;
+        __dmb();
+        multicore_fifo_push_blocking(0);
+        voice2 = true;
+    }
 
-        int16_t sa_0 = brainwavetable[offset_a];
-        int16_t sa_1 = brainwavetable[(offset_a + 1) & 0x7FFFF];
-        int16_t sb_0 = brainwavetable[offset_b];
-        int16_t sb_1 = brainwavetable[(offset_b + 1) & 0x7FFFF];
+    // ---- Wavetable read: two frames in SRAM, interpolated ----
+    renderVoice(out_buf, phase_accum, phase_increment, level, morph_from, morph_step);
 
-        uint16_t sa = interpolate(sa_0, sa_1, mu_scaled);
-        uint16_t sb = interpolate(sb_0, sb_1, mu_scaled);
+    // ---- Join voice 2 ----
+    if (voice2) {
+        const uint32_t start = time_us_32();
+        while (!voice2_done && time_us_32() - start < voice2_wait_us) {
+            tight_loop_contents();
+        }
+        if (voice2_done) {
+            __dmb();
+            for (int i = 0; i < dcfg.blockSize; ++i) {
+                out_buf[i] = (out_buf[i] + voice2_buf[i]) >> 1;
+            }
+        } else {
+            ++voice2_late;
+        }
+    }
 
-        uint16_t out_0 = (sa * (1.0f - morph_frac)) + (sb * morph_frac);
-        out_buf[i] = constrain(out_0, 0, PWM_RESOLUTION - 1);
+    for (int i = 0; i < dcfg.blockSize; ++i) {
+        out_buf[i] = constrain(out_buf[i], 0, PWM_RESOLUTION - 1);
 
         // ---- Display Buffer Logic ----
         if (live_display_index < DISPLAY_BUF_SIZE) {
@@ -246,6 +391,8 @@ void audioBlockCallback(void* userdata, uint16_t* out_buf) {
 
 // ---- Display thread ----
 void displayTask() {
+    voice2Core1Init();
+
     Wire1.setSDA(PIN_WIRE_SDA);
     Wire1.setSCL(PIN_WIRE_SCL);
     Wire1.begin();
@@ -267,6 +414,14 @@ void displayTask() {
             display.display();
             live_display_ready = false;
         }
+#ifdef AUDIO_PROFILE
+        // Render IRQ timing as binary frames (audio_profiler.h), 4 per second
+        static uint32_t last_prof = 0;
+        if (millis() - last_prof >= 250) {
+            last_prof = millis();
+            prof_stream(Serial);
+        }
+#endif
         delay(2);
         tight_loop_contents();
     }
@@ -292,6 +447,9 @@ void setup() {
     build_pitch_lut(base_freq, sample_rate);
     build_lfo_freq_lut();
 
+    // Core 1 gets a quarter of the block period to finish voice 2
+    voice2_wait_us = (uint32_t)(250000.0f * AUDIO_BLOCK_SIZE / sample_rate);
+
     multicore_launch_core1(displayTask);
     Serial.println("Audio-rate morph crossfade system ready");
 }
@@ -300,6 +458,7 @@ void loop() {
     updateLFOSwitch();
     pollOctaveSwitch();
 
+#ifndef AUDIO_PROFILE
     if (debug_millis > 500){
         // Optional: Read and display ADC values
         Serial.print("ADC values: ");
@@ -307,9 +466,19 @@ void loop() {
             Serial.print(audio.getADC(i));
             Serial.print(" ");
         }
+        Serial.print("voice 2 late: ");
+        Serial.print(voice2_late);
+        const DAClessAudio::Health health = audio.getHealth();
+        Serial.print(" underruns: ");
+        Serial.print(health.underruns);
+        Serial.print(" near misses: ");
+        Serial.print(health.nearMisses);
+        Serial.print(" min slack: ");
+        Serial.print(health.slackMin);
         Serial.println();   
         debug_millis = 0;
     }
+#endif  // the profiler owns the serial port
 
 
 }
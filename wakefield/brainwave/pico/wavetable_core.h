@@ -0,0 +1,99 @@
+// Band-limited wavetable oscillator core shared by the desktop
+// BrainwaveOscillator (src/brainwave_tables.*, float samples) and the Pico
+// sketch (12-bit samples, brainwave-osc.ino). It lives in the sketch folder
+// because Arduino only builds what is there; the desktop includes it by
+// relative path. Header only, no allocation, no library calls.
+//
+// Layout of one frame (MipLayout): level k holds 2^(TopBits - k) samples
+// and harmonics up to a quarter of that, so every level is 4x oversampled
+// for linear interpolation. Levels are stored back to back, level 0 first,
+// with no guard sample (reads wrap). brainwave/gen_wavetable.cpp writes the
+// same layout for the Pico; the desktop builds it at startup.
+//
+// Sample arithmetic comes from a traits type (FloatSample, Q12Sample, or a
+// build's own with the same members):
+//
+//   sample_t                      stored sample
+//   frac_t                        interpolation fraction
+//   frac(phase, bits)             fraction below the top bits of the phase
+//   lerp(a, b, frac)              a + (b - a) * frac
+//   blend(a, b, frac)             the same, for the morph between frames
+#pragma once
+#include <stdint.h>
+
+namespace wtcore {
+
+template <int TopBits, int Levels>
+struct MipLayout {
+    static constexpr int kTopBits = TopBits;
+    static constexpr int kLevels = Levels;
+    static constexpr int kTopSize = 1 << TopBits;
+    // Samples per frame, all levels
+    static constexpr int kFrameSpan = 2 * kTopSize - ((2 * kTopSize) >> Levels);
+    // Level 0 is alias-free while the phase increment (2^32 = one cycle per
+    // sample) is below 2^kSafeIncBits; each level doubles that
+    static constexpr int kSafeIncBits = 33 - TopBits;
+
+    static_assert(Levels >= 1 && Levels <= TopBits - 1, "smallest level needs 4 samples");
+
+    static constexpr int levelBits(int level) { return TopBits - level; }
+    static constexpr int levelSize(int level) { return kTopSize >> level; }
+    static constexpr int maxHarmonic(int level) { return levelSize(level) / 4; }
+    // Level k of a frame starts this many samples into it
+    static constexpr int levelOffset(int level) { return 2 * kTopSize - ((2 * kTopSize) >> level); }
+
+    // Smallest level whose harmonics all stay under Nyquist at this increment
+    static inline int levelForIncrement(uint32_t increment) {
+        if (increment < (1u << kSafeIncBits)) {
+            return 0;
+        }
+        int level = (31 - __builtin_clz(increment)) - kSafeIncBits + 1;
+        return level < Levels ? level : Levels - 1;
+    }
+};
+
+struct FloatSample {
+    typedef float sample_t;
+    typedef float frac_t;
+    static inline frac_t frac(uint32_t phase, int bits) {
+        return static_cast<float>((phase << bits) >> 16) * (1.0f / 65536.0f);
+    }
+    static inline sample_t lerp(sample_t a, sample_t b, frac_t f) { return a + (b - a) * f; }
+    static inline sample_t blend(sample_t a, sample_t b, frac_t f) { return lerp(a, b, f); }
+};
+
+// 12-bit offset binary (0..4095), Q8 fractions; the Pico's hardware
+// interpolator takes the same operands
+struct Q12Sample {
+    typedef uint16_t sample_t;
+    typedef uint16_t frac_t;
+    static inline frac_t frac(uint32_t phase, int bits) {
+        return static_cast<frac_t>((phase << bits) >> 24);
+    }
+    static inline sample_t lerp(sample_t a, sample_t b, frac_t f) {
+        return static_cast<sample_t>(a + ((((int32_t)b - (int32_t)a) * f) >> 8));
+    }
+    static inline sample_t blend(sample_t a, sample_t b, frac_t f) { return lerp(a, b, f); }
+};
+
+template <class Layout, class Traits>
+struct WavetableCore {
+    typedef typename Traits::sample_t sample_t;
+    typedef typename Traits::frac_t frac_t;
+
+    // Linear read of one level of one frame (levelSize(level) samples)
+    static inline sample_t read(const sample_t* table, uint32_t phase, int level) {
+        const int bits = Layout::levelBits(level);
+        const uint32_t index = phase >> (32 - bits);
+        const uint32_t next = (index + 1) & ((1u << bits) - 1);
+        return Traits::lerp(table[index], table[next], Traits::frac(phase, bits));
+    }
+
+    // Two neighbouring frames at the same level, blended by morph
+    static inline sample_t readMorph(const sample_t* a, const sample_t* b, uint32_t phase, int level,
+                                     frac_t morph) {
+        return Traits::blend(read(a, phase, level), read(b, phase, level), morph);
+    }
+};
+
+} // namespace wtcore
@@ -0,0 +1,8148 @@
+// Generated by brainwave/gen_wavetable.cpp from brainwave_wavetable.wav; do not edit.
+//   --frame-len 2048 --top-bits 8 --levels 7 --pack12
+#pragma once
+#include <stdint.h>
+
+#define WT_FRAMES      256
+#define WT_TOP_BITS    8      // Level 0: 256 samples, harmonics 1..64
+#define WT_LEVELS      7      // Level k: WT_TOP_BITS - k bits, half the harmonics of k - 1
+#define WT_FRAME_SPAN  508    // Samples per frame, all levels
+#define WT_PACKED12    1      // 1: two samples per three bytes
+
+// Level k of a frame starts this many samples into it
+#define WT_LEVEL_OFFSET(k) (2 * (1 << WT_TOP_BITS) - ((2 * (1 << WT_TOP_BITS)) >> (k)))
+
+// Level 0 is alias-free while the phase increment (2^32 = one cycle per
+// sample) is below 2^WT_SAFE_INC_BITS; each level doubles that
+#define WT_SAFE_INC_BITS 25
+
+const uint8_t wavetable[195072] PROGMEM = {
+0,104,166,55,140,212,206,29,225,51,14,228,67,126,228,75,174,228,73,174,228,75,174,228,
+73,174,228,75,174,228,73,174,228,75,174,228,73,174,228,75,174,228,73,174,228,75,174,228,
+74,174,228,75,174,228,74,174,228,75,174,228,74,174,228,75,174,228,74,174,228,75,174,228,
+74,174,228,75,174,228,74,174,228,75,174,228,74,174,228,75,174,228,74,174,228,75,174,228,
+74,174,228,75,174,228,74,174,228,75,174,228,74,174,228,75,174,228,74,174,228,75,174,228,
+74,174,228,75,174,228,74,174,228,75,174,228,74,174,228,75,174,228,74,174,228,75,174,228,
+74,174,228,75,174,228,73,174,228,75,174,228,73,174,228,75,174,228,73,174,228,75,174,228,
+73,174,228,75,174,228,73,174,228,75,126,228,67,14,228,51,30,225,206,141,212,55,108,166,
+0,168,89,201,131,43,50,242,30,205,1,28,189,145,27,181,97,27,183,97,27,181,97,27,
+183,97,27,181,97,27,183,97,27,181,97,27,183,97,27,181,97,27,183,97,27,181,97,27,
+182,97,27,181,97,27,182,97,27,181,97,27,182,97,27,181,97,27,182,97,27,181,97,27,
+182,97,27,181,97,27,182,97,27,181,97,27,182,97,27,181,97,27,182,97,27,181,97,27,
+182,97,27,181,97,27,182,97,27,181,97,27,182,97,27,181,97,27,182,97,27,181,97,27,
+182,97,27,181,97,27,182,97,27,181,97,27,182,97,27,181,97,27,182,97,27,181,97,27,
+182,97,27,181,97,27,183,97,27,181,97,27,183,97,27,181,97,27,183,97,27,181,97,27,
+183,97,27,181,97,27,183,97,27,181,145,27,189,1,28,205,241,30,50,130,43,201,163,89,
+0,152,190,1,222,228,30,206,227,103,30,229,51,110,228,93,222,228,58,142,228,89,206,228,
+61,158,228,86,190,228,63,174,228,85,190,228,64,174,228,84,174,228,65,174,228,83,174,228,
+65,174,228,83,174,228,65,174,228,84,174,228,64,190,228,85,174,228,63,190,228,86,158,228,
+61,206,228,89,142,228,58,222,228,93,110,228,51,30,229,103,206,227,30,222,228,1,158,190,
+0,120,65,255,49,27,226,65,28,153,241,26,205,161,27,163,49,27,198,129,27,167,65,27,
+195,113,27,170,81,27,193,97,27,171,81,27,192,97,27,172,97,27,191,97,27,173,97,27,
+191,97,27,173,97,27,191,97,27,172,97,27,192,81,27,171,97,27,193,81,27,170,113,27,
+195,65,27,167,129,27,198,49,27,163,161,27,205,241,26,153,65,28,226,49,27,255,113,65,
+0,40,207,249,126,231,221,157,227,152,62,229,12,94,228,127,222,228,26,158,228,119,190,228,
+30,190,228,119,158,228,26,222,228,127,94,228,12,62,229,152,158,227,221,125,231,249,46,207,
+0,232,48,7,145,24,35,114,28,104,209,26,244,177,27,129,49,27,230,113,27,137,81,27,
+226,81,27,137,113,27,230,49,27,129,177,27,244,209,26,104,113,28,35,146,24,7,225,48,
+0,152,213,83,31,231,172,221,227,198,222,228,216,221,228,198,222,227,172,29,231,83,159,213,
+0,120,42,173,240,24,84,50,28,58,49,27,40,50,27,58,49,28,84,242,24,173,112,42,
+0,232,215,132,31,230,93,29,230,132,239,215,0,40,40,124,240,25,163,242,25,124,32,40,
+0,120,218,255,127,218,0,152,37,1,144,37,0,248,255,0,24,0,0,104,165,33,92,211,
+194,173,224,47,238,227,66,126,228,74,174,228,73,174,228,75,174,228,73,174,228,75,174,228,
+73,174,228,75,174,228,73,174,228,75,174,228,74,174,228,75,174,228,74,174,228,75,174,228,
+74,174,228,75,174,228,74,174,228,75,174,228,74,174,228,75,174,228,74,174,228,75,174,228,
+74,174,228,75,174,228,74,174,228,75,174,228,74,174,228,75,174,228,74,174,228,75,174,228,
+74,174,228,75,174,228,74,174,228,75,174,228,74,174,228,75,174,228,74,174,228,75,174,228,
+74,174,228,75,174,228,74,174,228,75,174,228,74,174,228,75,174,228,74,174,228,75,174,228,
+74,174,228,75,174,228,73,174,228,75,174,228,73,174,228,75,174,228,73,174,228,75,174,228,
+73,174,228,74,126,228,66,238,227,47,174,224,194,93,211,33,108,165,0,168,90,223,179,44,
+62,98,31,209,33,28,190,145,27,182,97,27,183,97,27,181,97,27,183,97,27,181,97,27,
+183,97,27,181,97,27,183,97,27,181,97,27,182,97,27,181,97,27,182,97,27,181,97,27,
+182,97,27,181,97,27,182,97,27,181,97,27,182,97,27,181,97,27,182,97,27,181,97,27,
+182,97,27,181,97,27,182,97,27,181,97,27,182,97,27,181,97,27,182,97,27,181,97,27,
+182,97,27,181,97,27,182,97,27,181,97,27,182,97,27,181,97,27,182,97,27,181,97,27,
+182,97,27,181,97,27,182,97,27,181,97,27,182,97,27,181,97,27,182,97,27,181,97,27,
+182,97,27,181,97,27,183,97,27,181,97,27,183,97,27,181,97,27,183,97,27,181,97,27,
+183,97,27,182,145,27,190,33,28,209,97,31,62,178,44,223,163,90,0,152,189,241,141,228,
+32,222,227,101,30,229,53,110,228,92,222,228,59,142,228,88,206,228,62,158,228,85,190,228,
+64,174,228,84,190,228,65,174,228,83,174,228,65,174,228,83,174,228,65,174,228,83,174,228,
+65,174,228,83,174,228,65,190,228,84,174,228,64,190,228,85,158,228,62,206,228,88,142,228,
+59,222,228,92,110,228,53,30,229,101,222,227,32,142,228,241,157,189,0,120,66,15,130,27,
+224,49,28,155,241,26,203,161,27,164,49,27,197,129,27,168,65,27,194,113,27,171,81,27,
+192,97,27,172,81,27,191,97,27,173,97,27,191,97,27,173,97,27,191,97,27,173,97,27,
+191,97,27,173,97,27,191,81,27,172,97,27,192,81,27,171,113,27,194,65,27,168,129,27,
+197,49,27,164,161,27,203,241,26,155,49,28,224,129,27,15,114,66,0,168,206,243,126,231,
+224,157,227,150,62,229,14,94,228,126,222,228,27,158,228,118,190,228,31,190,228,118,158,228,
+27,222,228,126,94,228,14,62,229,150,158,227,224,125,231,243,174,206,0,104,49,13,145,24,
+32,114,28,106,209,26,242,177,27,130,49,27,229,113,27,138,81,27,225,81,27,138,113,27,
+229,49,27,130,177,27,242,209,26,106,113,28,32,146,24,13,97,49,0,120,213,81,31,231,
+173,221,227,197,222,228,216,221,228,197,222,227,173,29,231,81,127,213,0,152,42,175,240,24,
+83,50,28,59,49,27,40,50,27,59,49,28,83,242,24,175,144,42,0,232,215,132,31,230,
+93,29,230,132,239,215,0,40,40,124,240,25,163,242,25,124,32,40,0,120,218,255,127,218,
+0,152,37,1,144,37,0,248,255,0,24,0,0,104,164,11,60,210,182,45,224,42,190,227,
+65,110,228,74,174,228,73,174,228,75,174,228,73,174,228,75,174,228,73,174,228,75,174,228,
+74,174,228,75,174,228,74,174,228,75,174,228,74,174,228,75,174,228,74,174,228,75,174,228,
+74,174,228,75,174,228,74,174,228,75,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,75,174,228,74,174,228,75,174,228,
+74,174,228,75,174,228,74,174,228,75,174,228,74,174,228,75,174,228,74,174,228,75,174,228,
+74,174,228,75,174,228,73,174,228,75,174,228,73,174,228,75,174,228,73,174,228,74,110,228,
+65,190,227,42,46,224,182,61,210,11,108,164,0,168,91,245,211,45,74,226,31,214,81,28,
+191,161,27,182,97,27,183,97,27,181,97,27,183,97,27,181,97,27,183,97,27,181,97,27,
+182,97,27,181,97,27,182,97,27,181,97,27,182,97,27,181,97,27,182,97,27,181,97,27,
+182,97,27,181,97,27,182,97,27,181,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,181,97,27,182,97,27,181,97,27,
+182,97,27,181,97,27,182,97,27,181,97,27,182,97,27,181,97,27,182,97,27,181,97,27,
+182,97,27,181,97,27,183,97,27,181,97,27,183,97,27,181,97,27,183,97,27,182,161,27,
+191,81,28,214,225,31,74,210,45,245,163,91,0,152,188,224,45,228,34,222,227,99,14,229,
+54,110,228,91,222,228,60,142,228,87,190,228,63,158,228,85,190,228,64,174,228,83,190,228,
+65,174,228,83,174,228,66,174,228,82,174,228,66,174,228,82,174,228,66,174,228,83,174,228,
+65,190,228,83,174,228,64,190,228,85,158,228,63,190,228,87,142,228,60,222,228,91,110,228,
+54,14,229,99,222,227,34,46,228,224,157,188,0,120,67,32,226,27,222,49,28,157,1,27,
+202,161,27,165,49,27,196,129,27,169,81,27,193,113,27,171,81,27,192,97,27,173,81,27,
+191,97,27,173,97,27,190,97,27,174,97,27,190,97,27,174,97,27,190,97,27,173,97,27,
+191,81,27,173,97,27,192,81,27,171,113,27,193,81,27,169,129,27,196,49,27,165,161,27,
+202,1,27,157,49,28,222,225,27,32,114,67,0,56,206,236,126,231,227,157,227,148,62,229,
+15,94,228,125,222,228,28,158,228,117,190,228,32,190,228,117,158,228,28,222,228,125,94,228,
+15,62,229,148,158,227,227,125,231,236,62,206,0,216,49,20,145,24,29,114,28,108,209,26,
+241,177,27,131,49,27,228,113,27,139,81,27,224,81,27,139,113,27,228,49,27,131,177,27,
+241,209,26,108,113,28,29,146,24,20,209,49,0,72,213,79,31,231,174,221,227,196,222,228,
+217,221,228,196,222,227,174,29,231,79,79,213,0,200,42,177,240,24,82,50,28,60,49,27,
+39,50,27,60,49,28,82,242,24,177,192,42,0,216,215,131,31,230,94,29,230,131,223,215,
+0,56,40,125,240,25,162,242,25,125,48,40,0,120,218,255,127,218,0,152,37,1,144,37,
+0,248,255,0,24,0,0,120,163,245,251,208,169,173,223,37,142,227,64,94,228,73,158,228,
+73,174,228,75,174,228,73,174,228,75,174,228,74,174,228,75,174,228,74,174,228,75,174,228,
+74,174,228,75,174,228,74,174,228,75,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,75,174,228,74,174,228,75,174,228,74,174,228,75,174,228,74,174,228,75,174,228,
+74,174,228,75,174,228,73,174,228,75,174,228,73,158,228,73,94,228,64,142,227,37,174,223,
+169,253,208,245,123,163,0,152,92,11,20,47,87,98,32,219,129,28,192,177,27,183,113,27,
+183,97,27,181,97,27,183,97,27,181,97,27,182,97,27,181,97,27,182,97,27,181,97,27,
+182,97,27,181,97,27,182,97,27,181,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,181,97,27,182,97,27,181,97,27,182,97,27,181,97,27,182,97,27,181,97,27,
+182,97,27,181,97,27,183,97,27,181,97,27,183,113,27,183,177,27,192,129,28,219,97,32,
+87,18,47,11,148,92,0,136,187,207,205,227,35,222,227,97,14,229,56,110,228,90,222,228,
+61,142,228,86,190,228,64,158,228,84,190,228,65,174,228,83,190,228,66,174,228,82,174,228,
+66,174,228,82,174,228,67,174,228,82,174,228,66,174,228,82,174,228,66,190,228,83,174,228,
+65,190,228,84,158,228,64,190,228,86,142,228,61,222,228,90,110,228,56,14,229,97,222,227,
+35,206,227,207,141,187,0,136,68,49,66,28,221,49,28,159,1,27,200,161,27,166,49,27,
+195,129,27,170,81,27,192,113,27,172,81,27,191,97,27,173,81,27,190,97,27,174,97,27,
+190,97,27,174,97,27,189,97,27,174,97,27,190,97,27,174,97,27,190,81,27,173,97,27,
+191,81,27,172,113,27,192,81,27,170,129,27,195,49,27,166,161,27,200,1,27,159,49,28,
+221,65,28,49,130,68,0,168,205,229,110,231,229,157,227,147,62,229,16,94,228,124,222,228,
+29,158,228,116,190,228,33,190,228,116,158,228,29,222,228,124,94,228,16,62,229,147,158,227,
+229,109,231,229,174,205,0,104,50,27,161,24,27,114,28,109,209,26,240,177,27,132,49,27,
+227,113,27,140,81,27,223,81,27,140,113,27,227,49,27,132,177,27,240,209,26,109,113,28,
+27,162,24,27,97,50,0,40,213,77,47,231,176,221,227,195,222,228,218,221,228,195,222,227,
+176,45,231,77,47,213,0,232,42,179,224,24,80,50,28,61,49,27,38,50,27,61,49,28,
+80,226,24,179,224,42,0,200,215,130,31,230,94,29,230,130,207,215,0,72,40,126,240,25,
+162,242,25,126,64,40,0,120,218,254,127,218,0,152,37,2,144,37,0,232,255,0,40,0,
+0,136,162,223,187,207,155,45,223,31,94,227,62,78,228,72,158,228,73,174,228,75,174,228,
+74,174,228,75,174,228,74,174,228,75,174,228,74,174,228,75,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,75,174,228,74,174,228,75,174,228,74,174,228,75,174,228,
+74,174,228,75,174,228,73,158,228,72,78,228,62,94,227,31,46,223,155,189,207,223,139,162,
+0,136,93,33,84,48,101,226,32,225,177,28,194,193,27,184,113,27,183,97,27,181,97,27,
+182,97,27,181,97,27,182,97,27,181,97,27,182,97,27,181,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,181,97,27,182,97,27,181,97,27,182,97,27,181,97,27,
+182,97,27,181,97,27,183,113,27,184,193,27,194,177,28,225,225,32,101,82,48,33,132,93,
+0,136,186,189,93,227,35,222,227,95,14,229,57,126,228,88,222,228,62,142,228,85,190,228,
+64,158,228,83,190,228,66,174,228,82,190,228,67,174,228,81,174,228,67,174,228,81,174,228,
+67,174,228,81,174,228,67,174,228,81,174,228,67,190,228,82,174,228,66,190,228,83,158,228,
+64,190,228,85,142,228,62,222,228,88,126,228,57,14,229,95,222,227,35,94,227,189,141,186,
+0,136,69,67,178,28,221,49,28,161,1,27,199,145,27,168,49,27,194,129,27,171,81,27,
+192,113,27,173,81,27,190,97,27,174,81,27,189,97,27,175,97,27,189,97,27,175,97,27,
+189,97,27,175,97,27,189,97,27,175,97,27,189,81,27,174,97,27,190,81,27,173,113,27,
+192,81,27,171,129,27,194,49,27,168,145,27,199,1,27,161,49,28,221,177,28,67,130,69,
+0,40,205,221,110,231,232,157,227,145,62,229,18,94,228,122,222,228,31,158,228,115,190,228,
+34,190,228,115,158,228,31,222,228,122,94,228,18,62,229,145,158,227,232,109,231,221,46,205,
+0,232,50,35,161,24,24,114,28,111,209,26,238,177,27,134,49,27,225,113,27,141,81,27,
+222,81,27,141,113,27,225,49,27,134,177,27,238,209,26,111,113,28,24,162,24,35,225,50,
+0,248,212,75,47,231,177,221,227,194,222,228,219,221,228,194,222,227,177,45,231,75,255,212,
+0,24,43,181,224,24,79,50,28,62,49,27,37,50,27,62,49,28,79,226,24,181,16,43,
+0,184,215,130,31,230,95,29,230,130,191,215,0,88,40,126,240,25,161,242,25,126,80,40,
+0,120,218,254,127,218,0,152,37,2,144,37,0,232,255,0,40,0,0,136,161,201,123,206,
+141,141,222,25,30,227,61,62,228,72,158,228,73,174,228,74,174,228,74,174,228,75,174,228,
+74,174,228,75,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,75,174,228,74,174,228,75,174,228,74,174,228,74,174,228,
+73,158,228,72,62,228,61,30,227,25,142,222,141,125,206,201,139,161,0,136,94,55,148,49,
+115,130,33,231,241,28,195,209,27,184,113,27,183,97,27,182,97,27,182,97,27,181,97,27,
+182,97,27,181,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,181,97,27,182,97,27,181,97,27,182,97,27,182,97,27,
+183,113,27,184,209,27,195,241,28,231,129,33,115,146,49,55,132,94,0,120,185,171,237,226,
+36,222,227,93,254,228,58,126,228,87,206,228,63,158,228,84,190,228,65,158,228,83,190,228,
+66,174,228,82,190,228,67,174,228,81,174,228,68,174,228,81,174,228,68,174,228,81,174,228,
+68,174,228,81,174,228,67,190,228,82,174,228,66,190,228,83,158,228,65,190,228,84,158,228,
+63,206,228,87,126,228,58,254,228,93,222,227,36,238,226,171,125,185,0,152,70,85,34,29,
+220,49,28,163,17,27,198,145,27,169,65,27,193,113,27,172,81,27,191,113,27,173,81,27,
+190,97,27,174,81,27,189,97,27,175,97,27,188,97,27,175,97,27,188,97,27,175,97,27,
+188,97,27,175,97,27,189,81,27,174,97,27,190,81,27,173,113,27,191,81,27,172,113,27,
+193,65,27,169,145,27,198,17,27,163,49,28,220,33,29,85,146,70,0,136,204,213,94,231,
+235,157,227,143,62,229,19,94,228,121,222,228,32,158,228,114,190,228,35,190,228,114,158,228,
+32,222,228,121,94,228,19,62,229,143,158,227,235,93,231,213,142,204,0,136,51,43,177,24,
+21,114,28,113,209,26,237,177,27,135,49,27,224,113,27,142,81,27,221,81,27,142,113,27,
+224,49,27,135,177,27,237,209,26,113,113,28,21,178,24,43,129,51,0,200,212,72,47,231,
+178,221,227,193,222,228,219,221,228,193,222,227,178,45,231,72,207,212,0,72,43,184,224,24,
+78,50,28,63,33,27,37,50,27,63,49,28,78,226,24,184,64,43,0,184,215,129,31,230,
+95,29,230,129,191,215,0,88,40,127,240,25,161,242,25,127,80,40,0,120,218,254,127,218,
+0,152,37,2,144,37,0,232,255,0,40,0,0,168,160,178,43,205,125,237,221,19,222,226,
+58,46,228,71,142,228,73,158,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,158,228,73,142,228,71,46,228,
+58,222,226,19,238,221,125,45,205,178,171,160,0,104,95,78,228,50,131,34,34,237,49,29,
+198,225,27,185,129,27,183,113,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,113,27,183,129,27,185,225,27,
+198,49,29,237,33,34,131,226,50,78,100,95,0,88,184,152,109,226,36,222,227,91,254,228,
+59,126,228,86,206,228,64,158,228,83,190,228,66,158,228,82,190,228,67,174,228,81,190,228,
+68,174,228,80,174,228,68,174,228,80,174,228,68,174,228,80,174,228,68,174,228,80,174,228,
+68,190,228,81,174,228,67,190,228,82,158,228,66,190,228,83,158,228,64,206,228,86,126,228,
+59,254,228,91,222,227,36,110,226,152,93,184,0,184,71,104,162,29,220,49,28,165,17,27,
+197,145,27,170,65,27,192,113,27,173,81,27,190,113,27,174,81,27,189,97,27,175,81,27,
+188,97,27,176,97,27,188,97,27,176,97,27,188,97,27,176,97,27,188,97,27,176,97,27,
+188,81,27,175,97,27,189,81,27,174,113,27,190,81,27,173,113,27,192,65,27,170,145,27,
+197,17,27,165,49,28,220,161,29,104,178,71,0,248,203,204,94,231,238,157,227,141,62,229,
+21,94,228,120,222,228,33,158,228,113,190,228,36,190,228,113,158,228,33,222,228,120,94,228,
+21,62,229,141,158,227,238,93,231,204,254,203,0,24,52,52,177,24,18,114,28,115,209,26,
+235,177,27,136,49,27,223,113,27,143,81,27,220,81,27,143,113,27,223,49,27,136,177,27,
+235,209,26,115,113,28,18,178,24,52,17,52,0,152,212,70,47,231,179,221,227,192,238,228,
+220,237,228,192,222,227,179,45,231,70,159,212,0,120,43,186,224,24,77,50,28,64,33,27,
+36,34,27,64,49,28,77,226,24,186,112,43,0,168,215,128,31,230,96,29,230,128,175,215,
+0,104,40,128,240,25,160,242,25,128,96,40,0,104,218,254,111,218,0,168,37,2,160,37,
+0,232,255,0,40,0,0,184,159,156,219,203,109,45,221,11,158,226,56,14,228,70,142,228,
+72,158,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,158,228,72,142,228,70,14,228,56,158,226,11,46,221,
+109,221,203,156,187,159,0,88,96,100,52,52,147,226,34,245,113,29,200,1,28,186,129,27,
+184,113,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,113,27,184,129,27,186,1,28,200,113,29,245,225,34,
+147,50,52,100,84,96,0,72,183,132,221,225,35,206,227,89,254,228,61,126,228,85,206,228,
+65,158,228,83,190,228,66,158,228,81,190,228,68,174,228,80,174,228,68,174,228,80,174,228,
+69,174,228,80,174,228,69,174,228,80,174,228,69,174,228,80,174,228,68,174,228,80,174,228,
+68,190,228,81,158,228,66,190,228,83,158,228,65,206,228,85,126,228,61,254,228,89,206,227,
+35,222,225,132,77,183,0,200,72,124,50,30,221,65,28,167,17,27,195,145,27,171,65,27,
+191,113,27,173,81,27,190,113,27,175,81,27,188,97,27,176,97,27,188,97,27,176,97,27,
+187,97,27,176,97,27,187,97,27,176,97,27,187,97,27,176,97,27,188,97,27,176,97,27,
+188,81,27,175,113,27,190,81,27,173,113,27,191,65,27,171,145,27,195,17,27,167,65,28,
+221,49,30,124,194,72,0,88,203,195,78,231,241,157,227,139,62,229,22,94,228,118,222,228,
+34,158,228,112,190,228,37,190,228,112,158,228,34,222,228,118,94,228,22,62,229,139,158,227,
+241,77,231,195,94,203,0,184,52,61,193,24,15,114,28,117,209,26,234,177,27,138,49,27,
+222,113,27,144,81,27,219,81,27,144,113,27,222,49,27,138,177,27,234,209,26,117,113,28,
+15,194,24,61,177,52,0,88,212,67,47,231,181,221,227,191,238,228,221,237,228,191,222,227,
+181,45,231,67,95,212,0,184,43,189,224,24,75,50,28,65,33,27,35,34,27,65,49,28,
+75,226,24,189,176,43,0,152,215,127,47,230,96,45,230,127,159,215,0,120,40,129,224,25,
+160,226,25,129,112,40,0,104,218,253,111,218,0,168,37,3,160,37,0,216,255,0,56,0,
+0,200,158,134,123,202,92,109,220,3,78,226,53,254,227,68,126,228,72,158,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,158,228,72,126,228,68,254,227,53,78,226,3,110,220,92,125,202,134,203,158,
+0,72,97,122,148,53,164,162,35,253,193,29,203,17,28,188,145,27,184,113,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,113,27,184,145,27,188,17,28,203,193,29,253,161,35,164,146,53,122,68,97,
+0,40,182,113,61,225,34,206,227,87,238,228,62,126,228,84,206,228,65,158,228,82,190,228,
+67,158,228,81,190,228,68,174,228,80,174,228,69,174,228,79,174,228,69,174,228,79,174,228,
+69,174,228,79,174,228,69,174,228,79,174,228,69,174,228,80,174,228,68,190,228,81,158,228,
+67,190,228,82,158,228,65,206,228,84,126,228,62,238,228,87,206,227,34,62,225,113,45,182,
+0,232,73,143,210,30,222,65,28,169,33,27,194,145,27,172,65,27,191,113,27,174,81,27,
+189,113,27,175,81,27,188,97,27,176,97,27,187,97,27,177,97,27,187,97,27,177,97,27,
+187,97,27,177,97,27,187,97,27,177,97,27,187,97,27,176,97,27,188,81,27,175,113,27,
+189,81,27,174,113,27,191,65,27,172,145,27,194,33,27,169,65,28,222,209,30,143,226,73,
+0,168,202,186,62,231,244,157,227,137,62,229,24,94,228,117,222,228,35,158,228,111,190,228,
+38,190,228,111,158,228,35,222,228,117,94,228,24,62,229,137,158,227,244,61,231,186,174,202,
+0,104,53,70,209,24,12,114,28,119,209,26,232,177,27,139,49,27,221,113,27,145,81,27,
+218,81,27,145,113,27,221,49,27,139,177,27,232,209,26,119,113,28,12,210,24,70,97,53,
+0,40,212,64,63,231,182,221,227,190,238,228,222,237,228,190,222,227,182,61,231,64,47,212,
+0,232,43,192,208,24,74,50,28,66,33,27,34,34,27,66,49,28,74,210,24,192,224,43,
+0,136,215,127,47,230,97,45,230,127,143,215,0,136,40,129,224,25,159,226,25,129,128,40,
+0,104,218,253,111,218,0,168,37,3,160,37,0,216,255,0,56,0,0,232,157,112,27,201,
+74,157,219,250,237,225,49,222,227,67,110,228,72,158,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,158,228,
+72,110,228,67,222,227,49,238,225,250,157,219,74,29,201,112,235,157,0,40,98,144,244,54,
+182,114,36,6,34,30,207,49,28,189,161,27,184,113,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,113,27,
+184,161,27,189,49,28,207,33,30,6,114,36,182,242,54,144,36,98,0,8,181,92,157,224,
+33,190,227,85,238,228,63,126,228,83,206,228,66,158,228,81,190,228,68,158,228,80,190,228,
+69,174,228,79,174,228,69,174,228,79,174,228,69,174,228,79,174,228,70,174,228,79,174,228,
+69,174,228,79,174,228,69,174,228,79,174,228,69,190,228,80,158,228,68,190,228,81,158,228,
+66,206,228,83,126,228,63,238,228,85,190,227,33,158,224,92,13,181,0,8,75,164,114,31,
+223,81,28,171,33,27,193,145,27,173,65,27,190,113,27,175,81,27,188,113,27,176,81,27,
+187,97,27,177,97,27,187,97,27,177,97,27,187,97,27,177,97,27,186,97,27,177,97,27,
+187,97,27,177,97,27,187,97,27,177,97,27,187,81,27,176,113,27,188,81,27,175,113,27,
+190,65,27,173,145,27,193,33,27,171,81,28,223,113,31,164,2,75,0,248,201,176,46,231,
+247,157,227,134,62,229,26,94,228,116,222,228,37,158,228,110,190,228,39,190,228,110,158,228,
+37,222,228,116,94,228,26,62,229,134,158,227,247,45,231,176,254,201,0,24,54,80,225,24,
+9,114,28,122,209,26,230,177,27,140,49,27,219,113,27,146,81,27,217,81,27,146,113,27,
+219,49,27,140,177,27,230,209,26,122,113,28,9,226,24,80,17,54,0,232,211,61,63,231,
+184,221,227,189,238,228,223,237,228,189,222,227,184,61,231,61,239,211,0,40,44,195,208,24,
+72,50,28,67,33,27,33,34,27,67,49,28,72,210,24,195,32,44,0,120,215,126,47,230,
+97,45,230,126,127,215,0,152,40,130,224,25,159,226,25,130,144,40,0,104,218,253,111,218,
+0,168,37,3,160,37,0,216,255,0,56,0,0,8,157,90,171,199,55,205,218,241,141,225,
+45,174,227,65,94,228,71,142,228,73,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,73,142,228,71,94,228,65,174,227,
+45,142,225,241,205,218,55,173,199,90,11,157,0,8,99,166,100,56,201,66,37,15,130,30,
+211,97,28,191,177,27,185,129,27,183,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,183,129,27,185,177,27,191,97,28,
+211,129,30,15,66,37,201,98,56,166,4,99,0,216,179,71,237,223,31,174,227,83,222,228,
+64,142,228,82,206,228,67,158,228,81,190,228,68,174,228,79,190,228,69,174,228,79,174,228,
+70,174,228,78,174,228,70,174,228,78,174,228,70,174,228,78,174,228,70,174,228,78,174,228,
+70,174,228,79,174,228,69,190,228,79,174,228,68,190,228,81,158,228,67,206,228,82,142,228,
+64,222,228,83,174,227,31,238,223,71,221,179,0,56,76,185,34,32,225,97,28,173,49,27,
+192,129,27,174,65,27,189,113,27,175,81,27,188,97,27,177,81,27,187,97,27,177,97,27,
+186,97,27,178,97,27,186,97,27,178,97,27,186,97,27,178,97,27,186,97,27,178,97,27,
+186,97,27,177,97,27,187,81,27,177,97,27,188,81,27,175,113,27,189,65,27,174,129,27,
+192,49,27,173,97,28,225,33,32,185,50,76,0,72,201,166,30,231,250,173,227,132,46,229,
+28,110,228,114,222,228,38,158,228,108,190,228,41,190,228,108,158,228,38,222,228,114,110,228,
+28,46,229,132,174,227,250,29,231,166,78,201,0,200,54,90,241,24,6,98,28,124,225,26,
+228,161,27,142,49,27,218,113,27,148,81,27,215,81,27,148,113,27,218,49,27,142,161,27,
+228,225,26,124,97,28,6,242,24,90,193,54,0,168,211,57,63,231,185,221,227,188,238,228,
+225,237,228,188,222,227,185,61,231,57,175,211,0,104,44,199,208,24,71,50,28,68,33,27,
+31,34,27,68,49,28,71,210,24,199,96,44,0,104,215,125,47,230,98,45,230,125,111,215,
+0,168,40,131,224,25,158,226,25,131,160,40,0,104,218,252,111,218,0,168,37,4,160,37,
+0,200,255,0,72,0,0,40,156,68,59,198,36,221,217,230,29,225,41,126,227,64,78,228,
+70,142,228,73,158,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,158,228,73,142,228,70,78,228,64,126,227,41,30,225,230,221,217,
+36,61,198,68,43,156,0,232,99,188,212,57,220,50,38,26,242,30,215,145,28,192,193,27,
+186,129,27,183,113,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,113,27,183,129,27,186,193,27,192,145,28,215,241,30,26,50,38,
+220,210,57,188,228,99,0,184,178,50,61,223,28,158,227,81,222,228,65,142,228,82,206,228,
+68,158,228,80,190,228,69,174,228,79,190,228,70,174,228,78,174,228,70,174,228,78,174,228,
+70,174,228,78,174,228,70,174,228,78,174,228,70,174,228,78,174,228,70,174,228,78,174,228,
+70,190,228,79,174,228,69,190,228,80,158,228,68,206,228,82,142,228,65,222,228,81,158,227,
+28,62,223,50,189,178,0,88,77,206,210,32,228,113,28,175,49,27,191,129,27,174,65,27,
+188,113,27,176,81,27,187,97,27,177,81,27,186,97,27,178,97,27,186,97,27,178,97,27,
+186,97,27,178,97,27,186,97,27,178,97,27,186,97,27,178,97,27,186,97,27,178,97,27,
+186,81,27,177,97,27,187,81,27,176,113,27,188,65,27,174,129,27,191,49,27,175,113,28,
+228,209,32,206,82,77,0,136,200,154,14,231,254,173,227,130,46,229,29,110,228,113,222,228,
+39,158,228,107,190,228,42,190,228,107,158,228,39,222,228,113,110,228,29,46,229,130,174,227,
+254,13,231,154,142,200,0,136,55,102,1,25,2,98,28,126,225,26,227,161,27,143,49,27,
+217,113,27,149,81,27,214,81,27,149,113,27,217,49,27,143,161,27,227,225,26,126,97,28,
+2,2,25,102,129,55,0,104,211,53,63,231,187,221,227,187,238,228,226,237,228,187,222,227,
+187,61,231,53,111,211,0,168,44,203,208,24,69,50,28,69,33,27,30,34,27,69,49,28,
+69,210,24,203,160,44,0,88,215,124,47,230,99,45,230,124,95,215,0,184,40,132,224,25,
+157,226,25,132,176,40,0,88,218,252,95,218,0,184,37,4,176,37,0,200,255,0,72,0,
+0,88,155,46,203,196,16,221,216,219,157,224,36,78,227,61,62,228,70,126,228,73,158,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,158,228,73,126,228,70,62,228,61,78,227,36,158,224,219,221,216,16,205,196,46,91,155,
+0,184,100,210,68,59,240,50,39,37,114,31,220,193,28,195,209,27,186,145,27,183,113,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,113,27,183,145,27,186,209,27,195,193,28,220,113,31,37,50,39,240,66,59,210,180,100,
+0,136,177,28,109,222,24,126,227,79,206,228,66,142,228,81,206,228,68,158,228,79,190,228,
+69,174,228,78,190,228,70,174,228,78,174,228,71,174,228,78,174,228,71,174,228,78,174,228,
+71,174,228,78,174,228,71,174,228,78,174,228,71,174,228,78,174,228,70,190,228,78,174,228,
+69,190,228,79,158,228,68,206,228,81,142,228,66,206,228,79,126,227,24,110,222,28,141,177,
+0,136,78,228,162,33,232,145,28,177,65,27,190,129,27,175,65,27,188,113,27,177,81,27,
+187,97,27,178,81,27,186,97,27,178,97,27,185,97,27,178,97,27,185,97,27,178,97,27,
+185,97,27,178,97,27,185,97,27,178,97,27,185,97,27,178,97,27,186,81,27,178,97,27,
+187,81,27,177,113,27,188,65,27,175,129,27,190,65,27,177,145,28,232,161,33,228,130,78,
+0,184,199,143,238,230,1,174,227,128,46,229,31,110,228,111,222,228,41,158,228,106,190,228,
+43,190,228,106,158,228,41,222,228,111,110,228,31,46,229,128,174,227,1,238,230,143,190,199,
+0,88,56,113,33,25,255,97,28,128,225,26,225,161,27,145,49,27,215,113,27,150,81,27,
+213,81,27,150,113,27,215,49,27,145,161,27,225,225,26,128,97,28,255,33,25,113,81,56,
+0,24,211,50,63,231,189,221,227,185,238,228,227,237,228,185,222,227,189,61,231,50,31,211,
+0,248,44,206,208,24,67,50,28,71,33,27,29,34,27,71,49,28,67,210,24,206,240,44,
+0,56,215,122,47,230,100,45,230,122,63,215,0,216,40,134,224,25,156,226,25,134,208,40,
+0,88,218,252,95,218,0,184,37,4,176,37,0,200,255,0,72,0,0,136,154,25,91,195,
+251,220,215,207,29,224,30,14,227,59,30,228,69,126,228,72,158,228,73,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,73,158,228,72,126,228,
+69,30,228,59,14,227,30,30,224,207,221,215,251,92,195,25,139,154,0,136,101,231,180,60,
+5,51,40,49,242,31,226,1,29,197,241,27,187,145,27,184,113,27,183,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,183,113,27,184,145,27,
+187,241,27,197,1,29,226,241,31,49,50,40,5,179,60,231,132,101,0,104,176,5,157,221,
+20,94,227,77,190,228,66,142,228,80,190,228,69,158,228,79,190,228,70,174,228,78,190,228,
+71,174,228,78,174,228,71,174,228,77,174,228,71,174,228,77,174,228,71,174,228,77,174,228,
+71,174,228,77,174,228,71,174,228,78,174,228,71,190,228,78,174,228,70,190,228,79,158,228,
+69,190,228,80,142,228,66,190,228,77,94,227,20,158,221,5,109,176,0,168,79,251,114,34,
+236,177,28,179,81,27,190,129,27,176,81,27,187,113,27,177,81,27,186,97,27,178,81,27,
+185,97,27,178,97,27,185,97,27,179,97,27,185,97,27,179,97,27,185,97,27,179,97,27,
+185,97,27,179,97,27,185,97,27,178,97,27,185,81,27,178,97,27,186,81,27,177,113,27,
+187,81,27,176,129,27,190,81,27,179,177,28,236,113,34,251,162,79,0,232,198,131,206,230,
+4,174,227,125,46,229,33,110,228,110,222,228,42,158,228,104,190,228,44,190,228,104,158,228,
+42,222,228,110,110,228,33,46,229,125,174,227,4,206,230,131,238,198,0,40,57,125,65,25,
+252,97,28,131,225,26,223,161,27,146,49,27,214,113,27,152,81,27,212,81,27,152,113,27,
+214,49,27,146,161,27,223,225,26,131,97,28,252,65,25,125,33,57,0,200,210,45,79,231,
+191,221,227,184,238,228,228,237,228,184,222,227,191,77,231,45,207,210,0,72,45,211,192,24,
+65,50,28,72,33,27,28,34,27,72,49,28,65,194,24,211,64,45,0,40,215,121,47,230,
+100,45,230,121,47,215,0,232,40,135,224,25,156,226,25,135,224,40,0,88,218,251,95,218,
+0,184,37,5,176,37,0,184,255,0,88,0,0,184,153,3,219,193,230,204,214,194,125,223,
+24,206,226,56,254,227,67,110,228,72,158,228,73,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,73,158,228,72,110,228,67,254,227,56,206,226,
+24,126,223,194,205,214,230,220,193,3,187,153,0,88,102,253,52,62,26,67,41,62,146,32,
+232,65,29,200,17,28,189,161,27,184,113,27,183,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,183,113,27,184,161,27,189,17,28,200,65,29,
+232,145,32,62,66,41,26,51,62,253,84,102,0,56,175,238,188,220,15,62,227,75,174,228,
+67,142,228,79,190,228,70,158,228,78,190,228,70,174,228,78,190,228,71,174,228,77,174,228,
+71,174,228,77,174,228,71,174,228,77,174,228,71,174,228,77,174,228,71,174,228,77,174,228,
+71,174,228,77,174,228,71,190,228,78,174,228,70,190,228,78,158,228,70,190,228,79,142,228,
+67,174,228,75,62,227,15,190,220,238,60,175,0,216,80,18,83,35,241,209,28,181,97,27,
+189,129,27,177,81,27,186,113,27,178,81,27,186,97,27,178,81,27,185,97,27,179,97,27,
+185,97,27,179,97,27,185,97,27,179,97,27,185,97,27,179,97,27,185,97,27,179,97,27,
+185,97,27,179,97,27,185,81,27,178,97,27,186,81,27,178,113,27,186,81,27,177,129,27,
+189,97,27,181,209,28,241,81,35,18,211,80,0,8,198,118,174,230,8,190,227,123,46,229,
+35,110,228,108,222,228,44,158,228,103,190,228,46,190,228,103,158,228,44,222,228,108,110,228,
+35,46,229,123,190,227,8,174,230,118,14,198,0,8,58,138,97,25,248,81,28,133,225,26,
+221,161,27,148,49,27,212,113,27,153,81,27,210,81,27,153,113,27,212,49,27,148,161,27,
+221,225,26,133,81,28,248,97,25,138,1,58,0,120,210,41,79,231,193,221,227,182,238,228,
+230,237,228,182,222,227,193,77,231,41,127,210,0,152,45,215,192,24,63,50,28,74,33,27,
+26,34,27,74,49,28,63,194,24,215,144,45,0,24,215,120,47,230,101,45,230,120,31,215,
+0,248,40,136,224,25,155,226,25,136,240,40,0,72,218,251,79,218,0,200,37,5,192,37,
+0,184,255,0,88,0,0,232,152,238,90,192,208,172,213,180,221,222,17,126,226,53,222,227,
+66,94,228,71,142,228,73,158,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,158,228,73,142,228,71,94,228,66,222,227,53,126,226,17,222,222,180,173,213,
+208,92,192,238,234,152,0,40,103,18,181,63,48,99,42,76,50,33,239,145,29,203,49,28,
+190,177,27,185,129,27,183,113,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,113,27,183,129,27,185,177,27,190,49,28,203,145,29,239,49,33,76,98,42,
+48,179,63,18,37,103,0,8,174,215,204,219,9,14,227,72,158,228,67,142,228,79,190,228,
+70,158,228,78,190,228,71,174,228,77,174,228,71,174,228,77,174,228,72,174,228,77,174,228,
+72,174,228,77,174,228,72,174,228,77,174,228,72,174,228,77,174,228,72,174,228,77,174,228,
+71,174,228,77,174,228,71,190,228,78,158,228,70,190,228,79,142,228,67,158,228,72,14,227,
+9,206,219,215,12,174,0,8,82,41,67,36,247,1,29,184,113,27,189,129,27,177,81,27,
+186,113,27,178,81,27,185,97,27,179,97,27,185,97,27,179,97,27,184,97,27,179,97,27,
+184,97,27,179,97,27,184,97,27,179,97,27,184,97,27,179,97,27,184,97,27,179,97,27,
+185,97,27,179,97,27,185,81,27,178,113,27,186,81,27,177,129,27,189,113,27,184,1,29,
+247,65,36,41,3,82,0,40,197,104,126,230,11,190,227,120,46,229,37,110,228,106,222,228,
+45,158,228,102,190,228,47,190,228,102,158,228,45,222,228,106,110,228,37,46,229,120,190,227,
+11,126,230,104,46,197,0,232,58,152,145,25,245,81,28,136,225,26,219,161,27,150,49,27,
+211,113,27,154,81,27,209,81,27,154,113,27,211,49,27,150,161,27,219,225,26,136,81,28,
+245,145,25,152,225,58,0,24,210,36,79,231,195,221,227,180,238,228,231,237,228,180,222,227,
+195,77,231,36,31,210,0,248,45,220,192,24,61,50,28,76,33,27,25,34,27,76,49,28,
+61,194,24,220,240,45,0,248,214,119,47,230,102,45,230,119,255,214,0,24,41,137,224,25,
+154,226,25,137,16,41,0,72,218,250,79,218,0,200,37,6,192,37,0,168,255,0,104,0,
+0,40,152,217,218,190,185,124,212,165,45,222,9,46,226,49,174,227,64,78,228,70,142,228,
+73,158,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,158,228,
+73,142,228,70,78,228,64,174,227,49,46,226,9,46,222,165,125,212,185,220,190,217,42,152,
+0,232,103,39,53,65,71,147,43,91,226,33,247,225,29,207,97,28,192,193,27,186,129,27,
+183,113,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,113,27,
+183,129,27,186,193,27,192,97,28,207,225,29,247,225,33,91,146,43,71,51,65,39,229,103,
+0,216,172,191,204,218,3,222,226,70,142,228,68,142,228,78,190,228,71,158,228,77,190,228,
+71,174,228,77,174,228,72,174,228,76,174,228,72,174,228,76,174,228,72,174,228,76,174,228,
+72,174,228,76,174,228,72,174,228,76,174,228,72,174,228,76,174,228,72,174,228,77,174,228,
+71,190,228,77,158,228,71,190,228,78,142,228,68,142,228,70,222,226,3,206,218,191,220,172,
+0,56,83,65,67,37,253,49,29,186,129,27,188,129,27,178,81,27,185,113,27,179,81,27,
+185,97,27,179,97,27,184,97,27,180,97,27,184,97,27,180,97,27,184,97,27,180,97,27,
+184,97,27,180,97,27,184,97,27,180,97,27,184,97,27,180,97,27,184,97,27,179,97,27,
+185,81,27,179,113,27,185,81,27,178,129,27,188,129,27,186,49,29,253,65,37,65,51,83,
+0,56,196,90,78,230,14,190,227,118,46,229,39,110,228,105,222,228,46,158,228,100,190,228,
+48,190,228,100,158,228,46,222,228,105,110,228,39,46,229,118,190,227,14,78,230,90,62,196,
+0,216,59,166,193,25,242,81,28,138,225,26,217,161,27,151,49,27,210,113,27,156,81,27,
+208,81,27,156,113,27,210,49,27,151,161,27,217,225,26,138,81,28,242,193,25,166,209,59,
+0,184,209,31,79,231,197,221,227,179,238,228,233,237,228,179,222,227,197,77,231,31,191,209,
+0,88,46,225,192,24,59,50,28,77,33,27,23,34,27,77,49,28,59,194,24,225,80,46,
+0,216,214,117,47,230,103,45,230,117,223,214,0,56,41,139,224,25,153,226,25,139,48,41,
+0,72,218,250,79,218,0,200,37,6,192,37,0,168,255,0,104,0,0,88,151,197,90,189,
+162,60,211,150,125,221,1,190,225,44,126,227,62,46,228,69,126,228,72,158,228,73,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,73,158,228,72,126,228,69,46,228,
+62,126,227,44,190,225,1,126,221,150,61,211,162,92,189,197,90,151,0,184,104,59,181,66,
+94,211,44,106,146,34,255,81,30,212,145,28,194,225,27,187,145,27,184,113,27,183,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,183,113,27,184,145,27,187,225,27,
+194,145,28,212,81,30,255,145,34,106,210,44,94,179,66,59,181,104,0,168,171,167,204,217,
+251,157,226,67,126,228,68,142,228,77,190,228,71,158,228,77,190,228,72,174,228,76,174,228,
+72,174,228,76,174,228,72,174,228,76,174,228,72,174,228,76,174,228,72,174,228,76,174,228,
+72,174,228,76,174,228,72,174,228,76,174,228,72,174,228,76,174,228,72,190,228,77,158,228,
+71,190,228,77,142,228,68,126,228,67,158,226,251,205,217,167,172,171,0,104,84,89,67,38,
+5,114,29,189,145,27,188,129,27,179,81,27,185,113,27,179,81,27,184,97,27,180,97,27,
+184,97,27,180,97,27,184,97,27,180,97,27,184,97,27,180,97,27,184,97,27,180,97,27,
+184,97,27,180,97,27,184,97,27,180,97,27,184,97,27,180,97,27,184,81,27,179,113,27,
+185,81,27,179,129,27,188,145,27,189,113,29,5,66,38,89,99,84,0,72,195,76,30,230,
+17,190,227,115,30,229,41,110,228,103,222,228,48,158,228,99,190,228,50,190,228,99,158,228,
+48,222,228,103,110,228,41,30,229,115,190,227,17,30,230,76,78,195,0,200,60,180,241,25,
+239,81,28,141,241,26,215,161,27,153,49,27,208,113,27,157,81,27,206,81,27,157,113,27,
+208,49,27,153,161,27,215,241,26,141,81,28,239,241,25,180,193,60,0,88,209,26,79,231,
+200,221,227,177,238,228,235,237,228,177,222,227,200,77,231,26,95,209,0,184,46,230,192,24,
+56,50,28,79,33,27,21,34,27,79,49,28,56,194,24,230,176,46,0,200,214,115,47,230,
+104,45,230,115,207,214,0,72,41,141,224,25,152,226,25,141,64,41,0,56,218,249,63,218,
+0,216,37,7,208,37,0,152,255,0,120,0,0,168,150,176,218,187,139,252,209,133,173,220,
+247,93,225,40,78,227,60,30,228,68,110,228,72,142,228,73,158,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,158,228,73,142,228,72,110,228,68,30,228,60,78,227,40,94,225,
+247,173,220,133,253,209,139,220,187,176,170,150,0,104,105,80,53,68,117,19,46,123,98,35,
+9,178,30,216,193,28,196,241,27,188,161,27,184,129,27,183,113,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,113,27,183,129,27,184,161,27,188,241,27,196,193,28,216,177,30,
+9,98,35,123,18,46,117,51,68,80,101,105,0,136,170,143,188,216,242,93,226,64,110,228,
+68,142,228,77,190,228,71,174,228,76,190,228,72,174,228,76,174,228,72,174,228,76,174,228,
+72,174,228,76,174,228,73,174,228,76,174,228,73,174,228,76,174,228,73,174,228,76,174,228,
+72,174,228,76,174,228,72,174,228,76,174,228,72,190,228,76,174,228,71,190,228,77,142,228,
+68,110,228,64,94,226,242,189,216,143,140,170,0,136,85,113,83,39,14,178,29,192,161,27,
+188,129,27,179,81,27,185,97,27,180,81,27,184,97,27,180,97,27,184,97,27,180,97,27,
+184,97,27,180,97,27,183,97,27,180,97,27,183,97,27,180,97,27,183,97,27,180,97,27,
+184,97,27,180,97,27,184,97,27,180,97,27,184,81,27,180,97,27,185,81,27,179,129,27,
+188,161,27,192,177,29,14,82,39,113,131,85,0,72,194,60,222,229,20,206,227,113,30,229,
+43,110,228,101,206,228,49,158,228,98,190,228,51,190,228,98,158,228,49,206,228,101,110,228,
+43,30,229,113,206,227,20,222,229,60,78,194,0,200,61,196,49,26,236,65,28,143,241,26,
+213,161,27,155,65,27,207,113,27,158,81,27,205,81,27,158,113,27,207,65,27,155,161,27,
+213,241,26,143,65,28,236,49,26,196,193,61,0,232,208,20,79,231,202,205,227,175,238,228,
+236,237,228,175,206,227,202,77,231,20,239,208,0,40,47,236,192,24,54,66,28,81,33,27,
+20,34,27,81,65,28,54,194,24,236,32,47,0,168,214,114,47,230,106,45,230,114,175,214,
+0,104,41,142,224,25,150,226,25,142,96,41,0,56,218,248,63,218,0,216,37,8,208,37,
+0,136,255,0,136,0,0,232,149,156,106,186,115,172,208,116,205,219,237,221,224,34,14,227,
+57,254,227,67,94,228,71,142,228,73,158,228,73,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+73,158,228,73,142,228,71,94,228,67,254,227,57,14,227,34,222,224,237,205,219,116,173,208,
+115,108,186,156,234,149,0,40,106,100,165,69,141,99,47,140,66,36,19,50,31,222,1,29,
+199,17,28,189,177,27,185,129,27,183,113,27,183,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+183,113,27,183,129,27,185,177,27,189,17,28,199,1,29,222,49,31,19,66,36,140,98,47,
+141,163,69,100,37,106,0,88,169,119,140,215,233,253,225,60,78,228,68,142,228,76,190,228,
+72,174,228,76,190,228,72,174,228,76,174,228,73,174,228,76,174,228,73,174,228,76,174,228,
+73,174,228,75,174,228,73,174,228,75,174,228,73,174,228,76,174,228,73,174,228,76,174,228,
+73,174,228,76,174,228,72,190,228,76,174,228,72,190,228,76,142,228,68,78,228,60,254,225,
+233,141,215,119,92,169,0,184,86,137,131,40,23,18,30,196,193,27,188,129,27,180,81,27,
+184,97,27,180,81,27,184,97,27,180,97,27,183,97,27,180,97,27,183,97,27,180,97,27,
+183,97,27,181,97,27,183,97,27,181,97,27,183,97,27,180,97,27,183,97,27,180,97,27,
+183,97,27,180,97,27,184,81,27,180,97,27,184,81,27,180,129,27,188,193,27,196,17,30,
+23,130,40,137,179,86,0,72,193,44,158,229,23,206,227,111,30,229,44,110,228,100,206,228,
+51,158,228,96,190,228,52,190,228,96,158,228,51,206,228,100,110,228,44,30,229,111,206,227,
+23,158,229,44,78,193,0,200,62,212,113,26,233,65,28,145,241,26,212,161,27,156,65,27,
+205,113,27,160,81,27,204,81,27,160,113,27,205,65,27,156,161,27,212,241,26,145,65,28,
+233,113,26,212,193,62,0,120,208,14,79,231,205,205,227,173,238,228,238,237,228,173,206,227,
+205,77,231,14,127,208,0,152,47,242,192,24,51,66,28,83,33,27,18,34,27,83,65,28,
+51,194,24,242,144,47,0,136,214,112,63,230,107,61,230,112,143,214,0,136,41,144,208,25,
+149,210,25,144,128,41,0,40,218,248,47,218,0,232,37,8,224,37,0,136,255,0,136,0,
+0,56,149,136,234,184,91,76,207,98,237,218,226,93,224,28,190,226,54,206,227,65,78,228,
+70,126,228,72,158,228,73,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,73,158,228,72,126,228,
+70,78,228,65,206,227,54,190,226,28,94,224,226,237,218,98,77,207,91,236,184,136,58,149,
+0,216,106,120,37,71,165,195,48,158,34,37,30,178,31,228,81,29,202,65,28,191,193,27,
+186,145,27,184,113,27,183,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,183,113,27,184,145,27,
+186,193,27,191,65,28,202,81,29,228,177,31,30,34,37,158,194,48,165,35,71,120,213,106,
+0,40,168,94,92,214,222,173,225,57,46,228,68,126,228,75,174,228,72,174,228,76,174,228,
+73,174,228,76,174,228,73,174,228,75,174,228,73,174,228,75,174,228,73,174,228,75,174,228,
+73,174,228,75,174,228,73,174,228,75,174,228,73,174,228,75,174,228,73,174,228,76,174,228,
+73,174,228,76,174,228,72,174,228,75,126,228,68,46,228,57,174,225,222,93,214,94,44,168,
+0,232,87,162,179,41,34,98,30,199,225,27,188,145,27,181,97,27,184,97,27,180,97,27,
+183,97,27,180,97,27,183,97,27,181,97,27,183,97,27,181,97,27,183,97,27,181,97,27,
+183,97,27,181,97,27,183,97,27,181,97,27,183,97,27,181,97,27,183,97,27,180,97,27,
+183,97,27,180,97,27,184,97,27,181,145,27,188,225,27,199,97,30,34,178,41,162,227,87,
+0,56,192,27,78,229,25,206,227,108,30,229,46,110,228,98,206,228,52,158,228,95,190,228,
+54,190,228,95,158,228,52,206,228,98,110,228,46,30,229,108,206,227,25,78,229,27,62,192,
+0,216,63,229,193,26,231,65,28,148,241,26,210,161,27,158,65,27,204,113,27,161,81,27,
+202,81,27,161,113,27,204,65,27,158,161,27,210,241,26,148,65,28,231,193,26,229,209,63,
+0,8,208,7,79,231,208,205,227,171,238,228,240,237,228,171,206,227,208,77,231,7,15,208,
+0,8,48,249,192,24,48,66,28,85,33,27,16,34,27,85,65,28,48,194,24,249,0,48,
+0,88,214,110,63,230,108,61,230,110,95,214,0,184,41,146,208,25,148,210,25,146,176,41,
+0,40,218,247,47,218,0,232,37,9,224,37,0,120,255,0,152,0,0,136,148,117,106,183,
+67,236,205,78,237,217,213,189,223,21,110,226,50,174,227,63,62,228,69,126,228,72,142,228,
+73,158,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,158,228,73,142,228,72,126,228,69,62,228,63,174,227,
+50,110,226,21,190,223,213,237,217,78,237,205,67,108,183,117,138,148,0,136,107,139,165,72,
+189,35,50,178,34,38,43,82,32,235,161,29,206,97,28,193,209,27,187,145,27,184,129,27,
+183,113,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,113,27,183,129,27,184,145,27,187,209,27,193,97,28,
+206,161,29,235,81,32,43,34,38,178,34,50,189,163,72,139,133,107,0,8,167,69,44,213,
+211,61,225,52,14,228,67,126,228,75,174,228,72,174,228,76,174,228,73,174,228,75,174,228,
+73,174,228,75,174,228,73,174,228,75,174,228,73,174,228,75,174,228,73,174,228,75,174,228,
+73,174,228,75,174,228,73,174,228,75,174,228,73,174,228,75,174,228,73,174,228,76,174,228,
+72,174,228,75,126,228,67,14,228,52,62,225,211,45,213,69,12,167,0,8,89,187,227,42,
+45,210,30,204,1,28,189,145,27,181,97,27,184,97,27,180,97,27,183,97,27,181,97,27,
+183,97,27,181,97,27,183,97,27,181,97,27,183,97,27,181,97,27,183,97,27,181,97,27,
+183,97,27,181,97,27,183,97,27,181,97,27,183,97,27,181,97,27,183,97,27,180,97,27,
+184,97,27,181,145,27,189,1,28,204,209,30,45,226,42,187,3,89,0,40,191,10,254,228,
+28,222,227,106,14,229,48,126,228,97,206,228,54,158,228,94,174,228,55,174,228,94,158,228,
+54,206,228,97,126,228,48,14,229,106,222,227,28,254,228,10,46,191,0,232,64,246,17,27,
+228,49,28,150,1,27,208,145,27,159,65,27,202,113,27,162,97,27,201,97,27,162,113,27,
+202,65,27,159,145,27,208,1,27,150,49,28,228,17,27,246,225,64,0,136,207,0,79,231,
+211,205,227,169,238,228,242,237,228,169,206,227,211,77,231,0,143,207,0,136,48,0,193,24,
+45,66,28,87,33,27,14,34,27,87,65,28,45,194,24,0,129,48,0,56,214,108,63,230,
+110,61,230,108,63,214,0,216,41,148,208,25,146,210,25,148,208,41,0,24,218,246,31,218,
+0,248,37,10,240,37,0,104,255,0,168,0,0,216,147,98,234,181,42,124,204,58,237,216,
+200,29,223,13,14,226,46,126,227,61,30,228,68,110,228,71,142,228,73,158,228,73,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,73,158,228,73,142,228,71,110,228,68,30,228,61,126,227,46,14,226,13,30,223,
+200,237,216,58,125,204,42,236,181,98,218,147,0,56,108,158,37,74,214,147,51,198,34,39,
+56,242,32,243,1,30,210,145,28,195,241,27,188,161,27,185,129,27,183,113,27,183,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,183,113,27,183,129,27,185,161,27,188,241,27,195,145,28,210,1,30,243,241,32,
+56,34,39,198,146,51,214,35,74,158,53,108,0,232,165,44,220,211,198,205,224,48,238,227,
+66,110,228,74,174,228,72,174,228,75,174,228,73,174,228,75,174,228,73,174,228,75,174,228,
+73,174,228,75,174,228,73,174,228,75,174,228,73,174,228,75,174,228,73,174,228,75,174,228,
+73,174,228,75,174,228,73,174,228,75,174,228,73,174,228,75,174,228,72,174,228,74,110,228,
+66,238,227,48,206,224,198,221,211,44,236,165,0,40,90,212,51,44,58,66,31,208,33,28,
+190,161,27,182,97,27,184,97,27,181,97,27,183,97,27,181,97,27,183,97,27,181,97,27,
+183,97,27,181,97,27,183,97,27,181,97,27,183,97,27,181,97,27,183,97,27,181,97,27,
+183,97,27,181,97,27,183,97,27,181,97,27,183,97,27,181,97,27,184,97,27,182,161,27,
+190,33,28,208,65,31,58,50,44,212,35,90,0,8,190,248,157,228,30,222,227,103,14,229,
+50,126,228,95,206,228,55,158,228,92,174,228,56,174,228,92,158,228,55,206,228,95,126,228,
+50,14,229,103,222,227,30,158,228,248,13,190,0,8,66,8,114,27,226,49,28,153,1,27,
+206,145,27,161,65,27,201,113,27,164,97,27,200,97,27,164,113,27,201,65,27,161,145,27,
+206,1,27,153,49,28,226,113,27,8,2,66,0,248,206,249,78,231,214,205,227,166,238,228,
+244,237,228,166,206,227,214,77,231,249,254,206,0,24,49,7,193,24,42,66,28,90,33,27,
+12,34,27,90,65,28,42,194,24,7,17,49,0,8,214,105,63,230,111,61,230,105,15,214,
+0,8,42,151,208,25,145,210,25,151,0,42,0,8,218,245,15,218,0,8,38,11,0,38,
+0,88,255,0,184,0,0,40,147,79,122,180,17,252,202,38,205,215,186,109,222,5,174,225,
+41,62,227,58,254,227,66,94,228,70,126,228,72,158,228,73,158,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,158,228,73,158,228,
+72,126,228,70,94,228,66,254,227,58,62,227,41,174,225,5,110,222,186,205,215,38,253,202,
+17,124,180,79,42,147,0,232,108,177,149,75,239,19,53,218,66,40,70,162,33,251,97,30,
+215,209,28,198,17,28,190,177,27,186,145,27,184,113,27,183,113,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,113,27,183,113,27,
+184,145,27,186,177,27,190,17,28,198,209,28,215,97,30,251,161,33,70,66,40,218,18,53,
+239,147,75,177,229,108,0,200,164,18,140,210,185,61,224,42,190,227,65,110,228,73,174,228,
+72,174,228,75,174,228,73,174,228,75,174,228,73,174,228,75,174,228,73,174,228,75,174,228,
+73,174,228,75,174,228,73,174,228,75,174,228,73,174,228,75,174,228,73,174,228,75,174,228,
+73,174,228,75,174,228,73,174,228,75,174,228,72,174,228,73,110,228,65,190,227,42,62,224,
+185,141,210,18,204,164,0,72,91,238,131,45,71,210,31,214,81,28,191,161,27,183,97,27,
+184,97,27,181,97,27,183,97,27,181,97,27,183,97,27,181,97,27,183,97,27,181,97,27,
+183,97,27,181,97,27,183,97,27,181,97,27,183,97,27,181,97,27,183,97,27,181,97,27,
+183,97,27,181,97,27,183,97,27,181,97,27,184,97,27,183,161,27,191,81,28,214,209,31,
+71,130,45,238,67,91,0,232,188,229,61,228,31,222,227,101,14,229,52,126,228,94,206,228,
+56,158,228,91,174,228,58,174,228,91,158,228,56,206,228,94,126,228,52,14,229,101,222,227,
+31,62,228,229,237,188,0,40,67,27,210,27,225,49,28,155,1,27,204,145,27,162,65,27,
+200,113,27,165,97,27,198,97,27,165,113,27,200,65,27,162,145,27,204,1,27,155,49,28,
+225,209,27,27,34,67,0,104,206,241,78,231,217,205,227,164,238,228,246,237,228,164,206,227,
+217,77,231,241,110,206,0,168,49,15,193,24,39,66,28,92,33,27,10,34,27,92,65,28,
+39,194,24,15,161,49,0,232,213,103,63,230,113,61,230,103,239,213,0,40,42,153,208,25,
+143,210,25,153,32,42,0,8,218,244,15,218,0,8,38,12,0,38,0,72,255,0,200,0,
+0,136,146,61,250,178,248,123,201,16,173,214,171,173,221,251,61,225,35,254,226,55,206,227,
+64,62,228,69,126,228,72,142,228,73,158,228,73,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,73,158,228,73,142,228,72,126,228,69,62,228,
+64,206,227,55,254,226,35,62,225,251,173,221,171,173,214,16,125,201,248,251,178,61,138,146,
+0,136,109,195,21,77,8,148,54,240,98,41,85,98,34,5,210,30,221,17,29,201,65,28,
+192,209,27,187,145,27,184,129,27,183,113,27,183,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,183,113,27,183,129,27,184,145,27,187,209,27,
+192,65,28,201,17,29,221,209,30,5,98,34,85,98,41,240,146,54,8,20,77,195,133,109,
+0,168,163,249,43,209,170,173,223,36,142,227,63,94,228,73,158,228,73,174,228,75,174,228,
+73,174,228,75,174,228,73,174,228,75,174,228,74,174,228,75,174,228,74,174,228,75,174,228,
+74,174,228,75,174,228,74,174,228,75,174,228,74,174,228,75,174,228,73,174,228,75,174,228,
+73,174,228,75,174,228,73,158,228,73,94,228,63,142,227,36,174,223,170,45,209,249,171,163,
+0,104,92,7,228,46,86,98,32,220,129,28,193,177,27,183,113,27,183,97,27,181,97,27,
+183,97,27,181,97,27,183,97,27,181,97,27,182,97,27,181,97,27,182,97,27,181,97,27,
+182,97,27,181,97,27,182,97,27,181,97,27,182,97,27,181,97,27,183,97,27,181,97,27,
+183,97,27,181,97,27,183,113,27,183,177,27,193,129,28,220,97,32,86,226,46,7,100,92,
+0,184,187,209,189,227,33,222,227,98,14,229,53,126,228,92,206,228,58,158,228,90,174,228,
+59,174,228,90,158,228,58,206,228,92,126,228,53,14,229,98,222,227,33,190,227,209,189,187,
+0,88,68,47,82,28,223,49,28,158,1,27,203,145,27,164,65,27,198,113,27,166,97,27,
+197,97,27,166,113,27,198,65,27,164,145,27,203,1,27,158,49,28,223,81,28,47,82,68,
+0,216,205,233,62,231,220,205,227,162,238,228,249,237,228,162,206,227,220,61,231,233,222,205,
+0,56,50,23,209,24,36,66,28,94,33,27,7,34,27,94,65,28,36,210,24,23,49,50,
+0,184,213,100,63,230,115,61,230,100,191,213,0,88,42,156,208,25,141,210,25,156,80,42,
+0,248,217,243,255,217,0,24,38,13,16,38,0,56,255,0,216,0,0,232,145,43,138,177,
+223,235,199,250,124,213,155,221,220,241,189,224,29,174,226,51,174,227,62,46,228,68,110,228,
+71,142,228,72,158,228,73,158,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,158,228,73,158,228,72,142,228,71,110,228,68,46,228,62,174,227,51,174,226,
+29,190,224,241,221,220,155,125,213,250,236,199,223,139,177,43,234,145,0,40,110,213,133,78,
+33,36,56,6,147,42,101,50,35,15,82,31,227,97,29,205,97,28,194,225,27,188,161,27,
+185,129,27,184,113,27,183,113,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,113,27,183,113,27,184,129,27,185,161,27,188,225,27,194,97,28,205,97,29,
+227,81,31,15,50,35,101,146,42,6,35,56,33,132,78,213,37,110,0,152,162,224,187,207,
+154,13,223,30,78,227,61,78,228,72,158,228,72,158,228,75,174,228,73,174,228,75,174,228,
+74,174,228,75,174,228,74,174,228,75,174,228,74,174,228,75,174,228,74,174,228,75,174,228,
+74,174,228,75,174,228,74,174,228,75,174,228,74,174,228,75,174,228,73,174,228,75,158,228,
+72,158,228,72,78,228,61,78,227,30,14,223,154,189,207,224,155,162,0,120,93,32,84,48,
+102,2,33,226,193,28,195,193,27,184,113,27,184,113,27,181,97,27,183,97,27,181,97,27,
+182,97,27,181,97,27,182,97,27,181,97,27,182,97,27,181,97,27,182,97,27,181,97,27,
+182,97,27,181,97,27,182,97,27,181,97,27,182,97,27,181,97,27,183,97,27,181,113,27,
+184,113,27,184,193,27,195,193,28,226,1,33,102,82,48,32,116,93,0,136,186,189,61,227,
+33,222,227,96,254,228,55,126,228,91,206,228,59,158,228,88,174,228,60,174,228,88,158,228,
+59,206,228,91,126,228,55,254,228,96,222,227,33,62,227,189,141,186,0,136,69,67,210,28,
+223,49,28,160,17,27,201,145,27,165,65,27,197,113,27,168,97,27,196,97,27,168,113,27,
+197,65,27,165,145,27,201,17,27,160,49,28,223,209,28,67,130,69,0,56,205,224,62,231,
+224,205,227,159,238,228,251,237,228,159,206,227,224,61,231,224,62,205,0,216,50,32,209,24,
+32,66,28,97,33,27,5,34,27,97,65,28,32,210,24,32,209,50,0,120,213,97,63,230,
+117,61,230,97,127,213,0,152,42,159,208,25,139,210,25,159,144,42,0,232,217,242,239,217,
+0,40,38,14,32,38,0,40,255,0,232,0,0,88,145,25,26,176,198,91,198,227,44,212,
+138,253,219,230,45,224,22,78,226,47,110,227,60,14,228,67,94,228,70,126,228,72,142,228,
+73,158,228,73,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,73,158,228,
+73,142,228,72,126,228,70,94,228,67,14,228,60,110,227,47,78,226,22,46,224,230,253,219,
+138,45,212,227,92,198,198,27,176,25,90,145,0,184,110,231,245,79,58,180,57,29,227,43,
+118,18,36,26,226,31,234,193,29,209,161,28,196,1,28,189,177,27,186,145,27,184,129,27,
+183,113,27,183,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,183,113,27,
+183,129,27,184,145,27,186,177,27,189,1,28,196,161,28,209,193,29,234,225,31,26,18,36,
+118,226,43,29,179,57,58,244,79,231,181,110,0,120,161,198,75,206,137,93,222,23,254,226,
+59,46,228,71,142,228,72,158,228,74,174,228,74,174,228,75,174,228,74,174,228,75,174,228,
+74,174,228,75,174,228,74,174,228,75,174,228,74,174,228,75,174,228,74,174,228,75,174,228,
+74,174,228,75,174,228,74,174,228,75,174,228,74,174,228,74,158,228,72,142,228,71,46,228,
+59,254,226,23,94,222,137,77,206,198,123,161,0,152,94,58,196,49,119,178,33,233,17,29,
+197,225,27,185,129,27,184,113,27,182,97,27,182,97,27,181,97,27,182,97,27,181,97,27,
+182,97,27,181,97,27,182,97,27,181,97,27,182,97,27,181,97,27,182,97,27,181,97,27,
+182,97,27,181,97,27,182,97,27,181,97,27,182,97,27,182,113,27,184,129,27,185,225,27,
+197,17,29,233,177,33,119,194,49,58,148,94,0,88,185,168,189,226,34,222,227,94,254,228,
+57,126,228,89,206,228,60,158,228,87,174,228,61,174,228,87,158,228,60,206,228,89,126,228,
+57,254,228,94,222,227,34,190,226,168,93,185,0,184,70,88,82,29,222,49,28,162,17,27,
+199,145,27,167,65,27,196,113,27,169,97,27,195,97,27,169,113,27,196,65,27,167,145,27,
+199,17,27,162,49,28,222,81,29,88,178,70,0,136,204,215,46,231,227,221,227,156,238,228,
+253,237,228,156,222,227,227,45,231,215,142,204,0,136,51,41,225,24,29,50,28,100,33,27,
+3,34,27,100,49,28,29,226,24,41,129,51,0,72,213,94,63,230,119,61,230,94,79,213,
+0,200,42,162,208,25,137,210,25,162,192,42,0,216,217,241,223,217,0,56,38,15,48,38,
+0,24,255,0,248,0,0,184,144,8,186,174,173,203,196,203,220,210,120,13,219,217,141,223,
+14,238,225,42,62,227,57,222,227,65,62,228,69,110,228,71,142,228,73,158,228,73,158,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,158,228,73,158,228,73,142,228,71,110,228,
+69,62,228,65,222,227,57,62,227,42,238,225,14,142,223,217,13,219,120,221,210,203,204,196,
+173,187,174,8,186,144,0,88,111,248,85,81,83,68,59,53,51,45,136,2,37,39,130,32,
+242,33,30,214,209,28,199,49,28,191,209,27,187,161,27,185,129,27,183,113,27,183,113,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,113,27,183,113,27,183,129,27,185,161,27,
+187,209,27,191,49,28,199,209,28,214,33,30,242,129,32,39,2,37,136,50,45,53,67,59,
+83,84,81,248,85,111,0,120,160,173,203,204,119,157,221,15,174,226,56,14,228,70,126,228,
+72,158,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,158,228,72,126,228,70,14,228,56,174,226,15,158,221,
+119,205,204,173,123,160,0,152,95,83,68,51,137,114,34,241,97,29,200,1,28,186,145,27,
+184,113,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,113,27,184,145,27,186,1,28,200,97,29,241,113,34,
+137,66,51,83,148,95,0,24,184,146,29,226,33,206,227,91,238,228,58,126,228,88,206,228,
+62,158,228,86,174,228,63,174,228,86,158,228,62,206,228,88,126,228,58,238,228,91,206,227,
+33,30,226,146,29,184,0,248,71,110,242,29,223,65,28,165,33,27,198,145,27,168,65,27,
+194,113,27,170,97,27,193,97,27,170,113,27,194,65,27,168,145,27,198,33,27,165,65,28,
+223,241,29,110,242,71,0,216,203,204,30,231,231,221,227,154,238,228,0,238,228,154,222,227,
+231,29,231,204,222,203,0,56,52,52,241,24,25,50,28,102,33,27,0,34,27,102,49,28,
+25,242,24,52,49,52,0,8,213,91,79,230,121,77,230,91,15,213,0,8,43,165,192,25,
+135,194,25,165,0,43,0,216,217,240,223,217,0,56,38,16,48,38,0,8,255,0,8,1,
+0,40,144,247,73,173,148,59,195,179,140,209,101,13,218,204,221,222,5,126,225,37,238,226,
+53,190,227,63,46,228,68,94,228,70,126,228,72,158,228,73,158,228,73,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,73,158,228,73,158,228,72,126,228,70,94,228,68,46,228,63,190,227,
+53,238,226,37,126,225,5,222,222,204,13,218,101,141,209,179,60,195,148,75,173,247,41,144,
+0,232,111,9,198,82,108,212,60,77,131,46,155,2,38,52,50,33,251,145,30,219,33,29,
+203,81,28,193,225,27,188,177,27,186,145,27,184,113,27,183,113,27,183,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,183,113,27,183,113,27,184,145,27,186,177,27,188,225,27,193,81,28,
+203,33,29,219,145,30,251,49,33,52,2,38,155,130,46,77,211,60,108,196,82,9,230,111,
+0,104,159,148,75,203,101,205,220,6,94,226,53,238,227,68,126,228,72,158,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,158,228,72,126,228,68,238,227,53,94,226,6,206,220,101,77,203,148,107,159,
+0,168,96,108,196,52,155,66,35,250,177,29,203,33,28,188,145,27,184,113,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,113,27,184,145,27,188,33,28,203,177,29,250,65,35,155,194,52,108,164,96,
+0,216,182,124,125,225,32,206,227,89,238,228,60,142,228,87,206,228,63,158,228,85,174,228,
+64,174,228,85,158,228,63,206,228,87,142,228,60,238,228,89,206,227,32,126,225,124,221,182,
+0,56,73,132,146,30,224,65,28,167,33,27,196,129,27,169,65,27,193,113,27,171,97,27,
+192,97,27,171,113,27,193,65,27,169,129,27,196,33,27,167,65,28,224,145,30,132,50,73,
+0,40,203,194,14,231,234,221,227,151,238,228,3,238,228,151,222,227,234,13,231,194,46,203,
+0,232,52,62,1,25,22,50,28,105,33,27,253,33,27,105,49,28,22,2,25,62,225,52,
+0,200,212,87,79,230,123,77,230,87,207,212,0,72,43,169,192,25,133,194,25,169,64,43,
+0,200,217,238,207,217,0,72,38,18,64,38,0,232,254,0,40,1,0,152,143,230,233,171,
+123,155,193,154,28,208,81,253,216,190,29,222,252,253,224,30,158,226,49,142,227,60,14,228,
+66,78,228,69,126,228,71,142,228,72,158,228,73,158,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,158,228,
+73,158,228,72,142,228,71,126,228,69,78,228,66,14,228,60,142,227,49,158,226,30,254,224,
+252,29,222,190,253,216,81,29,208,154,156,193,123,235,171,230,153,143,0,120,112,26,38,84,
+133,116,62,102,243,47,175,18,39,66,242,33,4,18,31,226,113,29,207,129,28,196,1,28,
+190,193,27,187,145,27,185,129,27,184,113,27,183,113,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,113,27,
+183,113,27,184,129,27,185,145,27,187,193,27,190,1,28,196,129,28,207,113,29,226,17,31,
+4,242,33,66,18,39,175,242,47,102,115,62,133,36,84,26,118,112,0,104,158,123,187,201,
+81,221,219,252,253,225,49,206,227,66,110,228,71,142,228,73,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,73,142,228,
+71,110,228,66,206,227,49,254,225,252,221,219,81,189,201,123,107,158,0,168,97,133,84,54,
+175,50,36,4,18,30,207,65,28,190,161,27,185,129,27,183,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,183,129,27,
+185,161,27,190,65,28,207,17,30,4,50,36,175,82,54,133,164,97,0,136,181,101,205,224,
+31,190,227,87,222,228,61,142,228,85,190,228,64,158,228,84,174,228,65,174,228,84,158,228,
+64,190,228,85,142,228,61,222,228,87,190,227,31,206,224,101,141,181,0,136,74,155,66,31,
+225,81,28,169,49,27,195,129,27,171,81,27,192,113,27,172,97,27,191,97,27,172,113,27,
+192,81,27,171,129,27,195,49,27,169,81,28,225,65,31,155,114,74,0,88,202,183,254,230,
+238,221,227,148,238,228,5,238,228,148,222,227,238,253,230,183,94,202,0,184,53,73,17,25,
+18,50,28,108,33,27,251,33,27,108,49,28,18,18,25,73,177,53,0,136,212,83,79,230,
+126,77,230,83,143,212,0,136,43,173,192,25,130,194,25,173,128,43,0,184,217,237,191,217,
+0,88,38,19,80,38,0,216,254,0,56,1,0,8,143,214,153,170,98,251,191,129,172,206,
+60,221,215,174,77,221,241,125,224,23,78,226,45,78,227,57,222,227,64,62,228,68,110,228,
+71,126,228,72,142,228,73,158,228,73,158,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,158,228,73,158,228,73,142,228,72,126,228,
+71,110,228,68,62,228,64,222,227,57,78,227,45,78,226,23,126,224,241,77,221,174,221,215,
+60,173,206,129,252,191,98,155,170,214,9,143,0,8,113,42,118,85,158,20,64,127,99,49,
+196,50,40,82,194,34,15,146,31,233,193,29,211,193,28,199,49,28,192,209,27,188,161,27,
+185,145,27,184,129,27,183,113,27,183,113,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,113,27,183,113,27,183,129,27,184,145,27,
+185,161,27,188,209,27,192,49,28,199,193,28,211,193,29,233,145,31,15,194,34,82,50,40,
+196,98,49,127,19,64,158,116,85,42,6,113,0,104,157,98,27,200,60,237,218,241,125,225,
+45,158,227,65,78,228,70,142,228,73,158,228,73,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,73,158,228,73,142,228,70,78,228,65,158,227,
+45,126,225,241,237,218,60,29,200,98,107,157,0,168,98,158,244,55,196,34,37,15,146,30,
+211,113,28,191,193,27,186,129,27,183,113,27,183,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,183,113,27,183,129,27,186,193,27,191,113,28,
+211,145,30,15,34,37,196,242,55,158,164,98,0,72,180,78,253,223,28,158,227,84,222,228,
+62,142,228,84,190,228,65,158,228,83,174,228,66,174,228,83,158,228,65,190,228,84,142,228,
+62,222,228,84,158,227,28,254,223,78,77,180,0,200,75,178,18,32,228,113,28,172,49,27,
+194,129,27,172,81,27,191,113,27,173,97,27,190,97,27,173,113,27,191,81,27,172,129,27,
+194,49,27,172,113,28,228,17,32,178,194,75,0,136,201,171,238,230,242,221,227,145,238,228,
+8,238,228,145,222,227,242,237,230,171,142,201,0,136,54,85,33,25,14,50,28,111,33,27,
+248,33,27,111,49,28,14,34,25,85,129,54,0,56,212,79,79,230,128,77,230,79,63,212,
+0,216,43,177,192,25,128,194,25,177,208,43,0,152,217,235,159,217,0,120,38,21,112,38,
+0,184,254,0,88,1,0,136,142,199,57,169,73,91,190,103,44,205,39,173,214,158,109,220,
+229,221,223,15,222,225,40,14,227,54,174,227,62,30,228,67,78,228,70,126,228,71,142,228,
+72,158,228,73,158,228,73,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,73,158,228,73,158,228,72,142,228,71,126,228,70,78,228,67,30,228,
+62,174,227,54,14,227,40,222,225,15,222,223,229,109,220,158,173,214,39,45,205,103,92,190,
+73,59,169,199,137,142,0,136,113,57,214,86,183,180,65,153,227,50,217,98,41,98,162,35,
+27,50,32,241,49,30,216,1,29,202,97,28,194,241,27,189,193,27,186,145,27,185,129,27,
+184,113,27,183,113,27,183,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,183,113,27,183,113,27,184,129,27,185,145,27,186,193,27,189,241,27,
+194,97,28,202,1,29,216,49,30,241,49,32,27,162,35,98,98,41,217,226,50,153,179,65,
+183,212,86,57,134,113,0,104,156,73,139,198,38,237,217,230,13,225,39,110,227,62,62,228,
+69,126,228,73,158,228,73,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,73,158,228,73,126,228,69,62,228,62,110,227,39,14,225,230,237,217,
+38,141,198,73,107,156,0,168,99,183,132,57,218,34,38,26,2,31,217,161,28,194,209,27,
+187,145,27,183,113,27,183,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,183,113,27,183,145,27,187,209,27,194,161,28,217,1,31,26,34,38,
+218,130,57,183,164,99,0,248,178,53,45,223,25,142,227,82,206,228,63,142,228,83,190,228,
+66,174,228,82,174,228,67,174,228,82,174,228,66,190,228,83,142,228,63,206,228,82,142,227,
+25,46,223,53,253,178,0,24,77,203,226,32,231,129,28,174,65,27,193,129,27,173,81,27,
+190,97,27,174,97,27,189,97,27,174,97,27,190,81,27,173,129,27,193,65,27,174,129,28,
+231,225,32,203,18,77,0,184,200,158,206,230,246,221,227,142,238,228,11,238,228,142,222,227,
+246,205,230,158,190,200,0,88,55,98,65,25,10,50,28,114,33,27,245,33,27,114,49,28,
+10,66,25,98,81,55,0,248,211,74,79,230,131,77,230,74,255,211,0,24,44,182,192,25,
+125,194,25,182,16,44,0,136,217,233,143,217,0,136,38,23,128,38,0,152,254,0,120,1,
+0,8,142,183,249,167,49,187,188,78,156,203,16,109,213,141,141,219,217,61,223,7,110,225,
+34,190,226,50,126,227,59,254,227,65,62,228,69,110,228,71,126,228,72,142,228,73,158,228,
+73,158,228,73,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,73,158,228,
+73,158,228,73,142,228,72,126,228,71,110,228,69,62,228,65,254,227,59,126,227,50,190,226,
+34,110,225,7,62,223,217,141,219,141,109,213,16,157,203,78,188,188,49,251,167,183,9,142,
+0,8,114,73,22,88,207,84,67,178,115,52,240,162,42,115,130,36,39,210,32,249,161,30,
+222,81,29,206,145,28,197,17,28,191,209,27,187,161,27,185,145,27,184,129,27,183,113,27,
+183,113,27,183,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,183,113,27,
+183,113,27,183,129,27,184,145,27,185,161,27,187,209,27,191,17,28,197,145,28,206,81,29,
+222,161,30,249,209,32,39,130,36,115,162,42,240,114,52,178,83,67,207,20,88,73,6,114,
+0,120,155,49,235,196,16,205,216,217,125,224,34,46,227,60,30,228,68,126,228,72,158,228,
+73,158,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,158,228,
+73,158,228,72,126,228,68,30,228,60,46,227,34,126,224,217,205,216,16,237,196,49,123,155,
+0,152,100,207,36,59,240,66,39,39,146,31,222,225,28,196,241,27,188,145,27,184,113,27,
+183,113,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,113,27,
+183,113,27,184,145,27,188,241,27,196,225,28,222,145,31,39,66,39,240,34,59,207,148,100,
+0,168,177,29,77,222,21,110,227,79,190,228,64,142,228,82,190,228,67,174,228,81,174,228,
+67,174,228,81,174,228,67,190,228,82,142,228,64,190,228,79,110,227,21,78,222,29,173,177,
+0,104,78,227,194,33,235,161,28,177,81,27,192,129,27,174,81,27,189,97,27,175,97,27,
+189,97,27,175,97,27,189,81,27,174,129,27,192,81,27,177,161,28,235,193,33,227,98,78,
+0,216,199,145,174,230,250,221,227,139,222,228,14,222,228,139,222,227,250,173,230,145,222,199,
+0,56,56,111,97,25,6,50,28,117,49,27,242,49,27,117,49,28,6,98,25,111,49,56,
+0,152,211,70,79,230,134,77,230,70,159,211,0,120,44,186,192,25,122,194,25,186,112,44,
+0,120,217,231,127,217,0,152,38,25,144,38,0,120,254,0,152,1,0,136,141,168,169,166,
+25,27,187,51,12,202,249,28,212,122,141,218,203,125,222,253,237,224,27,94,226,45,62,227,
+56,206,227,63,30,228,67,78,228,70,126,228,71,142,228,72,158,228,73,158,228,73,158,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,158,228,73,158,228,73,158,228,72,142,228,
+71,126,228,70,78,228,67,30,228,63,206,227,56,62,227,45,94,226,27,238,224,253,125,222,
+203,141,218,122,29,212,249,12,202,51,28,187,25,171,166,168,137,141,0,136,114,88,102,89,
+231,244,68,205,3,54,7,243,43,134,130,37,53,146,33,3,34,31,229,177,29,211,209,28,
+200,65,28,193,241,27,189,193,27,186,145,27,185,129,27,184,113,27,183,113,27,183,113,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,113,27,183,113,27,183,113,27,184,129,27,
+185,145,27,186,193,27,189,241,27,193,65,28,200,209,28,211,177,29,229,33,31,3,146,33,
+53,130,37,134,242,43,7,3,54,205,243,68,231,100,89,88,134,114,0,136,154,25,75,195,
+249,172,215,203,221,223,27,222,226,56,254,227,67,110,228,71,142,228,73,158,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,158,228,73,142,228,71,110,228,
+67,254,227,56,222,226,27,222,223,203,173,215,249,76,195,25,139,154,0,136,101,231,196,60,
+7,99,40,53,50,32,229,49,29,200,17,28,189,161,27,185,129,27,183,113,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,113,27,183,129,27,185,161,27,
+189,17,28,200,49,29,229,49,32,53,98,40,7,195,60,231,132,101,0,88,176,3,93,221,
+16,62,227,76,174,228,65,142,228,81,190,228,68,174,228,80,174,228,68,174,228,80,174,228,
+68,190,228,81,142,228,65,174,228,76,62,227,16,94,221,3,93,176,0,184,79,253,178,34,
+240,209,28,180,97,27,191,129,27,175,81,27,188,97,27,176,97,27,188,97,27,176,97,27,
+188,81,27,175,129,27,191,97,27,180,209,28,240,177,34,253,178,79,0,232,198,131,142,230,
+253,221,227,135,222,228,17,222,228,135,222,227,253,141,230,131,238,198,0,40,57,125,129,25,
+3,50,28,121,49,27,239,49,27,121,49,28,3,130,25,125,33,57,0,72,211,64,79,230,
+137,77,230,64,79,211,0,200,44,192,192,25,119,194,25,192,192,44,0,88,217,229,95,217,
+0,184,38,27,176,38,0,88,254,0,184,1,0,8,141,154,105,165,1,123,185,25,108,200,
+225,188,210,103,109,217,188,189,221,242,93,224,20,254,225,40,254,226,53,158,227,60,254,227,
+65,62,228,68,110,228,70,126,228,72,142,228,72,158,228,73,158,228,73,158,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,158,228,73,158,228,73,158,228,72,142,228,72,126,228,70,110,228,68,62,228,
+65,254,227,60,158,227,53,254,226,40,254,225,20,94,224,242,189,221,188,109,217,103,189,210,
+225,108,200,25,124,185,1,107,165,154,9,141,0,8,115,102,166,90,255,148,70,231,163,55,
+31,83,45,153,162,38,68,82,34,14,178,31,236,17,30,216,17,29,203,113,28,196,17,28,
+191,209,27,188,161,27,186,145,27,184,129,27,184,113,27,183,113,27,183,113,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,113,27,183,113,27,183,113,27,184,129,27,184,145,27,186,161,27,188,209,27,
+191,17,28,196,113,28,203,17,29,216,17,30,236,177,31,14,82,34,68,162,38,153,82,45,
+31,163,55,231,147,70,255,164,90,102,6,115,0,168,153,1,155,193,225,124,214,189,45,223,
+19,142,226,53,222,227,65,78,228,70,142,228,72,158,228,73,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,73,158,228,72,142,228,70,78,228,65,222,227,53,142,226,
+19,46,223,189,125,214,225,156,193,1,171,153,0,104,102,255,116,62,31,147,41,67,226,32,
+237,129,29,203,49,28,191,193,27,186,129,27,184,113,27,183,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,183,113,27,184,129,27,186,193,27,191,49,28,203,129,29,
+237,225,32,67,146,41,31,115,62,255,100,102,0,8,175,234,92,220,10,14,227,73,158,228,
+66,142,228,80,190,228,68,174,228,79,174,228,69,174,228,79,174,228,68,190,228,80,142,228,
+66,158,228,73,14,227,10,94,220,234,12,175,0,8,81,22,179,35,246,1,29,183,113,27,
+190,129,27,176,81,27,188,97,27,177,97,27,187,97,27,177,97,27,188,81,27,176,129,27,
+190,113,27,183,1,29,246,177,35,22,3,81,0,232,197,116,94,230,1,238,227,132,222,228,
+20,222,228,132,238,227,1,94,230,116,238,197,0,40,58,140,177,25,255,33,28,124,49,27,
+236,49,27,124,33,28,255,177,25,140,33,58,0,232,210,59,79,230,141,77,230,59,239,210,
+0,40,45,197,192,25,115,194,25,197,32,45,0,72,217,227,79,217,0,200,38,29,192,38,
+0,56,254,0,216,1,0,152,140,140,41,164,233,234,183,255,203,198,200,76,209,82,77,216,
+173,221,220,231,189,223,11,142,225,34,174,226,48,110,227,58,222,227,63,30,228,67,78,228,
+69,110,228,71,126,228,72,142,228,73,158,228,73,158,228,73,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,73,158,228,
+73,158,228,73,142,228,72,126,228,71,110,228,69,78,228,67,30,228,63,222,227,58,110,227,
+48,174,226,34,142,225,11,190,223,231,221,220,173,77,216,82,77,209,200,204,198,255,235,183,
+233,42,164,140,153,140,0,120,115,116,230,91,23,37,72,1,68,57,56,195,46,174,194,39,
+83,50,35,25,82,32,245,129,30,222,97,29,208,161,28,198,49,28,193,241,27,189,193,27,
+187,161,27,185,145,27,184,129,27,183,113,27,183,113,27,183,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,183,113,27,
+183,113,27,183,129,27,184,145,27,185,161,27,187,193,27,189,241,27,193,49,28,198,161,28,
+208,97,29,222,129,30,245,81,32,25,50,35,83,194,39,174,194,46,56,67,57,1,36,72,
+23,229,91,116,118,115,0,184,152,233,250,191,200,44,213,173,125,222,11,46,226,49,174,227,
+63,62,228,69,126,228,72,158,228,73,158,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,158,228,73,158,228,72,126,228,69,62,228,63,174,227,49,46,226,11,126,222,173,45,213,
+200,252,191,233,186,152,0,88,103,23,21,64,56,227,42,83,146,33,245,225,29,207,97,28,
+193,209,27,187,145,27,184,113,27,183,113,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,113,27,183,113,27,184,145,27,187,209,27,193,97,28,207,225,29,245,145,33,83,226,42,
+56,19,64,23,85,103,0,184,173,208,92,219,3,206,226,70,142,228,66,142,228,79,190,228,
+69,174,228,79,174,228,70,174,228,79,174,228,69,190,228,79,142,228,66,142,228,70,206,226,
+3,94,219,208,188,173,0,88,82,48,179,36,253,65,29,186,129,27,190,129,27,177,81,27,
+187,97,27,177,97,27,186,97,27,177,97,27,187,81,27,177,129,27,190,129,27,186,65,29,
+253,177,36,48,83,82,0,232,196,100,46,230,5,238,227,129,222,228,23,222,228,129,238,227,
+5,46,230,100,238,196,0,40,59,156,225,25,251,33,28,127,49,27,233,49,27,127,33,28,
+251,225,25,156,33,59,0,120,210,53,79,230,144,77,230,53,127,210,0,152,45,203,192,25,
+112,194,25,203,144,45,0,40,217,225,47,217,0,232,38,31,224,38,0,24,254,0,248,1,
+0,40,140,126,249,162,210,74,182,228,43,197,175,220,207,61,29,215,156,237,219,218,13,223,
+2,14,225,27,78,226,44,30,227,54,174,227,61,254,227,65,62,228,68,94,228,70,126,228,
+71,142,228,72,142,228,73,158,228,73,158,228,73,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,73,158,228,73,158,228,73,142,228,72,142,228,
+71,126,228,70,94,228,68,62,228,65,254,227,61,174,227,54,30,227,44,78,226,27,14,225,
+2,14,223,218,237,219,156,29,215,61,221,207,175,44,197,228,75,182,210,250,162,126,41,140,
+0,232,115,130,22,93,46,197,73,28,228,58,81,51,48,195,242,40,100,34,36,38,2,33,
+254,1,31,229,193,29,212,241,28,202,97,28,195,17,28,191,209,27,188,177,27,186,145,27,
+185,129,27,184,129,27,183,113,27,183,113,27,183,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,183,113,27,183,113,27,183,129,27,184,129,27,
+185,145,27,186,177,27,188,209,27,191,17,28,195,97,28,202,241,28,212,193,29,229,1,31,
+254,1,33,38,34,36,100,242,40,195,50,48,81,227,58,28,196,73,46,21,93,130,230,115,
+0,232,151,210,74,190,175,220,211,156,173,221,2,190,225,44,110,227,61,30,228,68,110,228,
+71,142,228,73,158,228,73,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,73,158,228,73,142,228,
+71,110,228,68,30,228,61,110,227,44,190,225,2,174,221,156,221,211,175,76,190,210,234,151,
+0,40,104,46,197,65,81,51,44,100,98,34,254,81,30,212,161,28,195,241,27,188,161,27,
+185,129,27,183,113,27,183,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,183,113,27,183,129,27,
+185,161,27,188,241,27,195,161,28,212,81,30,254,97,34,100,50,44,81,195,65,46,37,104,
+0,104,172,181,60,218,251,141,226,67,110,228,66,142,228,78,174,228,70,174,228,78,174,228,
+70,174,228,78,174,228,70,174,228,78,142,228,66,110,228,67,142,226,251,61,218,181,108,172,
+0,168,83,75,211,37,5,130,29,189,161,27,190,129,27,178,97,27,186,97,27,178,97,27,
+186,97,27,178,97,27,186,97,27,178,129,27,190,161,27,189,129,29,5,210,37,75,163,83,
+0,216,195,84,238,229,8,238,227,126,222,228,26,222,228,126,238,227,8,238,229,84,222,195,
+0,56,60,172,33,26,248,33,28,130,49,27,230,49,27,130,33,28,248,33,26,172,49,60,
+0,8,210,47,79,230,148,77,230,47,15,210,0,8,46,209,192,25,108,194,25,209,0,46,
+0,8,217,222,15,217,0,8,39,34,0,39,0,232,253,0,40,2,0,184,139,112,217,161,
+188,186,180,202,139,195,150,92,206,39,221,213,138,237,218,204,77,222,247,125,224,20,238,225,
+38,222,226,50,110,227,58,222,227,63,30,228,67,78,228,69,110,228,70,126,228,72,142,228,
+72,158,228,73,158,228,73,158,228,73,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,73,158,228,73,158,228,73,158,228,72,142,228,72,126,228,70,110,228,69,78,228,
+67,30,228,63,222,227,58,110,227,50,222,226,38,238,225,20,126,224,247,77,222,204,237,218,
+138,221,213,39,93,206,150,140,195,202,187,180,188,218,161,112,185,139,0,88,116,144,54,94,
+68,85,75,54,132,60,106,179,49,217,50,42,118,34,37,52,194,33,9,146,31,236,33,30,
+218,49,29,206,161,28,198,49,28,193,241,27,189,193,27,187,161,27,186,145,27,184,129,27,
+184,113,27,183,113,27,183,113,27,183,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,183,113,27,183,113,27,183,113,27,184,129,27,184,145,27,186,161,27,187,193,27,
+189,241,27,193,49,28,198,161,28,206,49,29,218,33,30,236,145,31,9,194,33,52,34,37,
+118,50,42,217,178,49,106,131,60,54,84,75,68,53,94,144,86,116,0,8,151,188,170,188,
+150,124,210,138,205,220,247,77,225,38,46,227,58,254,227,67,94,228,70,142,228,72,158,228,
+73,158,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,158,228,73,158,228,72,142,228,70,94,228,67,254,227,
+58,46,227,38,78,225,247,205,220,138,125,210,150,172,188,188,10,151,0,8,105,68,101,67,
+106,147,45,118,66,35,9,194,30,218,225,28,198,17,28,189,177,27,186,129,27,184,113,27,
+183,113,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,113,27,183,113,27,184,129,27,186,177,27,189,17,28,
+198,225,28,218,193,30,9,66,35,118,146,45,106,99,67,68,5,105,0,40,171,155,12,217,
+242,61,226,63,78,228,66,126,228,77,174,228,70,174,228,78,174,228,71,174,228,78,174,228,
+70,174,228,77,126,228,66,78,228,63,62,226,242,13,217,155,44,171,0,232,84,101,3,39,
+14,210,29,193,193,27,190,145,27,179,97,27,186,97,27,178,97,27,185,97,27,178,97,27,
+186,97,27,179,145,27,190,193,27,193,209,29,14,2,39,101,227,84,0,200,194,67,174,229,
+12,238,227,122,222,228,28,222,228,122,238,227,12,174,229,67,206,194,0,72,61,189,97,26,
+244,33,28,134,49,27,228,49,27,134,33,28,244,97,26,189,65,61,0,152,209,40,79,230,
+152,77,230,40,159,209,0,120,46,216,192,25,104,194,25,216,112,46,0,232,216,219,239,216,
+0,40,39,37,32,39,0,184,253,0,88,2,0,72,139,99,169,160,165,42,179,175,219,193,
+124,204,204,16,141,212,119,237,217,189,125,221,236,221,223,11,126,225,32,126,226,46,62,227,
+55,174,227,61,254,227,65,46,228,68,94,228,69,110,228,71,126,228,72,142,228,72,158,228,
+73,158,228,73,158,228,73,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,73,158,228,73,158,228,
+73,158,228,72,142,228,72,126,228,71,110,228,69,94,228,68,46,228,65,254,227,61,174,227,
+55,62,227,46,126,226,32,126,225,11,222,223,236,125,221,189,237,217,119,141,212,16,205,204,
+124,220,193,175,43,179,165,170,160,99,73,139,0,200,116,157,102,95,91,229,76,81,52,62,
+132,67,51,240,130,43,137,34,38,67,146,34,20,50,32,245,145,30,224,145,29,210,209,28,
+201,97,28,195,17,28,191,225,27,188,177,27,187,161,27,185,145,27,184,129,27,184,113,27,
+183,113,27,183,113,27,183,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,183,113,27,183,113,27,
+183,113,27,184,129,27,184,145,27,185,161,27,187,177,27,188,225,27,191,17,28,195,97,28,
+201,209,28,210,145,29,224,145,30,245,49,32,20,146,34,67,34,38,137,130,43,240,66,51,
+132,51,62,81,228,76,91,101,95,157,198,116,0,56,150,165,250,186,124,12,209,119,221,219,
+236,189,224,32,238,226,55,222,227,65,78,228,69,126,228,72,142,228,73,158,228,73,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,73,158,228,73,142,228,72,126,228,69,78,228,65,222,227,55,238,226,32,190,224,
+236,221,219,119,13,209,124,252,186,165,58,150,0,216,105,91,21,69,132,3,47,137,50,36,
+20,82,31,224,33,29,201,49,28,191,193,27,187,145,27,184,129,27,183,113,27,183,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,183,113,27,183,129,27,184,145,27,187,193,27,191,49,28,201,33,29,224,81,31,
+20,50,36,137,2,47,132,19,69,91,213,105,0,216,169,128,204,215,231,221,225,59,46,228,
+66,126,228,76,174,228,71,174,228,77,174,228,71,174,228,77,174,228,71,174,228,76,126,228,
+66,46,228,59,222,225,231,205,215,128,220,169,0,56,86,128,67,40,25,50,30,197,225,27,
+190,145,27,180,97,27,185,97,27,179,97,27,185,97,27,179,97,27,185,97,27,180,145,27,
+190,225,27,197,49,30,25,66,40,128,51,86,0,168,193,49,94,229,15,238,227,119,222,228,
+31,222,228,119,238,227,15,94,229,49,174,193,0,104,62,207,177,26,241,33,28,137,49,27,
+225,49,27,137,33,28,241,177,26,207,97,62,0,24,209,32,79,230,156,77,230,32,31,209,
+0,248,46,224,192,25,100,194,25,224,240,46,0,200,216,216,207,216,0,72,39,40,64,39,
+0,136,253,0,136,2,0,216,138,87,153,159,143,154,177,149,43,192,97,60,203,248,44,211,
+99,205,216,173,157,220,224,61,223,2,254,224,25,30,226,40,238,226,51,126,227,58,206,227,
+63,14,228,66,62,228,68,94,228,70,126,228,71,142,228,72,142,228,73,158,228,73,158,228,
+73,158,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,158,228,73,158,228,73,158,228,73,142,228,72,142,228,
+71,126,228,70,94,228,68,62,228,66,14,228,63,206,227,58,126,227,51,238,226,40,30,226,
+25,254,224,2,62,223,224,157,220,173,205,216,99,45,211,248,60,203,97,44,192,149,155,177,
+143,154,159,87,217,138,0,56,117,169,118,96,113,117,78,107,228,63,159,211,52,8,227,44,
+157,66,39,83,114,35,32,210,32,254,17,31,231,241,29,216,33,29,205,145,28,198,65,28,
+193,1,28,190,209,27,188,177,27,186,145,27,185,129,27,184,129,27,183,113,27,183,113,27,
+183,113,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,113,27,183,113,27,183,113,27,183,129,27,184,129,27,
+185,145,27,186,177,27,188,209,27,190,1,28,193,65,28,198,145,28,205,33,29,216,241,29,
+231,17,31,254,209,32,32,114,35,83,66,39,157,226,44,8,211,52,159,227,63,107,116,78,
+113,117,96,169,54,117,0,120,149,143,90,185,97,140,207,99,221,218,224,45,224,25,142,226,
+51,174,227,63,46,228,68,110,228,71,142,228,73,158,228,73,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,73,158,228,
+73,142,228,71,110,228,68,46,228,63,174,227,51,142,226,25,46,224,224,221,218,99,141,207,
+97,92,185,143,122,149,0,152,106,113,181,70,159,131,48,157,50,37,32,226,31,231,129,29,
+205,97,28,193,225,27,188,161,27,185,129,27,183,113,27,183,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,183,113,27,
+183,129,27,185,161,27,188,225,27,193,97,28,205,129,29,231,225,31,32,50,37,157,130,48,
+159,179,70,113,149,106,0,152,168,100,124,214,220,125,225,54,14,228,65,110,228,75,174,228,
+71,174,228,77,174,228,72,174,228,77,174,228,71,174,228,75,110,228,65,14,228,54,126,225,
+220,125,214,100,156,168,0,120,87,156,147,41,36,146,30,202,1,28,191,161,27,181,97,27,
+185,97,27,179,97,27,184,97,27,179,97,27,185,97,27,181,161,27,191,1,28,202,145,30,
+36,146,41,156,115,87,0,136,192,30,14,229,18,238,227,116,222,228,34,222,228,116,238,227,
+18,14,229,30,142,192,0,136,63,226,1,27,238,33,28,140,49,27,222,49,27,140,33,28,
+238,1,27,226,129,63,0,136,208,25,79,230,160,77,230,25,143,208,0,136,47,231,192,25,
+96,194,25,231,128,47,0,168,216,213,175,216,0,104,39,43,96,39,0,88,253,0,184,2,
+0,120,138,75,121,158,122,26,176,123,123,190,70,156,201,223,204,209,78,157,215,156,173,219,
+210,125,222,248,93,224,17,174,225,34,158,226,46,62,227,54,174,227,60,238,227,64,46,228,
+67,78,228,69,110,228,70,126,228,71,142,228,72,142,228,73,158,228,73,158,228,73,158,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,158,228,73,158,228,73,158,228,73,142,228,72,142,228,71,126,228,70,110,228,69,78,228,
+67,46,228,64,238,227,60,174,227,54,62,227,46,158,226,34,174,225,17,94,224,248,125,222,
+210,173,219,156,157,215,78,205,209,223,156,201,70,124,190,123,27,176,122,122,158,75,121,138,
+0,152,117,181,150,97,134,245,79,133,148,65,186,115,54,33,67,46,178,114,40,100,98,36,
+46,146,33,8,178,31,239,97,30,222,113,29,210,209,28,202,97,28,196,33,28,192,225,27,
+189,193,27,187,161,27,186,145,27,185,129,27,184,129,27,183,113,27,183,113,27,183,113,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,113,27,183,113,27,183,113,27,183,129,27,184,129,27,185,145,27,186,161,27,187,193,27,
+189,225,27,192,33,28,196,97,28,202,209,28,210,113,29,222,97,30,239,177,31,8,146,33,
+46,98,36,100,114,40,178,66,46,33,115,54,186,147,65,133,244,79,134,149,97,181,150,117,
+0,184,148,122,186,183,70,252,205,78,205,217,210,141,223,17,46,226,46,110,227,60,14,228,
+67,94,228,70,126,228,72,158,228,73,158,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,158,228,73,158,228,72,126,228,70,94,228,
+67,14,228,60,110,227,46,46,226,17,142,223,210,205,217,78,253,205,70,188,183,122,186,148,
+0,88,107,134,85,72,186,19,50,178,66,38,46,130,32,239,225,29,210,161,28,196,1,28,
+189,177,27,186,145,27,184,113,27,183,113,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,113,27,183,113,27,184,145,27,186,177,27,
+189,1,28,196,161,28,210,225,29,239,129,32,46,66,38,178,18,50,186,83,72,134,85,107,
+0,88,167,73,44,213,207,253,224,49,222,227,64,110,228,74,158,228,71,174,228,76,174,228,
+72,174,228,76,174,228,71,158,228,74,110,228,64,222,227,49,254,224,207,45,213,73,92,167,
+0,184,88,183,227,42,49,18,31,207,49,28,192,161,27,182,113,27,185,97,27,180,97,27,
+184,97,27,180,97,27,185,113,27,182,161,27,192,49,28,207,17,31,49,226,42,183,179,88,
+0,88,191,11,174,228,20,238,227,113,222,228,37,222,228,113,238,227,20,174,228,11,94,191,
+0,184,64,245,97,27,236,33,28,143,49,27,219,49,27,143,33,28,236,97,27,245,177,64,
+0,8,208,16,79,230,165,77,230,16,15,208,0,8,48,240,192,25,91,194,25,240,0,48,
+0,120,216,209,127,216,0,152,39,47,144,39,0,24,253,0,248,2,0,24,138,63,105,157,
+101,154,174,97,219,188,44,252,199,198,76,208,57,93,214,138,173,218,196,173,221,236,189,223,
+8,62,225,28,62,226,41,238,226,51,110,227,57,206,227,62,14,228,65,46,228,68,78,228,
+69,110,228,71,126,228,71,142,228,72,142,228,73,158,228,73,158,228,73,158,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,158,228,73,158,228,73,158,228,
+73,142,228,72,142,228,71,126,228,71,110,228,69,78,228,68,46,228,65,14,228,62,206,227,
+57,110,227,51,238,226,41,62,226,28,62,225,8,190,223,236,173,221,196,173,218,138,93,214,
+57,77,208,198,252,199,44,220,188,97,155,174,101,106,157,63,25,138,0,248,117,193,166,98,
+155,117,81,159,52,67,212,19,56,58,195,47,199,178,41,118,98,37,60,98,34,20,82,32,
+248,209,30,228,209,29,215,33,29,205,161,28,199,65,28,194,1,28,191,225,27,188,193,27,
+187,161,27,185,145,27,185,129,27,184,129,27,183,113,27,183,113,27,183,113,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,113,27,183,113,27,183,113,27,
+183,129,27,184,129,27,185,145,27,185,161,27,187,193,27,188,225,27,191,1,28,194,65,28,
+199,161,28,205,33,29,215,209,29,228,209,30,248,81,32,20,98,34,60,98,37,118,178,41,
+199,194,47,58,19,56,212,51,67,159,116,81,155,165,98,193,246,117,0,248,147,101,26,182,
+44,108,204,57,173,216,196,205,222,8,206,225,41,62,227,57,238,227,65,78,228,69,126,228,
+71,142,228,73,158,228,73,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,73,158,228,73,142,228,71,126,228,69,78,228,65,238,227,57,62,227,
+41,206,225,8,206,222,196,173,216,57,109,204,44,28,182,101,250,147,0,24,108,155,245,73,
+212,163,51,199,98,39,60,66,33,248,65,30,215,209,28,199,33,28,191,193,27,187,145,27,
+185,129,27,183,113,27,183,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,183,113,27,183,129,27,185,145,27,187,193,27,191,33,28,199,209,28,
+215,65,30,248,65,33,60,98,39,199,162,51,212,243,73,155,21,108,0,24,166,46,188,211,
+193,125,224,43,174,227,63,94,228,73,158,228,72,174,228,76,174,228,72,174,228,76,174,228,
+72,158,228,73,94,228,63,174,227,43,126,224,193,189,211,46,28,166,0,248,89,210,83,44,
+63,146,31,213,97,28,193,177,27,183,113,27,184,97,27,180,97,27,184,97,27,180,97,27,
+184,113,27,183,177,27,193,97,28,213,145,31,63,82,44,210,243,89,0,24,190,247,61,228,
+22,238,227,110,206,228,40,206,228,110,238,227,22,62,228,247,29,190,0,248,65,9,210,27,
+234,33,28,146,65,27,216,65,27,146,33,28,234,209,27,9,242,65,0,104,207,7,79,230,
+170,77,230,7,111,207,0,168,48,249,192,25,86,194,25,249,160,48,0,72,216,205,79,216,
+0,200,39,51,192,39,0,216,252,0,56,3,0,184,137,51,105,156,81,42,173,72,43,187,
+17,76,198,173,204,206,34,13,213,119,141,217,180,205,220,224,29,223,255,173,224,20,206,225,
+35,158,226,46,46,227,54,158,227,59,222,227,63,30,228,66,62,228,68,94,228,70,110,228,
+71,126,228,72,142,228,72,158,228,73,158,228,73,158,228,73,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,73,158,228,73,158,228,73,158,228,72,142,228,72,126,228,
+71,110,228,70,94,228,68,62,228,66,30,228,63,222,227,59,158,227,54,46,227,46,158,226,
+35,206,225,20,174,224,255,29,223,224,205,220,180,141,217,119,13,213,34,205,206,173,76,198,
+17,44,187,72,43,173,81,106,156,51,185,137,0,88,118,205,166,99,175,229,82,184,228,68,
+239,195,57,83,67,49,222,2,43,137,130,38,76,66,35,32,242,32,1,98,31,236,65,30,
+221,113,29,210,225,28,202,113,28,197,49,28,193,241,27,190,209,27,188,177,27,186,161,27,
+185,145,27,184,129,27,184,113,27,183,113,27,183,113,27,183,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,183,113,27,183,113,27,183,113,27,184,129,27,184,145,27,
+185,161,27,186,177,27,188,209,27,190,241,27,193,49,28,197,113,28,202,225,28,210,113,29,
+221,65,30,236,97,31,1,242,32,32,66,35,76,130,38,137,2,43,222,66,49,83,195,57,
+239,227,68,184,228,82,175,165,99,205,86,118,0,56,147,81,138,180,17,220,202,34,125,215,
+180,13,222,255,77,225,35,238,226,54,190,227,63,46,228,68,110,228,71,142,228,72,158,228,
+73,158,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,158,228,
+73,158,228,72,142,228,71,110,228,68,46,228,63,190,227,54,238,226,35,78,225,255,13,222,
+180,125,215,34,221,202,17,140,180,81,58,147,0,216,108,175,133,75,239,51,53,222,146,40,
+76,2,34,1,194,30,221,33,29,202,81,28,193,225,27,188,161,27,185,129,27,184,113,27,
+183,113,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,113,27,
+183,113,27,184,129,27,185,161,27,188,225,27,193,81,28,202,33,29,221,193,30,1,2,34,
+76,146,40,222,50,53,239,131,75,175,213,108,0,216,164,18,76,210,178,221,223,37,126,227,
+61,78,228,72,158,228,72,158,228,75,174,228,73,174,228,75,158,228,72,158,228,72,78,228,
+61,126,227,37,222,223,178,77,210,18,220,164,0,56,91,238,195,45,78,50,32,219,145,28,
+195,193,27,184,113,27,184,113,27,181,97,27,183,97,27,181,113,27,184,113,27,184,193,27,
+195,145,28,219,49,32,78,194,45,238,51,91,0,216,188,226,189,227,24,238,227,106,206,228,
+43,206,228,106,238,227,24,190,227,226,221,188,0,56,67,30,82,28,232,33,28,150,65,27,
+213,65,27,150,33,28,232,81,28,30,50,67,0,200,206,254,62,230,175,61,230,254,206,206,
+0,72,49,2,209,25,81,210,25,2,65,49,0,24,216,201,31,216,0,248,39,55,240,39,
+0,152,252,0,120,3,0,104,137,40,105,155,61,186,171,46,123,185,246,155,196,147,60,205,
+11,173,211,99,109,216,164,221,219,211,93,222,244,29,224,12,94,225,29,62,226,41,238,226,
+50,94,227,56,190,227,61,254,227,64,30,228,67,78,228,69,94,228,70,110,228,71,126,228,
+72,142,228,72,158,228,73,158,228,73,158,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,158,228,73,158,228,73,158,228,72,142,228,72,126,228,71,110,228,70,94,228,69,78,228,
+67,30,228,64,254,227,61,190,227,56,94,227,50,238,226,41,62,226,29,94,225,12,30,224,
+244,93,222,211,221,219,164,109,216,99,173,211,11,61,205,147,156,196,246,123,185,46,187,171,
+61,106,155,40,105,137,0,168,118,216,166,100,195,85,84,210,148,70,10,116,59,109,211,50,
+245,98,44,157,162,39,92,50,36,45,178,33,12,242,31,244,177,30,227,209,29,215,33,29,
+206,177,28,200,81,28,195,17,28,192,241,27,189,193,27,187,177,27,186,161,27,185,145,27,
+184,129,27,184,113,27,183,113,27,183,113,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,113,27,183,113,27,183,113,27,184,129,27,184,145,27,185,161,27,186,177,27,187,193,27,
+189,241,27,192,17,28,195,81,28,200,177,28,206,33,29,215,209,29,227,177,30,244,241,31,
+12,178,33,45,50,36,92,162,39,157,98,44,245,210,50,109,115,59,10,148,70,210,84,84,
+195,165,100,216,166,118,0,136,146,61,234,178,246,59,201,11,61,214,164,61,221,244,205,224,
+29,158,226,50,142,227,61,14,228,67,94,228,70,126,228,72,142,228,73,158,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,158,228,73,142,228,72,126,228,
+70,94,228,67,14,228,61,142,227,50,158,226,29,206,224,244,61,221,164,61,214,11,61,201,
+246,235,178,61,138,146,0,136,109,195,37,77,10,212,54,245,210,41,92,210,34,12,66,31,
+227,113,29,206,129,28,195,1,28,189,177,27,186,145,27,184,129,27,183,113,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,113,27,183,129,27,184,145,27,
+186,177,27,189,1,28,195,129,28,206,113,29,227,65,31,12,210,34,92,210,41,245,210,54,
+10,36,77,195,133,109,0,168,163,247,219,208,162,61,223,30,46,227,59,46,228,71,142,228,
+72,158,228,75,174,228,73,174,228,75,158,228,72,142,228,71,46,228,59,46,227,30,62,223,
+162,221,208,247,171,163,0,104,92,9,52,47,94,210,32,226,225,28,197,225,27,185,129,27,
+184,113,27,181,97,27,183,97,27,181,113,27,184,129,27,185,225,27,197,225,28,226,209,32,
+94,50,47,9,100,92,0,152,187,205,61,227,25,238,227,103,206,228,45,206,228,103,238,227,
+25,62,227,205,157,187,0,120,68,51,210,28,231,33,28,153,65,27,211,65,27,153,33,28,
+231,209,28,51,114,68,0,40,206,244,62,230,180,61,230,244,46,206,0,232,49,12,209,25,
+76,210,25,12,225,49,0,232,215,197,239,215,0,40,40,59,32,40,0,88,252,0,184,3,
+0,8,137,30,121,154,42,74,170,22,219,183,219,251,194,121,172,203,243,76,210,79,61,215,
+146,221,218,196,141,221,232,109,223,3,222,224,21,222,225,35,158,226,45,30,227,53,126,227,
+58,206,227,62,14,228,65,46,228,67,78,228,69,110,228,70,126,228,71,142,228,72,142,228,
+73,158,228,73,158,228,73,158,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,158,228,73,158,228,73,158,228,
+73,142,228,72,142,228,71,126,228,70,110,228,69,78,228,67,46,228,65,14,228,62,206,227,
+58,126,227,53,30,227,45,158,226,35,222,225,21,222,224,3,110,223,232,141,221,196,221,218,
+146,61,215,79,77,210,243,172,203,121,252,194,219,219,183,22,75,170,42,122,154,30,9,137,
+0,8,119,226,150,101,214,197,85,234,52,72,37,20,61,135,99,52,13,195,45,177,210,40,
+110,50,37,60,130,34,24,162,32,253,49,31,235,49,30,221,113,29,211,241,28,203,145,28,
+198,65,28,194,1,28,191,225,27,189,193,27,187,161,27,186,145,27,185,129,27,184,129,27,
+183,113,27,183,113,27,183,113,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,113,27,183,113,27,183,113,27,
+183,129,27,184,129,27,185,145,27,186,161,27,187,193,27,189,225,27,191,1,28,194,65,28,
+198,145,28,203,241,28,211,113,29,221,49,30,235,49,31,253,161,32,24,130,34,60,50,37,
+110,210,40,177,194,45,13,99,52,135,19,61,37,52,72,234,196,85,214,149,101,226,6,119,
+0,232,145,42,106,177,219,155,199,243,252,212,146,77,220,232,61,224,21,62,226,45,94,227,
+58,238,227,65,62,228,69,110,228,71,142,228,73,158,228,73,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,73,158,228,73,142,228,71,110,228,69,62,228,65,238,227,
+58,94,227,45,62,226,21,62,224,232,77,220,146,253,212,243,156,199,219,107,177,42,234,145,
+0,40,110,214,165,78,37,116,56,13,19,43,110,194,35,24,210,31,235,209,29,211,177,28,
+198,33,28,191,209,27,187,161,27,185,129,27,183,113,27,183,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,183,113,27,183,129,27,185,161,27,187,209,27,191,33,28,
+198,177,28,211,209,29,235,209,31,24,194,35,110,18,43,13,115,56,37,164,78,214,37,110,
+0,120,162,220,75,207,145,125,222,23,238,226,57,30,228,70,126,228,72,158,228,75,174,228,
+73,174,228,75,158,228,72,126,228,70,30,228,57,238,226,23,126,222,145,77,207,220,123,162,
+0,152,93,36,196,48,111,146,33,233,33,29,199,241,27,186,145,27,184,113,27,181,97,27,
+183,97,27,181,113,27,184,145,27,186,241,27,199,33,29,233,145,33,111,194,48,36,148,93,
+0,88,186,183,173,226,26,222,227,100,206,228,48,206,228,100,222,227,26,174,226,183,93,186,
+0,184,69,73,98,29,230,49,28,156,65,27,208,65,27,156,49,28,230,97,29,73,178,69,
+0,104,205,234,46,230,185,45,230,234,110,205,0,168,50,22,225,25,71,226,25,22,161,50,
+0,184,215,192,191,215,0,88,40,64,80,40,0,8,252,0,8,4,0,184,136,19,137,153,
+23,234,168,253,58,182,192,75,193,94,12,202,218,220,208,57,253,213,128,205,217,181,173,220,
+220,189,222,248,77,224,13,110,225,29,62,226,40,222,226,49,78,227,55,158,227,59,222,227,
+63,14,228,66,62,228,68,94,228,69,110,228,70,126,228,71,142,228,72,142,228,73,158,228,
+73,158,228,73,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,73,158,228,73,158,228,73,142,228,72,142,228,71,126,228,
+70,110,228,69,94,228,68,62,228,66,14,228,63,222,227,59,158,227,55,78,227,49,222,226,
+40,62,226,29,110,225,13,78,224,248,189,222,220,173,220,181,205,217,128,253,213,57,221,208,
+218,12,202,94,76,193,192,59,182,253,234,168,23,138,153,19,185,136,0,88,119,237,134,102,
+233,37,87,3,213,73,64,196,62,162,3,54,38,51,47,199,18,42,128,66,38,75,98,35,
+36,82,33,8,194,31,243,161,30,227,209,29,216,49,29,207,193,28,201,113,28,197,49,28,
+193,1,28,190,209,27,188,177,27,187,161,27,186,145,27,185,129,27,184,129,27,183,113,27,
+183,113,27,183,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,183,113,27,183,113,27,183,129,27,184,129,27,185,145,27,
+186,161,27,187,177,27,188,209,27,190,1,28,193,49,28,197,113,28,201,193,28,207,49,29,
+216,209,29,227,161,30,243,193,31,8,82,33,36,98,35,75,66,38,128,18,42,199,50,47,
+38,3,54,162,195,62,64,212,73,3,37,87,233,133,102,237,86,119,0,56,145,23,218,175,
+192,235,197,218,156,211,128,93,219,220,141,223,13,222,225,40,30,227,55,190,227,63,46,228,
+68,94,228,70,126,228,72,158,228,73,158,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,158,228,73,158,228,72,126,228,70,94,228,68,46,228,63,190,227,55,30,227,40,222,225,
+13,142,223,220,93,219,128,157,211,218,236,197,192,219,175,23,58,145,0,216,110,233,53,80,
+64,36,58,38,115,44,128,178,36,36,130,32,243,49,30,216,241,28,201,81,28,193,225,27,
+188,177,27,186,145,27,184,113,27,183,113,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,113,27,183,113,27,184,145,27,186,177,27,188,225,27,193,81,28,201,241,28,216,49,30,
+243,129,32,36,178,36,128,114,44,38,35,58,64,52,80,233,213,110,0,88,161,193,187,205,
+127,189,221,14,158,226,54,254,227,69,126,228,71,158,228,74,174,228,73,174,228,74,158,228,
+71,126,228,69,254,227,54,158,226,14,190,221,127,189,205,193,91,161,0,184,94,63,84,50,
+129,82,34,242,113,29,202,17,28,187,145,27,185,113,27,182,97,27,183,97,27,182,113,27,
+185,145,27,187,17,28,202,113,29,242,81,34,129,82,50,63,180,94,0,8,185,160,29,226,
+26,206,227,97,206,228,50,206,228,97,206,227,26,30,226,160,13,185,0,8,71,96,242,29,
+230,65,28,159,65,27,206,65,27,159,65,28,230,241,29,96,2,71,0,184,204,222,46,230,
+191,45,230,222,190,204,0,88,51,34,225,25,65,226,25,34,81,51,0,120,215,187,127,215,
+0,152,40,69,144,40,0,184,251,0,88,4,0,104,136,10,169,152,5,154,167,229,170,180,
+166,155,191,68,108,200,193,92,207,34,173,212,109,189,216,165,189,219,206,253,221,237,173,223,
+4,238,224,22,206,225,34,142,226,44,14,227,51,110,227,57,190,227,61,238,227,64,30,228,
+66,62,228,68,94,228,70,110,228,71,126,228,72,142,228,72,158,228,73,158,228,73,158,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,158,228,73,158,228,73,158,228,72,142,228,72,126,228,71,110,228,70,94,228,68,62,228,
+66,30,228,64,238,227,61,190,227,57,110,227,51,14,227,44,142,226,34,206,225,22,238,224,
+4,174,223,237,253,221,206,189,219,165,189,216,109,173,212,34,93,207,193,108,200,68,156,191,
+166,171,180,229,154,167,5,170,152,10,105,136,0,168,119,246,102,103,251,117,88,27,101,75,
+90,116,64,188,163,55,63,179,48,222,98,43,147,82,39,91,82,36,50,18,34,19,98,32,
+252,33,31,234,65,30,222,129,29,212,1,29,205,161,28,199,81,28,195,33,28,192,241,27,
+190,209,27,188,177,27,186,161,27,185,145,27,184,129,27,184,113,27,183,113,27,183,113,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,113,27,183,113,27,183,113,27,184,129,27,184,145,27,185,161,27,186,177,27,188,209,27,
+190,241,27,192,33,28,195,81,28,199,161,28,205,1,29,212,129,29,222,65,30,234,33,31,
+252,97,32,19,18,34,50,82,36,91,82,39,147,98,43,222,178,48,63,163,55,188,115,64,
+90,100,75,27,117,88,251,101,103,246,166,119,0,168,144,5,90,174,166,75,196,193,44,210,
+109,93,218,206,221,222,4,110,225,34,206,226,51,158,227,61,14,228,66,78,228,70,126,228,
+72,142,228,73,158,228,74,174,228,74,174,228,74,174,228,74,174,228,74,158,228,73,142,228,
+72,126,228,70,78,228,66,14,228,61,158,227,51,206,226,34,110,225,4,222,222,206,93,218,
+109,45,210,193,76,196,166,91,174,5,170,144,0,104,111,251,181,81,90,196,59,63,227,45,
+147,178,37,50,50,33,252,161,30,222,65,29,205,113,28,195,1,28,190,193,27,186,145,27,
+184,129,27,183,113,27,182,97,27,182,97,27,182,97,27,182,97,27,182,113,27,183,129,27,
+184,145,27,186,193,27,190,1,28,195,113,28,205,65,29,222,161,30,252,49,33,50,178,37,
+147,226,45,63,195,59,90,180,81,251,101,111,0,56,160,166,43,204,108,237,220,5,62,226,
+50,206,227,67,110,228,71,158,228,74,174,228,74,174,228,74,158,228,71,110,228,67,206,227,
+50,62,226,5,238,220,108,45,204,166,59,160,0,216,95,90,228,51,148,34,35,251,209,29,
+206,65,28,189,161,27,185,113,27,182,97,27,182,97,27,182,113,27,185,161,27,189,65,28,
+206,209,29,251,33,35,148,226,51,90,212,95,0,184,183,137,109,225,25,190,227,94,190,228,
+52,190,228,94,190,227,25,110,225,137,189,183,0,88,72,119,162,30,231,81,28,162,81,27,
+204,81,27,162,81,28,231,161,30,119,82,72,0,232,203,211,30,230,196,29,230,211,238,203,
+0,40,52,45,241,25,60,242,25,45,33,52,0,56,215,181,63,215,0,216,40,75,208,40,
+0,88,251,0,184,4,0,24,136,0,201,151,243,73,166,206,26,179,140,235,189,41,204,198,
+168,220,205,11,93,211,89,141,215,147,189,218,192,45,221,225,253,222,251,93,224,14,94,225,
+28,46,226,39,190,226,47,46,227,53,142,227,58,206,227,62,254,227,65,46,228,67,78,228,
+69,94,228,70,126,228,71,142,228,72,142,228,73,158,228,73,158,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,158,228,73,158,228,
+73,142,228,72,142,228,71,126,228,70,94,228,69,78,228,67,46,228,65,254,227,62,206,227,
+58,142,227,53,46,227,47,190,226,39,46,226,28,94,225,14,94,224,251,253,222,225,45,221,
+192,189,218,147,141,215,89,93,211,11,221,205,168,204,198,41,236,189,140,27,179,206,74,166,
+243,201,151,0,25,136,0,248,119,0,71,104,13,198,89,50,245,76,116,36,66,215,67,57,
+88,51,50,245,178,44,167,130,40,109,82,37,64,226,34,31,18,33,5,178,31,242,177,30,
+228,225,29,217,81,29,209,225,28,203,129,28,198,65,28,194,17,28,191,225,27,189,193,27,
+187,177,27,186,145,27,185,129,27,184,129,27,183,113,27,183,113,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,113,27,183,113,27,
+183,129,27,184,129,27,185,145,27,186,177,27,187,193,27,189,225,27,191,17,28,194,65,28,
+198,129,28,203,225,28,209,81,29,217,225,29,228,177,30,242,177,31,5,18,33,31,226,34,
+64,82,37,109,130,40,167,178,44,245,50,50,88,67,57,215,35,66,116,244,76,50,197,89,
+13,70,104,0,247,119,0,8,144,243,233,172,140,155,194,168,188,208,89,61,217,192,29,222,
+251,237,224,28,126,226,47,94,227,58,238,227,65,62,228,69,110,228,71,142,228,73,158,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,158,228,73,142,228,71,110,228,69,62,228,
+65,238,227,58,94,227,47,126,226,28,238,224,251,29,222,192,61,217,89,189,208,168,156,194,
+140,235,172,243,9,144,0,8,112,13,38,83,116,116,61,88,83,47,167,210,38,64,242,33,
+5,34,31,228,145,29,209,177,28,198,33,28,191,209,27,187,161,27,185,129,27,183,113,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,113,27,183,129,27,185,161,27,187,209,27,
+191,33,28,198,177,28,209,145,29,228,33,31,5,242,33,64,210,38,167,82,47,88,115,61,
+116,36,83,13,6,112,0,40,159,140,139,202,88,253,219,251,205,225,46,174,227,65,94,228,
+71,158,228,74,174,228,74,174,228,74,158,228,71,94,228,65,174,227,46,206,225,251,253,219,
+88,141,202,140,43,159,0,232,96,116,132,53,168,18,36,5,66,30,210,97,28,191,177,27,
+185,113,27,182,97,27,182,97,27,182,113,27,185,177,27,191,97,28,210,65,30,5,18,36,
+168,130,53,116,228,96,0,104,182,113,189,224,24,174,227,92,190,228,55,190,228,92,174,227,
+24,190,224,113,109,182,0,168,73,143,82,31,232,97,28,164,81,27,201,81,27,164,97,28,
+232,81,31,143,162,73,0,40,203,199,14,230,202,13,230,199,46,203,0,232,52,57,1,26,
+54,2,26,57,225,52,0,248,214,175,255,214,0,24,41,81,16,41,0,248,250,0,24,5,
+0,200,135,247,248,150,226,9,165,184,138,177,114,75,188,14,44,197,142,76,204,244,236,209,
+68,93,214,129,189,217,177,77,220,213,61,222,240,189,223,5,238,224,21,190,225,33,110,226,
+42,238,226,50,94,227,55,158,227,59,222,227,63,14,228,65,62,228,67,78,228,69,110,228,
+70,126,228,71,142,228,72,158,228,73,158,228,73,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,73,158,228,73,158,228,72,142,228,71,126,228,
+70,110,228,69,78,228,67,62,228,65,14,228,63,222,227,59,158,227,55,94,227,50,238,226,
+42,110,226,33,190,225,21,238,224,5,190,223,240,61,222,213,77,220,177,189,217,129,93,214,
+68,237,209,244,76,204,142,44,197,14,76,188,114,139,177,184,10,165,226,249,150,247,200,135,
+0,72,120,9,23,105,30,6,91,72,133,78,142,196,67,242,227,58,114,195,51,12,35,46,
+188,178,41,127,82,38,79,194,35,43,210,33,16,82,32,251,33,31,235,81,30,223,161,29,
+214,33,29,206,177,28,201,113,28,197,49,28,193,1,28,191,209,27,189,193,27,187,161,27,
+186,145,27,185,129,27,184,113,27,183,113,27,183,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,183,113,27,183,113,27,184,129,27,185,145,27,
+186,161,27,187,193,27,189,209,27,191,1,28,193,49,28,197,113,28,201,177,28,206,33,29,
+214,161,29,223,81,30,235,33,31,251,81,32,16,210,33,43,194,35,79,82,38,127,178,41,
+188,34,46,12,195,51,114,227,58,242,195,67,142,132,78,72,5,91,30,22,105,9,71,120,
+0,120,143,226,137,171,114,235,192,142,76,207,68,29,216,177,93,221,240,93,224,21,30,226,
+42,46,227,55,190,227,63,30,228,67,94,228,70,126,228,72,158,228,73,174,228,74,174,228,
+74,174,228,74,174,228,73,158,228,72,126,228,70,94,228,67,30,228,63,190,227,55,46,227,
+42,30,226,21,94,224,240,93,221,177,29,216,68,77,207,142,236,192,114,139,171,226,121,143,
+0,152,112,30,134,84,142,36,63,114,195,48,188,242,39,79,178,34,16,178,31,235,241,29,
+214,225,28,201,81,28,193,241,27,189,177,27,186,145,27,184,113,27,183,97,27,182,97,27,
+182,97,27,182,97,27,183,113,27,184,145,27,186,177,27,189,241,27,193,81,28,201,225,28,
+214,241,29,235,177,31,16,178,34,79,242,39,188,194,48,114,35,63,142,132,84,30,150,112,
+0,24,158,114,251,200,67,13,219,241,93,225,42,126,227,63,78,228,70,142,228,74,174,228,
+74,174,228,74,142,228,70,78,228,63,126,227,42,94,225,241,13,219,67,253,200,114,27,158,
+0,248,97,142,20,55,189,2,37,15,178,30,214,145,28,193,193,27,186,129,27,182,97,27,
+182,97,27,182,129,27,186,193,27,193,145,28,214,177,30,15,2,37,189,18,55,142,244,97,
+0,24,181,89,253,223,22,158,227,89,190,228,57,190,228,89,158,227,22,254,223,89,29,181,
+0,248,74,167,18,32,234,113,28,167,81,27,199,81,27,167,113,28,234,17,32,167,242,74,
+0,72,202,186,254,229,207,253,229,186,78,202,0,200,53,70,17,26,49,18,26,70,193,53,
+0,184,214,169,191,214,0,88,41,87,80,41,0,152,250,0,120,5,0,136,135,238,40,150,
+209,201,163,161,10,176,88,171,186,244,123,195,116,188,202,220,124,208,46,13,213,111,157,216,
+161,93,219,199,125,221,229,29,223,252,93,224,13,78,225,27,14,226,37,174,226,45,30,227,
+52,110,227,57,190,227,61,238,227,64,30,228,66,62,228,68,94,228,70,110,228,71,126,228,
+72,142,228,73,158,228,73,158,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,174,228,74,158,228,73,158,228,73,142,228,72,126,228,71,110,228,70,94,228,68,62,228,
+66,30,228,64,238,227,61,190,227,57,110,227,52,30,227,45,174,226,37,14,226,27,78,225,
+13,94,224,252,29,223,229,125,221,199,93,219,161,157,216,111,13,213,46,125,208,220,188,202,
+116,124,195,244,171,186,88,11,176,161,202,163,209,41,150,238,136,135,0,136,120,18,231,105,
+47,70,92,95,5,80,168,100,69,12,148,60,140,83,53,36,147,47,210,2,43,145,114,39,
+95,178,36,57,146,34,27,242,32,4,178,31,243,193,30,229,1,30,219,97,29,211,241,28,
+204,161,28,199,81,28,195,33,28,192,241,27,190,209,27,188,177,27,186,161,27,185,145,27,
+184,129,27,183,113,27,183,113,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,97,27,182,113,27,183,113,27,183,129,27,184,145,27,185,161,27,186,177,27,188,209,27,
+190,241,27,192,33,28,195,81,28,199,161,28,204,241,28,211,97,29,219,1,30,229,193,30,
+243,177,31,4,242,32,27,146,34,57,178,36,95,114,39,145,2,43,210,146,47,36,83,53,
+140,147,60,12,100,69,168,4,80,95,69,92,47,230,105,18,135,120,0,232,142,209,25,170,
+88,75,191,116,204,205,46,253,214,161,125,220,229,205,223,13,190,225,37,222,226,52,158,227,
+61,14,228,66,78,228,70,126,228,72,158,228,73,174,228,74,174,228,74,174,228,74,174,228,
+73,158,228,72,126,228,70,78,228,66,14,228,61,158,227,52,222,226,37,190,225,13,206,223,
+229,125,220,161,253,214,46,205,205,116,76,191,88,27,170,209,233,142,0,40,113,47,246,85,
+168,196,64,140,67,50,210,18,41,95,146,35,27,66,32,243,81,30,219,49,29,204,113,28,
+195,1,28,190,193,27,186,145,27,184,113,27,183,97,27,182,97,27,182,97,27,182,97,27,
+183,113,27,184,145,27,186,193,27,190,1,28,195,113,28,204,49,29,219,81,30,243,65,32,
+27,146,35,95,18,41,210,66,50,140,195,64,168,244,85,47,38,113,0,24,157,89,91,199,
+46,13,218,229,221,224,37,78,227,61,46,228,69,142,228,73,174,228,74,174,228,73,142,228,
+69,46,228,61,78,227,37,222,224,229,13,218,46,93,199,89,27,157,0,248,98,167,180,56,
+210,2,38,27,50,31,219,193,28,195,225,27,187,129,27,183,97,27,182,97,27,183,129,27,
+187,225,27,195,193,28,219,49,31,27,2,38,210,178,56,167,244,98,0,184,179,64,45,223,
+19,126,227,86,190,228,59,190,228,86,126,227,19,46,223,64,189,179,0,88,76,192,226,32,
+237,145,28,170,81,27,197,81,27,170,145,28,237,225,32,192,82,76,0,120,201,173,222,229,
+213,221,229,173,126,201,0,152,54,83,49,26,43,50,26,83,145,54,0,104,214,163,111,214,
+0,168,41,93,160,41,0,56,250,0,216,5,0,56,135,230,88,149,194,153,162,140,154,174,
+64,11,185,218,219,193,90,44,201,196,12,207,24,189,211,91,125,215,144,93,218,185,173,220,
+217,109,222,241,205,223,5,222,224,20,174,225,32,78,226,41,222,226,48,62,227,54,142,227,
+58,206,227,62,254,227,65,46,228,67,78,228,69,110,228,70,126,228,71,142,228,72,158,228,
+73,158,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,74,158,228,
+73,158,228,72,142,228,71,126,228,70,110,228,69,78,228,67,46,228,65,254,227,62,206,227,
+58,142,227,54,62,227,48,222,226,41,78,226,32,174,225,20,222,224,5,206,223,241,109,222,
+217,173,220,185,93,218,144,125,215,91,189,211,24,13,207,196,44,201,90,220,193,218,11,185,
+64,155,174,140,154,162,194,89,149,230,56,135,0,216,120,26,183,106,62,118,93,116,117,81,
+192,4,71,38,52,62,166,227,54,60,3,49,232,82,44,165,146,40,112,178,37,71,98,35,
+39,162,33,15,66,32,251,49,31,236,97,30,224,193,29,215,49,29,208,209,28,202,129,28,
+198,65,28,194,17,28,191,225,27,189,193,27,187,161,27,186,145,27,185,129,27,184,113,27,
+183,113,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,182,113,27,
+183,113,27,184,129,27,185,145,27,186,161,27,187,193,27,189,225,27,191,17,28,194,65,28,
+198,129,28,202,209,28,208,49,29,215,193,29,224,97,30,236,49,31,251,65,32,15,162,33,
+39,98,35,71,178,37,112,146,40,165,82,44,232,2,49,60,227,54,166,51,62,38,4,71,
+192,116,81,116,117,93,62,182,106,26,215,120,0,104,142,194,201,168,64,171,189,90,76,204,
+24,189,213,144,157,219,217,29,223,5,78,225,32,158,226,48,110,227,58,238,227,65,62,228,
+69,110,228,71,142,228,73,174,228,74,174,228,74,174,228,74,174,228,73,142,228,71,110,228,
+69,62,228,65,238,227,58,110,227,48,158,226,32,78,225,5,30,223,217,157,219,144,189,213,
+24,77,204,90,172,189,64,203,168,194,105,142,0,168,113,62,70,87,192,100,66,166,195,51,
+232,82,42,112,114,36,39,242,32,251,193,30,224,113,29,208,161,28,198,33,28,191,209,27,
+187,161,27,185,129,27,183,97,27,182,97,27,182,97,27,182,97,27,183,129,27,185,161,27,
+187,209,27,191,33,28,198,161,28,208,113,29,224,193,30,251,241,32,39,114,36,112,82,42,
+232,194,51,166,99,66,192,68,87,62,166,113,0,24,156,64,187,197,24,253,216,217,93,224,
+31,14,227,58,30,228,69,126,228,73,174,228,74,174,228,73,126,228,69,30,228,58,14,227,
+31,94,224,217,253,216,24,189,197,64,27,156,0,248,99,192,84,58,232,18,39,39,178,31,
+225,1,29,198,241,27,187,145,27,183,97,27,182,97,27,183,145,27,187,241,27,198,1,29,
+225,177,31,39,18,39,232,82,58,192,244,99,0,104,178,40,77,222,16,94,227,83,174,228,
+60,174,228,83,94,227,16,78,222,40,109,178,0,168,77,216,194,33,240,177,28,173,97,27,
+196,97,27,173,177,28,240,193,33,216,162,77,0,152,200,159,206,229,219,205,229,159,158,200,
+0,120,55,97,65,26,37,66,26,97,113,55,0,40,214,156,47,214,0,232,41,100,224,41,
+0,200,249,0,72,6,0,248,134,221,152,148,178,121,161,119,42,173,39,123,183,192,59,192,
+65,140,199,171,156,205,1,109,210,71,77,214,126,93,217,169,205,219,204,173,221,231,45,223,
+252,93,224,12,62,225,25,254,225,36,142,226,44,254,226,50,94,227,56,174,227,60,222,227,
+63,14,228,66,62,228,68,94,228,70,110,228,71,126,228,72,142,228,73,158,228,73,174,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,174,228,73,158,228,73,142,228,72,126,228,
+71,110,228,70,94,228,68,62,228,66,14,228,63,222,227,60,174,227,56,94,227,50,254,226,
+44,142,226,36,254,225,25,62,225,12,94,224,252,45,223,231,173,221,204,205,219,169,93,217,
+126,77,214,71,109,210,1,157,205,171,140,199,65,60,192,192,123,183,39,43,173,119,122,161,
+178,153,148,221,248,134,0,24,121,35,119,107,78,150,94,137,229,82,217,148,72,64,212,63,
+191,131,56,85,115,50,255,162,45,185,194,41,130,178,38,87,66,36,52,98,34,25,226,32,
+4,178,31,244,209,30,231,17,30,220,129,29,212,17,29,206,177,28,200,97,28,196,49,28,
+193,1,28,190,209,27,188,177,27,186,161,27,185,145,27,184,129,27,183,113,27,183,97,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,97,27,183,113,27,183,129,27,184,145,27,
+185,161,27,186,177,27,188,209,27,190,1,28,193,49,28,196,97,28,200,177,28,206,17,29,
+212,129,29,220,17,30,231,209,30,244,177,31,4,226,32,25,98,34,52,66,36,87,178,38,
+130,194,41,185,162,45,255,114,50,85,131,56,191,211,63,64,148,72,217,228,82,137,149,94,
+78,118,107,35,23,121,0,216,141,178,121,167,39,11,188,65,188,202,1,125,212,126,157,218,
+204,125,222,252,205,224,25,78,226,44,46,227,56,206,227,63,46,228,68,110,228,71,142,228,
+73,158,228,74,174,228,74,174,228,74,158,228,73,142,228,71,110,228,68,46,228,63,206,227,
+56,46,227,44,78,226,25,206,224,252,125,222,204,157,218,126,125,212,1,189,202,65,12,188,
+39,123,167,178,217,141,0,56,114,78,150,88,217,4,68,191,83,53,255,146,43,130,114,37,
+52,146,33,4,66,31,231,193,29,212,225,28,200,65,28,193,225,27,188,161,27,185,129,27,
+183,113,27,182,97,27,182,97,27,182,113,27,183,129,27,185,161,27,188,225,27,193,65,28,
+200,225,28,212,193,29,231,65,31,4,146,33,52,114,37,130,146,43,255,82,53,191,3,68,
+217,148,88,78,54,114,0,40,155,39,27,196,1,237,215,204,205,223,25,206,226,56,254,227,
+68,126,228,73,174,228,74,174,228,73,126,228,68,254,227,56,206,226,25,206,223,204,237,215,
+1,29,196,39,43,155,0,232,100,217,244,59,255,34,40,52,66,32,231,65,29,200,17,28,
+188,145,27,183,97,27,182,97,27,183,145,27,188,17,28,200,65,29,231,65,32,52,34,40,
+255,242,59,217,228,100,0,24,177,15,109,221,11,62,227,81,174,228,62,174,228,81,62,227,
+11,110,221,15,29,177,0,248,78,241,162,34,245,209,28,175,97,27,194,97,27,175,209,28,
+245,161,34,241,242,78,0,168,199,145,174,229,225,173,229,145,174,199,0,104,56,111,97,26,
+31,98,26,111,97,56,0,216,213,149,223,213,0,56,42,107,48,42,0,88,249,0,184,6,
+0,184,134,214,232,147,164,105,160,99,202,171,16,235,181,166,155,190,39,252,197,146,28,204,
+235,12,209,50,29,213,108,77,216,154,221,218,190,221,220,219,125,222,242,205,223,4,206,224,
+19,158,225,30,62,226,39,190,226,47,46,227,53,126,227,57,190,227,61,254,227,64,46,228,
+67,78,228,69,110,228,70,126,228,72,142,228,73,158,228,73,174,228,74,174,228,74,174,228,
+74,174,228,74,174,228,74,174,228,73,158,228,73,142,228,72,126,228,70,110,228,69,78,228,
+67,46,228,64,254,227,61,190,227,57,126,227,53,46,227,47,190,226,39,62,226,30,158,225,
+19,206,224,4,206,223,242,125,222,219,221,220,190,221,218,154,77,216,108,29,213,50,13,209,
+235,28,204,146,252,197,39,156,190,166,235,181,16,203,171,99,106,160,164,233,147,214,184,134,
+0,88,121,42,39,108,92,166,95,157,69,84,240,36,74,90,116,65,217,19,58,110,243,51,
+21,3,47,206,242,42,148,194,39,102,50,37,66,50,35,37,146,33,14,66,32,252,65,31,
+237,113,30,226,209,29,217,81,29,209,225,28,203,145,28,199,81,28,195,17,28,192,225,27,
+189,193,27,187,161,27,186,145,27,184,129,27,183,113,27,183,97,27,182,97,27,182,97,27,
+182,97,27,182,97,27,182,97,27,183,113,27,183,129,27,184,145,27,186,161,27,187,193,27,
+189,225,27,192,17,28,195,81,28,199,145,28,203,225,28,209,81,29,217,209,29,226,113,30,
+237,65,31,252,65,32,14,146,33,37,50,35,66,50,37,102,194,39,148,242,42,206,2,47,
+21,243,51,110,19,58,217,115,65,90,36,74,240,68,84,157,165,95,92,38,108,42,87,121,
+0,104,141,164,57,166,16,107,186,39,44,201,235,44,211,108,173,217,190,189,221,242,77,224,
+19,238,225,39,254,226,53,158,227,61,14,228,67,94,228,70,142,228,73,158,228,74,174,228,
+74,174,228,74,158,228,73,142,228,70,94,228,67,14,228,61,158,227,53,254,226,39,238,225,
+19,78,224,242,189,221,190,173,217,108,45,211,235,44,201,39,108,186,16,59,166,164,105,141,
+0,168,114,92,214,89,240,164,69,217,227,54,21,227,44,148,98,38,66,82,34,14,194,31,
+237,33,30,217,17,29,203,113,28,195,1,28,189,177,27,186,129,27,183,113,27,182,97,27,
+182,97,27,182,113,27,183,129,27,186,177,27,189,1,28,195,113,28,203,17,29,217,33,30,
+237,193,31,14,82,34,66,98,38,148,226,44,21,227,54,217,163,69,240,212,89,92,166,114,
+0,56,154,16,123,194,234,204,214,190,45,223,18,126,226,53,222,227,67,110,228,73,174,228,
+74,174,228,73,110,228,67,222,227,53,126,226,18,46,223,190,205,214,234,124,194,16,59,154,
+0,216,101,240,148,61,22,67,41,66,226,32,238,145,29,203,49,28,189,161,27,183,97,27,
+182,97,27,183,161,27,189,49,28,203,145,29,238,225,32,66,66,41,22,147,61,240,212,101,
+0,216,175,246,124,220,7,30,227,78,174,228,63,174,228,78,30,227,7,126,220,246,220,175,
+0,56,80,10,147,35,249,241,28,178,97,27,193,97,27,178,241,28,249,145,35,10,51,80,
+0,184,198,131,158,229,230,157,229,131,190,198,0,88,57,125,113,26,26,114,26,125,81,57,
+0,120,213,142,127,213,0,152,42,114,144,42,0,232,248,0,40,7,0,136,134,206,56,147,
+150,89,159,80,122,170,249,106,180,141,11,189,14,108,196,122,156,202,211,172,207,29,221,211,
+89,45,215,137,237,217,176,13,220,207,205,221,232,45,223,251,77,224,11,46,225,24,238,225,
+34,126,226,43,238,226,49,78,227,55,158,227,59,222,227,63,14,228,65,62,228,68,94,228,
+70,110,228,71,142,228,72,158,228,73,158,228,74,174,228,74,174,228,74,174,228,74,174,228,
+74,158,228,73,158,228,72,142,228,71,110,228,70,94,228,68,62,228,65,14,228,63,222,227,
+59,158,227,55,78,227,49,238,226,43,126,226,34,238,225,24,46,225,11,78,224,251,45,223,
+232,205,221,207,13,220,176,237,217,137,45,215,89,221,211,29,173,207,211,156,202,122,108,196,
+14,12,189,141,107,180,249,122,170,80,90,159,150,57,147,206,136,134,0,136,121,50,215,108,
+106,182,96,176,149,85,7,165,75,115,4,67,242,163,59,134,115,53,45,99,48,227,50,44,
+167,226,40,119,34,38,80,2,36,49,66,34,24,226,32,5,194,31,245,225,30,232,33,30,
+222,145,29,213,33,29,207,193,28,201,113,28,197,49,28,193,1,28,191,209,27,188,177,27,
+186,161,27,185,129,27,184,113,27,183,113,27,182,97,27,182,97,27,182,97,27,182,97,27,
+182,113,27,183,113,27,184,129,27,185,161,27,186,177,27,188,209,27,191,1,28,193,49,28,
+197,113,28,201,193,28,207,33,29,213,145,29,222,33,30,232,225,30,245,193,31,5,226,32,
+24,66,34,49,2,36,80,34,38,119,226,40,167,50,44,227,98,48,45,115,53,134,163,59,
+242,3,67,115,164,75,7,149,85,176,181,96,106,214,108,50,135,121,0,232,140,150,9,165,
+249,218,184,14,172,199,211,220,209,89,157,216,176,253,220,232,189,223,11,142,225,34,190,226,
+49,126,227,59,254,227,65,78,228,70,126,228,72,158,228,74,174,228,74,174,228,74,158,228,
+72,126,228,70,78,228,65,254,227,59,126,227,49,190,226,34,142,225,11,190,223,232,253,220,
+176,157,216,89,221,209,211,172,199,14,220,184,249,10,165,150,233,140,0,40,115,106,6,91,
+7,53,71,242,99,56,45,51,46,167,114,39,80,18,35,24,82,32,245,129,30,222,81,29,
+207,145,28,197,17,28,191,193,27,186,145,27,184,113,27,182,97,27,182,97,27,182,113,27,
+184,145,27,186,193,27,191,17,28,197,145,28,207,81,29,222,129,30,245,81,32,24,18,35,
+80,114,39,167,50,46,45,99,56,242,51,71,7,5,91,106,38,115,0,88,153,249,234,192,
+211,156,213,176,141,222,11,46,226,49,190,227,65,110,228,72,174,228,74,174,228,72,110,228,
+65,190,227,49,46,226,11,142,222,176,157,213,211,236,192,249,90,153,0,184,102,7,37,63,
+45,115,42,80,130,33,245,225,29,207,81,28,191,161,27,184,97,27,182,97,27,184,161,27,
+191,81,28,207,225,29,245,129,33,80,114,42,45,35,63,7,181,102,0,152,174,221,140,219,
+1,238,226,75,158,228,65,158,228,75,238,226,1,142,219,221,156,174,0,120,81,35,131,36,
+255,33,29,181,113,27,191,113,27,181,33,29,255,129,36,35,115,81,0,200,197,116,126,229,
+236,125,229,116,206,197,0,72,58,140,145,26,20,146,26,140,65,58,0,40,213,134,47,213,
+0,232,42,122,224,42,0,104,248,0,168,7,0,72,134,199,152,146,136,73,158,61,42,169,
+226,234,178,117,123,187,245,219,194,97,28,201,188,76,206,8,141,210,70,13,214,120,237,216,
+161,45,219,194,13,221,221,141,222,242,189,223,4,190,224,18,142,225,29,46,226,38,174,226,
+46,30,227,52,110,227,57,190,227,61,254,227,64,46,228,67,78,228,69,110,228,71,126,228,
+72,142,228,73,158,228,74,174,228,74,174,228,74,174,228,74,174,228,74,158,228,73,142,228,
+72,126,228,71,110,228,69,78,228,67,46,228,64,254,227,61,190,227,57,110,227,52,30,227,
+46,174,226,38,46,226,29,142,225,18,190,224,4,190,223,242,141,222,221,13,221,194,45,219,
+161,237,216,120,13,214,70,141,210,8,77,206,188,28,201,97,220,194,245,123,187,117,235,178,
+226,42,169,61,74,158,136,153,146,199,72,134,0,200,121,57,119,109,120,198,97,195,229,86,
+30,37,77,139,148,68,11,52,61,159,243,54,68,195,49,248,130,45,186,2,42,136,34,39,
+95,226,36,62,2,35,35,130,33,14,82,32,252,81,31,238,129,30,227,225,29,218,97,29,
+210,241,28,204,161,28,199,81,28,195,17,28,192,225,27,189,193,27,187,161,27,185,145,27,
+184,129,27,183,113,27,182,97,27,182,97,27,182,97,27,182,97,27,182,113,27,183,129,27,
+184,145,27,185,161,27,187,193,27,189,225,27,192,17,28,195,81,28,199,161,28,204,241,28,
+210,97,29,218,225,29,227,129,30,238,81,31,252,81,32,14,130,33,35,2,35,62,226,36,
+95,34,39,136,2,42,186,130,45,248,194,49,68,243,54,159,51,61,11,148,68,139,36,77,
+30,229,86,195,197,97,120,118,109,57,199,121,0,120,140,136,217,163,226,90,183,245,27,198,
+188,140,208,70,141,215,161,45,220,221,45,223,4,46,225,29,110,226,46,78,227,57,222,227,
+64,62,228,69,126,228,72,158,228,74,174,228,74,174,228,74,158,228,72,126,228,69,62,228,
+64,222,227,57,78,227,46,110,226,29,46,225,4,46,223,221,45,220,161,141,215,70,141,208,
+188,28,198,245,91,183,226,218,163,136,121,140,0,152,115,120,54,92,30,181,72,11,244,57,
+68,131,47,186,130,40,95,226,35,35,226,32,252,225,30,227,161,29,210,193,28,199,49,28,
+192,209,27,187,145,27,184,113,27,182,97,27,182,97,27,182,113,27,184,145,27,187,209,27,
+192,49,28,199,193,28,210,161,29,227,225,30,252,225,32,35,226,35,95,130,40,186,130,47,
+68,243,57,11,180,72,30,53,92,120,150,115,0,136,152,226,90,191,188,108,212,161,221,221,
+3,222,225,46,158,227,64,94,228,72,174,228,74,174,228,72,94,228,64,158,227,46,222,225,
+3,222,221,161,109,212,188,92,191,226,138,152,0,136,103,30,181,64,68,163,43,95,50,34,
+253,49,30,210,113,28,192,177,27,184,97,27,182,97,27,184,177,27,192,113,28,210,49,30,
+253,49,34,95,162,43,68,179,64,30,133,103,0,88,173,196,140,218,251,189,226,73,158,228,
+66,158,228,73,190,226,251,141,218,196,92,173,0,184,82,60,131,37,5,82,29,183,113,27,
+190,113,27,183,81,29,5,130,37,60,179,82,0,200,196,101,78,229,242,77,229,101,206,196,
+0,72,59,155,193,26,14,194,26,155,65,59,0,200,212,126,207,212,0,72,43,130,64,43,
+0,232,247,0,40,8,0,24,134,192,248,145,123,89,157,43,234,167,205,122,177,93,251,185,
+220,91,193,73,156,199,165,220,204,242,76,209,50,237,212,103,221,215,146,77,218,181,77,220,
+209,221,221,232,45,223,251,61,224,11,30,225,23,222,225,33,110,226,42,222,226,49,78,227,
+54,158,227,59,222,227,63,14,228,66,62,228,68,94,228,70,126,228,72,142,228,73,158,228,
+74,174,228,74,174,228,74,174,228,74,174,228,74,158,228,73,142,228,72,126,228,70,94,228,
+68,62,228,66,14,228,63,222,227,59,158,227,54,78,227,49,222,226,42,110,226,33,222,225,
+23,30,225,11,62,224,251,45,223,232,221,221,209,77,220,181,77,218,146,221,215,103,237,212,
+50,77,209,242,220,204,165,156,199,73,92,193,220,251,185,93,123,177,205,234,167,43,90,157,
+123,249,145,192,24,134,0,248,121,64,23,110,133,182,98,213,37,88,51,149,78,163,20,70,
+36,180,62,183,115,56,91,51,51,14,195,46,206,34,43,153,50,40,110,194,37,75,194,35,
+47,50,34,24,226,32,5,210,31,245,241,30,233,49,30,223,161,29,214,49,29,207,193,28,
+202,113,28,197,49,28,193,1,28,190,209,27,188,177,27,186,145,27,184,129,27,183,113,27,
+182,97,27,182,97,27,182,97,27,182,97,27,182,113,27,183,129,27,184,145,27,186,177,27,
+188,209,27,190,1,28,193,49,28,197,113,28,202,193,28,207,49,29,214,161,29,223,49,30,
+233,241,30,245,209,31,5,226,32,24,50,34,47,194,35,75,194,37,110,50,40,153,34,43,
+206,194,46,14,51,51,91,115,56,183,179,62,36,20,70,163,148,78,51,37,88,213,181,98,
+133,22,110,64,247,121,0,8,140,123,185,162,205,218,181,220,155,196,165,44,207,50,125,214,
+146,93,219,209,141,222,251,189,224,23,30,226,42,30,227,54,190,227,63,46,228,68,110,228,
+72,158,228,74,174,228,74,174,228,74,158,228,72,110,228,68,46,228,63,190,227,54,30,227,
+42,30,226,23,190,224,251,141,222,209,93,219,146,125,214,50,45,207,165,156,196,220,219,181,
+205,186,162,123,9,140,0,8,116,133,86,93,51,53,74,36,116,59,91,227,48,206,146,41,
+110,178,36,47,130,33,5,82,31,233,241,29,214,241,28,202,81,28,193,225,27,188,161,27,
+184,113,27,182,97,27,182,97,27,182,113,27,184,161,27,188,225,27,193,81,28,202,241,28,
+214,241,29,233,81,31,5,130,33,47,178,36,110,146,41,206,226,48,91,115,59,36,52,74,
+51,85,93,133,6,116,0,184,151,205,202,189,165,44,211,146,29,221,251,125,225,42,110,227,
+63,78,228,72,174,228,74,174,228,72,78,228,63,110,227,42,126,225,251,29,221,146,45,211,
+165,204,189,205,186,151,0,88,104,51,69,66,91,227,44,110,242,34,5,146,30,214,161,28,
+193,193,27,184,97,27,182,97,27,184,193,27,193,161,28,214,145,30,5,242,34,110,226,44,
+91,67,66,51,85,104,0,24,172,172,140,217,244,125,226,70,142,228,67,142,228,70,126,226,
+244,141,217,172,28,172,0,248,83,84,131,38,12,146,29,186,129,27,189,129,27,186,145,29,
+12,130,38,84,243,83,0,216,195,85,46,229,247,45,229,85,222,195,0,56,60,171,225,26,
+9,226,26,171,49,60,0,120,212,118,127,212,0,152,43,138,144,43,0,104,247,0,168,8,
+0,216,133,186,88,145,111,105,156,26,186,166,184,26,176,70,123,184,196,203,191,49,28,198,
+142,124,203,221,252,207,30,189,211,85,205,214,130,93,217,167,125,219,197,45,221,222,157,222,
+243,189,223,3,190,224,17,126,225,28,30,226,38,174,226,45,30,227,52,110,227,57,190,227,
+61,254,227,64,46,228,67,78,228,70,110,228,71,142,228,73,158,228,73,174,228,74,174,228,
+74,174,228,74,174,228,73,158,228,73,142,228,71,110,228,70,78,228,67,46,228,64,254,227,
+61,190,227,57,110,227,52,30,227,45,174,226,38,30,226,28,126,225,17,190,224,3,190,223,
+243,157,222,222,45,221,197,125,219,167,93,217,130,205,214,85,189,211,30,253,207,221,124,203,
+142,28,198,49,204,191,196,123,184,70,27,176,184,186,166,26,106,156,111,89,145,186,216,133,
+0,56,122,70,183,110,145,166,99,230,85,89,72,245,79,186,148,71,60,68,64,207,243,57,
+114,147,52,35,19,48,226,82,44,171,66,41,126,178,38,89,146,36,59,226,34,34,114,33,
+13,82,32,253,81,31,239,145,30,228,241,29,218,97,29,211,241,28,204,161,28,199,81,28,
+195,17,28,192,225,27,189,193,27,186,161,27,185,129,27,183,113,27,183,97,27,182,97,27,
+182,97,27,182,97,27,183,113,27,183,129,27,185,161,27,186,193,27,189,225,27,192,17,28,
+195,81,28,199,161,28,204,241,28,211,97,29,218,241,29,228,145,30,239,81,31,253,81,32,
+13,114,33,34,226,34,59,146,36,89,178,38,126,66,41,171,82,44,226,18,48,35,147,52,
+114,243,57,207,67,64,60,148,71,186,244,79,72,85,89,230,165,99,145,182,110,70,55,122,
+0,168,139,111,169,161,184,106,180,196,27,195,142,220,205,30,93,213,130,125,218,197,237,221,
+243,61,224,17,206,225,38,222,226,52,158,227,61,14,228,67,110,228,71,158,228,73,174,228,
+74,174,228,73,158,228,71,110,228,67,14,228,61,158,227,52,222,226,38,206,225,17,62,224,
+243,237,221,197,125,218,130,93,213,30,221,205,142,28,195,196,107,180,184,170,161,111,169,139,
+0,104,116,145,102,94,72,165,75,60,244,60,114,51,50,226,178,42,126,146,37,59,34,34,
+13,210,31,239,65,30,218,49,29,204,113,28,195,1,28,189,161,27,185,113,27,183,97,27,
+182,97,27,183,113,27,185,161,27,189,1,28,195,113,28,204,49,29,218,65,30,239,209,31,
+13,34,34,59,146,37,126,178,42,226,50,50,114,243,60,60,164,75,72,101,94,145,102,116,
+0,248,150,184,74,188,142,236,209,130,93,220,243,29,225,38,78,227,61,62,228,71,158,228,
+74,158,228,71,62,228,61,78,227,38,30,225,243,93,220,130,237,209,142,76,188,184,250,150,
+0,24,105,72,197,67,114,35,46,126,178,35,13,242,30,218,193,28,195,209,27,185,113,27,
+182,113,27,185,209,27,195,193,28,218,241,30,13,178,35,126,34,46,114,195,67,72,21,105,
+0,232,170,148,124,216,236,61,226,67,142,228,68,142,228,67,62,226,236,125,216,148,236,170,
+0,40,85,108,147,39,20,210,29,189,129,27,188,129,27,189,209,29,20,146,39,108,35,85,
+0,216,194,70,14,229,252,13,229,70,222,194,0,56,61,186,1,27,4,2,27,186,49,61,
+0,24,212,110,31,212,0,248,43,146,240,43,0,232,246,0,40,9,0,168,133,180,200,144,
+99,137,155,10,154,165,164,202,174,48,11,183,172,91,190,25,172,196,119,28,202,199,172,206,
+10,141,210,67,189,213,114,109,216,153,173,218,185,125,220,211,253,221,233,61,223,252,61,224,
+11,30,225,23,206,225,33,110,226,42,222,226,49,78,227,55,158,227,59,222,227,63,30,228,
+66,78,228,69,110,228,71,142,228,72,158,228,73,174,228,74,174,228,74,174,228,74,174,228,
+73,158,228,72,142,228,71,110,228,69,78,228,66,30,228,63,222,227,59,158,227,55,78,227,
+49,222,226,42,110,226,33,206,225,23,30,225,11,62,224,252,61,223,233,253,221,211,125,220,
+185,173,218,153,109,216,114,189,213,67,141,210,10,173,206,199,28,202,119,172,196,25,92,190,
+172,11,183,48,203,174,164,154,165,10,138,155,99,201,144,180,168,133,0,104,122,76,71,111,
+157,134,100,246,117,90,92,69,81,208,4,73,84,180,65,231,99,59,137,243,53,57,99,49,
+246,130,45,189,82,42,142,162,39,103,98,37,71,146,35,45,18,34,23,210,32,4,210,31,
+245,241,30,233,65,30,223,161,29,214,49,29,207,193,28,201,113,28,197,49,28,193,241,27,
+190,193,27,187,161,27,185,129,27,184,113,27,183,97,27,182,97,27,182,97,27,182,97,27,
+183,113,27,184,129,27,185,161,27,187,193,27,190,241,27,193,49,28,197,113,28,201,193,28,
+207,49,29,214,161,29,223,65,30,233,241,30,245,209,31,4,210,32,23,18,34,45,146,35,
+71,98,37,103,162,39,142,82,42,189,130,45,246,98,49,57,243,53,137,99,59,231,179,65,
+84,4,73,208,68,81,92,117,90,246,133,100,157,70,111,76,103,122,0,72,139,99,169,160,
+164,10,179,172,155,193,119,124,204,10,61,212,114,157,217,185,61,221,233,205,223,11,126,225,
+33,174,226,49,126,227,59,254,227,66,94,228,71,142,228,73,174,228,74,174,228,73,142,228,
+71,94,228,66,254,227,59,126,227,49,174,226,33,126,225,11,206,223,233,61,221,185,157,217,
+114,61,212,10,125,204,119,156,193,172,11,179,164,170,160,99,73,139,0,200,116,157,102,95,
+92,5,77,84,116,62,137,147,51,246,210,43,142,114,38,71,210,34,23,66,32,245,145,30,
+223,97,29,207,145,28,197,17,28,190,177,27,185,129,27,183,97,27,182,97,27,183,129,27,
+185,177,27,190,17,28,197,145,28,207,97,29,223,145,30,245,65,32,23,210,34,71,114,38,
+142,210,43,246,146,51,137,115,62,84,4,77,92,101,95,157,198,116,0,56,150,164,218,186,
+119,172,208,114,157,219,233,189,224,33,30,227,59,46,228,71,158,228,74,158,228,71,46,228,
+59,30,227,33,190,224,233,157,219,114,173,208,119,220,186,164,58,150,0,216,105,92,53,69,
+137,99,47,142,114,36,23,82,31,223,241,28,197,225,27,185,113,27,182,113,27,185,225,27,
+197,241,28,223,81,31,23,114,36,142,98,47,137,51,69,92,213,105,0,200,169,124,108,215,
+228,253,225,65,126,228,69,126,228,65,254,225,228,109,215,124,204,169,0,72,86,132,163,40,
+28,18,30,191,145,27,187,145,27,191,17,30,28,162,40,132,67,86,0,216,193,54,222,228,
+2,222,228,54,222,193,0,56,62,202,49,27,254,49,27,202,49,62,0,184,211,101,191,211,
+0,88,44,155,80,44,0,88,246,0,184,9,0,120,133,174,72,144,88,169,154,250,121,164,
+145,122,173,26,171,181,150,235,188,2,60,195,96,188,200,177,92,205,246,92,209,48,173,212,
+97,125,215,138,205,217,172,189,219,200,93,221,224,173,222,244,205,223,4,190,224,17,126,225,
+29,30,226,38,174,226,46,30,227,52,126,227,57,206,227,62,14,228,65,62,228,68,94,228,
+70,126,228,72,158,228,73,174,228,74,174,228,74,174,228,74,174,228,73,158,228,72,126,228,
+70,94,228,68,62,228,65,14,228,62,206,227,57,126,227,52,30,227,46,174,226,38,30,226,
+29,126,225,17,190,224,4,206,223,244,173,222,224,93,221,200,189,219,172,205,217,138,125,215,
+97,173,212,48,93,209,246,92,205,177,188,200,96,60,195,2,236,188,150,171,181,26,123,173,
+145,122,164,250,169,154,88,73,144,174,120,133,0,152,122,82,199,111,168,102,101,6,150,91,
+111,149,82,230,100,74,106,36,67,254,211,60,160,83,55,79,179,50,10,179,46,208,98,43,
+159,146,40,118,66,38,84,82,36,56,178,34,32,98,33,12,66,32,252,81,31,239,145,30,
+227,241,29,218,97,29,210,241,28,204,145,28,199,65,28,194,1,28,191,209,27,188,177,27,
+186,145,27,184,113,27,183,97,27,182,97,27,182,97,27,182,97,27,183,113,27,184,145,27,
+186,177,27,188,209,27,191,1,28,194,65,28,199,145,28,204,241,28,210,97,29,218,241,29,
+227,145,30,239,81,31,252,65,32,12,98,33,32,178,34,56,82,36,84,66,38,118,146,40,
+159,98,43,208,178,46,10,179,50,79,83,55,160,211,60,254,35,67,106,100,74,230,148,82,
+111,149,91,6,102,101,168,198,111,82,151,122,0,232,138,88,169,159,145,170,177,150,43,192,
+96,28,203,246,12,211,97,173,216,172,141,220,224,77,223,4,30,225,29,110,226,46,78,227,
+57,238,227,65,78,228,70,142,228,73,174,228,74,174,228,73,142,228,70,78,228,65,238,227,
+57,78,227,46,110,226,29,30,225,4,78,223,224,141,220,172,173,216,97,13,211,246,28,203,
+96,44,192,150,171,177,145,170,159,88,233,138,0,40,117,168,102,96,111,101,78,106,228,63,
+160,243,52,10,3,45,159,98,39,84,130,35,32,194,32,252,241,30,227,161,29,210,193,28,
+199,33,28,191,193,27,186,129,27,183,97,27,182,97,27,183,129,27,186,193,27,191,33,28,
+199,193,28,210,161,29,227,241,30,252,193,32,32,130,35,84,98,39,159,2,45,10,243,52,
+160,227,63,106,100,78,111,101,96,168,38,117,0,136,149,145,106,185,96,108,207,97,205,218,
+224,77,224,29,238,226,57,30,228,70,158,228,74,158,228,70,30,228,57,238,226,29,78,224,
+224,205,218,97,109,207,96,108,185,145,138,149,0,136,106,111,165,70,160,163,48,159,66,37,
+32,194,31,227,33,29,199,241,27,186,113,27,182,113,27,186,241,27,199,33,29,227,193,31,
+32,66,37,159,162,48,160,163,70,111,133,106,0,168,168,100,92,214,219,189,225,62,126,228,
+70,126,228,62,190,225,219,93,214,100,172,168,0,104,87,156,179,41,37,82,30,194,145,27,
+186,145,27,194,81,30,37,178,41,156,99,87,0,232,192,39,174,228,7,174,228,39,238,192,
+0,40,63,217,97,27,249,97,27,217,33,63,0,88,211,93,95,211,0,184,44,163,176,44,
+0,216,245,0,56,10,0,88,133,169,200,143,78,217,153,235,105,163,127,74,172,6,75,180,
+128,123,187,236,219,193,74,92,199,156,28,204,226,44,208,30,157,211,81,125,214,123,237,216,
+159,253,218,189,173,220,214,29,222,235,77,223,253,77,224,11,46,225,24,222,225,34,110,226,
+42,238,226,50,94,227,55,174,227,60,238,227,64,46,228,67,94,228,70,126,228,72,158,228,
+73,174,228,74,174,228,74,174,228,74,174,228,73,158,228,72,126,228,70,94,228,67,46,228,
+64,238,227,60,174,227,55,94,227,50,238,226,42,110,226,34,222,225,24,46,225,11,78,224,
+253,77,223,235,29,222,214,173,220,189,253,218,159,237,216,123,125,214,81,157,211,30,45,208,
+226,28,204,156,92,199,74,220,193,236,123,187,128,75,180,6,75,172,127,106,163,235,217,153,
+78,201,143,169,88,133,0,184,122,87,71,112,178,54,102,21,166,92,129,197,83,250,196,75,
+128,148,68,20,52,62,182,179,56,100,243,51,30,227,47,226,114,44,175,146,41,133,34,39,
+97,18,37,67,98,35,42,242,33,21,194,32,3,194,31,245,225,30,232,49,30,222,161,29,
+214,33,29,206,177,28,201,97,28,196,33,28,192,225,27,189,177,27,186,145,27,184,113,27,
+183,97,27,182,97,27,182,97,27,182,97,27,183,113,27,184,145,27,186,177,27,189,225,27,
+192,33,28,196,97,28,201,177,28,206,33,29,214,161,29,222,49,30,232,225,30,245,193,31,
+3,194,32,21,242,33,42,98,35,67,18,37,97,34,39,133,146,41,175,114,44,226,226,47,
+30,243,51,100,179,56,182,51,62,20,148,68,128,196,75,250,196,83,129,165,92,21,54,102,
+178,70,112,87,183,122,0,152,138,78,185,158,127,106,176,128,203,190,74,204,201,226,236,209,
+81,189,215,159,221,219,214,189,222,253,189,224,24,46,226,42,46,227,55,206,227,64,62,228,
+70,142,228,73,174,228,74,174,228,73,142,228,70,62,228,64,206,227,55,46,227,42,46,226,
+24,190,224,253,189,222,214,221,219,159,189,215,81,237,209,226,204,201,74,204,190,128,107,176,
+127,186,158,78,153,138,0,120,117,178,86,97,129,165,79,128,68,65,182,67,54,30,35,46,
+175,82,40,97,50,36,42,82,33,3,82,31,232,225,29,214,225,28,201,65,28,192,209,27,
+186,129,27,183,97,27,182,97,27,183,129,27,186,209,27,192,65,28,201,225,28,214,225,29,
+232,81,31,3,82,33,42,50,36,97,82,40,175,34,46,30,67,54,182,67,65,128,164,79,
+129,85,97,178,118,117,0,232,148,127,10,184,74,44,206,81,253,217,214,221,223,24,174,226,
+55,14,228,70,158,228,74,158,228,70,14,228,55,174,226,24,222,223,214,253,217,81,45,206,
+74,12,184,127,234,148,0,40,107,129,5,72,182,227,49,175,18,38,42,50,32,232,97,29,
+201,1,28,186,113,27,182,113,27,186,1,28,201,97,29,232,49,32,42,18,38,175,226,49,
+182,3,72,129,37,107,0,152,167,78,76,213,210,109,225,59,110,228,70,110,228,59,110,225,
+210,77,213,78,156,167,0,120,88,178,195,42,46,162,30,197,161,27,186,161,27,197,161,30,
+46,194,42,178,115,88,0,232,191,23,126,228,11,126,228,23,238,191,0,40,64,233,145,27,
+245,145,27,233,33,64,0,248,210,84,255,210,0,24,45,172,16,45,0,72,245,0,200,10,
+0,40,133,164,72,143,68,25,153,221,105,162,109,26,171,242,10,179,106,43,186,214,123,192,
+53,252,197,135,204,202,207,252,206,12,125,210,64,125,213,108,13,216,146,45,218,177,253,219,
+204,141,221,227,205,222,245,237,223,5,206,224,18,142,225,30,62,226,39,190,226,47,46,227,
+53,142,227,59,222,227,63,30,228,67,78,228,69,126,228,72,142,228,73,174,228,74,174,228,
+74,174,228,74,174,228,73,142,228,72,126,228,69,78,228,67,30,228,63,222,227,59,142,227,
+53,46,227,47,190,226,39,62,226,30,142,225,18,206,224,5,238,223,245,205,222,227,141,221,
+204,253,219,177,45,218,146,13,216,108,125,213,64,125,210,12,253,206,207,204,202,135,252,197,
+53,124,192,214,43,186,106,11,179,242,26,171,109,106,162,221,25,153,68,73,143,164,40,133,
+0,232,122,92,199,112,188,246,102,35,166,93,147,245,84,14,5,77,150,228,69,42,148,63,
+203,19,58,121,67,53,49,19,49,244,146,45,192,146,42,148,2,40,110,226,37,79,18,36,
+52,130,34,29,66,33,11,34,32,251,65,31,238,129,30,226,209,29,217,81,29,209,225,28,
+203,129,28,197,49,28,193,241,27,189,193,27,187,145,27,184,129,27,183,97,27,182,97,27,
+182,97,27,182,97,27,183,129,27,184,145,27,187,193,27,189,241,27,193,49,28,197,129,28,
+203,225,28,209,81,29,217,209,29,226,129,30,238,65,31,251,33,32,11,66,33,29,130,34,
+52,18,36,79,226,37,110,2,40,148,146,42,192,146,45,244,18,49,49,67,53,121,19,58,
+203,147,63,42,228,69,150,4,77,14,245,84,147,165,93,35,246,102,188,198,112,92,231,122,
+0,72,138,68,217,157,109,42,175,106,107,189,53,124,200,207,204,208,64,205,214,146,29,219,
+204,61,222,245,93,224,18,238,225,39,254,226,53,190,227,63,62,228,69,142,228,73,174,228,
+74,174,228,73,142,228,69,62,228,63,190,227,53,254,226,39,238,225,18,94,224,245,61,222,
+204,29,219,146,205,214,64,205,208,207,124,200,53,108,189,106,43,175,109,218,157,68,73,138,
+0,200,117,188,54,98,147,229,80,150,164,66,203,147,55,49,67,47,192,66,41,110,242,36,
+52,210,33,11,178,31,238,33,30,217,17,29,203,81,28,193,209,27,187,129,27,183,97,27,
+182,97,27,183,129,27,187,209,27,193,81,28,203,17,29,217,33,30,238,177,31,11,210,33,
+52,242,36,110,66,41,192,66,47,49,147,55,203,163,66,150,228,80,147,53,98,188,198,117,
+0,72,148,109,170,182,53,252,204,64,45,217,204,93,223,18,126,226,53,254,227,69,158,228,
+74,158,228,69,254,227,53,126,226,18,94,223,204,45,217,64,253,204,53,172,182,109,74,148,
+0,200,107,147,101,73,203,19,51,192,226,38,52,178,32,238,145,29,203,17,28,187,113,27,
+182,113,27,187,17,28,203,145,29,238,177,32,52,226,38,192,18,51,203,99,73,147,197,107,
+0,136,166,55,60,212,201,29,225,57,110,228,71,110,228,57,30,225,201,61,212,55,140,166,
+0,136,89,201,211,43,55,242,30,199,161,27,185,161,27,199,241,30,55,210,43,201,131,89,
+0,232,190,8,94,228,16,94,228,8,238,190,0,40,65,248,177,27,240,177,27,248,33,65,
+0,152,210,75,159,210,0,120,45,181,112,45,0,184,244,0,88,11,0,8,133,159,216,142,
+58,105,152,207,121,161,92,250,169,223,202,177,86,219,184,193,43,191,32,188,196,115,140,201,
+187,204,205,250,108,209,48,125,212,93,45,215,133,109,217,166,77,219,194,237,220,218,77,222,
+238,125,223,255,109,224,13,62,225,25,254,225,35,142,226,44,14,227,51,110,227,57,206,227,
+62,14,228,66,78,228,69,110,228,71,142,228,73,158,228,74,174,228,74,174,228,74,158,228,
+73,142,228,71,110,228,69,78,228,66,14,228,62,206,227,57,110,227,51,14,227,44,142,226,
+35,254,225,25,62,225,13,110,224,255,125,223,238,77,222,218,237,220,194,77,219,166,109,217,
+133,45,215,93,125,212,48,109,209,250,204,205,187,140,201,115,188,196,32,44,191,193,219,184,
+86,203,177,223,250,169,92,122,161,207,105,152,58,217,142,159,8,133,0,8,123,97,55,113,
+198,166,103,49,150,94,164,21,86,33,69,78,170,52,71,63,228,64,224,83,59,141,131,54,
+69,67,50,6,163,46,208,146,43,163,226,40,123,162,38,90,194,36,62,34,35,38,194,33,
+18,146,32,1,162,31,243,209,30,231,17,30,221,129,29,212,1,29,205,161,28,199,65,28,
+194,1,28,190,193,27,187,161,27,185,129,27,183,113,27,182,97,27,182,97,27,182,113,27,
+183,129,27,185,161,27,187,193,27,190,1,28,194,65,28,199,161,28,205,1,29,212,129,29,
+221,17,30,231,209,30,243,161,31,1,146,32,18,194,33,38,34,35,62,194,36,90,162,38,
+123,226,40,163,146,43,208,162,46,6,67,50,69,131,54,141,83,59,224,227,64,63,52,71,
+170,68,78,33,21,86,164,149,94,49,166,103,198,54,113,97,7,123,0,248,137,58,249,156,
+92,250,173,86,27,188,32,60,199,187,172,207,48,221,213,133,109,218,194,173,221,238,253,223,
+13,158,225,35,206,226,51,158,227,62,46,228,69,126,228,73,174,228,74,174,228,73,126,228,
+69,46,228,62,158,227,51,206,226,35,158,225,13,254,223,238,173,221,194,109,218,133,221,213,
+48,173,207,187,60,199,32,28,188,86,251,173,92,250,156,58,249,137,0,24,118,198,22,99,
+164,21,82,170,244,67,224,211,56,69,99,48,208,50,42,123,162,37,62,98,34,18,18,32,
+243,113,30,221,65,29,205,113,28,194,225,27,187,145,27,183,97,27,182,97,27,183,145,27,
+187,225,27,194,113,28,205,65,29,221,113,30,243,17,32,18,98,34,62,162,37,123,50,42,
+208,98,48,69,211,56,224,243,67,170,20,82,164,21,99,198,22,118,0,168,147,92,106,181,
+32,188,203,48,93,216,194,237,222,13,62,226,51,238,227,69,158,228,74,158,228,69,238,227,
+51,62,226,13,238,222,194,93,216,48,189,203,32,108,181,92,170,147,0,104,108,164,165,74,
+224,83,52,208,178,39,62,34,33,243,209,29,205,33,28,187,113,27,182,113,27,187,33,28,
+205,209,29,243,33,33,62,178,39,208,82,52,224,163,74,164,101,108,0,136,165,34,44,211,
+191,205,224,54,94,228,71,94,228,54,206,224,191,45,211,34,140,165,0,136,90,222,227,44,
+65,66,31,202,177,27,185,177,27,202,65,31,65,226,44,222,131,90,0,248,189,248,29,228,
+20,30,228,248,253,189,0,24,66,8,242,27,236,241,27,8,18,66,0,40,210,67,47,210,
+0,232,45,189,224,45,0,56,244,0,216,11,0,216,132,154,104,142,49,185,151,195,153,160,
+76,234,168,205,154,176,66,155,183,172,219,189,11,108,195,95,92,200,168,156,204,232,92,208,
+31,141,211,79,77,214,119,157,216,154,157,218,183,93,220,209,205,221,230,13,223,248,13,224,
+8,254,224,21,190,225,32,94,226,41,222,226,49,78,227,55,174,227,61,254,227,65,62,228,
+68,110,228,71,142,228,73,158,228,74,174,228,74,174,228,74,158,228,73,142,228,71,110,228,
+68,62,228,65,254,227,61,174,227,55,78,227,49,222,226,41,94,226,32,190,225,21,254,224,
+8,14,224,248,13,223,230,205,221,209,93,220,183,157,218,154,157,216,119,77,214,79,141,211,
+31,93,208,232,156,204,168,92,200,95,108,195,11,220,189,172,155,183,66,155,176,205,234,168,
+76,154,160,195,185,151,49,105,142,154,216,132,0,56,123,102,167,113,207,86,104,61,118,95,
+180,37,87,51,117,79,190,116,72,84,52,66,245,163,60,161,179,55,88,115,51,24,179,47,
+225,130,44,177,194,41,137,114,39,102,114,37,73,178,35,47,66,34,26,2,33,8,2,32,
+248,17,31,235,81,30,224,177,29,215,49,29,207,193,28,201,97,28,195,17,28,191,209,27,
+188,161,27,185,129,27,183,113,27,182,97,27,182,97,27,182,113,27,183,129,27,185,161,27,
+188,209,27,191,17,28,195,97,28,201,193,28,207,49,29,215,177,29,224,81,30,235,17,31,
+248,1,32,8,2,33,26,66,34,47,178,35,73,114,37,102,114,39,137,194,41,177,130,44,
+225,178,47,24,115,51,88,179,55,161,163,60,245,51,66,84,116,72,190,116,79,51,37,87,
+180,117,95,61,86,104,207,166,113,102,55,123,0,168,137,49,57,156,76,218,172,66,203,186,
+11,252,197,168,140,206,31,253,212,119,173,217,183,29,221,230,141,223,8,94,225,32,158,226,
+49,126,227,61,30,228,68,126,228,73,174,228,74,174,228,73,126,228,68,30,228,61,126,227,
+49,158,226,32,94,225,8,142,223,230,29,221,183,173,217,119,253,212,31,141,206,168,252,197,
+11,204,186,66,219,172,76,58,156,49,169,137,0,104,118,207,214,99,180,53,83,190,68,69,
+245,19,58,88,131,49,225,18,43,137,98,38,73,242,34,26,130,32,248,177,30,224,113,29,
+207,145,28,195,241,27,188,145,27,183,97,27,182,97,27,183,145,27,188,241,27,195,145,28,
+207,113,29,224,177,30,248,129,32,26,242,34,73,98,38,137,18,43,225,130,49,88,19,58,
+245,67,69,190,52,83,180,213,99,207,102,118,0,24,147,76,42,180,11,140,202,31,125,215,
+183,109,222,8,14,226,49,222,227,68,158,228,74,158,228,68,222,227,49,14,226,8,110,222,
+183,125,215,31,141,202,11,44,180,76,26,147,0,248,108,180,229,75,245,131,53,225,146,40,
+73,162,33,248,1,30,207,49,28,188,113,27,182,113,27,188,49,28,207,1,30,248,161,33,
+73,146,40,225,130,53,245,227,75,180,245,108,0,152,164,13,28,210,181,125,224,51,94,228,
+72,94,228,51,126,224,181,29,210,13,156,164,0,120,91,243,243,45,75,146,31,205,177,27,
+184,177,27,205,145,31,75,242,45,243,115,91,0,8,189,233,237,227,24,238,227,233,13,189,
+0,8,67,23,34,28,232,33,28,23,2,67,0,200,209,58,207,209,0,72,46,198,64,46,
+0,168,243,0,104,12,0,184,132,150,8,142,41,9,151,183,185,159,61,234,167,187,122,175,
+47,91,182,153,155,188,247,59,194,75,44,199,149,124,203,214,76,207,15,141,210,64,93,213,
+106,221,215,142,237,217,173,189,219,200,61,221,222,141,222,242,173,223,2,158,224,16,110,225,
+28,30,226,38,190,226,47,46,227,54,158,227,59,238,227,64,46,228,68,94,228,71,142,228,
+73,158,228,74,174,228,74,174,228,74,158,228,73,142,228,71,94,228,68,46,228,64,238,227,
+59,158,227,54,46,227,47,190,226,38,30,226,28,110,225,16,158,224,2,174,223,242,141,222,
+222,61,221,200,189,219,173,237,217,142,221,215,106,93,213,64,141,210,15,77,207,214,124,203,
+149,44,199,75,60,194,247,155,188,153,91,182,47,123,175,187,234,167,61,186,159,183,9,151,
+41,9,142,150,184,132,0,88,123,106,7,114,215,6,105,73,86,96,195,37,88,69,149,80,
+209,180,73,103,116,67,9,212,61,181,227,56,107,147,52,42,195,48,241,130,45,192,178,42,
+150,50,40,114,34,38,83,82,36,56,210,34,34,130,33,14,98,32,254,113,31,240,161,30,
+228,241,29,218,81,29,209,225,28,202,113,28,197,33,28,192,225,27,188,177,27,185,129,27,
+183,113,27,182,97,27,182,97,27,182,113,27,183,129,27,185,177,27,188,225,27,192,33,28,
+197,113,28,202,225,28,209,81,29,218,241,29,228,161,30,240,113,31,254,97,32,14,130,33,
+34,210,34,56,82,36,83,34,38,114,50,40,150,178,42,192,130,45,241,194,48,42,147,52,
+107,227,56,181,211,61,9,116,67,103,180,73,209,148,80,69,37,88,195,85,96,73,6,105,
+215,6,114,106,87,123,0,104,137,41,121,155,61,186,171,47,155,185,247,187,196,149,108,205,
+15,13,212,106,237,216,173,141,220,222,45,223,2,14,225,28,110,226,47,110,227,59,14,228,
+68,126,228,73,174,228,74,174,228,73,126,228,68,14,228,59,110,227,47,110,226,28,14,225,
+2,46,223,222,141,220,173,237,216,106,13,212,15,109,205,149,188,196,247,155,185,47,187,171,
+61,122,155,41,105,137,0,168,118,215,150,100,195,85,84,209,116,70,9,84,59,107,163,50,
+241,2,44,150,34,39,83,130,35,34,226,32,254,1,31,228,161,29,209,161,28,197,1,28,
+188,145,27,183,97,27,182,97,27,183,145,27,188,1,28,197,161,28,209,161,29,228,1,31,
+254,225,32,34,130,35,83,34,39,150,2,44,241,162,50,107,83,59,9,116,70,209,84,84,
+195,149,100,215,166,118,0,152,146,61,250,178,247,91,201,15,173,214,173,237,221,2,206,225,
+47,190,227,68,158,228,74,158,228,68,190,227,47,206,225,2,238,221,173,173,214,15,93,201,
+247,251,178,61,154,146,0,120,109,195,21,77,9,180,54,241,98,41,83,34,34,254,65,30,
+209,81,28,188,113,27,182,113,27,188,81,28,209,65,30,254,33,34,83,98,41,241,178,54,
+9,20,77,195,117,109,0,184,163,249,27,209,171,29,224,49,78,228,72,78,228,49,30,224,
+171,29,209,249,187,163,0,88,92,7,244,46,85,242,31,207,193,27,184,193,27,207,241,31,
+85,242,46,7,84,92,0,24,188,218,189,227,28,190,227,218,29,188,0,248,67,38,82,28,
+228,81,28,38,242,67,0,104,209,50,111,209,0,168,46,206,160,46,0,40,243,0,232,12,
+0,152,132,146,168,141,33,121,150,171,233,158,47,234,166,171,90,174,29,59,181,134,107,187,
+228,251,192,56,252,197,131,92,202,197,60,206,255,156,209,49,125,212,92,13,215,130,61,217,
+163,29,219,190,189,220,214,29,222,235,77,223,252,77,224,11,46,225,24,238,225,35,142,226,
+44,14,227,52,126,227,58,222,227,63,30,228,67,94,228,70,142,228,72,158,228,74,174,228,
+74,174,228,74,158,228,72,142,228,70,94,228,67,30,228,63,222,227,58,126,227,52,14,227,
+44,142,226,35,238,225,24,46,225,11,78,224,252,77,223,235,29,222,214,189,220,190,29,219,
+163,61,217,130,13,215,92,125,212,49,157,209,255,60,206,197,92,202,131,252,197,56,252,192,
+228,107,187,134,59,181,29,91,174,171,234,166,47,234,158,171,121,150,33,169,141,146,152,132,
+0,120,123,110,103,114,223,150,105,85,38,97,209,37,89,85,181,81,227,212,74,122,164,68,
+28,20,63,200,19,58,125,179,53,59,211,49,1,115,46,207,146,43,164,2,41,126,210,38,
+93,242,36,66,82,35,42,242,33,21,194,32,4,194,31,245,225,30,232,33,30,221,129,29,
+212,1,29,204,145,28,198,49,28,193,241,27,189,177,27,186,129,27,184,113,27,182,97,27,
+182,97,27,182,113,27,184,129,27,186,177,27,189,241,27,193,49,28,198,145,28,204,1,29,
+212,129,29,221,33,30,232,225,30,245,193,31,4,194,32,21,242,33,42,82,35,66,242,36,
+93,210,38,126,2,41,164,146,43,207,114,46,1,211,49,59,179,53,125,19,58,200,19,63,
+28,164,68,122,212,74,227,180,81,85,37,89,209,37,97,85,150,105,223,102,114,110,119,123,
+0,40,137,33,185,154,47,186,170,29,107,184,228,139,195,131,92,204,255,28,211,92,45,216,
+163,237,219,214,189,222,252,189,224,24,62,226,44,78,227,58,254,227,67,110,228,72,174,228,
+74,174,228,72,110,228,67,254,227,58,78,227,44,62,226,24,190,224,252,189,222,214,237,219,
+163,45,216,92,29,211,255,92,204,131,140,195,228,107,184,29,187,170,47,186,154,33,41,137,
+0,232,118,223,86,101,209,85,85,227,164,71,28,132,60,125,179,51,1,243,44,164,226,39,
+93,34,36,42,82,33,4,82,31,232,209,29,212,193,28,198,17,28,189,161,27,184,97,27,
+182,97,27,184,161,27,189,17,28,198,193,28,212,209,29,232,81,31,4,82,33,42,34,36,
+93,226,39,164,242,44,1,179,51,125,131,60,28,164,71,227,84,85,209,85,101,223,230,118,
+0,24,146,47,218,177,228,59,200,255,204,213,163,109,221,252,141,225,44,174,227,67,142,228,
+74,142,228,67,174,227,44,142,225,252,109,221,163,205,213,255,60,200,228,219,177,47,26,146,
+0,248,109,209,53,78,28,212,55,1,67,42,93,162,34,4,130,30,212,97,28,189,129,27,
+182,129,27,189,97,28,212,129,30,4,162,34,93,66,42,1,211,55,28,52,78,209,245,109,
+0,216,162,229,11,208,161,205,223,46,62,228,73,62,228,46,206,223,161,13,208,229,219,162,
+0,56,93,27,4,48,95,66,32,210,209,27,183,209,27,210,65,32,95,2,48,27,52,93,
+0,56,187,204,141,227,32,142,227,204,61,187,0,216,68,52,130,28,224,129,28,52,210,68,
+0,8,209,41,15,209,0,8,47,215,0,47,0,152,242,0,120,13,0,120,132,142,72,141,
+25,233,149,161,41,158,34,10,166,155,90,173,12,27,180,116,75,186,210,219,191,38,220,196,
+114,76,201,180,60,205,239,172,208,34,173,211,79,77,214,118,141,216,152,125,218,181,45,220,
+206,173,221,228,237,222,247,253,223,7,238,224,20,174,225,32,94,226,42,238,226,50,110,227,
+57,206,227,62,30,228,67,78,228,70,126,228,72,158,228,74,174,228,74,174,228,74,158,228,
+72,126,228,70,78,228,67,30,228,62,206,227,57,110,227,50,238,226,42,94,226,32,174,225,
+20,238,224,7,254,223,247,237,222,228,173,221,206,45,220,181,125,218,152,141,216,118,77,214,
+79,173,211,34,173,208,239,60,205,180,76,201,114,220,196,38,220,191,210,75,186,116,27,180,
+12,91,173,155,10,166,34,42,158,161,233,149,25,73,141,142,120,132,0,152,123,114,199,114,
+231,38,106,95,230,97,222,5,90,101,181,82,244,244,75,140,196,69,46,52,64,218,51,59,
+142,195,54,76,211,50,17,99,47,222,98,44,177,194,41,138,130,39,104,146,37,75,226,35,
+50,98,34,28,34,33,9,18,32,249,33,31,236,97,30,224,177,29,214,33,29,206,161,28,
+199,65,28,194,241,27,189,193,27,186,145,27,184,113,27,182,97,27,182,97,27,182,113,27,
+184,145,27,186,193,27,189,241,27,194,65,28,199,161,28,206,33,29,214,177,29,224,97,30,
+236,33,31,249,17,32,9,34,33,28,98,34,50,226,35,75,146,37,104,130,39,138,194,41,
+177,98,44,222,98,47,17,211,50,76,195,54,142,51,59,218,51,64,46,196,69,140,244,75,
+244,180,82,101,5,90,222,229,97,95,38,106,231,198,114,114,151,123,0,232,136,25,25,154,
+34,186,169,12,75,183,210,107,194,114,76,203,239,44,210,79,109,215,152,93,219,206,77,222,
+247,125,224,20,14,226,42,46,227,57,238,227,67,110,228,72,174,228,74,174,228,72,110,228,
+67,238,227,57,46,227,42,14,226,20,126,224,247,77,222,206,93,219,152,109,215,79,45,210,
+239,76,203,114,108,194,210,75,183,12,187,169,34,26,154,25,233,136,0,40,119,231,246,101,
+222,85,86,244,196,72,46,164,61,142,195,52,17,227,45,177,162,40,104,178,36,50,194,33,
+9,146,31,236,1,30,214,225,28,199,33,28,189,161,27,184,97,27,182,97,27,184,161,27,
+189,33,28,199,225,28,214,1,30,236,145,31,9,194,33,50,178,36,104,162,40,177,226,45,
+17,195,52,142,163,61,46,196,72,244,84,86,222,245,101,231,38,119,0,152,145,34,202,176,
+210,43,199,239,252,212,152,237,220,247,77,225,42,158,227,67,142,228,74,142,228,67,158,227,
+42,78,225,247,237,220,152,253,212,239,44,199,210,203,176,34,154,145,0,120,110,222,69,79,
+46,228,56,17,19,43,104,34,35,9,194,30,214,113,28,189,129,27,182,129,27,189,113,28,
+214,193,30,9,34,35,104,18,43,17,227,56,46,68,79,222,117,110,0,8,162,211,11,207,
+151,109,223,43,62,228,73,62,228,43,110,223,151,13,207,211,11,162,0,8,94,45,4,49,
+105,162,32,213,209,27,183,209,27,213,161,32,105,2,49,45,4,94,0,88,186,190,93,227,
+35,94,227,190,93,186,0,184,69,66,178,28,221,177,28,66,178,69,0,168,208,33,175,208,
+0,104,47,223,96,47,0,24,242,0,248,13,0,88,132,138,248,140,18,89,149,151,121,157,
+21,42,165,140,90,172,252,10,179,98,43,185,192,203,190,21,204,195,97,60,200,164,60,204,
+224,188,207,20,205,210,66,125,213,107,221,215,142,221,217,172,173,219,199,45,221,221,141,222,
+241,173,223,2,158,224,16,126,225,29,46,226,39,206,226,48,78,227,55,190,227,61,14,228,
+66,78,228,70,126,228,72,158,228,74,174,228,74,174,228,74,158,228,72,126,228,70,78,228,
+66,14,228,61,190,227,55,78,227,48,206,226,39,46,226,29,126,225,16,158,224,2,174,223,
+241,141,222,221,45,221,199,173,219,172,221,217,142,221,215,107,125,213,66,205,210,20,189,207,
+224,60,204,164,60,200,97,204,195,21,204,190,192,43,185,98,11,179,252,90,172,140,42,165,
+21,122,157,151,89,149,18,249,140,138,88,132,0,184,123,118,23,115,238,182,106,105,150,98,
+235,229,90,116,181,83,4,5,77,158,228,70,64,68,65,235,67,60,159,211,55,92,211,51,
+32,83,48,236,66,45,190,146,42,149,50,40,114,50,38,84,98,36,57,226,34,35,130,33,
+15,98,32,254,113,31,240,145,30,227,225,29,217,65,29,208,193,28,201,81,28,195,1,28,
+190,193,27,186,145,27,184,113,27,182,97,27,182,97,27,182,113,27,184,145,27,186,193,27,
+190,1,28,195,81,28,201,193,28,208,65,29,217,225,29,227,145,30,240,113,31,254,97,32,
+15,130,33,35,226,34,57,98,36,84,50,38,114,50,40,149,146,42,190,66,45,236,82,48,
+32,211,51,92,211,55,159,67,60,235,67,65,64,228,70,158,4,77,4,181,83,116,229,90,
+235,149,98,105,182,106,238,22,115,118,183,123,0,168,136,18,121,153,21,202,168,252,42,182,
+192,91,193,97,76,202,224,76,209,66,189,214,142,205,218,199,221,221,241,45,224,16,222,225,
+39,14,227,55,222,227,66,110,228,72,174,228,74,174,228,72,110,228,66,222,227,55,14,227,
+39,222,225,16,46,224,241,221,221,199,205,218,142,189,214,66,77,209,224,76,202,97,92,193,
+192,43,182,252,202,168,21,122,153,18,169,136,0,104,119,238,150,102,235,69,87,4,229,73,
+64,180,62,159,195,53,32,195,46,190,82,41,114,66,37,57,50,34,15,226,31,240,49,30,
+217,1,29,201,49,28,190,161,27,184,97,27,182,97,27,184,161,27,190,49,28,201,1,29,
+217,49,30,240,225,31,15,50,34,57,66,37,114,82,41,190,194,46,32,195,53,159,179,62,
+64,228,73,4,69,87,235,149,102,238,102,119,0,40,145,21,202,175,192,27,198,224,44,212,
+142,125,220,241,13,225,39,126,227,66,142,228,74,142,228,66,126,227,39,14,225,241,125,220,
+142,45,212,224,28,198,192,203,175,21,42,145,0,232,110,235,69,80,64,244,57,32,227,43,
+114,146,35,15,2,31,217,145,28,190,129,27,182,129,27,190,145,28,217,1,31,15,146,35,
+114,226,43,32,243,57,64,68,80,235,229,110,0,56,161,193,27,206,141,13,223,40,46,228,
+73,46,228,40,14,223,141,29,206,193,59,161,0,216,94,63,244,49,115,2,33,216,225,27,
+183,225,27,216,1,33,115,242,49,63,212,94,0,120,185,176,45,227,38,46,227,176,125,185,
+0,152,70,80,226,28,218,225,28,80,146,70,0,88,208,25,95,208,0,184,47,231,176,47,
+0,152,241,0,120,14,0,72,132,135,168,140,12,217,148,141,201,156,9,90,164,127,122,171,
+236,10,178,82,43,184,175,187,189,4,188,194,80,60,199,148,76,203,209,220,206,7,253,209,
+54,189,212,95,45,215,131,77,217,163,29,219,191,189,220,215,29,222,235,93,223,253,93,224,
+12,62,225,26,254,225,37,174,226,46,46,227,54,158,227,60,254,227,65,78,228,69,126,228,
+72,158,228,74,174,228,74,174,228,74,158,228,72,126,228,69,78,228,65,254,227,60,158,227,
+54,46,227,46,174,226,37,254,225,26,62,225,12,94,224,253,93,223,235,29,222,215,189,220,
+191,29,219,163,77,217,131,45,215,95,189,212,54,253,209,7,221,206,209,76,203,148,60,199,
+80,188,194,4,188,189,175,43,184,82,11,178,236,122,171,127,90,164,9,202,156,141,217,148,
+12,169,140,135,72,132,0,200,123,121,103,115,244,54,107,115,70,99,247,181,91,129,149,84,
+20,5,78,174,228,71,81,84,66,252,83,61,176,211,56,108,195,52,47,51,49,249,18,46,
+202,82,43,161,226,40,125,194,38,93,242,36,65,82,35,41,242,33,21,178,32,3,178,31,
+244,209,30,230,17,30,219,97,29,210,225,28,202,113,28,196,17,28,191,193,27,187,145,27,
+184,113,27,182,97,27,182,97,27,182,113,27,184,145,27,187,193,27,191,17,28,196,113,28,
+202,225,28,210,97,29,219,17,30,230,209,30,244,177,31,3,178,32,21,242,33,41,82,35,
+65,242,36,93,194,38,125,226,40,161,82,43,202,18,46,249,50,49,47,195,52,108,211,56,
+176,83,61,252,83,66,81,228,71,174,4,78,20,149,84,129,181,91,247,69,99,115,54,107,
+244,102,115,121,199,123,0,120,136,12,217,152,9,250,167,236,42,181,175,75,192,80,76,201,
+209,124,208,54,253,213,131,61,218,191,125,221,235,221,223,12,174,225,37,238,226,54,206,227,
+65,94,228,72,174,228,74,174,228,72,94,228,65,206,227,54,238,226,37,174,225,12,222,223,
+235,125,221,191,61,218,131,253,213,54,125,208,209,76,201,80,76,192,175,43,181,236,250,167,
+9,218,152,12,121,136,0,152,119,244,54,103,247,21,88,20,229,74,81,196,63,176,195,54,
+47,147,47,202,18,42,125,210,37,65,146,34,21,50,32,244,97,30,219,33,29,202,65,28,
+191,177,27,184,97,27,182,97,27,184,177,27,191,65,28,202,33,29,219,97,30,244,49,32,
+21,146,34,65,210,37,125,18,42,202,146,47,47,195,54,176,195,63,81,228,74,20,21,88,
+247,53,103,244,150,119,0,200,144,9,202,174,175,11,197,209,108,211,131,253,219,235,205,224,
+37,110,227,65,142,228,74,142,228,65,110,227,37,206,224,235,253,219,131,109,211,209,12,197,
+175,203,174,9,202,144,0,72,111,247,69,81,81,4,59,47,163,44,125,18,36,21,66,31,
+219,161,28,191,129,27,182,129,27,191,161,28,219,65,31,21,18,36,125,162,44,47,3,59,
+81,68,81,247,69,111,0,136,160,176,43,205,131,189,222,38,46,228,73,46,228,38,190,222,
+131,45,205,176,139,160,0,136,95,80,228,50,125,82,33,218,225,27,183,225,27,218,81,33,
+125,226,50,80,132,95,0,168,184,162,237,226,41,238,226,162,173,184,0,104,71,94,34,29,
+215,33,29,94,98,71,0,248,207,17,255,207,0,24,48,239,16,48,0,24,241,0,248,14,
+0,40,132,132,88,140,6,89,148,132,41,156,254,153,163,113,154,170,222,26,177,67,43,183,
+159,187,188,244,187,193,64,76,198,133,92,202,195,252,205,249,44,209,41,253,211,84,125,214,
+121,173,216,154,157,218,183,77,220,208,189,221,230,253,222,248,29,224,9,14,225,22,222,225,
+34,126,226,44,30,227,53,142,227,59,238,227,65,62,228,69,126,228,72,158,228,74,174,228,
+74,174,228,74,158,228,72,126,228,69,62,228,65,238,227,59,142,227,53,30,227,44,126,226,
+34,222,225,22,14,225,9,30,224,248,253,222,230,189,221,208,77,220,183,157,218,154,173,216,
+121,125,214,84,253,211,41,45,209,249,252,205,195,92,202,133,76,198,64,188,193,244,187,188,
+159,43,183,67,27,177,222,154,170,113,154,163,254,41,156,132,89,148,6,89,140,132,40,132,
+0,232,123,124,183,115,250,182,107,124,230,99,2,118,92,143,117,85,34,245,78,189,228,72,
+97,84,67,12,84,62,192,195,57,123,179,53,61,19,50,7,227,46,215,18,44,172,146,41,
+135,98,39,102,114,37,73,194,35,48,82,34,26,18,33,8,242,31,247,1,31,234,49,30,
+222,145,29,212,241,28,203,129,28,197,33,28,191,209,27,187,145,27,184,113,27,182,97,27,
+182,97,27,182,113,27,184,145,27,187,209,27,191,33,28,197,129,28,203,241,28,212,145,29,
+222,49,30,234,1,31,247,241,31,8,18,33,26,82,34,48,194,35,73,114,37,102,98,39,
+135,146,41,172,18,44,215,226,46,7,19,50,61,179,53,123,195,57,192,83,62,12,84,67,
+97,228,72,189,244,78,34,117,85,143,117,92,2,230,99,124,182,107,250,182,115,124,231,123,
+0,72,136,6,73,152,254,25,167,222,58,180,159,75,191,64,92,200,195,156,207,41,77,213,
+121,173,217,183,13,221,230,141,223,9,110,225,34,206,226,53,190,227,65,94,228,72,174,228,
+74,174,228,72,94,228,65,190,227,53,206,226,34,110,225,9,142,223,230,13,221,183,173,217,
+121,77,213,41,157,207,195,92,200,64,76,191,159,59,180,222,26,167,254,73,152,6,73,136,
+0,200,119,250,198,103,2,246,88,34,213,75,97,196,64,192,179,55,61,115,48,215,194,42,
+135,98,38,73,2,35,26,130,32,247,161,30,222,65,29,203,81,28,191,177,27,184,97,27,
+182,97,27,184,177,27,191,81,28,203,65,29,222,161,30,247,129,32,26,2,35,73,98,38,
+135,194,42,215,114,48,61,179,55,192,195,64,97,212,75,34,245,88,2,198,103,250,198,119,
+0,104,144,254,233,173,159,11,196,195,156,210,121,125,219,230,157,224,34,94,227,65,142,228,
+74,142,228,65,94,227,34,158,224,230,125,219,121,157,210,195,12,196,159,235,173,254,105,144,
+0,168,111,2,38,82,97,4,60,61,115,45,135,146,36,26,114,31,222,177,28,191,129,27,
+182,129,27,191,177,28,222,113,31,26,146,36,135,114,45,61,3,60,97,36,82,2,166,111,
+0,216,159,160,59,204,121,93,222,35,30,228,73,30,228,35,94,222,121,61,204,160,219,159,
+0,56,96,96,212,51,135,178,33,221,241,27,183,241,27,221,177,33,135,210,51,96,52,96,
+0,216,183,150,189,226,44,190,226,150,221,183,0,56,72,106,82,29,212,81,29,106,50,72,
+0,152,207,9,159,207,0,120,48,247,112,48,0,152,240,0,120,15,0,8,132,129,24,140,
+0,233,147,124,137,155,243,217,162,101,202,169,208,58,176,52,59,182,144,187,187,229,203,192,
+49,92,197,119,108,201,181,28,205,236,108,208,29,77,211,73,221,213,112,29,216,146,29,218,
+175,221,219,201,93,221,224,173,222,244,205,223,5,206,224,19,174,225,32,94,226,42,254,226,
+51,126,227,58,238,227,64,62,228,69,110,228,72,158,228,74,174,228,74,174,228,74,158,228,
+72,110,228,69,62,228,64,238,227,58,126,227,51,254,226,42,94,226,32,174,225,19,206,224,
+5,206,223,244,173,222,224,93,221,201,221,219,175,29,218,146,29,216,112,221,213,73,77,211,
+29,109,208,236,28,205,181,108,201,119,92,197,49,204,192,229,187,187,144,59,182,52,59,176,
+208,202,169,101,218,162,243,137,155,124,233,147,0,25,140,129,8,132,0,8,124,127,247,115,
+0,39,108,132,134,100,13,54,93,155,69,86,48,213,79,204,212,73,112,84,68,27,68,63,
+207,179,58,137,163,54,75,243,50,20,163,47,227,194,44,183,50,42,144,242,39,110,242,37,
+81,50,36,55,178,34,32,98,33,12,66,32,251,65,31,237,97,30,224,177,29,214,17,29,
+205,145,28,198,33,28,192,209,27,187,161,27,184,113,27,182,97,27,182,97,27,182,113,27,
+184,161,27,187,209,27,192,33,28,198,145,28,205,17,29,214,177,29,224,97,30,237,65,31,
+251,65,32,12,98,33,32,178,34,55,50,36,81,242,37,110,242,39,144,50,42,183,194,44,
+227,162,47,20,243,50,75,163,54,137,179,58,207,67,63,27,84,68,112,212,73,204,212,79,
+48,69,86,155,53,93,13,134,100,132,38,108,0,247,115,127,7,124,0,24,136,0,201,151,
+243,89,166,208,74,179,144,91,190,49,124,199,181,204,206,29,157,212,112,45,217,175,157,220,
+224,77,223,5,62,225,32,174,226,51,174,227,64,94,228,72,174,228,74,174,228,72,94,228,
+64,174,227,51,174,226,32,62,225,5,78,223,224,157,220,175,45,217,112,157,212,29,205,206,
+181,124,199,49,92,190,144,75,179,208,90,166,243,201,151,0,25,136,0,248,119,0,71,104,
+13,182,89,48,197,76,112,180,65,207,147,56,75,67,49,227,114,43,144,226,38,81,114,35,
+32,194,32,251,209,30,224,97,29,205,97,28,192,177,27,184,97,27,182,97,27,184,177,27,
+192,97,28,205,97,29,224,209,30,251,193,32,32,114,35,81,226,38,144,114,43,227,66,49,
+75,147,56,207,179,65,112,196,76,48,181,89,13,70,104,0,247,119,0,8,144,243,9,173,
+144,27,195,181,220,209,112,253,218,224,93,224,32,62,227,64,142,228,74,142,228,64,62,227,
+32,94,224,224,253,218,112,221,209,181,28,195,144,11,173,243,9,144,0,8,112,13,6,83,
+112,244,60,75,51,46,144,18,37,32,178,31,224,209,28,192,129,27,182,129,27,192,209,28,
+224,177,31,32,18,37,144,50,46,75,243,60,112,4,83,13,6,112,0,56,159,145,91,203,
+111,13,222,32,14,228,73,14,228,32,14,222,111,93,203,145,59,159,0,216,96,111,180,52,
+145,2,34,224,1,28,183,1,28,224,1,34,145,178,52,111,212,96,0,24,183,137,141,226,
+46,142,226,137,29,183,0,248,72,119,130,29,210,129,29,119,242,72,0,72,207,1,79,207,
+0,200,48,255,192,48,0,24,240,0,248,15,0,248,131,126,216,139,251,136,147,116,249,154,
+234,41,162,90,250,168,195,106,175,38,91,181,130,219,186,214,219,191,35,124,196,105,156,200,
+167,76,204,224,172,207,18,157,210,63,61,213,102,141,215,137,157,217,168,109,219,195,253,220,
+218,93,222,239,141,223,1,158,224,16,126,225,29,62,226,41,222,226,50,110,227,58,222,227,
+64,46,228,68,110,228,72,158,228,74,174,228,74,174,228,74,158,228,72,110,228,68,46,228,
+64,222,227,58,110,227,50,222,226,41,62,226,29,126,225,16,158,224,1,142,223,239,93,222,
+218,253,220,195,109,219,168,157,217,137,141,215,102,61,213,63,157,210,18,173,207,224,76,204,
+167,156,200,105,124,196,35,220,191,214,219,186,130,91,181,38,107,175,195,250,168,90,42,162,
+234,249,154,116,137,147,251,216,139,126,248,131,0,24,124,130,55,116,5,135,108,140,22,101,
+22,230,93,166,21,87,61,165,80,218,180,74,126,52,69,42,52,64,221,147,59,151,115,55,
+89,195,51,32,99,48,238,114,45,193,210,42,154,130,40,119,114,38,88,162,36,61,18,35,
+38,178,33,17,130,32,255,113,31,240,145,30,227,209,29,215,49,29,206,161,28,198,49,28,
+192,225,27,188,161,27,184,113,27,182,97,27,182,97,27,182,113,27,184,161,27,188,225,27,
+192,49,28,198,161,28,206,49,29,215,209,29,227,145,30,240,113,31,255,129,32,17,178,33,
+38,18,35,61,162,36,88,114,38,119,130,40,154,210,42,193,114,45,238,98,48,32,195,51,
+89,115,55,151,147,59,221,51,64,42,52,69,126,180,74,218,164,80,61,21,87,166,229,93,
+22,22,101,140,134,108,5,55,116,130,23,124,0,232,135,251,72,151,234,169,165,195,106,178,
+130,107,189,35,156,198,167,12,206,18,253,211,102,157,216,168,61,220,218,253,222,1,14,225,
+29,158,226,50,174,227,64,78,228,72,174,228,74,174,228,72,78,228,64,174,227,50,158,226,
+29,14,225,1,254,222,218,61,220,168,157,216,102,253,211,18,13,206,167,156,198,35,108,189,
+130,107,178,195,170,165,234,73,151,251,232,135,0,40,120,5,199,104,22,102,90,61,165,77,
+126,164,66,221,115,57,89,3,50,238,18,44,154,114,39,88,210,35,38,18,33,255,1,31,
+227,113,29,206,97,28,192,193,27,184,97,27,182,97,27,184,193,27,192,97,28,206,113,29,
+227,1,31,255,17,33,38,210,35,88,114,39,154,18,44,238,2,50,89,115,57,221,163,66,
+126,164,77,61,101,90,22,198,104,5,39,120,0,184,143,234,57,172,130,59,194,167,44,209,
+102,141,218,218,29,224,29,46,227,64,142,228,74,142,228,64,46,227,29,30,224,218,141,218,
+102,45,209,167,60,194,130,59,172,234,185,143,0,88,112,22,214,83,126,212,61,89,227,46,
+154,130,37,38,242,31,227,225,28,192,129,27,182,129,27,192,225,28,227,241,31,38,130,37,
+154,226,46,89,211,61,126,212,83,22,86,112,0,152,158,130,139,202,102,173,221,30,14,228,
+74,14,228,30,174,221,102,141,202,130,155,158,0,120,97,126,132,53,154,98,34,226,1,28,
+182,1,28,226,97,34,154,130,53,126,116,97,0,104,182,125,93,226,49,94,226,125,109,182,
+0,168,73,131,178,29,207,177,29,131,162,73,0,248,206,250,254,206,0,24,49,6,17,49,
+0,168,239,0,104,16,0,232,131,124,152,139,246,40,147,109,121,154,224,137,161,79,74,168,
+183,154,174,25,139,180,116,251,185,200,11,191,21,156,195,91,204,199,155,140,203,212,236,206,
+7,237,209,52,157,212,93,253,214,129,29,217,161,253,218,188,157,220,213,13,222,234,77,223,
+253,93,224,13,78,225,27,30,226,39,206,226,48,94,227,57,206,227,63,46,228,68,110,228,
+71,158,228,73,174,228,74,174,228,73,158,228,71,110,228,68,46,228,63,206,227,57,94,227,
+48,206,226,39,30,226,27,78,225,13,94,224,253,77,223,234,13,222,213,157,220,188,253,218,
+161,29,217,129,253,214,93,157,212,52,237,209,7,237,206,212,140,203,155,204,199,91,156,195,
+21,12,191,200,251,185,116,139,180,25,155,174,183,74,168,79,138,161,224,121,154,109,41,147,
+246,152,139,124,232,131,0,40,124,132,119,116,10,231,108,147,150,101,32,134,94,177,197,87,
+73,117,81,231,132,75,140,20,70,56,4,65,235,115,60,165,67,56,101,131,52,44,35,49,
+249,34,46,204,114,43,163,18,41,127,242,38,95,18,37,68,114,35,43,2,34,22,194,32,
+3,178,31,243,193,30,229,241,29,217,65,29,208,177,28,199,65,28,193,225,27,188,161,27,
+185,113,27,183,97,27,182,97,27,183,113,27,185,161,27,188,225,27,193,65,28,199,177,28,
+208,65,29,217,241,29,229,193,30,243,177,31,3,194,32,22,2,34,43,114,35,68,18,37,
+95,242,38,127,18,41,163,114,43,204,34,46,249,34,49,44,131,52,101,67,56,165,115,60,
+235,3,65,56,20,70,140,132,75,231,116,81,73,197,87,177,133,94,32,150,101,147,230,108,
+10,119,116,132,39,124,0,200,135,246,216,150,224,249,164,183,154,177,116,139,188,21,188,197,
+155,76,205,7,77,211,93,29,216,161,205,219,213,173,222,253,221,224,27,126,226,48,158,227,
+63,78,228,71,158,228,74,158,228,71,78,228,63,158,227,48,126,226,27,222,224,253,173,222,
+213,205,219,161,29,216,93,77,211,7,77,205,155,188,197,21,140,188,116,155,177,183,250,164,
+224,217,150,246,200,135,0,72,120,10,55,105,32,22,91,73,117,78,140,132,67,235,83,58,
+101,195,50,249,194,44,163,242,39,95,66,36,43,98,33,3,50,31,229,145,29,208,113,28,
+193,193,27,185,113,27,182,113,27,185,193,27,193,113,28,208,145,29,229,49,31,3,98,33,
+43,66,36,95,242,39,163,194,44,249,194,50,101,83,58,235,131,67,140,116,78,73,21,91,
+32,54,105,10,71,120,0,104,143,224,121,171,116,91,193,155,124,208,93,29,218,213,221,223,
+27,14,227,63,126,228,74,126,228,63,14,227,27,222,223,213,29,218,93,125,208,155,92,193,
+116,123,171,224,105,143,0,168,112,32,150,84,140,180,62,101,147,47,163,242,37,43,50,32,
+229,1,29,193,145,27,182,145,27,193,1,29,229,49,32,43,242,37,163,146,47,101,179,62,
+140,148,84,32,166,112,0,8,158,117,187,201,92,93,221,27,254,227,74,254,227,27,94,221,
+92,189,201,117,11,158,0,8,98,139,84,54,164,178,34,229,17,28,182,17,28,229,177,34,
+164,82,54,139,4,98,0,168,181,114,45,226,51,46,226,114,173,181,0,104,74,142,226,29,
+205,225,29,142,98,74,0,168,206,243,174,206,0,104,49,13,97,49,0,56,239,0,216,16,
+0,216,131,121,88,139,241,200,146,102,9,154,216,249,160,69,154,167,172,218,173,13,187,179,
+103,43,185,187,59,190,8,204,194,79,252,198,142,204,202,200,60,206,252,76,209,43,13,212,
+84,125,214,121,173,216,154,141,218,182,61,220,208,189,221,230,13,223,249,45,224,10,46,225,
+25,254,225,37,174,226,47,78,227,56,190,227,62,30,228,68,110,228,71,158,228,73,174,228,
+74,174,228,73,158,228,71,110,228,68,30,228,62,190,227,56,78,227,47,174,226,37,254,225,
+25,46,225,10,46,224,249,13,223,230,189,221,208,61,220,182,141,218,154,173,216,121,125,214,
+84,13,212,43,77,209,252,60,206,200,204,202,142,252,198,79,204,194,8,60,190,187,43,185,
+103,187,179,13,219,173,172,154,167,69,250,160,216,9,154,102,201,146,241,88,139,121,216,131,
+0,56,124,135,183,116,15,71,109,154,6,102,40,22,95,187,117,88,84,53,82,243,84,76,
+153,228,70,69,212,65,248,67,61,177,19,57,114,67,53,56,211,49,4,195,46,213,2,44,
+172,146,41,135,98,39,102,130,37,74,210,35,48,82,34,26,2,33,7,226,31,246,225,30,
+231,17,30,219,97,29,209,193,28,200,81,28,194,241,27,188,161,27,185,113,27,183,97,27,
+182,97,27,183,113,27,185,161,27,188,241,27,194,81,28,200,193,28,209,97,29,219,17,30,
+231,225,30,246,225,31,7,2,33,26,82,34,48,210,35,74,130,37,102,98,39,135,146,41,
+172,2,44,213,194,46,4,211,49,56,67,53,114,19,57,177,67,61,248,211,65,69,228,70,
+153,84,76,243,52,82,84,117,88,187,21,95,40,6,102,154,70,109,15,183,116,135,55,124,
+0,152,135,241,104,150,216,89,164,172,218,176,103,187,187,8,252,196,142,140,204,252,188,210,
+84,157,215,154,109,219,208,109,222,249,173,224,25,94,226,47,142,227,62,78,228,71,158,228,
+74,158,228,71,78,228,62,142,227,47,94,226,25,174,224,249,109,222,208,109,219,154,157,215,
+84,189,210,252,140,204,142,252,196,8,188,187,103,219,176,172,90,164,216,105,150,241,152,135,
+0,120,120,15,167,105,40,182,91,84,53,79,153,84,68,248,19,59,114,131,51,4,83,45,
+172,114,40,102,162,36,48,162,33,7,98,31,231,177,29,209,129,28,194,193,27,185,113,27,
+182,113,27,185,193,27,194,129,28,209,177,29,231,97,31,7,162,33,48,162,36,102,114,40,
+172,82,45,4,131,51,114,19,59,248,83,68,153,52,79,84,181,91,40,166,105,15,119,120,
+0,24,143,216,201,170,103,139,192,142,204,207,84,173,217,208,157,223,25,254,226,62,126,228,
+74,126,228,62,254,226,25,158,223,208,173,217,84,205,207,142,140,192,103,203,170,216,25,143,
+0,248,112,40,70,85,153,132,63,114,67,48,172,98,38,48,114,32,231,17,29,194,145,27,
+182,145,27,194,17,29,231,113,32,48,98,38,172,66,48,114,131,63,153,68,85,40,246,112,
+0,120,157,104,251,200,84,13,221,25,238,227,74,238,227,25,14,221,84,253,200,104,123,157,
+0,152,98,152,20,55,172,2,35,231,33,28,182,33,28,231,1,35,172,18,55,152,148,98,
+0,8,181,103,253,225,53,254,225,103,13,181,0,8,75,153,18,30,203,17,30,153,2,75,
+0,88,206,236,94,206,0,184,49,20,177,49,0,200,238,0,72,17,0,200,131,119,40,139,
+237,120,146,96,137,153,208,105,160,59,250,166,161,42,173,1,251,178,91,107,184,175,107,189,
+252,11,194,67,76,198,131,28,202,189,140,205,242,172,208,33,125,211,75,253,213,113,45,216,
+147,45,218,176,237,219,203,109,221,226,205,222,246,253,223,7,254,224,22,222,225,35,158,226,
+46,62,227,55,190,227,62,30,228,67,94,228,71,142,228,73,174,228,74,174,228,73,142,228,
+71,94,228,67,30,228,62,190,227,55,62,227,46,158,226,35,222,225,22,254,224,7,254,223,
+246,205,222,226,109,221,203,237,219,176,45,218,147,45,216,113,253,213,75,125,211,33,173,208,
+242,140,205,189,28,202,131,76,198,67,12,194,252,107,189,175,107,184,91,251,178,1,43,173,
+161,250,166,59,106,160,208,137,153,96,121,146,237,40,139,119,200,131,0,72,124,137,231,116,
+19,151,109,160,134,102,48,166,95,197,21,89,95,229,82,255,20,77,165,164,71,81,164,66,
+4,4,62,189,195,57,125,243,53,67,131,50,14,99,47,223,146,44,181,18,42,143,226,39,
+109,226,37,80,34,36,53,162,34,30,66,33,10,18,32,249,17,31,234,49,30,221,113,29,
+210,209,28,201,81,28,194,241,27,189,177,27,185,129,27,183,97,27,182,97,27,183,129,27,
+185,177,27,189,241,27,194,81,28,201,209,28,210,113,29,221,49,30,234,17,31,249,17,32,
+10,66,33,30,162,34,53,34,36,80,226,37,109,226,39,143,18,42,181,146,44,223,98,47,
+14,131,50,67,243,53,125,195,57,189,3,62,4,164,66,81,164,71,165,20,77,255,228,82,
+95,21,89,197,165,95,48,134,102,160,150,109,19,231,116,137,71,124,0,120,135,237,8,150,
+208,185,163,161,26,176,91,251,186,252,59,196,131,220,203,242,28,210,75,29,215,147,13,219,
+203,45,222,246,125,224,22,62,226,46,126,227,62,62,228,71,158,228,74,158,228,71,62,228,
+62,126,227,46,62,226,22,126,224,246,45,222,203,13,219,147,29,215,75,29,210,242,220,203,
+131,60,196,252,251,186,91,27,176,161,186,163,208,9,150,237,120,135,0,152,120,19,7,106,
+48,86,92,95,245,79,165,20,69,4,212,59,125,51,52,14,243,45,181,242,40,109,2,37,
+53,226,33,10,146,31,234,209,29,210,145,28,194,209,27,185,113,27,182,113,27,185,209,27,
+194,145,28,210,209,29,234,145,31,10,226,33,53,2,37,109,242,40,181,242,45,14,51,52,
+125,211,59,4,20,69,165,244,79,95,85,92,48,6,106,19,151,120,0,216,142,208,25,170,
+91,203,191,131,44,207,75,61,217,203,109,223,22,238,226,62,126,228,74,126,228,62,238,226,
+22,110,223,203,61,217,75,45,207,131,204,191,91,27,170,208,217,142,0,56,113,48,246,85,
+165,68,64,125,227,48,181,210,38,53,162,32,234,33,29,194,145,27,182,145,27,194,33,29,
+234,161,32,53,210,38,181,226,48,125,67,64,165,244,85,48,54,113,0,248,156,92,59,200,
+75,173,220,23,238,227,74,238,227,23,174,220,75,61,200,92,251,156,0,24,99,164,212,55,
+181,98,35,233,33,28,182,33,28,233,97,35,181,210,55,164,20,99,0,104,180,93,205,225,
+54,206,225,93,109,180,0,168,75,163,66,30,202,65,30,163,162,75,0,24,206,230,30,206,
+0,248,49,26,241,49,0,104,238,0,168,17,0,184,131,117,248,138,233,40,146,90,41,153,
+200,233,159,50,90,166,151,138,172,247,74,178,80,187,183,163,187,188,240,91,193,55,140,197,
+120,108,201,179,236,204,232,28,208,24,237,210,67,125,213,106,189,215,140,205,217,171,157,219,
+198,45,221,221,141,222,242,205,223,4,206,224,20,190,225,33,126,226,45,30,227,54,174,227,
+61,14,228,67,94,228,71,142,228,73,174,228,74,174,228,73,142,228,71,94,228,67,14,228,
+61,174,227,54,30,227,45,126,226,33,190,225,20,206,224,4,206,223,242,141,222,221,45,221,
+198,157,219,171,205,217,140,189,215,106,125,213,67,237,210,24,29,208,232,236,204,179,108,201,
+120,140,197,55,92,193,240,187,188,163,187,183,80,75,178,247,138,172,151,90,166,50,234,159,
+200,41,153,90,41,146,233,248,138,117,184,131,0,88,124,139,23,117,23,231,109,166,230,102,
+56,38,96,206,181,89,105,133,83,9,197,77,176,84,72,93,84,67,16,180,62,201,131,58,
+136,163,54,77,35,51,24,243,47,232,34,45,189,146,42,150,82,40,116,66,38,85,114,36,
+58,226,34,35,130,33,14,66,32,252,65,31,236,81,30,223,145,29,211,241,28,202,97,28,
+195,1,28,189,177,27,185,129,27,183,97,27,182,97,27,183,129,27,185,177,27,189,1,28,
+195,97,28,202,241,28,211,145,29,223,81,30,236,65,31,252,65,32,14,130,33,35,226,34,
+58,114,36,85,66,38,116,82,40,150,146,42,189,34,45,232,242,47,24,35,51,77,163,54,
+136,131,58,201,179,62,16,84,67,93,84,72,176,196,77,9,133,83,105,181,89,206,37,96,
+56,230,102,166,230,109,23,23,117,139,87,124,0,88,135,233,168,149,200,41,163,151,122,175,
+80,59,186,240,123,195,120,60,203,232,140,209,67,173,214,140,189,218,198,221,221,242,77,224,
+20,30,226,45,110,227,61,62,228,71,158,228,74,158,228,71,62,228,61,110,227,45,30,226,
+20,78,224,242,221,221,198,189,218,140,173,214,67,141,209,232,60,203,120,124,195,240,59,186,
+80,123,175,151,42,163,200,169,149,233,88,135,0,184,120,23,103,106,56,230,92,105,149,80,
+176,212,69,16,148,60,136,211,52,24,131,46,189,98,41,116,82,37,58,50,34,14,194,31,
+236,241,29,211,161,28,195,209,27,185,113,27,182,113,27,185,209,27,195,161,28,211,241,29,
+236,193,31,14,50,34,58,82,37,116,98,41,189,130,46,24,211,52,136,147,60,16,212,69,
+176,148,80,105,229,92,56,102,106,23,183,120,0,152,142,200,121,169,80,11,191,120,140,206,
+67,205,216,198,45,223,20,222,226,61,126,228,74,126,228,61,222,226,20,46,223,198,205,216,
+67,141,206,120,12,191,80,123,169,200,153,142,0,120,113,56,150,86,176,4,65,136,131,49,
+189,66,39,58,226,32,236,49,29,195,145,27,182,145,27,195,49,29,236,225,32,58,66,39,
+189,130,49,136,3,65,176,148,86,56,118,113,0,136,156,80,139,199,67,93,220,20,222,227,
+74,222,227,20,94,220,67,141,199,80,139,156,0,136,99,176,132,56,189,178,35,236,49,28,
+182,49,28,236,177,35,189,130,56,176,132,99,0,216,179,83,173,225,56,174,225,83,221,179,
+0,56,76,173,98,30,200,97,30,173,50,76,0,200,205,224,206,205,0,72,50,32,65,50,
+0,8,238,0,8,18,0,168,131,115,200,138,229,216,145,85,185,152,193,105,159,42,218,165,
+142,234,171,237,170,177,70,11,183,153,11,188,230,171,192,45,236,196,110,204,200,169,92,204,
+223,140,207,15,109,210,59,13,213,99,93,215,134,109,217,165,61,219,193,221,220,217,77,222,
+239,157,223,2,174,224,18,158,225,32,110,226,43,14,227,53,158,227,61,14,228,67,94,228,
+71,142,228,73,174,228,74,174,228,73,142,228,71,94,228,67,14,228,61,158,227,53,14,227,
+43,110,226,32,158,225,18,174,224,2,158,223,239,77,222,217,221,220,193,61,219,165,109,217,
+134,93,215,99,13,213,59,109,210,15,141,207,223,92,204,169,204,200,110,236,196,45,172,192,
+230,11,188,153,11,183,70,171,177,237,234,171,142,218,165,42,106,159,193,185,152,85,217,145,
+229,200,138,115,168,131,0,104,124,141,71,117,27,55,110,171,86,103,63,166,96,214,53,90,
+114,37,84,19,101,78,186,4,73,103,4,68,26,100,63,211,35,59,146,67,55,87,179,51,
+33,131,48,241,162,45,197,2,43,157,178,40,122,162,38,91,210,36,63,50,35,39,194,33,
+17,114,32,254,97,31,238,113,30,224,161,29,213,1,29,203,113,28,195,1,28,189,177,27,
+185,129,27,183,97,27,182,97,27,183,129,27,185,177,27,189,1,28,195,113,28,203,1,29,
+213,161,29,224,113,30,238,97,31,254,113,32,17,194,33,39,50,35,63,210,36,91,162,38,
+122,178,40,157,2,43,197,162,45,241,130,48,33,179,51,87,67,55,146,35,59,211,99,63,
+26,4,68,103,4,73,186,100,78,19,37,84,114,53,90,214,165,96,63,86,103,171,54,110,
+27,71,117,141,103,124,0,56,135,229,88,149,193,169,162,142,218,174,70,155,185,230,219,194,
+110,156,202,223,12,209,59,61,214,134,93,218,193,157,221,239,45,224,18,14,226,43,94,227,
+61,62,228,71,158,228,74,158,228,71,62,228,61,94,227,43,14,226,18,46,224,239,157,221,
+193,93,218,134,61,214,59,13,209,223,156,202,110,220,194,230,155,185,70,219,174,142,170,162,
+193,89,149,229,56,135,0,216,120,27,183,106,63,102,93,114,53,81,186,116,70,26,52,61,
+146,115,53,33,3,47,197,210,41,122,178,37,63,114,34,17,226,31,238,1,30,213,177,28,
+195,209,27,185,113,27,182,113,27,185,209,27,195,177,28,213,1,30,238,225,31,17,114,34,
+63,178,37,122,210,41,197,2,47,33,115,53,146,51,61,26,116,70,186,52,81,114,101,93,
+63,182,106,27,215,120,0,88,142,193,233,168,70,107,190,110,252,205,59,109,216,193,253,222,
+18,190,226,61,126,228,74,126,228,61,190,226,18,254,222,193,109,216,59,253,205,110,108,190,
+70,235,168,193,89,142,0,184,113,63,38,87,186,164,65,146,19,50,197,162,39,63,18,33,
+238,81,29,195,145,27,182,145,27,195,81,29,238,17,33,63,162,39,197,18,50,146,163,65,
+186,36,87,63,182,113,0,24,156,70,235,198,59,29,220,18,222,227,74,222,227,18,30,220,
+59,237,198,70,27,156,0,248,99,186,36,57,197,242,35,238,49,28,182,49,28,238,241,35,
+197,34,57,186,244,99,0,72,179,74,125,225,58,126,225,74,77,179,0,200,76,182,146,30,
+198,145,30,182,194,76,0,136,205,218,142,205,0,136,50,38,129,50,0,168,237,0,104,18,
+0,152,131,113,168,138,225,152,145,80,105,152,187,249,158,34,74,165,133,90,171,227,10,177,
+60,107,182,142,107,187,219,11,192,34,76,196,100,44,200,160,188,203,214,252,206,7,237,209,
+52,141,212,92,237,214,128,13,217,160,237,218,188,157,220,213,29,222,236,109,223,255,141,224,
+16,126,225,30,78,226,42,254,226,52,142,227,60,14,228,66,94,228,71,142,228,73,174,228,
+74,174,228,73,142,228,71,94,228,66,14,228,60,142,227,52,254,226,42,78,226,30,126,225,
+16,142,224,255,109,223,236,29,222,213,157,220,188,237,218,160,13,217,128,237,214,92,141,212,
+52,237,209,7,253,206,214,188,203,160,44,200,100,76,196,34,12,192,219,107,187,142,107,182,
+60,11,177,227,90,171,133,74,165,34,250,158,187,105,152,80,153,145,225,168,138,113,152,131,
+0,120,124,143,103,117,31,119,110,176,166,103,69,22,97,222,197,90,123,181,84,29,5,79,
+196,164,73,114,164,68,37,4,64,222,195,59,156,227,55,96,83,52,42,19,49,249,34,46,
+204,130,43,164,34,41,128,2,39,96,34,37,68,114,35,43,242,33,20,162,32,1,130,31,
+240,145,30,226,193,29,214,17,29,204,129,28,196,1,28,190,177,27,185,129,27,183,97,27,
+182,97,27,183,129,27,185,177,27,190,1,28,196,129,28,204,17,29,214,193,29,226,145,30,
+240,129,31,1,162,32,20,242,33,43,114,35,68,34,37,96,2,39,128,34,41,164,130,43,
+204,34,46,249,18,49,42,83,52,96,227,55,156,195,59,222,3,64,37,164,68,114,164,73,
+196,4,79,29,181,84,123,197,90,222,21,97,69,166,103,176,118,110,31,103,117,143,119,124,
+0,24,135,225,8,149,187,41,162,133,58,174,60,235,184,219,43,194,100,12,202,214,124,208,
+52,205,213,128,13,218,188,93,221,236,253,223,16,238,225,42,78,227,60,46,228,71,158,228,
+74,158,228,71,46,228,60,78,227,42,238,225,16,254,223,236,93,221,188,13,218,128,205,213,
+52,125,208,214,12,202,100,44,194,219,235,184,60,59,174,133,42,162,187,9,149,225,24,135,
+0,248,120,31,7,107,69,230,93,123,213,81,196,36,71,37,228,61,156,3,54,42,147,47,
+204,66,42,128,2,38,68,178,34,20,18,32,240,33,30,214,193,28,196,225,27,185,113,27,
+182,113,27,185,225,27,196,193,28,214,33,30,240,17,32,20,178,34,68,2,38,128,66,42,
+204,146,47,42,3,54,156,227,61,37,36,71,196,212,81,123,229,93,69,6,107,31,247,120,
+0,24,142,187,89,168,60,187,189,100,108,205,52,13,216,188,205,222,16,174,226,60,126,228,
+74,126,228,60,174,226,16,206,222,188,13,216,52,109,205,100,188,189,60,91,168,187,25,142,
+0,248,113,69,182,87,196,84,66,156,163,50,204,2,40,68,66,33,240,97,29,196,145,27,
+182,145,27,196,97,29,240,65,33,68,2,40,204,162,50,156,83,66,196,180,87,69,246,113,
+0,184,155,60,75,198,52,205,219,16,206,227,74,206,227,16,206,219,52,77,198,60,187,155,
+0,88,100,196,196,57,204,66,36,240,65,28,182,65,28,240,65,36,204,194,57,196,84,100,
+0,184,178,65,93,225,59,94,225,65,189,178,0,88,77,191,178,30,197,177,30,191,82,77,
+0,72,205,213,78,205,0,200,50,43,193,50,0,88,237,0,184,18,0,136,131,112,120,138,
+222,88,145,75,9,152,181,153,158,27,218,164,125,202,170,218,122,176,50,203,181,133,203,186,
+210,107,191,25,172,195,91,156,199,151,60,203,206,124,206,0,125,209,45,45,212,86,141,214,
+122,189,216,155,173,218,184,93,220,210,221,221,232,61,223,252,93,224,14,94,225,28,62,226,
+41,238,226,51,142,227,60,254,227,66,94,228,71,142,228,73,174,228,74,174,228,73,142,228,
+71,94,228,66,254,227,60,142,227,51,238,226,41,62,226,28,94,225,14,94,224,252,61,223,
+232,221,221,210,93,220,184,173,218,155,189,216,122,141,214,86,45,212,45,125,209,0,125,206,
+206,60,203,151,156,199,91,172,195,25,108,191,210,203,186,133,203,181,50,123,176,218,202,170,
+125,218,164,27,154,158,181,9,152,75,89,145,222,120,138,112,136,131,0,136,124,144,151,117,
+34,183,110,181,6,104,75,118,97,229,53,91,131,69,85,38,149,79,206,68,74,123,68,69,
+46,164,64,231,99,60,165,115,56,105,211,52,50,147,49,0,147,46,211,226,43,170,130,41,
+134,82,39,101,98,37,72,178,35,46,50,34,24,210,32,4,178,31,242,177,30,228,209,29,
+215,33,29,205,129,28,196,17,28,190,177,27,185,129,27,183,97,27,182,97,27,183,129,27,
+185,177,27,190,17,28,196,129,28,205,33,29,215,209,29,228,177,30,242,177,31,4,210,32,
+24,50,34,46,178,35,72,98,37,101,82,39,134,130,41,170,226,43,211,146,46,0,147,49,
+50,211,52,105,115,56,165,99,60,231,163,64,46,68,69,123,68,74,206,148,79,38,69,85,
+131,53,91,229,117,97,75,6,104,181,182,110,34,151,117,144,135,124,0,8,135,222,184,148,
+181,185,161,125,170,173,50,91,184,210,155,193,91,124,201,206,12,208,45,109,213,122,189,217,
+184,45,221,232,205,223,14,206,225,41,62,227,60,46,228,71,158,228,74,158,228,71,46,228,
+60,62,227,41,206,225,14,206,223,232,45,221,184,189,217,122,109,213,45,13,208,206,124,201,
+91,156,193,210,91,184,50,171,173,125,186,161,181,185,148,222,8,135,0,8,121,34,87,107,
+75,86,94,131,101,82,206,180,71,46,116,62,165,147,54,50,3,48,211,162,42,134,82,38,
+72,226,34,24,66,32,242,65,30,215,209,28,196,225,27,185,113,27,182,113,27,185,225,27,
+196,209,28,215,65,30,242,65,32,24,226,34,72,82,38,134,162,42,211,2,48,50,147,54,
+165,115,62,46,180,71,206,100,82,131,85,94,75,86,107,34,7,121,0,232,141,181,217,167,
+50,43,189,91,236,204,45,173,215,184,141,222,14,158,226,60,126,228,74,126,228,60,158,226,
+14,142,222,184,173,215,45,237,204,91,44,189,50,219,167,181,233,141,0,40,114,75,54,88,
+206,228,66,165,35,51,211,98,40,72,130,33,242,113,29,196,145,27,182,145,27,196,113,29,
+242,129,33,72,98,40,211,34,51,165,227,66,206,52,88,75,38,114,0,88,155,50,187,197,
+45,141,219,14,206,227,74,206,227,14,142,219,45,189,197,50,91,155,0,184,100,206,84,58,
+211,130,36,242,65,28,182,65,28,242,129,36,211,82,58,206,180,100,0,56,178,57,45,225,
+60,46,225,57,61,178,0,216,77,199,226,30,196,225,30,199,210,77,0,24,205,207,30,205,
+0,248,50,49,241,50,0,248,236,0,24,19,0,120,131,110,88,138,219,24,145,71,185,151,
+175,41,158,21,106,164,118,90,170,210,250,175,42,75,181,124,59,186,201,219,190,16,44,195,
+82,28,199,142,188,202,198,12,206,248,12,209,38,189,211,79,61,214,117,109,216,150,93,218,
+180,29,220,206,173,221,230,13,223,250,61,224,12,78,225,27,46,226,40,238,226,51,126,227,
+59,254,227,66,78,228,70,142,228,73,174,228,74,174,228,73,142,228,70,78,228,66,254,227,
+59,126,227,51,238,226,40,46,226,27,78,225,12,62,224,250,13,223,230,173,221,206,29,220,
+180,93,218,150,109,216,117,61,214,79,189,211,38,13,209,248,12,206,198,188,202,142,28,199,
+82,44,195,16,220,190,201,59,186,124,75,181,42,251,175,210,90,170,118,106,164,21,42,158,
+175,185,151,71,25,145,219,88,138,110,120,131,0,152,124,146,183,117,37,247,110,185,86,104,
+81,230,97,235,165,91,138,181,85,46,21,80,214,196,74,132,212,69,55,52,65,240,227,60,
+174,243,56,114,83,53,58,3,50,8,3,47,218,82,44,177,210,41,139,162,39,106,178,37,
+76,242,35,50,98,34,26,2,33,6,210,31,244,193,30,229,225,29,216,33,29,205,145,28,
+197,17,28,190,193,27,186,129,27,183,97,27,182,97,27,183,129,27,186,193,27,190,17,28,
+197,145,28,205,33,29,216,225,29,229,193,30,244,209,31,6,2,33,26,98,34,50,242,35,
+76,178,37,106,162,39,139,210,41,177,82,44,218,2,47,8,3,50,58,83,53,114,243,56,
+174,227,60,240,51,65,55,212,69,132,196,74,214,20,80,46,181,85,138,165,91,235,229,97,
+81,86,104,185,246,110,37,183,117,146,151,124,0,232,134,219,120,148,175,89,161,118,42,173,
+42,203,183,201,11,193,82,236,200,198,140,207,38,253,212,117,109,217,180,237,220,230,173,223,
+12,190,225,40,62,227,59,46,228,70,158,228,74,158,228,70,46,228,59,62,227,40,190,225,
+12,174,223,230,237,220,180,109,217,117,253,212,38,141,207,198,236,200,82,12,193,201,203,183,
+42,43,173,118,90,161,175,121,148,219,232,134,0,40,121,37,151,107,81,182,94,138,229,82,
+214,68,72,55,4,63,174,35,55,58,131,48,218,18,43,139,162,38,76,34,35,26,98,32,
+244,81,30,216,209,28,197,225,27,186,113,27,182,113,27,186,225,27,197,209,28,216,81,30,
+244,97,32,26,34,35,76,162,38,139,18,43,218,130,48,58,35,55,174,3,63,55,68,72,
+214,228,82,138,181,94,81,150,107,37,39,121,0,184,141,175,105,167,42,155,188,82,108,204,
+38,93,215,180,109,222,12,142,226,59,110,228,74,110,228,59,142,226,12,110,222,180,93,215,
+38,109,204,82,156,188,42,107,167,175,185,141,0,88,114,81,166,88,214,116,67,174,163,51,
+218,178,40,76,162,33,244,129,29,197,161,27,182,161,27,197,129,29,244,161,33,76,178,40,
+218,162,51,174,115,67,214,164,88,81,86,114,0,248,154,42,43,197,38,77,219,12,190,227,
+74,190,227,12,78,219,38,45,197,42,251,154,0,24,101,214,228,58,218,194,36,244,81,28,
+182,81,28,244,193,36,218,226,58,214,20,101,0,200,177,49,13,225,61,14,225,49,205,177,
+0,72,78,207,2,31,195,1,31,207,66,78,0,216,204,202,222,204,0,56,51,54,49,51,
+0,168,236,0,104,19,0,104,131,109,56,138,217,232,144,67,121,151,170,217,157,14,250,163,
+111,218,169,203,122,175,34,187,180,116,187,185,192,91,190,8,156,194,74,156,198,135,60,202,
+190,156,205,241,156,208,32,93,211,74,221,213,111,29,216,145,29,218,176,237,219,203,125,221,
+227,237,222,248,29,224,10,46,225,26,14,226,39,222,226,50,126,227,59,238,227,66,78,228,
+70,142,228,73,174,228,74,174,228,73,142,228,70,78,228,66,238,227,59,126,227,50,222,226,
+39,14,226,26,46,225,10,30,224,248,237,222,227,125,221,203,237,219,176,29,218,145,29,216,
+111,221,213,74,93,211,32,157,208,241,156,205,190,60,202,135,156,198,74,156,194,8,92,190,
+192,187,185,116,187,180,34,123,175,203,218,169,111,250,163,14,218,157,170,121,151,67,233,144,
+217,56,138,109,104,131,0,168,124,147,215,117,39,39,111,189,150,104,86,54,98,242,21,92,
+145,53,86,53,149,80,222,84,75,140,84,70,64,180,65,248,115,61,182,115,57,121,211,53,
+66,115,50,15,115,47,224,178,44,182,50,42,145,242,39,111,242,37,80,34,36,53,146,34,
+29,34,33,8,242,31,246,225,30,230,1,30,217,49,29,206,145,28,197,33,28,190,193,27,
+186,129,27,183,97,27,182,97,27,183,129,27,186,193,27,190,33,28,197,145,28,206,49,29,
+217,1,30,230,225,30,246,241,31,8,34,33,29,146,34,53,34,36,80,242,37,111,242,39,
+145,50,42,182,178,44,224,114,47,15,115,50,66,211,53,121,115,57,182,115,61,248,179,65,
+64,84,70,140,84,75,222,148,80,53,53,86,145,21,92,242,53,98,86,150,104,189,38,111,
+39,215,117,147,167,124,0,216,134,217,56,148,170,233,160,111,186,172,34,75,183,192,139,192,
+74,124,200,190,28,207,32,173,212,111,29,217,176,189,220,227,141,223,10,174,225,39,46,227,
+59,46,228,70,158,228,74,158,228,70,46,228,59,46,227,39,174,225,10,142,223,227,189,220,
+176,29,217,111,173,212,32,29,207,190,124,200,74,140,192,192,75,183,34,187,172,111,234,160,
+170,57,148,217,216,134,0,56,121,39,215,107,86,38,95,145,85,83,222,196,72,64,132,63,
+182,147,55,66,243,48,224,98,43,145,242,38,80,82,35,29,130,32,246,97,30,217,225,28,
+197,225,27,186,113,27,182,113,27,186,225,27,197,225,28,217,97,30,246,129,32,29,82,35,
+80,242,38,145,98,43,224,242,48,66,147,55,182,131,63,64,196,72,222,84,83,145,37,95,
+86,214,107,39,55,121,0,152,141,170,249,166,34,11,188,74,236,203,32,253,214,176,61,222,
+10,126,226,59,110,228,74,110,228,59,126,226,10,62,222,176,253,214,32,237,203,74,12,188,
+34,251,166,170,153,141,0,120,114,86,22,89,222,4,68,182,35,52,224,18,41,80,210,33,
+246,145,29,197,161,27,182,161,27,197,145,29,246,209,33,80,18,41,224,34,52,182,3,68,
+222,20,89,86,118,114,0,168,154,34,171,196,32,13,219,10,190,227,74,190,227,10,14,219,
+32,173,196,34,171,154,0,104,101,222,100,59,224,2,37,246,81,28,182,81,28,246,1,37,
+224,98,59,222,100,101,0,88,177,42,237,224,62,238,224,42,93,177,0,184,78,214,34,31,
+194,33,31,214,178,78,0,168,204,198,174,204,0,104,51,58,97,51,0,104,236,0,168,19,
+0,104,131,107,24,138,214,184,144,63,57,151,165,137,157,9,154,163,104,122,169,196,10,175,
+26,75,180,108,59,185,185,219,189,0,44,194,66,28,198,127,204,201,184,44,205,235,60,208,
+26,13,211,68,141,213,107,205,215,141,221,217,172,173,219,200,77,221,224,189,222,245,253,223,
+8,14,225,24,254,225,38,206,226,49,110,227,58,238,227,65,78,228,70,142,228,73,174,228,
+74,174,228,73,142,228,70,78,228,65,238,227,58,110,227,49,206,226,38,254,225,24,14,225,
+8,254,223,245,189,222,224,77,221,200,173,219,172,221,217,141,205,215,107,141,213,68,13,211,
+26,61,208,235,44,205,184,204,201,127,28,198,66,44,194,0,220,189,185,59,185,108,75,180,
+26,11,175,196,122,169,104,154,163,9,138,157,165,57,151,63,185,144,214,24,138,107,104,131,
+0,168,124,149,247,117,42,87,111,193,214,104,91,134,98,247,117,92,152,149,86,60,5,81,
+230,196,75,148,212,70,71,52,66,0,228,61,190,243,57,129,67,54,72,227,50,21,211,47,
+230,2,45,188,130,42,149,66,40,115,50,38,84,98,36,56,194,34,32,82,33,11,18,32,
+248,1,31,232,17,30,218,65,29,207,161,28,198,33,28,191,193,27,186,129,27,183,97,27,
+182,97,27,183,129,27,186,193,27,191,33,28,198,161,28,207,65,29,218,17,30,232,1,31,
+248,17,32,11,82,33,32,194,34,56,98,36,84,50,38,115,66,40,149,130,42,188,2,45,
+230,210,47,21,227,50,72,67,54,129,243,57,190,227,61,0,52,66,71,212,70,148,196,75,
+230,4,81,60,149,86,152,117,92,247,133,98,91,214,104,193,86,111,42,247,117,149,167,124,
+0,184,134,214,248,147,165,153,160,104,74,172,26,203,182,185,11,192,66,252,199,184,188,206,
+26,77,212,107,221,216,172,141,220,224,93,223,8,142,225,38,30,227,58,30,228,70,158,228,
+74,158,228,70,30,228,58,30,227,38,142,225,8,94,223,224,141,220,172,221,216,107,77,212,
+26,189,206,184,252,199,66,12,192,185,203,182,26,75,172,104,154,160,165,249,147,214,184,134,
+0,88,121,42,23,108,91,118,95,152,197,83,230,68,73,71,4,64,190,19,56,72,83,49,
+230,194,43,149,50,39,84,130,35,32,178,32,248,129,30,218,241,28,198,241,27,186,113,27,
+182,113,27,186,241,27,198,241,28,218,129,30,248,177,32,32,130,35,84,50,39,149,194,43,
+230,82,49,72,19,56,190,3,64,71,68,73,230,196,83,152,117,95,91,22,108,42,87,121,
+0,104,141,165,137,166,26,155,187,66,140,203,26,189,214,172,13,222,8,110,226,58,110,228,
+74,110,228,58,110,226,8,14,222,172,189,214,26,141,203,66,156,187,26,139,166,165,105,141,
+0,168,114,91,134,89,230,116,68,190,131,52,230,82,41,84,2,34,248,161,29,198,161,27,
+182,161,27,198,161,29,248,1,34,84,82,41,230,130,52,190,115,68,230,132,89,91,166,114,
+0,88,154,26,43,196,26,205,218,8,174,227,74,174,227,8,206,218,26,45,196,26,91,154,
+0,184,101,230,228,59,230,66,37,248,97,28,182,97,28,248,65,37,230,226,59,230,180,101,
+0,232,176,35,205,224,63,206,224,35,237,176,0,40,79,221,66,31,193,65,31,221,34,79,
+0,120,204,193,126,204,0,152,51,63,145,51,0,24,236,0,248,19,0,88,131,106,248,137,
+212,136,144,60,249,150,161,57,157,4,58,163,98,10,169,189,154,174,19,219,179,101,203,184,
+177,107,189,249,187,193,59,172,197,121,92,201,177,204,204,229,220,207,20,173,210,63,61,213,
+102,141,215,137,157,217,169,125,219,197,29,221,221,157,222,243,221,223,6,254,224,23,238,225,
+37,190,226,48,94,227,58,238,227,65,78,228,70,142,228,73,174,228,74,174,228,73,142,228,
+70,78,228,65,238,227,58,94,227,48,190,226,37,238,225,23,254,224,6,222,223,243,157,222,
+221,29,221,197,125,219,169,157,217,137,141,215,102,61,213,63,173,210,20,221,207,229,204,204,
+177,92,201,121,172,197,59,188,193,249,107,189,177,203,184,101,219,179,19,155,174,189,10,169,
+98,58,163,4,58,157,161,249,150,60,137,144,212,248,137,106,88,131,0,184,124,150,23,118,
+44,135,111,196,22,105,95,214,98,252,213,92,158,5,87,67,117,81,237,52,76,155,68,71,
+79,164,66,7,84,62,197,99,58,135,179,54,79,67,51,27,51,48,236,98,45,193,210,42,
+154,130,40,119,114,38,87,146,36,59,242,34,35,114,33,13,50,32,250,17,31,233,33,30,
+219,81,29,208,177,28,198,33,28,191,193,27,186,129,27,183,97,27,182,97,27,183,129,27,
+186,193,27,191,33,28,198,177,28,208,81,29,219,33,30,233,17,31,250,49,32,13,114,33,
+35,242,34,59,146,36,87,114,38,119,130,40,154,210,42,193,98,45,236,50,48,27,67,51,
+79,179,54,135,99,58,197,83,62,7,164,66,79,68,71,155,52,76,237,116,81,67,5,87,
+158,213,92,252,213,98,95,22,105,196,134,111,44,23,118,150,183,124,0,168,134,212,200,147,
+161,73,160,98,218,171,19,91,182,177,155,191,59,156,199,177,92,206,20,253,211,102,157,216,
+169,93,220,221,61,223,6,126,225,37,14,227,58,30,228,70,158,228,74,158,228,70,30,228,
+58,14,227,37,126,225,6,62,223,221,93,220,169,157,216,102,253,211,20,93,206,177,156,199,
+59,156,191,177,91,182,19,219,171,98,74,160,161,201,147,212,168,134,0,104,121,44,71,108,
+95,198,95,158,53,84,237,180,73,79,116,64,197,115,56,79,179,49,236,18,44,154,114,39,
+87,178,35,35,210,32,250,145,30,219,1,29,198,241,27,186,113,27,182,113,27,186,241,27,
+198,1,29,219,145,30,250,209,32,35,178,35,87,114,39,154,18,44,236,178,49,79,115,56,
+197,115,64,79,180,73,237,52,84,158,197,95,95,70,108,44,103,121,0,72,141,161,41,166,
+19,27,187,59,28,203,20,109,214,169,221,221,6,94,226,58,110,228,74,110,228,58,94,226,
+6,222,221,169,109,214,20,29,203,59,28,187,19,43,166,161,73,141,0,200,114,95,230,89,
+237,244,68,197,243,52,236,162,41,87,50,34,250,177,29,198,161,27,182,161,27,198,177,29,
+250,49,34,87,162,41,236,242,52,197,243,68,237,228,89,95,198,114,0,24,154,19,187,195,
+20,141,218,7,174,227,74,174,227,7,142,218,20,189,195,19,27,154,0,248,101,237,84,60,
+236,130,37,249,97,28,182,97,28,249,129,37,236,82,60,237,244,101,0,136,176,29,173,224,
+64,174,224,29,141,176,0,136,79,227,98,31,192,97,31,227,130,79,0,72,204,189,78,204,
+0,200,51,67,193,51,0,216,235,0,56,20,0,88,131,105,232,137,210,88,144,56,185,150,
+157,233,156,255,233,162,93,170,168,183,58,174,13,107,179,94,91,184,171,251,188,242,75,193,
+52,76,197,114,252,200,171,108,204,223,140,207,15,93,210,58,237,212,98,77,215,133,109,217,
+165,77,219,194,253,220,219,125,222,241,189,223,5,238,224,22,222,225,36,174,226,48,94,227,
+57,222,227,65,78,228,70,142,228,73,174,228,74,174,228,73,142,228,70,78,228,65,222,227,
+57,94,227,48,174,226,36,222,225,22,238,224,5,190,223,241,125,222,219,253,220,194,77,219,
+165,109,217,133,77,215,98,237,212,58,93,210,15,141,207,223,108,204,171,252,200,114,76,197,
+52,76,193,242,251,188,171,91,184,94,107,179,13,59,174,183,170,168,93,234,162,255,233,156,
+157,185,150,56,89,144,210,232,137,105,88,131,0,184,124,151,39,118,46,183,111,200,86,105,
+99,38,99,1,38,93,163,101,87,73,213,81,243,164,76,162,180,71,85,20,67,14,196,62,
+204,195,58,142,19,55,85,163,51,33,131,48,241,178,45,198,34,43,158,194,40,123,162,38,
+91,194,36,62,18,35,37,146,33,15,82,32,251,33,31,234,49,30,220,97,29,208,177,28,
+199,49,28,191,193,27,186,129,27,183,97,27,182,97,27,183,129,27,186,193,27,191,49,28,
+199,177,28,208,97,29,220,49,30,234,33,31,251,81,32,15,146,33,37,18,35,62,194,36,
+91,162,38,123,194,40,158,34,43,198,178,45,241,130,48,33,163,51,85,19,55,142,195,58,
+204,195,62,14,20,67,85,180,71,162,164,76,243,212,81,73,101,87,163,37,93,1,38,99,
+99,86,105,200,182,111,46,39,118,151,183,124,0,152,134,210,136,147,157,249,159,93,122,171,
+13,235,181,171,43,191,52,44,199,171,252,205,15,173,211,98,93,216,165,45,220,219,29,223,
+5,110,225,36,14,227,57,30,228,70,158,228,74,158,228,70,30,228,57,14,227,36,110,225,
+5,30,223,219,45,220,165,93,216,98,173,211,15,253,205,171,44,199,52,44,191,171,235,181,
+13,123,171,93,250,159,157,137,147,210,152,134,0,120,121,46,135,108,99,22,96,163,149,84,
+243,36,74,85,228,64,204,227,56,85,19,50,241,98,44,158,178,39,91,226,35,37,242,32,
+251,161,30,220,1,29,199,241,27,186,113,27,182,113,27,186,241,27,199,1,29,220,161,30,
+251,241,32,37,226,35,91,178,39,158,98,44,241,18,50,85,227,56,204,227,64,85,36,74,
+243,148,84,163,21,96,99,134,108,46,119,121,0,40,141,157,217,165,13,187,186,52,188,202,
+15,45,214,165,189,221,5,78,226,57,110,228,74,110,228,57,78,226,5,190,221,165,45,214,
+15,189,202,52,188,186,13,219,165,157,41,141,0,232,114,99,54,90,243,84,69,204,83,53,
+241,226,41,91,82,34,251,193,29,199,161,27,182,161,27,199,193,29,251,81,34,91,226,41,
+241,82,53,204,83,69,243,52,90,99,230,114,0,216,153,13,91,195,15,93,218,5,158,227,
+74,158,227,5,94,218,15,93,195,13,219,153,0,56,102,243,180,60,241,178,37,251,113,28,
+182,113,28,251,177,37,241,178,60,243,52,102,0,56,176,23,141,224,64,142,224,23,61,176,
+0,216,79,233,130,31,192,129,31,233,210,79,0,24,204,186,30,204,0,248,51,70,241,51,
+0,168,235,0,104,20,0,72,131,104,200,137,208,56,144,54,137,150,153,169,156,250,153,162,
+88,90,168,177,218,173,7,11,179,88,251,183,164,155,188,236,235,192,46,236,196,108,156,200,
+165,12,204,218,44,207,10,13,210,54,173,212,94,13,215,130,45,217,162,29,219,191,205,220,
+217,93,222,239,173,223,3,206,224,21,206,225,35,158,226,47,78,227,57,222,227,65,78,228,
+70,142,228,73,174,228,74,174,228,73,142,228,70,78,228,65,222,227,57,78,227,47,158,226,
+35,206,225,21,206,224,3,174,223,239,93,222,217,205,220,191,29,219,162,45,217,130,13,215,
+94,173,212,54,13,210,10,45,207,218,12,204,165,156,200,108,236,196,46,236,192,236,155,188,
+164,251,183,88,11,179,7,219,173,177,90,168,88,154,162,250,169,156,153,137,150,54,57,144,
+208,200,137,104,72,131,0,200,124,152,71,118,48,215,111,202,134,105,103,102,99,6,118,93,
+168,181,87,79,53,82,249,4,77,168,20,72,92,116,67,20,36,63,210,35,59,148,115,55,
+91,3,52,38,227,48,246,2,46,202,98,43,162,2,41,126,226,38,94,242,36,65,66,35,
+39,178,33,17,98,32,253,65,31,235,65,30,221,113,29,209,193,28,199,49,28,191,193,27,
+186,129,27,183,97,27,182,97,27,183,129,27,186,193,27,191,49,28,199,193,28,209,113,29,
+221,65,30,235,65,31,253,97,32,17,178,33,39,66,35,65,242,36,94,226,38,126,2,41,
+162,98,43,202,2,46,246,226,48,38,3,52,91,115,55,148,35,59,210,35,63,20,116,67,
+92,20,72,168,4,77,249,52,82,79,181,87,168,117,93,6,102,99,103,134,105,202,214,111,
+48,71,118,152,199,124,0,136,134,208,104,147,153,169,159,88,42,171,7,139,181,164,203,190,
+46,204,198,165,172,205,10,109,211,94,45,216,162,253,219,217,253,222,3,94,225,35,254,226,
+57,30,228,70,158,228,74,158,228,70,30,228,57,254,226,35,94,225,3,254,222,217,253,219,
+162,45,216,94,109,211,10,173,205,165,204,198,46,204,190,164,139,181,7,27,171,88,170,159,
+153,105,147,208,136,134,0,136,121,48,167,108,103,102,96,168,245,84,249,132,74,92,68,65,
+210,67,57,91,99,50,246,162,44,162,226,39,94,18,36,39,18,33,253,177,30,221,17,29,
+199,241,27,186,113,27,182,113,27,186,241,27,199,17,29,221,177,30,253,17,33,39,18,36,
+94,226,39,162,162,44,246,98,50,91,67,57,210,67,65,92,132,74,249,228,84,168,101,96,
+103,166,108,48,135,121,0,8,141,153,137,165,7,75,186,46,92,202,10,237,213,162,157,221,
+3,62,226,57,110,228,74,110,228,57,62,226,3,158,221,162,237,213,10,93,202,46,76,186,
+7,139,165,153,9,141,0,8,115,103,134,90,249,196,69,210,179,53,246,34,42,94,114,34,
+253,209,29,199,161,27,182,161,27,199,209,29,253,113,34,94,34,42,246,178,53,210,195,69,
+249,132,90,103,6,115,0,152,153,7,235,194,10,45,218,3,158,227,74,158,227,3,46,218,
+10,237,194,7,155,153,0,120,102,249,36,61,246,226,37,253,113,28,182,113,28,253,225,37,
+246,34,61,249,116,102,0,232,175,18,109,224,65,110,224,18,237,175,0,40,80,238,162,31,
+191,161,31,238,34,80,0,248,203,182,254,203,0,24,52,74,17,52,0,104,235,0,168,20,
+0,72,131,103,184,137,206,24,144,51,89,150,150,105,156,246,89,162,83,10,168,172,122,173,
+1,171,178,82,155,183,158,59,188,230,139,192,41,140,196,103,76,200,160,188,203,213,236,206,
+5,205,209,50,109,212,90,221,214,126,253,216,159,237,218,188,173,220,215,61,222,238,141,223,
+2,190,224,19,190,225,34,158,226,47,78,227,57,222,227,64,62,228,70,142,228,73,174,228,
+74,174,228,73,142,228,70,62,228,64,222,227,57,78,227,47,158,226,34,190,225,19,190,224,
+2,142,223,238,61,222,215,173,220,188,237,218,159,253,216,126,221,214,90,109,212,50,205,209,
+5,237,206,213,188,203,160,76,200,103,140,196,41,140,192,230,59,188,158,155,183,82,171,178,
+1,123,173,172,10,168,83,90,162,246,105,156,150,89,150,51,25,144,206,184,137,103,72,131,
+0,200,124,153,87,118,50,247,111,205,182,105,106,166,99,10,182,93,173,5,88,84,149,82,
+255,100,77,174,116,72,98,212,67,26,132,63,215,131,59,153,195,55,96,83,52,43,35,49,
+251,66,46,206,162,43,166,50,41,130,18,39,97,34,37,68,98,35,41,210,33,18,130,32,
+254,81,31,237,81,30,222,113,29,209,193,28,199,49,28,192,209,27,186,129,27,183,97,27,
+182,97,27,183,129,27,186,209,27,192,49,28,199,193,28,209,113,29,222,81,30,237,81,31,
+254,129,32,18,210,33,41,98,35,68,34,37,97,18,39,130,50,41,166,162,43,206,66,46,
+251,34,49,43,83,52,96,195,55,153,131,59,215,131,63,26,212,67,98,116,72,174,100,77,
+255,148,82,84,5,88,173,181,93,10,166,99,106,182,105,205,246,111,50,87,118,153,199,124,
+0,120,134,206,56,147,150,105,159,83,202,170,1,43,181,158,107,190,41,124,198,160,92,205,
+5,45,211,90,237,215,159,205,219,215,237,222,2,62,225,34,254,226,57,14,228,70,158,228,
+74,158,228,70,14,228,57,254,226,34,62,225,2,238,222,215,205,219,159,237,215,90,45,211,
+5,93,205,160,124,198,41,108,190,158,43,181,1,203,170,83,106,159,150,57,147,206,120,134,
+0,152,121,50,215,108,106,166,96,173,69,85,255,228,74,98,164,65,215,147,57,96,179,50,
+251,226,44,166,34,40,97,66,36,41,34,33,254,209,30,222,17,29,199,1,28,186,113,27,
+182,113,27,186,1,28,199,17,29,222,209,30,254,33,33,41,66,36,97,34,40,166,226,44,
+251,178,50,96,147,57,215,163,65,98,228,74,255,68,85,173,165,96,106,214,108,50,151,121,
+0,232,140,150,57,165,1,235,185,41,12,202,5,173,213,159,125,221,2,46,226,57,110,228,
+74,110,228,57,46,226,2,126,221,159,173,213,5,13,202,41,236,185,1,59,165,150,233,140,
+0,40,115,106,214,90,255,36,70,215,3,54,251,98,42,97,146,34,254,225,29,199,161,27,
+182,161,27,199,225,29,254,145,34,97,98,42,251,2,54,215,35,70,255,212,90,106,38,115,
+0,104,153,2,155,194,5,253,217,2,158,227,74,158,227,2,254,217,5,157,194,2,107,153,
+0,168,102,254,116,61,251,18,38,254,113,28,182,113,28,254,17,38,251,114,61,254,164,102,
+0,152,175,12,93,224,66,94,224,12,157,175,0,120,80,244,178,31,190,177,31,244,114,80,
+0,200,203,179,206,203,0,72,52,77,65,52,0,56,235,0,216,20,0,56,131,102,152,137,
+204,248,143,48,41,150,147,57,156,242,25,162,79,202,167,168,58,173,252,90,178,77,75,183,
+153,219,187,225,59,192,35,60,196,98,252,199,155,108,203,208,156,206,1,141,209,46,61,212,
+86,157,214,123,205,216,156,205,218,186,141,220,213,29,222,236,125,223,1,174,224,18,174,225,
+34,142,226,46,78,227,56,222,227,64,62,228,70,142,228,73,174,228,74,174,228,73,142,228,
+70,62,228,64,222,227,56,78,227,46,142,226,34,174,225,18,174,224,1,126,223,236,29,222,
+213,141,220,186,205,218,156,205,216,123,157,214,86,45,212,46,141,209,1,157,206,208,108,203,
+155,252,199,98,60,196,35,60,192,225,219,187,153,75,183,77,91,178,252,58,173,168,202,167,
+79,26,162,242,57,156,147,41,150,48,249,143,204,152,137,102,56,131,0,216,124,154,119,118,
+52,23,112,208,230,105,109,214,99,14,246,93,177,69,88,88,213,82,4,181,77,179,196,72,
+103,52,68,31,212,63,221,211,59,158,19,56,101,163,52,48,115,49,255,130,46,210,226,43,
+170,114,41,133,66,39,100,66,37,70,130,35,43,242,33,20,146,32,255,97,31,238,97,30,
+222,129,29,210,193,28,200,49,28,192,209,27,186,129,27,183,97,27,182,97,27,183,129,27,
+186,209,27,192,49,28,200,193,28,210,129,29,222,97,30,238,97,31,255,145,32,20,242,33,
+43,130,35,70,66,37,100,66,39,133,114,41,170,210,43,210,130,46,255,114,49,48,163,52,
+101,19,56,158,211,59,221,211,63,31,52,68,103,196,72,179,180,77,4,213,82,88,69,88,
+177,245,93,14,214,99,109,230,105,208,22,112,52,119,118,154,215,124,0,104,134,204,8,147,
+147,41,159,79,138,170,252,218,180,153,27,190,35,44,198,155,12,205,1,237,210,86,189,215,
+156,173,219,213,205,222,1,46,225,34,238,226,56,14,228,70,158,228,74,158,228,70,14,228,
+56,238,226,34,46,225,1,206,222,213,173,219,156,189,215,86,237,210,1,13,205,155,44,198,
+35,28,190,153,219,180,252,138,170,79,42,159,147,9,147,204,104,134,0,168,121,52,7,109,
+109,230,96,177,133,85,4,53,75,103,244,65,221,227,57,101,3,51,255,34,45,170,82,40,
+100,98,36,43,66,33,255,225,30,222,33,29,200,1,28,186,113,27,182,113,27,186,1,28,
+200,33,29,222,225,30,255,65,33,43,98,36,100,82,40,170,34,45,255,2,51,101,227,57,
+221,243,65,103,52,75,4,133,85,177,229,96,109,6,109,52,167,121,0,200,140,147,249,164,
+252,154,185,35,188,201,1,109,213,156,93,221,1,46,226,56,110,228,74,110,228,56,46,226,
+1,94,221,156,109,213,1,189,201,35,156,185,252,250,164,147,201,140,0,72,115,109,22,91,
+4,117,70,221,83,54,255,162,42,100,178,34,255,225,29,200,161,27,182,161,27,200,225,29,
+255,177,34,100,162,42,255,82,54,221,115,70,4,21,91,109,70,115,0,56,153,252,58,194,
+1,205,217,1,142,227,74,142,227,1,206,217,1,61,194,252,58,153,0,216,102,4,213,61,
+255,66,38,255,129,28,182,129,28,255,65,38,255,210,61,4,213,102,0,72,175,8,61,224,
+66,62,224,8,77,175,0,200,80,248,210,31,190,209,31,248,194,80,0,168,203,176,174,203,
+0,104,52,80,97,52,0,8,235,0,8,21,0,56,131,102,136,137,203,216,143,46,249,149,
+144,9,156,239,217,161,75,122,167,163,234,172,248,10,178,72,251,182,148,139,187,220,235,191,
+30,236,195,93,172,199,151,44,203,204,92,206,253,76,209,42,253,211,83,109,214,120,157,216,
+154,157,218,184,109,220,211,253,221,235,93,223,255,157,224,17,158,225,33,142,226,46,62,227,
+56,206,227,64,62,228,70,142,228,73,174,228,74,174,228,73,142,228,70,62,228,64,206,227,
+56,62,227,46,142,226,33,158,225,17,158,224,255,93,223,235,253,221,211,109,220,184,157,218,
+154,157,216,120,109,214,83,253,211,42,77,209,253,92,206,204,44,203,151,172,199,93,236,195,
+30,236,191,220,139,187,148,251,182,72,11,178,248,234,172,163,122,167,75,218,161,239,9,156,
+144,249,149,46,217,143,203,136,137,102,56,131,0,216,124,154,135,118,53,55,112,210,22,106,
+112,6,100,17,54,94,181,149,88,93,37,83,8,5,78,184,20,73,108,132,68,36,36,64,
+226,35,60,163,99,56,105,227,52,52,179,49,3,195,46,214,18,44,173,162,41,136,114,39,
+102,114,37,72,162,35,45,18,34,21,178,32,1,114,31,239,113,30,223,129,29,210,209,28,
+200,65,28,192,209,27,186,129,27,183,97,27,182,97,27,183,129,27,186,209,27,192,65,28,
+200,209,28,210,129,29,223,113,30,239,113,31,1,178,32,21,18,34,45,162,35,72,114,37,
+102,114,39,136,162,41,173,18,44,214,194,46,3,179,49,52,227,52,105,99,56,163,35,60,
+226,35,64,36,132,68,108,20,73,184,4,78,8,37,83,93,149,88,181,53,94,17,6,100,
+112,22,106,210,54,112,53,135,118,154,215,124,0,104,134,203,232,146,144,249,158,75,58,170,
+248,138,180,148,203,189,30,220,197,151,204,204,253,172,210,83,141,215,154,141,219,211,189,222,
+255,29,225,33,238,226,56,14,228,70,158,228,74,158,228,70,14,228,56,238,226,33,30,225,
+255,189,222,211,141,219,154,141,215,83,173,210,253,204,204,151,220,197,30,204,189,148,139,180,
+248,58,170,75,250,158,144,233,146,203,104,134,0,168,121,53,39,109,112,22,97,181,213,85,
+8,133,75,108,68,66,226,51,58,105,67,51,3,99,45,173,130,40,102,130,36,45,82,33,
+1,242,30,223,33,29,200,1,28,186,113,27,182,113,27,186,1,28,200,33,29,223,241,30,
+1,82,33,45,130,36,102,130,40,173,98,45,3,67,51,105,51,58,226,67,66,108,132,75,
+8,213,85,181,21,97,112,38,109,53,167,121,0,184,140,144,185,164,248,74,185,30,124,201,
+253,60,213,154,61,221,255,29,226,56,110,228,74,110,228,56,30,226,255,61,221,154,61,213,
+253,124,201,30,76,185,248,186,164,144,185,140,0,88,115,112,86,91,8,197,70,226,147,54,
+3,211,42,102,210,34,1,242,29,200,161,27,182,161,27,200,241,29,1,210,34,102,210,42,
+3,147,54,226,195,70,8,85,91,112,86,115,0,8,153,248,234,193,253,172,217,255,141,227,
+74,142,227,255,173,217,253,236,193,248,10,153,0,8,103,8,37,62,3,99,38,1,130,28,
+182,129,28,1,98,38,3,35,62,8,5,103,0,8,175,3,45,224,67,46,224,3,13,175,
+0,8,81,253,226,31,189,225,31,253,2,81,0,136,203,173,142,203,0,136,52,83,129,52,
+0,216,234,0,56,21,0,56,131,101,120,137,201,184,143,44,217,149,141,217,155,236,169,161,
+71,74,167,159,170,172,243,202,177,68,171,182,144,75,187,215,155,191,26,172,195,88,108,199,
+146,236,202,200,28,206,249,28,209,39,205,211,80,61,214,118,125,216,151,125,218,182,77,220,
+209,221,221,233,77,223,254,141,224,17,158,225,32,126,226,45,62,227,56,206,227,64,62,228,
+70,142,228,73,174,228,74,174,228,73,142,228,70,62,228,64,206,227,56,62,227,45,126,226,
+32,158,225,17,142,224,254,77,223,233,221,221,209,77,220,182,125,218,151,125,216,118,61,214,
+80,205,211,39,29,209,249,28,206,200,236,202,146,108,199,88,172,195,26,156,191,215,75,187,
+144,171,182,68,203,177,243,170,172,159,74,167,71,170,161,236,217,155,141,217,149,44,185,143,
+201,120,137,101,56,131,0,216,124,155,151,118,55,87,112,212,54,106,115,54,100,20,102,94,
+185,197,88,97,101,83,13,69,78,188,100,73,112,196,68,41,116,64,230,99,60,168,163,56,
+110,35,53,56,243,49,7,243,46,217,66,44,176,210,41,138,146,39,105,146,37,74,194,35,
+47,50,34,23,194,32,2,130,31,239,113,30,224,145,29,211,209,28,200,65,28,192,209,27,
+186,129,27,183,97,27,182,97,27,183,129,27,186,209,27,192,65,28,200,209,28,211,145,29,
+224,113,30,239,129,31,2,194,32,23,50,34,47,194,35,74,146,37,105,146,39,138,210,41,
+176,66,44,217,242,46,7,243,49,56,35,53,110,163,56,168,99,60,230,115,64,41,196,68,
+112,100,73,188,68,78,13,101,83,97,197,88,185,101,94,20,54,100,115,54,106,212,86,112,
+55,151,118,155,215,124,0,88,134,201,200,146,141,201,158,71,250,169,243,74,180,144,123,189,
+26,140,197,146,140,204,249,124,210,80,109,215,151,109,219,209,157,222,254,29,225,32,222,226,
+56,14,228,70,158,228,74,158,228,70,14,228,56,222,226,32,30,225,254,157,222,209,109,219,
+151,109,215,80,125,210,249,140,204,146,140,197,26,124,189,144,75,180,243,250,169,71,202,158,
+141,201,146,201,88,134,0,184,121,55,71,109,115,70,97,185,21,86,13,197,75,112,148,66,
+230,131,58,110,131,51,7,147,45,176,162,40,105,162,36,47,114,33,2,242,30,224,49,29,
+200,1,28,186,113,27,182,113,27,186,1,28,200,49,29,224,241,30,2,114,33,47,162,36,
+105,162,40,176,146,45,7,131,51,110,131,58,230,147,66,112,196,75,13,21,86,185,69,97,
+115,70,109,55,183,121,0,152,140,141,121,164,243,10,185,26,44,201,249,12,213,151,29,221,
+254,13,226,56,110,228,74,110,228,56,14,226,254,29,221,151,13,213,249,44,201,26,12,185,
+243,122,164,141,153,140,0,120,115,115,150,91,13,5,71,230,227,54,7,3,43,105,242,34,
+2,2,30,200,161,27,182,161,27,200,1,30,2,242,34,105,2,43,7,227,54,230,3,71,
+13,149,91,115,118,115,0,216,152,243,170,193,249,124,217,254,141,227,74,142,227,254,125,217,
+249,172,193,243,218,152,0,56,103,13,101,62,7,147,38,2,130,28,182,129,28,2,146,38,
+7,99,62,13,53,103,0,200,174,255,28,224,67,30,224,255,204,174,0,72,81,1,243,31,
+189,241,31,1,67,81,0,104,203,170,110,203,0,168,52,86,161,52,0,168,234,0,104,21,
+0,40,131,100,104,137,200,152,143,42,185,149,139,169,155,233,121,161,68,10,167,156,106,172,
+240,138,177,64,107,182,139,11,187,211,91,191,22,108,195,84,44,199,143,172,202,196,236,205,
+246,220,208,36,157,211,77,29,214,115,93,216,149,93,218,180,45,220,207,205,221,232,61,223,
+253,125,224,16,142,225,32,110,226,45,46,227,55,206,227,64,62,228,70,142,228,73,174,228,
+74,174,228,73,142,228,70,62,228,64,206,227,55,46,227,45,110,226,32,142,225,16,126,224,
+253,61,223,232,205,221,207,45,220,180,93,218,149,93,216,115,29,214,77,157,211,36,221,208,
+246,236,205,196,172,202,143,44,199,84,108,195,22,92,191,211,11,187,139,107,182,64,139,177,
+240,106,172,156,10,167,68,122,161,233,169,155,139,185,149,42,153,143,200,104,137,100,40,131,
+0,232,124,156,167,118,56,119,112,214,86,106,117,102,100,23,150,94,188,5,89,100,165,83,
+16,133,78,192,164,73,117,4,69,45,180,64,234,163,60,172,227,56,113,99,53,60,35,50,
+10,51,47,220,114,44,179,242,41,141,178,39,107,178,37,76,226,35,49,66,34,24,210,32,
+3,146,31,240,129,30,224,161,29,211,225,28,201,65,28,192,209,27,186,129,27,183,97,27,
+182,97,27,183,129,27,186,209,27,192,65,28,201,225,28,211,161,29,224,129,30,240,145,31,
+3,210,32,24,66,34,49,226,35,76,178,37,107,178,39,141,242,41,179,114,44,220,50,47,
+10,35,50,60,99,53,113,227,56,172,163,60,234,179,64,45,4,69,117,164,73,192,132,78,
+16,165,83,100,5,89,188,149,94,23,102,100,117,86,106,214,118,112,56,167,118,156,231,124,
+0,72,134,200,168,146,139,153,158,68,202,169,240,10,180,139,59,189,22,76,197,143,76,204,
+246,76,210,77,61,215,149,77,219,207,141,222,253,13,225,32,222,226,55,14,228,70,158,228,
+74,158,228,70,14,228,55,222,226,32,14,225,253,141,222,207,77,219,149,61,215,77,77,210,
+246,76,204,143,76,197,22,60,189,139,11,180,240,202,169,68,154,158,139,169,146,200,72,134,
+0,200,121,56,103,109,117,118,97,188,69,86,16,5,76,117,212,66,234,195,58,113,195,51,
+10,195,45,179,210,40,107,194,36,49,130,33,3,2,31,224,49,29,201,1,28,186,113,27,
+182,113,27,186,1,28,201,49,29,224,1,31,3,130,33,49,194,36,107,210,40,179,194,45,
+10,195,51,113,195,58,234,211,66,117,4,76,16,69,86,188,117,97,117,102,109,56,199,121,
+0,136,140,139,73,164,240,186,184,22,252,200,246,220,212,149,253,220,253,13,226,55,110,228,
+74,110,228,55,14,226,253,253,220,149,221,212,246,252,200,22,188,184,240,74,164,139,137,140,
+0,136,115,117,198,91,16,85,71,234,19,55,10,51,43,107,18,35,3,2,30,201,161,27,
+182,161,27,201,1,30,3,18,35,107,50,43,10,19,55,234,83,71,16,197,91,117,134,115,
+0,184,152,240,106,193,246,92,217,253,125,227,74,126,227,253,93,217,246,108,193,240,186,152,
+0,88,103,16,165,62,10,179,38,3,146,28,182,145,28,3,178,38,10,163,62,16,85,103,
+0,152,174,252,12,224,67,14,224,252,156,174,0,120,81,4,3,32,189,1,32,4,115,81,
+0,88,203,168,94,203,0,184,52,88,177,52,0,136,234,0,136,21,0,40,131,100,88,137,
+199,136,143,41,153,149,136,137,155,230,73,161,65,218,166,152,42,172,236,74,177,60,43,182,
+135,203,186,207,27,191,18,44,195,81,236,198,139,108,202,193,172,205,243,172,208,33,109,211,
+75,237,213,113,45,216,147,61,218,178,13,220,206,189,221,231,45,223,252,109,224,15,126,225,
+31,110,226,44,46,227,55,206,227,64,62,228,69,142,228,73,174,228,74,174,228,73,142,228,
+69,62,228,64,206,227,55,46,227,44,110,226,31,126,225,15,110,224,252,45,223,231,189,221,
+206,13,220,178,61,218,147,45,216,113,237,213,75,109,211,33,173,208,243,172,205,193,108,202,
+139,236,198,81,44,195,18,28,191,207,203,186,135,43,182,60,75,177,236,42,172,152,218,166,
+65,74,161,230,137,155,136,153,149,41,137,143,199,88,137,100,40,131,0,232,124,156,183,118,
+57,135,112,215,118,106,120,134,100,26,198,94,191,53,89,104,229,83,20,197,78,196,228,73,
+121,68,69,49,244,64,238,227,60,175,35,57,117,163,53,63,99,50,13,99,47,223,162,44,
+181,34,42,143,226,39,109,210,37,78,2,36,50,82,34,25,226,32,4,162,31,241,145,30,
+225,161,29,212,225,28,201,65,28,192,209,27,187,129,27,183,97,27,182,97,27,183,129,27,
+187,209,27,192,65,28,201,225,28,212,161,29,225,145,30,241,161,31,4,226,32,25,82,34,
+50,2,36,78,210,37,109,226,39,143,34,42,181,162,44,223,98,47,13,99,50,63,163,53,
+117,35,57,175,227,60,238,243,64,49,68,69,121,228,73,196,196,78,20,229,83,104,53,89,
+191,197,94,26,134,100,120,118,106,215,134,112,57,183,118,156,231,124,0,72,134,199,152,146,
+136,105,158,65,138,169,236,202,179,135,251,188,18,28,197,139,28,204,243,28,210,75,29,215,
+147,45,219,206,125,222,252,253,224,31,206,226,55,14,228,69,158,228,74,158,228,69,14,228,
+55,206,226,31,254,224,252,125,222,206,45,219,147,29,215,75,29,210,243,28,204,139,28,197,
+18,252,188,135,203,179,236,138,169,65,106,158,136,153,146,199,72,134,0,200,121,57,119,109,
+120,166,97,191,133,86,20,69,76,121,20,67,238,243,58,117,243,51,13,243,45,181,242,40,
+109,226,36,50,146,33,4,18,31,225,65,29,201,1,28,187,113,27,182,113,27,187,1,28,
+201,65,29,225,17,31,4,146,33,50,226,36,109,242,40,181,242,45,13,243,51,117,243,58,
+238,19,67,121,68,76,20,133,86,191,165,97,120,118,109,57,199,121,0,120,140,136,25,164,
+236,122,184,18,188,200,243,188,212,147,237,220,252,253,225,55,94,228,74,94,228,55,254,225,
+252,237,220,147,189,212,243,188,200,18,124,184,236,26,164,136,121,140,0,152,115,120,246,91,
+20,149,71,238,83,55,13,83,43,109,34,35,4,18,30,201,177,27,182,177,27,201,17,30,
+4,34,35,109,82,43,13,83,55,238,147,71,20,245,91,120,150,115,0,136,152,236,42,193,
+243,60,217,252,125,227,74,126,227,252,61,217,243,44,193,236,138,152,0,136,103,20,229,62,
+13,211,38,4,146,28,182,145,28,4,210,38,13,227,62,20,133,103,0,88,174,248,236,223,
+68,238,223,248,92,174,0,184,81,8,35,32,188,33,32,8,179,81,0,56,203,165,62,203,
+0,216,52,91,209,52,0,88,234,0,184,21,0,40,131,99,88,137,198,104,143,39,121,149,
+134,89,155,228,25,161,62,170,166,149,250,171,233,26,177,56,251,181,132,139,186,203,219,190,
+14,236,194,77,188,198,136,60,202,190,124,205,240,124,208,30,77,211,72,205,213,111,13,216,
+145,29,218,177,253,219,205,157,221,229,29,223,251,93,224,14,126,225,30,110,226,44,46,227,
+55,190,227,63,62,228,69,126,228,73,174,228,74,174,228,73,126,228,69,62,228,63,190,227,
+55,46,227,44,110,226,30,126,225,14,94,224,251,29,223,229,157,221,205,253,219,177,29,218,
+145,13,216,111,205,213,72,77,211,30,125,208,240,124,205,190,60,202,136,188,198,77,236,194,
+14,220,190,203,139,186,132,251,181,56,27,177,233,250,171,149,170,166,62,26,161,228,89,155,
+134,121,149,39,105,143,198,88,137,99,40,131,0,232,124,157,183,118,58,167,112,217,150,106,
+122,182,100,28,246,94,194,101,89,107,21,84,23,245,78,200,20,74,124,132,69,53,52,65,
+242,35,61,179,83,57,120,211,53,66,147,50,16,147,47,226,194,44,184,66,42,145,2,40,
+111,242,37,79,18,36,51,114,34,27,242,32,5,178,31,242,145,30,226,161,29,212,225,28,
+201,81,28,193,209,27,187,145,27,183,97,27,182,97,27,183,145,27,187,209,27,193,81,28,
+201,225,28,212,161,29,226,145,30,242,177,31,5,242,32,27,114,34,51,18,36,79,242,37,
+111,2,40,145,66,42,184,194,44,226,146,47,16,147,50,66,211,53,120,83,57,179,35,61,
+242,51,65,53,132,69,124,20,74,200,244,78,23,21,84,107,101,89,194,245,94,28,182,100,
+122,150,106,217,166,112,58,183,118,157,231,124,0,56,134,198,120,146,134,73,158,62,90,169,
+233,138,179,132,187,188,14,220,196,136,236,203,240,236,209,72,253,214,145,29,219,205,93,222,
+251,237,224,30,206,226,55,254,227,69,158,228,74,158,228,69,254,227,55,206,226,30,238,224,
+251,93,222,205,29,219,145,253,214,72,237,209,240,236,203,136,220,196,14,188,188,132,139,179,
+233,90,169,62,74,158,134,121,146,198,56,134,0,216,121,58,151,109,122,198,97,194,181,86,
+23,133,76,124,84,67,242,51,59,120,35,52,16,35,46,184,18,41,111,242,36,51,178,33,
+5,34,31,226,65,29,201,17,28,187,113,27,182,113,27,187,17,28,201,65,29,226,33,31,
+5,178,33,51,242,36,111,18,41,184,34,46,16,35,52,120,51,59,242,83,67,124,132,76,
+23,181,86,194,197,97,122,150,109,58,215,121,0,104,140,134,233,163,233,74,184,14,140,200,
+240,140,212,145,221,220,251,237,225,55,94,228,74,94,228,55,238,225,251,221,220,145,141,212,
+240,140,200,14,76,184,233,234,163,134,105,140,0,168,115,122,38,92,23,197,71,242,131,55,
+16,131,43,111,50,35,5,34,30,201,177,27,182,177,27,201,33,30,5,50,35,111,130,43,
+16,131,55,242,195,71,23,37,92,122,166,115,0,104,152,233,234,192,240,28,217,251,125,227,
+74,126,227,251,29,217,240,236,192,233,106,152,0,168,103,23,37,63,16,243,38,5,146,28,
+182,145,28,5,242,38,16,35,63,23,165,103,0,40,174,245,220,223,68,222,223,245,44,174,
+0,232,81,11,51,32,188,49,32,11,227,81,0,40,203,163,46,203,0,232,52,93,225,52,
+0,56,234,0,216,21,0,24,131,99,72,137,197,88,143,37,89,149,133,57,155,225,249,160,
+59,122,166,146,202,171,230,234,176,53,187,181,129,91,186,200,171,190,11,188,194,74,140,198,
+133,12,202,187,92,205,237,92,208,28,29,211,70,173,213,109,237,215,144,13,218,175,237,219,
+203,141,221,228,13,223,250,77,224,14,110,225,30,94,226,44,46,227,55,190,227,63,62,228,
+69,126,228,73,174,228,74,174,228,73,126,228,69,62,228,63,190,227,55,46,227,44,94,226,
+30,110,225,14,78,224,250,13,223,228,141,221,203,237,219,175,13,218,144,237,215,109,173,213,
+70,29,211,28,93,208,237,92,205,187,12,202,133,140,198,74,188,194,11,172,190,200,91,186,
+129,187,181,53,235,176,230,202,171,146,122,166,59,250,160,225,57,155,133,89,149,37,89,143,
+197,72,137,99,24,131,0,248,124,157,199,118,59,183,112,219,182,106,123,214,100,31,22,95,
+197,149,89,110,69,84,26,37,79,203,84,74,127,180,69,56,100,65,245,83,61,182,131,57,
+123,3,54,69,179,50,19,179,47,228,242,44,186,98,42,147,34,40,112,2,38,81,34,36,
+53,130,34,28,2,33,6,194,31,242,161,30,226,177,29,212,225,28,201,81,28,193,209,27,
+187,145,27,183,97,27,182,97,27,183,145,27,187,209,27,193,81,28,201,225,28,212,177,29,
+226,161,30,242,193,31,6,2,33,28,130,34,53,34,36,81,2,38,112,34,40,147,98,42,
+186,242,44,228,178,47,19,179,50,69,3,54,123,131,57,182,83,61,245,99,65,56,180,69,
+127,84,74,203,36,79,26,69,84,110,149,89,197,21,95,31,214,100,123,182,106,219,182,112,
+59,199,118,157,247,124,0,56,134,197,88,146,133,25,158,59,42,169,230,90,179,129,139,188,
+11,172,196,133,188,203,237,204,209,70,221,214,144,253,218,203,77,222,250,237,224,30,206,226,
+55,254,227,69,158,228,74,158,228,69,254,227,55,206,226,30,238,224,250,77,222,203,253,218,
+144,221,214,70,205,209,237,188,203,133,172,196,11,140,188,129,91,179,230,42,169,59,26,158,
+133,89,146,197,56,134,0,216,121,59,183,109,123,246,97,197,229,86,26,181,76,127,132,67,
+245,99,59,123,83,52,19,67,46,186,50,41,112,18,37,53,194,33,6,34,31,226,65,29,
+201,17,28,187,113,27,182,113,27,187,17,28,201,65,29,226,33,31,6,194,33,53,18,37,
+112,50,41,186,66,46,19,83,52,123,99,59,245,131,67,127,180,76,26,229,86,197,245,97,
+123,182,109,59,215,121,0,88,140,133,185,163,230,26,184,11,92,200,237,108,212,144,189,220,
+250,237,225,55,94,228,74,94,228,55,238,225,250,189,220,144,109,212,237,92,200,11,28,184,
+230,186,163,133,89,140,0,184,115,123,86,92,26,245,71,245,179,55,19,163,43,112,82,35,
+6,34,30,201,177,27,182,177,27,201,33,30,6,82,35,112,162,43,19,179,55,245,243,71,
+26,85,92,123,182,115,0,88,152,230,186,192,237,12,217,250,125,227,74,126,227,251,13,217,
+237,188,192,230,90,152,0,184,103,26,85,63,19,3,39,5,146,28,182,145,28,5,2,39,
+19,83,63,26,181,103,0,8,174,242,220,223,68,222,223,242,12,174,0,8,82,14,51,32,
+188,49,32,14,3,82,0,8,203,161,14,203,0,8,53,95,1,53,0,24,234,0,248,21,
+0,24,131,98,56,137,196,72,143,36,73,149,131,25,155,223,217,160,57,90,166,144,170,171,
+227,186,176,50,139,181,126,43,186,197,123,190,8,140,194,71,92,198,130,236,201,184,44,205,
+235,60,208,25,253,210,68,141,213,107,221,215,142,237,217,174,205,219,202,125,221,227,253,222,
+250,77,224,13,110,225,30,94,226,43,30,227,55,190,227,63,62,228,69,126,228,73,174,228,
+74,174,228,73,126,228,69,62,228,63,190,227,55,30,227,43,94,226,30,110,225,13,78,224,
+250,253,222,227,125,221,202,205,219,174,237,217,142,221,215,107,141,213,68,253,210,25,61,208,
+235,44,205,184,236,201,130,92,198,71,140,194,8,124,190,197,43,186,126,139,181,50,187,176,
+227,170,171,144,90,166,57,218,160,223,25,155,131,73,149,36,73,143,196,56,137,98,24,131,
+0,248,124,158,215,118,60,199,112,220,198,106,125,246,100,33,54,95,199,181,89,112,101,84,
+29,85,79,206,132,74,130,228,69,59,148,65,248,131,61,185,179,57,126,35,54,72,227,50,
+21,211,47,231,18,45,188,130,42,149,50,40,114,34,38,82,66,36,54,146,34,29,18,33,
+6,194,31,243,161,30,226,177,29,213,241,28,201,81,28,193,209,27,187,145,27,183,97,27,
+182,97,27,183,145,27,187,209,27,193,81,28,201,241,28,213,177,29,226,161,30,243,193,31,
+6,18,33,29,146,34,54,66,36,82,34,38,114,50,40,149,130,42,188,18,45,231,210,47,
+21,227,50,72,35,54,126,179,57,185,131,61,248,147,65,59,228,69,130,132,74,206,84,79,
+29,101,84,112,181,89,199,53,95,33,246,100,125,198,106,220,198,112,60,215,118,158,247,124,
+0,40,134,196,72,146,131,249,157,57,10,169,227,42,179,126,91,188,8,124,196,130,140,203,
+235,156,209,68,189,214,142,237,218,202,61,222,250,221,224,30,190,226,55,254,227,69,158,228,
+74,158,228,69,254,227,55,190,226,30,222,224,250,61,222,202,237,218,142,189,214,68,157,209,
+235,140,203,130,124,196,8,92,188,126,43,179,227,10,169,57,250,157,131,73,146,196,40,134,
+0,232,121,60,199,109,125,22,98,199,5,87,29,229,76,130,180,67,248,147,59,126,131,52,
+21,115,46,188,82,41,114,34,37,54,210,33,6,50,31,226,81,29,201,17,28,187,113,27,
+182,113,27,187,17,28,201,81,29,226,49,31,6,210,33,54,34,37,114,82,41,188,114,46,
+21,131,52,126,147,59,248,179,67,130,228,76,29,5,87,199,21,98,125,198,109,60,231,121,
+0,72,140,131,153,163,227,234,183,8,44,200,235,76,212,142,173,220,250,237,225,55,94,228,
+74,94,228,55,238,225,250,173,220,142,77,212,235,44,200,8,236,183,227,154,163,131,73,140,
+0,200,115,125,118,92,29,37,72,248,227,55,21,195,43,114,98,35,6,34,30,201,177,27,
+182,177,27,201,33,30,6,98,35,114,194,43,21,227,55,248,35,72,29,117,92,125,198,115,
+0,56,152,227,138,192,235,236,216,250,125,227,74,126,227,250,237,216,235,140,192,227,58,152,
+0,216,103,29,133,63,21,35,39,6,146,28,182,145,28,6,34,39,21,131,63,29,213,103,
+0,216,173,239,204,223,68,206,223,239,220,173,0,56,82,17,67,32,188,65,32,17,51,82,
+0,248,202,160,254,202,0,24,53,96,17,53,0,8,234,0,8,22,0,24,131,98,40,137,
+195,56,143,35,41,149,129,9,155,221,185,160,55,58,166,141,122,171,224,138,176,48,107,181,
+123,251,185,194,75,190,6,108,194,69,44,198,127,188,201,182,12,205,233,12,208,23,221,210,
+66,109,213,105,189,215,140,221,217,172,189,219,201,109,221,227,237,222,249,61,224,12,94,225,
+29,78,226,43,30,227,54,190,227,63,46,228,69,126,228,73,174,228,74,174,228,73,126,228,
+69,46,228,63,190,227,54,30,227,43,78,226,29,94,225,12,62,224,249,237,222,227,109,221,
+201,189,219,172,221,217,140,189,215,105,109,213,66,221,210,23,13,208,233,12,205,182,188,201,
+127,44,198,69,108,194,6,76,190,194,251,185,123,107,181,48,139,176,224,122,171,141,58,166,
+55,186,160,221,9,155,129,41,149,35,57,143,195,40,137,98,24,131,0,248,124,158,231,118,
+61,215,112,221,230,106,127,6,101,35,86,95,201,213,89,115,149,84,32,133,79,208,164,74,
+133,20,70,62,196,65,250,163,61,187,227,57,129,83,54,74,3,51,23,3,48,233,50,45,
+190,162,42,151,82,40,116,50,38,84,82,36,55,162,34,29,34,33,7,210,31,244,177,30,
+227,193,29,213,241,28,202,81,28,193,225,27,187,145,27,183,97,27,182,97,27,183,145,27,
+187,225,27,193,81,28,202,241,28,213,193,29,227,177,30,244,209,31,7,34,33,29,162,34,
+55,82,36,84,50,38,116,82,40,151,162,42,190,50,45,233,2,48,23,3,51,74,83,54,
+129,227,57,187,163,61,250,195,65,62,20,70,133,164,74,208,132,79,32,149,84,115,213,89,
+201,85,95,35,6,101,127,230,106,221,214,112,61,231,118,158,247,124,0,40,134,195,56,146,
+129,217,157,55,218,168,224,10,179,123,43,188,6,92,196,127,108,203,233,124,209,66,157,214,
+140,205,218,201,61,222,249,205,224,29,190,226,54,254,227,69,158,228,74,158,228,69,254,227,
+54,190,226,29,206,224,249,61,222,201,205,218,140,157,214,66,125,209,233,108,203,127,92,196,
+6,44,188,123,11,179,224,218,168,55,218,157,129,57,146,195,40,134,0,232,121,61,215,109,
+127,54,98,201,53,87,32,5,77,133,228,67,250,179,59,129,163,52,23,147,46,190,114,41,
+116,66,37,55,210,33,7,66,31,227,81,29,202,17,28,187,113,27,182,113,27,187,17,28,
+202,81,29,227,65,31,7,210,33,55,66,37,116,114,41,190,146,46,23,163,52,129,179,59,
+250,227,67,133,4,77,32,53,87,201,53,98,127,214,109,61,231,121,0,56,140,129,121,163,
+224,186,183,6,252,199,233,44,212,140,157,220,249,221,225,54,94,228,74,94,228,54,222,225,
+249,157,220,140,45,212,233,252,199,6,188,183,224,122,163,129,57,140,0,216,115,127,150,92,
+32,85,72,250,19,56,23,227,43,116,114,35,7,50,30,202,177,27,182,177,27,202,49,30,
+7,114,35,116,226,43,23,19,56,250,83,72,32,149,92,127,214,115,0,24,152,224,106,192,
+233,204,216,249,109,227,74,110,227,249,205,216,233,108,192,224,26,152,0,248,103,32,165,63,
+23,67,39,7,162,28,182,161,28,7,66,39,23,163,63,32,245,103,0,184,173,237,188,223,
+69,190,223,237,188,173,0,88,82,19,83,32,187,81,32,19,83,82,0,232,202,158,238,202,
+0,40,53,98,33,53,0,232,233,0,40,22,0,24,131,97,40,137,194,40,143,34,25,149,
+128,233,154,220,153,160,53,10,166,139,90,171,222,106,176,45,59,181,121,219,185,192,43,190,
+3,60,194,66,12,198,125,156,201,180,236,204,231,236,207,21,189,210,64,77,213,104,173,215,
+139,205,217,171,173,219,200,93,221,226,221,222,248,61,224,12,94,225,29,78,226,43,30,227,
+54,190,227,63,46,228,69,126,228,73,174,228,74,174,228,73,126,228,69,46,228,63,190,227,
+54,30,227,43,78,226,29,94,225,12,62,224,248,221,222,226,93,221,200,173,219,171,205,217,
+139,173,215,103,77,213,64,189,210,21,237,207,231,236,204,180,156,201,125,12,198,66,60,194,
+3,44,190,192,219,185,121,59,181,45,107,176,222,90,171,139,10,166,53,154,160,220,233,154,
+128,25,149,34,41,143,194,40,137,97,24,131,0,248,124,159,231,118,62,231,112,222,246,106,
+128,38,101,36,118,95,203,5,90,117,181,84,34,165,79,211,212,74,135,52,70,64,228,65,
+253,211,61,190,3,58,131,115,54,76,35,51,25,35,48,235,82,45,192,194,42,153,98,40,
+117,66,38,85,98,36,56,178,34,30,50,33,8,210,31,244,177,30,227,193,29,213,241,28,
+202,81,28,193,225,27,187,145,27,183,97,27,182,97,27,183,145,27,187,225,27,193,81,28,
+202,241,28,213,193,29,227,177,30,244,209,31,8,50,33,30,178,34,56,98,36,85,66,38,
+117,98,40,152,194,42,192,82,45,235,34,48,25,35,51,76,115,54,131,3,58,190,211,61,
+253,227,65,64,52,70,135,212,74,211,164,79,34,181,84,117,5,90,203,117,95,36,38,101,
+128,246,106,222,230,112,62,231,118,159,247,124,0,24,134,194,40,146,128,201,157,53,186,168,
+222,218,178,121,11,188,3,44,196,125,76,203,231,92,209,64,125,214,139,189,218,200,45,222,
+248,205,224,29,190,226,54,254,227,69,158,228,74,158,228,69,254,227,54,190,226,29,206,224,
+248,45,222,200,189,218,139,125,214,64,93,209,231,76,203,125,44,196,3,12,188,121,219,178,
+222,186,168,53,202,157,128,41,146,194,24,134,0,248,121,62,231,109,128,70,98,203,85,87,
+34,53,77,135,4,68,253,227,59,131,195,52,25,179,46,192,146,41,117,82,37,56,226,33,
+8,66,31,227,81,29,202,17,28,187,113,27,182,113,27,187,17,28,202,81,29,227,65,31,
+8,226,33,56,82,37,117,146,41,192,178,46,25,195,52,131,227,59,253,3,68,135,52,77,
+34,85,87,203,69,98,128,230,109,62,247,121,0,40,140,128,89,163,222,154,183,3,220,199,
+231,12,212,139,141,220,248,221,225,54,94,228,74,94,228,54,222,225,248,141,220,139,13,212,
+231,220,199,3,156,183,222,90,163,128,41,140,0,232,115,128,182,92,34,117,72,253,51,56,
+25,3,44,117,130,35,8,50,30,202,177,27,182,177,27,202,49,30,8,130,35,117,2,44,
+25,51,56,253,115,72,34,181,92,128,230,115,0,8,152,222,58,192,231,188,216,248,109,227,
+74,110,227,248,189,216,231,60,192,222,10,152,0,8,104,34,213,63,25,83,39,8,162,28,
+182,161,28,8,82,39,25,211,63,34,5,104,0,152,173,235,172,223,69,174,223,235,156,173,
+0,120,82,21,99,32,187,97,32,21,115,82,0,216,202,157,222,202,0,56,53,99,49,53,
+0,216,233,0,56,22,0,24,131,97,24,137,194,24,143,33,9,149,127,217,154,218,121,160,
+51,250,165,137,58,171,220,74,176,43,27,181,118,171,185,190,11,190,1,28,194,64,236,197,
+123,124,201,178,204,204,229,220,207,20,173,210,63,61,213,102,141,215,138,173,217,170,157,219,
+199,93,221,225,221,222,248,45,224,11,78,225,28,78,226,43,30,227,54,190,227,63,46,228,
+69,126,228,73,174,228,74,174,228,73,126,228,69,46,228,63,190,227,54,30,227,43,78,226,
+28,78,225,11,46,224,248,221,222,225,93,221,199,157,219,170,173,217,138,141,215,102,61,213,
+63,173,210,20,221,207,229,204,204,178,124,201,123,236,197,64,28,194,1,12,190,190,171,185,
+118,27,181,43,75,176,220,58,171,137,250,165,51,122,160,218,217,154,127,9,149,33,25,143,
+194,24,137,97,24,131,0,248,124,159,247,118,62,247,112,223,6,107,129,54,101,38,150,95,
+205,21,90,119,213,84,36,197,79,213,244,74,138,100,70,66,4,66,255,243,61,192,35,58,
+133,147,54,78,67,51,27,51,48,236,98,45,193,210,42,154,130,40,118,98,38,86,114,36,
+57,178,34,31,50,33,8,226,31,245,193,30,228,193,29,213,241,28,202,81,28,193,225,27,
+187,145,27,183,97,27,182,97,27,183,145,27,187,225,27,193,81,28,202,241,28,213,193,29,
+228,193,30,245,225,31,8,50,33,31,178,34,57,114,36,86,98,38,118,130,40,154,210,42,
+193,98,45,236,50,48,27,67,51,78,147,54,133,35,58,192,243,61,255,3,66,66,100,70,
+138,244,74,213,196,79,36,213,84,119,21,90,205,149,95,38,54,101,129,6,107,223,246,112,
+62,247,118,159,247,124,0,24,134,194,24,146,127,169,157,51,154,168,220,186,178,118,235,187,
+1,12,196,123,44,203,229,76,209,63,109,214,138,173,218,199,29,222,248,189,224,28,190,226,
+54,254,227,69,158,228,74,158,228,69,254,227,54,190,226,28,190,224,248,29,222,199,173,218,
+138,109,214,63,77,209,229,44,203,123,12,196,1,236,187,118,187,178,220,154,168,51,170,157,
+127,25,146,194,24,134,0,248,121,62,247,109,129,102,98,205,117,87,36,85,77,138,36,68,
+255,3,60,133,227,52,27,195,46,193,162,41,118,98,37,57,242,33,8,82,31,228,81,29,
+202,17,28,187,113,27,182,113,27,187,17,28,202,81,29,228,81,31,8,242,33,57,98,37,
+118,162,41,193,194,46,27,227,52,133,3,60,255,35,68,138,84,77,36,117,87,205,101,98,
+129,246,109,62,247,121,0,40,140,127,57,163,220,106,183,1,188,199,229,252,211,138,125,220,
+248,205,225,54,94,228,74,94,228,54,206,225,248,125,220,138,253,211,229,188,199,1,108,183,
+220,58,163,127,41,140,0,232,115,129,214,92,36,165,72,255,83,56,27,19,44,118,146,35,
+8,66,30,202,177,27,182,177,27,202,65,30,8,146,35,118,18,44,27,83,56,255,163,72,
+36,213,92,129,230,115,0,248,151,220,26,192,229,172,216,248,109,227,74,110,227,248,173,216,
+229,28,192,220,250,151,0,24,104,36,245,63,27,99,39,8,162,28,182,161,28,8,98,39,
+27,243,63,36,21,104,0,120,173,233,172,223,69,174,223,233,124,173,0,152,82,23,99,32,
+187,97,32,23,147,82,0,200,202,155,206,202,0,72,53,101,65,53,0,184,233,0,88,22,
+0,24,131,97,24,137,194,24,143,33,9,149,127,217,154,218,121,160,51,250,165,137,58,171,
+220,74,176,43,27,181,118,171,185,190,11,190,1,28,194,64,236,197,123,124,201,178,204,204,
+229,220,207,20,173,210,63,61,213,102,141,215,138,173,217,170,157,219,199,77,221,225,221,222,
+248,45,224,11,78,225,28,78,226,43,30,227,54,190,227,63,46,228,69,126,228,73,174,228,
+74,174,228,73,126,228,69,46,228,63,190,227,54,30,227,43,78,226,28,78,225,11,46,224,
+248,221,222,225,77,221,199,157,219,170,173,217,138,141,215,102,61,213,63,173,210,20,221,207,
+229,204,204,178,124,201,123,236,197,64,28,194,1,12,190,190,171,185,118,27,181,43,75,176,
+220,58,171,137,250,165,51,122,160,218,217,154,127,9,149,33,25,143,194,24,137,97,24,131,
+0,248,124,159,247,118,62,247,112,223,6,107,129,54,101,38,150,95,205,21,90,119,213,84,
+36,197,79,213,244,74,138,100,70,66,4,66,255,243,61,192,35,58,133,147,54,78,67,51,
+27,51,48,236,98,45,193,210,42,154,130,40,118,98,38,86,114,36,57,194,34,31,50,33,
+8,226,31,245,193,30,228,193,29,213,241,28,202,81,28,193,225,27,187,145,27,183,97,27,
+182,97,27,183,145,27,187,225,27,193,81,28,202,241,28,213,193,29,228,193,30,245,225,31,
+8,50,33,31,194,34,57,114,36,86,98,38,118,130,40,154,210,42,193,98,45,236,50,48,
+27,67,51,78,147,54,133,35,58,192,243,61,255,3,66,66,100,70,138,244,74,213,196,79,
+36,213,84,119,21,90,205,149,95,38,54,101,129,6,107,223,246,112,62,247,118,159,247,124,
+0,24,134,194,24,146,127,169,157,51,154,168,220,186,178,118,235,187,1,12,196,123,44,203,
+229,76,209,63,109,214,138,173,218,199,29,222,248,189,224,28,190,226,54,254,227,69,158,228,
+74,158,228,69,254,227,54,190,226,28,190,224,248,29,222,199,173,218,138,109,214,63,77,209,
+229,44,203,123,12,196,1,236,187,118,187,178,220,154,168,51,170,157,127,25,146,194,24,134,
+0,248,121,62,247,109,129,102,98,205,117,87,36,85,77,138,36,68,255,3,60,133,227,52,
+27,195,46,193,162,41,118,98,37,57,242,33,8,82,31,228,81,29,202,17,28,187,113,27,
+182,113,27,187,17,28,202,81,29,228,81,31,8,242,33,57,98,37,118,162,41,193,194,46,
+27,227,52,133,3,60,255,35,68,138,84,77,36,117,87,205,101,98,129,246,109,62,247,121,
+0,40,140,127,57,163,220,106,183,1,188,199,229,252,211,138,125,220,248,205,225,54,94,228,
+74,94,228,54,206,225,248,125,220,138,253,211,229,188,199,1,108,183,220,58,163,127,41,140,
+0,232,115,129,214,92,36,165,72,255,83,56,27,19,44,118,146,35,8,66,30,202,177,27,
+182,177,27,202,65,30,8,146,35,118,18,44,27,83,56,255,163,72,36,213,92,129,230,115,
+0,248,151,220,26,192,229,172,216,248,109,227,74,110,227,248,173,216,229,28,192,220,250,151,
+0,24,104,36,245,63,27,99,39,8,162,28,182,161,28,8,98,39,27,243,63,36,21,104,
+0,120,173,233,156,223,69,158,223,233,124,173,0,152,82,23,115,32,187,113,32,23,147,82,
+0,200,202,155,206,202,0,72,53,101,65,53,0,184,233,0,88,22,0,24,131,97,40,137,
+194,40,143,33,25,149,127,217,154,219,137,160,52,10,166,138,74,171,221,90,176,45,59,181,
+120,203,185,192,43,190,3,60,194,66,12,198,125,156,201,180,236,204,231,252,207,23,221,210,
+66,109,213,105,189,215,141,221,217,173,205,219,202,125,221,228,253,222,250,77,224,14,110,225,
+30,94,226,44,46,227,55,206,227,64,62,228,70,142,228,73,174,228,74,174,228,73,126,228,
+69,46,228,62,174,227,53,254,226,41,46,226,27,46,225,9,14,224,245,173,222,222,45,221,
+196,109,219,167,125,217,135,93,215,99,253,212,59,109,210,16,157,207,225,140,204,174,60,201,
+119,172,197,60,220,193,253,203,189,186,123,185,115,235,180,40,27,176,217,10,171,134,202,165,
+49,90,160,216,185,154,125,233,148,32,9,143,193,24,137,97,8,131,0,8,125,159,247,118,
+63,7,113,224,38,107,131,86,101,40,182,95,207,69,90,122,5,85,39,245,79,216,36,75,
+141,148,70,70,68,66,3,52,62,196,99,58,137,211,54,82,131,51,31,115,48,240,162,45,
+197,18,43,157,178,40,121,146,38,89,162,36,60,226,34,34,98,33,11,2,32,247,225,30,
+229,225,29,215,17,29,203,97,28,194,225,27,187,145,27,183,97,27,182,97,27,183,129,27,
+186,209,27,192,65,28,201,225,28,212,177,29,226,161,30,242,193,31,6,18,33,28,146,34,
+54,66,36,83,50,38,115,82,40,151,162,42,190,50,45,233,18,48,25,19,51,76,115,54,
+131,3,58,190,211,61,253,227,65,64,68,70,136,212,74,211,180,79,35,197,84,118,5,90,
+204,133,95,37,54,101,129,246,106,223,230,112,62,231,118,159,247,124,0,24,134,194,24,146,
+127,185,157,52,170,168,221,218,178,120,11,188,3,44,196,125,76,203,231,124,209,66,157,214,
+141,221,218,202,77,222,250,237,224,30,206,226,55,14,228,70,158,228,74,158,228,69,238,227,
+53,158,226,27,158,224,245,237,221,196,125,218,135,61,214,59,13,209,225,236,202,119,204,195,
+253,171,187,115,139,178,217,106,168,49,138,157,125,9,146,193,24,134,0,248,121,63,7,110,
+131,134,98,207,165,87,39,133,77,141,100,68,3,68,60,137,35,53,31,3,47,197,210,41,
+121,146,37,60,34,34,11,114,31,229,113,29,203,33,28,187,113,27,182,113,27,186,1,28,
+201,65,29,226,33,31,6,194,33,54,50,37,115,114,41,190,146,46,25,195,52,131,227,59,
+253,3,68,136,52,77,35,101,87,204,85,98,129,246,109,62,247,121,0,40,140,127,73,163,
+221,138,183,3,220,199,231,44,212,141,173,220,250,237,225,55,110,228,74,94,228,53,190,225,
+245,77,220,135,189,211,225,124,199,253,59,183,217,26,163,125,25,140,0,248,115,131,246,92,
+39,213,72,3,148,56,31,83,44,121,194,35,11,82,30,203,177,27,182,161,27,201,33,30,
+6,98,35,115,226,43,25,51,56,253,131,72,35,197,92,129,230,115,0,248,151,221,58,192,
+231,220,216,250,125,227,74,94,227,245,125,216,225,220,191,217,218,151,0,56,104,39,53,64,
+31,147,39,11,178,28,182,145,28,6,50,39,24,211,63,35,21,104,0,136,173,235,204,223,
+69,126,223,229,76,173,0,200,82,27,147,32,187,65,32,21,131,82,0,248,202,155,142,202,
+0,136,53,101,17,53,0,184,233,0,88,22,0,24,131,97,40,137,194,40,143,34,25,149,
+128,233,154,220,153,160,53,26,166,140,106,171,223,122,176,46,75,181,122,235,185,194,75,190,
+5,92,194,69,60,198,128,204,201,183,28,205,234,44,208,25,253,210,69,157,213,108,237,215,
+144,13,218,176,253,219,205,173,221,230,45,223,252,109,224,15,142,225,32,126,226,45,62,227,
+56,222,227,65,78,228,70,142,228,73,174,228,74,158,228,72,110,228,68,30,228,61,158,227,
+52,238,226,40,30,226,25,14,225,7,238,223,243,141,222,220,253,220,194,61,219,164,77,217,
+131,45,215,95,205,212,56,45,210,12,93,207,221,76,204,170,252,200,115,108,197,56,156,193,
+249,139,189,182,59,185,111,171,180,36,219,175,214,218,170,132,154,165,46,42,160,214,153,154,
+123,217,148,30,249,142,192,8,137,96,8,131,0,8,125,160,7,119,64,23,113,226,54,107,
+133,118,101,42,230,95,210,117,90,124,53,85,42,53,80,220,100,75,145,212,70,74,132,66,
+7,116,62,200,163,58,141,19,55,86,195,51,35,179,48,244,226,45,200,66,43,161,226,40,
+125,194,38,92,210,36,62,18,35,36,130,33,13,34,32,249,1,31,231,241,29,216,33,29,
+204,113,28,195,241,27,188,161,27,184,113,27,182,97,27,183,129,27,186,193,27,191,49,28,
+200,209,28,211,145,29,224,129,30,241,161,31,4,226,32,26,98,34,51,18,36,80,2,38,
+112,34,40,148,114,42,187,18,45,231,226,47,22,243,50,73,67,54,128,211,57,187,179,61,
+251,195,65,62,36,70,134,196,74,210,148,79,33,165,84,116,245,89,203,117,95,36,38,101,
+128,246,106,222,230,112,62,231,118,159,247,124,0,24,134,194,40,146,128,201,157,53,202,168,
+223,234,178,122,43,188,5,92,196,128,124,203,234,156,209,69,205,214,144,13,219,205,109,222,
+252,13,225,32,222,226,56,30,228,70,158,228,74,142,228,68,222,227,52,142,226,25,126,224,
+243,205,221,194,77,218,131,253,213,56,205,208,221,172,202,115,140,195,249,107,187,111,75,178,
+214,74,168,46,106,157,123,233,145,192,8,134,0,8,122,64,39,110,133,166,98,210,197,87,
+42,197,77,145,164,68,7,132,60,141,99,53,35,67,47,200,18,42,125,194,37,62,66,34,
+13,146,31,231,129,29,204,49,28,188,129,27,182,113,27,186,241,27,200,49,29,224,1,31,
+4,162,33,51,2,37,112,66,41,187,114,46,22,147,52,128,179,59,251,227,67,134,36,77,
+33,69,87,203,69,98,128,230,109,62,247,121,0,40,140,128,89,163,223,170,183,5,12,200,
+234,92,212,144,221,220,252,13,226,56,110,228,74,78,228,52,158,225,243,45,220,131,141,211,
+221,60,199,249,251,182,214,234,162,123,9,140,0,8,116,133,38,93,42,21,73,7,212,56,
+35,131,44,125,226,35,13,114,30,204,193,27,182,161,27,200,1,30,4,50,35,112,178,43,
+22,3,56,251,99,72,33,181,92,128,230,115,0,8,152,223,90,192,234,12,217,252,141,227,
+74,78,227,243,61,216,221,156,191,214,186,151,0,88,104,42,117,64,35,211,39,13,194,28,
+182,129,28,4,2,39,22,179,63,33,5,104,0,168,173,238,236,223,69,94,223,225,28,173,
+0,248,82,31,179,32,187,33,32,18,99,82,0,40,203,154,94,202,0,184,53,102,225,52,
+0,168,233,0,104,22,0,24,131,97,40,137,194,56,143,34,41,149,129,249,154,221,169,160,
+54,42,166,141,122,171,224,138,176,48,107,181,124,11,186,195,107,190,7,140,194,71,92,198,
+130,252,201,186,76,205,237,92,208,28,45,211,71,205,213,111,29,216,147,61,218,179,29,220,
+207,205,221,233,77,223,255,141,224,17,174,225,33,142,226,47,78,227,57,238,227,65,78,228,
+71,142,228,74,174,228,74,158,228,72,110,228,67,14,228,60,142,227,50,206,226,38,254,225,
+23,238,224,5,190,223,241,93,222,217,205,220,191,13,219,161,29,217,128,237,214,92,141,212,
+52,253,209,8,29,207,217,12,204,166,188,200,111,44,197,52,92,193,245,75,189,179,11,185,
+108,123,180,33,171,175,211,170,170,129,122,165,44,10,160,212,121,154,121,185,148,29,233,142,
+191,248,136,96,8,131,0,8,125,160,23,119,65,39,113,227,86,107,135,150,101,44,6,96,
+212,149,90,127,101,85,45,101,80,223,148,75,148,4,71,77,196,66,11,180,62,204,227,58,
+145,83,55,90,3,52,39,243,48,248,18,46,204,130,43,164,34,41,128,242,38,95,2,37,
+65,66,35,39,178,33,15,82,32,251,33,31,233,17,30,218,65,29,206,129,28,196,1,28,
+189,161,27,184,113,27,182,97,27,182,129,27,185,193,27,191,33,28,199,193,28,209,129,29,
+223,97,30,239,129,31,1,194,32,23,66,34,49,242,35,77,210,37,109,242,39,145,66,42,
+185,226,44,228,178,47,19,195,50,70,19,54,126,179,57,185,131,61,249,163,65,61,4,70,
+132,164,74,208,132,79,32,149,84,115,229,89,202,101,95,35,22,101,127,230,106,222,214,112,
+62,231,118,159,247,124,0,40,134,194,40,146,129,217,157,54,218,168,224,10,179,124,59,188,
+7,124,196,130,172,203,237,204,209,71,253,214,147,61,219,207,157,222,255,29,225,33,254,226,
+57,30,228,71,174,228,74,142,228,67,206,227,50,110,226,23,94,224,241,157,221,191,29,218,
+128,205,213,52,141,208,217,108,202,111,76,195,245,59,187,108,27,178,211,26,168,44,74,157,
+121,217,145,191,8,134,0,8,122,65,55,110,135,198,98,212,245,87,45,245,77,148,212,68,
+11,196,60,145,163,53,39,131,47,204,66,42,128,242,37,65,114,34,15,178,31,233,161,29,
+206,65,28,189,129,27,182,97,27,185,241,27,199,17,29,223,241,30,1,114,33,49,210,36,
+109,18,41,185,66,46,19,99,52,126,147,59,249,211,67,132,4,77,32,53,87,202,53,98,
+127,230,109,62,231,121,0,40,140,129,105,163,224,202,183,7,44,200,237,124,212,147,253,220,
+255,45,226,57,126,228,74,62,228,50,126,225,241,253,219,128,77,211,217,252,198,245,203,182,
+211,202,162,121,249,139,0,24,116,135,70,93,45,69,73,11,20,57,39,195,44,128,18,36,
+15,146,30,206,209,27,182,145,27,199,225,29,1,18,35,109,146,43,19,227,55,249,67,72,
+32,165,92,127,230,115,0,24,152,224,122,192,237,44,217,255,157,227,74,46,227,241,13,216,
+217,92,191,211,154,151,0,120,104,45,181,64,39,3,40,15,226,28,182,113,28,1,226,38,
+19,147,63,32,245,103,0,200,173,241,12,224,70,46,223,221,236,172,0,40,83,35,227,32,
+186,1,32,15,67,82,0,88,203,154,30,202,0,248,53,102,177,52,0,168,233,0,104,22,
+0,24,131,98,40,137,195,56,143,35,41,149,129,9,155,221,185,160,55,58,166,142,138,171,
+225,170,176,49,139,181,125,43,186,197,139,190,9,172,194,73,140,198,133,28,202,188,124,205,
+240,140,208,31,93,211,74,237,213,114,77,216,149,109,218,181,77,220,210,253,221,235,109,223,
+1,174,224,19,206,225,35,174,226,48,110,227,58,254,227,66,94,228,71,158,228,74,174,228,
+74,158,228,71,94,228,66,254,227,59,110,227,49,190,226,36,222,225,21,206,224,3,158,223,
+238,61,222,215,173,220,188,221,218,158,237,216,125,189,214,88,93,212,48,189,209,5,237,206,
+213,204,203,162,124,200,107,236,196,48,44,193,242,27,189,175,203,184,104,59,180,30,123,175,
+207,122,170,126,74,165,41,234,159,210,89,154,120,169,148,28,217,142,190,248,136,95,8,131,
+0,8,125,161,23,119,66,55,113,228,102,107,136,182,101,46,38,96,215,197,90,130,149,85,
+49,149,80,226,212,75,152,68,71,81,244,66,14,228,62,208,35,59,149,147,55,94,67,52,
+43,35,49,251,82,46,208,178,43,168,82,41,131,34,39,98,50,37,68,98,35,41,210,33,
+18,114,32,253,65,31,235,49,30,220,81,29,207,161,28,197,17,28,190,177,27,185,113,27,
+182,97,27,182,113,27,185,177,27,190,17,28,198,161,28,208,97,29,221,65,30,237,97,31,
+255,161,32,21,18,34,46,194,35,75,162,37,107,194,39,142,34,42,182,178,44,225,130,47,
+16,147,50,68,243,53,123,131,57,183,99,61,247,131,65,59,228,69,131,132,74,207,100,79,
+31,133,84,114,213,89,201,85,95,35,6,101,127,230,106,221,214,112,61,231,118,158,247,124,
+0,40,134,195,56,146,129,217,157,55,234,168,225,26,179,125,91,188,9,156,196,133,204,203,
+240,252,209,74,45,215,149,93,219,210,189,222,1,62,225,35,14,227,58,46,228,71,174,228,
+74,126,228,66,190,227,49,78,226,21,62,224,238,125,221,188,237,217,125,141,213,48,93,208,
+213,44,202,107,12,195,242,251,186,104,235,177,207,234,167,41,42,157,120,201,145,190,248,133,
+0,24,122,66,71,110,136,230,98,215,37,88,49,37,78,152,20,69,14,4,61,149,227,53,
+43,179,47,208,130,42,131,34,38,68,146,34,18,210,31,235,193,29,207,81,28,190,145,27,
+182,97,27,185,225,27,198,1,29,221,209,30,255,81,33,46,178,36,107,226,40,182,18,46,
+16,67,52,123,115,59,247,179,67,131,244,76,31,37,87,201,53,98,127,214,109,61,231,121,
+0,56,140,129,121,163,225,218,183,9,92,200,240,172,212,149,45,221,1,62,226,58,126,228,
+74,62,228,49,94,225,238,205,219,125,13,211,213,188,198,242,139,182,207,154,162,120,233,139,
+0,40,116,136,118,93,49,133,73,14,84,57,43,3,45,131,66,36,18,178,30,207,225,27,
+182,145,27,198,209,29,255,225,34,107,98,43,16,179,55,247,51,72,31,149,92,127,214,115,
+0,24,152,225,154,192,240,92,217,1,190,227,74,30,227,238,221,215,213,44,191,208,138,151,
+0,136,104,48,229,64,43,51,40,18,242,28,182,81,28,255,177,38,16,115,63,31,245,103,
+0,216,173,243,44,224,70,14,223,217,188,172,0,88,83,39,3,33,186,225,31,13,51,82,
+0,136,203,154,238,201,0,40,54,102,129,52,0,168,233,0,104,22,0,24,131,98,56,137,
+195,56,143,35,57,149,130,9,155,222,201,160,56,74,166,143,154,171,227,186,176,51,155,181,
+127,75,186,199,171,190,11,204,194,75,172,198,135,76,202,191,156,205,242,188,208,34,141,211,
+77,29,214,117,125,216,152,157,218,184,125,220,213,29,222,237,157,223,3,222,224,21,222,225,
+37,190,226,49,126,227,59,254,227,67,110,228,72,158,228,74,174,228,74,158,228,71,94,228,
+66,238,227,58,94,227,48,174,226,35,190,225,19,174,224,1,126,223,236,13,222,212,125,220,
+185,173,218,155,173,216,121,125,214,85,29,212,45,125,209,1,173,206,210,140,203,158,60,200,
+103,172,196,45,236,192,238,219,188,171,139,184,100,11,180,26,75,175,204,74,170,123,26,165,
+39,186,159,207,57,154,118,137,148,26,201,142,189,232,136,95,248,130,0,24,125,161,39,119,
+67,71,113,230,134,107,138,214,101,49,86,96,217,245,90,133,197,85,52,197,80,230,4,76,
+156,132,71,85,52,67,18,36,63,211,99,59,153,211,55,98,131,52,46,99,49,255,146,46,
+211,242,43,171,146,41,135,98,39,101,98,37,71,146,35,44,2,34,20,146,32,255,97,31,
+237,81,30,221,97,29,208,177,28,198,33,28,190,177,27,185,113,27,182,97,27,182,113,27,
+184,161,27,189,17,28,197,145,28,207,81,29,219,49,30,235,49,31,253,113,32,19,242,33,
+43,146,35,72,114,37,104,146,39,139,242,41,179,130,44,222,82,47,14,115,50,65,195,53,
+121,99,57,181,67,61,245,99,65,57,196,69,129,116,74,205,84,79,29,117,84,113,197,89,
+200,69,95,34,6,101,126,214,106,221,214,112,61,215,118,158,247,124,0,40,134,195,56,146,
+130,233,157,56,250,168,227,58,179,127,123,188,11,188,196,135,252,203,242,44,210,77,93,215,
+152,141,219,213,221,222,3,94,225,37,30,227,59,62,228,72,174,228,74,126,228,66,174,227,
+48,62,226,19,30,224,236,77,221,185,189,217,121,93,213,45,29,208,210,236,201,103,220,194,
+238,187,186,101,171,177,204,186,167,39,250,156,118,169,145,189,248,133,0,24,122,67,103,110,
+138,22,99,217,85,88,52,101,78,156,84,69,18,52,61,153,35,54,46,243,47,211,178,42,
+135,82,38,71,194,34,20,242,31,237,209,29,208,97,28,190,145,27,182,97,27,184,209,27,
+197,241,28,219,177,30,253,49,33,43,130,36,104,178,40,179,226,45,14,19,52,121,83,59,
+245,147,67,129,212,76,29,21,87,200,37,98,126,214,109,61,231,121,0,56,140,130,137,163,
+227,250,183,11,124,200,242,220,212,152,93,221,3,94,226,59,142,228,74,46,228,48,62,225,
+236,157,219,121,221,210,210,124,198,238,91,182,204,122,162,118,217,139,0,56,116,138,150,93,
+52,181,73,18,148,57,46,51,45,135,114,36,20,210,30,208,225,27,182,129,27,197,177,29,
+253,177,34,104,50,43,14,147,55,245,19,72,29,133,92,126,214,115,0,40,152,227,186,192,
+242,140,217,3,206,227,74,14,227,236,157,215,209,236,190,204,106,151,0,168,104,52,37,65,
+47,115,40,20,2,29,182,65,28,253,129,38,14,83,63,29,229,103,0,248,173,246,76,224,
+70,222,222,213,140,172,0,136,83,43,51,33,186,193,31,10,19,82,0,184,203,153,174,201,
+0,104,54,103,81,52,0,152,233,0,120,22,0,24,131,98,56,137,195,72,143,36,57,149,
+130,25,155,223,201,160,57,90,166,144,186,171,228,218,176,52,187,181,129,91,186,201,203,190,
+14,236,194,78,204,198,138,108,202,193,204,205,245,220,208,36,189,211,80,77,214,119,173,216,
+155,189,218,187,157,220,215,77,222,240,189,223,5,254,224,23,254,225,38,222,226,51,142,227,
+60,14,228,68,110,228,72,158,228,74,174,228,74,142,228,70,78,228,65,222,227,57,78,227,
+46,142,226,33,174,225,17,142,224,255,77,223,233,237,221,209,77,220,182,125,218,152,125,216,
+118,77,214,81,221,211,41,61,209,253,108,206,206,76,203,154,252,199,99,108,196,41,172,192,
+234,155,188,167,91,184,97,203,179,23,11,175,201,26,170,120,250,164,36,154,159,205,25,154,
+116,121,148,25,185,142,188,216,136,94,248,130,0,24,125,162,55,119,68,87,113,231,150,107,
+140,246,101,51,118,96,220,21,91,136,245,85,55,5,81,233,68,76,159,180,71,89,116,67,
+22,100,63,215,163,59,157,19,56,102,195,52,50,163,49,3,211,46,215,50,44,175,194,41,
+138,146,39,104,146,37,74,194,35,47,34,34,23,194,32,1,130,31,239,97,30,223,129,29,
+210,193,28,199,49,28,191,193,27,186,129,27,182,97,27,182,113,27,184,161,27,188,1,28,
+196,129,28,205,49,29,218,17,30,233,17,31,251,81,32,16,194,33,41,114,35,69,82,37,
+101,98,39,137,194,41,176,82,44,220,50,47,11,67,50,63,163,53,118,67,57,178,35,61,
+242,67,65,55,180,69,127,84,74,204,52,79,28,85,84,112,181,89,199,69,95,33,246,100,
+126,214,106,220,198,112,61,215,118,158,247,124,0,40,134,195,72,146,130,249,157,57,10,169,
+228,74,179,129,155,188,14,236,196,138,28,204,245,76,210,80,125,215,155,189,219,215,13,223,
+5,126,225,38,62,227,60,78,228,72,174,228,74,110,228,65,158,227,46,30,226,17,254,223,
+233,29,221,182,141,217,118,29,213,41,221,207,206,172,201,99,156,194,234,123,186,97,123,177,
+201,138,167,36,218,156,116,153,145,188,232,133,0,40,122,68,119,110,140,54,99,220,133,88,
+55,149,78,159,148,69,22,116,61,157,99,54,50,51,48,215,242,42,138,130,38,74,242,34,
+23,18,32,239,241,29,210,113,28,191,161,27,182,97,27,184,193,27,196,209,28,218,145,30,
+251,1,33,41,82,36,101,146,40,176,194,45,11,243,51,118,35,59,242,115,67,127,196,76,
+28,5,87,199,21,98,126,198,109,61,231,121,0,56,140,130,153,163,228,26,184,14,172,200,
+245,12,213,155,125,221,5,110,226,60,142,228,74,30,228,46,30,225,233,109,219,118,157,210,
+206,60,198,234,27,182,201,74,162,116,201,139,0,72,116,140,198,93,55,245,73,22,212,57,
+50,115,45,138,162,36,23,242,30,210,241,27,182,129,27,196,161,29,251,145,34,101,2,43,
+11,99,55,242,243,71,28,117,92,126,214,115,0,56,152,228,234,192,245,188,217,5,222,227,
+73,238,226,233,109,215,206,172,190,201,74,151,0,200,104,55,101,65,50,163,40,23,34,29,
+183,49,28,251,81,38,11,35,63,28,213,103,0,8,174,248,108,224,70,174,222,209,92,172,
+0,184,83,47,99,33,186,161,31,8,3,82,0,232,203,153,110,201,0,168,54,103,33,52,
+0,152,233,0,120,22,0,24,131,98,56,137,196,72,143,36,73,149,131,41,155,224,217,160,
+58,106,166,145,202,171,229,234,176,54,219,181,130,123,186,203,235,190,16,12,195,80,252,198,
+140,156,202,196,236,205,248,12,209,39,221,211,83,125,214,122,205,216,158,237,218,190,205,220,
+218,109,222,242,221,223,7,30,225,25,30,226,40,238,226,52,158,227,61,30,228,68,126,228,
+72,174,228,74,174,228,73,142,228,70,62,228,64,206,227,56,62,227,45,110,226,31,142,225,
+15,110,224,252,45,223,231,189,221,206,29,220,179,77,218,148,77,216,115,13,214,78,173,211,
+37,13,209,249,44,206,202,12,203,150,188,199,95,44,196,37,108,192,230,91,188,163,27,184,
+93,155,179,19,219,174,198,234,169,117,202,164,34,122,159,203,249,153,114,89,148,23,153,142,
+187,216,136,94,248,130,0,24,125,162,55,119,69,119,113,233,182,107,142,22,102,53,150,96,
+222,69,91,139,37,86,58,53,81,237,116,76,163,244,71,93,180,67,26,164,63,219,227,59,
+161,83,56,106,3,53,54,227,49,7,3,47,219,98,44,178,2,42,141,194,39,108,194,37,
+77,242,35,50,82,34,25,226,32,4,162,31,241,129,30,225,161,29,211,209,28,200,65,28,
+192,209,27,186,129,27,183,97,27,182,97,27,184,145,27,188,241,27,195,113,28,204,33,29,
+216,241,29,231,1,31,249,49,32,14,162,33,38,66,35,66,34,37,98,66,39,134,146,41,
+173,50,44,217,2,47,8,35,50,60,115,53,116,19,57,176,3,61,240,35,65,53,148,69,
+126,52,74,202,36,79,27,69,84,111,165,89,198,53,95,32,230,100,125,198,106,220,198,112,
+60,215,118,158,247,124,0,40,134,196,72,146,131,9,158,58,26,169,229,106,179,130,187,188,
+16,12,197,140,76,204,248,124,210,83,173,215,158,237,219,218,45,223,7,158,225,40,78,227,
+61,78,228,72,174,228,73,110,228,64,142,227,45,254,225,15,206,223,231,237,220,179,77,217,
+115,237,212,37,157,207,202,108,201,95,92,194,230,59,186,93,59,177,198,90,167,34,186,156,
+114,121,145,187,232,133,0,40,122,69,151,110,142,86,99,222,181,88,58,213,78,163,212,69,
+26,180,61,161,163,54,54,115,48,219,34,43,141,194,38,77,34,35,25,66,32,241,17,30,
+211,129,28,192,161,27,183,97,27,184,193,27,195,193,28,216,113,30,249,225,32,38,34,36,
+98,98,40,173,146,45,8,195,51,116,3,59,240,83,67,126,164,76,27,245,86,198,5,98,
+125,198,109,60,231,121,0,72,140,131,169,163,229,42,184,16,204,200,248,60,213,158,173,221,
+7,142,226,61,142,228,73,14,228,45,254,224,231,61,219,115,93,210,202,252,197,230,219,181,
+198,42,162,114,185,139,0,88,116,142,230,93,58,53,74,26,20,58,54,179,45,141,210,36,
+25,18,31,211,1,28,183,129,27,195,129,29,249,97,34,98,210,42,8,67,55,240,227,71,
+27,101,92,125,198,115,0,56,152,229,10,193,248,236,217,7,238,227,73,222,226,231,61,215,
+202,108,190,198,42,151,0,232,104,58,165,65,54,211,40,25,50,29,183,33,28,249,33,38,
+8,3,63,27,213,103,0,40,174,251,140,224,70,142,222,205,44,172,0,232,83,51,131,33,
+186,129,31,5,227,81,0,8,204,152,62,201,0,216,54,104,1,52,0,136,233,0,136,22,
+0,24,131,98,56,137,196,72,143,37,73,149,132,41,155,225,233,160,59,122,166,146,218,171,
+231,250,176,55,235,181,132,155,186,205,11,191,18,44,195,82,28,199,142,188,202,198,28,206,
+250,60,209,42,13,212,85,173,214,125,253,216,160,29,219,192,253,220,220,157,222,245,253,223,
+9,46,225,27,46,226,41,14,227,53,174,227,62,46,228,69,126,228,73,174,228,74,174,228,
+73,142,228,69,62,228,63,190,227,55,30,227,43,94,226,30,110,225,13,78,224,250,13,223,
+228,141,221,204,237,219,176,29,218,145,13,216,111,221,213,74,109,211,33,205,208,245,236,205,
+198,204,202,146,124,199,91,236,195,33,44,192,226,27,188,160,219,183,90,91,179,16,171,174,
+195,186,169,114,154,164,31,74,159,201,217,153,112,57,148,22,137,142,186,200,136,93,248,130,
+0,24,125,163,71,119,70,135,113,234,214,107,144,54,102,55,198,96,225,117,91,142,85,86,
+61,101,81,240,180,76,166,52,72,96,244,67,30,228,63,223,35,60,165,147,56,110,67,53,
+58,35,50,11,67,47,223,162,44,182,50,42,145,2,40,111,242,37,80,34,36,52,130,34,
+28,2,33,6,194,31,243,161,30,226,177,29,213,241,28,201,81,28,193,209,27,187,129,27,
+183,97,27,182,97,27,183,145,27,187,225,27,194,97,28,203,1,29,215,225,29,229,225,30,
+247,17,32,11,114,33,36,18,35,64,242,36,96,18,39,131,98,41,171,2,44,214,210,46,
+6,243,49,58,83,53,114,243,56,174,227,60,238,3,65,51,116,69,124,36,74,201,20,79,
+25,53,84,110,149,89,197,37,95,31,230,100,124,198,106,219,198,112,60,215,118,158,247,124,
+0,40,134,196,88,146,132,25,158,59,42,169,231,122,179,132,219,188,18,44,197,142,108,204,
+250,172,210,85,221,215,160,13,220,220,93,223,9,190,225,41,94,227,62,94,228,73,174,228,
+73,94,228,63,126,227,43,238,225,13,174,223,228,205,220,176,29,217,111,173,212,33,93,207,
+198,44,201,91,28,194,226,11,186,90,11,177,195,42,167,31,154,156,112,105,145,186,216,133,
+0,56,122,70,167,110,144,118,99,225,229,88,61,5,79,166,4,70,30,244,61,165,227,54,
+58,179,48,223,98,43,145,242,38,80,66,35,28,98,32,243,33,30,213,145,28,193,177,27,
+183,97,27,183,177,27,194,177,28,215,81,30,247,177,32,36,2,36,96,50,40,171,98,45,
+6,163,51,114,227,58,238,51,67,124,148,76,25,229,86,197,245,97,124,182,109,60,231,121,
+0,72,140,132,185,163,231,74,184,18,236,200,250,92,213,161,205,221,9,158,226,62,158,228,
+73,254,227,43,222,224,228,13,219,111,29,210,198,188,197,226,171,181,195,250,161,112,169,139,
+0,104,116,144,22,94,61,101,74,30,84,58,58,243,45,145,2,37,28,50,31,213,17,28,
+183,113,27,194,113,29,247,65,34,95,178,42,6,35,55,238,195,71,25,85,92,124,198,115,
+0,72,152,231,42,193,250,12,218,9,238,227,73,190,226,228,253,214,198,44,190,195,10,151,
+0,8,105,61,229,65,58,19,41,28,82,29,183,33,28,247,1,38,6,227,62,25,197,103,
+0,56,174,253,172,224,70,94,222,201,252,171,0,24,84,55,179,33,186,97,31,3,211,81,
+0,56,204,151,254,200,0,24,55,105,209,51,0,120,233,0,152,22,0,24,131,98,56,137,
+196,88,143,37,89,149,132,57,155,225,249,160,60,138,166,148,234,171,232,26,177,57,11,182,
+134,187,186,207,43,191,20,92,195,84,60,199,145,220,202,201,60,206,253,92,209,45,61,212,
+88,205,214,128,45,217,163,61,219,195,29,221,223,189,222,247,45,224,11,78,225,29,78,226,
+43,30,227,54,190,227,63,62,228,69,142,228,73,174,228,74,174,228,73,126,228,69,46,228,
+62,174,227,53,14,227,42,62,226,28,78,225,11,46,224,248,221,222,226,109,221,201,189,219,
+173,237,217,142,221,215,108,157,213,70,45,211,30,141,208,241,172,205,194,140,202,142,60,199,
+87,172,195,28,236,191,222,219,187,156,155,183,86,43,179,12,107,174,192,138,169,111,106,164,
+28,42,159,199,185,153,111,41,148,21,121,142,185,184,136,93,232,130,0,40,125,163,87,119,
+71,151,113,235,230,107,145,86,102,57,230,96,228,165,91,145,133,86,64,165,81,244,228,76,
+170,116,72,100,52,68,34,36,64,227,99,60,169,211,56,114,131,53,62,99,50,15,131,47,
+226,226,44,186,114,42,148,50,40,114,34,38,83,82,36,55,162,34,30,50,33,8,226,31,
+245,193,30,228,209,29,214,1,29,203,97,28,194,225,27,187,145,27,183,97,27,182,97,27,
+183,129,27,187,209,27,193,81,28,202,241,28,213,193,29,227,193,30,245,225,31,9,82,33,
+33,242,34,61,210,36,93,226,38,128,66,41,168,210,43,211,178,46,3,211,49,55,51,53,
+111,211,56,172,179,60,236,227,64,49,84,69,122,4,74,199,244,78,24,37,84,108,133,89,
+196,21,95,31,214,100,124,182,106,219,182,112,60,215,118,158,247,124,0,40,134,196,88,146,
+132,25,158,60,74,169,232,154,179,134,251,188,20,76,197,145,156,204,253,220,210,88,13,216,
+163,61,220,223,125,223,11,222,225,43,110,227,63,94,228,73,174,228,73,94,228,62,94,227,
+42,206,225,11,142,223,226,157,220,173,237,216,108,109,212,30,29,207,194,236,200,87,204,193,
+222,203,185,86,203,176,192,250,166,28,122,156,111,89,145,185,216,133,0,56,122,71,183,110,
+145,150,99,228,21,89,64,69,79,170,68,70,34,68,62,169,35,55,62,243,48,226,162,43,
+148,34,39,83,114,35,30,130,32,245,65,30,214,177,28,194,177,27,183,97,27,183,177,27,
+193,161,28,213,49,30,245,145,32,33,210,35,93,2,40,168,50,45,3,115,51,111,195,58,
+236,19,67,122,116,76,24,197,86,196,245,97,124,182,109,60,231,121,0,72,140,132,201,163,
+232,106,184,20,28,201,253,140,213,163,253,221,11,190,226,63,158,228,73,238,227,42,190,224,
+226,221,218,108,237,209,194,124,197,222,107,181,192,202,161,111,153,139,0,120,116,145,70,94,
+64,165,74,34,148,58,62,35,46,148,50,37,30,82,31,214,33,28,183,113,27,193,81,29,
+245,17,34,93,130,42,3,243,54,236,163,71,24,69,92,124,198,115,0,72,152,232,74,193,
+253,60,218,11,254,227,73,174,226,226,205,214,194,236,189,192,250,150,0,24,105,64,37,66,
+62,67,41,30,98,29,183,17,28,245,209,37,3,195,62,24,197,103,0,88,174,255,204,224,
+70,46,222,197,204,171,0,72,84,59,227,33,186,65,31,1,179,81,0,104,204,151,190,200,
+0,88,55,105,161,51,0,120,233,0,152,22,0,24,131,99,72,137,197,88,143,38,89,149,
+133,73,155,226,9,161,61,154,166,149,250,171,233,42,177,58,27,182,135,203,186,209,75,191,
+22,124,195,87,92,199,147,12,203,203,108,206,255,140,209,47,109,212,91,253,214,130,93,217,
+166,109,219,197,77,221,225,237,222,249,77,224,13,110,225,30,110,226,44,46,227,55,206,227,
+64,62,228,70,142,228,73,174,228,74,174,228,72,126,228,68,30,228,61,158,227,52,254,226,
+41,46,226,26,46,225,9,14,224,246,189,222,223,61,221,198,141,219,170,173,217,138,173,215,
+104,109,213,67,253,210,26,77,208,237,108,205,190,76,202,138,252,198,83,108,195,24,172,191,
+218,155,187,152,91,183,82,235,178,9,59,174,188,90,169,109,74,164,26,250,158,196,153,153,
+109,9,148,19,105,142,184,168,136,92,232,130,0,40,125,164,103,119,72,167,113,237,6,108,
+147,118,102,60,22,97,230,197,91,147,181,86,68,213,81,247,36,77,174,180,72,104,116,68,
+38,100,64,232,163,60,173,19,57,118,195,53,66,163,50,19,195,47,230,18,45,189,162,42,
+152,98,40,118,98,38,86,130,36,58,210,34,33,82,33,11,2,32,247,225,30,230,225,29,
+215,17,29,204,113,28,195,241,27,188,145,27,184,97,27,182,97,27,183,129,27,186,209,27,
+192,65,28,201,225,28,212,161,29,226,161,30,243,193,31,7,34,33,31,194,34,59,162,36,
+90,178,38,126,18,41,165,162,43,209,130,46,1,163,49,53,3,53,109,179,56,169,147,60,
+234,195,64,47,68,69,121,244,73,198,228,78,23,21,84,107,117,89,195,5,95,30,198,100,
+123,182,106,218,182,112,59,199,118,157,247,124,0,56,134,197,104,146,133,41,158,61,90,169,
+233,170,179,135,27,189,22,124,197,147,188,204,255,252,210,91,45,216,166,93,220,225,157,223,
+13,238,225,44,126,227,64,110,228,73,174,228,72,78,228,61,78,227,41,174,225,9,110,223,
+223,109,220,170,173,216,104,61,212,26,221,206,190,172,200,83,140,193,218,139,185,82,155,176,
+188,218,166,26,74,156,109,57,145,184,200,133,0,72,122,72,215,110,147,198,99,230,53,89,
+68,117,79,174,132,70,38,132,62,173,99,55,66,51,49,230,210,43,152,98,39,86,162,35,
+33,162,32,247,97,30,215,193,28,195,193,27,184,97,27,183,161,27,192,145,28,212,33,30,
+243,113,32,31,178,35,90,226,39,165,18,45,1,83,51,109,147,58,234,243,66,121,100,76,
+23,181,86,195,229,97,123,166,109,59,215,121,0,88,140,133,217,163,233,122,184,22,60,201,
+255,188,213,166,29,222,13,206,226,64,158,228,72,238,227,40,158,224,223,173,218,104,173,209,
+190,60,197,218,43,181,188,170,161,109,137,139,0,136,116,147,102,94,68,229,74,38,212,58,
+66,99,46,152,98,37,33,114,31,216,33,28,184,113,27,192,65,29,243,241,33,90,82,42,
+1,211,54,234,147,71,23,53,92,123,182,115,0,88,152,233,106,193,0,109,218,13,14,228,
+72,142,226,223,141,214,189,172,189,188,218,150,0,56,105,68,101,66,67,131,41,33,130,29,
+184,1,28,243,161,37,0,163,62,23,181,103,0,104,174,2,237,224,70,14,222,193,156,171,
+0,120,84,63,3,34,186,33,31,254,162,81,0,152,204,150,142,200,0,136,55,106,113,51,
+0,104,233,0,168,22,0,24,131,99,72,137,197,104,143,38,105,149,133,73,155,227,25,161,
+62,170,166,150,26,172,234,74,177,60,59,182,137,235,186,210,107,191,24,156,195,89,140,199,
+149,44,203,206,140,206,2,173,209,50,141,212,94,45,215,133,125,217,168,157,219,200,109,221,
+228,13,223,251,109,224,15,142,225,32,126,226,46,62,227,57,222,227,65,78,228,70,142,228,
+74,174,228,74,158,228,72,110,228,68,14,228,61,142,227,51,222,226,39,14,226,24,14,225,
+7,222,223,243,141,222,220,13,221,195,93,219,166,125,217,135,109,215,101,45,213,63,189,210,
+22,13,208,233,44,205,185,12,202,134,188,198,79,44,195,20,108,191,214,91,187,148,43,183,
+78,171,178,5,11,174,185,42,169,106,26,164,23,218,158,194,121,153,107,249,147,18,89,142,
+183,168,136,92,232,130,0,40,125,164,103,119,73,183,113,238,22,108,149,150,102,62,54,97,
+233,245,91,150,229,86,71,5,82,251,100,77,178,228,72,108,180,68,42,164,64,236,227,60,
+177,83,57,122,3,54,71,227,50,23,3,48,234,82,45,193,226,42,155,162,40,121,146,38,
+90,178,36,61,2,35,36,130,33,13,50,32,249,1,31,232,1,30,217,49,29,205,129,28,
+195,1,28,188,161,27,184,113,27,182,97,27,182,129,27,186,193,27,191,49,28,199,209,28,
+210,145,29,224,129,30,241,161,31,5,2,33,28,162,34,56,114,36,88,146,38,123,226,40,
+162,130,43,206,98,46,254,130,49,50,227,52,107,131,56,167,115,60,232,163,64,46,36,69,
+119,212,73,196,196,78,22,245,83,106,101,89,194,245,94,29,198,100,123,166,106,218,166,112,
+59,199,118,157,247,124,0,56,134,197,104,146,133,57,158,62,106,169,234,202,179,137,43,189,
+24,156,197,149,236,204,2,45,211,94,93,216,168,141,220,228,189,223,15,14,226,46,158,227,
+65,110,228,74,174,228,72,78,228,61,62,227,39,142,225,7,62,223,220,61,220,166,125,216,
+101,253,211,22,157,206,185,108,200,79,76,193,214,75,185,78,91,176,185,170,166,23,42,156,
+107,41,145,183,200,133,0,72,122,73,231,110,149,230,99,233,101,89,71,181,79,178,196,70,
+42,196,62,177,163,55,71,115,49,234,18,44,155,146,39,90,210,35,36,210,32,249,129,30,
+217,209,28,195,193,27,184,97,27,182,161,27,191,113,28,210,1,30,241,81,32,28,130,35,
+88,178,39,162,226,44,254,34,51,107,115,58,232,227,66,119,68,76,22,165,86,194,213,97,
+123,166,109,59,215,121,0,88,140,133,233,163,234,154,184,24,92,201,2,221,213,169,77,222,
+15,238,226,65,158,228,72,222,227,39,126,224,220,109,218,101,109,209,186,252,196,214,235,180,
+185,122,161,107,121,139,0,152,116,149,150,94,71,37,75,42,20,59,70,163,46,155,162,37,
+36,146,31,217,49,28,184,113,27,191,33,29,241,193,33,87,50,42,254,178,54,232,115,71,
+22,37,92,123,182,115,0,104,152,234,138,193,2,141,218,15,30,228,72,126,226,221,77,214,
+185,108,189,185,186,150,0,88,105,71,165,66,71,195,41,35,146,29,184,241,27,241,129,37,
+254,130,62,22,165,103,0,136,174,4,13,225,69,222,221,188,108,171,0,168,84,68,51,34,
+187,1,31,252,130,81,0,200,204,149,78,200,0,200,55,107,65,51,0,88,233,0,184,22,
+0,24,131,99,72,137,197,104,143,38,105,149,134,89,155,228,25,161,63,186,166,151,42,172,
+236,90,177,61,75,182,139,11,187,212,123,191,26,188,195,91,172,199,152,76,203,208,188,206,
+4,221,209,52,189,212,96,77,215,136,173,217,171,189,219,202,157,221,230,45,223,254,141,224,
+17,174,225,34,158,226,47,94,227,58,238,227,66,94,228,71,158,228,74,174,228,74,158,228,
+72,110,228,67,254,227,60,126,227,50,206,226,37,238,225,22,238,224,5,190,223,241,109,222,
+218,221,220,192,45,219,163,77,217,132,61,215,97,237,212,59,125,210,18,205,207,229,236,204,
+181,204,201,130,124,198,75,236,194,16,44,191,210,27,187,144,235,182,75,123,178,2,203,173,
+182,250,168,103,234,163,21,186,158,192,89,153,105,217,147,16,73,142,182,152,136,91,232,130,
+0,40,125,165,119,119,74,199,113,240,54,108,151,182,102,64,86,97,235,37,92,153,21,87,
+74,69,82,254,148,77,181,36,73,112,244,68,46,228,64,240,35,61,181,147,57,126,67,54,
+75,35,51,27,67,48,238,146,45,197,34,43,159,210,40,124,194,38,93,226,36,64,50,35,
+38,162,33,15,82,32,251,33,31,234,33,30,219,65,29,206,145,28,196,1,28,189,161,27,
+184,113,27,182,97,27,182,113,27,185,177,27,190,33,28,198,177,28,209,113,29,222,97,30,
+239,129,31,2,226,32,26,114,34,54,82,36,85,98,38,120,194,40,160,82,43,204,50,46,
+251,82,49,48,195,52,104,99,56,165,83,60,230,147,64,44,4,69,117,196,73,195,180,78,
+20,229,83,105,85,89,193,245,94,28,182,100,122,166,106,218,166,112,59,199,118,157,247,124,
+0,56,134,197,104,146,134,73,158,63,122,169,236,218,179,139,75,189,26,188,197,152,12,205,
+4,77,211,96,141,216,171,173,220,230,237,223,17,46,226,47,174,227,66,126,228,74,174,228,
+72,62,228,60,46,227,37,110,225,5,30,223,218,13,220,163,77,216,97,189,211,18,93,206,
+181,44,200,75,12,193,210,11,185,75,43,176,182,122,166,21,10,156,105,25,145,182,184,133,
+0,88,122,74,7,111,151,6,100,235,149,89,74,229,79,181,4,71,46,4,63,181,227,55,
+75,179,49,238,82,44,159,194,39,93,2,36,38,242,32,251,161,30,219,225,28,196,209,27,
+184,97,27,182,145,27,190,97,28,209,225,29,239,33,32,26,98,35,85,130,39,160,194,44,
+252,2,51,104,83,58,230,195,66,117,52,76,20,149,86,193,197,97,122,166,109,59,215,121,
+0,88,140,134,249,163,236,186,184,26,140,201,4,13,214,171,109,222,17,254,226,66,174,228,
+72,206,227,37,94,224,218,61,218,97,45,209,181,188,196,210,187,180,182,90,161,105,105,139,
+0,168,116,151,182,94,74,85,75,46,84,59,75,227,46,159,210,37,38,178,31,219,65,28,
+184,97,27,190,17,29,239,161,33,85,2,42,252,130,54,230,83,71,20,21,92,122,182,115,
+0,104,152,236,170,193,5,189,218,17,46,228,71,94,226,218,29,214,181,44,189,182,154,150,
+0,120,105,74,229,66,75,243,41,38,178,29,185,225,27,239,81,37,251,98,62,20,165,103,
+0,152,174,6,45,225,69,174,221,184,60,171,0,216,84,72,99,34,187,225,30,250,114,81,
+0,232,204,149,14,200,0,8,56,107,33,51,0,88,233,0,184,22,0,40,131,99,72,137,
+197,104,143,39,121,149,135,105,155,228,41,161,64,202,166,152,58,172,237,106,177,62,107,182,
+140,43,187,214,155,191,28,220,195,93,204,199,154,124,203,211,220,206,7,13,210,55,221,212,
+99,125,215,138,205,217,174,237,219,205,189,221,232,93,223,0,174,224,19,206,225,35,174,226,
+48,110,227,59,254,227,66,94,228,71,158,228,74,174,228,74,158,228,71,94,228,66,254,227,
+59,110,227,48,174,226,36,206,225,21,206,224,3,158,223,238,61,222,215,173,220,189,253,218,
+160,29,217,128,253,214,93,189,212,55,61,210,14,141,207,225,172,204,177,140,201,126,60,198,
+71,172,194,12,220,190,206,219,186,140,171,182,71,59,178,254,154,173,178,186,168,100,186,163,
+18,138,158,190,57,153,103,185,147,15,41,142,182,136,136,91,232,130,0,40,125,165,135,119,
+75,231,113,241,86,108,153,214,102,66,134,97,238,85,92,156,85,87,78,117,82,2,213,77,
+185,100,73,116,52,69,50,52,65,244,99,61,185,211,57,130,131,54,79,99,51,31,131,48,
+242,210,45,201,82,43,163,18,41,128,242,38,96,18,37,67,98,35,41,210,33,18,114,32,
+253,65,31,235,65,30,220,97,29,208,161,28,198,17,28,190,177,27,185,113,27,182,97,27,
+182,113,27,185,177,27,190,17,28,197,161,28,208,97,29,221,65,30,237,97,31,0,178,32,
+24,82,34,51,34,36,82,66,38,118,146,40,157,50,43,201,2,46,249,50,49,45,147,52,
+102,67,56,163,51,60,228,115,64,42,228,68,116,164,73,194,164,78,19,213,83,104,69,89,
+192,229,94,28,166,100,121,150,106,217,166,112,59,199,118,157,231,124,0,56,134,197,120,146,
+135,73,158,64,138,169,237,234,179,140,107,189,28,220,197,154,60,205,7,125,211,99,173,216,
+174,221,220,232,13,224,19,62,226,48,190,227,66,126,228,74,174,228,71,46,228,58,14,227,
+36,94,225,3,238,222,215,221,219,160,13,216,93,125,211,14,29,206,177,236,199,71,204,192,
+206,203,184,71,235,175,178,74,166,18,234,155,103,249,144,181,184,133,0,88,122,75,23,111,
+153,38,100,238,197,89,78,37,80,185,68,71,50,68,63,185,35,56,79,243,49,242,146,44,
+163,2,40,96,50,36,41,34,33,253,177,30,220,1,29,198,225,27,185,97,27,182,145,27,
+190,81,28,208,209,29,237,1,32,24,50,35,82,98,39,157,146,44,249,210,50,102,51,58,
+228,163,66,116,36,76,19,133,86,192,197,97,121,150,109,59,215,121,0,88,140,135,9,164,
+237,202,184,28,172,201,7,61,214,174,141,222,19,30,227,66,174,228,71,190,227,36,62,224,
+215,13,218,93,237,208,177,124,196,206,123,180,178,42,161,103,105,139,0,168,116,153,230,94,
+78,149,75,50,148,59,79,35,47,163,2,38,41,210,31,220,81,28,185,97,27,190,241,28,
+237,129,33,82,210,41,249,98,54,228,67,71,19,5,92,121,182,115,0,120,152,237,186,193,
+7,237,218,19,62,228,71,78,226,215,221,213,177,236,188,179,122,150,0,152,105,77,37,67,
+79,51,42,41,194,29,185,209,27,237,33,37,249,82,62,19,149,103,0,184,174,9,77,225,
+69,126,221,180,12,171,0,8,85,76,147,34,187,193,30,247,82,81,0,24,205,148,206,199,
+0,72,56,108,241,50,0,72,233,0,200,22,0,40,131,99,72,137,198,120,143,39,121,149,
+135,105,155,229,57,161,64,218,166,153,74,172,238,122,177,64,123,182,142,59,187,216,187,191,
+29,252,195,95,236,199,156,156,203,213,12,207,9,45,210,58,13,213,101,173,215,141,253,217,
+176,13,220,207,237,221,235,125,223,2,206,224,21,238,225,37,206,226,50,126,227,60,14,228,
+67,110,228,72,158,228,74,174,228,74,142,228,71,78,228,65,238,227,57,94,227,47,158,226,
+34,190,225,19,174,224,0,110,223,236,13,222,212,125,220,186,205,218,157,221,216,125,205,214,
+90,125,212,51,253,209,10,77,207,221,108,204,173,76,201,121,236,197,66,108,194,8,156,190,
+202,155,186,136,107,182,67,251,177,251,90,173,175,138,168,97,138,163,15,106,158,187,25,153,
+101,169,147,14,25,142,181,136,136,90,216,130,0,56,125,166,135,119,75,247,113,242,102,108,
+155,246,102,69,166,97,241,133,92,159,133,87,81,181,82,5,21,78,189,164,73,120,116,69,
+54,116,65,248,163,61,190,35,58,135,195,54,83,163,51,35,195,48,246,18,46,205,146,43,
+166,66,41,131,50,39,99,66,37,70,146,35,44,2,34,20,162,32,0,98,31,237,81,30,
+222,113,29,209,177,28,199,33,28,191,193,27,185,129,27,182,97,27,182,113,27,184,161,27,
+189,1,28,196,145,28,206,65,29,219,33,30,235,65,31,254,145,32,21,34,34,49,2,36,
+80,18,38,115,98,40,155,2,43,198,226,45,247,2,49,43,115,52,100,35,56,161,19,60,
+227,83,64,40,212,68,114,148,73,192,148,78,18,197,83,103,53,89,192,213,94,27,166,100,
+121,150,106,217,150,112,58,199,118,157,231,124,0,56,134,198,120,146,135,89,158,64,154,169,
+238,10,180,142,139,189,29,252,197,156,92,205,9,173,211,101,221,216,176,253,220,235,45,224,
+21,94,226,50,206,227,67,142,228,74,174,228,71,30,228,57,254,226,34,62,225,0,206,222,
+212,173,219,157,221,215,90,61,211,10,221,205,173,156,199,66,140,192,202,139,184,67,187,175,
+175,26,166,15,186,155,101,233,144,181,168,133,0,104,122,75,39,111,155,86,100,241,245,89,
+81,85,80,189,132,71,54,132,63,190,115,56,83,51,50,246,210,44,166,50,40,99,98,36,
+44,66,33,0,210,30,222,17,29,199,241,27,185,97,27,182,129,27,189,65,28,206,177,29,
+235,225,31,21,18,35,80,50,39,155,98,44,247,178,50,100,19,58,227,131,66,114,4,76,
+18,117,86,192,181,97,121,150,109,58,215,121,0,104,140,135,9,164,238,234,184,29,204,201,
+9,93,214,176,189,222,21,46,227,67,174,228,71,158,227,34,14,224,212,221,217,90,173,208,
+173,44,196,202,59,180,175,250,160,101,89,139,0,184,116,155,22,95,81,213,75,54,228,59,
+83,99,47,166,50,38,44,2,32,222,113,28,185,97,27,189,225,28,235,81,33,80,178,41,
+247,66,54,227,35,71,18,5,92,121,166,115,0,120,152,238,218,193,10,13,219,21,62,228,
+70,46,226,212,173,213,173,172,188,175,90,150,0,184,105,81,101,67,83,99,42,44,226,29,
+186,209,27,235,1,37,246,50,62,18,149,103,0,200,174,11,109,225,69,78,221,176,204,170,
+0,72,85,80,195,34,187,161,30,245,66,81,0,72,205,147,142,199,0,136,56,109,193,50,
+0,56,233,0,216,22,0,40,131,99,88,137,198,120,143,40,137,149,136,121,155,230,73,161,
+65,234,166,154,90,172,239,154,177,65,155,182,143,91,187,217,219,191,31,28,196,97,12,200,
+158,188,203,215,44,207,12,93,210,60,61,213,104,205,215,143,45,218,179,61,220,210,13,222,
+237,157,223,4,238,224,23,254,225,39,222,226,51,142,227,61,30,228,68,110,228,72,158,228,
+74,174,228,73,142,228,70,78,228,65,222,227,56,62,227,46,126,226,32,158,225,17,142,224,
+254,77,223,233,237,221,209,93,220,183,157,218,154,173,216,121,141,214,86,61,212,48,189,209,
+6,13,207,217,28,204,169,252,200,117,172,197,62,28,194,4,92,190,198,91,186,132,43,182,
+63,203,177,247,42,173,172,90,168,94,90,163,13,58,158,185,249,152,100,137,147,12,9,142,
+180,120,136,90,216,130,0,56,125,166,151,119,76,7,114,244,134,108,156,22,103,71,214,97,
+243,181,92,162,181,87,84,229,82,9,69,78,193,228,73,124,180,69,58,180,65,252,243,61,
+194,99,58,139,19,55,87,243,51,39,3,49,250,82,46,208,210,43,170,130,41,135,98,39,
+102,114,37,73,178,35,47,34,34,23,194,32,2,130,31,239,113,30,224,145,29,210,209,28,
+200,49,28,191,193,27,186,129,27,183,97,27,182,113,27,184,161,27,188,241,27,195,129,28,
+205,49,29,217,17,30,233,33,31,252,113,32,19,2,34,46,210,35,77,226,37,113,66,40,
+152,210,42,196,178,45,244,226,48,41,83,52,98,3,56,159,243,59,225,51,64,39,180,68,
+113,116,73,191,116,78,17,181,83,102,37,89,191,197,94,26,150,100,120,134,106,216,150,112,
+58,183,118,157,231,124,0,56,134,198,136,146,136,105,158,65,170,169,239,26,180,143,155,189,
+31,28,198,158,124,205,12,205,211,104,253,216,179,45,221,237,77,224,23,126,226,51,222,227,
+68,142,228,74,158,228,70,30,228,56,238,226,32,30,225,254,157,222,209,125,219,154,157,215,
+86,13,211,6,157,205,169,92,199,62,76,192,198,75,184,63,123,175,172,234,165,13,154,155,
+100,201,144,180,168,133,0,104,122,76,71,111,156,118,100,243,37,90,84,149,80,193,196,71,
+58,196,63,194,179,56,87,115,50,250,2,45,170,114,40,102,146,36,47,114,33,2,242,30,
+224,33,29,200,241,27,186,113,27,182,129,27,188,49,28,205,145,29,233,193,31,19,226,34,
+77,18,39,152,66,44,244,146,50,98,243,57,225,115,66,113,244,75,17,101,86,191,165,97,
+120,134,109,58,215,121,0,104,140,136,25,164,239,250,184,31,236,201,12,141,214,179,221,222,
+23,62,227,68,174,228,70,142,227,32,238,223,209,173,217,86,109,208,169,236,195,198,251,179,
+172,218,160,100,73,139,0,200,116,156,54,95,84,21,76,58,36,60,87,163,47,170,98,38,
+47,34,32,224,129,28,186,97,27,188,209,28,233,49,33,77,130,41,244,34,54,225,19,71,
+17,245,91,120,166,115,0,136,152,239,250,193,12,61,219,23,78,228,70,14,226,210,109,213,
+169,108,188,172,58,150,0,216,105,84,165,67,87,163,42,46,2,30,186,193,27,233,209,36,
+244,18,62,17,133,103,0,232,174,13,141,225,69,30,221,171,156,170,0,120,85,85,243,34,
+187,129,30,243,34,81,0,104,205,146,78,199,0,200,56,110,161,50,0,40,233,0,232,22,
+0,40,131,99,88,137,198,120,143,40,137,149,136,137,155,230,89,161,66,250,166,155,106,172,
+241,170,177,67,171,182,145,107,187,219,251,191,33,60,196,99,44,200,161,236,203,218,92,207,
+14,125,210,63,93,213,106,253,215,146,77,218,181,93,220,212,45,222,239,189,223,6,14,225,
+25,30,226,40,254,226,52,158,227,62,30,228,68,126,228,73,174,228,74,174,228,73,142,228,
+70,62,228,64,206,227,55,46,227,44,110,226,31,126,225,15,110,224,252,45,223,231,189,221,
+207,45,220,180,93,218,150,109,216,118,77,214,82,253,211,44,125,209,2,205,206,213,220,203,
+165,188,200,113,108,197,58,220,193,255,27,190,194,27,186,128,235,181,59,139,177,244,234,172,
+169,42,168,91,58,163,10,26,158,183,201,152,98,105,147,11,249,141,179,104,136,89,216,130,
+0,56,125,167,167,119,77,23,114,245,166,108,158,70,103,73,246,97,246,213,92,165,229,87,
+87,37,83,12,133,78,197,36,74,128,244,69,62,244,65,1,52,62,198,163,58,143,83,55,
+91,51,52,43,67,49,254,146,46,212,18,44,174,194,41,138,162,39,106,178,37,76,226,35,
+49,82,34,25,226,32,4,162,31,241,145,30,225,161,29,212,225,28,201,65,28,192,209,27,
+186,129,27,183,97,27,182,97,27,183,145,27,188,241,27,194,113,28,204,17,29,216,241,29,
+231,1,31,250,81,32,17,226,33,44,178,35,75,194,37,110,18,40,150,178,42,193,146,45,
+242,178,48,38,35,52,95,227,55,157,211,59,223,19,64,37,164,68,111,100,73,189,100,78,
+15,165,83,101,21,89,190,181,94,26,134,100,120,134,106,216,150,112,58,183,118,157,231,124,
+0,56,134,198,136,146,136,105,158,66,186,169,241,58,180,145,187,189,33,60,198,161,172,205,
+14,253,211,106,45,217,181,77,221,239,109,224,25,142,226,52,238,227,68,158,228,74,158,228,
+70,14,228,55,206,226,31,254,224,252,125,222,207,77,219,150,109,215,82,205,210,2,93,205,
+165,28,199,58,252,191,194,11,184,59,75,175,169,186,165,10,122,155,98,185,144,179,168,133,
+0,104,122,77,87,111,158,150,100,246,85,90,87,197,80,197,4,72,62,20,64,198,243,56,
+91,179,50,254,66,45,174,162,40,106,194,36,49,146,33,4,18,31,225,65,29,201,1,28,
+186,113,27,182,113,27,188,33,28,204,129,29,231,161,31,17,194,34,75,226,38,150,18,44,
+242,98,50,95,211,57,223,83,66,111,212,75,15,85,86,190,165,97,120,134,109,58,215,121,
+0,104,140,136,41,164,241,26,185,33,28,202,14,173,214,181,253,222,25,78,227,68,174,228,
+70,126,227,31,206,223,207,109,217,82,45,208,165,172,195,193,187,179,169,170,160,98,57,139,
+0,216,116,158,102,95,87,85,76,63,100,60,91,227,47,174,162,38,49,66,32,225,145,28,
+186,97,27,188,193,28,231,17,33,75,98,41,242,242,53,223,243,70,15,229,91,120,166,115,
+0,136,152,240,26,194,15,93,219,25,94,228,69,254,225,207,45,213,164,44,188,169,42,150,
+0,232,105,87,229,67,92,227,42,49,18,30,187,177,27,231,177,36,241,242,61,16,133,103,
+0,248,174,16,157,225,68,238,220,167,108,170,0,168,85,89,35,35,188,113,30,240,18,81,
+0,152,205,145,30,199,0,248,56,111,113,50,0,24,233,0,248,22,0,40,131,99,88,137,
+198,136,143,40,153,149,137,137,155,231,89,161,67,10,167,156,122,172,242,186,177,68,203,182,
+146,139,187,221,11,192,35,92,196,101,76,200,163,12,204,220,124,207,17,157,210,65,125,213,
+109,29,216,148,125,218,184,141,220,215,93,222,241,221,223,8,46,225,27,62,226,42,14,227,
+53,174,227,63,46,228,69,126,228,73,174,228,74,174,228,73,126,228,69,46,228,63,190,227,
+54,30,227,43,78,226,29,94,225,13,62,224,250,253,222,228,141,221,204,253,219,177,45,218,
+147,61,216,114,29,214,78,189,211,40,61,209,254,140,206,209,156,203,160,124,200,109,44,197,
+54,156,193,251,219,189,189,219,185,124,171,181,56,75,177,240,186,172,165,250,167,87,10,163,
+7,234,157,181,169,152,96,89,147,9,233,141,178,88,136,89,216,130,0,56,125,167,183,119,
+78,39,114,247,182,108,160,102,103,75,38,98,249,5,93,169,21,88,91,85,83,16,197,78,
+200,100,74,132,52,70,67,52,66,5,116,62,202,227,58,147,147,55,96,115,52,47,131,49,
+2,211,46,216,82,44,178,242,41,142,210,39,109,226,37,79,18,36,52,130,34,28,18,33,
+6,210,31,243,177,30,227,193,29,213,241,28,202,81,28,193,225,27,187,145,27,183,97,27,
+182,97,27,183,145,27,187,225,27,193,97,28,203,1,29,214,209,29,229,225,30,248,49,32,
+15,178,33,41,130,35,72,146,37,108,242,39,147,146,42,191,114,45,239,146,48,36,3,52,
+93,195,55,155,179,59,221,3,64,35,132,68,110,68,73,188,84,78,14,149,83,100,5,89,
+189,181,94,25,134,100,119,118,106,216,134,112,58,183,118,157,231,124,0,56,134,198,136,146,
+137,121,158,67,202,169,242,74,180,146,219,189,35,92,198,163,204,205,17,29,212,109,77,217,
+184,125,221,241,141,224,27,174,226,53,254,227,69,158,228,74,158,228,69,254,227,54,190,226,
+29,222,224,250,77,222,204,29,219,147,45,215,78,141,210,254,28,205,160,220,198,54,188,191,
+189,203,183,56,11,175,165,122,165,7,90,155,96,153,144,178,152,133,0,120,122,78,119,111,
+160,182,100,249,149,90,91,5,81,200,68,72,67,84,64,202,51,57,96,243,50,2,131,45,
+178,226,40,109,242,36,52,194,33,6,50,31,227,81,29,202,17,28,187,113,27,182,113,27,
+187,17,28,203,97,29,229,129,31,15,146,34,72,194,38,147,242,43,239,66,50,93,179,57,
+221,51,66,110,196,75,14,69,86,189,149,97,119,134,109,58,215,121,0,104,140,137,57,164,
+242,42,185,35,60,202,17,221,214,184,29,223,27,110,227,69,174,228,69,110,227,29,174,223,
+204,61,217,78,237,207,160,108,195,189,139,179,165,122,160,96,41,139,0,232,116,160,150,95,
+91,133,76,67,164,60,96,35,48,178,210,38,52,98,32,227,161,28,187,97,27,187,161,28,
+229,241,32,72,50,41,239,210,53,221,227,70,14,213,91,119,166,115,0,152,152,242,58,194,
+17,141,219,26,94,228,69,222,225,204,237,212,160,220,187,165,10,150,0,8,106,91,53,68,
+96,35,43,52,50,30,187,177,27,230,129,36,239,210,61,14,117,103,0,8,175,18,189,225,
+68,190,220,163,60,170,0,216,85,93,83,35,188,81,30,238,2,81,0,200,205,144,222,198,
+0,56,57,112,65,50,0,8,233,0,8,23,0,40,131,100,88,137,199,136,143,41,153,149,
+137,153,155,232,105,161,68,26,167,157,138,172,243,202,177,69,219,182,148,171,187,222,43,192,
+37,108,196,103,108,200,165,44,204,222,156,207,19,205,210,67,173,213,111,77,216,151,157,218,
+186,173,220,217,125,222,244,253,223,10,78,225,29,78,226,43,30,227,55,190,227,63,62,228,
+70,142,228,73,174,228,74,174,228,73,126,228,68,46,228,62,174,227,53,254,226,41,46,226,
+27,62,225,10,30,224,247,221,222,225,93,221,201,205,219,174,253,217,143,253,215,111,221,213,
+75,141,211,36,253,208,250,60,206,204,92,203,156,60,200,104,220,196,49,92,193,247,139,189,
+185,155,185,120,107,181,52,11,177,236,122,172,162,186,167,84,218,162,4,202,157,178,137,152,
+94,57,147,8,201,141,177,88,136,89,200,130,0,72,125,167,183,119,79,71,114,248,214,108,
+162,134,103,78,70,98,252,53,93,172,85,88,94,149,83,20,5,79,204,164,74,136,116,70,
+71,132,66,9,180,62,207,51,59,152,211,55,100,179,52,52,211,49,6,19,47,220,130,44,
+181,50,42,145,18,40,113,18,38,82,66,36,55,178,34,31,50,33,9,242,31,246,209,30,
+229,225,29,215,17,29,203,97,28,194,241,27,188,145,27,183,97,27,182,97,27,183,129,27,
+186,209,27,193,81,28,201,241,28,213,193,29,227,193,30,246,17,32,12,146,33,39,98,35,
+70,114,37,105,194,39,145,98,42,189,66,45,237,114,48,34,227,51,91,163,55,153,163,59,
+219,227,63,34,100,68,108,52,73,187,68,78,13,133,83,99,245,88,188,165,94,24,118,100,
+119,118,106,215,134,112,57,183,118,156,231,124,0,72,134,199,152,146,137,137,158,68,218,169,
+243,90,180,148,235,189,37,124,198,165,236,205,19,61,212,111,125,217,186,157,221,244,173,224,
+28,190,226,55,254,227,70,158,228,74,158,228,68,238,227,53,158,226,27,174,224,247,29,222,
+201,237,218,143,253,214,75,77,210,250,204,204,156,140,198,49,124,191,185,139,183,52,203,174,
+162,74,165,4,42,155,94,137,144,177,152,133,0,120,122,79,135,111,162,230,100,252,197,90,
+94,69,81,204,132,72,71,148,64,207,131,57,100,67,51,6,195,45,181,18,41,113,34,37,
+55,242,33,9,98,31,229,113,29,203,33,28,188,113,27,182,113,27,186,17,28,201,81,29,
+228,97,31,12,114,34,70,146,38,145,210,43,237,34,50,91,147,57,219,35,66,108,180,75,
+13,53,86,188,133,97,119,118,109,57,199,121,0,120,140,137,73,164,243,74,185,37,92,202,
+19,253,214,186,77,223,28,126,227,70,174,228,69,94,227,27,126,223,201,253,216,75,173,207,
+156,28,195,185,75,179,162,74,160,94,25,139,0,248,116,162,198,95,94,197,76,71,244,60,
+100,99,48,181,18,39,55,146,32,229,177,28,187,97,27,186,145,28,228,193,32,70,18,41,
+237,178,53,219,195,70,13,197,91,119,150,115,0,168,152,243,90,194,19,173,219,28,110,228,
+68,190,225,201,189,212,156,156,187,162,234,149,0,40,106,94,117,68,100,83,43,55,82,30,
+188,161,27,228,97,36,237,178,61,13,117,103,0,40,175,20,221,225,67,142,220,158,12,170,
+0,8,86,98,131,35,189,49,30,236,226,80,0,232,205,143,158,198,0,120,57,113,33,50,
+0,248,232,0,24,23,0,40,131,100,88,137,199,136,143,41,169,149,138,153,155,232,121,161,
+69,42,167,158,154,172,244,234,177,71,235,182,149,187,187,224,75,192,39,140,196,105,156,200,
+167,76,204,224,188,207,21,237,210,70,205,213,114,109,216,153,205,218,189,205,220,219,157,222,
+246,45,224,12,110,225,30,110,226,45,46,227,56,206,227,64,78,228,70,142,228,73,174,228,
+74,158,228,72,110,228,68,30,228,61,158,227,52,238,226,40,30,226,25,30,225,8,254,223,
+245,173,222,223,61,221,198,141,219,170,205,217,140,205,215,107,157,213,71,77,211,32,189,208,
+246,252,205,200,12,203,152,236,199,100,156,196,45,12,193,243,75,189,181,91,185,116,43,181,
+48,219,176,233,74,172,158,138,167,81,170,162,2,154,157,176,105,152,92,25,147,6,185,141,
+176,72,136,88,200,130,0,72,125,168,199,119,80,87,114,250,246,108,164,166,103,80,118,98,
+254,101,93,175,133,88,98,197,83,23,53,79,208,228,74,140,180,70,75,196,66,13,4,63,
+211,115,59,156,35,56,104,3,53,56,19,50,10,83,47,224,194,44,185,114,42,149,66,40,
+116,66,38,86,130,36,58,210,34,33,98,33,11,18,32,248,241,30,231,241,29,216,33,29,
+204,113,28,195,241,27,188,161,27,184,113,27,182,97,27,183,129,27,186,193,27,192,65,28,
+200,225,28,211,161,29,226,161,30,244,225,31,10,114,33,37,66,35,67,66,37,103,162,39,
+142,66,42,186,34,45,235,82,48,32,195,51,89,115,55,151,131,59,217,195,63,32,84,68,
+107,36,73,185,36,78,12,117,83,98,229,88,187,149,94,24,118,100,118,102,106,215,134,112,
+57,183,118,156,231,124,0,72,134,199,152,146,138,137,158,69,234,169,244,122,180,149,11,190,
+39,156,198,167,12,206,21,109,212,114,157,217,189,189,221,246,205,224,30,222,226,56,14,228,
+70,158,228,74,142,228,68,222,227,52,142,226,25,142,224,245,253,221,198,173,218,140,189,214,
+71,13,210,246,140,204,152,76,198,45,60,191,181,75,183,48,155,174,158,26,165,2,10,155,
+92,105,144,176,136,133,0,136,122,80,167,111,164,6,101,254,245,90,98,117,81,208,196,72,
+75,212,64,211,195,57,104,131,51,10,3,46,185,82,41,116,98,37,58,18,34,11,130,31,
+231,129,29,204,49,28,188,129,27,182,113,27,186,1,28,200,49,29,226,65,31,10,82,34,
+67,114,38,142,162,43,235,2,50,89,115,57,217,3,66,107,148,75,12,37,86,187,133,97,
+118,118,109,57,199,121,0,120,140,138,89,164,244,90,185,39,124,202,21,45,215,189,109,223,
+30,142,227,70,174,228,68,78,227,25,94,223,198,205,216,71,109,207,152,220,194,181,11,179,
+158,42,160,92,9,139,0,8,117,164,230,95,98,5,77,75,52,61,104,163,48,185,66,39,
+58,178,32,231,193,28,188,97,27,186,129,28,226,161,32,67,226,40,235,146,53,217,179,70,
+12,181,91,118,150,115,0,168,152,244,122,194,22,205,219,30,126,228,67,158,225,198,125,212,
+152,92,187,158,202,149,0,72,106,98,181,68,104,147,43,58,114,30,189,145,27,226,65,36,
+234,146,61,12,101,103,0,56,175,22,237,225,67,94,220,154,204,169,0,72,86,102,179,35,
+189,33,30,234,210,80,0,24,206,142,94,198,0,184,57,114,241,49,0,232,232,0,40,23,
+0,40,131,100,104,137,199,152,143,42,169,149,138,169,155,233,137,161,69,42,167,159,170,172,
+245,250,177,72,11,183,151,219,187,226,107,192,40,172,196,107,188,200,169,108,204,227,236,207,
+24,13,211,72,253,213,116,157,216,156,237,218,191,253,220,222,189,222,248,77,224,14,142,225,
+32,126,226,46,78,227,57,222,227,65,78,228,71,142,228,74,174,228,74,158,228,72,110,228,
+67,14,228,60,126,227,50,222,226,38,254,225,23,254,224,6,222,223,242,141,222,220,13,221,
+195,93,219,167,141,217,137,141,215,103,93,213,67,13,211,28,125,208,241,188,205,196,204,202,
+147,172,199,96,76,196,41,204,192,238,11,189,177,27,185,112,235,180,44,155,176,229,10,172,
+155,90,167,78,122,162,255,121,157,174,73,152,90,9,147,5,169,141,175,56,136,88,200,130,
+0,72,125,168,215,119,81,103,114,251,6,109,166,198,103,82,150,98,1,150,93,178,181,88,
+101,5,84,27,117,79,212,36,75,144,244,70,79,4,67,18,68,63,215,195,59,160,99,56,
+109,67,53,60,83,50,15,147,47,228,2,45,189,178,42,153,130,40,119,130,38,89,178,36,
+61,2,35,36,130,33,14,50,32,250,17,31,233,17,30,218,49,29,206,145,28,196,1,28,
+189,161,27,184,113,27,182,97,27,182,129,27,185,193,27,191,49,28,199,193,28,210,145,29,
+224,129,30,242,193,31,8,82,33,34,18,35,65,34,37,100,114,39,140,18,42,184,2,45,
+232,34,48,29,163,51,87,83,55,149,99,59,216,163,63,30,52,68,105,4,73,184,20,78,
+11,101,83,97,229,88,187,133,94,23,102,100,118,102,106,214,118,112,57,167,118,156,231,124,
+0,72,134,199,168,146,138,153,158,69,250,169,245,138,180,151,43,190,40,188,198,169,60,206,
+24,141,212,116,205,217,191,237,221,248,237,224,32,238,226,57,30,228,71,174,228,74,142,228,
+67,206,227,50,110,226,23,110,224,242,205,221,195,125,218,137,125,214,67,205,209,241,76,204,
+147,12,198,41,236,190,177,11,183,44,91,174,155,234,164,255,233,154,90,89,144,175,136,133,
+0,136,122,81,183,111,166,38,101,1,38,91,101,181,81,212,4,73,79,36,65,215,3,58,
+109,195,51,15,67,46,189,146,41,119,146,37,61,66,34,14,162,31,233,161,29,206,65,28,
+189,129,27,182,97,27,185,241,27,199,33,29,224,33,31,8,34,34,65,66,38,140,130,43,
+232,210,49,87,83,57,216,227,65,105,132,75,11,21,86,187,117,97,118,102,109,57,199,121,
+0,120,140,138,89,164,245,122,185,40,156,202,24,77,215,191,141,223,32,158,227,71,174,228,
+67,46,227,23,46,223,195,157,216,67,29,207,147,156,194,177,203,178,155,250,159,90,249,138,
+0,24,117,166,22,96,101,69,77,79,116,61,109,243,48,189,114,39,61,226,32,233,225,28,
+189,97,27,185,113,28,224,129,32,65,194,40,232,114,53,216,147,70,11,181,91,118,150,115,
+0,184,152,245,138,194,24,253,219,32,126,228,67,126,225,195,61,212,147,28,187,155,170,149,
+0,104,106,101,245,68,109,211,43,61,146,30,189,145,27,224,17,36,232,130,61,11,85,103,
+0,72,175,24,13,226,67,46,220,149,156,169,0,120,86,107,227,35,189,1,30,232,194,80,
+0,56,206,141,30,198,0,248,57,115,209,49,0,216,232,0,56,23,0,40,131,100,104,137,
+199,152,143,42,185,149,139,185,155,234,137,161,70,58,167,160,186,172,246,10,178,73,27,183,
+152,235,187,227,123,192,42,204,196,109,204,200,171,140,204,229,12,208,26,61,211,75,29,214,
+119,189,216,158,13,219,193,29,221,224,237,222,250,109,224,16,158,225,34,158,226,47,94,227,
+58,238,227,66,94,228,71,158,228,74,174,228,74,158,228,71,94,228,66,254,227,59,110,227,
+49,190,226,37,222,225,22,222,224,4,174,223,240,93,222,217,221,220,192,45,219,164,93,217,
+133,93,215,100,45,213,63,205,210,24,61,208,237,124,205,192,140,202,143,108,199,91,12,196,
+36,124,192,234,203,188,172,203,184,108,171,180,40,91,176,225,218,171,151,42,167,75,74,162,
+252,73,157,171,41,152,88,233,146,4,153,141,174,40,136,87,200,130,0,72,125,169,231,119,
+82,119,114,252,38,109,168,230,103,85,198,98,4,198,93,181,229,88,105,53,84,31,181,79,
+216,100,75,148,68,71,84,68,67,22,148,63,220,3,60,165,163,56,113,131,53,64,147,50,
+19,211,47,232,66,45,193,226,42,156,178,40,123,178,38,92,226,36,64,50,35,39,178,33,
+16,98,32,252,49,31,234,49,30,219,81,29,207,161,28,197,17,28,190,177,27,185,113,27,
+182,97,27,182,113,27,185,177,27,190,33,28,198,177,28,209,113,29,222,113,30,240,161,31,
+6,34,33,32,242,34,63,2,37,98,82,39,137,242,41,181,210,44,230,2,48,27,131,51,
+85,67,55,147,67,59,214,147,63,29,36,68,104,244,72,183,4,78,10,85,83,96,213,88,
+186,133,94,22,86,100,117,86,106,214,118,112,57,167,118,156,231,124,0,72,134,199,168,146,
+139,169,158,70,10,170,246,154,180,152,59,190,42,220,198,171,92,206,26,189,212,119,237,217,
+193,13,222,250,13,225,34,254,226,58,46,228,71,174,228,74,126,228,66,190,227,49,94,226,
+22,78,224,240,157,221,192,77,218,133,77,214,63,141,209,237,12,204,143,188,197,36,172,190,
+172,203,182,40,27,174,151,186,164,252,185,154,88,73,144,174,120,133,0,152,122,82,199,111,
+168,86,101,4,86,91,105,245,81,216,68,73,84,100,65,220,83,58,113,3,52,19,131,46,
+193,194,41,123,194,37,64,114,34,16,194,31,234,177,29,207,81,28,190,145,27,182,97,27,
+185,225,27,198,17,29,222,1,31,6,2,34,63,34,38,137,82,43,230,178,49,85,51,57,
+214,211,65,104,116,75,10,5,86,186,101,97,117,102,109,57,199,121,0,120,140,139,105,164,
+246,138,185,42,188,202,26,125,215,193,173,223,33,174,227,71,174,228,66,30,227,21,14,223,
+192,93,216,63,221,206,143,76,194,172,139,178,152,202,159,88,233,138,0,40,117,168,70,96,
+104,133,77,84,196,61,113,51,49,193,178,39,64,2,33,235,241,28,190,97,27,185,97,28,
+223,97,32,63,146,40,230,82,53,214,131,70,10,165,91,117,150,115,0,184,152,246,170,194,
+26,29,220,33,142,228,66,110,225,192,253,211,143,220,186,152,138,149,0,136,106,104,53,69,
+113,19,44,64,162,30,190,129,27,223,241,35,230,98,61,10,85,103,0,104,175,26,45,226,
+66,254,219,145,108,169,0,168,86,111,19,36,190,225,29,230,162,80,0,104,206,140,222,197,
+0,56,58,116,161,49,0,200,232,0,72,23,0,40,131,100,104,137,200,152,143,42,185,149,
+139,185,155,234,153,161,71,74,167,161,202,172,247,26,178,74,43,183,154,11,188,229,155,192,
+44,236,196,111,236,200,173,188,204,231,44,208,28,93,211,77,61,214,121,221,216,161,61,219,
+196,61,221,226,13,223,252,141,224,18,190,225,35,174,226,49,110,227,59,254,227,67,94,228,
+72,158,228,74,174,228,74,158,228,71,94,228,66,238,227,58,94,227,48,174,226,35,206,225,
+20,190,224,2,142,223,237,45,222,214,173,220,189,253,218,161,29,217,130,29,215,96,237,212,
+59,141,210,20,253,207,233,60,205,187,60,202,139,28,199,87,204,195,32,60,192,230,123,188,
+168,139,184,104,107,180,36,27,176,221,154,171,148,234,166,72,26,162,249,25,157,169,9,152,
+86,201,146,2,121,141,173,40,136,87,184,130,0,88,125,169,231,119,83,151,114,254,70,109,
+170,6,104,87,246,98,7,246,93,184,37,89,108,117,84,35,245,79,220,164,75,152,132,71,
+88,148,67,26,212,63,224,67,60,169,243,56,117,211,53,69,211,50,23,19,48,236,130,45,
+197,34,43,160,242,40,126,242,38,95,18,37,67,98,35,42,226,33,19,130,32,254,81,31,
+236,65,30,221,97,29,208,177,28,198,33,28,190,177,27,185,113,27,182,97,27,182,113,27,
+184,177,27,189,17,28,197,161,28,207,97,29,221,81,30,238,129,31,4,2,33,30,210,34,
+60,210,36,95,50,39,135,210,41,179,178,44,228,226,47,25,83,51,83,35,55,145,35,59,
+212,115,63,27,4,68,102,228,72,182,244,77,9,69,83,95,197,88,185,117,94,22,86,100,
+117,86,106,214,118,112,56,167,118,156,231,124,0,72,134,200,168,146,139,169,158,71,26,170,
+247,170,180,154,91,190,44,252,198,173,124,206,28,221,212,121,29,218,196,45,222,252,45,225,
+35,30,227,59,62,228,72,174,228,74,126,228,66,174,227,48,62,226,20,46,224,237,109,221,
+189,29,218,130,13,214,59,77,209,233,188,203,139,124,197,32,108,190,168,139,182,36,219,173,
+148,138,164,249,153,154,86,41,144,173,120,133,0,152,122,83,231,111,170,118,101,7,134,91,
+108,53,82,220,132,73,88,164,65,224,147,58,117,83,52,23,195,46,197,2,42,126,242,37,
+67,162,34,19,226,31,236,209,29,208,97,28,190,145,27,182,97,27,184,209,27,197,241,28,
+221,225,30,4,226,33,60,242,37,135,50,43,228,146,49,83,19,57,212,179,65,102,100,75,
+9,245,85,185,101,97,117,102,109,56,199,121,0,136,140,139,121,164,247,170,185,44,220,202,
+28,157,215,196,205,223,35,190,227,71,174,228,66,14,227,20,222,222,189,45,216,59,157,206,
+139,12,194,168,75,178,148,154,159,86,217,138,0,56,117,170,118,96,108,197,77,88,4,62,
+117,115,49,197,226,39,67,50,33,236,1,29,190,97,27,185,81,28,221,65,32,60,114,40,
+228,50,53,212,99,70,9,149,91,117,134,115,0,200,152,247,202,194,29,61,220,35,142,228,
+65,78,225,189,189,211,138,140,186,148,106,149,0,168,106,108,133,69,118,83,44,67,194,30,
+191,129,27,221,209,35,227,66,61,9,69,103,0,120,175,28,61,226,66,206,219,140,60,169,
+0,216,86,116,67,36,190,209,29,228,146,80,0,136,206,139,142,197,0,136,58,117,129,49,
+0,184,232,0,88,23,0,40,131,100,104,137,200,152,143,43,185,149,140,201,155,235,169,161,
+72,90,167,162,218,172,248,42,178,76,75,183,155,27,188,230,187,192,46,12,197,113,12,201,
+175,220,204,233,76,208,30,125,211,79,109,214,123,13,217,163,93,219,198,109,221,228,45,223,
+254,173,224,20,222,225,37,206,226,50,126,227,60,14,228,67,110,228,72,158,228,74,174,228,
+74,142,228,70,78,228,65,222,227,57,78,227,46,142,226,33,174,225,18,158,224,0,110,223,
+235,13,222,212,125,220,186,205,218,157,237,216,126,221,214,92,173,212,55,77,210,15,173,207,
+229,236,204,183,252,201,134,220,198,82,124,195,27,252,191,225,59,188,164,75,184,99,43,180,
+32,219,175,218,90,171,145,186,166,69,234,161,247,249,156,166,233,151,84,185,146,1,105,141,
+172,24,136,86,184,130,0,88,125,170,247,119,84,167,114,255,86,109,172,38,104,90,22,99,
+9,38,94,187,85,89,111,181,84,38,53,80,224,228,75,157,196,71,92,212,67,31,20,64,
+229,147,60,174,51,57,122,19,54,73,35,51,27,99,48,241,194,45,201,98,43,164,50,41,
+130,34,39,99,66,37,70,146,35,44,2,34,21,162,32,0,114,31,238,97,30,223,129,29,
+210,193,28,199,49,28,191,193,27,186,129,27,182,97,27,182,113,27,184,161,27,189,1,28,
+196,145,28,206,65,29,219,49,30,236,97,31,2,226,32,28,162,34,58,178,36,93,2,39,
+133,162,41,177,146,44,226,194,47,23,51,51,81,3,55,143,3,59,210,83,63,26,244,67,
+101,196,72,180,228,77,8,53,83,94,181,88,184,101,94,21,70,100,116,86,106,213,118,112,
+56,167,118,156,231,124,0,72,134,200,184,146,140,185,158,72,42,170,248,202,180,155,107,190,
+46,28,199,175,156,206,30,253,212,123,61,218,198,77,222,254,77,225,37,46,227,60,62,228,
+72,174,228,74,110,228,65,158,227,46,30,226,18,14,224,235,77,221,186,221,217,126,205,213,
+55,253,208,229,124,203,134,44,197,27,28,190,164,59,182,32,171,173,145,90,164,247,105,154,
+84,25,144,172,104,133,0,168,122,84,247,111,172,166,101,9,182,91,111,101,82,224,212,73,
+92,244,65,229,227,58,122,147,52,27,19,47,201,66,42,130,50,38,70,194,34,21,2,32,
+238,241,29,210,113,28,191,161,27,182,97,27,184,209,27,196,225,28,219,193,30,2,194,33,
+58,210,37,133,18,43,226,114,49,81,243,56,210,163,65,101,68,75,8,229,85,184,85,97,
+116,86,109,56,199,121,0,136,140,140,137,164,248,186,185,46,252,202,30,189,215,198,237,223,
+37,206,227,72,158,228,65,238,226,18,190,222,186,237,215,55,93,206,134,188,193,164,11,178,
+145,122,159,84,201,138,0,72,117,172,150,96,111,5,78,92,84,62,122,179,49,201,34,40,
+70,82,33,238,33,29,191,113,27,184,65,28,219,33,32,58,82,40,226,18,53,210,83,70,
+8,133,91,116,134,115,0,200,152,248,218,194,31,109,220,36,158,228,64,46,225,186,125,211,
+134,76,186,145,74,149,0,200,106,111,197,69,122,147,44,70,226,30,192,113,27,220,161,35,
+225,50,61,8,69,103,0,136,175,30,93,226,65,158,219,136,252,168,0,24,87,120,115,36,
+191,177,29,226,130,80,0,184,206,138,78,197,0,200,58,118,81,49,0,168,232,0,104,23,
+0,40,131,100,104,137,200,168,143,43,201,149,140,201,155,236,169,161,72,106,167,163,234,172,
+249,74,178,77,91,183,156,59,188,232,203,192,47,28,197,114,44,201,177,252,204,235,108,208,
+33,173,211,81,141,214,126,45,217,165,125,219,200,141,221,230,77,223,0,206,224,22,254,225,
+39,222,226,51,142,227,61,30,228,68,126,228,72,174,228,74,174,228,73,142,228,70,62,228,
+64,206,227,56,62,227,45,110,226,32,142,225,16,126,224,253,61,223,232,221,221,209,77,220,
+183,157,218,154,189,216,123,173,214,88,109,212,51,13,210,11,109,207,224,172,204,179,188,201,
+130,140,198,78,60,195,23,172,191,221,251,187,160,11,184,95,235,179,28,155,175,214,42,171,
+141,138,166,66,186,161,244,201,156,164,185,151,82,153,146,255,88,141,171,8,136,86,184,130,
+0,88,125,170,7,120,85,183,114,1,119,109,174,86,104,92,70,99,12,86,94,190,133,89,
+115,229,84,42,117,80,228,36,76,161,4,72,96,20,68,35,100,64,233,211,60,178,131,57,
+126,83,54,77,99,51,32,163,48,245,2,46,205,162,43,168,98,41,133,82,39,102,114,37,
+73,194,35,47,50,34,24,210,32,3,146,31,240,129,30,224,161,29,211,209,28,200,65,28,
+192,209,27,186,129,27,183,97,27,182,97,27,184,145,27,188,241,27,195,129,28,205,49,29,
+217,17,30,234,65,31,0,194,32,26,130,34,56,146,36,91,226,38,130,130,41,175,98,44,
+223,162,47,21,19,51,79,227,54,142,243,58,209,67,63,24,212,67,100,180,72,179,196,77,
+7,37,83,93,165,88,184,101,94,20,70,100,116,70,106,213,102,112,56,167,118,156,231,124,
+0,72,134,200,184,146,140,201,158,72,58,170,249,218,180,156,139,190,47,44,199,177,188,206,
+33,29,213,126,93,218,200,109,222,0,110,225,38,62,227,61,78,228,72,174,228,73,110,228,
+64,142,227,45,254,225,16,222,223,232,29,221,183,173,217,123,141,213,51,189,208,224,60,203,
+130,236,196,23,220,189,160,251,181,28,107,173,141,42,164,244,73,154,82,249,143,171,104,133,
+0,168,122,85,23,112,174,198,101,12,230,91,115,165,82,228,20,74,96,52,66,233,35,59,
+126,211,52,32,83,47,205,130,42,133,98,38,73,242,34,24,50,32,240,17,30,211,129,28,
+192,161,27,183,97,27,184,193,27,195,209,28,218,161,30,0,162,33,56,178,37,130,242,42,
+223,82,49,79,227,56,209,131,65,100,52,75,7,213,85,184,69,97,116,86,109,56,199,121,
+0,136,140,140,153,164,249,202,185,47,28,203,33,237,215,200,13,224,38,222,227,72,158,228,
+64,222,226,16,142,222,183,189,215,51,13,206,130,124,193,159,203,177,141,74,159,82,185,138,
+0,88,117,174,198,96,115,69,78,97,148,62,126,3,50,205,82,40,73,130,33,240,49,29,
+192,113,27,184,49,28,218,1,32,56,34,40,223,242,52,209,67,70,7,117,91,116,134,115,
+0,216,152,249,250,194,33,141,220,38,158,228,64,14,225,183,61,211,130,12,186,141,42,149,
+0,232,106,115,5,70,126,211,44,73,2,31,192,113,27,218,129,35,223,18,61,7,53,103,
+0,168,175,32,109,226,64,94,219,131,204,168,0,72,87,125,179,36,192,161,29,224,98,80,
+0,216,206,137,14,197,0,8,59,119,49,49,0,152,232,0,120,23,0,40,131,100,120,137,
+200,168,143,43,201,149,141,217,155,236,185,161,73,122,167,163,250,172,250,90,178,78,107,183,
+158,75,188,233,235,192,49,60,197,116,76,201,179,28,205,237,156,208,35,205,211,84,173,214,
+128,77,217,167,157,219,202,173,221,233,109,223,2,222,224,23,14,226,40,254,226,52,174,227,
+62,46,228,69,126,228,73,174,228,74,174,228,73,142,228,69,62,228,63,190,227,55,30,227,
+43,94,226,30,110,225,14,94,224,251,29,223,230,173,221,206,29,220,180,93,218,151,125,216,
+119,109,214,84,45,212,47,205,209,7,45,207,220,108,204,174,108,201,125,76,198,73,236,194,
+18,108,191,216,171,187,155,187,183,91,171,179,24,91,175,210,234,170,138,74,166,63,138,161,
+241,169,156,162,153,151,80,121,146,254,72,141,170,248,135,85,184,130,0,88,125,171,23,120,
+86,199,114,2,151,109,176,118,104,94,102,99,15,134,94,193,197,89,118,37,85,46,181,80,
+232,100,76,165,84,72,101,100,68,40,164,64,238,35,61,183,195,57,131,163,54,82,163,51,
+36,227,48,249,66,46,209,226,43,172,162,41,137,146,39,105,178,37,76,242,35,50,98,34,
+26,242,32,5,178,31,242,161,30,226,177,29,213,241,28,201,81,28,193,209,27,187,129,27,
+183,97,27,182,97,27,183,145,27,187,225,27,194,97,28,204,17,29,216,1,30,233,49,31,
+254,161,32,23,98,34,54,114,36,89,194,38,128,98,41,172,66,44,221,114,47,19,243,50,
+77,195,54,140,211,58,207,35,63,23,196,67,98,164,72,178,180,77,6,21,83,93,149,88,
+183,85,94,20,54,100,115,70,106,213,102,112,56,151,118,156,231,124,0,72,134,200,184,146,
+141,201,158,73,58,170,250,234,180,158,155,190,49,76,199,179,220,206,35,77,213,128,125,218,
+202,157,222,2,126,225,40,94,227,62,94,228,73,174,228,73,94,228,63,126,227,43,238,225,
+14,190,223,230,237,220,180,125,217,119,77,213,47,125,208,220,236,202,125,156,196,18,140,189,
+155,187,181,24,43,173,138,250,163,241,41,154,80,233,143,170,88,133,0,184,122,86,39,112,
+176,230,101,15,22,92,118,229,82,232,84,74,101,132,66,238,115,59,131,35,53,36,147,47,
+209,194,42,137,146,38,76,34,35,26,82,32,242,33,30,213,145,28,193,177,27,183,97,27,
+183,177,27,194,177,28,216,145,30,254,113,33,54,146,37,128,194,42,221,50,49,77,195,56,
+207,115,65,98,36,75,6,213,85,183,69,97,115,86,109,56,199,121,0,136,140,141,153,164,
+250,234,185,49,60,203,35,13,216,202,45,224,40,238,227,73,158,228,63,190,226,14,110,222,
+180,125,215,47,205,205,125,44,193,155,139,177,138,26,159,80,169,138,0,104,117,176,246,96,
+118,133,78,101,228,62,131,67,50,209,146,40,76,162,33,242,81,29,193,113,27,183,33,28,
+216,225,31,54,2,40,221,210,52,207,35,70,6,117,91,115,134,115,0,216,152,250,26,195,
+35,173,220,40,158,228,63,238,224,180,253,210,125,188,185,138,10,149,0,8,107,118,85,70,
+131,19,45,76,34,31,193,113,27,216,97,35,221,242,60,6,53,103,0,184,175,34,141,226,
+64,46,219,127,156,168,0,120,87,129,227,36,192,129,29,222,82,80,0,8,207,135,206,196,
+0,72,59,120,1,49,0,120,232,0,152,23,0,40,131,101,120,137,201,168,143,44,217,149,
+141,217,155,237,201,161,74,122,167,164,10,173,251,106,178,79,139,183,159,107,188,235,251,192,
+51,92,197,118,108,201,181,60,205,239,188,208,37,237,211,86,221,214,130,109,217,170,205,219,
+205,205,221,235,141,223,4,254,224,25,46,226,42,14,227,54,190,227,63,46,228,69,126,228,
+73,174,228,74,174,228,73,126,228,69,46,228,62,174,227,53,14,227,42,62,226,28,78,225,
+12,46,224,249,237,222,227,125,221,203,237,219,176,45,218,147,77,216,115,45,214,81,237,211,
+43,125,209,3,237,206,216,28,204,170,44,201,121,252,197,69,172,194,14,28,191,212,107,187,
+151,123,183,87,107,179,20,43,175,206,186,170,134,26,166,59,90,161,238,121,156,159,121,151,
+78,89,146,252,40,141,169,248,135,85,168,130,0,104,125,171,23,120,87,231,114,4,183,109,
+178,150,104,97,150,99,18,182,94,197,245,89,122,85,85,50,229,80,236,164,76,169,148,72,
+105,164,68,44,244,64,242,99,61,187,19,58,135,227,54,86,243,51,40,35,49,253,146,46,
+213,34,44,175,226,41,141,194,39,109,226,37,80,34,36,53,146,34,29,34,33,7,226,31,
+244,193,30,228,209,29,214,1,29,203,97,28,194,225,27,187,145,27,183,97,27,182,97,27,
+183,145,27,187,225,27,193,81,28,202,1,29,214,225,29,231,17,31,252,129,32,21,66,34,
+51,66,36,86,162,38,126,50,41,170,34,44,219,82,47,17,211,50,75,163,54,138,179,58,
+205,19,63,21,180,67,97,132,72,177,164,77,5,5,83,92,149,88,182,69,94,19,54,100,
+115,54,106,212,102,112,55,151,118,155,231,124,0,88,134,201,200,146,141,217,158,74,74,170,
+251,250,180,159,187,190,51,108,199,181,252,206,37,109,213,130,173,218,204,189,222,4,158,225,
+41,110,227,63,94,228,73,174,228,73,94,228,62,94,227,42,206,225,12,158,223,227,189,220,
+176,61,217,115,29,213,43,61,208,216,172,202,121,92,196,14,76,189,151,123,181,20,235,172,
+134,186,163,238,249,153,78,201,143,169,88,133,0,184,122,87,71,112,178,22,102,18,86,92,
+122,37,83,236,148,74,105,196,66,242,179,59,135,99,53,40,211,47,213,242,42,141,210,38,
+80,82,35,29,114,32,244,65,30,214,177,28,194,177,27,183,97,27,183,177,27,193,161,28,
+215,113,30,252,81,33,52,98,37,126,162,42,219,18,49,75,163,56,205,83,65,97,20,75,
+5,197,85,182,53,97,115,70,109,55,183,121,0,152,140,141,169,164,251,250,185,51,92,203,
+37,45,216,205,77,224,41,254,227,73,158,228,62,174,226,11,62,222,176,61,215,43,141,205,
+121,236,192,151,75,177,134,234,158,78,153,138,0,120,117,178,38,97,122,197,78,105,36,63,
+135,131,50,213,210,40,80,210,33,245,97,29,194,113,27,183,17,28,215,193,31,51,226,39,
+219,178,52,205,19,70,5,101,91,115,118,115,0,232,152,251,42,195,37,205,220,41,174,228,
+62,190,224,177,189,210,121,124,185,134,234,148,0,40,107,122,149,70,135,83,45,79,82,31,
+194,97,27,215,65,35,219,226,60,5,37,103,0,200,175,36,157,226,63,254,218,122,92,168,
+0,184,87,134,19,37,193,113,29,220,66,80,0,40,207,134,142,196,0,136,59,122,225,48,
+0,104,232,0,168,23,0,40,131,101,120,137,201,184,143,44,217,149,142,233,155,237,201,161,
+75,138,167,165,26,173,252,122,178,80,155,183,160,123,188,236,27,193,52,124,197,120,140,201,
+183,92,205,241,220,208,39,13,212,88,253,214,132,157,217,172,237,219,207,237,221,237,173,223,
+6,30,225,27,78,226,43,30,227,55,206,227,64,62,228,70,142,228,73,174,228,74,174,228,
+72,126,228,68,30,228,61,158,227,52,254,226,40,46,226,26,46,225,9,14,224,246,205,222,
+224,93,221,200,189,219,173,253,217,144,13,216,112,237,213,77,173,211,39,61,209,255,156,206,
+211,220,203,165,220,200,116,188,197,64,92,194,9,220,190,207,27,187,146,59,183,83,43,179,
+16,235,174,203,122,170,131,234,165,56,42,161,235,73,156,157,89,151,76,73,146,251,24,141,
+168,232,135,84,168,130,0,104,125,172,39,120,88,247,114,5,199,109,180,182,104,99,198,99,
+21,230,94,200,37,90,125,149,85,53,37,81,240,228,76,173,212,72,110,244,68,49,52,65,
+247,179,61,192,83,58,140,51,55,91,51,52,45,115,49,1,211,46,217,98,44,179,34,42,
+144,2,40,112,18,38,83,82,36,56,178,34,32,66,33,10,2,32,247,225,30,230,225,29,
+216,17,29,204,113,28,195,241,27,188,145,27,184,97,27,182,97,27,183,129,27,186,209,27,
+192,65,28,201,241,28,213,193,29,229,241,30,250,97,32,19,34,34,49,34,36,84,114,38,
+124,18,41,168,2,44,217,50,47,15,179,50,73,131,54,136,147,58,204,243,62,20,148,67,
+96,116,72,176,148,77,4,245,82,91,133,88,181,69,94,19,38,100,114,54,106,212,86,112,
+55,151,118,155,231,124,0,88,134,201,200,146,142,217,158,75,90,170,252,10,181,160,203,190,
+52,140,199,183,28,207,39,141,213,132,205,218,207,221,222,6,190,225,43,126,227,64,110,228,
+73,174,228,72,78,228,61,78,227,40,174,225,9,110,223,224,141,220,173,13,217,112,221,212,
+39,253,207,211,92,202,116,12,196,9,252,188,146,59,181,16,187,172,131,138,163,235,217,153,
+76,185,143,168,72,133,0,200,122,88,87,112,180,54,102,21,134,92,125,85,83,240,212,74,
+110,20,67,247,3,60,140,179,53,45,19,48,217,50,43,144,2,39,83,130,35,32,162,32,
+247,97,30,216,193,28,195,193,27,184,97,27,183,161,27,192,145,28,213,81,30,250,49,33,
+49,66,37,124,130,42,217,242,48,73,131,56,204,67,65,96,4,75,4,181,85,181,53,97,
+114,70,109,55,183,121,0,152,140,142,185,164,252,10,186,52,124,203,39,77,216,207,109,224,
+43,14,228,73,142,228,61,142,226,9,14,222,173,13,215,39,61,205,116,156,192,146,11,177,
+131,186,158,76,137,138,0,136,117,180,86,97,125,5,79,110,116,63,140,211,50,217,2,41,
+83,2,34,247,129,29,195,129,27,183,1,28,213,161,31,49,194,39,217,146,52,204,3,70,
+4,85,91,114,118,115,0,232,152,252,74,195,40,237,220,43,174,228,61,158,224,174,125,210,
+116,60,185,131,202,148,0,72,107,125,213,70,140,147,45,82,114,31,195,97,27,213,33,35,
+216,194,60,4,37,103,0,216,175,38,173,226,62,206,218,117,44,168,0,232,87,139,67,37,
+194,97,29,218,50,80,0,88,207,133,78,196,0,200,59,123,177,48,0,88,232,0,184,23,
+0,40,131,101,120,137,201,184,143,44,217,149,142,233,155,238,217,161,75,154,167,166,42,173,
+253,138,178,81,171,183,162,139,188,238,43,193,54,140,197,122,172,201,185,124,205,243,252,208,
+41,45,212,90,29,215,135,189,217,174,13,220,209,13,222,239,205,223,8,62,225,29,94,226,
+44,62,227,56,222,227,65,78,228,70,142,228,73,174,228,74,158,228,72,110,228,67,14,228,
+60,142,227,51,222,226,39,14,226,24,14,225,7,238,223,244,157,222,222,45,221,197,141,219,
+170,189,217,140,205,215,108,189,213,73,109,211,35,253,208,250,92,206,207,140,203,161,156,200,
+112,108,197,60,28,194,5,140,190,203,219,186,142,251,182,78,219,178,12,171,174,199,58,170,
+127,170,165,53,250,160,233,41,156,154,57,151,74,41,146,249,8,141,167,216,135,83,168,130,
+0,104,125,173,55,120,89,7,115,7,231,109,182,214,104,102,230,99,23,22,95,203,101,90,
+129,213,85,57,101,81,244,52,77,178,20,73,114,52,69,53,132,65,251,243,61,196,163,58,
+144,115,55,95,131,52,49,179,49,6,19,47,221,162,44,183,82,42,148,66,40,116,82,38,
+86,130,36,59,226,34,34,114,33,12,34,32,249,1,31,232,1,30,217,49,29,205,129,28,
+196,1,28,189,161,27,184,113,27,182,97,27,183,129,27,186,193,27,192,49,28,200,209,28,
+212,177,29,227,209,30,248,65,32,17,2,34,47,2,36,82,82,38,121,242,40,166,226,43,
+215,18,47,13,147,50,71,99,54,134,131,58,202,227,62,18,132,67,94,100,72,175,132,77,
+3,229,82,90,117,88,181,53,94,18,38,100,114,54,106,212,86,112,55,151,118,155,231,124,
+0,88,134,201,200,146,142,233,158,75,106,170,253,26,181,162,235,190,54,172,199,185,60,207,
+41,173,213,135,237,218,209,253,222,8,222,225,44,142,227,65,110,228,73,174,228,72,62,228,
+60,62,227,39,142,225,7,78,223,222,93,220,170,205,216,108,157,212,35,173,207,207,28,202,
+112,204,195,5,188,188,142,235,180,12,123,172,127,90,163,233,169,153,74,153,143,167,56,133,
+0,216,122,89,119,112,182,102,102,23,182,92,129,149,83,244,36,75,114,84,67,251,67,60,
+144,243,53,49,99,48,221,114,43,148,66,39,86,178,35,34,194,32,249,129,30,217,209,28,
+196,209,27,184,97,27,183,161,27,191,129,28,212,49,30,248,17,33,47,34,37,121,98,42,
+215,210,48,71,99,56,202,35,65,94,244,74,3,165,85,181,37,97,114,70,109,55,183,121,
+0,152,140,142,185,164,253,42,186,54,156,203,41,109,216,209,141,224,44,30,228,73,142,228,
+61,126,226,7,238,221,170,205,214,35,253,204,112,92,192,142,203,176,127,154,158,74,121,138,
+0,152,117,182,118,97,129,69,79,114,180,63,144,19,51,221,66,41,86,34,34,249,145,29,
+195,129,27,183,241,27,212,129,31,47,162,39,215,114,52,202,227,69,3,85,91,114,118,115,
+0,232,152,253,106,195,42,29,221,44,174,228,60,126,224,170,61,210,111,236,184,127,170,148,
+0,104,107,129,37,71,145,211,45,86,146,31,196,97,27,212,241,34,214,162,60,3,37,103,
+0,248,175,40,205,226,62,142,218,113,252,167,0,24,88,143,131,37,194,65,29,216,18,80,
+0,120,207,132,254,195,0,24,60,124,145,48,0,72,232,0,200,23,0,40,131,101,120,137,
+201,184,143,45,233,149,143,249,155,238,233,161,76,170,167,167,58,173,254,154,178,83,187,183,
+163,171,188,239,75,193,55,172,197,123,188,201,187,140,205,245,28,209,43,77,212,92,61,215,
+137,221,217,176,45,220,211,45,222,241,237,223,10,94,225,30,126,226,46,78,227,57,238,227,
+65,78,228,71,158,228,74,174,228,74,158,228,72,110,228,67,254,227,59,126,227,50,206,226,
+37,238,225,22,238,224,5,206,223,241,109,222,219,253,220,194,93,219,167,141,217,137,157,215,
+104,125,213,69,45,211,31,189,208,246,28,206,203,76,203,156,76,200,107,28,197,55,204,193,
+0,76,190,198,139,186,138,171,182,74,155,178,8,107,174,195,250,169,123,122,165,50,202,160,
+230,249,155,152,9,151,72,9,146,248,248,140,166,200,135,83,152,130,0,120,125,173,71,120,
+90,23,115,8,7,110,184,6,105,104,22,100,26,70,95,206,149,90,133,21,86,61,165,81,
+248,116,77,182,100,73,118,132,69,58,196,65,0,68,62,201,243,58,149,195,55,100,195,52,
+53,243,49,10,83,47,225,226,44,187,146,42,152,114,40,119,130,38,89,178,36,62,18,35,
+37,162,33,15,66,32,251,33,31,234,33,30,219,65,29,206,145,28,197,17,28,189,161,27,
+184,113,27,182,97,27,182,113,27,185,193,27,191,33,28,199,193,28,210,145,29,226,177,30,
+246,33,32,15,226,33,45,226,35,80,50,38,119,210,40,164,194,43,213,242,46,11,131,50,
+69,83,54,133,99,58,201,195,62,17,100,67,93,84,72,173,116,77,2,213,82,89,101,88,
+180,37,94,18,22,100,113,38,106,211,86,112,55,151,118,155,231,124,0,88,134,201,216,146,
+143,233,158,76,122,170,254,58,181,163,251,190,55,188,199,187,92,207,43,205,213,137,13,219,
+211,29,223,10,238,225,46,158,227,65,126,228,74,174,228,72,62,228,59,46,227,37,110,225,
+5,30,223,219,45,220,167,157,216,104,93,212,31,109,207,203,204,201,107,124,195,0,108,188,
+138,171,180,8,59,172,123,42,163,230,137,153,72,137,143,166,56,133,0,216,122,90,135,112,
+184,134,102,26,230,92,133,213,83,248,100,75,118,164,67,0,148,60,149,67,54,53,163,48,
+225,178,43,152,114,39,89,226,35,37,242,32,251,161,30,219,225,28,197,209,27,184,97,27,
+182,145,27,191,113,28,210,33,30,246,241,32,45,2,37,119,66,42,213,178,48,69,83,56,
+201,19,65,93,212,74,2,149,85,180,37,97,113,54,109,55,183,121,0,152,140,143,201,164,
+254,58,186,56,188,203,43,157,216,211,173,224,46,46,228,74,142,228,60,94,226,5,190,221,
+167,141,214,31,189,204,107,12,192,138,139,176,124,106,158,72,105,138,0,168,117,184,166,97,
+132,133,79,118,4,64,149,83,51,225,130,41,89,82,34,251,177,29,196,129,27,182,225,27,
+210,97,31,45,114,39,213,82,52,200,211,69,2,69,91,113,118,115,0,248,152,254,122,195,
+44,61,221,45,174,228,59,94,224,167,253,209,107,172,184,124,138,148,0,136,107,132,101,71,
+149,19,46,89,178,31,197,97,27,211,209,34,212,146,60,2,21,103,0,8,176,42,221,226,
+61,94,218,108,188,167,0,88,88,148,179,37,195,49,29,214,2,80,0,152,207,130,190,195,
+0,88,60,126,113,48,0,40,232,0,232,23,0,40,131,101,120,137,201,184,143,45,233,149,
+143,249,155,239,233,161,77,170,167,168,74,173,255,170,178,84,203,183,164,187,188,241,91,193,
+57,204,197,125,220,201,188,172,205,247,60,209,45,109,212,94,93,215,139,253,217,178,77,220,
+213,77,222,243,13,224,12,110,225,32,142,226,47,94,227,58,238,227,66,94,228,71,158,228,
+74,174,228,74,158,228,71,94,228,66,254,227,58,110,227,48,174,226,36,206,225,20,206,224,
+3,158,223,239,77,222,216,205,220,191,45,219,163,93,217,133,93,215,100,61,213,65,237,210,
+27,125,208,242,204,205,198,252,202,152,252,199,102,220,196,50,124,193,251,251,189,194,75,186,
+133,107,182,70,91,178,4,43,174,191,202,169,120,58,165,46,154,160,227,201,155,150,233,150,
+70,233,145,246,216,140,165,200,135,82,152,130,0,120,125,174,71,120,91,55,115,10,39,110,
+186,38,105,106,70,100,29,118,95,210,213,90,136,69,86,65,229,81,252,180,77,186,164,73,
+123,196,69,62,20,66,5,148,62,206,51,59,154,19,56,104,19,53,58,67,50,14,147,47,
+229,34,45,191,210,42,156,178,40,123,178,38,93,226,36,65,66,35,40,194,33,17,114,32,
+253,65,31,236,65,30,220,97,29,208,161,28,198,17,28,190,177,27,185,113,27,182,97,27,
+182,113,27,185,177,27,190,33,28,198,177,28,209,129,29,224,161,30,244,1,32,13,194,33,
+43,194,35,78,18,38,117,178,40,162,162,43,211,210,46,9,99,50,68,51,54,131,67,58,
+199,179,62,15,84,67,92,68,72,172,100,77,1,197,82,88,101,88,179,37,94,17,22,100,
+113,38,106,211,86,112,55,151,118,155,231,124,0,88,134,201,216,146,143,249,158,77,138,170,
+255,74,181,164,27,191,57,220,199,188,124,207,45,237,213,139,45,219,213,61,223,12,14,226,
+47,174,227,66,126,228,74,174,228,71,46,228,58,14,227,36,78,225,3,254,222,216,253,219,
+163,93,216,100,29,212,27,45,207,198,140,201,102,44,195,251,43,188,133,107,180,4,251,171,
+120,234,162,227,105,153,70,105,143,165,40,133,0,232,122,91,167,112,186,166,102,29,38,93,
+136,21,84,252,164,75,123,228,67,5,228,60,154,131,54,58,227,48,229,242,43,156,178,39,
+93,18,36,40,18,33,253,193,30,220,1,29,198,225,27,185,97,27,182,145,27,190,97,28,
+209,1,30,244,209,32,43,226,36,117,34,42,211,146,48,68,51,56,199,243,64,92,196,74,
+1,133,85,179,21,97,113,54,109,55,183,121,0,152,140,143,217,164,255,74,186,57,204,203,
+45,189,216,213,205,224,47,46,228,74,126,228,58,78,226,3,142,221,164,77,214,27,109,204,
+103,188,191,133,75,176,120,58,158,70,89,138,0,184,117,186,214,97,136,197,79,123,84,64,
+153,163,51,229,194,41,92,130,34,253,193,29,198,145,27,182,225,27,209,65,31,43,82,39,
+211,66,52,199,195,69,1,53,91,113,118,115,0,248,152,255,154,195,46,93,221,47,190,228,
+58,62,224,164,189,209,102,92,184,120,106,148,0,168,107,136,181,71,154,83,46,92,210,31,
+198,81,27,209,177,34,210,114,60,1,21,103,0,24,176,44,237,226,60,30,218,103,140,167,
+0,136,88,153,243,37,196,33,29,212,242,79,0,184,207,129,126,195,0,152,60,127,81,48,
+0,24,232,0,248,23,0,56,131,101,120,137,202,200,143,45,249,149,143,9,156,240,249,161,
+77,186,167,168,90,173,0,187,178,85,235,183,165,203,188,242,123,193,59,220,197,127,252,201,
+190,204,205,249,92,209,47,141,212,96,125,215,141,29,218,180,109,220,215,109,222,245,45,224,
+13,142,225,33,174,226,49,110,227,59,254,227,67,110,228,72,158,228,74,174,228,74,142,228,
+71,78,228,65,238,227,57,78,227,47,158,226,34,190,225,19,174,224,1,126,223,236,29,222,
+213,157,220,188,237,218,160,29,217,130,29,215,97,253,212,61,173,210,23,45,208,237,140,205,
+194,188,202,147,188,199,98,140,196,46,60,193,247,171,189,189,251,185,129,27,182,65,27,178,
+0,235,173,187,138,169,116,10,165,43,106,160,224,169,155,147,201,150,68,217,145,244,200,140,
+164,184,135,82,152,130,0,120,125,174,87,120,92,71,115,12,55,110,188,70,105,109,102,100,
+32,166,95,213,5,91,140,133,86,69,37,82,0,245,77,191,244,73,127,20,70,67,100,66,
+9,212,62,210,131,59,158,83,56,109,83,53,62,131,50,19,227,47,233,98,45,195,18,43,
+159,242,40,126,242,38,96,34,37,68,114,35,43,242,33,20,146,32,255,97,31,237,81,30,
+222,113,29,209,193,28,199,33,28,191,193,27,185,129,27,182,97,27,182,113,27,184,161,27,
+189,17,28,197,161,28,207,97,29,223,129,30,243,225,31,11,162,33,41,162,35,76,242,37,
+115,146,40,160,130,43,209,178,46,7,67,50,66,19,54,129,51,58,197,147,62,14,68,67,
+91,36,72,171,84,77,0,181,82,88,85,88,179,21,94,16,6,100,113,22,106,211,70,112,
+54,151,118,155,215,124,0,88,134,202,216,146,143,9,159,77,138,170,0,91,181,165,43,191,
+59,252,199,190,156,207,47,13,214,141,77,219,215,93,223,14,30,226,48,190,227,67,142,228,
+74,174,228,71,30,228,57,254,226,34,62,225,1,206,222,213,205,219,160,45,216,97,221,211,
+23,221,206,194,60,201,98,236,194,247,219,187,129,27,180,0,187,171,116,186,162,224,57,153,
+68,73,143,164,40,133,0,232,122,92,199,112,188,214,102,32,86,93,140,85,84,0,245,75,
+127,52,68,9,36,61,158,211,54,62,51,49,233,50,44,159,226,39,96,66,36,43,66,33,
+255,209,30,222,17,29,199,241,27,185,97,27,182,129,27,189,81,28,208,241,29,242,177,32,
+41,194,36,115,2,42,209,114,48,66,19,56,197,227,64,91,180,74,0,133,85,179,5,97,
+113,54,109,54,183,121,0,168,140,143,217,164,0,91,186,59,236,203,47,221,216,215,221,224,
+48,62,228,74,126,228,57,46,226,1,94,221,160,29,214,22,45,204,98,124,191,129,11,176,
+116,10,158,68,73,138,0,200,117,188,6,98,140,5,80,127,148,64,158,227,51,234,242,41,
+96,178,34,255,225,29,199,145,27,182,209,27,208,49,31,41,50,39,209,34,52,197,179,69,
+0,53,91,113,102,115,0,8,153,0,171,195,48,125,221,48,190,228,57,30,224,161,109,209,
+98,28,184,116,74,148,0,200,107,140,245,71,158,163,46,95,242,31,199,81,27,208,145,34,
+208,98,60,0,5,103,0,40,176,46,253,226,59,238,217,99,76,167,0,200,88,157,35,38,
+197,17,29,210,226,79,0,232,207,127,62,195,0,216,60,129,33,48,0,248,231,0,24,24,
+0,56,131,101,136,137,202,200,143,46,249,149,144,9,156,240,249,161,78,202,167,169,106,173,
+1,203,178,86,251,183,167,235,188,243,139,193,60,252,197,128,28,202,192,236,205,251,124,209,
+49,173,212,98,157,215,143,61,218,182,141,220,217,141,222,247,77,224,15,174,225,35,190,226,
+50,142,227,60,14,228,67,110,228,72,158,228,74,174,228,73,142,228,70,78,228,64,222,227,
+56,62,227,45,126,226,32,158,225,17,142,224,254,77,223,234,237,221,211,109,220,185,189,218,
+157,237,216,126,237,214,93,189,212,57,109,210,18,237,207,233,60,205,189,108,202,143,108,199,
+93,60,196,41,236,192,242,107,189,184,187,185,124,219,181,61,219,177,251,170,173,183,74,169,
+113,218,164,40,58,160,221,121,155,145,169,150,66,185,145,243,184,140,163,168,135,81,152,130,
+0,120,125,175,103,120,93,87,115,13,87,110,190,102,105,111,150,100,35,214,95,216,53,91,
+143,197,86,73,101,82,5,53,78,195,52,74,132,84,70,72,164,66,14,36,63,215,211,59,
+163,163,56,113,163,53,67,211,50,23,35,48,238,162,45,199,82,43,163,34,41,130,34,39,
+99,82,37,71,162,35,45,34,34,22,194,32,2,130,31,239,113,30,224,145,29,211,209,28,
+200,49,28,192,193,27,186,129,27,183,97,27,182,113,27,184,161,27,189,1,28,196,129,28,
+206,81,29,221,97,30,241,193,31,9,130,33,39,130,35,74,210,37,113,114,40,158,98,43,
+207,146,46,5,35,50,64,243,53,128,19,58,196,131,62,13,36,67,89,20,72,170,68,77,
+255,164,82,87,69,88,178,21,94,16,6,100,112,22,106,210,70,112,54,135,118,155,215,124,
+0,88,134,202,232,146,144,9,159,78,154,170,1,107,181,167,59,191,60,12,200,192,188,207,
+49,45,214,143,109,219,217,125,223,15,62,226,50,206,227,67,142,228,74,158,228,70,14,228,
+56,222,226,32,30,225,254,173,222,211,157,219,157,237,215,93,157,211,18,157,206,189,252,200,
+93,156,194,242,139,187,124,219,179,251,122,171,113,138,162,221,25,153,66,57,143,163,24,133,
+0,248,122,93,215,112,190,246,102,35,134,93,143,149,84,5,53,76,132,132,68,14,116,61,
+163,19,55,67,115,49,238,114,44,163,34,40,99,114,36,45,98,33,2,242,30,224,49,29,
+200,1,28,186,113,27,182,129,27,189,65,28,206,209,29,241,145,32,39,162,36,113,226,41,
+207,82,48,64,3,56,196,211,64,89,164,74,255,116,85,178,5,97,112,38,109,54,183,121,
+0,168,140,144,233,164,1,123,186,60,12,204,49,253,216,217,253,224,50,78,228,74,110,228,
+56,14,226,254,61,221,157,221,213,18,221,203,93,44,191,124,187,175,113,218,157,66,57,138,
+0,216,117,190,54,98,143,85,80,132,228,64,163,51,52,238,50,42,99,210,34,2,2,30,
+200,161,27,182,193,27,206,17,31,39,18,39,207,2,52,196,147,69,255,36,91,112,102,115,
+0,8,153,1,203,195,50,157,221,49,190,228,56,238,223,157,45,209,93,204,183,113,42,148,
+0,232,107,143,69,72,163,227,46,99,34,32,201,81,27,207,113,34,206,66,60,255,4,103,
+0,56,176,48,29,227,58,174,217,94,28,167,0,248,88,162,99,38,198,241,28,208,210,79,
+0,8,208,126,238,194,0,40,61,130,1,48,0,232,231,0,40,24,0,56,131,101,136,137,
+202,200,143,46,249,149,144,25,156,241,9,162,79,218,167,170,106,173,2,219,178,87,11,184,
+168,251,188,245,171,193,62,12,198,130,44,202,194,12,206,253,156,209,51,205,212,100,189,215,
+145,93,218,184,173,220,219,173,222,248,93,224,17,190,225,37,206,226,51,158,227,61,30,228,
+68,126,228,72,174,228,74,174,228,73,142,228,70,62,228,64,206,227,55,46,227,44,110,226,
+31,126,225,15,110,224,252,45,223,231,205,221,208,61,220,182,141,218,153,173,216,122,173,214,
+89,125,212,53,45,210,14,173,207,229,252,204,185,44,202,138,44,199,89,252,195,36,156,192,
+237,27,189,180,107,185,120,139,181,57,139,177,247,106,173,179,26,169,109,154,164,37,10,160,
+218,73,155,142,121,150,64,153,145,241,168,140,161,152,135,81,136,130,0,136,125,175,119,120,
+95,103,115,15,119,110,192,150,105,114,198,100,38,6,96,219,117,91,147,245,86,77,165,82,
+9,133,78,199,132,74,136,164,70,76,244,66,19,116,63,220,19,60,167,227,56,118,227,53,
+71,19,51,27,99,48,242,226,45,203,146,43,167,98,41,134,98,39,103,130,37,74,210,35,
+48,66,34,25,226,32,4,162,31,241,145,30,225,161,29,212,225,28,201,65,28,192,209,27,
+186,129,27,183,97,27,182,97,27,184,145,27,188,241,27,195,113,28,205,65,29,219,81,30,
+239,177,31,8,98,33,37,98,35,72,178,37,111,82,40,156,66,43,205,114,46,3,3,50,
+62,227,53,126,3,58,194,99,62,11,20,67,88,4,72,169,52,77,254,164,82,86,53,88,
+177,5,94,15,246,99,112,22,106,210,70,112,54,135,118,155,215,124,0,88,134,202,232,146,
+144,25,159,79,170,170,2,123,181,168,91,191,62,44,200,194,220,207,51,77,214,145,141,219,
+219,141,223,17,94,226,51,222,227,68,142,228,74,158,228,70,14,228,55,206,226,30,254,224,
+252,125,222,208,109,219,153,173,215,89,93,211,14,93,206,185,172,200,89,76,194,237,75,187,
+120,155,179,247,58,171,109,90,162,218,233,152,64,25,143,161,24,133,0,248,122,95,247,112,
+192,38,103,38,182,93,147,213,84,9,117,76,136,196,68,19,196,61,168,99,55,71,179,49,
+242,178,44,167,98,40,103,162,36,48,146,33,4,18,31,225,65,29,201,1,28,186,113,27,
+182,129,27,188,49,28,205,177,29,239,129,32,37,130,36,111,194,41,205,50,48,62,227,55,
+194,179,64,88,148,74,254,100,85,177,245,96,112,38,109,54,183,121,0,168,140,144,249,164,
+2,139,186,62,44,204,51,29,217,219,29,225,51,78,228,74,110,228,55,254,225,252,13,221,
+153,157,213,14,157,203,89,220,190,120,123,175,109,170,157,64,41,138,0,232,117,192,102,98,
+147,149,80,136,52,65,167,115,52,242,114,42,103,2,35,4,18,30,201,161,27,182,193,27,
+205,241,30,37,242,38,205,226,51,194,131,69,254,20,91,112,102,115,0,24,153,2,219,195,
+52,189,221,51,190,228,54,206,223,154,237,208,88,140,183,109,10,148,0,8,108,147,133,72,
+168,35,47,102,66,32,202,81,27,205,81,34,204,50,60,254,244,102,0,72,176,49,45,227,
+58,126,217,89,236,166,0,40,89,167,147,38,198,225,28,207,194,79,0,40,208,124,174,194,
+0,104,61,132,225,47,0,200,231,0,72,24,0,56,131,101,136,137,202,200,143,46,9,150,
+145,25,156,241,9,162,79,218,167,171,122,173,3,235,178,88,27,184,169,11,189,246,187,193,
+63,44,198,132,76,202,195,44,206,255,172,209,53,237,212,102,221,215,147,125,218,186,205,220,
+221,205,222,250,125,224,19,222,225,38,238,226,52,174,227,62,46,228,69,126,228,73,174,228,
+74,174,228,73,126,228,69,46,228,63,190,227,54,30,227,43,78,226,29,94,225,12,62,224,
+250,253,222,229,157,221,205,13,220,179,93,218,150,125,216,119,109,214,85,61,212,49,237,209,
+10,93,207,224,188,204,180,220,201,133,220,198,84,172,195,32,92,192,233,203,188,175,27,185,
+115,75,181,52,75,177,243,42,173,175,218,168,106,106,164,33,218,159,215,41,155,140,89,150,
+62,121,145,240,136,140,160,136,135,80,136,130,0,136,125,176,135,120,96,135,115,16,151,110,
+194,182,105,116,230,100,41,54,96,223,165,91,151,53,87,81,229,82,13,197,78,204,196,74,
+141,244,70,81,68,67,23,180,63,224,99,60,172,51,57,123,51,54,76,83,51,32,179,48,
+246,34,46,207,210,43,171,162,41,137,146,39,106,178,37,77,2,36,51,114,34,27,18,33,
+6,210,31,244,177,30,227,193,29,213,241,28,202,81,28,193,225,27,187,145,27,183,97,27,
+182,97,27,183,145,27,187,225,27,194,97,28,204,33,29,218,49,30,237,145,31,6,66,33,
+35,66,35,70,146,37,109,50,40,154,34,43,203,98,46,1,227,49,61,195,53,124,227,57,
+193,83,62,10,4,67,87,244,71,168,36,77,253,148,82,85,53,88,177,5,94,15,246,99,
+111,6,106,210,70,112,54,135,118,155,215,124,0,88,134,202,232,146,145,25,159,79,186,170,
+3,139,181,169,107,191,63,60,200,195,252,207,53,109,214,147,173,219,221,173,223,19,110,226,
+52,238,227,69,158,228,74,158,228,69,254,227,54,190,226,29,206,224,250,93,222,205,61,219,
+150,125,215,85,29,211,10,13,206,180,92,200,84,12,194,233,251,186,115,75,179,243,250,170,
+106,26,162,215,201,152,62,9,143,160,8,133,0,8,123,96,7,113,194,70,103,41,246,93,
+150,21,85,13,197,76,141,20,69,23,4,62,172,179,55,76,3,50,246,242,44,171,146,40,
+106,210,36,51,178,33,6,66,31,227,81,29,202,17,28,187,113,27,182,113,27,187,33,28,
+204,161,29,237,97,32,35,98,36,109,162,41,203,18,48,61,211,55,193,163,64,87,132,74,
+253,84,85,177,245,96,111,38,109,54,183,121,0,168,140,145,249,164,3,155,186,63,60,204,
+53,61,217,221,61,225,52,94,228,74,94,228,54,222,225,250,221,220,150,93,213,10,77,203,
+84,156,190,115,59,175,106,122,157,62,9,138,0,8,118,194,150,98,150,213,80,141,116,65,
+172,195,52,246,178,42,106,50,35,6,50,30,202,177,27,182,177,27,204,209,30,35,210,38,
+203,210,51,193,115,69,253,20,91,111,102,115,0,24,153,3,251,195,54,221,221,52,190,228,
+53,174,223,150,173,208,83,60,183,106,234,147,0,40,108,150,213,72,173,99,47,106,98,32,
+203,81,27,204,49,34,202,18,60,253,244,102,0,104,176,51,61,227,57,62,217,84,172,166,
+0,104,89,172,211,38,199,209,28,205,162,79,0,72,208,123,110,194,0,168,61,133,193,47,
+0,184,231,0,88,24,0,56,131,101,136,137,202,216,143,46,9,150,145,41,156,242,25,162,
+80,234,167,171,138,173,4,251,178,89,43,184,170,27,189,247,219,193,64,60,198,133,108,202,
+197,60,206,0,205,209,55,13,213,104,253,215,149,157,218,188,237,220,223,237,222,252,157,224,
+20,254,225,40,254,226,54,190,227,63,62,228,69,142,228,73,174,228,74,174,228,73,126,228,
+69,46,228,62,174,227,53,254,226,41,46,226,27,62,225,10,30,224,247,221,222,226,109,221,
+202,221,219,175,29,218,147,61,216,115,45,214,81,253,211,45,157,209,6,29,207,220,108,204,
+176,140,201,129,140,198,79,92,195,27,12,192,228,139,188,171,219,184,111,11,181,48,11,177,
+239,234,172,172,154,168,102,42,164,30,170,159,213,249,154,137,57,150,60,89,145,238,120,140,
+159,136,135,80,136,130,0,136,125,176,135,120,97,151,115,18,183,110,196,214,105,119,22,101,
+44,102,96,226,229,91,154,117,87,84,37,83,17,5,79,208,4,75,145,52,71,85,132,67,
+28,4,64,229,179,60,177,131,57,127,131,54,80,163,51,36,243,48,250,114,46,211,18,44,
+175,226,41,141,210,39,109,242,37,81,50,36,54,162,34,30,50,33,9,242,31,246,209,30,
+229,225,29,215,17,29,203,97,28,194,225,27,187,145,27,183,97,27,182,97,27,183,129,27,
+187,209,27,193,81,28,202,17,29,216,17,30,236,113,31,4,34,33,33,34,35,68,114,37,
+107,18,40,152,2,43,201,66,46,0,211,49,59,163,53,123,211,57,192,67,62,9,244,66,
+86,228,71,167,20,77,252,132,82,85,37,88,176,245,93,14,230,99,111,6,106,210,54,112,
+54,135,118,155,215,124,0,88,134,202,232,146,145,41,159,80,186,170,4,155,181,170,123,191,
+64,92,200,197,12,208,55,141,214,149,205,219,223,205,223,20,142,226,54,254,227,69,158,228,
+74,158,228,68,238,227,53,158,226,27,174,224,247,45,222,202,253,218,147,61,215,81,221,210,
+6,205,205,176,28,200,79,188,193,228,187,186,111,11,179,239,202,170,102,234,161,212,153,152,
+60,233,142,159,8,133,0,8,123,97,39,113,196,118,103,44,38,94,154,69,85,17,5,77,
+145,84,69,28,84,62,177,243,55,80,67,50,250,50,45,175,210,40,109,18,37,54,226,33,
+9,98,31,229,113,29,203,33,28,188,113,27,182,113,27,187,17,28,202,129,29,236,65,32,
+33,66,36,107,130,41,201,2,48,59,179,55,192,147,64,86,116,74,252,84,85,176,229,96,
+111,38,109,54,183,121,0,168,140,145,9,165,4,171,186,65,92,204,55,93,217,223,77,225,
+53,110,228,74,78,228,53,190,225,247,173,220,147,29,213,5,13,203,79,76,190,111,251,174,
+102,74,157,60,249,137,0,24,118,196,198,98,154,21,81,145,196,65,177,3,53,251,242,42,
+109,98,35,9,82,30,203,193,27,182,161,27,203,193,30,33,178,38,201,178,51,191,99,69,
+252,4,91,111,102,115,0,24,153,4,11,196,56,237,221,53,190,228,52,126,223,147,93,208,
+79,252,182,102,202,147,0,72,108,154,21,73,177,179,47,109,146,32,204,81,27,203,33,34,
+200,2,60,252,244,102,0,120,176,53,77,227,56,14,217,79,124,166,0,152,89,177,3,39,
+200,193,28,203,146,79,0,104,208,121,30,194,0,248,61,135,161,47,0,152,231,0,120,24,
+0,56,131,102,136,137,203,216,143,47,9,150,145,41,156,242,41,162,80,250,167,172,154,173,
+5,11,179,90,59,184,171,59,189,249,235,193,66,92,198,135,124,202,199,92,206,2,237,209,
+57,45,213,106,29,216,151,189,218,190,13,221,225,13,223,254,189,224,22,14,226,41,30,227,
+55,206,227,64,62,228,70,142,228,73,174,228,74,174,228,72,110,228,68,30,228,61,158,227,
+51,238,226,40,30,226,25,30,225,8,254,223,245,173,222,223,61,221,199,173,219,172,237,217,
+143,253,215,111,253,213,77,189,211,40,93,209,1,221,206,215,28,204,171,76,201,124,60,198,
+74,28,195,22,188,191,223,59,188,166,139,184,106,187,180,44,187,176,235,154,172,168,90,168,
+98,250,163,27,106,159,210,201,154,135,25,150,58,73,145,237,104,140,158,120,135,79,136,130,
+0,136,125,177,151,120,98,167,115,19,199,110,198,246,105,121,70,101,46,166,96,229,21,92,
+158,181,87,88,117,83,21,85,79,212,84,75,150,132,71,90,212,67,33,84,64,234,243,60,
+182,211,57,132,195,54,85,243,51,41,51,49,255,178,46,216,82,44,179,18,42,145,18,40,
+113,34,38,84,98,36,57,210,34,33,98,33,11,18,32,248,241,30,231,241,29,216,33,29,
+205,113,28,195,241,27,188,161,27,184,113,27,182,97,27,183,129,27,186,209,27,192,65,28,
+201,241,28,215,1,30,234,81,31,2,2,33,31,2,35,66,82,37,105,242,39,150,226,42,
+199,34,46,254,178,49,57,147,53,121,179,57,190,35,62,7,212,66,85,212,71,166,4,77,
+251,116,82,84,21,88,176,229,93,14,230,99,111,6,106,209,54,112,53,135,118,154,215,124,
+0,104,134,203,248,146,145,41,159,80,202,170,5,171,181,171,155,191,66,124,200,199,44,208,
+57,173,214,151,237,219,225,237,223,22,158,226,55,14,228,70,158,228,74,142,228,68,222,227,
+52,142,226,25,142,224,245,253,221,199,205,218,143,253,214,77,141,210,1,125,205,171,204,199,
+74,108,193,223,107,186,106,203,178,235,138,170,98,186,161,210,121,152,58,217,142,158,248,132,
+0,24,123,98,55,113,198,150,103,46,86,94,158,133,85,21,69,77,150,164,69,33,164,62,
+182,67,56,85,147,50,255,130,45,179,18,41,113,66,37,57,18,34,11,130,31,231,129,29,
+205,49,28,188,129,27,182,113,27,186,1,28,201,113,29,234,33,32,31,34,36,105,98,41,
+199,226,47,57,147,55,190,115,64,85,100,74,251,68,85,176,229,96,111,22,109,53,183,121,
+0,168,140,145,25,165,5,187,186,66,124,204,57,125,217,225,109,225,54,110,228,74,78,228,
+52,158,225,245,125,220,143,221,212,1,189,202,74,252,189,106,187,174,98,42,157,58,233,137,
+0,40,118,198,230,98,158,85,81,150,20,66,182,83,53,255,50,43,113,146,35,11,114,30,
+204,193,27,182,161,27,202,161,30,31,146,38,199,146,51,190,83,69,251,244,90,111,102,115,
+0,40,153,4,43,196,57,13,222,54,190,228,51,94,223,144,29,208,74,172,182,98,170,147,
+0,104,108,158,101,73,182,243,47,112,178,32,205,81,27,202,1,34,199,226,59,252,228,102,
+0,136,176,55,93,227,55,206,216,75,60,166,0,216,89,181,67,39,201,177,28,201,130,79,
+0,152,208,120,222,193,0,56,62,136,113,47,0,136,231,0,136,24,0,56,131,102,136,137,
+203,216,143,47,25,150,146,41,156,243,41,162,81,250,167,173,170,173,6,27,179,91,75,184,
+172,75,189,250,251,193,67,108,198,136,156,202,200,124,206,4,13,210,59,77,213,108,61,216,
+153,221,218,192,45,221,226,45,223,0,206,224,24,46,226,42,46,227,56,222,227,65,78,228,
+70,142,228,74,174,228,74,158,228,72,110,228,67,14,228,60,126,227,50,206,226,38,254,225,
+23,254,224,6,222,223,243,141,222,220,29,221,196,125,219,169,189,217,140,205,215,108,189,213,
+73,125,211,36,29,209,253,140,206,211,220,203,166,252,200,119,252,197,70,204,194,17,108,191,
+219,235,187,161,75,184,101,123,180,39,123,176,231,90,172,164,26,168,95,186,163,24,58,159,
+207,169,154,132,233,149,56,41,145,235,72,140,157,104,135,79,120,130,0,152,125,177,167,120,
+99,199,115,21,231,110,200,38,106,124,102,101,49,214,96,232,85,92,161,245,87,92,181,83,
+25,149,79,217,148,75,155,196,71,95,36,68,37,164,64,239,67,61,186,19,58,137,19,55,
+90,51,52,45,131,49,3,243,46,220,146,44,183,82,42,148,66,40,116,82,38,87,146,36,
+60,242,34,36,130,33,13,50,32,250,17,31,233,17,30,218,65,29,206,145,28,196,1,28,
+189,161,27,184,113,27,182,97,27,182,129,27,186,193,27,191,49,28,200,225,28,214,225,29,
+232,65,31,0,226,32,30,226,34,64,50,37,103,210,39,148,194,42,197,2,46,252,146,49,
+56,115,53,120,163,57,189,19,62,6,196,66,84,196,71,165,244,76,250,100,82,83,21,88,
+175,229,93,13,230,99,110,246,105,209,54,112,53,135,118,154,215,124,0,104,134,203,248,146,
+146,57,159,81,218,170,6,187,181,172,171,191,67,140,200,200,76,208,59,205,214,153,13,220,
+226,13,224,24,174,226,56,30,228,70,158,228,74,142,228,67,206,227,50,110,226,23,110,224,
+243,205,221,196,157,218,140,205,214,73,77,210,253,60,205,166,124,199,70,28,193,219,27,186,
+101,123,178,230,74,170,95,138,161,207,73,152,56,185,142,157,248,132,0,24,123,99,87,113,
+200,198,103,49,134,94,161,197,85,26,149,77,155,244,69,37,244,62,186,147,56,90,211,50,
+3,195,45,183,66,41,116,114,37,60,66,34,13,162,31,233,161,29,206,65,28,189,129,27,
+182,113,27,186,241,27,200,97,29,232,1,32,30,2,36,103,66,41,197,194,47,56,131,55,
+189,99,64,84,84,74,250,52,85,175,213,96,110,22,109,53,167,121,0,184,140,146,25,165,
+6,203,186,67,156,204,58,157,217,227,125,225,56,126,228,74,62,228,50,126,225,242,77,220,
+140,157,212,253,108,202,70,172,189,101,123,174,95,250,156,56,217,137,0,56,118,200,22,99,
+161,149,81,155,100,66,186,163,53,3,115,43,116,194,35,14,146,30,206,209,27,182,145,27,
+200,145,30,29,114,38,198,114,51,189,67,69,250,244,90,110,86,115,0,40,153,5,59,196,
+59,45,222,55,190,228,49,46,223,140,221,207,69,108,182,95,138,147,0,136,108,161,165,73,
+187,51,48,116,210,32,207,81,27,201,225,33,197,210,59,251,228,102,0,152,176,56,109,227,
+54,158,216,70,12,166,0,8,90,186,115,39,202,161,28,200,114,79,0,184,208,118,142,193,
+0,136,62,138,81,47,0,104,231,0,168,24,0,56,131,102,136,137,203,216,143,47,25,150,
+146,57,156,243,57,162,82,10,168,174,170,173,6,43,179,92,91,184,173,91,189,251,11,194,
+69,140,198,138,172,202,202,140,206,6,45,210,60,109,213,110,93,216,155,253,218,194,77,221,
+228,61,223,1,238,224,25,62,226,44,62,227,57,238,227,66,94,228,71,158,228,74,174,228,
+74,158,228,71,94,228,66,254,227,59,110,227,49,190,226,36,222,225,21,222,224,4,174,223,
+240,93,222,218,237,220,193,77,219,166,125,217,136,141,215,104,125,213,69,61,211,32,221,208,
+248,76,206,206,140,203,162,172,200,114,172,197,65,124,194,13,28,191,214,155,187,156,251,183,
+97,43,180,35,59,176,226,26,172,160,234,167,91,138,163,20,10,159,204,121,154,130,201,149,
+54,9,145,234,56,140,156,88,135,78,120,130,0,152,125,178,183,120,100,215,115,22,7,111,
+202,70,106,126,150,101,52,6,97,236,133,92,165,37,88,96,245,83,30,213,79,221,228,75,
+159,20,72,100,116,68,42,244,64,243,147,61,191,99,58,142,99,55,94,131,52,50,195,49,
+8,51,47,224,210,44,187,146,42,152,130,40,120,146,38,90,194,36,63,34,35,38,178,33,
+16,98,32,252,49,31,235,49,30,220,81,29,207,161,28,197,17,28,190,177,27,185,113,27,
+182,97,27,182,113,27,185,177,27,190,33,28,199,209,28,212,209,29,231,33,31,255,209,32,
+28,194,34,62,18,37,101,178,39,146,162,42,196,226,45,250,130,49,54,99,53,118,131,57,
+187,3,62,5,180,66,83,180,71,164,228,76,250,100,82,82,5,88,174,213,93,13,214,99,
+110,246,105,209,54,112,53,135,118,154,215,124,0,104,134,203,248,146,146,57,159,82,234,170,
+6,203,181,173,187,191,69,172,200,202,108,208,60,237,214,155,45,220,228,29,224,25,206,226,
+57,46,228,71,174,228,74,126,228,66,190,227,49,78,226,21,78,224,240,173,221,193,109,218,
+136,141,214,69,13,210,248,236,204,162,44,199,65,220,192,214,203,185,97,59,178,226,10,170,
+91,74,161,204,41,152,54,169,142,156,232,132,0,40,123,100,103,113,202,230,103,52,198,94,
+165,5,86,30,213,77,159,68,70,42,52,63,191,227,56,94,35,51,8,3,46,187,130,41,
+120,162,37,63,98,34,16,194,31,235,193,29,207,81,28,190,145,27,182,97,27,185,225,27,
+199,65,29,231,241,31,28,226,35,101,34,41,196,162,47,54,99,55,187,83,64,83,68,74,
+250,36,85,174,213,96,110,22,109,53,167,121,0,184,140,146,41,165,6,219,186,69,172,204,
+60,189,217,229,157,225,57,126,228,74,46,228,49,94,225,240,29,220,136,93,212,248,44,202,
+65,108,189,97,43,174,91,202,156,54,201,137,0,72,118,202,70,99,165,229,81,159,164,66,
+191,227,53,8,179,43,120,242,35,16,178,30,207,225,27,182,145,27,199,113,30,27,82,38,
+196,98,51,187,51,69,250,228,90,110,86,115,0,40,153,6,75,196,61,77,222,56,190,228,
+48,14,223,137,141,207,64,28,182,91,106,147,0,168,108,165,245,73,192,131,48,119,2,33,
+208,81,27,200,193,33,195,194,59,250,228,102,0,168,176,58,125,227,53,94,216,65,204,165,
+0,72,90,191,179,39,203,145,28,198,98,79,0,216,208,116,78,193,0,200,62,140,49,47,
+0,72,231,0,200,24,0,56,131,102,152,137,203,216,143,47,25,150,146,57,156,243,57,162,
+82,26,168,174,186,173,7,43,179,93,107,184,175,107,189,252,43,194,70,156,198,139,204,202,
+204,172,206,7,61,210,62,141,213,112,125,216,156,29,219,196,109,221,230,93,223,3,254,224,
+27,78,226,45,78,227,58,254,227,66,94,228,71,158,228,74,174,228,74,158,228,71,94,228,
+66,238,227,58,94,227,48,158,226,35,190,225,19,190,224,2,142,223,238,61,222,215,189,220,
+190,13,219,162,77,217,132,93,215,100,61,213,65,253,210,28,141,208,244,252,205,202,76,203,
+157,108,200,110,92,197,60,44,194,8,220,190,209,91,187,152,171,183,92,219,179,30,235,175,
+222,218,171,156,170,167,87,74,163,17,218,158,201,73,154,127,169,149,52,233,144,232,40,140,
+155,88,135,78,120,130,0,152,125,178,183,120,101,231,115,24,39,111,204,102,106,129,198,101,
+55,54,97,239,197,92,169,101,88,100,53,84,34,37,80,226,52,76,164,100,72,104,180,68,
+47,52,65,248,227,61,196,179,58,146,163,55,99,195,52,54,19,50,12,131,47,228,18,45,
+191,210,42,156,178,40,124,194,38,94,2,37,66,82,35,41,210,33,18,130,32,254,81,31,
+237,81,30,221,113,29,208,177,28,198,33,28,190,177,27,185,113,27,182,97,27,182,113,27,
+185,177,27,190,17,28,198,193,28,211,193,29,229,17,31,253,177,32,26,162,34,60,242,36,
+100,146,39,144,130,42,194,210,45,249,98,49,52,67,53,117,115,57,186,227,61,4,164,66,
+81,164,71,163,228,76,249,84,82,82,245,87,174,213,93,13,214,99,110,246,105,209,54,112,
+53,119,118,154,215,124,0,104,134,203,248,146,146,57,159,82,234,170,7,219,181,175,203,191,
+70,188,200,204,124,208,62,13,215,156,77,220,230,61,224,27,222,226,58,46,228,71,174,228,
+74,126,228,66,174,227,48,62,226,19,46,224,238,125,221,190,45,218,132,77,214,65,205,209,
+244,172,204,157,236,198,60,140,192,209,139,185,92,235,177,222,202,169,87,26,161,201,249,151,
+52,137,142,155,232,132,0,40,123,101,135,113,204,22,104,55,246,94,169,69,86,34,37,78,
+164,132,70,47,132,63,196,35,57,99,99,51,12,67,46,191,194,41,124,226,37,66,146,34,
+18,226,31,237,209,29,208,97,28,190,145,27,182,97,27,185,225,27,198,49,29,229,209,31,
+26,194,35,100,2,41,194,146,47,52,83,55,186,67,64,81,52,74,249,36,85,174,213,96,
+110,22,109,53,167,121,0,184,140,146,41,165,7,235,186,70,204,204,62,205,217,230,189,225,
+58,142,228,74,46,228,48,78,225,237,237,219,133,29,212,244,220,201,60,28,189,92,235,173,
+87,154,156,52,185,137,0,88,118,204,118,99,169,37,82,164,244,66,196,51,54,12,243,43,
+123,34,36,19,194,30,208,225,27,182,129,27,198,81,30,26,66,38,194,66,51,186,35,69,
+249,228,90,110,86,115,0,56,153,7,107,196,63,109,222,57,190,228,47,238,222,133,77,207,
+60,220,181,87,74,147,0,200,108,169,53,74,196,195,48,123,34,33,209,81,27,199,161,33,
+193,162,59,249,212,102,0,184,176,59,141,227,51,30,216,60,156,165,0,120,90,196,243,39,
+205,129,28,197,82,79,0,248,208,114,254,192,0,24,63,142,17,47,0,40,231,0,232,24,
+0,56,131,102,152,137,203,232,143,48,25,150,147,73,156,244,73,162,83,26,168,175,202,173,
+8,59,179,94,123,184,176,123,189,254,59,194,71,188,198,141,220,202,205,204,206,9,93,210,
+64,157,213,114,157,216,158,61,219,198,125,221,232,125,223,5,30,225,28,110,226,46,94,227,
+59,14,228,67,110,228,72,158,228,74,174,228,74,142,228,71,78,228,65,222,227,57,78,227,
+46,142,226,33,174,225,18,158,224,0,110,223,235,13,222,212,141,220,187,221,218,159,13,217,
+129,29,215,96,253,212,61,189,210,24,77,208,240,188,205,197,252,202,152,28,200,105,12,197,
+55,220,193,3,140,190,204,11,187,147,107,183,88,155,179,26,171,175,218,154,171,152,106,167,
+84,26,163,14,170,158,198,25,154,125,121,149,50,201,144,231,8,140,154,72,135,77,120,130,
+0,152,125,179,199,120,102,7,116,25,71,111,206,134,106,131,246,101,58,102,97,242,245,92,
+172,165,88,104,117,84,38,101,80,230,116,76,168,164,72,109,4,69,52,132,65,253,51,62,
+201,3,59,151,243,55,104,19,53,59,83,50,16,195,47,232,82,45,195,18,43,160,242,40,
+127,2,39,97,50,37,69,130,35,44,2,34,21,162,32,0,114,31,238,97,30,223,129,29,
+210,193,28,199,49,28,191,193,27,185,129,27,182,97,27,182,113,27,184,161,27,189,1,28,
+197,177,28,210,161,29,228,241,30,251,145,32,24,146,34,58,210,36,98,114,39,142,114,42,
+192,178,45,247,66,49,51,51,53,115,83,57,185,211,61,2,148,66,80,148,71,162,212,76,
+248,68,82,81,245,87,173,197,93,12,198,99,109,246,105,208,38,112,53,119,118,154,215,124,
+0,104,134,203,8,147,147,73,159,83,250,170,8,235,181,176,235,191,71,220,200,205,156,208,
+64,45,215,158,109,220,232,93,224,28,238,226,59,62,228,72,174,228,74,126,228,65,158,227,
+46,30,226,18,14,224,235,77,221,187,253,217,129,13,214,61,141,209,240,92,204,152,156,198,
+55,60,192,204,59,185,88,171,177,218,138,169,84,234,160,198,217,151,50,121,142,154,216,132,
+0,56,123,102,151,113,206,54,104,58,38,95,172,133,86,38,101,78,168,212,70,52,212,63,
+201,115,57,104,179,51,16,131,46,195,2,42,127,18,38,69,194,34,21,2,32,238,241,29,
+210,113,28,191,145,27,182,97,27,184,209,27,197,33,29,228,177,31,24,162,35,98,226,40,
+192,114,47,51,51,55,185,35,64,80,36,74,248,20,85,173,197,96,109,6,109,53,167,121,
+0,184,140,147,57,165,8,11,187,71,220,204,64,237,217,232,205,225,59,142,228,73,30,228,
+46,46,225,235,189,219,129,221,211,240,140,201,55,204,188,87,171,173,84,106,156,50,169,137,
+0,104,118,206,166,99,172,101,82,168,68,67,201,131,54,16,51,44,127,82,36,21,226,30,
+210,241,27,183,129,27,197,65,30,24,34,38,192,50,51,185,3,69,248,212,90,109,86,115,
+0,56,153,8,123,196,65,125,222,58,190,228,45,190,222,129,253,206,55,140,181,84,42,147,
+0,232,108,172,133,74,201,19,49,127,82,33,211,81,27,198,145,33,191,146,59,248,212,102,
+0,200,176,61,157,227,50,222,215,55,92,165,0,184,90,201,51,40,206,113,28,195,66,79,
+0,24,209,113,190,192,0,88,63,143,241,46,0,24,231,0,248,24,0,56,131,102,152,137,
+203,232,143,48,41,150,147,73,156,244,73,162,83,42,168,176,218,173,9,75,179,95,139,184,
+177,139,189,255,75,194,73,204,198,142,252,202,207,220,206,11,125,210,66,189,213,115,173,216,
+160,77,219,199,157,221,234,157,223,6,62,225,30,126,226,48,126,227,60,14,228,68,110,228,
+72,174,228,74,174,228,73,142,228,70,62,228,64,206,227,56,62,227,45,110,226,31,142,225,
+16,126,224,253,61,223,232,221,221,209,93,220,184,173,218,156,221,216,125,221,214,92,189,212,
+57,109,210,19,13,208,235,108,205,193,172,202,148,204,199,100,188,196,50,140,193,254,59,190,
+199,187,186,142,27,183,83,75,179,21,107,175,213,90,171,148,42,167,80,218,162,10,122,158,
+195,249,153,122,89,149,48,185,144,229,248,139,153,56,135,77,104,130,0,168,125,179,215,120,
+103,23,116,27,87,111,208,182,106,134,22,102,61,150,97,246,53,93,176,229,88,108,181,84,
+43,165,80,235,196,76,173,244,72,114,84,69,57,212,65,2,132,62,206,83,59,156,67,56,
+108,99,53,63,163,50,21,3,48,237,162,45,199,82,43,164,50,41,131,50,39,100,98,37,
+72,178,35,47,50,34,24,210,32,3,146,31,240,129,30,225,161,29,211,209,28,200,65,28,
+192,209,27,186,129,27,183,97,27,182,113,27,184,161,27,188,1,28,196,145,28,208,145,29,
+226,209,30,250,113,32,22,114,34,57,194,36,96,98,39,141,82,42,190,146,45,245,50,49,
+49,19,53,114,67,57,183,195,61,1,132,66,79,132,71,161,196,76,247,52,82,80,229,87,
+173,197,93,12,198,99,109,230,105,208,38,112,53,119,118,154,215,124,0,104,134,203,8,147,
+147,73,159,83,10,171,9,251,181,177,251,191,73,236,200,207,188,208,66,61,215,160,125,220,
+233,109,224,30,14,227,60,78,228,72,174,228,73,110,228,64,142,227,45,254,225,16,222,223,
+232,29,221,184,205,217,125,205,213,57,61,209,235,28,204,148,76,198,50,236,191,199,235,184,
+83,91,177,213,74,169,80,170,160,195,169,151,48,89,142,153,216,132,0,56,123,103,183,113,
+208,102,104,61,102,95,176,197,86,43,181,78,173,36,71,57,36,64,206,195,57,108,243,51,
+21,211,46,199,66,42,131,66,38,72,242,34,24,50,32,240,17,30,211,129,28,192,161,27,
+183,97,27,184,193,27,196,1,29,226,161,31,23,146,35,96,210,40,190,82,47,49,35,55,
+183,19,64,79,20,74,247,4,85,173,197,96,109,6,109,53,167,121,0,184,140,147,57,165,
+9,27,187,73,252,204,65,13,218,234,237,225,60,158,228,73,14,228,45,14,225,232,141,219,
+125,157,211,235,76,201,50,124,188,83,107,173,80,58,156,48,153,137,0,120,118,208,214,99,
+176,165,82,173,148,67,206,195,54,21,115,44,131,130,36,24,2,31,211,1,28,183,113,27,
+196,33,30,22,2,38,191,18,51,183,243,68,247,212,90,109,86,115,0,72,153,8,139,196,
+66,157,222,59,174,228,44,142,222,126,189,206,50,60,181,80,10,147,0,8,109,176,213,74,
+206,83,49,130,130,33,212,97,27,197,113,33,190,130,59,248,196,102,0,216,176,62,173,227,
+49,174,215,50,44,165,0,232,90,206,99,40,207,97,28,194,50,79,0,56,209,111,110,192,
+0,168,63,145,209,46,0,248,230,0,24,25,0,56,131,102,152,137,204,232,143,48,41,150,
+147,73,156,245,89,162,84,42,168,176,218,173,10,91,179,95,155,184,178,155,189,0,92,194,
+74,220,198,143,12,203,208,252,206,12,141,210,67,221,213,117,205,216,162,109,219,201,189,221,
+235,173,223,8,78,225,31,158,226,49,142,227,61,30,228,68,126,228,73,174,228,74,174,228,
+73,142,228,69,62,228,63,190,227,55,30,227,43,94,226,30,110,225,13,94,224,251,29,223,
+230,173,221,206,45,220,181,125,218,152,157,216,122,157,214,88,125,212,53,45,210,15,189,207,
+231,44,205,188,108,202,143,124,199,95,124,196,45,60,193,249,235,189,194,107,186,137,203,182,
+78,11,179,17,27,175,209,26,171,144,234,166,76,170,162,7,74,158,192,201,153,120,57,149,
+46,153,144,227,232,139,152,40,135,76,104,130,0,168,125,180,231,120,104,39,116,29,119,111,
+210,214,106,136,70,102,64,198,97,249,101,93,180,37,89,112,245,84,47,245,80,239,4,77,
+178,68,73,119,164,69,62,36,66,7,212,62,211,147,59,161,147,56,113,163,53,68,227,50,
+25,83,48,241,226,45,203,146,43,168,114,41,134,114,39,104,146,37,75,226,35,50,98,34,
+26,242,32,5,178,31,242,161,30,226,177,29,213,241,28,201,81,28,193,209,27,187,129,27,
+183,97,27,182,97,27,183,145,27,188,241,27,195,129,28,207,113,29,225,193,30,248,97,32,
+21,82,34,55,162,36,94,66,39,139,50,42,189,130,45,244,18,49,48,3,53,113,51,57,
+182,179,61,0,116,66,78,116,71,161,180,76,246,52,82,80,229,87,172,181,93,11,198,99,
+109,230,105,208,38,112,52,119,118,154,215,124,0,104,134,204,8,147,147,89,159,84,10,171,
+9,251,181,178,11,192,74,252,200,208,204,208,67,93,215,162,157,220,235,141,224,31,30,227,
+61,78,228,73,174,228,73,94,228,63,126,227,43,238,225,13,190,223,230,237,220,181,141,217,
+122,141,213,53,253,208,231,204,203,143,252,197,45,156,191,194,155,184,78,27,177,209,10,169,
+76,122,160,192,137,151,46,57,142,152,200,132,0,72,123,104,215,113,210,134,104,64,150,95,
+180,5,87,47,245,78,178,116,71,62,116,64,211,19,58,113,67,52,25,19,47,203,130,42,
+134,130,38,75,34,35,26,82,32,243,33,30,213,145,28,193,161,27,183,97,27,183,193,27,
+195,241,28,225,129,31,21,114,35,94,178,40,189,66,47,48,19,55,182,3,64,78,20,74,
+246,4,85,172,181,96,109,6,109,52,167,121,0,184,140,147,73,165,9,43,187,74,12,205,
+67,45,218,235,253,225,61,158,228,73,254,227,44,238,224,230,93,219,122,93,211,231,252,200,
+45,44,188,78,27,173,76,10,156,46,137,137,0,136,118,210,6,100,180,245,82,178,228,67,
+211,19,55,25,179,44,134,178,36,26,34,31,212,17,28,183,113,27,195,17,30,21,226,37,
+189,2,51,182,227,68,247,196,90,109,86,115,0,72,153,9,171,196,68,189,222,60,174,228,
+42,110,222,122,109,206,45,252,180,76,234,146,0,40,109,180,21,75,211,163,49,134,162,33,
+214,97,27,196,81,33,188,98,59,247,196,102,0,232,176,64,189,227,48,110,215,45,236,164,
+0,40,91,211,163,40,208,81,28,192,34,79,0,88,209,109,46,192,0,232,63,147,177,46,
+0,216,230,0,56,25,0,56,131,102,152,137,204,232,143,48,41,150,148,89,156,245,89,162,
+84,58,168,177,234,173,10,107,179,96,171,184,179,171,189,1,124,194,75,252,198,145,44,203,
+210,12,207,14,173,210,69,237,213,119,237,216,164,141,219,203,221,221,237,205,223,9,110,225,
+32,174,226,50,158,227,62,46,228,69,126,228,73,174,228,74,174,228,73,126,228,69,46,228,
+62,174,227,53,14,227,42,62,226,28,78,225,11,46,224,249,237,222,227,141,221,204,253,219,
+177,61,218,149,109,216,118,109,214,85,61,212,49,237,209,11,125,207,226,220,204,183,28,202,
+138,60,199,90,44,196,40,252,192,244,155,189,190,27,186,133,123,182,74,187,178,12,219,174,
+205,202,170,140,170,166,72,106,162,3,10,158,189,153,153,117,25,149,44,121,144,226,200,139,
+151,24,135,76,104,130,0,168,125,180,247,120,105,71,116,30,151,111,212,246,106,139,118,102,
+67,6,98,253,165,93,184,101,89,116,69,85,51,53,81,244,84,77,182,148,73,123,244,69,
+66,116,66,12,20,63,216,227,59,166,211,56,118,243,53,73,51,51,30,147,48,245,34,46,
+207,210,43,171,162,41,138,162,39,107,210,37,79,18,36,52,130,34,29,34,33,7,226,31,
+245,193,30,228,209,29,214,1,29,203,97,28,194,225,27,187,145,27,183,97,27,182,97,27,
+183,145,27,187,225,27,194,113,28,206,97,29,224,161,30,247,65,32,19,50,34,53,130,36,
+92,34,39,137,18,42,187,98,45,242,2,49,46,227,52,111,19,57,181,147,61,255,99,66,
+77,100,71,160,164,76,246,36,82,79,213,87,172,181,93,11,182,99,108,230,105,208,38,112,
+52,119,118,154,215,124,0,104,134,204,8,147,148,89,159,84,26,171,10,11,182,179,27,192,
+75,28,201,210,236,208,69,125,215,164,189,220,237,157,224,32,46,227,62,94,228,73,174,228,
+73,94,228,62,94,227,42,206,225,11,158,223,227,205,220,177,93,217,118,93,213,49,189,208,
+226,124,203,138,172,197,40,76,191,190,91,184,74,203,176,205,202,168,72,58,160,189,89,151,
+44,41,142,151,200,132,0,72,123,105,231,113,212,182,104,67,214,95,184,69,87,51,69,79,
+182,180,71,66,196,64,216,99,58,118,147,52,30,83,47,207,178,42,138,178,38,79,66,35,
+29,114,32,245,65,30,214,177,28,194,177,27,183,97,27,183,177,27,194,225,28,224,113,31,
+19,82,35,92,146,40,187,34,47,46,243,54,181,243,63,77,4,74,246,244,84,172,181,96,
+108,6,109,52,167,121,0,200,140,148,73,165,10,59,187,75,44,205,69,61,218,237,13,226,
+62,158,228,73,238,227,42,206,224,227,29,219,118,29,211,226,172,200,41,220,187,73,219,172,
+72,218,155,44,121,137,0,152,118,212,54,100,184,53,83,183,52,68,215,99,55,30,243,44,
+138,242,36,29,66,31,214,33,28,183,113,27,194,1,30,19,210,37,187,226,50,181,211,68,
+246,196,90,108,70,115,0,72,153,10,187,196,70,205,222,61,174,228,41,62,222,119,45,206,
+40,172,180,73,186,146,0,88,109,183,101,75,216,227,49,137,210,33,215,97,27,195,65,33,
+186,82,59,246,196,102,0,248,176,65,205,227,47,46,215,40,188,164,0,88,91,216,227,40,
+209,65,28,191,18,79,0,120,209,107,222,191,0,56,64,149,145,46,0,184,230,0,88,25,
+0,56,131,102,152,137,204,232,143,49,41,150,148,89,156,245,89,162,85,58,168,177,250,173,
+11,107,179,97,187,184,180,187,189,2,140,194,76,12,199,146,60,203,211,44,207,15,205,210,
+70,13,214,120,253,216,165,157,219,204,237,221,238,221,223,11,126,225,34,190,226,51,174,227,
+63,62,228,70,142,228,73,174,228,74,174,228,72,126,228,68,30,228,61,158,227,52,254,226,
+40,46,226,26,46,225,9,14,224,246,205,222,225,93,221,201,205,219,174,13,218,145,45,216,
+114,45,214,81,253,211,45,173,209,6,45,207,222,140,204,179,204,201,133,236,198,86,220,195,
+36,172,192,239,75,189,185,203,185,128,59,182,69,107,178,8,139,174,201,138,170,135,106,166,
+69,58,162,0,218,157,186,105,153,114,233,148,42,89,144,224,184,139,150,8,135,75,104,130,
+0,168,125,181,7,121,106,87,116,32,183,111,214,38,107,142,166,102,70,54,98,0,214,93,
+187,165,89,121,133,85,55,133,81,248,148,77,187,212,73,128,68,70,71,196,66,17,100,63,
+220,51,60,170,35,57,123,67,54,77,131,51,34,227,48,250,98,46,211,18,44,175,226,41,
+142,226,39,111,2,38,82,66,36,55,178,34,31,66,33,10,2,32,247,225,30,230,225,29,
+216,17,29,204,113,28,195,241,27,188,145,27,184,97,27,182,97,27,183,129,27,186,209,27,
+193,97,28,205,81,29,222,145,30,245,49,32,18,34,34,52,114,36,91,18,39,136,2,42,
+186,66,45,241,226,48,45,211,52,110,3,57,180,131,61,254,83,66,76,84,71,159,164,76,
+245,20,82,79,213,87,171,181,93,11,182,99,108,214,105,207,38,112,52,119,118,154,215,124,
+0,104,134,204,24,147,148,89,159,85,26,171,11,27,182,180,43,192,76,44,201,211,252,208,
+70,141,215,165,221,220,238,189,224,34,62,227,63,110,228,73,174,228,72,78,228,61,78,227,
+40,174,225,9,110,223,225,157,220,174,29,217,114,29,213,45,109,208,222,60,203,133,108,197,
+36,252,190,185,11,184,69,139,176,201,122,168,69,10,160,186,41,151,42,9,142,150,184,132,
+0,88,123,106,7,114,214,230,104,70,6,96,187,149,87,55,133,79,187,4,72,71,20,65,
+220,163,58,123,211,52,34,163,47,211,242,42,142,242,38,82,114,35,31,162,32,247,97,30,
+216,193,28,195,193,27,184,97,27,183,161,27,193,209,28,222,81,31,18,50,35,91,130,40,
+186,18,47,45,227,54,180,227,63,76,244,73,245,244,84,171,181,96,108,246,108,52,167,121,
+0,200,140,148,89,165,11,75,187,76,60,205,70,93,218,239,45,226,63,174,228,72,222,227,
+41,158,224,224,237,218,114,221,210,222,92,200,36,156,187,69,155,172,69,170,155,42,105,137,
+0,168,118,214,102,100,187,117,83,187,116,68,220,179,55,34,51,45,142,34,37,32,114,31,
+215,49,28,184,97,27,193,225,29,17,178,37,186,210,50,180,195,68,245,180,90,108,70,115,
+0,88,153,11,203,196,71,237,222,62,174,228,39,30,222,115,221,205,35,92,180,69,154,146,
+0,120,109,187,181,75,221,51,50,141,242,33,217,97,27,194,33,33,185,66,59,245,180,102,
+0,8,177,67,221,227,45,238,214,35,124,164,0,152,91,221,35,41,211,49,28,189,2,79,
+0,152,209,105,158,191,0,120,64,151,113,46,0,152,230,0,120,25,0,56,131,102,152,137,
+204,248,143,49,57,150,148,89,156,246,105,162,85,74,168,178,250,173,12,123,179,98,203,184,
+181,203,189,3,156,194,78,28,199,147,92,203,213,60,207,17,221,210,72,45,214,122,29,217,
+167,189,219,206,13,222,240,253,223,12,142,225,35,206,226,52,190,227,64,62,228,70,142,228,
+73,174,228,74,158,228,72,110,228,68,14,228,61,142,227,51,222,226,39,14,226,24,14,225,
+7,238,223,244,157,222,222,45,221,198,157,219,171,221,217,142,237,215,110,237,213,77,189,211,
+40,93,209,2,237,206,217,76,204,174,124,201,128,156,198,81,140,195,31,92,192,234,251,188,
+180,139,185,123,235,181,64,43,178,3,75,174,196,74,170,131,42,166,65,250,161,253,169,157,
+183,73,153,112,201,148,40,57,144,223,168,139,149,8,135,74,88,130,0,184,125,182,7,121,
+107,103,116,33,215,111,216,70,107,144,198,102,73,102,98,3,22,94,191,229,89,125,197,85,
+60,197,81,253,228,77,192,36,74,133,132,70,76,20,67,22,180,63,225,131,60,175,115,57,
+128,147,54,82,195,51,39,35,49,254,178,46,216,82,44,179,34,42,146,34,40,114,50,38,
+85,114,36,58,226,34,34,114,33,12,34,32,249,1,31,232,1,30,217,49,29,205,129,28,
+195,1,28,188,161,27,184,113,27,182,97,27,183,129,27,186,209,27,192,81,28,204,65,29,
+221,129,30,244,17,32,16,2,34,50,82,36,89,242,38,134,226,41,184,50,45,239,210,48,
+43,179,52,109,243,56,178,115,61,253,67,66,75,68,71,158,148,76,244,20,82,78,197,87,
+171,165,93,10,182,99,108,214,105,207,22,112,52,119,118,154,215,124,0,104,134,204,24,147,
+148,105,159,85,42,171,12,43,182,181,59,192,78,60,201,213,28,209,72,173,215,167,237,220,
+240,205,224,35,78,227,64,110,228,73,174,228,72,78,228,60,62,227,39,142,225,7,78,223,
+222,109,220,171,237,216,110,221,212,40,45,208,217,236,202,128,28,197,31,172,190,180,187,183,
+64,59,176,196,58,168,65,218,159,183,9,151,40,249,141,149,184,132,0,104,123,107,23,114,
+216,6,105,73,54,96,191,213,87,60,213,79,192,84,72,76,100,65,225,243,58,128,35,53,
+39,227,47,216,50,43,146,34,39,85,162,35,34,194,32,249,129,30,217,209,28,196,193,27,
+184,97,27,183,161,27,192,193,28,221,65,31,16,34,35,89,98,40,184,242,46,43,211,54,
+178,211,63,75,228,73,244,228,84,171,165,96,108,246,108,52,167,121,0,200,140,148,89,165,
+12,75,187,78,92,205,72,125,218,240,61,226,63,174,228,72,206,227,39,126,224,222,189,218,
+110,141,210,217,12,200,31,76,187,64,75,172,65,122,155,40,89,137,0,184,118,216,150,100,
+191,197,83,192,196,68,225,3,56,39,131,45,146,82,37,34,146,31,217,65,28,184,97,27,
+193,209,29,16,146,37,184,178,50,178,195,68,244,180,90,108,70,115,0,88,153,11,219,196,
+73,253,222,63,158,228,38,238,221,111,157,205,30,12,180,65,122,146,0,152,109,191,5,76,
+226,115,50,145,34,34,218,113,27,193,17,33,183,50,59,245,180,102,0,24,177,68,221,227,
+44,174,214,30,60,164,0,216,91,226,99,41,212,49,28,188,242,78,0,168,209,103,78,191,
+0,200,64,153,97,46,0,120,230,0,152,25,0,56,131,102,152,137,204,248,143,49,57,150,
+149,105,156,246,105,162,86,74,168,179,10,174,12,139,179,99,219,184,181,219,189,4,172,194,
+79,44,199,149,108,203,214,92,207,18,253,210,74,61,214,124,61,217,168,221,219,208,29,222,
+241,13,224,14,174,225,36,222,226,53,206,227,65,78,228,71,142,228,74,174,228,74,158,228,
+72,110,228,67,254,227,60,126,227,50,206,226,37,238,225,22,238,224,5,190,223,241,125,222,
+219,253,220,195,93,219,168,157,217,138,189,215,107,173,213,73,125,211,36,29,209,253,156,206,
+212,252,203,169,60,201,124,76,198,76,60,195,26,12,192,229,171,188,175,59,185,118,155,181,
+59,219,177,255,250,173,192,10,170,127,234,165,61,186,161,249,121,157,180,25,153,109,169,148,
+38,25,144,221,136,139,148,248,134,74,88,130,0,184,125,182,23,121,108,135,116,35,247,111,
+218,102,107,147,246,102,76,150,98,7,86,94,195,37,90,129,5,86,64,21,82,1,53,78,
+197,116,74,138,212,70,81,100,67,27,4,64,230,211,60,180,195,57,132,211,54,87,19,52,
+44,115,49,3,243,46,220,146,44,183,98,42,149,82,40,118,114,38,88,178,36,61,18,35,
+37,146,33,15,82,32,251,33,31,234,33,30,219,65,29,206,145,28,196,1,28,189,161,27,
+184,113,27,182,97,27,182,129,27,185,193,27,191,65,28,203,49,29,220,97,30,242,1,32,
+15,242,33,48,50,36,88,210,38,132,210,41,182,18,45,238,178,48,42,163,52,107,227,56,
+177,99,61,252,51,66,75,52,71,157,132,76,244,4,82,77,197,87,170,165,93,10,166,99,
+107,214,105,207,22,112,52,119,118,154,215,124,0,104,134,204,24,147,149,105,159,86,58,171,
+12,59,182,181,75,192,79,92,201,214,44,209,74,205,215,168,13,221,241,237,224,36,94,227,
+64,126,228,74,174,228,72,62,228,59,46,227,37,110,225,5,30,223,219,61,220,168,173,216,
+107,157,212,36,221,207,212,156,202,124,204,196,26,92,190,175,107,183,59,251,175,192,250,167,
+61,154,159,180,217,150,38,217,141,148,168,132,0,104,123,108,55,114,218,54,105,76,118,96,
+195,21,88,64,21,80,197,164,72,81,180,65,230,67,59,132,115,53,44,51,48,220,114,43,
+149,98,39,88,210,35,37,242,32,251,161,30,219,225,28,197,209,27,184,97,27,182,145,27,
+192,177,28,220,33,31,15,2,35,88,66,40,182,226,46,42,179,54,177,195,63,75,212,73,
+244,212,84,170,165,96,107,246,108,52,167,121,0,200,140,149,105,165,12,91,187,79,108,205,
+73,141,218,242,77,226,64,174,228,71,190,227,37,94,224,219,141,218,107,77,210,212,204,199,
+26,252,186,59,11,172,61,74,155,38,73,137,0,200,118,218,198,100,195,5,84,197,20,69,
+230,67,56,44,195,45,149,130,37,37,178,31,219,81,28,185,97,27,192,193,29,14,130,37,
+183,162,50,177,179,68,244,164,90,107,70,115,0,88,153,12,235,196,75,29,223,64,158,228,
+36,190,221,107,77,205,25,204,179,61,90,146,0,184,109,195,69,76,231,195,50,149,82,34,
+220,113,27,192,241,32,181,34,59,244,180,102,0,40,177,70,237,227,43,110,214,25,12,164,
+0,8,92,231,163,41,213,33,28,186,226,78,0,200,209,101,254,190,0,24,65,155,65,46,
+0,88,230,0,184,25,0,56,131,102,152,137,204,248,143,49,57,150,149,105,156,247,121,162,
+86,90,168,179,10,174,13,155,179,100,219,184,182,235,189,5,188,194,80,60,199,150,124,203,
+215,108,207,20,13,211,75,93,214,125,77,217,170,237,219,209,61,222,243,45,224,15,190,225,
+38,254,226,54,222,227,65,94,228,71,158,228,74,174,228,74,158,228,71,94,228,66,254,227,
+58,110,227,48,174,226,36,206,225,20,206,224,3,158,223,239,77,222,216,205,220,192,45,219,
+164,109,217,135,125,215,103,109,213,69,61,211,32,221,208,249,92,206,208,172,203,164,236,200,
+119,252,197,71,236,194,21,188,191,224,91,188,170,235,184,113,75,181,55,155,177,250,186,173,
+188,202,169,123,170,165,57,138,161,246,57,157,177,233,152,107,121,148,35,9,144,219,120,139,
+147,232,134,73,88,130,0,184,125,183,39,121,109,151,116,37,7,112,221,150,107,149,38,103,
+79,214,98,10,134,94,199,101,90,133,69,86,68,85,82,6,117,78,201,196,74,143,36,71,
+86,180,67,32,84,64,235,35,61,185,19,58,137,35,55,92,99,52,48,179,49,7,51,47,
+224,210,44,187,162,42,153,146,40,121,162,38,92,226,36,64,66,35,40,194,33,17,114,32,
+253,65,31,236,65,30,220,97,29,208,161,28,198,17,28,190,177,27,185,113,27,182,97,27,
+182,113,27,185,177,27,191,49,28,202,17,29,218,81,30,241,225,31,13,210,33,47,34,36,
+86,194,38,131,178,41,181,2,45,236,162,48,41,147,52,106,211,56,176,83,61,251,35,66,
+74,52,71,156,116,76,243,4,82,77,181,87,170,149,93,9,166,99,107,214,105,207,22,112,
+52,119,118,154,215,124,0,104,134,204,24,147,149,121,159,86,58,171,13,75,182,182,91,192,
+80,108,201,215,76,209,75,221,215,170,29,221,243,253,224,38,110,227,65,126,228,74,174,228,
+71,46,228,58,14,227,36,78,225,3,254,222,216,13,220,164,125,216,103,93,212,32,157,207,
+208,76,202,119,124,196,21,12,190,170,27,183,55,171,175,188,186,167,57,106,159,177,185,150,
+35,185,141,147,152,132,0,120,123,109,87,114,221,86,105,79,166,96,199,85,88,68,101,80,
+201,244,72,86,4,66,235,147,59,137,195,53,48,115,48,224,178,43,153,146,39,92,2,36,
+40,18,33,253,193,30,220,1,29,198,225,27,185,97,27,182,145,27,191,161,28,218,17,31,
+13,242,34,86,50,40,181,194,46,41,163,54,176,179,63,74,196,73,243,212,84,170,149,96,
+107,246,108,52,167,121,0,200,140,149,105,165,13,107,187,80,124,205,75,173,218,243,93,226,
+65,174,228,71,174,227,36,62,224,216,77,218,103,13,210,208,124,199,21,172,186,55,203,171,
+57,26,155,35,57,137,0,216,118,221,246,100,199,69,84,201,100,69,235,147,56,48,3,46,
+153,194,37,40,210,31,220,97,28,185,97,27,191,177,29,13,98,37,181,146,50,176,163,68,
+243,164,90,107,70,115,0,88,153,13,251,196,76,45,223,64,158,228,35,142,221,104,13,205,
+20,124,179,57,58,146,0,216,109,199,149,76,236,3,51,152,130,34,221,113,27,192,225,32,
+180,18,59,243,180,102,0,56,177,71,253,227,41,62,214,20,204,163,0,72,92,236,211,41,
+215,17,28,185,210,78,0,232,209,99,190,190,0,88,65,157,33,46,0,56,230,0,216,25,
+0,56,131,102,152,137,204,248,143,49,57,150,149,105,156,247,121,162,87,90,168,180,26,174,
+14,155,179,100,235,184,183,251,189,6,204,194,81,92,199,151,156,203,217,140,207,21,45,211,
+77,109,214,127,109,217,172,13,220,211,77,222,244,61,224,16,206,225,39,14,227,55,222,227,
+66,94,228,72,158,228,74,174,228,74,158,228,71,78,228,65,238,227,57,94,227,47,158,226,
+34,190,225,19,174,224,1,126,223,236,29,222,214,157,220,189,253,218,161,45,217,131,61,215,
+99,45,213,64,237,210,28,141,208,245,12,206,203,108,203,160,156,200,114,172,197,66,156,194,
+16,108,191,219,11,188,165,155,184,108,251,180,50,75,177,245,122,173,183,122,169,119,122,165,
+54,74,161,242,9,157,174,185,152,104,89,148,33,233,143,218,104,139,146,216,134,73,72,130,
+0,200,125,183,55,121,110,167,116,38,39,112,223,182,107,152,86,103,82,6,99,14,198,94,
+202,149,90,137,149,86,73,149,82,11,197,78,206,20,75,148,116,71,91,4,68,37,164,64,
+240,115,61,190,99,58,142,115,55,96,163,52,53,3,50,11,131,47,228,34,45,192,226,42,
+157,210,40,125,226,38,95,18,37,68,114,35,42,242,33,20,146,32,255,97,31,237,81,30,
+222,113,29,209,177,28,199,33,28,191,193,27,185,113,27,182,97,27,182,113,27,184,177,27,
+190,49,28,201,1,29,217,65,30,240,209,31,12,194,33,45,2,36,84,162,38,129,162,41,
+179,226,44,235,130,48,39,115,52,105,179,56,175,67,61,250,19,66,73,36,71,156,116,76,
+242,244,81,76,181,87,169,149,93,9,166,99,107,214,105,207,22,112,52,119,118,154,215,124,
+0,104,134,204,24,147,149,121,159,87,74,171,14,75,182,183,107,192,81,124,201,217,92,209,
+77,253,215,172,61,221,244,13,225,39,126,227,66,142,228,74,174,228,71,30,228,57,254,226,
+34,62,225,1,206,222,214,221,219,161,61,216,99,13,212,28,93,207,203,12,202,114,44,196,
+16,188,189,165,203,182,50,91,175,183,122,167,54,42,159,174,137,150,33,169,141,146,152,132,
+0,120,123,110,103,114,223,134,105,82,230,96,202,149,88,73,181,80,206,68,73,91,84,66,
+240,227,59,142,3,54,53,179,48,228,242,43,157,210,39,95,50,36,42,66,33,255,209,30,
+222,17,29,199,241,27,185,97,27,182,129,27,190,145,28,217,1,31,12,210,34,84,18,40,
+179,178,46,39,147,54,175,163,63,73,196,73,242,196,84,169,149,96,107,246,108,52,167,121,
+0,200,140,149,121,165,14,123,187,81,156,205,76,189,218,245,125,226,66,174,228,71,158,227,
+34,30,224,213,29,218,99,205,209,203,44,199,16,92,186,50,123,171,54,234,154,33,41,137,
+0,232,118,223,38,101,202,149,84,206,180,69,240,227,56,53,67,46,157,242,37,43,242,31,
+222,113,28,185,97,27,190,145,29,11,82,37,180,114,50,175,147,68,242,148,90,107,70,115,
+0,104,153,13,27,197,78,77,223,65,142,228,33,110,221,100,189,204,15,44,179,54,26,146,
+0,248,109,202,229,76,241,83,51,156,162,34,223,129,27,191,193,32,178,242,58,243,164,102,
+0,56,177,72,253,227,40,254,213,15,156,163,0,120,92,241,19,42,216,17,28,184,210,78,
+0,8,210,97,110,190,0,168,65,159,1,46,0,24,230,0,248,25,0,56,131,102,168,137,
+204,248,143,50,73,150,149,121,156,247,121,162,87,106,168,180,42,174,14,171,179,101,251,184,
+184,11,190,7,220,194,82,108,199,152,172,203,218,156,207,23,61,211,78,141,214,128,125,217,
+173,29,220,212,109,222,246,93,224,18,238,225,40,30,227,56,238,227,67,110,228,72,158,228,
+74,174,228,73,142,228,70,78,228,65,222,227,56,62,227,46,126,226,32,158,225,17,142,224,
+254,77,223,234,253,221,211,109,220,185,205,218,158,253,216,128,13,215,95,237,212,60,173,210,
+23,77,208,240,204,205,199,28,203,155,76,200,109,92,197,61,76,194,11,28,191,214,187,187,
+160,75,184,103,171,180,45,251,176,241,42,173,179,58,169,115,58,165,50,26,161,239,217,156,
+171,137,152,102,57,148,31,201,143,216,72,139,144,200,134,72,72,130,0,200,125,184,71,121,
+112,199,116,40,71,112,225,214,107,154,134,103,85,54,99,17,246,94,206,213,90,141,213,86,
+77,229,82,15,21,79,211,100,75,153,196,71,96,84,68,42,244,64,245,195,61,195,179,58,
+147,195,55,101,243,52,57,67,50,16,195,47,233,98,45,196,34,43,161,2,41,128,18,39,
+98,66,37,71,162,35,45,18,34,22,194,32,2,130,31,239,113,30,224,145,29,210,209,28,
+200,49,28,191,193,27,186,129,27,183,97,27,182,113,27,184,161,27,189,33,28,200,241,28,
+216,33,30,238,177,31,10,162,33,44,242,35,83,146,38,128,130,41,178,210,44,233,114,48,
+38,99,52,104,163,56,174,51,61,249,3,66,72,20,71,155,100,76,242,228,81,76,165,87,
+169,149,93,9,150,99,107,198,105,206,22,112,52,103,118,154,215,124,0,104,134,204,40,147,
+149,121,159,87,74,171,14,91,182,184,123,192,82,140,201,218,124,209,78,13,216,173,77,221,
+246,45,225,40,142,227,67,142,228,74,158,228,70,30,228,56,238,226,32,30,225,254,173,222,
+211,157,219,158,13,216,95,205,211,23,13,207,199,188,201,109,220,195,11,108,189,160,123,182,
+45,27,175,179,58,167,50,250,158,171,105,150,31,137,141,144,136,132,0,136,123,112,135,114,
+225,166,105,85,22,97,206,213,88,77,245,80,211,148,73,96,164,66,245,51,60,147,83,54,
+57,3,49,233,66,44,161,2,40,98,114,36,45,98,33,2,242,30,224,33,29,200,241,27,
+186,113,27,182,129,27,189,129,28,216,225,30,10,194,34,83,2,40,178,146,46,38,131,54,
+174,147,63,72,180,73,242,196,84,169,149,96,107,230,108,52,167,121,0,200,140,149,121,165,
+14,139,187,82,172,205,78,221,218,246,141,226,66,190,228,70,142,227,33,238,223,211,237,217,
+95,125,209,199,220,198,11,12,186,45,59,171,50,186,154,31,25,137,0,248,118,225,86,101,
+206,213,84,211,4,70,245,51,57,57,147,46,161,34,38,45,34,32,224,129,28,186,81,27,
+190,129,29,10,50,37,178,98,50,174,131,68,242,148,90,107,70,115,0,104,153,14,43,197,
+79,93,223,66,142,228,31,62,221,96,109,204,10,220,178,50,250,145,0,24,110,206,53,77,
+246,163,51,160,210,34,225,129,27,190,177,32,177,226,58,242,164,102,0,72,177,74,13,228,
+38,190,213,9,92,163,0,184,92,247,83,42,218,1,28,182,194,78,0,40,210,95,30,190,
+0,248,65,161,225,45,0,248,229,0,24,26,0,56,131,102,168,137,205,248,143,50,73,150,
+150,121,156,248,137,162,87,106,168,181,42,174,15,187,179,102,11,185,185,27,190,8,236,194,
+83,124,199,154,188,203,219,172,207,24,77,211,80,157,214,130,157,217,175,61,220,214,125,222,
+247,109,224,19,254,225,41,46,227,57,254,227,68,110,228,72,174,228,74,174,228,73,142,228,
+70,62,228,64,206,227,55,46,227,44,110,226,31,126,225,15,110,224,252,45,223,231,205,221,
+208,61,220,182,157,218,154,189,216,124,205,214,91,173,212,56,109,210,19,13,208,236,124,205,
+194,204,202,150,252,199,104,12,197,56,252,193,6,204,190,209,107,187,155,251,183,98,107,180,
+40,171,176,236,234,172,174,250,168,111,250,164,46,218,160,236,169,156,168,105,152,99,9,148,
+29,169,143,215,56,139,143,200,134,72,72,130,0,200,125,184,71,121,113,215,116,41,103,112,
+227,6,108,157,166,103,88,102,99,20,54,95,210,21,91,145,21,87,82,37,83,20,101,79,
+216,164,75,158,20,72,101,164,68,47,68,65,250,19,62,200,3,59,152,19,56,106,67,53,
+62,147,50,20,3,48,237,162,45,200,98,43,165,66,41,132,82,39,102,114,37,74,210,35,
+48,66,34,25,226,32,4,162,31,241,145,30,225,161,29,212,225,28,201,65,28,192,209,27,
+186,129,27,183,97,27,182,97,27,184,161,27,189,17,28,199,225,28,215,17,30,237,161,31,
+9,146,33,42,210,35,81,114,38,126,114,41,176,194,44,232,98,48,37,83,52,102,147,56,
+173,35,61,248,243,65,71,4,71,154,84,76,241,228,81,75,165,87,169,133,93,8,150,99,
+106,198,105,206,22,112,51,103,118,154,215,124,0,104,134,205,40,147,150,137,159,87,90,171,
+15,107,182,185,139,192,83,172,201,219,140,209,80,45,216,175,109,221,247,61,225,41,158,227,
+67,142,228,74,158,228,70,14,228,55,206,226,31,254,224,252,125,222,208,109,219,154,205,215,
+91,141,211,19,205,206,194,108,201,104,140,195,6,28,189,155,43,182,40,203,174,174,250,166,
+46,202,158,168,57,150,29,121,141,143,136,132,0,136,123,113,151,114,227,214,105,88,70,97,
+210,21,89,82,69,81,216,228,73,101,244,66,250,131,60,152,163,54,62,67,49,237,130,44,
+165,66,40,102,162,36,48,146,33,4,18,31,225,65,29,201,1,28,186,113,27,182,129,27,
+189,113,28,215,209,30,9,162,34,81,226,39,176,130,46,37,99,54,173,131,63,71,164,73,
+241,180,84,169,133,96,106,230,108,51,167,121,0,200,140,150,137,165,15,155,187,83,188,205,
+79,237,218,248,157,226,67,190,228,70,126,227,31,206,223,208,173,217,91,61,209,194,140,198,
+6,188,185,40,235,170,46,138,154,29,249,136,0,24,119,227,134,101,210,37,85,216,84,70,
+250,131,57,62,211,46,165,98,38,48,66,32,225,145,28,186,81,27,189,113,29,8,34,37,
+177,82,50,173,115,68,241,132,90,106,70,115,0,104,153,14,59,197,81,125,223,67,126,228,
+30,14,221,92,45,204,5,156,178,46,218,145,0,56,110,210,117,77,251,227,51,164,2,35,
+226,145,27,189,145,32,175,210,58,242,164,102,0,88,177,75,29,228,37,126,213,4,28,163,
+0,248,92,252,147,42,219,241,27,181,178,78,0,56,210,93,222,189,0,56,66,163,209,45,
+0,216,229,0,56,26,0,56,131,103,168,137,205,248,143,50,73,150,150,121,156,248,137,162,
+88,122,168,181,58,174,15,187,179,102,27,185,186,43,190,9,252,194,84,140,199,155,204,203,
+221,204,207,25,109,211,81,189,214,131,173,217,176,77,220,215,157,222,249,125,224,20,14,226,
+42,62,227,58,14,228,68,126,228,73,174,228,74,174,228,73,126,228,69,46,228,63,190,227,
+54,30,227,43,78,226,29,94,225,13,78,224,250,13,223,229,157,221,205,13,220,179,93,218,
+151,141,216,120,141,214,87,109,212,52,45,210,15,189,207,231,44,205,189,140,202,145,172,199,
+99,188,196,51,172,193,0,124,190,204,27,187,150,171,183,94,27,180,35,107,176,232,154,172,
+170,186,168,107,186,164,42,154,160,232,121,156,165,57,152,96,233,147,27,137,143,213,40,139,
+142,184,134,71,72,130,0,200,125,185,87,121,114,231,116,43,135,112,229,38,108,160,214,103,
+91,150,99,24,118,95,214,85,91,149,85,87,86,117,83,24,165,79,221,244,75,162,100,72,
+106,244,68,52,148,65,0,100,62,205,83,59,157,99,56,111,147,53,67,227,50,25,83,48,
+241,226,45,204,162,43,169,130,41,136,130,39,105,178,37,77,2,36,51,114,34,27,2,33,
+6,194,31,243,177,30,227,193,29,213,241,28,202,81,28,193,225,27,187,145,27,183,97,27,
+182,97,27,183,145,27,188,1,28,198,209,28,214,1,30,236,145,31,7,114,33,41,194,35,
+80,98,38,125,82,41,175,162,44,231,66,48,35,67,52,101,131,56,172,19,61,247,227,65,
+70,244,70,154,84,76,241,212,81,75,149,87,168,133,93,8,150,99,106,198,105,206,22,112,
+51,103,118,153,215,124,0,120,134,205,40,147,150,137,159,88,90,171,15,107,182,186,155,192,
+84,188,201,221,156,209,81,61,216,176,125,221,249,77,225,42,174,227,68,158,228,74,158,228,
+69,254,227,54,190,226,29,222,224,250,93,222,205,61,219,151,141,215,87,77,211,15,125,206,
+189,28,201,99,60,195,0,204,188,150,235,181,35,139,174,170,186,166,42,138,158,165,9,150,
+27,89,141,142,120,132,0,152,123,114,183,114,229,6,106,91,134,97,214,85,89,86,133,81,
+221,36,74,106,68,67,0,212,60,157,243,54,67,147,49,241,194,44,169,130,40,105,210,36,
+51,178,33,6,50,31,227,81,29,202,17,28,187,113,27,182,113,27,188,97,28,214,193,30,
+7,146,34,80,210,39,175,114,46,35,83,54,172,115,63,70,164,73,241,180,84,168,133,96,
+106,230,108,51,151,121,0,216,140,150,137,165,15,171,187,84,220,205,81,13,219,249,173,226,
+68,190,228,69,110,227,29,174,223,205,125,217,87,253,208,189,60,198,1,108,185,35,171,170,
+42,90,154,27,233,136,0,40,119,229,182,101,214,101,85,221,164,70,255,211,57,67,19,47,
+169,146,38,51,98,32,227,161,28,187,81,27,188,97,29,7,2,37,175,50,50,172,99,68,
+241,132,90,106,54,115,0,104,153,15,75,197,82,141,223,67,126,228,28,222,220,88,221,203,
+0,76,178,42,186,145,0,88,110,214,197,77,0,52,52,168,50,35,228,145,27,189,129,32,
+174,194,58,241,164,102,0,104,177,76,29,228,36,62,213,255,235,162,0,40,93,1,212,42,
+220,241,27,180,162,78,0,88,210,91,142,189,0,136,66,165,177,45,0,184,229,0,88,26,
+0,56,131,103,168,137,205,8,144,50,73,150,150,121,156,248,153,162,88,122,168,182,58,174,
+16,203,179,103,27,185,187,59,190,10,12,195,85,156,199,156,220,203,222,220,207,27,125,211,
+82,205,214,133,205,217,177,109,220,217,173,222,250,157,224,22,30,226,43,78,227,59,30,228,
+69,126,228,73,174,228,74,174,228,73,126,228,69,46,228,62,174,227,53,254,226,41,62,226,
+27,62,225,11,30,224,248,221,222,226,109,221,202,221,219,176,45,218,147,77,216,117,77,214,
+83,45,212,48,237,209,10,125,207,227,236,204,185,60,202,140,108,199,94,108,196,46,92,193,
+251,27,190,199,203,186,145,91,183,89,203,179,31,27,176,227,74,172,166,106,168,103,122,164,
+38,106,160,229,57,156,162,9,152,94,185,147,25,105,143,211,8,139,141,168,134,71,56,130,
+0,216,125,185,103,121,115,7,117,45,167,112,231,86,108,162,6,104,94,214,99,27,166,95,
+218,149,91,153,165,87,90,197,83,29,245,79,225,68,76,167,180,72,111,68,69,57,244,65,
+5,180,62,210,163,59,162,163,56,116,211,53,71,35,51,29,147,48,246,34,46,208,226,43,
+173,194,41,139,194,39,109,226,37,80,50,36,54,162,34,30,50,33,8,242,31,245,209,30,
+229,209,29,215,17,29,203,97,28,194,225,27,187,145,27,183,97,27,182,97,27,183,145,27,
+187,241,27,197,193,28,213,241,29,234,113,31,6,98,33,39,162,35,79,66,38,123,66,41,
+174,146,44,229,50,48,34,51,52,100,115,56,171,3,61,246,211,65,69,244,70,153,68,76,
+240,212,81,74,149,87,168,117,93,8,150,99,106,198,105,206,6,112,51,103,118,153,215,124,
+0,120,134,205,40,147,150,137,159,88,106,171,16,123,182,187,171,192,85,204,201,222,188,209,
+82,93,216,177,157,221,250,109,225,43,190,227,69,158,228,74,158,228,69,238,227,53,158,226,
+27,190,224,248,45,222,202,13,219,147,93,215,83,13,211,10,61,206,185,204,200,94,236,194,
+251,123,188,145,155,181,31,59,174,166,122,166,38,90,158,162,233,149,25,57,141,141,120,132,
+0,152,123,115,215,114,231,38,106,94,182,97,218,149,89,90,213,81,225,116,74,111,148,67,
+5,36,61,162,67,55,71,211,49,246,2,45,173,178,40,109,2,37,54,226,33,8,82,31,
+229,113,29,203,33,28,187,113,27,182,113,27,187,81,28,213,161,30,6,114,34,78,178,39,
+174,82,46,34,67,54,171,99,63,69,148,73,240,164,84,168,133,96,106,230,108,51,151,121,
+0,216,140,150,137,165,16,187,187,85,236,205,82,29,219,250,189,226,68,190,228,68,94,227,
+27,142,223,202,61,217,84,173,208,184,236,197,251,27,185,31,107,170,38,42,154,25,217,136,
+0,56,119,231,230,101,218,165,85,225,244,70,5,36,58,72,99,47,172,210,38,54,130,32,
+229,177,28,188,81,27,188,81,29,6,242,36,174,34,50,171,83,68,240,132,90,106,54,115,
+0,120,153,16,91,197,83,173,223,68,110,228,26,174,220,84,141,203,251,251,177,39,138,145,
+0,136,110,217,21,78,5,132,52,172,98,35,230,161,27,188,97,32,173,178,58,240,148,102,
+0,120,177,77,45,228,34,254,212,250,171,162,0,104,93,6,20,43,222,225,27,179,146,78,
+0,120,210,89,62,189,0,216,66,167,145,45,0,152,229,0,120,26,0,56,131,103,168,137,
+205,8,144,50,89,150,150,137,156,249,153,162,89,138,168,182,74,174,17,219,179,104,43,185,
+187,75,190,11,28,195,86,172,199,157,252,203,223,236,207,28,141,211,84,237,214,134,221,217,
+179,125,220,218,189,222,251,173,224,23,46,226,44,94,227,60,30,228,69,142,228,73,174,228,
+74,174,228,72,110,228,68,30,228,61,158,227,52,238,226,40,30,226,25,30,225,8,254,223,
+245,189,222,223,77,221,199,173,219,173,253,217,144,29,216,113,13,214,79,237,211,44,157,209,
+6,45,207,222,156,204,180,236,201,135,28,199,89,28,196,41,12,193,246,203,189,194,123,186,
+140,11,183,84,123,179,26,203,175,222,10,172,161,42,168,99,58,164,34,42,160,225,9,156,
+159,217,151,91,153,147,23,73,143,210,248,138,140,152,134,70,56,130,0,216,125,186,119,121,
+116,23,117,46,199,112,233,118,108,165,54,104,97,6,100,31,230,95,222,213,91,157,229,87,
+95,5,84,34,69,80,230,148,76,172,4,73,116,148,69,62,68,66,10,4,63,215,243,59,
+167,243,56,121,35,54,76,115,51,34,227,48,250,114,46,212,34,44,177,2,42,143,242,39,
+112,18,38,83,98,36,57,194,34,33,82,33,11,18,32,248,241,30,231,241,29,216,33,29,
+204,113,28,195,241,27,188,161,27,184,97,27,182,97,27,183,129,27,187,241,27,196,177,28,
+212,225,29,233,97,31,5,82,33,38,146,35,77,50,38,122,34,41,172,130,44,228,34,48,
+33,19,52,99,99,56,170,243,60,245,195,65,69,228,70,152,52,76,239,196,81,74,133,87,
+167,117,93,7,134,99,106,182,105,206,6,112,51,103,118,153,215,124,0,120,134,205,40,147,
+150,153,159,89,106,171,17,139,182,187,187,192,86,220,201,223,204,209,84,109,216,179,173,221,
+251,125,225,44,206,227,69,158,228,74,142,228,68,222,227,52,142,226,25,142,224,245,253,221,
+199,221,218,144,29,215,79,205,210,6,237,205,180,124,200,89,156,194,246,43,188,140,75,181,
+26,235,173,161,58,166,34,26,158,159,185,149,23,41,141,140,104,132,0,168,123,116,231,114,
+233,86,106,97,246,97,222,213,89,95,37,82,230,196,74,116,228,67,10,116,61,167,147,55,
+76,35,50,250,66,45,177,242,40,112,50,37,57,18,34,11,130,31,231,129,29,204,49,28,
+188,129,27,182,113,27,187,65,28,212,145,30,5,98,34,77,162,39,172,66,46,33,51,54,
+170,83,63,69,132,73,239,164,84,167,117,96,106,230,108,51,151,121,0,216,140,150,153,165,
+17,187,187,86,252,205,83,61,219,252,205,226,69,190,228,68,78,227,26,94,223,199,13,217,
+80,109,208,180,156,197,246,203,184,26,27,170,35,250,153,23,201,136,0,72,119,233,22,102,
+221,245,85,230,68,71,10,116,58,76,163,47,176,2,39,57,178,32,230,193,28,188,81,27,
+187,65,29,4,210,36,173,18,50,170,83,68,239,116,90,106,54,115,0,120,153,16,107,197,
+85,189,223,68,94,228,24,126,220,80,61,203,246,171,177,35,106,145,0,168,110,221,101,78,
+10,212,52,176,146,35,232,177,27,188,81,32,171,162,58,240,148,102,0,136,177,79,45,228,
+32,174,212,245,107,162,0,168,93,11,100,43,224,225,27,177,130,78,0,136,210,87,238,188,
+0,40,67,169,129,45,0,120,229,0,152,26,0,56,131,103,168,137,205,8,144,50,89,150,
+151,137,156,249,153,162,89,138,168,183,74,174,17,219,179,104,59,185,188,91,190,12,44,195,
+87,188,199,158,12,204,224,252,207,29,173,211,85,253,214,135,237,217,180,141,220,219,221,222,
+253,189,224,24,62,226,45,110,227,61,46,228,70,142,228,74,174,228,74,158,228,72,110,228,
+67,14,228,60,142,227,50,222,226,38,254,225,24,254,224,6,222,223,243,141,222,221,29,221,
+196,125,219,170,189,217,141,221,215,109,221,213,75,173,211,40,93,209,2,237,206,217,76,204,
+175,156,201,131,204,198,84,204,195,36,188,192,241,123,189,189,43,186,135,187,182,79,43,179,
+21,123,175,218,186,171,157,234,167,94,250,163,31,234,159,222,217,155,156,169,151,89,121,147,
+21,41,143,208,232,138,139,136,134,70,56,130,0,216,125,186,135,121,117,39,117,48,231,112,
+235,150,108,167,102,104,100,54,100,34,38,96,225,21,92,162,37,88,99,85,84,38,149,80,
+235,228,76,177,84,73,121,228,69,67,148,66,15,84,63,220,67,60,172,67,57,125,115,54,
+81,195,51,39,35,49,254,178,46,216,98,44,180,50,42,147,50,40,115,82,38,86,146,36,
+60,242,34,35,130,33,13,50,32,250,17,31,233,17,30,218,49,29,206,129,28,196,1,28,
+189,161,27,184,113,27,182,97,27,182,129,27,186,225,27,195,161,28,211,209,29,232,81,31,
+3,50,33,37,130,35,76,34,38,121,18,41,171,98,44,227,18,48,32,3,52,98,83,56,
+169,227,60,244,195,65,68,212,70,151,52,76,239,196,81,73,133,87,167,117,93,7,134,99,
+105,182,105,206,6,112,51,103,118,153,215,124,0,120,134,205,40,147,151,153,159,89,122,171,
+17,139,182,188,203,192,87,236,201,224,220,209,85,125,216,180,189,221,253,141,225,45,222,227,
+70,174,228,74,142,228,67,206,227,50,110,226,24,110,224,243,221,221,196,173,218,140,221,214,
+76,141,210,2,157,205,175,60,200,84,76,194,241,219,187,135,251,180,21,171,173,157,234,165,
+31,234,157,156,153,149,21,9,141,139,104,132,0,168,123,117,7,115,235,118,106,100,38,98,
+225,37,90,99,101,82,235,20,75,121,52,68,15,196,61,172,211,55,81,115,50,254,130,45,
+180,50,41,116,98,37,60,50,34,13,162,31,232,161,29,206,65,28,189,129,27,182,97,27,
+186,49,28,211,129,30,3,82,34,76,146,39,171,50,46,32,35,54,169,67,63,68,132,73,
+239,148,84,167,117,96,105,230,108,51,151,121,0,216,140,151,153,165,17,203,187,87,12,206,
+85,77,219,253,221,226,69,190,228,67,46,227,24,62,223,196,221,216,76,45,208,175,76,197,
+241,123,184,21,219,169,31,202,153,21,185,136,0,88,119,235,70,102,225,53,86,235,148,71,
+15,196,58,81,227,47,180,50,39,60,210,32,232,225,28,189,81,27,187,49,29,3,194,36,
+171,2,50,169,67,68,239,116,90,105,54,115,0,120,153,17,123,197,86,205,223,69,94,228,
+22,78,220,76,253,202,241,91,177,31,74,145,0,200,110,225,181,78,15,20,53,180,194,35,
+234,177,27,187,65,32,170,146,58,239,148,102,0,136,177,80,61,228,31,110,212,240,59,162,
+0,216,93,16,164,43,225,209,27,176,130,78,0,168,210,84,174,188,0,104,67,172,97,45,
+0,72,229,0,200,26,0,56,131,103,168,137,205,8,144,51,89,150,151,137,156,249,169,162,
+89,138,168,183,90,174,18,235,179,105,59,185,189,91,190,13,60,195,88,204,199,159,28,204,
+225,12,208,30,189,211,86,13,215,137,13,218,181,173,220,221,237,222,254,205,224,25,78,226,
+46,126,227,61,62,228,70,158,228,74,174,228,74,158,228,72,94,228,67,254,227,59,110,227,
+49,190,226,37,222,225,22,222,224,4,190,223,240,93,222,218,237,220,193,77,219,166,141,217,
+137,157,215,105,157,213,71,109,211,35,29,209,253,156,206,213,12,204,170,76,201,126,124,198,
+79,124,195,31,108,192,236,43,189,184,219,185,130,107,182,74,219,178,16,59,175,213,122,171,
+152,154,167,90,186,163,27,186,159,218,153,155,153,121,151,86,73,147,19,25,143,206,200,138,
+138,120,134,69,40,130,0,232,125,187,151,121,118,71,117,50,247,112,237,198,108,170,150,104,
+103,118,100,38,86,96,229,85,92,166,117,88,104,149,84,43,213,80,240,52,77,182,164,73,
+126,52,70,72,228,66,20,164,63,225,147,60,177,147,57,130,195,54,86,3,52,43,115,49,
+3,243,46,221,162,44,185,114,42,151,114,40,119,130,38,90,194,36,63,34,35,38,178,33,
+16,82,32,252,49,31,234,49,30,219,81,29,207,161,28,197,17,28,189,177,27,184,113,27,
+182,97,27,182,113,27,186,209,27,195,145,28,210,193,29,231,65,31,2,34,33,35,98,35,
+75,2,38,119,2,41,170,82,44,226,2,48,31,243,51,97,67,56,168,211,60,243,179,65,
+67,212,70,151,36,76,238,180,81,73,133,87,167,117,93,7,134,99,105,182,105,205,6,112,
+51,103,118,153,215,124,0,120,134,205,56,147,151,153,159,89,122,171,18,155,182,189,219,192,
+88,252,201,225,236,209,86,157,216,182,221,221,254,157,225,46,222,227,70,174,228,74,126,228,
+67,190,227,49,94,226,22,78,224,240,173,221,193,109,218,137,157,214,71,61,210,253,92,205,
+170,236,199,79,252,193,236,139,187,130,171,180,16,91,173,152,170,165,27,170,157,153,105,149,
+19,233,140,138,88,132,0,184,123,118,39,115,237,166,106,103,102,98,229,101,90,104,181,82,
+240,100,75,126,132,68,20,20,62,177,35,56,86,179,50,3,211,45,185,114,41,119,162,37,
+63,98,34,16,194,31,234,177,29,207,81,28,189,145,27,182,97,27,186,49,28,210,113,30,
+2,50,34,74,114,39,170,34,46,31,19,54,168,51,63,67,116,73,238,148,84,167,117,96,
+105,214,108,51,151,121,0,216,140,151,153,165,18,219,187,88,28,206,86,93,219,254,237,226,
+70,174,228,66,30,227,22,14,223,193,157,216,72,221,207,170,252,196,236,27,184,16,139,169,
+27,138,153,18,169,136,0,104,119,238,134,102,229,133,86,240,244,71,20,20,59,86,51,48,
+184,114,39,63,2,33,234,241,28,190,97,27,186,33,29,2,178,36,170,242,49,168,51,68,
+238,116,90,105,54,115,0,120,153,17,139,197,87,221,223,69,78,228,20,30,220,72,173,202,
+236,27,177,27,42,145,0,232,110,229,245,78,20,100,53,184,242,35,236,193,27,187,49,32,
+169,130,58,239,148,102,0,152,177,81,61,228,29,46,212,234,251,161,0,24,94,22,228,43,
+227,209,27,175,114,78,0,184,210,82,94,188,0,184,67,174,81,45,0,40,229,0,232,26,
+0,56,131,103,168,137,205,8,144,51,89,150,151,137,156,249,169,162,90,154,168,183,90,174,
+18,235,179,106,75,185,190,107,190,13,76,195,89,220,199,160,44,204,226,44,208,32,205,211,
+88,29,215,138,29,218,183,189,220,222,253,222,255,221,224,26,94,226,47,126,227,62,62,228,
+71,158,228,74,174,228,74,158,228,71,94,228,66,238,227,58,94,227,48,174,226,35,206,225,
+20,190,224,2,142,223,238,61,222,215,189,220,190,29,219,163,77,217,133,109,215,102,93,213,
+67,45,211,31,205,208,249,92,206,208,188,203,165,252,200,121,44,198,74,44,195,25,12,192,
+231,219,188,179,139,185,124,27,182,69,139,178,11,235,174,208,42,171,148,90,167,86,122,163,
+23,122,159,215,105,155,149,73,151,83,41,147,16,249,142,205,184,138,137,120,134,68,40,130,
+0,232,125,188,151,121,119,87,117,51,23,113,240,230,108,173,198,104,107,166,100,41,150,96,
+233,149,92,170,181,88,108,229,84,48,37,81,245,132,77,187,244,73,132,132,70,77,52,67,
+25,4,64,231,227,60,182,227,57,135,19,55,91,83,52,48,179,49,7,67,47,225,226,44,
+189,178,42,154,162,40,123,194,38,93,242,36,66,82,35,41,210,33,18,130,32,254,81,31,
+236,65,30,221,97,29,208,177,28,198,33,28,190,177,27,185,113,27,182,97,27,182,113,27,
+185,209,27,194,145,28,209,177,29,230,49,31,1,18,33,34,82,35,73,242,37,118,242,40,
+169,66,44,224,226,47,30,227,51,96,51,56,167,195,60,243,163,65,66,196,70,150,36,76,
+238,180,81,73,117,87,166,101,93,7,134,99,105,182,105,205,6,112,51,103,118,153,215,124,
+0,120,134,205,56,147,151,153,159,90,122,171,18,171,182,190,219,192,89,12,202,226,12,210,
+87,173,216,183,237,221,255,173,225,47,238,227,71,174,228,74,126,228,66,174,227,48,62,226,
+20,46,224,238,125,221,190,61,218,133,109,214,67,253,209,249,12,205,165,156,199,74,156,193,
+231,59,187,124,91,180,11,11,173,148,106,165,23,122,157,149,57,149,16,217,140,137,72,132,
+0,200,123,119,55,115,240,214,106,107,150,98,233,165,90,108,5,83,245,180,75,132,212,68,
+25,116,62,182,115,56,91,3,51,7,19,46,189,162,41,123,210,37,66,146,34,18,226,31,
+236,209,29,208,97,28,190,145,27,182,97,27,185,33,28,209,97,30,1,34,34,73,98,39,
+169,2,46,30,3,54,167,51,63,66,100,73,238,148,84,166,117,96,105,214,108,51,151,121,
+0,216,140,151,169,165,18,219,187,89,60,206,87,125,219,255,253,226,70,174,228,66,14,227,
+20,238,222,190,93,216,68,157,207,165,172,196,231,203,183,11,75,169,23,90,153,16,153,136,
+0,120,119,240,182,102,233,197,86,245,68,72,25,100,59,91,115,48,188,178,39,66,34,33,
+236,1,29,190,97,27,186,17,29,1,146,36,169,210,49,167,51,68,238,100,90,105,54,115,
+0,136,153,18,155,197,89,237,223,70,62,228,18,238,219,68,93,202,230,203,176,23,10,145,
+0,8,111,233,69,79,26,180,53,188,34,36,238,209,27,186,33,32,167,114,58,238,132,102,
+0,168,177,82,61,228,27,238,211,229,187,161,0,88,94,27,36,44,229,209,27,174,98,78,
+0,216,210,80,14,188,0,8,68,176,49,45,0,8,229,0,8,27,0,56,131,103,168,137,
+205,8,144,51,89,150,151,153,156,250,169,162,90,154,168,184,106,174,19,251,179,106,91,185,
+190,123,190,14,92,195,90,236,199,161,60,204,227,60,208,33,221,211,89,61,215,139,45,218,
+184,205,220,223,13,223,0,238,224,27,110,226,48,142,227,63,78,228,71,158,228,74,174,228,
+74,142,228,71,78,228,65,222,227,57,78,227,46,142,226,33,174,225,18,158,224,0,110,223,
+235,13,222,212,141,220,187,237,218,160,29,217,130,45,215,98,29,213,63,221,210,27,141,208,
+244,12,206,203,108,203,161,172,200,116,220,197,69,220,194,20,188,191,226,139,188,173,59,185,
+119,203,181,64,59,178,6,155,174,204,234,170,143,26,167,82,58,163,19,58,159,211,57,155,
+146,41,151,81,9,147,14,217,142,203,152,138,136,104,134,68,40,130,0,232,125,188,167,121,
+120,119,117,53,55,113,242,6,109,175,230,104,110,214,100,45,214,96,237,213,92,174,245,88,
+113,37,85,52,117,81,250,212,77,192,68,74,137,212,70,83,132,67,30,84,64,236,51,61,
+187,51,58,140,99,55,95,163,52,53,3,50,12,131,47,229,50,45,193,242,42,158,226,40,
+126,242,38,96,34,37,69,130,35,44,2,34,21,162,32,0,114,31,238,97,30,223,129,29,
+210,193,28,199,49,28,191,193,27,185,129,27,182,97,27,182,113,27,185,193,27,193,129,28,
+208,161,29,229,33,31,0,2,33,33,66,35,72,226,37,117,210,40,167,50,44,223,210,47,
+29,211,51,95,35,56,166,179,60,242,147,65,66,180,70,150,20,76,237,164,81,72,117,87,
+166,101,93,6,118,99,105,182,105,205,6,112,51,103,118,153,215,124,0,120,134,205,56,147,
+151,169,159,90,138,171,19,171,182,190,235,192,90,28,202,227,28,210,89,189,216,184,253,221,
+0,190,225,48,254,227,71,174,228,74,126,228,65,158,227,46,30,226,18,14,224,235,77,221,
+187,13,218,130,45,214,63,189,209,244,188,204,161,76,199,69,76,193,226,219,186,119,11,180,
+6,203,172,143,42,165,19,58,157,146,25,149,14,185,140,136,72,132,0,200,123,120,87,115,
+242,246,106,110,214,98,237,229,90,113,69,83,250,4,76,137,52,69,30,196,62,187,195,56,
+95,83,51,12,83,46,193,226,41,126,2,38,69,194,34,21,2,32,238,241,29,210,113,28,
+191,145,27,182,97,27,185,17,28,208,81,30,0,18,34,72,82,39,167,242,45,29,243,53,
+166,35,63,66,100,73,237,132,84,166,101,96,105,214,108,51,151,121,0,216,140,151,169,165,
+19,235,187,90,76,206,88,141,219,0,14,227,71,174,228,65,238,226,18,190,222,187,45,216,
+63,77,207,160,92,196,226,123,183,6,251,168,19,42,153,14,137,136,0,136,119,242,230,102,
+237,21,87,250,148,72,30,180,59,96,195,48,193,226,39,69,82,33,238,33,29,191,97,27,
+185,1,29,0,130,36,167,194,49,166,35,68,237,100,90,105,54,115,0,136,153,18,171,197,
+90,13,224,70,62,228,17,190,219,64,13,202,225,123,176,19,234,144,0,40,111,237,149,79,
+31,4,54,192,82,36,239,209,27,186,1,32,166,98,58,238,132,102,0,184,177,83,77,228,
+26,174,211,224,139,161,0,136,94,32,100,44,230,193,27,173,82,78,0,232,210,77,190,187,
+0,88,68,179,33,45,0,216,228,0,56,27,0,56,131,103,168,137,205,8,144,51,89,150,
+151,153,156,250,169,162,90,170,168,184,106,174,19,251,179,107,91,185,191,123,190,15,92,195,
+91,252,199,162,76,204,229,76,208,34,253,211,90,77,215,140,77,218,185,221,220,224,29,223,
+1,254,224,28,126,226,49,158,227,63,78,228,72,158,228,74,174,228,73,142,228,70,62,228,
+64,206,227,56,62,227,45,126,226,32,142,225,16,126,224,253,61,223,233,221,221,210,93,220,
+184,173,218,156,237,216,126,237,214,94,221,212,59,157,210,23,61,208,240,188,205,199,28,203,
+156,92,200,111,140,197,64,140,194,15,108,191,221,59,188,168,219,184,114,123,181,59,235,177,
+1,75,174,199,154,170,139,202,166,78,250,162,15,10,159,208,9,155,143,249,150,78,217,146,
+12,185,142,202,136,138,135,88,134,67,40,130,0,232,125,189,183,121,121,135,117,54,87,113,
+244,54,109,178,22,105,113,6,101,48,6,97,241,21,93,178,69,89,117,117,85,57,197,81,
+255,36,78,197,148,74,142,52,71,88,212,67,35,164,64,241,131,61,192,131,58,145,179,55,
+100,243,52,57,83,50,16,211,47,233,114,45,197,50,43,162,34,41,130,34,39,100,98,37,
+72,178,35,46,50,34,23,210,32,3,146,31,240,129,30,224,145,29,211,209,28,200,65,28,
+192,209,27,186,129,27,183,97,27,182,113,27,184,193,27,193,113,28,207,145,29,228,17,31,
+255,241,32,32,50,35,71,194,37,116,194,40,166,18,44,222,194,47,27,195,51,94,19,56,
+165,179,60,241,147,65,65,180,70,149,20,76,237,164,81,72,101,87,166,101,93,6,118,99,
+105,182,105,205,6,112,51,103,118,153,215,124,0,120,134,205,56,147,151,169,159,90,138,171,
+19,187,182,191,251,192,91,44,202,229,44,210,90,205,216,185,13,222,1,206,225,49,254,227,
+71,174,228,73,110,228,64,142,227,45,14,226,16,222,223,233,45,221,184,205,217,126,237,213,
+59,125,209,240,124,204,156,252,198,64,252,192,221,139,186,114,187,179,1,123,172,139,234,164,
+15,10,157,143,233,148,12,169,140,135,56,132,0,216,123,121,103,115,244,38,107,113,6,99,
+241,37,91,117,149,83,255,84,76,142,132,69,35,20,63,192,19,57,100,147,51,16,147,46,
+197,34,42,130,66,38,72,226,34,23,50,32,240,1,30,211,129,28,192,161,27,183,97,27,
+185,17,28,207,65,30,255,1,34,71,66,39,166,226,45,27,227,53,165,19,63,65,84,73,
+237,132,84,166,101,96,105,214,108,51,151,121,0,216,140,151,169,165,19,251,187,91,92,206,
+90,157,219,2,30,227,71,174,228,64,222,226,16,158,222,184,237,215,59,13,207,156,12,196,
+221,43,183,1,187,168,15,250,152,12,121,136,0,152,119,244,22,103,241,85,87,255,228,72,
+35,4,60,100,3,49,197,34,40,72,114,33,240,49,29,192,97,27,185,241,28,254,113,36,
+166,178,49,165,19,68,237,100,90,105,54,115,0,136,153,19,171,197,91,29,224,71,46,228,
+15,142,219,60,189,201,220,43,176,15,186,144,0,72,111,241,229,79,36,84,54,196,130,36,
+241,225,27,185,241,31,165,98,58,237,132,102,0,184,177,84,77,228,24,110,211,218,75,161,
+0,200,94,38,164,44,232,193,27,172,82,78,0,8,211,75,110,187,0,168,68,181,1,45,
+0,184,228,0,88,27,0,56,131,103,168,137,205,8,144,51,89,150,151,153,156,250,185,162,
+91,170,168,185,106,174,20,11,180,107,107,185,192,139,190,16,108,195,92,12,200,163,92,204,
+230,92,208,35,13,212,91,93,215,142,93,218,186,253,220,225,61,223,2,14,225,29,142,226,
+50,174,227,64,94,228,72,174,228,74,174,228,73,142,228,70,62,228,63,190,227,55,30,227,
+44,94,226,30,110,225,14,94,224,251,29,223,230,189,221,207,45,220,181,125,218,153,173,216,
+123,173,214,90,157,212,55,93,210,18,253,207,235,124,205,194,220,202,151,12,200,106,44,197,
+59,60,194,10,28,191,215,219,187,163,139,184,109,27,181,54,155,177,252,250,173,194,74,170,
+134,138,166,73,170,162,11,202,158,204,201,154,140,201,150,75,185,146,10,153,142,200,120,138,
+133,72,134,67,24,130,0,248,125,189,199,121,123,151,117,56,119,113,246,86,109,181,70,105,
+116,70,101,52,70,97,245,101,93,183,133,89,122,197,85,62,21,82,4,117,78,203,244,74,
+147,132,71,93,52,68,41,244,64,246,211,61,197,227,58,150,3,56,105,51,53,62,147,50,
+21,19,48,238,178,45,201,114,43,166,98,41,133,98,39,103,146,37,75,226,35,49,82,34,
+26,242,32,5,178,31,242,161,30,226,177,29,212,241,28,201,81,28,193,209,27,186,129,27,
+183,97,27,182,97,27,184,177,27,192,97,28,206,129,29,227,1,31,254,209,32,31,18,35,
+70,178,37,114,178,40,165,2,44,221,178,47,26,179,51,93,3,56,164,163,60,240,131,65,
+64,164,70,149,4,76,236,164,81,71,101,87,165,85,93,6,118,99,105,182,105,205,6,112,
+51,103,118,153,215,124,0,120,134,205,56,147,151,169,159,91,154,171,20,187,182,192,11,193,
+92,60,202,230,60,210,91,221,216,186,29,222,2,222,225,50,14,228,72,174,228,73,94,228,
+63,126,227,44,238,225,14,190,223,230,253,220,181,157,217,122,173,213,55,45,209,235,44,204,
+151,172,198,59,172,192,215,59,186,109,91,179,252,42,172,134,154,164,11,202,156,140,185,148,
+10,137,140,133,56,132,0,216,123,123,135,115,246,86,107,116,70,99,245,117,91,122,229,83,
+4,181,76,147,212,69,41,100,63,197,99,57,105,227,51,21,227,46,201,98,42,134,114,38,
+75,18,35,26,82,32,242,33,30,212,145,28,193,177,27,183,97,27,184,1,28,206,49,30,
+254,241,33,70,34,39,165,210,45,26,211,53,164,3,63,64,84,73,236,116,84,165,101,96,
+105,214,108,51,151,121,0,216,140,151,185,165,20,251,187,92,108,206,91,173,219,3,46,227,
+71,174,228,63,190,226,14,110,222,181,189,215,55,189,206,151,188,195,215,219,182,252,106,168,
+11,202,152,10,105,136,0,168,119,246,70,103,245,165,87,4,53,73,41,84,60,105,83,49,
+201,82,40,75,162,33,242,81,29,193,97,27,185,225,28,253,97,36,165,162,49,164,19,68,
+236,84,90,105,54,115,0,136,153,19,187,197,92,45,224,71,30,228,12,94,219,56,109,201,
+215,219,175,12,154,144,0,120,111,244,53,80,41,164,54,200,178,36,244,241,27,185,225,31,
+164,82,58,237,132,102,0,200,177,85,77,228,22,30,211,213,11,161,0,8,95,43,244,44,
+234,193,27,171,66,78,0,24,211,73,46,187,0,232,68,184,241,44,0,136,228,0,136,27,
+0,56,131,103,168,137,205,8,144,51,105,150,152,153,156,250,185,162,91,170,168,185,122,174,
+20,11,180,108,107,185,192,155,190,16,124,195,92,28,200,164,108,204,230,108,208,36,29,212,
+92,109,215,143,109,218,187,13,221,226,77,223,3,30,225,30,158,226,50,174,227,64,94,228,
+72,174,228,74,174,228,73,126,228,69,46,228,62,174,227,53,14,227,42,62,226,28,78,225,
+12,46,224,249,237,222,227,141,221,204,253,219,178,77,218,149,109,216,119,125,214,86,93,212,
+51,29,210,14,173,207,230,44,205,189,140,202,146,188,199,101,220,196,54,220,193,5,204,190,
+210,139,187,158,59,184,104,203,180,48,75,177,248,186,173,189,10,170,130,74,166,69,106,162,
+7,138,158,201,153,154,137,153,150,73,137,146,8,121,142,198,88,138,132,56,134,66,24,130,
+0,248,125,190,215,121,124,183,117,58,151,113,248,134,109,183,118,105,119,118,101,55,134,97,
+249,165,93,187,197,89,126,5,86,67,85,82,8,197,78,208,68,75,152,212,71,98,132,68,
+46,68,65,251,51,62,202,51,59,155,83,56,110,131,53,67,227,50,26,99,48,242,242,45,
+205,178,43,170,146,41,137,162,39,107,194,37,78,18,36,52,130,34,29,34,33,7,226,31,
+244,193,30,228,209,29,214,1,29,203,97,28,194,225,27,187,145,27,183,97,27,182,97,27,
+184,177,27,192,97,28,206,113,29,226,241,30,253,193,32,30,2,35,69,162,37,113,162,40,
+164,242,43,220,162,47,26,163,51,92,243,55,164,147,60,240,115,65,64,164,70,148,4,76,
+236,148,81,71,101,87,165,85,93,6,118,99,104,166,105,205,6,112,51,103,118,153,215,124,
+0,120,134,205,56,147,152,169,159,91,154,171,20,203,182,192,11,193,92,76,202,230,76,210,
+92,253,216,187,45,222,3,238,225,50,14,228,72,174,228,73,94,228,62,110,227,42,206,225,
+12,158,223,227,205,220,178,93,217,119,109,213,51,237,208,230,220,203,146,92,198,54,92,192,
+210,235,185,104,11,179,248,218,171,130,90,164,7,154,156,137,153,148,8,105,140,132,40,132,
+0,232,123,124,167,115,248,118,107,119,118,99,249,181,91,126,53,84,8,5,77,152,36,70,
+46,180,63,202,179,57,110,51,52,26,35,47,205,162,42,137,178,38,78,66,35,29,114,32,
+244,65,30,214,161,28,194,177,27,183,97,27,184,1,28,206,33,30,253,225,33,69,18,39,
+164,194,45,26,195,53,164,3,63,64,68,73,236,116,84,165,101,96,104,214,108,51,151,121,
+0,216,140,152,185,165,20,11,188,93,124,206,92,189,219,4,46,227,72,158,228,62,174,226,
+12,62,222,178,125,215,51,109,206,146,108,195,210,139,182,247,42,168,7,154,152,8,73,136,
+0,200,119,248,118,103,249,229,87,9,133,73,46,164,60,110,163,49,205,146,40,78,210,33,
+244,97,29,194,113,27,184,225,28,252,81,36,164,146,49,163,3,68,236,84,90,104,54,115,
+0,136,153,19,203,197,93,61,224,71,14,228,10,46,219,52,29,201,209,139,175,8,122,144,
+0,152,111,248,133,80,47,244,54,204,226,36,246,1,28,185,209,31,163,66,58,237,132,102,
+0,200,177,86,77,228,20,222,210,208,219,160,0,56,95,48,52,45,236,193,27,170,66,78,
+0,56,211,70,222,186,0,56,69,186,209,44,0,104,228,0,168,27,0,56,131,103,168,137,
+206,24,144,51,105,150,152,153,156,250,185,162,91,170,168,185,122,174,20,27,180,108,123,185,
+193,155,190,17,140,195,93,28,200,165,124,204,231,124,208,37,45,212,93,125,215,144,125,218,
+188,29,221,227,77,223,4,46,225,31,174,226,51,190,227,65,94,228,72,174,228,74,158,228,
+72,110,228,68,30,228,61,158,227,52,254,226,40,46,226,26,46,225,9,14,224,246,205,222,
+225,93,221,201,205,219,174,13,218,146,61,216,115,61,214,82,29,212,47,205,209,9,109,207,
+226,220,204,184,60,202,141,108,199,95,140,196,48,140,193,255,107,190,205,59,187,152,235,183,
+99,123,180,43,251,176,243,106,173,184,186,169,125,250,165,65,42,162,3,74,158,197,105,154,
+134,105,150,70,105,146,6,89,142,197,72,138,131,40,134,66,24,130,0,248,125,190,231,121,
+125,199,117,59,183,113,250,166,109,186,166,105,122,166,101,59,198,97,253,229,93,191,21,90,
+131,85,86,72,165,82,13,21,79,213,148,75,157,36,72,104,212,68,51,164,65,1,132,62,
+208,131,59,161,163,56,115,211,53,72,51,51,30,163,48,247,66,46,209,242,43,174,210,41,
+141,210,39,110,2,38,82,66,36,55,178,34,31,66,33,10,2,32,247,225,30,230,225,29,
+216,17,29,204,113,28,195,241,27,188,161,27,184,113,27,182,97,27,184,177,27,191,81,28,
+205,97,29,225,225,30,252,193,32,29,242,34,68,146,37,112,146,40,163,226,43,219,146,47,
+25,147,51,91,243,55,163,131,60,239,115,65,63,148,70,148,244,75,236,148,81,71,101,87,
+165,85,93,6,118,99,104,166,105,205,6,112,50,103,118,153,215,124,0,120,134,206,56,147,
+152,169,159,91,154,171,20,203,182,193,27,193,93,92,202,231,92,210,93,13,217,188,61,222,
+4,254,225,51,30,228,72,174,228,72,78,228,61,78,227,40,174,225,9,110,223,225,157,220,
+174,45,217,115,45,213,47,157,208,226,140,203,141,252,197,48,252,191,205,139,185,99,187,178,
+243,138,171,125,26,164,3,90,156,134,105,148,6,89,140,131,40,132,0,232,123,125,183,115,
+250,166,107,122,182,99,253,245,91,131,133,84,13,85,77,157,132,70,51,20,64,208,19,58,
+115,131,52,30,115,47,209,226,42,141,226,38,82,114,35,31,162,32,247,97,30,216,193,28,
+195,193,27,184,97,27,184,241,27,205,17,30,252,209,33,68,2,39,163,178,45,25,179,53,
+163,243,62,63,68,73,236,116,84,165,101,96,104,214,108,50,151,121,0,216,140,152,185,165,
+20,11,188,93,124,206,93,205,219,4,62,227,72,158,228,61,142,226,10,30,222,174,61,215,
+47,45,206,141,12,195,205,59,182,242,218,167,3,106,152,6,57,136,0,216,119,250,166,103,
+253,53,88,14,213,73,51,4,61,115,227,49,209,210,40,82,242,33,246,129,29,195,113,27,
+184,209,28,252,65,36,163,146,49,163,3,68,236,84,90,104,54,115,0,136,153,20,219,197,
+94,61,224,71,254,227,8,238,218,48,205,200,204,59,175,4,90,144,0,184,111,252,213,80,
+52,68,55,208,34,37,248,17,28,185,209,31,162,50,58,236,132,102,0,216,177,87,77,228,
+18,158,210,202,155,160,0,120,95,54,116,45,238,193,27,169,50,78,0,72,211,67,142,186,
+0,136,69,189,193,44,0,56,228,0,216,27,0,56,131,103,168,137,206,24,144,51,105,150,
+152,153,156,251,185,162,91,186,168,185,122,174,21,27,180,109,123,185,193,171,190,18,140,195,
+94,44,200,165,124,204,232,140,208,38,61,212,94,141,215,145,141,218,189,45,221,228,93,223,
+5,62,225,31,174,226,52,190,227,65,110,228,72,174,228,74,158,228,72,110,228,67,14,228,
+60,142,227,51,222,226,39,14,226,24,14,225,7,238,223,244,157,222,222,45,221,198,157,219,
+171,221,217,142,253,215,111,253,213,78,205,211,42,141,209,5,29,207,221,140,204,179,236,201,
+136,28,199,90,60,196,43,60,193,250,27,190,199,219,186,147,139,183,93,43,180,38,171,176,
+238,26,173,180,106,169,121,186,165,61,234,161,0,26,158,194,41,154,131,57,150,67,57,146,
+3,57,142,195,56,138,130,40,134,65,24,130,0,248,125,191,231,121,126,215,117,61,215,113,
+253,214,109,189,214,105,125,230,101,62,246,97,0,38,94,195,85,90,135,165,86,76,245,82,
+18,101,79,218,228,75,163,132,72,109,52,69,57,244,65,6,212,62,213,211,59,166,243,56,
+120,35,54,77,115,51,35,243,48,251,130,46,214,66,44,178,18,42,145,18,40,114,50,38,
+85,114,36,58,226,34,34,114,33,12,34,32,249,1,31,232,1,30,217,49,29,205,129,28,
+196,1,28,189,161,27,184,113,27,182,97,27,184,161,27,191,81,28,204,97,29,225,209,30,
+251,177,32,28,226,34,67,130,37,111,130,40,162,210,43,218,130,47,24,147,51,91,227,55,
+162,131,60,238,99,65,63,148,70,147,244,75,235,148,81,71,85,87,165,85,93,5,118,99,
+104,166,105,205,246,111,50,103,118,153,215,124,0,120,134,206,56,147,152,185,159,91,154,171,
+21,219,182,193,43,193,94,92,202,232,108,210,94,29,217,189,77,222,5,254,225,52,30,228,
+72,174,228,72,62,228,60,62,227,39,142,225,7,78,223,222,109,220,171,237,216,111,237,212,
+42,93,208,221,60,203,136,172,197,43,172,191,199,59,185,93,107,178,238,74,171,121,218,163,
+0,42,156,131,57,148,3,57,140,130,24,132,0,248,123,126,215,115,253,214,107,125,230,99,
+0,54,92,135,197,84,18,165,77,163,212,70,57,100,64,213,99,58,120,211,52,35,179,47,
+214,34,43,145,34,39,85,162,35,34,194,32,249,129,30,217,209,28,196,209,27,184,97,27,
+184,241,27,204,17,30,251,193,33,67,242,38,162,162,45,24,179,53,162,227,62,63,52,73,
+235,116,84,165,85,96,104,214,108,50,151,121,0,216,140,152,185,165,21,27,188,94,140,206,
+94,221,219,5,62,227,72,142,228,60,126,226,7,238,221,171,253,214,42,221,205,136,188,194,
+199,219,181,237,154,167,0,58,152,3,41,136,0,232,119,253,214,103,0,118,88,19,53,74,
+57,84,61,120,51,50,214,18,41,85,34,34,249,145,29,196,129,27,184,209,28,251,49,36,
+162,130,49,162,243,67,235,84,90,104,54,115,0,152,153,20,219,197,95,77,224,71,238,227,
+6,190,218,43,125,200,199,235,174,0,58,144,0,216,111,0,38,81,57,148,55,213,82,37,
+250,33,28,185,193,31,161,50,58,236,116,102,0,232,177,87,93,228,16,78,210,197,91,160,
+0,184,95,59,196,45,240,177,27,169,34,78,0,88,211,65,62,186,0,216,69,191,177,44,
+0,24,228,0,248,27,0,56,131,103,168,137,206,24,144,51,105,150,152,169,156,251,185,162,
+91,186,168,186,138,174,21,43,180,109,139,185,194,171,190,18,156,195,95,60,200,166,140,204,
+233,156,208,39,77,212,95,157,215,146,157,218,190,61,221,229,109,223,6,78,225,32,190,226,
+52,206,227,66,110,228,73,174,228,74,158,228,71,94,228,67,254,227,59,126,227,49,206,226,
+37,238,225,22,238,224,5,206,223,241,125,222,219,253,220,195,109,219,168,173,217,139,189,215,
+107,189,213,74,141,211,38,61,209,0,221,206,216,76,204,175,156,201,131,204,198,85,236,195,
+38,236,192,245,203,189,194,139,186,142,59,183,88,219,179,33,91,176,233,202,172,175,42,169,
+116,106,165,56,170,161,252,217,157,190,249,153,128,9,150,65,25,146,1,25,142,193,24,138,
+129,24,134,65,8,130,0,8,126,191,247,121,127,247,117,63,247,113,255,246,109,191,6,106,
+128,22,102,66,54,98,4,102,94,200,165,90,140,229,86,81,69,83,23,181,79,223,52,76,
+168,212,72,114,132,69,62,68,66,11,36,63,218,35,60,171,67,57,125,115,54,81,195,51,
+40,51,49,0,211,46,218,130,44,182,82,42,149,82,40,117,98,38,88,162,36,61,18,35,
+37,146,33,15,66,32,251,33,31,234,33,30,219,65,29,207,145,28,197,17,28,189,177,27,
+185,113,27,182,97,27,183,161,27,190,65,28,204,81,29,224,193,30,250,161,32,27,210,34,
+66,114,37,110,114,40,161,194,43,217,114,47,23,131,51,90,211,55,161,115,60,238,99,65,
+62,132,70,147,228,75,235,132,81,70,85,87,165,85,93,5,102,99,104,166,105,205,246,111,
+50,103,118,153,215,124,0,120,134,206,56,147,152,185,159,91,170,171,21,219,182,194,43,193,
+95,108,202,233,124,210,95,45,217,190,93,222,6,14,226,52,46,228,72,174,228,71,62,228,
+59,46,227,37,110,225,5,30,223,219,61,220,168,189,216,107,173,212,38,13,208,216,252,202,
+131,92,197,38,92,191,194,235,184,88,27,178,233,250,170,116,138,163,252,233,155,128,25,148,
+1,25,140,129,24,132,0,248,123,127,247,115,255,246,107,128,38,100,4,134,92,140,21,85,
+23,245,77,168,36,71,62,180,64,218,179,58,125,19,53,40,3,48,218,98,43,149,82,39,
+88,210,35,37,242,32,251,161,30,219,225,28,197,209,27,185,97,27,184,225,27,204,1,30,
+250,177,33,66,226,38,161,146,45,23,163,53,161,227,62,62,52,73,235,100,84,165,85,96,
+104,214,108,50,151,121,0,216,140,152,201,165,21,43,188,95,156,206,95,237,219,6,78,227,
+72,142,228,59,94,226,5,190,221,168,189,214,38,141,205,131,108,194,194,139,181,233,74,167,
+252,9,152,1,25,136,0,248,119,255,6,104,4,198,88,23,133,74,62,164,61,125,131,50,
+218,82,41,88,82,34,251,177,29,197,129,27,184,193,28,250,33,36,161,114,49,161,227,67,
+235,68,90,104,54,115,0,152,153,20,235,197,96,93,224,71,222,227,4,142,218,39,45,200,
+194,155,174,252,25,144,0,248,111,4,118,81,62,228,55,217,130,37,252,49,28,185,177,31,
+160,34,58,236,116,102,0,232,177,88,93,228,14,14,210,192,27,160,0,248,95,64,4,46,
+242,177,27,168,34,78,0,104,211,62,238,185,0,40,70,194,161,44,0,232,227,0,40,28,
+0,72,131,103,168,137,206,24,144,51,105,150,152,169,156,251,201,162,92,186,168,186,138,174,
+21,43,180,110,139,185,194,187,190,19,172,195,95,76,200,167,156,204,234,156,208,40,77,212,
+96,173,215,147,173,218,191,77,221,230,125,223,7,94,225,33,206,226,53,206,227,66,110,228,
+73,174,228,73,142,228,71,94,228,66,238,227,58,110,227,48,174,226,36,206,225,20,206,224,
+3,158,223,239,77,222,216,205,220,192,45,219,165,109,217,135,141,215,104,125,213,70,77,211,
+34,253,208,252,140,206,212,252,203,170,76,201,126,124,198,80,156,195,33,140,192,240,107,189,
+189,59,186,137,235,182,83,139,179,28,11,176,228,122,172,170,218,168,112,42,165,52,106,161,
+248,153,157,186,201,153,125,217,149,62,249,145,255,248,141,192,8,138,128,8,134,64,8,130,
+0,8,126,192,7,122,128,7,118,64,23,114,1,23,110,194,54,106,131,70,102,70,118,98,
+8,166,94,204,229,90,144,53,87,86,149,83,28,5,80,228,132,76,173,36,73,119,212,69,
+67,164,66,16,132,63,223,115,60,176,147,57,130,195,54,86,19,52,44,131,49,4,19,47,
+222,194,44,186,146,42,152,130,40,121,162,38,91,226,36,64,66,35,40,194,33,17,114,32,
+253,65,31,236,65,30,220,97,29,208,161,28,198,33,28,190,177,27,185,129,27,183,97,27,
+183,161,27,190,65,28,203,65,29,223,177,30,249,145,32,26,194,34,65,98,37,109,98,40,
+160,194,43,216,114,47,22,115,51,89,195,55,161,99,60,237,83,65,62,132,70,146,228,75,
+235,132,81,70,85,87,164,69,93,5,102,99,104,166,105,205,246,111,50,103,118,153,199,124,
+0,120,134,206,56,147,152,185,159,92,170,171,21,235,182,194,59,193,95,124,202,234,140,210,
+96,61,217,191,109,222,7,30,226,53,46,228,73,174,228,71,46,228,58,14,227,36,78,225,
+3,254,222,216,13,220,165,125,216,104,109,212,34,205,207,212,172,202,126,12,197,33,12,191,
+189,155,184,83,203,177,228,170,170,112,74,163,248,169,155,125,233,147,255,8,140,128,8,132,
+0,8,124,128,7,116,1,39,108,131,102,100,8,198,92,144,101,85,28,69,78,173,116,71,
+67,4,65,223,3,59,130,99,53,44,67,48,222,162,43,152,146,39,91,2,36,40,18,33,
+253,193,30,220,1,29,198,225,27,185,97,27,183,225,27,203,241,29,249,161,33,65,210,38,
+160,130,45,22,147,53,161,211,62,62,36,73,235,100,84,164,85,96,104,214,108,50,151,121,
+0,232,140,152,201,165,21,43,188,95,172,206,96,253,219,7,94,227,72,142,228,58,62,226,
+3,158,221,164,141,214,34,77,205,126,28,194,189,59,181,228,10,167,248,201,151,255,8,136,
+0,8,120,1,71,104,8,6,89,28,213,74,67,244,61,130,195,50,222,130,41,92,114,34,
+253,209,29,198,129,27,184,177,28,249,17,36,160,98,49,161,227,67,235,68,90,104,38,115,
+0,152,153,21,251,197,97,109,224,72,206,227,2,94,218,35,221,199,188,75,174,248,233,143,
+0,40,112,8,198,81,68,52,56,221,178,37,254,65,28,184,161,31,159,18,58,235,116,102,
+0,248,177,89,93,228,12,190,209,186,219,159,0,56,96,70,84,46,244,177,27,167,18,78,
+0,136,211,60,158,185,0,120,70,196,129,44,0,200,227,0,72,28,0,72,131,103,168,137,
+206,24,144,51,105,150,152,169,156,251,201,162,92,186,168,186,138,174,21,43,180,110,139,185,
+194,187,190,19,172,195,95,76,200,167,156,204,234,156,208,40,77,212,96,173,215,147,173,218,
+191,77,221,230,125,223,7,94,225,33,206,226,53,206,227,66,110,228,73,174,228,73,142,228,
+71,94,228,66,238,227,58,110,227,48,174,226,36,206,225,20,206,224,3,158,223,239,77,222,
+216,205,220,192,45,219,165,109,217,135,141,215,104,125,213,70,77,211,34,253,208,252,140,206,
+212,252,203,170,76,201,126,124,198,80,156,195,33,140,192,240,107,189,189,59,186,137,235,182,
+83,139,179,28,11,176,228,122,172,170,218,168,112,42,165,52,106,161,248,153,157,186,201,153,
+125,217,149,62,249,145,255,248,141,192,8,138,128,8,134,64,8,130,0,8,126,192,7,122,
+128,7,118,64,23,114,1,23,110,194,54,106,131,70,102,70,118,98,8,166,94,204,229,90,
+144,53,87,86,149,83,28,5,80,228,132,76,173,36,73,119,212,69,67,164,66,16,132,63,
+223,115,60,176,147,57,130,195,54,86,19,52,44,131,49,4,19,47,222,194,44,186,146,42,
+152,130,40,121,162,38,91,226,36,64,66,35,40,194,33,17,114,32,253,65,31,236,65,30,
+220,97,29,208,161,28,198,33,28,190,177,27,185,129,27,183,97,27,183,161,27,190,65,28,
+203,65,29,223,177,30,249,145,32,26,194,34,65,98,37,109,98,40,160,194,43,216,114,47,
+22,115,51,89,195,55,161,99,60,237,83,65,62,132,70,146,228,75,235,132,81,70,85,87,
+164,69,93,5,102,99,104,166,105,205,246,111,50,103,118,153,199,124,0,120,134,206,72,147,
+152,185,159,92,170,171,21,235,182,194,59,193,95,124,202,234,140,210,96,61,217,191,109,222,
+7,30,226,53,46,228,73,174,228,71,46,228,58,14,227,36,78,225,3,254,222,216,13,220,
+165,125,216,104,109,212,34,205,207,212,172,202,126,12,197,33,12,191,189,155,184,83,203,177,
+228,170,170,112,74,163,248,169,155,125,233,147,255,8,140,128,8,132,0,8,124,128,7,116,
+1,39,108,131,102,100,8,198,92,144,101,85,28,69,78,173,116,71,67,4,65,223,3,59,
+130,99,53,44,67,48,222,162,43,152,146,39,91,2,36,40,18,33,253,193,30,220,1,29,
+198,225,27,185,97,27,183,225,27,203,241,29,249,161,33,65,210,38,160,130,45,22,147,53,
+161,211,62,62,36,73,235,100,84,164,85,96,104,198,108,50,151,121,0,232,140,152,201,165,
+21,43,188,95,172,206,96,253,219,7,94,227,72,142,228,58,62,226,3,158,221,164,141,214,
+34,77,205,126,28,194,189,59,181,228,10,167,248,217,151,255,8,136,0,8,120,1,55,104,
+8,6,89,28,213,74,67,244,61,130,195,50,222,130,41,92,114,34,253,209,29,198,129,27,
+184,177,28,249,17,36,160,98,49,161,227,67,235,68,90,104,38,115,0,152,153,21,251,197,
+97,109,224,72,206,227,2,94,218,35,221,199,188,75,174,248,233,143,0,40,112,8,198,81,
+68,52,56,221,178,37,254,65,28,184,161,31,159,18,58,235,116,102,0,248,177,89,93,228,
+12,190,209,186,235,159,0,40,96,70,84,46,244,177,27,167,18,78,0,136,211,60,158,185,
+0,120,70,196,129,44,0,200,227,0,72,28,0,72,131,104,200,137,208,56,144,54,153,150,
+156,233,156,255,25,163,97,26,169,192,250,174,28,155,180,117,11,186,202,59,191,27,44,196,
+104,204,200,176,44,205,242,44,209,48,221,212,104,45,216,154,29,219,198,173,221,237,221,223,
+12,174,225,38,14,227,56,254,227,68,142,228,74,174,228,73,142,228,70,78,228,65,222,227,
+57,78,227,46,142,226,33,174,225,17,158,224,0,110,223,235,13,222,213,141,220,188,237,218,
+160,45,217,131,61,215,99,45,213,65,253,210,29,173,208,247,60,206,207,172,203,165,252,200,
+121,44,198,75,76,195,28,60,192,235,43,189,184,235,185,132,171,182,79,59,179,24,203,175,
+224,58,172,167,170,168,108,250,164,49,58,161,245,121,157,184,153,153,122,185,149,60,217,145,
+254,232,141,191,248,137,127,248,133,64,8,130,0,8,126,192,23,122,129,23,118,65,39,114,
+2,55,110,196,86,106,134,118,102,72,150,98,11,214,94,207,21,91,148,101,87,89,213,83,
+32,69,80,232,212,76,177,100,73,124,36,70,72,228,66,21,196,63,228,195,60,181,227,57,
+135,19,55,91,99,52,49,211,49,9,99,47,227,18,45,191,226,42,157,210,40,125,226,38,
+96,34,37,68,130,35,43,2,34,21,162,32,0,114,31,239,97,30,223,129,29,210,193,28,
+199,49,28,191,193,27,186,129,27,183,97,27,182,129,27,188,17,28,200,1,29,218,97,30,
+244,49,32,19,98,34,58,242,36,102,226,39,152,50,43,208,226,46,14,227,50,80,67,55,
+152,227,59,229,211,64,54,4,70,139,116,75,228,20,81,64,245,86,159,245,92,1,38,99,
+100,118,105,202,214,111,48,71,118,152,199,124,0,136,134,208,104,147,156,249,159,97,10,172,
+28,91,183,202,187,193,104,252,202,242,12,211,104,173,217,199,221,222,12,110,226,56,78,228,
+73,158,228,70,30,228,57,238,226,33,30,225,0,190,222,213,205,219,160,61,216,99,29,212,
+29,125,207,207,92,202,121,188,196,28,188,190,184,75,184,79,139,177,224,122,170,108,26,163,
+245,137,155,122,201,147,254,248,139,127,8,132,0,8,124,129,23,116,2,71,108,134,134,100,
+11,246,92,148,149,85,32,133,78,177,196,71,72,84,65,228,83,59,135,179,53,49,147,48,
+227,242,43,157,210,39,96,66,36,43,82,33,0,242,30,223,33,29,199,241,27,186,113,27,
+183,193,27,200,161,29,244,49,33,57,98,38,152,2,45,14,19,53,152,83,62,54,180,72,
+228,4,84,159,21,96,100,166,108,48,135,121,0,248,140,156,25,166,28,171,188,104,44,207,
+104,109,220,13,142,227,73,126,228,56,30,226,0,94,221,160,61,214,29,253,204,121,204,193,
+184,251,180,224,202,166,245,169,151,254,248,135,0,24,120,2,103,104,11,70,89,32,21,75,
+72,68,62,135,19,51,227,210,41,96,178,34,0,242,29,200,145,27,183,129,28,243,161,35,
+152,226,48,152,99,67,228,244,89,100,22,115,0,200,153,28,123,198,105,189,224,73,174,227,
+254,13,218,30,141,199,184,11,174,245,217,143,0,56,112,11,6,82,72,132,56,226,2,38,
+2,98,28,183,81,31,151,146,57,228,68,102,0,104,178,96,109,228,9,110,209,182,187,159,
+0,88,96,74,164,46,247,161,27,160,162,77,0,216,211,59,46,185,0,232,70,197,49,44,
+0,184,227,0,88,28,0,88,131,105,216,137,210,104,144,57,217,150,160,41,157,4,106,163,
+102,122,169,198,90,175,35,11,181,124,123,186,210,187,191,35,172,196,112,92,201,184,172,205,
+251,172,209,56,93,213,112,173,216,162,141,219,205,29,222,243,61,224,17,238,225,42,62,227,
+59,30,228,70,158,228,74,174,228,73,126,228,69,46,228,63,190,227,54,30,227,43,94,226,
+30,110,225,14,94,224,252,45,223,231,205,221,208,77,220,183,173,218,156,221,216,126,237,214,
+94,221,212,60,173,210,24,93,208,242,236,205,201,92,203,159,172,200,116,220,197,70,252,194,
+23,252,191,230,219,188,179,171,185,128,91,182,74,251,178,20,139,175,220,10,172,163,106,168,
+105,202,164,46,10,161,242,73,157,182,121,153,120,153,149,59,185,145,252,216,141,189,232,137,
+126,248,133,63,8,130,0,8,126,193,23,122,130,39,118,67,55,114,4,87,110,197,118,106,
+136,150,102,74,198,98,14,6,95,210,69,91,151,165,87,93,5,84,36,133,80,236,20,77,
+182,180,73,128,100,70,77,52,67,26,20,64,233,19,61,186,51,58,140,99,55,97,179,52,
+55,35,50,14,179,47,232,98,45,196,50,43,162,34,41,130,50,39,100,98,37,73,194,35,
+48,66,34,25,226,32,4,178,31,242,161,30,226,177,29,213,241,28,202,81,28,193,225,27,
+187,145,27,183,97,27,182,113,27,186,241,27,197,209,28,214,33,30,239,209,31,13,242,33,
+51,130,36,94,98,39,144,178,42,200,98,46,5,99,50,72,179,54,144,99,59,221,83,64,
+46,148,69,132,4,75,221,180,80,58,149,86,154,165,92,252,229,98,96,54,105,199,166,111,
+46,55,118,151,183,124,0,152,134,210,152,147,160,73,160,102,106,172,35,203,183,210,59,194,
+112,140,203,251,140,211,112,45,218,205,61,223,17,174,226,59,110,228,74,158,228,69,254,227,
+55,206,226,30,238,224,252,125,222,208,125,219,156,237,215,94,205,211,24,45,207,201,12,202,
+116,108,196,23,108,190,179,11,184,74,75,177,220,58,170,105,234,162,242,105,155,120,185,147,
+252,216,139,126,248,131,0,24,124,130,55,116,4,87,108,136,166,100,14,38,93,151,213,85,
+36,197,78,182,4,72,77,164,65,233,163,59,140,19,54,55,227,48,232,66,44,162,34,40,
+100,146,36,48,146,33,4,34,31,226,81,29,201,17,28,187,113,27,182,161,27,197,97,29,
+239,209,32,51,226,37,144,130,44,5,131,52,144,211,61,46,68,72,221,164,83,154,197,95,
+96,118,108,46,119,121,0,24,141,160,121,166,35,43,189,112,188,207,112,221,220,18,190,227,
+74,110,228,54,238,225,252,13,221,155,237,213,24,157,204,116,124,193,180,171,180,220,154,166,
+242,137,151,252,248,135,0,24,120,4,135,104,14,118,89,36,101,75,76,148,62,140,115,51,
+232,34,42,101,2,35,4,34,30,202,161,27,182,81,28,238,49,35,144,82,48,144,227,66,
+221,148,89,96,246,114,0,8,154,34,11,199,113,13,225,74,142,227,250,205,217,25,61,199,
+179,219,173,242,185,143,0,88,112,14,54,82,77,212,56,231,66,38,6,130,28,182,1,31,
+143,2,57,222,4,102,0,216,178,104,141,228,5,30,209,177,139,159,0,136,96,79,244,46,
+251,129,27,152,50,77,0,40,212,58,206,184,0,72,71,198,225,43,0,168,227,0,104,28,
+0,88,131,106,248,137,212,136,144,60,9,151,163,105,157,9,186,163,108,218,169,205,202,175,
+42,123,181,132,251,186,218,59,192,43,44,197,120,220,201,192,60,206,3,61,210,64,221,213,
+120,29,217,169,253,219,212,125,222,249,141,224,23,62,226,46,126,227,62,78,228,71,158,228,
+74,158,228,72,110,228,68,30,228,61,158,227,52,254,226,41,46,226,27,62,225,11,46,224,
+248,237,222,227,141,221,204,13,220,179,93,218,151,141,216,121,157,214,89,141,212,55,93,210,
+19,13,208,236,156,205,196,12,203,154,92,200,111,140,197,65,172,194,18,172,191,225,139,188,
+175,91,185,123,27,182,70,187,178,16,75,175,216,202,171,159,58,168,102,138,164,43,218,160,
+239,25,157,179,89,153,118,137,149,57,169,145,251,200,141,188,216,137,126,232,133,63,248,129,
+0,24,126,193,39,122,130,55,118,68,71,114,5,103,110,199,134,106,138,182,102,77,246,98,
+17,54,95,213,133,91,154,213,87,97,69,84,40,197,80,240,84,77,186,244,73,133,180,70,
+81,132,67,31,100,64,238,99,61,191,131,58,145,179,55,102,3,53,60,115,50,20,3,48,
+237,178,45,201,130,43,167,114,41,135,130,39,105,178,37,77,2,36,52,130,34,29,34,33,
+8,226,31,245,209,30,229,225,29,215,17,29,204,113,28,195,241,27,188,161,27,184,113,27,
+182,113,27,185,193,27,194,145,28,210,209,29,233,129,31,7,146,33,44,18,36,87,242,38,
+136,50,42,192,210,45,253,226,49,64,51,54,136,227,58,213,211,63,38,20,69,124,148,74,
+214,68,80,52,53,86,148,85,92,247,165,98,93,6,105,196,134,111,44,23,118,150,183,124,
+0,168,134,212,200,147,163,153,160,108,218,172,42,75,184,218,187,194,120,12,204,3,13,212,
+120,157,218,212,157,223,23,238,226,62,126,228,74,142,228,68,222,227,53,158,226,27,190,224,
+248,61,222,204,61,219,151,157,215,89,125,211,19,205,206,196,172,201,111,28,196,18,28,190,
+175,187,183,70,11,177,216,250,169,102,186,162,239,57,155,118,153,147,251,200,139,126,248,131,
+0,24,124,130,71,116,5,119,108,138,214,100,17,86,93,154,21,86,40,5,79,186,84,72,
+81,244,65,238,243,59,145,99,54,60,67,49,237,146,44,167,114,40,105,210,36,52,210,33,
+8,82,31,229,113,29,203,49,28,188,129,27,182,145,27,194,33,29,233,113,32,44,114,37,
+136,2,44,253,2,52,136,83,61,38,196,71,214,52,83,148,117,95,93,70,108,44,103,121,
+0,56,141,163,201,166,42,171,189,121,60,208,120,77,221,23,222,227,74,78,228,52,190,225,
+249,205,220,151,157,213,19,77,204,110,44,193,175,107,180,216,106,166,240,105,151,251,232,135,
+0,40,120,5,167,104,16,166,89,40,165,75,81,228,62,146,195,51,237,114,42,105,66,35,
+7,82,30,204,193,27,182,49,28,233,193,34,136,210,47,135,99,66,214,68,89,93,214,114,
+0,72,154,41,139,199,121,93,225,75,110,227,246,125,217,20,237,198,174,155,173,240,169,143,
+0,104,112,16,118,82,82,36,57,236,146,38,10,162,28,181,177,30,135,130,56,215,196,101,
+0,88,179,111,157,228,1,206,208,173,91,159,0,184,96,83,68,47,255,113,27,145,178,76,
+0,120,212,57,94,184,0,184,71,199,145,43,0,152,227,0,120,28,0,104,131,107,8,138,
+214,184,144,63,57,151,167,185,157,14,10,164,114,58,170,211,42,176,49,251,181,139,123,187,
+226,187,192,52,188,197,129,108,202,201,188,206,12,189,210,73,93,214,128,157,217,177,125,220,
+219,237,222,255,237,224,28,142,226,50,174,227,65,110,228,73,174,228,74,158,228,71,110,228,
+67,14,228,60,126,227,50,222,226,39,14,226,24,14,225,8,254,223,245,189,222,224,77,221,
+200,205,219,174,29,218,147,77,216,116,93,214,84,61,212,50,13,210,14,189,207,232,76,205,
+191,188,202,149,12,200,106,60,197,60,92,194,13,92,191,220,75,188,170,27,185,119,203,181,
+66,123,178,12,11,175,212,138,171,156,250,167,98,90,164,40,170,160,237,249,156,177,57,153,
+116,105,149,55,137,145,249,168,141,187,200,137,125,232,133,63,248,129,0,24,126,193,39,122,
+131,71,118,69,103,114,7,135,110,201,166,106,140,214,102,79,22,99,19,86,95,216,181,91,
+158,21,88,100,133,84,44,5,81,244,148,77,190,68,74,137,244,70,86,196,67,36,180,64,
+243,179,61,196,211,58,150,3,56,107,83,53,65,195,50,25,83,48,242,2,46,206,210,43,
+172,178,41,140,194,39,109,242,37,82,66,36,56,194,34,32,82,33,11,18,32,248,1,31,
+232,1,30,217,49,29,206,145,28,196,1,28,189,161,27,185,113,27,182,97,27,183,161,27,
+191,97,28,206,129,29,228,33,31,1,34,33,37,146,35,79,114,38,128,178,41,183,82,45,
+244,82,49,55,163,53,127,83,58,204,83,63,30,148,68,117,20,74,207,228,79,45,213,85,
+142,5,92,242,85,98,89,214,104,193,86,111,42,7,118,149,167,124,0,184,134,214,248,147,
+167,233,160,114,58,173,49,187,184,226,75,195,129,156,204,12,157,212,128,29,219,219,253,223,
+28,46,227,65,142,228,74,142,228,67,206,227,51,126,226,24,142,224,245,13,222,200,253,218,
+147,77,215,84,45,211,14,125,206,191,92,201,106,204,195,13,204,189,170,123,183,66,203,176,
+212,202,169,98,138,162,237,25,155,116,121,147,249,184,139,125,248,131,0,24,124,131,87,116,
+7,151,108,140,246,100,19,134,93,158,69,86,44,69,79,190,148,72,86,68,66,243,67,60,
+150,179,54,65,147,49,242,226,44,172,194,40,109,18,37,56,2,34,11,130,31,232,145,29,
+205,65,28,189,129,27,182,129,27,191,225,28,228,17,32,37,242,36,128,114,43,244,114,51,
+127,195,60,30,84,71,207,212,82,142,37,95,89,22,108,42,87,121,0,104,141,167,41,167,
+49,43,190,129,204,208,128,189,221,28,14,228,74,62,228,50,142,225,245,141,220,146,77,213,
+14,253,203,106,220,192,170,43,180,212,58,166,237,73,151,249,216,135,0,56,120,7,199,104,
+19,214,89,44,229,75,86,52,63,150,19,52,242,194,42,110,130,35,11,130,30,206,209,27,
+182,1,28,228,81,34,128,66,47,127,227,65,207,228,88,89,166,114,0,136,154,48,27,200,
+129,173,225,75,62,227,243,61,217,15,157,198,170,91,173,237,137,143,0,136,112,19,182,82,
+86,116,57,241,210,38,13,210,28,181,97,30,127,242,55,208,132,101,0,200,179,118,173,228,
+254,125,208,168,43,159,0,232,96,88,148,47,2,98,27,138,66,76,0,216,212,56,254,183,
+0,24,72,200,49,43,0,136,227,0,136,28,0,104,131,108,40,138,216,216,144,66,121,151,
+171,249,157,19,90,164,119,154,170,217,154,176,56,107,182,147,251,187,234,75,193,60,76,198,
+138,236,202,210,76,207,20,77,211,81,221,214,136,29,218,184,237,220,226,77,223,4,62,225,
+32,206,226,53,222,227,67,126,228,73,174,228,73,142,228,71,78,228,65,238,227,58,94,227,
+48,174,226,36,222,225,21,222,224,4,190,223,241,125,222,220,13,221,196,125,219,170,205,217,
+142,253,215,112,13,214,79,237,211,45,189,209,9,109,207,226,236,204,186,92,202,144,188,199,
+101,236,196,55,12,194,8,12,191,216,251,187,166,203,184,114,139,181,62,59,178,8,203,174,
+208,90,171,152,202,167,95,42,164,37,138,160,234,201,156,174,9,153,114,73,149,53,121,145,
+248,152,141,186,184,137,124,216,133,62,248,129,0,24,126,194,55,122,132,87,118,70,119,114,
+8,151,110,203,198,106,142,6,103,82,70,99,22,134,95,219,229,91,161,69,88,104,181,84,
+48,69,81,248,212,77,194,132,74,142,68,71,90,20,68,40,4,65,248,3,62,201,35,59,
+155,83,56,112,179,53,70,35,51,30,163,48,247,82,46,211,34,44,177,2,42,144,18,40,
+114,66,38,86,146,36,60,2,35,36,146,33,15,82,32,252,49,31,235,49,30,220,97,29,
+208,177,28,198,33,28,191,193,27,185,129,27,183,97,27,183,145,27,189,49,28,203,65,29,
+224,209,30,252,193,32,30,34,35,72,242,37,120,50,41,175,194,44,236,194,48,46,35,53,
+118,195,57,196,195,62,22,20,68,109,164,73,200,116,79,39,117,85,137,181,91,237,21,98,
+85,150,104,190,54,111,40,231,117,148,167,124,0,200,134,216,40,148,171,57,161,119,154,173,
+56,59,185,234,203,195,138,44,205,20,29,213,136,141,219,226,77,224,32,94,227,67,158,228,
+73,126,228,65,174,227,48,78,226,21,78,224,241,205,221,196,173,218,142,13,215,79,221,210,
+9,45,206,186,12,201,101,124,195,8,140,189,166,43,183,62,139,176,208,138,169,95,90,162,
+234,233,154,114,89,147,248,168,139,124,232,131,0,40,124,132,103,116,8,183,108,142,38,101,
+22,182,93,161,133,86,48,133,79,194,228,72,90,132,66,248,147,60,155,3,55,70,227,49,
+247,50,45,177,2,41,114,98,37,60,66,34,15,194,31,235,193,29,208,97,28,191,145,27,
+183,113,27,189,177,28,224,193,31,30,130,36,120,242,42,236,226,50,118,67,60,22,212,70,
+200,116,82,137,213,94,85,230,107,40,71,121,0,136,141,171,121,167,56,171,190,138,76,209,
+136,45,222,33,46,228,74,46,228,48,94,225,241,77,220,142,253,212,9,173,203,100,140,192,
+166,219,179,208,250,165,234,41,151,248,216,135,0,56,120,8,231,104,22,22,90,48,53,76,
+90,132,63,156,99,52,247,18,43,114,194,35,15,178,30,208,225,27,182,225,27,223,225,33,
+120,194,46,118,99,65,200,148,88,85,134,114,0,184,154,55,171,200,137,237,225,76,30,227,
+239,237,216,10,77,198,165,43,173,234,121,143,0,152,112,22,230,82,91,196,57,246,34,39,
+17,242,28,180,33,30,119,98,55,201,84,101,0,72,180,125,189,228,249,45,208,164,251,158,
+0,24,97,92,228,47,7,82,27,131,194,75,0,40,213,55,142,183,0,136,72,201,225,42,
+0,120,227,0,152,28,0,120,131,109,56,138,218,8,145,69,185,151,175,73,158,24,186,164,
+125,250,170,224,10,177,63,235,182,155,123,188,242,203,193,69,204,198,146,124,203,219,220,207,
+29,205,211,90,109,215,144,141,218,191,93,221,232,173,223,10,158,225,37,14,227,57,14,228,
+69,142,228,74,174,228,73,142,228,70,62,228,64,206,227,56,62,227,46,142,226,33,174,225,
+18,174,224,1,142,223,238,61,222,216,205,220,192,61,219,166,141,217,137,173,215,107,189,213,
+74,173,211,40,109,209,4,29,207,221,156,204,181,12,202,139,108,199,96,156,196,50,188,193,
+3,188,190,211,171,187,161,139,184,110,75,181,57,251,177,4,139,174,205,26,171,149,154,167,
+92,250,163,34,90,160,231,169,156,172,233,152,112,41,149,52,89,145,247,136,141,185,184,137,
+124,216,133,62,248,129,0,24,126,194,55,122,132,87,118,71,135,114,9,183,110,204,230,106,
+144,38,103,84,102,99,25,182,95,222,21,92,164,133,88,107,245,84,51,133,81,252,20,78,
+199,196,74,146,132,71,95,100,68,45,84,65,253,83,62,206,115,59,160,163,56,117,3,54,
+75,115,51,35,243,48,252,162,46,216,98,44,182,82,42,149,98,40,119,130,38,90,210,36,
+64,66,35,40,210,33,18,130,32,255,97,31,238,97,30,223,129,29,210,209,28,200,65,28,
+192,209,27,186,129,27,183,97,27,182,129,27,187,1,28,199,1,29,219,113,30,246,97,32,
+24,178,34,65,130,37,112,178,40,166,66,44,227,50,48,37,147,52,110,67,57,187,67,62,
+14,148,67,101,36,73,193,4,79,32,21,85,131,85,91,232,197,97,81,86,104,187,6,111,
+38,215,117,147,151,124,0,216,134,218,88,148,175,137,161,125,10,174,63,187,185,242,91,196,
+146,188,205,29,173,213,144,253,219,232,173,224,37,158,227,69,174,228,73,110,228,64,142,227,
+46,30,226,18,30,224,238,141,221,192,109,218,137,189,214,74,141,210,4,221,205,181,188,200,
+96,44,195,3,60,189,161,235,182,57,75,176,205,90,169,92,42,162,231,201,154,112,73,147,
+247,152,139,124,232,131,0,40,124,132,119,116,9,199,108,144,70,101,25,230,93,164,181,86,
+51,197,79,199,36,73,95,212,66,253,227,60,160,83,55,75,51,50,252,130,45,182,82,41,
+119,162,37,64,130,34,18,242,31,238,241,29,210,129,28,192,161,27,183,97,27,187,113,28,
+219,97,31,24,18,36,112,98,42,227,82,50,110,179,59,14,84,70,193,4,82,131,133,94,
+81,182,107,38,55,121,0,168,141,175,217,167,63,43,191,146,220,209,144,157,222,37,78,228,
+74,14,228,45,62,225,238,13,220,137,189,212,4,93,203,96,76,192,161,155,179,205,202,165,
+232,9,151,247,200,135,0,72,120,9,7,105,24,70,90,51,117,76,95,196,63,160,179,52,
+252,82,43,119,2,36,18,210,30,211,1,28,182,193,27,219,113,33,112,50,46,110,227,64,
+193,52,88,81,102,114,0,248,154,63,59,201,145,45,226,76,238,226,235,173,216,5,253,197,
+160,235,172,232,89,143,0,184,112,24,38,83,96,20,58,251,98,39,21,34,29,180,225,29,
+111,210,54,193,20,101,0,200,180,132,205,228,245,221,207,160,219,158,0,56,97,96,52,48,
+11,66,27,124,66,75,0,120,213,54,46,183,0,232,72,202,145,42,0,104,227,0,168,28,
+0,120,131,110,88,138,220,40,145,72,233,151,180,137,158,29,10,165,131,90,171,231,122,177,
+71,91,183,163,251,188,251,91,194,78,92,199,155,12,204,228,92,208,38,93,212,98,237,215,
+152,13,219,199,205,221,239,13,224,16,238,225,42,78,227,60,46,228,71,158,228,74,158,228,
+72,126,228,69,46,228,63,190,227,54,30,227,44,94,226,31,126,225,15,126,224,254,77,223,
+234,253,221,212,141,220,188,253,218,161,61,217,133,109,215,102,109,213,70,93,211,35,29,209,
+255,204,206,216,92,204,176,204,201,134,28,199,91,76,196,46,108,193,255,123,190,206,107,187,
+157,59,184,106,11,181,53,187,177,0,91,174,201,218,170,145,90,167,89,202,163,31,42,160,
+229,121,156,170,201,152,110,9,149,50,73,145,245,120,141,184,168,137,123,200,133,62,248,129,
+0,24,126,194,71,122,133,103,118,72,151,114,11,199,110,206,6,107,146,70,103,86,150,99,
+27,230,95,225,69,92,167,181,88,111,53,85,55,181,81,0,85,78,203,4,75,150,212,71,
+99,164,68,50,148,65,1,164,62,210,195,59,165,243,56,122,67,54,80,179,51,40,67,49,
+1,243,46,221,178,44,186,162,42,154,162,40,123,210,38,95,18,37,68,130,35,44,18,34,
+22,194,32,2,146,31,241,145,30,225,177,29,212,241,28,202,81,28,193,225,27,187,145,27,
+184,113,27,182,113,27,185,225,27,196,193,28,214,33,30,240,1,32,17,66,34,57,2,37,
+104,34,40,158,178,43,218,178,47,28,3,52,101,179,56,178,179,61,5,20,67,93,180,72,
+185,148,78,25,181,84,125,5,91,227,133,97,76,38,104,183,230,110,36,183,117,146,151,124,
+0,232,134,220,136,148,180,217,161,131,122,174,71,59,186,251,219,196,155,76,206,38,45,214,
+152,125,220,239,13,225,42,206,227,70,174,228,73,94,228,63,110,227,44,254,225,15,238,223,
+234,77,221,188,29,218,133,109,214,70,61,210,255,140,205,176,108,200,91,236,194,255,235,188,
+157,171,182,53,11,176,201,26,169,89,250,161,229,169,154,110,41,147,245,136,139,123,232,131,
+0,40,124,133,135,116,11,231,108,146,102,101,27,22,94,167,245,86,55,5,80,203,100,73,
+99,36,67,1,36,61,165,163,55,80,131,50,1,211,45,186,162,41,123,242,37,68,194,34,
+22,34,32,241,17,30,212,161,28,193,177,27,183,97,27,186,65,28,214,1,31,17,146,35,
+104,226,41,218,194,49,101,51,59,5,212,69,185,148,81,125,53,94,76,134,107,36,39,121,
+0,200,141,180,57,168,71,187,191,155,108,210,152,253,222,41,110,228,74,254,227,43,14,225,
+234,189,219,133,109,212,255,12,203,91,252,191,157,91,179,201,154,165,229,233,150,245,184,135,
+0,88,120,11,39,105,27,118,90,55,181,76,99,20,64,165,3,53,1,163,43,123,82,36,
+22,2,31,213,17,28,182,161,27,215,17,33,104,162,45,101,83,64,185,212,87,76,70,114,
+0,56,155,70,203,201,153,109,226,76,206,226,232,109,216,0,173,197,156,171,172,229,73,143,
+0,200,112,27,102,83,100,100,58,0,163,39,24,66,29,180,161,29,103,66,54,186,212,100,
+0,56,181,140,205,228,241,141,207,155,171,158,0,104,97,101,132,48,15,66,27,116,210,74,
+0,200,213,53,190,182,0,88,73,203,65,42,0,88,227,0,184,28,0,136,131,111,120,138,
+222,88,145,76,41,152,184,217,158,34,106,165,137,202,171,238,234,177,78,219,183,171,139,189,
+3,220,194,86,236,199,164,156,204,236,236,208,47,221,212,106,109,216,160,141,219,206,61,222,
+245,109,224,21,46,226,46,126,227,63,78,228,72,174,228,74,158,228,72,110,228,68,30,228,
+61,158,227,52,254,226,41,62,226,28,78,225,12,62,224,250,13,223,230,189,221,208,77,220,
+183,173,218,157,253,216,128,29,215,97,29,213,65,13,211,30,205,208,250,124,206,211,252,203,
+171,124,201,129,204,198,86,252,195,41,44,193,250,43,190,202,27,187,152,251,183,101,187,180,
+49,123,177,252,26,174,197,170,170,142,42,167,86,154,163,28,250,159,226,89,156,168,169,152,
+108,233,148,48,41,145,244,104,141,183,152,137,122,200,133,61,248,129,0,24,126,195,71,122,
+134,119,118,73,167,114,12,231,110,208,38,107,148,102,103,88,182,99,30,22,96,228,117,92,
+170,229,88,114,101,85,59,245,81,4,149,78,207,84,75,155,20,72,104,244,68,54,228,65,
+6,228,62,215,19,60,170,67,57,127,163,54,85,19,52,45,147,49,6,67,47,226,2,45,
+191,242,42,159,242,40,128,18,39,99,98,37,73,194,35,48,82,34,26,2,33,6,210,31,
+244,193,30,228,209,29,215,17,29,204,113,28,195,241,27,188,161,27,184,113,27,182,113,27,
+184,193,27,193,145,28,210,225,29,235,161,31,11,210,33,50,130,36,96,162,39,150,50,43,
+209,34,47,20,115,51,92,35,56,170,51,61,253,131,66,85,52,72,178,36,78,18,69,84,
+119,165,90,222,53,97,72,230,103,180,182,110,34,151,117,145,135,124,0,248,134,222,200,148,
+184,41,162,137,218,174,78,187,186,3,108,197,164,204,206,47,173,214,160,237,220,245,93,225,
+46,254,227,72,174,228,72,62,228,61,78,227,41,206,225,12,174,223,230,13,221,183,221,217,
+128,29,214,65,237,209,250,60,205,171,28,200,86,156,194,250,171,188,152,91,182,49,203,175,
+197,234,168,86,202,161,226,137,154,108,9,147,244,120,139,122,216,131,0,56,124,134,151,116,
+12,7,109,148,134,101,30,70,94,170,37,87,59,69,80,207,180,73,104,100,67,6,116,61,
+170,243,55,85,211,50,6,35,46,191,242,41,128,50,38,73,2,35,26,98,32,244,65,30,
+215,193,28,195,209,27,184,97,27,184,17,28,210,177,30,11,34,35,96,98,41,209,66,49,
+92,163,58,253,83,69,178,52,81,119,229,93,72,70,107,34,23,121,0,232,141,184,153,168,
+78,59,192,164,236,210,160,109,223,45,126,228,73,222,227,41,206,224,230,125,219,128,29,212,
+250,188,202,86,172,191,152,27,179,197,106,165,226,201,150,244,168,135,0,104,120,12,71,105,
+30,166,90,59,245,76,104,100,64,170,83,53,6,243,43,128,146,36,26,66,31,215,49,28,
+183,145,27,211,161,32,96,34,45,92,211,63,178,116,87,72,38,114,0,120,155,78,91,202,
+160,173,226,76,158,226,228,29,216,251,92,197,151,123,172,227,57,143,0,216,112,29,150,83,
+105,180,58,5,243,39,28,114,29,180,97,29,96,178,53,178,148,100,0,184,181,147,221,228,
+237,61,207,151,123,158,0,152,97,105,212,48,19,50,27,109,82,74,0,24,214,52,94,182,
+0,184,73,204,241,41,0,72,227,0,200,28,0,136,131,112,136,138,224,136,145,79,105,152,
+188,41,159,39,202,165,143,42,172,245,106,178,86,91,184,179,11,190,12,108,195,95,124,200,
+173,44,205,246,124,209,56,109,213,115,237,216,168,253,219,213,157,222,252,205,224,27,126,226,
+50,174,227,65,110,228,73,174,228,74,158,228,71,94,228,66,254,227,60,126,227,50,222,226,
+39,14,226,25,30,225,9,14,224,247,221,222,226,125,221,204,13,220,179,109,218,152,173,216,
+124,221,214,93,221,212,60,189,210,25,125,208,245,44,206,206,188,203,166,44,201,124,124,198,
+81,188,195,36,220,192,245,235,189,197,219,186,148,187,183,97,123,180,45,59,177,248,218,173,
+194,106,170,139,250,166,83,106,163,26,218,159,224,57,156,165,137,152,106,201,148,47,25,145,
+243,72,141,182,136,137,122,184,133,61,232,129,0,40,126,195,87,122,134,135,118,74,199,114,
+13,247,110,209,54,107,150,134,103,91,214,99,32,54,96,230,165,92,173,21,89,117,165,85,
+62,53,82,8,213,78,211,148,75,159,84,72,108,52,69,59,36,66,11,52,63,220,83,60,
+175,147,57,131,227,54,90,83,52,50,227,49,11,147,47,231,82,45,196,50,43,163,50,41,
+132,98,39,103,162,37,77,2,36,52,146,34,30,50,33,9,2,32,247,241,30,231,1,30,
+217,49,29,206,145,28,196,17,28,189,177,27,185,113,27,182,97,27,183,161,27,191,97,28,
+206,145,29,229,65,31,4,114,33,43,18,36,88,34,39,141,162,42,200,146,46,10,227,50,
+83,147,55,161,163,60,244,3,66,77,180,71,170,164,77,11,229,83,113,69,90,217,229,96,
+68,166,103,177,134,110,32,135,117,144,135,124,0,8,135,224,248,148,188,121,162,143,74,175,
+86,59,187,12,252,197,173,108,207,56,61,215,168,93,221,252,189,225,50,30,228,73,174,228,
+71,46,228,60,46,227,39,158,225,9,126,223,226,205,220,179,157,217,124,221,213,60,157,209,
+245,236,204,166,220,199,81,76,194,245,91,188,148,27,182,45,139,175,194,186,168,83,170,161,
+224,89,154,106,249,146,243,104,139,122,216,131,0,56,124,134,167,116,13,23,109,150,182,101,
+32,102,94,173,85,87,62,133,80,211,244,73,108,180,67,11,196,61,175,51,56,90,35,51,
+11,115,46,196,50,42,132,114,38,77,66,35,30,146,32,247,113,30,217,225,28,196,225,27,
+185,97,27,183,241,27,206,81,30,4,178,34,88,210,40,200,162,48,83,19,58,244,211,68,
+170,196,80,113,149,93,68,22,107,32,7,121,0,8,142,188,249,168,86,203,192,173,124,211,
+168,205,223,49,142,228,72,190,227,38,158,224,227,61,219,124,205,211,245,108,202,81,108,191,
+148,219,178,194,58,165,224,169,150,243,168,135,0,104,120,13,103,105,32,214,90,62,53,77,
+108,164,64,175,163,53,11,67,44,132,210,36,29,114,31,218,81,28,184,129,27,207,65,32,
+88,146,44,83,67,63,170,20,87,68,6,114,0,184,155,86,251,202,168,237,226,75,126,226,
+224,221,215,246,12,197,147,59,172,224,25,143,0,248,112,32,214,83,109,4,59,10,51,40,
+32,146,29,181,33,29,88,18,53,170,84,100,0,56,182,154,221,228,233,237,206,147,75,158,
+0,200,97,109,36,49,23,50,27,102,210,73,0,104,214,51,254,181,0,24,74,205,161,41,
+0,56,227,0,216,28,0,152,131,114,168,138,227,184,145,82,169,152,193,121,159,45,26,166,
+150,154,172,252,218,178,94,219,184,187,155,190,20,252,195,104,12,201,182,188,205,255,12,210,
+64,253,213,124,109,217,176,125,220,220,13,223,2,46,225,32,206,226,53,222,227,68,142,228,
+73,174,228,73,142,228,70,78,228,65,238,227,58,94,227,48,174,226,36,222,225,22,238,224,
+6,222,223,243,157,222,223,77,221,200,205,219,175,45,218,148,109,216,119,141,214,88,141,212,
+55,109,210,21,45,208,240,220,205,202,108,203,161,220,200,120,44,198,76,108,195,31,140,192,
+241,155,189,193,139,186,144,107,183,93,59,180,41,251,176,244,154,173,190,58,170,135,186,166,
+79,58,163,23,170,159,221,9,156,163,105,152,104,185,148,45,249,144,241,56,141,181,120,137,
+121,184,133,61,232,129,0,40,126,195,87,122,135,151,118,75,215,114,15,23,111,211,86,107,
+152,166,103,93,6,100,35,102,96,233,213,92,177,85,89,121,213,85,66,117,82,12,21,79,
+215,212,75,163,164,72,112,132,69,63,116,66,15,132,63,225,163,60,180,227,57,136,51,55,
+95,163,52,54,51,50,16,227,47,235,162,45,201,130,43,168,130,41,137,162,39,108,226,37,
+81,66,36,56,194,34,33,114,33,13,50,32,250,33,31,234,49,30,220,97,29,208,177,28,
+198,33,28,191,193,27,186,129,27,183,97,27,183,129,27,188,33,28,203,65,29,224,225,30,
+254,1,33,36,146,35,80,162,38,132,18,42,192,2,46,1,83,50,74,3,55,152,19,60,
+236,115,65,69,52,71,162,52,77,4,117,83,106,245,89,211,149,96,63,102,103,174,86,110,
+29,103,117,142,119,124,0,40,135,227,40,149,193,217,162,150,202,175,94,187,187,20,140,198,
+182,252,207,64,189,215,176,221,221,2,14,226,54,62,228,73,158,228,70,30,228,58,14,227,
+36,110,225,6,62,223,223,141,220,175,77,217,119,141,213,55,93,209,240,172,204,161,140,199,
+76,252,193,241,27,188,144,219,181,41,75,175,190,122,168,79,122,161,221,57,154,104,217,146,
+241,88,139,121,216,131,0,56,124,135,183,116,15,55,109,152,214,101,35,150,94,177,149,87,
+66,197,80,215,52,74,112,244,67,15,20,62,180,131,56,95,99,51,16,179,46,201,130,42,
+137,194,38,81,130,35,33,210,32,250,161,30,220,1,29,198,241,27,186,113,27,183,209,27,
+202,1,30,254,49,34,80,82,40,192,18,48,74,131,57,236,83,68,162,68,80,106,53,93,
+63,230,106,29,231,120,0,56,142,193,89,169,94,91,193,182,12,212,176,61,224,53,158,228,
+71,158,227,36,110,224,223,253,218,119,141,211,240,28,202,76,28,191,144,155,178,190,10,165,
+221,137,150,241,152,135,0,120,120,15,135,105,35,6,91,66,117,77,112,244,64,180,243,53,
+16,131,44,137,18,37,33,162,31,220,113,28,185,113,27,203,209,31,80,2,44,74,179,62,
+162,180,86,63,214,113,0,8,156,93,139,203,176,45,227,75,78,226,220,141,215,241,188,196,
+143,11,172,222,9,143,0,8,113,34,6,84,113,84,59,15,131,40,36,194,29,181,225,28,
+80,130,52,163,4,100,0,184,182,161,221,228,228,157,206,143,27,158,0,248,97,113,116,49,
+28,50,27,95,82,73,0,184,214,50,142,181,0,136,74,206,81,41,0,40,227,0,232,28,
+0,152,131,115,200,138,229,232,145,86,233,152,197,201,159,50,122,166,156,10,173,3,91,179,
+101,91,185,196,27,191,29,140,196,113,156,201,192,76,206,8,157,210,73,141,214,132,253,217,
+183,237,220,228,125,223,8,126,225,36,14,227,57,14,228,69,158,228,74,174,228,73,126,228,
+69,62,228,64,206,227,56,62,227,46,142,226,34,190,225,19,190,224,3,158,223,240,109,222,
+219,13,221,196,141,219,171,221,217,144,29,216,115,61,214,83,61,212,50,29,210,16,237,207,
+235,140,205,197,28,203,156,140,200,115,220,197,71,28,195,26,60,192,236,75,189,188,75,186,
+139,43,183,89,251,179,37,187,176,241,106,173,187,10,170,132,138,166,76,10,163,20,122,159,
+219,233,155,161,73,152,102,153,148,43,233,144,240,40,141,180,104,137,120,168,133,60,232,129,
+0,40,126,196,103,122,136,167,118,76,231,114,16,39,111,213,118,107,154,198,103,95,38,100,
+37,150,96,236,5,93,180,133,89,124,5,86,69,165,82,15,85,79,219,20,76,167,228,72,
+117,196,69,68,196,66,20,212,63,230,243,60,185,51,58,141,131,55,100,243,52,59,131,50,
+21,35,48,240,242,45,206,210,43,173,210,41,141,242,39,112,50,38,85,130,36,60,2,35,
+37,162,33,16,114,32,253,81,31,237,81,30,222,129,29,210,209,28,200,65,28,192,209,27,
+187,145,27,183,97,27,182,113,27,187,1,28,199,1,29,220,145,30,248,145,32,28,34,35,
+73,18,38,124,130,41,183,114,45,248,194,49,64,115,54,143,131,59,227,243,64,60,180,70,
+154,180,76,253,4,83,100,149,89,206,69,96,59,38,103,170,38,110,27,71,117,141,119,124,
+0,56,135,229,104,149,197,41,163,156,58,176,102,75,188,29,28,199,192,140,208,73,77,216,
+184,77,222,8,94,226,57,94,228,74,158,228,69,14,228,56,238,226,34,62,225,3,14,223,
+219,77,220,171,13,217,114,61,213,51,13,209,235,92,204,157,60,199,71,172,193,236,203,187,
+139,155,181,37,27,175,187,74,168,76,74,161,219,25,154,102,185,146,240,72,139,120,200,131,
+0,72,124,136,199,116,16,87,109,154,246,101,37,198,94,180,197,87,69,245,80,219,116,74,
+117,68,68,20,100,62,185,211,56,99,179,51,21,3,47,205,210,42,142,2,39,85,194,35,
+37,2,33,253,209,30,222,33,29,200,1,28,187,113,27,182,177,27,199,177,29,248,193,33,
+72,194,39,183,130,47,64,243,56,227,195,67,154,212,79,100,229,92,59,166,106,27,215,120,
+0,88,142,197,201,169,102,235,193,192,156,212,184,157,224,56,174,228,70,126,227,33,62,224,
+219,173,218,114,61,211,235,204,201,71,204,190,139,91,178,187,202,164,219,105,150,240,136,135,
+0,136,120,16,167,105,37,54,91,69,181,77,117,68,65,185,67,54,21,211,44,142,98,37,
+37,210,31,223,145,28,186,97,27,200,113,31,72,114,43,64,35,62,154,68,86,59,182,113,
+0,72,156,101,43,204,183,93,227,74,30,226,216,77,215,236,108,196,138,203,171,219,249,142,
+0,24,113,37,70,84,118,164,59,20,195,40,40,242,29,182,177,28,73,226,51,155,196,99,
+0,72,183,168,237,228,224,93,206,139,235,157,0,40,98,117,180,49,32,34,27,88,194,72,
+0,248,214,49,46,181,0,232,74,207,17,41,0,24,227,0,248,28,0,168,131,116,232,138,
+231,8,146,89,41,153,202,25,160,56,234,166,163,122,173,10,203,179,110,235,185,205,171,191,
+38,28,197,123,60,202,201,236,206,17,61,211,82,13,215,141,125,218,191,109,221,235,221,223,
+14,222,225,41,78,227,60,62,228,71,158,228,74,158,228,72,126,228,68,46,228,62,190,227,
+54,30,227,44,110,226,31,142,225,16,142,224,255,109,223,236,45,222,215,205,220,192,77,219,
+167,157,217,139,221,215,110,253,213,79,253,211,46,221,209,11,157,207,230,60,205,192,204,202,
+152,60,200,110,156,197,67,204,194,22,252,191,232,11,189,184,11,186,135,235,182,85,187,179,
+33,123,176,237,42,173,183,202,169,129,90,166,73,218,162,17,90,159,216,201,155,159,41,152,
+101,121,148,42,201,144,239,24,141,179,104,137,120,168,133,60,232,129,0,40,126,196,103,122,
+136,167,118,77,247,114,17,71,111,214,150,107,155,230,103,97,70,100,40,182,96,239,53,93,
+183,181,89,127,69,86,73,229,82,19,149,79,223,84,76,171,36,73,121,4,70,72,4,67,
+24,20,64,234,67,61,189,115,58,146,211,55,104,67,53,64,211,50,26,115,48,245,50,46,
+210,18,44,177,18,42,146,50,40,117,114,38,89,194,36,64,66,35,41,226,33,20,162,32,
+1,130,31,240,129,30,225,161,29,212,241,28,202,81,28,194,225,27,187,145,27,184,113,27,
+182,113,27,185,209,27,196,193,28,215,49,30,242,49,32,21,162,34,65,146,37,115,2,41,
+174,210,44,239,34,49,55,211,53,133,243,58,218,99,64,51,36,70,146,68,76,246,148,82,
+93,37,89,200,245,95,54,230,102,167,6,110,25,39,117,140,103,124,0,72,135,231,152,149,
+202,137,163,163,170,176,110,219,188,38,188,199,201,28,209,82,221,216,192,189,222,14,158,226,
+61,126,228,74,142,228,68,238,227,54,206,226,31,14,225,255,205,222,215,13,220,167,189,216,
+110,253,212,46,189,208,230,12,204,152,236,198,67,108,193,232,139,187,135,91,181,33,219,174,
+183,26,168,73,26,161,216,249,153,101,169,146,239,56,139,120,200,131,0,72,124,136,215,116,
+17,103,109,155,22,102,40,246,94,183,245,87,73,53,81,223,180,74,121,132,68,24,164,62,
+189,35,57,104,3,52,26,83,47,210,18,43,146,82,39,89,2,36,41,66,33,1,2,31,
+225,65,29,202,33,28,188,129,27,182,145,27,195,113,29,242,81,33,64,50,39,174,242,46,
+55,83,56,218,51,67,146,100,79,93,133,92,54,118,106,25,199,120,0,136,142,202,41,170,
+110,123,194,201,44,213,192,253,224,59,174,228,69,110,227,31,14,224,215,109,218,110,237,210,
+230,140,201,67,140,190,135,27,178,183,170,164,216,73,150,239,136,135,0,136,120,17,199,105,
+40,102,91,73,245,77,121,132,65,189,131,54,26,35,45,146,162,37,41,2,32,225,161,28,
+187,97,27,197,17,31,64,226,42,55,147,61,146,228,85,54,134,113,0,136,156,110,187,204,
+191,141,227,74,238,225,213,13,215,232,28,196,134,155,171,217,217,142,0,56,113,39,118,84,
+122,244,59,24,3,41,43,34,30,182,129,28,65,82,51,146,132,99,0,200,183,176,237,228,
+220,13,206,135,203,157,0,72,98,121,4,50,36,34,27,80,66,72,0,72,215,48,190,180,
+0,88,75,208,193,40,0,8,227,0,8,29,0,184,131,117,248,138,234,56,146,93,105,153,
+206,105,160,61,74,167,169,234,173,18,75,180,118,107,186,213,59,192,47,172,197,132,204,202,
+210,124,207,26,205,211,91,157,215,149,253,218,199,221,221,241,77,224,20,46,226,46,126,227,
+63,94,228,72,174,228,74,158,228,71,110,228,67,14,228,61,158,227,52,254,226,41,62,226,
+28,94,225,13,94,224,252,61,223,233,237,221,211,141,220,188,253,218,162,93,217,135,141,215,
+105,173,213,74,173,211,41,141,209,6,77,207,225,236,204,187,124,202,147,236,199,105,76,197,
+62,140,194,17,172,191,227,187,188,180,187,185,131,171,182,81,123,179,29,59,176,233,250,172,
+180,154,169,126,42,166,70,186,162,14,42,159,214,153,155,156,9,152,99,89,148,40,185,144,
+237,8,141,178,88,137,119,152,133,60,232,129,0,40,126,196,119,122,137,183,118,78,7,115,
+19,87,111,216,182,107,157,6,104,100,118,100,42,230,96,242,85,93,186,229,89,130,117,86,
+76,21,83,23,213,79,227,148,76,175,100,73,125,84,70,77,84,67,29,100,64,239,131,61,
+194,195,58,151,35,56,109,147,53,69,35,51,31,195,48,250,130,46,215,98,44,182,98,42,
+151,130,40,121,178,38,94,18,37,68,130,35,45,34,34,23,210,32,4,178,31,243,177,30,
+228,209,29,215,17,29,204,113,28,195,1,28,189,161,27,185,113,27,182,97,27,184,177,27,
+193,145,28,210,225,29,236,193,31,15,50,34,57,18,37,107,114,40,165,66,44,230,146,48,
+46,67,53,124,99,58,209,211,63,43,164,69,138,196,75,238,36,82,87,197,88,195,165,95,
+50,166,102,163,214,109,22,23,117,139,87,124,0,88,135,234,216,149,206,217,163,169,42,177,
+118,91,189,47,76,200,210,172,209,91,93,217,199,29,223,20,238,226,63,142,228,74,126,228,
+67,222,227,52,158,226,28,222,224,252,157,222,211,205,219,162,125,216,105,173,212,41,109,208,
+225,188,203,147,156,198,62,28,193,227,59,187,131,27,181,29,155,174,180,234,167,70,234,160,
+214,217,153,99,137,146,237,40,139,119,200,131,0,72,124,137,231,116,19,135,109,157,54,102,
+42,38,95,186,37,88,76,117,81,227,244,74,125,212,68,29,244,62,194,115,57,109,83,52,
+31,163,47,215,98,43,151,146,39,94,66,36,45,114,33,4,50,31,228,113,29,204,49,28,
+189,145,27,182,129,27,193,33,29,236,241,32,57,178,38,165,98,46,46,195,55,209,179,66,
+138,228,78,87,53,92,50,54,106,22,183,120,0,168,142,206,153,170,118,11,195,210,188,213,
+200,77,225,62,174,228,68,78,227,28,206,223,211,45,218,105,157,210,225,60,201,62,60,190,
+131,219,177,180,106,164,214,57,150,237,120,135,0,152,120,19,215,105,42,166,91,76,53,78,
+125,212,65,194,211,54,31,115,45,151,226,37,45,66,32,228,193,28,188,97,27,194,193,30,
+56,82,42,46,3,61,138,116,85,50,102,113,0,216,156,118,91,205,198,189,227,72,190,225,
+209,189,214,227,204,195,130,91,171,214,201,142,0,72,113,42,182,84,126,68,60,29,83,41,
+47,82,30,184,81,28,58,178,50,138,52,99,0,72,184,183,221,228,215,205,205,131,155,157,
+0,120,98,125,68,50,41,50,27,73,194,71,0,152,215,46,94,180,0,184,75,210,113,40,
+0,232,226,0,40,29,0,184,131,118,24,139,236,120,146,97,169,153,211,185,160,67,170,167,
+176,90,174,25,203,180,126,251,186,222,203,192,57,76,198,141,108,203,220,28,208,36,93,212,
+100,45,216,158,125,219,207,93,222,248,173,224,25,126,226,50,190,227,66,126,228,73,174,228,
+73,142,228,71,94,228,66,254,227,59,126,227,50,222,226,39,30,226,26,46,225,10,46,224,
+249,253,222,229,173,221,207,77,220,184,189,218,158,13,217,130,77,215,101,93,213,70,93,211,
+36,61,209,1,253,206,221,172,204,182,44,202,142,156,199,100,252,196,57,60,194,13,108,191,
+223,123,188,175,123,185,126,107,182,77,59,179,26,11,176,229,186,172,176,90,169,122,250,165,
+67,138,162,12,10,159,211,121,155,154,233,151,97,73,148,39,169,144,236,248,140,177,72,137,
+118,152,133,59,232,129,0,40,126,197,119,122,138,199,118,79,23,115,20,103,111,217,198,107,
+159,38,104,102,150,100,45,6,97,244,133,93,189,21,90,134,181,86,80,85,83,27,5,80,
+230,212,76,179,164,73,130,148,70,81,148,67,33,164,64,243,211,61,199,19,59,156,115,56,
+114,227,53,74,99,51,35,19,49,255,210,46,220,178,44,186,178,42,155,194,40,126,2,39,
+98,82,37,72,194,35,49,98,34,27,18,33,7,226,31,246,225,30,230,241,29,217,49,29,
+206,145,28,197,17,28,190,177,27,185,129,27,183,97,27,183,145,27,190,81,28,206,145,29,
+231,97,31,8,178,33,49,146,36,98,226,39,156,178,43,220,242,47,36,163,52,115,195,57,
+199,67,63,34,20,69,130,68,75,231,180,81,80,101,88,189,85,95,45,102,102,159,150,109,
+20,247,116,138,87,124,0,104,135,236,24,150,211,57,164,176,154,177,126,235,189,57,236,200,
+220,76,210,100,237,217,207,141,223,25,46,227,66,158,228,74,126,228,66,190,227,50,126,226,
+26,174,224,249,93,222,207,141,219,158,45,216,101,109,212,36,29,208,221,108,203,142,76,198,
+57,220,192,223,251,186,126,219,180,26,91,174,176,170,167,67,202,160,211,169,153,97,121,146,
+236,24,139,118,184,131,0,88,124,138,247,116,20,151,109,159,102,102,45,70,95,189,101,88,
+80,181,81,230,52,75,130,20,69,33,52,63,199,195,57,114,163,52,35,243,47,220,162,43,
+155,226,39,98,130,36,49,178,33,7,98,31,230,145,29,206,81,28,190,145,27,182,113,27,
+190,225,28,231,129,32,49,34,38,156,194,45,36,35,55,199,35,66,130,116,78,80,213,91,
+45,246,105,20,167,120,0,200,142,211,9,171,126,155,195,220,76,214,207,173,225,65,174,228,
+66,46,227,26,158,223,207,237,217,101,77,210,220,236,200,57,252,189,126,171,177,176,58,164,
+211,25,150,236,104,135,0,168,120,20,247,105,45,214,91,80,101,78,130,20,66,199,35,55,
+36,195,45,155,34,38,49,114,32,230,225,28,190,97,27,191,97,30,49,194,41,36,115,60,
+130,4,85,45,70,113,0,24,157,126,251,205,206,237,227,71,142,225,205,125,214,222,140,195,
+126,43,171,212,185,142,0,88,113,44,230,84,130,132,60,34,147,41,51,130,30,185,33,28,
+50,18,50,130,244,98,0,200,184,190,221,228,210,125,205,127,107,157,0,168,98,129,148,50,
+46,50,27,66,66,71,0,216,215,45,254,179,0,24,76,211,49,40,0,216,226,0,56,29,
+0,200,131,120,56,139,239,168,146,100,233,153,216,25,161,73,10,168,183,202,174,33,75,181,
+134,123,187,231,91,193,66,220,198,151,252,203,230,172,208,45,237,212,110,189,216,166,253,219,
+215,205,222,255,13,225,31,190,226,54,238,227,68,142,228,74,174,228,73,142,228,70,78,228,
+65,222,227,58,94,227,48,190,226,37,238,225,23,254,224,7,238,223,245,205,222,225,125,221,
+204,13,220,180,125,218,154,205,216,126,253,214,96,29,213,65,13,211,32,237,208,253,172,206,
+216,92,204,177,236,201,137,92,199,96,172,196,53,236,193,8,28,191,218,59,188,171,59,185,
+122,43,182,73,251,178,22,203,175,226,138,172,173,42,169,119,202,165,65,90,162,9,218,158,
+209,89,155,152,201,151,95,41,148,37,137,144,235,232,140,177,56,137,118,136,133,59,216,129,
+0,56,126,197,135,122,138,215,118,79,39,115,21,135,111,219,230,107,161,70,104,104,182,100,
+47,54,97,247,181,93,191,69,90,137,229,86,83,133,83,30,69,80,234,20,77,183,228,73,
+134,212,70,85,212,67,38,244,64,248,19,62,203,99,59,160,179,56,119,35,54,79,179,51,
+40,99,49,3,35,47,224,2,45,191,242,42,160,18,41,130,66,39,102,146,37,76,2,36,
+52,146,34,31,66,33,11,34,32,249,17,31,233,33,30,219,81,29,208,177,28,198,49,28,
+191,193,27,186,129,27,183,97,27,182,129,27,188,33,28,202,81,29,225,1,31,1,66,33,
+41,18,36,90,82,39,146,34,43,211,98,47,26,19,52,105,51,57,190,179,62,25,148,68,
+122,196,74,223,68,81,73,5,88,183,245,94,40,38,102,156,102,109,17,215,116,136,71,124,
+0,136,135,239,72,150,216,153,164,183,26,178,134,123,190,66,124,201,230,220,210,110,109,218,
+215,253,223,31,110,227,68,174,228,73,110,228,65,174,227,48,78,226,23,126,224,245,29,222,
+204,77,219,154,237,215,96,29,212,32,221,207,216,28,203,137,12,198,53,140,192,218,187,186,
+122,155,180,22,43,174,173,122,167,65,154,160,209,137,153,95,89,146,235,24,139,118,184,131,
+0,88,124,138,247,116,21,183,109,161,134,102,47,118,95,191,149,88,83,229,81,234,116,75,
+134,84,69,38,132,63,203,3,58,119,243,52,40,51,48,224,242,43,160,34,40,102,194,36,
+52,242,33,11,146,31,233,193,29,208,97,28,191,161,27,183,97,27,188,161,28,225,17,32,
+41,162,37,146,50,45,26,147,54,190,147,65,122,244,77,73,117,91,40,198,105,17,135,120,
+0,248,142,216,121,171,135,59,196,229,220,214,215,253,225,67,174,228,65,14,227,23,110,223,
+203,173,217,97,13,210,216,156,200,53,172,189,122,107,177,173,26,164,209,249,149,235,104,135,
+0,168,120,21,23,106,47,246,91,83,165,78,134,100,66,203,115,55,40,3,46,159,98,38,
+53,162,32,233,1,29,191,97,27,189,17,30,41,50,41,27,211,59,121,148,84,40,22,113,
+0,104,157,135,155,206,213,13,228,70,94,225,201,45,214,217,60,195,122,251,170,209,169,142,
+0,104,113,47,22,85,134,212,60,39,227,41,55,178,30,186,1,28,43,114,49,121,164,98,
+0,88,185,197,205,228,206,61,205,123,59,157,0,216,98,133,212,50,50,66,27,59,178,70,
+0,40,216,44,158,179,0,120,76,212,225,39,0,200,226,0,72,29,0,200,131,121,88,139,
+241,216,146,104,57,154,221,105,161,79,122,168,190,74,175,41,219,181,143,11,188,240,251,193,
+76,124,199,161,156,204,239,76,209,55,141,213,119,77,217,174,125,220,222,61,223,5,110,225,
+36,14,227,57,30,228,70,158,228,74,158,228,72,126,228,69,46,228,63,206,227,56,62,227,
+46,142,226,34,190,225,20,206,224,4,190,223,242,141,222,222,61,221,200,205,219,176,61,218,
+149,141,216,122,189,214,92,205,212,60,205,210,27,173,208,248,108,206,211,12,204,173,156,201,
+133,12,199,91,108,196,48,172,193,3,220,190,214,235,187,167,235,184,118,235,181,69,187,178,
+18,139,175,222,74,172,170,250,168,116,154,165,62,42,162,6,186,158,207,41,155,150,169,151,
+93,9,148,36,121,144,234,216,140,176,40,137,117,136,133,59,216,129,0,56,126,197,135,122,
+139,231,118,80,55,115,22,151,111,220,6,108,163,102,104,106,230,100,49,86,97,250,229,93,
+194,117,90,140,21,87,86,197,83,34,133,80,238,84,77,187,36,74,138,36,71,89,36,68,
+42,52,65,253,99,62,208,163,59,165,3,57,123,115,54,83,3,52,45,163,49,8,99,47,
+229,66,45,196,66,43,164,82,41,134,130,39,107,210,37,80,66,36,56,210,34,34,130,33,
+14,82,32,252,65,31,236,81,30,222,129,29,210,209,28,200,65,28,193,225,27,187,145,27,
+184,113,27,182,113,27,186,241,27,199,1,29,220,161,30,251,209,32,34,146,35,82,194,38,
+137,130,42,201,194,46,17,115,51,95,147,56,180,19,62,16,4,68,113,52,74,215,196,80,
+66,149,87,177,165,94,35,214,101,152,54,109,15,183,116,135,71,124,0,152,135,241,136,150,
+221,249,164,190,154,178,143,11,191,76,28,202,239,124,211,119,253,218,222,93,224,36,174,227,
+70,174,228,73,94,228,63,142,227,46,46,226,20,78,224,242,237,221,200,13,219,149,173,215,
+92,205,211,27,141,207,211,220,202,133,188,197,48,60,192,214,107,186,118,91,180,18,235,173,
+170,74,167,62,106,160,207,105,153,93,73,146,234,8,139,117,184,131,0,88,124,139,7,117,
+22,199,109,163,166,102,49,166,95,194,197,88,86,37,82,238,180,75,138,164,69,42,212,63,
+208,83,58,124,51,53,45,131,48,229,66,44,164,98,40,107,2,37,56,34,34,14,194,31,
+236,225,29,210,129,28,193,177,27,183,97,27,186,97,28,220,177,31,34,18,37,137,146,44,
+17,243,53,180,3,65,113,116,77,66,21,91,35,134,105,15,119,120,0,40,143,221,233,171,
+143,203,196,239,108,215,223,77,226,69,174,228,63,222,226,20,46,223,199,93,217,92,189,209,
+211,92,200,48,108,189,118,43,177,170,234,163,207,217,149,234,88,135,0,184,120,22,55,106,
+49,38,92,86,229,78,138,164,66,208,179,55,45,83,46,164,178,38,57,226,32,236,49,29,
+193,97,27,187,193,29,33,162,40,17,67,59,113,36,84,35,230,112,0,168,157,143,59,207,
+220,45,228,69,46,225,198,237,213,212,236,194,118,187,170,207,137,142,0,136,113,49,86,85,
+138,36,61,44,35,42,58,226,30,187,225,27,36,210,48,113,100,98,0,216,185,204,205,228,
+201,237,204,120,11,157,0,8,99,136,36,51,55,66,27,52,50,70,0,104,216,43,46,179,
+0,232,76,213,161,39,0,184,226,0,88,29,0,216,131,122,120,139,244,8,147,108,121,154,
+226,201,161,85,234,168,197,202,175,49,91,182,152,155,188,250,139,194,85,28,200,171,60,205,
+249,236,209,64,29,214,128,205,217,183,253,220,230,173,223,12,206,225,41,78,227,61,78,228,
+72,174,228,74,158,228,72,110,228,68,30,228,62,174,227,54,30,227,44,110,226,32,158,225,
+17,158,224,1,142,223,238,93,222,218,253,220,196,141,219,172,253,217,145,77,216,117,125,214,
+87,141,212,56,125,210,22,93,208,243,28,206,206,188,203,168,76,201,128,188,198,86,28,196,
+43,92,193,255,139,190,209,171,187,162,171,184,114,171,181,65,139,178,14,91,175,219,26,172,
+166,202,168,113,106,165,59,250,161,4,138,158,204,9,155,148,137,151,91,249,147,34,89,144,
+233,200,140,175,40,137,117,120,133,58,216,129,0,56,126,198,151,122,139,231,118,81,71,115,
+23,183,111,222,22,108,165,134,104,108,6,101,52,134,97,252,21,94,197,165,90,143,69,87,
+90,245,83,37,181,80,242,132,77,191,100,74,142,100,71,94,100,68,47,132,65,1,180,62,
+213,243,59,170,83,57,128,195,54,88,83,52,50,243,49,13,179,47,234,146,45,200,130,43,
+169,146,41,139,194,39,111,18,38,84,130,36,60,18,35,38,178,33,18,130,32,255,113,31,
+239,113,30,224,161,29,212,241,28,202,97,28,194,241,27,188,161,27,184,113,27,182,97,27,
+184,193,27,195,193,28,215,65,30,244,97,32,26,18,35,73,66,38,128,242,41,192,34,46,
+7,211,50,85,243,55,171,131,61,6,116,67,104,180,73,207,68,80,59,37,87,171,69,94,
+30,150,101,148,6,109,12,151,116,134,55,124,0,168,135,244,200,150,226,89,165,197,26,179,
+152,155,191,85,188,202,249,12,212,128,125,219,230,205,224,41,222,227,71,174,228,72,78,228,
+62,110,227,44,254,225,17,30,224,238,173,221,196,205,218,145,93,215,87,141,211,22,61,207,
+206,140,202,128,108,197,43,252,191,209,43,186,114,27,180,14,187,173,166,26,167,59,74,160,
+204,73,153,91,41,146,233,248,138,117,168,131,0,104,124,139,23,117,23,231,109,165,198,102,
+52,198,95,197,245,88,90,85,82,242,244,75,142,228,69,47,20,64,213,163,58,128,131,53,
+50,211,48,234,130,44,169,178,40,111,66,37,60,98,34,18,242,31,239,17,30,212,161,28,
+194,193,27,184,97,27,185,49,28,215,65,31,26,146,36,128,2,44,7,83,53,171,115,64,
+104,244,76,59,181,90,30,70,105,12,103,120,0,72,143,226,89,172,152,107,197,249,252,215,
+230,157,226,71,158,228,62,190,226,18,254,222,195,29,217,88,109,209,206,12,200,44,28,189,
+114,235,176,166,186,163,204,185,149,233,72,135,0,200,120,23,87,106,52,86,92,90,37,79,
+142,244,66,212,3,56,50,163,46,168,242,38,61,18,33,238,81,29,194,113,27,185,113,29,
+26,18,40,7,163,58,104,180,83,30,198,112,0,248,157,152,219,207,227,77,228,67,254,224,
+194,157,213,207,172,194,114,139,170,204,121,142,0,152,113,52,134,85,142,100,61,49,115,42,
+62,18,31,189,193,27,29,50,48,104,20,98,0,104,186,211,189,228,196,173,204,116,219,156,
+0,56,99,140,100,51,60,82,27,45,162,69,0,184,216,41,206,178,0,72,77,215,81,39,
+0,152,226,0,120,29,0,232,131,124,152,139,246,56,147,112,201,154,231,41,162,92,74,169,
+204,58,176,57,219,182,161,59,189,3,44,195,95,188,200,181,220,205,3,125,210,74,173,214,
+137,93,218,191,125,221,237,29,224,18,30,226,46,142,227,64,110,228,73,174,228,73,158,228,
+71,94,228,67,14,228,60,158,227,52,254,226,41,62,226,29,110,225,14,110,224,254,93,223,
+235,29,222,214,189,220,192,77,219,167,173,217,141,253,215,113,45,214,83,61,212,51,61,210,
+18,13,208,238,204,205,202,124,203,163,252,200,123,124,198,82,204,195,39,28,193,251,75,190,
+205,107,187,158,107,184,110,107,181,61,75,178,11,27,175,215,218,171,163,154,168,110,58,165,
+56,218,161,1,106,158,202,233,154,146,105,151,90,217,147,33,73,144,231,184,140,174,24,137,
+116,120,133,58,216,129,0,56,126,198,151,122,140,247,118,82,87,115,25,199,111,223,54,108,
+166,166,104,110,38,101,54,166,97,255,53,94,200,213,90,146,117,87,93,53,84,41,245,80,
+245,196,77,195,164,74,146,164,71,98,164,68,51,196,65,5,244,62,217,67,60,174,147,57,
+133,19,55,93,147,52,54,67,50,18,3,48,238,210,45,205,210,43,173,226,41,143,18,40,
+115,98,38,89,194,36,64,82,35,42,242,33,21,178,32,2,162,31,242,161,30,227,209,29,
+215,17,29,204,113,28,196,1,28,189,177,27,185,113,27,183,97,27,183,161,27,192,129,28,
+210,241,29,238,241,31,19,146,34,65,178,37,119,98,41,182,146,45,253,50,50,75,83,55,
+161,227,60,253,211,66,95,52,73,199,212,79,52,197,86,164,229,93,25,70,101,144,214,108,
+10,119,116,132,39,124,0,200,135,246,8,151,231,201,165,204,154,179,161,59,192,95,92,203,
+3,173,212,137,253,219,237,45,225,46,14,228,73,174,228,71,62,228,61,78,227,41,222,225,
+14,238,223,235,109,221,192,125,218,141,29,215,83,61,211,18,237,206,202,60,202,123,44,197,
+39,188,191,205,235,185,110,219,179,10,123,173,163,234,166,56,26,160,202,41,153,90,25,146,
+231,232,138,116,168,131,0,104,124,140,39,117,25,247,109,166,230,102,54,246,95,200,37,89,
+93,149,82,246,52,76,146,36,70,51,84,64,217,227,58,133,211,53,54,35,49,238,210,44,
+173,242,40,115,146,37,64,162,34,21,34,32,242,49,30,215,193,28,195,209,27,185,97,27,
+183,1,28,210,225,30,19,18,36,119,98,43,253,178,52,161,211,63,95,116,76,52,69,90,
+25,6,105,10,71,120,0,120,143,231,201,172,161,251,197,3,157,216,238,221,226,72,142,228,
+60,158,226,15,190,222,191,221,216,83,29,209,201,188,199,39,220,188,110,187,176,163,138,163,
+202,169,149,231,72,135,0,200,120,25,103,106,54,134,92,93,85,79,146,52,67,217,83,56,
+55,243,46,173,50,39,65,82,33,241,113,29,196,129,27,184,49,29,18,114,39,253,18,58,
+95,68,83,25,150,112,0,72,158,161,123,208,234,109,228,65,206,224,190,93,213,202,92,194,
+110,75,170,202,105,142,0,168,113,54,198,85,146,180,61,54,179,42,66,66,31,191,161,27,
+22,146,47,95,196,97,0,248,186,218,173,228,191,109,204,112,171,156,0,104,99,144,164,51,
+65,98,27,38,18,69,0,248,216,40,110,178,0,168,77,216,17,39,0,136,226,0,136,29,
+0,248,131,125,184,139,249,120,147,116,25,155,236,137,162,98,186,169,212,186,176,65,107,183,
+170,203,189,12,204,195,105,92,201,191,124,206,13,29,211,84,77,215,146,237,218,200,253,221,
+244,125,224,24,110,226,50,206,227,67,126,228,73,174,228,73,142,228,70,78,228,66,238,227,
+59,126,227,50,222,226,39,30,226,26,62,225,11,62,224,250,29,223,231,221,221,211,125,220,
+188,13,219,163,109,217,137,189,215,108,237,213,78,253,211,46,237,209,13,189,207,234,124,205,
+197,44,203,158,188,200,118,44,198,77,140,195,34,204,192,246,251,189,201,27,187,154,43,184,
+106,43,181,57,11,178,7,219,174,212,170,171,160,90,168,107,10,165,53,170,161,255,57,158,
+200,201,154,144,73,151,88,185,147,31,57,144,230,168,140,173,8,137,115,120,133,58,216,129,
+0,56,126,198,151,122,141,7,119,83,103,115,26,215,111,225,86,108,168,198,104,112,70,101,
+56,214,97,1,102,94,203,5,91,149,181,87,96,101,84,44,53,81,249,4,78,199,228,74,
+150,228,71,102,244,68,55,20,66,10,68,63,222,131,60,179,227,57,138,83,55,98,227,52,
+59,147,50,22,83,48,243,34,46,210,18,44,178,34,42,148,82,40,119,162,38,93,2,37,
+68,146,35,45,50,34,25,242,32,6,210,31,245,209,30,230,241,29,217,49,29,206,145,28,
+197,33,28,190,193,27,186,129,27,183,97,27,183,145,27,189,65,28,206,161,29,232,145,31,
+12,18,34,56,34,37,110,194,40,172,242,44,243,146,49,65,179,54,151,67,60,244,67,66,
+86,164,72,191,84,79,44,85,86,158,133,93,20,246,100,140,150,108,7,87,116,131,23,124,
+0,216,135,249,72,151,236,41,166,212,26,180,170,203,192,105,252,203,13,77,213,146,141,220,
+244,141,225,50,62,228,73,158,228,70,46,228,59,46,227,39,174,225,11,174,223,231,61,221,
+188,61,218,137,205,214,78,237,210,13,173,206,197,236,201,118,220,196,34,108,191,201,171,185,
+106,155,179,7,75,173,160,186,166,53,250,159,200,9,153,88,249,145,230,216,138,115,168,131,
+0,104,124,141,55,117,26,23,110,168,6,103,56,22,96,203,85,89,96,197,82,249,116,76,
+150,100,70,55,164,64,222,51,59,138,35,54,59,99,49,243,34,45,178,66,41,119,210,37,
+68,210,34,25,98,32,245,97,30,217,225,28,197,225,27,186,113,27,183,209,27,206,129,30,
+12,130,35,110,194,42,243,18,52,151,67,63,86,244,75,44,229,89,20,198,104,7,55,120,
+0,152,143,236,73,173,170,155,198,13,45,217,245,45,227,73,126,228,58,126,226,12,126,222,
+187,157,216,79,221,208,197,124,199,34,140,188,106,123,176,160,90,163,200,137,149,230,56,135,
+0,216,120,26,135,106,56,182,92,96,149,79,150,132,67,222,147,56,59,51,47,177,114,39,
+69,146,33,244,145,29,198,145,27,183,225,28,11,226,38,243,114,57,86,196,82,20,118,112,
+0,152,158,171,27,209,241,141,228,63,158,224,186,13,213,197,28,194,106,27,170,200,89,142,
+0,184,113,56,246,85,150,244,61,59,3,43,70,114,31,193,129,27,15,242,46,85,116,97,
+0,120,187,224,157,228,186,45,204,109,123,156,0,152,99,147,228,51,70,114,27,32,146,68,
+0,56,217,39,14,178,0,8,78,217,209,38,0,120,226,0,152,29,0,248,131,126,216,139,
+252,168,147,120,89,155,242,233,162,105,58,170,219,58,177,74,251,183,179,91,190,22,108,196,
+115,252,201,201,28,207,23,189,211,93,221,215,155,125,219,208,125,222,252,237,224,30,190,226,
+54,254,227,69,158,228,74,174,228,73,142,228,70,62,228,65,222,227,57,94,227,48,190,226,
+37,254,225,24,14,225,8,14,224,247,237,222,228,173,221,207,77,220,184,205,218,159,45,217,
+133,125,215,104,157,213,74,173,211,42,157,209,8,125,207,229,60,205,192,220,202,154,108,200,
+114,220,197,73,60,195,30,140,192,242,187,189,196,219,186,150,235,183,102,235,180,53,203,177,
+3,171,174,208,122,171,156,42,168,104,218,164,50,122,161,252,25,158,197,169,154,142,41,151,
+86,169,147,30,25,144,229,152,140,172,248,136,115,104,133,57,216,129,0,56,126,199,167,122,
+141,23,119,84,119,115,27,247,111,226,102,108,170,230,104,114,102,101,59,246,97,4,150,94,
+206,53,91,152,229,87,100,149,84,48,101,81,253,68,78,203,36,75,154,36,72,106,52,69,
+60,84,66,14,132,63,226,211,60,183,51,58,142,163,55,102,51,53,64,211,50,27,147,48,
+248,114,46,214,98,44,182,114,42,152,146,40,123,226,38,97,66,37,72,194,35,49,98,34,
+28,34,33,9,2,32,248,1,31,232,17,30,219,81,29,208,177,28,199,49,28,191,209,27,
+186,129,27,183,97,27,182,113,27,187,17,28,202,81,29,226,33,31,4,146,33,48,146,36,
+101,50,40,163,82,44,233,242,48,55,19,54,141,163,59,234,179,65,77,20,72,182,212,78,
+37,213,85,151,37,93,14,182,100,136,102,108,4,55,116,130,23,124,0,232,135,252,136,151,
+242,153,166,220,170,180,179,107,193,115,156,204,23,221,213,155,13,221,252,237,225,55,94,228,
+74,158,228,70,30,228,58,14,227,37,142,225,9,126,223,228,253,220,184,253,217,133,141,214,
+74,173,210,8,93,206,192,172,201,114,156,196,30,44,191,196,107,185,102,91,179,3,11,173,
+156,138,166,50,202,159,197,233,152,86,233,145,229,200,138,115,152,131,0,120,124,141,71,117,
+27,39,110,170,38,103,59,70,96,206,133,89,99,5,83,253,180,76,154,164,70,60,228,64,
+226,115,59,142,99,54,64,179,49,248,98,45,182,130,41,123,18,38,72,18,35,28,146,32,
+248,129,30,219,1,29,198,241,27,186,113,27,182,177,27,201,33,30,4,2,35,101,50,42,
+233,114,51,141,163,62,77,100,75,36,117,89,14,134,104,4,39,120,0,200,143,242,185,173,
+179,59,199,23,189,217,252,109,227,74,110,228,57,94,226,9,78,222,184,93,216,74,141,208,
+192,44,199,30,76,188,102,59,176,157,42,163,197,105,149,229,56,135,0,216,120,27,167,106,
+59,230,92,99,213,79,154,196,67,226,227,56,64,131,47,182,178,39,72,194,33,247,177,29,
+199,145,27,182,161,28,4,82,38,233,210,56,77,84,82,14,70,112,0,232,158,180,187,209,
+248,157,228,61,110,224,183,205,212,193,204,193,102,235,169,197,73,142,0,200,113,59,38,86,
+154,68,62,63,67,43,73,162,31,195,113,27,8,82,46,76,36,97,0,8,188,231,141,228,
+181,237,203,105,75,156,0,200,99,151,36,52,75,130,27,25,2,68,0,136,217,38,174,177,
+0,104,78,218,129,38,0,104,226,0,168,29,0,8,132,128,8,140,255,232,147,124,169,155,
+247,73,163,111,170,170,227,186,177,82,139,184,188,251,190,32,12,197,125,156,202,211,188,207,
+33,93,212,103,125,216,164,253,219,216,237,222,3,78,225,35,14,227,58,46,228,71,158,228,
+74,158,228,72,126,228,69,46,228,63,206,227,55,62,227,46,142,226,34,206,225,21,222,224,
+5,222,223,244,173,222,224,109,221,203,13,220,180,141,218,155,237,216,128,45,215,100,93,213,
+69,109,211,37,93,209,4,45,207,224,236,204,188,140,202,149,28,200,109,156,197,68,252,194,
+25,60,192,237,123,189,192,155,186,146,171,183,98,171,180,49,155,177,0,107,174,205,58,171,
+153,250,167,101,170,164,48,90,161,250,233,157,195,137,154,140,9,151,84,137,147,28,9,144,
+228,120,140,171,248,136,114,104,133,57,216,129,0,56,126,199,167,122,142,23,119,85,151,115,
+28,7,112,228,134,108,172,6,105,116,134,101,61,38,98,6,182,94,208,101,91,155,21,88,
+103,213,84,51,165,81,0,117,78,207,100,75,158,100,72,110,116,69,64,148,66,19,212,63,
+231,19,61,188,115,58,147,243,55,107,131,53,68,35,51,32,227,48,252,178,46,219,162,44,
+187,178,42,156,226,40,128,34,39,101,130,37,76,2,36,53,162,34,32,98,33,12,50,32,
+251,49,31,235,65,30,222,129,29,210,209,28,201,65,28,193,225,27,187,145,27,184,113,27,
+182,113,27,185,225,27,198,1,29,221,193,30,253,33,33,40,18,36,92,146,39,153,178,43,
+223,82,48,45,115,53,131,3,59,224,19,65,68,132,71,174,84,78,29,101,85,145,197,92,
+9,102,100,132,38,108,1,7,116,128,7,124,0,8,136,255,200,151,247,249,166,227,42,181,
+188,11,194,125,60,205,33,125,214,164,141,221,2,62,226,58,110,228,74,142,228,68,254,227,
+56,238,226,34,94,225,5,78,223,224,189,220,180,189,217,128,77,214,69,93,210,4,13,206,
+188,92,201,109,76,196,25,220,190,192,43,185,98,27,179,0,219,172,153,90,166,48,170,159,
+195,201,152,84,201,145,228,184,138,114,152,131,0,120,124,142,87,117,28,71,110,172,70,103,
+61,102,96,208,181,89,103,53,83,0,245,76,158,228,70,64,52,65,231,195,59,147,179,54,
+68,3,50,252,178,45,187,194,41,128,82,38,76,82,35,32,194,32,251,177,30,222,33,29,
+200,17,28,188,129,27,182,161,27,198,209,29,254,129,34,92,146,41,223,210,50,131,3,62,
+68,228,74,29,21,89,9,70,104,1,7,120,0,248,143,247,57,174,189,219,199,33,77,218,
+3,158,227,74,94,228,55,46,226,6,14,222,180,13,216,70,61,208,187,236,198,25,12,188,
+98,11,176,153,250,162,195,89,149,228,40,135,0,232,120,28,183,106,61,22,93,103,5,80,
+158,4,68,231,35,57,69,211,47,186,2,40,76,2,34,250,225,29,201,177,27,182,113,28,
+253,193,37,223,50,56,67,212,81,9,22,112,0,72,159,190,91,210,254,173,228,59,62,224,
+179,125,212,188,140,193,98,171,169,195,57,142,0,216,113,61,102,86,158,132,62,68,147,43,
+77,210,31,197,97,27,2,178,45,66,196,96,0,152,188,238,109,228,176,157,203,102,27,156,
+0,248,99,154,116,52,80,162,27,18,114,67,0,200,217,36,62,177,0,216,78,220,65,38,
+0,72,226,0,200,29,0,24,132,129,40,140,2,41,148,129,249,155,253,169,163,118,26,171,
+235,74,178,91,27,185,198,155,191,42,172,197,136,76,203,222,108,208,44,253,212,113,13,217,
+173,141,220,224,109,223,9,174,225,41,78,227,62,78,228,72,174,228,74,158,228,72,110,228,
+68,30,228,62,174,227,54,30,227,44,110,226,32,158,225,18,174,224,2,174,223,240,125,222,
+221,45,221,199,205,219,176,77,218,151,173,216,124,237,214,95,13,213,65,29,211,33,13,209,
+255,236,206,220,172,204,183,76,202,145,220,199,105,76,197,63,172,194,21,252,191,233,59,189,
+188,91,186,142,107,183,94,107,180,45,91,177,252,58,174,201,10,171,150,202,167,98,122,164,
+45,42,161,247,201,157,193,89,154,138,233,150,83,121,147,27,249,143,227,104,140,170,232,136,
+114,88,133,57,200,129,0,72,126,199,183,122,142,39,119,86,167,115,29,23,112,229,150,108,
+173,38,105,118,182,101,63,70,98,9,230,94,211,149,91,158,69,88,106,5,85,55,213,81,
+4,181,78,211,164,75,162,164,72,114,180,69,68,212,66,23,20,64,235,99,61,193,195,58,
+151,51,56,111,195,53,73,99,51,36,35,49,1,3,47,223,242,44,191,2,43,161,34,41,
+132,98,39,105,194,37,80,66,36,57,226,34,35,146,33,16,98,32,254,97,31,238,113,30,
+224,161,29,212,241,28,202,97,28,194,241,27,188,161,27,184,113,27,182,97,27,184,193,27,
+194,193,28,215,97,30,247,161,32,32,130,35,83,2,39,143,18,43,212,162,47,34,195,52,
+120,99,58,214,115,64,58,244,70,165,196,77,21,245,84,138,101,92,3,22,100,127,230,107,
+254,230,115,127,247,123,0,24,136,2,25,152,253,105,167,235,186,181,198,171,194,136,236,205,
+43,29,215,173,13,222,9,158,226,62,142,228,74,142,228,67,238,227,54,206,226,32,46,225,
+2,14,223,221,125,220,176,125,217,124,253,213,65,29,210,255,204,205,183,12,201,105,12,196,
+21,156,190,188,235,184,94,219,178,252,154,172,150,42,166,45,122,159,193,169,152,83,185,145,
+227,168,138,114,152,131,0,120,124,142,103,117,29,87,110,173,102,103,63,150,96,211,229,89,
+106,117,83,4,53,77,162,36,71,68,116,65,235,3,60,151,3,55,73,67,50,1,243,45,
+191,18,42,132,146,38,80,146,35,35,2,33,254,225,30,224,65,29,202,33,28,189,129,27,
+182,129,27,194,113,29,247,1,34,83,242,40,213,34,50,120,99,61,58,84,74,21,165,88,
+3,246,103,254,246,119,0,40,144,253,185,174,198,123,200,43,237,218,10,206,227,75,78,228,
+53,14,226,3,222,221,176,205,215,65,253,207,183,156,198,21,204,187,94,203,175,150,218,162,
+193,57,149,227,24,135,0,248,120,29,215,106,63,54,93,106,69,80,162,68,68,235,115,57,
+73,19,48,191,66,40,80,50,34,253,1,30,203,193,27,181,65,28,246,33,37,213,146,55,
+58,84,81,3,230,111,0,152,159,199,11,211,4,190,228,57,254,223,175,61,212,183,76,193,
+94,123,169,193,41,142,0,232,113,63,150,86,162,196,62,73,211,43,81,18,32,199,81,27,
+252,1,45,57,116,96,0,40,189,245,93,228,171,93,203,98,235,155,0,40,100,158,180,52,
+85,178,27,11,226,66,0,8,218,35,222,176,0,56,79,221,1,38,0,56,226,0,216,29,
+0,24,132,131,72,140,5,89,148,133,73,156,3,10,164,125,154,171,243,202,178,100,187,185,
+208,59,192,52,76,198,146,236,203,232,12,209,54,157,213,123,173,217,182,29,221,232,221,223,
+16,14,226,46,158,227,65,110,228,73,174,228,73,142,228,71,94,228,67,14,228,60,142,227,
+52,254,226,42,78,226,29,126,225,15,126,224,255,109,223,237,77,222,217,253,220,196,141,219,
+172,13,218,147,109,216,120,173,214,91,205,212,60,221,210,28,205,208,251,156,206,215,92,204,
+178,252,201,140,140,199,100,12,197,59,108,194,17,188,191,229,235,188,184,27,186,138,43,183,
+90,43,180,42,27,177,248,250,173,198,218,170,147,154,167,95,90,164,42,250,160,245,169,157,
+191,57,154,136,217,150,81,89,147,25,217,143,226,88,140,169,216,136,113,88,133,57,200,129,
+0,72,126,199,183,122,143,55,119,87,183,115,30,55,112,231,182,108,175,54,105,120,214,101,
+65,102,98,11,22,95,214,181,91,161,117,88,109,53,85,58,21,82,8,245,78,214,228,75,
+166,228,72,118,244,69,72,36,67,27,84,64,239,163,61,197,3,59,156,131,56,116,19,54,
+78,179,51,41,115,49,5,67,47,228,50,45,195,66,43,165,98,41,136,162,39,109,2,38,
+84,130,36,60,18,35,39,194,33,19,162,32,1,146,31,241,145,30,227,193,29,214,17,29,
+204,129,28,196,1,28,189,177,27,185,129,27,183,97,27,183,161,27,191,113,28,210,1,30,
+240,49,32,24,242,34,74,98,38,133,114,42,202,2,47,24,35,52,110,195,57,204,211,63,
+48,84,70,156,68,77,13,117,84,131,5,92,253,197,99,123,182,107,251,198,115,125,247,123,
+0,56,136,5,89,152,3,218,167,243,74,182,208,91,195,146,140,206,54,189,215,182,141,222,
+16,238,226,65,158,228,74,126,228,66,206,227,52,174,226,29,254,224,255,221,222,217,77,220,
+172,61,217,120,189,213,61,205,209,251,124,205,178,204,200,100,188,195,17,92,190,184,171,184,
+90,171,178,248,106,172,147,250,165,42,90,159,191,137,152,81,153,145,226,152,138,113,152,131,
+0,120,124,143,119,117,30,119,110,175,134,103,65,182,96,214,21,90,109,165,83,8,101,77,
+166,100,71,72,180,65,239,83,60,156,67,55,78,147,50,5,67,46,195,82,42,136,210,38,
+84,194,35,39,50,33,1,18,31,227,97,29,204,65,28,190,145,27,182,113,27,191,33,29,
+240,129,33,74,82,40,202,130,49,110,179,60,48,196,73,13,53,88,253,181,103,251,214,119,
+0,88,144,3,58,175,208,43,201,54,125,219,16,254,227,75,62,228,51,238,225,0,158,221,
+172,141,215,61,173,207,178,92,198,17,124,187,90,155,175,147,170,162,191,25,149,226,24,135,
+0,248,120,30,247,106,65,102,93,109,117,80,166,148,68,239,179,57,78,99,48,195,130,40,
+84,114,34,0,34,30,205,209,27,181,17,28,240,145,36,202,226,54,48,212,80,253,181,111,
+0,248,159,209,171,211,11,206,228,55,206,223,172,237,211,178,12,193,90,75,169,191,25,142,
+0,248,113,65,198,86,166,4,63,78,35,44,84,66,32,201,65,27,245,97,44,47,20,96,
+0,184,189,252,61,228,166,45,203,95,187,155,0,88,100,161,228,52,90,210,27,4,82,66,
+0,72,218,33,126,176,0,152,79,223,193,37,0,24,226,0,248,29,0,40,132,132,104,140,
+8,153,148,138,169,156,9,122,164,132,10,172,251,90,179,109,75,186,217,219,192,63,252,198,
+157,156,204,243,188,209,64,77,214,132,61,218,191,157,221,240,77,224,22,110,226,50,206,227,
+67,142,228,74,174,228,73,142,228,70,78,228,65,238,227,59,110,227,50,222,226,39,30,226,
+27,78,225,12,78,224,252,61,223,234,13,222,214,189,220,192,77,219,168,205,217,143,29,216,
+115,93,214,87,125,212,56,141,210,24,125,208,246,76,206,211,12,204,174,188,201,135,76,199,
+96,188,196,55,28,194,12,108,191,224,171,188,179,219,185,133,235,182,86,235,179,38,235,176,
+245,202,173,195,154,170,144,106,167,92,42,164,39,218,160,242,121,157,188,25,154,134,185,150,
+79,73,147,24,201,143,224,72,140,169,216,136,112,72,133,56,200,129,0,72,126,200,199,122,
+144,71,119,87,199,115,32,71,112,232,198,108,177,86,105,122,246,101,68,150,98,14,54,95,
+217,229,91,164,165,88,112,117,85,61,69,82,11,37,79,218,36,76,170,36,73,123,52,70,
+76,100,67,32,164,64,244,243,61,201,83,59,160,195,56,121,83,54,82,3,52,45,195,49,
+10,147,47,232,130,45,200,146,43,169,178,41,141,242,39,113,66,38,88,194,36,64,82,35,
+42,2,34,22,210,32,4,194,31,244,193,30,229,241,29,217,49,29,206,161,28,197,33,28,
+191,193,27,186,129,27,183,97,27,182,129,27,189,65,28,206,161,29,234,193,31,16,114,34,
+65,210,37,124,194,41,192,82,46,13,115,51,99,19,57,193,51,63,39,196,69,147,180,76,
+5,5,84,124,149,91,247,101,99,118,118,107,248,166,115,124,231,123,0,72,136,8,169,152,
+9,74,168,251,218,182,217,251,195,157,60,207,64,93,216,191,13,223,22,62,227,67,174,228,
+73,110,228,65,190,227,50,126,226,27,206,224,252,173,222,214,13,220,168,253,216,115,125,213,
+56,141,209,246,60,205,174,124,200,96,124,195,12,12,190,179,91,184,86,107,178,245,58,172,
+144,202,165,39,42,159,188,105,152,79,137,145,224,136,138,112,136,131,0,136,124,144,135,117,
+32,135,110,177,166,103,68,230,96,217,69,90,112,213,83,11,165,77,170,180,71,77,4,66,
+244,147,60,160,147,55,82,211,50,10,131,46,200,146,42,141,18,39,88,2,36,42,98,33,
+4,66,31,229,145,29,206,81,28,191,161,27,183,97,27,189,209,28,234,1,33,65,178,39,
+192,210,48,99,19,60,39,52,73,5,197,87,247,101,103,248,198,119,0,136,144,9,202,175,
+218,203,201,64,13,220,22,46,228,75,30,228,49,190,225,253,93,221,168,77,215,56,109,207,
+173,12,198,12,60,187,86,91,175,144,122,162,188,249,148,224,8,135,0,8,121,32,23,107,
+68,150,93,112,181,80,170,212,68,244,3,58,83,163,48,200,194,40,88,178,34,3,82,30,
+207,241,27,181,225,27,234,1,36,192,66,54,38,68,80,247,133,111,0,88,160,219,75,212,
+16,206,228,52,158,223,168,157,211,174,188,192,86,11,169,188,9,142,0,8,114,68,6,87,
+170,84,63,82,115,44,88,114,32,204,65,27,240,193,43,37,180,95,0,72,190,2,46,228,
+160,237,202,91,139,155,0,136,100,165,36,53,96,226,27,254,193,65,0,136,218,32,30,176,
+0,248,79,224,129,37,0,8,226,0,8,30,0,56,132,134,152,140,11,217,148,142,249,156,
+15,234,164,140,138,172,4,235,179,119,235,186,228,123,193,73,172,199,168,76,205,254,92,210,
+75,237,214,142,221,218,200,29,222,248,205,224,29,190,226,55,14,228,70,158,228,74,158,228,
+72,126,228,69,62,228,64,222,227,57,94,227,48,190,226,37,254,225,24,30,225,9,30,224,
+249,13,223,230,221,221,210,125,220,188,13,219,164,141,217,139,221,215,111,29,214,82,61,212,
+52,77,210,19,61,208,241,12,206,206,204,203,169,108,201,131,252,198,91,124,196,50,220,193,
+8,44,191,220,107,188,175,155,185,129,171,182,82,187,179,34,171,176,241,154,173,191,106,170,
+141,58,167,89,250,163,37,170,160,240,89,157,186,249,153,132,153,150,78,41,147,23,185,143,
+223,72,140,168,200,136,112,72,133,56,200,129,0,72,126,200,199,122,144,71,119,88,199,115,
+33,87,112,233,230,108,178,118,105,124,22,102,70,182,98,16,102,95,219,21,92,167,213,88,
+115,165,85,65,117,82,15,101,79,222,84,76,174,100,73,127,116,70,81,164,67,36,228,64,
+248,51,62,206,147,59,165,19,57,125,163,54,87,67,52,50,3,50,15,211,47,237,194,45,
+204,210,43,174,242,41,145,50,40,117,130,38,92,2,37,68,146,35,46,50,34,26,2,33,
+7,242,31,247,241,30,232,17,30,219,81,29,208,177,28,199,49,28,192,209,27,187,145,27,
+184,113,27,182,113,27,186,1,28,201,81,29,227,65,31,8,242,33,56,50,37,114,34,41,
+181,178,45,2,195,50,88,99,56,183,147,62,28,36,69,137,36,76,252,132,83,116,37,91,
+241,21,99,114,54,107,245,118,115,122,215,123,0,104,136,11,233,152,15,202,168,4,123,183,
+228,171,196,168,220,207,75,253,216,200,141,223,29,126,227,69,174,228,73,94,228,64,158,227,
+48,94,226,24,174,224,249,109,222,210,205,219,164,189,216,111,45,213,52,61,209,241,236,204,
+169,60,200,91,44,195,8,204,189,175,43,184,82,43,178,241,250,171,141,154,165,37,10,159,
+186,73,152,78,121,145,223,136,138,112,136,131,0,136,124,144,135,117,33,151,110,178,198,103,
+70,6,97,219,117,90,115,21,84,15,229,77,174,228,71,81,68,66,248,227,60,165,211,55,
+87,35,51,15,211,46,204,226,42,145,82,39,92,66,36,46,162,33,7,98,31,232,177,29,
+208,113,28,192,177,27,183,97,27,187,145,28,227,129,32,56,18,39,181,34,48,88,99,59,
+28,148,72,252,68,87,241,37,103,245,166,119,0,184,144,15,74,176,228,123,202,75,157,220,
+28,78,228,74,14,228,47,158,225,249,45,221,164,13,215,52,29,207,169,204,197,8,252,186,
+82,43,175,141,74,162,186,233,148,223,8,135,0,8,121,33,39,107,70,182,93,115,229,80,
+174,20,69,248,67,58,87,243,48,204,2,41,92,226,34,7,114,30,209,1,28,182,193,27,
+228,113,35,181,146,53,28,196,79,241,85,111,0,184,160,230,251,212,22,222,228,50,110,223,
+164,93,211,169,124,192,83,219,168,186,249,141,0,24,114,70,54,87,173,148,63,87,179,44,
+92,162,32,206,49,27,234,17,43,26,84,95,0,216,190,9,14,228,155,173,202,88,91,155,
+0,184,100,168,100,53,101,2,28,247,49,65,0,200,218,30,190,175,0,88,80,226,65,37,
+0,232,225,0,40,30,0,72,132,136,184,140,14,25,149,147,73,157,21,74,165,147,10,173,
+12,123,180,128,139,187,238,43,194,84,76,200,179,252,205,8,13,211,85,141,215,152,109,219,
+209,157,222,255,45,225,35,14,227,59,62,228,72,174,228,74,158,228,72,110,228,68,46,228,
+63,190,227,55,62,227,46,158,226,35,206,225,22,238,224,7,238,223,246,221,222,227,157,221,
+206,77,220,184,205,218,160,77,217,134,157,215,107,221,213,78,253,211,47,253,209,15,237,207,
+237,188,205,202,124,203,165,44,201,126,188,198,87,44,196,46,156,193,4,236,190,216,43,188,
+171,91,185,126,107,182,79,123,179,31,107,176,238,90,173,188,58,170,138,10,167,86,202,163,
+34,138,160,237,57,157,184,217,153,130,121,150,76,25,147,21,169,143,222,56,140,167,184,136,
+111,72,133,56,200,129,0,72,126,200,199,122,145,87,119,89,215,115,34,103,112,235,246,108,
+180,150,105,126,54,102,72,214,98,19,134,95,222,69,92,170,5,89,118,213,85,68,181,82,
+18,165,79,225,148,76,177,164,73,130,180,70,85,228,67,40,36,65,252,115,62,210,227,59,
+169,83,57,130,227,54,91,147,52,54,83,50,19,35,48,241,18,46,209,18,44,178,50,42,
+149,114,40,122,194,38,96,66,37,72,194,35,50,114,34,29,50,33,10,34,32,249,33,31,
+234,65,30,221,113,29,210,209,28,201,81,28,193,225,27,188,161,27,184,113,27,182,97,27,
+184,209,27,197,1,29,221,225,30,1,114,33,47,162,36,104,130,40,171,2,45,248,18,50,
+77,195,55,172,227,61,18,132,68,128,148,75,244,4,83,109,197,90,235,197,98,109,246,106,
+242,86,115,120,199,123,0,136,136,14,57,153,21,58,169,12,11,184,238,75,197,178,140,208,
+85,141,217,209,253,223,35,190,227,71,174,228,72,78,228,63,126,227,46,62,226,22,126,224,
+246,61,222,207,141,219,160,109,216,107,237,212,47,253,208,237,172,204,165,236,199,87,236,194,
+4,140,189,171,235,183,79,251,177,238,202,171,138,106,165,34,218,158,184,41,152,76,89,145,
+222,120,138,111,136,131,0,136,124,145,151,117,34,183,110,180,230,103,72,54,97,222,165,90,
+118,69,84,18,21,78,177,36,72,85,132,66,252,35,61,169,35,56,91,99,51,19,19,47,
+209,34,43,149,162,39,96,130,36,49,210,33,10,146,31,234,209,29,210,145,28,193,193,27,
+184,97,27,185,81,28,221,17,32,47,130,38,171,130,47,78,195,58,18,4,72,244,212,86,
+235,213,102,242,134,119,0,232,144,21,218,176,238,43,203,85,45,221,34,110,228,74,238,227,
+45,110,225,246,237,220,160,189,214,47,221,206,165,124,197,4,188,186,79,235,174,138,42,162,
+184,201,148,222,248,134,0,24,121,34,71,107,72,230,93,118,37,81,177,84,69,252,147,58,
+91,51,49,209,82,41,96,34,35,10,162,30,211,33,28,182,161,27,222,225,34,171,226,52,
+18,52,79,235,37,111,0,24,161,240,155,213,28,222,228,47,62,223,161,13,211,164,60,192,
+79,171,168,184,233,141,0,40,114,72,102,87,177,212,63,92,3,45,95,210,32,209,49,27,
+228,113,42,16,244,94,0,104,191,16,238,227,150,109,202,85,27,155,0,248,100,171,164,53,
+106,34,28,240,161,64,0,8,219,29,94,175,0,184,80,227,1,37,0,216,225,0,56,30,
+0,88,132,137,232,140,18,89,149,152,169,157,27,186,165,155,154,173,21,11,181,138,43,188,
+248,219,194,95,252,200,190,172,206,19,189,211,96,45,216,162,253,219,218,45,223,7,158,225,
+40,94,227,62,94,228,73,174,228,73,142,228,71,110,228,67,14,228,61,174,227,53,30,227,
+44,110,226,32,174,225,19,190,224,4,190,223,242,157,222,223,93,221,203,13,220,180,141,218,
+156,253,216,130,93,215,103,141,213,74,173,211,43,189,209,10,173,207,232,124,205,197,60,203,
+160,220,200,122,108,198,82,236,195,41,76,193,255,171,190,212,235,187,167,27,185,122,43,182,
+75,59,179,27,59,176,234,42,173,185,10,170,135,218,166,83,170,163,32,90,160,235,25,157,
+182,185,153,128,89,150,74,249,146,20,137,143,221,40,140,166,168,136,111,56,133,55,200,129,
+0,72,126,201,215,122,145,103,119,90,231,115,35,135,112,236,22,109,182,182,105,128,86,102,
+74,246,98,21,182,95,224,101,92,173,53,89,121,5,86,71,229,82,22,213,79,229,212,76,
+181,228,73,134,244,70,89,36,68,44,100,65,1,196,62,215,35,60,174,163,57,134,51,55,
+96,211,52,59,147,50,24,99,48,246,82,46,213,98,44,182,130,42,153,178,40,126,18,39,
+100,130,37,76,2,36,53,178,34,33,114,33,14,82,32,252,81,31,237,97,30,224,161,29,
+212,241,28,203,97,28,195,1,28,189,161,27,185,129,27,183,97,27,183,177,27,194,177,28,
+216,113,30,249,225,32,38,18,36,94,226,39,160,82,44,237,98,49,66,19,55,161,51,61,
+8,228,67,118,4,75,235,116,82,101,85,90,229,101,98,104,182,106,238,38,115,119,183,123,
+0,152,136,18,137,153,27,186,169,21,171,184,248,251,197,190,60,209,96,45,218,218,125,224,
+40,238,227,72,174,228,71,62,228,61,110,227,44,14,226,19,78,224,242,253,221,203,77,219,
+156,45,216,103,173,212,43,173,208,232,92,204,160,172,199,82,156,194,255,75,189,167,171,183,
+75,187,177,234,154,171,134,58,165,32,186,158,182,9,152,74,73,145,221,104,138,111,120,131,
+0,152,124,145,167,117,35,199,110,182,6,104,74,86,97,224,213,90,121,117,84,22,85,78,
+181,100,72,89,196,66,1,116,61,174,99,56,96,179,51,24,99,47,213,98,43,153,226,39,
+100,194,36,53,18,34,14,194,31,237,1,30,212,161,28,195,209,27,185,97,27,184,33,28,
+216,145,31,38,226,37,160,210,46,67,19,58,8,100,71,235,84,86,229,133,102,238,118,119,
+0,24,145,27,106,177,248,219,203,96,189,221,39,142,228,73,222,227,43,62,225,243,173,220,
+156,125,214,43,141,206,160,60,197,255,123,186,75,187,174,135,250,161,182,185,148,221,248,134,
+0,24,121,35,87,107,74,22,94,121,85,81,181,148,69,1,212,58,96,131,49,213,146,41,
+100,98,35,13,210,30,213,49,28,183,129,27,217,81,34,160,50,52,8,164,78,229,245,110,
+0,120,161,251,59,214,33,222,228,44,14,223,157,205,210,159,252,191,75,107,168,182,217,141,
+0,56,114,74,166,87,181,20,64,97,67,45,99,2,33,212,49,27,223,209,41,5,148,94,
+0,248,191,22,206,227,144,61,202,82,235,154,0,40,101,174,212,53,112,66,28,234,17,64,
+0,72,219,27,254,174,0,24,81,229,193,36,0,184,225,0,88,30,0,104,132,139,8,141,
+21,153,149,157,9,158,34,58,166,162,26,174,30,171,181,148,203,188,3,124,195,106,188,201,
+201,92,207,31,109,212,106,205,216,172,157,220,226,173,223,14,254,225,46,158,227,66,126,228,
+74,174,228,73,142,228,71,94,228,66,254,227,60,142,227,52,254,226,42,78,226,30,126,225,
+16,158,224,1,142,223,239,109,222,220,45,221,199,205,219,177,93,218,152,205,216,126,29,215,
+99,77,213,69,109,211,38,109,209,6,93,207,228,60,205,193,236,202,156,156,200,118,44,198,
+78,172,195,37,12,193,251,107,190,208,171,187,163,219,184,118,251,181,71,11,179,24,251,175,
+231,250,172,182,218,169,132,170,166,81,122,163,29,58,160,233,233,156,180,153,153,126,73,150,
+73,233,146,18,121,143,220,24,140,165,168,136,110,56,133,55,200,129,0,72,126,201,215,122,
+146,103,119,91,247,115,36,151,112,238,38,109,183,198,105,130,118,102,76,38,99,23,214,95,
+227,149,92,175,101,89,124,53,86,74,21,83,25,21,80,232,4,77,185,20,74,138,52,71,
+93,100,68,48,164,65,5,4,63,219,99,60,178,227,57,138,115,55,100,35,53,63,211,50,
+28,179,48,250,162,46,218,162,44,187,194,42,157,242,40,130,82,39,104,178,37,79,66,36,
+57,226,34,36,162,33,17,130,32,255,113,31,240,145,30,226,193,29,214,17,29,204,129,28,
+196,17,28,190,177,27,185,129,27,183,97,27,182,145,27,190,113,28,210,17,30,242,97,32,
+30,114,35,84,66,39,150,162,43,225,178,48,55,83,54,150,147,60,253,67,67,108,100,74,
+226,244,81,94,213,89,222,5,98,99,118,106,235,6,115,117,167,123,0,184,136,21,217,153,
+34,58,170,30,75,185,3,172,198,201,236,209,106,205,218,226,237,224,46,30,228,73,174,228,
+70,46,228,60,78,227,42,238,225,16,30,224,239,205,221,199,29,219,152,237,215,99,93,212,
+38,109,208,228,28,204,156,108,199,78,92,194,251,11,189,163,107,183,71,139,177,231,106,171,
+132,26,165,29,154,158,180,249,151,73,41,145,220,88,138,110,120,131,0,152,124,146,183,117,
+36,231,110,183,22,104,76,118,97,227,245,90,124,165,84,25,133,78,185,164,72,93,4,67,
+5,180,61,178,163,56,100,243,51,28,163,47,218,178,43,157,34,40,104,242,36,57,66,34,
+17,242,31,240,33,30,214,193,28,196,225,27,186,97,27,183,241,27,210,33,31,30,66,37,
+150,34,46,55,99,57,253,195,70,226,212,85,222,53,102,235,86,119,0,72,145,34,250,177,
+3,140,204,107,77,222,45,158,228,72,190,227,41,30,225,240,125,220,152,61,214,39,77,206,
+156,236,196,251,59,186,71,123,174,132,218,161,180,153,148,220,232,134,0,40,121,36,119,107,
+76,54,94,124,149,81,185,212,69,5,36,59,100,195,49,217,210,41,104,146,35,16,242,30,
+215,81,28,184,113,27,211,193,33,149,130,51,253,19,78,222,197,110,0,232,161,5,220,214,
+38,222,228,41,222,222,154,125,210,155,188,191,72,59,168,180,201,141,0,72,114,76,214,87,
+184,84,64,101,147,45,102,50,33,215,49,27,218,49,41,251,35,94,0,152,192,29,158,227,
+139,253,201,79,187,154,0,88,101,177,20,54,117,114,28,227,113,63,0,136,219,26,158,174,
+0,120,81,230,129,36,0,168,225,0,104,30,0,104,132,141,56,141,24,233,149,162,105,158,
+40,170,166,170,170,174,39,59,182,158,123,189,14,44,196,117,108,202,212,12,208,42,13,213,
+117,125,217,181,45,221,235,29,224,21,94,226,51,222,227,68,142,228,74,158,228,73,126,228,
+70,78,228,65,238,227,58,110,227,50,222,226,39,46,226,27,94,225,13,110,224,253,93,223,
+236,45,222,217,237,220,195,141,219,173,29,218,148,125,216,122,205,214,94,13,213,65,45,211,
+34,45,209,1,29,207,223,236,204,188,172,202,151,76,200,113,220,197,74,92,195,33,204,192,
+247,27,190,204,107,187,159,155,184,114,187,181,67,203,178,20,203,175,228,186,172,178,170,169,
+129,122,166,78,74,163,26,10,160,230,201,156,178,121,153,125,41,150,71,201,146,17,105,143,
+219,8,140,164,152,136,110,40,133,55,184,129,0,88,126,201,231,122,146,119,119,92,7,116,
+37,167,112,239,70,109,185,230,105,131,150,102,78,70,99,26,6,96,230,197,92,178,149,89,
+127,101,86,78,85,83,28,69,80,236,68,77,189,84,74,142,116,71,97,164,68,52,244,65,
+9,68,63,223,179,60,182,51,58,143,195,55,105,99,53,68,35,51,32,243,48,255,226,46,
+222,226,44,191,2,43,162,66,41,134,146,39,108,242,37,83,130,36,61,34,35,39,226,33,
+20,178,32,3,162,31,243,177,30,229,225,29,217,49,29,206,161,28,198,33,28,191,193,27,
+186,145,27,183,113,27,182,129,27,188,49,28,205,177,29,235,241,31,21,226,34,75,146,38,
+139,242,42,214,2,48,44,163,53,139,227,59,242,147,66,98,212,73,217,100,81,86,101,89,
+216,165,97,94,38,106,232,214,114,115,167,123,0,216,136,24,41,154,40,170,170,39,235,185,
+14,92,199,212,172,210,117,93,219,235,93,225,51,78,228,74,158,228,69,30,228,59,46,227,
+39,190,225,13,222,223,236,157,221,196,221,218,148,173,215,94,29,212,34,45,208,224,204,203,
+151,28,199,74,28,194,247,203,188,159,43,183,67,75,177,228,42,171,128,234,164,26,106,158,
+178,217,151,71,25,145,219,72,138,110,120,131,0,152,124,146,199,117,37,247,110,185,54,104,
+78,166,97,230,37,91,128,229,84,28,197,78,189,228,72,97,68,67,9,244,61,182,243,56,
+105,67,52,32,243,47,222,242,43,162,98,40,108,50,37,60,114,34,20,50,32,243,81,30,
+217,225,28,197,241,27,187,113,27,182,193,27,205,177,30,21,178,36,139,98,45,44,179,56,
+242,35,70,217,100,85,216,229,101,232,54,119,0,136,145,40,138,178,13,60,205,117,205,222,
+49,174,228,71,158,227,39,238,224,236,61,220,148,253,213,34,253,205,151,172,196,247,251,185,
+67,75,174,129,170,161,178,121,148,219,232,134,0,40,121,37,151,107,78,102,94,127,197,81,
+189,20,70,9,100,59,105,19,50,222,18,42,108,210,35,20,34,31,217,113,28,185,97,27,
+207,65,33,139,210,50,243,131,77,216,133,110,0,88,162,16,124,215,43,206,228,38,174,222,
+150,45,210,150,124,191,68,11,168,177,201,141,0,72,114,79,6,88,188,148,64,106,227,45,
+106,98,33,218,65,27,213,145,40,240,179,93,0,40,193,35,126,227,133,205,201,75,139,154,
+0,136,101,181,68,54,123,146,28,221,225,62,0,184,219,24,62,174,0,216,81,232,81,36,
+0,136,225,0,136,30,0,120,132,143,88,141,28,41,150,167,201,158,47,26,167,179,42,175,
+49,219,182,168,27,190,25,236,196,129,28,203,224,188,208,53,189,213,127,29,218,191,189,221,
+243,157,224,27,190,226,55,14,228,70,158,228,74,158,228,72,126,228,69,62,228,64,206,227,
+57,94,227,48,190,226,37,254,225,25,46,225,11,62,224,250,45,223,233,253,221,213,189,220,
+192,93,219,169,221,217,144,61,216,118,141,214,90,189,212,61,221,210,30,221,208,253,204,206,
+219,172,204,184,92,202,147,12,200,109,156,197,69,28,195,29,140,192,243,219,189,199,43,187,
+155,91,184,110,123,181,64,139,178,16,155,175,224,138,172,175,122,169,126,74,166,75,42,163,
+24,234,159,228,169,156,176,89,153,123,9,150,69,185,146,16,89,143,218,248,139,164,136,136,
+109,40,133,55,184,129,0,88,126,201,231,122,147,135,119,92,23,116,38,183,112,240,86,109,
+187,6,106,133,182,102,80,102,99,28,38,96,232,229,92,181,197,89,130,149,86,81,133,83,
+32,117,80,240,132,77,192,148,74,146,180,71,101,228,68,57,52,66,13,132,63,227,243,60,
+187,115,58,147,3,56,109,179,53,72,99,51,37,67,49,3,51,47,226,50,45,195,66,43,
+166,130,41,138,210,39,112,50,38,87,178,36,64,82,35,43,18,34,23,226,32,6,210,31,
+246,225,30,231,17,30,219,81,29,208,177,28,199,65,28,192,209,27,187,145,27,184,113,27,
+182,113,27,186,1,28,201,81,29,229,113,31,13,82,34,65,242,37,129,82,42,203,82,47,
+32,243,52,127,35,59,231,243,65,88,52,73,207,228,80,77,245,88,209,69,97,89,230,105,
+228,182,114,113,151,123,0,248,136,28,121,154,47,58,171,49,139,186,25,28,200,224,92,211,
+128,253,219,243,205,225,55,110,228,74,142,228,69,14,228,57,14,227,37,158,225,11,174,223,
+233,93,221,192,157,218,144,109,215,90,221,211,30,221,207,219,140,203,147,220,198,69,204,193,
+243,139,188,155,235,182,64,27,177,224,250,170,126,186,164,24,74,158,176,185,151,69,9,145,
+218,72,138,109,120,131,0,152,124,147,199,117,38,7,111,187,86,104,80,198,97,232,85,91,
+130,21,85,32,245,78,192,36,73,101,132,67,13,68,62,187,51,57,109,131,52,37,51,48,
+226,50,44,166,162,40,112,114,37,64,178,34,23,98,32,245,113,30,219,1,29,199,1,28,
+187,129,27,182,161,27,201,65,30,13,18,36,128,178,44,32,243,55,231,131,69,207,212,84,
+209,149,101,228,22,119,0,184,145,47,26,179,24,252,205,128,77,223,53,174,228,70,142,227,
+37,190,224,233,253,219,144,173,213,30,189,205,147,92,196,243,187,185,64,11,174,126,138,161,
+176,105,148,218,216,134,0,56,121,38,167,107,80,134,94,130,5,82,192,84,70,13,180,59,
+109,83,50,226,98,42,112,18,36,23,82,31,219,129,28,186,97,27,203,193,32,128,18,50,
+232,243,76,209,85,110,0,200,162,27,44,216,48,190,228,35,126,222,146,237,209,145,60,191,
+65,219,167,175,185,141,0,88,114,81,54,88,191,212,64,111,35,46,110,146,33,221,81,27,
+208,225,39,229,67,93,0,184,193,41,78,227,128,141,201,72,91,154,0,184,101,184,132,54,
+128,194,28,215,81,62,0,248,219,23,238,173,0,40,82,233,17,36,0,120,225,0,152,30,
+0,136,132,144,136,141,32,105,150,173,41,159,54,154,167,187,186,175,58,123,183,179,203,190,
+36,156,197,140,220,203,235,124,209,64,125,214,138,189,218,201,77,222,252,13,225,34,14,227,
+60,78,228,72,174,228,74,158,228,72,110,228,68,30,228,63,190,227,55,62,227,46,158,226,
+35,222,225,22,254,224,8,14,224,247,253,222,229,205,221,210,125,220,188,29,219,165,157,217,
+140,253,215,114,77,214,86,125,212,56,157,210,25,157,208,249,140,206,215,92,204,179,28,202,
+143,204,199,104,92,197,65,220,194,24,76,192,238,155,189,195,235,186,151,27,184,106,59,181,
+60,91,178,13,91,175,221,90,172,172,74,169,123,42,166,72,250,162,21,202,159,226,137,156,
+174,57,153,121,249,149,68,153,146,15,73,143,217,232,139,163,136,136,109,24,133,54,184,129,
+0,88,126,202,247,122,147,135,119,93,39,116,39,199,112,241,118,109,188,22,106,135,214,102,
+82,134,99,30,70,96,235,21,93,184,229,89,133,197,86,84,181,83,35,181,80,243,180,77,
+196,212,74,150,244,71,105,36,69,61,116,66,18,196,63,232,51,61,191,179,58,152,67,56,
+113,243,53,77,179,51,41,131,49,7,115,47,231,114,45,200,146,43,170,194,41,142,18,40,
+116,114,38,91,242,36,68,146,35,46,66,34,27,18,33,9,2,32,248,17,31,234,49,30,
+221,113,29,210,209,28,201,81,28,194,241,27,188,161,27,184,113,27,182,97,27,184,193,27,
+196,1,29,222,1,31,4,194,33,55,82,37,118,146,41,192,146,46,21,51,52,116,115,58,
+220,67,65,77,148,72,198,84,80,69,117,88,202,229,96,83,166,105,224,134,114,112,135,123,
+0,8,137,32,217,154,54,186,171,58,59,187,36,204,200,235,12,212,138,157,220,251,45,226,
+59,142,228,74,142,228,68,254,227,55,238,226,35,110,225,8,126,223,229,45,221,188,93,218,
+140,45,215,86,141,211,25,157,207,215,60,203,143,140,198,65,140,193,238,75,188,151,171,182,
+60,219,176,221,202,170,123,138,164,21,42,158,174,153,151,68,233,144,217,56,138,109,104,131,
+0,168,124,147,215,117,39,39,111,188,118,104,82,230,97,235,133,91,133,69,85,35,53,79,
+196,100,73,105,196,67,18,132,62,191,131,57,114,211,52,41,115,48,231,130,44,170,226,40,
+116,178,37,68,226,34,27,146,32,248,161,30,221,33,29,201,17,28,188,129,27,182,129,27,
+197,225,29,5,114,35,118,2,44,21,67,55,220,211,68,198,84,84,202,53,101,224,6,119,
+0,248,145,54,186,179,35,172,206,139,205,223,58,190,228,69,110,227,35,142,224,229,205,219,
+140,109,213,25,125,205,143,28,196,238,123,185,60,219,173,123,90,161,174,73,148,217,216,134,
+0,56,121,39,199,107,82,182,94,133,53,82,196,148,70,18,244,59,113,147,50,231,162,42,
+116,66,36,27,130,31,221,161,28,187,81,27,198,65,32,117,98,49,221,83,76,202,21,110,
+0,56,163,39,204,216,53,174,228,33,78,222,143,157,209,141,252,190,61,171,167,173,169,141,
+0,104,114,83,102,88,195,20,65,115,115,46,113,194,33,223,97,27,203,65,39,217,211,92,
+0,72,194,48,46,227,122,93,201,69,43,154,0,232,101,187,180,54,134,226,28,208,193,61,
+0,40,220,21,142,173,0,136,82,235,225,35,0,88,225,0,184,30,0,152,132,146,184,141,
+35,185,150,178,137,159,61,26,168,195,74,176,68,43,184,189,123,191,47,92,198,152,156,204,
+247,60,210,75,45,215,149,93,219,210,205,222,3,126,225,40,94,227,63,110,228,73,174,228,
+73,142,228,71,94,228,67,14,228,61,158,227,53,30,227,44,110,226,33,174,225,20,206,224,
+5,222,223,244,189,222,226,141,221,206,61,220,184,221,218,161,93,217,136,189,215,110,13,214,
+82,61,212,52,93,210,21,93,208,244,60,206,210,28,204,175,220,201,138,124,199,100,12,197,
+61,140,194,20,252,191,234,91,189,191,171,186,147,219,183,102,11,181,56,27,178,10,43,175,
+218,42,172,169,10,169,120,250,165,70,202,162,19,154,159,223,105,156,172,25,153,119,217,149,
+66,137,146,13,41,143,216,216,139,162,120,136,108,24,133,54,184,129,0,88,126,202,247,122,
+148,151,119,94,55,116,40,231,112,243,134,109,190,54,106,137,246,102,84,166,99,33,118,96,
+237,69,93,186,21,90,136,5,87,87,245,83,38,229,80,246,244,77,200,4,75,154,52,72,
+109,100,69,65,180,66,22,20,64,236,131,61,195,3,59,156,147,56,118,51,54,81,243,51,
+46,211,49,12,179,47,235,178,45,204,210,43,174,2,42,146,82,40,120,178,38,95,50,37,
+72,210,35,50,130,34,30,82,33,12,50,32,251,65,31,236,97,30,223,161,29,212,241,28,
+203,113,28,195,1,28,189,177,27,185,129,27,183,97,27,183,161,27,193,177,28,216,145,30,
+253,65,33,46,178,36,107,226,40,181,210,45,9,115,51,104,179,57,209,147,64,67,228,71,
+188,196,79,61,245,87,195,133,96,78,86,105,221,86,114,110,119,123,0,40,137,35,41,155,
+61,58,172,68,235,187,47,140,201,247,204,212,149,45,221,3,142,226,63,158,228,74,126,228,
+67,222,227,53,206,226,32,78,225,5,78,223,226,237,220,184,29,218,136,237,214,82,77,211,
+21,77,207,210,252,202,138,76,198,61,76,193,234,251,187,147,107,182,56,171,176,218,154,170,
+120,106,164,19,250,157,172,121,151,66,217,144,216,40,138,108,104,131,0,168,124,148,231,117,
+40,55,111,190,150,104,84,22,98,237,165,91,136,117,85,38,101,79,200,164,73,109,20,68,
+22,196,62,195,195,57,118,19,53,46,195,48,235,194,44,174,34,41,120,242,37,72,34,35,
+30,194,32,251,193,30,224,65,29,203,49,28,189,145,27,182,113,27,193,129,29,253,225,34,
+107,66,43,9,131,54,209,35,68,188,212,83,195,229,100,221,230,118,0,56,146,61,90,180,
+47,108,207,150,77,224,61,190,228,67,78,227,33,94,224,226,141,219,136,45,213,21,45,205,
+138,220,195,234,59,185,57,171,173,120,58,161,172,41,148,216,200,134,0,72,121,40,231,107,
+84,214,94,136,101,82,199,212,70,22,52,60,118,227,50,235,226,42,120,130,36,30,178,31,
+223,193,28,189,81,27,195,193,31,106,162,48,209,179,75,195,213,109,0,168,163,50,92,217,
+57,158,228,29,30,222,139,77,209,136,188,190,58,107,167,171,153,141,0,120,114,85,166,88,
+198,84,65,120,195,46,117,242,33,227,113,27,199,177,38,206,99,92,0,216,194,54,254,226,
+117,45,201,66,235,153,0,40,102,190,228,54,139,18,29,202,49,61,0,104,220,19,46,173,
+0,232,82,237,161,35,0,56,225,0,216,30,0,168,132,148,232,141,39,9,151,184,249,159,
+68,154,168,204,234,176,78,203,184,200,59,192,59,28,199,164,92,205,3,237,210,87,221,215,
+159,253,219,220,93,223,11,238,225,46,174,227,67,142,228,74,174,228,73,142,228,70,78,228,
+66,254,227,60,142,227,52,254,226,42,78,226,30,142,225,17,174,224,2,174,223,241,141,222,
+223,93,221,203,13,220,181,157,218,157,29,217,132,125,215,106,205,213,77,253,211,48,13,210,
+17,13,208,240,252,205,206,204,203,171,140,201,134,60,199,96,204,196,56,76,194,16,188,191,
+230,27,189,187,107,186,144,155,183,99,203,180,53,235,177,6,235,174,214,234,171,166,234,168,
+117,202,165,67,170,162,16,122,159,221,57,156,170,9,153,117,185,149,65,105,146,12,25,143,
+215,200,139,161,104,136,108,24,133,54,184,129,0,88,126,202,247,122,148,167,119,95,71,116,
+41,247,112,244,166,109,191,86,106,139,6,103,86,214,99,35,150,96,240,101,93,189,69,90,
+139,37,87,90,37,84,42,37,81,250,36,78,203,68,75,157,116,72,112,164,69,69,244,66,
+26,84,64,240,195,61,200,67,59,160,211,56,122,131,54,85,67,52,50,19,50,16,3,48,
+239,2,46,208,18,44,179,66,42,150,146,40,124,242,38,99,114,37,75,2,36,53,178,34,
+33,130,33,15,98,32,254,97,31,239,129,30,226,193,29,214,17,29,204,129,28,196,17,28,
+190,193,27,186,129,27,183,97,27,182,129,27,189,97,28,210,33,30,245,177,32,36,18,36,
+97,50,40,169,34,45,253,178,50,92,243,56,197,211,63,56,68,71,178,36,79,52,117,87,
+188,21,96,72,6,105,217,38,114,108,103,123,0,72,137,39,137,155,68,202,172,78,155,188,
+59,76,202,3,125,213,159,189,221,11,238,226,66,174,228,73,110,228,66,206,227,52,174,226,
+30,30,225,2,30,223,223,189,220,181,221,217,132,173,214,77,13,211,17,13,207,206,172,202,
+134,12,198,56,12,193,230,187,187,144,59,182,53,107,176,214,106,170,117,58,164,16,218,157,
+170,89,151,65,201,144,215,24,138,108,104,131,0,168,124,148,247,117,41,71,111,191,182,104,
+86,54,98,240,213,91,139,165,85,42,165,79,203,212,73,112,84,68,26,4,63,200,3,58,
+122,99,53,50,3,49,239,2,45,179,98,41,124,50,38,75,82,35,33,242,32,254,241,30,
+226,97,29,204,65,28,190,161,27,183,97,27,190,33,29,245,81,34,97,146,42,253,194,53,
+197,115,67,178,68,83,188,133,100,217,198,118,0,104,146,69,250,180,58,44,208,160,205,224,
+64,190,228,66,62,227,31,46,224,222,93,219,133,237,212,16,237,204,134,140,195,230,11,185,
+53,107,173,117,10,161,170,25,148,215,200,134,0,72,121,41,247,107,86,6,95,139,165,82,
+203,4,71,26,132,60,122,35,51,240,34,43,123,178,36,34,226,31,225,209,28,190,81,27,
+192,65,31,96,226,47,198,19,75,187,165,109,0,40,164,62,252,217,61,142,228,26,238,221,
+135,13,209,132,140,190,54,59,167,169,137,141,0,136,114,87,214,88,202,132,65,124,3,47,
+121,34,34,230,129,27,195,17,38,194,227,91,0,120,195,60,206,226,111,237,200,63,187,153,
+0,88,102,193,36,55,145,66,29,196,145,60,0,152,220,18,206,172,0,72,83,238,113,35,
+0,40,225,0,232,30,0,184,132,150,24,142,43,89,151,189,89,160,76,26,169,213,138,177,
+88,123,185,212,235,192,71,220,199,176,28,206,15,173,211,98,141,216,170,157,220,229,237,223,
+19,78,226,51,238,227,69,158,228,74,158,228,72,126,228,70,62,228,65,238,227,58,110,227,
+50,222,226,40,46,226,28,94,225,14,126,224,255,125,223,238,93,222,219,29,221,199,205,219,
+177,93,218,153,221,216,128,61,215,102,141,213,73,189,211,44,205,209,12,205,207,236,188,205,
+202,140,203,166,76,201,129,252,198,91,140,196,52,12,194,12,124,191,226,219,188,184,43,186,
+140,107,183,95,139,180,49,171,177,3,187,174,211,186,171,163,186,168,114,154,165,64,122,162,
+14,90,159,219,25,156,168,233,152,116,169,149,63,89,146,11,9,143,214,184,139,160,104,136,
+107,8,133,54,184,129,0,88,126,202,7,123,149,167,119,96,87,116,42,7,113,245,182,109,
+193,102,106,140,38,103,88,246,99,37,182,96,242,149,93,192,117,90,142,85,87,93,85,84,
+45,85,81,253,100,78,207,132,75,161,164,72,116,228,69,72,52,67,30,148,64,244,3,62,
+204,131,59,165,19,57,127,195,54,90,131,52,54,83,50,20,67,48,244,66,46,212,82,44,
+183,130,42,154,210,40,128,50,39,103,178,37,79,66,36,57,242,34,37,178,33,18,146,32,
+1,146,31,242,177,30,228,225,29,216,49,29,206,161,28,198,33,28,191,209,27,186,145,27,
+184,113,27,182,113,27,187,33,28,205,193,29,237,33,32,27,114,35,86,130,39,158,98,44,
+241,242,49,80,51,56,185,35,63,44,148,70,168,132,78,43,245,86,180,181,95,67,182,104,
+213,246,113,106,87,123,0,104,137,43,233,155,76,90,173,88,75,189,71,12,203,15,61,214,
+170,93,222,19,62,227,69,174,228,73,94,228,65,174,227,50,142,226,28,238,224,255,237,222,
+219,125,220,177,157,217,128,109,214,73,205,210,12,205,206,202,108,202,129,188,197,52,204,192,
+226,139,187,140,251,181,49,59,176,211,58,170,114,10,164,14,186,157,168,73,151,63,185,144,
+214,8,138,107,104,131,0,168,124,149,7,118,42,87,111,193,198,104,88,86,98,242,5,92,
+142,213,85,45,213,79,207,20,74,116,132,68,30,68,63,204,83,58,127,163,53,54,67,49,
+244,66,45,183,162,41,128,114,38,79,146,35,37,34,33,1,34,31,228,129,29,206,97,28,
+191,177,27,183,97,27,187,209,28,237,177,33,86,210,41,241,2,53,185,195,66,168,180,82,
+180,37,100,213,166,118,0,168,146,76,154,181,70,236,208,171,61,225,67,190,228,64,30,227,
+28,254,223,219,29,219,129,157,212,12,173,204,130,76,195,226,203,184,49,59,173,114,234,160,
+168,249,147,214,184,134,0,88,121,42,23,108,88,38,95,142,213,82,207,68,71,30,196,60,
+126,99,51,244,114,43,127,242,36,37,18,32,228,241,28,192,81,27,189,209,30,85,34,47,
+186,115,74,180,101,109,0,168,164,74,156,218,64,126,228,23,190,221,132,189,208,127,76,190,
+51,11,167,167,137,141,0,136,114,89,6,89,205,196,65,129,83,47,124,82,34,233,145,27,
+192,113,37,182,99,91,0,8,196,66,158,226,105,189,200,60,139,153,0,136,102,196,84,55,
+151,114,29,190,1,60,0,200,220,16,126,172,0,152,83,240,65,35,0,8,225,0,8,31,
+0,200,132,152,72,142,47,169,151,195,201,160,84,170,169,222,26,178,99,43,186,223,171,193,
+83,156,200,188,220,206,27,109,212,110,61,217,181,61,221,238,109,224,26,174,226,56,30,228,
+71,174,228,74,158,228,72,110,228,69,46,228,63,206,227,56,78,227,48,190,226,37,14,226,
+25,62,225,11,78,224,252,77,223,235,45,222,216,237,220,195,141,219,173,45,218,150,157,216,
+124,253,214,97,61,213,69,109,211,39,141,209,8,141,207,231,108,205,197,76,203,162,12,201,
+125,172,198,87,76,196,48,204,193,8,60,191,222,155,188,180,235,185,136,43,183,91,91,180,
+46,123,177,255,138,174,208,138,171,160,138,168,111,106,165,62,90,162,11,42,159,217,249,155,
+166,201,152,114,137,149,62,73,146,9,249,142,213,168,139,160,88,136,107,8,133,53,184,129,
+0,88,126,203,7,123,149,183,119,96,103,116,43,23,113,247,198,109,194,134,106,142,70,103,
+90,22,100,39,230,96,245,181,93,194,165,90,145,133,87,96,133,84,48,133,81,1,149,78,
+210,180,75,165,228,72,120,36,70,76,116,67,34,212,64,248,67,62,208,195,59,169,99,57,
+131,3,55,94,195,52,59,163,50,25,131,48,248,130,46,217,162,44,187,210,42,159,18,41,
+132,114,39,106,226,37,83,114,36,61,34,35,40,226,33,21,194,32,4,194,31,245,209,30,
+231,1,30,219,81,29,208,193,28,200,65,28,193,225,27,187,161,27,184,113,27,182,97,27,
+185,241,27,200,97,29,230,161,31,18,210,34,75,210,38,146,162,43,229,50,49,68,115,55,
+173,99,62,33,228,69,157,244,77,34,101,86,172,69,95,61,102,104,209,198,113,104,71,123,
+0,136,137,47,57,156,83,234,173,99,251,189,82,204,203,27,237,214,180,237,222,26,142,227,
+71,174,228,72,78,228,63,158,227,48,94,226,25,206,224,252,189,222,216,61,220,173,93,217,
+124,29,214,69,125,210,8,125,206,197,44,202,125,124,197,48,140,192,222,75,187,136,187,181,
+46,251,175,208,10,170,111,234,163,11,154,157,166,41,151,62,153,144,213,8,138,107,88,131,
+0,184,124,149,7,118,43,119,111,194,230,104,90,118,98,245,37,92,145,5,86,48,21,80,
+210,84,74,120,196,68,34,132,63,208,147,58,131,227,53,59,147,49,248,146,45,187,242,41,
+132,178,38,83,210,35,40,82,33,4,66,31,231,177,29,208,113,28,193,193,27,184,97,27,
+185,129,28,230,33,33,76,34,41,229,66,52,174,19,66,157,36,82,173,213,99,209,134,118,
+0,248,146,84,58,182,82,188,209,182,173,225,69,174,228,63,254,226,26,206,223,215,221,218,
+125,93,212,8,93,204,125,12,195,222,139,184,46,11,173,111,202,160,166,233,147,213,184,134,
+0,88,121,43,39,108,90,70,95,145,5,83,210,132,71,34,4,61,131,179,51,248,178,43,
+131,50,37,41,66,32,230,17,29,193,97,27,187,97,30,74,82,46,174,211,73,172,21,109,
+0,40,165,86,60,219,68,94,228,20,142,221,128,125,208,123,12,190,47,219,166,165,121,141,
+0,152,114,91,54,89,209,4,66,133,147,47,128,130,34,236,177,27,188,209,36,170,227,90,
+0,152,196,72,110,226,100,141,200,58,75,153,0,200,102,198,132,55,156,162,29,184,113,59,
+0,8,221,14,30,172,0,248,83,242,1,35,0,232,224,0,40,31,0,216,132,154,120,142,
+51,249,151,201,57,161,91,42,170,232,186,178,109,219,186,235,107,194,95,92,201,201,156,207,
+39,45,213,122,237,217,191,221,221,247,237,224,33,14,227,60,94,228,73,174,228,74,158,228,
+71,110,228,68,30,228,62,190,227,55,62,227,46,158,226,35,222,225,23,14,225,9,30,224,
+249,29,223,232,237,221,213,173,220,192,93,219,170,237,217,146,93,216,120,189,214,93,253,212,
+65,45,211,35,77,209,4,77,207,227,44,205,193,252,202,158,188,200,121,108,198,83,12,196,
+44,140,193,4,252,190,218,91,188,176,171,185,132,235,182,88,27,180,42,59,177,252,90,174,
+205,90,171,157,90,168,108,74,165,59,42,162,9,10,159,215,217,155,164,169,152,112,105,149,
+60,41,146,8,233,142,212,152,139,159,88,136,106,8,133,53,184,129,0,88,126,203,7,123,
+150,183,119,97,119,116,44,39,113,248,230,109,196,166,106,144,102,103,92,54,100,41,6,97,
+247,229,93,197,197,90,148,181,87,99,181,84,51,181,81,4,213,78,214,244,75,168,36,73,
+124,100,70,80,180,67,38,20,65,252,131,62,212,3,60,173,163,57,135,83,55,98,19,53,
+63,227,50,29,195,48,252,194,46,221,226,44,191,18,43,163,82,41,136,178,39,110,34,38,
+86,178,36,64,98,35,43,34,34,24,242,32,7,242,31,247,1,31,233,49,30,221,113,29,
+210,209,28,201,81,28,194,241,27,188,161,27,185,113,27,182,97,27,183,193,27,196,1,29,
+223,33,31,9,50,34,65,34,38,134,226,42,217,98,48,55,179,54,161,163,61,21,52,69,
+147,84,77,24,229,85,165,213,94,55,22,104,205,150,113,102,55,123,0,168,137,51,169,156,
+91,138,174,109,187,190,95,156,204,39,173,215,191,125,223,33,206,227,72,174,228,71,62,228,
+62,126,227,46,62,226,23,158,224,249,141,222,213,13,220,170,45,217,120,221,213,65,61,210,
+4,61,206,193,236,201,121,60,197,44,76,192,218,11,187,132,139,181,42,203,175,205,218,169,
+108,186,163,9,122,157,164,9,151,60,137,144,212,248,137,106,88,131,0,184,124,150,23,118,
+44,135,111,196,6,105,92,150,98,247,85,92,148,53,86,51,69,80,214,132,74,124,4,69,
+38,196,63,212,211,58,135,35,54,63,211,49,252,210,45,191,50,42,136,226,38,86,2,36,
+43,130,33,7,114,31,233,209,29,210,145,28,194,209,27,185,97,27,184,65,28,223,145,32,
+65,98,40,217,114,51,161,83,65,147,132,81,165,101,99,205,102,118,0,56,147,92,234,182,
+94,124,210,192,13,226,72,158,228,61,238,226,24,158,223,212,173,218,121,29,212,3,29,204,
+121,204,194,218,75,184,43,219,172,108,154,160,164,201,147,212,168,134,0,104,121,44,71,108,
+92,118,95,148,53,83,213,196,71,38,68,61,135,243,51,253,242,43,135,98,37,44,114,32,
+232,33,29,195,113,27,184,1,30,64,146,45,162,35,73,164,213,108,0,184,165,98,204,219,
+71,62,228,17,94,221,124,45,208,118,204,189,44,171,166,163,105,141,0,168,114,93,102,89,
+212,68,66,138,227,47,132,178,34,239,209,27,185,65,36,158,83,90,0,56,197,78,62,226,
+94,93,200,55,27,153,0,248,102,201,180,55,162,210,29,178,209,58,0,56,221,13,190,171,
+0,88,84,243,209,34,0,216,224,0,56,31,0,232,132,157,168,142,56,73,152,208,169,161,
+99,186,170,241,106,179,120,139,187,246,43,195,107,44,202,213,108,208,52,237,213,133,157,218,
+201,109,222,0,94,225,39,110,227,64,126,228,73,174,228,73,142,228,71,94,228,67,14,228,
+61,158,227,53,30,227,44,126,226,33,190,225,20,222,224,6,238,223,246,221,222,228,189,221,
+209,125,220,188,29,219,166,173,217,142,29,216,116,125,214,89,189,212,61,237,210,31,253,208,
+255,252,206,223,236,204,189,188,202,153,124,200,117,44,198,79,188,195,40,76,193,255,187,190,
+214,27,188,172,107,185,128,171,182,84,235,179,39,11,177,249,26,174,202,42,171,154,42,168,
+106,26,165,56,10,162,7,234,158,212,185,155,162,137,152,110,89,149,59,25,146,7,217,142,
+211,136,139,158,72,136,106,248,132,53,168,129,0,104,126,203,23,123,150,199,119,98,135,116,
+45,55,113,249,246,109,197,182,106,146,134,103,94,86,100,44,38,97,249,5,94,200,245,90,
+150,229,87,102,229,84,54,245,81,7,5,79,217,36,76,172,100,73,128,164,70,84,244,67,
+42,84,65,1,196,62,216,83,60,177,227,57,139,147,55,103,83,53,67,35,51,33,19,49,
+1,19,47,225,34,45,195,82,43,167,146,41,140,242,39,114,98,38,90,242,36,68,146,35,
+47,82,34,28,50,33,10,34,32,250,49,31,236,81,30,223,145,29,212,241,28,203,113,28,
+195,1,28,189,177,27,185,129,27,183,97,27,183,145,27,192,161,28,217,177,30,0,162,33,
+55,114,37,123,34,42,205,162,47,43,227,53,149,227,60,10,132,68,136,164,76,15,85,85,
+157,101,94,48,198,103,200,102,113,99,39,123,0,200,137,56,9,157,99,26,175,120,123,191,
+107,92,205,52,93,216,201,13,224,40,14,228,73,174,228,70,46,228,61,94,227,44,30,226,
+20,110,224,246,77,222,209,205,219,166,237,216,116,157,213,61,253,209,255,252,205,189,156,201,
+117,252,196,40,252,191,214,203,186,128,75,181,39,155,175,202,170,169,106,138,163,7,74,157,
+162,233,150,59,121,144,211,232,137,106,88,131,0,184,124,150,39,118,45,151,111,197,38,105,
+94,198,98,249,133,92,150,101,86,54,117,80,217,196,74,128,68,69,42,20,64,216,19,59,
+139,115,54,67,19,50,1,19,46,195,114,42,140,34,39,90,66,36,47,194,33,10,162,31,
+236,241,29,212,177,28,195,225,27,186,97,27,183,1,28,216,1,32,55,178,39,204,178,50,
+149,147,64,136,244,80,157,5,99,200,70,118,0,120,147,100,138,183,107,76,211,203,109,226,
+73,142,228,59,206,226,21,110,223,208,109,218,117,205,211,255,220,203,117,124,194,214,27,184,
+39,155,172,105,122,160,162,169,147,211,168,134,0,104,121,45,103,108,94,150,95,151,117,83,
+217,244,71,42,148,61,139,51,52,1,67,44,139,162,37,48,162,32,235,65,29,197,129,27,
+183,161,29,53,194,44,149,131,72,156,149,108,0,56,166,110,92,220,74,46,228,14,46,221,
+120,237,207,114,156,189,40,123,166,161,89,141,0,184,114,95,150,89,216,116,66,142,35,48,
+136,226,34,242,225,27,182,177,35,146,211,89,0,200,197,84,254,225,88,45,200,52,235,152,
+0,40,103,204,228,55,168,18,30,172,65,58,0,104,221,11,110,171,0,168,84,245,161,34,
+0,184,224,0,88,31,0,248,132,159,232,142,60,169,152,214,41,162,108,74,171,251,10,180,
+131,75,188,3,252,195,120,236,202,226,60,209,64,173,214,145,77,219,212,13,223,8,222,225,
+45,174,227,67,142,228,74,158,228,73,126,228,70,78,228,65,254,227,59,142,227,51,254,226,
+42,78,226,31,142,225,18,190,224,3,190,223,243,173,222,225,141,221,206,61,220,185,237,218,
+162,109,217,138,221,215,112,61,214,85,125,212,57,173,210,27,189,208,251,188,206,218,172,204,
+184,124,202,149,60,200,112,236,197,75,124,195,36,12,193,251,123,190,210,219,187,168,43,185,
+125,123,182,80,171,179,35,203,176,245,234,173,199,250,170,151,250,167,103,234,164,54,218,161,
+4,186,158,210,153,155,160,105,152,109,57,149,57,9,146,6,201,142,210,136,139,157,56,136,
+105,248,132,53,168,129,0,104,126,203,23,123,151,215,119,99,135,116,46,71,113,250,6,110,
+199,214,106,147,166,103,96,118,100,46,86,97,252,53,94,202,37,91,153,21,88,105,21,85,
+57,37,82,11,69,79,221,100,76,176,148,73,131,228,70,88,52,68,46,148,65,5,4,63,
+220,147,60,181,35,58,144,211,55,107,147,53,72,99,51,38,83,49,5,83,47,229,98,45,
+199,146,43,171,210,41,144,50,40,118,162,38,94,34,37,71,210,35,50,130,34,31,98,33,
+13,82,32,253,81,31,238,129,30,225,193,29,214,17,29,205,129,28,197,17,28,191,193,27,
+186,145,27,183,113,27,182,129,27,189,97,28,211,49,30,248,1,33,44,194,36,111,98,41,
+192,210,46,30,35,53,136,19,60,253,195,67,125,4,76,5,197,84,148,229,93,42,102,103,
+196,38,113,97,23,123,0,248,137,60,105,157,108,186,175,131,59,192,120,44,206,64,29,217,
+212,141,224,46,62,228,74,158,228,70,30,228,60,62,227,42,254,225,18,62,224,243,29,222,
+206,157,219,162,173,216,112,93,213,56,189,209,251,172,205,184,92,201,112,172,196,35,188,191,
+210,139,186,125,11,181,35,91,175,199,122,169,103,106,163,4,42,157,160,217,150,57,105,144,
+210,216,137,105,88,131,0,184,124,151,55,118,46,167,111,199,54,105,96,230,98,252,165,92,
+153,149,86,57,181,80,221,4,75,131,132,69,46,84,64,221,99,59,144,179,54,72,99,50,
+5,83,46,200,178,42,144,98,39,94,114,36,50,242,33,13,210,31,238,17,30,214,209,28,
+196,241,27,186,113,27,182,209,27,210,129,31,44,242,38,192,226,49,136,211,63,125,84,80,
+148,165,98,196,22,118,0,200,147,108,58,184,119,12,212,213,205,226,74,126,228,58,174,226,
+19,62,223,205,45,218,113,141,211,251,156,203,113,60,194,210,219,183,36,107,172,103,90,160,
+160,153,147,210,152,134,0,120,121,46,119,108,96,182,95,153,165,83,220,52,72,46,212,61,
+143,115,52,5,131,44,143,226,37,51,210,32,237,97,29,198,145,27,182,65,29,43,2,44,
+137,211,71,148,69,108,0,200,166,123,236,220,77,14,228,11,238,220,117,157,207,109,92,189,
+37,75,166,159,89,141,0,184,114,97,198,89,219,180,66,147,115,48,139,34,35,245,1,28,
+179,33,35,133,67,89,0,88,198,90,206,225,83,253,199,49,171,152,0,104,103,207,20,56,
+173,66,30,166,177,57,0,152,221,9,14,171,0,8,85,247,113,34,0,152,224,0,120,31,
+0,24,133,161,24,143,65,249,152,221,153,162,116,234,171,5,187,180,143,11,189,15,188,196,
+133,188,203,239,252,209,77,109,215,157,253,219,222,157,223,16,78,226,51,254,227,70,158,228,
+74,158,228,72,126,228,69,62,228,64,222,227,58,110,227,50,222,226,40,46,226,28,110,225,
+15,142,224,0,142,223,240,125,222,222,77,221,202,13,220,181,173,218,158,45,217,134,157,215,
+108,253,213,81,61,212,53,109,210,22,125,208,247,124,206,214,92,204,180,60,202,145,252,199,
+108,156,197,70,60,195,32,204,192,247,59,190,206,155,187,164,251,184,121,59,182,77,123,179,
+32,155,176,242,186,173,196,202,170,148,202,167,100,202,164,51,186,161,2,154,158,208,121,155,
+158,89,152,107,41,149,56,233,145,4,185,142,209,120,139,157,56,136,105,232,132,52,168,129,
+0,104,126,204,39,123,151,215,119,99,151,116,47,87,113,252,38,110,200,230,106,149,182,103,
+98,150,100,48,118,97,254,85,94,205,69,91,156,69,88,108,69,85,60,85,82,14,117,79,
+224,148,76,179,212,73,135,20,71,92,116,68,50,212,65,9,68,63,224,211,60,186,115,58,
+148,19,56,111,211,53,76,179,51,42,147,49,9,147,47,234,162,45,203,210,43,175,18,42,
+148,114,40,122,226,38,98,98,37,75,2,36,54,194,34,34,146,33,16,130,32,0,130,31,
+241,161,30,228,225,29,216,49,29,206,161,28,198,49,28,192,209,27,187,145,27,184,113,27,
+182,113,27,186,17,28,205,193,29,240,113,32,34,18,36,99,162,40,179,18,46,17,83,52,
+123,83,59,241,3,67,113,84,75,251,36,84,140,117,93,35,22,103,191,246,112,95,247,122,
+0,24,138,65,217,157,116,90,176,143,251,192,133,252,206,77,205,217,222,29,225,51,110,228,
+74,142,228,69,14,228,58,46,227,40,206,225,15,14,224,240,237,221,202,93,219,158,109,216,
+108,29,213,52,125,209,247,108,205,180,28,201,108,108,196,31,140,191,206,75,186,121,219,180,
+32,43,175,195,74,169,100,58,163,2,10,157,158,185,150,56,89,144,209,216,137,105,72,131,
+0,200,124,151,55,118,47,183,111,200,86,105,98,6,99,254,213,92,156,197,86,61,229,80,
+224,52,75,135,196,69,50,132,64,225,163,59,148,243,54,76,163,50,9,147,46,204,242,42,
+148,162,39,98,178,36,54,34,34,16,2,32,241,65,30,216,225,28,198,1,28,187,129,27,
+182,161,27,205,241,30,34,66,38,179,18,49,123,19,63,113,180,79,140,53,98,191,246,117,
+0,24,148,116,250,184,132,220,212,223,29,227,76,110,228,56,142,226,16,14,223,201,253,217,
+109,77,211,247,92,203,109,252,193,206,155,183,32,59,172,100,58,160,158,121,147,209,152,134,
+0,120,121,47,151,108,98,214,95,156,213,83,224,116,72,50,20,62,147,179,52,9,195,44,
+147,18,38,55,2,33,240,129,29,200,161,27,180,241,28,33,50,43,124,19,71,140,245,107,
+0,104,167,135,140,221,79,238,227,8,206,220,113,93,207,105,28,189,34,27,166,157,73,141,
+0,200,114,99,246,89,222,244,66,151,179,48,143,66,35,248,33,28,177,129,34,121,163,88,
+0,248,198,96,158,225,77,221,199,47,123,152,0,152,103,209,52,56,179,114,30,160,17,57,
+0,200,221,7,190,170,0,88,85,249,65,34,0,120,224,0,152,31,0,40,133,163,88,143,
+69,89,153,228,25,163,125,122,172,16,107,181,154,203,189,28,140,197,146,156,204,252,204,210,
+89,45,216,168,173,220,232,45,224,24,174,226,56,46,228,72,174,228,74,158,228,72,110,228,
+68,46,228,63,206,227,56,78,227,48,190,226,38,14,226,26,62,225,12,94,224,253,93,223,
+237,77,222,219,29,221,199,205,219,177,109,218,155,253,216,130,93,215,104,189,213,77,253,211,
+48,29,210,18,61,208,243,60,206,210,28,204,176,236,201,141,172,199,104,92,197,66,252,194,
+27,124,192,243,251,189,202,91,187,160,187,184,117,251,181,73,59,179,28,107,176,239,138,173,
+192,154,170,145,154,167,97,154,164,49,138,161,0,122,158,206,89,155,156,57,152,105,9,149,
+54,217,145,3,153,142,208,104,139,156,40,136,104,232,132,52,168,129,0,104,126,204,39,123,
+152,231,119,100,167,116,48,119,113,253,54,110,202,6,107,151,214,103,100,182,100,50,150,97,
+0,134,94,207,117,91,159,117,88,111,117,85,64,133,82,17,165,79,228,212,76,183,20,74,
+139,84,71,96,180,68,54,20,66,13,148,63,229,19,61,190,179,58,152,99,56,115,35,54,
+80,243,51,46,211,49,13,211,47,238,242,45,208,18,44,179,82,42,152,178,40,126,18,39,
+101,162,37,79,66,36,57,242,34,37,194,33,19,178,32,3,178,31,244,209,30,230,1,30,
+218,81,29,208,193,28,200,65,28,193,225,27,188,161,27,184,113,27,182,97,27,184,225,27,
+200,97,29,232,225,31,24,98,35,88,226,39,167,66,45,4,115,51,110,131,58,228,67,66,
+102,164,74,240,148,83,131,245,92,28,182,102,187,182,112,93,231,122,0,56,138,69,57,158,
+125,10,177,154,187,193,146,204,207,89,141,218,232,157,225,56,126,228,74,142,228,68,254,227,
+56,14,227,37,174,225,13,222,223,237,189,221,199,29,219,154,45,216,104,221,212,48,45,209,
+243,44,205,176,220,200,104,44,196,27,60,191,202,11,186,117,155,180,29,251,174,192,26,169,
+97,26,163,0,234,156,156,153,150,54,57,144,208,200,137,104,72,131,0,200,124,152,71,118,
+48,215,111,202,118,105,100,38,99,0,246,92,159,245,86,64,21,81,227,116,75,139,4,70,
+54,212,64,229,227,59,152,51,55,80,227,50,13,227,46,208,50,43,152,226,39,102,242,36,
+57,82,34,19,50,32,243,97,30,219,1,29,200,17,28,188,129,27,182,145,27,200,113,30,
+24,130,37,167,66,48,110,83,62,102,4,79,131,213,97,187,214,117,0,88,148,125,170,185,
+145,172,213,232,109,227,76,94,228,54,110,226,14,206,222,198,189,217,105,13,211,242,12,203,
+104,188,193,202,107,183,29,11,172,97,10,160,156,105,147,208,152,134,0,120,121,48,167,108,
+100,6,96,159,5,84,227,164,72,54,84,62,152,3,53,14,3,45,151,82,38,58,66,33,
+242,161,29,202,177,27,180,161,28,24,98,42,111,99,70,131,181,107,0,248,167,148,12,222,
+81,190,227,5,142,220,109,13,207,101,236,188,30,235,165,155,57,141,0,216,114,101,38,90,
+226,36,67,155,3,49,147,130,35,251,81,28,175,1,34,108,19,88,0,136,199,101,94,225,
+71,173,199,44,75,152,0,200,103,212,100,56,185,178,30,155,129,56,0,248,221,5,94,170,
+0,184,85,251,17,34,0,88,224,0,184,31,0,56,133,166,136,143,74,185,153,234,153,163,
+134,26,173,26,27,182,166,155,190,40,92,198,159,108,205,9,157,211,102,253,216,180,93,221,
+242,189,224,32,14,227,61,94,228,73,174,228,73,142,228,71,94,228,67,30,228,62,190,227,
+55,62,227,46,158,226,36,238,225,24,30,225,10,46,224,251,45,223,234,29,222,215,237,220,
+195,157,219,174,61,218,151,189,216,126,45,215,100,125,213,73,189,211,44,221,209,14,237,207,
+239,236,205,206,220,203,172,172,201,136,108,199,100,28,197,62,188,194,23,76,192,239,187,189,
+198,43,187,157,123,184,114,203,181,70,11,179,25,43,176,236,90,173,189,106,170,142,122,167,
+95,122,164,46,106,161,253,89,158,204,57,155,154,25,152,104,233,148,53,201,145,2,137,142,
+207,88,139,155,24,136,104,232,132,52,168,129,0,104,126,204,39,123,152,247,119,101,183,116,
+49,135,113,254,70,110,203,38,107,152,246,103,102,214,100,52,182,97,3,166,94,210,149,91,
+161,149,88,114,165,85,67,181,82,20,229,79,231,4,77,186,68,74,142,148,71,99,228,68,
+57,84,66,17,196,63,233,83,61,194,243,58,156,163,56,120,99,54,84,51,52,50,35,50,
+17,35,48,242,50,46,212,82,44,183,146,42,156,226,40,130,82,39,105,210,37,82,114,36,
+61,34,35,41,242,33,22,226,32,5,226,31,246,241,30,232,33,30,220,113,29,210,209,28,
+201,81,28,194,241,27,189,177,27,185,129,27,183,97,27,183,177,27,195,1,29,224,81,31,
+14,178,34,76,18,39,154,114,44,247,162,50,97,179,57,216,115,65,90,244,73,230,244,82,
+122,117,92,22,86,102,182,134,112,90,215,122,0,104,138,74,169,158,134,170,177,166,139,194,
+159,172,208,102,61,219,242,13,226,61,158,228,74,126,228,67,238,227,55,238,226,35,142,225,
+10,174,223,234,125,221,195,237,218,151,237,215,100,157,212,44,237,208,239,236,204,172,140,200,
+100,236,195,23,12,191,199,219,185,114,107,180,25,203,174,189,234,168,95,234,162,253,201,156,
+154,137,150,53,41,144,207,184,137,104,72,131,0,200,124,152,87,118,49,231,111,203,134,105,
+102,70,99,3,38,93,161,37,87,67,69,81,231,164,75,142,52,70,57,20,65,233,35,60,
+156,131,55,84,35,51,17,35,47,212,114,43,156,34,40,105,34,37,61,146,34,22,98,32,
+246,129,30,221,33,29,201,33,28,189,145,27,182,113,27,195,1,30,14,210,36,154,98,47,
+97,131,61,90,100,78,122,101,97,182,166,117,0,168,148,134,106,186,159,124,214,242,173,227,
+76,62,228,53,78,226,11,158,222,195,125,217,101,205,210,238,204,202,100,124,193,198,43,183,
+25,219,171,94,234,159,154,89,147,207,136,134,0,136,121,49,183,108,102,38,96,162,53,84,
+231,228,72,58,148,62,156,67,53,18,67,45,155,146,38,61,114,33,245,193,29,203,209,27,
+180,97,28,14,146,41,97,163,69,122,101,107,0,152,168,161,156,222,83,158,227,2,94,220,
+105,189,206,97,172,188,27,187,165,153,41,141,0,232,114,103,86,90,229,100,67,159,83,49,
+151,178,35,254,113,28,173,113,33,95,115,87,0,24,200,107,30,225,65,125,199,41,11,152,
+0,8,104,215,148,56,191,242,30,149,241,55,0,40,222,4,14,170,0,8,86,252,225,33,
+0,72,224,0,200,31,0,72,133,168,200,143,79,25,154,242,25,164,143,186,173,37,219,182,
+179,107,191,54,60,199,173,60,206,23,125,212,115,189,217,191,253,221,251,61,225,39,110,227,
+65,142,228,74,174,228,73,142,228,71,94,228,66,14,228,61,158,227,53,30,227,44,126,226,
+33,190,225,21,238,224,7,14,224,248,253,222,231,237,221,212,173,220,192,93,219,170,253,217,
+147,125,216,123,237,214,96,61,213,69,125,211,40,157,209,10,173,207,234,172,205,202,156,203,
+168,108,201,132,44,199,96,220,196,58,124,194,19,12,192,236,123,189,195,235,186,153,75,184,
+110,139,181,66,203,178,22,251,175,232,26,173,186,58,170,140,74,167,92,74,164,44,74,161,
+251,57,158,202,25,155,152,249,151,102,217,148,52,169,145,1,121,142,206,72,139,155,24,136,
+103,216,132,52,168,129,0,104,126,204,55,123,153,247,119,101,199,116,50,151,113,255,102,110,
+204,54,107,154,22,104,104,246,100,54,214,97,5,198,94,212,197,91,164,197,88,116,213,85,
+70,245,82,24,21,80,234,68,77,190,132,74,146,196,71,103,36,69,61,148,66,20,4,64,
+237,147,61,198,51,59,160,227,56,124,163,54,88,115,52,54,99,50,22,99,48,246,114,46,
+216,146,44,187,210,42,160,34,41,133,146,39,109,18,38,86,178,36,64,98,35,44,34,34,
+25,18,33,8,2,32,249,33,31,235,81,30,223,145,29,212,241,28,203,113,28,195,1,28,
+190,177,27,185,129,27,183,97,27,182,145,27,191,161,28,217,209,30,5,18,34,65,82,38,
+141,146,43,233,194,49,83,211,56,202,163,64,77,52,73,219,84,82,113,245,91,14,246,101,
+177,70,112,88,199,122,0,136,138,79,41,159,143,90,178,179,91,195,173,124,209,114,253,219,
+251,125,226,65,174,228,73,110,228,66,222,227,53,206,226,33,94,225,7,142,223,231,77,221,
+192,173,218,147,189,215,96,93,212,40,173,208,234,172,204,168,76,200,96,172,195,19,204,190,
+195,155,185,110,43,180,22,139,174,186,202,168,92,202,162,251,169,156,152,105,150,52,25,144,
+206,184,137,103,72,131,0,200,124,153,87,118,50,247,111,204,166,105,104,102,99,5,70,93,
+164,69,87,70,133,81,234,228,75,146,116,70,61,68,65,237,99,60,160,195,55,88,99,51,
+22,99,47,216,178,43,160,82,40,109,98,37,64,194,34,25,130,32,249,177,30,223,65,29,
+203,49,28,190,161,27,183,97,27,191,145,29,5,18,36,142,146,46,83,179,60,77,180,77,
+113,229,96,177,118,117,0,8,149,143,42,187,173,76,215,251,237,227,76,46,228,51,46,226,
+8,110,222,191,77,217,97,141,210,234,140,202,96,60,193,194,251,182,22,171,171,92,202,159,
+152,57,147,206,136,134,0,136,121,50,215,108,104,70,96,164,101,84,234,20,73,62,212,62,
+160,131,53,22,131,45,159,194,38,65,162,33,248,225,29,205,225,27,180,33,28,5,194,40,
+83,227,68,113,5,107,0,56,169,174,28,223,84,126,227,255,45,220,102,125,206,92,108,188,
+24,139,165,151,41,141,0,232,114,105,134,90,232,164,67,164,147,49,154,226,35,1,146,28,
+172,241,32,82,211,86,0,168,200,112,222,224,60,77,199,39,219,151,0,56,104,217,196,56,
+196,50,31,144,97,55,0,72,222,2,174,169,0,104,86,254,193,33,0,40,224,0,232,31,
+0,104,133,171,8,144,84,121,154,249,169,164,152,90,174,48,155,183,191,43,192,67,12,200,
+186,28,207,36,77,213,127,125,218,202,173,222,5,190,225,45,190,227,68,158,228,74,158,228,
+72,126,228,70,78,228,65,238,227,59,126,227,51,254,226,42,94,226,31,158,225,18,206,224,
+4,222,223,245,205,222,227,173,221,209,125,220,188,45,219,167,189,217,143,61,216,119,173,214,
+92,253,212,65,61,211,36,93,209,6,109,207,230,108,205,197,76,203,163,44,201,128,236,198,
+92,156,196,54,60,194,15,204,191,232,59,189,191,171,186,149,11,184,106,91,181,63,155,178,
+18,203,175,229,234,172,183,10,170,137,26,167,89,26,164,41,26,161,249,9,158,200,249,154,
+150,217,151,100,185,148,50,153,145,0,105,142,205,56,139,154,8,136,103,216,132,51,168,129,
+0,104,126,205,55,123,153,7,120,102,215,116,51,167,113,0,119,110,206,86,107,156,54,104,
+106,22,101,56,6,98,7,246,94,215,245,91,167,245,88,119,5,86,73,37,83,27,69,80,
+238,116,77,193,180,74,150,4,72,107,100,69,65,212,66,24,68,64,241,211,61,202,115,59,
+164,35,57,128,227,54,93,195,52,59,163,50,26,163,48,250,178,46,220,210,44,191,18,43,
+164,98,41,137,210,39,113,82,38,89,226,36,68,146,35,47,98,34,29,66,33,11,50,32,
+252,65,31,238,113,30,225,177,29,214,17,29,205,145,28,197,33,28,191,193,27,186,145,27,
+184,113,27,182,113,27,188,81,28,211,81,30,251,97,33,54,146,37,129,194,42,220,242,48,
+70,3,56,189,227,63,65,116,72,208,180,81,104,101,91,7,150,101,172,6,112,85,167,122,
+0,184,138,84,153,159,153,26,179,191,59,196,187,92,210,127,173,220,5,238,226,68,174,228,
+73,94,228,65,190,227,51,174,226,31,62,225,4,94,223,227,29,221,188,109,218,143,125,215,
+92,29,212,36,109,208,230,92,204,163,12,200,92,108,195,15,140,190,191,91,185,106,251,179,
+18,91,174,183,154,168,89,154,162,249,137,156,150,73,150,50,9,144,205,168,137,103,56,131,
+0,216,124,153,103,118,51,7,112,206,198,105,106,134,99,7,118,93,167,117,87,73,181,81,
+238,20,76,150,180,70,65,132,65,241,163,60,164,3,56,93,179,51,26,163,47,220,242,43,
+164,146,40,113,162,37,68,242,34,29,178,32,252,209,30,225,97,29,205,81,28,191,177,27,
+183,97,27,188,33,29,251,97,35,129,178,45,69,211,59,65,244,76,103,117,96,172,86,117,
+0,88,149,153,234,187,186,28,216,4,30,228,76,30,228,50,14,226,5,62,222,188,13,217,
+93,61,210,230,76,202,92,252,192,191,187,182,19,123,171,89,154,159,150,41,147,205,120,134,
+0,152,121,51,231,108,106,118,96,167,149,84,237,84,73,65,20,63,164,195,53,26,211,45,
+163,2,39,68,210,33,251,1,30,206,241,27,180,241,27,252,241,39,70,35,68,103,181,106,
+0,232,169,187,156,223,85,78,227,252,253,219,98,61,206,88,60,188,20,91,165,149,25,141,
+0,248,114,107,182,90,236,212,67,168,211,49,158,18,36,4,194,28,171,113,32,69,35,86,
+0,56,201,118,158,224,54,45,199,36,155,151,0,120,104,220,228,56,202,114,31,138,209,54,
+0,120,222,0,94,169,0,184,86,0,146,33,0,8,224,0,8,32,0,120,133,174,72,144,
+89,233,154,1,42,165,162,10,175,60,91,184,204,11,193,81,236,200,201,252,207,50,29,214,
+140,61,219,214,77,223,14,62,226,52,14,228,71,174,228,74,158,228,72,126,228,69,62,228,
+64,222,227,58,110,227,50,222,226,40,62,226,29,126,225,16,158,224,2,174,223,242,157,222,
+224,125,221,205,61,220,185,237,218,163,125,217,140,253,215,115,109,214,89,189,212,61,253,210,
+32,29,209,2,45,207,226,44,205,193,12,203,159,236,200,124,172,198,88,92,196,50,252,193,
+11,140,191,228,11,189,187,107,186,145,203,183,103,27,181,59,91,178,15,155,175,226,186,172,
+180,218,169,134,234,166,87,250,163,39,250,160,247,233,157,198,217,154,149,201,151,99,169,148,
+49,137,145,255,88,142,204,56,139,153,8,136,102,216,132,51,168,129,0,104,126,205,55,123,
+154,7,120,103,215,116,52,183,113,1,135,110,207,102,107,157,70,104,107,54,101,58,38,98,
+9,22,95,217,21,92,169,37,89,122,53,86,76,85,83,30,117,80,241,180,77,196,244,74,
+153,68,72,111,164,69,69,4,67,28,132,64,245,19,62,206,179,59,168,99,57,132,35,55,
+97,3,53,63,227,50,30,227,48,254,242,46,224,18,45,195,82,43,167,162,41,141,18,40,
+116,146,38,93,34,37,71,210,35,51,146,34,32,114,33,14,98,32,254,113,31,240,145,30,
+227,209,29,216,49,29,206,161,28,198,49,28,192,209,27,187,145,27,184,113,27,182,97,27,
+185,1,28,204,209,29,242,193,32,42,210,36,116,242,41,206,18,48,55,35,55,175,3,63,
+52,180,71,196,4,81,94,229,90,255,37,101,167,198,111,82,151,122,0,232,138,89,25,160,
+162,202,179,204,27,197,201,44,211,140,93,221,14,78,227,70,174,228,72,94,228,64,174,227,
+50,142,226,29,14,225,2,46,223,224,221,220,185,61,218,140,61,215,89,221,211,32,45,208,
+226,28,204,159,204,199,88,44,195,11,76,190,187,27,185,103,187,179,15,43,174,180,106,168,
+87,122,162,247,105,156,149,57,150,49,249,143,204,152,137,102,56,131,0,216,124,154,119,118,
+52,23,112,207,214,105,107,166,99,9,150,93,169,165,87,76,229,81,241,84,76,153,244,70,
+69,196,65,245,227,60,168,67,56,97,243,51,30,227,47,224,50,44,167,210,40,116,210,37,
+71,50,35,32,226,32,254,1,31,227,129,29,206,97,28,192,177,27,184,97,27,186,193,28,
+242,177,34,116,226,44,55,243,58,52,68,76,94,245,95,167,38,117,0,168,149,162,186,188,
+201,236,216,13,78,228,75,254,227,48,238,225,3,14,222,184,205,216,89,253,209,226,12,202,
+88,188,192,187,123,182,15,75,171,87,122,159,149,9,147,204,120,134,0,152,121,52,7,109,
+107,150,96,169,197,84,241,148,73,69,84,63,168,3,54,30,19,46,167,66,39,72,2,34,
+253,33,30,208,17,28,181,193,27,243,33,39,55,83,67,94,101,106,0,152,170,201,28,224,
+86,46,227,249,205,219,94,237,205,84,252,187,17,59,165,148,9,141,0,8,115,108,214,90,
+239,20,68,172,35,50,162,66,36,7,226,28,170,241,31,55,115,85,0,216,201,123,110,224,
+48,253,198,34,107,151,0,168,104,222,20,57,208,162,31,133,49,54,0,168,222,254,13,169,
+0,8,87,2,98,33,0,232,223,0,40,32,0,136,133,176,136,144,95,73,155,8,186,165,
+172,186,175,72,43,185,217,219,193,95,204,201,215,220,208,64,237,214,153,253,219,225,237,223,
+22,174,226,57,62,228,73,174,228,73,142,228,71,110,228,68,46,228,63,206,227,56,78,227,
+48,190,226,38,14,226,26,78,225,13,110,224,255,125,223,239,109,222,221,77,221,202,13,220,
+181,189,218,159,77,217,136,189,215,111,45,214,85,125,212,57,189,210,28,221,208,254,236,206,
+222,236,204,189,204,202,155,172,200,120,108,198,83,28,196,46,188,193,7,76,191,224,203,188,
+183,59,186,142,155,183,99,235,180,56,43,178,12,107,175,223,138,172,177,170,169,131,202,166,
+84,202,163,37,218,160,244,201,157,196,185,154,147,169,151,97,137,148,47,105,145,253,72,142,
+203,40,139,152,248,135,102,200,132,51,152,129,0,120,126,205,71,123,154,23,120,104,231,116,
+53,199,113,3,167,110,209,134,107,159,102,104,109,86,101,60,70,98,12,54,95,219,69,92,
+172,69,89,125,101,86,79,133,83,33,165,80,244,228,77,200,36,75,157,116,72,114,212,69,
+73,68,67,32,196,64,249,83,62,210,243,59,173,163,57,136,99,55,101,67,53,67,35,51,
+34,35,49,2,51,47,228,82,45,199,146,43,171,226,41,145,82,40,120,194,38,97,82,37,
+75,2,36,54,194,34,35,162,33,17,146,32,1,162,31,243,193,30,230,1,30,218,81,29,
+208,193,28,200,65,28,193,225,27,188,161,27,185,129,27,183,97,27,183,209,27,199,97,29,
+234,33,32,31,18,36,103,34,41,192,50,47,41,67,54,161,51,62,39,228,70,184,84,80,
+84,85,90,248,197,100,161,134,111,80,135,122,0,8,139,94,137,160,172,138,180,217,235,197,
+215,12,212,153,13,222,23,158,227,72,174,228,71,78,228,63,142,227,48,110,226,27,222,224,
+255,253,222,221,173,220,181,253,217,136,253,214,84,157,211,28,237,207,222,220,203,155,140,199,
+83,236,194,7,12,190,183,235,184,99,139,179,12,251,173,177,58,168,84,90,162,244,73,156,
+147,25,150,47,217,143,203,136,137,102,56,131,0,216,124,154,135,118,53,55,112,209,246,105,
+109,198,99,12,182,93,172,213,87,79,21,82,244,132,76,157,36,71,73,4,66,249,35,61,
+173,131,56,101,51,52,34,35,48,228,114,44,172,18,41,120,18,38,75,98,35,35,18,33,
+1,50,31,229,161,29,208,129,28,193,193,27,185,97,27,184,113,28,233,1,34,103,2,44,
+41,35,58,39,132,75,84,133,95,162,6,117,0,8,150,172,122,189,215,188,217,21,126,228,
+74,238,227,47,190,225,255,205,221,181,141,216,85,189,209,222,204,201,84,124,192,183,75,182,
+12,27,171,84,90,159,147,249,146,203,104,134,0,168,121,53,23,109,109,182,96,172,245,84,
+244,196,73,73,148,63,172,67,54,34,83,46,171,130,39,75,66,34,1,82,30,209,33,28,
+182,145,27,235,81,38,41,147,66,84,5,106,0,72,171,214,140,224,87,254,226,246,157,219,
+90,173,205,80,188,187,14,11,165,146,249,140,0,24,115,110,6,91,242,84,68,176,99,50,
+166,114,36,10,18,29,169,129,31,42,195,84,0,104,202,128,30,224,42,221,198,31,59,151,
+0,216,104,225,52,57,214,242,31,128,161,53,0,200,222,252,189,168,0,88,87,4,66,33,
+0,200,223,0,72,32,0,168,133,179,200,144,100,185,155,17,74,166,182,106,176,84,251,185,
+230,187,194,109,188,202,229,188,209,78,205,215,165,189,220,235,125,224,30,30,227,62,110,228,
+74,174,228,73,142,228,71,94,228,67,14,228,62,174,227,54,46,227,46,158,226,36,238,225,
+24,46,225,11,78,224,252,77,223,236,61,222,218,13,221,199,205,219,178,125,218,156,13,217,
+132,141,215,107,237,213,81,61,212,53,109,210,24,157,208,249,172,206,218,172,204,185,140,202,
+151,92,200,116,44,198,79,220,195,42,124,193,4,12,191,220,139,188,180,251,185,138,91,183,
+96,171,180,53,251,177,9,43,175,220,90,172,174,122,169,128,154,166,82,170,163,34,170,160,
+242,169,157,194,153,154,145,137,151,96,121,148,46,89,145,252,56,142,202,24,139,152,232,135,
+101,200,132,51,152,129,0,120,126,205,71,123,155,23,120,104,247,116,54,215,113,4,183,110,
+210,150,107,160,134,104,111,118,101,62,102,98,14,102,95,222,101,92,174,117,89,128,149,86,
+82,181,83,36,229,80,247,20,78,203,100,75,160,180,72,118,20,70,76,132,67,36,4,65,
+252,147,62,214,51,60,177,227,57,140,179,55,105,131,53,71,99,51,38,99,49,7,115,47,
+232,162,45,203,210,43,175,34,42,149,130,40,124,2,39,100,146,37,78,66,36,57,2,35,
+38,210,33,20,194,32,4,194,31,245,225,30,232,33,30,220,113,29,210,225,28,202,97,28,
+194,1,28,189,177,27,185,129,27,183,97,27,182,161,27,194,241,28,226,145,31,21,82,35,
+91,66,40,178,82,46,27,83,53,147,83,61,26,20,70,172,164,79,74,197,89,239,85,100,
+156,70,111,77,103,122,0,56,139,100,9,161,183,74,181,230,219,198,229,236,212,165,189,222,
+31,238,227,73,174,228,70,62,228,62,126,227,46,78,226,24,190,224,252,205,222,218,125,220,
+178,205,217,132,189,214,81,93,211,24,157,207,218,156,203,151,76,199,79,172,194,4,204,189,
+179,171,184,96,91,179,9,203,173,174,10,168,81,42,162,242,41,156,145,9,150,46,201,143,
+202,136,137,101,56,131,0,216,124,155,135,118,54,71,112,210,6,106,111,230,99,14,230,93,
+175,5,88,82,69,82,247,180,76,160,100,71,77,68,66,252,99,61,177,195,56,105,115,52,
+38,115,48,232,178,44,176,82,41,124,66,38,78,146,35,38,66,33,4,82,31,232,193,29,
+210,145,28,194,209,27,186,97,27,183,49,28,225,81,33,91,34,43,27,51,57,26,196,74,
+73,5,95,156,214,116,0,104,150,182,90,190,230,140,218,28,158,228,73,206,227,45,158,225,
+252,157,221,178,93,216,81,125,209,218,124,201,79,60,192,179,11,182,9,235,170,81,42,159,
+145,233,146,202,88,134,0,184,121,54,39,109,111,230,96,175,37,85,247,4,74,77,212,63,
+176,147,54,38,147,46,175,178,39,78,114,34,4,114,30,211,65,28,183,113,27,228,129,37,
+26,179,65,74,165,105,0,248,171,228,12,225,87,222,226,243,109,219,86,109,205,76,140,187,
+11,219,164,144,233,140,0,40,115,112,54,91,245,132,68,180,163,50,170,162,36,13,50,29,
+169,1,31,28,19,84,0,248,202,133,222,223,36,173,198,28,251,150,0,24,105,228,100,57,
+220,50,32,123,17,53,0,232,222,250,93,168,0,184,87,6,34,33,0,168,223,0,104,32,
+0,184,133,182,8,145,106,41,156,25,234,166,193,42,177,96,203,186,244,171,195,123,172,203,
+244,172,210,92,157,216,178,125,221,246,29,225,38,126,227,66,142,228,74,174,228,73,142,228,
+70,78,228,66,254,227,60,158,227,53,30,227,44,126,226,34,206,225,22,254,224,8,30,224,
+249,29,223,233,13,222,215,221,220,195,157,219,174,61,218,152,205,216,128,77,215,103,173,213,
+77,253,211,49,61,210,20,93,208,245,108,206,214,108,204,181,76,202,147,28,200,112,236,197,
+76,156,195,38,60,193,0,204,190,216,75,188,176,187,185,135,43,183,92,123,180,49,203,177,
+6,251,174,217,42,172,172,90,169,126,106,166,79,122,163,32,138,160,240,137,157,192,137,154,
+143,121,151,94,105,148,45,73,145,251,40,142,201,8,139,151,232,135,101,200,132,50,152,129,
+0,120,126,206,71,123,155,39,120,105,7,117,55,231,113,5,199,110,211,166,107,162,150,104,
+113,134,101,64,134,98,16,134,95,224,149,92,177,165,89,130,181,86,84,229,83,39,21,81,
+250,68,78,207,148,75,164,228,72,121,84,70,80,196,67,40,68,65,0,212,62,218,115,60,
+180,35,58,144,227,55,109,195,53,75,163,51,42,163,49,11,179,47,236,210,45,207,18,44,
+179,98,42,153,194,40,128,66,39,104,210,37,82,114,36,61,50,35,41,2,34,23,242,32,
+7,242,31,248,17,31,234,65,30,222,145,29,212,241,28,203,113,28,196,17,28,190,193,27,
+186,129,27,183,97,27,182,129,27,190,145,28,218,241,30,10,146,34,78,114,39,164,98,45,
+12,99,52,133,99,60,12,68,69,160,228,78,63,37,89,231,229,99,150,6,111,74,87,122,
+0,104,139,106,153,161,193,10,182,244,187,199,244,204,213,178,109,223,39,46,228,74,158,228,
+70,46,228,61,94,227,44,46,226,22,142,224,249,157,222,215,61,220,174,141,217,128,125,214,
+77,29,211,20,93,207,214,92,203,147,12,199,75,108,194,0,140,189,176,123,184,92,27,179,
+5,155,173,172,234,167,79,10,162,240,9,156,143,233,149,45,185,143,201,120,137,101,40,131,
+0,232,124,155,151,118,55,87,112,211,38,106,113,6,100,16,6,94,177,37,88,84,117,82,
+251,244,76,164,148,71,80,132,66,0,164,61,181,3,57,109,179,52,42,179,48,236,242,44,
+179,146,41,128,130,38,82,210,35,41,114,33,7,130,31,234,225,29,212,177,28,195,225,27,
+186,113,27,182,241,27,217,161,32,78,66,42,12,83,56,12,4,74,63,117,94,150,166,116,
+0,184,150,193,58,191,245,92,219,35,174,228,72,190,227,44,126,225,249,109,221,174,29,216,
+77,61,209,214,60,201,75,252,191,176,219,181,6,187,170,79,10,159,143,217,146,201,88,134,
+0,184,121,55,55,109,113,6,97,177,85,85,250,52,74,80,20,64,181,211,54,42,211,46,
+179,242,39,82,162,34,7,146,30,212,81,28,184,97,27,221,177,36,11,211,64,63,85,105,
+0,184,172,242,124,225,87,174,226,241,61,219,82,45,205,72,76,187,7,187,164,142,217,140,
+0,56,115,114,86,91,249,196,68,184,227,50,174,210,36,15,98,29,169,145,30,14,83,83,
+0,136,203,139,158,223,31,141,198,26,203,150,0,72,105,230,132,57,225,114,32,117,129,52,
+0,24,223,248,13,168,0,8,88,8,242,32,0,136,223,0,136,32,0,216,133,185,88,145,
+112,153,156,33,138,167,204,234,177,109,155,187,2,140,196,138,140,204,2,141,211,106,125,217,
+191,45,222,0,158,225,45,206,227,69,158,228,74,158,228,72,126,228,69,62,228,65,238,227,
+59,126,227,51,254,226,42,94,226,31,158,225,19,206,224,5,238,223,246,237,222,230,221,221,
+211,173,220,192,93,219,171,13,218,148,157,216,124,13,215,99,109,213,73,189,211,45,237,209,
+16,29,208,241,44,206,210,28,204,177,12,202,143,220,199,108,172,197,71,92,195,34,252,192,
+252,139,190,212,11,188,172,139,185,131,235,182,89,75,180,46,139,177,2,203,174,214,250,171,
+169,42,169,123,74,166,76,90,163,29,106,160,238,105,157,190,105,154,141,89,151,93,73,148,
+43,57,145,250,24,142,200,248,138,150,216,135,100,184,132,50,152,129,0,120,126,206,87,123,
+156,55,120,106,23,117,56,247,113,6,215,110,213,198,107,163,182,104,115,166,101,66,166,98,
+18,166,95,227,181,92,180,197,89,133,229,86,87,21,84,42,69,81,254,132,78,210,196,75,
+167,36,73,125,132,70,84,4,68,44,132,65,4,20,63,222,179,60,185,99,58,148,51,56,
+113,3,54,79,243,51,46,227,49,15,243,47,240,34,46,211,82,44,183,162,42,157,2,41,
+132,114,39,108,2,38,85,178,36,64,98,35,45,50,34,26,34,33,10,34,32,251,65,31,
+237,113,30,225,177,29,214,17,29,205,145,28,197,33,28,191,209,27,187,145,27,184,113,27,
+182,113,27,187,65,28,211,113,30,0,226,33,65,146,38,150,130,44,254,130,51,118,131,59,
+254,115,68,147,36,78,52,133,88,223,117,99,144,182,110,71,55,122,0,152,139,112,41,162,
+204,218,182,2,172,200,3,173,214,191,29,224,45,78,228,75,142,228,69,30,228,59,62,227,
+42,254,225,19,94,224,246,109,222,212,13,220,171,77,217,125,61,214,73,221,210,16,29,207,
+210,28,203,143,204,198,71,44,194,252,75,189,172,59,184,89,235,178,2,107,173,169,186,167,
+76,218,161,238,233,155,141,217,149,43,169,143,200,104,137,100,40,131,0,232,124,156,167,118,
+56,103,112,213,54,106,115,38,100,18,54,94,180,85,88,87,165,82,254,36,77,167,212,71,
+84,196,66,4,228,61,185,67,57,113,243,52,46,243,48,240,50,45,183,210,41,131,194,38,
+85,2,36,44,162,33,10,178,31,237,17,30,214,209,28,197,241,27,187,129,27,181,193,27,
+211,241,31,65,98,41,253,98,55,254,51,73,52,229,93,144,118,116,0,24,151,204,26,192,
+4,29,220,42,190,228,71,158,227,42,78,225,246,61,221,171,221,215,73,253,208,210,252,200,
+71,204,191,172,155,181,2,155,170,76,234,158,141,185,146,200,72,134,0,200,121,56,87,109,
+115,38,97,180,117,85,254,116,74,84,68,64,185,19,55,46,19,47,183,50,40,85,210,34,
+10,194,30,214,113,28,185,81,27,214,241,35,252,242,63,52,245,104,0,120,173,255,236,225,
+87,126,226,238,253,218,78,221,204,68,12,187,4,139,164,141,201,140,0,72,115,115,134,91,
+252,4,69,188,51,51,178,18,37,18,146,29,169,33,30,1,147,82,0,24,204,143,94,223,
+25,109,198,24,139,150,0,136,105,232,164,57,231,178,32,113,241,51,0,56,223,246,189,167,
+0,88,88,10,210,32,0,104,223,0,168,32,0,232,133,188,152,145,118,25,157,42,42,168,
+215,170,178,122,123,188,17,124,197,153,124,205,18,125,212,120,77,218,203,221,222,10,46,226,
+52,30,228,72,174,228,74,158,228,72,110,228,68,46,228,64,222,227,57,110,227,49,222,226,
+40,62,226,29,126,225,17,174,224,3,190,223,243,189,222,227,173,221,208,109,220,188,45,219,
+167,205,217,145,93,216,121,205,214,95,45,213,69,125,211,41,173,209,12,221,207,237,236,205,
+206,220,203,173,204,201,139,156,199,104,108,197,67,28,195,30,188,192,248,75,190,209,219,187,
+169,75,185,127,187,182,85,11,180,43,91,177,255,154,174,211,202,171,166,250,168,120,26,166,
+74,58,163,27,58,160,236,73,157,188,73,154,140,57,151,91,57,148,42,41,145,249,8,142,
+199,248,138,150,216,135,100,184,132,50,152,129,0,120,126,206,87,123,156,55,120,106,23,117,
+57,7,114,7,231,110,214,214,107,165,214,104,116,198,101,68,198,98,20,214,95,229,213,92,
+182,245,89,136,21,87,90,69,84,45,117,81,1,181,78,213,4,76,171,84,73,129,196,70,
+87,52,68,47,196,65,8,84,63,226,243,60,189,163,58,152,115,56,117,67,54,83,51,52,
+50,35,50,19,51,48,244,98,46,215,146,44,187,226,42,161,66,41,135,178,39,111,66,38,
+89,226,36,68,162,35,48,98,34,29,82,33,13,82,32,253,97,31,239,145,30,227,209,29,
+216,49,29,206,161,28,199,49,28,192,225,27,188,161,27,184,113,27,182,97,27,184,241,27,
+204,225,29,246,49,33,53,194,37,136,146,43,238,146,50,103,147,58,239,147,67,134,100,77,
+41,229,87,214,245,98,138,118,110,68,39,122,0,200,139,118,169,162,215,170,183,17,156,201,
+18,141,215,203,189,224,52,126,228,74,142,228,68,14,228,58,30,227,40,222,225,17,62,224,
+243,61,222,208,205,219,167,29,217,121,253,213,69,157,210,12,221,206,206,220,202,139,140,198,
+67,236,193,248,27,189,168,251,183,85,187,178,255,58,173,166,138,167,74,186,161,236,201,155,
+140,185,149,42,153,143,199,104,137,100,40,131,0,232,124,156,167,118,57,119,112,214,86,106,
+116,70,100,20,86,94,182,133,88,90,213,82,1,85,77,171,20,72,88,244,66,8,36,62,
+189,131,57,117,51,53,50,51,49,244,114,45,187,18,42,135,242,38,89,66,36,48,210,33,
+13,210,31,239,49,30,216,241,28,198,1,28,188,129,27,182,145,27,204,81,31,53,130,40,
+238,114,54,239,99,72,41,101,93,138,70,116,0,120,151,215,250,192,19,221,220,48,206,228,
+69,142,227,40,46,225,243,13,221,168,157,215,69,205,208,206,188,200,67,140,191,169,91,181,
+255,106,170,74,202,158,140,169,146,199,72,134,0,200,121,57,103,109,116,70,97,182,165,85,
+1,181,74,87,132,64,189,83,55,50,67,47,187,114,40,88,2,35,13,226,30,216,129,28,
+187,65,27,208,49,35,237,18,63,41,149,104,0,56,174,13,77,226,86,94,226,235,205,218,
+73,157,204,65,220,186,1,107,164,139,185,140,0,88,115,117,166,91,255,52,69,191,115,51,
+183,66,37,21,178,29,170,193,29,243,210,81,0,168,204,148,14,223,19,61,198,21,91,150,
+0,184,105,235,212,57,237,2,33,108,97,51,0,88,223,244,109,167,0,168,88,12,178,32,
+0,72,223,0,200,32,0,8,134,191,232,145,124,153,157,51,202,168,227,122,179,136,91,189,
+32,108,198,169,124,206,33,109,213,134,45,219,216,141,223,20,174,226,58,94,228,73,174,228,
+73,142,228,71,110,228,68,30,228,63,190,227,56,78,227,48,190,226,38,30,226,27,94,225,
+14,126,224,0,158,223,241,141,222,224,109,221,205,61,220,185,253,218,164,157,217,141,29,216,
+117,157,214,92,237,212,65,61,211,37,125,209,8,157,207,233,172,205,202,156,203,169,140,201,
+135,92,199,100,44,197,64,220,194,26,124,192,244,27,190,205,155,187,165,27,185,124,123,182,
+82,219,179,39,43,177,252,106,174,208,170,171,163,202,168,118,250,165,71,10,163,25,26,160,
+234,41,157,186,41,154,138,41,151,90,25,148,41,9,145,248,248,141,199,232,138,149,200,135,
+99,184,132,50,152,129,0,120,126,206,87,123,157,71,120,107,39,117,58,23,114,8,7,111,
+215,246,107,166,230,104,118,230,101,70,230,98,22,246,95,231,5,93,185,21,90,138,69,87,
+93,101,84,48,165,81,4,229,78,217,52,76,174,148,73,132,244,70,91,116,68,51,244,65,
+12,148,63,230,51,61,192,227,58,156,179,56,121,131,54,87,115,52,54,99,50,23,115,48,
+248,146,46,219,210,44,191,34,43,164,114,41,139,242,39,115,114,38,92,18,37,71,210,35,
+51,162,34,32,130,33,15,114,32,0,146,31,242,177,30,229,241,29,218,81,29,208,193,28,
+200,81,28,193,241,27,188,161,27,185,129,27,183,97,27,183,177,27,198,97,29,236,129,32,
+40,226,36,122,162,42,223,146,49,87,163,57,224,179,66,120,148,76,29,69,87,205,117,98,
+132,38,110,65,7,122,0,248,139,124,73,163,227,122,184,32,156,202,33,109,216,216,77,225,
+57,158,228,74,126,228,67,254,227,56,14,227,38,190,225,14,14,224,240,13,222,205,157,219,
+164,221,216,117,205,213,65,93,210,8,157,206,202,156,202,135,76,198,64,172,193,244,219,188,
+165,203,183,82,123,178,252,10,173,163,90,167,71,154,161,234,169,155,138,169,149,41,137,143,
+198,88,137,99,40,131,0,232,124,157,183,118,58,135,112,215,102,106,118,102,100,22,118,94,
+185,181,88,93,5,83,4,149,77,174,68,72,91,52,67,12,100,62,192,195,57,121,115,53,
+54,115,49,248,178,45,191,66,42,139,50,39,92,114,36,51,2,34,16,2,32,242,81,30,
+218,1,29,200,17,28,189,145,27,182,113,27,199,193,30,40,162,39,223,114,53,224,147,71,
+29,197,92,132,22,116,0,232,151,226,234,193,34,157,221,54,222,228,68,110,227,39,254,224,
+240,221,220,164,93,215,65,141,208,202,124,200,63,76,191,165,43,181,252,58,170,72,154,158,
+138,153,146,199,56,134,0,216,121,57,119,109,118,118,97,184,213,85,4,229,74,91,196,64,
+193,147,55,54,131,47,191,178,40,92,50,35,16,18,31,217,161,28,188,49,27,202,113,34,
+222,34,62,30,37,104,0,8,175,28,173,226,85,46,226,233,157,218,69,93,204,61,156,186,
+254,58,164,137,169,140,0,104,115,119,214,91,2,117,69,195,179,51,187,114,37,23,226,29,
+171,97,29,228,2,81,0,56,205,153,206,222,13,29,198,19,27,150,0,248,105,237,244,57,
+243,66,33,103,209,50,0,120,223,242,29,167,0,248,88,14,146,32,0,40,223,0,232,32,
+0,40,134,195,56,146,131,25,158,61,122,169,239,74,180,149,75,190,47,108,199,184,108,207,
+48,93,214,148,253,219,228,61,224,29,30,227,63,126,228,74,174,228,73,142,228,71,94,228,
+66,14,228,61,174,227,54,46,227,46,158,226,36,238,225,25,46,225,12,94,224,253,109,223,
+238,93,222,220,61,221,202,13,220,182,189,218,160,93,217,137,221,215,113,93,214,88,189,212,
+61,253,210,33,45,209,4,93,207,229,92,205,197,92,203,165,76,201,131,28,199,96,236,196,
+60,156,194,22,60,192,240,219,189,201,91,187,161,219,184,120,75,182,79,155,179,36,251,176,
+249,58,174,205,122,171,160,170,168,115,202,165,69,234,162,22,250,159,232,9,157,184,9,154,
+136,9,151,88,9,148,39,249,144,247,232,141,198,216,138,148,200,135,99,168,132,49,152,129,
+0,120,126,206,103,123,157,71,120,108,55,117,58,39,114,9,23,111,217,6,108,168,6,105,
+120,6,102,72,6,99,25,22,96,234,37,93,187,69,90,141,101,87,96,149,84,51,213,81,
+7,21,79,220,116,76,177,196,73,136,52,71,95,180,68,55,52,66,16,212,63,234,115,61,
+196,35,59,160,243,56,125,195,54,91,179,52,58,179,50,27,179,48,252,226,46,223,18,45,
+195,98,43,168,178,41,143,50,40,119,178,38,96,82,37,74,2,36,54,210,34,36,178,33,
+18,162,32,3,178,31,244,225,30,231,33,30,220,113,29,210,225,28,202,97,28,195,1,28,
+189,177,27,185,129,27,183,97,27,182,145,27,193,241,28,227,209,31,28,18,36,108,178,41,
+208,162,48,72,163,56,209,195,65,107,196,75,17,149,86,195,245,97,125,214,109,61,231,121,
+0,40,140,131,217,163,239,90,185,47,156,203,48,77,217,228,221,225,62,174,228,73,110,228,
+66,222,227,54,238,226,36,158,225,12,222,223,238,205,221,202,93,219,160,157,216,113,141,213,
+61,29,210,4,93,206,198,92,202,131,12,198,60,108,193,240,155,188,161,139,183,79,75,178,
+249,218,172,160,58,167,69,106,161,232,137,155,136,137,149,39,121,143,198,72,137,99,24,131,
+0,248,124,157,199,118,58,151,112,217,134,106,120,134,100,25,166,94,187,213,88,96,53,83,
+7,197,77,177,132,72,95,116,67,16,164,62,196,3,58,125,179,53,58,179,49,252,242,45,
+195,130,42,143,114,39,96,178,36,54,66,34,18,50,32,244,113,30,220,33,29,202,49,28,
+190,161,27,183,97,27,194,49,30,28,194,38,208,114,52,209,179,70,17,53,92,125,230,115,
+0,72,152,238,218,194,50,77,222,59,206,228,66,94,227,37,206,224,237,157,220,161,29,215,
+60,77,208,198,60,200,59,28,191,162,235,180,249,10,170,69,122,158,136,137,146,198,56,134,
+0,216,121,58,135,109,120,150,97,187,5,86,7,37,75,94,244,64,197,211,55,58,195,47,
+196,242,40,95,114,35,19,66,31,219,177,28,190,65,27,197,193,33,206,50,61,18,197,103,
+0,216,175,42,13,227,84,254,225,230,93,218,65,29,204,57,92,186,250,26,164,136,153,140,
+0,120,115,120,246,91,6,181,69,199,243,51,191,178,37,26,18,30,172,1,29,214,50,80,
+0,184,205,158,126,222,7,253,197,16,235,149,0,40,106,240,20,58,249,146,33,98,81,50,
+0,152,223,240,205,166,0,72,89,16,114,32,0,8,223,0,8,33,0,56,134,198,136,146,
+137,153,158,71,42,170,251,26,181,164,59,191,62,92,200,200,108,208,64,77,215,163,205,220,
+240,221,224,37,142,227,67,158,228,74,158,228,72,126,228,70,78,228,66,254,227,60,158,227,
+53,30,227,44,126,226,34,206,225,22,14,225,9,46,224,251,61,223,235,45,222,217,13,221,
+198,221,219,178,141,218,157,29,217,134,173,215,110,29,214,84,125,212,57,189,210,29,253,208,
+0,29,207,225,44,205,194,28,203,161,12,201,127,236,198,92,172,196,56,92,194,19,12,192,
+237,155,189,198,43,187,158,155,184,117,11,182,75,107,179,33,187,176,246,10,174,202,74,171,
+157,122,168,112,154,165,67,186,162,20,218,159,229,233,156,182,233,153,135,249,150,87,233,147,
+38,233,144,246,216,141,197,200,138,148,184,135,99,168,132,49,152,129,0,120,126,207,103,123,
+157,87,120,108,71,117,59,55,114,10,39,111,218,38,108,169,22,105,121,38,102,74,38,99,
+27,54,96,236,85,93,189,117,90,144,149,87,99,197,84,54,5,82,10,85,79,223,164,76,
+181,4,74,139,116,71,98,228,68,58,116,66,19,4,64,237,179,61,200,99,59,164,51,57,
+129,3,55,95,243,52,62,227,50,31,243,48,0,19,47,227,82,45,199,146,43,172,242,41,
+146,98,40,122,242,38,99,130,37,78,50,36,58,2,35,39,226,33,21,210,32,5,226,31,
+247,1,31,234,65,30,222,145,29,212,241,28,203,113,28,196,17,28,190,193,27,186,145,27,
+184,113,27,182,113,27,189,129,28,219,49,31,16,66,35,93,194,40,192,162,47,56,179,55,
+194,211,64,92,244,74,5,229,85,185,117,97,119,134,109,58,215,121,0,104,140,137,121,164,
+251,58,186,62,156,204,63,45,218,240,109,226,66,190,228,73,94,228,66,206,227,53,206,226,
+34,110,225,9,190,223,235,157,221,198,45,219,157,109,216,110,77,213,57,221,209,0,29,206,
+194,28,202,127,204,197,56,60,193,237,107,188,158,91,183,75,27,178,246,170,172,157,10,167,
+67,74,161,229,105,155,135,121,149,38,105,143,197,72,137,99,24,131,0,248,124,157,199,118,
+59,167,112,218,150,106,121,166,100,27,198,94,189,5,89,99,101,83,10,245,77,181,180,72,
+98,164,67,19,212,62,200,67,58,129,243,53,62,243,49,0,51,46,199,194,42,146,162,39,
+99,226,36,58,114,34,21,82,32,247,161,30,222,65,29,203,65,28,190,177,27,183,81,27,
+190,161,29,16,226,37,193,114,51,194,211,69,5,149,91,119,166,115,0,184,152,250,218,195,
+66,13,223,64,206,228,64,78,227,35,174,224,234,109,220,158,221,214,57,13,208,194,252,199,
+55,220,190,158,187,180,246,234,169,67,90,158,134,121,146,197,40,134,0,232,121,59,151,109,
+122,182,97,189,37,86,10,85,75,98,52,65,201,19,56,62,3,48,199,50,41,98,162,35,
+22,98,31,221,193,28,192,65,27,192,1,33,190,50,60,6,85,103,0,168,176,56,109,227,
+83,222,225,228,45,218,61,221,203,54,44,186,247,250,163,134,137,140,0,136,115,122,22,92,
+9,229,69,202,51,52,195,226,37,28,50,30,173,161,28,200,98,79,0,72,206,163,62,222,
+1,221,197,14,171,149,0,104,106,242,52,58,255,210,33,93,193,49,0,184,223,238,125,166,
+0,152,89,18,82,32,0,232,222,0,40,33,0,88,134,202,232,146,144,25,159,81,234,170,
+8,251,181,178,43,192,78,108,201,216,124,209,79,61,216,177,157,221,251,125,225,45,222,227,
+70,174,228,74,158,228,72,126,228,69,62,228,65,238,227,59,126,227,51,254,226,42,94,226,
+32,174,225,20,222,224,7,254,223,248,13,223,232,253,221,214,221,220,195,157,219,175,77,218,
+153,237,216,130,109,215,106,221,213,80,61,212,53,125,210,25,189,208,252,220,206,221,236,204,
+190,220,202,157,204,200,123,156,198,88,108,196,52,28,194,15,204,191,233,107,189,194,235,186,
+154,107,184,113,219,181,72,59,179,30,139,176,243,218,173,199,26,171,155,74,168,110,122,165,
+64,154,162,18,186,159,227,201,156,180,217,153,133,217,150,85,217,147,37,217,144,245,200,141,
+196,184,138,147,184,135,98,168,132,49,152,129,0,120,126,207,103,123,158,87,120,109,87,117,
+60,71,114,11,55,111,219,54,108,171,54,105,123,54,102,76,70,99,29,86,96,238,117,93,
+192,149,90,146,197,87,101,245,84,57,53,82,13,133,79,226,212,76,184,52,74,143,164,71,
+102,36,69,62,164,66,23,68,64,241,243,61,204,163,59,168,115,57,133,67,55,99,51,53,
+66,35,51,35,51,49,4,83,47,231,146,45,203,210,43,176,50,42,150,162,40,126,34,39,
+103,194,37,81,114,36,61,50,35,42,18,34,24,2,33,8,18,32,249,49,31,236,97,30,
+224,177,29,214,17,29,205,145,28,197,33,28,191,209,27,187,145,27,184,113,27,182,97,27,
+186,49,28,211,145,30,5,114,34,79,210,39,177,146,46,40,163,54,178,227,63,78,20,74,
+248,36,85,175,245,96,112,38,109,54,183,121,0,168,140,144,25,165,8,43,187,78,156,205,
+79,13,219,252,221,226,69,190,228,72,94,228,65,190,227,51,174,226,32,78,225,6,142,223,
+232,109,221,195,253,218,153,45,216,106,13,213,53,157,209,252,220,205,190,220,201,123,140,197,
+52,252,192,233,43,188,154,27,183,72,235,177,243,122,172,155,234,166,64,42,161,227,73,155,
+133,89,149,37,89,143,196,56,137,98,24,131,0,248,124,158,215,118,60,183,112,219,182,106,
+123,198,100,29,230,94,192,37,89,101,149,83,13,37,78,184,244,72,102,228,67,23,20,63,
+204,131,58,133,51,54,66,51,50,4,115,46,203,2,43,150,226,39,103,18,37,61,162,34,
+24,130,32,250,193,30,224,97,29,205,81,28,191,177,27,184,81,27,187,49,29,4,2,37,
+177,114,50,178,227,68,248,244,90,112,102,115,0,24,153,7,219,196,81,173,223,68,206,228,
+63,46,227,33,126,224,230,61,220,154,157,214,52,205,207,190,172,199,51,156,190,155,123,180,
+242,186,169,64,58,158,133,89,146,196,40,134,0,232,121,60,183,109,123,214,97,192,85,86,
+14,149,75,101,116,65,205,99,56,66,67,48,204,114,41,102,210,35,26,146,31,223,225,28,
+193,65,27,188,97,32,175,50,59,249,244,102,0,136,177,70,189,227,81,174,225,226,237,217,
+56,173,203,50,236,185,244,218,163,132,121,140,0,152,115,124,54,92,12,37,70,206,99,52,
+200,34,38,30,98,30,175,81,28,186,130,78,0,216,206,167,238,221,252,188,197,12,123,149,
+0,152,106,244,84,58,4,35,34,89,49,49,0,216,223,236,45,166,0,232,89,20,50,32,
+0,200,222,0,72,33,0,120,134,205,56,147,152,169,159,91,154,171,21,219,182,193,43,193,
+94,108,202,233,124,210,95,45,217,191,109,222,6,14,226,53,46,228,72,174,228,73,142,228,
+72,110,228,68,46,228,63,206,227,57,94,227,49,222,226,40,62,226,30,142,225,17,190,224,
+4,222,223,245,221,222,229,205,221,211,173,220,192,109,219,171,29,218,150,173,216,126,45,215,
+102,157,213,76,253,211,49,61,210,21,125,208,248,156,206,217,172,204,186,156,202,153,140,200,
+119,108,198,84,44,196,48,236,193,11,140,191,229,43,189,190,187,186,151,43,184,110,155,181,
+69,11,179,27,91,176,240,170,173,196,234,170,152,42,168,107,74,165,62,122,162,16,154,159,
+225,169,156,178,185,153,131,185,150,84,201,147,36,201,144,243,184,141,195,184,138,146,168,135,
+98,152,132,49,136,129,0,136,126,207,119,123,158,103,120,110,87,117,61,87,114,13,71,111,
+220,70,108,172,86,105,125,86,102,78,102,99,31,118,96,240,149,93,194,197,90,149,229,87,
+104,37,85,60,101,82,16,181,79,229,4,77,187,116,74,146,228,71,105,84,69,66,228,66,
+27,132,64,245,35,62,208,227,59,172,163,57,137,131,55,103,115,53,70,99,51,39,115,49,
+8,147,47,235,210,45,207,18,44,180,114,42,154,226,40,130,98,39,106,242,37,85,162,36,
+64,98,35,45,66,34,27,50,33,11,50,32,252,81,31,239,129,30,226,209,29,216,49,29,
+207,177,28,199,65,28,193,225,27,188,161,27,184,129,27,183,97,27,184,225,27,203,1,30,
+250,161,33,65,226,38,161,146,45,23,163,53,162,227,62,63,52,73,235,116,84,165,101,96,
+104,214,108,51,151,121,0,216,140,152,185,165,21,27,188,95,156,206,95,253,219,7,78,227,
+72,174,228,71,78,228,64,158,227,49,142,226,30,30,225,4,94,223,229,61,221,192,189,218,
+150,237,215,102,205,212,49,93,209,248,156,205,186,156,201,119,76,197,48,188,192,229,235,187,
+151,235,182,69,187,177,240,74,172,152,186,166,62,10,161,225,57,155,131,57,149,36,73,143,
+195,40,137,98,24,131,0,248,124,158,231,118,61,199,112,220,214,106,125,214,100,31,6,95,
+194,85,89,104,197,83,16,85,78,187,36,73,105,36,68,27,84,63,208,195,58,137,115,54,
+70,115,50,8,179,46,207,66,43,154,34,40,106,82,37,64,210,34,27,178,32,252,225,30,
+226,129,29,207,113,28,192,193,27,185,97,27,184,193,28,249,17,36,161,114,49,161,243,67,
+235,84,90,104,54,115,0,136,153,20,235,197,97,93,224,71,190,228,61,30,227,31,78,224,
+227,13,220,151,109,214,48,141,207,186,108,199,47,108,190,151,75,180,239,154,169,62,26,158,
+131,73,146,195,24,134,0,248,121,61,199,109,125,246,97,194,117,86,17,197,75,105,164,65,
+209,163,56,70,131,48,208,162,41,105,2,36,29,194,31,225,241,28,195,81,27,185,177,31,
+159,34,58,236,132,102,0,88,178,84,253,227,78,126,225,223,173,217,52,109,203,47,172,185,
+240,186,163,131,105,140,0,168,115,125,86,92,16,101,70,209,163,52,204,98,38,33,146,30,
+178,17,28,172,178,77,0,88,207,171,158,221,246,140,197,10,59,149,0,216,106,246,132,58,
+10,115,34,85,177,48,0,248,223,233,221,165,0,56,90,23,18,32,0,152,222,0,120,33,
+0,152,134,209,152,147,159,73,160,102,106,172,34,187,183,209,43,194,111,124,203,250,124,211,
+111,29,218,205,45,223,17,158,226,59,110,228,74,174,228,73,142,228,71,94,228,67,30,228,
+62,190,227,56,78,227,48,190,226,38,30,226,28,94,225,15,142,224,1,174,223,242,173,222,
+226,157,221,208,109,220,189,45,219,168,221,217,146,125,216,123,253,214,98,109,213,73,189,211,
+46,13,210,17,61,208,244,92,206,213,108,204,182,92,202,149,76,200,115,44,198,80,236,195,
+44,172,193,7,92,191,226,235,188,187,123,186,147,251,183,107,107,181,65,219,178,23,43,176,
+237,122,173,193,186,170,149,250,167,105,42,165,59,74,162,14,106,159,223,137,156,177,153,153,
+130,169,150,82,169,147,34,169,144,242,168,141,194,168,138,146,168,135,97,152,132,49,136,129,
+0,136,126,207,119,123,159,103,120,110,103,117,62,103,114,14,103,111,222,102,108,174,102,105,
+126,118,102,79,134,99,33,166,96,242,197,93,197,229,90,151,21,88,107,85,85,63,149,82,
+19,229,79,233,52,77,191,164,74,149,20,72,109,148,69,69,36,67,30,180,64,249,99,62,
+212,35,60,176,227,57,141,195,55,107,179,53,74,163,51,43,179,49,12,211,47,239,2,46,
+210,82,44,183,162,42,158,18,41,133,146,39,110,50,38,88,226,36,67,162,35,48,114,34,
+30,98,33,14,98,32,255,129,31,241,177,30,229,241,29,218,81,29,208,193,28,200,81,28,
+194,241,27,189,177,27,185,129,27,183,97,27,182,161,27,197,113,29,239,225,32,51,242,37,
+145,146,44,6,147,52,145,227,61,47,84,72,222,164,83,154,197,95,97,118,108,47,119,121,
+0,24,141,159,105,166,34,27,189,111,172,207,111,221,220,17,174,227,74,174,228,70,62,228,
+63,142,227,47,110,226,28,254,224,1,46,223,226,13,221,188,141,218,146,189,215,98,157,212,
+46,29,209,244,108,205,182,92,201,115,12,197,44,124,192,225,187,187,147,187,182,65,139,177,
+237,26,172,149,154,166,59,218,160,223,25,155,130,41,149,34,41,143,194,40,137,97,24,131,
+0,248,124,159,231,118,62,215,112,222,230,106,126,246,100,33,54,95,197,117,89,107,245,83,
+19,133,78,191,84,73,109,84,68,31,148,63,212,3,59,141,179,54,74,163,50,12,243,46,
+210,114,43,158,82,40,110,130,37,68,2,35,30,226,32,255,17,31,228,161,29,209,129,28,
+193,209,27,186,97,27,182,97,28,239,49,35,145,98,48,145,243,66,222,164,89,97,246,114,
+0,248,153,33,251,198,113,237,224,74,174,228,59,254,226,30,30,224,224,221,219,147,45,214,
+45,93,207,183,44,199,44,44,190,148,27,180,236,106,169,60,250,157,129,57,146,194,8,134,
+0,8,122,62,215,109,127,22,98,196,165,86,20,245,75,108,228,65,212,227,56,73,179,48,
+211,226,41,109,50,36,32,242,31,226,17,29,197,97,27,182,33,31,143,18,57,223,20,102,
+0,72,179,99,77,228,76,94,225,221,125,217,47,45,203,43,108,185,237,154,163,129,73,140,
+0,200,115,127,118,92,19,165,70,213,227,52,209,146,38,35,178,30,180,193,27,157,194,76,
+0,232,207,176,94,221,240,124,197,7,11,149,0,8,107,249,148,58,16,179,34,80,33,48,
+0,24,224,231,157,165,0,120,90,25,242,31,0,120,222,0,152,33,0,184,134,213,248,147,
+167,217,160,113,42,173,48,171,184,225,59,195,128,140,204,11,141,212,127,13,219,218,237,223,
+27,30,227,64,142,228,74,158,228,72,142,228,70,78,228,66,14,228,61,174,227,54,46,227,
+46,158,226,36,254,225,25,62,225,13,110,224,255,125,223,239,125,222,223,109,221,205,61,220,
+185,253,218,164,173,217,142,61,216,119,189,214,95,45,213,69,125,211,42,205,209,13,253,207,
+240,28,206,209,44,204,178,28,202,145,12,200,111,236,197,76,172,195,40,108,193,4,28,191,
+222,187,188,183,59,186,144,203,183,103,59,181,62,155,178,20,251,175,234,74,173,190,138,170,
+146,202,167,102,250,164,57,42,162,11,74,159,221,105,156,175,121,153,128,137,150,81,153,147,
+33,153,144,241,152,141,193,152,138,145,152,135,97,152,132,48,136,129,0,136,126,208,119,123,
+159,119,120,111,119,117,63,119,114,15,119,111,223,118,108,175,134,105,128,150,102,81,166,99,
+35,198,96,245,229,93,199,21,91,154,69,88,110,133,85,66,197,82,22,21,80,236,116,77,
+194,212,74,153,68,72,112,212,69,73,84,67,34,244,64,252,163,62,216,99,60,180,35,58,
+145,3,56,111,243,53,78,227,51,47,243,49,16,19,48,243,66,46,214,146,44,187,226,42,
+161,82,41,137,210,39,114,98,38,92,18,37,71,210,35,51,162,34,33,146,33,17,146,32,
+1,162,31,243,209,30,231,17,30,220,113,29,210,225,28,202,97,28,195,1,28,190,193,27,
+186,129,27,184,113,27,182,129,27,192,241,28,229,33,32,38,2,37,129,130,43,245,130,51,
+128,211,60,31,100,71,208,228,82,143,53,95,89,22,108,43,87,121,0,88,141,167,25,167,
+48,27,190,128,188,208,127,189,221,27,254,227,75,158,228,69,46,228,61,110,227,45,78,226,
+25,206,224,254,253,222,223,205,220,185,93,218,143,125,215,94,93,212,42,221,208,240,28,205,
+178,28,201,111,204,196,40,60,192,222,123,187,144,123,182,62,75,177,234,234,171,146,106,166,
+57,186,160,221,249,154,128,25,149,33,25,143,193,24,137,97,24,131,0,248,124,159,247,118,
+63,247,112,223,246,106,128,22,101,35,86,95,199,165,89,110,37,84,22,197,78,194,148,73,
+112,148,68,34,212,63,216,67,59,145,243,54,78,243,50,16,51,47,214,178,43,162,146,40,
+113,178,37,71,66,35,33,18,33,2,66,31,231,193,29,211,161,28,195,225,27,187,113,27,
+181,17,28,229,81,34,129,82,47,128,243,65,208,244,88,89,182,114,0,104,154,47,27,200,
+128,125,225,76,142,228,58,238,226,27,238,223,221,173,219,144,237,213,41,29,207,179,236,198,
+40,252,189,144,219,179,233,58,169,57,202,157,128,41,146,193,8,134,0,8,122,63,231,109,
+128,70,98,199,213,86,23,53,76,112,20,66,216,35,57,77,243,48,215,34,42,112,98,36,
+35,34,32,229,33,29,198,129,27,180,145,30,128,242,55,209,164,101,0,40,180,113,141,228,
+73,46,225,219,61,217,43,253,202,40,44,185,234,122,163,128,57,140,0,216,115,128,150,92,
+22,229,70,216,19,53,213,210,38,37,226,30,183,129,27,143,226,75,0,104,208,180,14,221,
+234,76,197,5,219,148,0,56,107,251,196,58,22,3,35,76,161,47,0,40,224,229,77,165,
+0,200,90,27,226,31,0,88,222,0,184,33,0,216,134,217,88,148,175,121,161,125,250,173,
+62,171,185,241,75,196,145,172,205,28,157,213,143,253,219,232,157,224,36,142,227,68,158,228,
+74,158,228,72,126,228,70,78,228,65,254,227,60,142,227,53,30,227,44,126,226,34,222,225,
+23,30,225,10,62,224,252,77,223,236,77,222,220,61,221,201,13,220,182,205,218,161,109,217,
+139,253,215,115,125,214,91,237,212,65,77,211,38,141,209,10,189,207,236,220,205,205,236,203,
+174,236,201,141,204,199,107,172,197,72,124,195,37,44,193,0,220,190,218,123,188,180,11,186,
+140,139,183,100,251,180,59,107,178,17,203,175,231,26,173,188,106,170,144,170,167,99,218,164,
+55,10,162,9,42,159,219,73,156,173,105,153,126,121,150,79,137,147,32,137,144,240,136,141,
+192,152,138,145,136,135,96,136,132,48,136,129,0,136,126,208,135,123,160,135,120,111,119,117,
+63,135,114,16,135,111,224,134,108,177,150,105,130,166,102,83,198,99,37,230,96,247,5,94,
+201,53,91,157,101,88,112,165,85,68,245,82,25,69,80,239,164,77,197,4,75,156,132,72,
+116,4,70,76,148,67,38,52,65,0,228,62,219,147,60,184,99,58,149,67,56,115,35,54,
+82,35,52,51,51,50,20,83,48,246,130,46,218,194,44,191,34,43,165,146,41,141,18,40,
+117,162,38,95,66,37,74,2,36,55,210,34,36,194,33,20,194,32,4,210,31,246,241,30,
+233,49,30,222,145,29,212,241,28,203,129,28,196,17,28,191,193,27,186,145,27,184,113,27,
+182,113,27,188,129,28,220,113,31,24,18,36,113,114,42,228,98,50,111,195,59,15,100,70,
+194,20,82,131,149,94,81,182,107,39,55,121,0,168,141,175,201,167,62,27,191,145,204,209,
+143,141,222,37,62,228,75,142,228,69,30,228,60,78,227,44,46,226,23,174,224,252,221,222,
+220,157,220,182,29,218,139,61,215,91,29,212,38,157,208,236,236,204,174,220,200,107,156,196,
+37,12,192,218,75,187,140,75,182,59,27,177,231,186,171,144,74,166,55,154,160,219,217,154,
+126,249,148,32,9,143,193,8,137,96,8,131,0,8,125,160,7,119,63,7,113,224,22,107,
+130,54,101,37,118,95,201,197,89,112,85,84,25,245,78,197,196,73,116,196,68,38,4,64,
+219,115,59,149,51,55,82,35,51,20,115,47,218,242,43,165,210,40,117,242,37,74,114,35,
+36,50,33,4,98,31,233,225,29,212,193,28,196,241,27,187,129,27,181,209,27,219,129,33,
+113,66,46,111,243,64,194,68,88,81,102,114,0,232,154,62,59,201,144,13,226,78,126,228,
+56,206,226,25,190,223,218,125,219,140,173,213,37,221,206,175,172,198,36,188,189,141,171,179,
+230,26,169,55,170,157,126,25,146,193,8,134,0,8,122,63,247,109,130,102,98,201,245,86,
+26,101,76,115,84,66,220,99,57,81,51,49,219,98,42,116,146,36,38,82,32,231,65,29,
+200,145,27,178,1,30,112,210,54,194,36,101,0,24,181,127,205,228,70,254,224,217,253,216,
+38,189,202,37,236,184,231,90,163,126,41,140,0,232,115,130,182,92,25,37,71,219,83,53,
+218,18,39,39,18,31,186,65,27,129,242,74,0,232,208,184,190,220,229,44,197,3,155,148,
+0,120,107,253,228,58,27,83,35,72,33,47,0,72,224,227,253,164,0,24,91,29,194,31,
+0,56,222,0,216,33,0,248,134,222,184,148,183,25,162,137,218,174,77,171,186,2,92,197,
+163,204,206,46,157,214,159,221,220,245,93,225,45,238,227,71,174,228,74,158,228,72,126,228,
+69,62,228,64,238,227,58,126,227,51,254,226,42,94,226,32,190,225,21,238,224,8,30,224,
+249,45,223,234,29,222,217,13,221,198,221,219,179,141,218,158,61,217,135,205,215,112,77,214,
+87,173,212,61,13,211,34,77,209,6,125,207,232,156,205,202,172,203,170,172,201,137,140,199,
+103,108,197,69,60,195,33,252,192,252,155,190,215,59,188,176,219,185,137,91,183,97,203,180,
+56,59,178,14,155,175,228,234,172,185,58,170,141,122,167,97,186,164,52,234,161,7,10,159,
+217,41,156,171,73,153,125,89,150,78,105,147,31,121,144,239,136,141,192,136,138,144,136,135,
+96,136,132,48,136,129,0,136,126,208,135,123,160,135,120,112,135,117,64,135,114,17,151,111,
+225,166,108,178,182,105,131,198,102,85,230,99,39,6,97,249,37,94,204,85,91,159,149,88,
+115,213,85,71,37,83,28,117,80,242,212,77,200,68,75,159,180,72,119,68,70,80,212,67,
+41,116,65,4,20,63,223,211,60,187,163,58,153,131,56,119,99,54,86,99,52,54,115,50,
+24,147,48,250,194,46,222,2,45,195,98,43,169,194,41,144,66,40,121,210,38,98,130,37,
+77,50,36,58,2,35,39,242,33,22,226,32,7,242,31,248,33,31,235,81,30,224,177,29,
+214,17,29,205,145,28,198,33,28,192,209,27,187,145,27,184,113,27,182,97,27,185,33,28,
+211,177,30,11,50,35,97,114,41,210,66,49,93,179,58,254,99,69,179,52,81,119,245,93,
+73,86,107,34,23,121,0,232,141,183,137,168,77,43,192,163,220,210,159,93,223,45,110,228,
+75,142,228,68,30,228,59,62,227,42,14,226,21,126,224,249,173,222,217,109,220,179,237,217,
+136,13,215,87,221,211,34,109,208,232,172,204,170,156,200,103,92,196,33,204,191,214,11,187,
+137,27,182,56,235,176,228,154,171,141,26,166,52,122,160,217,185,154,125,233,148,31,249,142,
+192,8,137,96,8,131,0,8,125,160,7,119,64,23,113,225,38,107,131,86,101,39,150,95,
+204,245,89,115,117,84,28,37,79,200,244,73,119,4,69,42,68,64,223,179,59,153,115,55,
+86,99,51,24,163,47,222,50,44,169,2,41,120,34,38,77,162,35,39,98,33,7,146,31,
+235,1,30,214,209,28,197,241,27,188,129,27,181,161,27,211,177,32,97,50,45,93,227,63,
+179,132,87,73,38,114,0,104,155,77,107,202,160,141,226,79,110,228,55,190,226,23,158,223,
+215,77,219,137,109,213,33,157,206,171,108,198,32,124,189,137,123,179,227,234,168,52,138,157,
+124,9,146,192,248,133,0,24,122,64,7,110,132,134,98,204,37,87,29,149,76,119,148,66,
+224,163,57,85,115,49,223,162,42,119,194,36,41,114,32,233,81,29,201,161,27,177,129,29,
+96,162,53,179,164,100,0,8,182,142,253,228,67,222,224,216,189,216,34,141,202,33,172,184,
+227,58,163,125,9,140,0,8,116,131,214,92,29,101,71,223,131,53,222,82,39,40,50,31,
+189,17,27,114,2,74,0,104,209,188,110,220,223,28,197,1,107,148,0,168,107,255,244,58,
+33,163,35,68,161,46,0,88,224,225,173,164,0,104,91,31,178,31,0,24,222,0,248,33,
+0,24,135,226,40,149,192,201,162,149,186,175,93,171,187,19,124,198,181,236,207,63,173,215,
+175,205,221,1,254,225,53,62,228,73,174,228,73,142,228,71,110,228,68,46,228,63,206,227,
+57,94,227,49,222,226,40,62,226,30,142,225,18,206,224,5,238,223,247,253,222,231,237,221,
+213,205,220,195,157,219,175,93,218,154,253,216,132,141,215,108,13,214,83,125,212,57,205,210,
+30,13,209,2,61,207,228,92,205,198,108,203,166,108,201,133,76,199,99,44,197,65,252,194,
+29,188,192,248,107,190,211,11,188,173,155,185,133,27,183,93,155,180,52,11,178,11,107,175,
+225,186,172,182,10,170,138,90,167,94,138,164,50,186,161,5,234,158,215,9,156,169,41,153,
+123,73,150,76,89,147,29,105,144,238,120,141,191,120,138,143,120,135,96,136,132,48,136,129,
+0,136,126,208,135,123,160,151,120,113,151,117,65,151,114,18,167,111,227,182,108,180,198,105,
+133,230,102,87,6,100,41,38,97,251,85,94,206,133,91,162,181,88,118,5,86,74,85,83,
+31,165,80,245,4,78,204,116,75,163,244,72,123,116,70,83,4,68,45,164,65,8,84,63,
+227,19,61,191,227,58,156,179,56,123,163,54,90,163,52,58,179,50,28,211,48,254,2,47,
+226,66,45,199,162,43,173,2,42,148,130,40,124,18,39,102,178,37,81,114,36,61,66,35,
+43,34,34,25,18,33,10,34,32,251,65,31,238,129,30,226,209,29,216,49,29,207,177,28,
+199,65,28,193,225,27,188,161,27,185,129,27,183,97,27,183,209,27,203,17,30,255,65,34,
+81,98,40,193,34,48,75,147,57,237,99,68,163,84,80,107,69,93,64,230,106,30,247,120,
+0,56,142,192,73,169,93,75,193,181,252,211,175,45,224,52,158,228,74,126,228,67,254,227,
+57,30,227,40,238,225,18,94,224,246,125,222,214,61,220,175,173,217,132,205,214,83,157,211,
+30,45,208,228,108,204,166,92,200,99,28,196,29,140,191,211,219,186,133,219,181,52,187,176,
+225,106,171,138,234,165,50,90,160,215,153,154,123,201,148,29,233,142,191,248,136,96,8,131,
+0,8,125,160,23,119,65,39,113,227,70,107,133,118,101,41,182,95,206,37,90,118,165,84,
+31,85,79,204,52,74,123,52,69,45,132,64,227,243,59,157,179,55,90,163,51,28,227,47,
+226,114,44,173,66,41,124,98,38,81,210,35,42,146,33,10,178,31,238,33,30,216,241,28,
+199,17,28,189,145,27,182,113,27,204,225,31,81,18,44,75,195,62,163,196,86,64,214,113,
+0,232,155,92,139,203,175,253,226,80,78,228,53,158,226,20,110,223,212,13,219,133,45,213,
+29,93,206,167,60,198,28,76,189,134,75,179,224,186,168,50,106,157,123,233,145,191,248,133,
+0,24,122,65,39,110,133,166,98,206,85,87,32,197,76,122,196,66,228,211,57,89,179,49,
+227,226,42,123,2,37,44,162,32,236,113,29,203,193,27,176,17,29,81,130,52,164,36,100,
+0,248,182,156,45,229,64,174,224,214,125,216,29,77,202,30,108,184,224,42,163,123,249,139,
+0,24,116,133,230,92,32,165,71,226,195,53,227,146,39,42,98,31,192,225,26,100,18,73,
+0,232,209,192,30,220,217,252,196,255,42,148,0,232,107,1,21,59,39,243,35,64,33,46,
+0,120,224,222,109,164,0,168,91,34,146,31,0,232,221,0,40,34,0,72,135,231,152,149,
+201,121,163,162,154,176,109,187,188,37,172,199,200,12,209,81,205,216,191,173,222,13,158,226,
+60,126,228,74,174,228,73,142,228,71,94,228,67,30,228,62,190,227,55,78,227,48,190,226,
+38,30,226,28,110,225,16,158,224,3,190,223,244,205,222,228,189,221,211,157,220,192,109,219,
+172,45,218,151,205,216,128,93,215,105,205,213,80,61,212,54,141,210,26,205,208,254,252,206,
+224,28,205,194,44,203,162,44,201,130,28,199,96,252,196,61,188,194,25,124,192,245,43,190,
+207,203,187,169,107,185,130,235,182,90,107,180,49,219,177,8,59,175,222,154,172,179,234,169,
+136,42,167,92,106,164,48,154,161,3,202,158,213,249,155,168,25,153,121,41,150,75,73,147,
+28,89,144,237,104,141,190,104,138,143,120,135,95,120,132,48,136,129,0,136,126,208,151,123,
+161,151,120,113,167,117,66,167,114,19,183,111,228,198,108,181,230,105,135,246,102,88,22,100,
+43,70,97,253,117,94,208,165,91,164,229,88,120,37,86,77,117,83,34,213,80,248,52,78,
+207,164,75,166,36,73,126,164,70,87,68,68,49,228,65,11,148,63,231,83,61,195,19,59,
+160,243,56,127,227,54,94,227,52,62,243,50,32,19,49,2,67,47,230,130,45,202,210,43,
+176,66,42,151,178,40,128,66,39,105,226,37,84,162,36,64,114,35,45,82,34,28,66,33,
+12,82,32,253,113,31,240,161,30,228,241,29,218,81,29,208,193,28,201,81,28,194,241,27,
+189,177,27,185,129,27,183,97,27,182,145,27,196,113,29,243,97,33,65,66,39,175,2,47,
+56,99,56,219,83,67,147,116,79,94,149,92,55,118,106,25,199,120,0,120,142,201,25,170,
+109,107,194,200,28,213,191,237,224,59,174,228,74,110,228,67,238,227,56,254,226,38,206,225,
+16,46,224,244,77,222,211,13,220,172,125,217,128,157,214,80,109,211,26,237,207,225,44,204,
+162,28,200,96,220,195,25,92,191,207,155,186,130,171,181,49,139,176,222,58,171,136,202,165,
+48,58,160,213,137,154,121,185,148,28,217,142,190,248,136,95,8,131,0,8,125,161,23,119,
+66,55,113,228,86,107,135,134,101,43,214,95,208,69,90,120,213,84,34,133,79,207,100,74,
+126,116,69,49,180,64,231,51,60,160,243,55,94,227,51,31,35,48,230,162,44,176,114,41,
+128,146,38,84,2,36,45,194,33,12,226,31,240,65,30,218,17,29,200,33,28,189,161,27,
+182,97,27,197,33,31,65,242,42,56,163,61,147,244,85,55,150,113,0,104,156,109,203,204,
+190,109,227,80,62,228,52,142,226,18,62,223,209,221,218,129,253,212,26,29,206,163,252,197,
+25,12,189,130,11,179,222,154,168,48,90,157,121,217,145,190,232,133,0,40,122,66,55,110,
+135,198,98,208,117,87,34,5,77,126,4,67,231,19,58,93,243,49,230,18,43,127,50,37,
+47,210,32,238,129,29,204,209,27,176,161,28,66,66,51,147,164,99,0,232,183,171,93,229,
+60,142,224,212,77,216,24,29,202,27,44,184,221,10,163,122,217,139,0,56,116,134,6,93,
+35,229,71,229,243,53,232,194,39,44,130,31,196,177,26,85,34,72,0,104,210,195,222,219,
+211,220,196,252,250,147,0,24,108,4,53,59,45,51,36,61,161,45,0,136,224,220,29,164,
+0,248,91,36,130,31,0,200,221,0,72,34,0,104,135,236,8,150,211,41,164,175,138,177,
+125,219,189,56,204,200,219,60,210,99,221,217,206,125,223,25,46,227,66,158,228,74,158,228,
+72,126,228,70,78,228,66,14,228,61,158,227,54,46,227,46,158,226,36,254,225,26,78,225,
+13,126,224,0,158,223,241,157,222,225,141,221,207,109,220,189,61,219,169,237,217,147,141,216,
+125,29,215,101,157,213,76,253,211,50,77,210,23,157,208,250,188,206,221,220,204,190,236,202,
+158,236,200,126,220,198,92,188,196,57,140,194,22,76,192,241,251,189,204,155,187,166,43,185,
+127,187,182,87,59,180,46,171,177,5,11,175,219,106,172,176,186,169,133,250,166,90,58,164,
+45,122,161,1,170,158,211,217,155,166,249,152,120,25,150,74,41,147,27,73,144,236,88,141,
+189,104,138,142,104,135,95,120,132,47,136,129,0,136,126,209,151,123,161,167,120,114,167,117,
+67,183,114,20,199,111,229,230,108,182,246,105,136,22,103,90,54,100,45,102,97,255,149,94,
+211,213,91,166,21,89,123,85,86,80,165,83,37,5,81,251,100,78,210,212,75,169,84,73,
+129,228,70,90,116,68,52,20,66,15,196,63,234,131,61,199,83,59,164,51,57,130,35,55,
+98,35,53,66,51,51,35,83,49,6,131,47,233,194,45,206,18,44,180,114,42,155,242,40,
+131,130,39,109,34,38,87,210,36,67,162,35,49,130,34,31,114,33,15,114,32,0,146,31,
+243,193,30,230,17,30,220,113,29,210,225,28,202,113,28,195,1,28,190,193,27,186,145,27,
+184,113,27,182,113,27,190,225,28,231,145,32,50,50,38,157,210,45,37,67,55,200,51,66,
+131,132,78,81,229,91,45,6,106,20,167,120,0,200,142,210,249,170,125,139,195,219,60,214,
+207,157,225,64,190,228,73,94,228,66,222,227,54,238,226,37,174,225,13,14,224,241,29,222,
+207,221,219,169,61,217,125,93,214,76,45,211,22,173,207,221,236,203,158,236,199,92,156,195,
+22,28,191,204,107,186,127,123,181,46,91,176,219,10,171,133,170,165,45,26,160,211,105,154,
+120,169,148,27,201,142,189,232,136,95,248,130,0,24,125,161,39,119,67,71,113,229,102,107,
+136,166,101,45,246,95,211,101,90,123,5,85,37,181,79,210,148,74,129,164,69,52,244,64,
+234,115,60,164,35,56,98,35,52,35,99,48,234,226,44,180,178,41,131,210,38,87,50,36,
+49,242,33,15,2,32,243,97,30,219,33,29,202,49,28,190,177,27,183,81,27,192,113,30,
+49,210,41,37,131,60,131,20,85,46,70,113,0,248,156,125,251,205,204,189,227,79,30,228,
+51,110,226,15,14,223,206,173,218,126,189,212,22,237,205,159,188,197,21,220,188,127,219,178,
+219,106,168,45,58,157,120,201,145,189,232,133,0,40,122,67,71,110,136,214,98,210,165,87,
+37,53,77,129,52,67,235,83,58,97,35,50,234,82,43,130,98,37,50,2,33,241,161,29,
+205,241,27,177,81,28,52,18,50,131,20,99,0,232,184,185,141,229,56,110,224,211,253,215,
+19,237,201,24,236,183,217,250,162,121,201,139,0,72,116,135,22,93,39,37,72,232,35,54,
+237,18,40,45,162,31,200,129,26,71,34,71,0,232,210,199,142,219,206,188,196,250,186,147,
+0,88,108,6,85,59,50,131,36,57,33,45,0,152,224,218,221,163,0,56,92,38,114,31,
+0,168,221,0,104,34,0,152,135,241,136,150,220,233,164,189,138,178,142,251,190,75,12,202,
+238,108,211,118,237,218,221,77,224,35,158,227,70,174,228,74,158,228,72,126,228,69,62,228,
+65,238,227,59,142,227,52,14,227,44,126,226,34,222,225,23,30,225,11,78,224,253,109,223,
+238,109,222,222,93,221,204,61,220,185,253,218,165,189,217,144,93,216,121,221,214,97,93,213,
+72,189,211,46,29,210,19,93,208,246,140,206,217,172,204,186,172,202,154,172,200,122,156,198,
+88,124,196,54,76,194,18,12,192,238,187,189,200,91,187,162,251,184,123,123,182,83,251,179,
+43,123,177,2,219,174,216,58,172,174,138,169,131,218,166,87,26,164,43,90,161,254,137,158,
+209,185,155,164,217,152,118,249,149,72,25,147,26,57,144,235,72,141,188,88,138,141,104,135,
+94,120,132,47,136,129,0,136,126,209,151,123,162,167,120,115,183,117,68,199,114,21,215,111,
+230,246,108,184,22,106,138,54,103,92,86,100,47,134,97,2,182,94,213,245,91,169,53,89,
+125,133,86,82,213,83,40,53,81,254,148,78,213,20,76,173,148,73,133,20,71,94,180,68,
+56,84,66,18,4,64,238,195,61,202,147,59,168,115,57,134,99,55,102,99,53,70,99,51,
+39,131,49,10,179,47,237,242,45,210,82,44,184,178,42,159,50,41,135,178,39,112,82,38,
+91,18,37,71,210,35,52,178,34,34,162,33,18,162,32,3,194,31,245,241,30,233,49,30,
+222,145,29,212,1,29,204,129,28,197,33,28,191,209,27,187,145,27,184,113,27,182,97,27,
+186,113,28,221,193,31,35,34,37,138,178,44,18,3,54,181,19,65,114,132,77,67,37,91,
+36,134,105,15,119,120,0,24,143,220,217,171,142,187,196,238,92,215,222,61,226,68,190,228,
+72,94,228,65,206,227,52,206,226,35,126,225,11,222,223,238,237,221,204,157,219,165,13,217,
+121,29,214,72,237,210,19,109,207,217,172,203,154,172,199,88,92,195,18,236,190,200,43,186,
+123,75,181,43,43,176,216,234,170,131,122,165,43,250,159,209,73,154,118,137,148,26,185,142,
+188,232,136,94,248,130,0,24,125,162,39,119,68,87,113,230,134,107,138,198,101,47,22,96,
+213,149,90,125,37,85,40,229,79,213,196,74,133,228,69,56,36,65,238,179,60,168,99,56,
+102,99,52,39,163,48,237,34,45,184,242,41,135,2,39,91,114,36,52,34,34,18,50,32,
+245,145,30,221,65,29,204,65,28,191,177,27,184,81,27,188,209,29,34,178,40,18,83,59,
+114,52,84,36,246,112,0,152,157,143,59,207,219,13,228,79,254,227,50,78,226,13,222,222,
+203,109,218,122,125,212,18,173,205,155,124,197,18,156,188,123,171,178,216,58,168,43,26,157,
+118,185,145,188,232,133,0,40,122,68,87,110,138,246,98,213,213,87,40,101,77,133,116,67,
+238,147,58,101,99,50,238,146,43,134,162,37,53,50,33,243,193,29,206,17,28,177,1,28,
+37,210,48,113,116,98,0,216,185,199,173,229,52,62,224,209,189,215,14,189,201,21,172,183,
+214,218,162,119,169,139,0,104,116,137,54,93,42,101,72,235,83,54,242,82,40,47,210,31,
+204,97,26,57,50,70,0,104,211,202,62,219,200,156,196,248,138,147,0,136,108,8,117,59,
+56,211,36,54,161,44,0,168,224,215,141,163,0,136,92,41,98,31,0,120,221,0,152,34,
+0,184,135,246,8,151,231,185,165,204,138,179,160,43,192,94,76,203,2,157,212,136,253,219,
+236,29,225,45,14,228,72,174,228,73,158,228,72,110,228,68,46,228,64,222,227,58,126,227,
+51,254,226,42,110,226,33,190,225,21,254,224,9,46,224,251,61,223,236,77,222,219,45,221,
+201,13,220,182,205,218,162,125,217,140,29,216,118,173,214,94,29,213,69,141,211,42,221,209,
+15,29,208,243,76,206,213,108,204,182,124,202,151,124,200,118,92,198,85,60,196,50,12,194,
+14,204,191,234,139,189,197,43,187,159,187,184,120,75,182,80,203,179,40,75,177,255,170,174,
+213,10,172,171,106,169,128,186,166,85,250,163,41,58,161,252,105,158,208,153,155,162,201,152,
+117,233,149,71,9,147,25,41,144,234,56,141,188,72,138,141,88,135,94,104,132,47,136,129,
+0,136,126,209,167,123,162,183,120,115,199,117,68,215,114,22,231,111,231,6,109,185,38,106,
+139,70,103,94,118,100,48,166,97,4,214,94,215,21,92,171,85,89,128,165,86,85,5,84,
+43,101,81,1,197,78,216,68,76,176,196,73,136,84,71,97,228,68,59,132,66,22,68,64,
+242,3,62,206,211,59,171,179,57,138,147,55,105,147,53,74,163,51,43,195,49,13,243,47,
+241,50,46,214,130,44,187,242,42,162,98,41,138,242,39,116,146,38,94,66,37,74,2,36,
+55,226,34,37,194,33,20,210,32,5,226,31,247,17,31,235,81,30,223,161,29,214,17,29,
+205,145,28,198,49,28,192,225,27,188,161,27,184,113,27,183,97,27,184,1,28,211,241,30,
+20,18,36,120,114,43,254,194,52,162,227,63,96,132,76,52,85,90,25,6,105,10,87,120,
+0,104,143,231,185,172,160,235,197,2,141,216,237,221,226,72,190,228,71,78,228,65,174,227,
+51,174,226,33,94,225,8,190,223,236,189,221,201,109,219,162,205,216,118,237,213,69,173,210,
+15,61,207,213,108,203,151,108,199,85,44,195,14,172,190,197,251,185,120,11,181,40,251,175,
+213,186,170,128,90,165,41,218,159,208,41,154,117,121,148,25,169,142,188,216,136,94,248,130,
+0,24,125,162,55,119,68,103,113,231,150,107,139,230,101,48,54,96,215,181,90,128,85,85,
+43,21,80,216,4,75,136,20,70,59,100,65,242,227,60,171,163,56,105,163,52,43,211,48,
+241,98,45,187,34,42,138,66,39,94,162,36,55,82,34,20,82,32,248,177,30,223,97,29,
+205,97,28,191,193,27,185,81,27,184,49,29,19,130,39,254,34,58,96,84,83,25,166,112,
+0,40,158,161,123,208,233,93,228,78,238,227,49,46,226,10,174,222,201,61,218,118,77,212,
+15,109,205,151,76,197,14,92,188,120,123,178,213,26,168,41,250,156,117,153,145,188,216,133,
+0,56,122,68,119,110,139,22,99,215,245,87,43,149,77,136,180,67,242,195,58,105,163,50,
+241,194,43,138,210,37,55,98,33,246,225,29,207,33,28,178,177,27,23,146,47,95,228,97,
+0,216,186,214,205,229,47,30,224,208,125,215,10,141,201,18,92,183,211,202,162,118,137,139,
+0,136,116,138,70,93,45,181,72,238,131,54,246,146,40,48,242,31,209,65,26,42,50,69,
+0,232,211,206,238,218,195,124,196,246,90,147,0,184,108,10,149,59,61,35,37,50,33,44,
+0,200,224,213,77,163,0,200,92,43,66,31,0,88,221,0,184,34,0,232,135,252,136,151,
+241,137,166,219,154,180,178,91,193,114,140,204,22,205,213,154,253,220,251,221,225,54,78,228,
+74,174,228,73,142,228,71,94,228,67,30,228,63,206,227,57,94,227,49,222,226,40,78,226,
+30,158,225,19,222,224,6,254,223,248,13,223,233,13,222,216,253,220,198,221,219,179,157,218,
+159,77,217,137,237,215,114,109,214,90,237,212,65,77,211,39,157,209,11,221,207,239,12,206,
+209,44,204,178,60,202,147,60,200,114,44,198,81,252,195,46,220,193,11,156,191,230,75,189,
+193,235,186,155,139,184,117,27,182,77,155,179,37,11,177,252,122,174,210,218,171,168,58,169,
+126,138,166,82,218,163,39,10,161,250,73,158,206,121,155,161,169,152,115,201,149,69,249,146,
+24,9,144,233,40,141,187,72,138,140,88,135,94,104,132,47,120,129,0,152,126,209,167,123,
+162,183,120,116,199,117,69,231,114,23,7,112,232,22,109,186,70,106,141,102,103,95,150,100,
+50,198,97,6,6,95,217,53,92,174,133,89,130,213,86,88,53,84,46,149,81,4,5,79,
+219,116,76,179,244,73,139,132,71,101,36,69,63,196,66,26,116,64,245,51,62,210,19,60,
+175,227,57,142,211,55,109,211,53,78,227,51,47,3,50,17,51,48,245,114,46,217,194,44,
+191,34,43,166,162,41,142,34,40,119,194,38,97,114,37,77,50,36,58,18,35,40,2,34,
+23,2,33,8,18,32,250,49,31,237,113,30,226,193,29,216,49,29,207,177,28,199,65,28,
+193,241,27,189,177,27,185,129,27,183,97,27,182,193,27,202,49,30,5,18,35,102,66,42,
+234,130,51,142,179,62,78,116,75,37,133,89,15,134,104,4,39,120,0,200,143,241,185,173,
+178,43,199,21,173,217,251,93,227,74,174,228,70,62,228,64,158,227,49,142,226,31,62,225,
+6,142,223,233,141,221,198,61,219,159,157,216,114,173,213,65,109,210,11,253,206,209,44,203,
+147,44,199,81,236,194,11,124,190,193,187,185,116,219,180,37,203,175,210,138,170,126,42,165,
+39,170,159,206,9,154,115,105,148,24,153,142,187,200,136,94,248,130,0,24,125,162,71,119,
+69,119,113,232,166,107,141,6,102,50,102,96,217,229,90,130,133,85,46,69,80,219,52,75,
+140,84,70,63,148,65,245,35,61,175,227,56,109,227,52,47,19,49,245,162,45,191,98,42,
+142,114,39,97,210,36,58,130,34,23,130,32,250,209,30,225,129,29,207,113,28,192,209,27,
+186,97,27,182,177,28,5,98,38,234,226,56,78,84,82,15,70,112,0,216,158,179,187,209,
+246,141,228,76,206,227,48,14,226,7,126,222,198,253,217,114,13,212,11,45,205,147,12,197,
+11,44,188,117,75,178,210,234,167,39,218,156,115,137,145,187,216,133,0,56,122,69,135,110,
+141,54,99,217,37,88,46,197,77,139,228,67,245,3,59,109,227,50,245,2,44,142,18,38,
+58,146,33,249,1,30,208,65,28,180,129,27,10,82,46,77,52,97,0,216,187,228,221,229,
+43,254,223,206,61,215,5,93,201,15,28,183,207,186,162,117,105,139,0,168,116,139,86,93,
+49,245,72,241,179,54,251,210,40,50,18,32,213,49,26,28,50,68,0,88,212,209,158,218,
+189,92,196,244,26,147,0,248,108,12,181,59,67,115,37,47,177,43,0,216,224,211,13,163,
+0,8,93,45,50,31,0,56,221,0,216,34,0,24,136,1,9,152,252,89,167,234,170,181,
+197,155,194,135,204,205,42,13,215,172,253,221,8,142,226,61,142,228,74,158,228,72,142,228,
+71,94,228,67,14,228,62,190,227,55,78,227,48,190,226,38,46,226,28,126,225,17,174,224,
+4,222,223,245,237,222,230,237,221,213,205,220,195,157,219,176,109,218,155,13,217,133,173,215,
+111,61,214,86,173,212,61,13,211,35,93,209,7,157,207,235,204,205,205,236,203,175,252,201,
+143,252,199,111,236,197,77,204,195,42,156,193,7,92,191,227,11,189,190,187,186,152,91,184,
+113,235,181,74,107,179,34,219,176,249,74,174,208,186,171,166,10,169,123,106,166,80,170,163,
+36,234,160,248,41,158,204,89,155,159,137,152,114,185,149,68,217,146,22,249,143,232,24,141,
+186,56,138,140,72,135,93,104,132,47,120,129,0,152,126,209,167,123,163,199,120,116,215,117,
+70,247,114,24,23,112,234,54,109,188,86,106,142,134,103,97,182,100,52,230,97,8,38,95,
+220,101,92,176,165,89,133,5,87,90,85,84,48,197,81,7,53,79,222,164,76,182,36,74,
+143,180,71,104,84,69,66,4,67,29,180,64,249,115,62,214,67,60,179,35,58,146,19,56,
+113,19,54,81,35,52,51,67,50,21,115,48,249,178,46,221,2,45,195,98,43,170,210,41,
+145,98,40,123,2,39,101,162,37,80,114,36,61,66,35,43,34,34,26,34,33,11,50,32,
+252,97,31,239,145,30,228,225,29,218,81,29,208,193,28,201,81,28,194,1,28,189,177,27,
+185,129,27,184,113,27,182,129,27,195,129,29,248,17,34,84,2,41,214,66,50,121,115,61,
+59,100,74,22,181,88,4,6,104,254,246,119,0,24,144,252,169,174,197,107,200,42,221,218,
+9,190,227,75,158,228,69,62,228,62,126,227,47,126,226,29,14,225,3,110,223,230,93,221,
+195,13,219,155,93,216,110,125,213,61,61,210,7,189,206,206,252,202,143,252,198,77,172,194,
+7,60,190,190,139,185,113,171,180,34,155,175,208,106,170,123,10,165,36,138,159,204,249,153,
+114,73,148,22,137,142,186,200,136,93,232,130,0,40,125,163,71,119,70,135,113,234,198,107,
+142,22,102,52,134,96,220,5,91,133,165,85,48,117,80,222,100,75,143,132,70,66,212,65,
+249,99,61,179,19,57,113,19,53,50,83,49,249,210,45,195,146,42,146,178,39,101,2,37,
+61,178,34,26,162,32,253,1,31,227,145,29,209,145,28,194,209,27,187,113,27,181,81,28,
+247,49,37,214,162,55,59,100,81,4,246,111,0,136,159,198,251,210,3,190,228,74,190,227,
+47,238,225,4,94,222,195,205,217,110,221,211,8,237,204,143,220,196,7,236,187,113,43,178,
+208,186,167,36,202,156,114,105,145,186,216,133,0,56,122,70,167,110,142,70,99,220,85,88,
+48,229,77,143,36,68,249,51,59,113,35,51,248,50,44,146,66,38,61,178,33,252,33,30,
+209,81,28,182,81,27,253,17,45,58,132,96,0,232,188,242,237,229,38,222,223,205,237,214,
+0,45,201,13,220,182,204,170,162,115,73,139,0,200,116,141,102,93,52,53,73,243,227,54,
+0,35,41,51,50,32,218,33,26,14,34,67,0,200,212,212,78,218,183,76,196,242,234,146,
+0,40,109,14,197,59,73,195,37,44,65,43,0,232,224,208,189,162,0,88,93,48,34,31,
+0,8,221,0,8,35,0,72,136,8,153,152,8,74,168,250,202,182,216,235,195,156,44,207,
+63,77,216,190,253,222,22,46,227,67,158,228,74,158,228,72,126,228,70,78,228,66,254,227,
+61,158,227,54,46,227,46,158,226,37,14,226,26,78,225,14,142,224,1,174,223,243,189,222,
+227,189,221,210,157,220,192,109,219,172,45,218,152,221,216,130,125,215,107,253,213,83,109,212,
+58,221,210,31,45,209,4,109,207,231,156,205,202,172,203,171,188,201,139,188,199,107,172,197,
+73,140,195,39,92,193,4,44,191,223,219,188,186,139,186,149,27,184,110,187,181,71,59,179,
+31,187,176,246,42,174,205,138,171,163,234,168,121,58,166,78,138,163,34,202,160,246,9,158,
+202,73,155,157,121,152,112,169,149,67,201,146,21,233,143,231,8,141,185,40,138,139,72,135,
+93,104,132,46,120,129,0,152,126,210,167,123,163,199,120,117,231,117,71,7,115,25,39,112,
+235,70,109,189,102,106,144,150,103,99,198,100,54,6,98,10,70,95,222,133,92,178,213,89,
+135,37,87,93,133,84,51,229,81,10,85,79,225,212,76,185,84,74,146,244,71,107,132,69,
+70,52,67,33,228,64,252,179,62,217,131,60,183,99,58,149,83,56,117,83,54,85,99,52,
+54,115,50,25,163,48,252,226,46,225,50,45,198,162,43,173,18,42,149,146,40,126,50,39,
+104,226,37,84,162,36,64,114,35,46,82,34,29,82,33,13,98,32,255,129,31,242,193,30,
+230,1,30,219,113,29,210,225,28,202,113,28,195,17,28,190,193,27,186,145,27,184,113,27,
+182,113,27,189,225,28,234,17,33,66,194,39,193,226,48,100,35,60,40,68,73,6,197,87,
+248,117,103,248,198,119,0,120,144,8,186,175,216,187,201,63,253,219,22,30,228,76,142,228,
+69,46,228,61,110,227,45,94,226,27,238,224,1,62,223,227,45,221,192,221,218,152,45,216,
+107,61,213,58,253,209,4,125,206,202,188,202,139,188,198,73,124,194,3,12,190,187,75,185,
+110,123,180,31,107,175,205,58,170,121,218,164,34,106,159,202,217,153,112,57,148,21,121,142,
+185,184,136,93,232,130,0,40,125,163,87,119,71,151,113,235,214,107,144,54,102,54,166,96,
+222,53,91,135,213,85,51,165,80,225,148,75,146,196,70,69,4,66,253,147,61,183,83,57,
+117,83,53,54,147,49,252,18,46,198,210,42,149,226,39,104,50,37,64,226,34,29,210,32,
+255,33,31,229,177,29,211,161,28,195,225,27,187,129,27,180,241,27,234,17,36,193,82,54,
+39,84,80,248,149,111,0,56,160,218,75,212,15,238,228,72,158,227,46,206,225,1,46,222,
+192,141,217,107,157,211,4,173,204,139,156,196,4,172,187,110,251,177,205,154,167,34,170,156,
+112,89,145,185,216,133,0,56,122,71,183,110,144,102,99,222,117,88,51,21,78,146,100,68,
+252,115,59,117,99,51,252,114,44,149,130,38,64,226,33,255,65,30,210,113,28,184,33,27,
+241,193,43,38,212,95,0,232,189,0,254,229,33,190,223,204,173,214,251,12,201,10,140,182,
+201,154,162,114,57,139,0,216,116,142,118,93,55,133,73,246,3,55,5,99,41,52,82,32,
+223,17,26,0,34,66,0,56,213,215,254,217,178,44,196,240,186,146,0,88,109,16,229,59,
+78,19,38,41,209,42,0,232,224,206,125,162,0,152,93,50,34,31,0,232,220,0,40,35,
+0,136,136,14,41,153,20,42,169,11,251,183,237,59,197,177,124,208,84,125,217,208,237,223,
+34,174,227,71,174,228,73,142,228,72,126,228,69,62,228,65,238,227,59,142,227,52,14,227,
+44,142,226,35,222,225,24,46,225,12,94,224,254,125,223,240,141,222,224,141,221,207,109,220,
+189,61,219,169,253,217,148,173,216,127,61,215,103,189,213,79,61,212,54,157,210,27,237,208,
+0,45,207,227,92,205,198,124,203,167,140,201,136,124,199,103,108,197,70,92,195,35,44,193,
+0,236,190,220,155,188,183,75,186,145,235,183,107,123,181,68,11,179,28,139,176,243,250,173,
+202,90,171,160,186,168,118,26,166,75,106,163,32,170,160,244,233,157,200,41,155,156,89,152,
+111,137,149,66,185,146,20,217,143,230,248,140,185,40,138,139,56,135,92,88,132,46,120,129,
+0,152,126,210,183,123,164,215,120,117,231,117,71,23,115,26,55,112,236,86,109,191,134,106,
+145,182,103,100,230,100,56,38,98,12,102,95,224,165,92,181,245,89,138,85,87,96,181,84,
+54,21,82,13,133,79,228,4,77,188,148,74,149,36,72,111,196,69,73,116,67,36,36,65,
+0,228,62,221,179,60,186,163,58,153,147,56,120,131,54,89,147,52,58,179,50,29,227,48,
+0,35,47,229,114,45,202,210,43,177,82,42,153,210,40,129,98,39,108,18,38,87,210,36,
+67,162,35,49,130,34,32,130,33,16,146,32,2,178,31,244,225,30,232,49,30,221,129,29,
+212,1,29,204,129,28,197,33,28,191,209,27,187,145,27,184,129,27,183,97,27,185,97,28,
+222,33,32,48,146,38,172,146,47,79,211,58,19,20,72,245,228,86,236,229,102,242,134,119,
+0,216,144,20,202,176,237,11,203,84,29,221,33,94,228,76,126,228,68,30,228,60,78,227,
+44,62,226,24,206,224,254,13,223,224,253,220,188,157,218,149,237,215,103,253,212,54,189,209,
+0,77,206,198,124,202,136,124,198,70,60,194,0,204,189,183,27,185,107,75,180,28,59,175,
+202,10,170,118,186,164,32,74,159,200,185,153,111,41,148,20,105,142,185,184,136,92,232,130,
+0,40,125,164,87,119,71,167,113,236,230,107,145,86,102,56,198,96,224,85,91,138,5,86,
+54,213,80,228,196,75,149,244,70,73,68,66,0,212,61,186,147,57,120,147,53,58,195,49,
+0,83,46,202,18,43,153,34,40,107,114,37,68,18,35,32,2,33,2,66,31,232,209,29,
+212,193,28,196,241,27,188,145,27,180,177,27,223,241,34,172,2,53,19,68,79,236,53,111,
+0,8,161,239,139,213,26,254,228,70,142,227,45,158,225,253,253,221,190,93,217,103,109,211,
+1,109,204,135,108,196,0,124,187,106,203,177,202,106,167,32,138,156,111,73,145,184,216,133,
+0,56,122,72,199,110,145,134,99,224,165,88,54,69,78,150,148,68,0,164,59,121,163,51,
+255,162,44,153,178,38,66,18,34,3,114,30,211,129,28,186,17,27,230,129,42,17,4,95,
+0,248,190,14,254,229,27,158,223,203,93,214,245,220,200,7,76,182,197,138,162,113,25,139,
+0,248,116,143,134,93,59,197,73,249,51,55,11,179,41,53,114,32,229,17,26,242,17,65,
+0,168,213,218,158,217,172,12,196,238,138,146,0,136,109,18,5,60,84,115,38,38,97,42,
+0,248,224,203,61,162,0,216,93,53,18,31,0,184,220,0,88,35,0,184,136,21,201,153,
+33,42,170,29,59,185,2,156,198,199,220,209,105,189,218,225,221,224,45,30,228,73,174,228,
+73,142,228,72,110,228,68,46,228,64,222,227,58,126,227,51,254,226,42,110,226,33,190,225,
+22,14,225,10,62,224,252,93,223,237,93,222,221,93,221,204,61,220,186,13,219,166,205,217,
+145,109,216,123,13,215,100,141,213,76,253,211,50,93,210,24,173,208,252,236,206,224,28,205,
+194,60,203,164,76,201,132,76,199,99,60,197,66,28,195,32,236,192,252,187,190,216,107,188,
+180,27,186,142,187,183,104,75,181,65,219,178,25,91,176,240,202,173,199,58,171,158,154,168,
+116,234,165,73,58,163,30,138,160,242,201,157,198,9,155,154,73,152,109,121,149,64,169,146,
+19,201,143,229,248,140,184,24,138,138,56,135,92,88,132,46,120,129,0,152,126,210,183,123,
+164,215,120,118,247,117,72,23,115,27,71,112,237,102,109,192,150,106,147,198,103,102,6,101,
+58,70,98,14,134,95,226,213,92,183,37,90,140,117,87,98,213,84,57,69,82,16,181,79,
+231,52,77,191,196,74,152,84,72,114,244,69,76,164,67,40,84,65,4,36,63,224,243,60,
+190,211,58,157,195,56,124,195,54,92,211,52,62,243,50,32,35,49,4,99,47,232,178,45,
+206,18,44,180,130,42,156,2,41,133,162,39,111,66,38,90,2,37,70,210,35,52,178,34,
+35,178,33,19,178,32,4,210,31,246,1,31,234,81,30,223,161,29,214,17,29,205,145,28,
+198,49,28,192,225,27,188,161,27,184,129,27,183,97,27,183,241,27,211,49,31,31,82,37,
+151,50,46,57,115,57,254,211,70,227,228,85,223,69,102,235,86,119,0,72,145,33,234,177,
+1,124,204,105,61,222,44,158,228,75,126,228,68,14,228,58,46,227,42,30,226,22,158,224,
+252,237,222,221,205,220,186,109,218,145,189,215,100,205,212,50,141,209,252,12,206,194,60,202,
+132,76,198,66,12,194,252,155,189,180,235,184,104,27,180,25,11,175,199,234,169,116,154,164,
+30,42,159,198,169,153,109,9,148,19,89,142,184,168,136,92,232,130,0,40,125,164,103,119,
+72,183,113,237,6,108,147,102,102,58,230,96,226,117,91,140,37,86,57,5,81,231,244,75,
+152,36,71,76,116,66,4,4,62,190,195,57,124,211,53,62,3,50,4,131,46,206,66,43,
+156,82,40,111,162,37,70,66,35,35,34,33,4,114,31,234,241,29,214,225,28,198,1,28,
+188,145,27,181,113,27,212,209,33,151,146,51,255,35,78,223,197,110,0,216,161,4,204,214,
+37,30,229,68,126,227,44,126,225,250,221,221,187,29,217,99,61,211,253,44,204,131,44,196,
+253,59,187,103,155,177,200,58,167,30,122,156,109,41,145,184,216,133,0,56,122,72,231,110,
+147,150,99,226,213,88,56,117,78,153,212,68,3,228,59,125,227,51,3,227,44,157,242,38,
+69,50,34,6,146,30,212,145,28,188,241,26,219,65,41,252,51,94,0,248,191,28,254,229,
+22,142,223,202,29,214,240,172,200,5,12,182,194,122,162,112,249,138,0,24,117,144,150,93,
+62,5,74,251,99,55,16,243,41,54,130,32,234,17,26,228,17,64,0,24,214,221,78,217,
+167,236,195,236,74,146,0,200,109,20,37,60,89,195,38,35,241,41,0,8,225,201,253,161,
+0,24,94,55,2,31,0,152,220,0,120,35,0,232,136,28,121,154,46,42,171,48,123,186,
+23,252,199,222,76,211,126,237,219,242,189,225,55,110,228,74,174,228,73,142,228,71,94,228,
+67,30,228,63,206,227,56,94,227,49,222,226,41,78,226,31,158,225,19,238,224,7,14,224,
+249,45,223,235,61,222,218,45,221,201,13,220,182,221,218,163,141,217,142,61,216,120,205,214,
+96,77,213,72,205,211,47,45,210,20,109,208,249,172,206,220,220,204,190,252,202,160,12,201,
+128,12,199,96,252,196,62,220,194,28,188,192,249,123,190,213,59,188,176,235,185,139,139,183,
+100,27,181,61,171,178,22,43,176,238,154,173,197,10,171,155,106,168,113,202,165,71,26,163,
+28,106,160,240,169,157,196,233,154,152,41,152,108,89,149,63,137,146,18,185,143,229,232,140,
+183,8,138,137,56,135,92,88,132,46,120,129,0,152,126,210,183,123,164,215,120,119,7,118,
+73,39,115,27,87,112,238,134,109,193,182,106,148,230,103,104,38,101,60,102,98,16,166,95,
+228,245,92,185,69,90,143,165,87,101,5,85,59,117,82,18,229,79,234,100,77,195,244,74,
+156,132,72,117,36,70,80,212,67,43,148,65,7,84,63,228,51,61,194,19,59,160,3,57,
+128,3,55,96,19,53,66,51,51,36,99,49,7,163,47,236,226,45,209,82,44,184,194,42,
+160,66,41,136,210,39,114,130,38,93,50,37,74,2,36,55,226,34,38,210,33,21,226,32,
+7,2,32,249,33,31,237,113,30,225,193,29,215,49,29,207,177,28,200,65,28,193,241,27,
+189,177,27,185,129,27,183,97,27,182,161,27,201,81,30,14,34,36,130,194,44,34,19,56,
+233,147,69,208,228,84,210,149,101,228,38,119,0,184,145,46,10,179,23,220,205,127,77,223,
+53,190,228,74,110,228,67,254,227,57,30,227,41,254,225,20,126,224,249,189,222,218,157,220,
+182,61,218,142,141,215,96,141,212,47,77,209,249,204,205,190,12,202,128,12,198,62,204,193,
+249,91,189,176,187,184,100,219,179,22,235,174,197,186,169,113,122,164,28,10,159,196,137,153,
+108,249,147,18,89,142,183,152,136,92,232,130,0,40,125,164,119,119,73,183,113,238,22,108,
+148,134,102,60,6,97,228,149,91,143,85,86,59,37,81,234,52,76,156,84,71,80,180,66,
+7,68,62,194,3,58,128,3,54,66,67,50,7,195,46,209,130,43,160,130,40,114,210,37,
+74,114,35,38,82,33,7,146,31,236,17,30,215,241,28,199,17,28,189,161,27,182,81,27,
+203,193,32,129,50,50,233,3,77,210,85,110,0,184,162,26,12,216,47,30,229,65,110,227,
+43,94,225,247,173,221,184,237,216,95,253,210,250,236,203,127,252,195,250,251,186,100,123,177,
+197,10,167,27,90,156,108,25,145,183,216,133,0,56,122,73,247,110,148,182,99,229,5,89,
+59,149,78,156,20,69,6,20,60,129,35,52,6,19,45,161,34,39,72,98,34,9,178,30,
+213,161,28,191,241,26,209,1,40,230,83,93,0,8,193,42,254,229,16,110,223,201,205,213,
+235,140,200,2,188,181,191,106,162,111,201,138,0,72,117,145,166,93,65,85,74,254,131,55,
+21,67,42,55,162,32,240,17,26,214,1,63,0,136,214,224,254,216,162,204,195,234,26,146,
+0,248,109,22,69,60,94,19,39,32,129,41,0,8,225,199,189,161,0,88,94,57,2,31,
+0,120,220,0,152,35,0,40,137,35,25,155,60,42,172,67,203,187,46,108,201,246,172,212,
+148,29,221,2,126,226,62,158,228,74,158,228,72,142,228,70,78,228,66,14,228,61,174,227,
+55,78,227,48,190,226,39,46,226,29,126,225,17,190,224,5,238,223,247,253,222,232,13,222,
+215,253,220,198,221,219,179,157,218,159,93,217,138,253,215,116,157,214,93,29,213,68,141,211,
+43,237,209,16,61,208,245,124,206,216,172,204,187,188,202,156,204,200,125,204,198,92,188,196,
+59,172,194,24,124,192,245,75,190,210,251,187,173,171,185,135,75,183,97,235,180,58,123,178,
+19,251,175,235,106,173,194,218,170,153,74,168,111,170,165,68,250,162,26,74,160,238,137,157,
+195,217,154,151,9,152,106,73,149,62,121,146,17,169,143,228,216,140,182,8,138,137,40,135,
+91,72,132,46,120,129,0,152,126,210,199,123,165,231,120,119,7,118,74,55,115,28,103,112,
+239,150,109,194,198,106,150,6,104,105,54,101,61,134,98,18,198,95,230,21,93,188,101,90,
+145,197,87,103,53,85,62,165,82,21,21,80,237,148,77,198,36,75,159,196,72,121,100,70,
+83,20,68,46,196,65,11,148,63,232,99,61,197,83,59,164,67,57,131,67,55,100,83,53,
+69,99,51,40,147,49,11,211,47,240,34,46,213,130,44,188,242,42,163,114,41,140,18,40,
+118,178,38,97,114,37,77,50,36,58,18,35,41,2,34,24,18,33,9,34,32,251,81,31,
+239,145,30,227,225,29,217,81,29,208,193,28,201,97,28,195,1,28,190,193,27,186,129,27,
+184,113,27,182,113,27,194,145,29,254,241,34,108,98,43,10,163,54,210,67,68,189,228,83,
+196,229,100,221,230,118,0,40,146,60,74,180,45,92,207,148,61,224,60,206,228,73,94,228,
+67,238,227,55,254,226,39,222,225,17,78,224,247,141,222,215,109,220,179,253,217,138,77,215,
+93,77,212,43,13,209,245,140,205,187,204,201,125,204,197,59,156,193,245,27,189,173,123,184,
+97,171,179,19,187,174,194,154,169,111,74,164,26,234,158,195,121,153,106,233,147,17,73,142,
+182,152,136,91,232,130,0,40,125,165,119,119,74,199,113,239,38,108,150,150,102,61,38,97,
+230,197,91,145,117,86,62,85,81,237,100,76,159,148,71,83,244,66,11,116,62,197,67,58,
+131,67,54,69,131,50,11,3,47,213,194,43,163,194,40,118,18,38,77,162,35,41,130,33,
+9,194,31,239,49,30,217,17,29,201,33,28,189,177,27,183,65,27,196,209,31,107,178,48,
+211,195,75,196,229,109,0,168,163,49,60,217,56,30,229,62,78,227,42,46,225,244,125,221,
+182,173,216,91,205,210,246,172,203,123,204,195,246,203,186,96,75,177,195,234,166,25,74,156,
+107,249,144,182,200,133,0,72,122,74,7,111,149,198,99,231,37,89,61,197,78,160,68,69,
+10,68,60,133,99,52,10,67,45,165,98,39,74,146,34,12,226,30,214,193,28,194,241,26,
+200,209,38,207,99,92,0,8,194,55,238,229,11,78,223,200,125,213,230,108,200,0,108,181,
+187,90,162,109,169,138,0,104,117,147,182,93,69,165,74,0,164,55,26,147,42,56,194,32,
+245,33,26,201,1,62,0,232,214,226,174,216,156,188,195,232,234,145,0,40,110,24,85,60,
+100,99,39,30,33,41,0,24,225,196,125,161,0,152,94,60,242,30,0,72,220,0,200,35,
+0,104,137,43,217,155,75,74,173,87,59,189,69,236,202,14,29,214,169,77,222,18,62,227,
+68,174,228,74,158,228,72,126,228,70,78,228,66,254,227,60,158,227,54,46,227,46,174,226,
+37,14,226,27,94,225,15,158,224,2,190,223,244,221,222,229,221,221,213,205,220,195,173,219,
+176,109,218,156,45,217,135,205,215,113,93,214,90,221,212,65,77,211,40,173,209,13,253,207,
+241,60,206,213,108,204,183,140,202,152,156,200,121,156,198,89,140,196,55,108,194,21,76,192,
+242,11,190,206,203,187,170,123,185,132,27,183,94,187,180,55,75,178,16,203,175,232,74,173,
+191,186,170,150,26,168,108,122,165,66,218,162,23,42,160,236,121,157,193,185,154,149,249,151,
+105,57,149,60,105,146,16,153,143,227,200,140,182,248,137,136,40,135,91,72,132,45,120,129,
+0,152,126,211,199,123,165,231,120,120,23,118,74,71,115,29,119,112,240,166,109,196,214,106,
+151,22,104,107,86,101,63,150,98,20,230,95,233,53,93,190,149,90,148,245,87,106,85,85,
+65,197,82,24,69,80,240,196,77,201,84,75,162,244,72,124,148,70,86,68,68,50,4,66,
+14,196,63,235,163,61,201,131,59,167,115,57,135,115,55,104,131,53,73,163,51,43,211,49,
+15,19,48,243,98,46,216,194,44,191,50,43,167,178,41,143,66,40,121,226,38,100,162,37,
+80,98,36,61,66,35,43,50,34,27,50,33,12,82,32,254,113,31,241,177,30,229,1,30,
+219,97,29,210,225,28,202,113,28,196,17,28,190,193,27,186,145,27,184,113,27,182,97,27,
+188,209,28,238,193,33,87,242,41,242,34,53,187,211,66,169,196,82,181,53,100,213,166,118,
+0,168,146,75,138,181,69,220,208,170,45,225,67,206,228,72,94,228,66,222,227,53,238,226,
+37,190,225,15,46,224,245,93,222,212,61,220,176,205,217,135,29,215,90,29,212,39,221,208,
+241,92,205,183,156,201,121,140,197,55,92,193,242,235,188,169,75,184,94,123,179,16,139,174,
+191,106,169,108,42,164,24,202,158,193,89,153,105,201,147,16,57,142,182,136,136,91,232,130,
+0,40,125,165,135,119,74,215,113,240,70,108,151,182,102,63,70,97,232,229,91,148,165,86,
+65,133,81,240,148,76,162,196,71,87,36,67,14,180,62,201,131,58,135,115,54,73,179,50,
+15,51,47,217,242,43,166,242,40,121,66,38,80,210,35,44,178,33,11,226,31,241,81,30,
+219,33,29,203,49,28,190,177,27,184,65,27,189,225,30,86,50,47,187,131,74,181,101,109,
+0,168,164,73,108,218,64,14,229,60,78,227,41,254,224,241,93,221,179,109,216,87,157,210,
+243,108,203,119,156,195,243,139,186,93,27,177,192,186,166,23,42,156,105,233,144,181,200,133,
+0,72,122,75,39,111,151,230,99,233,85,89,64,245,78,163,132,69,13,116,60,137,163,52,
+13,115,45,169,162,39,77,178,34,15,18,31,215,193,28,196,1,27,192,161,37,183,99,91,
+0,24,195,69,222,229,5,62,223,200,61,213,225,60,200,253,43,181,184,90,162,108,137,138,
+0,136,117,148,182,93,72,229,74,3,212,55,31,211,42,56,210,32,251,49,26,187,241,60,
+0,88,215,229,94,216,151,156,195,230,186,145,0,88,110,26,117,60,105,179,39,27,177,40,
+0,24,225,194,61,161,0,216,94,62,242,30,0,40,220,0,232,35,0,168,137,51,153,156,
+90,122,174,108,155,190,93,124,204,38,141,215,190,109,223,32,206,227,72,174,228,73,142,228,
+72,110,228,68,62,228,65,238,227,59,142,227,52,14,227,44,142,226,35,238,225,24,62,225,
+13,110,224,0,158,223,242,173,222,226,173,221,210,157,220,192,109,219,173,61,218,153,237,216,
+132,157,215,109,45,214,86,173,212,61,29,211,36,125,209,9,189,207,238,252,205,209,44,204,
+179,76,202,149,92,200,117,92,198,85,76,196,52,60,194,17,12,192,238,219,189,203,155,187,
+166,75,185,129,235,182,91,139,180,52,27,178,13,155,175,229,26,173,189,138,170,148,250,167,
+106,90,165,64,186,162,21,10,160,234,89,157,191,153,154,147,217,151,103,25,149,59,89,146,
+15,137,143,226,184,140,181,232,137,136,24,135,91,72,132,45,120,129,0,152,126,211,199,123,
+165,247,120,120,39,118,75,87,115,30,135,112,241,182,109,197,246,106,153,54,104,109,118,101,
+65,182,98,22,6,96,235,85,93,192,181,90,150,21,88,108,133,85,67,245,82,27,117,80,
+243,244,77,204,132,75,165,36,73,127,196,70,90,116,68,53,52,66,18,4,64,239,211,61,
+204,195,59,171,179,57,139,179,55,107,195,53,77,227,51,47,19,50,18,83,48,247,146,46,
+220,242,44,195,98,43,170,226,41,147,114,40,124,34,39,103,210,37,83,162,36,64,114,35,
+46,98,34,30,98,33,14,114,32,0,162,31,243,209,30,232,33,30,221,129,29,212,1,29,
+204,129,28,197,33,28,191,209,27,188,161,27,184,129,27,183,97,27,184,65,28,224,161,32,
+66,130,40,218,146,51,163,115,65,148,148,81,166,117,99,205,102,118,0,56,147,91,202,182,
+93,108,210,191,253,225,71,190,228,70,78,228,65,190,227,51,206,226,36,142,225,12,14,224,
+242,45,222,209,13,220,173,157,217,131,221,214,86,221,211,35,157,208,238,28,205,179,92,201,
+117,92,197,51,44,193,239,187,188,166,27,184,91,75,179,13,91,174,189,58,169,106,10,164,
+21,170,158,191,73,153,103,185,147,14,41,142,181,136,136,91,216,130,0,56,125,165,135,119,
+75,231,113,242,86,108,153,198,102,65,102,97,235,5,92,150,213,86,67,181,81,243,196,76,
+165,244,71,90,84,67,17,228,62,205,179,58,139,179,54,77,243,50,18,115,47,221,50,44,
+170,50,41,125,114,38,83,2,36,47,226,33,14,2,32,244,129,30,220,65,29,205,81,28,
+191,193,27,186,81,27,185,17,30,65,162,45,163,67,73,165,213,108,0,184,165,97,156,219,
+71,254,228,58,62,227,40,222,224,238,45,221,176,45,216,83,93,210,240,44,203,116,92,195,
+240,91,186,90,251,176,189,138,166,21,26,156,104,217,144,181,200,133,0,72,122,75,55,111,
+152,246,99,235,133,89,67,21,79,166,180,69,16,180,60,140,227,52,16,179,45,173,226,39,
+80,226,34,18,50,31,216,209,28,198,17,27,185,113,36,159,83,90,0,40,196,82,206,229,
+255,29,223,199,237,212,219,28,200,251,219,180,181,74,162,107,105,138,0,168,117,149,198,93,
+75,53,75,5,244,55,37,35,43,57,242,32,1,66,26,174,225,59,0,184,215,231,14,216,
+146,124,195,228,138,145,0,136,110,28,149,60,110,3,40,25,81,40,0,40,225,191,253,160,
+0,24,95,65,226,30,0,248,219,0,24,36,0,248,137,59,89,157,107,170,175,130,27,192,
+118,28,206,63,253,216,210,125,224,45,46,228,74,174,228,73,142,228,71,110,228,68,46,228,
+64,222,227,57,110,227,51,254,226,42,110,226,33,206,225,22,14,225,10,78,224,253,109,223,
+239,125,222,223,125,221,207,109,220,189,61,219,170,13,218,149,189,216,128,93,215,106,237,213,
+82,109,212,58,221,210,32,61,209,5,141,207,234,204,205,205,252,203,176,12,202,145,28,200,
+114,28,198,81,28,196,48,252,193,14,220,191,235,155,189,199,91,187,163,11,185,126,187,182,
+88,91,180,49,235,177,10,107,175,226,234,172,186,106,170,145,202,167,104,58,165,62,154,162,
+19,234,159,232,57,157,189,137,154,146,201,151,102,9,149,58,73,146,13,121,143,225,184,140,
+180,232,137,135,24,135,90,72,132,45,120,129,0,152,126,211,199,123,166,247,120,121,39,118,
+76,87,115,31,151,112,243,198,109,198,6,107,154,70,104,110,134,101,67,214,98,24,38,96,
+237,117,93,194,213,90,152,69,88,111,165,85,70,37,83,30,165,80,246,36,78,207,180,75,
+168,84,73,130,4,71,93,180,68,57,116,66,21,52,64,242,19,62,208,243,59,175,243,57,
+142,243,55,111,3,54,80,19,52,51,67,50,22,131,48,251,210,46,224,50,45,198,162,43,
+174,34,42,150,178,40,128,82,39,107,2,38,86,210,36,67,162,35,49,146,34,33,146,33,
+17,162,32,3,194,31,246,1,31,234,65,30,223,161,29,214,17,29,205,161,28,199,49,28,
+192,225,27,188,161,27,185,129,27,183,97,27,182,225,27,211,145,31,46,18,39,193,242,49,
+138,243,63,126,100,80,149,181,98,197,22,118,0,200,147,107,42,184,118,252,211,212,189,226,
+74,190,228,69,62,228,65,174,227,50,190,226,34,110,225,10,222,223,239,253,221,206,221,219,
+170,93,217,128,173,214,83,173,211,32,109,208,234,220,204,175,28,201,114,28,197,48,236,192,
+235,123,188,163,235,183,88,27,179,10,59,174,186,26,169,103,234,163,19,138,158,189,41,153,
+102,169,147,13,25,142,180,120,136,90,216,130,0,56,125,166,151,119,76,247,113,243,102,108,
+154,230,102,67,134,97,237,37,92,153,245,86,70,213,81,246,244,76,168,36,72,93,148,67,
+21,36,63,208,243,58,142,243,54,81,51,51,22,163,47,224,98,44,173,98,41,128,178,38,
+86,50,36,50,18,34,17,50,32,246,161,30,222,81,29,206,97,28,191,209,27,187,81,27,
+182,81,29,44,18,44,138,227,71,149,69,108,0,216,166,121,188,220,77,238,228,55,46,227,
+39,174,224,235,13,221,173,253,215,80,45,210,236,236,202,112,44,195,236,27,186,87,203,176,
+187,106,166,19,250,155,102,201,144,180,200,133,0,72,122,76,71,111,154,22,100,237,165,89,
+69,69,79,169,244,69,20,228,60,144,35,53,20,227,45,176,18,40,83,2,35,21,98,31,
+217,225,28,201,33,27,179,81,35,135,51,89,0,40,197,95,190,229,249,13,223,198,157,212,
+214,252,199,249,155,180,177,58,162,106,73,138,0,200,117,150,214,93,79,117,75,7,20,56,
+42,115,43,58,2,33,7,82,26,161,225,58,0,24,216,233,190,215,140,92,195,226,90,145,
+0,184,110,30,181,60,116,83,40,23,241,39,0,40,225,188,189,160,0,88,95,68,226,30,
+0,200,219,0,72,36,0,56,138,69,57,158,124,250,176,153,171,193,144,188,207,88,109,218,
+231,141,225,56,126,228,75,158,228,72,142,228,71,94,228,67,30,228,62,190,227,56,94,227,
+49,222,226,41,78,226,31,174,225,20,238,224,8,46,224,251,77,223,236,93,222,221,77,221,
+204,61,220,186,13,219,167,221,217,146,141,216,125,45,215,102,189,213,79,61,212,54,173,210,
+29,253,208,2,77,207,230,140,205,202,188,203,172,220,201,141,236,199,110,236,197,78,220,195,
+45,204,193,10,156,191,232,107,189,196,43,187,160,219,184,123,139,182,85,43,180,46,187,177,
+7,75,175,224,202,172,183,58,170,143,170,167,101,10,165,59,106,162,17,202,159,231,25,157,
+188,105,154,144,169,151,101,249,148,57,57,146,12,105,143,224,168,140,179,216,137,135,8,135,
+90,56,132,45,104,129,0,168,126,211,215,123,166,7,121,121,55,118,77,103,115,32,167,112,
+244,214,109,199,22,107,155,102,104,112,166,101,68,246,98,25,70,96,239,165,93,197,5,91,
+155,101,88,113,213,85,73,69,83,32,197,80,249,84,78,210,228,75,171,132,73,133,52,71,
+96,228,68,60,164,66,24,116,64,246,67,62,211,51,60,178,35,58,146,35,56,115,51,54,
+84,83,52,54,131,50,26,195,48,254,18,47,227,98,45,202,210,43,177,82,42,154,226,40,
+131,130,39,110,50,38,89,2,37,70,210,35,52,194,34,35,178,33,20,194,32,5,226,31,
+248,33,31,236,97,30,225,193,29,215,49,29,207,177,28,200,81,28,194,241,27,189,177,27,
+185,129,27,184,113,27,181,145,27,200,129,30,25,162,37,168,82,48,112,99,62,103,20,79,
+132,213,97,187,214,117,0,88,148,124,138,185,144,156,213,231,93,227,76,174,228,68,62,228,
+64,142,227,48,158,226,32,78,225,7,190,223,237,205,221,203,173,219,167,45,217,125,125,214,
+79,109,211,28,45,208,231,156,204,172,236,200,110,220,196,44,188,192,232,75,188,160,187,183,
+85,235,178,7,11,174,183,234,168,101,202,163,17,106,158,188,9,153,101,137,147,12,9,142,
+179,104,136,90,216,130,0,56,125,166,167,119,77,7,114,244,134,108,155,6,103,68,166,97,
+239,69,92,155,37,87,73,5,82,249,36,77,171,84,72,96,196,67,24,84,63,212,51,59,
+146,35,55,84,115,51,25,227,47,228,162,44,177,146,41,131,226,38,89,98,36,53,66,34,
+19,82,32,249,193,30,224,113,29,208,129,28,192,209,27,188,97,27,180,177,28,25,114,42,
+112,131,70,132,181,107,0,8,168,147,204,221,82,206,228,53,30,227,37,126,224,232,221,220,
+170,189,215,76,237,209,233,172,202,108,236,194,233,235,185,84,155,176,184,58,166,17,234,155,
+101,169,144,179,200,133,0,72,122,77,103,111,155,38,100,239,213,89,72,117,79,172,36,70,
+23,36,61,148,99,53,23,35,46,180,82,40,86,50,35,24,146,31,219,241,28,203,65,27,
+174,65,34,109,3,88,0,56,198,107,158,229,242,253,222,198,77,212,209,220,199,246,75,180,
+174,58,162,105,25,138,0,248,117,151,214,93,82,197,75,10,52,56,47,195,43,58,18,33,
+14,114,26,149,209,57,0,120,216,235,110,215,135,76,195,224,42,145,0,232,110,32,197,60,
+121,163,40,21,145,39,0,40,225,186,125,160,0,152,95,70,226,30,0,168,219,0,104,36,
+0,136,138,78,25,159,142,74,178,177,75,195,171,92,209,113,221,219,250,109,226,64,174,228,
+74,158,228,72,126,228,70,78,228,66,14,228,61,174,227,55,62,227,47,190,226,39,46,226,
+29,142,225,18,206,224,6,254,223,248,29,223,234,45,222,218,29,221,201,13,220,183,221,218,
+163,157,217,143,77,216,122,237,214,99,125,213,75,253,211,51,109,210,25,205,208,254,28,207,
+227,76,205,198,124,203,168,156,201,138,172,199,106,172,197,74,172,195,41,140,193,7,108,191,
+228,59,189,193,251,186,156,171,184,119,91,182,82,251,179,43,139,177,4,27,175,221,154,172,
+181,10,170,140,138,167,99,234,164,57,74,162,15,170,159,229,249,156,186,73,154,143,153,151,
+99,217,148,55,25,146,11,89,143,223,152,140,179,200,137,134,8,135,89,56,132,45,104,129,
+0,168,126,211,215,123,167,7,121,122,71,118,77,119,115,33,183,112,245,246,109,201,54,107,
+157,118,104,113,198,101,70,22,99,27,102,96,241,197,93,199,37,91,157,133,88,116,5,86,
+75,117,83,35,245,80,252,132,78,213,20,76,174,180,73,137,100,71,100,20,69,63,212,66,
+28,164,64,249,131,62,215,99,60,182,99,58,150,99,56,118,115,54,88,147,52,58,195,50,
+29,243,48,2,67,47,231,162,45,205,18,44,181,146,42,157,34,41,134,194,39,113,114,38,
+93,50,37,73,2,36,55,242,34,38,226,33,22,242,32,8,18,32,250,65,31,238,129,30,
+227,225,29,217,81,29,209,209,28,201,97,28,195,1,28,190,193,27,186,145,27,184,113,27,
+182,97,27,192,161,29,6,50,36,143,178,46,85,195,60,79,196,77,114,245,96,178,134,117,
+0,248,148,142,10,187,171,60,215,250,221,227,77,142,228,68,46,228,62,110,227,47,126,226,
+30,46,225,5,142,223,234,157,221,200,125,219,164,253,216,121,61,214,76,45,211,25,253,207,
+227,108,204,168,172,200,107,172,196,41,124,192,228,11,188,156,139,183,82,187,178,4,219,173,
+181,202,168,99,154,163,15,74,158,186,249,152,99,121,147,11,249,141,179,104,136,89,216,130,
+0,56,125,167,167,119,77,23,114,245,150,108,157,22,103,70,198,97,241,117,92,157,69,87,
+75,53,82,252,84,77,174,132,72,100,4,68,28,148,63,215,99,59,149,99,55,88,163,51,
+29,19,48,231,226,44,180,210,41,135,18,39,92,146,36,56,114,34,22,130,32,251,225,30,
+226,145,29,209,161,28,194,225,27,188,129,27,179,49,28,6,210,40,85,3,69,114,21,107,
+0,88,169,173,220,222,86,174,228,51,14,227,35,78,224,229,189,220,167,141,215,72,189,209,
+229,108,202,104,188,194,230,171,185,80,123,176,182,26,166,14,202,155,100,153,144,178,200,133,
+0,72,122,78,119,111,156,70,100,242,245,89,74,149,79,176,100,70,26,84,61,152,163,53,
+27,83,46,184,130,40,89,82,35,27,194,31,221,1,29,205,97,27,170,49,33,83,179,86,
+0,56,199,120,126,229,236,221,222,197,253,211,203,188,199,244,251,179,171,42,162,104,249,137,
+0,24,118,152,230,93,85,21,76,12,84,56,53,19,44,59,50,33,20,146,26,136,209,56,
+0,216,216,237,30,215,130,44,195,222,250,144,0,24,111,34,229,60,126,243,40,19,49,39,
+0,40,225,183,61,160,0,216,95,73,226,30,0,120,219,0,152,36,0,216,138,88,9,160,
+161,186,179,202,251,196,199,28,211,138,77,221,13,62,227,70,174,228,73,142,228,72,126,228,
+69,62,228,65,254,227,60,158,227,54,46,227,46,174,226,37,14,226,27,110,225,16,174,224,
+3,222,223,246,237,222,231,253,221,215,253,220,198,221,219,180,173,218,160,109,217,140,29,216,
+118,189,214,96,77,213,72,205,211,47,45,210,21,141,208,251,220,206,223,28,205,194,76,203,
+165,108,201,134,124,199,103,124,197,71,108,195,37,92,193,4,44,191,225,251,188,189,187,186,
+153,123,184,116,43,182,79,203,179,40,91,177,2,235,174,218,106,172,178,234,169,138,90,167,
+97,202,164,55,42,162,13,138,159,227,217,156,184,57,154,141,121,151,98,201,148,54,9,146,
+10,73,143,222,136,140,178,200,137,134,248,134,89,56,132,45,104,129,0,168,126,211,215,123,
+167,23,121,122,71,118,78,135,115,34,199,112,246,6,110,202,70,107,158,150,104,115,214,101,
+72,54,99,29,134,96,243,229,93,201,69,91,159,181,88,118,37,86,78,165,83,38,37,81,
+254,180,78,216,68,76,177,228,73,140,148,71,103,84,69,67,20,67,31,228,64,252,179,62,
+219,163,60,185,147,58,153,147,56,122,163,54,91,195,52,62,243,50,33,51,49,5,131,47,
+235,226,45,209,66,44,184,194,42,160,82,41,138,242,39,116,162,38,96,98,37,76,50,36,
+58,18,35,41,18,34,25,34,33,10,50,32,253,97,31,240,161,30,229,1,30,219,97,29,
+210,225,28,202,113,28,196,17,28,191,209,27,187,145,27,184,129,27,183,97,27,186,209,28,
+243,193,34,118,242,44,57,19,59,54,84,76,95,5,96,168,54,117,0,168,149,161,154,188,
+199,220,216,11,78,228,77,126,228,68,46,228,61,94,227,45,110,226,27,254,224,3,110,223,
+231,125,221,198,77,219,160,189,216,118,13,214,72,253,210,21,189,207,223,44,204,165,108,200,
+103,108,196,37,76,192,225,219,187,153,75,183,79,139,178,2,171,173,178,154,168,97,122,163,
+13,58,158,184,217,152,98,105,147,10,233,141,178,88,136,89,216,130,0,56,125,167,183,119,
+78,39,114,246,166,108,158,54,103,72,214,97,243,149,92,159,117,87,78,101,82,254,132,77,
+177,196,72,103,52,68,31,196,63,219,163,59,153,163,55,91,227,51,33,83,48,235,18,45,
+184,2,42,138,82,39,96,194,36,58,146,34,25,162,32,253,17,31,229,161,29,211,177,28,
+195,225,27,188,145,27,179,193,27,245,49,39,57,115,67,95,101,106,0,168,170,199,220,223,
+89,142,228,50,254,226,34,30,224,226,141,220,164,77,215,69,141,209,225,60,202,101,140,194,
+226,123,185,77,75,176,179,234,165,12,170,155,98,137,144,178,184,133,0,88,122,78,135,111,
+158,102,100,244,37,90,77,197,79,179,148,70,30,132,61,155,211,53,31,131,46,187,194,40,
+92,130,35,30,242,31,222,17,29,206,129,27,167,49,32,57,99,85,0,72,200,132,94,229,
+230,205,222,196,173,211,198,156,199,242,187,179,168,42,162,103,217,137,0,56,118,153,230,93,
+88,85,76,14,116,56,58,99,44,60,66,33,26,178,26,124,193,55,0,56,217,239,206,214,
+125,12,195,220,202,144,0,72,111,36,5,61,131,67,41,17,209,38,0,40,225,181,253,159,
+0,24,96,75,226,30,0,88,219,0,184,36,0,56,139,99,9,161,181,42,181,229,187,198,
+228,204,212,164,173,222,30,222,227,73,174,228,73,142,228,72,110,228,68,46,228,64,238,227,
+59,142,227,52,14,227,44,142,226,35,238,225,25,62,225,14,126,224,1,174,223,243,205,222,
+228,205,221,212,205,220,195,173,219,177,125,218,157,61,217,137,237,215,115,141,214,92,13,213,
+68,141,211,44,253,209,18,93,208,247,156,206,219,220,204,191,12,203,161,44,201,131,60,199,
+99,60,197,67,60,195,34,28,193,0,252,190,221,203,188,186,139,186,150,75,184,113,235,181,
+76,155,179,38,43,177,255,186,174,215,74,172,176,186,169,135,58,167,94,170,164,53,10,162,
+11,106,159,225,201,156,182,25,154,140,105,151,96,185,148,53,249,145,9,57,143,221,120,140,
+177,184,137,133,248,134,89,56,132,44,104,129,0,168,126,212,215,123,167,23,121,123,87,118,
+79,151,115,35,215,112,247,22,110,203,86,107,160,166,104,116,246,101,74,70,99,31,166,96,
+245,5,94,203,101,91,162,213,88,121,85,86,80,197,83,41,85,81,1,229,78,218,116,76,
+180,36,74,143,196,71,106,132,69,70,68,67,35,20,65,0,244,62,222,211,60,189,211,58,
+157,211,56,125,227,54,95,3,53,65,51,51,37,115,49,9,179,47,238,18,46,212,130,44,
+188,2,43,164,130,41,141,34,40,119,210,38,99,146,37,79,98,36,61,66,35,44,66,34,
+28,66,33,13,98,32,255,145,31,242,209,30,231,33,30,221,129,29,212,1,29,204,129,28,
+197,33,28,192,225,27,188,161,27,184,129,27,183,97,27,183,49,28,226,97,33,92,66,43,
+28,83,57,27,228,74,75,5,95,157,214,116,0,88,150,181,58,190,228,124,218,27,142,228,
+76,110,228,67,30,228,59,62,227,44,78,226,25,222,224,1,62,223,228,77,221,195,29,219,
+157,141,216,115,205,213,68,189,210,18,125,207,219,252,203,161,60,200,99,60,196,34,12,192,
+222,171,187,150,27,183,76,91,178,255,138,173,176,122,168,94,90,163,11,26,158,182,201,152,
+96,89,147,9,217,141,177,88,136,89,200,130,0,72,125,167,183,119,79,55,114,247,182,108,
+160,70,103,74,246,97,245,181,92,162,149,87,80,133,82,1,181,77,180,244,72,106,100,68,
+34,4,64,222,211,59,157,211,55,95,19,52,37,147,48,238,82,45,188,66,42,141,130,39,
+99,242,36,61,194,34,28,210,32,255,49,31,231,193,29,212,209,28,197,241,27,189,161,27,
+180,129,27,229,145,37,28,211,65,75,181,105,0,8,172,226,204,224,91,94,228,49,238,226,
+31,254,223,224,93,220,161,29,215,66,77,209,222,252,201,97,76,194,223,75,185,75,27,176,
+176,202,165,10,154,155,97,121,144,177,184,133,0,88,122,79,151,111,159,118,100,246,69,90,
+80,245,79,181,196,70,33,196,61,159,19,54,34,195,46,190,242,40,95,178,35,32,18,32,
+225,33,29,207,177,27,165,65,31,30,3,84,0,72,201,144,62,229,223,189,222,196,93,211,
+193,124,199,240,107,179,164,42,162,102,169,137,0,104,118,154,230,93,92,165,76,16,148,56,
+63,179,44,60,82,33,33,210,26,112,193,54,0,136,217,240,126,214,120,236,194,218,154,144,
+0,120,111,38,37,61,136,147,41,16,129,38,0,40,225,178,205,159,0,72,96,78,226,30,
+0,40,219,0,232,36,0,152,139,111,25,162,203,186,182,1,156,200,1,141,214,189,253,223,
+45,78,228,75,174,228,72,142,228,71,94,228,67,30,228,63,206,227,57,110,227,51,254,226,
+42,110,226,33,206,225,23,30,225,11,94,224,254,141,223,241,157,222,225,157,221,209,157,220,
+192,125,219,173,77,218,154,13,217,133,173,215,111,77,214,89,221,212,65,93,211,40,189,209,
+14,29,208,244,108,206,216,172,204,187,204,202,157,236,200,127,252,198,96,12,197,64,252,194,
+30,236,192,253,187,190,218,155,188,183,91,186,147,27,184,110,187,181,73,107,179,35,251,176,
+252,138,174,213,26,172,173,154,169,133,10,167,92,122,164,51,234,161,9,74,159,223,169,156,
+181,249,153,138,73,151,95,153,148,52,233,145,8,41,143,220,104,140,177,184,137,132,232,134,
+88,40,132,44,104,129,0,168,126,212,231,123,168,39,121,124,87,118,79,167,115,36,231,112,
+248,38,110,204,118,107,161,198,104,118,22,102,75,102,99,33,198,96,247,37,94,205,149,91,
+164,5,89,123,117,86,83,245,83,43,133,81,4,21,79,221,164,76,183,84,74,146,244,71,
+109,180,69,73,116,67,38,84,65,3,36,63,226,19,61,192,3,59,160,19,57,129,35,55,
+99,67,53,69,99,51,40,163,49,12,243,47,242,82,46,216,178,44,191,50,43,167,194,41,
+145,98,40,123,2,39,102,194,37,83,146,36,64,114,35,47,114,34,31,114,33,15,130,32,
+2,178,31,245,241,30,233,65,30,223,161,29,214,17,29,205,161,28,199,65,28,193,241,27,
+189,177,27,185,129,27,184,97,27,181,193,27,211,17,32,67,130,41,255,114,55,255,83,73,
+53,245,93,145,118,116,0,24,151,202,250,191,2,253,219,41,190,228,74,94,228,67,14,228,
+57,46,227,43,46,226,23,190,224,255,29,223,225,29,221,192,221,218,154,93,216,112,157,213,
+65,141,210,14,77,207,216,188,203,158,252,199,96,252,195,31,220,191,218,123,187,147,235,182,
+73,59,178,252,90,173,173,90,168,92,58,163,9,250,157,181,169,152,95,73,147,8,201,141,
+177,88,136,88,200,130,0,72,125,168,183,119,79,71,114,248,198,108,161,102,103,75,22,98,
+247,213,92,164,181,87,83,181,82,4,213,77,183,36,73,109,148,68,38,52,64,225,19,60,
+160,19,56,98,83,52,40,195,48,242,130,45,191,114,42,144,178,39,102,50,37,64,242,34,
+31,242,32,1,82,31,233,225,29,213,225,28,199,1,28,189,177,27,182,81,27,215,17,36,
+254,18,64,54,245,104,0,136,173,253,172,225,92,62,228,48,222,226,29,206,223,221,45,220,
+157,221,214,62,13,209,218,188,201,94,28,194,219,27,185,72,235,175,174,170,165,9,122,155,
+95,105,144,176,168,133,0,104,122,80,167,111,161,150,100,247,101,90,82,37,80,184,244,70,
+37,244,61,162,83,54,38,3,47,194,50,41,99,226,35,35,66,32,227,49,29,208,209,27,
+164,97,30,3,131,82,0,72,202,156,14,229,217,173,222,195,253,210,187,92,199,237,27,179,
+161,26,162,101,137,137,0,136,118,155,246,93,95,245,76,19,180,56,69,19,45,61,98,33,
+39,2,27,100,193,53,0,216,217,242,46,214,115,204,194,216,106,144,0,168,111,40,69,61,
+141,227,41,14,49,38,0,40,225,175,141,159,0,136,96,81,226,30,0,248,218,0,24,37,
+0,248,139,123,57,163,225,106,184,30,124,202,31,77,216,214,61,225,57,158,228,75,158,228,
+72,142,228,71,94,228,67,30,228,62,190,227,56,94,227,49,222,226,41,78,226,31,174,225,
+21,254,224,9,62,224,252,93,223,238,109,222,223,125,221,206,109,220,189,77,219,170,29,218,
+151,221,216,130,125,215,108,29,214,85,173,212,62,29,211,37,141,209,11,237,207,240,44,206,
+212,108,204,184,156,202,154,188,200,124,204,198,92,204,196,60,204,194,27,172,192,249,139,190,
+215,91,188,180,43,186,144,219,183,107,139,181,70,59,179,32,219,176,249,106,174,210,234,171,
+171,122,169,130,234,166,90,90,164,49,202,161,7,42,159,221,137,156,179,233,153,136,57,151,
+94,137,148,50,217,145,7,25,143,220,104,140,176,168,137,132,232,134,88,40,132,44,104,129,
+0,168,126,212,231,123,168,39,121,124,103,118,80,167,115,36,247,112,249,54,110,206,134,107,
+162,214,104,120,38,102,77,134,99,35,230,96,249,69,94,207,181,91,166,37,89,126,149,86,
+85,37,84,46,165,81,7,53,79,224,212,76,186,132,74,149,52,72,112,228,69,76,180,67,
+41,132,65,7,100,63,229,67,61,196,67,59,164,67,57,132,83,55,102,115,53,72,163,51,
+44,227,49,16,35,48,245,130,46,219,242,44,194,98,43,171,242,41,148,146,40,126,50,39,
+105,242,37,86,194,36,67,162,35,50,146,34,33,162,33,18,178,32,4,210,31,247,17,31,
+235,97,30,224,193,29,215,49,29,207,177,28,200,81,28,194,241,27,189,177,27,185,129,27,
+184,113,27,181,113,27,199,209,30,42,194,39,225,146,53,226,163,71,31,213,92,133,22,116,
+0,216,151,225,202,193,33,141,221,53,222,228,73,78,228,67,254,227,56,30,227,41,14,226,
+20,158,224,253,237,222,222,237,220,189,173,218,150,45,216,109,93,213,61,93,210,11,13,207,
+212,140,203,154,188,199,92,204,195,27,156,191,215,75,187,144,187,182,70,11,178,249,42,173,
+170,58,168,90,26,163,7,218,157,179,137,152,94,57,147,7,185,141,176,72,136,88,200,130,
+0,72,125,168,199,119,80,87,114,249,214,108,162,134,103,77,54,98,249,245,92,166,213,87,
+86,229,82,7,5,78,186,84,73,112,196,68,41,116,64,229,67,60,164,83,56,102,131,52,
+44,3,49,245,178,45,195,178,42,147,226,39,106,98,37,67,34,35,34,34,33,3,114,31,
+236,1,30,215,241,28,200,17,28,189,193,27,183,49,27,203,129,34,223,66,62,31,53,104,
+0,24,175,26,125,226,91,14,228,47,206,226,26,158,223,219,253,219,153,173,214,59,221,208,
+214,140,201,91,220,193,216,235,184,69,187,175,171,138,165,7,90,155,94,89,144,176,168,133,
+0,104,122,80,183,111,162,182,100,249,133,90,85,85,80,187,36,71,40,52,62,165,131,54,
+42,51,47,197,98,41,103,18,36,37,114,32,230,65,29,209,1,28,165,145,29,230,242,80,
+0,72,203,168,222,228,210,157,222,195,173,210,182,60,199,235,219,178,158,26,162,100,105,137,
+0,168,118,156,246,93,98,53,77,21,212,56,74,99,45,61,114,33,46,50,27,88,193,52,
+0,40,218,243,238,213,110,188,194,214,58,144,0,216,111,42,85,61,146,51,42,13,225,37,
+0,40,225,173,93,159,0,184,96,83,226,30,0,216,218,0,56,37,0,104,140,137,105,164,
+249,42,186,61,124,204,62,13,218,239,93,226,66,174,228,74,142,228,72,126,228,69,78,228,
+66,14,228,61,174,227,55,62,227,47,190,226,39,46,226,29,142,225,19,222,224,7,14,224,
+250,61,223,235,77,222,220,77,221,203,61,220,186,29,219,167,221,217,147,157,216,127,77,215,
+105,221,213,82,109,212,58,237,210,33,77,209,7,173,207,236,252,205,209,44,204,180,92,202,
+150,124,200,120,140,198,89,156,196,57,140,194,24,124,192,246,91,190,212,43,188,176,235,185,
+140,171,183,104,91,181,67,11,179,29,171,176,246,58,174,207,202,171,168,74,169,128,202,166,
+87,58,164,47,170,161,5,10,159,219,105,156,177,201,153,135,41,151,92,121,148,49,201,145,
+6,9,143,219,88,140,175,152,137,131,232,134,88,40,132,44,104,129,0,168,126,212,231,123,
+168,39,121,125,119,118,81,183,115,37,7,113,250,70,110,207,150,107,164,230,104,121,70,102,
+79,166,99,37,6,97,251,101,94,209,213,91,169,69,89,128,197,86,88,69,84,49,213,81,
+10,101,79,227,4,77,189,180,74,152,100,72,116,36,70,80,228,67,44,180,65,10,148,63,
+232,131,61,199,115,59,167,131,57,136,147,55,106,179,53,76,227,51,47,19,50,20,99,48,
+249,194,46,223,34,45,198,162,43,174,50,42,151,194,40,129,114,39,109,50,38,89,242,36,
+70,210,35,53,194,34,36,194,33,21,210,32,6,2,32,249,49,31,237,129,30,227,225,29,
+217,81,29,209,209,28,201,97,28,195,1,28,190,193,27,187,145,27,184,129,27,182,97,27,
+190,177,29,17,2,38,194,146,51,195,227,69,7,165,91,119,166,115,0,168,152,249,202,195,
+64,237,222,63,238,228,71,78,228,67,238,227,54,254,226,40,222,225,18,126,224,250,189,222,
+219,189,220,186,125,218,147,253,215,105,45,213,58,29,210,8,205,206,208,76,203,151,140,199,
+88,156,195,24,108,191,211,27,187,141,139,182,67,219,177,247,250,172,168,10,168,88,234,162,
+5,202,157,177,121,152,92,41,147,6,169,141,175,72,136,88,200,130,0,72,125,168,199,119,
+81,103,114,250,230,108,164,150,103,79,70,98,251,37,93,168,5,88,88,21,83,9,53,78,
+189,132,73,115,244,68,45,164,64,232,115,60,168,131,56,105,195,52,48,67,49,248,242,45,
+198,226,42,151,18,40,109,146,37,70,82,35,37,82,33,6,146,31,238,49,30,216,17,29,
+202,33,28,189,193,27,185,33,27,193,33,33,192,66,60,7,101,103,0,184,176,54,61,227,
+90,238,227,47,190,226,23,126,223,217,205,219,149,125,214,56,157,208,210,92,201,88,156,193,
+212,187,184,66,139,175,168,106,165,5,58,155,92,89,144,175,152,133,0,120,122,81,183,111,
+164,214,100,251,165,90,88,133,80,190,84,71,44,116,62,168,179,54,46,115,47,200,146,41,
+107,66,36,39,146,32,233,81,29,209,33,28,166,209,28,202,82,79,0,56,204,179,174,228,
+203,125,222,194,93,210,177,28,199,233,139,178,155,26,162,99,57,137,0,216,118,157,246,93,
+101,133,77,23,244,56,79,179,45,62,146,33,53,98,27,77,209,51,0,120,218,245,158,213,
+105,156,194,212,10,144,0,8,112,44,117,61,151,115,42,11,145,37,0,40,225,170,29,159,
+0,248,96,86,226,30,0,168,218,0,104,37,0,216,140,151,169,165,19,251,187,93,124,206,
+93,221,219,5,62,227,71,190,228,73,142,228,72,126,228,68,62,228,65,238,227,59,158,227,
+54,46,227,46,174,226,37,14,226,27,110,225,16,174,224,4,238,223,247,13,223,232,29,222,
+217,29,221,200,13,220,183,237,218,164,173,217,144,109,216,123,13,215,101,173,213,78,61,212,
+55,173,210,30,29,209,4,109,207,233,188,205,205,252,203,176,44,202,147,76,200,116,92,198,
+85,92,196,53,92,194,20,60,192,243,43,190,208,251,187,173,187,185,137,123,183,101,43,181,
+64,219,178,26,123,176,244,10,174,205,154,171,165,42,169,126,154,166,85,26,164,44,138,161,
+3,234,158,218,89,156,176,185,153,133,9,151,91,89,148,48,185,145,5,249,142,218,72,140,
+174,152,137,131,216,134,87,24,132,44,104,129,0,168,126,212,247,123,169,55,121,125,119,118,
+82,199,115,38,23,113,251,86,110,208,182,107,165,6,105,123,86,102,80,182,99,38,38,97,
+253,133,94,212,245,91,171,117,89,130,229,86,91,117,84,51,5,82,12,149,79,230,52,77,
+192,228,74,155,148,72,119,84,70,83,20,68,48,228,65,13,212,63,236,179,61,203,179,59,
+171,179,57,140,195,55,109,227,53,80,19,52,51,83,50,23,163,48,252,242,46,226,98,45,
+201,210,43,178,98,42,155,2,41,133,162,39,112,98,38,92,34,37,73,2,36,56,242,34,
+39,242,33,24,2,33,9,34,32,252,97,31,240,161,30,229,1,30,219,97,29,210,225,28,
+202,113,28,197,33,28,191,209,27,188,145,27,184,129,27,183,81,27,185,209,28,251,49,36,
+163,146,49,163,19,68,237,100,90,105,54,115,0,120,153,18,219,197,95,61,224,71,222,228,
+69,78,228,67,206,227,52,238,226,38,190,225,15,78,224,248,141,222,216,157,220,184,77,218,
+144,205,215,102,237,212,54,237,209,4,141,206,205,28,203,147,76,199,85,92,195,21,44,191,
+208,219,186,138,75,182,64,171,177,244,202,172,165,234,167,85,202,162,3,170,157,176,89,152,
+91,9,147,5,153,141,174,56,136,87,184,130,0,88,125,169,215,119,82,119,114,251,6,109,
+165,182,103,80,102,98,253,69,93,171,37,88,91,69,83,12,101,78,193,196,73,118,52,69,
+48,228,64,235,179,60,171,195,56,109,243,52,51,131,49,252,34,46,202,34,43,154,66,40,
+112,194,37,72,114,35,40,130,33,8,194,31,241,81,30,218,33,29,204,65,28,189,193,27,
+187,49,27,185,209,31,161,50,58,238,148,102,0,104,178,82,221,227,88,190,227,48,158,226,
+19,78,223,215,157,219,145,77,214,54,93,208,206,44,201,85,92,193,209,139,184,63,91,175,
+166,74,165,3,26,155,91,73,144,174,136,133,0,136,122,82,199,111,165,246,100,253,197,90,
+90,181,80,193,132,71,47,180,62,171,243,54,50,179,47,202,194,41,111,114,36,41,194,32,
+237,113,29,208,81,28,168,49,28,174,162,77,0,40,205,190,126,228,197,109,222,194,13,210,
+171,12,199,231,59,178,151,26,162,98,25,137,0,248,118,158,246,93,105,213,77,25,4,57,
+85,3,46,62,162,33,59,146,27,66,225,50,0,184,218,246,78,213,100,124,194,210,218,143,
+0,56,112,46,149,61,156,195,42,10,81,37,0,24,225,167,221,158,0,56,97,89,242,30,
+0,120,218,0,152,37,0,88,141,166,9,167,46,251,189,126,156,208,125,157,221,26,254,227,
+75,174,228,72,142,228,72,110,228,68,46,228,64,222,227,58,126,227,52,14,227,44,142,226,
+36,254,225,25,78,225,14,142,224,2,190,223,245,221,222,230,237,221,215,237,220,198,221,219,
+180,189,218,161,125,217,141,61,216,120,221,214,98,125,213,75,253,211,51,125,210,26,221,208,
+0,61,207,229,140,205,202,188,203,173,236,201,143,12,200,113,44,198,82,44,196,50,28,194,
+17,12,192,239,235,189,205,203,187,170,139,185,134,75,183,98,11,181,61,171,178,23,75,176,
+241,234,173,202,122,171,163,250,168,123,122,166,83,250,163,42,106,161,1,218,158,216,57,156,
+174,153,153,132,249,150,90,73,148,47,169,145,4,233,142,217,56,140,174,136,137,130,216,134,
+87,24,132,43,104,129,0,168,126,212,247,123,169,55,121,126,135,118,82,215,115,39,39,113,
+252,102,110,209,198,107,166,22,105,124,118,102,82,214,99,40,54,97,255,165,94,214,21,92,
+173,149,89,133,21,87,93,149,84,54,37,82,15,197,79,233,100,77,195,4,75,158,196,72,
+122,132,70,86,68,68,51,36,66,17,4,64,239,243,61,206,227,59,174,227,57,143,3,56,
+113,35,54,83,83,52,54,131,50,27,211,48,0,51,47,230,146,45,205,18,44,181,146,42,
+158,50,41,136,210,39,115,146,38,95,82,37,76,50,36,58,34,35,41,34,34,26,50,33,
+11,82,32,254,129,31,242,193,30,231,17,30,220,129,29,212,1,29,204,145,28,198,49,28,
+192,225,27,188,161,27,184,129,27,184,97,27,181,17,28,230,113,34,131,114,47,130,19,66,
+210,4,89,90,182,114,0,88,154,46,251,199,127,109,225,76,206,228,68,78,228,66,190,227,
+50,206,226,37,158,225,13,46,224,246,109,222,213,109,220,181,29,218,140,157,215,99,189,212,
+51,189,209,1,93,206,201,220,202,144,28,199,81,44,195,17,252,190,205,171,186,135,27,182,
+61,139,177,241,170,172,163,202,167,83,170,162,1,138,157,174,73,152,89,249,146,4,153,141,
+174,56,136,87,184,130,0,88,125,169,215,119,82,119,114,252,22,109,167,198,103,82,134,98,
+255,101,93,173,69,88,93,101,83,15,133,78,195,244,73,121,100,69,51,20,65,239,227,60,
+175,243,56,112,51,53,55,179,49,255,82,46,205,82,43,157,114,40,116,242,37,75,162,35,
+43,162,33,10,226,31,243,113,30,219,65,29,206,81,28,190,193,27,188,65,27,180,161,30,
+129,18,56,210,180,101,0,24,180,111,125,228,84,158,227,48,142,226,16,46,223,214,109,219,
+141,29,214,51,29,208,202,252,200,82,44,193,205,107,184,61,43,175,163,58,165,1,234,154,
+90,73,144,174,120,133,0,152,122,82,199,111,166,38,101,255,213,90,93,229,80,195,164,71,
+51,228,62,174,19,55,54,243,47,205,242,41,115,162,36,42,226,32,240,129,29,208,113,28,
+172,145,27,145,242,75,0,40,206,200,78,228,190,93,222,193,189,209,166,236,198,229,251,177,
+148,10,162,97,233,136,0,40,119,159,6,94,108,21,78,27,36,57,90,83,46,63,162,33,
+66,194,27,56,225,49,0,8,219,247,254,212,95,92,194,208,186,143,0,88,112,48,181,61,
+161,19,43,9,1,37,0,24,225,165,173,158,0,104,97,91,242,30,0,88,218,0,184,37,
+0,232,141,182,121,168,76,27,192,161,188,210,157,77,223,44,110,228,75,158,228,72,142,228,
+71,94,228,67,30,228,63,206,227,57,110,227,51,238,226,42,110,226,34,206,225,23,46,225,
+12,110,224,255,157,223,242,189,222,227,205,221,212,189,220,195,173,219,177,125,218,158,77,217,
+138,253,215,117,173,214,95,61,213,72,205,211,48,61,210,23,173,208,253,252,206,226,76,205,
+198,140,203,169,188,201,140,220,199,109,236,197,78,236,195,46,236,193,13,220,191,236,187,189,
+202,139,187,167,91,185,131,27,183,95,203,180,58,123,178,20,27,176,238,186,173,200,74,171,
+161,218,168,121,90,166,81,218,163,40,74,161,255,185,158,214,25,156,172,121,153,130,217,150,
+88,57,148,46,137,145,3,233,142,216,56,140,173,120,137,130,200,134,87,24,132,43,104,129,
+0,168,126,213,247,123,169,71,121,126,151,118,83,215,115,40,39,113,253,134,110,210,214,107,
+168,54,105,126,150,102,84,246,99,42,86,97,1,198,94,216,53,92,175,181,89,135,53,87,
+95,197,84,56,85,82,18,245,79,236,148,77,198,68,75,161,244,72,125,180,70,89,132,68,
+54,84,66,20,52,64,243,35,62,210,35,60,178,35,58,147,51,56,116,83,54,87,131,52,
+58,195,50,30,19,49,3,99,47,233,210,45,208,66,44,184,210,42,161,98,41,139,18,40,
+118,194,38,98,146,37,79,98,36,61,82,35,44,66,34,29,82,33,14,114,32,1,162,31,
+244,225,30,233,65,30,222,161,29,214,33,29,205,161,28,199,65,28,193,241,27,189,177,27,
+185,129,27,184,113,27,181,161,27,212,193,32,99,82,45,95,243,63,180,148,87,74,38,114,
+0,72,155,75,75,202,158,109,226,79,174,228,67,62,228,65,158,227,48,190,226,35,126,225,
+11,14,224,243,61,222,211,61,220,178,221,217,137,93,215,95,125,212,47,125,209,253,28,206,
+198,172,202,140,220,198,78,252,194,14,188,190,201,123,186,131,235,181,58,91,177,239,122,172,
+160,154,167,81,138,162,255,105,157,172,41,152,88,233,146,3,137,141,173,40,136,87,184,130,
+0,88,125,169,231,119,83,135,114,253,38,109,168,230,103,84,166,98,1,134,93,175,117,88,
+96,149,83,17,181,78,198,36,74,125,148,69,55,84,65,242,19,61,178,51,57,116,99,53,
+58,243,49,3,147,46,209,146,43,161,178,40,119,50,38,78,210,35,45,210,33,13,2,32,
+245,145,30,221,81,29,208,113,28,191,209,27,189,97,27,177,161,29,98,194,53,181,196,100,
+0,232,181,140,13,229,80,126,227,49,110,226,11,254,222,213,45,219,137,237,213,49,221,207,
+197,204,200,79,236,192,201,59,184,58,235,174,160,26,165,0,202,154,88,57,144,173,104,133,
+0,168,122,83,215,111,168,70,101,0,246,90,96,37,81,198,212,71,55,36,63,177,67,55,
+59,51,48,207,34,42,119,226,36,43,18,33,245,161,29,207,145,28,176,1,27,116,34,74,
+0,8,207,211,14,228,184,77,222,192,93,209,161,204,198,227,171,177,145,10,162,96,201,136,
+0,72,119,160,6,94,111,101,78,29,68,57,95,179,46,64,194,33,72,2,28,45,1,49,
+0,72,219,248,174,212,90,60,194,206,138,143,0,136,112,50,213,61,166,99,43,8,193,36,
+0,8,225,162,125,158,0,152,97,94,2,31,0,40,218,0,232,37,0,120,142,200,9,170,
+107,75,194,198,252,212,189,221,224,58,174,228,74,142,228,72,142,228,70,78,228,66,14,228,
+62,190,227,56,94,227,49,222,226,41,78,226,32,190,225,21,14,225,10,78,224,253,125,223,
+239,141,222,225,157,221,209,141,220,192,125,219,174,77,218,155,29,217,135,205,215,114,125,214,
+91,13,213,68,141,211,44,13,210,19,109,208,249,204,206,222,28,205,195,76,203,166,124,201,
+136,156,199,106,188,197,75,188,195,43,188,193,10,172,191,233,139,189,199,91,187,164,43,185,
+128,235,182,92,171,180,55,75,178,18,251,175,236,138,173,197,42,171,158,170,168,119,58,166,
+79,170,163,38,42,161,253,153,158,212,9,156,171,105,153,129,201,150,87,41,148,45,121,145,
+2,217,142,215,40,140,172,120,137,129,200,134,86,24,132,43,104,129,0,168,126,213,247,123,
+170,71,121,127,151,118,84,231,115,41,55,113,254,150,110,211,230,107,169,70,105,127,166,102,
+85,6,100,44,118,97,3,230,94,218,101,92,177,213,89,137,101,87,98,229,84,59,133,82,
+20,21,80,238,196,77,201,100,75,164,36,73,128,228,70,92,180,68,57,132,66,23,100,64,
+246,83,62,213,83,60,181,83,58,150,115,56,120,147,54,90,195,52,61,243,50,34,67,49,
+7,163,47,237,2,46,212,130,44,188,2,43,165,146,41,142,66,40,121,242,38,101,194,37,
+82,146,36,64,130,35,47,114,34,31,130,33,17,146,32,3,194,31,246,1,31,235,81,30,
+224,193,29,215,49,29,207,177,28,200,81,28,194,1,28,190,193,27,186,129,27,184,129,27,
+182,97,27,198,49,31,67,18,43,58,195,61,149,4,86,56,150,113,0,88,156,107,171,204,
+188,77,227,81,142,228,66,62,228,64,126,227,47,174,226,33,94,225,9,238,223,240,13,222,
+208,13,220,175,173,217,134,45,215,92,77,212,44,77,209,250,236,205,194,108,202,137,172,198,
+75,188,194,10,140,190,198,75,186,128,187,181,55,43,177,236,90,172,158,122,167,79,106,162,
+253,89,157,171,25,152,87,217,146,2,121,141,172,40,136,86,184,130,0,88,125,170,231,119,
+84,151,114,254,54,109,169,246,103,85,182,98,3,166,93,177,149,88,98,181,83,20,229,78,
+201,84,74,128,196,69,58,132,65,246,83,61,181,99,57,119,163,53,62,35,50,6,195,46,
+212,194,43,164,226,40,122,98,38,82,2,36,48,2,34,16,34,32,247,177,30,223,97,29,
+209,145,28,192,209,27,190,129,27,175,193,28,68,98,51,149,180,99,0,200,183,169,125,229,
+74,94,227,51,78,226,7,222,222,212,253,218,132,189,213,46,157,207,193,156,200,76,156,192,
+197,27,184,56,187,174,157,10,165,254,169,154,87,57,144,173,88,133,0,184,122,83,215,111,
+169,102,101,2,6,91,99,85,81,200,244,71,59,116,63,180,115,55,63,115,48,210,82,42,
+124,18,37,44,50,33,249,193,29,205,177,28,182,145,26,87,66,72,0,248,207,221,222,227,
+177,61,222,192,13,209,156,188,198,225,91,177,142,10,162,95,153,136,0,120,119,161,6,94,
+114,181,78,31,84,57,100,3,47,64,210,33,79,50,28,35,17,48,0,136,219,248,94,212,
+86,28,194,204,106,143,0,168,112,52,245,61,170,179,43,8,129,36,0,8,225,159,61,158,
+0,216,97,97,2,31,0,248,217,0,24,38,0,24,143,219,185,171,140,155,196,236,60,215,
+220,45,226,68,190,228,73,142,228,72,126,228,69,62,228,66,254,227,60,174,227,55,62,227,
+47,190,226,39,62,226,30,158,225,19,238,224,7,30,224,251,77,223,237,109,222,222,109,221,
+206,109,220,189,77,219,171,29,218,152,237,216,131,157,215,110,61,214,88,221,212,65,93,211,
+41,205,209,16,61,208,246,140,206,219,220,204,191,28,203,162,76,201,133,108,199,103,124,197,
+71,140,195,40,124,193,7,108,191,229,75,189,195,43,187,161,251,184,125,187,182,89,123,180,
+52,43,178,15,203,175,233,106,173,195,250,170,156,138,168,116,10,166,76,138,163,36,10,161,
+252,121,158,211,233,155,169,73,153,128,185,150,86,25,148,43,105,145,1,201,142,214,24,140,
+172,104,137,129,184,134,86,24,132,43,88,129,0,184,126,213,247,123,170,87,121,127,167,118,
+84,247,115,41,71,113,255,166,110,213,246,107,170,86,105,128,198,102,87,38,100,45,150,97,
+4,6,95,220,133,92,180,5,90,140,133,87,100,21,85,61,165,82,23,69,80,241,228,77,
+204,148,75,167,84,73,131,20,71,95,228,68,61,196,66,27,164,64,249,147,62,216,131,60,
+185,147,58,153,163,56,123,195,54,94,243,52,65,51,51,37,131,49,10,211,47,240,66,46,
+215,178,44,191,50,43,168,210,41,146,114,40,125,34,39,104,242,37,85,194,36,67,162,35,
+50,162,34,34,162,33,19,194,32,5,242,31,249,33,31,237,113,30,226,209,29,217,81,29,
+209,209,28,201,97,28,196,17,28,190,209,27,187,145,27,184,129,27,183,81,27,188,225,29,
+36,210,40,20,115,59,116,84,84,37,246,112,0,120,157,141,27,207,217,253,227,80,110,228,
+66,62,228,62,110,227,46,142,226,31,46,225,7,190,223,238,221,221,205,221,219,171,125,217,
+131,253,214,88,29,212,40,13,209,246,172,205,191,60,202,133,108,198,71,140,194,7,92,190,
+195,27,186,125,155,181,52,251,176,233,42,172,156,90,167,77,74,162,251,57,157,169,249,151,
+86,201,146,1,105,141,172,24,136,86,184,130,0,88,125,170,247,119,84,167,114,255,70,109,
+170,22,104,87,214,98,5,198,93,179,181,88,100,229,83,23,21,79,204,116,74,131,244,69,
+61,180,65,249,131,61,185,163,57,123,211,53,65,99,50,10,3,47,215,242,43,168,18,41,
+125,146,38,85,50,36,51,50,34,18,82,32,249,225,30,225,129,29,210,161,28,194,209,27,
+190,161,27,176,17,28,39,242,48,115,148,98,0,168,185,197,221,229,68,62,227,53,46,226,
+2,190,222,211,189,218,127,157,213,44,93,207,188,108,200,74,92,192,193,251,183,54,123,174,
+154,234,164,252,121,154,85,57,144,172,72,133,0,200,122,84,215,111,171,150,101,4,38,91,
+102,149,81,202,20,72,63,180,63,182,163,55,68,179,48,212,114,42,129,82,37,45,82,33,
+254,225,29,203,209,28,188,49,26,59,98,70,0,216,208,230,158,227,171,45,222,191,189,208,
+150,156,198,223,27,177,139,10,162,94,121,136,0,152,119,162,6,94,117,245,78,33,116,57,
+106,83,47,65,226,33,85,114,28,26,49,47,0,200,219,249,30,212,81,12,194,202,58,143,
+0,216,112,54,5,62,175,243,43,7,65,36,0,248,224,156,13,158,0,8,98,100,18,31,
+0,200,217,0,72,38,0,184,143,240,153,173,176,251,198,19,141,217,250,77,227,73,190,228,
+72,142,228,72,110,228,68,62,228,65,238,227,59,142,227,53,46,227,45,174,226,38,30,226,
+27,126,225,17,190,224,5,254,223,248,29,223,234,61,222,219,61,221,203,61,220,186,29,219,
+168,237,217,149,173,216,128,109,215,107,13,214,85,157,212,62,29,211,37,157,209,12,253,207,
+242,92,206,215,156,204,187,220,202,159,12,201,129,44,199,99,76,197,68,76,195,36,76,193,
+3,60,191,226,27,189,192,251,186,157,203,184,122,139,182,86,75,180,49,251,177,12,155,175,
+230,58,173,192,218,170,153,106,168,114,234,165,74,106,163,34,234,160,250,89,158,209,201,155,
+168,57,153,126,153,150,84,249,147,42,89,145,0,185,142,214,8,140,171,104,137,128,184,134,
+86,8,132,43,88,129,0,184,126,213,7,124,170,87,121,128,167,118,85,7,116,42,87,113,
+0,183,110,214,22,108,172,118,105,130,214,102,88,70,100,47,182,97,6,38,95,222,165,92,
+182,37,90,142,165,87,103,53,85,64,213,82,26,117,80,244,20,78,207,196,75,170,132,73,
+134,68,71,99,20,69,64,244,66,30,212,64,253,195,62,220,195,60,188,195,58,157,227,56,
+127,3,55,97,51,53,69,115,51,41,179,49,14,19,48,244,114,46,219,242,44,194,114,43,
+171,2,42,149,162,40,128,98,39,107,34,38,88,242,36,70,210,35,53,210,34,37,210,33,
+22,242,32,8,18,32,251,81,31,239,145,30,229,241,29,218,97,29,211,225,28,203,129,28,
+197,33,28,191,209,27,188,161,27,184,129,27,184,81,27,183,193,28,6,130,38,237,18,57,
+80,116,82,16,86,112,0,184,158,177,155,209,244,141,228,78,94,228,67,46,228,60,78,227,
+45,110,226,28,14,225,5,158,223,234,189,221,203,173,219,168,77,217,128,189,214,85,221,211,
+37,205,208,242,124,205,187,252,201,129,60,198,68,76,194,4,44,190,192,219,185,122,107,181,
+49,203,176,230,10,172,153,42,167,74,42,162,250,25,157,168,233,151,84,169,146,0,105,141,
+171,24,136,86,184,130,0,88,125,170,247,119,85,167,114,0,103,109,172,38,104,88,246,98,
+6,230,93,182,229,88,103,5,84,26,69,79,207,164,74,134,52,70,64,228,65,253,195,61,
+188,211,57,127,19,54,69,147,50,14,67,47,219,50,44,171,82,41,128,194,38,88,98,36,
+53,82,34,22,114,32,251,1,31,228,161,29,211,193,28,196,225,27,189,177,27,178,129,27,
+12,114,46,79,84,97,0,152,187,226,45,230,61,30,227,55,14,226,253,157,222,210,125,218,
+122,109,213,42,13,207,184,76,200,71,28,192,189,219,183,51,59,174,152,218,164,251,73,154,
+83,57,144,172,40,133,0,232,122,85,215,111,173,198,101,5,54,91,104,213,81,205,52,72,
+67,244,63,185,195,55,72,3,49,214,162,42,134,146,37,46,114,33,3,2,30,201,241,28,
+195,225,25,30,114,68,0,168,209,239,110,227,164,29,222,191,109,208,145,124,198,221,203,176,
+136,10,162,93,89,136,0,184,119,163,6,94,120,69,79,35,148,57,111,163,47,65,242,33,
+92,162,28,17,97,46,0,248,219,249,206,211,76,220,193,200,10,143,0,8,113,56,53,62,
+180,67,44,7,17,36,0,232,224,153,221,157,0,56,98,103,34,31,0,152,217,0,120,38,
+0,104,144,7,154,175,214,155,201,60,221,219,20,14,228,76,174,228,72,142,228,72,94,228,
+67,46,228,64,222,227,58,126,227,52,14,227,44,142,226,36,254,225,26,94,225,15,158,224,
+3,222,223,246,253,222,232,13,222,217,29,221,200,13,220,183,237,218,165,189,217,146,125,216,
+125,61,215,104,221,213,81,109,212,58,237,210,34,109,209,9,205,207,239,44,206,212,108,204,
+184,172,202,156,220,200,126,252,198,96,12,197,65,28,195,33,28,193,0,12,191,223,235,188,
+189,203,186,154,155,184,119,91,182,83,27,180,46,203,177,9,123,175,228,26,173,190,170,170,
+151,58,168,112,202,165,72,74,163,32,202,160,248,73,158,207,185,155,166,25,153,125,137,150,
+83,233,147,41,73,145,255,168,142,213,8,140,170,88,137,128,184,134,85,8,132,43,88,129,
+0,184,126,213,7,124,171,87,121,128,183,118,86,7,116,43,103,113,1,199,110,215,38,108,
+173,134,105,131,246,102,90,102,100,49,198,97,8,70,95,224,197,92,184,69,90,144,213,87,
+105,101,85,66,245,82,28,149,80,247,68,78,210,244,75,173,180,73,137,116,71,102,68,69,
+67,36,67,33,4,65,0,244,62,223,243,60,191,3,59,160,19,57,130,51,55,100,99,53,
+72,163,51,44,227,49,17,67,48,247,162,46,222,34,45,198,162,43,175,50,42,152,210,40,
+131,146,39,110,82,38,91,34,37,73,2,36,56,242,34,39,2,34,24,18,33,10,50,32,
+253,113,31,241,177,30,230,17,30,220,129,29,212,1,29,204,145,28,198,49,28,192,225,27,
+189,177,27,184,129,27,184,97,27,180,1,28,236,49,36,196,114,54,42,116,80,249,165,111,
+0,40,160,216,27,212,13,238,228,75,62,228,68,46,228,58,62,227,45,78,226,25,238,224,
+3,110,223,231,141,221,201,125,219,164,29,217,125,141,214,81,173,211,34,157,208,239,76,205,
+184,188,201,126,12,198,65,28,194,0,252,189,189,171,185,119,59,181,47,155,176,228,234,171,
+151,10,167,72,10,162,248,249,156,166,217,151,83,153,146,255,88,141,170,8,136,85,184,130,
+0,88,125,171,7,120,86,183,114,1,119,109,173,54,104,90,22,99,8,6,94,184,5,89,
+105,37,84,28,117,79,209,212,74,137,100,70,67,20,66,0,244,61,191,3,58,130,83,54,
+72,195,50,17,115,47,222,98,44,175,130,41,131,242,38,92,146,36,55,130,34,25,162,32,
+253,33,31,231,193,29,211,209,28,198,225,27,188,209,27,181,33,27,243,241,43,40,228,95,
+0,136,189,255,109,230,54,14,227,58,222,225,248,141,222,210,61,218,117,77,213,40,205,206,
+179,44,200,69,204,191,185,187,183,49,11,174,149,202,164,249,41,154,82,73,144,171,24,133,
+0,248,122,85,199,111,174,230,101,7,70,91,107,5,82,207,84,72,71,68,64,187,227,55,
+77,67,49,216,194,42,139,210,37,46,130,33,8,50,30,198,1,29,202,161,25,1,130,66,
+0,120,210,248,46,227,158,29,222,190,29,208,140,108,198,219,139,176,133,250,161,92,41,136,
+0,232,119,164,22,94,123,133,79,37,164,57,116,243,47,66,242,33,98,226,28,8,145,45,
+0,56,220,250,142,211,72,204,193,198,234,142,0,40,113,58,69,62,184,131,44,6,209,35,
+0,216,224,151,173,157,0,104,98,105,50,31,0,120,217,0,152,38,0,56,145,31,202,177,
+255,75,204,103,29,222,42,142,228,75,142,228,72,142,228,71,78,228,67,30,228,63,206,227,
+57,110,227,50,238,226,42,110,226,34,222,225,24,46,225,13,126,224,0,174,223,243,205,222,
+229,237,221,214,237,220,197,221,219,180,189,218,162,141,217,142,77,216,122,253,214,100,157,213,
+78,61,212,55,189,210,30,45,209,5,141,207,235,236,205,208,60,204,181,108,202,152,156,200,
+122,204,198,92,220,196,61,220,194,29,220,192,253,203,190,220,187,188,186,155,186,151,107,184,
+116,43,182,80,235,179,44,155,177,7,75,175,225,234,172,187,138,170,148,26,168,109,170,165,
+70,42,163,30,170,160,246,41,158,205,153,155,164,9,153,123,105,150,82,217,147,40,57,145,
+254,152,142,212,248,139,170,88,137,127,168,134,85,8,132,43,88,129,0,184,126,213,7,124,
+171,103,121,129,183,118,86,23,116,44,119,113,2,215,110,216,54,108,174,166,105,133,6,103,
+92,118,100,51,230,97,10,102,95,226,229,92,186,101,90,147,245,87,108,133,85,69,37,83,
+31,197,80,249,116,78,212,36,76,176,228,73,140,164,71,105,116,69,70,84,67,36,68,65,
+3,52,63,227,51,61,195,51,59,164,67,57,134,115,55,104,163,53,75,211,51,48,35,50,
+21,131,48,251,226,46,226,82,45,201,210,43,178,114,42,156,18,41,134,194,39,114,130,38,
+94,82,37,76,50,36,59,34,35,42,34,34,27,66,33,13,98,32,0,146,31,243,225,30,
+232,49,30,222,161,29,214,33,29,206,161,28,199,65,28,193,241,27,189,193,27,185,129,27,
+184,129,27,181,129,27,214,241,33,153,194,51,1,68,78,225,213,110,0,200,161,2,156,214,
+35,30,229,72,46,228,69,14,228,55,30,227,44,46,226,22,206,224,2,62,223,228,109,221,
+198,77,219,161,237,216,123,77,214,77,125,211,31,93,208,235,28,205,181,140,201,122,220,197,
+62,220,193,253,203,189,186,123,185,116,11,181,44,107,176,225,186,171,149,218,166,70,250,161,
+246,217,156,164,201,151,82,137,146,254,72,141,170,248,135,85,184,130,0,88,125,171,23,120,
+86,199,114,2,135,109,174,70,104,92,54,99,10,22,94,186,53,89,107,85,84,31,165,79,
+212,4,75,140,148,70,70,68,66,3,52,62,194,51,58,134,131,54,75,243,50,21,179,47,
+225,146,44,179,194,41,133,34,39,95,194,36,58,162,34,28,210,32,254,65,31,234,225,29,
+212,241,28,201,1,28,187,225,27,184,241,26,221,113,41,254,67,94,0,120,191,26,158,230,
+45,254,226,61,174,225,242,109,222,209,253,217,112,45,213,39,125,206,174,252,199,67,140,191,
+181,155,183,47,203,173,146,202,164,248,249,153,80,73,144,170,248,132,0,24,123,86,199,111,
+176,22,102,8,70,91,110,69,82,209,116,72,75,132,64,189,19,56,82,147,49,217,226,42,
+144,18,38,47,162,33,14,98,30,195,17,29,211,113,25,230,145,64,0,72,211,0,239,226,
+152,253,221,189,205,207,135,76,198,216,59,176,129,250,161,91,9,136,0,8,120,165,22,94,
+127,213,79,40,196,57,121,67,48,67,18,34,104,34,29,0,193,44,0,104,220,250,62,211,
+67,172,193,196,202,142,0,72,113,60,101,62,189,211,44,6,161,35,0,200,224,148,125,157,
+0,152,98,108,66,31,0,72,217,0,200,38,0,24,146,59,26,180,43,44,207,146,29,224,
+59,206,228,74,142,228,72,142,228,69,78,228,66,14,228,61,174,227,56,94,227,49,222,226,
+41,94,226,32,190,225,22,14,225,10,78,224,254,141,223,241,173,222,227,189,221,211,189,220,
+195,173,219,177,141,218,159,93,217,139,29,216,119,205,214,97,109,213,75,253,211,51,125,210,
+27,253,208,2,93,207,232,172,205,205,252,203,177,60,202,148,108,200,119,140,198,89,172,196,
+58,172,194,26,172,192,250,155,190,216,139,188,183,91,186,148,59,184,113,251,181,77,187,179,
+41,107,177,4,27,175,223,202,172,184,90,170,146,250,167,107,138,165,68,10,163,28,138,160,
+244,9,158,204,121,155,163,233,152,122,89,150,80,201,147,39,41,145,253,136,142,211,232,139,
+169,72,137,127,168,134,85,248,131,42,88,129,0,184,126,214,23,124,171,103,121,129,199,118,
+87,39,116,45,135,113,3,231,110,217,70,108,176,182,105,134,38,103,93,150,100,52,6,98,
+12,134,95,228,5,93,188,133,90,149,21,88,110,181,85,71,69,83,33,245,80,252,164,78,
+215,84,76,179,20,74,143,212,71,108,180,69,73,132,67,40,116,65,6,100,63,230,99,61,
+198,99,59,167,131,57,137,163,55,108,211,53,79,19,52,51,99,50,24,179,48,254,18,47,
+229,146,45,205,18,44,181,162,42,159,66,41,137,242,39,117,178,38,97,130,37,79,98,36,
+61,82,35,45,82,34,29,98,33,15,130,32,2,194,31,246,1,31,234,81,30,224,177,29,
+215,49,29,207,177,28,200,97,28,195,1,28,190,193,27,187,129,27,184,129,27,182,65,27,
+197,241,31,110,226,48,213,243,75,197,245,109,0,152,163,46,12,217,54,46,229,68,46,228,
+70,254,227,53,14,227,43,14,226,20,190,224,0,30,223,225,61,221,196,29,219,157,205,216,
+120,29,214,74,77,211,28,29,208,231,236,204,178,76,201,118,156,197,59,172,193,249,155,189,
+183,59,185,112,235,180,41,59,176,222,154,171,146,186,166,68,218,161,244,185,156,163,169,151,
+81,105,146,253,72,141,169,232,135,85,184,130,0,88,125,171,39,120,87,199,114,3,167,109,
+175,102,104,93,86,99,12,54,94,188,85,89,110,117,84,34,213,79,215,36,75,144,212,70,
+73,116,66,7,100,62,197,99,58,138,195,54,78,35,51,25,243,47,228,194,44,182,242,41,
+136,66,39,99,242,36,60,210,34,31,242,32,0,82,31,236,1,30,213,1,29,203,17,28,
+186,225,27,188,225,26,201,1,39,210,115,92,0,120,193,54,190,230,36,238,226,65,126,225,
+236,93,222,209,189,217,107,13,213,37,45,206,169,220,199,65,60,191,177,139,183,45,139,173,
+143,186,164,247,201,153,79,73,144,170,232,132,0,40,123,86,199,111,177,70,102,9,86,91,
+113,133,82,211,132,72,79,212,64,191,51,56,87,227,49,219,2,43,149,82,38,47,178,33,
+20,146,30,191,33,29,220,81,25,202,145,62,0,8,212,8,175,226,145,237,221,188,125,207,
+130,44,198,214,251,175,126,250,161,90,233,135,0,40,120,166,22,94,130,21,80,42,228,57,
+126,147,48,68,34,34,111,98,29,248,0,44,0,152,220,250,254,210,63,124,193,194,154,142,
+0,120,113,62,149,62,193,19,45,6,113,35,0,184,224,145,77,157,0,200,98,111,82,31,
+0,24,217,0,248,38,0,40,147,89,170,182,90,60,210,189,237,225,71,206,228,72,142,228,
+73,126,228,68,62,228,66,254,227,60,174,227,55,62,227,47,206,226,40,62,226,30,158,225,
+20,238,224,8,46,224,252,93,223,238,125,222,224,141,221,208,141,220,192,125,219,174,93,218,
+156,45,217,136,237,215,116,157,214,94,61,213,72,205,211,48,77,210,24,189,208,254,44,207,
+229,124,205,201,204,203,174,12,202,145,60,200,116,92,198,85,108,196,55,124,194,23,124,192,
+247,107,190,213,91,188,180,43,186,145,11,184,110,203,181,74,139,179,38,75,177,1,251,174,
+220,154,172,182,58,170,144,202,167,105,106,165,66,234,162,26,106,160,242,233,157,202,105,155,
+161,217,152,120,73,150,79,169,147,38,25,145,252,120,142,210,232,139,169,56,137,126,168,134,
+84,248,131,42,88,129,0,184,126,214,23,124,172,103,121,130,215,118,87,39,116,46,151,113,
+4,247,110,218,102,108,177,198,105,136,54,103,95,166,100,54,38,98,14,166,95,230,37,93,
+190,165,90,151,69,88,112,213,85,74,117,83,36,21,81,255,196,78,218,132,76,182,68,74,
+146,4,72,111,228,69,76,180,67,43,164,65,9,148,63,233,147,61,201,163,59,171,179,57,
+140,211,55,111,3,54,82,67,52,55,147,50,27,227,48,2,83,47,232,194,45,208,66,44,
+184,210,42,162,114,41,140,34,40,120,226,38,100,178,37,82,146,36,64,130,35,48,130,34,
+32,146,33,18,178,32,4,226,31,248,33,31,236,113,30,226,209,29,216,65,29,209,209,28,
+201,97,28,196,17,28,190,209,27,188,145,27,183,129,27,184,65,27,185,33,30,67,210,45,
+166,99,73,167,229,108,0,168,165,94,108,219,70,46,229,65,46,228,71,222,227,50,254,226,
+43,238,225,17,158,224,254,237,222,222,29,221,194,237,218,154,157,216,117,221,213,70,29,211,
+25,237,207,227,172,204,175,12,201,115,108,197,55,108,193,246,107,189,180,11,185,109,187,180,
+39,11,176,219,122,171,144,138,166,65,186,161,243,153,156,161,153,151,79,89,146,252,56,141,
+169,232,135,84,184,130,0,88,125,172,39,120,87,215,114,4,183,109,177,118,104,95,118,99,
+13,86,94,191,133,89,112,149,84,37,5,80,217,84,75,147,4,71,76,164,66,10,164,62,
+201,163,58,141,3,55,81,99,51,29,35,48,231,242,44,186,50,42,139,114,39,102,34,37,
+62,242,34,34,34,33,2,114,31,239,33,30,213,17,29,206,49,28,185,225,27,191,225,26,
+186,161,36,162,99,90,0,120,195,81,206,230,27,222,226,68,78,225,230,61,222,210,109,217,
+101,237,212,36,221,205,164,188,199,63,236,190,173,107,183,43,75,173,140,170,164,245,153,153,
+77,89,144,169,200,132,0,72,123,87,183,111,179,118,102,11,102,91,116,197,82,213,164,72,
+83,36,65,193,83,56,92,51,50,220,34,43,155,162,38,46,210,33,26,194,30,188,49,29,
+229,65,25,175,145,60,0,200,212,16,127,226,139,221,221,187,45,207,125,12,198,212,187,175,
+123,250,161,89,201,135,0,72,120,167,22,94,133,85,80,44,4,58,131,227,48,69,50,34,
+117,146,29,240,64,43,0,200,220,250,174,210,59,108,193,192,122,142,0,152,113,64,165,62,
+197,99,45,6,65,35,0,168,224,142,29,157,0,248,98,114,98,31,0,232,216,0,40,39,
+0,72,148,122,90,185,141,108,213,229,61,227,76,174,228,71,142,228,72,110,228,67,46,228,
+65,238,227,58,142,227,54,30,227,45,174,226,38,30,226,28,126,225,18,206,224,6,14,224,
+250,61,223,236,93,222,221,93,221,205,93,220,189,77,219,171,45,218,153,253,216,133,189,215,
+112,93,214,90,13,213,68,141,211,44,29,210,20,141,208,251,236,206,225,60,205,198,140,203,
+170,204,201,142,252,199,112,28,198,82,60,196,51,60,194,19,76,192,243,59,190,210,27,188,
+176,251,185,142,219,183,107,155,181,71,107,179,35,27,177,255,202,174,217,106,172,180,26,170,
+141,170,167,103,58,165,64,202,162,24,74,160,240,201,157,200,73,155,160,185,152,119,57,150,
+78,153,147,37,9,145,251,104,142,210,216,139,168,56,137,126,152,134,84,248,131,42,88,129,
+0,184,126,214,23,124,172,119,121,130,215,118,88,55,116,46,167,113,5,7,111,219,118,108,
+178,214,105,137,86,103,96,198,100,56,70,98,16,198,95,232,69,93,192,213,90,153,101,88,
+115,245,85,76,165,83,39,69,81,2,245,78,221,164,76,185,116,74,149,52,72,114,20,70,
+80,244,67,46,212,65,13,196,63,237,211,61,205,211,59,174,243,57,144,19,56,114,67,54,
+86,131,52,58,211,50,31,35,49,5,131,47,236,242,45,212,130,44,188,2,43,166,178,41,
+144,82,40,123,18,39,103,226,37,85,194,36,67,178,35,51,178,34,35,178,33,20,210,32,
+6,2,32,250,65,31,238,145,30,228,241,29,218,97,29,211,241,28,202,129,28,198,33,28,
+191,225,27,189,161,27,184,129,27,185,97,27,180,209,28,27,162,42,115,163,70,134,197,107,
+0,248,167,144,156,221,82,14,229,62,62,228,71,190,227,48,238,226,41,190,225,14,126,224,
+252,189,222,219,237,220,191,173,218,151,109,216,114,173,213,67,237,210,22,173,207,224,124,204,
+171,220,200,111,60,197,52,44,193,242,59,189,177,219,184,106,155,180,36,219,175,217,90,171,
+142,106,166,63,154,161,241,121,156,159,137,151,78,73,146,251,56,141,168,216,135,84,184,130,
+0,88,125,172,55,120,88,215,114,5,199,109,178,134,104,97,150,99,15,118,94,193,165,89,
+114,181,84,39,53,80,220,132,75,150,52,71,79,212,66,14,228,62,204,211,58,145,51,55,
+85,147,51,32,99,48,234,34,45,189,98,42,142,162,39,105,98,37,65,34,35,37,82,33,
+4,146,31,242,81,30,215,33,29,208,81,28,185,209,27,194,1,27,174,113,34,112,19,88,
+0,104,197,107,206,230,17,222,226,72,30,225,223,45,222,210,45,217,95,205,212,34,141,205,
+159,172,199,60,172,190,169,91,183,41,251,172,137,170,164,244,105,153,76,89,144,169,168,132,
+0,104,123,87,183,111,180,166,102,12,102,91,119,21,83,215,180,72,87,100,65,196,99,56,
+97,131,50,222,66,43,161,226,38,46,226,33,33,242,30,184,49,29,239,65,25,149,161,58,
+0,120,213,23,63,226,133,205,221,186,221,206,120,236,197,210,107,175,120,234,161,88,169,135,
+0,104,120,168,38,94,136,165,80,46,20,58,136,51,49,70,66,34,123,210,29,233,144,42,
+0,232,220,250,110,210,54,60,193,190,90,142,0,184,113,66,213,62,202,163,45,6,33,35,
+0,152,224,139,237,156,0,40,99,117,114,31,0,184,216,0,88,39,0,152,149,159,106,188,
+196,172,216,9,62,228,77,158,228,71,142,228,72,94,228,67,46,228,64,206,227,58,126,227,
+52,14,227,44,142,226,36,254,225,26,94,225,16,174,224,4,238,223,247,13,223,233,45,222,
+219,61,221,203,61,220,186,29,219,168,253,217,150,205,216,130,141,215,109,45,214,87,205,212,
+65,93,211,41,221,209,17,77,208,248,188,206,222,12,205,195,92,203,167,156,201,138,204,199,
+109,236,197,79,12,196,48,12,194,16,12,192,240,11,190,207,235,187,173,203,185,139,171,183,
+104,107,181,69,59,179,33,235,176,252,170,174,215,74,172,177,234,169,139,138,167,101,26,165,
+62,170,162,22,58,160,239,185,157,199,57,155,158,169,152,118,25,150,77,137,147,36,249,144,
+250,104,142,209,200,139,167,40,137,126,152,134,84,248,131,42,88,129,0,184,126,214,23,124,
+172,119,121,130,231,118,89,71,116,47,167,113,6,23,111,220,134,108,179,246,105,138,102,103,
+98,214,100,57,86,98,17,214,95,234,101,93,194,245,90,155,133,88,117,37,86,79,197,83,
+41,101,81,4,37,79,223,212,76,187,164,74,152,100,72,117,68,70,83,36,68,49,4,66,
+16,4,64,240,3,62,208,3,60,177,35,58,147,67,56,118,115,54,89,179,52,61,3,51,
+34,83,49,8,195,47,239,50,46,215,178,44,191,66,43,169,226,41,147,130,40,126,66,39,
+106,18,38,88,242,36,70,210,35,53,210,34,37,226,33,23,2,33,9,34,32,252,97,31,
+240,177,30,230,17,30,220,129,29,212,1,29,204,145,28,198,65,28,192,225,27,189,177,27,
+184,129,27,185,113,27,179,209,27,247,97,39,60,163,67,97,117,106,0,152,170,196,172,223,
+89,206,228,60,62,228,70,158,227,47,222,226,40,158,225,12,94,224,250,141,222,216,205,220,
+188,125,218,148,61,216,111,109,213,63,173,210,18,125,207,220,76,204,168,156,200,108,12,197,
+49,252,192,239,11,189,174,171,184,103,107,180,33,187,175,214,42,171,140,58,166,61,122,161,
+239,89,156,158,121,151,77,57,146,250,40,141,167,200,135,84,184,130,0,88,125,172,71,120,
+89,231,114,6,215,109,179,150,104,98,182,99,17,150,94,195,213,89,116,229,84,42,85,80,
+223,164,75,153,100,71,82,4,67,17,20,63,207,3,59,148,115,55,88,195,51,36,147,48,
+238,98,45,193,162,42,145,210,39,108,146,37,68,66,35,40,130,33,6,178,31,244,113,30,
+216,49,29,209,113,28,186,209,27,196,65,27,167,97,32,60,115,85,0,88,199,133,206,230,
+7,222,226,76,222,224,217,29,222,210,221,216,90,189,212,33,61,205,154,140,199,59,92,190,
+165,75,183,40,187,172,134,154,164,243,41,153,74,105,144,169,136,132,0,136,123,87,167,111,
+182,230,102,13,118,91,122,85,83,216,196,72,91,180,65,197,131,56,102,211,50,223,82,43,
+166,50,39,46,242,33,39,50,31,180,49,29,249,65,25,123,177,56,0,40,214,30,255,225,
+128,189,221,185,141,206,115,220,197,208,43,175,118,234,161,87,121,135,0,152,120,169,38,94,
+138,229,80,48,52,58,141,131,49,71,82,34,128,18,30,226,224,41,0,8,221,249,46,210,
+50,28,193,188,58,142,0,216,113,68,245,62,206,227,45,7,1,35,0,136,224,136,189,156,
+0,88,99,120,130,31,0,136,216,0,136,39,0,248,150,200,202,191,255,220,219,40,190,228,
+75,126,228,72,142,228,70,78,228,67,30,228,62,190,227,57,110,227,50,238,226,43,126,226,
+34,222,225,24,62,225,13,142,224,2,190,223,245,237,222,231,13,222,216,13,221,200,13,220,
+183,237,218,165,205,217,146,157,216,127,77,215,106,253,213,84,157,212,62,45,211,38,173,209,
+14,29,208,244,124,206,218,220,204,191,44,203,164,92,201,135,140,199,106,188,197,76,204,195,
+45,220,193,13,220,191,237,203,189,204,187,187,170,155,185,136,123,183,101,75,181,66,11,179,
+30,203,176,249,122,174,212,42,172,175,202,169,137,106,167,98,250,164,60,138,162,20,26,160,
+237,153,157,197,25,155,157,153,152,116,9,150,75,121,147,35,233,144,249,88,142,208,184,139,
+167,40,137,125,136,134,83,248,131,42,88,129,0,184,126,214,23,124,173,135,121,131,231,118,
+89,87,116,48,183,113,7,39,111,221,150,108,181,6,106,140,118,103,99,246,100,59,118,98,
+19,246,95,236,133,93,196,21,91,158,165,88,119,69,86,81,229,83,44,149,81,7,69,79,
+226,4,77,190,196,74,155,148,72,120,116,70,86,84,68,52,68,66,19,52,64,243,51,62,
+211,67,60,180,83,58,150,131,56,121,179,54,92,227,52,65,51,51,38,147,49,12,243,47,
+242,98,46,218,226,44,194,114,43,172,18,42,150,194,40,129,114,39,110,66,38,91,34,37,
+73,2,36,56,2,35,40,2,34,25,34,33,11,82,32,254,129,31,243,209,30,232,49,30,
+222,145,29,213,33,29,206,161,28,199,81,28,194,241,27,189,193,27,186,129,27,184,145,27,
+181,81,27,216,49,36,1,67,64,56,21,105,0,104,173,250,124,225,92,142,228,60,78,228,
+69,126,227,46,206,226,37,126,225,11,62,224,247,109,222,214,157,220,185,77,218,145,13,216,
+107,61,213,60,125,210,15,61,207,217,12,204,164,108,200,105,220,196,45,204,192,236,219,188,
+171,123,184,101,59,180,30,139,175,212,10,171,137,26,166,59,90,161,237,73,156,156,89,151,
+76,41,146,249,24,141,167,200,135,83,184,130,0,88,125,173,71,120,89,247,114,7,231,109,
+180,182,104,100,198,99,19,182,94,197,245,89,119,5,85,44,133,80,226,212,75,155,148,71,
+85,52,67,20,68,63,211,51,59,151,163,55,92,3,52,39,211,48,241,146,45,196,210,42,
+149,2,40,111,194,37,71,114,35,42,162,33,9,210,31,245,145,30,219,65,29,210,145,28,
+187,193,27,196,129,27,164,145,30,6,163,82,0,72,201,158,174,230,253,221,226,80,158,224,
+210,13,222,210,141,216,84,157,212,32,237,204,149,108,199,57,12,190,160,43,183,38,123,172,
+131,154,164,241,249,152,73,121,144,168,104,132,0,168,123,88,151,111,183,22,103,15,118,91,
+125,149,83,218,228,72,96,4,66,199,163,56,107,35,51,224,114,43,172,130,39,46,2,34,
+46,114,31,176,49,29,3,98,25,98,193,54,0,200,214,36,191,225,122,173,221,184,61,206,
+111,188,197,206,235,174,115,234,161,86,89,135,0,184,120,170,38,94,141,37,81,50,84,58,
+145,211,49,72,98,34,134,82,30,220,64,41,0,56,221,249,222,209,46,252,192,186,26,142,
+0,248,113,70,21,63,210,51,46,7,209,34,0,104,224,133,141,156,0,136,99,123,162,31,
+0,88,216,0,184,39,0,136,152,246,138,195,60,189,222,62,238,228,72,126,228,73,142,228,
+68,62,228,67,14,228,60,174,227,56,78,227,48,222,226,41,94,226,31,190,225,23,30,225,
+11,94,224,0,158,223,242,189,222,229,221,221,213,221,220,198,221,219,180,189,218,163,157,217,
+143,109,216,124,29,215,102,205,213,81,93,212,58,253,210,35,109,209,10,237,207,241,76,206,
+215,172,204,188,236,202,160,44,201,132,92,199,102,124,197,72,156,195,41,172,193,10,172,191,
+233,155,189,201,139,187,167,107,185,133,75,183,98,27,181,63,219,178,27,155,176,247,74,174,
+210,250,171,172,154,169,134,74,167,96,218,164,57,106,162,18,250,159,235,121,157,195,249,154,
+155,121,152,115,233,149,74,105,147,33,217,144,248,72,142,207,184,139,166,24,137,125,136,134,
+83,232,131,42,88,129,0,184,126,214,39,124,173,135,121,131,247,118,90,87,116,49,199,113,
+8,55,111,223,166,108,182,38,106,141,150,103,101,22,101,61,150,98,21,22,96,238,165,93,
+199,53,91,160,197,88,122,117,86,84,21,84,46,197,81,9,117,79,229,52,77,193,244,74,
+158,196,72,123,164,70,89,132,68,55,116,66,23,100,64,246,99,62,215,115,60,184,147,58,
+154,179,56,124,227,54,96,35,53,68,99,51,41,195,49,15,35,48,246,162,46,221,18,45,
+198,178,43,175,66,42,154,242,40,132,162,39,113,114,38,93,82,37,76,50,36,58,50,35,
+43,50,34,27,82,33,14,114,32,0,178,31,245,241,30,233,81,30,225,177,29,215,49,29,
+208,193,28,200,97,28,196,1,28,189,209,27,188,129,27,183,145,27,184,33,27,194,81,33,
+196,130,60,10,133,103,0,136,176,50,13,227,91,78,228,61,94,228,66,94,227,46,190,226,
+34,94,225,9,14,224,244,61,222,212,109,220,181,29,218,142,205,215,103,13,213,57,61,210,
+11,13,207,214,220,203,161,60,200,102,156,196,42,156,192,233,155,188,168,75,184,98,11,180,
+27,107,175,209,218,170,135,10,166,57,58,161,235,57,156,155,57,151,74,25,146,248,8,141,
+166,200,135,83,168,130,0,104,125,173,71,120,90,7,115,8,247,109,182,214,104,101,214,99,
+21,214,94,199,5,90,121,53,85,47,165,80,229,4,76,158,196,71,88,116,67,23,116,63,
+214,115,59,154,211,55,95,51,52,42,3,49,245,210,45,199,2,43,153,66,40,114,242,37,
+75,162,35,44,210,33,12,2,32,247,177,30,222,81,29,210,177,28,190,177,27,195,193,27,
+165,1,29,206,130,79,0,24,203,181,142,230,243,221,226,84,94,224,203,253,221,211,61,216,
+78,125,212,30,157,204,144,76,199,55,188,189,156,27,183,36,59,172,128,154,164,240,201,152,
+71,137,144,168,72,132,0,200,123,88,135,111,185,70,103,16,118,91,128,213,83,220,244,72,
+100,84,66,201,195,56,112,115,51,226,146,43,178,210,39,45,18,34,53,178,31,172,49,29,
+13,130,25,75,241,52,0,88,215,42,127,225,116,141,221,183,237,205,106,156,197,203,171,174,
+112,218,161,85,73,135,0,200,120,171,54,94,144,101,81,53,116,58,150,35,50,73,130,34,
+140,146,30,214,176,40,0,72,221,248,158,209,42,220,192,184,250,141,0,24,114,72,53,63,
+214,115,46,8,193,34,0,88,224,130,93,156,0,184,99,126,178,31,0,40,216,0,232,39,
+};
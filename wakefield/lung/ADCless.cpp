@@ -7,36 +7,27 @@
 #include "hardware/irq.h"
 #include "ADCless.h"
 
+#define ADC_RING_BYTES (ADC_RING_FRAMES * NUM_ADC_INPUTS * 2)
+static_assert((ADC_RING_BYTES & (ADC_RING_BYTES - 1)) == 0, "ADC ring must be a power of 2 in bytes");
+
 // DEFINITIONS of the variables
-volatile uint16_t adc_results_buf[NUM_ADC_INPUTS] __attribute__((aligned(NUM_ADC_INPUTS * sizeof(uint16_t))));
-volatile uint16_t* adc_results_ptr[1] = {adc_results_buf};
+// Aligned to its size so record mode can wrap the DMA write address on it
+volatile uint16_t adc_results_buf[ADC_RING_FRAMES][NUM_ADC_INPUTS] __attribute__((aligned(ADC_RING_BYTES)));
+volatile uint16_t* adc_results_ptr[1] = {&adc_results_buf[0][0]};
 int adc_samp_chan, adc_ctrl_chan;
 
-// Function definition
-void configureADC_DMA(){
-    uint8_t mask = (1u << NUM_ADC_INPUTS) - 1;
+// Record mode: per-frame source addresses, read in a ring by s_cap_addr_chan
+static const volatile uint16_t* s_cap_src[ADC_RING_FRAMES] __attribute__((aligned(ADC_RING_FRAMES * sizeof(void*))));
+static int               s_cap_addr_chan = -1;   // Loads the next source into s_cap_rec_chan
+static int               s_cap_rec_chan  = -1;   // Copies one sample, restarts the frame
+static volatile uint16_t* s_cap_dst      = nullptr;
+static uintptr_t         s_cap_end       = 0;    // Guard stops the chain at this write address
+static volatile bool     s_cap_on        = false;
 
-    #ifdef ADCLESS_RP2350B
-        // Serial.println("RP2350B is defined."); // DISABLED TO PREVENT POPS
-        // Serial.println(mask, HEX);
-    #else
-        // Serial.println("RP2350B is not defined."); // DISABLED TO PREVENT POPS
-    #endif
-
-    // Setup ADC.
-    for (int i = 0; i < NUM_ADC_INPUTS; i++){
-        adc_gpio_init(BASE_ADC_PIN + i);
-    }
-
-    adc_init();
-    adc_set_clkdiv(1);
-    adc_set_round_robin((1 << NUM_ADC_INPUTS) - 1);
-    adc_select_input(0);
-    adc_fifo_setup(true, true, 4, false, false);
-    adc_fifo_drain();
-
-    int samp_chan = dma_claim_unused_channel(true);
-    int ctrl_chan = dma_claim_unused_channel(true);
+// Free-running ring: samp_chan fills all frames, ctrl_chan rewinds it
+static void start_ring_dma(void) {
+    int samp_chan = adc_samp_chan;
+    int ctrl_chan = adc_ctrl_chan;
     dma_channel_config samp_conf = dma_channel_get_default_config(samp_chan);
     dma_channel_config ctrl_conf = dma_channel_get_default_config(ctrl_chan);
 
@@ -53,7 +44,7 @@ void configureADC_DMA(){
         &samp_conf,
         nullptr,
         &adc_hw->fifo,
-        NUM_ADC_INPUTS,
+        NUM_ADC_INPUTS * ADC_RING_FRAMES,   // whole ring, then ctrl_chan rewinds it
         false
     );
 
@@ -73,5 +64,142 @@ void configureADC_DMA(){
         false
     );
     dma_channel_start(ctrl_chan);
+}
+
+// Function definition
+void configureADC_DMA(){
+    uint8_t mask = (1u << NUM_ADC_INPUTS) - 1;
+
+    #ifdef ADCLESS_RP2350B
+        // Serial.println("RP2350B is defined."); // DISABLED TO PREVENT POPS
+        // Serial.println(mask, HEX);
+    #else
+        // Serial.println("RP2350B is not defined."); // DISABLED TO PREVENT POPS
+    #endif
+
+    // Setup ADC.
+    for (int i = 0; i < NUM_ADC_INPUTS; i++){
+        adc_gpio_init(BASE_ADC_PIN + i);
+    }
+
+    adc_init();
+    adc_set_clkdiv(1);
+    adc_set_round_robin((1 << NUM_ADC_INPUTS) - 1);
+    adc_select_input(0);
+    adc_fifo_setup(true, true, 4, false, false);
+    adc_fifo_drain();
+
+    adc_samp_chan = dma_claim_unused_channel(true);
+    adc_ctrl_chan = dma_claim_unused_channel(true);
+    start_ring_dma();
+    adc_run(true);
+}
+
+// Stop conversions and every ADC DMA channel, and rewind the round robin
+// to channel 0 so the next frame starts aligned
+static void adc_halt(void) {
+    adc_run(false);
+    while (!(adc_hw->cs & ADC_CS_READY_BITS)) tight_loop_contents();
+    // Disable first, so an abort cannot fire a chain into a live channel
+    const int chans[] = {adc_samp_chan, adc_ctrl_chan, s_cap_addr_chan, s_cap_rec_chan};
+    for (int c : chans) if (c >= 0) hw_clear_bits(&dma_hw->ch[c].al1_ctrl, DMA_CH0_CTRL_TRIG_EN_BITS);
+    for (int c : chans) if (c >= 0) dma_channel_abort(c);
+    adc_fifo_drain();
+    adc_select_input(0);
+}
+
+bool adc_capture_start(volatile uint16_t* dst, uint32_t max_samples, float rate_hz, uint8_t channel) {
+    if (s_cap_on || !dst || max_samples <= ADC_CAPTURE_MARGIN || channel >= NUM_ADC_INPUTS || rate_hz <= 0.0f) {
+        return false;
+    }
+    if (s_cap_rec_chan < 0) {
+        s_cap_addr_chan = dma_claim_unused_channel(false);
+        s_cap_rec_chan  = dma_claim_unused_channel(false);
+        if (s_cap_addr_chan < 0 || s_cap_rec_chan < 0) {
+            if (s_cap_addr_chan >= 0) dma_channel_unclaim(s_cap_addr_chan);
+            if (s_cap_rec_chan >= 0)  dma_channel_unclaim(s_cap_rec_chan);
+            s_cap_addr_chan = s_cap_rec_chan = -1;
+            return false;
+        }
+    }
+    for (int f = 0; f < ADC_RING_FRAMES; ++f) s_cap_src[f] = &adc_results_buf[f][channel];
+
+    // Whole round robin at NUM_ADC_INPUTS x rate_hz: each input at rate_hz.
+    // A conversion takes 96 ADC clocks, so faster than that cannot be paced
+    const float div = (float)clock_get_hz(clk_adc) / (rate_hz * NUM_ADC_INPUTS) - 1.0f;
+    if (div < 95.0f) return false;
+
+    adc_halt();
+    adc_set_clkdiv(div);
+
+    // Frame: NUM_ADC_INPUTS samples into the ring, wrapping on its size
+    dma_channel_config samp_conf = dma_channel_get_default_config(adc_samp_chan);
+    channel_config_set_transfer_data_size(&samp_conf, DMA_SIZE_16);
+    channel_config_set_read_increment(&samp_conf, false);
+    channel_config_set_write_increment(&samp_conf, true);
+    channel_config_set_ring(&samp_conf, true, __builtin_ctz(ADC_RING_BYTES));
+    channel_config_set_irq_quiet(&samp_conf, true);
+    channel_config_set_dreq(&samp_conf, DREQ_ADC);
+    channel_config_set_chain_to(&samp_conf, s_cap_addr_chan);
+    dma_channel_configure(adc_samp_chan, &samp_conf, &adc_results_buf[0][0], &adc_hw->fifo,
+                          NUM_ADC_INPUTS, false);
+
+    // Then: the recorded input's address in that frame, which triggers...
+    dma_channel_config addr_conf = dma_channel_get_default_config(s_cap_addr_chan);
+    channel_config_set_transfer_data_size(&addr_conf, DMA_SIZE_32);
+    channel_config_set_read_increment(&addr_conf, true);
+    channel_config_set_write_increment(&addr_conf, false);
+    channel_config_set_ring(&addr_conf, false, __builtin_ctz(sizeof(s_cap_src)));
+    channel_config_set_irq_quiet(&addr_conf, true);
+    channel_config_set_dreq(&addr_conf, DREQ_FORCE);
+    dma_channel_configure(s_cap_addr_chan, &addr_conf, &dma_hw->ch[s_cap_rec_chan].al3_read_addr_trig,
+                          s_cap_src, 1, false);
+
+    // ...the copy of that sample to PSRAM, which restarts the frame
+    dma_channel_config rec_conf = dma_channel_get_default_config(s_cap_rec_chan);
+    channel_config_set_transfer_data_size(&rec_conf, DMA_SIZE_16);
+    channel_config_set_read_increment(&rec_conf, false);
+    channel_config_set_write_increment(&rec_conf, true);
+    channel_config_set_irq_quiet(&rec_conf, true);
+    channel_config_set_dreq(&rec_conf, DREQ_FORCE);
+    channel_config_set_chain_to(&rec_conf, adc_samp_chan);
+    dma_channel_configure(s_cap_rec_chan, &rec_conf, dst, s_cap_src[0], 1, false);
+
+    s_cap_dst = dst;
+    s_cap_end = (uintptr_t)(dst + (max_samples - ADC_CAPTURE_MARGIN));
+    s_cap_on  = true;
+    dma_channel_start(adc_samp_chan);
+    adc_run(true);
+    return true;
+}
+
+void __not_in_flash_func(adc_capture_guard)(void) {
+    if (s_cap_on && dma_hw->ch[s_cap_rec_chan].write_addr >= s_cap_end) {
+        // Next trigger is ignored; the frame chain stops there
+        hw_clear_bits(&dma_hw->ch[s_cap_rec_chan].al1_ctrl, DMA_CH0_CTRL_TRIG_EN_BITS);
+    }
+}
+
+bool adc_capture_active(void) {
+    return s_cap_on;
+}
+
+uint32_t adc_capture_count(void) {
+    if (!s_cap_on) return 0;
+    return (uint32_t)((dma_hw->ch[s_cap_rec_chan].write_addr - (uintptr_t)s_cap_dst) / sizeof(uint16_t));
+}
+
+bool adc_capture_full(void) {
+    return s_cap_on && !(dma_hw->ch[s_cap_rec_chan].al1_ctrl & DMA_CH0_CTRL_TRIG_EN_BITS);
+}
+
+uint32_t adc_capture_stop(void) {
+    if (!s_cap_on) return 0;
+    adc_halt();
+    const uint32_t n = adc_capture_count();
+    s_cap_on = false;
+    adc_set_clkdiv(1);
+    start_ring_dma();
     adc_run(true);
-}
\ No newline at end of file
+    return n;
+}
@@ -10,9 +10,13 @@
  * ## ADC Configuration
  * 
  * **8-Channel Input**: Supports up to 8 analog control inputs
- * **DMA Sampling**: Continuous sampling without CPU intervention
+ * **DMA Sampling**: Free-running round-robin into a ring of ADC_RING_FRAMES
+ *   frames, rewritten continuously without CPU intervention
  * **12-bit Resolution**: 0-4095 range for precise control
- * **Real-time Processing**: Samples are processed in the audio interrupt
+ * **Real-time Processing**: The ring is decimated and filtered once per
+ *   audio block (adc_filter.h)
+ * **Audio Capture**: One channel can also be streamed into a PSRAM buffer
+ *   at the audio rate (record mode) while the ring keeps running
  * 
  * ## Control Inputs
  * 
@@ -40,6 +44,14 @@
 
 // ── ADC Configuration ──────────────────────────────────────────────────────────
 #define NUM_ADC_INPUTS      8  // Number of analog control inputs
+#define ADC_RING_FRAMES    16  // Round-robin frames kept (power of 2, <= 16)
+
+// 500 ksps over 8 inputs is 62.5 kHz a channel, so 16 frames is the last
+// ~0.26 ms: about one 48 kHz audio block. The filter sums a whole frame
+// column in 16-bit lanes, hence the limit of 16 (16 * 4095 < 65536).
+static_assert(ADC_RING_FRAMES >= 1 && ADC_RING_FRAMES <= 16 &&
+              (ADC_RING_FRAMES & (ADC_RING_FRAMES - 1)) == 0,
+              "ADC_RING_FRAMES must be a power of 2 up to 16");
 
 // ── Hardware Target Selection ──────────────────────────────────────────────────
 // Uncomment the appropriate target for your hardware
@@ -53,8 +65,12 @@
     #define BASE_ADC_PIN 26  // Starting ADC pin for RP2040
 #endif
 
+// Capture stops this many samples short of the buffer end: the audio IRQ
+// checks once per block, so this is the most one check can overshoot
+#define ADC_CAPTURE_MARGIN 256
+
 // ── ADC State Variables ────────────────────────────────────────────────────────
-extern volatile uint16_t adc_results_buf[NUM_ADC_INPUTS];  // DMA buffer for ADC results
+extern volatile uint16_t adc_results_buf[ADC_RING_FRAMES][NUM_ADC_INPUTS];  // DMA ring, [frame][channel]
 extern volatile uint16_t* adc_results_ptr[1];              // DMA pointer (must be array of 1)
 extern int adc_samp_chan, adc_ctrl_chan;                   // DMA channel assignments
 
@@ -66,4 +82,31 @@ extern int adc_samp_chan, adc_ctrl_chan;                   // DMA channel assign
  * Sets up the ADC and DMA system for continuous, non-blocking sampling
  * of all control inputs. Must be called during system initialization.
  */
-void configureADC_DMA();
\ No newline at end of file
+void configureADC_DMA();
+
+// ── Audio Capture ──────────────────────────────────────────────────────────────
+//
+// Record mode paces the round robin so each input is converted at rate_hz
+// and chains two more DMA channels onto every frame: one loads the address
+// of `channel` in the frame just written, the other copies that sample to
+// the next slot of dst and restarts the frame. The samples land in dst as
+// raw 12-bit ADC values (the DMA cannot convert them), with no CPU work
+// per sample. The ring is still written and filtered as usual.
+
+// Start capturing into dst (max_samples > ADC_CAPTURE_MARGIN). False if
+// already capturing or no DMA channels are free.
+bool adc_capture_start(volatile uint16_t* dst, uint32_t max_samples, float rate_hz, uint8_t channel);
+
+// Audio IRQ, once per block: stop the chain before it reaches the margin
+void adc_capture_guard(void);
+
+// True while capturing; full once the guard has stopped it
+bool adc_capture_active(void);
+bool adc_capture_full(void);
+
+// Samples written to dst so far
+uint32_t adc_capture_count(void);
+
+// Stop (if running), restore the free-running ring, and return the number
+// of samples written to dst
+uint32_t adc_capture_stop(void);
\ No newline at end of file
@@ -1,4 +1,5 @@
 #include <Arduino.h>
+#include <pico.h>
 #include <hardware/pwm.h>
 #include <hardware/dma.h>
 #include <hardware/regs/dreq.h>
@@ -6,22 +7,32 @@
 #include "hardware/gpio.h"
 #include "hardware/irq.h"
 #include "DACless.h"
+#include "audio_engine.h"
+#include "audio_profiler.h"
 
-// Fixed a/b output buffers
-volatile uint16_t pwm_out_buf_a[AUDIO_BLOCK_SIZE] __attribute__((aligned(AUDIO_BLOCK_SIZE * sizeof(uint16_t))));
-volatile uint16_t pwm_out_buf_b[AUDIO_BLOCK_SIZE] __attribute__((aligned(AUDIO_BLOCK_SIZE * sizeof(uint16_t))));
-volatile uint16_t pwm_out_buf_c[AUDIO_BLOCK_SIZE] __attribute__((aligned(AUDIO_BLOCK_SIZE * sizeof(uint16_t))));
-volatile uint16_t pwm_out_buf_d[AUDIO_BLOCK_SIZE] __attribute__((aligned(AUDIO_BLOCK_SIZE * sizeof(uint16_t))));
+// Output rings: AUDIO_BUFFER_COUNT blocks per channel, played in order
+volatile uint16_t pwm_out_buf_L[AUDIO_BUFFER_COUNT][AUDIO_BLOCK_SIZE];
+volatile uint16_t pwm_out_buf_R[AUDIO_BUFFER_COUNT][AUDIO_BLOCK_SIZE];
 
-static const uint size_bits = 5; // 128 = 8
-static_assert((1<<size_bits) == AUDIO_BLOCK_SIZE * sizeof(uint16_t));
+// Read addresses for the control channels, which feed them to the data
+// channels one block at a time. Aligned for the control channel's read ring
+static volatile uint16_t* ring_addr_L[AUDIO_BUFFER_COUNT] __attribute__((aligned(AUDIO_BUFFER_COUNT * sizeof(uint32_t))));
+static volatile uint16_t* ring_addr_R[AUDIO_BUFFER_COUNT] __attribute__((aligned(AUDIO_BUFFER_COUNT * sizeof(uint32_t))));
+static const uint ring_addr_bits = __builtin_ctz(AUDIO_BUFFER_COUNT * sizeof(uint32_t));
+static_assert(sizeof(volatile uint16_t*) == sizeof(uint32_t), "control DMA copies 32-bit addresses");
 
 volatile uint16_t* out_buf_ptr_L;
 volatile uint16_t* out_buf_ptr_R;
-volatile int callback_flag_L;
-volatile int callback_flag_R;
+static uint32_t s_ring_played = 0;   // Ring index of the block the L channel finishes next
 
-int dma_chan_a, dma_chan_b, dma_chan_c, dma_chan_d;
+// Output health (DACless.h): written by the completion IRQ only
+static volatile uint32_t s_health_blocks = 0;
+static volatile uint32_t s_underruns = 0;
+static volatile uint32_t s_near_misses = 0;
+static volatile int32_t  s_slack_min = INT32_MAX;
+static const int32_t kCyclesPerSample = PWM_RESOLUTION + 1;   // Wrap PWM_RESOLUTION, clkdiv 1
+
+int dma_chan_L, dma_chan_L_ctrl, dma_chan_R, dma_chan_R_ctrl;
 
 float audio_rate = clock_get_hz(clk_sys) / (PWM_RESOLUTION - 1);
 
@@ -38,90 +49,120 @@ void unmuteAudioOutput() {
     pwm_set_enabled(slice_num, true); // Re-enable PWM
 }
 
-void PWM_DMATransCpltCallbackL(){
-    uint32_t pending = dma_hw->ints1;  // Get all pending interrupts on IRQ 1
-    uint32_t timestamp_us = time_us_32();
-    
-    // Handle the interrupt for channel A
-    if (pending & (1u << dma_chan_a)) {
-        dma_hw->ints1 = 1u << dma_chan_a; // clear the interrupt request
-        out_buf_ptr_L   = &pwm_out_buf_a[0];
-        callback_flag_L = 1;
-    }
-
-    // Handle the interrupt for channel B
-    if (pending & (1u << dma_chan_b)) {
-        dma_hw->ints1 = 1u << dma_chan_b; // clear the interrupt request
-        out_buf_ptr_L   = &pwm_out_buf_b[0];
-        callback_flag_L = 1;
-    }
+// Where the left data channel is: the ring block it is reading and the
+// samples it has left in it. From the read address alone, which moves with
+// each transfer; the blocks are contiguous, so between two blocks (before
+// the control channel re-triggers it) the address is already the next one's
+// start, with all of it left
+static inline uint32_t __not_in_flash_func(ring_position)(uint32_t* remaining) {
+    const uint32_t sample = (uint32_t)((dma_hw->ch[dma_chan_L].read_addr - (uintptr_t)pwm_out_buf_L[0])
+                                       / sizeof(uint16_t)) % (AUDIO_BUFFER_COUNT * AUDIO_BLOCK_SIZE);
+    *remaining = AUDIO_BLOCK_SIZE - sample % AUDIO_BLOCK_SIZE;
+    return sample / AUDIO_BLOCK_SIZE;
 }
 
-void PWM_DMATransCpltCallbackR(){
-    uint32_t pending = dma_hw->ints0;  // Get all pending interrupts on IRQ 1
-    uint32_t timestamp_us = time_us_32();
-    
-    // Handle the interrupt for channel C
-    if (pending & (1u << dma_chan_c)) {
-        dma_hw->ints0 = 1u << dma_chan_c; // clear the interrupt request
-        out_buf_ptr_R   = &pwm_out_buf_c[0];
-        callback_flag_R = 1;
-    }
-
-    // Handle the interrupt for channel D
-    if (pending & (1u << dma_chan_d)) {
-        dma_hw->ints0 = 1u << dma_chan_d; // clear the interrupt request
-        out_buf_ptr_R   = &pwm_out_buf_d[0];
-        callback_flag_R = 1;
+// DMA completion handler runs from RAM: an XIP miss here delays the render
+void __not_in_flash_func(PWM_DMATransCpltCallbackL)(){
+    dma_hw->ints1 = 1u << dma_chan_L; // clear the interrupt request
+
+    // The control channel has already queued the next block; the one before
+    // it just finished and is the free slot, AUDIO_BUFFER_COUNT - 1 blocks
+    // ahead. Taken from the DMA's position rather than counted, so an IRQ
+    // held off past a completion costs the blocks it missed, not the sync
+    uint32_t remaining;
+    const uint32_t free_slot = (ring_position(&remaining) - 1u) & (AUDIO_BUFFER_COUNT - 1);
+    const bool missed = free_slot != s_ring_played;
+    s_ring_played = (free_slot + 1u) & (AUDIO_BUFFER_COUNT - 1);
+    out_buf_ptr_L = pwm_out_buf_L[free_slot];
+    out_buf_ptr_R = pwm_out_buf_R[free_slot];
+
+    audio_tick();
+
+    // Slack: the rest of the block the DMA is on, and any whole blocks
+    // between it and ours; negative, the part of ours it already played
+    const uint32_t playing = ring_position(&remaining);
+    const uint32_t between = (free_slot - playing) & (AUDIO_BUFFER_COUNT - 1);
+    const int32_t slack = between == 0
+        ? -(int32_t)(AUDIO_BLOCK_SIZE - remaining) * kCyclesPerSample
+        : (int32_t)((between - 1u) * AUDIO_BLOCK_SIZE + remaining) * kCyclesPerSample;
+    if (missed || slack < 0) {
+        s_underruns = s_underruns + 1u;
+        PROF_EVENT(PROF_EV_UNDERRUN);
+    } else if (slack < AUDIO_NEAR_MISS_SAMPLES * kCyclesPerSample) {
+        s_near_misses = s_near_misses + 1u;
+        PROF_EVENT(PROF_EV_NEAR_MISS);
     }
+    if (slack < s_slack_min) s_slack_min = slack;
+    s_health_blocks = s_health_blocks + 1u;
+    PROF_OUTPUT_SLACK(slack);
 }
 
-void configurePWM_DMA_L(){
-    gpio_set_function(PIN_PWM_OUT_L, GPIO_FUNC_PWM);// set GP2 function PWM
-    uint slice_num = pwm_gpio_to_slice_num(PIN_PWM_OUT_L);// GP2 PWM slice
-    pwm_set_clkdiv(slice_num, 1);
-    pwm_set_wrap(slice_num, PWM_RESOLUTION);
-    pwm_set_enabled(slice_num, true);
-    pwm_set_irq_enabled(slice_num, true); // Necessary? Yes
+void audio_health_read(AudioHealth* out) {
+    out->blocks = s_health_blocks;
+    out->underruns = s_underruns;
+    out->near_misses = s_near_misses;
+    out->slack_min = s_slack_min;
+}
 
-    dma_chan_a = dma_claim_unused_channel(true);
-    dma_chan_b = dma_claim_unused_channel(true);
+// One output: a data channel paced by the PWM wrap plays a block and chains
+// to a control channel, which writes the next ring address into the data
+// channel's read-address trigger (as ADCless.cpp re-arms its sample channel)
+static void configure_output_ring(uint slice_num, int data_chan, int ctrl_chan,
+                                  volatile uint16_t (*bufs)[AUDIO_BLOCK_SIZE],
+                                  volatile uint16_t** ring_addr) {
+    for (int i = 0; i < AUDIO_BUFFER_COUNT; i++) {
+        ring_addr[i] = bufs[i];
+    }
 
-    dma_channel_config cfg_0_a = dma_channel_get_default_config(dma_chan_a);
-    channel_config_set_transfer_data_size(&cfg_0_a, DMA_SIZE_16);
-    channel_config_set_read_increment(&cfg_0_a, true);
-    channel_config_set_dreq(&cfg_0_a, DREQ_PWM_WRAP0 + slice_num); // write data at pwm frequency
-    channel_config_set_ring(&cfg_0_a, false, size_bits); //'false' refers to whether data is being written to the buffer
-    channel_config_set_chain_to(&cfg_0_a, dma_chan_b); // start chan b when chan a completed
+    dma_channel_config data_conf = dma_channel_get_default_config(data_chan);
+    channel_config_set_transfer_data_size(&data_conf, DMA_SIZE_16);
+    channel_config_set_read_increment(&data_conf, true);
+    channel_config_set_write_increment(&data_conf, false);
+    channel_config_set_dreq(&data_conf, DREQ_PWM_WRAP0 + slice_num); // write data at pwm frequency
+    channel_config_set_chain_to(&data_conf, ctrl_chan);              // queue the next block when done
 
     dma_channel_configure(
-        dma_chan_a,         // Channel to be configured
-        &cfg_0_a,           // The configuration we just created
+        data_chan,          // Channel to be configured
+        &data_conf,         // The configuration we just created
         &pwm_hw->slice[slice_num].cc, // write address
-        pwm_out_buf_a,      // The initial read address
+        bufs[0],            // The initial read address
         AUDIO_BLOCK_SIZE,   // Number of transfers
         false               // Start immediately?
     );
 
-    dma_channel_set_irq1_enabled(dma_chan_a, true);
+    dma_channel_config ctrl_conf = dma_channel_get_default_config(ctrl_chan);
+    channel_config_set_transfer_data_size(&ctrl_conf, DMA_SIZE_32);
+    channel_config_set_read_increment(&ctrl_conf, true);
+    channel_config_set_write_increment(&ctrl_conf, false);
+    channel_config_set_ring(&ctrl_conf, false, ring_addr_bits);      // wrap over the address table
+    channel_config_set_irq_quiet(&ctrl_conf, true);
+    channel_config_set_dreq(&ctrl_conf, DREQ_FORCE);
 
-    dma_channel_config cfg_0_b = dma_channel_get_default_config(dma_chan_b);
-    channel_config_set_transfer_data_size(&cfg_0_b, DMA_SIZE_16);
-    channel_config_set_read_increment(&cfg_0_b, true);
-    channel_config_set_dreq(&cfg_0_b, DREQ_PWM_WRAP0 + slice_num); // write data at pwm frequency
-    channel_config_set_ring(&cfg_0_b, false, size_bits);
-    channel_config_set_chain_to(&cfg_0_b, dma_chan_a); // start chan a when chan b completed
-    
     dma_channel_configure(
-        dma_chan_b,         // Channel to be configured
-        &cfg_0_b,           // The configuration we just created
-        &pwm_hw->slice[slice_num].cc, // write address
-        pwm_out_buf_b,      // The initial read address
-        AUDIO_BLOCK_SIZE,   // Number of transfers
-        false               // Start immediately?
+        ctrl_chan,
+        &ctrl_conf,
+        &dma_hw->ch[data_chan].al3_read_addr_trig,
+        &ring_addr[1],      // bufs[0] plays first, bufs[1] is queued next
+        1,
+        false
     );
+}
+
+void configurePWM_DMA_L(){
+    gpio_set_function(PIN_PWM_OUT_L, GPIO_FUNC_PWM);// set GP2 function PWM
+    uint slice_num = pwm_gpio_to_slice_num(PIN_PWM_OUT_L);// GP2 PWM slice
+    pwm_set_clkdiv(slice_num, 1);
+    pwm_set_wrap(slice_num, PWM_RESOLUTION);
+    pwm_set_enabled(slice_num, true);
+    pwm_set_irq_enabled(slice_num, true); // Necessary? Yes
+
+    dma_chan_L = dma_claim_unused_channel(true);
+    dma_chan_L_ctrl = dma_claim_unused_channel(true);
+    configure_output_ring(slice_num, dma_chan_L, dma_chan_L_ctrl, pwm_out_buf_L, ring_addr_L);
 
-    dma_channel_set_irq1_enabled(dma_chan_b, true);
+    // Only the left ring interrupts; the right one is started with it and
+    // finishes its blocks on the same PWM wraps
+    dma_channel_set_irq1_enabled(dma_chan_L, true);
     irq_set_exclusive_handler(DMA_IRQ_1, PWM_DMATransCpltCallbackL);
     irq_set_enabled(DMA_IRQ_1, true);
 }
@@ -134,47 +175,10 @@ void configurePWM_DMA_R(){
     pwm_set_enabled(slice_num, true);
     pwm_set_irq_enabled(slice_num, true); // Necessary? Yes
 
-    dma_chan_c = dma_claim_unused_channel(true);
-    dma_chan_d = dma_claim_unused_channel(true);
-
-    dma_channel_config cfg_0_c = dma_channel_get_default_config(dma_chan_c);
-    channel_config_set_transfer_data_size(&cfg_0_c, DMA_SIZE_16);
-    channel_config_set_read_increment(&cfg_0_c, true);
-    channel_config_set_dreq(&cfg_0_c, DREQ_PWM_WRAP0 + slice_num); // write data at pwm frequency
-    channel_config_set_ring(&cfg_0_c, false, size_bits); //'false' refers to whether data is being written to the buffer
-    channel_config_set_chain_to(&cfg_0_c, dma_chan_d); // start chan b when chan a completed
-
-    dma_channel_configure(
-        dma_chan_c,         // Channel to be configured
-        &cfg_0_c,           // The configuration we just created
-        &pwm_hw->slice[slice_num].cc, // write address
-        pwm_out_buf_c,      // The initial read address
-        AUDIO_BLOCK_SIZE,   // Number of transfers
-        false               // Start immediately?
-    );
-
-    dma_channel_set_irq0_enabled(dma_chan_c, true);
+    dma_chan_R = dma_claim_unused_channel(true);
+    dma_chan_R_ctrl = dma_claim_unused_channel(true);
+    configure_output_ring(slice_num, dma_chan_R, dma_chan_R_ctrl, pwm_out_buf_R, ring_addr_R);
 
-    dma_channel_config cfg_0_d = dma_channel_get_default_config(dma_chan_d);
-    channel_config_set_transfer_data_size(&cfg_0_d, DMA_SIZE_16);
-    channel_config_set_read_increment(&cfg_0_d, true);
-    channel_config_set_dreq(&cfg_0_d, DREQ_PWM_WRAP0 + slice_num); // write data at pwm frequency
-    channel_config_set_ring(&cfg_0_d, false, size_bits);
-    channel_config_set_chain_to(&cfg_0_d, dma_chan_c); // start chan c when chan d completed
-    
-    dma_channel_configure(
-        dma_chan_d,         // Channel to be configured
-        &cfg_0_d,           // The configuration we just created
-        &pwm_hw->slice[slice_num].cc, // write address
-        pwm_out_buf_d,      // The initial read address
-        AUDIO_BLOCK_SIZE,   // Number of transfers
-        false               // Start immediately?
-    );
-
-    dma_channel_set_irq0_enabled(dma_chan_d, true);
-    irq_set_exclusive_handler(DMA_IRQ_0, PWM_DMATransCpltCallbackR);
-    irq_set_enabled(DMA_IRQ_0, true);
-
-    dma_channel_start(dma_chan_a); // seems to start something
-    dma_channel_start(dma_chan_c); // seems to start something
-}
\ No newline at end of file
+    // Start both rings on the same cycle so block boundaries line up
+    dma_start_channel_mask((1u << dma_chan_L) | (1u << dma_chan_R));
+}
@@ -11,7 +11,8 @@
  * 
  * **PWM Audio**: Uses PWM to generate analog audio output with 12-bit resolution
  * **DMA Transfer**: Continuous audio output without CPU intervention
- * **Dual Buffering**: Ping-pong buffers for seamless audio streaming
+ * **Buffer Ring**: AUDIO_BUFFER_COUNT blocks per channel, chained by a
+ *   control DMA channel, so rendering can run a few blocks ahead
  * **High Sample Rate**: 48kHz output for professional audio quality
  * **Low Latency**: Minimal delay between audio processing and output
  * 
@@ -26,7 +27,8 @@
  * 
  * - **Sample Rate**: Configurable via audio_rate setting (typically 48kHz)
  * - **Bit Depth**: 12-bit PWM resolution (equivalent to ~12-bit DAC)
- * - **Latency**: <1ms end-to-end audio latency
+ * - **Latency**: (AUDIO_BUFFER_COUNT - 1) * AUDIO_BLOCK_SIZE samples of
+ *   buffering, 0.33 ms at the 16 x 2 default
  * - **CPU Load**: <5% CPU usage for audio output
  * 
  * @author Brian Varren
@@ -36,22 +38,33 @@
 
 #pragma once
 
+#include <stdint.h>
+
 // ── Audio Output Configuration ──────────────────────────────────────────────────
+// Block size and ring depth are build-time settings (override with -D, e.g.
+// in build_opt.h): 32/64-sample blocks cut the per-block overhead (ADC
+// snapshot, boundary and pitch math), 8 with a ring of 2 for lowest latency
+#ifndef AUDIO_BLOCK_SIZE
 #define AUDIO_BLOCK_SIZE    16    // Audio buffer size (samples per DMA transfer)
+#endif
+#ifndef AUDIO_BUFFER_COUNT
+#define AUDIO_BUFFER_COUNT  2     // Blocks in each channel's DMA ring (2, 4, 8 or 16)
+#endif
 #define PIN_PWM_OUT_L       20    // PWM output pin for audio
 #define PIN_PWM_OUT_R       21    // PWM output pin for audio
 #define PWM_RESOLUTION      4096  // PWM resolution (12-bit)
 
+static_assert(AUDIO_BLOCK_SIZE >= 4 && AUDIO_BLOCK_SIZE <= 1024, "AUDIO_BLOCK_SIZE out of range");
+static_assert(AUDIO_BUFFER_COUNT >= 2 && AUDIO_BUFFER_COUNT <= 16 &&
+              (AUDIO_BUFFER_COUNT & (AUDIO_BUFFER_COUNT - 1)) == 0,
+              "AUDIO_BUFFER_COUNT must be a power of two from 2 to 16 (control DMA ring)");
+
 // ── Audio Output State Variables ────────────────────────────────────────────────
-extern volatile uint16_t pwm_out_buf_a[AUDIO_BLOCK_SIZE];  // First audio buffer
-extern volatile uint16_t pwm_out_buf_b[AUDIO_BLOCK_SIZE];  // Second audio buffer
-extern volatile uint16_t pwm_out_buf_c[AUDIO_BLOCK_SIZE];  // Third audio buffer
-extern volatile uint16_t pwm_out_buf_d[AUDIO_BLOCK_SIZE];  // Fourth audio buffer
-extern volatile uint16_t* out_buf_ptr_L;                     // Pointer to active buffer
-extern volatile uint16_t* out_buf_ptr_R;                     // Pointer to active buffer
-extern volatile int callback_flag_L;                         // DMA completion flag
-extern volatile int callback_flag_R;                         // DMA completion flag
-extern int dma_chan_a, dma_chan_b, dma_chan_c, dma_chan_d;                        // DMA channel assignments
+extern volatile uint16_t pwm_out_buf_L[AUDIO_BUFFER_COUNT][AUDIO_BLOCK_SIZE];  // Left ring
+extern volatile uint16_t pwm_out_buf_R[AUDIO_BUFFER_COUNT][AUDIO_BLOCK_SIZE];  // Right ring
+extern volatile uint16_t* out_buf_ptr_L;                     // Block to render next (just played)
+extern volatile uint16_t* out_buf_ptr_R;                     // Block to render next (just played)
+extern int dma_chan_L, dma_chan_L_ctrl, dma_chan_R, dma_chan_R_ctrl;  // DMA channel assignments
 extern float audio_rate;                                   // Audio sample rate (Hz)
 
 // ── Audio Output Interface Functions ────────────────────────────────────────────
@@ -75,18 +88,43 @@ void unmuteAudioOutput();
 /**
  * @brief DMA transfer completion callback
  * 
- * Called by the DMA system when an audio buffer transfer completes.
- * This function manages the ping-pong buffer system and signals
- * the audio engine to process the next buffer.
+ * Called by the DMA system (DMA_IRQ_1) when the left channel finishes a
+ * block. The right channel runs in lockstep and raises no interrupt. The
+ * block that just played is now the free one: out_buf_ptr_L/R are pointed
+ * at it and the audio engine renders into it right here, in the IRQ, so
+ * rendering is paced by the hardware rather than by polling from loop().
  */
 void PWM_DMATransCpltCallbackL();
-void PWM_DMATransCpltCallbackR();
 
 /**
  * @brief Configure PWM DMA for audio output
  * 
- * Sets up the PWM and DMA system for continuous audio output.
+ * Sets up the PWM and the data/control DMA channel pair for each output.
+ * configurePWM_DMA_R() starts both rings together, so call it last.
  * Must be called during system initialization.
  */
 void configurePWM_DMA_L();
-void configurePWM_DMA_R();
\ No newline at end of file
+void configurePWM_DMA_R();
+
+// ── Output Health ───────────────────────────────────────────────────────────────
+// After each render the completion IRQ reads where the left data channel is
+// in the ring and works out the slack: cycles until the DMA reaches the
+// block just rendered (a sample is PWM_RESOLUTION + 1 cycles). Negative
+// slack means the DMA got there first and played the start of the block
+// stale; completions missed while the IRQ was held off mean whole blocks
+// replayed. Both count as underruns. Slack under AUDIO_NEAR_MISS_SAMPLES
+// samples is a near miss. Always counted, profiler or not: a register read
+// and a few compares per block
+#ifndef AUDIO_NEAR_MISS_SAMPLES
+#define AUDIO_NEAR_MISS_SAMPLES  (AUDIO_BLOCK_SIZE / 4)
+#endif
+
+struct AudioHealth {
+  uint32_t blocks;         // All since boot
+  uint32_t underruns;
+  uint32_t near_misses;
+  int32_t  slack_min;      // Cycles (INT32_MAX before the first block)
+};
+
+// Either core; the profiler stream has the same per report
+void audio_health_read(AudioHealth* out);
\ No newline at end of file
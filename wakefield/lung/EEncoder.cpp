@@ -35,7 +35,12 @@ EEncoder::EEncoder(uint8_t pinA, uint8_t pinB, uint8_t buttonPin, uint8_t counts
     _encoderCallback(nullptr),
     _buttonCallback(nullptr),
     _longPressCallback(nullptr),
-    _enabled(true)
+    _enabled(true),
+#ifdef ARDUINO_ARCH_RP2040
+    _pio(nullptr),
+#endif
+    _pioSm(-1),
+    _pioOffset(0)
 {
     // Configure pins with INPUT_PULLUP
     pinMode(_pinA, INPUT_PULLUP);
@@ -76,7 +81,12 @@ EEncoder::EEncoder(uint8_t pinA, uint8_t pinB, uint8_t countsPerDetent) :
     _encoderCallback(nullptr),
     _buttonCallback(nullptr),
     _longPressCallback(nullptr),
-    _enabled(true)
+    _enabled(true),
+#ifdef ARDUINO_ARCH_RP2040
+    _pio(nullptr),
+#endif
+    _pioSm(-1),
+    _pioOffset(0)
 {
     // Configure pins
     pinMode(_pinA, INPUT_PULLUP);
@@ -92,7 +102,11 @@ EEncoder::EEncoder(uint8_t pinA, uint8_t pinB, uint8_t countsPerDetent) :
 void EEncoder::update() {
     if (!_enabled) return;
     
-    readEncoder();
+    if (_pioSm >= 0) {
+        readPioEncoder();
+    } else {
+        readEncoder();
+    }
     
     if (_hasButton) {
         readButton();
@@ -143,38 +157,7 @@ void EEncoder::readEncoder() {
             _absolutePosition += direction;
             _lastStateChangeTime = currentTime;
             
-            // Calculate how many detents we've moved since last callback
-            int32_t positionDelta = _absolutePosition - _lastCallbackPosition;
-            
-            // Check if we've moved enough for a complete detent
-            if (abs(positionDelta) >= _countsPerDetent) {
-                // Calculate how many full detents we've moved
-                int8_t detents = positionDelta / _countsPerDetent;
-                
-                // Update the last callback position by the number of full detents
-                // This preserves any fractional detent for next time
-                _lastCallbackPosition += detents * _countsPerDetent;
-                
-                // Set increment for this callback
-                _increment = detents;
-                
-                // Apply acceleration if enabled
-                if (_accelerationEnabled && abs(detents) == 1) {
-                    uint32_t timeSinceLastRotation = currentTime - _lastRotationTime;
-                    
-                    // If rotating quickly, multiply increment
-                    if (timeSinceLastRotation < ACCELERATION_THRESHOLD_MS) {
-                        _increment *= _accelerationRate;
-                    }
-                }
-                
-                _lastRotationTime = currentTime;
-                
-                // Fire callback
-                if (_encoderCallback != nullptr) {
-                    _encoderCallback(*this);
-                }
-            }
+            emitDetents(currentTime);
         }
         
         // Track valid states for idle detection
@@ -186,23 +169,175 @@ void EEncoder::readEncoder() {
     }
     // Handle idle recalibration
     else {
-        uint32_t currentTime = millis();
+        recalibrateIdle(millis());
+    }
+}
+
+// Fire the callback for each whole detent moved since the last one
+void EEncoder::emitDetents(uint32_t currentTime) {
+    // Calculate how many detents we've moved since last callback
+    int32_t positionDelta = _absolutePosition - _lastCallbackPosition;
+    
+    // Check if we've moved enough for a complete detent
+    if (abs(positionDelta) >= _countsPerDetent) {
+        // Calculate how many full detents we've moved (a long stall under
+        // the PIO decoder can bank more than fit; the rest come next time)
+        int32_t wholeDetents = positionDelta / _countsPerDetent;
+        if (wholeDetents > 127) wholeDetents = 127;
+        if (wholeDetents < -127) wholeDetents = -127;
+        int8_t detents = (int8_t)wholeDetents;
         
-        // If encoder has been idle at a detent position, recalibrate
-        if ((currentTime - _lastStateChangeTime) > ENCODER_IDLE_TIMEOUT_MS) {
-            // Only recalibrate if we're at a natural detent position
-            if (_encoderState == 0b00 || _encoderState == 0b11) {
-                // Round position to nearest detent
-                int32_t nearestDetent = ((_absolutePosition + _countsPerDetent/2) / _countsPerDetent) * _countsPerDetent;
-                
-                // Only adjust if we're close to a detent (within 1 count)
-                if (abs(_absolutePosition - nearestDetent) <= 1) {
-                    _absolutePosition = nearestDetent;
-                    _lastCallbackPosition = nearestDetent;
-                }
+        // Update the last callback position by the number of full detents
+        // This preserves any fractional detent for next time
+        _lastCallbackPosition += detents * _countsPerDetent;
+        
+        // Set increment for this callback
+        _increment = detents;
+        
+        // Apply acceleration if enabled
+        if (_accelerationEnabled && abs(detents) == 1) {
+            uint32_t timeSinceLastRotation = currentTime - _lastRotationTime;
+            
+            // If rotating quickly, multiply increment
+            if (timeSinceLastRotation < ACCELERATION_THRESHOLD_MS) {
+                _increment *= _accelerationRate;
             }
         }
+        
+        _lastRotationTime = currentTime;
+        
+        // Fire callback
+        if (_encoderCallback != nullptr) {
+            _encoderCallback(*this);
+        }
+    }
+}
+
+// Snap the position to the nearest detent once the encoder rests on one
+void EEncoder::recalibrateIdle(uint32_t currentTime) {
+    // If encoder has been idle at a detent position, recalibrate
+    if ((currentTime - _lastStateChangeTime) > ENCODER_IDLE_TIMEOUT_MS) {
+        // Only recalibrate if we're at a natural detent position
+        if (_encoderState == 0b00 || _encoderState == 0b11) {
+            // Round position to nearest detent
+            int32_t nearestDetent = ((_absolutePosition + _countsPerDetent/2) / _countsPerDetent) * _countsPerDetent;
+            
+            // Only adjust if we're close to a detent (within 1 count)
+            if (abs(_absolutePosition - nearestDetent) <= 1) {
+                _pioOffset += nearestDetent - _absolutePosition;
+                _absolutePosition = nearestDetent;
+                _lastCallbackPosition = nearestDetent;
+            }
+        }
+    }
+}
+
+// ── PIO decoder ─────────────────────────────────────────────────────────────
+// The state machine loops sampling both pins, jumps through a 16-entry
+// table indexed by (previous state << 2 | new state) and counts in Y, pushing
+// the count without blocking on every pass (at most 10 cycles, so steps up
+// to sysclk/10 are counted). The table must sit at offset 0: the jump is a
+// MOV PC. Built with pio_encode_* since the Arduino build has no pioasm.
+#ifdef ARDUINO_ARCH_RP2040
+static const uint QUAD_UPDATE    = 15;   // MOV ISR, Y; wrap target
+static const uint QUAD_DECREMENT = 14;
+static const uint QUAD_INCREMENT = 21;
+static uint16_t s_quadProgram[24];
+static const pio_program_t s_quadPio = { s_quadProgram, 24, 0 };
+
+static void buildQuadratureProgram() {
+    // Table rows: previous state 00, 01, 10, 11; columns: new state
+    static const uint8_t table[14] = {
+        QUAD_UPDATE,    QUAD_DECREMENT, QUAD_INCREMENT, QUAD_UPDATE,      // 00
+        QUAD_INCREMENT, QUAD_UPDATE,    QUAD_UPDATE,    QUAD_DECREMENT,   // 01
+        QUAD_DECREMENT, QUAD_UPDATE,    QUAD_UPDATE,    QUAD_INCREMENT,   // 10
+        QUAD_UPDATE,    QUAD_INCREMENT,                                   // 11 (rest in place)
+    };
+    uint i = 0;
+    for (; i < 14; ++i) s_quadProgram[i] = pio_encode_jmp(table[i]);
+    s_quadProgram[i++] = pio_encode_jmp_y_dec(QUAD_UPDATE);      // 14: 11 -> 10, Y-- (falls through)
+    s_quadProgram[i++] = pio_encode_mov(pio_isr, pio_y);         // 15: 11 -> 11, update
+    s_quadProgram[i++] = pio_encode_push(false, false);          //     push noblock
+    s_quadProgram[i++] = pio_encode_out(pio_isr, 2);             //     previous state into ISR
+    s_quadProgram[i++] = pio_encode_in(pio_pins, 2);             //     new state below it
+    s_quadProgram[i++] = pio_encode_mov(pio_osr, pio_isr);       //     keep it for the next pass
+    s_quadProgram[i++] = pio_encode_mov(pio_pc, pio_isr);        // 20: computed jump
+    s_quadProgram[i++] = pio_encode_mov_not(pio_y, pio_y);       // 21: increment = ~(~Y - 1)
+    s_quadProgram[i++] = pio_encode_jmp_y_dec(QUAD_INCREMENT + 2);
+    s_quadProgram[i++] = pio_encode_mov_not(pio_y, pio_y);       // 23: wrap
+}
+#endif
+
+bool EEncoder::enablePioDecoder() {
+#ifdef ARDUINO_ARCH_RP2040
+    if (_pioSm >= 0) return true;
+    if (_pinB + 1 != _pinA) return false;   // IN PINS reads B then A
+    buildQuadratureProgram();
+    
+    // Any PIO block with offset 0 free (or already holding the program)
+    // and a spare state machine
+    static PIO s_loaded[NUM_PIOS] = {};
+    for (uint n = 0; n < NUM_PIOS; ++n) {
+        PIO pio = PIO_INSTANCE(n);
+        const bool loaded = s_loaded[n] != nullptr;
+        if (!loaded && !pio_can_add_program_at_offset(pio, &s_quadPio, 0)) continue;
+        const int sm = pio_claim_unused_sm(pio, false);
+        if (sm < 0) continue;
+        if (!loaded) {
+            pio_add_program_at_offset(pio, &s_quadPio, 0);
+            s_loaded[n] = pio;
+        }
+        
+        pio_sm_set_consecutive_pindirs(pio, sm, _pinB, 2, false);
+        pio_sm_config c = pio_get_default_sm_config();
+        sm_config_set_wrap(&c, QUAD_UPDATE, 23);
+        sm_config_set_in_pins(&c, _pinB);
+        sm_config_set_in_shift(&c, false, false, 32);
+        sm_config_set_out_shift(&c, true, false, 32);
+        sm_config_set_fifo_join(&c, PIO_FIFO_JOIN_RX);
+        pio_sm_init(pio, sm, QUAD_UPDATE, &c);
+        
+        // Start from the current pins so the first pass counts nothing
+        pio_sm_exec(pio, sm, pio_encode_set(pio_y, 0));
+        pio_sm_exec(pio, sm, pio_encode_in(pio_pins, 2));
+        pio_sm_exec(pio, sm, pio_encode_mov(pio_osr, pio_isr));
+        pio_sm_set_enabled(pio, sm, true);
+        
+        _pio = pio;
+        _pioSm = (int8_t)sm;
+        _pioOffset = _absolutePosition;
+        return true;
+    }
+#endif
+    return false;
+}
+
+// Newest hardware count: drop whatever is queued, take the next push
+int32_t EEncoder::readPioCount() {
+#ifdef ARDUINO_ARCH_RP2040
+    uint n = pio_sm_get_rx_fifo_level(_pio, _pioSm) + 1;
+    uint32_t count = 0;
+    while (n-- > 0) count = pio_sm_get_blocking(_pio, _pioSm);
+    // The table counts up for 00 -> 10; the polled decoder for 00 -> 01
+    return -(int32_t)count;
+#else
+    return 0;
+#endif
+}
+
+void EEncoder::readPioEncoder() {
+    uint32_t currentTime = millis();
+    _encoderState = getEncoderState();   // for idle recalibration only
+    
+    int32_t position = readPioCount() + _pioOffset;
+    if (position != _absolutePosition) {
+        _absolutePosition = position;
+        _lastStateChangeTime = currentTime;
+        emitDetents(currentTime);
+    } else {
+        recalibrateIdle(currentTime);
     }
+    _lastEncoderState = _encoderState;
 }
 
 // Read and process button
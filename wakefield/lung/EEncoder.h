@@ -12,6 +12,8 @@
   - Long press detection
   - Acceleration support
   - Intelligent idle recalibration
+  - Optional PIO quadrature counter (RP2040/RP2350): edges are counted in
+    hardware, so late update() calls cannot drop steps
   - Simple, clean API
 */
 
@@ -19,6 +21,9 @@
 #define EEncoder_h
 
 #include <Arduino.h>
+#ifdef ARDUINO_ARCH_RP2040
+#include <hardware/pio.h>
+#endif
 
 // Default debounce time in milliseconds for button
 #define DEFAULT_DEBOUNCE_MS 10
@@ -53,9 +58,16 @@ public:
     // Constructor for encoder without button
     EEncoder(uint8_t pinA, uint8_t pinB, uint8_t countsPerDetent = DEFAULT_COUNTS_PER_DETENT);
     
-    // Must be called in loop() as often as possible
+    // Must be called in loop() as often as possible (any rate will do once
+    // the PIO decoder is running)
     void update();
     
+    // Count edges with a PIO state machine instead of sampling the pins in
+    // update(). Needs pinB == pinA - 1 and 24 free instructions at offset 0
+    // of a PIO block. Returns false (polling stays in use) otherwise
+    bool enablePioDecoder();
+    bool isPioDecoder() const { return _pioSm >= 0; }
+    
     // Set callback handlers
     void setEncoderHandler(EncoderCallback callback);
     void setButtonHandler(ButtonCallback callback);
@@ -125,8 +137,19 @@ private:
     // Enable state
     bool _enabled;
     
+    // PIO decoder (_pioSm < 0: polling)
+#ifdef ARDUINO_ARCH_RP2040
+    PIO _pio;
+#endif
+    int8_t _pioSm;
+    int32_t _pioOffset;              // _absolutePosition - hardware count
+    
     // Internal methods
     void readEncoder();
+    void readPioEncoder();
+    int32_t readPioCount();
+    void emitDetents(uint32_t currentTime);
+    void recalibrateIdle(uint32_t currentTime);
     void readButton();
     uint8_t getEncoderState();
 };
@@ -1,25 +1,54 @@
 #include "adc_filter.h"
-#include "ADCless.h"   // NUM_ADC_INPUTS, adc_results_buf[]
+#include "ADCless.h"   // NUM_ADC_INPUTS, ADC_RING_FRAMES, adc_results_buf[][]
 #include <stddef.h>
+#include <pico.h>
 
 // ───────────────────────── Module state ───────────────────────────────────
 static AdcEmaFilter       s_filters[NUM_ADC_INPUTS];           // per-channel EMA
 static volatile uint16_t  s_filtered[NUM_ADC_INPUTS];          // published values
+static volatile uint16_t  s_block[NUM_ADC_INPUTS];             // decimated, pre-EMA
+static uint16_t           s_held[NUM_ADC_INPUTS];              // value at the last change flag
+static volatile uint32_t  s_changed = 0;                       // bit i: channel i moved
 static volatile uint8_t   s_inited = 0;
 
 // ──────────────────────── Small helpers (no heap) ─────────────────────────
 static inline uint8_t clamp_u8(uint8_t v, uint8_t hi) { return (v > hi) ? hi : v; }
 
+static_assert((NUM_ADC_INPUTS & 1) == 0, "channels are summed in pairs");
+
+// One-stage CIC over the ring: per channel, the sum of every frame, scaled
+// to 0..65520. Each 32-bit word holds two adjacent channels' 12-bit samples,
+// so one add accumulates both lanes (16 * 4095 cannot carry across). Frames
+// the DMA is overwriting mid-sum only shift the window by a sample.
+static inline void __not_in_flash_func(ring_sums_q16)(uint16_t* out) {
+  const volatile uint32_t* w = (const volatile uint32_t*)&adc_results_buf[0][0];
+  uint32_t acc[NUM_ADC_INPUTS / 2] = {0};
+  for (uint32_t f = 0; f < ADC_RING_FRAMES; ++f) {
+    for (uint32_t k = 0; k < NUM_ADC_INPUTS / 2; ++k) acc[k] += *w++;
+  }
+  for (uint32_t k = 0; k < NUM_ADC_INPUTS / 2; ++k) {
+    out[2 * k]     = (uint16_t)((acc[k] & 0xFFFFu) * (16u / ADC_RING_FRAMES));
+    out[2 * k + 1] = (uint16_t)((acc[k] >> 16)     * (16u / ADC_RING_FRAMES));
+  }
+}
+
+// 0..65520 back to 0..4095, rounded
+static inline uint16_t q16_to_q12(uint16_t v) { return (uint16_t)((v + 8u) >> 4); }
+
 void adc_filter_init(float update_rate_hz, float cutoff_hz, uint32_t median3_mask) {
   // Default construct then configure
+  uint16_t sums[NUM_ADC_INPUTS];
+  ring_sums_q16(sums);
   for (uint32_t i = 0; i < NUM_ADC_INPUTS; ++i) {
     s_filters[i].setCutoffHz(update_rate_hz, cutoff_hz);
     s_filters[i].enableMedian3((median3_mask >> i) & 1u);
-    // Prime outputs with current raw (prevents initial jump on first read)
-    uint16_t raw = adc_results_buf[i];
-    (void)s_filters[i].process(raw);
-    s_filtered[i] = s_filters[i].value();
+    // Prime outputs with the current ring (prevents initial jump on first read)
+    (void)s_filters[i].process(sums[i]);
+    s_block[i]    = q16_to_q12(sums[i]);
+    s_filtered[i] = q16_to_q12(s_filters[i].value());
+    s_held[i]     = s_filtered[i];
   }
+  s_changed = (1u << NUM_ADC_INPUTS) - 1u;           // Everything is news to the first reader
   s_inited = 1;
 }
 
@@ -42,22 +71,45 @@ void adc_filter_enable_median3_mask(uint32_t median3_mask) {
   }
 }
 
-void adc_filter_update_from_dma(void) {
+void __not_in_flash_func(adc_filter_update_from_dma)(void) {
   if (!s_inited) return;
-  // Update each channel once from the latest DMA result
+  // Decimate the ring, then one EMA step per channel at 16-bit resolution
+  uint16_t sums[NUM_ADC_INPUTS];
+  ring_sums_q16(sums);
+  uint32_t changed = 0;
   for (uint32_t i = 0; i < NUM_ADC_INPUTS; ++i) {
-    uint16_t raw = adc_results_buf[i];           // 12-bit 0..4095
-    uint16_t f   = s_filters[i].process(raw);    // EMA (+ optional median3)
-    s_filtered[i] = f;                           // publish (16-bit write)
+    uint16_t f    = s_filters[i].process(sums[i]);  // EMA (+ optional median3)
+    uint16_t v    = q16_to_q12(f);
+    s_block[i]    = q16_to_q12(sums[i]);            // publish (16-bit writes)
+    s_filtered[i] = v;
+    // Flag a move past the deadband from where the channel was last flagged,
+    // so a slow turn still gets through while rounding flicker doesn't
+    int32_t d = (int32_t)v - (int32_t)s_held[i];
+    if (d > ADC_FILTER_DEADBAND_Q12 || d < -ADC_FILTER_DEADBAND_Q12) {
+      s_held[i] = v;
+      changed |= 1u << i;
+    }
   }
+  s_changed |= changed;
 }
 
-uint16_t adc_filter_get(uint8_t ch) {
+uint32_t __not_in_flash_func(adc_filter_take_changed)(void) {
+  uint32_t changed = s_changed;
+  s_changed = 0;
+  return changed;
+}
+
+uint16_t __not_in_flash_func(adc_filter_get)(uint8_t ch) {
   if (ch >= NUM_ADC_INPUTS) return 0;
   // 16-bit read; on RP2040 this is a single aligned access
   return s_filtered[ch];
 }
 
+uint16_t __not_in_flash_func(adc_filter_get_block)(uint8_t ch) {
+  if (ch >= NUM_ADC_INPUTS) return 0;
+  return s_block[ch];
+}
+
 void adc_filter_snapshot(uint16_t* dst, uint32_t n) {
   if (!dst) return;
   uint32_t count = (n < NUM_ADC_INPUTS) ? n : NUM_ADC_INPUTS;
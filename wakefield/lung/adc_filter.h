@@ -7,6 +7,11 @@
  * uses exponential moving average (EMA) filters with optional median-of-3
  * prefiltering for robust, real-time control processing.
  * 
+ * **Block Decimation**: Once per audio block the whole ADC DMA ring
+ * (ADC_RING_FRAMES round-robin frames) is summed per channel, a one-stage
+ * CIC decimating to the block rate. Two channels are summed per 32-bit add.
+ * The 16-bit sum carries 4 bits more than the ADC, and the EMA runs on it.
+ * 
  * ## Filtering Features
  * 
  * **Exponential Moving Average (EMA)**: Smooths control inputs using integer-only
@@ -44,8 +49,8 @@
  * y += (x - y) >> shift
  * 
  * Where:
- * - x is the input sample (0..4095)
- * - y is the filtered output
+ * - x is the input sample (any 16-bit range; the bank feeds 0..65520)
+ * - y is the filtered output, in the same range
  * - shift controls smoothing (0 = no smoothing, 15 = heavy smoothing)
  * 
  * The filter also supports optional median-of-3 prefiltering to eliminate
@@ -64,7 +69,7 @@ public:
     m0 = m1 = 0;
   }
 
-  // Process one 12-bit ADC sample (0..4095). Returns filtered sample (0..4095).
+  // Process one sample (0..65535). Returns the filtered sample.
   inline uint16_t process(uint16_t x) {
     uint16_t in = x;
     if (use_median3) {
@@ -121,7 +126,7 @@ private:
   bool     initialized;
 
   // EMA state
-  int32_t  y;                 // current filtered value (0..4095 range)
+  int32_t  y;                 // current filtered value (input range)
 
   // median-of-3 state
   uint16_t m0, m1;            // last two raw samples
@@ -133,9 +138,11 @@ private:
 // real-time performance.
 //
 // Usage Pattern:
-// 1. Call adc_filter_update_from_dma() at regular intervals (e.g., audio block rate)
+// 1. Call adc_filter_update_from_dma() once per audio block (it decimates the ring)
 // 2. Read filtered values with adc_filter_get(ch) from anywhere in the system
 // 3. All filtering is done in the background with no blocking operations
+// 4. Or take adc_filter_take_changed() once per block and recompute only
+//    what depends on the channels it flags
 
 // Configure all channels at once.
 // median3_mask: bit i enables median-of-3 on channel i (1=on).
@@ -146,11 +153,24 @@ void adc_filter_set_cutoff_all(float update_rate_hz, float cutoff_hz);
 void adc_filter_set_shift_all(uint8_t shift);
 void adc_filter_enable_median3_mask(uint32_t median3_mask);
 
-// Update bank from adc_results_buf[]. O(NUM_ADC_INPUTS), no heap.
+// Update bank from the adc_results_buf[][] ring. O(NUM_ADC_INPUTS * ADC_RING_FRAMES / 2)
+// 32-bit adds, then one EMA step per channel; no heap.
 void adc_filter_update_from_dma(void);
 
 // Read the latest filtered sample (0..4095). Safe across cores.
 uint16_t adc_filter_get(uint8_t ch);
 
+// The last block's decimated (ring average) sample, before the EMA (0..4095)
+uint16_t adc_filter_get_block(uint8_t ch);
+
+// Filtered moves (0..4095 units) at or below this are not flagged as changes
+#define ADC_FILTER_DEADBAND_Q12 1
+
+// Channels whose filtered value moved past the deadband since the last call
+// (bit i = channel i), then cleared. Flags gather until taken, so a reader
+// that skips blocks misses nothing; the first call after init flags every
+// channel. For one reader on the core that runs adc_filter_update_from_dma()
+uint32_t adc_filter_take_changed(void);
+
 // Bulk snapshot into caller-provided buffer; copies min(n, NUM_ADC_INPUTS).
 void adc_filter_snapshot(uint16_t* dst, uint32_t n);
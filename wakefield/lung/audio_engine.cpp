@@ -25,30 +25,19 @@
 #include "adc_filter.h"
 #include "audio_engine.h"
 #include "pico_interp.h"
+#include "audio_profiler.h"
 #include "sf_globals_bridge.h"
 #include "config_pins.h"
 #include <hardware/pwm.h>
 #include <hardware/gpio.h>
+#include <pico.h>
 #include <Arduino.h>  // Add for Serial
 
 // Forward declaration from audio_engine_render.cpp
-void ae_render_block(const int16_t* samples,
-                     uint32_t total_samples,
-                     ae_state_t engine_state,
-                     volatile uint64_t* io_phase_q32_32);
+void ae_render_block(ae_state_t engine_state, uint64_t* io_phase_q32_32);
 
 // Debug moved to audio_engine_debug.cpp
 
-// // Publish the loop + transport state for the display
-// static inline void publish_display_state(uint16_t start_q12, uint16_t len_q12, uint32_t playhead, uint32_t total) {
-//     disp_write_begin();
-//     g_disp.loop_start_q12 = start_q12;
-//     g_disp.loop_len_q12   = len_q12;
-//     g_disp.playhead       = playhead;
-//     g_disp.total          = total;
-//     disp_write_end();
-// }
-
 // audio_engine_get_last_snapshot moved to audio_engine_debug.cpp
 
 // ── Debug helper functions ──────────────────────────────────────────────────
@@ -67,9 +56,6 @@ static int8_t              s_dir   = +1;     // +1 forward, -1 reverse (used for
 static bool s_mode_switch_last_fwd = false;  // Previous forward switch state
 static bool s_mode_switch_last_rev = false;  // Previous reverse switch state
 
-// // Live playhead for UI (0..65535). 16-bit write/read is atomic on RP2-class MCUs.
-// volatile uint16_t g_playhead_norm_u16 = 0;
-
 void audio_engine_set_mode(ae_mode_t m) {
     s_mode = m;
     // sync s_dir with mode
@@ -146,7 +132,6 @@ void audio_engine_mode_switch_poll(void) {
 
 
 void audio_engine_arm(bool armed) {
-    if (!g_phase_q32_32) { /* optional reset */ }
     s_state = armed ? AE_STATE_READY : AE_STATE_IDLE;
 }
 
@@ -156,7 +141,7 @@ void audio_engine_play(bool play) {
 }
 
 ae_state_t audio_engine_get_state(void){ return s_state; }
-ae_mode_t  audio_engine_get_mode(void){  return s_mode;  }
+ae_mode_t  __not_in_flash_func(audio_engine_get_mode)(void){  return s_mode;  }
 
 
 
@@ -167,7 +152,7 @@ ae_mode_t  audio_engine_get_mode(void){  return s_mode;  }
 // Q32.32 format: 32 bits for integer sample index + 32 bits for fractional position
 // This prevents phase overflow even with very large samples and provides smooth
 // interpolation between samples for pitch shifting.
-volatile uint64_t g_phase_q32_32 = 0;
+uint64_t g_phase_q32_32 = 0;
 
 // ── Pitch base ─────────────────────────────────────────────────────────────
 // Base increment in Q32.32 format. This determines how fast the phase accumulator
@@ -194,16 +179,41 @@ static bool s_reset_trigger_last_state = false;
 // LED control for visual feedback when loop wraps
 static bool s_loop_led_state = false;
 static uint32_t s_loop_led_off_time = 0;
+static volatile bool s_loop_led_pending = false;   // Set by blink, timed by update
 static const uint32_t LOOP_LED_BLINK_MS = 10;  // LED blink duration in milliseconds
 
 
-static const int16_t* g_samples_q15 = nullptr;
 
 static uint32_t g_total_samples = 0;      // set when file is bound
 static const uint32_t MIN_LOOP_LEN_CONST = 64;  // Fixed minimum loop length
 static uint32_t g_span_start    = 0;      // = total - MIN_LOOP_LEN_CONST (precomputed)
 static uint32_t g_span_len      = 0;      // = total - MIN_LOOP_LEN_CONST (same span)
 
+// ── Buffer binding (core 1 → core 0) ──────────────────────────────────────
+// The loader runs on core 1 while the render reads the fields above from
+// the DMA IRQ on core 0, so a bind is staged here under a seqlock and
+// applied by audio_tick() between blocks. The IRQ never spins: a bind
+// caught mid-write is simply picked up one block later.
+//
+// Switching samples while playing fades the current block out, binds, and
+// fades the next block in (one block each way, a few hundred microseconds),
+// so a resident sample from the cache swaps in without a click.
+//
+// Each layer has its own record and sequence; one bind is taken per block.
+typedef struct {
+    const int16_t* samples;
+    uint32_t       total;
+    uint64_t       inc_base_q32_32;
+} ae_bind_t;
+
+static ae_bind_t         s_bind[AE_LAYERS];
+static volatile uint32_t s_bind_seq[AE_LAYERS];       // even = stable
+static volatile uint32_t s_bind_applied[AE_LAYERS];   // core 0: last sequence taken
+static ae_bind_t         s_bind_staged;               // core 0: taken, applied after the fade-out
+static uint8_t           s_bind_staged_layer = 0;
+static volatile bool     s_bind_fading  = false;
+static const int16_t*    s_bound[AE_LAYERS];          // core 0: what the render reads
+
 
 // ── Tune knob ──────────────────────────────────────────────────────────────
 // Lookup table for exponential pitch control. The tune knob provides smooth
@@ -299,17 +309,12 @@ void playback_bind_loaded_buffer(uint32_t src_sample_rate_hz,
                                  uint32_t out_sample_rate_hz,
                                  uint32_t sample_count)
 {
-    g_samples_q15   = reinterpret_cast<const int16_t*>(sf::audioData);
-    g_total_samples = sample_count;
-
-    // Unity base: src_hz / out_hz in Q16.16
-    g_inc_base_q32_32 = (uint64_t)(((uint64_t)src_sample_rate_hz << 32) / (uint64_t)out_sample_rate_hz);
-
-    // Ensure loop spans are valid for the new file
-    loop_mapper_recalc_spans();
-    
-    // Reset loop boundaries calculation flag for new file
-    ae_reset_loop_boundaries_flag();
+    seq_write_begin(&s_bind_seq[0]);
+    s_bind[0].samples = reinterpret_cast<const int16_t*>(sf::audioData);
+    s_bind[0].total   = sample_count;
+    // Unity base: src_hz / out_hz in Q32.32 (the 64-bit divide stays here)
+    s_bind[0].inc_base_q32_32 = (uint64_t)(((uint64_t)src_sample_rate_hz << 32) / (uint64_t)out_sample_rate_hz);
+    seq_write_end(&s_bind_seq[0]);
     
     // Debug log - DISABLED TO PREVENT POPS
     // Serial.print(F("[AE] Buffer bound: "));
@@ -319,40 +324,101 @@ void playback_bind_loaded_buffer(uint32_t src_sample_rate_hz,
     // Serial.println(F(" Hz"));
 }
 
+// The second layer plays at the first one's pitch, so only the buffer goes
+void playback_bind_second_layer(const int16_t* samples, uint32_t sample_count) {
+    seq_write_begin(&s_bind_seq[1]);
+    s_bind[1].samples = samples;
+    s_bind[1].total   = samples ? sample_count : 0;
+    s_bind[1].inc_base_q32_32 = 0;
+    seq_write_end(&s_bind_seq[1]);
+}
+
+bool playback_bound_buffers(const int16_t* out[AE_LAYERS]) {
+    if (s_bind_fading) return false;
+    for (int l = 0; l < AE_LAYERS; ++l) {
+        if (s_bind_applied[l] != s_bind_seq[l]) return false;
+    }
+    __dmb();
+    for (int l = 0; l < AE_LAYERS; ++l) out[l] = s_bound[l];
+    return true;
+}
+
+static void __not_in_flash_func(apply_bind)(uint8_t layer, const ae_bind_t& bind) {
+    s_bound[layer] = bind.samples;
+    if (layer == 0) {
+        g_total_samples   = bind.total;
+        g_inc_base_q32_32 = bind.inc_base_q32_32;
+        loop_mapper_recalc_spans();    // Loop spans for the new file
+    }
+    ae_render_rebind(layer, bind.samples, bind.total);   // Start at the new loop, recalculated next block
+}
+
 
 void audio_init(void) {
     // Initialize all audio buffers to silence to prevent startup pops
     const uint16_t silence_pwm = PWM_RESOLUTION / 2;  // Midpoint = silence
-    for (int i = 0; i < AUDIO_BLOCK_SIZE; i++) {
-        pwm_out_buf_a[i] = silence_pwm;
-        pwm_out_buf_b[i] = silence_pwm;
-        pwm_out_buf_c[i] = silence_pwm;
-        pwm_out_buf_d[i] = silence_pwm;
+    for (int b = 0; b < AUDIO_BUFFER_COUNT; b++) {
+        for (int i = 0; i < AUDIO_BLOCK_SIZE; i++) {
+            pwm_out_buf_L[b][i] = silence_pwm;
+            pwm_out_buf_R[b][i] = silence_pwm;
+        }
     }
     
+    // Everything the render reads must be ready before the DMA starts:
+    // the first completion IRQ renders straight away
     init_expo_table_1oct();
+    ae_render_init();
+    setupInterpolators();
+#ifdef AUDIO_PROFILE
+    // One sample is PWM_RESOLUTION + 1 clocks (wrap is inclusive, clkdiv 1)
+    prof_init((PWM_RESOLUTION + 1u) * AUDIO_BLOCK_SIZE, AUDIO_BUFFER_COUNT);
+#endif
     configurePWM_DMA_L();
     configurePWM_DMA_R();
     unmuteAudioOutput();
-    
-    setupInterpolators();
 
     // dma_start_channel_mask(1u << dma_chan);
-    // Serial.printf("[AE] DMA L started? %d\n", dma_channel_is_busy(dma_chan_a));
-    // Serial.printf("[AE] DMA R started? %d\n", dma_channel_is_busy(dma_chan_c));
+    // Serial.printf("[AE] DMA L started? %d\n", dma_channel_is_busy(dma_chan_L));
+    // Serial.printf("[AE] DMA R started? %d\n", dma_channel_is_busy(dma_chan_R));
 
     // Serial.println(F("[AE] Audio engine initialized"));
 }
 
-void audio_tick(void) {
-    // Process audio when either channel is ready to prevent buffer underruns
-    // This fixes the pop issue caused by waiting for both channels simultaneously
-    if (callback_flag_L > 0 || callback_flag_R > 0) {
-        adc_filter_update_from_dma();
-        ae_render_block(g_samples_q15, g_total_samples, s_state, &g_phase_q32_32);
-        callback_flag_L = 0;
-        callback_flag_R = 0;
+// Render one block into out_buf_ptr_L/R. Called from the DMA completion IRQ
+// (PWM_DMATransCpltCallbackL) once per finished block, so both output rings
+// always get the block that just played
+void __not_in_flash_func(audio_tick)(void) {
+    PROF_BLOCK_BEGIN();
+    bool fade_out = false, fade_in = false;
+    if (s_bind_fading) {
+        apply_bind(s_bind_staged_layer, s_bind_staged);   // Previous block faded out
+        __dmb();
+        s_bind_fading = false;
+        fade_in = true;
+    } else {
+        for (uint8_t l = 0; l < AE_LAYERS && !fade_out; ++l) {
+            const uint32_t seq = seq_read_begin(&s_bind_seq[l]);
+            if (seq == s_bind_applied[l]) continue;
+            const ae_bind_t bind = s_bind[l];
+            if (seq_read_retry(&s_bind_seq[l], seq)) continue;
+            if (s_state == AE_STATE_PLAYING && s_bound[l]) {
+                s_bind_staged = bind;          // Fade this block out, bind next
+                s_bind_staged_layer = l;
+                s_bind_fading = fade_out = true;
+            } else {
+                apply_bind(l, bind);
+            }
+            s_bind_applied[l] = seq;
+        }
     }
+
+    adc_filter_update_from_dma();
+    adc_capture_guard();
+    PROF_SECTION(PROF_SEC_ADC);
+    ae_render_block(s_state, &g_phase_q32_32);    // Marks the two layer sections
+    if (fade_out || fade_in) ae_render_ramp(fade_in);
+    PROF_SECTION(PROF_SEC_EFFECTS);
+    PROF_BLOCK_END();
 }
 
 // ── Reset Trigger Functions ──────────────────────────────────────────────────────
@@ -435,6 +501,11 @@ void audio_engine_loop_led_init(void) {
  * blinking state. It turns the LED off after the blink duration expires.
  */
 void audio_engine_loop_led_update(void) {
+    // A blink from the render path starts its timer here
+    if (s_loop_led_pending) {
+        s_loop_led_pending = false;
+        s_loop_led_off_time = millis() + LOOP_LED_BLINK_MS;
+    }
     // Check if LED is currently on and time to turn it off
     if (s_loop_led_state && millis() >= s_loop_led_off_time) {
         gpio_put(LOOP_LED_PIN, 0);  // Turn LED off
@@ -447,9 +518,11 @@ void audio_engine_loop_led_update(void) {
  * 
  * This function should be called when the loop wraps to provide
  * visual feedback. It turns the LED on for a brief duration.
+ * Called from the render path, so it runs from RAM and leaves millis()
+ * (a flash-resident core call) to audio_engine_loop_led_update().
  */
-void audio_engine_loop_led_blink(void) {
+void __not_in_flash_func(audio_engine_loop_led_blink)(void) {
     gpio_put(LOOP_LED_PIN, 1);  // Turn LED on
     s_loop_led_state = true;
-    s_loop_led_off_time = millis() + LOOP_LED_BLINK_MS;
+    s_loop_led_pending = true;
 }
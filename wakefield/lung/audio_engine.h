@@ -60,8 +60,12 @@ typedef enum {
   AE_STATE_PAUSED = 3,   // buffer bound, transport paused
 } ae_state_t;
 
-// Q16.16 phase accumulator, advanced each audio sample
-extern volatile uint64_t g_phase_q32_32;
+// Samples the render can play at once (see "Sample layers" below)
+#define AE_LAYERS 2
+
+// Q32.32 phase accumulator, advanced each audio sample. Core 0 only (64-bit
+// accesses tear); the display reads positions via vis_get_snapshot()
+extern uint64_t g_phase_q32_32;
 
 // Q16.16 base increment (unity speed = src_rate / out_rate)
 // Set at bind time; later multiplied by the tune ratio per block.
@@ -71,9 +75,6 @@ extern uint64_t g_inc_base_q32_32;
 //  adc(int16 centered) * g_pm_scale_q16_16 => Q16.16 delta added to phase
 extern int32_t g_pm_scale_q16_16;
 
-// Live playhead position normalized to the current loop, 0..65535.
-extern volatile uint16_t g_playhead_norm_u16;
-
 // Reset trigger state
 extern volatile bool g_reset_trigger_pending;
 
@@ -82,9 +83,12 @@ extern volatile bool g_reset_trigger_pending;
 // Initializes tables and PWM DMA (expects your DACless/ADCless to be linkable)
 void audio_init(void);
 
+// Render the next block; called by the DACless DMA IRQ, not from loop()
 void audio_tick(void);
 
 // Bind the loaded sample buffer and set the base increment to unity for that file.
+// Callable from either core: the binding is published through a seqlock and
+// taken up by the render at the start of the next block.
 //  - src_sample_rate_hz: WAV/native sample rate
 //  - out_sample_rate_hz: your audio engine output rate (PWM ISR rate)
 //  - sample_count: number of int16 PCM samples in PSRAM
@@ -92,6 +96,16 @@ void playback_bind_loaded_buffer(uint32_t src_sample_rate_hz,
                                  uint32_t out_sample_rate_hz,
                                  uint32_t sample_count);
 
+// Bind a second sample to layer 1 alongside the current one, or unbind it
+// (samples nullptr). Published like playback_bind_loaded_buffer; the
+// buffer must stay resident until the bind of something else is taken up.
+void playback_bind_second_layer(const int16_t* samples, uint32_t sample_count);
+
+// The buffers the render reads, per layer (nullptr = layer off), once every
+// bind has been taken up; false while one is still in flight (a block or
+// two). The loader checks this before freeing a buffer.
+bool playback_bound_buffers(const int16_t* out[AE_LAYERS]);
+
 // ── Transport / mode control (UI calls these) ────────────────────
 void audio_engine_set_mode(ae_mode_t m);      // FORWARD/REVERSE/ALTERNATE
 void audio_engine_arm(bool armed);            // armed=true => READY; false => IDLE/PAUSED
@@ -110,6 +124,40 @@ void audio_engine_loop_led_blink(void);      // Trigger LED blink on loop wrap
 
 // ── Loop boundaries control ──────────────────────────────────────
 void ae_reset_loop_boundaries_flag(void);    // Reset loop boundaries calculation flag
+void ae_render_init(void);                   // Build the crossfade gain table (audio_init)
+// New sample bound to a layer (core 0, between blocks): restart at its loop start
+void ae_render_rebind(uint8_t layer, const int16_t* samples, uint32_t total_samples);
+
+// ── Sample layers ────────────────────────────────────────────────
+// Layer 0 plays the current sample. Layer 1 optionally plays a second
+// resident sample alongside it, with its own loop window; both follow the
+// same pitch, mode and FM. The balance (Q15, 0 = layer 0 alone, 32767 =
+// layer 1 alone) blends them at constant power, and the loop start/length
+// knobs edit whichever layer is louder. Set from the UI core.
+void     ae_render_set_layer_mix(uint16_t mix_q15);
+uint16_t ae_render_get_layer_mix(void);
+
+// ── Stretch (granular) mode ──────────────────────────────────────
+// Each layer plays as four overlapping Hann-windowed grains started from a
+// loop position that moves independently of pitch: the octave switch, tune
+// and FM set the grain pitch while the loop keeps its duration. At octave 0
+// the tune knob sets the loop speed instead (its LFO range) with grains at
+// unity pitch. The crossfade knob sets the grain length (512-8192 samples).
+// Set from the UI core; the render fades across the switch.
+void ae_render_set_stretch(bool on);
+bool ae_render_get_stretch(void);
+
+// Ramp the block just rendered toward (fade_in false) or up from (fade_in
+// true) silence, across a rebind (audio_tick)
+void ae_render_ramp(bool fade_in);
+
+// ── Effects on core 1 ────────────────────────────────────────────
+// Built with AUDIO_FX_CORE1 defined (build_opt.h), core 0 renders the
+// layer mix and core 1 runs the saturation, lowpass and PWM conversion on
+// it during the next block: one block more latency, the effects off the
+// audio core's budget. setup1() calls this to take them over; until then,
+// or if no SIO doorbell is free, core 0 keeps running them
+void ae_render_fx_core1_init(void);
 
 // ── Mode switch control ──────────────────────────────────────────
 void audio_engine_mode_switch_init(void);    // Initialize GPIO16/17 for mode switch
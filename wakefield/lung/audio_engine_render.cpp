@@ -1,18 +1,35 @@
 /**
  * @file audio_engine_render.cpp
- * @brief Dual-voice audio rendering engine with seamless crossfading
+ * @brief Two-layer, dual-voice audio rendering engine with seamless crossfading
  * 
  * Simplified architecture using two concurrent voices for clean crossfading,
- * TZFM support, and bidirectional playback.
+ * TZFM support, and bidirectional playback. Up to two samples play at once,
+ * each as a layer with its own voice pair and loop window.
  * 
  * Key Concepts:
+ * - Layers: layer 0 is the current sample, layer 1 an optional second one;
+ *   the UI balance blends them at constant power (layered at the middle,
+ *   one alone at either end) and the loop knobs edit the louder layer
+ * - Stretch mode: each layer as four overlapping Hann-windowed grains (Q15
+ *   window table, the hardware interpolator for the reads, scheduled once per
+ *   block) so pitch and loop duration are independent
  * - Q32.32 fixed-point: 32-bit integer + 32-bit fractional part for sub-sample precision
- * - Constant-power crossfading: Uses cos/sin curves to maintain consistent loudness
- * - Hardware interpolation: Leverages Pico's interpolate() for smooth sample reconstruction
+ * - Constant-power crossfading: Q15 quarter-sine table for the cos/sin curves
+ * - Hardware interpolation: interp0's blend mode (interpolate_s16) for sample reconstruction
  * - TZFM (Through-Zero FM): Allows negative frequencies for reverse playback
+ * - SRAM sample windows: each voice reads a window DMA copied from PSRAM a
+ *   block ahead of its playhead (sample_prefetch.h), PSRAM only on a miss
+ * - Effects on core 1 (AUDIO_FX_CORE1): core 0 stops at the clamped mix and
+ *   core 1 runs saturation, lowpass and PWM conversion a block behind
+ * - RAM-resident: every function on the render path is __not_in_flash_func and
+ *   the hot voice/crossfade state lives in scratch Y, so an XIP cache miss
+ *   (core 1 drawing or reading the SD card) cannot stall the audio core.
+ *   No libgcc/libm calls per block either: 64-bit divides, exp2f and
+ *   float-to-int64 conversions are replaced by 32-bit or table forms.
+ *   check_audio_ram.py verifies this on the built ELF.
  * 
  * @author Brian Varren (rewritten)
- * @version 2.0
+ * @version 2.2
  * @date 2024
  */
 
@@ -22,19 +39,22 @@
  #include "ADCless.h"
  #include "adc_filter.h"
  #include "audio_engine.h"
+#include "audio_profiler.h"
  #include "pico_interp.h"
+ #include "sample_prefetch.h"
  #include "sf_globals_bridge.h"
  #include "ui_input.h"
  #include "ladder_filter.h"
  #include <Arduino.h>
+ #include <pico.h>
+#ifdef AUDIO_FX_CORE1
+#include <hardware/irq.h>
+#include <hardware/sync.h>
+#include <pico/multicore.h>
+#endif
  
  // Forward declarations
  extern volatile bool g_reset_trigger_pending;
- static bool g_loop_boundaries_calculated = false;
- 
- void ae_reset_loop_boundaries_flag(void) {
-     g_loop_boundaries_calculated = false;
- }
  
 // ── Voice Structure ──────────────────────────────────────────────────────────
 // Each voice maintains its own playback state and loop boundaries
@@ -42,87 +62,312 @@ struct Voice {
     uint64_t phase_q32_32;      // Q32.32 phase accumulator - 32-bit integer + 32-bit fractional
     uint32_t loop_start;        // Loop start (samples) - where playback begins
     uint32_t loop_end;          // Loop end (samples) - where playback wraps to start
-    float amplitude;            // Current amplitude (0-1) for mixing during crossfades
+    int32_t amplitude_q15;      // Current amplitude (Q15, 0-32768) for mixing during crossfades
     bool active;                // Is this voice currently playing? (false = silent)
+    uint8_t window;             // Prefetch window (g_prefetch index) - fixed per voice
 };
- 
+
+// ── Grain Structure ──────────────────────────────────────────────────────────
+// Stretch mode plays each layer as overlapping Hann-windowed grains. A grain
+// starts on a block boundary and lasts a whole number of blocks, so the
+// scheduler only runs once per block
+const uint32_t MAX_GRAINS = 4;              // Per layer; the window overlap (hop = length / 4)
+struct Grain {
+    uint64_t phase_q32_32;      // Read position (Q32.32), wrapped in the layer's loop
+    uint32_t window_q32;        // Progress through the window, 0..1 as a Q0.32 fraction
+    uint32_t window_step_q32;   // Progress per sample: 2^32 / length
+    uint32_t remaining;         // Samples left; 0 = free
+};
+
+// ── Layer Structure ──────────────────────────────────────────────────────────
+// A layer plays one sample through a pair of voices, the pair existing only
+// for its loop crossfades. Layer 0 is the current sample; layer 1 is a second
+// resident sample held from the browser, with its own loop window. Both
+// share the pitch, direction and FM of the block
+struct Layer {
+    Voice voice[2];                         // Crossfade pair - only one is "primary" at a time
+    uint8_t primary;                        // Index of the currently playing voice
+    const int16_t* samples;                 // Bound sample, nullptr = layer off
+    uint32_t total_samples;
+
+    // Crossfade state - tracks the transition between the pair
+    bool crossfading;                       // Are we currently crossfading?
+    uint32_t crossfade_samples_remaining;   // Samples left in current crossfade
+    uint32_t crossfade_progress_q32;        // Progress 0..1 as a Q0.32 fraction
+    uint32_t crossfade_step_q32;            // Progress per sample: 2^32 / total
+
+    // Pending loop parameters (calculated once per block to avoid recalculation)
+    uint32_t pending_start;                 // New loop start position
+    uint32_t pending_end;                   // New loop end position
+
+    bool was_in_zone_last_sample;           // Prevents retriggering crossfade on zone entry
+    bool boundaries_calculated;             // Pending window valid (cleared after each crossfade)
+    bool window_changed;                    // Knobs or sample moved since pending_* were computed
+    bool reset_pending;                     // Reset trigger not yet taken by this layer
+
+    // Loop window knobs (12-bit): follow the ADCs while this layer has
+    // focus, held while the other one does
+    uint16_t start_q12;
+    uint16_t len_q12;
+
+    // Crossfade lengths for the primary loop, kept until the loop, the
+    // crossfade knob or the pitch moves
+    uint32_t xfade_len;                     // Trigger zone (samples of the loop)
+    uint32_t xfade_samples;                 // Duration at the current pitch
+    uint32_t xfade_loop_len;                // Loop length they were computed for
+
+    int32_t gain_q15;                       // Layer mix gain reached at the end of the last block
+
+    // Stretch mode: the loop position moves at its own rate and grains
+    // are started from it at the pitch of the block
+    uint64_t time_q32_32;                   // Loop position grains start from
+    int32_t grain_countdown;                // Samples until the next grain starts
+    Grain grains[MAX_GRAINS];
+};
+
 // ── Global State ─────────────────────────────────────────────────────────────
-// Two voices for seamless crossfading - only one is "primary" at a time
-static Voice voice_A = {0, 0, 0, 1.0f, true};   // Initially active
-static Voice voice_B = {0, 0, 0, 0.0f, false};  // Initially silent
-static Voice* primary_voice = &voice_A;         // Currently playing voice
-static Voice* secondary_voice = &voice_B;       // Voice fading in during crossfade
+// Hot state sits in scratch Y (SRAM bank 5, next to core 0's stack): only the
+// audio core touches it, so it never contends with core 1 for a striped bank
+static Layer __scratch_y("lung_render") s_layers[AE_LAYERS];
+
+// Layer balance set by the UI, Q15 0..32767: 0 = layer 0 alone, 16384 =
+// both at -3 dB, 32767 = layer 1 alone. The start/length knobs address the
+// louder layer. Unused while no second layer is bound
+static volatile uint16_t s_layer_mix_q15 = 0;
+
+void ae_render_set_layer_mix(uint16_t mix_q15) {
+    s_layer_mix_q15 = (mix_q15 > 32767u) ? 32767u : mix_q15;
+}
+
+uint16_t ae_render_get_layer_mix(void) {
+    return s_layer_mix_q15;
+}
+
+// Stretch (granular) mode as requested by the UI, and as the render plays
+// it: a change fades the output out over one block and back in over the
+// next, switching in between
+static volatile bool s_stretch_request = false;
+static bool __scratch_y("lung_render") s_stretch = false;
+static bool __scratch_y("lung_render") s_stretch_switching = false;
+
+void ae_render_set_stretch(bool on) {
+    s_stretch_request = on;
+}
+
+bool ae_render_get_stretch(void) {
+    return s_stretch_request;
+}
+
+void __not_in_flash_func(ae_reset_loop_boundaries_flag)(void) {
+    for (int l = 0; l < AE_LAYERS; ++l) {
+        s_layers[l].boundaries_calculated = false;
+        s_layers[l].window_changed = true;
+    }
+}
+
+// New sample bound to a layer: drop both voices' loops so the next block
+// cold-starts at the new file's loop start (audio_tick fades across the
+// jump). A new layer starts from the other layer's loop window
+void __not_in_flash_func(ae_render_rebind)(uint8_t layer, const int16_t* samples, uint32_t total_samples) {
+    Layer& L = s_layers[layer];
+    Voice& primary = L.voice[L.primary];
+    Voice& secondary = L.voice[L.primary ^ 1u];
+    L.samples = samples;
+    L.total_samples = samples ? total_samples : 0;
+    L.crossfading = false;
+    L.was_in_zone_last_sample = false;
+    L.boundaries_calculated = false;
+    L.window_changed = true;
+    L.xfade_loop_len = UINT32_MAX;            // Crossfade lengths stale
+    L.reset_pending = false;
+    primary.loop_start = primary.loop_end = 0;    // Also restarts the stretch position
+    primary.amplitude_q15 = 32768;
+    primary.active = true;
+    secondary.active = false;
+    secondary.amplitude_q15 = 0;
+    for (uint32_t k = 0; k < MAX_GRAINS; ++k) L.grains[k].remaining = 0;
+    L.grain_countdown = 0;
+    prefetch_invalidate(primary.window);      // Copies of the old sample
+    prefetch_invalidate(secondary.window);
+    if (layer != 0) {
+        L.start_q12 = s_layers[0].start_q12;
+        L.len_q12 = s_layers[0].len_q12;
+    }
+}
  
-// Crossfade state - tracks the transition between voices
-static bool crossfading = false;                    // Are we currently crossfading?
-static uint32_t crossfade_samples_total = 0;        // Total crossfade duration
-static uint32_t crossfade_samples_remaining = 0;    // Samples left in current crossfade
+// Quarter sine in Q15: entry i = sin(pi/2 * i/256), 0..32768. The fade-in
+// gain reads it forward, the fade-out gain backward (cos = reversed sin)
+static uint16_t kQuarterSine_Q15[257];
+
+// Hann window in Q15: entry i = sin^2(pi * i/256), 0..32768..0, read with
+// the same interpolation as the quarter sine
+static uint16_t kHann_Q15[257];
+
+// Fine tune ratio 2^(0.5 * x), x = -1..+1 over 257 entries (as the tune
+// table in audio_engine.cpp), so the block never calls exp2f
+static float kTuneRatio[257];
+
+void ae_render_init(void) {
+    for (uint32_t i = 0; i <= 256; ++i) {
+        kQuarterSine_Q15[i] = (uint16_t)lrintf(32768.0f * sinf((float)M_PI_2 * (float)i / 256.0f));
+        kTuneRatio[i] = exp2f(0.5f * ((int32_t)i - 128) / 128.0f);
+        const float h = sinf((float)M_PI * (float)i / 256.0f);
+        kHann_Q15[i] = (uint16_t)lrintf(32768.0f * h * h);
+    }
+    for (int l = 0; l < AE_LAYERS; ++l) {
+        Layer& L = s_layers[l];
+        memset(&L, 0, sizeof(L));
+        L.voice[0] = {0, 0, 0, 32768, true, (uint8_t)(2 * l)};       // Initially active
+        L.voice[1] = {0, 0, 0, 0, false, (uint8_t)(2 * l + 1)};      // Initially silent
+        L.gain_q15 = (l == 0) ? 32768 : 0;
+        L.window_changed = true;
+        L.xfade_loop_len = UINT32_MAX;
+    }
+    prefetch_init();
+}
+
+// Table lookup with linear interpolation: index 0..255 plus a weight 0..256
+static inline int32_t __not_in_flash_func(quarter_sine_q15)(uint32_t idx, uint32_t w8) {
+    const int32_t a = kQuarterSine_Q15[idx];
+    const int32_t b = kQuarterSine_Q15[idx + 1];
+    return a + (((b - a) * (int32_t)w8) >> 8);
+}
 
-// Pending loop parameters (calculated once per block to avoid recalculation)
-static uint32_t pending_start = 0;                  // New loop start position
-static uint32_t pending_end = 0;                    // New loop end position
+// Window gain at a Q0.32 progress: top 8 bits index, next 8 interpolate
+static inline int32_t __not_in_flash_func(hann_q15)(uint32_t progress_q32) {
+    const uint32_t idx = progress_q32 >> 24;
+    const int32_t a = kHann_Q15[idx];
+    const int32_t b = kHann_Q15[idx + 1];
+    return a + (((b - a) * (int32_t)((progress_q32 >> 16) & 0xFFu)) >> 8);
+}
+
+// Tune knob (12-bit) to ratio: 16 ADC steps per table entry
+static inline float __not_in_flash_func(tune_ratio_from_adc)(uint16_t adc_q12) {
+    const uint32_t idx = adc_q12 >> 4;
+    const float w = (float)(adc_q12 & 15u) * (1.0f / 16.0f);
+    return kTuneRatio[idx] + (kTuneRatio[idx + 1] - kTuneRatio[idx]) * w;
+}
 
-// Zone detection state - prevents retriggering crossfade on zone entry
-static bool was_in_zone_last_sample = false;
+// floor(adc_q12 * span / 4095) with 32-bit divides only (no __aeabi_uldivmod)
+static inline uint32_t __not_in_flash_func(scale_by_adc_q12)(uint16_t adc_q12, uint32_t span) {
+    const uint32_t q = span / 4095u;
+    const uint32_t r = span % 4095u;
+    return adc_q12 * q + (adc_q12 * r) / 4095u;
+}
  
-// Filters (mono path - applied after mixing both voices)
-static Ladder8PoleLowpassFilter s_lowpass_filter;   // 8-pole ladder filter for lowpass
-static SaturationEffect s_saturation_effect;        // Saturation effect for warmth and distortion
+// Filters (mono path - applied after mixing both layers), in the scratch
+// bank of the core that runs them
+#ifdef AUDIO_FX_CORE1
+#define FX_STATE __scratch_x("lung_fx")
+#else
+#define FX_STATE __scratch_y("lung_render")
+#endif
+static Ladder8PoleLowpassFilter FX_STATE s_lowpass_filter;   // 8-pole ladder filter for lowpass
+static SaturationEffect FX_STATE s_saturation_effect;        // Saturation effect for warmth and distortion
 
 // TZFM (Through-Zero Frequency Modulation) state
-static float base_ratio = 1.0f;                     // Base playback speed (1.0 = normal)
-static float tzfm_depth = 0.0f;                     // FM modulation depth
-static float modulator_smoothed = 0.0f;             // Smoothed modulator to prevent clicks
-const float MODULATOR_SMOOTHING = 0.85f;            // One-pole smoothing coefficient
+static float __scratch_y("lung_render") base_ratio = 1.0f;                     // Base playback speed (1.0 = normal)
+static int32_t __scratch_y("lung_render") modulator_smoothed_q15 = 0;          // Smoothed modulator (Q15) to prevent clicks
+const int32_t MODULATOR_SMOOTHING_Q15 = 4915;       // One-pole coefficient: 1 - 0.85 in Q15
+const int32_t TZFM_DEPTH_MIN_Q15 = 32;              // Depths at or below 0.001 leave FM off
+
+// Block controls derived from the knobs, carried from block to block and
+// recomputed only when adc_filter_take_changed() flags a channel they
+// depend on, or the octave switch or direction moves
+struct BlockControls {
+    bool primed;                            // The first block computes everything
+    uint8_t octave_pos;
+    bool is_reverse;
+    uint8_t focus;                          // Layer the window knobs edit
+    int64_t base_inc;                       // From base_ratio and direction
+    int32_t tzfm_depth_q15;
+    uint32_t grain_len;
+    uint16_t sat_coeff;
+    uint16_t lp_coeff;
+};
+static BlockControls __scratch_y("lung_render") s_controls;
+
+// Channel ch flagged in an adc_filter_take_changed() mask
+static inline bool adc_moved(uint32_t changed, uint8_t ch) { return ((changed >> ch) & 1u) != 0; }
+
+// Phase increment limits (Q32.32) to prevent overflow in the accumulator
+const int64_t MAX_INC = (1LL << 37);
+const int64_t MIN_INC = -(1LL << 37);
  
  // ── Helper Functions ─────────────────────────────────────────────────────────
  
 // Convert Q15 signed sample to unsigned PWM value
 // Q15: -32768 to +32767, PWM: 0 to PWM_RESOLUTION-1
-static inline uint16_t q15_to_pwm_u(int16_t s) {
+static inline uint16_t __not_in_flash_func(q15_to_pwm_u)(int16_t s) {
     uint32_t u = ((uint16_t)s) ^ 0x8000u;  // Convert signed to unsigned (flip MSB)
     return (uint16_t)((u * (PWM_RESOLUTION - 1u)) >> 16);  // Scale to PWM range
 }
  
-// Wrap phase within loop boundaries (handles both forward and reverse)
+// x mod span (Q32.32). The span is a whole number of samples, so only the
+// integer part needs reducing: one 32-bit hardware divide
+static inline uint64_t __not_in_flash_func(mod_span_q)(uint64_t x, uint32_t span_samples) {
+    const uint32_t whole = (uint32_t)(x >> 32) % span_samples;
+    return ((uint64_t)whole << 32) | (x & 0xFFFFFFFFull);
+}
+
+// Wrap a phase within loop boundaries (handles both forward and reverse)
 // Converts sample indices to Q32.32 for precise boundary checking
-static void wrap_phase(Voice* v) {
-    const int64_t start_q = ((int64_t)v->loop_start) << 32;  // Convert to Q32.32
-    const int64_t end_q = ((int64_t)v->loop_end) << 32;      // Convert to Q32.32
+static inline uint64_t __not_in_flash_func(wrap_in_loop)(uint64_t phase_q32_32, uint32_t loop_start, uint32_t loop_end) {
+    const int64_t start_q = ((int64_t)loop_start) << 32;  // Convert to Q32.32
+    const int64_t end_q = ((int64_t)loop_end) << 32;      // Convert to Q32.32
      const int64_t span_q = end_q - start_q;  // Loop length in Q32.32
      
-     if (span_q <= 0) return;  // Invalid loop boundaries
+     if (span_q <= 0) return phase_q32_32;  // Invalid loop boundaries
      
-     int64_t phase = (int64_t)v->phase_q32_32;
+     int64_t phase = (int64_t)phase_q32_32;
      int64_t normalized = phase - start_q;  // Position relative to loop start
      
      // Modulo wrapping for both directions - handles forward and reverse playback
+     // One step past either end is the usual case; a further jump (phase
+     // set from outside) takes the divide
+     const uint32_t span_samples = loop_end - loop_start;
      if (normalized >= span_q) {
-         normalized = normalized % span_q;  // Forward: wrap to start
+         // Forward: wrap to start
+         normalized = (normalized < 2 * span_q) ? normalized - span_q
+                                                : (int64_t)mod_span_q((uint64_t)normalized, span_samples);
      } else if (normalized < 0) {
-         normalized = span_q - ((-normalized) % span_q);  // Reverse: wrap to end
-         if (normalized == span_q) normalized = 0;  // Edge case: exactly at end
+         // Reverse: wrap to end (exactly -span lands on 0)
+         if (normalized >= -span_q) {
+             normalized += span_q;
+         } else {
+             const int64_t rem = (int64_t)mod_span_q((uint64_t)(-normalized), span_samples);
+             normalized = rem ? span_q - rem : 0;
+         }
      }
      
-     v->phase_q32_32 = (uint64_t)(start_q + normalized);
+     return (uint64_t)(start_q + normalized);
  }
+
+// Wrap a voice's phase within its own loop
+static inline void __not_in_flash_func(wrap_phase)(Voice* v) {
+    v->phase_q32_32 = wrap_in_loop(v->phase_q32_32, v->loop_start, v->loop_end);
+}
  
 // Get interpolated sample from voice using hardware interpolation
 // Returns smoothly interpolated sample between two adjacent samples
-static int16_t get_sample(const Voice* v, const int16_t* samples, uint32_t total_samples, bool is_reverse) {
-    if (!v->active || v->amplitude <= 0.0f) return 0;  // Silent voice
+static int16_t __not_in_flash_func(get_sample)(const Layer& L, const Voice* v, bool is_reverse) {
+    if (!v->active || v->amplitude_q15 <= 0) return 0;  // Silent voice
     if (v->loop_end <= v->loop_start) return 0;        // Invalid loop
+
+    const int16_t* samples = L.samples;
+    const uint32_t total_samples = L.total_samples;
+    const bool fading_out = L.crossfading && v == &L.voice[L.primary];
     
     // Extract integer sample index from Q32.32 phase
     uint32_t i = (uint32_t)(v->phase_q32_32 >> 32);
 
    // Special case: During crossfade, handle primary voice buffer overflow more gracefully
    // This prevents loud pops from discontinuity while still allowing fade-out
-   if (crossfading && v == primary_voice) {
+   if (fading_out) {
        if (i >= total_samples) {
            // If primary voice has significant amplitude, clamp to last sample to avoid pop
            // If amplitude is very low, allow wrap to prevent unnecessary processing
-           if (v->amplitude > 0.1f) {
+           if (v->amplitude_q15 > 3277) {  // 0.1 in Q15
                i = total_samples - 1;  // Clamp to last valid sample
            } else {
                i %= total_samples;  // Safe to wrap when nearly silent
@@ -134,13 +379,12 @@ static int16_t get_sample(const Voice* v, const int16_t* samples, uint32_t total
    
    // Additional safety: If we're very close to buffer end during crossfade, 
    // apply additional amplitude reduction to ensure smooth fade-out
-   float additional_fade = 1.0f;  // Default: no additional fade
-   if (crossfading && v == primary_voice && i >= total_samples - 8) {
+   int32_t additional_fade_q15 = 32768;  // Default: no additional fade
+   if (fading_out && i >= total_samples - 8) {
        // Calculate distance from buffer end (0-7 samples)
        uint32_t distance_from_end = total_samples - 1 - i;
        // Apply additional fade factor (1.0 at distance 7, 0.0 at distance 0)
-       additional_fade = (float)distance_from_end / 7.0f;
-       additional_fade = fmaxf(0.0f, fminf(1.0f, additional_fade));
+       additional_fade_q15 = (distance_from_end >= 7) ? 32768 : (int32_t)(distance_from_end * 32768u / 7u);
    }
     
     // Get second sample for interpolation (handles loop boundaries)
@@ -151,58 +395,55 @@ static int16_t get_sample(const Voice* v, const int16_t* samples, uint32_t total
         i2 = (i < v->loop_end - 1) ? (i + 1) : v->loop_start;   // Forward: next sample
     }
     
-    // Extract 8-bit fractional part for interpolation (0-255)
+    // Signed hardware blend; it takes the weight from the top 8 bits of
+    // the phase fraction itself
+    PrefetchWindow& w = g_prefetch[v->window];
     const uint32_t frac32 = (uint32_t)(v->phase_q32_32 & 0xFFFFFFFFull);
-    const uint16_t mu8 = (uint16_t)(frac32 >> 24);  // Use upper 8 bits as interpolation weight
-    
-    // Convert to unsigned for hardware interpolation, then back to signed
-    const uint16_t u0 = (uint16_t)((int32_t)samples[i] + 32768);   // Convert -32768..32767 to 0..65535
-    const uint16_t u1 = (uint16_t)((int32_t)samples[i2] + 32768);
-    const uint16_t ui = interpolate(u0, u1, mu8);  // Hardware interpolation on Pico
-    int16_t sample = (int16_t)((int32_t)ui - 32768);  // Convert back to signed
+    int16_t sample = interpolate_s16(prefetch_read(w, samples, i), prefetch_read(w, samples, i2), frac32);
     
     // Apply additional fade factor if near buffer end during crossfade
-    sample = (int16_t)(sample * additional_fade);
+    sample = (int16_t)(((int32_t)sample * additional_fade_q15) >> 15);
     
     return sample;
 }
  
-// Calculate TZFM-modulated increment for phase accumulator
-// TZFM (Through-Zero FM) allows negative frequencies for reverse playback
-static int64_t calculate_increment(uint16_t adc_fm_raw, bool is_reverse) {
-    // Base increment from pitch controls (in Q32.32 format)
-    int64_t base_inc = (int64_t)(base_ratio * (double)(1ULL << 32));
+// Base phase increment (Q32.32) from the pitch controls, once per block
+// Single-precision only: the RP2350's FPU has no double support. Integer
+// and fraction are converted separately, as float-to-int64 is a library call
+static int64_t __not_in_flash_func(calculate_base_increment)(bool is_reverse) {
+    const uint32_t whole = (uint32_t)base_ratio;
+    const uint32_t frac = (uint32_t)((base_ratio - (float)whole) * 4294967296.0f);  // * 2^32
+    int64_t base_inc = (int64_t)(((uint64_t)whole << 32) | frac);
     
     // Apply direction - negative for reverse playback
     if (is_reverse) base_inc = -base_inc;
     
-    // Apply TZFM if enabled (allows through-zero modulation)
-    if (tzfm_depth > 0.001f) {
-        // Convert FM input to bipolar (-1 to +1) from 12-bit ADC
-        float raw_mod = ((float)adc_fm_raw - 2048.0f) / 2048.0f;
-        raw_mod = fmaxf(-1.0f, fminf(1.0f, raw_mod));  // Clamp to valid range
-        
-        // One-pole smoothing to prevent clicks from rapid FM changes
-        modulator_smoothed = MODULATOR_SMOOTHING * modulator_smoothed + 
-                           (1.0f - MODULATOR_SMOOTHING) * raw_mod;
-        
-        // Apply modulation: 1.0 + (mod * depth) allows through-zero
-        float modulated = (float)base_inc * (1.0f + modulator_smoothed * tzfm_depth);
-        base_inc = (int64_t)modulated;
-    }
-    
-    // Safety limits to prevent overflow in phase accumulator
-    const int64_t MAX_INC = (1LL << 37);   // Reasonable upper limit
-    const int64_t MIN_INC = -(1LL << 37);  // Reasonable lower limit
     if (base_inc > MAX_INC) base_inc = MAX_INC;
     if (base_inc < MIN_INC) base_inc = MIN_INC;
-    
     return base_inc;
 }
+
+// Calculate TZFM-modulated increment for phase accumulator, per sample
+// TZFM (Through-Zero FM) allows negative frequencies for reverse playback
+// mod_target_q15: FM input as bipolar Q15; depth_q15: 0..32768
+static inline int64_t __not_in_flash_func(calculate_increment)(int64_t base_inc, int32_t mod_target_q15, int32_t depth_q15) {
+    // One-pole smoothing to prevent clicks from rapid FM changes (rounded)
+    modulator_smoothed_q15 += ((mod_target_q15 - modulator_smoothed_q15) * MODULATOR_SMOOTHING_Q15
+                               + (1 << 14)) >> 15;
+    
+    // Apply modulation: 1.0 + (mod * depth) allows through-zero
+    const int32_t mod_depth_q15 = (modulator_smoothed_q15 * depth_q15) >> 15;
+    int64_t inc = base_inc + ((base_inc * mod_depth_q15) >> 15);
+    
+    // Safety limits to prevent overflow in phase accumulator
+    if (inc > MAX_INC) inc = MAX_INC;
+    if (inc < MIN_INC) inc = MIN_INC;
+    return inc;
+}
  
 // Check if phase is in crossfade trigger zone
 // Determines when to start crossfading based on current position and crossfade length
-static bool is_in_crossfade_zone(uint64_t phase, uint32_t loop_start, uint32_t loop_end, 
+static bool __not_in_flash_func(is_in_crossfade_zone)(uint64_t phase, uint32_t loop_start, uint32_t loop_end, 
                                  uint32_t xfade_len, bool is_reverse) {
     uint32_t idx = (uint32_t)(phase >> 32);  // Extract sample index from Q32.32
     
@@ -219,254 +460,733 @@ static bool is_in_crossfade_zone(uint64_t phase, uint32_t loop_start, uint32_t l
     }
 }
  
+ 
 // Setup secondary voice for crossfade
 // Initializes the incoming voice with new loop boundaries and position
-static void setup_crossfade(uint32_t xfade_len, uint32_t xfade_samples, bool is_reverse) {
+static void __not_in_flash_func(setup_crossfade)(Layer& L, uint32_t xfade_samples, bool is_reverse) {
+    Voice* secondary_voice = &L.voice[L.primary ^ 1u];
+
     // Secondary voice gets new loop boundaries from pending parameters
-    secondary_voice->loop_start = pending_start;
-    secondary_voice->loop_end = pending_end;
+    secondary_voice->loop_start = L.pending_start;
+    secondary_voice->loop_end = L.pending_end;
     secondary_voice->active = true;
     
     // Position secondary voice at the start of the new loop region
     // In reverse mode, start from the end of the loop (last sample)
     if (is_reverse) {
-        secondary_voice->phase_q32_32 = ((uint64_t)(pending_end - 1)) << 32;
+        secondary_voice->phase_q32_32 = ((uint64_t)(L.pending_end - 1)) << 32;
     } else {
-        secondary_voice->phase_q32_32 = ((uint64_t)pending_start) << 32;
+        secondary_voice->phase_q32_32 = ((uint64_t)L.pending_start) << 32;
     }
      
      // Start crossfade
-     crossfading = true;
-     crossfade_samples_total = xfade_samples;
-     crossfade_samples_remaining = xfade_samples;
+     L.crossfading = true;
+     L.crossfade_samples_remaining = xfade_samples;
+     L.crossfade_progress_q32 = 0;
+     L.crossfade_step_q32 = 0xFFFFFFFFu / xfade_samples;  // 2^32 / total, 32-bit divide
      
      // Clear reset trigger
-     g_reset_trigger_pending = false;
+     L.reset_pending = false;
  }
- 
-// ── Main Render Function ─────────────────────────────────────────────────────
-// Processes one audio block (AUDIO_BLOCK_SIZE samples) with dual-voice crossfading
 
-void ae_render_block(const int16_t* samples,
-                     uint32_t total_samples,
-                     ae_state_t engine_state,
-                     volatile uint64_t* io_phase_q32_32)
-{
-    // Early exit for silence - output center PWM value (no audio)
-    if (engine_state != AE_STATE_PLAYING || !samples || total_samples < 2) {
-        const uint16_t silence_pwm = PWM_RESOLUTION / 2;  // Center PWM value
-        for (uint32_t i = 0; i < AUDIO_BLOCK_SIZE; ++i) {
-            out_buf_ptr_L[i] = silence_pwm;
-            out_buf_ptr_R[i] = silence_pwm;
+// New loop start/end positions from the layer's window knobs, when they or
+// the sample changed since the last call; otherwise pending_* still hold
+static void __not_in_flash_func(calculate_boundaries)(Layer& L) {
+    if (!L.window_changed) return;
+    L.window_changed = false;
+    const uint32_t MIN_LOOP = 2048u;  // Minimum loop length (samples)
+    const uint32_t total_samples = L.total_samples;
+    const uint32_t span = (total_samples > MIN_LOOP) ? (total_samples - MIN_LOOP) : 0;
+    
+    // Map ADC values to sample positions within available range
+    L.pending_start = scale_by_adc_q12(L.start_q12, span);
+    uint32_t len = MIN_LOOP + scale_by_adc_q12(L.len_q12, span);
+    L.pending_end = L.pending_start + len;
+    if (L.pending_end > total_samples) L.pending_end = total_samples;  // Clamp to buffer end
+}
+
+// Ask for the samples a voice should read next block: from its playhead
+// in the direction of travel, this block's advance plus a quarter (room for
+// FM and tune to move) and the interpolation neighbours. A voice playing on
+// past its loop (the fading-out one) is clipped to the sample instead of
+// wrapped. Loops are at least 2048 samples unless the whole sample is
+// shorter, so one wrap is all a window can see
+static void __not_in_flash_func(prefetch_voice)(const Layer& L, const Voice* v, int64_t advance, bool wraps) {
+    if (!v->active || v->loop_end <= v->loop_start) return;
+    const uint64_t mag = (uint64_t)(advance < 0 ? -advance : advance);
+    uint32_t span = (uint32_t)(mag >> 32) + (uint32_t)(mag >> 34) + 3u;
+    if (span > PREFETCH_SAMPLES) span = PREFETCH_SAMPLES;
+    const uint32_t i = (uint32_t)(v->phase_q32_32 >> 32);
+    const bool forward = advance >= 0;
+
+    if (!wraps) {
+        if (i >= L.total_samples) return;
+        if (forward) {
+            const uint32_t count = (span < L.total_samples - i) ? span : L.total_samples - i;
+            prefetch_request(v->window, L.samples, i, count, 0, 0);
+        } else {
+            const uint32_t first = (i + 1 >= span) ? i + 1 - span : 0;
+            prefetch_request(v->window, L.samples, first, i + 1 - first, 0, 0);
         }
         return;
     }
-    
-    // ── Read Control Inputs ──────────────────────────────────────────────────
-    // All ADC inputs are filtered except FM (needs fast response for TZFM)
-    const uint16_t adc_start_q12 = adc_filter_get(ADC_LOOP_START_CH);    // Loop start position
-    const uint16_t adc_len_q12 = adc_filter_get(ADC_LOOP_LEN_CH);        // Loop length
-    const uint16_t adc_xfade_q12 = adc_filter_get(ADC_XFADE_LEN_CH);     // Crossfade length
-    const uint16_t adc_tune_q12 = adc_filter_get(ADC_TUNE_CH);           // Fine tuning
-    const uint16_t adc_tzfm_depth_q12 = adc_filter_get(ADC_TZFM_DEPTH_CH); // FM depth
-    const uint16_t adc_lowpass_q12 = adc_filter_get(ADC_FX1_CH);         // Lowpass filter
-    const uint16_t adc_saturation_q12 = adc_filter_get(ADC_FX2_CH);      // Saturation effect
-    const uint16_t adc_fm_raw = adc_results_buf[ADC_PM_CH];  // Unfiltered for TZFM
-     
-    // ── Calculate Pitch Once ─────────────────────────────────────────────────
-    // Convert ADC values to playback speed ratio (1.0 = normal speed)
-    const uint8_t octave_pos = sf::ui_get_octave_position();
-    float t_norm = ((float)adc_tune_q12 - 2048.0f) / 2048.0f;  // Convert to -1..+1
-    t_norm = fmaxf(-1.0f, fminf(1.0f, t_norm));  // Clamp to valid range
-    
-    if (octave_pos == 0) {
-        // LFO mode: very slow playback for modulation effects
-        const float lfo_min = 0.001f;  // Minimum LFO speed
-        const float lfo_max = 1.0f;    // Maximum LFO speed
-        base_ratio = lfo_min + (1.0f - t_norm) * 0.5f * (lfo_max - lfo_min);
+
+    const uint32_t ls = v->loop_start, le = v->loop_end;
+    if (i < ls || i >= le) return;
+    if (le - ls <= span) {
+        prefetch_request(v->window, L.samples, ls, le - ls, 0, 0);   // The whole loop
+    } else if (forward) {
+        const uint32_t n0 = (span < le - i) ? span : le - i;
+        prefetch_request(v->window, L.samples, i, n0, ls, span - n0);
     } else {
-        // Octave mode: musical intervals (0.5x, 1x, 2x, 4x, etc.)
-        const int octave_shift = (int)octave_pos - 4;  // Center position = 1x speed
-        const float octave_ratio = exp2f((float)octave_shift);  // 2^octave_shift
-        const float tune_ratio = exp2f(t_norm * 0.5f);  // Fine tuning: ±50 cents
-        base_ratio = octave_ratio * tune_ratio;
+        const uint32_t n0 = (span < i - ls + 1) ? span : i - ls + 1;
+        prefetch_request(v->window, L.samples, i + 1 - n0, n0, le - (span - n0), span - n0);
     }
-     
-    // Update TZFM depth (0.0 = no modulation, 1.0 = full depth)
-    tzfm_depth = (float)adc_tzfm_depth_q12 / 4095.0f;
-    
-    // Get playback direction from UI state
-    const ae_mode_t mode = audio_engine_get_mode();
-    const bool is_reverse = (mode == AE_MODE_REVERSE);
-    
-    // ── Calculate Loop Boundaries ────────────────────────────────────────────
-    // Lambda function to calculate new loop start/end positions from ADC values
-    auto calculate_boundaries = [&]() {
-        const uint32_t MIN_LOOP = 2048u;  // Minimum loop length (samples)
-        const uint32_t span = (total_samples > MIN_LOOP) ? (total_samples - MIN_LOOP) : 0;
-        
-        // Map ADC values to sample positions within available range
-        pending_start = span ? (uint32_t)(((uint64_t)adc_start_q12 * span) / 4095u) : 0u;
-        uint32_t len = MIN_LOOP + (span ? (uint32_t)(((uint64_t)adc_len_q12 * span) / 4095u) : 0u);
-        pending_end = pending_start + len;
-        if (pending_end > total_samples) pending_end = total_samples;  // Clamp to buffer end
-    };
-    
+}
+
+// ── Layer Render ─────────────────────────────────────────────────────────────
+// Advances one layer through the block into mix[] (stored by the first layer,
+// added by the second: no zeroing, which could become a flash memset call),
+// its gain ramping linearly from gain_from to gain_to so balance changes
+// don't zipper. inc[] holds the block's per-sample increments, shared by
+// both, and advance their sum, from which the voices' next windows are asked
+static void __not_in_flash_func(render_layer)(Layer& L,
+                                              const int64_t* inc,
+                                              int64_t advance,
+                                              uint16_t adc_xfade_q12,
+                                              bool xfade_stale,
+                                              bool is_reverse,
+                                              int32_t gain_from,
+                                              int32_t gain_to,
+                                              int32_t* mix,
+                                              bool accumulate)
+{
+    Voice* primary_voice = &L.voice[L.primary];
+    Voice* secondary_voice = &L.voice[L.primary ^ 1u];
+
     // Calculate boundaries if needed (first run or manual reset)
-    if (!g_loop_boundaries_calculated || g_reset_trigger_pending) {
-        calculate_boundaries();
-        g_loop_boundaries_calculated = true;
+    if (!L.boundaries_calculated || L.reset_pending) {
+        calculate_boundaries(L);
+        L.boundaries_calculated = true;
         
         // Initialize primary voice if first run (cold start)
         if (primary_voice->loop_end == 0) {
-            primary_voice->loop_start = pending_start;
-            primary_voice->loop_end = pending_end;
-            primary_voice->phase_q32_32 = ((uint64_t)pending_start) << 32;
-            *io_phase_q32_32 = primary_voice->phase_q32_32;  // Sync global phase
+            primary_voice->loop_start = L.pending_start;
+            primary_voice->loop_end = L.pending_end;
+            primary_voice->phase_q32_32 = ((uint64_t)L.pending_start) << 32;
         }
     }
      
     // ── Calculate Crossfade Length ───────────────────────────────────────────
-    // Crossfade length is calculated in samples, then converted to time at current pitch
-    uint32_t xfade_len = 0;
-    if (primary_voice->loop_end > primary_voice->loop_start) {
-        uint32_t loop_len = primary_voice->loop_end - primary_voice->loop_start;
-        uint32_t max_xfade = loop_len / 2;  // Maximum crossfade is half the loop length
-        xfade_len = (uint32_t)((uint64_t)max_xfade * adc_xfade_q12 >> 12);  // Scale by ADC value
-        if (xfade_len < 8) xfade_len = 8;  // Minimum crossfade length
-        if (xfade_len > max_xfade) xfade_len = max_xfade;  // Clamp to maximum
+    // Crossfade length is calculated in samples, then converted to time at current pitch.
+    // Only when the loop changed (a crossfade finished) or xfade_stale says
+    // the crossfade knob or the pitch moved; otherwise the last ones stand
+    const uint32_t loop_len = (primary_voice->loop_end > primary_voice->loop_start)
+                              ? primary_voice->loop_end - primary_voice->loop_start : 0;
+    if (xfade_stale || loop_len != L.xfade_loop_len) {
+        uint32_t xfade_len = 0;
+        if (loop_len > 0) {
+            uint32_t max_xfade = loop_len / 2;  // Maximum crossfade is half the loop length
+            xfade_len = (uint32_t)((uint64_t)max_xfade * adc_xfade_q12 >> 12);  // Scale by ADC value
+            if (xfade_len < 8) xfade_len = 8;  // Minimum crossfade length
+            if (xfade_len > max_xfade) xfade_len = max_xfade;  // Clamp to maximum
+        }
+
+        // Convert crossfade length to actual samples at current playback speed
+        // This accounts for pitch changes - slower playback = longer crossfade time
+        // Add safety check to prevent division by near-zero values
+        float safe_ratio = fmaxf(0.0001f, fabsf(base_ratio));  // Prevent near-zero division
+        uint32_t xfade_samples = (uint32_t)fminf((float)xfade_len / safe_ratio, 4.0e9f);
+        if (xfade_samples < 16) xfade_samples = 16;  // Minimum crossfade duration
+        // Note: Upper clamp removed to allow long crossfades when needed
+        L.xfade_len = xfade_len;
+        L.xfade_samples = xfade_samples;
+        L.xfade_loop_len = loop_len;
     }
-    
-   // Convert crossfade length to actual samples at current playback speed
-   // This accounts for pitch changes - slower playback = longer crossfade time
-   // Add safety check to prevent division by near-zero values
-   float safe_ratio = fmaxf(0.0001f, fabs(base_ratio));  // Prevent near-zero division
-   uint32_t xfade_samples_unclamped = (uint32_t)((((uint64_t)xfade_len) << 32) / (uint64_t)(safe_ratio * (1ULL << 32)));
-   uint32_t xfade_samples = xfade_samples_unclamped;
-   if (xfade_samples < 16) xfade_samples = 16;  // Minimum crossfade duration
-   // Note: Upper clamp removed to allow long crossfades when needed
+    const uint32_t xfade_len = L.xfade_len;
+    const uint32_t xfade_samples = L.xfade_samples;
      
-    // ── Process Audio Samples ────────────────────────────────────────────────
-    // Main audio processing loop - processes one sample at a time for real-time response
-    
-    // Sync phase from primary voice (in case it was updated externally)
-    primary_voice->phase_q32_32 = *io_phase_q32_32;
-    
     for (uint32_t n = 0; n < AUDIO_BLOCK_SIZE; ++n) {
-       // Calculate phase increment with TZFM modulation
-       int64_t inc = calculate_increment(adc_fm_raw, is_reverse);
-       
-       // Get current position BEFORE advancing phase (for crossfade detection)
-       uint32_t current_idx = (uint32_t)(primary_voice->phase_q32_32 >> 32);
-
        // Check for crossfade trigger BEFORE wrapping phase
        // This prevents premature wrapping that would interrupt crossfades
-       if (!crossfading && !g_reset_trigger_pending && xfade_len > 0) {
+       if (!L.crossfading && !L.reset_pending && xfade_len > 0) {
            bool in_zone = is_in_crossfade_zone(primary_voice->phase_q32_32,
                                               primary_voice->loop_start,
                                               primary_voice->loop_end,
                                               xfade_len, is_reverse);
            
-           if (in_zone && !was_in_zone_last_sample) {
-               calculate_boundaries();  // Get fresh boundaries for the incoming voice
-               setup_crossfade(xfade_len, xfade_samples, is_reverse);
+           if (in_zone && !L.was_in_zone_last_sample) {
+               calculate_boundaries(L);  // Get fresh boundaries for the incoming voice
+               setup_crossfade(L, xfade_samples, is_reverse);
                audio_engine_loop_led_blink();  // Visual feedback
+               PROF_EVENT(PROF_EV_XFADE);
            }
-           was_in_zone_last_sample = in_zone;  // Prevent retriggering
+           L.was_in_zone_last_sample = in_zone;  // Prevent retriggering
        }
 
        // Advance primary voice's phase accumulator
-       primary_voice->phase_q32_32 += inc;
+       primary_voice->phase_q32_32 += inc[n];
 
        // Only wrap phase when not crossfading - allows primary voice to play out during fade
-       if (!crossfading) {
+       if (!L.crossfading) {
            wrap_phase(primary_voice);
        }
         
         // Manual trigger check (user-initiated crossfade)
-        if (g_reset_trigger_pending && !crossfading) {
-             calculate_boundaries();
-             setup_crossfade(xfade_len, xfade_samples, is_reverse);
+        if (L.reset_pending && !L.crossfading) {
+             calculate_boundaries(L);
+             setup_crossfade(L, xfade_samples, is_reverse);
              audio_engine_loop_led_blink();
+             PROF_EVENT(PROF_EV_RESET);
          }
          
          // Handle crossfading between voices
-         if (crossfading) {
+         if (L.crossfading) {
              // Advance secondary voice with same increment as primary
-             secondary_voice->phase_q32_32 += inc;
+             secondary_voice->phase_q32_32 += inc[n];
              wrap_phase(secondary_voice);  // Secondary voice always wraps normally
              
              // Calculate crossfade amplitudes using constant-power curves
              // This maintains consistent loudness during the transition
-             float t = (float)(crossfade_samples_total - crossfade_samples_remaining) / 
-                      (float)crossfade_samples_total;  // Progress: 0.0 to 1.0
-             primary_voice->amplitude = cosf(M_PI_2 * t);    // Fade out: 1.0 → 0.0
-             secondary_voice->amplitude = sinf(M_PI_2 * t);  // Fade in: 0.0 → 1.0
+             // Progress 0..1: top 8 bits index the table, next 8 interpolate
+             const uint32_t idx = L.crossfade_progress_q32 >> 24;
+             const uint32_t w8 = (L.crossfade_progress_q32 >> 16) & 0xFFu;
+             primary_voice->amplitude_q15 = quarter_sine_q15(255u - idx, 256u - w8);  // Fade out: 1.0 → 0.0
+             secondary_voice->amplitude_q15 = quarter_sine_q15(idx, w8);              // Fade in: 0.0 → 1.0
+             L.crossfade_progress_q32 += L.crossfade_step_q32;
              
-             if (--crossfade_samples_remaining == 0) {
+             if (--L.crossfade_samples_remaining == 0) {
                  // Crossfade complete - swap voices and clean up
-                 crossfading = false;
+                 L.crossfading = false;
+                 L.primary ^= 1u;
                  Voice* temp = primary_voice;
                  primary_voice = secondary_voice;  // New voice becomes primary
                  secondary_voice = temp;           // Old voice becomes secondary
                  secondary_voice->active = false;  // Silence old voice
-                 secondary_voice->amplitude = 0.0f;
-                 primary_voice->amplitude = 1.0f;  // Full volume for new voice
-                 g_loop_boundaries_calculated = false;  // Force boundary recalculation
+                 secondary_voice->amplitude_q15 = 0;
+                 primary_voice->amplitude_q15 = 32768;  // Full volume for new voice
+                 L.boundaries_calculated = false;  // Force boundary recalculation
              }
          }
          
-         // Mix both voices with their current amplitudes
+         // Mix both voices with their current amplitudes (Q15 MACs)
          // Use int32_t for accumulation to prevent overflow during crossfade
          int32_t sample = 0;
-         bool is_rev_now = (inc < 0);  // Determine actual playback direction
+         bool is_rev_now = (inc[n] < 0);  // Determine actual playback direction
          
-         if (primary_voice->active && primary_voice->amplitude > 0.0f) {
-             int16_t s = get_sample(primary_voice, samples, total_samples, is_rev_now);
-             sample += (int32_t)(s * primary_voice->amplitude);
+         if (primary_voice->active && primary_voice->amplitude_q15 > 0) {
+             int16_t s = get_sample(L, primary_voice, is_rev_now);
+             sample += ((int32_t)s * primary_voice->amplitude_q15) >> 15;
          }
          
-         if (secondary_voice->active && secondary_voice->amplitude > 0.0f) {
-             int16_t s = get_sample(secondary_voice, samples, total_samples, is_rev_now);
-             sample += (int32_t)(s * secondary_voice->amplitude);
+         if (secondary_voice->active && secondary_voice->amplitude_q15 > 0) {
+             int16_t s = get_sample(L, secondary_voice, is_rev_now);
+             sample += ((int32_t)s * secondary_voice->amplitude_q15) >> 15;
          }
          
-         // Clamp accumulated sample to prevent int16_t overflow
+         // Clamp to int16_t, then apply the layer gain (exact at unity)
          if (sample > 32767) sample = 32767;
          if (sample < -32768) sample = -32768;
-         int16_t sample_clamped = (int16_t)sample;
-         
-        // Apply effects (mono path - both channels get same processed signal)
-        // Apply saturation first to add harmonics, then lowpass to shape them
-        uint16_t sat_coeff = adc_to_ladder_coefficient(adc_saturation_q12);
-        sample_clamped = s_saturation_effect.process(sample_clamped, sat_coeff);
-        
-        uint16_t lp_coeff = adc_to_ladder_coefficient(adc_lowpass_q12);
-        sample_clamped = s_lowpass_filter.process(sample_clamped, lp_coeff);
-        
-        // Convert final sample to PWM and output to both channels
-        uint16_t pwm = q15_to_pwm_u(sample_clamped);
-        out_buf_ptr_L[n] = pwm;  // Left channel
-        out_buf_ptr_R[n] = pwm;  // Right channel (mono)
+         const int32_t gain = gain_from + (gain_to - gain_from) * (int32_t)(n + 1) / AUDIO_BLOCK_SIZE;
+         mix[n] = (accumulate ? mix[n] : 0) + ((sample * gain) >> 15);
+    }
+    L.gain_q15 = gain_to;
+
+    if (g_prefetch[primary_voice->window].missed || g_prefetch[secondary_voice->window].missed) {
+        PROF_EVENT(PROF_EV_PREFETCH_MISS);
+    }
+    prefetch_voice(L, primary_voice, advance, !L.crossfading);
+    if (L.crossfading) prefetch_voice(L, secondary_voice, advance, true);
+}
+ 
+// ── Stretch Mode ─────────────────────────────────────────────────────────────
+// The loop position advances by time_inc per sample (the tune knob's LFO
+// range at octave 0, otherwise unity in the playback direction) while the
+// grains read at the block's increments, so pitch no longer sets the loop
+// duration. The window follows the knobs every block: no loop crossfades,
+// the grains smooth a change. grain_len is a whole number of blocks.
+//
+// Each grain runs over the whole block before the next one starts, so its
+// state stays in registers; the first grain stores into acc[] and the rest
+// add. Four grains overlap at a hop of a quarter length, where the Hann
+// windows sum to 2: the sum is halved
+static void __not_in_flash_func(render_layer_grains)(Layer& L,
+                                                     const int64_t* inc,
+                                                     int64_t time_inc,
+                                                     uint32_t grain_len,
+                                                     bool is_reverse,
+                                                     int32_t gain_from,
+                                                     int32_t gain_to,
+                                                     int32_t* mix,
+                                                     bool accumulate)
+{
+    Voice* v = &L.voice[L.primary];
+    const bool cold = (v->loop_end == 0);
+    calculate_boundaries(L);
+    const uint32_t loop_start = v->loop_start = L.pending_start;
+    const uint32_t loop_end = v->loop_end = L.pending_end;
+    L.boundaries_calculated = true;
+
+    // Cold start or reset trigger: back to the loop start (end, in reverse)
+    if (cold || L.reset_pending) {
+        L.time_q32_32 = (uint64_t)(is_reverse ? loop_end - 1 : loop_start) << 32;
+        if (L.reset_pending) {
+            L.reset_pending = false;
+            audio_engine_loop_led_blink();
+            PROF_EVENT(PROF_EV_RESET);
+        }
+    }
+    L.time_q32_32 = wrap_in_loop(L.time_q32_32, loop_start, loop_end);
+
+    // Start a grain at the loop position once per hop, in a free slot (the
+    // one nearest its end if a shorter length has left none free)
+    if (L.grain_countdown <= 0) {
+        Grain* g = &L.grains[0];
+        for (uint32_t k = 1; k < MAX_GRAINS && g->remaining; ++k) {
+            if (L.grains[k].remaining < g->remaining) g = &L.grains[k];
+        }
+        g->phase_q32_32 = L.time_q32_32;
+        g->window_q32 = 0;
+        g->window_step_q32 = 0xFFFFFFFFu / grain_len;   // 2^32 / length, 32-bit divide
+        g->remaining = grain_len;
+        L.grain_countdown += (int32_t)(grain_len / MAX_GRAINS);
+        if (L.grain_countdown <= 0) L.grain_countdown = (int32_t)(grain_len / MAX_GRAINS);
+    }
+
+    const int16_t* samples = L.samples;
+    int32_t acc[AUDIO_BLOCK_SIZE];
+    bool stored = false;
+    for (uint32_t k = 0; k < MAX_GRAINS; ++k) {
+        Grain& g = L.grains[k];
+        if (!g.remaining) continue;
+        uint64_t phase = wrap_in_loop(g.phase_q32_32, loop_start, loop_end);   // The window may have moved
+        uint32_t window = g.window_q32;
+        const uint32_t step = g.window_step_q32;
+        for (uint32_t n = 0; n < AUDIO_BLOCK_SIZE; ++n) {
+            const uint32_t i = (uint32_t)(phase >> 32);
+            const uint32_t i2 = (inc[n] < 0) ? ((i > loop_start) ? (i - 1) : (loop_end - 1))
+                                             : ((i < loop_end - 1) ? (i + 1) : loop_start);
+            const int32_t s = interpolate_s16(samples[i], samples[i2], (uint32_t)phase);
+            const int32_t y = (s * hann_q15(window)) >> 15;
+            acc[n] = stored ? acc[n] + y : y;
+            window += step;
+            phase = wrap_in_loop(phase + (uint64_t)inc[n], loop_start, loop_end);
+        }
+        stored = true;
+        g.phase_q32_32 = phase;
+        g.window_q32 = window;
+        g.remaining -= AUDIO_BLOCK_SIZE;
+    }
+
+    for (uint32_t n = 0; n < AUDIO_BLOCK_SIZE; ++n) {
+        int32_t sample = stored ? (acc[n] >> 1) : 0;
+        if (sample > 32767) sample = 32767;
+        if (sample < -32768) sample = -32768;
+        const int32_t gain = gain_from + (gain_to - gain_from) * (int32_t)(n + 1) / AUDIO_BLOCK_SIZE;
+        mix[n] = (accumulate ? mix[n] : 0) + ((sample * gain) >> 15);
+    }
+    L.gain_q15 = gain_to;
+
+    // Advance the loop position by the block; blink on a wrap
+    L.grain_countdown -= AUDIO_BLOCK_SIZE;
+    const uint64_t advanced = L.time_q32_32 + (uint64_t)(time_inc * AUDIO_BLOCK_SIZE);
+    L.time_q32_32 = wrap_in_loop(advanced, loop_start, loop_end);
+    if (L.time_q32_32 != advanced) audio_engine_loop_led_blink();
+    v->phase_q32_32 = L.time_q32_32;       // Playhead for the display
+}
+
+// Stretch mode on: grains start from where each layer's voice was.
+// Off: the voice carries on from the stretch position, its loop
+// recalculated and crossfades starting afresh
+static void __not_in_flash_func(switch_stretch)(bool on) {
+    for (int l = 0; l < AE_LAYERS; ++l) {
+        Layer& L = s_layers[l];
+        Voice& primary = L.voice[L.primary];
+        Voice& secondary = L.voice[L.primary ^ 1u];
+        if (on) {
+            L.time_q32_32 = primary.phase_q32_32;
+            for (uint32_t k = 0; k < MAX_GRAINS; ++k) L.grains[k].remaining = 0;
+            L.grain_countdown = 0;
+        } else {
+            primary.phase_q32_32 = L.time_q32_32;
+            primary.amplitude_q15 = 32768;
+            primary.active = true;
+            secondary.active = false;
+            secondary.amplitude_q15 = 0;
+            L.crossfading = false;
+            L.was_in_zone_last_sample = false;
+        }
+        L.boundaries_calculated = false;
+    }
+    s_stretch = on;
+}
+ 
+// ── Effects Stage ────────────────────────────────────────────────────────────
+// Saturation first to add harmonics, then the lowpass to shape them, then
+// PWM on both channels (mono path). raw is the block's clamped layer mix
+static void __not_in_flash_func(render_effects)(const int16_t* raw,
+                                                volatile uint16_t* out_L, volatile uint16_t* out_R,
+                                                uint16_t sat_coeff, uint16_t lp_coeff) {
+    for (uint32_t n = 0; n < AUDIO_BLOCK_SIZE; ++n) {
+        int16_t sample = s_saturation_effect.process(raw[n], sat_coeff);
+        sample = s_lowpass_filter.process(sample, lp_coeff);
+        const uint16_t pwm = q15_to_pwm_u(sample);
+        out_L[n] = pwm;  // Left channel
+        out_R[n] = pwm;  // Right channel (mono)
+    }
+}
+
+static void __not_in_flash_func(fill_silence)(volatile uint16_t* out_L, volatile uint16_t* out_R) {
+    const uint16_t silence_pwm = PWM_RESOLUTION / 2;  // Center PWM value
+    for (uint32_t i = 0; i < AUDIO_BLOCK_SIZE; ++i) {
+        out_L[i] = silence_pwm;
+        out_R[i] = silence_pwm;
+    }
+}
+
+// Linear ramp over a PWM block, toward (fade_in false) or up from (fade_in
+// true) the midpoint
+static void __not_in_flash_func(ramp_pwm)(volatile uint16_t* out_L, volatile uint16_t* out_R, bool fade_in) {
+    const int32_t mid = PWM_RESOLUTION / 2;
+    for (int n = 0; n < AUDIO_BLOCK_SIZE; ++n) {
+        const int32_t g = fade_in ? n : (AUDIO_BLOCK_SIZE - 1 - n);
+        out_L[n] = (uint16_t)(mid + ((int32_t)out_L[n] - mid) * g / AUDIO_BLOCK_SIZE);
+        out_R[n] = (uint16_t)(mid + ((int32_t)out_R[n] - mid) * g / AUDIO_BLOCK_SIZE);
+    }
+}
+
+#ifdef AUDIO_FX_CORE1
+// ── Effects on Core 1 ────────────────────────────────────────────────────────
+// Core 0 renders block k's clamped mix into a job; at the start of block
+// k+1 it hands the job to core 1 with the PWM half the DMA has just
+// finished, the one block k+1 would have filled, and rings core 1's
+// doorbell. Core 1's doorbell IRQ runs the effects into that half while
+// core 0 renders the next mix. Core 1 has the deadline core 0 had (the DMA
+// coming back round to the half), a whole block period for 16 samples of
+// effects; its drawing runs at thread level under the IRQ. The SIO FIFO
+// would be the obvious mailbox, but arduino-pico's multicore support takes
+// it (idleOtherCore), so the job pointer goes through s_fx_handoff and the
+// doorbell only signals. The job state is in main SRAM, which both cores
+// reach at the same cost
+struct FxJob {
+    int16_t raw[AUDIO_BLOCK_SIZE];   // Clamped layer mix
+    volatile uint16_t* out_L;        // PWM half to fill
+    volatile uint16_t* out_R;
+    uint16_t sat_coeff;              // The block's knob settings
+    uint16_t lp_coeff;
+    int8_t ramp;                     // Rebind: +1 up from silence, -1 down to it, 0 none
+    bool silent;                     // Engine stopped: midpoint, the filters left alone
+    bool core1;                      // Goes to core 1; false while core 0 runs the effects
+};
+static FxJob s_fx_jobs[2];
+static uint8_t __scratch_y("lung_render") s_fx_render = 0;   // Job this block renders
+static FxJob* volatile s_fx_handoff = nullptr;                // Job core 1 is running
+static FxJob* volatile s_fx_done = nullptr;                   // Job core 1 last finished
+static volatile int s_fx_bell = -1;                           // Set once core 1 is listening
+
+static void __not_in_flash_func(fx_core1_irq)(void) {
+    const int bell = s_fx_bell;
+    if (bell < 0 || !multicore_doorbell_is_set_current_core((uint)bell)) return;
+    multicore_doorbell_clear_current_core((uint)bell);
+    __dmb();                                  // Job written before the doorbell rang
+    FxJob* job = s_fx_handoff;
+    if (job->silent) {
+        fill_silence(job->out_L, job->out_R);
+    } else {
+        render_effects(job->raw, job->out_L, job->out_R, job->sat_coeff, job->lp_coeff);
+    }
+    if (job->ramp) ramp_pwm(job->out_L, job->out_R, job->ramp > 0);
+    __dmb();
+    s_fx_done = job;
+}
+
+void ae_render_fx_core1_init(void) {
+    const int bell = multicore_doorbell_claim_unused(0x3u, false);   // Rung on core 0, taken on core 1
+    if (bell < 0) return;                                            // Core 0 keeps the effects
+    multicore_doorbell_clear_current_core((uint)bell);
+    irq_add_shared_handler(SIO_IRQ_BELL, fx_core1_irq, PICO_SHARED_IRQ_HANDLER_DEFAULT_ORDER_PRIORITY);
+    irq_set_priority(SIO_IRQ_BELL, PICO_HIGHEST_IRQ_PRIORITY);
+    irq_set_enabled(SIO_IRQ_BELL, true);
+    __dmb();
+    s_fx_bell = bell;
+}
+
+// Start of a block: last block's job goes to core 1 for the PWM half that
+// just played, and this block's job is the other one
+static FxJob& __not_in_flash_func(fx_begin_block)(void) {
+    FxJob& last = s_fx_jobs[s_fx_render];
+    const int bell = s_fx_bell;
+    if (last.core1) {
+        if (s_fx_handoff && s_fx_done != s_fx_handoff) PROF_EVENT(PROF_EV_FX_LATE);
+        last.out_L = out_buf_ptr_L;
+        last.out_R = out_buf_ptr_R;
+        s_fx_handoff = &last;
+        __dmb();
+        multicore_doorbell_set_other_core((uint)bell);
+    } else if (bell >= 0) {
+        fill_silence(out_buf_ptr_L, out_buf_ptr_R);   // Core 1 just took over: one empty block
+    }
+    s_fx_render ^= 1u;
+    FxJob& job = s_fx_jobs[s_fx_render];
+    job.ramp = 0;
+    job.silent = false;
+    job.core1 = bell >= 0;
+    return job;
+}
+#else
+void ae_render_fx_core1_init(void) {}
+#endif
+
+void __not_in_flash_func(ae_render_ramp)(bool fade_in) {
+#ifdef AUDIO_FX_CORE1
+    FxJob& job = s_fx_jobs[s_fx_render];
+    if (job.core1) {
+        job.ramp = fade_in ? 1 : -1;          // Core 1 ramps it after the effects
+        return;
+    }
+#endif
+    ramp_pwm(out_buf_ptr_L, out_buf_ptr_R, fade_in);
+}
+ 
+// ── Main Render Function ─────────────────────────────────────────────────────
+// Processes one audio block (AUDIO_BLOCK_SIZE samples): both layers into a
+// mix buffer, then the effects. The profiler sections split the block into
+// layer 0 (with the shared increments), layer 1, and effects (audio_tick)
+
+void __not_in_flash_func(ae_render_block)(ae_state_t engine_state, uint64_t* io_phase_q32_32)
+{
+    Layer& layer0 = s_layers[0];
+    Layer& layer1 = s_layers[1];
+    prefetch_begin_block();     // Last block's window copies become readable
+#ifdef AUDIO_FX_CORE1
+    FxJob& job = fx_begin_block();
+#endif
+
+    // Early exit for silence - output center PWM value (no audio)
+    if (engine_state != AE_STATE_PLAYING || !layer0.samples || layer0.total_samples < 2) {
+#ifdef AUDIO_FX_CORE1
+        job.silent = true;
+        if (!job.core1) fill_silence(out_buf_ptr_L, out_buf_ptr_R);
+#else
+        fill_silence(out_buf_ptr_L, out_buf_ptr_R);
+#endif
+        if (s_stretch_switching || s_stretch != s_stretch_request) {
+            switch_stretch(s_stretch_request);     // Nothing to fade
+            s_stretch_switching = false;
+        }
+        PROF_SECTION(PROF_SEC_RENDER);
+        PROF_SECTION(PROF_SEC_LAYER);
+        return;
+    }
+    const bool layered = layer1.samples && layer1.total_samples >= 2;
+
+    // Stretch mode change: this block fades out in the old mode, the next
+    // fades in in the new one
+    bool mode_fade_out = false, mode_fade_in = false;
+    if (s_stretch_switching) {
+        switch_stretch(!s_stretch);
+        s_stretch_switching = false;
+        mode_fade_in = true;
+    } else if (s_stretch != s_stretch_request) {
+        s_stretch_switching = mode_fade_out = true;
     }
     
+    // ── Read Control Inputs ──────────────────────────────────────────────────
+    // All ADC inputs are filtered except FM (needs fast response for TZFM),
+    // which takes the block's decimated value: no smoothing, no aliasing.
+    // The filter bank flags the channels that moved past its deadband, and
+    // only what depends on those is recomputed below
+    BlockControls& ctl = s_controls;
+    uint32_t changed = adc_filter_take_changed();
+    if (!ctl.primed) {
+        changed = ~0u;
+        ctl.primed = true;
+    }
+    const uint16_t adc_start_q12 = adc_filter_get(ADC_LOOP_START_CH);    // Loop start position
+    const uint16_t adc_len_q12 = adc_filter_get(ADC_LOOP_LEN_CH);        // Loop length
+    const uint16_t adc_xfade_q12 = adc_filter_get(ADC_XFADE_LEN_CH);     // Crossfade length
+    const uint16_t adc_tune_q12 = adc_filter_get(ADC_TUNE_CH);           // Fine tuning
+    const uint16_t adc_tzfm_depth_q12 = adc_filter_get(ADC_TZFM_DEPTH_CH); // FM depth
+    const uint16_t adc_lowpass_q12 = adc_filter_get(ADC_FX1_CH);         // Lowpass filter
+    const uint16_t adc_saturation_q12 = adc_filter_get(ADC_FX2_CH);      // Saturation effect
+    const uint16_t adc_fm_raw = adc_filter_get_block(ADC_PM_CH);  // Unfiltered for TZFM
+
+    // ── Layer Balance ────────────────────────────────────────────────────────
+    // Constant-power gains from the UI balance (same quarter-sine table as the
+    // loop crossfades); a lone layer 0 stays at unity. The knobs edit the
+    // louder layer's window, the other layer keeps the one it had
+    const uint32_t mix_q15 = layered ? s_layer_mix_q15 : 0u;
+    int32_t gain0_q15 = 32768, gain1_q15 = 0;
+    if (layered) {
+        const uint32_t idx = mix_q15 >> 7;            // 0..255
+        const uint32_t w8 = (mix_q15 & 0x7Fu) << 1;   // 0..254
+        gain0_q15 = quarter_sine_q15(255u - idx, 256u - w8);
+        gain1_q15 = quarter_sine_q15(idx, w8);
+    }
+    const uint8_t focus_index = (mix_q15 >= 16384u) ? 1u : 0u;
+    if (adc_moved(changed, ADC_LOOP_START_CH) || adc_moved(changed, ADC_LOOP_LEN_CH) || focus_index != ctl.focus) {
+        Layer& focus = s_layers[focus_index];
+        focus.start_q12 = adc_start_q12;
+        focus.len_q12 = adc_len_q12;
+        focus.window_changed = true;
+        ctl.focus = focus_index;
+    }
+
+    // A reset trigger restarts both layers' loops
+    if (g_reset_trigger_pending) {
+        g_reset_trigger_pending = false;
+        layer0.reset_pending = true;
+        layer1.reset_pending = layered;
+    }
+     
+    // ── Calculate Pitch Once ─────────────────────────────────────────────────
+    // Convert ADC values to playback speed ratio (1.0 = normal speed)
+    const uint8_t octave_pos = sf::ui_get_octave_position();
+    const bool pitch_changed = adc_moved(changed, ADC_TUNE_CH) || octave_pos != ctl.octave_pos;
+    if (pitch_changed) {
+        ctl.octave_pos = octave_pos;
+        float t_norm = ((float)adc_tune_q12 - 2048.0f) / 2048.0f;  // Convert to -1..+1
+        t_norm = fmaxf(-1.0f, fminf(1.0f, t_norm));  // Clamp to valid range
+
+        if (octave_pos == 0) {
+            // LFO mode: very slow playback for modulation effects
+            const float lfo_min = 0.001f;  // Minimum LFO speed
+            const float lfo_max = 1.0f;    // Maximum LFO speed
+            base_ratio = lfo_min + (1.0f - t_norm) * 0.5f * (lfo_max - lfo_min);
+        } else {
+            // Octave mode: musical intervals (0.5x, 1x, 2x, 4x, etc.)
+            const int octave_shift = (int)octave_pos - 4;  // Center position = 1x speed
+            const float octave_ratio = (octave_shift >= 0)  // 2^octave_shift, exact
+                ? (float)(1u << octave_shift)
+                : 1.0f / (float)(1u << -octave_shift);
+            const float tune_ratio = tune_ratio_from_adc(adc_tune_q12);  // Fine tuning: ±50 cents
+            base_ratio = octave_ratio * tune_ratio;
+        }
+    }
+     
+    // TZFM depth in Q15 (0 = no modulation, 32768 = full depth)
+    if (adc_moved(changed, ADC_TZFM_DEPTH_CH)) {
+        ctl.tzfm_depth_q15 = (int32_t)(((uint32_t)adc_tzfm_depth_q12 * 32768u) / 4095u);
+    }
+    const int32_t tzfm_depth_q15 = ctl.tzfm_depth_q15;
+    const bool tzfm_active = tzfm_depth_q15 > TZFM_DEPTH_MIN_Q15;
+    
+    // FM input as bipolar Q15 (-1 to +1) from the 12-bit ADC. The DMA ring
+    // holds one conversion per channel, so it is constant across the block;
+    // only the smoother moves per sample
+    const int32_t fm_target_q15 = ((int32_t)adc_fm_raw - 2048) << 4;
+    
+    // Get playback direction from UI state
+    const ae_mode_t mode = audio_engine_get_mode();
+    const bool is_reverse = (mode == AE_MODE_REVERSE);
+    
+    // Unmodulated increment, constant for the block
+    if (pitch_changed || is_reverse != ctl.is_reverse) {
+        ctl.base_inc = calculate_base_increment(is_reverse);
+        ctl.is_reverse = is_reverse;
+    }
+    const int64_t base_inc = ctl.base_inc;
+
+    // Stretch mode splits pitch from time: the grains take the pitch and
+    // the loop position moves at unity, except at octave 0, where the tune
+    // knob's LFO range sets the loop speed and grains play at unity
+    const int64_t unity_inc = is_reverse ? -(1LL << 32) : (1LL << 32);
+    const bool stretch_lfo = s_stretch && octave_pos == 0;
+    const int64_t read_inc = stretch_lfo ? unity_inc : base_inc;
+    const int64_t time_inc = stretch_lfo ? base_inc : unity_inc;
+
+    // Per-sample increments with TZFM modulation, once for both layers
+    int64_t inc[AUDIO_BLOCK_SIZE];
+    int64_t advance = 0;
+    for (uint32_t n = 0; n < AUDIO_BLOCK_SIZE; ++n) {
+        inc[n] = tzfm_active ? calculate_increment(read_inc, fm_target_q15, tzfm_depth_q15) : read_inc;
+        advance += inc[n];
+    }
+
+    // Grain length from the crossfade knob (its job in stretch mode):
+    // 512..8192 samples, a multiple of four blocks so the hop is whole blocks
+    if (adc_moved(changed, ADC_XFADE_LEN_CH)) {
+        ctl.grain_len = (512u + scale_by_adc_q12(adc_xfade_q12, 8192u - 512u))
+                        & ~(uint32_t)(MAX_GRAINS * AUDIO_BLOCK_SIZE - 1u);
+    }
+    const uint32_t grain_len = ctl.grain_len;
+
+    // Loop crossfade lengths follow the crossfade knob and the pitch
+    const bool xfade_stale = adc_moved(changed, ADC_XFADE_LEN_CH) || pitch_changed;
+    
+    // ── Render Layers ────────────────────────────────────────────────────────
+    int32_t mix[AUDIO_BLOCK_SIZE];
+
+    // Sync phase from layer 0's primary voice (in case it was updated externally)
+    layer0.voice[layer0.primary].phase_q32_32 = *io_phase_q32_32;
+    if (s_stretch) {
+        render_layer_grains(layer0, inc, time_inc, grain_len, is_reverse, layer0.gain_q15, gain0_q15, mix, false);
+    } else {
+        render_layer(layer0, inc, advance, adc_xfade_q12, xfade_stale, is_reverse, layer0.gain_q15, gain0_q15, mix, false);
+    }
+    PROF_SECTION(PROF_SEC_RENDER);
+
+    if (layered && s_stretch) {
+        render_layer_grains(layer1, inc, time_inc, grain_len, is_reverse, layer1.gain_q15, gain1_q15, mix, true);
+    } else if (layered) {
+        render_layer(layer1, inc, advance, adc_xfade_q12, xfade_stale, is_reverse, layer1.gain_q15, gain1_q15, mix, true);
+    } else {
+        layer1.gain_q15 = 0;    // A layer bound later fades in from silence
+    }
+    prefetch_kick();            // Next block's windows fill while the effects run
+    PROF_SECTION(PROF_SEC_LAYER);
+
+    // ── Effects and Output ───────────────────────────────────────────────────
+    // Clamp the layer sum to prevent int16_t overflow, then the effects
+    // (mono path - both channels get same processed signal), here or on core 1
+    if (adc_moved(changed, ADC_FX2_CH)) ctl.sat_coeff = adc_to_ladder_coefficient(adc_saturation_q12);
+    if (adc_moved(changed, ADC_FX1_CH)) ctl.lp_coeff = adc_to_ladder_coefficient(adc_lowpass_q12);
+    const uint16_t sat_coeff = ctl.sat_coeff;
+    const uint16_t lp_coeff = ctl.lp_coeff;
+#ifdef AUDIO_FX_CORE1
+    int16_t* raw = job.raw;
+#else
+    int16_t raw[AUDIO_BLOCK_SIZE];
+#endif
+    for (uint32_t n = 0; n < AUDIO_BLOCK_SIZE; ++n) {
+        int32_t sample = mix[n];
+        if (mode_fade_out) sample = sample * (int32_t)(AUDIO_BLOCK_SIZE - 1 - n) / AUDIO_BLOCK_SIZE;
+        if (mode_fade_in) sample = sample * (int32_t)n / AUDIO_BLOCK_SIZE;
+        if (sample > 32767) sample = 32767;
+        if (sample < -32768) sample = -32768;
+        raw[n] = (int16_t)sample;
+    }
+#ifdef AUDIO_FX_CORE1
+    job.sat_coeff = sat_coeff;
+    job.lp_coeff = lp_coeff;
+    if (!job.core1) render_effects(raw, out_buf_ptr_L, out_buf_ptr_R, sat_coeff, lp_coeff);
+#else
+    render_effects(raw, out_buf_ptr_L, out_buf_ptr_R, sat_coeff, lp_coeff);
+#endif
+    
     // Update global phase for external access (UI, etc.)
+    const Voice* primary_voice = &layer0.voice[layer0.primary];
+    const Voice* secondary_voice = &layer0.voice[layer0.primary ^ 1u];
     *io_phase_q32_32 = primary_voice->phase_q32_32;
     
     // ── Update Display State ─────────────────────────────────────────────────
-    // Prepare visualization data for the UI display
+    // Prepare visualization data for the UI display (layer 0, the sample
+    // the waveform view shows)
+    const uint32_t total_samples = layer0.total_samples;
     uint32_t vis_primary = (uint32_t)(primary_voice->phase_q32_32 >> 32);
     uint32_t vis_secondary = 0;
     uint8_t vis_xfading = 0;
     
-    if (crossfading) {
+    if (layer0.crossfading) {
         vis_xfading = 1;  // Show crossfade indicator
         vis_secondary = (uint32_t)(secondary_voice->phase_q32_32 >> 32);
     }
     
     // Convert loop boundaries to 12-bit values for display scaling
-    const uint16_t start_q12 = (uint16_t)(((uint64_t)primary_voice->loop_start * 4095u) / total_samples);
-    const uint16_t len_q12 = (uint16_t)(((uint64_t)(primary_voice->loop_end - primary_voice->loop_start) * 4095u) / total_samples);
+    // (float: display precision is plenty and avoids a 64-bit divide)
+    const float to_q12 = 4095.0f / (float)total_samples;
+    const uint16_t start_q12 = (uint16_t)((float)primary_voice->loop_start * to_q12);
+    const uint16_t len_q12 = (uint16_t)((float)(primary_voice->loop_end - primary_voice->loop_start) * to_q12);
      
      publish_display_state2(start_q12, len_q12, vis_primary, total_samples, vis_xfading, vis_secondary);
- }
\ No newline at end of file
+ }
@@ -0,0 +1,103 @@
+#include "audio_profiler.h"
+
+#ifdef AUDIO_PROFILE
+
+#include <string.h>
+
+// ───────────────────────── IRQ-side state ─────────────────────────────────
+ProfAccum         g_prof;
+uint32_t          g_prof_block_start = 0;
+uint32_t          g_prof_mark        = 0;
+uint32_t          g_prof_budget      = 0;
+uint32_t          g_prof_period      = 1;
+uint32_t          g_prof_bin_scale   = 0;
+volatile uint8_t  g_prof_request     = 0;
+volatile uint8_t  g_prof_ready       = 0;
+
+static ProfAccum  s_report;                    // Handed over by the IRQ
+
+static void accum_reset(ProfAccum& a) {
+  memset(&a, 0, sizeof(a));
+  for (int i = 0; i < PROF_SEC_COUNT; ++i) a.sections[i].min = 0xFFFFFFFFu;
+  a.block.min = 0xFFFFFFFFu;
+  a.slack_min = INT32_MAX;
+  a.output_slack_min = INT32_MAX;
+}
+
+// End of a block, with a request pending: copy out and start afresh
+void __not_in_flash_func(prof_handover)(void) {
+  s_report = g_prof;
+  accum_reset(g_prof);
+  __dmb();
+  g_prof_ready   = 1;
+  g_prof_request = 0;
+}
+
+void prof_init(uint32_t period_cycles, uint32_t ring_blocks) {
+  // Processor clock, no interrupt; keep an existing tick's configuration
+  if (!(systick_hw->csr & 1u)) {
+    systick_hw->rvr = 0x00FFFFFFu;
+    systick_hw->cvr = 0;
+    systick_hw->csr = 0x5u;                    // ENABLE | CLKSOURCE (CPU)
+  }
+  g_prof_period = period_cycles ? period_cycles : 1u;
+  const uint64_t scale = ((uint64_t)PROF_HIST_BINS << 32) / g_prof_period;
+  g_prof_bin_scale = scale > 0xFFFFFFFFu ? 0xFFFFFFFFu : (uint32_t)scale;
+  g_prof_budget = period_cycles * (ring_blocks > 1 ? ring_blocks - 1u : 1u);
+  accum_reset(g_prof);
+  g_prof_ready = g_prof_request = 0;
+}
+
+// ───────────────────────── Reader (other core) ────────────────────────────
+static void put_u8(uint8_t* buf, uint32_t& n, uint8_t v) { buf[n++] = v; }
+static void put_u16(uint8_t* buf, uint32_t& n, uint16_t v) {
+  buf[n++] = (uint8_t)v;
+  buf[n++] = (uint8_t)(v >> 8);
+}
+static void put_u32(uint8_t* buf, uint32_t& n, uint32_t v) {
+  put_u16(buf, n, (uint16_t)v);
+  put_u16(buf, n, (uint16_t)(v >> 16));
+}
+// Mean per block; a section never reached reports zeros
+static void put_stat(uint8_t* buf, uint32_t& n, const ProfStat& s, uint32_t count) {
+  put_u32(buf, n, s.min == 0xFFFFFFFFu ? 0u : s.min);
+  put_u32(buf, n, count ? (uint32_t)(s.sum / count) : 0u);
+  put_u32(buf, n, s.max);
+}
+
+void prof_stream(Print& out) {
+  if (!g_prof_ready) {
+    g_prof_request = 1;
+    return;
+  }
+  __dmb();
+  const ProfAccum& r = s_report;
+
+  uint8_t frame[4 + 12 + 12 * (PROF_SEC_COUNT + 1) + 8 + 2
+                + 2 * PROF_EV_COUNT + 2 * PROF_HIST_BINS + 1];
+  uint32_t n = 4;                              // Header filled in below
+  put_u32(frame, n, r.blocks);
+  put_u32(frame, n, g_prof_period);
+  put_u32(frame, n, g_prof_budget);
+  for (int i = 0; i < PROF_SEC_COUNT; ++i) put_stat(frame, n, r.sections[i], r.blocks);
+  put_stat(frame, n, r.block, r.blocks);
+  put_u32(frame, n, (uint32_t)(r.blocks ? r.slack_min : 0));
+  put_u32(frame, n, (uint32_t)(r.output_slack_min == INT32_MAX ? 0 : r.output_slack_min));
+  put_u16(frame, n, r.overruns);
+  for (int i = 0; i < PROF_EV_COUNT; ++i)   put_u16(frame, n, r.events[i]);
+  for (int i = 0; i < PROF_HIST_BINS; ++i)  put_u16(frame, n, r.histogram[i]);
+
+  uint8_t sum = 0;
+  for (uint32_t i = 4; i < n; ++i) sum += frame[i];
+  const uint32_t payload = n - 4;
+  put_u8(frame, n, sum);
+  frame[0] = 'A';
+  frame[1] = 'P';
+  frame[2] = PROF_FRAME_VERSION;
+  frame[3] = (uint8_t)payload;
+
+  g_prof_ready = 0;                            // The IRQ may hand over again
+  out.write(frame, n);
+}
+
+#endif // AUDIO_PROFILE
@@ -0,0 +1,77 @@
+#!/bin/sh
+# Check that the lung audio path runs without touching flash.
+#
+# Walks the call graph of the built ELF from the DMA completion handler and
+# audio_tick() and reports, for every function reached:
+#
+#   FLASH    the function itself is in flash (XIP, 0x10000000-0x10ffffff)
+#   VENEER   a long-branch veneer, usually a RAM function calling into flash
+#   LITERAL  a literal-pool word pointing into flash (const data read from XIP)
+#
+# Calls through function pointers are not followed. Exits non-zero when
+# anything is reported, so it can gate a release build.
+#
+# Usage: lung/check_audio_ram.sh loop-sampler.ino.elf [extra root ...]
+#        (a build with AUDIO_FX_CORE1 adds core 1's effects IRQ, fx_core1_irq)
+#        (OBJDUMP overrides arm-none-eabi-objdump)
+set -e
+
+ELF="$1"
+if [ -z "$ELF" ] || [ ! -f "$ELF" ]; then
+    echo "usage: $0 firmware.elf [extra root ...]" >&2
+    exit 2
+fi
+shift
+ROOTS="PWM_DMATransCpltCallbackL audio_tick $*"
+OBJDUMP="${OBJDUMP:-arm-none-eabi-objdump}"
+
+"$OBJDUMP" -d --no-show-raw-insn -C "$ELF" | awk -v roots="$ROOTS" '
+function in_flash(hex,   v) {
+    v = tolower(hex)
+    sub(/^0x/, "", v)
+    # 8 hex digits starting 10: flash (PSRAM at 0x11000000 is left alone)
+    return length(v) == 8 && substr(v, 1, 2) == "10"
+}
+# Function header: "20000180 <audio_tick>:"
+/^[0-9a-f]+ <.*>:$/ {
+    fn = $0
+    sub(/^[0-9a-f]+ </, "", fn)
+    sub(/>:$/, "", fn)
+    addr[fn] = $1
+    next
+}
+fn != "" && /\t(bl|blx|b|b\.w|b\.n)\t[0-9a-f]+ <[^+>]+>/ {
+    target = $0
+    sub(/.*</, "", target)
+    sub(/>.*/, "", target)
+    if (target != fn) calls[fn] = calls[fn] SUBSEP target
+    next
+}
+fn != "" && /\.word\t0x[0-9a-f]+/ {
+    word = $0
+    sub(/.*\.word\t/, "", word)
+    sub(/[ \t].*/, "", word)
+    if (in_flash(word)) literals[fn] = literals[fn] " " word
+}
+END {
+    n = split(roots, queue, " ")
+    for (i = 1; i <= n; i++) seen[queue[i]] = 1
+    problems = 0
+    for (i = 1; i <= n; i++) {
+        f = queue[i]
+        if (!(f in addr)) {
+            print "MISSING  " f " (not in the ELF; inlined or renamed?)"
+            continue
+        }
+        if (in_flash(addr[f])) { print "FLASH    " f " @ " addr[f]; problems++ }
+        if (f ~ /veneer/)      { print "VENEER   " f " @ " addr[f]; problems++ }
+        if (literals[f] != "") { print "LITERAL  " f ":" literals[f]; problems++ }
+        m = split(calls[f], callees, SUBSEP)
+        for (j = 1; j <= m; j++) {
+            c = callees[j]
+            if (c != "" && !(c in seen)) { seen[c] = 1; queue[++n] = c }
+        }
+    }
+    printf "%d functions reached from the audio path, %d problems\n", n, problems
+    exit problems != 0
+}'
@@ -6,10 +6,20 @@
 #define ENC_BTN_PIN 19
 
 // ─────────────────────── SD Card ───────────────────────
+// Optional 4-bit SDIO through PIO (define SD_USE_SDIO, e.g. in build_opt.h).
+// CLK and CMD stay on the SPI SCK/MOSI pins and DAT0 on MISO; DAT1-DAT3
+// must follow DAT0 on consecutive GPIOs (25-27), so the card's DAT1/DAT2
+// pads need wiring and DAT3 (the SPI chip select) moves from 9 to 27. The
+// SPI fallback then selects the card on GPIO27.
+// #define SD_USE_SDIO
+#define SD_SCK_PIN  10  // Clock pin (SDIO CLK)
+#define SD_MOSI_PIN 11  // Master Out Slave In (SDIO CMD)
+#define SD_MISO_PIN 24  // Master In Slave Out (SDIO DAT0)
+#ifdef SD_USE_SDIO
+#define SD_CS_PIN   (SD_MISO_PIN + 3)  // Chip Select = SDIO DAT3
+#else
 #define SD_CS_PIN   9   // Chip Select pin for the SD card
-#define SD_SCK_PIN  10  // Clock pin
-#define SD_MOSI_PIN 11  // Master Out Slave In
-#define SD_MISO_PIN 24  // Master In Slave Out
+#endif
 
 // ─────────────────────── Display ───────────────────────
 #define DISP_DC     2
@@ -13,6 +13,7 @@ namespace sf {
 
 bool initialized = false;
 float cardSizeMB = 0.0f;
+static const char* s_bus_name = "none";
 
 static void log_err(const char* tag) {
   char buf[64];
@@ -22,7 +23,28 @@ static void log_err(const char* tag) {
 }
 
   // ───────────────── Initialization ─────────────────
+#if defined(SD_USE_SDIO) && HAS_SDIO_CLASS
+  // 4-bit SDIO on a PIO state machine (SdFat's RP2040/RP2350 driver)
+  static bool sd_begin_sdio() {
+    static SdioConfig cfg(SD_SCK_PIN, SD_MOSI_PIN, SD_MISO_PIN);
+    if (!sd.begin(cfg)) {
+      sd.end();
+      return false;
+    }
+    s_bus_name = "SDIO 4-bit";
+    return true;
+  }
+#endif
+
   bool sd_begin() {
+#if defined(SD_USE_SDIO) && HAS_SDIO_CLASS
+    // Card not wired for 4-bit, or not answering: fall back to SPI below
+    if (sd_begin_sdio()) {
+      cardSizeMB = sd.card()->sectorCount() / 2048.0;
+      initialized = true;
+      return true;
+    }
+#endif
     // Serial.println("Initializing SD card on SPI1..."); // DISABLED TO PREVENT POPS
     
     // Configure SPI1 pins
@@ -49,6 +71,7 @@ static void log_err(const char* tag) {
     // Get card size
     cardSizeMB = sd.card()->sectorCount() / 2048.0;
     initialized = true;
+    s_bus_name = "SPI";
     
     // Serial.printf("SD card initialized. Size: %.1f MB\n", cardSizeMB); // DISABLED TO PREVENT POPS
     return true;
@@ -61,6 +84,10 @@ float sd_card_size_mb() {
   return (float)(bytes / (1024.0 * 1024.0));
 }
 
+const char* sd_bus_name() {
+  return s_bus_name;
+}
+
 void sd_format_size(uint32_t bytes, char* out, int out_len) {
   const char* unit = "B";
   double v = (double)bytes;
@@ -10,6 +10,8 @@
  * ## Features
  * 
  * **SPI Interface**: Uses SPI communication for fast file access
+ * **Optional SDIO**: With SD_USE_SDIO (config_pins.h) sd_begin() tries a
+ *   4-bit PIO SDIO bus first and falls back to SPI; the file API is the same
  * **SdFat Library**: Leverages the efficient SdFat library for file operations
  * **Capacity Reporting**: Provides storage size information for user feedback
  * **Error Handling**: Robust initialization with proper error reporting
@@ -53,6 +55,13 @@ bool sd_begin();
  */
 float sd_card_size_mb();
 
+/**
+ * @brief Bus the card was brought up on
+ * 
+ * @return "SDIO 4-bit", "SPI", or "none" before a successful sd_begin()
+ */
+const char* sd_bus_name();
+
 /**
  * @brief Format byte count into human-readable string
  * 
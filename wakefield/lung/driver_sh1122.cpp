@@ -2,6 +2,10 @@
 #include <SPI.h>
 #include <U8g2lib.h>
 #include <string.h>
+#include <hardware/dma.h>
+#include <hardware/gpio.h>
+#include <hardware/irq.h>
+#include <hardware/spi.h>
 #include "config_pins.h"
 #include "driver_sh1122.h"
 
@@ -9,6 +13,7 @@
 // Safe starting point; bump to 24–32 MHz if stable on your wiring
 #define SH1122_SPI_DATA_HZ 60000000u
 #endif
+#define SH1122_SPI_CMD_HZ  8000000u   // row/column commands, as u8g2's bus clock
 
 namespace sf {
 
@@ -27,15 +32,123 @@ static bool  s_dirty           = true;
 static bool  s_auto_scroll     = true;
 static uint32_t s_last_scroll  = 0;
 
-// Send a block of display DATA bytes at a high SPI clock
-static inline void sh1122_write_data_burst(const uint8_t* src, size_t n) {
-  // Use the same SPI instance U8g2 bound to (Arduino SPI)
+// ───────────────────── Dirty rows and DMA transfer ─────────────────────
+// Drawing marks, per row, the span of bytes it touched. gray4_send_buffer()
+// trims each span against s_tx_frame (what the panel shows), copies what
+// really changed into it and returns; a DMA channel then streams one row
+// span at a time to the SPI FIFO, and its completion IRQ (DMA_IRQ_2, core 1)
+// sends the next row's address commands and starts the next span. Core 1
+// draws the next frame meanwhile into gray4_buffer. Anything else using the
+// display SPI (u8g2 text screens) waits for the transfer first.
+struct RowJob { uint8_t row, b0, b1; };        // bytes b0..b1 of a row
+
+static uint8_t  s_tx_frame[8192];              // panel contents once the queue drains
+static bool     s_tx_valid = false;            // false after u8g2 drew the panel
+static uint8_t  s_dirty_b0[64];                // per-row dirty byte span, b0 > b1 = clean
+static uint8_t  s_dirty_b1[64];
+static RowJob   s_jobs[64];
+static int      s_job_count = 0;
+static volatile int  s_job_next = 0;
+static volatile bool s_tx_busy  = false;
+static bool     s_txn_open = false;            // SPI transaction held for the queue
+static int      s_dma_chan = -1;
+
+static inline void mark_dirty(int y, int b) {
+  if (b < s_dirty_b0[y]) s_dirty_b0[y] = (uint8_t)b;
+  if (b > s_dirty_b1[y]) s_dirty_b1[y] = (uint8_t)b;
+}
+
+static void mark_all_dirty() {
+  memset(s_dirty_b0, 0, sizeof(s_dirty_b0));
+  memset(s_dirty_b1, 127, sizeof(s_dirty_b1));
+}
+
+static void mark_all_clean() {
+  memset(s_dirty_b0, 255, sizeof(s_dirty_b0));
+  memset(s_dirty_b1, 0, sizeof(s_dirty_b1));
+}
+
+// Row address, column address (in bytes = pixel pairs), then the span as data
+static void start_row_job(const RowJob& j) {
+  const uint8_t cmd[4] = { 0xB0, j.row, (uint8_t)(0x00 | (j.b0 & 0x0F)), (uint8_t)(0x10 | (j.b0 >> 4)) };
+  spi_set_baudrate(spi0, SH1122_SPI_CMD_HZ);
+  gpio_put(DISP_DC, 0);
+  gpio_put(DISP_CS, 0);
+  spi_write_blocking(spi0, cmd, sizeof(cmd));   // returns with the bus idle
+  spi_set_baudrate(spi0, SH1122_SPI_DATA_HZ);
+  gpio_put(DISP_DC, 1);
+  dma_channel_transfer_from_buffer_now(s_dma_chan, s_tx_frame + (uint16_t)j.row * 128u + j.b0,
+                                       (uint32_t)j.b1 - j.b0 + 1u);
+}
+
+// A span has left the DMA: let the FIFO drain, then the next row or done
+static void row_job_done() {
+  while (spi_is_busy(spi0)) tight_loop_contents();
+  while (spi_is_readable(spi0)) (void)spi_get_hw(spi0)->dr;   // DMA only writes
+  spi_get_hw(spi0)->icr = SPI_SSPICR_RORIC_BITS;
+  gpio_put(DISP_CS, 1);
+  const int next = s_job_next + 1;
+  s_job_next = next;
+  if (next < s_job_count) {
+    start_row_job(s_jobs[next]);
+  } else {
+    s_tx_busy = false;
+  }
+}
+
+#if defined(DMA_IRQ_2)
+static void sh1122_dma_irq() {
+  dma_irqn_acknowledge_channel(2, s_dma_chan);
+  row_job_done();
+}
+#endif
+
+// Wait for a queued transfer and give the SPI back (core 1 only)
+static void sh1122_wait_idle() {
+  while (s_tx_busy) tight_loop_contents();
+  if (s_txn_open) {
+    SPI.endTransaction();
+    s_txn_open = false;
+  }
+}
+
+// Queue the dirty spans of src; returns once the first span is on its way
+static void sh1122_queue_dirty(const uint8_t* src) {
+  sh1122_wait_idle();
+
+  int n = 0;
+  for (int y = 0; y < 64; ++y) {
+    int b0 = s_dirty_b0[y], b1 = s_dirty_b1[y];
+    if (b0 > b1) continue;
+    const uint8_t* s = src + y * 128;
+    uint8_t* d = s_tx_frame + y * 128;
+    if (s_tx_valid) {
+      while (b0 <= b1 && s[b0] == d[b0]) ++b0;   // trim bytes the panel already has
+      while (b1 >= b0 && s[b1] == d[b1]) --b1;
+      if (b0 > b1) continue;
+    }
+    memcpy(d + b0, s + b0, (size_t)(b1 - b0 + 1));
+    s_jobs[n++] = RowJob{ (uint8_t)y, (uint8_t)b0, (uint8_t)b1 };
+  }
+  mark_all_clean();
+  s_tx_valid = true;
+  if (n == 0) return;
+
+  // Hold the transaction at the data clock so Arduino's SPI state matches
+  // the hardware when it is released
   SPI.beginTransaction(SPISettings(SH1122_SPI_DATA_HZ, MSBFIRST, SPI_MODE0));
-  digitalWrite(DISP_DC, HIGH);   // data
-  digitalWrite(DISP_CS, LOW);    // select
-  SPI.transfer((void*)src, n);   // push n bytes in one go
-  digitalWrite(DISP_CS, HIGH);   // deselect
-  SPI.endTransaction();
+  s_txn_open = true;
+  s_job_count = n;
+  s_job_next = 0;
+  s_tx_busy = true;
+  start_row_job(s_jobs[0]);
+#if !defined(DMA_IRQ_2)
+  // No spare DMA IRQ (RP2040: DACless owns 0 and 1): run the queue here
+  while (s_tx_busy) {
+    dma_channel_wait_for_finish_blocking(s_dma_chan);
+    row_job_done();
+  }
+#endif
 }
 
 void view_clear_log() {
@@ -77,6 +190,8 @@ void view_redraw_log(U8G2& g) {
     g.drawStr(0, y, s_lines[i]);
   }
 
+  sh1122_wait_idle();
+  s_tx_valid = false;  // the panel no longer shows s_tx_frame
   g.sendBuffer();
   s_dirty = false;
 }
@@ -122,6 +237,8 @@ void view_show_status(const char* title, const char* line2) {
   g.setFont(u8g2_font_6x12_tf);
   if (title) g.drawStr(0, 14, title);
   if (line2) g.drawStr(0, 30, line2);
+  sh1122_wait_idle();
+  s_tx_valid = false;
   g.sendBuffer();
   s_dirty = false; // status renders immediately
 }
@@ -148,33 +265,30 @@ void sh1122_init() {
   u8g2.setFont(u8g2_font_5x7_tf);
   u8g2.clearBuffer();
   u8g2.sendBuffer();
+
+  // Row-span DMA into the SPI TX FIFO; completion is handled on this core
+  s_dma_chan = dma_claim_unused_channel(true);
+  dma_channel_config cfg = dma_channel_get_default_config(s_dma_chan);
+  channel_config_set_transfer_data_size(&cfg, DMA_SIZE_8);
+  channel_config_set_read_increment(&cfg, true);
+  channel_config_set_write_increment(&cfg, false);
+  channel_config_set_dreq(&cfg, spi_get_dreq(spi0, true));
+  dma_channel_configure(s_dma_chan, &cfg, &spi_get_hw(spi0)->dr, s_tx_frame, 0, false);
+#if defined(DMA_IRQ_2)
+  dma_irqn_set_channel_enabled(2, s_dma_chan, true);
+  irq_set_exclusive_handler(DMA_IRQ_2, sh1122_dma_irq);
+  irq_set_enabled(DMA_IRQ_2, true);
+#endif
   
   // Clear grayscale buffer
   gray4_clear(0);
 }
 
-// SH1122 is 256x64, 4-bit (two pixels per byte)
-static inline void sh1122_set_col0(U8G2& u8) {
-  // Column address = 0: lower 4 bits then higher 3 bits
-  u8.sendF("c", 0x00);   // Set Column Address low nibble (0x00..0x0F)
-  u8.sendF("c", 0x10);   // Set Column Address high (0x10..0x17) -> 0
-}
-
-static inline void sh1122_set_row(U8G2& u8, uint8_t row) {
-  // Row Address Set is a double-byte command: 0xB0, <row>
-  u8.sendF("ca", 0xB0, row);
-}
-
+// SH1122 is 256x64, 4-bit (two pixels per byte): 128 column bytes per row
 void sh1122_send_gray4(const uint8_t* buf_256x64_gray4) {
-  U8G2& u8 = sh1122_gfx();
-
-  for (uint8_t y = 0; y < 64; ++y) {
-    sh1122_set_row(u8, y);     // U8g2 command path (cheap)
-    sh1122_set_col0(u8);       // U8g2 command path (cheap)
-
-    const uint8_t* row = buf_256x64_gray4 + (uint16_t)y * 128u;
-    sh1122_write_data_burst(row, 128);  // <-- fast: one burst per row
-  }
+  // Arbitrary buffer: every row is a candidate, trimmed against the panel
+  mark_all_dirty();
+  sh1122_queue_dirty(buf_256x64_gray4);
 }
 
 
@@ -185,6 +299,7 @@ void gray4_clear(uint8_t shade) {
   if (shade > 15) shade = 15;
   uint8_t byte_val = (shade << 4) | shade;  // Both pixels same shade
   memset(gray4_buffer, byte_val, sizeof(gray4_buffer));
+  mark_all_dirty();
 }
 
 void gray4_set_pixel(int16_t x, int16_t y, uint8_t shade) {
@@ -204,6 +319,7 @@ void gray4_set_pixel(int16_t x, int16_t y, uint8_t shade) {
     // Even x - high nibble
     gray4_buffer[byte_idx] = (gray4_buffer[byte_idx] & 0x0F) | (shade << 4);
   }
+  mark_dirty(y, x >> 1);
 }
 
 uint8_t gray4_get_pixel(int16_t x, int16_t y) {
@@ -318,16 +434,17 @@ void gray4_fill_rect(int16_t x, int16_t y, int16_t w, int16_t h, uint8_t shade)
 }
 
 void gray4_send_buffer() {
-  sh1122_send_gray4(gray4_buffer);
+  sh1122_queue_dirty(gray4_buffer);
 }
 
 uint8_t* gray4_get_buffer() {
+  mark_all_dirty();  // the caller may write anywhere
   return gray4_buffer;
 }
 
-void sh1122_set_contrast(uint8_t v) { u8g2.setContrast(v); }
+void sh1122_set_contrast(uint8_t v) { sh1122_wait_idle(); u8g2.setContrast(v); }
 U8G2& sh1122_gfx()                  { return u8g2; }
 void  sh1122_clear_buffer()         { u8g2.clearBuffer(); }
-void  sh1122_send_buffer()          { u8g2.sendBuffer(); }
+void  sh1122_send_buffer()          { sh1122_wait_idle(); s_tx_valid = false; u8g2.sendBuffer(); }
 
 } // namespace sf
\ No newline at end of file
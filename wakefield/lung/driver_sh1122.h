@@ -104,7 +104,8 @@ U8G2& sh1122_gfx();
 void  sh1122_clear_buffer();
 void  sh1122_send_buffer();
 
-// Send raw 4-bit grayscale buffer (128 bytes per row, 64 rows = 8192 bytes)
+// Send raw 4-bit grayscale buffer (128 bytes per row, 64 rows = 8192 bytes).
+// Only bytes that differ from what the panel shows are sent
 void  sh1122_send_gray4(const uint8_t* buf_256x64_gray4);
 
 // === 4-bit Grayscale Drawing API ===
@@ -124,10 +125,13 @@ void gray4_draw_line(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint8_t sha
 void gray4_draw_rect(int16_t x, int16_t y, int16_t w, int16_t h, uint8_t shade);
 void gray4_fill_rect(int16_t x, int16_t y, int16_t w, int16_t h, uint8_t shade);
 
-// Send grayscale buffer to sh1122
+// Send grayscale buffer to sh1122: the rows touched since the last send, each
+// trimmed to the bytes that changed. Returns once the transfer is queued; it
+// completes by DMA in the background (RP2350), so drawing can continue
 void gray4_send_buffer();
 
-// Direct access to grayscale buffer (256x64 pixels, 2 pixels per byte = 8192 bytes)
+// Direct access to grayscale buffer (256x64 pixels, 2 pixels per byte = 8192 bytes).
+// Marks the whole frame dirty, as writes through it are not tracked
 uint8_t* gray4_get_buffer();
 
 } // namespace sf
\ No newline at end of file
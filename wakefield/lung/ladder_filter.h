@@ -18,7 +18,12 @@
  * All calculations use Q15 fixed-point format (16-bit signed integers) for
  * consistent performance and compatibility with the existing audio engine.
  * The filters use a ladder structure with proper state management for
- * smooth bypass transitions.
+ * smooth bypass transitions. Each pole is kernels::onePoleLag on the Q15
+ * type from shared/dsp, the same kernel the desktop filters run in float.
+ * The poles take their gain as Q15LagWeights, so on the RP2350 a pole is
+ * one dual 16-bit MAC (SMLAD) with the same output as the scalar form.
+ * The saturation is Q15 integer math clamped with SSAT, no float divides,
+ * so both can stay on next to the crossfade and TZFM render.
  * 
  * ## Usage
  * 
@@ -26,13 +31,15 @@
  * ADC6 for saturation) and applied to the audio output in real-time.
  * 
  * @author Brian Varren
- * @version 1.1
+ * @version 1.2
  * @date 2024
  */
 
 #pragma once
 #include <stdint.h>
 
+#include "../../shared/dsp/one_pole.h"
+
 /**
  * @class Ladder8PoleLowpassFilter
  * @brief 8-pole ladder lowpass filter using fixed-point math
@@ -44,10 +51,7 @@
  */
 class Ladder8PoleLowpassFilter {
 public:
-    Ladder8PoleLowpassFilter() : 
-        pole1(0), pole2(0), pole3(0), pole4(0), 
-        pole5(0), pole6(0), pole7(0), pole8(0),
-        initialized(false), last_coefficient(0) {}
+    Ladder8PoleLowpassFilter() : initialized(false), last_coefficient(0) {}
     
     /**
      * @brief Process one audio sample through the 8-pole lowpass filter
@@ -60,8 +64,7 @@ public:
         if (coefficient == 0) {
             if (last_coefficient != 0) {
                 // Reset all poles when transitioning from active to bypass
-                pole1 = pole2 = pole3 = pole4 = 0;
-                pole5 = pole6 = pole7 = pole8 = 0;
+                fillPoles(0);
                 initialized = false;
             }
             last_coefficient = 0;
@@ -70,64 +73,43 @@ public:
         
         // Initialize with current input if first time
         if (!initialized) {
-            pole1 = pole2 = pole3 = pole4 = input;
-            pole5 = pole6 = pole7 = pole8 = input;
+            fillPoles(input);
             initialized = true;
         }
         
+        if (coefficient != last_coefficient) {
+            weights = kernels::Q15LagWeights(kernels::Q15Gain{coefficient});
+        }
+
         // Process through 8 cascaded poles
         // Each pole: output = prev_output + coefficient * (input - prev_output) / 32768
-        int32_t diff1 = (int32_t)input - (int32_t)pole1;
-        int32_t scaled_diff1 = ((int64_t)diff1 * (int64_t)coefficient) >> 15;
-        pole1 = pole1 + (int16_t)scaled_diff1;
-        
-        int32_t diff2 = (int32_t)pole1 - (int32_t)pole2;
-        int32_t scaled_diff2 = ((int64_t)diff2 * (int64_t)coefficient) >> 15;
-        pole2 = pole2 + (int16_t)scaled_diff2;
-        
-        int32_t diff3 = (int32_t)pole2 - (int32_t)pole3;
-        int32_t scaled_diff3 = ((int64_t)diff3 * (int64_t)coefficient) >> 15;
-        pole3 = pole3 + (int16_t)scaled_diff3;
-        
-        int32_t diff4 = (int32_t)pole3 - (int32_t)pole4;
-        int32_t scaled_diff4 = ((int64_t)diff4 * (int64_t)coefficient) >> 15;
-        pole4 = pole4 + (int16_t)scaled_diff4;
-        
-        int32_t diff5 = (int32_t)pole4 - (int32_t)pole5;
-        int32_t scaled_diff5 = ((int64_t)diff5 * (int64_t)coefficient) >> 15;
-        pole5 = pole5 + (int16_t)scaled_diff5;
-        
-        int32_t diff6 = (int32_t)pole5 - (int32_t)pole6;
-        int32_t scaled_diff6 = ((int64_t)diff6 * (int64_t)coefficient) >> 15;
-        pole6 = pole6 + (int16_t)scaled_diff6;
-        
-        int32_t diff7 = (int32_t)pole6 - (int32_t)pole7;
-        int32_t scaled_diff7 = ((int64_t)diff7 * (int64_t)coefficient) >> 15;
-        pole7 = pole7 + (int16_t)scaled_diff7;
-        
-        int32_t diff8 = (int32_t)pole7 - (int32_t)pole8;
-        int32_t scaled_diff8 = ((int64_t)diff8 * (int64_t)coefficient) >> 15;
-        pole8 = pole8 + (int16_t)scaled_diff8;
+        kernels::Q15 x(input);
+        for (int i = 0; i < 8; ++i) {
+            x = kernels::onePoleLag(poles[i], x, weights);
+        }
         
         last_coefficient = coefficient;
-        return pole8;
+        return x.v;
     }
     
     /**
      * @brief Reset the filter state
      */
     inline void reset() {
-        pole1 = pole2 = pole3 = pole4 = 0;
-        pole5 = pole6 = pole7 = pole8 = 0;
+        fillPoles(0);
         initialized = false;
         last_coefficient = 0;
     }
     
 private:
-    int16_t pole1, pole2, pole3, pole4;  // First 4 poles
-    int16_t pole5, pole6, pole7, pole8;  // Last 4 poles
+    kernels::Q15 poles[8];  // Cascaded one-pole states, input side first
+    kernels::Q15LagWeights weights{kernels::Q15Gain{1}};  // Packed gain for last_coefficient
     bool initialized;
     uint16_t last_coefficient;  // Track coefficient changes for proper bypass
+
+    inline void fillPoles(int16_t value) {
+        for (int i = 0; i < 8; ++i) poles[i] = kernels::Q15(value);
+    }
 };
 
 /**
@@ -142,10 +124,7 @@ private:
  */
 class Ladder8PoleHighpassFilter {
 public:
-    Ladder8PoleHighpassFilter() : 
-        pole1(0), pole2(0), pole3(0), pole4(0), 
-        pole5(0), pole6(0), pole7(0), pole8(0),
-        initialized(false), last_coefficient(0) {}
+    Ladder8PoleHighpassFilter() : initialized(false), last_coefficient(0) {}
     
     /**
      * @brief Process one audio sample through the 8-pole highpass filter
@@ -158,8 +137,7 @@ public:
         if (coefficient == 0) {
             if (last_coefficient != 0) {
                 // Reset all poles when transitioning from active to bypass
-                pole1 = pole2 = pole3 = pole4 = 0;
-                pole5 = pole6 = pole7 = pole8 = 0;
+                fillPoles(0);
                 initialized = false;
             }
             last_coefficient = 0;
@@ -168,83 +146,44 @@ public:
         
         // Initialize with current input if first time
         if (!initialized) {
-            pole1 = pole2 = pole3 = pole4 = input;
-            pole5 = pole6 = pole7 = pole8 = input;
+            fillPoles(input);
             initialized = true;
         }
         
+        if (coefficient != last_coefficient) {
+            weights = kernels::Q15LagWeights(kernels::Q15Gain{coefficient});
+        }
+
         // Process through 8 cascaded lowpass poles to get the low frequencies
         // Then subtract from input to get high frequencies
-        int16_t current = input;
-        
-        // First 4 poles
-        int32_t diff1 = (int32_t)current - (int32_t)pole1;
-        int32_t scaled_diff1 = ((int64_t)diff1 * (int64_t)coefficient) >> 15;
-        pole1 = pole1 + (int16_t)scaled_diff1;
-        current = pole1;
-        
-        int32_t diff2 = (int32_t)current - (int32_t)pole2;
-        int32_t scaled_diff2 = ((int64_t)diff2 * (int64_t)coefficient) >> 15;
-        pole2 = pole2 + (int16_t)scaled_diff2;
-        current = pole2;
-        
-        int32_t diff3 = (int32_t)current - (int32_t)pole3;
-        int32_t scaled_diff3 = ((int64_t)diff3 * (int64_t)coefficient) >> 15;
-        pole3 = pole3 + (int16_t)scaled_diff3;
-        current = pole3;
-        
-        int32_t diff4 = (int32_t)current - (int32_t)pole4;
-        int32_t scaled_diff4 = ((int64_t)diff4 * (int64_t)coefficient) >> 15;
-        pole4 = pole4 + (int16_t)scaled_diff4;
-        current = pole4;
-        
-        // Last 4 poles
-        int32_t diff5 = (int32_t)current - (int32_t)pole5;
-        int32_t scaled_diff5 = ((int64_t)diff5 * (int64_t)coefficient) >> 15;
-        pole5 = pole5 + (int16_t)scaled_diff5;
-        current = pole5;
-        
-        int32_t diff6 = (int32_t)current - (int32_t)pole6;
-        int32_t scaled_diff6 = ((int64_t)diff6 * (int64_t)coefficient) >> 15;
-        pole6 = pole6 + (int16_t)scaled_diff6;
-        current = pole6;
-        
-        int32_t diff7 = (int32_t)current - (int32_t)pole7;
-        int32_t scaled_diff7 = ((int64_t)diff7 * (int64_t)coefficient) >> 15;
-        pole7 = pole7 + (int16_t)scaled_diff7;
-        current = pole7;
-        
-        int32_t diff8 = (int32_t)current - (int32_t)pole8;
-        int32_t scaled_diff8 = ((int64_t)diff8 * (int64_t)coefficient) >> 15;
-        pole8 = pole8 + (int16_t)scaled_diff8;
-        current = pole8;
-        
-        // Highpass = input - lowpass (current contains the lowpass result)
-        int32_t highpass_result = (int32_t)input - (int32_t)current;
-        
-        // Clamp to prevent overflow
-        if (highpass_result > 32767) highpass_result = 32767;
-        if (highpass_result < -32768) highpass_result = -32768;
+        kernels::Q15 current(input);
+        for (int i = 0; i < 8; ++i) {
+            current = kernels::onePoleLag(poles[i], current, weights);
+        }
         
+        // Highpass = input - lowpass, clamped to prevent overflow
         last_coefficient = coefficient;
-        return (int16_t)highpass_result;
+        return kernels::subSaturate(kernels::Q15(input), current).v;
     }
     
     /**
      * @brief Reset the filter state
      */
     inline void reset() {
-        pole1 = pole2 = pole3 = pole4 = 0;
-        pole5 = pole6 = pole7 = pole8 = 0;
+        fillPoles(0);
         initialized = false;
         last_coefficient = 0;
     }
     
 private:
-    int16_t pole1, pole2, pole3, pole4;  // First 4 poles
-    int16_t pole5, pole6, pole7, pole8;  // Last 4 poles
+    kernels::Q15 poles[8];  // Cascaded one-pole states, input side first
+    kernels::Q15LagWeights weights{kernels::Q15Gain{1}};  // Packed gain for last_coefficient
     bool initialized;
     uint16_t last_coefficient;  // Track coefficient changes for proper bypass
+
+    inline void fillPoles(int16_t value) {
+        for (int i = 0; i < 8; ++i) poles[i] = kernels::Q15(value);
+    }
 };
 
 /**
@@ -255,8 +194,9 @@ private:
  * and warmth to the audio signal. The saturation amount is controlled by
  * the effect coefficient (0-32767). Higher values = more saturation.
  * 
- * Uses a tanh-like soft clipping curve implemented with fixed-point arithmetic
- * for real-time performance.
+ * Uses a tanh-like soft clipping curve implemented with Q15 fixed-point
+ * arithmetic (32-bit intermediates, one saturating clamp at the end) for
+ * real-time performance.
  */
 class SaturationEffect {
 public:
@@ -276,44 +216,28 @@ public:
             return input;
         }
         
-        // Convert input to float for easier math
-        float input_f = (float)input / 32768.0f;
-        
-        // Calculate saturation amount (0.0 to 1.0)
-        float saturation_amount = (float)coefficient / 32767.0f;
-        
-        // Apply soft clipping using a tanh-like curve
-        // Scale input by saturation amount, then apply soft clipping
-        float scaled_input = input_f * (1.0f + saturation_amount * 2.0f);
-        
-        // Soft clipping using a polynomial approximation of tanh
-        float output_f;
-        if (scaled_input > 1.0f) {
-            output_f = 1.0f;
-        } else if (scaled_input < -1.0f) {
-            output_f = -1.0f;
+        // Scale input by saturation amount (1x to 3x drive), then apply
+        // soft clipping
+        const int32_t x = input;
+        const int32_t scaled = x + ((x * coefficient) >> 14);
+
+        int32_t shaped;
+        if (scaled > 32767) {
+            shaped = 32767;
+        } else if (scaled < -32768) {
+            shaped = -32768;
         } else {
             // Polynomial approximation of tanh for soft clipping
-            // tanh(x) ≈ x - x³/3 + 2x⁵/15 (for small x)
-            float x = scaled_input;
-            float x3 = x * x * x;
-            float x5 = x3 * x * x;
-            output_f = x - (x3 / 3.0f) + (2.0f * x5 / 15.0f);
+            // tanh(x) ≈ x - x³/3 + 2x⁵/15 (for small x), Q15 products
+            const int32_t x2 = (scaled * scaled) >> 15;
+            const int32_t x3 = (x2 * scaled) >> 15;
+            const int32_t x5 = (x3 * x2) >> 15;
+            shaped = scaled - ((x3 * 10923) >> 15) + ((x5 * 4369) >> 15);
         }
-        
+
         // Mix original and saturated signal based on coefficient
-        float mix_factor = saturation_amount;
-        output_f = input_f * (1.0f - mix_factor) + output_f * mix_factor;
-        
-        // Convert back to Q15 format
-        int32_t output_i32 = (int32_t)(output_f * 32768.0f);
-        
-        // Clamp to prevent overflow
-        if (output_i32 > 32767) output_i32 = 32767;
-        if (output_i32 < -32768) output_i32 = -32768;
-        
         last_coefficient = coefficient;
-        return (int16_t)output_i32;
+        return kernels::saturateQ15(x + (((shaped - x) * coefficient) >> 15));
     }
     
     /**
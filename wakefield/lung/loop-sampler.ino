@@ -82,6 +82,7 @@
 #include "storage_wav_meta.h"
 #include "sf_globals_bridge.h"
 #include "audio_engine.h"
+#include "audio_profiler.h"
 
 using namespace sf;
 
@@ -188,6 +189,7 @@ void setup() {
   {
     float mb = sd_card_size_mb();
     view_print_line("✅ SD Card ready");
+    view_print_line((String("Bus: ") + sd_bus_name()).c_str());
     view_print_line((String("Size: ") + String(mb, 1) + " MB").c_str());
     view_flush_if_dirty();
   }
@@ -232,6 +234,7 @@ void setup1(){
   Serial.println("Core1: Starting display init...");
   display_init();
   Serial.println("Core1: Display init complete");
+  ae_render_fx_core1_init();   // Effects IRQ, with AUDIO_FX_CORE1
 }
 
 // ───────────────────────── Core 0 Main Loop (Audio Core) ──────────────────────
@@ -245,13 +248,13 @@ void setup1(){
  * - Maintains timing for audio callbacks
  * 
  * The loop is intentionally simple to maintain real-time performance.
- * All heavy processing is done in the audio_tick() function.
+ * Audio itself is rendered by audio_tick() from the DMA completion IRQ
+ * (DACless.cpp), so nothing here can delay a block.
  */
 void loop() {
-  // Process audio engine - this handles the main audio processing loop
-  // including sample playback, crossfading, and control input processing
-  audio_tick();
-  
+  // SD reads for a sample load on core 1 (overlaps its decode)
+  sf::storage_read_service();
+
   // Poll for reset trigger on GPIO18
   audio_engine_reset_trigger_poll();
   
@@ -261,9 +264,8 @@ void loop() {
   // Poll for mode switch changes
   audio_engine_mode_switch_poll();
   
-  // Debug output (currently disabled to maintain real-time performance)
-  static uint32_t last = 0;
-  static uint32_t last_debug_report = 0;
+  // Audio timing is not printed from here: build with AUDIO_PROFILE and
+  // core 1 streams the render IRQ's figures (audio_profiler.h)
   static ae_mode_t last_mode = AE_MODE_FORWARD;
   
   // Print mode changes for debugging
@@ -274,19 +276,6 @@ void loop() {
     Serial.println(mode_names[current_mode]);
     last_mode = current_mode;
   }
-  
-  // if (millis() - last >= 250) {
-  //   last += 250;
-  //   Serial.print('.');
-  //   audio_engine_debug_poll();  // must be reachable
-  //   Serial.flush();
-  // }
-  
-  // // Print comprehensive debug report every 5 seconds
-  // if (millis() - last_debug_report >= 5000) {
-  //   last_debug_report = millis();
-  //   audio_engine_debug_print_quick_status();
-  // }
 }
 
 // ───────────────────────── Core 1 Main Loop (Display Core) ────────────────────
@@ -330,4 +319,13 @@ void loop1() {
   // Phase 2: Main UI loop - update inputs and display
   ui_input_update();  // Process encoders, buttons, rotary switch
   display_tick();     // Update display at ~60Hz
+
+#ifdef AUDIO_PROFILE
+  // Render IRQ timing as binary frames (audio_profiler.h), 4 per second
+  static uint32_t s_last_prof = 0;
+  if (millis() - s_last_prof >= 250) {
+    s_last_prof = millis();
+    prof_stream(Serial);
+  }
+#endif
 }
\ No newline at end of file
@@ -6,6 +6,12 @@
  * for high-performance sample interpolation. The RP2040 includes dedicated
  * interpolation hardware that can perform linear interpolation between
  * two 16-bit values with 8-bit fractional precision.
+ *
+ * Each core has two interpolators, but only interp0 can blend, so every
+ * voice on the audio core reads through it. It runs in signed blend mode
+ * with lane 1 shifting the raw Q0.32 phase fraction down to the 8-bit
+ * weight, so samples go in and come out as int16 with no offset
+ * conversion and no fraction math.
  * 
  * ## Hardware Interpolation
  * 
@@ -38,34 +44,34 @@
 
 #pragma once
 
+#include <stdint.h>
+#include "hardware/interp.h"
+
 // ── Hardware Interpolation Interface ──────────────────────────────────────────
 
 /**
  * @brief Initialize RP2040 interpolation hardware
  * 
- * Sets up the hardware interpolation units for use by the audio engine.
- * Must be called during system initialization.
+ * Configures interp0 of the calling core for signed blend mode. Must be called during system initialization, on the audio core.
  */
 void setupInterpolators();
 
 /**
- * @brief Perform hardware-accelerated linear interpolation
- * 
- * Uses the RP2040's interpolation hardware to interpolate between two values.
+ * @brief Perform hardware-accelerated linear interpolation of two samples
  * 
- * @param x First value (16-bit)
- * @param y Second value (16-bit) 
- * @param mu_scaled Interpolation factor (0-255, where 0 = x, 255 = y)
- * @return Interpolated result (16-bit)
- */
-uint16_t interpolate(uint16_t x, uint16_t y, uint16_t mu_scaled);
-
-/**
- * @brief Alternative interpolation function (if multiple units available)
+ * Inline so it runs wherever the caller does (the render path is in RAM).
+ * Reads through interp0, set up by setupInterpolators().
+ * The interpolator keeps no state between calls, so voices can share it
+ * as long as only the audio interrupt uses it.
  * 
- * @param x First value (16-bit)
- * @param y Second value (16-bit)
- * @param mu_scaled Interpolation factor (0-255)
- * @return Interpolated result (16-bit)
+ * @param x First sample (weight 0)
+ * @param y Second sample
+ * @param frac32 Position between them as a Q0.32 fraction; the top 8 bits are used
+ * @return Interpolated sample
  */
-uint16_t interpolate1(uint16_t x, uint16_t y, uint16_t mu_scaled);
\ No newline at end of file
+static inline int16_t interpolate_s16(int16_t x, int16_t y, uint32_t frac32) {
+    interp0->base[0] = (uint32_t)(int32_t)x;
+    interp0->base[1] = (uint32_t)(int32_t)y;
+    interp0->accum[1] = frac32;
+    return (int16_t)(int32_t)interp0->peek[1];
+}
\ No newline at end of file
@@ -0,0 +1,127 @@
+#include <Arduino.h>
+#include <string.h>
+#include <hardware/dma.h>
+#include <hardware/regs/dreq.h>
+#include <hardware/sync.h>
+#include <pico.h>
+#include "sample_prefetch.h"
+
+// Readable windows, next to the render's other hot state
+PrefetchWindow __scratch_y("lung_prefetch") g_prefetch[PREFETCH_WINDOWS];
+
+// Two buffers per window: the render reads one while DMA fills the other
+static int16_t s_buffers[2][PREFETCH_WINDOWS][PREFETCH_SAMPLES];
+static uint8_t s_fill = 1;                       // Buffer set the requests fill
+static PrefetchWindow s_pending[PREFETCH_WINDOWS];
+
+// One control block per run, loaded by the control channel into the data
+// channel's READ_ADDR, WRITE_ADDR, TRANS_COUNT and CTRL_TRIG. The data
+// channel chains back to the control channel after each run; the all-zero
+// block after the last run is a null trigger, which ends the chain
+struct ControlBlock {
+  const void* read;
+  void* write;
+  uint32_t count;
+  uint32_t ctrl;
+};
+static ControlBlock s_chain[2 * PREFETCH_WINDOWS + 1] __attribute__((aligned(16)));
+static uint32_t s_chain_len = 0;
+static bool s_chain_running = false;
+
+static int s_data_chan = -1;
+static int s_ctrl_chan = -1;
+static uint32_t s_data_ctrl = 0;                 // CTRL_TRIG of every run
+
+void prefetch_init(void) {
+  memset(g_prefetch, 0, sizeof(g_prefetch));
+  memset(s_pending, 0, sizeof(s_pending));
+  if (s_data_chan < 0) {
+    s_data_chan = dma_claim_unused_channel(false);
+    s_ctrl_chan = dma_claim_unused_channel(false);
+    if (s_data_chan < 0 || s_ctrl_chan < 0) {
+      if (s_data_chan >= 0) dma_channel_unclaim(s_data_chan);
+      if (s_ctrl_chan >= 0) dma_channel_unclaim(s_ctrl_chan);
+      s_data_chan = s_ctrl_chan = -1;
+      return;
+    }
+  }
+
+  // Runs: 16-bit copies, PSRAM (through the XIP cache, so coherent with the
+  // loader's writes) to SRAM, as fast as the bus allows, no IRQ
+  dma_channel_config data_conf = dma_channel_get_default_config(s_data_chan);
+  channel_config_set_transfer_data_size(&data_conf, DMA_SIZE_16);
+  channel_config_set_read_increment(&data_conf, true);
+  channel_config_set_write_increment(&data_conf, true);
+  channel_config_set_irq_quiet(&data_conf, true);
+  channel_config_set_dreq(&data_conf, DREQ_FORCE);
+  channel_config_set_chain_to(&data_conf, s_ctrl_chan);
+  s_data_ctrl = channel_config_get_ctrl_value(&data_conf);
+
+  // Control: four words per block, the write address wrapping on the 16
+  // bytes of the data channel's first register set
+  dma_channel_config ctrl_conf = dma_channel_get_default_config(s_ctrl_chan);
+  channel_config_set_transfer_data_size(&ctrl_conf, DMA_SIZE_32);
+  channel_config_set_read_increment(&ctrl_conf, true);
+  channel_config_set_write_increment(&ctrl_conf, true);
+  channel_config_set_ring(&ctrl_conf, true, 4);
+  channel_config_set_irq_quiet(&ctrl_conf, true);
+  channel_config_set_dreq(&ctrl_conf, DREQ_FORCE);
+  dma_channel_configure(s_ctrl_chan, &ctrl_conf, &dma_hw->ch[s_data_chan].read_addr,
+                        s_chain, 4, false);
+}
+
+// The control channel has read the null block and stopped
+static inline bool __not_in_flash_func(chain_done)(void) {
+  return !dma_channel_is_busy(s_ctrl_chan) && !dma_channel_is_busy(s_data_chan) &&
+         dma_hw->ch[s_ctrl_chan].read_addr == (uintptr_t)&s_chain[s_chain_len + 1];
+}
+
+void __not_in_flash_func(prefetch_begin_block)(void) {
+  if (s_chain_running) {
+    // A few hundred bytes against a whole block period: only a PSRAM bus
+    // held by something else for that long could make this wait
+    while (!chain_done()) tight_loop_contents();
+    s_chain_running = false;
+    for (uint32_t w = 0; w < PREFETCH_WINDOWS; ++w) g_prefetch[w] = s_pending[w];
+    s_fill ^= 1u;
+  } else {
+    for (uint32_t w = 0; w < PREFETCH_WINDOWS; ++w) g_prefetch[w].count[0] = g_prefetch[w].count[1] = 0;
+  }
+  for (uint32_t w = 0; w < PREFETCH_WINDOWS; ++w) {
+    s_pending[w].count[0] = s_pending[w].count[1] = 0;
+    g_prefetch[w].missed = false;
+  }
+  s_chain_len = 0;
+}
+
+void __not_in_flash_func(prefetch_request)(uint8_t window, const int16_t* samples,
+                                           uint32_t first0, uint32_t count0,
+                                           uint32_t first1, uint32_t count1) {
+  if (s_data_chan < 0 || window >= PREFETCH_WINDOWS || count0 + count1 > PREFETCH_SAMPLES ||
+      s_chain_len + 2 > 2 * PREFETCH_WINDOWS) {
+    return;
+  }
+  int16_t* buf = s_buffers[s_fill][window];
+  PrefetchWindow& p = s_pending[window];
+  p.first[0] = first0;
+  p.count[0] = count0;
+  p.first[1] = first1;
+  p.count[1] = count1;
+  p.buf = buf;
+  if (count0) s_chain[s_chain_len++] = {samples + first0, buf, count0, s_data_ctrl};
+  if (count1) s_chain[s_chain_len++] = {samples + first1, buf + count0, count1, s_data_ctrl};
+}
+
+void __not_in_flash_func(prefetch_kick)(void) {
+  if (s_chain_len == 0) return;
+  s_chain[s_chain_len] = {nullptr, nullptr, 0, 0};
+  __dmb();                                       // Blocks written before the DMA reads them
+  dma_channel_set_read_addr(s_ctrl_chan, s_chain, true);
+  s_chain_running = true;
+}
+
+void __not_in_flash_func(prefetch_invalidate)(uint8_t window) {
+  if (window >= PREFETCH_WINDOWS) return;
+  g_prefetch[window].count[0] = g_prefetch[window].count[1] = 0;
+  s_pending[window].count[0] = s_pending[window].count[1] = 0;
+}
@@ -0,0 +1,66 @@
+/**
+ * @file sample_prefetch.h
+ * @brief SRAM windows over the PSRAM samples, filled by DMA a block ahead
+ *
+ * Each crossfade voice reads its sample through a small SRAM window instead
+ * of going to PSRAM through the XIP cache, where two crossfading voices and
+ * core 1's waveform view evict each other's lines.
+ *
+ * At the end of a block the render asks, per playing voice, for the samples
+ * the voice should cover in the next block: its playhead onward in the
+ * direction it is moving, as far as this block's increments went plus a
+ * margin, wrapped in its loop (so up to two runs). prefetch_kick() copies
+ * all of them with one DMA chain while the effects run, and
+ * prefetch_begin_block() swaps the filled buffers in at the start of the
+ * next block. A read outside the window (a crossfade's first block, a jump,
+ * FM swinging past the margin, stretch mode) goes to PSRAM as before: a
+ * wrong guess costs time, never correctness.
+ *
+ * Everything here runs on the audio core; the window state is not shared.
+ */
+
+#pragma once
+#include <stdint.h>
+
+#define PREFETCH_WINDOWS  4      // AE_LAYERS x two crossfade voices
+#define PREFETCH_SAMPLES  256    // Per window: a 16-sample block at 16x speed
+
+struct PrefetchWindow {
+  // Run r holds sample indices first[r] .. first[r] + count[r] - 1; the
+  // second run (after a loop wrap) follows the first in buf
+  uint32_t first[2];
+  uint32_t count[2];
+  const int16_t* buf;
+  bool missed;                   // A read this block fell outside the window
+};
+
+extern PrefetchWindow g_prefetch[PREFETCH_WINDOWS];
+
+// Claim the two DMA channels (data and control). Without them every
+// request is dropped and all reads go to PSRAM
+void prefetch_init(void);
+
+// Start of a block: wait for the last block's copies (long done in
+// practice) and make them readable; windows nobody asked for are empty
+void prefetch_begin_block(void);
+
+// Ask for samples[first0 .. first0 + count0) and samples[first1 .. first1 +
+// count1) in a window next block; count0 + count1 <= PREFETCH_SAMPLES
+void prefetch_request(uint8_t window, const int16_t* samples,
+                      uint32_t first0, uint32_t count0, uint32_t first1, uint32_t count1);
+
+// Start the copies requested this block
+void prefetch_kick(void);
+
+// Forget a window (its sample was unbound), including any copy in flight
+void prefetch_invalidate(uint8_t window);
+
+// Sample i from the window, or from PSRAM if it isn't there
+static inline int16_t prefetch_read(PrefetchWindow& w, const int16_t* samples, uint32_t i) {
+  uint32_t k = i - w.first[0];
+  if (k < w.count[0]) return w.buf[k];
+  k = i - w.first[1];
+  if (k < w.count[1]) return w.buf[w.count[0] + k];
+  w.missed = true;
+  return samples[i];
+}
@@ -18,14 +18,15 @@
  * 
  * The system uses several techniques to ensure thread-safe communication:
  * 
- * **Atomic Variables**: Simple variables (like playhead position) are marked
- * volatile and accessed atomically where possible.
+ * **Atomic Variables**: Only single-word flags (setup done, transport
+ * state) are shared as volatiles; a 32-bit store cannot tear.
  * 
- * **Sequence Locks**: Complex data structures use sequence locks (seqlocks)
- * for lock-free reads while allowing safe updates from the writer.
+ * **Sequence Locks**: Everything wider (the display record from core 0, the
+ * buffer bind from core 1) goes through a seqlock, published as one record
+ * with lock-free reads on the other core.
  * 
- * **Memory Barriers**: Compiler memory barriers ensure proper ordering of
- * memory operations across cores.
+ * **Memory Barriers**: The seqlock helpers use data memory barriers, so the
+ * ordering holds across cores and not only in the compiler.
  * 
  * ## State Management
  * 
@@ -58,6 +59,7 @@
 #define ADC_FX1_CH        5  // Effect 1 control (lowpass filter)
 #define ADC_FX2_CH        6  // Effect 2 control (highpass filter)
 #define ADC_TZFM_DEPTH_CH 7  // TZFM modulation depth control
+#define ADC_REC_CH        ADC_PM_CH  // Audio input captured in record mode
 
 // ── Crossfade Configuration ───────────────────────────────────────────────────
 // These constants define the range of crossfade lengths for seamless loop transitions
@@ -92,25 +94,8 @@ namespace sf {
   using ::currentWav;       // WAV file metadata
 }
 
-// #pragma once
-// #include <stdint.h>
-//#include <hardware/sync.h>   // for __compiler_memory_barrier()
-
-// // 0..4095 for start/len (ADC-style), playhead/total are sample indices or Q16.16 — your choice
-// typedef struct {
-//   volatile uint32_t seq;            // even = stable, odd = being written
-//   volatile uint16_t loop_start_q12; // [0..4095]
-//   volatile uint16_t loop_len_q12;   // [0..4095]
-//   volatile uint32_t playhead;       // sample idx or Q16.16
-//   volatile uint32_t total;          // total samples (or Q16.16 length)
-// } sf_display_state_t;
-
-
-// Seqlock: writer flips an odd/even sequence around a field update; reader retries until it sees a stable, even sequence.
-// For core1 display stability
-extern volatile uint32_t g_core0_setup_done; 
-//extern sf_display_state_t g_disp;   // define once in a .cpp
-
+// Core 0 → core 1 ready flag (one word; written once)
+extern volatile uint32_t g_core0_setup_done;
 
 static inline void core0_publish_setup_done(void) {
   __compiler_memory_barrier();
@@ -118,60 +103,44 @@ static inline void core0_publish_setup_done(void) {
   __compiler_memory_barrier();
 }
 
-// static inline void disp_write_begin() {
-//   g_disp.seq++;                    // make odd
-//   __compiler_memory_barrier();
-// }
-// static inline void disp_write_end() {
-//   __compiler_memory_barrier();
-//   g_disp.seq++;                    // back to even
-// }
-
-// // Copy out a stable snapshot; returns when consistent.
-// static inline void disp_read_snapshot(sf_display_state_t* out) {
-//   while (1) {
-//     uint32_t a = g_disp.seq;
-//     __compiler_memory_barrier();
-//     uint16_t ls = g_disp.loop_start_q12;
-//     uint16_t ll = g_disp.loop_len_q12;
-//     uint32_t ph = g_disp.playhead;
-//     uint32_t tt = g_disp.total;
-//     __compiler_memory_barrier();
-//     uint32_t b = g_disp.seq;
-//     if ((a == b) && ((b & 1u) == 0)) {
-//       out->loop_start_q12 = ls;
-//       out->loop_len_q12   = ll;
-//       out->playhead       = ph;
-//       out->total          = tt;
-//       out->seq            = b;
-//       return;
-//     }
-//     // else: writer in progress; try again
-//   }
-// }
-
+// ───────────────────────────── Seqlock helpers ──────────────────────────────
+// Shared state that is more than one word goes through a seqlock: the single
+// writer makes the sequence odd, stores the fields with plain (non-volatile)
+// writes, then makes it even again. Readers copy the fields and keep the copy
+// only if the sequence was even and unchanged around it. The barriers are
+// __dmb() rather than compiler-only, as the two cores can see each other's
+// stores out of order.
+static inline void seq_write_begin(volatile uint32_t* seq) {
+  *seq = *seq + 1u;                  // odd: readers discard
+  __dmb();
+}
+static inline void seq_write_end(volatile uint32_t* seq) {
+  __dmb();
+  *seq = *seq + 1u;                  // even: stable
+}
+// Reader: returns the sequence to pass to seq_read_retry, or an odd value
+// if a write is in progress
+static inline uint32_t seq_read_begin(const volatile uint32_t* seq) {
+  const uint32_t s = *seq;
+  __dmb();
+  return s;
+}
+static inline bool seq_read_retry(const volatile uint32_t* seq, uint32_t s0) {
+  __dmb();
+  return (s0 & 1u) || *seq != s0;
+}
 
 /**
- * Visual state bridge between audio engine (writer) and display (reader).
- * - Exposes simple extern volatiles for quick reads.
- * - Also provides a tear-free snapshot API using a tiny seqlock.
+ * Visual state bridge between audio engine (writer, core 0) and display
+ * (reader, core 1). The render publishes one record per block, which costs
+ * a sequence increment either side of a handful of plain stores; the
+ * display takes tear-free copies with vis_get_snapshot().
  *
  * Conventions:
  *  - Functions: snake_case
- *  - Vars:      g_vis_* (extern volatile)
+ *  - Vars:      g_vis_*
  */
 
-// ─────────────────────────── Extern visual state (volatile) ─────────────────
-extern volatile uint16_t g_vis_start_q12;      // loop start, 0..4095
-extern volatile uint16_t g_vis_len_q12;        // loop length, 0..4095
-extern volatile uint32_t g_vis_total;          // total samples (≥1)
-extern volatile uint32_t g_vis_playhead_idx;   // primary playhead (head or main)
-extern volatile uint8_t  g_vis_xfade_active;   // 0 or 1
-extern volatile uint32_t g_vis_playhead2_idx;  // secondary playhead (tail when xfade)
-
-// Internal writer sequence for seqlock (even = stable, odd = writing)
-extern volatile uint32_t g_vis_seq;
-
 // ───────────────────────────── Snapshot struct ──────────────────────────────
 typedef struct {
   uint16_t start_q12;
@@ -182,6 +151,11 @@ typedef struct {
   uint32_t playhead2_idx;
 } sf_vis_snapshot_t;
 
+// Published record and its sequence (even = stable, odd = writing). Only
+// publish_display_state*() write these; read them through vis_get_snapshot
+extern sf_vis_snapshot_t g_vis;
+extern volatile uint32_t g_vis_seq;
+
 // ───────────────────────────── Publish APIs ─────────────────────────────────
 // Back-compat single-playhead publisher.
 void publish_display_state(uint16_t start_q12, uint16_t len_q12,
@@ -195,39 +169,14 @@ void publish_display_state2(uint16_t start_q12, uint16_t len_q12,
 // ───────────────────────────── Read API (safe) ──────────────────────────────
 /**
  * vis_get_snapshot(out):
- *   Copies a consistent snapshot using a seqlock. Spin-waits briefly
- *   if a write is in progress. No heap; O(1) memory; tiny code size.
+ *   Copies a consistent snapshot using the seqlock. Spins while a write is
+ *   in progress (a few stores on core 0). No heap; O(1) memory.
  */
 static inline void vis_get_snapshot(sf_vis_snapshot_t* out) {
-  // Declarations of externs so this can be header-inline without extra includes
-  extern volatile uint16_t g_vis_start_q12, g_vis_len_q12;
-  extern volatile uint32_t g_vis_total, g_vis_playhead_idx, g_vis_playhead2_idx;
-  extern volatile uint8_t  g_vis_xfade_active;
-  extern volatile uint32_t g_vis_seq;
-
-  for (;;) {
-    uint32_t s0 = g_vis_seq;           // read seq (start)
-    if (s0 & 1u) continue;             // writer in progress, try again
-
-    // Read fields
-    uint16_t start_q12   = g_vis_start_q12;
-    uint16_t len_q12     = g_vis_len_q12;
-    uint32_t total       = g_vis_total;
-    uint32_t playhead    = g_vis_playhead_idx;
-    uint8_t  xfade       = g_vis_xfade_active;
-    uint32_t playhead2   = g_vis_playhead2_idx;
-
-    uint32_t s1 = g_vis_seq;           // read seq (end)
-    if (s0 == s1 && !(s1 & 1u)) {
-      // Stable snapshot
-      out->start_q12     = start_q12;
-      out->len_q12       = len_q12;
-      out->total         = (total == 0u) ? 1u : total; // guard divide-by-zero
-      out->playhead_idx  = playhead;
-      out->xfade_active  = xfade;
-      out->playhead2_idx = playhead2;
-      return;
-    }
-    // else: writer raced us; spin and try again
-  }
-}
\ No newline at end of file
+  uint32_t s0;
+  do {
+    s0 = seq_read_begin(&g_vis_seq);
+    *out = g_vis;
+  } while (seq_read_retry(&g_vis_seq, s0));
+  if (out->total == 0u) out->total = 1u;   // guard divide-by-zero
+}
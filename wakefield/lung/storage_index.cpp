@@ -1,6 +1,8 @@
 #include <SdFat.h>
+#include <stdio.h>
 #include <string.h>
 #include "storage_loader.h"
+#include "storage_wav_meta.h"
 
 extern SdFat sd;  // provided by SD HAL
 
@@ -13,7 +15,146 @@ static bool ends_with_wav_ci(const char* s) {
   return (ext[0]=='.') && ((ext[1]|32)=='w') && ((ext[2]|32)=='a') && ((ext[3]|32)=='v');
 }
 
-bool file_index_scan(FileIndex& idx, const char* folder) {
+// ───────────────────────────── Index cache ─────────────────────────────
+// /.lung/index.bin: a header, then one IndexEntry per file. It lives in a
+// subfolder so that rewriting it leaves the indexed folder's own directory
+// entries (and so their hash) untouched.
+static const char*    INDEX_DIR     = "/.lung";
+static const char*    INDEX_PATH    = "/.lung/index.bin";
+static const uint32_t INDEX_MAGIC   = 0x5844494Cu;  // "LIDX"
+static const uint16_t INDEX_VERSION = 1;
+
+#pragma pack(push,1)
+struct IndexHeader {
+  uint32_t magic;
+  uint16_t version;
+  uint16_t entrySize;
+  uint32_t folderHash;   // which folder was indexed
+  uint32_t dirHash;      // raw directory entries at the time
+  uint32_t dirBytes;
+  uint32_t count;
+};
+struct IndexEntry {
+  char     name[MAX_NAME_LEN];
+  uint32_t size;
+  uint32_t dataSize;
+  uint32_t sampleRate;
+  uint16_t numChannels;
+  uint16_t bitsPerSample;
+  uint32_t dataOffset;
+  uint8_t  ok;
+  uint8_t  overview[OVERVIEW_BINS];
+};
+#pragma pack(pop)
+
+static uint32_t fnv1a(uint32_t h, const uint8_t* p, uint32_t n) {
+  for (uint32_t i = 0; i < n; ++i) { h ^= p[i]; h *= 16777619u; }
+  return h;
+}
+
+// Hash of the folder's raw directory entries (names, sizes, dates, first
+// clusters): any add, delete, rename or rewrite changes it. This is a
+// sequential read of the directory, far cheaper than openNext per entry
+static bool dir_signature(const char* folder, uint32_t& hash, uint32_t& bytes) {
+  FsFile dir;
+  if (!dir.open(folder)) return false;
+  uint8_t buf[512];
+  hash = 2166136261u;
+  bytes = 0;
+  int r;
+  while ((r = dir.read(buf, sizeof(buf))) > 0) {
+    hash = fnv1a(hash, buf, (uint32_t)r);
+    bytes += (uint32_t)r;
+  }
+  dir.close();
+  return r == 0 && bytes > 0;
+}
+
+static bool index_load(FileIndex& idx, uint32_t folderHash, uint32_t dirHash, uint32_t dirBytes) {
+  FsFile f = sd.open(INDEX_PATH, O_RDONLY);
+  if (!f) return false;
+  IndexHeader h;
+  bool ok = f.read(&h, sizeof(h)) == (int)sizeof(h) &&
+            h.magic == INDEX_MAGIC && h.version == INDEX_VERSION &&
+            h.entrySize == sizeof(IndexEntry) && h.count <= (uint32_t)MAX_WAV_FILES &&
+            h.folderHash == folderHash && h.dirHash == dirHash && h.dirBytes == dirBytes;
+  for (uint32_t i = 0; ok && i < h.count; ++i) {
+    IndexEntry e;
+    if (f.read(&e, sizeof(e)) != (int)sizeof(e)) { ok = false; break; }
+    memcpy(idx.names[i], e.name, MAX_NAME_LEN);
+    idx.names[i][MAX_NAME_LEN - 1] = '\0';
+    idx.sizes[i] = e.size;
+    WavInfo& wi = idx.info[i];
+    wi.dataSize = e.dataSize;
+    wi.sampleRate = e.sampleRate;
+    wi.numChannels = e.numChannels;
+    wi.bitsPerSample = e.bitsPerSample;
+    wi.dataOffset = e.dataOffset;
+    wi.ok = e.ok != 0;
+    memcpy(idx.overview[i], e.overview, OVERVIEW_BINS);
+  }
+  f.close();
+  idx.count = ok ? (int)h.count : 0;
+  return ok;
+}
+
+static void index_store(const FileIndex& idx, uint32_t folderHash, uint32_t dirHash, uint32_t dirBytes) {
+  FsFile f = sd.open(INDEX_PATH, O_WRONLY | O_CREAT | O_TRUNC);
+  if (!f) return;
+  const IndexHeader h = {INDEX_MAGIC, INDEX_VERSION, (uint16_t)sizeof(IndexEntry),
+                         folderHash, dirHash, dirBytes, (uint32_t)idx.count};
+  bool ok = f.write(&h, sizeof(h)) == sizeof(h);
+  for (int i = 0; ok && i < idx.count; ++i) {
+    IndexEntry e = {};
+    memcpy(e.name, idx.names[i], MAX_NAME_LEN);
+    e.size = idx.sizes[i];
+    const WavInfo& wi = idx.info[i];
+    e.dataSize = wi.dataSize;
+    e.sampleRate = wi.sampleRate;
+    e.numChannels = wi.numChannels;
+    e.bitsPerSample = wi.bitsPerSample;
+    e.dataOffset = wi.dataOffset;
+    e.ok = wi.ok ? 1 : 0;
+    memcpy(e.overview, idx.overview[i], OVERVIEW_BINS);
+    ok = f.write(&e, sizeof(e)) == sizeof(e);
+  }
+  f.close();
+  if (!ok) sd.remove(INDEX_PATH);  // never leave a truncated index behind
+}
+
+// Waveform overview: the first channel's peak over 64 frames at the start
+// of each bin. A sketch for the browser, not a true peak; one small read
+// per bin keeps a rebuild to a few hundred ms per hundred files
+static void build_overview(const char* path, const WavInfo& wi, uint8_t* out) {
+  memset(out, 0, OVERVIEW_BINS);
+  const uint32_t bps = wi.bitsPerSample / 8u;
+  const uint32_t frame = bps * wi.numChannels;
+  if (!wi.ok || frame == 0 || bps == 0 || bps > 4) return;
+  const uint32_t frames = wi.dataSize / frame;
+  if (frames == 0) return;
+  FsFile f = sd.open(path, O_RDONLY);
+  if (!f) return;
+  uint8_t buf[64 * 8];
+  for (int b = 0; b < OVERVIEW_BINS; ++b) {
+    const uint32_t first = (uint32_t)(((uint64_t)frames * b) / OVERVIEW_BINS);
+    uint32_t n = frames - first;
+    if (n > sizeof(buf) / frame) n = sizeof(buf) / frame;
+    if (!f.seekSet(wi.dataOffset + first * frame)) break;
+    const int r = f.read(buf, n * frame);
+    if (r <= 0) break;
+    uint32_t peak = 0;
+    for (const uint8_t* p = buf; p + frame <= buf + r; p += frame) {
+      // Top byte of the sample, as magnitude 0..128
+      int32_t v = (bps == 1) ? (int32_t)p[0] - 128 : (int32_t)(int8_t)p[bps - 1];
+      const uint32_t a = (uint32_t)(v < 0 ? -v : v);
+      if (a > peak) peak = a;
+    }
+    out[b] = (uint8_t)(peak >= 128 ? 255 : peak * 2);
+  }
+  f.close();
+}
+
+static bool file_index_walk(FileIndex& idx, const char* folder) {
   idx.count = 0;
 
   FsFile dir;
@@ -35,6 +176,32 @@ bool file_index_scan(FileIndex& idx, const char* folder) {
   }
 
   dir.close();
+
+  // Headers and overviews, once per rebuild rather than per load
+  for (int i = 0; i < idx.count; ++i) {
+    char path[MAX_NAME_LEN + 80];
+    const size_t flen = strlen(folder);
+    snprintf(path, sizeof(path), "%s%s%s", folder,
+             (flen && folder[flen - 1] == '/') ? "" : "/", idx.names[i]);
+    if (!wav_read_info(path, idx.info[i])) idx.info[i].ok = false;
+    build_overview(path, idx.info[i], idx.overview[i]);
+  }
+  return true;
+}
+
+bool file_index_scan(FileIndex& idx, const char* folder) {
+  idx.count = 0;
+  sd.mkdir(INDEX_DIR);  // before hashing: creating it changes the root directory
+
+  const uint32_t folderHash = fnv1a(2166136261u, (const uint8_t*)folder, (uint32_t)strlen(folder));
+  uint32_t dirHash = 0, dirBytes = 0;
+  const bool haveSig = dir_signature(folder, dirHash, dirBytes);
+  if (haveSig && index_load(idx, folderHash, dirHash, dirBytes)) {
+    return true;
+  }
+
+  if (!file_index_walk(idx, folder)) return false;
+  if (haveSig) index_store(idx, folderHash, dirHash, dirBytes);
   return true;
 }
 
@@ -1,5 +1,8 @@
+#include <Arduino.h>
 #include <SdFat.h>
+#include <stdio.h>
 #include <string.h>
+#include "ADCless.h"
 #include "audio_engine.h"
 #include "storage_loader.h"
 #include "storage_wav_meta.h"
@@ -12,20 +15,240 @@ extern SdFat sd;  // defined in storage_sd_hal.cpp
 
 namespace sf {
 
+// ───────────────────────────── Sample cache ─────────────────────────────
+// Each slot owns one pmalloc'd PSRAM block: the Q15 samples followed by the
+// sample's WavePyramid, so a hit restores the waveform view without a scan.
+// The slot that audioData points at is "current"; it, the slot held as the
+// engine's second layer and the buffers the render is still reading are
+// never evicted.
+
+struct CacheSlot {
+  char        name[MAX_NAME_LEN];   // Path as passed to the loader; "" = free
+  uint8_t*    buf;                  // Samples, then the pyramid
+  uint32_t    bytes;                // Sample bytes (pyramid not included)
+  WavInfo     info;
+  uint32_t    last_used;            // s_cache_clock at the last selection
+  bool        pinned;
+};
+
+static CacheSlot s_cache[SAMPLE_CACHE_SLOTS];
+static uint32_t  s_cache_clock = 0;
+static CacheSlot* s_layer_slot = nullptr;   // Playing as layer 1, or none
+static WavePyramid s_pyramid;   // Envelope of audioData (15 KB, SRAM)
+
+static CacheSlot* cache_find(const char* path) {
+  for (int i = 0; i < SAMPLE_CACHE_SLOTS; ++i) {
+    if (s_cache[i].buf && strncmp(s_cache[i].name, path, MAX_NAME_LEN) == 0) return &s_cache[i];
+  }
+  return nullptr;
+}
+
+static void cache_free(CacheSlot& s) {
+  free(s.buf);
+  s.buf = nullptr;
+  s.bytes = 0;
+  s.name[0] = '\0';
+  s.pinned = false;
+}
+
+// Wait (a block or two) for the render to take up the latest binds, so the
+// buffers it reads are known. If the DMA is not running nothing reads.
+static void cache_buffers_in_use(const int16_t* in_use[AE_LAYERS]) {
+  const uint32_t t0 = micros();
+  while (!playback_bound_buffers(in_use)) {
+    if (micros() - t0 > 10000u) {
+      for (int l = 0; l < AE_LAYERS; ++l) in_use[l] = nullptr;
+      return;
+    }
+    tight_loop_contents();
+  }
+}
+
+// Least recently used slot that is neither pinned nor in use; nullptr if
+// every resident sample is protected
+static CacheSlot* cache_victim(void) {
+  const int16_t* in_use[AE_LAYERS];
+  cache_buffers_in_use(in_use);
+  CacheSlot* victim = nullptr;
+  for (int i = 0; i < SAMPLE_CACHE_SLOTS; ++i) {
+    CacheSlot& s = s_cache[i];
+    if (!s.buf || s.pinned || s.buf == audioData || &s == s_layer_slot) continue;
+    if ((const int16_t*)s.buf == in_use[0] || (const int16_t*)s.buf == in_use[1]) continue;
+    if (!victim || s.last_used < victim->last_used) victim = &s;
+  }
+  return victim;
+}
+
+// A free slot and a PSRAM block of the given size, evicting as needed
+static CacheSlot* cache_alloc(uint32_t block_bytes) {
+  for (;;) {
+    CacheSlot* slot = nullptr;
+    for (int i = 0; i < SAMPLE_CACHE_SLOTS && !slot; ++i) {
+      if (!s_cache[i].buf) slot = &s_cache[i];
+    }
+    if (slot) {
+      slot->buf = (uint8_t*)pmalloc(block_bytes);
+      if (slot->buf) return slot;
+    }
+    CacheSlot* victim = cache_victim();
+    if (!victim) return nullptr;
+    cache_free(*victim);
+  }
+}
+
+// Make the slot current: publish the globals and bind it to the engine
+static void cache_select(CacheSlot& s) {
+  s.last_used = ++s_cache_clock;
+  memcpy(&s_pyramid, s.buf + s.bytes, sizeof(s_pyramid));
+
+  audioData        = s.buf;
+  audioDataSize    = s.bytes;
+  audioSampleCount = s.bytes / 2u;
+  currentWav       = s.info;
+
+  // Source (WAV) rate and the PWM/engine output rate
+  playback_bind_loaded_buffer(s.info.sampleRate, audio_rate, audioSampleCount);
+}
+
+static CacheSlot* cache_current(void) {
+  for (int i = 0; i < SAMPLE_CACHE_SLOTS; ++i) {
+    if (s_cache[i].buf && s_cache[i].buf == audioData) return &s_cache[i];
+  }
+  return nullptr;
+}
+
+bool storage_cache_is_resident(const char* path) {
+  return path && cache_find(path) != nullptr;
+}
+
+bool storage_cache_is_pinned(const char* path) {
+  const CacheSlot* s = path ? cache_find(path) : nullptr;
+  return s && s->pinned;
+}
+
+bool storage_cache_toggle_pin_current(void) {
+  CacheSlot* s = cache_current();
+  if (!s) return false;
+  s->pinned = !s->pinned;
+  return s->pinned;
+}
+
+// ───────────────────────────── Second layer ─────────────────────────────
+// The held slot is bound straight from the cache; loading other samples
+// afterwards changes only layer 0
+
+bool storage_layer_toggle_current(void) {
+  if (s_layer_slot) {
+    s_layer_slot = nullptr;
+    playback_bind_second_layer(nullptr, 0);
+    return false;
+  }
+  CacheSlot* cur = cache_current();
+  if (!cur) return false;
+  s_layer_slot = cur;
+  playback_bind_second_layer((const int16_t*)cur->buf, cur->bytes / 2u);
+  return true;
+}
+
+const char* storage_layer_name(void) {
+  return s_layer_slot ? s_layer_slot->name : nullptr;
+}
+
+// ───────────────────────────── Record mode ──────────────────────────────
+// The take's slot is pinned (and nameless) while the DMA writes into it
+
+static CacheSlot* s_rec_slot  = nullptr;
+static uint32_t   s_rec_rate  = 0;
+static uint32_t   s_rec_takes = 0;
+
+bool storage_record_begin(void) {
+  if (s_rec_slot) return false;
+  s_rec_rate = (uint32_t)lrintf(audio_rate);
+  const uint32_t samples = s_rec_rate * RECORD_MAX_SECONDS;
+
+  CacheSlot* slot = cache_alloc(samples * 2u + sizeof(WavePyramid));
+  if (!slot) return false;
+  slot->pinned = true;
+  if (!adc_capture_start((volatile uint16_t*)slot->buf, samples, audio_rate, ADC_REC_CH)) {
+    cache_free(*slot);
+    return false;
+  }
+  s_rec_slot = slot;
+  return true;
+}
+
+bool storage_record_active(void) {
+  return s_rec_slot != nullptr;
+}
+
+bool storage_record_full(void) {
+  return s_rec_slot && adc_capture_full();
+}
+
+uint32_t storage_record_samples(void) {
+  return s_rec_slot ? adc_capture_count() : 0u;
+}
+
+bool storage_record_end(void) {
+  if (!s_rec_slot) return false;
+  CacheSlot& s = *s_rec_slot;
+  s_rec_slot = nullptr;
+  const uint32_t n = adc_capture_stop();
+  if (n < 2u) {
+    cache_free(s);
+    return false;
+  }
+
+  // Raw 12-bit ADC (input biased at mid-scale) to Q15, in place
+  volatile uint16_t* raw = (volatile uint16_t*)s.buf;
+  int16_t* q15 = (int16_t*)s.buf;
+  for (uint32_t i = 0; i < n; ++i) {
+    q15[i] = (int16_t)(((int32_t)(raw[i] & 0x0FFFu) - 2048) * 16);
+  }
+
+  // No envelope: the waveform view reads the samples instead
+  s_pyramid.ready = false;
+  memcpy(s.buf + n * 2u, &s_pyramid, sizeof(s_pyramid));
+
+  snprintf(s.name, sizeof(s.name), "REC %u", (unsigned)++s_rec_takes);
+  s.bytes  = n * 2u;
+  s.info   = WavInfo{n * 2u, s_rec_rate, 1, 16, 0, true};
+  s.pinned = false;
+  cache_select(s);
+  return true;
+}
+
 // ───────────────────────────── Orchestrator ─────────────────────────────
 
+const WavePyramid* storage_wave_pyramid(void) {
+  return (audioData && s_pyramid.ready) ? &s_pyramid : nullptr;
+}
+
 bool storage_load_sample_q15_psram(const char* path,
                                    float* out_mbps,
                                    uint32_t* out_bytes_read,
-                                   uint32_t* out_required_bytes)
+                                   uint32_t* out_required_bytes,
+                                   const WavInfo* info,
+                                   bool* out_cached)
 {
   if (out_mbps)        *out_mbps = 0.0f;
   if (out_bytes_read)  *out_bytes_read = 0;
   if (out_required_bytes) *out_required_bytes = 0;
+  if (out_cached)      *out_cached = false;
+
+  // Resident: switch to it, no SD access
+  if (CacheSlot* hit = cache_find(path)) {
+    cache_select(*hit);
+    if (out_bytes_read)     *out_bytes_read = hit->bytes;
+    if (out_required_bytes) *out_required_bytes = hit->bytes;
+    if (out_cached)         *out_cached = true;
+    return true;
+  }
 
-  // Inspect WAV to compute required size
+  // Inspect WAV to compute required size (header from the index if given)
   WavInfo wi;
-  if (!wav_read_info(path, wi) || !wi.ok) return false;
+  if (info && info->ok) wi = *info;
+  else if (!wav_read_info(path, wi) || !wi.ok) return false;
   const uint32_t bytes_per_in = (wi.bitsPerSample / 8u) * (uint32_t)wi.numChannels;
   if (bytes_per_in == 0) return false;
 
@@ -33,49 +256,39 @@ bool storage_load_sample_q15_psram(const char* path,
   const uint32_t required_out_bytes  = total_input_samples * 2u; // mono Q15
   if (out_required_bytes) *out_required_bytes = required_out_bytes;
 
-  // Optional headroom check
+  // Larger than the whole heap: fail without emptying the cache
   #ifdef ARDUINO_ARCH_RP2040
-  if (required_out_bytes > rp2040.getFreePSRAMHeap()) {
+  if (required_out_bytes + sizeof(WavePyramid) > rp2040.getTotalPSRAMHeap()) {
     return false;
   }
   #endif
 
-  // Drop previous buffer (if any)
-  if (audioData) {
-    free(audioData);
-    audioData = nullptr;
-    audioDataSize = 0;
-    audioSampleCount = 0;
-  }
-
-  // Allocate PSRAM
-  uint8_t* buf = (uint8_t*)pmalloc(required_out_bytes);
-  if (!buf) return false;
+  // Allocate PSRAM, evicting least recently used samples to make room.
+  // The current sample keeps playing until the new one is decoded.
+  CacheSlot* slot = cache_alloc(required_out_bytes + sizeof(WavePyramid));
+  if (!slot) return false;
+  uint8_t* buf = slot->buf;
 
-  // Decode into PSRAM
+  // Decode into PSRAM (the pyramid in SRAM, copied behind the samples)
   uint32_t written = 0;
   float mbps = 0.0f;
-  const bool ok = wav_decode_q15_into_buffer(path, (int16_t*)buf, required_out_bytes, &written, &mbps);
+  s_pyramid.ready = false;
+  const bool ok = wav_decode_q15_into_buffer(path, (int16_t*)buf, required_out_bytes, &written, &mbps, &wi, &s_pyramid);
 
   if (!ok || written != required_out_bytes) {
-    free(buf);
+    cache_free(*slot);
+    // s_pyramid is gone; the current slot's copy brings it back
+    if (const CacheSlot* cur = cache_current()) memcpy(&s_pyramid, cur->buf + cur->bytes, sizeof(s_pyramid));
     return false;
   }
+  memcpy(buf + written, &s_pyramid, sizeof(s_pyramid));
 
-  // Publish globals
-  audioData        = buf;
-  audioDataSize    = written;
-  audioSampleCount = written / 2u;
-
-  // Source (WAV) sample rate from WavInfo
-  const uint32_t src_rate_hz = wi.sampleRate;
-
-  // Your PWM/engine output rate. Replace with your symbol if different:
-  // e.g., DACless_get_sample_rate_hz(), AUDIO_OUT_RATE_HZ, or PWM_SAMPLE_RATE_HZ.
-  const uint32_t out_rate_hz = audio_rate;   // <-- use your project’s constant
-
-  // Tell the audio engine about the new PSRAM buffer and rates.
-  playback_bind_loaded_buffer(src_rate_hz, out_rate_hz, audioSampleCount);
+  strncpy(slot->name, path, MAX_NAME_LEN - 1);
+  slot->name[MAX_NAME_LEN - 1] = '\0';
+  slot->bytes  = written;
+  slot->info   = wi;
+  slot->pinned = false;
+  cache_select(*slot);
 
   if (out_mbps)       *out_mbps = mbps;
   if (out_bytes_read) *out_bytes_read = written;
@@ -12,24 +12,32 @@
  * mono or stereo format. All files are converted to mono Q15 format for
  * consistent processing.
  * 
- * **Two-pass Normalization**: 
- * - Pass 1: Scans entire file to find peak amplitude
- * - Pass 2: Converts to mono, normalizes to -3dB, outputs as Q15
+ * **Single-pass Decode**: One read of the file converts to mono Q15 while
+ * tracking the peak; louder files are then scaled to -3dB in place. SD reads
+ * run on core 0 (storage_read_service) while core 1 converts the previous
+ * chunk.
  * 
  * **PSRAM Integration**: Automatically allocates PSRAM buffers for large
  * samples and manages memory efficiently.
  * 
  * **File Indexing**: Scans SD card for WAV files and maintains an index
- * for fast browsing and selection.
+ * for fast browsing and selection. The index (names, sizes, WAV headers and
+ * a waveform overview) is cached in /.lung/index.bin and reused while the
+ * folder's directory entries are unchanged, so boot reads one file instead
+ * of walking the FAT.
  * 
  * ## Audio Processing Pipeline
  * 
  * 1. **File Discovery**: Scan SD card for *.wav files (case-insensitive)
  * 2. **Metadata Extraction**: Read WAV headers to get sample rate, bit depth, channels
- * 3. **Peak Detection**: First pass to find maximum amplitude for normalization
- * 4. **Conversion**: Second pass converts to mono Q15 with -3dB normalization
- * 5. **PSRAM Storage**: Allocates PSRAM buffer and stores converted samples
- * 6. **Engine Binding**: Binds sample to audio engine for playback
+ * 3. **Conversion**: Streams the file to mono Q15, tracking the peak
+ * 4. **Normalization**: In-place -3dB gain over the PSRAM buffer if needed
+ * 5. **PSRAM Storage**: Allocates a PSRAM cache slot and stores converted
+ *    samples; recently used (or pinned) samples stay resident, so selecting
+ *    one again rebinds without touching the SD card
+ * 6. **Waveform Pyramid**: Min/max envelope built during conversion, kept
+ *    in SRAM so the waveform view never scans the PSRAM buffer
+ * 7. **Engine Binding**: Binds sample to audio engine for playback
  * 
  * @author Brian Varren
  * @version 1.0
@@ -38,29 +46,58 @@
 
 #pragma once
 #include <stdint.h>
+#include "storage_wav_meta.h"
 
 namespace sf {
 
-constexpr int MAX_WAV_FILES   = 100;
+constexpr int MAX_WAV_FILES   = 256;
 constexpr int MAX_NAME_LEN    = 64;
+constexpr int OVERVIEW_BINS   = 32;   // Peaks across the file, 0-255
 
 struct FileIndex {
   char     names[MAX_WAV_FILES][MAX_NAME_LEN];
   uint32_t sizes[MAX_WAV_FILES];
+  WavInfo  info[MAX_WAV_FILES];                      // ok = false if unreadable
+  uint8_t  overview[MAX_WAV_FILES][OVERVIEW_BINS];   // |peak| per bin, mono
   int      count;
 };
 
-// Scan root (or a folder) for *.wav (case-insensitive). Returns true if ok.
+// Min/max envelope of a decoded sample, in SRAM. Level 0 splits the sample
+// into buckets of (1 << shift) samples, at most PYRAMID_BINS of them; each
+// further level halves the count, down to one bucket per display column.
+// Built by the decoder (after normalization, so values match the buffer).
+constexpr int PYRAMID_BINS   = 2048;
+constexpr int PYRAMID_LEVELS = 4;     // 2048, 1024, 512, 256 buckets
+
+struct WavePyramid {
+  int16_t  lo[2 * PYRAMID_BINS];      // Levels back to back, see level_offset
+  int16_t  hi[2 * PYRAMID_BINS];
+  uint32_t count;                     // Samples covered
+  uint16_t bins;                      // Buckets used at level 0
+  uint8_t  shift;                     // log2(samples per level-0 bucket)
+  bool     ready;
+
+  static constexpr int level_offset(int level) {
+    return 2 * (PYRAMID_BINS - (PYRAMID_BINS >> level));
+  }
+};
+
+// Min/max of samples [start, end) from the pyramid, widened to whole
+// buckets. False (outputs untouched) if the range is narrower than a
+// level-0 bucket, where the caller should read the samples instead.
+bool wave_pyramid_minmax(const WavePyramid& pyr, uint32_t start, uint32_t end,
+                         int16_t& out_min, int16_t& out_max);
+
+// Index root (or a folder) for *.wav (case-insensitive). Returns true if ok.
+// Uses the cached index when the folder's directory entries hash to the
+// value stored with it; otherwise walks the folder, reads every header and
+// overview, and rewrites the cache.
 bool file_index_scan(FileIndex& idx, const char* folder = "/");
 
 // Return name by index (or nullptr if out of range)
 const char* file_index_get(const FileIndex& idx, int i);
 
-// Loads WAV file, performs two-pass normalization to -3dB, converts to mono Q15.
-// 
-// Process:
-// - Pass 1: Scan entire file to find peak amplitude
-// - Pass 2: Convert to mono (averaging stereo), normalize to -3dB, output as Q15
+// Loads WAV file, converts to mono Q15 (averaging stereo), normalizes to -3dB.
 // 
 // Input: Any standard PCM WAV (8/16/24/32-bit, mono/stereo)
 // Output: Normalized mono Q15 samples in PSRAM buffer
@@ -78,19 +115,74 @@ const char* file_index_get(const FileIndex& idx, int i);
 // Pure decode: WAV (8/16/24/32-bit PCM, mono/stereo) → mono Q15 into caller buffer.
 // - No allocation, no globals, no printing.
 // - dst_q15 capacity (dst_bytes) must be >= required size (2 * total_samples).
-// Returns true on success. Writes bytes written and MB/s (overall decode throughput).
+// Returns true on success. Writes bytes written and MB/s (WAV data read from SD
+// per second of the overlapped read/convert pipeline).
+// Runs on core 1; once core 0 is in loop() the SD reads are done there.
+// info: the file's header from the index, or nullptr to parse it here.
+// pyramid: filled in as the samples are converted, if given.
 bool wav_decode_q15_into_buffer(const char* path,
                                 int16_t* dst_q15,
                                 uint32_t dst_bytes,
                                 uint32_t* out_bytes_written,
-                                float* out_mbps);
+                                float* out_mbps,
+                                const WavInfo* info = nullptr,
+                                WavePyramid* pyramid = nullptr);
+
+// PSRAM sample cache: decoded samples stay resident, up to this many, and
+// are evicted least recently used first when a new one needs the room.
+// Pinned samples, the current one, the held second layer and the ones still
+// playing are kept.
+constexpr int SAMPLE_CACHE_SLOTS = 8;
 
-// High level orchestrator: allocates PSRAM, decodes, and publishes globals.
-// - Computes required bytes, checks PSRAM, pmallocs, decodes, sets audioData/audioSampleCount.
-// - On failure, frees any allocation and returns false.
+// High level orchestrator: makes path the current sample and publishes globals.
+// - Resident: rebinds straight away, no SD access (*out_cached = true).
+// - Otherwise computes required bytes, pmallocs (evicting as needed), decodes,
+//   then sets audioData/audioSampleCount/currentWav and binds the engine.
+// - On failure, frees any allocation and returns false; the current sample
+//   is untouched.
+// - info as for wav_decode_q15_into_buffer.
 bool storage_load_sample_q15_psram(const char* path,
                                    float* out_mbps,
                                    uint32_t* out_bytes_read,
-                                   uint32_t* out_required_bytes);
+                                   uint32_t* out_required_bytes,
+                                   const WavInfo* info = nullptr,
+                                   bool* out_cached = nullptr);
+
+// Cache state by path, for the browser
+bool storage_cache_is_resident(const char* path);
+bool storage_cache_is_pinned(const char* path);
+
+// Pin the current sample so it is never evicted, or unpin it. Returns the
+// new state (false if nothing is loaded)
+bool storage_cache_toggle_pin_current(void);
+
+// ── Second layer ──
+// Hold the current sample as the engine's layer 1 (playback_bind_second_layer),
+// so it keeps playing alongside whatever is loaded next, or release the held
+// one. The held sample stays resident until released. Returns true if a
+// sample is now held
+bool storage_layer_toggle_current(void);
+const char* storage_layer_name(void);     // Held sample's path, nullptr if none
+
+// ── Record mode ──
+// Captures ADC_REC_CH at audio_rate into a fresh cache slot by DMA (see
+// adc_capture_start), while the current sample keeps playing. Ending the
+// take converts it to Q15 in place and makes it the current sample, bound
+// to the engine like a loaded file; it stays resident as "REC n" until
+// evicted.
+constexpr uint32_t RECORD_MAX_SECONDS = 30;
+
+bool     storage_record_begin(void);      // False if no room or already recording
+bool     storage_record_active(void);
+bool     storage_record_full(void);       // Reached RECORD_MAX_SECONDS; call end
+uint32_t storage_record_samples(void);    // Captured so far
+bool     storage_record_end(void);        // Stop and bind; false if nothing was captured
+
+// Envelope of the sample loaded by storage_load_sample_q15_psram, or
+// nullptr if none is loaded
+const WavePyramid* storage_wave_pyramid(void);
+
+// Core 0 loop(): perform a pending decoder read, if any. Cheap when idle
+void storage_read_service(void);
 
 } // namespace sf
@@ -1,7 +1,9 @@
 #include <SdFat.h>
+#include <pico.h>
 #include <string.h>
 #include "storage_loader.h"
 #include "storage_wav_meta.h"
+#include "sf_globals_bridge.h"
 
 extern SdFat sd;  // provided by SD HAL
 
@@ -14,18 +16,161 @@ static inline int32_t le24_to_i32(const uint8_t* p) {
   return v;
 }
 
+// ───────────────────────────── Waveform pyramid ─────────────────────────
+// Level-0 buckets are filled sample by sample as chunks are converted
+// (first_index is the chunk's position in the sample); the coarser levels
+// are folded from level 0 once the whole file is in.
+struct PyramidFill {
+  WavePyramid* pyr;
+  uint32_t     first_index;
+};
+
+static void pyramid_begin(WavePyramid& pyr, uint32_t total) {
+  uint8_t shift = 0;
+  while ((total >> shift) >= (uint32_t)PYRAMID_BINS) ++shift;
+  pyr.count = total;
+  pyr.shift = shift;
+  pyr.bins  = (uint16_t)((total + (1u << shift) - 1u) >> shift);
+  pyr.ready = false;
+  for (int i = 0; i < pyr.bins; ++i) { pyr.lo[i] = 32767; pyr.hi[i] = -32768; }
+}
+
+static void pyramid_finish(WavePyramid& pyr) {
+  int n = pyr.bins;
+  for (int level = 1; level < PYRAMID_LEVELS; ++level) {
+    const int16_t* lo_in = pyr.lo + WavePyramid::level_offset(level - 1);
+    const int16_t* hi_in = pyr.hi + WavePyramid::level_offset(level - 1);
+    int16_t* lo_out = pyr.lo + WavePyramid::level_offset(level);
+    int16_t* hi_out = pyr.hi + WavePyramid::level_offset(level);
+    const int m = (n + 1) / 2;
+    for (int i = 0; i < m; ++i) {
+      const int j = (2 * i + 1 < n) ? 2 * i + 1 : 2 * i;
+      lo_out[i] = lo_in[2 * i] < lo_in[j] ? lo_in[2 * i] : lo_in[j];
+      hi_out[i] = hi_in[2 * i] > hi_in[j] ? hi_in[2 * i] : hi_in[j];
+    }
+    n = m;
+  }
+  pyr.ready = true;
+}
+
+bool wave_pyramid_minmax(const WavePyramid& pyr, uint32_t start, uint32_t end,
+                         int16_t& out_min, int16_t& out_max) {
+  if (!pyr.ready || end > pyr.count) end = pyr.count;
+  if (!pyr.ready || start >= end || (end - start) < (1u << pyr.shift)) return false;
+
+  // Coarsest level whose buckets still fit in the range: a few reads
+  int level = 0;
+  while (level + 1 < PYRAMID_LEVELS && (end - start) >= (1u << (pyr.shift + level + 1))) ++level;
+  const uint8_t s = (uint8_t)(pyr.shift + level);
+  const uint32_t b0 = start >> s;
+  const uint32_t b1 = (end - 1u) >> s;
+  const int16_t* lo = pyr.lo + WavePyramid::level_offset(level);
+  const int16_t* hi = pyr.hi + WavePyramid::level_offset(level);
+  int16_t mn = 32767, mx = -32768;
+  for (uint32_t b = b0; b <= b1; ++b) {
+    if (lo[b] < mn) mn = lo[b];
+    if (hi[b] > mx) mx = hi[b];
+  }
+  out_min = mn;
+  out_max = mx;
+  return true;
+}
+
+// Convert frames of raw PCM to mono Q15 at unity gain, tracking |peak| and
+// the level-0 pyramid buckets
+static void convert_chunk_q15(const uint8_t* p, uint32_t frames, int ch, int bps,
+                              int16_t* dst, int32_t& peak_q, const PyramidFill& fill) {
+  for (uint32_t i = 0; i < frames; ++i) {
+    float l = 0.0f, rch = 0.0f;
+    if (bps == 8) {
+      uint8_t a = *p++; l = ((int)a - 128) / 128.0f;
+      if (ch == 2) { uint8_t b = *p++; rch = ((int)b - 128) / 128.0f; }
+    } else if (bps == 16) {
+      int16_t a = (int16_t)(p[0] | (p[1] << 8)); p += 2; l = (float)a / 32768.0f;
+      if (ch == 2) { int16_t b = (int16_t)(p[0] | (p[1] << 8)); p += 2; rch = (float)b / 32768.0f; }
+    } else if (bps == 24) {
+      int32_t a = le24_to_i32(p); p += 3; l = (float)a / 8388608.0f;
+      if (ch == 2) { int32_t b = le24_to_i32(p); p += 3; rch = (float)b / 8388608.0f; }
+    } else {
+      int32_t a = (int32_t)(p[0] | (p[1] << 8) | (p[2] << 16) | (p[3] << 24)); p += 4; l = (float)a / 2147483648.0f;
+      if (ch == 2) { int32_t b = (int32_t)(p[0] | (p[1] << 8) | (p[2] << 16) | (p[3] << 24)); p += 4; rch = (float)b / 2147483648.0f; }
+    }
+    float mono = (ch == 2) ? 0.5f * (l + rch) : l;
+    float s = mono * 32767.0f;
+    int32_t q = (int32_t)(s + (s >= 0 ? 0.5f : -0.5f));
+    if (q >  32767) q =  32767;
+    if (q < -32768) q = -32768;
+    const int32_t aabs = q >= 0 ? q : -q;
+    if (aabs > peak_q) peak_q = aabs;
+    if (fill.pyr) {
+      const uint32_t b = (fill.first_index + i) >> fill.pyr->shift;
+      if (q < fill.pyr->lo[b]) fill.pyr->lo[b] = (int16_t)q;
+      if (q > fill.pyr->hi[b]) fill.pyr->hi[b] = (int16_t)q;
+    }
+    *dst++ = (int16_t)q;
+  }
+}
+
+// ───────────────────────────── Read-ahead ─────────────────────────────
+// Audio renders from the DMA IRQ, so core 0's loop() is free to do SD reads
+// for the decoder on core 1: core 1 queues a chunk, converts the previous
+// one while core 0 sits in the (DMA-driven) SPI transfer, then waits. Only
+// one read is ever in flight and core 1 does not touch the card meanwhile,
+// so SdFat is never used from both cores at once.
+enum : uint32_t { READ_IDLE = 0, READ_REQUESTED, READ_DONE };
+
+static FsFile*           s_read_file   = nullptr;
+static uint8_t*          s_read_dst    = nullptr;
+static uint32_t          s_read_len    = 0;
+static int               s_read_result = 0;
+static volatile uint32_t s_read_state  = READ_IDLE;
+
+void storage_read_service(void) {
+  if (s_read_state != READ_REQUESTED) return;
+  __sync_synchronize();  // see the request core 1 wrote before the flag
+  s_read_result = s_read_file->read(s_read_dst, s_read_len);
+  __sync_synchronize();
+  s_read_state = READ_DONE;
+}
+
+// Before core 0 reaches loop() nobody services requests: read inline
+static void read_begin(FsFile& f, uint8_t* dst, uint32_t len) {
+  s_read_file = &f;
+  s_read_dst  = dst;
+  s_read_len  = len;
+  if (!g_core0_setup_done) {
+    s_read_result = f.read(dst, len);
+    s_read_state  = READ_DONE;
+    return;
+  }
+  __sync_synchronize();
+  s_read_state = READ_REQUESTED;
+}
+
+static int read_end(void) {
+  while (s_read_state != READ_DONE) {
+    tight_loop_contents();
+  }
+  __sync_synchronize();
+  s_read_state = READ_IDLE;
+  return s_read_result;
+}
+
 bool wav_decode_q15_into_buffer(const char* path,
                                 int16_t* dst_q15,
                                 uint32_t dst_bytes,
                                 uint32_t* out_bytes_written,
-                                float* out_mbps)
+                                float* out_mbps,
+                                const WavInfo* info,
+                                WavePyramid* pyramid)
 {
   if (out_bytes_written) *out_bytes_written = 0;
   if (out_mbps)          *out_mbps = 0.0f;
 
-  // Parse header/meta
+  // Parse header/meta (unless the index already has it)
   WavInfo wi;
-  if (!wav_read_info(path, wi) || !wi.ok) return false;
+  if (info && info->ok) wi = *info;
+  else if (!wav_read_info(path, wi) || !wi.ok) return false;
   if (wi.numChannels == 0 || wi.dataSize == 0) return false;
   if (wi.bitsPerSample != 8 && wi.bitsPerSample != 16 &&
       wi.bitsPerSample != 24 && wi.bitsPerSample != 32) return false;
@@ -39,109 +184,80 @@ bool wav_decode_q15_into_buffer(const char* path,
 
   FsFile f = sd.open(path, O_RDONLY);
   if (!f) return false;
+  if (pyramid) pyramid_begin(*pyramid, total_input_samples);
 
-  // Chunk buffer
+  // Ping-pong chunk buffers: core 0 reads into one while this core
+  // converts the other (multi-block SD reads, 16 sectors each)
   static const uint32_t CHUNK_RAW = 8192;
-  static uint8_t  chunk_buf[CHUNK_RAW];
-
-  // Pass 1: find peak after downmix
-  float peak = 0.0f;
-  {
-    f.seekSet(wi.dataOffset);
-    uint32_t remaining = wi.dataSize;
-    while (remaining > 0) {
-      uint32_t to_read = remaining > CHUNK_RAW ? CHUNK_RAW : remaining;
-      to_read = (to_read / bytes_per_in) * bytes_per_in;
-      if (to_read == 0) break;
-      int r = f.read(chunk_buf, to_read);
-      if (r <= 0) break;
-
-      const uint32_t frames = (uint32_t)r / bytes_per_in;
-      const int ch = wi.numChannels;
-      const int bps = wi.bitsPerSample;
-      const uint8_t* p = chunk_buf;
-      for (uint32_t i = 0; i < frames; ++i) {
-        float l = 0.0f, rch = 0.0f;
-        if (bps == 8) {
-          uint8_t a = *p++; l = ((int)a - 128) / 128.0f;
-          if (ch == 2) { uint8_t b = *p++; rch = ((int)b - 128) / 128.0f; }
-        } else if (bps == 16) {
-          int16_t a = (int16_t)(p[0] | (p[1] << 8)); p += 2; l = (float)a / 32768.0f;
-          if (ch == 2) { int16_t b = (int16_t)(p[0] | (p[1] << 8)); p += 2; rch = (float)b / 32768.0f; }
-        } else if (bps == 24) {
-          int32_t a = le24_to_i32(p); p += 3; l = (float)a / 8388608.0f;
-          if (ch == 2) { int32_t b = le24_to_i32(p); p += 3; rch = (float)b / 8388608.0f; }
-        } else {
-          int32_t a = (int32_t)(p[0] | (p[1] << 8) | (p[2] << 16) | (p[3] << 24)); p += 4; l = (float)a / 2147483648.0f;
-          if (ch == 2) { int32_t b = (int32_t)(p[0] | (p[1] << 8) | (p[2] << 16) | (p[3] << 24)); p += 4; rch = (float)b / 2147483648.0f; }
-        }
-        float mono = (ch == 2) ? 0.5f * (l + rch) : l;
-        float aabs = mono >= 0.0f ? mono : -mono;
-        if (aabs > peak) peak = aabs;
-      }
-      remaining -= (uint32_t)r;
-    }
-  }
+  static uint8_t  chunk_buf[2][CHUNK_RAW];
 
-  // Target -3 dB
-  float gain = 1.0f;
-  if (peak > 0.000001f) {
-    const float target = 0.7071f;
-    const float g = target / peak;
-    gain = (g > 1.0f) ? 1.0f : g;
-  }
-
-  // Pass 2: decode into Q15 with gain, measure throughput
+  // Single pass: decode straight into the destination at unity gain while
+  // tracking the peak, so the SD file is read once. The -3 dB normalization
+  // only ever attenuates, so it is applied afterwards in place (see below)
   uint32_t written_bytes = 0;
+  uint32_t read_bytes = 0;
   uint32_t t0 = millis();
+  int32_t peak_q = 0;  // |sample| after downmix, Q15
   {
     f.seekSet(wi.dataOffset);
-    uint32_t remaining = wi.dataSize;
+    uint32_t unread = wi.dataSize;
+    auto next_chunk = [&]() -> uint32_t {
+      uint32_t to_read = unread > CHUNK_RAW ? CHUNK_RAW : unread;
+      return (to_read / bytes_per_in) * bytes_per_in;
+    };
+
     uint32_t out_index = 0; // in samples
-    while (remaining > 0) {
-      uint32_t to_read = remaining > CHUNK_RAW ? CHUNK_RAW : remaining;
-      to_read = (to_read / bytes_per_in) * bytes_per_in;
-      if (to_read == 0) break;
-      int r = f.read(chunk_buf, to_read);
+    int cur = 0;
+    uint32_t len = next_chunk();
+    if (len > 0) { read_begin(f, chunk_buf[cur], len); unread -= len; }
+    while (len > 0) {
+      int r = read_end();
       if (r <= 0) break;
+      read_bytes += (uint32_t)r;
+
+      // Queue the next chunk before converting this one (a short read
+      // means the file ended early: stop there)
+      uint32_t next = ((uint32_t)r == len) ? next_chunk() : 0;
+      if (next > 0) { read_begin(f, chunk_buf[cur ^ 1], next); unread -= next; }
 
       const uint32_t frames = (uint32_t)r / bytes_per_in;
-      const int ch = wi.numChannels;
-      const int bps = wi.bitsPerSample;
-      const uint8_t* p = chunk_buf;
-      for (uint32_t i = 0; i < frames; ++i) {
-        float l = 0.0f, rch = 0.0f;
-        if (bps == 8) {
-          uint8_t a = *p++; l = ((int)a - 128) / 128.0f;
-          if (ch == 2) { uint8_t b = *p++; rch = ((int)b - 128) / 128.0f; }
-        } else if (bps == 16) {
-          int16_t a = (int16_t)(p[0] | (p[1] << 8)); p += 2; l = (float)a / 32768.0f;
-          if (ch == 2) { int16_t b = (int16_t)(p[0] | (p[1] << 8)); p += 2; rch = (float)b / 32768.0f; }
-        } else if (bps == 24) {
-          int32_t a = le24_to_i32(p); p += 3; l = (float)a / 8388608.0f;
-          if (ch == 2) { int32_t b = le24_to_i32(p); p += 3; rch = (float)b / 8388608.0f; }
-        } else {
-          int32_t a = (int32_t)(p[0] | (p[1] << 8) | (p[2] << 16) | (p[3] << 24)); p += 4; l = (float)a / 2147483648.0f;
-          if (ch == 2) { int32_t b = (int32_t)(p[0] | (p[1] << 8) | (p[2] << 16) | (p[3] << 24)); p += 4; rch = (float)b / 2147483648.0f; }
-        }
-        float mono = (ch == 2) ? 0.5f * (l + rch) : l;
-        float s = mono * gain * 32767.0f;
-        int32_t q = (int32_t)(s + (s >= 0 ? 0.5f : -0.5f));
-        if (q >  32767) q =  32767;
-        if (q < -32768) q = -32768;
-        dst_q15[out_index++] = (int16_t)q;
-      }
+      convert_chunk_q15(chunk_buf[cur], frames, wi.numChannels, wi.bitsPerSample,
+                        dst_q15 + out_index, peak_q, PyramidFill{pyramid, out_index});
+      out_index += frames;
       written_bytes = out_index * 2u;
-      remaining -= (uint32_t)r;
+
+      cur ^= 1;
+      len = next;
+    }
+  }
+  const uint32_t dt_ms = millis() - t0;  // SD throughput: the gain pass is not timed
+
+  // Target -3 dB: gain = min(1, 0.7071 / peak). Louder files are scaled in
+  // place in Q15, one PSRAM read and write per sample, far quicker than a
+  // second pass over the SD card; quieter ones are left alone
+  const int32_t target_q = 23170;  // 0.7071 * 32768
+  if (peak_q > target_q) {
+    const int32_t gain_q15 = (int32_t)(((int64_t)target_q << 15) / peak_q);
+    const uint32_t n = written_bytes / 2u;
+    for (uint32_t i = 0; i < n; ++i) {
+      dst_q15[i] = (int16_t)(((int32_t)dst_q15[i] * gain_q15 + 16384) >> 15);
+    }
+    // Same rounding on the bucket extremes: a positive gain keeps the
+    // ordering, so they stay the exact min/max of the scaled samples
+    if (pyramid) {
+      for (int i = 0; i < pyramid->bins; ++i) {
+        pyramid->lo[i] = (int16_t)(((int32_t)pyramid->lo[i] * gain_q15 + 16384) >> 15);
+        pyramid->hi[i] = (int16_t)(((int32_t)pyramid->hi[i] * gain_q15 + 16384) >> 15);
+      }
     }
   }
+  if (pyramid && written_bytes == required_out_bytes) pyramid_finish(*pyramid);
 
   f.close();
 
-  const uint32_t dt_ms = millis() - t0;
   if (out_bytes_written) *out_bytes_written = written_bytes;
   if (out_mbps) {
-    float mb = (float)written_bytes / (1024.0f * 1024.0f);
+    float mb = (float)read_bytes / (1024.0f * 1024.0f);
     float sec = (dt_ms > 0) ? (dt_ms / 1000.0f) : 0.0f;
     *out_mbps = (sec > 0.0f) ? (mb / sec) : 0.0f;
   }
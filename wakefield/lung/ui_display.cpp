@@ -17,6 +17,15 @@ static FileIndex  s_idx;                // names[], sizes[], count
 static int        s_sel  = 0;           // selected row
 static int        s_top  = 0;           // top row of the current page
 static int        s_pendingIdx = -1;    // index captured on "load" press
+static uint32_t   s_recShownTenths = 0xFFFFFFFFu;  // last elapsed time drawn while recording
+
+// The row after the files starts a recording, the next holds (or releases)
+// the current sample as the engine's second layer, and the last toggles
+// stretch mode
+static inline int browser_rows(void) { return s_idx.count + 3; }
+static inline bool browser_is_record_row(int i) { return i == s_idx.count; }
+static inline bool browser_is_layer_row(int i) { return i == s_idx.count + 1; }
+static inline bool browser_is_stretch_row(int i) { return i == s_idx.count + 2; }
 
 // ─────────────────────────── Waveform state (UI) ─────────────────────────
 static const int16_t* s_samples     = 0;    // Q15 pointer in PSRAM
@@ -91,21 +100,53 @@ void browser_render_sample_list() {
 
   // Body (paged list)
   const int visible = 7; // rows that fit your font/height
-  const int end     = (s_top + visible <= s_idx.count) ? (s_top + visible) : s_idx.count;
+  const int end     = (s_top + visible <= browser_rows()) ? (s_top + visible) : browser_rows();
 
   for (int i = s_top; i < end; ++i) {
     char line[64];
+    if (browser_is_record_row(i)) {
+      snprintf(line, sizeof(line), "%c [Record input]", (i == s_sel) ? '>' : ' ');
+      view_print_line(line);
+      continue;
+    }
+    if (browser_is_layer_row(i)) {
+      // Balance as the share of layer 2, set by turning in the waveform view
+      const char* held = storage_layer_name();
+      if (held) snprintf(line, sizeof(line), "%c [Layer 2: %s %u%%]", (i == s_sel) ? '>' : ' ', held,
+                         (unsigned)((ae_render_get_layer_mix() * 100u + 16383u) / 32767u));
+      else      snprintf(line, sizeof(line), "%c [Layer 2: hold current]", (i == s_sel) ? '>' : ' ');
+      view_print_line(line);
+      continue;
+    }
+    if (browser_is_stretch_row(i)) {
+      snprintf(line, sizeof(line), "%c [Stretch: %s]", (i == s_sel) ? '>' : ' ',
+               ae_render_get_stretch() ? "on" : "off");
+      view_print_line(line);
+      continue;
+    }
     char sizeStr[16];
     sd_format_size(s_idx.sizes[i], sizeStr, sizeof(sizeStr));
     const char marker = (i == s_sel) ? '>' : ' ';
-    snprintf(line, sizeof(line), "%c %s (%s)", marker, s_idx.names[i], sizeStr);
+    // '*' pinned, '+' resident in the PSRAM cache
+    const char cached = storage_cache_is_pinned(s_idx.names[i])   ? '*'
+                      : storage_cache_is_resident(s_idx.names[i]) ? '+' : ' ';
+    snprintf(line, sizeof(line), "%c%c%s (%s)", marker, cached, s_idx.names[i], sizeStr);
     view_print_line(line);
   }
 
-  // Footer (selection position)
+  // Footer (selection position, then any output underruns and near misses
+  // since boot, with the least slack in samples, for reporting glitches)
   {
-    char footer[16];
-    snprintf(footer, sizeof(footer), "%d/%d", (s_sel + 1), s_idx.count);
+    char footer[48];
+    AudioHealth health;
+    audio_health_read(&health);
+    if (health.underruns || health.near_misses) {
+      snprintf(footer, sizeof(footer), "%d/%d  xrun %lu near %lu min %ld smp", (s_sel + 1), browser_rows(),
+               (unsigned long)health.underruns, (unsigned long)health.near_misses,
+               (long)(health.slack_min / (PWM_RESOLUTION + 1)));
+    } else {
+      snprintf(footer, sizeof(footer), "%d/%d", (s_sel + 1), browser_rows());
+    }
     view_print_line(footer);
   }
 
@@ -183,8 +224,10 @@ void display_tick(void) {
       const char* path = s_idx.names[s_pendingIdx];
       uint32_t bytesRead = 0, required = 0;
       float mbps = 0.0f;
+      bool cached = false;
 
-      const bool ok = storage_load_sample_q15_psram(path, &mbps, &bytesRead, &required);
+      const bool ok = storage_load_sample_q15_psram(path, &mbps, &bytesRead, &required,
+                                                    &s_idx.info[s_pendingIdx], &cached);
 
       // Status lines (keep it text-only here)
       {
@@ -192,7 +235,8 @@ void display_tick(void) {
         if (ok) {
           char sizeBuf[16];
           sd_format_size(bytesRead, sizeBuf, sizeof(sizeBuf));
-          snprintf(line, sizeof(line), "Speed: %.2f MB/s", mbps);
+          if (cached) snprintf(line, sizeof(line), "Resident in PSRAM");
+          else        snprintf(line, sizeof(line), "Speed: %.2f MB/s", mbps);
           view_print_line(line);
           snprintf(line, sizeof(line), "✓ Loaded %s (%u samples)", sizeBuf, (unsigned)(bytesRead / 2));
           view_print_line(line);
@@ -226,7 +270,8 @@ void display_tick(void) {
     #else
         // Normal waveform behavior
         if (audioData && audioSampleCount > 0u) {
-          waveform_init((const int16_t*)audioData, audioSampleCount, currentWav.sampleRate);
+          waveform_init((const int16_t*)audioData, audioSampleCount, currentWav.sampleRate,
+                        storage_wave_pyramid());
           waveform_draw();
           s_state = DS_WAVEFORM;
         } else {
@@ -243,6 +288,25 @@ void display_tick(void) {
       audio_engine_play(true);
       break;
 
+    case DS_RECORDING: {
+      if (storage_record_full()) {
+        display_on_button();              // Same as pressing stop
+        break;
+      }
+      const uint32_t tenths = (uint32_t)((uint64_t)storage_record_samples() * 10u / (uint32_t)audio_rate);
+      if (tenths != s_recShownTenths) {
+        s_recShownTenths = tenths;
+        char line[40];
+        view_clear_log();
+        view_print_line("Recording input");
+        snprintf(line, sizeof(line), "%u.%u s / %u s", (unsigned)(tenths / 10u), (unsigned)(tenths % 10u),
+                 (unsigned)RECORD_MAX_SECONDS);
+        view_print_line(line);
+        view_print_line("Press to stop");
+        view_flush_if_dirty();
+      }
+    } break;
+
     case DS_BROWSER:
     default:
       // Browser view is static until user interaction
@@ -266,11 +330,9 @@ void display_on_turn(int8_t inc) {
     } break;
 
     case DS_BROWSER: {
-      if (s_idx.count == 0) return;
-
       int next = s_sel + (int)inc;
       if (next < 0) next = 0;
-      if (next >= s_idx.count) next = s_idx.count - 1;
+      if (next >= browser_rows()) next = browser_rows() - 1;
 
       if (next != s_sel) {
         s_sel = next;
@@ -302,7 +364,26 @@ void display_on_button(void) {
     } break;
 
     case DS_BROWSER: {
-      if (s_idx.count == 0) return;
+      if (browser_is_record_row(s_sel)) {
+        if (storage_record_begin()) {
+          s_recShownTenths = 0xFFFFFFFFu;
+          s_state = DS_RECORDING;
+          s_pendingUpdate = true;
+        } else {
+          render_status_line("Record failed (no PSRAM?)");  // List returns on the next turn
+        }
+        return;
+      }
+      if (browser_is_layer_row(s_sel)) {
+        storage_layer_toggle_current();
+        browser_render_sample_list();
+        return;
+      }
+      if (browser_is_stretch_row(s_sel)) {
+        ae_render_set_stretch(!ae_render_get_stretch());
+        browser_render_sample_list();
+        return;
+      }
 
       // Capture selection and transition to LOADING
       s_pendingIdx = s_sel;
@@ -312,6 +393,19 @@ void display_on_button(void) {
       s_pendingUpdate = true;
     } break;
 
+    case DS_RECORDING: {
+      // Stop: the take becomes the current sample, shown like a loaded file
+      if (storage_record_end()) {
+        render_status_line("✓ Recorded");
+        s_tDelayUntil = millis() + 1000u;   // UX: same pause as a load
+        s_state = DS_DELAY_TO_WAVEFORM;
+      } else {
+        s_state = DS_BROWSER;
+        browser_render_sample_list();
+      }
+      s_pendingUpdate = true;
+    } break;
+
     // Ignore extra presses during load/delay/setup
     case DS_SETUP:
     case DS_LOADING:
@@ -321,6 +415,14 @@ void display_on_button(void) {
   }
 }
 
+// The press that starts a long press has already loaded (or left) the
+// sample, so the long press acts on whatever is current
+void display_on_long_press(void) {
+  if (s_state == DS_LOADING || s_state == DS_SETUP || s_state == DS_RECORDING) return;
+  storage_cache_toggle_pin_current();
+  if (s_state == DS_BROWSER) browser_render_sample_list();
+}
+
 // ────────────────────────── Timer Management ─────────────────────────────
 bool display_timer_begin(uint32_t fps) {
   if (s_timerActive) {
@@ -352,7 +454,7 @@ void display_timer_end(void) {
 }
 
 void display_debug_list_files(void) {
-  FileIndex idx;
+  static FileIndex idx;  // ~30 KB: too big for core 1's stack
   view_clear_log();
   view_print_line("=== WAV Files ===");
   if (!file_index_scan(idx)) {
@@ -406,7 +508,7 @@ void adc_debug_draw(void) {
     // Display raw and normalized values for each ADC channel
     for (int i = 0; i < NUM_ADC_INPUTS; i++) {
         char line[64];
-        uint16_t raw_value = adc_results_buf[i];
+        uint16_t raw_value = adc_results_buf[0][i];
         snprintf(line, sizeof(line), "CH%d: %4d", i, raw_value);
         view_print_line(line);
     }
@@ -25,7 +25,8 @@ enum DisplayState : uint8_t {
   DS_BROWSER,
   DS_LOADING,
   DS_DELAY_TO_WAVEFORM,
-  DS_WAVEFORM
+  DS_WAVEFORM,
+  DS_RECORDING          // Capturing the audio input (last browser row)
 #ifdef ADC_DEBUG
   ,DS_ADC_DEBUG         // Add ADC debug state
 #endif
@@ -35,7 +36,11 @@ DisplayState display_state(void);
 void display_set_state(DisplayState st);
 
 // Waveform subview (kept public; you don't call these from the sketch)
-void waveform_init(const int16_t* samples, uint32_t count, uint32_t sampleRate);
+struct WavePyramid;
+// pyramid: the sample's min/max envelope (storage_wave_pyramid()); columns
+// are drawn from it, reading samples only where it is too coarse
+void waveform_init(const int16_t* samples, uint32_t count, uint32_t sampleRate,
+                   const WavePyramid* pyramid);
 void waveform_draw(void);
 bool waveform_on_turn(int8_t inc);
 bool waveform_on_button(void);
@@ -57,6 +62,7 @@ void display_tick(void);
 // Forward encoder/button events
 void display_on_turn(int8_t inc);
 void display_on_button(void);
+void display_on_long_press(void);   // Pin/unpin the current sample in the cache
 
 // Optional: start/stop an internal timer that calls the ISR at 'fps'
 bool display_timer_begin(uint32_t fps);   // returns true if started
@@ -38,6 +38,7 @@
  */
 
 #include <Arduino.h>
+#include <pico.h>
 #include "EEncoder.h"
 #include "config_pins.h"        // ENC_A_PIN, ENC_B_PIN, ENC_BTN_PIN, ENC_COUNTS_PER_DETENT
 #include "ui_input.h"
@@ -70,8 +71,8 @@ void ui_octave_change_callback(RotarySwitch& oct) {
   // Serial.print("Octave changed to: "); Serial.println(oct.getPosition()); // DISABLED TO PREVENT POPS
 }
 
-// Function to get current octave switch position for audio engine
-uint8_t ui_get_octave_position() {
+// Function to get current octave switch position for audio engine (RAM: read per block)
+uint8_t __not_in_flash_func(ui_get_octave_position)() {
   return octave.getPosition();
 }
 
@@ -86,6 +87,10 @@ void ui_encoder_button_press_callback(EEncoder& /*enc*/) {
   display_on_button();
 }
 
+void ui_encoder_long_press_callback(EEncoder& /*enc*/) {
+  display_on_long_press();
+}
+
 /**
  * @brief Initialize the input system - ADC, encoders, and switches
  * 
@@ -110,7 +115,9 @@ void ui_input_init() {
   octave.setChangeHandler(ui_octave_change_callback);      // Octave switch changes
   s_enc.setEncoderHandler(ui_encoder_turn_callback);       // Encoder rotation
   s_enc.setButtonHandler(ui_encoder_button_press_callback); // Encoder button press
+  s_enc.setLongPressHandler(ui_encoder_long_press_callback); // Hold: pin current sample
   s_enc.setAcceleration(false); // Disable acceleration for precise control
+  s_enc.enablePioDecoder();     // Count encoder edges in PIO (falls back to polling)
 }
 
 /**
@@ -3,6 +3,7 @@
 #include "adc_filter.h"
 #include "audio_engine.h"
 #include "sf_globals_bridge.h"
+#include "storage_loader.h"
 #include "ui_display.h"
 
 namespace sf {
@@ -30,6 +31,7 @@ bool           s_wave_ready     = false;
 static const int16_t* s_samples     = 0;    // Q15 pointer in PSRAM
 static uint32_t       s_sampleCount = 0;
 static uint32_t       s_sampleRate  = 0;
+static const WavePyramid* s_pyramid = 0;    // Min/max envelope in SRAM
 
 static inline int adc12ToPx256(uint16_t v) {
   return (v * 256) >> 12;
@@ -65,10 +67,25 @@ static inline void draw_center_line_if_empty(void) {
 }
 
 // ───────────────────────────── Waveform view ─────────────────────────────
-void waveform_init(const int16_t* samples, uint32_t count, uint32_t sampleRate) {
+void waveform_init(const int16_t* samples, uint32_t count, uint32_t sampleRate,
+                   const WavePyramid* pyramid) {
   s_samples     = samples;
   s_sampleCount = count;
   s_sampleRate  = sampleRate;
+  s_pyramid     = (pyramid && pyramid->count == count) ? pyramid : 0;
+}
+
+// Min/max of samples [start, end): from the pyramid when it resolves the
+// span, so a column costs a few SRAM reads; from PSRAM only for spans
+// narrower than a pyramid bucket (deep zoom, few samples per column)
+static void column_minmax(uint32_t start, uint32_t end, int16_t& cmin, int16_t& cmax) {
+  if (s_pyramid && wave_pyramid_minmax(*s_pyramid, start, end, cmin, cmax)) return;
+  cmin = 32767; cmax = -32768;
+  for (uint32_t i = start; i < end; ++i) {
+    int16_t v = s_samples[i];
+    if (v < cmin) cmin = v;
+    if (v > cmax) cmax = v;
+  }
 }
 
 void waveform_draw(void) {
@@ -85,9 +102,14 @@ void waveform_draw(void) {
     return;
   }
 
-  // Peak estimate for normalization
+  // Peak for normalization: exact from the pyramid, else estimated
   int16_t peak = 1;
-  {
+  int16_t pmin, pmax;
+  if (s_pyramid && wave_pyramid_minmax(*s_pyramid, 0, s_sampleCount, pmin, pmax)) {
+    int32_t maxabs = (pmax > -(int32_t)pmin) ? pmax : -(int32_t)pmin;
+    if (maxabs > 32767) maxabs = 32767;
+    peak = (maxabs < 128) ? 128 : (int16_t)maxabs;
+  } else {
     const uint32_t step = (s_sampleCount > 4096u) ? (s_sampleCount / 4096u) : 1u;
     int16_t maxabs = 1;
     for (uint32_t i = 0; i < s_sampleCount; i += step) {
@@ -109,12 +131,8 @@ void waveform_draw(void) {
     if (end <= start) end = start + 1;
     if (end > s_sampleCount) end = s_sampleCount;
 
-    int16_t cmin =  32767, cmax = -32768;
-    for (uint32_t i = start; i < end; ++i) {
-      int16_t v = s_samples[i];
-      if (v < cmin) cmin = v;
-      if (v > cmax) cmax = v;
-    }
+    int16_t cmin, cmax;
+    column_minmax(start, end, cmin, cmax);
 
     int yMin = mid - ((int32_t)cmax * (H / 2)) / peak;
     int yMax = mid - ((int32_t)cmin * (H / 2)) / peak;
@@ -138,10 +156,18 @@ void waveform_draw(void) {
   gray4_send_buffer();
 }
 
-bool waveform_on_turn(int8_t /*inc*/) {
-  // Any input exits to browser in current UX
-  waveform_exit();
-  return false;
+// With a second layer held, turning sets the layer balance (32 detents end
+// to end); otherwise any input exits to browser
+bool waveform_on_turn(int8_t inc) {
+  if (!storage_layer_name()) {
+    waveform_exit();
+    return false;
+  }
+  int32_t mix = (int32_t)ae_render_get_layer_mix() + (int32_t)inc * 1024;
+  if (mix < 0) mix = 0;
+  if (mix > 32767) mix = 32767;
+  ae_render_set_layer_mix((uint16_t)mix);
+  return true;
 }
 
 bool waveform_on_button(void) {
@@ -243,6 +269,23 @@ void waveform_overlay_tick(void) {
   s_lastPlayheadPx  = ph1_px;
   s_lastPlayheadPx2 = ph2_px;
 
+  // Layer balance along the top row, repainted with the columns each tick
+  if (storage_layer_name()) {
+    gray4_draw_hline(0, (int)(((uint32_t)ae_render_get_layer_mix() * 255u) / 32767u), 0, 8);
+  }
+
+  // Output underrun marker: a block in the top right corner for a second
+  // after each one (counts in the browser footer)
+  static uint32_t s_lastUnderruns = 0;
+  static uint32_t s_underrunShownUntil = 0;
+  AudioHealth health;
+  audio_health_read(&health);
+  if (health.underruns != s_lastUnderruns) {
+    s_lastUnderruns = health.underruns;
+    s_underrunShownUntil = millis() + 1000u;
+  }
+  if ((int32_t)(s_underrunShownUntil - millis()) > 0) gray4_fill_rect(252, 0, 4, 4, 15);
+
   s_lastStartPx = act_start_px;
   s_lastEndPx   = act_end_px;
   gray4_send_buffer();
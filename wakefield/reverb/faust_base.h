@@ -0,0 +1,45 @@
+// Faust base classes shared by every generated Greyhole variant.
+// Generated files include this instead of carrying their own copy, so the
+// scalar and vector builds can live in one translation unit.
+#ifndef GREYHOLE_FAUST_BASE_H
+#define GREYHOLE_FAUST_BASE_H
+
+#ifndef FAUSTFLOAT
+#define FAUSTFLOAT float
+#endif
+
+class Meta {
+public:
+    virtual ~Meta() {}
+    virtual void declare(const char* key, const char* value) = 0;
+};
+
+class UI {
+public:
+    virtual ~UI() {}
+    virtual void openVerticalBox(const char* label) = 0;
+    virtual void openHorizontalBox(const char* label) = 0;
+    virtual void closeBox() = 0;
+    virtual void declare(void* zone, const char* key, const char* value) = 0;
+    virtual void addHorizontalSlider(const char* label, float* zone, float init, float min, float max, float step) = 0;
+};
+
+class dsp {
+public:
+    virtual ~dsp() {}
+    virtual int getNumInputs() = 0;
+    virtual int getNumOutputs() = 0;
+    virtual void buildUserInterface(UI* ui_interface) = 0;
+    virtual int getSampleRate() = 0;
+    virtual void init(int sample_rate) = 0;
+    virtual void instanceInit(int sample_rate) = 0;
+    virtual void instanceConstants(int sample_rate) = 0;
+    virtual void instanceResetUserInterface() = 0;
+    virtual void instanceClear() = 0;
+    virtual dsp* clone() = 0;
+    virtual void metadata(Meta* m) = 0;
+    virtual void compute(int count, FAUSTFLOAT** inputs, FAUSTFLOAT** outputs) = 0;
+};
+
+
+#endif // GREYHOLE_FAUST_BASE_H
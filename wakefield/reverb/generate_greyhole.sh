@@ -0,0 +1,47 @@
+#!/bin/sh
+# Regenerate the Greyhole reverb DSP variants used by src/reverb.cpp.
+#
+#   greyhole.cpp      scalar build (class mydsp), the default
+#   greyhole_vec.cpp  vector build (class mydsp_vec), compiled in with
+#                     -DWAKEFIELD_REVERB_VEC=ON
+#
+# greyhole_dsp.h is the older Faust 2.37 build of GreyholeRaw.dsp, kept only
+# so bench/greyhole_compare.cpp can check new output against it.
+#
+# Usage: reverb/generate_greyhole.sh [source.dsp]   (default: GreyholeRaw.dsp)
+set -e
+
+cd "$(dirname "$0")"
+SRC="${1:-GreyholeRaw.dsp}"
+COMMON="-lang cpp -ct 1 -es 1 -mcd 16 -mdd 1024 -mdy 33 -single -a greyhole_arch.cpp"
+
+# Faust fills the prime delay table (a copy of the waveform) in classInit.
+# Point the table at the waveform and make that constexpr instead, so init()
+# does no table work. Only valid while the table is the whole waveform.
+constexpr_tables() {
+    cn="$1"
+    file="$2"
+    size=$(sed -n "s/^const static int i${cn}SIG0Wave0\[\([0-9]*\)\].*/\1/p" "$file")
+    if [ -z "$size" ] || ! grep -q "fill${cn}SIG0($size, itbl0${cn}SIG0)" "$file"; then
+        echo "$file: prime table is not a plain copy of the waveform; left as generated" >&2
+        return 1
+    fi
+    sed -i \
+        -e "s/^const static int i${cn}SIG0Wave0\[/static constexpr int i${cn}SIG0Wave0[/" \
+        -e "/^class ${cn}SIG0 {/,/^static void delete${cn}SIG0(/d" \
+        -e "s/^static int itbl0${cn}SIG0\[[0-9]*\];/static constexpr const int* itbl0${cn}SIG0 = i${cn}SIG0Wave0;/" \
+        -e "/${cn}SIG0\* sig0 = new${cn}SIG0();/d" \
+        -e "/sig0->/d" \
+        -e "/delete${cn}SIG0(sig0);/d" \
+        "$file"
+}
+
+# Scalar: same options as the checked-in file
+faust $COMMON -ftz 0 -cn mydsp -o greyhole.cpp "$SRC"
+constexpr_tables mydsp greyhole.cpp
+
+# Vector: 32-frame loops, loop variant 1, flush-to-zero by bit mask
+faust $COMMON -vec -vs 32 -lv 1 -ftz 2 -cn mydsp_vec -o greyhole_vec.cpp "$SRC"
+constexpr_tables mydsp_vec greyhole_vec.cpp
+
+echo "Generated greyhole.cpp and greyhole_vec.cpp from $SRC"
@@ -0,0 +1,14 @@
+/* Minimal Faust architecture for the Greyhole reverb variants.
+ * Keeps the generated class plus the shared base classes; see
+ * generate_greyhole.sh. */
+
+#ifndef FAUSTFLOAT
+#define FAUSTFLOAT float
+#endif
+
+<<includeIntrinsic>>
+
+// Faust base classes
+#include "faust_base.h"
+
+<<includeclass>>
@@ -0,0 +1,303 @@
+#include "alsa_output.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cmath>
+#include <cstring>
+#include <poll.h>
+#include <pthread.h>
+#include <sched.h>
+#include <unistd.h>
+
+namespace {
+
+// Formats in order of preference: float is rendered into directly when
+// planar; the integer formats cover the common codecs
+const snd_pcm_format_t kFormats[] = {
+    SND_PCM_FORMAT_FLOAT_LE,
+    SND_PCM_FORMAT_S32_LE,
+    SND_PCM_FORMAT_S24_LE,
+    SND_PCM_FORMAT_S16_LE
+};
+
+template <typename T>
+inline void storeSample(char* dest, T value) {
+    std::memcpy(dest, &value, sizeof(T));
+}
+
+inline double clampSample(float value) {
+    return std::min(std::max(static_cast<double>(value), -1.0), 1.0);
+}
+
+} // namespace
+
+AlsaOutput::~AlsaOutput() {
+    close();
+}
+
+bool AlsaOutput::open(const std::string& device, unsigned int requestedRate, unsigned int requestedPeriod,
+                      unsigned int requestedPeriods, std::string& error) {
+    close();
+    int err = snd_pcm_open(&pcm, device.c_str(), SND_PCM_STREAM_PLAYBACK, SND_PCM_NONBLOCK);
+    if (err < 0) {
+        pcm = nullptr;
+        error = device + ": " + snd_strerror(err);
+        return false;
+    }
+
+    snd_pcm_hw_params_t* hw;
+    snd_pcm_hw_params_alloca(&hw);
+    snd_pcm_hw_params_any(pcm, hw);
+    // The device's own rate only: plug-layer resampling adds latency
+    snd_pcm_hw_params_set_rate_resample(pcm, hw, 0);
+
+    // Planar float first, then any format planar, then interleaved
+    format = SND_PCM_FORMAT_UNKNOWN;
+    const snd_pcm_access_t accesses[] = {SND_PCM_ACCESS_MMAP_NONINTERLEAVED, SND_PCM_ACCESS_MMAP_INTERLEAVED};
+    for (snd_pcm_access_t access : accesses) {
+        if (snd_pcm_hw_params_test_access(pcm, hw, access) < 0) {
+            continue;
+        }
+        for (snd_pcm_format_t candidate : kFormats) {
+            if (snd_pcm_hw_params_test_format(pcm, hw, candidate) == 0) {
+                snd_pcm_hw_params_set_access(pcm, hw, access);
+                snd_pcm_hw_params_set_format(pcm, hw, candidate);
+                format = candidate;
+                interleaved = access == SND_PCM_ACCESS_MMAP_INTERLEAVED;
+                break;
+            }
+        }
+        if (format != SND_PCM_FORMAT_UNKNOWN) {
+            break;
+        }
+    }
+    if (format == SND_PCM_FORMAT_UNKNOWN) {
+        error = device + ": no mmap access in a supported format";
+        close();
+        return false;
+    }
+
+    sampleRate = requestedRate;
+    snd_pcm_uframes_t period = requestedPeriod;
+    periods = std::max(requestedPeriods, 2u);
+    if ((err = snd_pcm_hw_params_set_channels(pcm, hw, 2)) < 0 ||
+        (err = snd_pcm_hw_params_set_rate_near(pcm, hw, &sampleRate, nullptr)) < 0 ||
+        (err = snd_pcm_hw_params_set_period_size_near(pcm, hw, &period, nullptr)) < 0 ||
+        (err = snd_pcm_hw_params_set_periods_near(pcm, hw, &periods, nullptr)) < 0 ||
+        (err = snd_pcm_hw_params(pcm, hw)) < 0) {
+        error = device + ": " + snd_strerror(err);
+        close();
+        return false;
+    }
+    periodFrames = static_cast<unsigned int>(period);
+
+    // Wake once a period is free; the stream is started by hand once the
+    // ring is primed
+    snd_pcm_sw_params_t* sw;
+    snd_pcm_sw_params_alloca(&sw);
+    snd_pcm_sw_params_current(pcm, sw);
+    snd_pcm_sw_params_set_avail_min(pcm, sw, period);
+    snd_pcm_sw_params_set_start_threshold(pcm, sw, period * periods);
+    if ((err = snd_pcm_sw_params(pcm, sw)) < 0) {
+        error = device + ": " + snd_strerror(err);
+        close();
+        return false;
+    }
+
+    direct = format == SND_PCM_FORMAT_FLOAT_LE && !interleaved;
+    scratchLeft.assign(direct ? 0 : periodFrames, 0.0f);
+    scratchRight.assign(direct ? 0 : periodFrames, 0.0f);
+    pollFds.resize(static_cast<size_t>(std::max(snd_pcm_poll_descriptors_count(pcm), 1)));
+    snd_pcm_poll_descriptors(pcm, pollFds.data(), static_cast<unsigned int>(pollFds.size()));
+    return true;
+}
+
+bool AlsaOutput::start(RenderFunction renderFunction, int priority, std::string& error) {
+    if (!pcm) {
+        error = "not open";
+        return false;
+    }
+    render = renderFunction;
+    running.store(true);
+    thread = std::thread(&AlsaOutput::run, this, priority);
+    return true;
+}
+
+void AlsaOutput::close() {
+    running.store(false);
+    if (thread.joinable()) {
+        thread.join();
+    }
+    if (pcm) {
+        snd_pcm_drop(pcm);
+        snd_pcm_close(pcm);
+        pcm = nullptr;
+    }
+}
+
+std::string AlsaOutput::getFormatName() const {
+    return std::string(snd_pcm_format_name(format)) + (interleaved ? " interleaved" : " planar");
+}
+
+void AlsaOutput::run(int priority) {
+    // rtsetup::configureAudioThread records what this got on the first period
+    if (priority > 0) {
+        sched_param param{};
+        param.sched_priority = priority;
+        pthread_setschedparam(pthread_self(), SCHED_FIFO, &param);
+    }
+
+    if (!fillSilence() || snd_pcm_start(pcm) < 0) {
+        failed.store(true);
+        return;
+    }
+
+    while (running.load(std::memory_order_relaxed)) {
+        // The timeout only bounds how long close() waits
+        int ready = poll(pollFds.data(), pollFds.size(), 200);
+        if (ready < 0 && errno != EINTR) {
+            failed.store(true);
+            return;
+        }
+        if (ready <= 0) {
+            continue;
+        }
+        unsigned short revents = 0;
+        snd_pcm_poll_descriptors_revents(pcm, pollFds.data(), static_cast<unsigned int>(pollFds.size()), &revents);
+        if (revents & POLLERR) {
+            const snd_pcm_state_t state = snd_pcm_state(pcm);
+            const int err = state == SND_PCM_STATE_SUSPENDED ? -ESTRPIPE
+                          : state == SND_PCM_STATE_XRUN ? -EPIPE : -ENODEV;
+            if (!recover(err)) {
+                return;
+            }
+            continue;
+        }
+        if (!(revents & POLLOUT)) {
+            continue;
+        }
+
+        snd_pcm_sframes_t avail = snd_pcm_avail_update(pcm);
+        if (avail < 0) {
+            if (!recover(static_cast<int>(avail))) {
+                return;
+            }
+            continue;
+        }
+        while (avail >= static_cast<snd_pcm_sframes_t>(periodFrames)) {
+            if (!renderPeriod(periodFrames)) {
+                break;
+            }
+            avail -= periodFrames;
+        }
+    }
+}
+
+bool AlsaOutput::renderPeriod(snd_pcm_uframes_t frames) {
+    while (frames > 0) {
+        const snd_pcm_channel_area_t* areas;
+        snd_pcm_uframes_t offset;
+        snd_pcm_uframes_t chunk = frames;
+        int err = snd_pcm_mmap_begin(pcm, &areas, &offset, &chunk);
+        if (err < 0) {
+            return recover(err);
+        }
+
+        const unsigned int n = static_cast<unsigned int>(chunk);
+        if (direct && areas[0].step == 32 && areas[1].step == 32) {
+            float* left = static_cast<float*>(areas[0].addr) + areas[0].first / 32 + offset;
+            float* right = static_cast<float*>(areas[1].addr) + areas[1].first / 32 + offset;
+            render(left, right, n, xrunPending);
+        } else {
+            render(scratchLeft.data(), scratchRight.data(), n, xrunPending);
+            writeConverted(areas, offset, scratchLeft.data(), scratchRight.data(), chunk);
+        }
+        xrunPending = false;
+
+        snd_pcm_sframes_t committed = snd_pcm_mmap_commit(pcm, offset, chunk);
+        if (committed < 0 || static_cast<snd_pcm_uframes_t>(committed) != chunk) {
+            return recover(committed < 0 ? static_cast<int>(committed) : -EPIPE);
+        }
+        frames -= chunk;
+    }
+    return true;
+}
+
+void AlsaOutput::writeConverted(const snd_pcm_channel_area_t* areas, snd_pcm_uframes_t offset,
+                                const float* left, const float* right, snd_pcm_uframes_t frames) {
+    const float* planes[2] = {left, right};
+    for (int c = 0; c < 2; ++c) {
+        const snd_pcm_channel_area_t& area = areas[c];
+        char* dest = static_cast<char*>(area.addr) + (area.first + offset * area.step) / 8;
+        const unsigned int stride = area.step / 8;
+        const float* source = planes[c];
+        switch (format) {
+            case SND_PCM_FORMAT_FLOAT_LE:
+                for (snd_pcm_uframes_t i = 0; i < frames; ++i, dest += stride) {
+                    storeSample(dest, source[i]);
+                }
+                break;
+            case SND_PCM_FORMAT_S32_LE:
+                for (snd_pcm_uframes_t i = 0; i < frames; ++i, dest += stride) {
+                    storeSample(dest, static_cast<int32_t>(std::lrint(clampSample(source[i]) * 2147483647.0)));
+                }
+                break;
+            case SND_PCM_FORMAT_S24_LE:
+                for (snd_pcm_uframes_t i = 0; i < frames; ++i, dest += stride) {
+                    storeSample(dest, static_cast<int32_t>(std::lrint(clampSample(source[i]) * 8388607.0)));
+                }
+                break;
+            default:
+                for (snd_pcm_uframes_t i = 0; i < frames; ++i, dest += stride) {
+                    storeSample(dest, static_cast<int16_t>(std::lrint(clampSample(source[i]) * 32767.0)));
+                }
+                break;
+        }
+    }
+}
+
+bool AlsaOutput::fillSilence() {
+    for (;;) {
+        snd_pcm_sframes_t avail = snd_pcm_avail_update(pcm);
+        if (avail < 0) {
+            return false;
+        }
+        if (avail == 0) {
+            return true;
+        }
+        const snd_pcm_channel_area_t* areas;
+        snd_pcm_uframes_t offset;
+        snd_pcm_uframes_t chunk = static_cast<snd_pcm_uframes_t>(avail);
+        if (snd_pcm_mmap_begin(pcm, &areas, &offset, &chunk) < 0) {
+            return false;
+        }
+        snd_pcm_areas_silence(areas, offset, 2, chunk, format);
+        if (snd_pcm_mmap_commit(pcm, offset, chunk) < 0) {
+            return false;
+        }
+    }
+}
+
+bool AlsaOutput::recover(int error) {
+    if (error == -ESTRPIPE) {
+        // Suspended: resume in place if the driver can, else start over
+        int err;
+        while ((err = snd_pcm_resume(pcm)) == -EAGAIN && running.load(std::memory_order_relaxed)) {
+            usleep(1000);
+        }
+        if (err == 0) {
+            return true;
+        }
+        error = -EPIPE;
+    }
+    if (error == -EPIPE) {
+        // Underrun: prime the ring with silence and restart straight away
+        xruns.fetch_add(1, std::memory_order_relaxed);
+        xrunPending = true;
+        if (snd_pcm_prepare(pcm) == 0 && fillSilence() && snd_pcm_start(pcm) == 0) {
+            return true;
+        }
+    }
+    failed.store(true);
+    return false;
+}
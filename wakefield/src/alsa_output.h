@@ -0,0 +1,87 @@
+#ifndef ALSA_OUTPUT_H
+#define ALSA_OUTPUT_H
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+#include <alsa/asoundlib.h>
+
+// Direct ALSA playback through the mmap interface (--alsa DEVICE, built
+// with -DWAKEFIELD_ALSA_MMAP=ON), for boards without JACK where RtAudio's
+// read/write path and its default periods cost too much latency. Our own
+// render thread sleeps in poll() on the PCM and renders each period into
+// the device ring between snd_pcm_mmap_begin and snd_pcm_mmap_commit.
+//
+// A planar float device is rendered into directly. Anything else (the
+// usual interleaved S16 or S32 codec) is rendered into two scratch planes
+// and converted into the ring in the same pass, still without a
+// write() copy. Periods down to 32 frames work; the ring holds `periods`
+// of them, two by default.
+//
+// An xrun re-prepares the PCM, fills the ring with silence and restarts
+// it at once; the next render call is flagged so it counts as an underrun.
+class AlsaOutput {
+public:
+    // Called on the render thread for each chunk of a period (a period
+    // splits where the ring wraps). xrun is set on the first call after a
+    // recovery
+    using RenderFunction = void (*)(float* left, float* right, unsigned int nFrames, bool xrun);
+
+    AlsaOutput() = default;
+    ~AlsaOutput();
+
+    // Open device (e.g. "hw:0,0") at sampleRate with periods of
+    // periodFrames. The device may round both; read them back after
+    bool open(const std::string& device, unsigned int sampleRate, unsigned int periodFrames,
+              unsigned int periods, std::string& error);
+
+    // Start the render thread, at SCHED_FIFO priority when priority > 0
+    bool start(RenderFunction render, int priority, std::string& error);
+
+    // Stop the render thread and close the device
+    void close();
+
+    unsigned int getSampleRate() const { return sampleRate; }
+    unsigned int getPeriodFrames() const { return periodFrames; }
+    unsigned int getPeriods() const { return periods; }
+    // Planar float, rendered into without conversion
+    bool isDirect() const { return direct; }
+    std::string getFormatName() const;
+    uint32_t getXruns() const { return xruns.load(std::memory_order_relaxed); }
+    // The device went away (unplugged, or an error recovery could not fix)
+    bool isFailed() const { return failed.load(std::memory_order_relaxed); }
+
+    AlsaOutput(const AlsaOutput&) = delete;
+    AlsaOutput& operator=(const AlsaOutput&) = delete;
+
+private:
+    void run(int priority);
+    bool renderPeriod(snd_pcm_uframes_t frames);
+    void writeConverted(const snd_pcm_channel_area_t* areas, snd_pcm_uframes_t offset,
+                        const float* left, const float* right, snd_pcm_uframes_t frames);
+    bool fillSilence();
+    bool recover(int error);
+
+    snd_pcm_t* pcm = nullptr;
+    snd_pcm_format_t format = SND_PCM_FORMAT_UNKNOWN;
+    bool interleaved = false;
+    bool direct = false;
+    unsigned int sampleRate = 0;
+    unsigned int periodFrames = 0;
+    unsigned int periods = 0;
+
+    RenderFunction render = nullptr;
+    std::vector<float> scratchLeft;     // Conversion path only
+    std::vector<float> scratchRight;
+    std::vector<struct pollfd> pollFds;
+    bool xrunPending = false;           // Render thread only
+
+    std::thread thread;
+    std::atomic<bool> running{false};
+    std::atomic<uint32_t> xruns{0};
+    std::atomic<bool> failed{false};
+};
+
+#endif // ALSA_OUTPUT_H
@@ -0,0 +1,243 @@
+#include "automation.h"
+#include "loop_manager.h"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+
+using Curve = AutomationTarget::Curve;
+
+// Same ids and ranges as applyNormalizedToParameter() in main.cpp, but
+// Current Loop spans every loop count --loops allows
+const AutomationTarget kTargets[] = {
+    {2,  "Attack",        0.001f, 30.0f,    Curve::LOG,
+     [](const SynthParamBlock& b) { return b.attack; },        [](SynthParamBlock& b, float v) { b.attack = v; }},
+    {3,  "Decay",         0.001f, 30.0f,    Curve::LOG,
+     [](const SynthParamBlock& b) { return b.decay; },         [](SynthParamBlock& b, float v) { b.decay = v; }},
+    {4,  "Sustain",       0.0f,   1.0f,     Curve::LINEAR,
+     [](const SynthParamBlock& b) { return b.sustain; },       [](SynthParamBlock& b, float v) { b.sustain = v; }},
+    {5,  "Release",       0.001f, 30.0f,    Curve::LOG,
+     [](const SynthParamBlock& b) { return b.release; },       [](SynthParamBlock& b, float v) { b.release = v; }},
+    {6,  "Master Volume", 0.0f,   1.0f,     Curve::LINEAR,
+     [](const SynthParamBlock& b) { return b.masterVolume; },  [](SynthParamBlock& b, float v) { b.masterVolume = v; }},
+    {10, "OSC1 Mode",     0.0f,   1.0f,     Curve::STEPPED,
+     [](const SynthParamBlock& b) { return float(b.osc[0].mode); }, [](SynthParamBlock& b, float v) { b.osc[0].mode = int(v); }},
+    {11, "OSC1 Freq",     20.0f,  2000.0f,  Curve::LOG,
+     [](const SynthParamBlock& b) { return b.osc[0].freq; },   [](SynthParamBlock& b, float v) { b.osc[0].freq = v; }},
+    {12, "OSC1 Morph",    0.0001f, 0.9999f, Curve::LINEAR,
+     [](const SynthParamBlock& b) { return b.osc[0].morph; },  [](SynthParamBlock& b, float v) { b.osc[0].morph = v; }},
+    {13, "OSC1 Duty",     0.0f,   1.0f,     Curve::LINEAR,
+     [](const SynthParamBlock& b) { return b.osc[0].duty; },   [](SynthParamBlock& b, float v) { b.osc[0].duty = v; }},
+    {14, "OSC1 Ratio",    0.125f, 16.0f,    Curve::LOG,
+     [](const SynthParamBlock& b) { return b.osc[0].ratio; },  [](SynthParamBlock& b, float v) { b.osc[0].ratio = v; }},
+    {15, "OSC1 Offset",   -1000.0f, 1000.0f, Curve::LINEAR,
+     [](const SynthParamBlock& b) { return b.osc[0].offset; }, [](SynthParamBlock& b, float v) { b.osc[0].offset = v; }},
+    {20, "Reverb Type",   0.0f,   6.0f,     Curve::STEPPED,
+     [](const SynthParamBlock& b) { return float(b.reverbType); }, [](SynthParamBlock& b, float v) { b.reverbType = int(v); }},
+    {21, "Reverb",        0.0f,   1.0f,     Curve::STEPPED,
+     [](const SynthParamBlock& b) { return b.reverbEnabled ? 1.0f : 0.0f; }, [](SynthParamBlock& b, float v) { b.reverbEnabled = v > 0.5f; }},
+    {22, "Delay Time",    0.0f,   1.0f,     Curve::LINEAR,
+     [](const SynthParamBlock& b) { return b.reverbDelayTime; }, [](SynthParamBlock& b, float v) { b.reverbDelayTime = v; }},
+    {23, "Size",          0.0f,   1.0f,     Curve::LINEAR,
+     [](const SynthParamBlock& b) { return b.reverbSize; },    [](SynthParamBlock& b, float v) { b.reverbSize = v; }},
+    {24, "Damping",       0.0f,   0.99f,    Curve::LINEAR,
+     [](const SynthParamBlock& b) { return b.reverbDamping; }, [](SynthParamBlock& b, float v) { b.reverbDamping = v; }},
+    {25, "Reverb Mix",    0.0f,   1.0f,     Curve::LINEAR,
+     [](const SynthParamBlock& b) { return b.reverbMix; },     [](SynthParamBlock& b, float v) { b.reverbMix = v; }},
+    {26, "Reverb Decay",  0.0f,   1.0f,     Curve::LINEAR,
+     [](const SynthParamBlock& b) { return b.reverbDecay; },   [](SynthParamBlock& b, float v) { b.reverbDecay = v; }},
+    {27, "Diffusion",     0.0f,   0.99f,    Curve::LINEAR,
+     [](const SynthParamBlock& b) { return b.reverbDiffusion; }, [](SynthParamBlock& b, float v) { b.reverbDiffusion = v; }},
+    {28, "Mod Depth",     0.0f,   1.0f,     Curve::LINEAR,
+     [](const SynthParamBlock& b) { return b.reverbModDepth; }, [](SynthParamBlock& b, float v) { b.reverbModDepth = v; }},
+    {29, "Mod Freq",      0.0f,   10.0f,    Curve::LINEAR,
+     [](const SynthParamBlock& b) { return b.reverbModFreq; }, [](SynthParamBlock& b, float v) { b.reverbModFreq = v; }},
+    {30, "Filter Type",   0.0f,   3.0f,     Curve::STEPPED,
+     [](const SynthParamBlock& b) { return float(b.filterType); }, [](SynthParamBlock& b, float v) { b.filterType = int(v); }},
+    {31, "Filter",        0.0f,   1.0f,     Curve::STEPPED,
+     [](const SynthParamBlock& b) { return b.filterEnabled ? 1.0f : 0.0f; }, [](SynthParamBlock& b, float v) { b.filterEnabled = v > 0.5f; }},
+    {32, "Cutoff",        20.0f,  20000.0f, Curve::LOG,
+     [](const SynthParamBlock& b) { return b.filterCutoff; },  [](SynthParamBlock& b, float v) { b.filterCutoff = v; }},
+    {33, "Filter Gain",   -24.0f, 24.0f,    Curve::LINEAR,
+     [](const SynthParamBlock& b) { return b.filterGain; },    [](SynthParamBlock& b, float v) { b.filterGain = v; }},
+    {40, "Current Loop",  0.0f,   MAX_LOOPS - 1.0f, Curve::STEPPED,
+     [](const SynthParamBlock& b) { return float(b.currentLoop); }, [](SynthParamBlock& b, float v) { b.currentLoop = int(v); }},
+    {41, "Overdub Mix",   0.0f,   1.0f,     Curve::LINEAR,
+     [](const SynthParamBlock& b) { return b.overdubMix; },    [](SynthParamBlock& b, float v) { b.overdubMix = v; }},
+};
+constexpr int kTargetCount = sizeof(kTargets) / sizeof(kTargets[0]);
+
+}  // namespace
+
+float AutomationTarget::normalize(const SynthParamBlock& block) const {
+    const float value = read(block);
+    float normalized;
+    switch (curve) {
+        case Curve::LOG:
+            normalized = std::log(std::max(value, min) / min) / std::log(max / min);
+            break;
+        case Curve::STEPPED:
+            // The middle of the value's step, which write() truncates back
+            normalized = (value - min + 0.5f) / (max - min);
+            break;
+        default:
+            normalized = (value - min) / (max - min);
+            break;
+    }
+    return std::clamp(normalized, 0.0f, 1.0f);
+}
+
+void AutomationTarget::apply(SynthParamBlock& block, float normalized) const {
+    switch (curve) {
+        case Curve::LOG:
+            write(block, std::exp(std::log(min) + normalized * (std::log(max) - std::log(min))));
+            break;
+        default:
+            // Stepped values truncate in write(), as in main.cpp
+            write(block, min + normalized * (max - min));
+            break;
+    }
+}
+
+float AutomationTarget::settle(float normalized) const {
+    if (curve != Curve::STEPPED) {
+        return normalized;
+    }
+    SynthParamBlock block;
+    apply(block, normalized);
+    return normalize(block);
+}
+
+const AutomationTarget* findAutomationTarget(int param) {
+    for (const AutomationTarget& target : kTargets) {
+        if (target.param == param) {
+            return &target;
+        }
+    }
+    return nullptr;
+}
+
+const AutomationTarget* getAutomationTargets(int& count) {
+    count = kTargetCount;
+    return kTargets;
+}
+
+uint16_t AutomationClip::quantize(float value) {
+    return static_cast<uint16_t>(std::clamp(value, 0.0f, 1.0f) * 65535.0f + 0.5f);
+}
+
+int AutomationClip::findLane(int param) const {
+    for (size_t i = 0; i < lanes.size(); ++i) {
+        if (lanes[i].param == param) {
+            return static_cast<int>(i);
+        }
+    }
+    return -1;
+}
+
+void AutomationClip::getPoints(int param, std::vector<Point>& points) const {
+    points.clear();
+    const int index = findLane(param);
+    if (index < 0) {
+        return;
+    }
+    const Lane& lane = lanes[index];
+    uint32_t tick = 0;
+    for (uint32_t i = lane.first; i < lane.first + lane.count; ++i) {
+        tick += deltas[i];
+        points.push_back({tick, toValue(values[i])});
+    }
+}
+
+void AutomationClip::setPoints(int param, std::vector<Point> points) {
+    if (param < 0 || param >= kMaxLanes) {
+        return;
+    }
+    std::stable_sort(points.begin(), points.end(),
+                     [](const Point& a, const Point& b) { return a.tick < b.tick; });
+    // The last of several points on one tick wins
+    size_t kept = 0;
+    for (size_t i = 0; i < points.size(); ++i) {
+        if (kept > 0 && points[kept - 1].tick == points[i].tick) {
+            points[kept - 1] = points[i];
+        } else {
+            points[kept++] = points[i];
+        }
+    }
+    points.resize(kept);
+
+    // Drop the old lane, closing the gap it leaves
+    const int index = findLane(param);
+    if (index >= 0) {
+        const Lane old = lanes[index];
+        deltas.erase(deltas.begin() + old.first, deltas.begin() + old.first + old.count);
+        values.erase(values.begin() + old.first, values.begin() + old.first + old.count);
+        lanes.erase(lanes.begin() + index);
+        for (Lane& lane : lanes) {
+            if (lane.first > old.first) {
+                lane.first -= old.count;
+            }
+        }
+    }
+    if (points.empty()) {
+        return;
+    }
+
+    // New lanes go at the end of the arrays; the lane list stays in param order
+    Lane lane{static_cast<uint8_t>(param), static_cast<uint32_t>(deltas.size()),
+              static_cast<uint32_t>(points.size())};
+    uint32_t previous = 0;
+    for (const Point& point : points) {
+        deltas.push_back(point.tick - previous);
+        values.push_back(quantize(point.value));
+        previous = point.tick;
+    }
+    auto position = std::lower_bound(lanes.begin(), lanes.end(), lane.param,
+                                     [](const Lane& a, uint8_t p) { return a.param < p; });
+    lanes.insert(position, lane);
+}
+
+void AutomationClip::overwrite(int param, uint32_t from, bool keepFrom, const Point* points, int count) {
+    if (count <= 0) {
+        return;
+    }
+    bool wrapped = false;
+    uint32_t previous = from;
+    for (int i = 0; i < count; ++i) {
+        wrapped = wrapped || points[i].tick < previous;
+        previous = points[i].tick;
+    }
+    const uint32_t to = points[count - 1].tick;
+
+    auto replaced = [&](uint32_t tick) {
+        const bool afterFrom = keepFrom ? tick > from : tick >= from;
+        return wrapped ? (afterFrom || tick <= to) : (afterFrom && tick <= to);
+    };
+
+    std::vector<Point> lane;
+    getPoints(param, lane);
+    lane.erase(std::remove_if(lane.begin(), lane.end(),
+                              [&](const Point& point) { return replaced(point.tick); }),
+               lane.end());
+    lane.insert(lane.end(), points, points + count);
+    setPoints(param, std::move(lane));
+}
+
+void AutomationClip::clear() {
+    lanes.clear();
+    deltas.clear();
+    values.clear();
+}
+
+bool AutomationClip::sameAs(const AutomationClip& other) const {
+    if (lanes.size() != other.lanes.size() || deltas != other.deltas || values != other.values) {
+        return false;
+    }
+    for (size_t i = 0; i < lanes.size(); ++i) {
+        if (lanes[i].param != other.lanes[i].param || lanes[i].first != other.lanes[i].first ||
+            lanes[i].count != other.lanes[i].count) {
+            return false;
+        }
+    }
+    return true;
+}
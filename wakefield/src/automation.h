@@ -0,0 +1,94 @@
+#ifndef AUTOMATION_H
+#define AUTOMATION_H
+
+#include <cstdint>
+#include <vector>
+#include "param_snapshot.h"
+
+// A parameter automation can move: the ids and ranges of
+// applyNormalizedToParameter() in main.cpp (the MIDI CC and OSC slots), so
+// lanes hold the same 0-1 values a controller sends
+struct AutomationTarget {
+    enum class Curve : uint8_t { LINEAR, LOG, STEPPED };
+
+    uint8_t param;
+    const char* name;
+    float min;
+    float max;
+    Curve curve;
+    float (*read)(const SynthParamBlock&);
+    void (*write)(SynthParamBlock&, float);
+
+    float normalize(const SynthParamBlock& block) const;
+    void apply(SynthParamBlock& block, float normalized) const;
+    // What normalize() reads back after apply(normalized): the middle of
+    // the step for a stepped parameter, normalized itself otherwise
+    float settle(float normalized) const;
+};
+
+// Every automatable parameter, in id order; nullptr for an id that isn't one
+const AutomationTarget* findAutomationTarget(int param);
+const AutomationTarget* getAutomationTargets(int& count);
+
+// One sequencer track's automation: a lane per parameter, each a sparse
+// list of (tick, value) events over the track's pattern loop. A tick is
+// 1/kTicksPerStep of a step at the pattern's resolution, so automation
+// follows tempo and resolution changes like the notes do.
+//
+// Every lane's events are stored back to back in two arrays: the distance
+// in ticks from the previous event of the lane (the first from tick 0) and
+// the value as a 16-bit fraction. The audio thread walks them with a cursor
+// per lane; the UI thread edits by decoding a lane, changing it and
+// encoding it again.
+class AutomationClip {
+public:
+    static constexpr uint32_t kTicksPerStep = 960;
+    static constexpr int kMaxLanes = 64;            // Parameter ids 0-63
+
+    struct Point {
+        uint32_t tick;
+        float value;                                // 0-1
+    };
+
+    struct Lane {
+        uint8_t param;
+        uint32_t first;                             // Into the event arrays
+        uint32_t count;
+    };
+
+    static uint16_t quantize(float value);
+    static float toValue(uint16_t quantized) { return quantized * (1.0f / 65535.0f); }
+
+    bool empty() const { return lanes.empty(); }
+    int getLaneCount() const { return static_cast<int>(lanes.size()); }
+    const Lane& getLane(int index) const { return lanes[index]; }
+    uint32_t getEventCount() const { return static_cast<uint32_t>(deltas.size()); }
+    const uint32_t* getDeltas() const { return deltas.data(); }
+    const uint16_t* getValues() const { return values.data(); }
+
+    // UI thread. A lane's events in tick order (empty if it has none)
+    void getPoints(int param, std::vector<Point>& points) const;
+    // Replace a lane's events (any order; a tick given twice keeps the
+    // last); an empty list removes the lane
+    void setPoints(int param, std::vector<Point> points);
+
+    // Recording: replace the lane's events from `from` through the last of
+    // points, which are in recording order and wrap past the end of the
+    // loop back to tick 0 when their ticks do. An event on `from` itself is
+    // kept when keepFrom is set (the previous batch's last point)
+    void overwrite(int param, uint32_t from, bool keepFrom, const Point* points, int count);
+
+    void clearLane(int param) { setPoints(param, {}); }
+    void clear();
+
+    bool sameAs(const AutomationClip& other) const;
+
+private:
+    int findLane(int param) const;
+
+    std::vector<Lane> lanes;            // In param order
+    std::vector<uint32_t> deltas;
+    std::vector<uint16_t> values;
+};
+
+#endif // AUTOMATION_H
@@ -1,73 +1,33 @@
 #include "brainwave_osc.h"
+#include "brainwave_tables.h"
+#include "fastmath.h"
 #include <algorithm>
 #include <cmath>
 
-// Classic Casio CZ style phase distortion for sawtooth with extended morph range
-static float generatePhaseDistorted(float phase, float amount) {
+// Tanh-shaped pulse (morph 0 = sine, 1 = hard square), evaluated via lookup
+static float generateTanhShaped(const BrainwaveTables& tables, float phase, float morph, float duty) {
     // phase is normalized [0, 1)
-    // amount: 0.0 = sawtooth pointing top-left (peak at left)
-    // amount: 0.5 = sine wave (centered peak)
-    // amount: 1.0 = sawtooth pointing top-right (peak at right)
-    // Creates visually symmetrical morphing
-
-    float clamped = std::min(std::max(amount, 0.0f), 1.0f);
-    bool mirror = false;
-    float morphAmount = clamped;
-
-    // For morph 0.0-0.5, we mirror the phase and remap to 0.5-1.0 range
-    if (clamped < 0.5f) {
-        mirror = true;
-        morphAmount = 1.0f - clamped * 2.0f;  // 0.0 -> 1.0, 0.5 -> 0.0
-        morphAmount = 0.5f + morphAmount * 0.5f;  // Map to 0.5-1.0
-    }
-
-    // After remapping, morphAmount is always in range [0.5, 1.0]
-    // morphAmount 0.5 -> pivot 0.5 (sine wave)
-    // morphAmount 1.0 -> pivot 0.9999 (sharp sawtooth)
-    float t = (morphAmount - 0.5f) * 2.0f;  // 0 at morphAmount=0.5, 1 at morphAmount=1.0
-    float pivot = 0.5f + 0.4999f * t;
-    pivot = std::min(std::max(pivot, 0.0001f), 0.9999f);
-
-    // Mirror phase for left-side morphing (flip horizontally)
-    float workingPhase = mirror ? (1.0f - phase) : phase;
-
-    float shapedPhase;
-    if (workingPhase <= pivot) {
-        float denom = std::max(1e-6f, 2.0f * pivot);
-        shapedPhase = workingPhase / denom;
-    } else {
-        float denom = std::max(1e-6f, 1.0f - pivot);
-        shapedPhase = 0.5f * (1.0f + ((workingPhase - pivot) / denom));
-    }
-
-    // No vertical inversion - just horizontal mirroring via phase
-    float output = -std::cos(shapedPhase * 2.0f * static_cast<float>(M_PI));
-    return output;
-}
-
-// Generate waveform with tanh-shaped pulse (morph 0.5 to 1.0)
-static float generateTanhShaped(float phase, float morph, float duty) {
-    // phase is normalized [0, 1)
-    const float twoPi = 2.0f * M_PI;
-    float sine = std::sin(twoPi * phase);
+    float sine = tables.sine(phase);
 
     // Map morph to edge parameter (0 = sine, 1 = hard square)
     float edge = std::min(std::max(morph, 0.0f), 1.0f);
-    edge = std::min(std::max(edge, 0.0f), 1.0f);
 
     // When edge is very small, just return a pure sine wave.
     if (edge < 1e-3f) {
         return sine;
     }
 
-    // Map duty to comparator bias
-    float theta = twoPi * (duty - 0.5f);
-    float x = sine - std::sin(theta);
+    // Map duty to comparator bias: sin(2*pi*(duty - 0.5))
+    float thetaPhase = duty - 0.5f;
+    if (thetaPhase < 0.0f) {
+        thetaPhase += 1.0f;
+    }
+    float x = sine - tables.sine(thetaPhase);
     
     // Edge hardness control
     float beta = 1.0f + 80.0f * edge;
     
-    float tanh_pulse = std::tanh(beta * x);
+    float tanh_pulse = tables.tanh(beta * x);
 
     // Crossfade from sine to tanh pulse based on edge to ensure smooth transition
     return (1.0f - edge) * sine + edge * tanh_pulse;
@@ -83,7 +43,8 @@ BrainwaveOscillator::BrainwaveOscillator()
     , ratio_(1.0f)
     , offsetHz_(0.0f)
     , fmSensitivity_(0.5f)  // Default FM sensitivity
-    , phaseAccumulator_(0) {
+    , phaseAccumulator_(0)
+    , tables_(&BrainwaveTables::instance()) {  // Builds the tables on first construction
 }
 
 float BrainwaveOscillator::calculateEffectiveFrequency(float sampleRate) {
@@ -106,26 +67,25 @@ float BrainwaveOscillator::calculateEffectiveFrequency(float sampleRate) {
     return freq;
 }
 
-float BrainwaveOscillator::generateSample(uint32_t phase, float morphPos) {
-    // Convert 32-bit phase accumulator to normalized phase (0.0 to 1.0)
-    float normalizedPhase = static_cast<double>(phase) / 4294967296.0;
-    
+float BrainwaveOscillator::generateSample(uint32_t phase, float morphPos, uint32_t increment) {
     float morphAmount = std::min(std::max(morphPos, 0.0f), 1.0f);
 
     if (shape_ == BrainwaveShape::SAW) {
-        return generatePhaseDistorted(normalizedPhase, morphAmount);
+        // Band-limited morph frames picked by the current pitch
+        return tables_->saw(phase, morphAmount, BrainwaveTables::levelForIncrement(increment));
     }
 
+    // Top 24 bits of the accumulator give an exact float phase in [0, 1)
+    float normalizedPhase = static_cast<float>(phase >> 8) * (1.0f / 16777216.0f);
     float shiftedPhase = normalizedPhase + 0.5f;
     if (shiftedPhase >= 1.0f) {
         shiftedPhase -= 1.0f;
     }
-    return generateTanhShaped(shiftedPhase, morphAmount, duty_);
+    return generateTanhShaped(*tables_, shiftedPhase, morphAmount, duty_);
 }
 
-float BrainwaveOscillator::process(float sampleRate, float fmInput,
-                                   float pitchMod, float morphMod, float dutyMod,
-                                   float ratioMod, float offsetMod) {
+uint32_t BrainwaveOscillator::calculatePhaseIncrement(float sampleRate, float fmInput, float pitchMod,
+                                                      float ratioMod, float offsetMod, bool& negative) const {
     // Calculate base frequency (FREE or KEY mode)
     float freq = 0.0f;
     if (mode_ == BrainwaveMode::FREE) {
@@ -136,7 +96,7 @@ float BrainwaveOscillator::process(float sampleRate, float fmInput,
 
     // Apply pitch modulation as frequency multiplier (pitchMod is in octaves)
     // This applies AFTER mode selection but BEFORE ratio/offset
-    float pitchMultiplier = std::pow(2.0f, pitchMod);
+    float pitchMultiplier = fastmath::exp2(pitchMod);
     freq *= pitchMultiplier;
 
     // Apply modulated ratio and offset
@@ -155,7 +115,7 @@ float BrainwaveOscillator::process(float sampleRate, float fmInput,
 
     // TZFM: Allow negative frequencies (through-zero)
     // Negative frequency = phase runs backward
-    bool isNegative = modulatedFreq < 0.0f;
+    negative = modulatedFreq < 0.0f;
     float absFreq = std::abs(modulatedFreq);
 
     // Prevent extremely high frequencies that could cause aliasing
@@ -163,7 +123,23 @@ float BrainwaveOscillator::process(float sampleRate, float fmInput,
 
     // Calculate phase increment using double precision
     double phaseIncrementDouble = (static_cast<double>(absFreq) * 4294967296.0) / static_cast<double>(sampleRate);
-    uint32_t phaseIncrement = static_cast<uint32_t>(phaseIncrementDouble);
+    return static_cast<uint32_t>(phaseIncrementDouble);
+}
+
+void BrainwaveOscillator::advance(float sampleRate, int n, float pitchMod, float ratioMod, float offsetMod) {
+    bool isNegative = false;
+    const uint32_t phaseIncrement = calculatePhaseIncrement(sampleRate, 0.0f, pitchMod, ratioMod, offsetMod,
+                                                            isNegative);
+    // Without FM the frequency never goes below zero
+    phaseAccumulator_ += phaseIncrement * static_cast<uint32_t>(n);
+}
+
+float BrainwaveOscillator::process(float sampleRate, float fmInput,
+                                   float pitchMod, float morphMod, float dutyMod,
+                                   float ratioMod, float offsetMod) {
+    bool isNegative = false;
+    const uint32_t phaseIncrement = calculatePhaseIncrement(sampleRate, fmInput, pitchMod, ratioMod, offsetMod,
+                                                            isNegative);
 
     // Apply morph and duty modulation
     float modulatedMorph = std::min(std::max(morphPosition_ + morphMod, 0.0f), 1.0f);
@@ -172,7 +148,7 @@ float BrainwaveOscillator::process(float sampleRate, float fmInput,
     // Temporarily override duty_ for this sample (generateSample uses member variable)
     float savedDuty = duty_;
     duty_ = modulatedDuty;
-    float sample = generateSample(phaseAccumulator_, modulatedMorph);
+    float sample = generateSample(phaseAccumulator_, modulatedMorph, phaseIncrement);
     duty_ = savedDuty;
 
     // Advance or reverse phase depending on frequency sign (TZFM)
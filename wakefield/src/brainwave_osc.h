@@ -4,6 +4,8 @@
 #include <cstdint>
 #include <cmath>
 
+class BrainwaveTables;
+
 // Brainwave oscillator modes
 enum class BrainwaveMode {
     FREE = 0,  // Free-running, user controls frequency
@@ -32,7 +34,7 @@ public:
     void setOffset(float offsetHz) { offsetHz_ = offsetHz; }
     float getOffset() const { return offsetHz_; }
     
-    // Morph control (0.0 to 1.0, maps to frames 0-255)
+    // Morph control (0.0 to 1.0, interpolated across the saw's morph frames)
     void setMorph(float morph) { morphPosition_ = morph; }
     float getMorph() const { return morphPosition_; }
     
@@ -57,8 +59,17 @@ public:
                   float pitchMod = 0.0f, float morphMod = 0.0f, float dutyMod = 0.0f,
                   float ratioMod = 0.0f, float offsetMod = 0.0f);
 
+    // Advance the phase by n samples without rendering them (no FM input),
+    // as n process() calls would; keeps a skipped oscillator in step
+    void advance(float sampleRate, int n, float pitchMod = 0.0f,
+                 float ratioMod = 0.0f, float offsetMod = 0.0f);
+
     // Reset phase
     void reset() { phaseAccumulator_ = 0; }
+
+    // Raw phase access (used by the SoA voice bank)
+    uint32_t getPhase() const { return phaseAccumulator_; }
+    void setPhase(uint32_t phase) { phaseAccumulator_ = phase; }
     
 private:
     BrainwaveMode mode_;
@@ -74,9 +85,14 @@ private:
     // Phase accumulator (32-bit for high precision)
     uint32_t phaseAccumulator_;
     
+    // Shared lookup tables (see brainwave_tables.h)
+    const BrainwaveTables* tables_;
+    
     // Helper functions
     float calculateEffectiveFrequency(float sampleRate);
-    float generateSample(uint32_t phase, float morphPos);
+    uint32_t calculatePhaseIncrement(float sampleRate, float fmInput, float pitchMod,
+                                     float ratioMod, float offsetMod, bool& negative) const;
+    float generateSample(uint32_t phase, float morphPos, uint32_t increment);
 };
 
 #endif // BRAINWAVE_OSC_H
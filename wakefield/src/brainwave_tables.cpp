@@ -0,0 +1,110 @@
+#include "brainwave_tables.h"
+#include <algorithm>
+#include <cmath>
+#include "../../shared/dsp/real_fft.h"
+
+namespace {
+
+// Unmirrored phase-distortion saw, t = 0 (sine) .. 1 (sharpest saw).
+// Same shaping as the direct evaluation it replaces.
+double phaseDistortedSaw(double phase, double t) {
+    double pivot = std::min(std::max(0.5 + 0.4999 * t, 0.0001), 0.9999);
+    double shaped;
+    if (phase <= pivot) {
+        shaped = phase / std::max(1e-6, 2.0 * pivot);
+    } else {
+        shaped = 0.5 * (1.0 + (phase - pivot) / std::max(1e-6, 1.0 - pivot));
+    }
+    return -std::cos(shaped * 2.0 * M_PI);
+}
+
+} // namespace
+
+const BrainwaveTables& BrainwaveTables::instance() {
+    static const BrainwaveTables tables;
+    return tables;
+}
+
+BrainwaveTables::BrainwaveTables()
+    : sawFrames(static_cast<size_t>(kMorphFrames) * SawLayout::kFrameSpan)
+    , sineTable(kTableSize + 1)
+    , tanhTable(kTanhSize + 1) {
+    const int sourceSize = SawLayout::kTopSize;
+    kernels::RealFFT analysis(sourceSize);
+    std::vector<float> source(sourceSize);
+    std::vector<float> re(sourceSize / 2 + 1);
+    std::vector<float> im(sourceSize / 2 + 1);
+    std::vector<kernels::RealFFT> synthesis;
+    for (int level = 0; level < kLevels; ++level) {
+        synthesis.emplace_back(SawLayout::levelSize(level));
+    }
+    // The inverse scales by size / 2; take out the forward's sourceSize too
+    const float scale = 2.0f / sourceSize;
+
+    for (int f = 0; f < kMorphFrames; ++f) {
+        double t = static_cast<double>(f) / (kMorphFrames - 1);
+        for (int n = 0; n < sourceSize; ++n) {
+            source[n] = static_cast<float>(phaseDistortedSaw(static_cast<double>(n) / sourceSize, t));
+        }
+        analysis.forward(source.data(), re.data(), im.data());
+
+        for (int level = 0; level < kLevels; ++level) {
+            // Keep DC and harmonics 1 .. maxHarmonic
+            const int size = SawLayout::levelSize(level);
+            const int maxHarmonic = SawLayout::maxHarmonic(level);
+            std::vector<float> bandRe(size / 2 + 1, 0.0f);
+            std::vector<float> bandIm(size / 2 + 1, 0.0f);
+            for (int h = 0; h <= maxHarmonic; ++h) {
+                bandRe[h] = re[h] * scale;
+                bandIm[h] = im[h] * scale;
+            }
+
+            float* out = &sawFrames[static_cast<size_t>(f) * SawLayout::kFrameSpan + SawLayout::levelOffset(level)];
+            synthesis[level].inverse(bandRe.data(), bandIm.data(), out);
+        }
+    }
+
+    for (int n = 0; n <= kTableSize; ++n) {
+        sineTable[n] = static_cast<float>(std::sin(2.0 * M_PI * n / kTableSize));
+    }
+    for (int n = 0; n <= kTanhSize; ++n) {
+        double x = -kTanhRange + 2.0 * kTanhRange * n / kTanhSize;
+        tanhTable[n] = static_cast<float>(std::tanh(x));
+    }
+}
+
+float BrainwaveTables::saw(uint32_t phase, float morph, int level) const {
+    // Mirrored half reads the frames backwards in time
+    bool mirror = morph < 0.5f;
+    float t = std::min(std::abs(2.0f * morph - 1.0f), 1.0f);
+    if (mirror) {
+        phase = 0u - phase;
+    }
+
+    float framePos = t * (kMorphFrames - 1);
+    int frameIndex = std::min(static_cast<int>(framePos), kMorphFrames - 2);
+    float frameFrac = framePos - static_cast<float>(frameIndex);
+
+    return SawCore::readMorph(frame(level, frameIndex), frame(level, frameIndex + 1), phase, level, frameFrac);
+}
+
+float BrainwaveTables::sine(float phase) const {
+    float pos = phase * kTableSize;
+    int index = static_cast<int>(pos);
+    float frac = pos - static_cast<float>(index);
+    index &= kTableSize - 1;
+    return sineTable[index] + (sineTable[index + 1] - sineTable[index]) * frac;
+}
+
+float BrainwaveTables::tanh(float x) const {
+    if (x >= kTanhRange) {
+        return 1.0f;
+    }
+    if (x <= -kTanhRange) {
+        return -1.0f;
+    }
+    float pos = (x + kTanhRange) * (kTanhSize / (2.0f * kTanhRange));
+    int index = std::min(static_cast<int>(pos), kTanhSize - 1);
+    float frac = pos - static_cast<float>(index);
+    return tanhTable[index] + (tanhTable[index + 1] - tanhTable[index]) * frac;
+}
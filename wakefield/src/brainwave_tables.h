@@ -0,0 +1,67 @@
+#ifndef BRAINWAVE_TABLES_H
+#define BRAINWAVE_TABLES_H
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+#include "../brainwave/pico/wavetable_core.h"
+
+// Precomputed waveforms for BrainwaveOscillator.
+//
+// SAW: the phase-distortion saw depends only on morph, so it is stored as
+// kMorphFrames frames spanning pivot 0.5 (sine) to 0.9999 (sharp saw). Each
+// frame is kept at kLevels band limits, one per octave, so the frame read for
+// a given phase increment has no partials above Nyquist. Morph positions
+// between frames are linearly interpolated, and morph < 0.5 reads the same
+// frames time-reversed (the mirrored saw). Frames use the mip layout and
+// reads of the wavetable core shared with the Pico sketch
+// (brainwave/pico/wavetable_core.h), with float samples.
+//
+// PULSE: sine and tanh lookup tables with linear interpolation replace the
+// per-sample std::sin/std::tanh of the tanh-shaped pulse.
+//
+// Tables are built once on first use (~0.6 MB); BrainwaveOscillator's
+// constructor touches them so that happens before the audio thread runs.
+class BrainwaveTables {
+public:
+    // Level k: 2048 >> k samples, harmonics <= 512 >> k
+    typedef wtcore::MipLayout<11, 10> SawLayout;
+    typedef wtcore::WavetableCore<SawLayout, wtcore::FloatSample> SawCore;
+
+    static constexpr int kTableBits = 10;
+    static constexpr int kTableSize = 1 << kTableBits;   // Samples in the sine table
+    static constexpr int kMorphFrames = 33;              // Frames across |2*morph - 1| in [0, 1]
+    static constexpr int kLevels = SawLayout::kLevels;
+    static constexpr float kTanhRange = 10.0f;           // tanh saturates to +-1 outside this
+
+    static const BrainwaveTables& instance();
+
+    // Band-limit level for a phase increment (2^32 = one cycle per sample)
+    static int levelForIncrement(uint32_t increment) {
+        return SawLayout::levelForIncrement(increment);
+    }
+
+    // Phase-distortion saw at morph in [0, 1]
+    float saw(uint32_t phase, float morph, int level) const;
+
+    // sin(2*pi*phase) for phase in [0, 1)
+    float sine(float phase) const;
+
+    float tanh(float x) const;
+
+private:
+    BrainwaveTables();
+
+    const float* frame(int level, int index) const {
+        return &sawFrames[static_cast<size_t>(index) * SawLayout::kFrameSpan + SawLayout::levelOffset(level)];
+    }
+
+    // [frame][SawLayout::kFrameSpan], all levels of a frame together
+    std::vector<float> sawFrames;
+    std::vector<float> sineTable;  // kTableSize + 1
+    std::vector<float> tanhTable;  // kTanhSize + 1 over [-kTanhRange, kTanhRange]
+
+    static constexpr int kTanhSize = 2048;
+};
+
+#endif // BRAINWAVE_TABLES_H
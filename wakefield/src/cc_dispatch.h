@@ -0,0 +1,81 @@
+#ifndef CC_DISPATCH_H
+#define CC_DISPATCH_H
+
+#include <cstdint>
+
+// What one MIDI controller drives, and how its 0-127 value is scaled
+struct CCTarget {
+    enum Kind : uint8_t {
+        PARAMETER,          // applyMIDICCToParameter(id): the parameter's own range
+        FILTER_CUTOFF,      // Legacy cutoff CC: 20 Hz - 20 kHz, logarithmic
+        PRESET_MORPH,       // 0-1, linear
+        LOOP_REC_PLAY,      // Loop buttons: press on values above 64
+        LOOP_OVERDUB,
+        LOOP_STOP,
+        LOOP_CLEAR
+    };
+
+    Kind kind;
+    uint8_t id;             // Parameter id for PARAMETER
+};
+
+// Controller number -> targets, so handling a CC is one indexed lookup
+// instead of comparing it against every mapping. Built by the audio thread
+// from the mapping atomics whenever SynthParameters::ccMapSerial moves.
+// A controller's targets run in the order they were added; a controller
+// with none costs a single load. 14-bit pairs or NRPN numbers would be
+// further entries of the same shape.
+class CCDispatchTable {
+public:
+    static constexpr int kControllers = 128;
+    static constexpr int kMaxTargets = 64;
+
+    uint32_t serial = ~0u;  // ccMapSerial this table was built from
+
+    void clear() {
+        for (int c = 0; c < kControllers; ++c) {
+            head[c] = -1;
+            tail[c] = -1;
+        }
+        count = 0;
+    }
+
+    // Ignores unmapped (negative) controllers, and targets past kMaxTargets
+    void add(int controller, CCTarget target) {
+        if (controller < 0 || controller >= kControllers || count == kMaxTargets) {
+            return;
+        }
+        const int16_t index = static_cast<int16_t>(count++);
+        entries[index] = Entry{target, -1};
+        if (tail[controller] < 0) {
+            head[controller] = index;
+        } else {
+            entries[tail[controller]].next = index;
+        }
+        tail[controller] = index;
+    }
+
+    // Call handle(target) for each target of controller
+    template <typename Handle>
+    void dispatch(int controller, Handle&& handle) const {
+        if (controller < 0 || controller >= kControllers) {
+            return;
+        }
+        for (int16_t i = head[controller]; i >= 0; i = entries[i].next) {
+            handle(entries[i].target);
+        }
+    }
+
+private:
+    struct Entry {
+        CCTarget target;
+        int16_t next;       // Next target of the same controller, -1 at the end
+    };
+
+    int16_t head[kControllers] = {};
+    int16_t tail[kControllers] = {};
+    Entry entries[kMaxTargets] = {};
+    int count = 0;
+};
+
+#endif // CC_DISPATCH_H
@@ -3,6 +3,8 @@
 
 #include <cmath>
 #include <atomic>
+#include <cstdint>
+#include "fastmath.h"
 
 /**
  * Chaos generator using the Ikeda map
@@ -84,6 +86,15 @@ public:
         }
     }
 
+    // Process nFrames samples, writing the X output and the matching Y
+    // output of each frame
+    void processBlock(float* xOut, float* yOut, unsigned int nFrames) {
+        for (unsigned int i = 0; i < nFrames; ++i) {
+            xOut[i] = process();
+            yOut[i] = getY();
+        }
+    }
+
     // Get Y output (secondary chaos output)
     float getY() const {
         if (fastMode) {
@@ -138,8 +149,9 @@ private:
 
         // x_{n+1} = 1 + u*(x_n*cos(t) - y_n*sin(t))
         // y_{n+1} = u*(x_n*sin(t) + y_n*cos(t))
-        double cosT = std::cos(t);
-        double sinT = std::sin(t);
+        // t stays within [-5.6, 0.4], inside fastmath's 2*pi accuracy range
+        double cosT = fastmath::cos(static_cast<float>(t));
+        double sinT = fastmath::sin(static_cast<float>(t));
 
         double newX = 1.0 + u * (x * cosT - y * sinT);
         double newY = u * (x * sinT + y * cosT);
@@ -164,4 +176,204 @@ private:
     double interpPhase;
 };
 
+/**
+ * The four ChaosGenerators of the synth, iterated together: one generator
+ * per lane of a 4-float GCC vector, so each Ikeda step, its sin/cos and the
+ * LINEAR/CUBIC/HOLD interpolation cost one vector op for all four. Every
+ * lane keeps its own chaos parameter, clock, interpolation mode and fast
+ * mode, and follows ChaosGenerator step for step.
+ *
+ * The state is float where ChaosGenerator's is double. From the same state
+ * one step agrees to within 1e-5; as with any chaotic map the trajectories
+ * then separate after a few dozen iterations, so the two agree on the
+ * attractor rather than sample for sample (bench/chaos_compare.cpp).
+ */
+class ChaosBank {
+public:
+    static constexpr int kLanes = 4;
+    typedef float Lanes __attribute__((vector_size(kLanes * sizeof(float))));
+    typedef int32_t LaneMask __attribute__((vector_size(kLanes * sizeof(int32_t))));
+
+    ChaosBank() {
+        for (int lane = 0; lane < kLanes; ++lane) {
+            u[lane] = 0.918f;
+            clockFrequency[lane] = 1.0f;
+        }
+        updateClockStep();
+    }
+
+    // Render nFrames of every lane: lane i's X into xOut[i] and Y into
+    // yOut[i]. A lane whose running flag is clear holds its state, so its
+    // output repeats. Null outputs advance the lanes without storing
+    void processBlock(float* const* xOut, float* const* yOut, const bool* running,
+                      unsigned int nFrames) {
+        LaneMask run = {};
+        for (int lane = 0; lane < kLanes; ++lane) run[lane] = running[lane] ? -1 : 0;
+        // Only running clocked lanes advance their clocks. The clocks stay
+        // double, so every lane iterates on the same frame as ChaosGenerator
+        const LaneMask clocked = run & ~fast;
+        const LaneMask iterating = run & fast;
+        const bool anyIterating = iterating[0] | iterating[1] | iterating[2] | iterating[3];
+        double activeClockStep[kLanes];
+        for (int lane = 0; lane < kLanes; ++lane) activeClockStep[lane] = clocked[lane] ? clockStep[lane] : 0.0;
+        const Lanes activeInterpStep = clocked ? interpStep : Lanes{};
+
+        for (unsigned int i = 0; i < nFrames; ++i) {
+            // Clocked lanes iterate when their clock wraps, fast lanes always
+            int wrappedBits = 0;
+            for (int lane = 0; lane < kLanes; ++lane) {
+                clockPhase[lane] += activeClockStep[lane];
+                const bool wrapped = clockPhase[lane] >= 1.0;
+                clockPhase[lane] -= wrapped ? 1.0 : 0.0;
+                wrappedBits |= static_cast<int>(wrapped) << lane;
+            }
+            const LaneMask trigger = laneMask(wrappedBits);
+
+            // Clocked lanes mostly wait, so the step is skipped when no lane moves
+            if (wrappedBits != 0 || anyIterating) {
+                const LaneMask advance = trigger | iterating;
+                prevX = trigger ? x : prevX;
+                prevY = trigger ? y : prevY;
+                Lanes nextX, nextY;
+                step(nextX, nextY);
+                x = advance ? nextX : x;
+                y = advance ? nextY : y;
+            }
+
+            const Lanes mu = trigger ? Lanes{} : interpPhase;
+            const Lanes next = mu + activeInterpStep;
+            interpPhase = next < 1.0f ? next : Lanes{} + 1.0f;
+
+            if (xOut) {
+                Lanes outX, outY;
+                outputs(outX, outY);
+                for (int lane = 0; lane < kLanes; ++lane) {
+                    xOut[lane][i] = outX[lane];
+                    yOut[lane][i] = outY[lane];
+                }
+            }
+        }
+    }
+
+    // Current output of one lane (the last rendered frame)
+    float getX(int lane) const {
+        Lanes outX, outY;
+        outputs(outX, outY);
+        return outX[lane];
+    }
+    float getY(int lane) const {
+        Lanes outX, outY;
+        outputs(outX, outY);
+        return outY[lane];
+    }
+
+    // Per-lane setters, with ChaosGenerator's ranges
+    void setChaosParameter(int lane, float chaos) { u[lane] = std::max(0.0f, std::min(1.0f, chaos)); }
+    void setClockFrequency(int lane, float freq) {
+        clockFrequency[lane] = std::max(0.01f, std::min(1000.0f, freq));
+        updateClockStep();
+    }
+    void setInterpMode(int lane, int mode) {
+        interpMode[lane] = std::max(0, std::min(2, mode));
+        hold[lane] = (interpMode[lane] == 2) ? -1 : 0;
+    }
+    void setFastMode(int lane, bool isFast) { fast[lane] = isFast ? -1 : 0; }
+    void setSampleRate(float sr) {
+        sampleRate = sr;
+        updateClockStep();
+    }
+    void reset(int lane) {
+        x[lane] = 0.1f;
+        y[lane] = 0.1f;
+        clockPhase[lane] = 0.0;
+        interpPhase[lane] = 0.0f;
+    }
+
+    // Getters
+    float getChaosParameter(int lane) const { return u[lane]; }
+    float getClockFrequency(int lane) const { return clockFrequency[lane]; }
+    int getInterpMode(int lane) const { return interpMode[lane]; }
+    bool getFastMode(int lane) const { return fast[lane] != 0; }
+
+private:
+    // All ones in the lanes whose bit is set
+    static LaneMask laneMask(int bits) {
+        return LaneMask{-(bits & 1), -((bits >> 1) & 1), -((bits >> 2) & 1), -((bits >> 3) & 1)};
+    }
+
+    static Lanes abs(Lanes v) { return v < 0.0f ? -v : v; }
+
+    // sin and cos of 2*pi*t: fastmath::sinTurns/cosTurns with the range
+    // reduction shared
+    static void sinCosTurns(Lanes t, Lanes& s, Lanes& c) {
+        const Lanes r = t - ((t + 12582912.0f) - 12582912.0f);  // [-0.5, 0.5]
+        const Lanes a = abs(r);
+        const Lanes folded = 0.25f - abs(0.25f - a);
+        const Lanes rs = r < 0.0f ? -folded : folded;
+        const Lanes rc = 0.25f - a;
+        s = sinPoly(rs);
+        c = sinPoly(rc);
+    }
+
+    // Minimax odd degree-9 fit of sin(2*pi*r) on [-0.25, 0.25], as fastmath
+    static Lanes sinPoly(Lanes r) {
+        const Lanes r2 = r * r;
+        Lanes p = Lanes{} + 39.535771f;
+        p = p * r2 - 76.549651f;
+        p = p * r2 + 81.600998f;
+        p = p * r2 - 41.341655f;
+        p = p * r2 + 6.2831852f;
+        return p * r;
+    }
+
+    // One Ikeda step of every lane
+    void step(Lanes& nextX, Lanes& nextY) const {
+        const Lanes t = 0.4f - 6.0f / (1.0f + x * x + y * y);
+        Lanes sinT, cosT;
+        sinCosTurns(t * 0.159154943091895336f, sinT, cosT);
+        nextX = 1.0f + u * (x * cosT - y * sinT);
+        nextY = u * (x * sinT + y * cosT);
+    }
+
+    // Interpolated outputs: fast lanes give the state, clocked lanes hold
+    // or interpolate from the previous state by interpPhase. ChaosGenerator's
+    // CUBIC takes both Hermite tangents as (p1 - p0), and with those the
+    // basis weights on p1 sum to mu, so CUBIC renders the LINEAR ramp
+    void outputs(Lanes& outX, Lanes& outY) const {
+        outX = prevX + (x - prevX) * interpPhase;
+        outY = prevY + (y - prevY) * interpPhase;
+        outX = hold ? prevX : outX;
+        outY = hold ? prevY : outY;
+        outX = fast ? x : outX;
+        outY = fast ? y : outY;
+    }
+
+    void updateClockStep() {
+        for (int lane = 0; lane < kLanes; ++lane) {
+            clockStep[lane] = static_cast<double>(clockFrequency[lane]) / sampleRate;
+            interpStep[lane] = static_cast<float>(clockStep[lane]);
+        }
+    }
+
+    // Ikeda map state
+    Lanes x = Lanes{} + 0.1f;
+    Lanes y = Lanes{} + 0.1f;
+    Lanes u = {};
+
+    // Clocking
+    float sampleRate = 48000.0f;
+    Lanes clockFrequency = {};   // Hz
+    double clockStep[kLanes] = {};     // clockFrequency / sampleRate
+    double clockPhase[kLanes] = {};
+    Lanes interpStep = {};       // clockStep in float
+
+    // Interpolation
+    int interpMode[kLanes] = {0, 0, 0, 0};  // 0=LINEAR, 1=CUBIC, 2=HOLD
+    LaneMask hold = {};          // All ones where interpMode is HOLD
+    LaneMask fast = {};          // All ones where fastMode is on
+    Lanes prevX = Lanes{} + 0.1f;
+    Lanes prevY = Lanes{} + 0.1f;
+    Lanes interpPhase = {};
+};
+
 #endif // CHAOS_H
@@ -0,0 +1,390 @@
+// CLAP entry point for the synth (wakefield.clap, -DWAKEFIELD_CLAP=ON):
+// translates host events, transport and buffers for PluginEngine, which
+// does the rest. One instrument, one stereo output, one note input
+// (CLAP notes or MIDI).
+#include <clap/clap.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+#include "plugin_engine.h"
+
+// The UI sources linked in for Synth refer to these (defined in main.cpp for synth)
+class LoopManager;
+class Sequencer;
+LoopManager* loopManager = nullptr;
+Sequencer* sequencer = nullptr;
+
+namespace {
+
+// Host events one process() call takes; more are dropped
+constexpr size_t kMaxEvents = 2048;
+
+const char* const kFeatures[] = {
+    CLAP_PLUGIN_FEATURE_INSTRUMENT,
+    CLAP_PLUGIN_FEATURE_SYNTHESIZER,
+    CLAP_PLUGIN_FEATURE_STEREO,
+    nullptr
+};
+
+const clap_plugin_descriptor_t kDescriptor = {
+    CLAP_VERSION_INIT,
+    "org.wakefield.synth",
+    "Wakefield",
+    "Wakefield",
+    "",
+    "",
+    "",
+    "1.0",
+    "Brainwave oscillators, samplers, reverb and loopers",
+    kFeatures
+};
+
+struct Plugin {
+    clap_plugin_t clap;
+    const clap_host_t* host;
+    PluginEngine engine;
+    std::vector<PluginEngine::Event> events;
+    uint32_t refillFrames = 0;      // Frames between loop storage refills
+    uint32_t framesSinceRefill = 0;
+};
+
+Plugin* self(const clap_plugin_t* plugin) {
+    return static_cast<Plugin*>(plugin->plugin_data);
+}
+
+// Append the engine's form of a host event, if it is one the engine takes
+void translate(const clap_event_header_t* header, std::vector<PluginEngine::Event>& events) {
+    if (header->space_id != CLAP_CORE_EVENT_SPACE_ID || events.size() == kMaxEvents) {
+        return;
+    }
+    PluginEngine::Event event{};
+    event.frame = header->time;
+    switch (header->type) {
+        case CLAP_EVENT_NOTE_ON:
+        case CLAP_EVENT_NOTE_OFF: {
+            const clap_event_note_t* note = reinterpret_cast<const clap_event_note_t*>(header);
+            if (note->key < 0 || note->key > 127) {
+                return;
+            }
+            event.type = header->type == CLAP_EVENT_NOTE_ON ? PluginEngine::Event::NOTE_ON
+                                                            : PluginEngine::Event::NOTE_OFF;
+            event.note = static_cast<uint8_t>(note->key);
+            event.velocity = static_cast<uint8_t>(std::min(std::max(note->velocity * 127.0 + 0.5, 1.0), 127.0));
+            break;
+        }
+        case CLAP_EVENT_MIDI: {
+            const clap_event_midi_t* midi = reinterpret_cast<const clap_event_midi_t*>(header);
+            const uint8_t status = midi->data[0] & 0xF0;
+            if (status == 0x90 && midi->data[2] > 0) {
+                event.type = PluginEngine::Event::NOTE_ON;
+                event.velocity = midi->data[2];
+            } else if (status == 0x80 || status == 0x90) {
+                event.type = PluginEngine::Event::NOTE_OFF;
+            } else {
+                return;
+            }
+            event.note = midi->data[1] & 0x7F;
+            break;
+        }
+        case CLAP_EVENT_PARAM_VALUE: {
+            const clap_event_param_value_t* param = reinterpret_cast<const clap_event_param_value_t*>(header);
+            event.type = PluginEngine::Event::PARAM;
+            event.param = param->param_id;
+            event.value = param->value;
+            break;
+        }
+        default:
+            return;
+    }
+    events.push_back(event);
+}
+
+void translateAll(const clap_input_events_t* in, std::vector<PluginEngine::Event>& events) {
+    events.clear();
+    const uint32_t count = in ? in->size(in) : 0;
+    for (uint32_t i = 0; i < count; ++i) {
+        translate(in->get(in, i), events);
+    }
+    // Hosts send events in time order; keep it so if one does not
+    std::stable_sort(events.begin(), events.end(),
+                     [](const PluginEngine::Event& a, const PluginEngine::Event& b) { return a.frame < b.frame; });
+}
+
+// ----- Plugin -----
+
+bool pluginInit(const clap_plugin_t*) {
+    return true;
+}
+
+void pluginDestroy(const clap_plugin_t* plugin) {
+    delete self(plugin);
+}
+
+bool pluginActivate(const clap_plugin_t* plugin, double sampleRate, uint32_t, uint32_t maxFrames) {
+    Plugin* p = self(plugin);
+    p->events.reserve(kMaxEvents);
+    p->refillFrames = static_cast<uint32_t>(sampleRate / 20.0);
+    p->framesSinceRefill = 0;
+    return p->engine.activate(sampleRate, maxFrames);
+}
+
+void pluginDeactivate(const clap_plugin_t* plugin) {
+    self(plugin)->engine.deactivate();
+}
+
+bool pluginStartProcessing(const clap_plugin_t*) {
+    return true;
+}
+
+void pluginStopProcessing(const clap_plugin_t*) {
+}
+
+void pluginReset(const clap_plugin_t*) {
+}
+
+clap_process_status pluginProcess(const clap_plugin_t* plugin, const clap_process_t* process) {
+    Plugin* p = self(plugin);
+    if (process->audio_outputs_count < 1 || process->audio_outputs[0].channel_count < 2) {
+        return CLAP_PROCESS_ERROR;
+    }
+    translateAll(process->in_events, p->events);
+
+    PluginEngine::Transport transport;
+    if (const clap_event_transport_t* t = process->transport) {
+        transport.valid = true;
+        transport.playing = (t->flags & CLAP_TRANSPORT_IS_PLAYING) != 0;
+        if (t->flags & CLAP_TRANSPORT_HAS_TEMPO) {
+            transport.tempo = t->tempo;
+        }
+        if (t->flags & CLAP_TRANSPORT_HAS_BEATS_TIMELINE) {
+            transport.beat = static_cast<double>(t->song_pos_beats) / CLAP_BEATTIME_FACTOR;
+        }
+    }
+
+    // The host's planes are rendered into directly
+    float* const* out = process->audio_outputs[0].data32;
+    p->engine.process(p->events.data(), static_cast<int>(p->events.size()), transport,
+                      out[0], out[1], process->frames_count);
+    process->audio_outputs[0].constant_mask = 0;
+
+    p->framesSinceRefill += process->frames_count;
+    if (p->framesSinceRefill >= p->refillFrames) {
+        p->framesSinceRefill = 0;
+        p->host->request_callback(p->host);
+    }
+    return CLAP_PROCESS_CONTINUE;
+}
+
+void pluginOnMainThread(const clap_plugin_t* plugin) {
+    self(plugin)->engine.refillStorage();
+}
+
+// ----- Audio ports: one stereo output -----
+
+uint32_t audioPortsCount(const clap_plugin_t*, bool isInput) {
+    return isInput ? 0 : 1;
+}
+
+bool audioPortsGet(const clap_plugin_t*, uint32_t index, bool isInput, clap_audio_port_info_t* info) {
+    if (isInput || index != 0) {
+        return false;
+    }
+    info->id = 0;
+    std::snprintf(info->name, sizeof(info->name), "%s", "Output");
+    info->flags = CLAP_AUDIO_PORT_IS_MAIN;
+    info->channel_count = 2;
+    info->port_type = CLAP_PORT_STEREO;
+    info->in_place_pair = CLAP_INVALID_ID;
+    return true;
+}
+
+const clap_plugin_audio_ports_t kAudioPorts = {audioPortsCount, audioPortsGet};
+
+// ----- Note ports: one input -----
+
+uint32_t notePortsCount(const clap_plugin_t*, bool isInput) {
+    return isInput ? 1 : 0;
+}
+
+bool notePortsGet(const clap_plugin_t*, uint32_t index, bool isInput, clap_note_port_info_t* info) {
+    if (!isInput || index != 0) {
+        return false;
+    }
+    info->id = 0;
+    info->supported_dialects = CLAP_NOTE_DIALECT_CLAP | CLAP_NOTE_DIALECT_MIDI;
+    info->preferred_dialect = CLAP_NOTE_DIALECT_CLAP;
+    std::snprintf(info->name, sizeof(info->name), "%s", "Notes");
+    return true;
+}
+
+const clap_plugin_note_ports_t kNotePorts = {notePortsCount, notePortsGet};
+
+// ----- Parameters -----
+
+uint32_t paramsCount(const clap_plugin_t*) {
+    return static_cast<uint32_t>(PluginEngine::getParamCount());
+}
+
+bool paramsGetInfo(const clap_plugin_t*, uint32_t index, clap_param_info_t* info) {
+    if (index >= static_cast<uint32_t>(PluginEngine::getParamCount())) {
+        return false;
+    }
+    const PluginEngine::Param& param = PluginEngine::getParam(static_cast<int>(index));
+    std::memset(info, 0, sizeof(*info));
+    info->id = param.id;
+    info->flags = CLAP_PARAM_IS_AUTOMATABLE | (param.stepped ? CLAP_PARAM_IS_STEPPED : 0);
+    std::snprintf(info->name, sizeof(info->name), "%s", param.name);
+    std::snprintf(info->module, sizeof(info->module), "%s", param.module);
+    info->min_value = param.min;
+    info->max_value = param.max;
+    // The engine's own starting value; the controls start off
+    static PluginEngine defaults;
+    info->default_value = defaults.getValue(param.id);
+    return true;
+}
+
+bool paramsGetValue(const clap_plugin_t* plugin, clap_id id, double* value) {
+    if (!PluginEngine::findParam(id)) {
+        return false;
+    }
+    *value = self(plugin)->engine.getValue(id);
+    return true;
+}
+
+bool paramsValueToText(const clap_plugin_t*, clap_id id, double value, char* text, uint32_t capacity) {
+    const PluginEngine::Param* param = PluginEngine::findParam(id);
+    if (!param) {
+        return false;
+    }
+    if (param->stepped) {
+        std::snprintf(text, capacity, "%d", static_cast<int>(value + 0.5));
+    } else {
+        std::snprintf(text, capacity, "%.4g", value);
+    }
+    return true;
+}
+
+bool paramsTextToValue(const clap_plugin_t*, clap_id id, const char* text, double* value) {
+    if (!PluginEngine::findParam(id)) {
+        return false;
+    }
+    char* end = nullptr;
+    *value = std::strtod(text, &end);
+    return end != text;
+}
+
+void paramsFlush(const clap_plugin_t* plugin, const clap_input_events_t* in, const clap_output_events_t*) {
+    Plugin* p = self(plugin);
+    translateAll(in, p->events);
+    p->engine.applyEvents(p->events.data(), static_cast<int>(p->events.size()));
+}
+
+const clap_plugin_params_t kParams = {
+    paramsCount, paramsGetInfo, paramsGetValue, paramsValueToText, paramsTextToValue, paramsFlush
+};
+
+// ----- State: every parameter as text -----
+
+bool stateSave(const clap_plugin_t* plugin, const clap_ostream_t* stream) {
+    const std::string text = self(plugin)->engine.saveState();
+    size_t written = 0;
+    while (written < text.size()) {
+        const int64_t n = stream->write(stream, text.data() + written, text.size() - written);
+        if (n <= 0) {
+            return false;
+        }
+        written += static_cast<size_t>(n);
+    }
+    return true;
+}
+
+bool stateLoad(const clap_plugin_t* plugin, const clap_istream_t* stream) {
+    std::string text;
+    char buffer[4096];
+    for (;;) {
+        const int64_t n = stream->read(stream, buffer, sizeof(buffer));
+        if (n < 0) {
+            return false;
+        }
+        if (n == 0) {
+            break;
+        }
+        text.append(buffer, static_cast<size_t>(n));
+    }
+    return self(plugin)->engine.loadState(text);
+}
+
+const clap_plugin_state_t kState = {stateSave, stateLoad};
+
+const void* pluginGetExtension(const clap_plugin_t*, const char* id) {
+    if (std::strcmp(id, CLAP_EXT_AUDIO_PORTS) == 0) {
+        return &kAudioPorts;
+    }
+    if (std::strcmp(id, CLAP_EXT_NOTE_PORTS) == 0) {
+        return &kNotePorts;
+    }
+    if (std::strcmp(id, CLAP_EXT_PARAMS) == 0) {
+        return &kParams;
+    }
+    if (std::strcmp(id, CLAP_EXT_STATE) == 0) {
+        return &kState;
+    }
+    return nullptr;
+}
+
+// ----- Factory and entry -----
+
+uint32_t factoryCount(const clap_plugin_factory_t*) {
+    return 1;
+}
+
+const clap_plugin_descriptor_t* factoryDescriptor(const clap_plugin_factory_t*, uint32_t index) {
+    return index == 0 ? &kDescriptor : nullptr;
+}
+
+const clap_plugin_t* factoryCreate(const clap_plugin_factory_t*, const clap_host_t* host, const char* id) {
+    if (!clap_version_is_compatible(host->clap_version) || std::strcmp(id, kDescriptor.id) != 0) {
+        return nullptr;
+    }
+    Plugin* p = new Plugin();
+    p->host = host;
+    p->clap.desc = &kDescriptor;
+    p->clap.plugin_data = p;
+    p->clap.init = pluginInit;
+    p->clap.destroy = pluginDestroy;
+    p->clap.activate = pluginActivate;
+    p->clap.deactivate = pluginDeactivate;
+    p->clap.start_processing = pluginStartProcessing;
+    p->clap.stop_processing = pluginStopProcessing;
+    p->clap.reset = pluginReset;
+    p->clap.process = pluginProcess;
+    p->clap.get_extension = pluginGetExtension;
+    p->clap.on_main_thread = pluginOnMainThread;
+    return &p->clap;
+}
+
+const clap_plugin_factory_t kFactory = {factoryCount, factoryDescriptor, factoryCreate};
+
+bool entryInit(const char*) {
+    return true;
+}
+
+void entryDeinit() {
+}
+
+const void* entryGetFactory(const char* id) {
+    return std::strcmp(id, CLAP_PLUGIN_FACTORY_ID) == 0 ? &kFactory : nullptr;
+}
+
+} // namespace
+
+extern "C" CLAP_EXPORT const clap_plugin_entry_t clap_entry = {
+    CLAP_VERSION_INIT,
+    entryInit,
+    entryDeinit,
+    entryGetFactory
+};
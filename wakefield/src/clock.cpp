@@ -1,10 +1,13 @@
 #include "clock.h"
 #include <algorithm>
+#include <cmath>
 
 Clock::Clock(float sampleRate)
     : sampleRate(sampleRate)
     , tempo(120.0)
     , sampleCounter(0)
+    , originSample(0)
+    , originBeat(0.0)
     , playing(false)
     , loopEnabled(false)
     , externalSync(false)
@@ -23,24 +26,58 @@ Clock::Clock(float sampleRate)
 
 void Clock::reset() {
     sampleCounter = 0;
+    originSample = 0;
+    originBeat = 0.0;
     for (int i = 0; i < 7; ++i) {
         lastStepSample[i] = 0;
     }
 }
 
 void Clock::setTempo(double bpm) {
-    tempo = std::clamp(bpm, 0.1, 999.0);
+    const double clamped = std::clamp(bpm, 0.1, 999.0);
+    if (clamped == tempo) {
+        return;
+    }
+    originBeat = beatAt(sampleCounter);
+    originSample = sampleCounter;
+    tempo = clamped;
     samplesPerBeat = (60.0 / tempo) * sampleRate;
 }
 
+void Clock::locate(double beat) {
+    originBeat = std::max(beat, 0.0);
+    originSample = sampleCounter;
+}
+
+void Clock::steer(unsigned int nFrames, double targetBeat, double bpm) {
+    if (!playing || nFrames == 0) {
+        setTempo(bpm);
+        return;
+    }
+    const double bufferBeats = bpm * nFrames / (60.0 * sampleRate);
+    const double error = targetBeat - (getBeatPosition() + bufferBeats);
+    if (std::abs(error) > 1.0) {
+        locate(targetBeat - bufferBeats);
+        setTempo(bpm);
+        return;
+    }
+    const double exact = (targetBeat - getBeatPosition()) * 60.0 * sampleRate / nFrames;
+    setTempo(std::clamp(exact, bpm * (1.0 - kMaxSteer), bpm * (1.0 + kMaxSteer)));
+}
+
 void Clock::advance(unsigned int nFrames) {
-    if (!playing || externalSync) {
+    if (!playing) {
         return;
     }
 
     sampleCounter += nFrames;
 }
 
+uint64_t Clock::getGridPosition() const {
+    const double position = getBeatPosition() * samplesPerBeat;
+    return position > 0.0 ? static_cast<uint64_t>(std::llround(position)) : 0;
+}
+
 int Clock::getSubdivIndex(Subdivision subdiv) const {
     // Map subdivision to array index (0-6)
     switch (subdiv) {
@@ -62,51 +99,108 @@ double Clock::getSamplesPerStep(Subdivision subdiv) const {
     return samplesPerBeat * beatsPerStep;
 }
 
-bool Clock::checkStepTrigger(unsigned int nFrames, Subdivision subdiv, int& stepIndex) {
-    if (!playing) {
-        return false;
+uint64_t Clock::stepSample(uint64_t step, double stepsPerBeat) const {
+    // Counted from the origin, so without a tempo change this is exactly
+    // ceil(step * samplesPerStep)
+    const double stepsPastOrigin = static_cast<double>(step) - originBeat * stepsPerBeat;
+    const double offset = std::ceil(stepsPastOrigin * (samplesPerBeat / stepsPerBeat));
+    if (offset <= -static_cast<double>(originSample)) {
+        return 0;
+    }
+    return static_cast<uint64_t>(static_cast<int64_t>(originSample) + static_cast<int64_t>(offset));
+}
+
+uint64_t Clock::stepAtOrAfter(uint64_t sample, double stepsPerBeat) const {
+    const double position = beatAt(sample) * stepsPerBeat;
+    uint64_t step = position > 0.0 ? static_cast<uint64_t>(position) : 0;
+    while (step > 0 && stepSample(step - 1, stepsPerBeat) >= sample) {
+        --step;
+    }
+    while (stepSample(step, stepsPerBeat) < sample) {
+        ++step;
+    }
+    return step;
+}
+
+uint64_t Clock::getStepSample(uint64_t step, Subdivision subdiv) const {
+    return stepSample(step, subdivisionToInt(subdiv) / 4.0);
+}
+
+uint64_t Clock::getStepAtOrAfter(uint64_t sample, Subdivision subdiv) const {
+    return stepAtOrAfter(sample, subdivisionToInt(subdiv) / 4.0);
+}
+
+int Clock::collectTicks(unsigned int nFrames, int ticksPerBeat, uint32_t* frames, int maxTicks) const {
+    if (!playing || nFrames == 0 || ticksPerBeat <= 0) {
+        return 0;
+    }
+    const uint64_t bufferEnd = sampleCounter + nFrames;
+    const double ticksPerBeatD = static_cast<double>(ticksPerBeat);
+    int count = 0;
+    for (uint64_t tick = stepAtOrAfter(sampleCounter, ticksPerBeatD); count < maxTicks; ++tick) {
+        const uint64_t tickSample = stepSample(tick, ticksPerBeatD);
+        if (tickSample >= bufferEnd) {
+            break;
+        }
+        frames[count++] = static_cast<uint32_t>(tickSample - sampleCounter);
+    }
+    return count;
+}
+
+int Clock::wrapStepIndex(uint64_t step, Subdivision subdiv) const {
+    int stepIndex = static_cast<int>(step);
+
+    // Handle looping
+    if (loopEnabled && subdiv == loopSubdivision) {
+        int loopLength = loopEndStep - loopStartStep;
+        if (loopLength > 0) {
+            int relativeStep = (stepIndex - loopStartStep) % loopLength;
+            if (relativeStep < 0) relativeStep += loopLength;
+            stepIndex = loopStartStep + relativeStep;
+        }
+    }
+    return stepIndex;
+}
+
+int Clock::collectStepTriggers(unsigned int nFrames, Subdivision subdiv,
+                               StepTrigger* triggers, int maxTriggers) {
+    if (!playing || nFrames == 0) {
+        return 0;
     }
 
     int idx = getSubdivIndex(subdiv);
-    double samplesPerStep = getSamplesPerStep(subdiv);
-
-    uint64_t oldSample = sampleCounter - nFrames;
-    uint64_t newSample = sampleCounter;
-
-    // Calculate step indices
-    int oldStep = static_cast<int>(oldSample / samplesPerStep);
-    int newStep = static_cast<int>(newSample / samplesPerStep);
-
-    // Did we cross a step boundary?
-    if (newStep > oldStep) {
-        stepIndex = newStep;
-        lastStepSample[idx] = newStep * samplesPerStep;
-
-        // Handle looping
-        if (loopEnabled && subdiv == loopSubdivision) {
-            int loopLength = loopEndStep - loopStartStep;
-            if (loopLength > 0) {
-                int relativeStep = (stepIndex - loopStartStep) % loopLength;
-                if (relativeStep < 0) relativeStep += loopLength;
-                stepIndex = loopStartStep + relativeStep;
-            }
+
+    uint64_t bufferStart = sampleCounter;
+    uint64_t bufferEnd = sampleCounter + nFrames;
+
+    // First step starting at or after the buffer start
+    uint64_t step = getStepAtOrAfter(bufferStart, subdiv);
+
+    int count = 0;
+    while (count < maxTriggers) {
+        uint64_t stepSample = getStepSample(step, subdiv);
+        if (stepSample >= bufferEnd) {
+            break;
         }
 
-        return true;
+        lastStepSample[idx] = stepSample;
+
+        triggers[count].frame = static_cast<uint32_t>(stepSample - bufferStart);
+        triggers[count].stepIndex = wrapStepIndex(step, subdiv);
+        ++count;
+        ++step;
     }
 
-    return false;
+    return count;
 }
 
 double Clock::getPhase(Subdivision subdiv) const {
-    double samplesPerStep = getSamplesPerStep(subdiv);
-    double phase = fmod(static_cast<double>(sampleCounter), samplesPerStep) / samplesPerStep;
-    return phase;
+    const double steps = getBeatPosition() * subdivisionToInt(subdiv) / 4.0;
+    return steps - std::floor(steps);
 }
 
 int Clock::getCurrentStep(Subdivision subdiv) const {
-    double samplesPerStep = getSamplesPerStep(subdiv);
-    return static_cast<int>(sampleCounter / samplesPerStep);
+    return static_cast<int>(std::floor(getBeatPosition() * subdivisionToInt(subdiv) / 4.0));
 }
 
 void Clock::setLoopPoints(int startStep, int endStep, Subdivision subdiv) {
@@ -15,6 +15,12 @@ enum class Subdivision {
     SIXTYFOURTH = 64
 };
 
+// A step boundary inside the upcoming buffer
+struct StepTrigger {
+    uint32_t frame;    // Offset from the start of the buffer
+    int stepIndex;     // Loop-wrapped when looping on this subdivision
+};
+
 class Clock {
 public:
     Clock(float sampleRate);
@@ -24,16 +30,51 @@ public:
     void stop() { playing = false; }
     void reset();
 
-    // Tempo control
+    // Tempo control. A tempo change keeps the beat position: the step grid
+    // continues from the current sample at the new tempo
     void setTempo(double bpm);
     double getTempo() const { return tempo; }
 
     // Advance clock by nFrames samples
     void advance(unsigned int nFrames);
 
-    // Check if we crossed a step boundary this buffer
-    // Returns true and sets stepIndex if a step was triggered
-    bool checkStepTrigger(unsigned int nFrames, Subdivision subdiv, int& stepIndex);
+    // Find the step boundaries in the next nFrames frames (call before
+    // advance). Fills up to maxTriggers entries in frame order and returns
+    // the count; the first frame of step n is ceil(n * samplesPerStep)
+    int collectStepTriggers(unsigned int nFrames, Subdivision subdiv,
+                            StepTrigger* triggers, int maxTriggers);
+
+    // MIDI clock ticks (ticksPerBeat to the quarter note) in the next
+    // nFrames frames, as frame offsets; call before advance
+    int collectTicks(unsigned int nFrames, int ticksPerBeat, uint32_t* frames, int maxTicks) const;
+
+    // Step grid for a subdivision: step n starts on the first sample at or
+    // after its beat position (ceil(n * samplesPerStep) until the tempo
+    // first changes); getStepAtOrAfter finds the first step starting at or
+    // after sample, wrapStepIndex applies the loop points
+    uint64_t getStepSample(uint64_t step, Subdivision subdiv) const;
+    uint64_t getStepAtOrAfter(uint64_t sample, Subdivision subdiv) const;
+    int wrapStepIndex(uint64_t step, Subdivision subdiv) const;
+
+    // Global sample position of the start of the current buffer
+    uint64_t getSamplePosition() const { return sampleCounter; }
+
+    // Position in quarter notes at the start of the current buffer, with
+    // its fraction of a sample
+    double getBeatPosition() const { return beatAt(sampleCounter); }
+
+    // Where getSamplePosition() would be had the current tempo run since
+    // beat 0, for grids that count from sample 0 (LoopGrid)
+    uint64_t getGridPosition() const;
+
+    // Jump to beat (e.g. a Song Position Pointer)
+    void locate(double beat);
+
+    // External sync, before the buffer's triggers are collected: run at
+    // bpm, bent by up to kMaxSteer so the beat position reaches targetBeat
+    // after nFrames frames. Errors over a beat are jumped instead
+    void steer(unsigned int nFrames, double targetBeat, double bpm);
+    static constexpr double kMaxSteer = 0.05;
 
     // Get current phase (0.0-1.0) for a subdivision
     double getPhase(Subdivision subdiv) const;
@@ -49,7 +90,7 @@ public:
     void enableLoop(bool enabled) { loopEnabled = enabled; }
     bool isLoopEnabled() const { return loopEnabled; }
 
-    // External sync (future MIDI clock support)
+    // External sync: tempo and transport follow MIDI clock (see steer)
     void enableExternalSync(bool enabled) { externalSync = enabled; }
     bool isExternalSync() const { return externalSync; }
 
@@ -60,6 +101,8 @@ private:
     double tempo;                  // BPM (20-300)
     double samplesPerBeat;         // Samples in one quarter note
     uint64_t sampleCounter;        // Global sample position
+    uint64_t originSample;         // Sample of the last tempo change...
+    double originBeat;             // ...and the beat position there
     uint64_t lastStepSample[7];    // Last trigger sample for each subdivision
 
     bool playing;
@@ -77,6 +120,14 @@ private:
 
     // Helper to get subdivision index (for array access)
     int getSubdivIndex(Subdivision subdiv) const;
+
+    double beatAt(uint64_t sample) const {
+        return originBeat + (static_cast<double>(sample) - static_cast<double>(originSample)) / samplesPerBeat;
+    }
+
+    // The grid of any division (stepsPerBeat steps to the quarter note)
+    uint64_t stepSample(uint64_t step, double stepsPerBeat) const;
+    uint64_t stepAtOrAfter(uint64_t sample, double stepsPerBeat) const;
 };
 
 #endif // CLOCK_H
@@ -14,11 +14,13 @@ MusicalConstraints::MusicalConstraints()
     , gravityNote(60)  // Middle C
     , customScale(12, false)
 {
+    compileTables();
 }
 
 void MusicalConstraints::setOctaveRange(int minOct, int maxOct) {
     octaveMin = std::clamp(minOct, 0, 9);
     octaveMax = std::clamp(maxOct, octaveMin, 9);
+    compileTables();
 }
 
 void MusicalConstraints::setDensity(float d) {
@@ -28,6 +30,7 @@ void MusicalConstraints::setDensity(float d) {
 void MusicalConstraints::setCustomScale(const std::vector<bool>& scale) {
     if (scale.size() == 12) {
         customScale = scale;
+        compileTables();
     }
 }
 
@@ -89,73 +92,77 @@ std::vector<int> MusicalConstraints::getScaleIntervals() const {
     return getIntervalsForScale(currentScale);
 }
 
-std::vector<int> MusicalConstraints::getLegalNotes() const {
-    std::vector<int> legalNotes;
+void MusicalConstraints::compileTables() {
+    legalMask[0] = 0;
+    legalMask[1] = 0;
     std::vector<int> intervals = getScaleIntervals();
 
-    // Generate all legal MIDI notes within octave range
+    // Mark all legal MIDI notes within octave range
     for (int octave = octaveMin; octave <= octaveMax; ++octave) {
         int baseNote = (octave + 1) * 12;  // C of this octave (MIDI: C-1=0, C0=12, C1=24, etc.)
 
         for (int interval : intervals) {
             int midiNote = baseNote + rootNote + interval;
             if (midiNote >= 0 && midiNote <= 127) {
-                legalNotes.push_back(midiNote);
+                legalMask[midiNote >> 6] |= 1ull << (midiNote & 63);
             }
         }
     }
 
-    return legalNotes;
+    legalCount = 0;
+    for (int note = 0; note < 128; ++note) {
+        legalIndex[note] = -1;
+        if ((legalMask[note >> 6] >> (note & 63)) & 1) {
+            legalIndex[note] = static_cast<int8_t>(legalCount);
+            legalNotes[legalCount++] = static_cast<uint8_t>(note);
+        }
+    }
+
+    // Closest legal note for every MIDI note; a tie goes to the lower one
+    int below = -1;
+    int next = 0;
+    for (int note = 0; note < 128; ++note) {
+        if (legalCount == 0) {
+            nearestNote[note] = 60;  // Default to middle C
+            continue;
+        }
+        while (next < legalCount && legalNotes[next] <= note) {
+            below = legalNotes[next++];
+        }
+        int above = next < legalCount ? legalNotes[next] : -1;
+        if (below < 0 || (above >= 0 && above - note < note - below)) {
+            nearestNote[note] = static_cast<uint8_t>(above);
+        } else {
+            nearestNote[note] = static_cast<uint8_t>(below);
+        }
+    }
+}
+
+std::vector<int> MusicalConstraints::getLegalNotes() const {
+    return std::vector<int>(legalNotes, legalNotes + legalCount);
 }
 
 bool MusicalConstraints::isNoteInScale(int midiNote) const {
     if (midiNote < 0 || midiNote > 127) return false;
-
-    // Check if note is within octave range
-    int octave = (midiNote / 12) - 1;
-    if (octave < octaveMin || octave > octaveMax) return false;
-
-    // Check if note's pitch class is in scale
-    int pitchClass = (midiNote - rootNote) % 12;
-    if (pitchClass < 0) pitchClass += 12;
-
-    std::vector<int> intervals = getScaleIntervals();
-    return std::find(intervals.begin(), intervals.end(), pitchClass) != intervals.end();
+    return (legalMask[midiNote >> 6] >> (midiNote & 63)) & 1;
 }
 
 int MusicalConstraints::quantizeToScale(int midiNote) const {
-    std::vector<int> legalNotes = getLegalNotes();
-
-    if (legalNotes.empty()) return 60;  // Default to middle C
-
-    // Find closest legal note
-    int closest = legalNotes[0];
-    int minDistance = std::abs(midiNote - closest);
-
-    for (int note : legalNotes) {
-        int distance = std::abs(midiNote - note);
-        if (distance < minDistance) {
-            minDistance = distance;
-            closest = note;
-        }
-    }
-
-    return closest;
+    return nearestNote[std::clamp(midiNote, 0, 127)];
 }
 
-int MusicalConstraints::getConstrainedNextNote(int currentNote) const {
-    std::vector<int> legalNotes = getLegalNotes();
-
-    if (legalNotes.empty()) return 60;
+int MusicalConstraints::getConstrainedNextNote(int currentNote, rng::Stream& rng) const {
+    if (legalCount == 0) return 60;
 
     // Find current note in legal notes
-    auto it = std::find(legalNotes.begin(), legalNotes.end(), currentNote);
-    int currentIndex = (it != legalNotes.end()) ? std::distance(legalNotes.begin(), it) : 0;
+    int currentIndex = (currentNote >= 0 && currentNote <= 127 && legalIndex[currentNote] >= 0)
+                           ? legalIndex[currentNote]
+                           : 0;
 
     switch (currentContour) {
         case Contour::DRONE:
             // 80% chance stay on same note, 20% move to neighbor
-            if (rand() % 100 < 80) {
+            if (rng.below(100) < 80) {
                 return currentNote;
             }
             // Fall through to random walk
@@ -165,18 +172,18 @@ int MusicalConstraints::getConstrainedNextNote(int currentNote) const {
             {
                 // Move up or down by small intervals
                 int maxSteps = std::min(maxInterval, 3);
-                int step = (rand() % (maxSteps * 2 + 1)) - maxSteps;
+                int step = static_cast<int>(rng.below(maxSteps * 2 + 1)) - maxSteps;
                 int newIndex = currentIndex + step;
-                newIndex = std::clamp(newIndex, 0, static_cast<int>(legalNotes.size()) - 1);
+                newIndex = std::clamp(newIndex, 0, legalCount - 1);
                 return legalNotes[newIndex];
             }
 
         case Contour::ASCENDING:
             {
                 // 70% chance move up, 30% stay or move down
-                if (rand() % 100 < 70) {
-                    int step = 1 + (rand() % std::min(maxInterval, 3));
-                    int newIndex = std::min(currentIndex + step, static_cast<int>(legalNotes.size()) - 1);
+                if (rng.below(100) < 70) {
+                    int step = 1 + static_cast<int>(rng.below(std::min(maxInterval, 3)));
+                    int newIndex = std::min(currentIndex + step, legalCount - 1);
                     return legalNotes[newIndex];
                 }
                 return currentNote;
@@ -185,8 +192,8 @@ int MusicalConstraints::getConstrainedNextNote(int currentNote) const {
         case Contour::DESCENDING:
             {
                 // 70% chance move down, 30% stay or move up
-                if (rand() % 100 < 70) {
-                    int step = 1 + (rand() % std::min(maxInterval, 3));
+                if (rng.below(100) < 70) {
+                    int step = 1 + static_cast<int>(rng.below(std::min(maxInterval, 3)));
                     int newIndex = std::max(currentIndex - step, 0);
                     return legalNotes[newIndex];
                 }
@@ -200,16 +207,16 @@ int MusicalConstraints::getConstrainedNextNote(int currentNote) const {
 
                 if (std::abs(distance) < 2) {
                     // Very close to gravity, stay nearby
-                    int step = (rand() % 3) - 1;  // -1, 0, or 1
+                    int step = static_cast<int>(rng.below(3)) - 1;  // -1, 0, or 1
                     int newIndex = currentIndex + step;
-                    newIndex = std::clamp(newIndex, 0, static_cast<int>(legalNotes.size()) - 1);
+                    newIndex = std::clamp(newIndex, 0, legalCount - 1);
                     return legalNotes[newIndex];
                 } else {
                     // Move toward gravity (60% of the time)
-                    if (rand() % 100 < 60) {
+                    if (rng.below(100) < 60) {
                         int step = (distance > 0) ? 1 : -1;
                         int newIndex = currentIndex + step;
-                        newIndex = std::clamp(newIndex, 0, static_cast<int>(legalNotes.size()) - 1);
+                        newIndex = std::clamp(newIndex, 0, legalCount - 1);
                         return legalNotes[newIndex];
                     } else {
                         return currentNote;
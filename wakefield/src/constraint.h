@@ -1,8 +1,10 @@
 #ifndef CONSTRAINT_H
 #define CONSTRAINT_H
 
+#include <cstdint>
 #include <vector>
 #include <string>
+#include "rng.h"
 
 // Dark ambient scales perfect for drone/atmospheric music
 enum class Scale {
@@ -32,10 +34,10 @@ public:
     MusicalConstraints();
 
     // Scale configuration
-    void setScale(Scale scale) { currentScale = scale; }
+    void setScale(Scale scale) { currentScale = scale; compileTables(); }
     Scale getScale() const { return currentScale; }
 
-    void setRootNote(int root) { rootNote = root % 12; }  // 0=C, 1=C#, 2=D, etc.
+    void setRootNote(int root) { rootNote = root % 12; compileTables(); }  // 0=C, 1=C#, 2=D, etc.
     int getRootNote() const { return rootNote; }
 
     void setOctaveRange(int minOct, int maxOct);
@@ -44,6 +46,7 @@ public:
 
     // Custom scale (12 bools for each semitone)
     void setCustomScale(const std::vector<bool>& scale);
+    const std::vector<bool>& getCustomScale() const { return customScale; }
 
     // Melodic contour
     void setContour(Contour contour) { currentContour = contour; }
@@ -60,7 +63,8 @@ public:
     void setMaxInterval(int semitones) { maxInterval = semitones; }
     int getMaxInterval() const { return maxInterval; }
 
-    // Query functions
+    // Query functions; table lookups, rebuilt whenever scale, root or
+    // octave range change
     std::vector<int> getLegalNotes() const;
     bool isNoteInScale(int midiNote) const;
     int quantizeToScale(int midiNote) const;  // Snap to nearest scale note
@@ -69,7 +73,7 @@ public:
     std::vector<int> getScaleIntervals() const;
 
     // Get constrained next note given current note and contour
-    int getConstrainedNextNote(int currentNote) const;
+    int getConstrainedNextNote(int currentNote, rng::Stream& rng) const;
 
     // Scale name for UI display
     std::string getScaleName() const;
@@ -87,8 +91,18 @@ private:
 
     std::vector<bool> customScale;  // 12 bools for custom scale
 
+    // Legal notes compiled from scale, root and octave range
+    uint64_t legalMask[2];          // Bit n & 63 of word n >> 6 = note n is legal
+    uint8_t legalNotes[128];        // Ascending
+    int8_t legalIndex[128];         // Position in legalNotes, -1 if not legal
+    uint8_t nearestNote[128];       // Closest legal note, the lower on a tie
+    int legalCount;
+
     // Helper to get scale intervals from root
     std::vector<int> getIntervalsForScale(Scale scale) const;
+
+    // Rebuild the legal note tables
+    void compileTables();
 };
 
 #endif // CONSTRAINT_H
@@ -0,0 +1,351 @@
+#include "convolution.h"
+#include "wav_reader.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+
+// ----- ConvolutionReverb -----
+
+namespace {
+
+// Built-in IR: decorrelated noise per side with a 5 ms fade-in, a 2.5 s
+// RT60 and a one-pole lowpass around 6 kHz
+void makeDefaultImpulse(float sampleRate, std::vector<float>& left, std::vector<float>& right) {
+    constexpr float kSeconds = 2.5f;
+    constexpr float kRt60 = 2.5f;
+    constexpr float kFadeInSeconds = 0.005f;
+    constexpr float kLowpassHz = 6000.0f;
+    const size_t frames = static_cast<size_t>(kSeconds * sampleRate);
+    left.resize(frames);
+    right.resize(frames);
+
+    const float decay = std::pow(10.0f, -3.0f / (kRt60 * sampleRate));
+    const float lowpass = 1.0f - std::exp(-2.0f * static_cast<float>(M_PI) * kLowpassHz / sampleRate);
+    const float fadeIn = 1.0f / (kFadeInSeconds * sampleRate);
+    uint32_t seedL = 0x2545f491u;
+    uint32_t seedR = 0x9e3779b9u;
+    auto noise = [](uint32_t& seed) {
+        seed = seed * 1664525u + 1013904223u;
+        return static_cast<float>(seed >> 8) / 8388608.0f - 1.0f;
+    };
+    float envelope = 1.0f;
+    float stateL = 0.0f;
+    float stateR = 0.0f;
+    for (size_t i = 0; i < frames; ++i) {
+        const float gain = envelope * std::min(1.0f, static_cast<float>(i) * fadeIn);
+        stateL += lowpass * (noise(seedL) - stateL);
+        stateR += lowpass * (noise(seedR) - stateR);
+        left[i] = stateL * gain;
+        right[i] = stateR * gain;
+        envelope *= decay;
+    }
+}
+
+} // namespace
+
+ConvolutionReverb::ConvolutionReverb(float sampleRate)
+    : sampleRate(sampleRate)
+    , fft(kFFTSize) {
+    clear();
+    std::vector<float> left;
+    std::vector<float> right;
+    makeDefaultImpulse(sampleRate, left, right);
+    setImpulse(left.data(), right.data(), left.size());
+    adoptPending();
+}
+
+ConvolutionReverb::~ConvolutionReverb() {
+    delete active;
+    delete pending.exchange(nullptr);
+    reclaim(retired);
+}
+
+void ConvolutionReverb::reclaim(std::atomic<Kernel*>& slot) {
+    Kernel* kernel = slot.exchange(nullptr, std::memory_order_acquire);
+    while (kernel) {
+        Kernel* next = kernel->next;
+        delete kernel;
+        kernel = next;
+    }
+}
+
+void ConvolutionReverb::setImpulse(const float* left, const float* right, size_t frames) {
+    // Kernels process() swapped out since the last load
+    reclaim(retired);
+
+    frames = std::min(frames, static_cast<size_t>(kMaxImpulseSeconds * sampleRate));
+    if (frames == 0) {
+        return;
+    }
+
+    // Unit energy, averaged over the two sides
+    double energy = 0.0;
+    for (size_t i = 0; i < frames; ++i) {
+        energy += 0.5 * (static_cast<double>(left[i]) * left[i] + static_cast<double>(right[i]) * right[i]);
+    }
+    const float normalize = energy > 0.0 ? static_cast<float>(1.0 / std::sqrt(energy)) : 0.0f;
+    // The inverse FFT's n/2 scale is folded in here, once
+    const float gain = normalize * 2.0f / static_cast<float>(kFFTSize);
+
+    Kernel* kernel = new Kernel;
+    kernel->frames = frames;
+    kernel->partitions = static_cast<int>((frames + kPartition - 1) / kPartition);
+    const size_t vectors = static_cast<size_t>(2) * kernel->partitions * 2 * kBinVectors;
+    kernel->spectra.assign(vectors, Lanes{});
+    kernel->delayLine.assign(vectors, Lanes{});
+    memory.set(2 * vectors * sizeof(Lanes));
+
+    // Own FFT: the member one belongs to the audio thread
+    kernels::RealFFT transform(kFFTSize);
+    std::vector<float> block(kFFTSize);
+    std::vector<float> re(4 * kBinVectors, 0.0f);
+    std::vector<float> im(4 * kBinVectors, 0.0f);
+    const float* channels[2] = {left, right};
+    for (int channel = 0; channel < 2; ++channel) {
+        for (int p = 0; p < kernel->partitions; ++p) {
+            const size_t start = static_cast<size_t>(p) * kPartition;
+            const size_t count = std::min(static_cast<size_t>(kPartition), frames - start);
+            std::fill(block.begin(), block.end(), 0.0f);
+            for (size_t i = 0; i < count; ++i) {
+                block[i] = channels[channel][start + i] * gain;
+            }
+            transform.forward(block.data(), re.data(), im.data());
+            Lanes* spectrum = kernel->spectrum(channel, p);
+            std::memcpy(spectrum, re.data(), kBinVectors * sizeof(Lanes));
+            std::memcpy(spectrum + kBinVectors, im.data(), kBinVectors * sizeof(Lanes));
+        }
+    }
+
+    publishedSeconds.store(static_cast<float>(frames) / sampleRate);
+    // A kernel still pending was never seen by process()
+    delete pending.exchange(kernel, std::memory_order_acq_rel);
+}
+
+bool ConvolutionReverb::loadImpulseFile(const std::string& path, std::string& error) {
+    std::ifstream in(path, std::ios::binary);
+    if (!in) {
+        error = "could not open " + path;
+        return false;
+    }
+    WAVInfo info;
+    if (!readWAVHeader(in, info, error)) {
+        error = path + ": " + error;
+        return false;
+    }
+    const bool pcm = info.format == 1 &&
+                     (info.bitsPerSample == 16 || info.bitsPerSample == 24 || info.bitsPerSample == 32);
+    const bool ieee = info.format == 3 && info.bitsPerSample == 32;
+    const uint32_t bytesPerSample = info.bitsPerSample / 8;
+    if ((!pcm && !ieee) || info.channels == 0 || info.sampleRate == 0 ||
+        info.blockAlign < info.channels * bytesPerSample) {
+        error = path + ": unsupported sample format";
+        return false;
+    }
+
+    size_t frames = info.dataBytes / info.blockAlign;
+    frames = std::min(frames, static_cast<size_t>(kMaxImpulseSeconds * info.sampleRate));
+    std::vector<unsigned char> raw(frames * info.blockAlign);
+    in.read(reinterpret_cast<char*>(raw.data()), static_cast<std::streamsize>(raw.size()));
+    frames = static_cast<size_t>(in.gcount()) / info.blockAlign;
+    if (frames == 0) {
+        error = path + " has no audio";
+        return false;
+    }
+
+    const uint32_t rightChannel = info.channels > 1 ? bytesPerSample : 0;   // Mono feeds both sides
+    std::vector<float> left(frames);
+    std::vector<float> right(frames);
+    for (size_t i = 0; i < frames; ++i) {
+        const unsigned char* frame = raw.data() + i * info.blockAlign;
+        left[i] = decodeWAVSample(frame, info);
+        right[i] = decodeWAVSample(frame + rightChannel, info);
+    }
+
+    if (static_cast<float>(info.sampleRate) != sampleRate) {
+        const double step = static_cast<double>(info.sampleRate) / sampleRate;
+        const size_t resampled = static_cast<size_t>(static_cast<double>(frames - 1) / step) + 1;
+        std::vector<float> newLeft(resampled);
+        std::vector<float> newRight(resampled);
+        for (size_t i = 0; i < resampled; ++i) {
+            const double position = i * step;
+            const size_t index = std::min(static_cast<size_t>(position), frames - 1);
+            const size_t nextIndex = std::min(index + 1, frames - 1);
+            const float frac = static_cast<float>(position - static_cast<double>(index));
+            newLeft[i] = left[index] + frac * (left[nextIndex] - left[index]);
+            newRight[i] = right[index] + frac * (right[nextIndex] - right[index]);
+        }
+        left.swap(newLeft);
+        right.swap(newRight);
+    }
+
+    setImpulse(left.data(), right.data(), left.size());
+    return true;
+}
+
+float ConvolutionReverb::impulseSeconds() const {
+    return publishedSeconds.load();
+}
+
+void ConvolutionReverb::setParameters(const Parameters& p) {
+    mix = std::clamp(p.mix, 0.0f, 1.0f);
+}
+
+void ConvolutionReverb::setTailGateEnabled(bool enabled) {
+    gateEnabled = enabled;
+    if (!enabled) {
+        idle = false;
+        silentSamples = 0;
+    }
+}
+
+void ConvolutionReverb::clear() {
+    std::memset(input, 0, sizeof(input));
+    std::memset(wet, 0, sizeof(wet));
+    head = 0;
+    filled = 0;
+    position = 0;
+    idle = false;
+    silentSamples = 0;
+}
+
+void ConvolutionReverb::adoptPending() {
+    if (!pending.load(std::memory_order_relaxed)) {
+        return;
+    }
+    Kernel* next = pending.exchange(nullptr, std::memory_order_acq_rel);
+    if (!next) {
+        return;
+    }
+    // The old kernel goes on the retired list for the loading thread
+    if (Kernel* old = active) {
+        old->next = retired.load(std::memory_order_relaxed);
+        while (!retired.compare_exchange_weak(old->next, old, std::memory_order_release,
+                                              std::memory_order_relaxed)) {
+        }
+    }
+    active = next;
+    clear();
+}
+
+int ConvolutionReverb::tailHoldSamples() const {
+    // The IR length plus the block in flight, at least 0.5 s
+    const size_t frames = (active ? active->frames : 0) + 2 * kPartition;
+    return std::max(static_cast<int>(0.5f * sampleRate), static_cast<int>(frames));
+}
+
+void ConvolutionReverb::processBlock() {
+    Kernel& kernel = *active;
+    const int partitions = kernel.partitions;
+    alignas(16) float re[4 * kBinVectors] = {};
+    alignas(16) float im[4 * kBinVectors] = {};
+
+    // Newest input spectrum into the FDL; the second half of the window
+    // becomes the first half of the next one
+    for (int channel = 0; channel < 2; ++channel) {
+        fft.forward(input[channel], re, im);
+        Lanes* slot = kernel.slot(channel, head);
+        std::memcpy(slot, re, kBinVectors * sizeof(Lanes));
+        std::memcpy(slot + kBinVectors, im, kBinVectors * sizeof(Lanes));
+        std::memcpy(input[channel], input[channel] + kPartition, kPartition * sizeof(float));
+    }
+    filled = std::min(filled + 1, partitions);
+
+    // Complex multiply-accumulate: the spectrum that entered p blocks ago
+    // meets partition p
+    for (int channel = 0; channel < 2; ++channel) {
+        Lanes* accRe = accumulator;
+        Lanes* accIm = accumulator + kBinVectors;
+        for (int v = 0; v < 2 * kBinVectors; ++v) {
+            accumulator[v] = Lanes{};
+        }
+        for (int p = 0; p < filled; ++p) {
+            const int index = head - p < 0 ? head - p + partitions : head - p;
+            const Lanes* x = kernel.slot(channel, index);
+            const Lanes* h = kernel.spectrum(channel, p);
+            for (int v = 0; v < kBinVectors; ++v) {
+                const Lanes xr = x[v];
+                const Lanes xi = x[kBinVectors + v];
+                const Lanes hr = h[v];
+                const Lanes hi = h[kBinVectors + v];
+                accRe[v] += xr * hr - xi * hi;
+                accIm[v] += xr * hi + xi * hr;
+            }
+        }
+        std::memcpy(re, accRe, kBinVectors * sizeof(Lanes));
+        std::memcpy(im, accIm, kBinVectors * sizeof(Lanes));
+        fft.inverse(re, im, scratch);
+        // Overlap-save: only the second half is free of wrap-around
+        std::memcpy(wet[channel], scratch + kPartition, kPartition * sizeof(float));
+    }
+    head = head + 1 == partitions ? 0 : head + 1;
+}
+
+void ConvolutionReverb::process(float* left, float* right, int numSamples) {
+    adoptPending();
+
+    const float dryGain = 1.0f - mix;
+    const float wetGain = mix;
+    if (!active) {
+        for (int i = 0; i < numSamples; ++i) {
+            left[i] *= dryGain;
+            right[i] *= dryGain;
+        }
+        return;
+    }
+
+    float inputPeak = 0.0f;
+    if (gateEnabled) {
+        for (int i = 0; i < numSamples; ++i) {
+            inputPeak = std::max(inputPeak, std::max(std::abs(left[i]), std::abs(right[i])));
+        }
+        if (idle) {
+            if (inputPeak < GreyholeReverb::kSilenceThreshold) {
+                for (int i = 0; i < numSamples; ++i) {
+                    left[i] *= dryGain;
+                    right[i] *= dryGain;
+                }
+                return;
+            }
+            idle = false;
+            silentSamples = 0;
+        }
+    }
+
+    float wetPeak = 0.0f;
+    int done = 0;
+    while (done < numSamples) {
+        const int n = std::min(kPartition - position, numSamples - done);
+        float* l = left + done;
+        float* r = right + done;
+        float* inL = input[0] + kPartition + position;
+        float* inR = input[1] + kPartition + position;
+        const float* wetL = wet[0] + position;
+        const float* wetR = wet[1] + position;
+        for (int i = 0; i < n; ++i) {
+            inL[i] = l[i];
+            inR[i] = r[i];
+            wetPeak = std::max(wetPeak, std::max(std::abs(wetL[i]), std::abs(wetR[i])));
+            l[i] = l[i] * dryGain + wetL[i] * wetGain;
+            r[i] = r[i] * dryGain + wetR[i] * wetGain;
+        }
+        position += n;
+        done += n;
+        if (position == kPartition) {
+            processBlock();
+            position = 0;
+        }
+    }
+
+    if (gateEnabled) {
+        if (inputPeak < GreyholeReverb::kSilenceThreshold && wetPeak < GreyholeReverb::kSilenceThreshold) {
+            silentSamples += numSamples;
+            if (silentSamples >= tailHoldSamples()) {
+                clear();
+                idle = true;
+            }
+        } else {
+            silentSamples = 0;
+        }
+    }
+}
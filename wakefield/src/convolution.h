@@ -0,0 +1,120 @@
+#ifndef CONVOLUTION_H
+#define CONVOLUTION_H
+
+#include <atomic>
+#include <cstddef>
+#include <string>
+#include <vector>
+#include "memory_stats.h"
+#include "reverb.h"
+#include "../../shared/dsp/real_fft.h"
+
+// Third engine: a captured room. Uniformly partitioned overlap-save
+// convolution with a stereo impulse response (left input through the left
+// IR, right through the right).
+//
+// The IR is cut into kPartition-frame pieces, each kept as the spectrum of
+// its zero-padded kFFTSize FFT. Every kPartition frames the spectrum of the
+// last kFFTSize input frames enters a frequency-domain delay line (FDL); the
+// output spectrum is the sum over p of FDL slot p times IR partition p,
+// four bins per vector op, and one inverse FFT per channel yields the next
+// wet block. The wet signal is kPartition frames late; the cost per frame
+// grows with the IR length, not the block size.
+//
+// Spectra and FDL are built together off the audio thread (setImpulse,
+// loadImpulseFile) and published through an atomic slot; process() adopts
+// the new one at its next block and pushes the old one onto a lock-free
+// list that the next load frees. Takes GreyholeReverb::Parameters, of
+// which only mix applies.
+class ConvolutionReverb {
+public:
+    using Parameters = GreyholeReverb::Parameters;
+
+    static constexpr int kPartition = 256;              // Frames per partition and wet latency
+    static constexpr int kFFTSize = 2 * kPartition;
+    static constexpr float kMaxImpulseSeconds = 10.0f;  // Longer IRs are cut
+
+    // Starts with a built-in 2.5 s decaying noise IR
+    explicit ConvolutionReverb(float sampleRate);
+    ~ConvolutionReverb();
+
+    ConvolutionReverb(const ConvolutionReverb&) = delete;
+    ConvolutionReverb& operator=(const ConvolutionReverb&) = delete;
+
+    // Not on the audio thread, and from one thread at a time. Normalizes the
+    // IR to unit energy so IRs of any level mix alike; right may equal left
+    void setImpulse(const float* left, const float* right, size_t frames);
+
+    // 16/24/32-bit PCM or float WAV, mono or stereo; other sample rates are
+    // resampled linearly. Same threading as setImpulse
+    bool loadImpulseFile(const std::string& path, std::string& error);
+
+    // Length of the IR process() will use, in seconds
+    float impulseSeconds() const;
+
+    void setParameters(const Parameters& p);
+
+    // Same tail gate as GreyholeReverb (on by default)
+    void setTailGateEnabled(bool enabled);
+    bool isIdle() const { return idle; }
+
+    // Process stereo audio in place (planar left/right), any block length
+    void process(float* left, float* right, int numSamples);
+
+    // Empty the FDL and the block buffers (audio thread)
+    void clear();
+
+private:
+    typedef float Lanes __attribute__((vector_size(4 * sizeof(float))));
+    static constexpr int kBins = kPartition + 1;
+    static constexpr int kBinVectors = (kBins + 3) / 4;   // Bins padded to whole vectors
+
+    // IR spectra and the FDL sized to match. Each spectrum is kBinVectors of
+    // real parts then kBinVectors of imaginary parts
+    struct Kernel {
+        int partitions = 0;
+        size_t frames = 0;
+        std::vector<Lanes> spectra;     // [channel][partition]
+        std::vector<Lanes> delayLine;   // [channel][slot]
+        Kernel* next = nullptr;         // Retired list link
+
+        Lanes* spectrum(int channel, int partition) {
+            return spectra.data() + (static_cast<size_t>(channel) * partitions + partition) * 2 * kBinVectors;
+        }
+        Lanes* slot(int channel, int index) {
+            return delayLine.data() + (static_cast<size_t>(channel) * partitions + index) * 2 * kBinVectors;
+        }
+    };
+
+    float sampleRate;
+    kernels::RealFFT fft;
+
+    Kernel* active = nullptr;                   // Audio thread only
+    std::atomic<Kernel*> pending{nullptr};      // Built, waiting for process()
+    std::atomic<Kernel*> retired{nullptr};      // Swapped out, freed by the next load
+    std::atomic<float> publishedSeconds{0.0f};
+    memstats::Account memory{memstats::REVERB};     // The newest kernel
+
+    // Block state: the last kFFTSize input frames per channel, the wet block
+    // being played out, and how far into the current block we are
+    int head = 0;       // FDL slot of the newest spectrum
+    int filled = 0;     // FDL slots written since clear()
+    int position = 0;
+    alignas(16) float input[2][kFFTSize];
+    alignas(16) float wet[2][kPartition];
+    alignas(16) float scratch[kFFTSize];
+    Lanes accumulator[2 * kBinVectors];
+
+    float mix = 0.3f;
+
+    bool gateEnabled = true;
+    bool idle = false;
+    int silentSamples = 0;
+
+    void adoptPending();
+    void processBlock();
+    int tailHoldSamples() const;
+    static void reclaim(std::atomic<Kernel*>& slot);
+};
+
+#endif // CONVOLUTION_H
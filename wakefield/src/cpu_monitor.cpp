@@ -1,127 +1,99 @@
 #include "cpu_monitor.h"
-#include <fstream>
-#include <sstream>
+#include <algorithm>
 
 CPUMonitor::CPUMonitor()
-    : running(false)
-    , enabled(true)  // Enabled by default
-    , currentUsage(0.0f) {
-}
-
-CPUMonitor::~CPUMonitor() {
-    stop();
-}
-
-void CPUMonitor::start() {
-    if (running.load()) {
-        return;  // Already running
-    }
-
-    running = true;
-    monitorThread = std::thread(&CPUMonitor::monitorLoop, this);
-}
-
-void CPUMonitor::stop() {
-    if (!running.load()) {
-        return;  // Not running
-    }
-
-    running = false;
-    if (monitorThread.joinable()) {
-        monitorThread.join();
-    }
-}
-
-float CPUMonitor::getCPUUsage() const {
-    return currentUsage.load();
+    : enabled(true)  // Enabled by default
+    , meanLoad(0.0f)
+    , peakLoad(0.0f)
+    , p99Load(0.0f)
+    , overloads(0)
+    , windows(0)
+    , exportBuckets{}
+    , exportCount(0)
+    , exportSum(0.0)
+    , windowNs(0)
+    , windowCallbacks(0)
+    , windowLoadSum(0.0)
+    , windowPeak(0.0f)
+    , histogram{} {
 }
 
 void CPUMonitor::setEnabled(bool enable) {
-    enabled = enable;
-}
-
-bool CPUMonitor::readCPUStats(CPUStats& stats) {
-    std::ifstream file("/proc/stat");
-    if (!file.is_open()) {
-        return false;
+    enabled.store(enable, std::memory_order_relaxed);
+    if (!enable) {
+        meanLoad.store(0.0f, std::memory_order_relaxed);
+        peakLoad.store(0.0f, std::memory_order_relaxed);
+        p99Load.store(0.0f, std::memory_order_relaxed);
     }
+}
 
-    std::string line;
-    if (!std::getline(file, line)) {
-        return false;
+void CPUMonitor::recordCallback(uint64_t busyNs, uint64_t periodNs) {
+    if (periodNs == 0) {
+        return;
     }
 
-    // Parse first line which should be "cpu  user nice system idle iowait irq softirq steal ..."
-    std::istringstream ss(line);
-    std::string cpu_label;
-    ss >> cpu_label;
-
-    if (cpu_label != "cpu") {
-        return false;
+    float load = static_cast<float>(static_cast<double>(busyNs) / static_cast<double>(periodNs));
+    if (load > kOverloadThreshold) {
+        overloads.fetch_add(1, std::memory_order_relaxed);
     }
 
-    stats.user = 0;
-    stats.nice = 0;
-    stats.system = 0;
-    stats.idle = 0;
-    stats.iowait = 0;
-    stats.irq = 0;
-    stats.softirq = 0;
-    stats.steal = 0;
-
-    ss >> stats.user >> stats.nice >> stats.system >> stats.idle
-       >> stats.iowait >> stats.irq >> stats.softirq >> stats.steal;
-
-    return true;
-}
-
-float CPUMonitor::calculateUsage(const CPUStats& prev, const CPUStats& current) {
-    // Calculate total time difference
-    unsigned long long prevIdle = prev.idle + prev.iowait;
-    unsigned long long currIdle = current.idle + current.iowait;
-
-    unsigned long long prevTotal = prev.user + prev.nice + prev.system + prev.idle +
-                                   prev.iowait + prev.irq + prev.softirq + prev.steal;
-    unsigned long long currTotal = current.user + current.nice + current.system + current.idle +
-                                   current.iowait + current.irq + current.softirq + current.steal;
+    int bin = std::min(static_cast<int>(load * 100.0f), kLoadBins - 1);
+    ++histogram[bin];
+    ++windowCallbacks;
+    windowLoadSum += load;
+    windowPeak = std::max(windowPeak, load);
+    windowNs += periodNs;
 
-    unsigned long long totalDiff = currTotal - prevTotal;
-    unsigned long long idleDiff = currIdle - prevIdle;
-
-    if (totalDiff == 0) {
-        return 0.0f;
+    if (windowNs >= kPublishWindowNs) {
+        publishWindow();
     }
-
-    // Calculate usage percentage
-    float usage = 100.0f * (1.0f - static_cast<float>(idleDiff) / static_cast<float>(totalDiff));
-
-    // Clamp to valid range
-    if (usage < 0.0f) usage = 0.0f;
-    if (usage > 100.0f) usage = 100.0f;
-
-    return usage;
 }
 
-void CPUMonitor::monitorLoop() {
-    CPUStats prevStats;
-    if (!readCPUStats(prevStats)) {
-        return;  // Failed to read initial stats
+void CPUMonitor::publishWindow() {
+    // Smallest bin with at least 99% of callbacks at or below it; report
+    // its upper edge, capped by the observed peak
+    uint32_t target = windowCallbacks - windowCallbacks / 100;
+    uint32_t cumulative = 0;
+    int bin = 0;
+    for (; bin < kLoadBins - 1; ++bin) {
+        cumulative += histogram[bin];
+        if (cumulative >= target) {
+            break;
+        }
     }
-
-    while (running.load()) {
-        // Wait for 500ms between samples
-        std::this_thread::sleep_for(std::chrono::milliseconds(500));
-
-        if (!enabled.load()) {
-            currentUsage = 0.0f;
-            continue;
+    float p99 = std::min((bin + 1) / 100.0f, windowPeak);
+
+    meanLoad.store(static_cast<float>(windowLoadSum / windowCallbacks), std::memory_order_relaxed);
+    peakLoad.store(windowPeak, std::memory_order_relaxed);
+    p99Load.store(p99, std::memory_order_relaxed);
+    windows.store(windows.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+
+    // Only this thread writes the export figures, so load and store suffice
+    uint32_t atOrBelow = 0;
+    int exportBin = 0;
+    for (int i = 0; i < kExportBuckets; ++i) {
+        for (; exportBin < kExportBoundsPercent[i]; ++exportBin) {
+            atOrBelow += histogram[exportBin];
         }
+        exportBuckets[i].store(exportBuckets[i].load(std::memory_order_relaxed) + atOrBelow,
+                               std::memory_order_relaxed);
+    }
+    exportSum.store(exportSum.load(std::memory_order_relaxed) + windowLoadSum, std::memory_order_relaxed);
+    exportCount.store(exportCount.load(std::memory_order_relaxed) + windowCallbacks, std::memory_order_release);
+
+    std::fill(histogram, histogram + kLoadBins, 0u);
+    windowNs = 0;
+    windowCallbacks = 0;
+    windowLoadSum = 0.0;
+    windowPeak = 0.0f;
+}
 
-        CPUStats currentStats;
-        if (readCPUStats(currentStats)) {
-            float usage = calculateUsage(prevStats, currentStats);
-            currentUsage = usage;
-            prevStats = currentStats;
-        }
+CPUMonitor::LoadHistogram CPUMonitor::getLoadHistogram() const {
+    LoadHistogram result;
+    result.count = exportCount.load(std::memory_order_acquire);
+    for (int i = 0; i < kExportBuckets; ++i) {
+        result.buckets[i] = exportBuckets[i].load(std::memory_order_relaxed);
     }
+    result.sum = exportSum.load(std::memory_order_relaxed);
+    return result;
 }
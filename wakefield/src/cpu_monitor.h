@@ -2,52 +2,83 @@
 #define CPU_MONITOR_H
 
 #include <atomic>
-#include <thread>
-#include <chrono>
-#include <string>
+#include <cstdint>
 
-// CPU usage monitoring for Linux systems
+// DSP load meter: how much of each buffer period the audio callback spends
+// rendering. The audio thread reports every callback's render time; once
+// per publish window it folds the window into mean, peak and 99th
+// percentile load and publishes them through atomics for the UI.
+// Load is a fraction of the deadline (1.0 = the whole buffer period).
 class CPUMonitor {
 public:
+    // Callbacks above this fraction of the deadline count as overloads
+    static constexpr float kOverloadThreshold = 0.8f;
+
+    // Upper bounds (percent of the deadline) of the cumulative histogram
+    // kept for metrics export
+    static constexpr int kExportBuckets = 8;
+    static constexpr int kExportBoundsPercent[kExportBuckets] = {10, 25, 50, 60, 70, 80, 90, 100};
+
+    // Every callback since start: buckets[i] counts loads at or below
+    // kExportBoundsPercent[i] (to the 1% bin), count all of them
+    struct LoadHistogram {
+        uint64_t buckets[kExportBuckets];
+        uint64_t count;
+        double sum;
+    };
+
     CPUMonitor();
-    ~CPUMonitor();
 
-    // Start monitoring in background thread
-    void start();
+    // Audio thread: one callback spent busyNs of a periodNs deadline
+    void recordCallback(uint64_t busyNs, uint64_t periodNs);
+
+    // Loads (0-1+) over the last publish window
+    float getMeanLoad() const { return meanLoad.load(std::memory_order_relaxed); }
+    float getPeakLoad() const { return peakLoad.load(std::memory_order_relaxed); }
+    float getP99Load() const { return p99Load.load(std::memory_order_relaxed); }
+
+    // Callbacks over kOverloadThreshold since start
+    uint64_t getOverloadCount() const { return overloads.load(std::memory_order_relaxed); }
 
-    // Stop monitoring
-    void stop();
+    // Publish windows since start; a change means fresh figures
+    uint32_t getWindowCount() const { return windows.load(std::memory_order_relaxed); }
 
-    // Get current CPU usage percentage (0-100)
-    float getCPUUsage() const;
+    // Up to the last publish window; fields may be a window apart
+    LoadHistogram getLoadHistogram() const;
 
     // Check if monitoring is enabled
-    bool isEnabled() const { return enabled.load(); }
+    bool isEnabled() const { return enabled.load(std::memory_order_relaxed); }
 
     // Enable/disable monitoring
     void setEnabled(bool enable);
 
 private:
-    std::atomic<bool> running;
+    // Audio time per published figure
+    static constexpr uint64_t kPublishWindowNs = 500000000;
+
+    // Histogram for the percentile: 1% bins, the last one catches the rest
+    static constexpr int kLoadBins = 128;
+
+    void publishWindow();
+
     std::atomic<bool> enabled;
-    std::atomic<float> currentUsage;
-    std::thread monitorThread;
-
-    // Read CPU stats from /proc/stat
-    struct CPUStats {
-        unsigned long long user;
-        unsigned long long nice;
-        unsigned long long system;
-        unsigned long long idle;
-        unsigned long long iowait;
-        unsigned long long irq;
-        unsigned long long softirq;
-        unsigned long long steal;
-    };
+    std::atomic<float> meanLoad;
+    std::atomic<float> peakLoad;
+    std::atomic<float> p99Load;
+    std::atomic<uint64_t> overloads;
+    std::atomic<uint32_t> windows;
+
+    // Cumulative histogram, folded in once per publish window
+    std::atomic<uint64_t> exportBuckets[kExportBuckets];
+    std::atomic<uint64_t> exportCount;
+    std::atomic<double> exportSum;
 
-    bool readCPUStats(CPUStats& stats);
-    float calculateUsage(const CPUStats& prev, const CPUStats& current);
-    void monitorLoop();
+    // Current window (audio thread only)
+    uint64_t windowNs;
+    uint32_t windowCallbacks;
+    double windowLoadSum;
+    float windowPeak;
+    uint32_t histogram[kLoadBins];
 };
 
 #endif // CPU_MONITOR_H
@@ -0,0 +1,75 @@
+#ifndef DENORMAL_GUARD_H
+#define DENORMAL_GUARD_H
+
+#include <cstdint>
+
+#if defined(__SSE__) || defined(__x86_64__) || defined(_M_X64)
+#include <xmmintrin.h>
+#define WAKEFIELD_DENORMAL_SSE 1
+#endif
+
+// Scoped floating-point mode for DSP code: flush denormal results to zero
+// (FTZ) and treat denormal inputs as zero (DAZ) while the guard lives, then
+// restore the caller's mode. Decaying filter, envelope and reverb states
+// otherwise end up in the subnormal range, where every operation is
+// microcoded and a silent tail costs many times the CPU of a loud one.
+//
+// x86: MXCSR FTZ (bit 15) and DAZ (bit 6).
+// ARM: FPCR/FPSCR FZ (bit 24); ARM has no separate DAZ, FZ covers inputs too.
+class ScopedDenormalGuard {
+public:
+    ScopedDenormalGuard() : saved(read()) {
+        write(saved | kFlushBits);
+    }
+
+    ~ScopedDenormalGuard() {
+        write(saved);
+    }
+
+    ScopedDenormalGuard(const ScopedDenormalGuard&) = delete;
+    ScopedDenormalGuard& operator=(const ScopedDenormalGuard&) = delete;
+
+    // True if this platform has a flush-to-zero mode the guard can set
+    static constexpr bool isSupported() {
+#if defined(WAKEFIELD_DENORMAL_SSE) || defined(__aarch64__) || (defined(__arm__) && defined(__ARM_FP))
+        return true;
+#else
+        return false;
+#endif
+    }
+
+private:
+#if defined(WAKEFIELD_DENORMAL_SSE)
+    typedef unsigned int Mode;
+    static constexpr Mode kFlushBits = 0x8040;  // FTZ | DAZ
+    static Mode read() { return _mm_getcsr(); }
+    static void write(Mode mode) { _mm_setcsr(mode); }
+#elif defined(__aarch64__)
+    typedef uint64_t Mode;
+    static constexpr Mode kFlushBits = Mode(1) << 24;  // FZ
+    static Mode read() {
+        Mode mode;
+        __asm__ __volatile__("mrs %0, fpcr" : "=r"(mode));
+        return mode;
+    }
+    static void write(Mode mode) { __asm__ __volatile__("msr fpcr, %0" : : "r"(mode)); }
+#elif defined(__arm__) && defined(__ARM_FP)
+    typedef uint32_t Mode;
+    static constexpr Mode kFlushBits = Mode(1) << 24;  // FZ
+    static Mode read() {
+        Mode mode;
+        __asm__ __volatile__("vmrs %0, fpscr" : "=r"(mode));
+        return mode;
+    }
+    static void write(Mode mode) { __asm__ __volatile__("vmsr fpscr, %0" : : "r"(mode)); }
+#else
+    typedef int Mode;
+    static constexpr Mode kFlushBits = 0;
+    static Mode read() { return 0; }
+    static void write(Mode) {}
+#endif
+
+    Mode saved;
+};
+
+#endif // DENORMAL_GUARD_H
@@ -0,0 +1,123 @@
+#include "dsp_arena.h"
+#include <cstdint>
+#include <sys/mman.h>
+#include <unistd.h>
+
+namespace {
+
+constexpr size_t kHugePage = size_t(2) << 20;
+
+size_t roundUp(size_t bytes, size_t to) {
+    return (bytes + to - 1) / to * to;
+}
+
+void* mapAnonymous(size_t bytes, int extraFlags) {
+    return mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | extraFlags, -1, 0);
+}
+
+} // namespace
+
+const char* DspArena::backingName(Backing backing) {
+    switch (backing) {
+        case Backing::HUGETLB: return "huge pages";
+        case Backing::THP: return "transparent huge pages";
+        case Backing::PAGES: return "normal pages";
+        default: return "none";
+    }
+}
+
+DspArena::DspArena(size_t bytes) {
+    if (!reserve(bytes)) {
+        throw std::bad_alloc();
+    }
+}
+
+DspArena::~DspArena() {
+    release();
+}
+
+void DspArena::release() {
+    if (base) {
+        munmap(base, mappedBytes);
+    }
+    base = nullptr;
+    mappedBytes = 0;
+    capacity = 0;
+    used = 0;
+    backing = Backing::NONE;
+}
+
+bool DspArena::reserve(size_t bytes) {
+    release();
+    if (bytes == 0) {
+        return true;
+    }
+    const size_t page = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    void* mapping = MAP_FAILED;
+
+#ifdef MAP_HUGETLB
+    // Fails unless the administrator set huge pages aside
+    mappedBytes = roundUp(bytes, kHugePage);
+    mapping = mapAnonymous(mappedBytes, MAP_HUGETLB);
+    if (mapping != MAP_FAILED) {
+        backing = Backing::HUGETLB;
+    }
+#endif
+
+    if (mapping == MAP_FAILED && bytes >= kHugePage) {
+        // Over-map by a huge page and trim to a 2 MB boundary, so the
+        // kernel can back whole huge pages from the start
+        mappedBytes = roundUp(bytes, page);
+        void* wide = mapAnonymous(mappedBytes + kHugePage, 0);
+        if (wide != MAP_FAILED) {
+            const uintptr_t start = reinterpret_cast<uintptr_t>(wide);
+            const uintptr_t aligned = roundUp(start, kHugePage);
+            if (aligned > start) {
+                munmap(wide, aligned - start);
+            }
+            const size_t tail = kHugePage - (aligned - start);
+            if (tail > 0) {
+                munmap(reinterpret_cast<void*>(aligned + mappedBytes), tail);
+            }
+            mapping = reinterpret_cast<void*>(aligned);
+            backing = Backing::PAGES;
+#ifdef MADV_HUGEPAGE
+            if (madvise(mapping, mappedBytes, MADV_HUGEPAGE) == 0) {
+                backing = Backing::THP;
+            }
+#endif
+        }
+    }
+
+    if (mapping == MAP_FAILED) {
+        mappedBytes = roundUp(bytes, page);
+        mapping = mapAnonymous(mappedBytes, 0);
+        backing = Backing::PAGES;
+    }
+    if (mapping == MAP_FAILED) {
+        mappedBytes = 0;
+        backing = Backing::NONE;
+        return false;
+    }
+
+    // Anonymous memory is zeroed; write a byte per page so the faults
+    // happen here
+    volatile char* bytesIn = static_cast<char*>(mapping);
+    for (size_t offset = 0; offset < mappedBytes; offset += page) {
+        bytesIn[offset] = 0;
+    }
+    base = static_cast<char*>(mapping);
+    capacity = bytes;
+    used = 0;
+    return true;
+}
+
+void* DspArena::take(size_t bytes) {
+    const size_t size = round(bytes);
+    if (!base || size > capacity - used) {
+        return nullptr;
+    }
+    void* memory = base + used;
+    used += size;
+    return memory;
+}
@@ -0,0 +1,116 @@
+#ifndef DSP_ARENA_H
+#define DSP_ARENA_H
+
+#include <cstddef>
+#include <new>
+#include <utility>
+
+// One mapping for an engine's audio-thread DSP state, handed out in 64-byte
+// aligned pieces in the order the engine asks for them. Synth sizes its
+// arena up front and carves it in processing order (modulation buffers,
+// voices, voice buffers, reverbs), so the state one buffer walks through
+// is contiguous, covered by few TLB entries and aligned for SIMD loads.
+//
+// reserve() tries reserved huge pages (MAP_HUGETLB, needs vm.nr_hugepages),
+// then normal pages on a 2 MB boundary with transparent huge pages
+// requested (MADV_HUGEPAGE), then normal pages. Memory starts zeroed with
+// every page faulted in, so the audio thread never takes a page fault on
+// it. Nothing is freed piecemeal: the mapping goes with the arena.
+class DspArena {
+public:
+    static constexpr size_t kAlign = 64;
+
+    enum class Backing {
+        NONE,       // Nothing mapped
+        HUGETLB,    // Reserved huge pages
+        THP,        // Transparent huge pages requested
+        PAGES       // Normal pages
+    };
+
+    // What take(bytes) uses of the arena, for sizing it up front
+    static constexpr size_t round(size_t bytes) { return (bytes + kAlign - 1) & ~(kAlign - 1); }
+
+    static const char* backingName(Backing backing);
+
+    DspArena() = default;
+    // Throws std::bad_alloc if nothing can be mapped
+    explicit DspArena(size_t bytes);
+    ~DspArena();
+
+    // Map bytes, dropping any earlier mapping and everything taken from it
+    bool reserve(size_t bytes);
+
+    // The next bytes, or nullptr past the reserved size
+    void* take(size_t bytes);
+
+    template <typename T>
+    T* takeArray(size_t count) { return static_cast<T*>(take(count * sizeof(T))); }
+
+    // Construct a T in the arena; its owner runs the destructor
+    template <typename T, typename... Args>
+    T* create(Args&&... args) {
+        static_assert(alignof(T) <= kAlign, "type fits the arena's alignment");
+        void* memory = take(sizeof(T));
+        return memory ? new (memory) T(std::forward<Args>(args)...) : nullptr;
+    }
+
+    // A fixed count of Ts constructed in place: indexed and iterated like
+    // a vector that never grows, so its elements never move
+    template <typename T>
+    class Array {
+    public:
+        T& operator[](size_t index) { return items[index]; }
+        const T& operator[](size_t index) const { return items[index]; }
+        T* begin() { return items; }
+        T* end() { return items + count; }
+        const T* begin() const { return items; }
+        const T* end() const { return items + count; }
+        size_t size() const { return count; }
+
+    private:
+        friend class DspArena;
+        T* items = nullptr;
+        size_t count = 0;
+    };
+
+    // Empty when the arena is used up
+    template <typename T, typename... Args>
+    Array<T> createArray(size_t count, const Args&... args) {
+        static_assert(alignof(T) <= kAlign, "type fits the arena's alignment");
+        Array<T> array;
+        array.items = static_cast<T*>(take(count * sizeof(T)));
+        if (array.items) {
+            for (size_t i = 0; i < count; ++i) {
+                new (array.items + i) T(args...);
+            }
+            array.count = count;
+        }
+        return array;
+    }
+
+    template <typename T>
+    static void destroy(Array<T>& array) {
+        for (T& item : array) {
+            item.~T();
+        }
+        array = Array<T>();
+    }
+
+    size_t getCapacity() const { return capacity; }
+    size_t getUsed() const { return used; }
+    Backing getBacking() const { return backing; }
+
+    DspArena(const DspArena&) = delete;
+    DspArena& operator=(const DspArena&) = delete;
+
+private:
+    void release();
+
+    char* base = nullptr;           // Page aligned
+    size_t mappedBytes = 0;         // capacity rounded up to whole (huge) pages
+    size_t capacity = 0;
+    size_t used = 0;
+    Backing backing = Backing::NONE;
+};
+
+#endif // DSP_ARENA_H
@@ -0,0 +1,135 @@
+#include "effects_pipeline.h"
+#include "loop_manager.h"
+#include "denormal_guard.h"
+#include "profile.h"
+#include "rt_check.h"
+#include <pthread.h>
+#include <system_error>
+
+const float EffectsPipeline::kSilence[EffectsPipeline::kMaxFrames] = {};
+
+EffectsPipeline::EffectsPipeline(Synth* synth, LoopManager* loopManager)
+    : synth(synth)
+    , loopManager(loopManager) {
+}
+
+EffectsPipeline::~EffectsPipeline() {
+    stop();
+}
+
+bool EffectsPipeline::start() {
+    if (isRunning()) {
+        return true;
+    }
+    current = 0;
+    working = 0;
+    pending = false;
+    priorityCopied = false;
+    running.store(true);
+    try {
+        thread = std::thread(&EffectsPipeline::run, this);
+    } catch (const std::system_error&) {
+        running.store(false);
+        return false;
+    }
+    return true;
+}
+
+void EffectsPipeline::stop() {
+    if (!isRunning()) {
+        return;
+    }
+    if (pending) {
+        done.wait();
+        pending = false;
+    }
+    running.store(false);
+    work.post();
+    thread.join();
+}
+
+void EffectsPipeline::submit(unsigned int nFrames, const Synth::EffectSettings& effects,
+                             int loopIndex, float overdubMix, const LoopGrid* loopGrid,
+                             const float*& outLeft, const float*& outRight) {
+    // The effects thread runs what the callback would have: give it the
+    // callback thread's scheduling class and priority, once
+    if (!priorityCopied) {
+        int policy;
+        sched_param param;
+        if (pthread_getschedparam(pthread_self(), &policy, &param) == 0) {
+            pthread_setschedparam(thread.native_handle(), policy, &param);
+        }
+        priorityCopied = true;
+    }
+
+    Slot& block = slots[current];
+    block.frames = nFrames;
+    block.effects = effects;
+    block.loopIndex = loopIndex;
+    block.overdubMix = overdubMix;
+    block.loopSynced = loopGrid != nullptr;
+    if (loopGrid) {
+        block.loopGrid = *loopGrid;
+    }
+
+    // Collect the previous block; normally it finished during this callback's voices
+    Slot& previous = slots[current ^ 1];
+    bool havePrevious = false;
+    if (pending) {
+        if (!done.tryWait()) {
+            lateBlocks.fetch_add(1, std::memory_order_relaxed);
+            done.wait();
+        }
+        pending = false;
+        havePrevious = previous.frames == nFrames;
+    }
+
+    working = current;
+    pending = true;
+    work.post();
+    current ^= 1;
+
+    if (havePrevious) {
+        outLeft = previous.resultLeft;
+        outRight = previous.resultRight;
+    } else {
+        outLeft = kSilence;
+        outRight = kSilence;
+    }
+}
+
+void EffectsPipeline::run() {
+    profile::registerThread("effects");
+    for (;;) {
+        work.wait();
+        if (!running.load()) {
+            break;
+        }
+        processSlot(slots[working]);
+        done.post();
+    }
+}
+
+void EffectsPipeline::processSlot(Slot& slot) {
+    RtCheckScope rtScope;
+    ScopedDenormalGuard denormalGuard;
+
+    const unsigned int frames = slot.frames;
+    synth->processEffects(slot.left, slot.right, frames, slot.effects);
+
+    if (!loopManager) {
+        slot.resultLeft = slot.left;
+        slot.resultRight = slot.right;
+        return;
+    }
+
+    if (slot.loopIndex >= 0) {
+        loopManager->selectLoop(slot.loopIndex);
+        loopManager->setOverdubMix(slot.overdubMix);
+    }
+    profile::ScopedTimer looperTimer(profile::LOOPER);
+    loopManager->processBlock(slot.left, slot.right, slot.outLeft, slot.outRight, frames,
+                              slot.loopSynced ? &slot.loopGrid : nullptr);
+    slot.resultLeft = slot.outLeft;
+    slot.resultRight = slot.outRight;
+}
@@ -0,0 +1,88 @@
+#ifndef EFFECTS_PIPELINE_H
+#define EFFECTS_PIPELINE_H
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include "looper.h"
+#include "rt_semaphore.h"
+#include "synth.h"
+
+class LoopManager;
+
+// Pipelined render (--pipeline): the audio callback renders the voices of
+// block N while a second thread runs the filter, reverb and loopers on
+// block N-1. The two stages trade blocks through a pair of slots, so the
+// callback never waits unless the effects of the previous block overran a
+// whole period. Output is one block late in exchange for spreading the
+// load over two cores.
+//
+// Effect and looper settings travel with their block, so they are applied
+// to the same audio as in the serial path, only a block later.
+class EffectsPipeline {
+public:
+    // Largest block one slot holds; bigger device buffers run serially
+    static constexpr unsigned int kMaxFrames = 4096;
+
+    EffectsPipeline(Synth* synth, LoopManager* loopManager);
+    ~EffectsPipeline();
+
+    // Start and stop the effects thread. Call only while no callback runs
+    bool start();
+    void stop();
+    bool isRunning() const { return running.load(std::memory_order_relaxed); }
+
+    // Audio thread. Planes to render this block's voices into
+    float* voiceLeft() { return slots[current].left; }
+    float* voiceRight() { return slots[current].right; }
+
+    // Audio thread, after the voices are in voiceLeft/voiceRight: hand the
+    // block to the effects thread and get the previous block's finished
+    // output (silence for the first block or after a buffer size change).
+    // A negative loopIndex leaves the looper selection and mix unchanged;
+    // loopGrid (null when unsynced) quantizes loop changes in this block.
+    void submit(unsigned int nFrames, const Synth::EffectSettings& effects,
+                int loopIndex, float overdubMix, const LoopGrid* loopGrid,
+                const float*& outLeft, const float*& outRight);
+
+    // Callbacks that had to wait for the effects thread
+    uint64_t getLateBlocks() const { return lateBlocks.load(std::memory_order_relaxed); }
+
+private:
+    struct Slot {
+        float left[kMaxFrames];
+        float right[kMaxFrames];
+        float outLeft[kMaxFrames];
+        float outRight[kMaxFrames];
+        const float* resultLeft = nullptr;   // Where the effects thread left the output
+        const float* resultRight = nullptr;
+        unsigned int frames = 0;
+        Synth::EffectSettings effects;
+        int loopIndex = -1;
+        float overdubMix = 0.0f;
+        bool loopSynced = false;
+        LoopGrid loopGrid;
+    };
+
+    void run();
+    void processSlot(Slot& slot);
+
+    Synth* synth;
+    LoopManager* loopManager;
+
+    Slot slots[2];
+    int current = 0;            // Slot the callback renders into
+    int working = 0;            // Slot handed to the effects thread (set before work.post)
+    bool pending = false;       // A submitted block has not been collected yet
+    bool priorityCopied = false;
+
+    RtSemaphore work;           // Callback -> effects thread: a slot is ready
+    RtSemaphore done;           // Effects thread -> callback: the slot is finished
+    std::thread thread;
+    std::atomic<bool> running{false};
+    std::atomic<uint64_t> lateBlocks{0};
+
+    static const float kSilence[kMaxFrames];
+};
+
+#endif // EFFECTS_PIPELINE_H
@@ -1,4 +1,5 @@
 #include "envelope.h"
+#include "fastmath.h"
 #include <algorithm>
 #include <cmath>
 
@@ -13,14 +14,82 @@ Envelope::Envelope(float sampleRate)
     , releaseTime(0.2f)      // 200ms default release
     , attackBend(0.5f)       // Linear by default
     , releaseBend(0.5f)      // Linear by default
+    , attackExponent(1.0f)
+    , releaseExponent(1.0f)
+    , curveStep(0.0f)
+    , segmentRemaining(0)
     , attackRate(0.0f)
     , decayRate(0.0f)
     , releaseRate(0.0f)
-    , releaseStartLevel(0.0f) {
+    , releaseStartLevel(0.0f)
+    , fastReleaseRate(0.0f)
+    , shared(nullptr)
+    , sharedVersion(0) {
 
     calculateRates();
 }
 
+EnvelopeParams::EnvelopeParams(float sampleRate)
+    : sampleRate(sampleRate) {
+    attackRate = 1.0f / (attackTime * sampleRate);
+    decayRate = 1.0f / (decayTime * sampleRate);
+    releaseRate = 1.0f / (releaseTime * sampleRate);
+}
+
+void EnvelopeParams::set(float attack, float decay, float sustain, float release) {
+    attack = std::max(0.001f, attack);
+    decay = std::max(0.001f, decay);
+    sustain = std::clamp(sustain, 0.0f, 1.0f);
+    release = std::max(0.001f, release);
+    if (attack == attackTime && decay == decayTime && sustain == sustainLevel &&
+        release == releaseTime) {
+        return;
+    }
+    attackTime = attack;
+    decayTime = decay;
+    sustainLevel = sustain;
+    releaseTime = release;
+    attackRate = 1.0f / (attackTime * sampleRate);
+    decayRate = 1.0f / (decayTime * sampleRate);
+    releaseRate = 1.0f / (releaseTime * sampleRate);
+    ++version;
+}
+
+void EnvelopeParams::setBends(float attack, float release) {
+    attack = std::clamp(attack, 0.0f, 1.0f);
+    release = std::clamp(release, 0.0f, 1.0f);
+    if (attack == attackBend && release == releaseBend) {
+        return;
+    }
+    attackBend = attack;
+    releaseBend = release;
+    attackExponent = Envelope::bendToExponent(attackBend);
+    releaseExponent = Envelope::bendToExponent(releaseBend);
+    ++version;
+}
+
+void Envelope::setShared(const EnvelopeParams* params) {
+    shared = params;
+    sharedVersion = 0;
+    if (shared) {
+        copyShared();
+    } else {
+        calculateRates();
+        attackExponent = bendToExponent(attackBend);
+        releaseExponent = bendToExponent(releaseBend);
+    }
+}
+
+void Envelope::copyShared() {
+    sustainLevel = shared->sustainLevel;
+    attackRate = shared->attackRate;
+    decayRate = shared->decayRate;
+    releaseRate = shared->releaseRate;
+    attackExponent = shared->attackExponent;
+    releaseExponent = shared->releaseExponent;
+    sharedVersion = shared->version;
+}
+
 void Envelope::setAttack(float seconds) {
     attackTime = std::max(0.001f, seconds);  // Minimum 1ms
     calculateRates();
@@ -42,10 +111,12 @@ void Envelope::setRelease(float seconds) {
 
 void Envelope::setAttackBend(float bend) {
     attackBend = std::clamp(bend, 0.0f, 1.0f);
+    attackExponent = bendToExponent(attackBend);
 }
 
 void Envelope::setReleaseBend(float bend) {
     releaseBend = std::clamp(bend, 0.0f, 1.0f);
+    releaseExponent = bendToExponent(releaseBend);
 }
 
 void Envelope::calculateRates() {
@@ -62,16 +133,22 @@ void Envelope::calculateRates() {
 }
 
 void Envelope::noteOn() {
+    syncShared();
     stage = EnvelopeStage::ATTACK;
     level = 0.0f;
     stageProgress = 0.0f;
+    segmentRemaining = 0;
+    fastReleaseRate = 0.0f;
 }
 
 void Envelope::noteOff() {
+    syncShared();
     // Enter release stage
     stage = EnvelopeStage::RELEASE;
     stageProgress = 0.0f;
+    segmentRemaining = 0;
     releaseStartLevel = level;
+    fastReleaseRate = 0.0f;
     if (releaseRate >= 1.0f) {
         // Instant release
         level = 0.0f;
@@ -79,21 +156,62 @@ void Envelope::noteOff() {
     }
 }
 
-float Envelope::applyBend(float progress, float bend) const {
-    // progress: 0 to 1 (linear time progress)
-    // bend: 0 to 1, where 0.5 = linear, <0.5 = concave (slow start), >0.5 = convex (fast start)
+void Envelope::fastRelease(float seconds) {
+    if (stage == EnvelopeStage::OFF) {
+        return;
+    }
+    stage = EnvelopeStage::RELEASE;
+    stageProgress = 0.0f;
+    segmentRemaining = 0;
+    releaseStartLevel = level;
+    fastReleaseRate = std::min(1.0f / (std::max(seconds, 0.0001f) * sampleRate), 1.0f);
+}
 
+float Envelope::bendToExponent(float bend) {
+    // bend: 0 to 1, where 0.5 = linear, <0.5 = concave (slow start), >0.5 = convex (fast start)
     if (bend == 0.5f) {
-        return progress;  // Linear, no bend
+        return 1.0f;
     }
 
     // Map bend from [0, 1] to an exponent
     // bend = 0.0 -> exp = 0.1 (very concave)
     // bend = 0.5 -> exp = 1.0 (linear)
     // bend = 1.0 -> exp = 10.0 (very convex)
-    float exponent = std::pow(10.0f, (bend - 0.5f) * 2.0f);
+    return std::pow(10.0f, (bend - 0.5f) * 2.0f);
+}
+
+float Envelope::applyBend(float progress, float exponent) {
+    // progress: 0 to 1 (linear time progress)
+    if (exponent == 1.0f) {
+        return progress;  // Linear, no bend
+    }
+    return fastmath::pow(progress, exponent);
+}
+
+float Envelope::advanceCurve(float rate, float base, float span, float exponent) {
+    if (segmentRemaining <= 0) {
+        // Segment length is capped by:
+        // - kCurveSegment;
+        // - the samples left in this stage (it ends once stageProgress reaches 1);
+        // - the samples already spent in it, so segments grow 1, 2, 4, ... over
+        //   the steep start of concave curves;
+        // - 1/16 of the stage, so short stages keep enough breakpoints.
+        float remaining = std::ceil((1.0f - stageProgress) / rate);
+        float elapsed = stageProgress / rate;
+        float limit = std::min({remaining, elapsed, 1.0f / (16.0f * rate),
+                                static_cast<float>(kCurveSegment)});
+        int length = std::max(static_cast<int>(limit), 1);
+
+        // Land exactly on the curve at the segment's last sample
+        float endProgress = std::min(stageProgress + rate * static_cast<float>(length - 1), 1.0f);
+        float target = base + span * applyBend(endProgress, exponent);
+        curveStep = (target - level) / static_cast<float>(length);
+        segmentRemaining = length;
+    }
 
-    return std::pow(progress, exponent);
+    --segmentRemaining;
+    level += curveStep;
+    return level;
 }
 
 float Envelope::process() {
@@ -108,9 +226,9 @@ float Envelope::process() {
                 level = 1.0f;
                 stage = EnvelopeStage::DECAY;
                 stageProgress = 0.0f;
+                segmentRemaining = 0;
             } else {
-                float progress = std::clamp(stageProgress, 0.0f, 1.0f);
-                level = applyBend(progress, attackBend);
+                advanceCurve(attackRate, 0.0f, 1.0f, attackExponent);
             }
             break;
 
@@ -120,10 +238,9 @@ float Envelope::process() {
                 level = sustainLevel;
                 stage = EnvelopeStage::SUSTAIN;
                 stageProgress = 0.0f;
+                segmentRemaining = 0;
             } else {
-                float progress = std::clamp(stageProgress, 0.0f, 1.0f);
-                float bentProgress = applyBend(progress, releaseBend);
-                level = 1.0f + (sustainLevel - 1.0f) * bentProgress;
+                advanceCurve(decayRate, 1.0f, sustainLevel - 1.0f, releaseExponent);
             }
             break;
 
@@ -133,15 +250,15 @@ float Envelope::process() {
             break;
 
         case EnvelopeStage::RELEASE: {
-            stageProgress += releaseRate;
+            const bool fast = fastReleaseRate > 0.0f;
+            const float rate = fast ? fastReleaseRate : releaseRate;
+            stageProgress += rate;
             if (stageProgress >= 1.0f) {
                 level = 0.0f;
                 stage = EnvelopeStage::OFF;
                 stageProgress = 0.0f;
             } else {
-                float progress = std::clamp(stageProgress, 0.0f, 1.0f);
-                float bentProgress = applyBend(progress, releaseBend);
-                level = releaseStartLevel * (1.0f - bentProgress);
+                advanceCurve(rate, releaseStartLevel, -releaseStartLevel, fast ? 1.0f : releaseExponent);
                 if (level <= 0.0001f) {
                     level = 0.0f;
                     stage = EnvelopeStage::OFF;
@@ -154,3 +271,30 @@ float Envelope::process() {
 
     return level;
 }
+
+int Envelope::processBlock(float* out, int n) {
+    syncShared();
+    int i = 0;
+    while (i < n) {
+        if (stage == EnvelopeStage::OFF) {
+            // Same convention as the per-sample loop: the sample that finds the
+            // envelope OFF is not counted as active
+            level = 0.0f;
+            std::fill(out + i, out + n, 0.0f);
+            return i;
+        }
+        if (stage == EnvelopeStage::SUSTAIN) {
+            level = sustainLevel;
+            std::fill(out + i, out + n, sustainLevel);
+            return n;
+        }
+
+        out[i] = process();
+        if (stage == EnvelopeStage::OFF) {
+            std::fill(out + i, out + n, 0.0f);
+            return i;
+        }
+        ++i;
+    }
+    return n;
+}
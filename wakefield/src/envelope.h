@@ -1,6 +1,8 @@
 #ifndef ENVELOPE_H
 #define ENVELOPE_H
 
+#include <cstdint>
+
 enum class EnvelopeStage {
     OFF,
     ATTACK,
@@ -9,8 +11,40 @@ enum class EnvelopeStage {
     RELEASE
 };
 
+// ADSR settings shared by many envelopes (every voice of a Synth), with
+// the per-sample rates and bend exponents worked out once per change. The
+// version moves on whenever a value does; envelopes attached with
+// setShared() compare it and copy the block only when it has moved
+struct EnvelopeParams {
+    explicit EnvelopeParams(float sampleRate);
+
+    // Same units and limits as the Envelope setters
+    void set(float attack, float decay, float sustain, float release);
+    void setBends(float attackBend, float releaseBend);
+
+    float sampleRate;
+    float attackTime = 0.01f;
+    float decayTime = 0.1f;
+    float sustainLevel = 0.7f;
+    float releaseTime = 0.2f;
+    float attackBend = 0.5f;
+    float releaseBend = 0.5f;
+
+    float attackRate = 0.0f;
+    float decayRate = 0.0f;
+    float releaseRate = 0.0f;
+    float attackExponent = 1.0f;
+    float releaseExponent = 1.0f;
+
+    uint32_t version = 1;
+};
+
 class Envelope {
 public:
+    // Bent stages are evaluated exactly at most kCurveSegment samples apart
+    // (closer at the start of a stage) and ramped linearly in between
+    static constexpr int kCurveSegment = 16;
+
     Envelope(float sampleRate);
     
     // Set ADSR parameters (in seconds for A, D, R; 0-1 for S)
@@ -22,13 +56,27 @@ public:
     // Set envelope bend/curve parameters (0.0-1.0, where 0.5 = linear)
     void setAttackBend(float bend);   // <0.5 = concave, >0.5 = convex
     void setReleaseBend(float bend);  // Affects both decay and release curves
+
+    // Follow a shared parameter block instead (nullptr = back to the
+    // setters' values): noteOn, noteOff and processBlock take up a new
+    // version of it. The block must outlive the envelope
+    void setShared(const EnvelopeParams* params);
     
     // Trigger envelope stages
     void noteOn();
     void noteOff();
+
+    // Release linearly to zero over the given time, whatever the stage and
+    // release settings (a voice being stolen for another note)
+    void fastRelease(float seconds);
     
     // Advance envelope by one sample and return current level
     float process();
+
+    // Render n samples of envelope gain. Returns the number of samples
+    // rendered while active (n unless the envelope finished inside the block;
+    // the remaining samples are 0).
+    int processBlock(float* out, int n);
     
     // Get current state
     EnvelopeStage getStage() const { return stage; }
@@ -51,17 +99,48 @@ private:
     float attackBend;
     float releaseBend;
 
+    // progress^exponent curve per bend, recomputed when a bend changes
+    float attackExponent;
+    float releaseExponent;
+
+    // Linear ramp across the current curve segment
+    float curveStep;
+    int segmentRemaining;
+
     // Rates (increment per sample)
     float attackRate;
     float decayRate;
     float releaseRate;
     float releaseStartLevel;
 
+    // Linear release rate while fastRelease() runs, else 0 (the settings apply)
+    float fastReleaseRate;
+
+    // Shared settings and the version last copied from them
+    const EnvelopeParams* shared;
+    uint32_t sharedVersion;
+
+    // Copy the shared block if it has moved on
+    void syncShared() {
+        if (shared && shared->version != sharedVersion) {
+            copyShared();
+        }
+    }
+    void copyShared();
+
     // Calculate rates from times
     void calculateRates();
 
-    // Apply bend curve to a linear 0-1 progress value
-    float applyBend(float progress, float bend) const;
+    // Map bend (0-1) to the curve exponent (0.1 to 10, 1 = linear)
+    static float bendToExponent(float bend);
+    friend struct EnvelopeParams;
+
+    // Apply a bend exponent to a linear 0-1 progress value
+    static float applyBend(float progress, float exponent);
+
+    // Advance the level along base + span * curve(stageProgress): starts a new
+    // segment when the last one is used up, otherwise steps the ramp
+    float advanceCurve(float rate, float base, float span, float exponent);
 };
 
 #endif // ENVELOPE_H
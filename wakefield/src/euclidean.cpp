@@ -2,10 +2,78 @@
 #include <algorithm>
 #include <string>
 
+namespace {
+
+// Bjorklund's algorithm on bit groups: k groups of [1] and (n-k) groups of
+// [0], the last groups repeatedly appended to the first until at most one
+// kind is left over. Bit i of the result is step i
+constexpr uint64_t bjorklund(int k, int n) {
+    if (n <= 0 || k <= 0) {
+        return 0;
+    }
+    if (k >= n) {
+        return n >= 64 ? ~0ull : (1ull << n) - 1;
+    }
+
+    uint64_t bits[EuclideanPattern::kMaxSteps] = {};
+    int lengths[EuclideanPattern::kMaxSteps] = {};
+    int count = n;
+    for (int i = 0; i < n; ++i) {
+        bits[i] = i < k ? 1 : 0;
+        lengths[i] = 1;
+    }
+
+    // Repeatedly pair groups until we can't pair anymore
+    while (count > 1) {
+        int numLeft = count - k;
+        if (numLeft <= 0) break;
+
+        int pairCount = k < numLeft ? k : numLeft;
+
+        // Pair first pairCount groups with last pairCount groups
+        for (int i = 0; i < pairCount; ++i) {
+            --count;
+            bits[i] |= bits[count] << lengths[i];
+            lengths[i] += lengths[count];
+        }
+
+        // Update k for next iteration
+        k = pairCount;
+    }
+
+    // Flatten groups into single pattern
+    uint64_t result = 0;
+    int position = 0;
+    for (int i = 0; i < count; ++i) {
+        result |= bits[i] << position;
+        position += lengths[i];
+    }
+    return result;
+}
+
+// Unrotated patterns, [steps][hits] for hits <= steps
+struct EuclideanTable {
+    uint64_t masks[EuclideanPattern::kMaxSteps + 1][EuclideanPattern::kMaxSteps + 1] = {};
+
+    constexpr EuclideanTable() {
+        for (int n = 1; n <= EuclideanPattern::kMaxSteps; ++n) {
+            for (int k = 0; k <= n; ++k) {
+                masks[n][k] = bjorklund(k, n);
+            }
+        }
+    }
+};
+
+constexpr EuclideanTable kEuclideanTable;
+static_assert(kEuclideanTable.masks[8][3] == 0x29, "3/8 should be X..X.X..");
+
+}  // namespace
+
 EuclideanPattern::EuclideanPattern()
     : hits(4)
     , steps(16)
     , rotation(0)
+    , mask(0)
 {
     generate();
 }
@@ -14,6 +82,7 @@ EuclideanPattern::EuclideanPattern(int h, int s, int r)
     : hits(h)
     , steps(s)
     , rotation(r)
+    , mask(0)
 {
     generate();
 }
@@ -34,81 +103,36 @@ void EuclideanPattern::setRotation(int r) {
     generate();
 }
 
-std::vector<bool> EuclideanPattern::bjorklund(int k, int n) const {
-    // Bjorklund's algorithm for Euclidean rhythms
-    // Distributes k hits evenly across n steps
-
-    if (k == 0 || n == 0) {
-        return std::vector<bool>(n, false);
-    }
-
-    if (k >= n) {
-        return std::vector<bool>(n, true);
-    }
-
-    // Initialize: k groups of [1] and (n-k) groups of [0]
-    std::vector<std::vector<bool>> groups;
-    for (int i = 0; i < k; ++i) {
-        groups.push_back({true});
-    }
-    for (int i = 0; i < n - k; ++i) {
-        groups.push_back({false});
-    }
-
-    // Repeatedly pair groups until we can't pair anymore
-    while (groups.size() > 1) {
-        int numLeft = groups.size() - k;
-        if (numLeft <= 0) break;
-
-        int pairCount = std::min(k, numLeft);
-
-        // Pair first pairCount groups with last pairCount groups
-        for (int i = 0; i < pairCount; ++i) {
-            std::vector<bool>& front = groups[i];
-            std::vector<bool>& back = groups[groups.size() - 1];
-            front.insert(front.end(), back.begin(), back.end());
-            groups.pop_back();
-        }
-
-        // Update k for next iteration
-        k = pairCount;
-    }
-
-    // Flatten groups into single pattern
-    std::vector<bool> result;
-    for (const auto& group : groups) {
-        result.insert(result.end(), group.begin(), group.end());
-    }
-
-    return result;
-}
-
 void EuclideanPattern::generate() {
-    // Generate base pattern
-    pattern = bjorklund(hits, steps);
-
-    // Apply rotation
-    if (rotation != 0 && !pattern.empty()) {
-        int rot = rotation % steps;
-        if (rot < 0) rot += steps;
-
-        std::rotate(pattern.begin(), pattern.begin() + rot, pattern.end());
+    const int n = std::clamp(steps, 0, kMaxSteps);
+    const int k = std::clamp(hits, 0, n);
+    mask = kEuclideanTable.masks[n][k];
+
+    // Apply rotation: step i takes the hit of step i + rotation
+    if (rotation != 0 && n > 0) {
+        int rot = rotation % n;
+        if (rot < 0) rot += n;
+
+        if (rot != 0) {
+            const uint64_t wrap = n >= 64 ? ~0ull : (1ull << n) - 1;
+            mask = ((mask >> rot) | (mask << (n - rot))) & wrap;
+        }
     }
 }
 
 bool EuclideanPattern::getTrigger(int step) const {
-    if (pattern.empty() || steps == 0) return false;
+    if (steps <= 0) return false;
 
     int index = step % steps;
     if (index < 0) index += steps;
 
-    return pattern[index];
+    return index < kMaxSteps && ((mask >> index) & 1);
 }
 
 std::string EuclideanPattern::toString() const {
     std::string result;
-    for (bool hit : pattern) {
-        result += hit ? "X " : "· ";
+    for (int i = 0; i < std::min(steps, kMaxSteps); ++i) {
+        result += ((mask >> i) & 1) ? "X " : "· ";
     }
     return result;
 }
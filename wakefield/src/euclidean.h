@@ -1,13 +1,17 @@
 #ifndef EUCLIDEAN_H
 #define EUCLIDEAN_H
 
-#include <vector>
+#include <cstdint>
 #include <string>
 
 // Euclidean rhythm generator using Bjorklund's algorithm
-// Distributes N hits evenly across M steps
+// Distributes N hits evenly across M steps. Every pattern up to 64 steps is
+// built at compile time, so changing hits, steps or rotation is a table
+// lookup and a rotate, and a step query is one bit test
 class EuclideanPattern {
 public:
+    static constexpr int kMaxSteps = 64;
+
     EuclideanPattern();
     EuclideanPattern(int hits, int steps, int rotation = 0);
 
@@ -20,12 +24,12 @@ public:
     int getSteps() const { return steps; }
     int getRotation() const { return rotation; }
 
-    // Generate pattern using Bjorklund's algorithm
+    // Look up the pattern for the current hits, steps and rotation
     void generate();
 
     // Query pattern
     bool getTrigger(int step) const;
-    const std::vector<bool>& getPattern() const { return pattern; }
+    uint64_t getMask() const { return mask; }  // Bit i = step i
 
     // Get pattern as string for display (X = hit, . = rest)
     std::string toString() const;
@@ -43,10 +47,7 @@ private:
     int hits;        // Number of triggers
     int steps;       // Total pattern length
     int rotation;    // Rotate pattern by N steps
-    std::vector<bool> pattern;  // Generated trigger mask
-
-    // Bjorklund's algorithm implementation
-    std::vector<bool> bjorklund(int hits, int steps) const;
+    uint64_t mask;   // Generated trigger mask, bit i = step i
 };
 
 #endif // EUCLIDEAN_H
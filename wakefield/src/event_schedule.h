@@ -0,0 +1,99 @@
+#ifndef EVENT_SCHEDULE_H
+#define EVENT_SCHEDULE_H
+
+#include <cstdint>
+#include <limits>
+
+// Note and automation events for one audio buffer, each tagged with the
+// frame it takes effect on. Filled at the top of the audio callback (MIDI
+// input, the sequencer) and consumed by the render loop, which splits the
+// buffer at every event frame. Fixed capacity, no allocation.
+struct ScheduledEvent {
+    enum Type : uint8_t {
+        NOTE_ON,
+        NOTE_OFF,
+        PARAM           // note is the parameter id, value its 0-1 setting
+    };
+    static constexpr uint8_t kNoChannel = 0xFF;
+
+    uint32_t frame;     // Offset from the start of the buffer
+    Type type;
+    uint8_t note;
+    uint8_t velocity;
+    uint8_t channel;    // MIDI channel 0-15, or kNoChannel (sequencer, replay)
+    float value;        // PARAM only
+};
+
+class EventSchedule {
+public:
+    static constexpr int kCapacity = 256;
+    static constexpr uint32_t kNoEvent = std::numeric_limits<uint32_t>::max();
+
+    void clear() {
+        count = 0;
+        next = 0;
+    }
+
+    // Insert in frame order; events on the same frame keep insertion order.
+    // Returns false (and drops the event) when the buffer is full
+    bool add(uint32_t frame, ScheduledEvent::Type type, uint8_t note, uint8_t velocity,
+             uint8_t channel = ScheduledEvent::kNoChannel) {
+        return insert(ScheduledEvent{frame, type, note, velocity, channel, 0.0f});
+    }
+
+    // An automation value for parameter id param (applyNormalizedToParameter)
+    bool addParam(uint32_t frame, uint8_t param, float value) {
+        return insert(ScheduledEvent{frame, ScheduledEvent::PARAM, param, 0, ScheduledEvent::kNoChannel, value});
+    }
+
+    // Frame of the next event not yet dispatched, or kNoEvent
+    uint32_t nextFrame() const {
+        return next < count ? events[next].frame : kNoEvent;
+    }
+
+    // Hand every undispatched event with frame <= upTo to fn, in order
+    template <typename Fn>
+    void dispatchThrough(uint32_t upTo, Fn&& fn) {
+        while (next < count && events[next].frame <= upTo) {
+            fn(events[next++]);
+        }
+    }
+
+    // Remove the undispatched events take(event) returns true for; the
+    // rest keep their order
+    template <typename Fn>
+    void extract(Fn&& take) {
+        int kept = next;
+        for (int i = next; i < count; ++i) {
+            if (!take(events[i])) {
+                events[kept++] = events[i];
+            }
+        }
+        count = kept;
+    }
+
+    // Events rejected because the buffer was full (audio thread counter)
+    uint32_t getDropped() const { return dropped; }
+
+private:
+    bool insert(const ScheduledEvent& event) {
+        if (count == kCapacity) {
+            ++dropped;
+            return false;
+        }
+        int i = count++;
+        while (i > next && events[i - 1].frame > event.frame) {
+            events[i] = events[i - 1];
+            --i;
+        }
+        events[i] = event;
+        return true;
+    }
+
+    ScheduledEvent events[kCapacity];
+    int count = 0;
+    int next = 0;
+    uint32_t dropped = 0;
+};
+
+#endif // EVENT_SCHEDULE_H
@@ -0,0 +1,174 @@
+#ifndef FASTMATH_H
+#define FASTMATH_H
+
+#include <algorithm>
+#include <cstdint>
+#include <cmath>
+#include <cstring>
+
+// Branch-free float approximations of the libm calls used on the audio
+// thread. Everything here is inline and uses only arithmetic, min/max and
+// bit casts, so loops over these functions auto-vectorize (GCC needs
+// -fno-trapping-math to if-convert the clamps; CMakeLists.txt sets it).
+// Error bounds are measured by bench/fastmath_bench.cpp against libm in
+// double precision; inputs outside the stated domains are clamped.
+namespace fastmath {
+
+namespace detail {
+
+inline float asFloat(uint32_t bits) {
+    float f;
+    std::memcpy(&f, &bits, sizeof(f));
+    return f;
+}
+
+inline uint32_t asBits(float f) {
+    uint32_t bits;
+    std::memcpy(&bits, &f, sizeof(bits));
+    return bits;
+}
+
+// Round to nearest (ties to even) for |x| < 2^22: adding 1.5 * 2^23 pushes
+// the fraction bits out of the mantissa. Breaks under -ffast-math.
+inline float roundToInt(float x) {
+    return (x + 12582912.0f) - 12582912.0f;
+}
+
+inline float clamp(float x, float lo, float hi) {
+    return std::min(std::max(x, lo), hi);
+}
+
+} // namespace detail
+
+// 2^x. Relative error < 3e-7 (about 2 ulp) for x in [-125, 127].
+inline float exp2(float x) {
+    x = detail::clamp(x, -125.0f, 127.0f);
+    const float k = detail::roundToInt(x);
+    const float f = x - k;  // [-0.5, 0.5]
+    // Minimax (relative) degree-5 fit of 2^f on [-0.5, 0.5]
+    float p = 1.3266970e-3f;
+    p = p * f + 9.6754597e-3f;
+    p = p * f + 5.5507426e-2f;
+    p = p * f + 2.4022122e-1f;
+    p = p * f + 6.9314695e-1f;
+    p = p * f + 1.0f;  // Exact at f = 0 so exp2(0) == 1
+    // Scale by 2^k by adding k to the exponent field
+    const int32_t ki = static_cast<int32_t>(k);
+    return detail::asFloat(detail::asBits(p) + (static_cast<uint32_t>(ki) << 23));
+}
+
+// e^x. Relative error < 5e-7 for |x| <= 4, < 5e-6 over [-86, 88] (from
+// rounding x * log2(e) to float).
+inline float exp(float x) {
+    return exp2(x * 1.44269504088896341f);
+}
+
+// log2(x) for finite x > 0. Error < 2e-7 * max(1, |log2(x)|).
+// Inputs below FLT_MIN (including x <= 0) return -126.
+inline float log2(float x) {
+    x = std::max(x, 1.17549435e-38f);
+    // Split x = 2^e * m with m in [sqrt(0.5), sqrt(2))
+    const uint32_t bits = detail::asBits(x);
+    const int32_t e = static_cast<int32_t>(bits - 0x3f3504f3u) >> 23;
+    const float m = detail::asFloat(bits - (static_cast<uint32_t>(e) << 23));
+    // log2(m) = 2/ln2 * atanh(s), s = (m - 1) / (m + 1), |s| < 0.172
+    const float s = (m - 1.0f) / (m + 1.0f);
+    const float s2 = s * s;
+    const float p = 2.8853913f + s2 * (0.96147149f + s2 * 0.59895532f);
+    return static_cast<float>(e) + s * p;
+}
+
+// x^y for x > 0; returns 0 for x <= 0 (the envelope/curve use case).
+// Relative error < 3e-7 * max(1, |y * log2(x)|).
+inline float pow(float x, float y) {
+    const float r = exp2(y * log2(x));
+    return x > 0.0f ? r : 0.0f;
+}
+
+// sin(2*pi*t) with t in turns. Absolute error < 2e-7 for |t| < 2^22;
+// the reduction to [-0.5, 0.5) is exact, so no error growth with |t|.
+inline float sinTurns(float t) {
+    float r = t - detail::roundToInt(t);  // [-0.5, 0.5]
+    // Fold onto [-0.25, 0.25] using sin(pi - a) = sin(a)
+    r = std::copysign(0.25f - std::fabs(0.25f - std::fabs(r)), r);
+    const float r2 = r * r;
+    // Minimax odd degree-9 fit of sin(2*pi*r) on [-0.25, 0.25]
+    float p = 39.535771f;
+    p = p * r2 - 76.549651f;
+    p = p * r2 + 81.600998f;
+    p = p * r2 - 41.341655f;
+    p = p * r2 + 6.2831852f;
+    return p * r;
+}
+
+// cos(2*pi*t) with t in turns. Same bound as sinTurns.
+inline float cosTurns(float t) {
+    // cos(2*pi*r) = sin(2*pi*(0.25 - |r|)), already inside the fold range
+    float r = t - detail::roundToInt(t);
+    r = 0.25f - std::fabs(r);
+    const float r2 = r * r;
+    float p = 39.535771f;
+    p = p * r2 - 76.549651f;
+    p = p * r2 + 81.600998f;
+    p = p * r2 - 41.341655f;
+    p = p * r2 + 6.2831852f;
+    return p * r;
+}
+
+// sin/cos in radians. Absolute error < 5e-7 for |x| <= 2*pi and grows by
+// about |x| * 1e-7 beyond that from rounding x / (2*pi) to float.
+inline float sin(float x) {
+    return sinTurns(x * 0.159154943091895336f);
+}
+
+inline float cos(float x) {
+    return cosTurns(x * 0.159154943091895336f);
+}
+
+// tanh(x). Absolute error < 4e-7 over all finite x (saturates past |x| = 7.9).
+// Rational 13/6 minimax fit (same form as Eigen's float tanh).
+inline float tanh(float x) {
+    x = detail::clamp(x, -7.90531111f, 7.90531111f);
+    const float x2 = x * x;
+    float p = -2.76076847742355e-16f;
+    p = p * x2 + 2.00018790482477e-13f;
+    p = p * x2 - 8.60467152213735e-11f;
+    p = p * x2 + 5.12229709037114e-08f;
+    p = p * x2 + 1.48572235717979e-05f;
+    p = p * x2 + 6.37261928875436e-04f;
+    p = p * x2 + 4.89352455891786e-03f;
+    p = p * x;
+    float q = 1.19825839466702e-06f;
+    q = q * x2 + 1.18534705686654e-04f;
+    q = q * x2 + 2.26843463243900e-03f;
+    q = q * x2 + 4.89352518554385e-03f;
+    return p / q;
+}
+
+// tan(pi*x) for x in [0, 0.49], the bilinear-transform prewarp of a
+// normalized frequency x = f / fs. Relative error < 3e-7. Below fs/4 an odd
+// degree-13 polynomial (Cephes tanf) in pi*x; above it tan(pi*x) =
+// 1 / tan(pi*(1/2 - x)) folds back onto that range.
+inline float tanPi(float x) {
+    x = detail::clamp(x, 0.0f, 0.49f);
+    const bool upper = x > 0.25f;
+    const float z = 3.14159265358979323846f * (upper ? 0.5f - x : x);
+    const float z2 = z * z;
+    float p = 9.38540185543e-3f;
+    p = p * z2 + 3.11992232697e-3f;
+    p = p * z2 + 2.44301354525e-2f;
+    p = p * z2 + 5.34112807005e-2f;
+    p = p * z2 + 1.33387994085e-1f;
+    p = p * z2 + 3.33331568548e-1f;
+    const float t = z + z * z2 * p;
+    return upper ? 1.0f / t : t;
+}
+
+// 10^(dB/20). Relative error < 1e-6 for |dB| <= 120.
+inline float dB2amp(float dB) {
+    return exp2(dB * 0.166096404744368118f);  // log2(10) / 20
+}
+
+} // namespace fastmath
+
+#endif // FASTMATH_H
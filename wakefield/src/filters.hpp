@@ -5,6 +5,9 @@
 #include <cstdint>
 #include <utility>
 
+#include "fastmath.h"
+#include "../../shared/dsp/one_pole.h"
+
 
 
 
@@ -16,29 +19,33 @@
 
 struct OnePoleTPT {
     explicit OnePoleTPT(float sampleRate = 48000.f) : sr(std::max(1.f, sampleRate)) {
-        setCutoff(1000.f);
+        updateCoeffs();
     }
 
     void setSampleRate(float sampleRate) {
         sr = std::max(1.f, sampleRate);
-        setCutoff(fcHz); // recompute coeffs for new SR
+        updateCoeffs(); // recompute coeffs for new SR
     }
 
+    // Recomputes only when the clamped cutoff changes
     void setCutoff(float hz) {
         // clamp to [0, Nyquist*0.49] to avoid tan() blowup
-        fcHz = std::clamp(hz, 0.0f, 0.49f * sr);
-        constexpr float PI = 3.14159265358979323846f;
-        const float g = std::tan(PI * fcHz / sr);   // trapezoidal (BLT) prewarp
-        tpt_g   = g;
-        tpt_inv = 1.0f / (1.0f + g);                // precompute 1/(1+g)
+        const float clamped = std::clamp(hz, 0.0f, 0.49f * sr);
+        if (clamped != fcHz) {
+            fcHz = clamped;
+            updateCoeffs();
+        }
+    }
+
+    // g/(1+g) for a normalized cutoff, as setCutoff computes it
+    static inline float integratorGainAt(float normalizedHz) {
+        return kernels::tptGain(fastmath::tanPi(normalizedHz));   // trapezoidal (BLT) prewarp
     }
 
     // Process one sample; returns {lp, hp}
     inline std::pair<float, float> process(float x) {
         // v = (x - s) * g/(1+g)
-        const float v  = (x - s) * (tpt_g * tpt_inv);
-        const float lp = v + s;
-        s = lp + v;                 // state update (integrator)
+        const float lp = kernels::onePoleTPT(s, x, tpt_g * tpt_inv);
         const float hp = x - lp;    // complementary HP
         return { lp, hp };
     }
@@ -47,15 +54,65 @@ struct OnePoleTPT {
     inline void processBlock(const float* in, float* outLP, float* outHP, int n) {
         for (int i = 0; i < n; ++i) {
             const float xi = in[i];
-            const float v  = (xi - s) * (tpt_g * tpt_inv);
-            const float lp = v + s;
-            s = lp + v;
+            const float lp = kernels::onePoleTPT(s, xi, tpt_g * tpt_inv);
             outLP[i] = lp;
             outHP[i] = xi - lp;
         }
     }
 
-    inline void reset(float val = 0.f) { s = val; }
+    // Process both channels of a stereo block in place, lowpass or
+    // highpass; the right channel keeps its own state
+    inline void processStereo(float* left, float* right, int n, bool highpass) {
+        const float k = tpt_g * tpt_inv;
+        float sl = s;
+        float sr2 = sRight;
+        for (int i = 0; i < n; ++i) {
+            const float xl = left[i];
+            const float xr = right[i];
+            const float lpl = kernels::onePoleTPT(sl, xl, k);
+            const float lpr = kernels::onePoleTPT(sr2, xr, k);
+            left[i] = highpass ? xl - lpl : lpl;
+            right[i] = highpass ? xr - lpr : lpr;
+        }
+        s = sl;
+        sRight = sr2;
+    }
+
+    // processStereo with the cutoff gliding exponentially from its current
+    // value to hz across the block, one prewarp lookup per sample; leaves
+    // the filter as setCutoff(hz) would
+    inline void processStereoGlide(float* left, float* right, int n, bool highpass, float hz) {
+        const float target = std::clamp(hz, 0.0f, 0.49f * sr);
+        if (target == fcHz || n <= 0) {
+            setCutoff(target);
+            processStereo(left, right, n, highpass);
+            return;
+        }
+        const float start = std::max(fcHz, 1.0f) / sr;
+        const float step = fastmath::exp2(fastmath::log2(std::max(target, 1.0f) / sr / start) / static_cast<float>(n));
+        float x = start;
+        float sl = s;
+        float sr2 = sRight;
+        for (int i = 0; i < n; ++i) {
+            x *= step;
+            const float k = integratorGainAt(x);
+            const float xl = left[i];
+            const float xr = right[i];
+            const float lpl = kernels::onePoleTPT(sl, xl, k);
+            const float lpr = kernels::onePoleTPT(sr2, xr, k);
+            left[i] = highpass ? xl - lpl : lpl;
+            right[i] = highpass ? xr - lpr : lpr;
+        }
+        s = sl;
+        sRight = sr2;
+        setCutoff(target);
+    }
+
+    inline void reset(float val = 0.f) { s = val; sRight = val; }
+
+    // Integrator gain g/(1+g), for kernels that run this filter's
+    // coefficients on their own state
+    float integratorGain() const { return tpt_g * tpt_inv; }
 
     // (optional) expose current cutoff and SR
     float sampleRate() const { return sr; }
@@ -67,8 +124,15 @@ private:
 
     // integrator state and precomputed coeffs
     float s       = 0.f;   // state (integrator memory)
+    float sRight  = 0.f;   // right channel state for processStereo
     float tpt_g   = 0.f;   // tan(pi*f/sr)
     float tpt_inv = 1.f;   // 1/(1+g)
+
+    void updateCoeffs() {
+        const float g = fastmath::tanPi(fcHz / sr);   // trapezoidal (BLT) prewarp
+        tpt_g   = g;
+        tpt_inv = 1.0f / (1.0f + g);                // precompute 1/(1+g)
+    }
 };
 
 
@@ -88,62 +152,102 @@ struct OnePoleHighShelfBLT {
     // Coeffs
     float b0{1.0f}, b1{0.0f}, a1{0.0f};
 
-    // State (TDF2)
+    // State (TDF2); s1R is the right channel for processStereo
     float s1{0.0f};
-
-    // --- utility
-    static inline float fast_tan(float x) { return std::tan(x); }
+    float s1R{0.0f};
 
     void setSampleRate(float sr) {
         sampleRate = std::max(1.0f, sr);
         updateCoeffs();
     }
 
-    // Cutoff: clamp to (0, 0.49*sr) to keep prewarp sane
+    // Cutoff: clamp to (0, 0.49*sr) to keep prewarp sane. The setters
+    // recompute only when the clamped cutoff or the gain changes
     void setCutoff(float hz) {
-        fcHz = std::clamp(hz, 1e-3f, 0.49f * sampleRate);
-        updateCoeffs();
+        const float clamped = std::clamp(hz, 1e-3f, 0.49f * sampleRate);
+        if (clamped != fcHz) {
+            fcHz = clamped;
+            updateCoeffs();
+        }
     }
 
     // Set high-frequency gain in dB (e.g. +6 dB => A=~2.0)
     void setGainDb(float dB) {
-        A = std::pow(10.0f, dB / 20.0f);
-        updateCoeffs();
+        setGainLinear(fastmath::dB2amp(dB));
     }
 
     // Or set directly in linear scale
     void setGainLinear(float linearA) {
         // avoid non-physical negatives or zeros
-        A = std::max(1e-6f, linearA);
-        updateCoeffs();
+        const float clamped = std::max(1e-6f, linearA);
+        if (clamped != A) {
+            A = clamped;
+            updateCoeffs();
+        }
     }
 
-    void reset() { s1 = 0.0f; }
+    void reset() { s1 = 0.0f; s1R = 0.0f; }
 
     inline float process(float x) {
         // Transposed Direct Form II (one state), modulation-stable
-        float y = b0 * x + s1;
-        s1 = b1 * x - a1 * y;
-        // tiny DC blocker against subnormal build-up (optional)
-        return y;
+        return kernels::firstOrderTDF2(s1, x, b0, b1, a1);
     }
 
     void processBlock(const float* in, float* out, int N) {
         for (int n = 0; n < N; ++n) out[n] = process(in[n]);
     }
 
+    // Both channels in place with one set of coefficients
+    void processStereo(float* left, float* right, int N) {
+        float sl = s1;
+        float sr = s1R;
+        for (int n = 0; n < N; ++n) {
+            left[n] = kernels::firstOrderTDF2(sl, left[n], b0, b1, a1);
+            right[n] = kernels::firstOrderTDF2(sr, right[n], b0, b1, a1);
+        }
+        s1 = sl;
+        s1R = sr;
+    }
+
+    // processStereo with the turnover gliding exponentially from its
+    // current value to hz across the block, one prewarp lookup per sample;
+    // leaves the filter as setCutoff(hz) would
+    void processStereoGlide(float* left, float* right, int N, float hz) {
+        const float target = std::clamp(hz, 1e-3f, 0.49f * sampleRate);
+        if (target == fcHz || N <= 0) {
+            setCutoff(target);
+            processStereo(left, right, N);
+            return;
+        }
+        const float step = fastmath::exp2(fastmath::log2(target / fcHz) / static_cast<float>(N));
+        float x = fcHz / sampleRate;
+        float sl = s1;
+        float sr = s1R;
+        for (int n = 0; n < N; ++n) {
+            x *= step;
+            float gb0, gb1, ga1;
+            coeffsFor(fastmath::tanPi(x), gb0, gb1, ga1);
+            left[n] = kernels::firstOrderTDF2(sl, left[n], gb0, gb1, ga1);
+            right[n] = kernels::firstOrderTDF2(sr, right[n], gb0, gb1, ga1);
+        }
+        s1 = sl;
+        s1R = sr;
+        setCutoff(target);
+    }
+
 private:
+    // Coefficients for a prewarped g = tan(pi*fc/fs)
+    void coeffsFor(float g, float& cb0, float& cb1, float& ca1) const {
+        kernels::highShelfBLT(g, A, cb0, cb1, ca1);
+    }
+
     void updateCoeffs() {
         // prewarp (bilinear): g = tan(pi*fc/fs)
-        const float g = fast_tan(float(M_PI) * (fcHz / sampleRate));
-
-        const float denom = 1.0f + g + 1e-30f; // keep safe
-        a1 = (g - 1.0f) / denom;               // feedback
-        b0 = (A + g) / denom;
-        b1 = -(A - g) / denom;
+        coeffsFor(fastmath::tanPi(fcHz / sampleRate), b0, b1, a1);
 
         // simple denormal guard on state if coeffs change wildly
         if (std::abs(s1) < 1e-30f) s1 = 0.0f;
+        if (std::abs(s1R) < 1e-30f) s1R = 0.0f;
     }
 };
 
@@ -163,46 +267,87 @@ struct OnePoleLowShelfBLT {
     // Coeffs
     float b0{1.0f}, b1{0.0f}, a1{0.0f};
 
-    // State (TDF2)
+    // State (TDF2); s1R is the right channel for processStereo
     float s1{0.0f};
-
-    static inline float fast_tan(float x) { return std::tan(x); }
+    float s1R{0.0f};
 
     void setSampleRate(float sr) { sampleRate = std::max(1.0f, sr); updateCoeffs(); }
 
+    // Like the high shelf, recomputes only on a change
     void setCutoff(float hz) {
-        fcHz = std::clamp(hz, 1e-3f, 0.49f * sampleRate);
-        updateCoeffs();
+        const float clamped = std::clamp(hz, 1e-3f, 0.49f * sampleRate);
+        if (clamped != fcHz) {
+            fcHz = clamped;
+            updateCoeffs();
+        }
     }
 
     // A is the **low-frequency** gain for LS
-    void setGainDb(float dB) { A = std::pow(10.0f, dB / 20.0f); updateCoeffs(); }
-    void setGainLinear(float linearA) { A = std::max(1e-6f, linearA); updateCoeffs(); }
+    void setGainDb(float dB) { setGainLinear(fastmath::dB2amp(dB)); }
+    void setGainLinear(float linearA) {
+        const float clamped = std::max(1e-6f, linearA);
+        if (clamped != A) {
+            A = clamped;
+            updateCoeffs();
+        }
+    }
 
-    void reset() { s1 = 0.0f; }
+    void reset() { s1 = 0.0f; s1R = 0.0f; }
 
     inline float process(float x) {
-        float y = b0 * x + s1;
-        s1 = b1 * x - a1 * y;
-        return y;
+        return kernels::firstOrderTDF2(s1, x, b0, b1, a1);
     }
 
     void processBlock(const float* in, float* out, int N) {
         for (int n = 0; n < N; ++n) out[n] = process(in[n]);
     }
 
+    // Both channels in place with one set of coefficients
+    void processStereo(float* left, float* right, int N) {
+        float sl = s1;
+        float sr = s1R;
+        for (int n = 0; n < N; ++n) {
+            left[n] = kernels::firstOrderTDF2(sl, left[n], b0, b1, a1);
+            right[n] = kernels::firstOrderTDF2(sr, right[n], b0, b1, a1);
+        }
+        s1 = sl;
+        s1R = sr;
+    }
+
+    // See OnePoleHighShelfBLT::processStereoGlide
+    void processStereoGlide(float* left, float* right, int N, float hz) {
+        const float target = std::clamp(hz, 1e-3f, 0.49f * sampleRate);
+        if (target == fcHz || N <= 0) {
+            setCutoff(target);
+            processStereo(left, right, N);
+            return;
+        }
+        const float step = fastmath::exp2(fastmath::log2(target / fcHz) / static_cast<float>(N));
+        float x = fcHz / sampleRate;
+        float sl = s1;
+        float sr = s1R;
+        for (int n = 0; n < N; ++n) {
+            x *= step;
+            float gb0, gb1, ga1;
+            coeffsFor(fastmath::tanPi(x), gb0, gb1, ga1);
+            left[n] = kernels::firstOrderTDF2(sl, left[n], gb0, gb1, ga1);
+            right[n] = kernels::firstOrderTDF2(sr, right[n], gb0, gb1, ga1);
+        }
+        s1 = sl;
+        s1R = sr;
+        setCutoff(target);
+    }
+
 private:
-    void updateCoeffs() {
-        const float g = fast_tan(float(M_PI) * (fcHz / sampleRate)); // prewarp
-        const float d = 1.0f + g + 1e-30f;
+    void coeffsFor(float g, float& cb0, float& cb1, float& ca1) const {
+        kernels::lowShelfBLT(g, A, cb0, cb1, ca1);
+    }
 
-        // --------- ONLY THESE LINES DIFFER FROM HS ----------
-        a1 = (g - 1.0f) / d;
-        b0 = (1.0f + A * g) / d;
-        b1 = (A * g - 1.0f) / d;
-        // -----------------------------------------------------
+    void updateCoeffs() {
+        coeffsFor(fastmath::tanPi(fcHz / sampleRate), b0, b1, a1); // prewarp
 
         if (std::abs(s1) < 1e-30f) s1 = 0.0f; // denormal guard
+        if (std::abs(s1R) < 1e-30f) s1R = 0.0f;
     }
 };
 
@@ -300,6 +445,125 @@ private:
     float lastFeedbackHP = 0.0f;
 
     inline float saturate(float x) const {
-        return std::tanh(x);
+        return fastmath::tanh(x);
+    }
+};
+
+
+
+
+
+// Four Ladder8PoleZdf channels with shared settings, one per lane of a
+// 16-byte vector (SSE on x86-64, NEON on ARM), so the eight ZDF stages and
+// their tanh saturators run once for all lanes and the coefficients are
+// computed once. Each lane does exactly the arithmetic of
+// Ladder8PoleZdf::process; the stereo filter uses lanes 0 and 1.
+class Ladder8PoleZdfX4 {
+public:
+    static constexpr int kLanes = 4;
+    typedef kernels::Lanes<float, kLanes>::type Lanes;
+
+    explicit Ladder8PoleZdfX4(float sampleRate = 48000.0f) {
+        setSampleRate(sampleRate);
+        setCutoff(1000.0f);
+    }
+
+    void setSampleRate(float sr) {
+        sampleRate = std::max(1.0f, sr);
+        stageCoeffs.setSampleRate(sampleRate);
+        feedbackCoeffs.setSampleRate(sampleRate);
+        setCutoff(cutoffHz);
+        setFeedbackHighpass(feedbackHpHz);
+    }
+
+    // Same ranges and mappings as Ladder8PoleZdf
+    void setCutoff(float hz) {
+        cutoffHz = std::clamp(hz, 20.0f, 0.45f * sampleRate);
+        stageCoeffs.setCutoff(cutoffHz);
+        stageGain = stageCoeffs.integratorGain();
+    }
+
+    void setResonance(float amount) {
+        resonance = std::clamp(amount, 0.0f, 1.2f);
+        resonanceGain = 0.2f + resonance * 3.5f;
+    }
+
+    void setDrive(float driveAmount) {
+        float drv = std::clamp(driveAmount, 0.1f, 15.0f);
+        inputDrive = drv;
+        stageDrive = drv <= 1.0f ? 1.0f : 1.0f + (drv - 1.0f) * 0.5f;
+    }
+
+    void setFeedbackHighpass(float hz) {
+        feedbackHpHz = std::clamp(hz, 10.0f, std::min(6000.0f, 0.45f * sampleRate));
+        feedbackCoeffs.setCutoff(feedbackHpHz);
+        feedbackGain = feedbackCoeffs.integratorGain();
+    }
+
+    void reset() {
+        for (auto& state : stageState) state = Lanes{};
+        feedbackState = Lanes{};
+        lastFeedbackHP = Lanes{};
+    }
+
+    // One sample for each lane
+    Lanes process(Lanes in) {
+        Lanes x = saturate(in * inputDrive - lastFeedbackHP * resonanceGain);
+
+        for (auto& s : stageState) {
+            x = saturate(kernels::onePoleTPT(s, x, stageGain) * stageDrive);
+        }
+
+        lastFeedbackHP = x - kernels::onePoleTPT(feedbackState, x, feedbackGain);
+        return x;
+    }
+
+    // Both channels of a stereo block in place, on lanes 0 and 1
+    void processStereo(float* left, float* right, int n) {
+        for (int i = 0; i < n; ++i) {
+            const Lanes y = process(Lanes{left[i], right[i], 0.0f, 0.0f});
+            left[i] = y[0];
+            right[i] = y[1];
+        }
+    }
+
+private:
+    float sampleRate = 48000.0f;
+    float cutoffHz = 1000.0f;
+    float resonance = 0.0f;
+    float resonanceGain = 0.2f;
+    float inputDrive = 1.0f;
+    float stageDrive = 1.0f;
+    float feedbackHpHz = 200.0f;
+
+    // Coefficient holders only; the state lives in the lanes below
+    OnePoleTPT stageCoeffs;
+    OnePoleTPT feedbackCoeffs;
+    float stageGain = 0.0f;
+    float feedbackGain = 0.0f;
+
+    Lanes stageState[8] = {};
+    Lanes feedbackState = {};
+    Lanes lastFeedbackHP = {};
+
+    // fastmath::tanh, one lane per element
+    static inline Lanes saturate(Lanes x) {
+        const float limit = 7.90531111f;
+        x = (x < -limit) ? Lanes{} - limit : x;
+        x = (limit < x) ? Lanes{} + limit : x;
+        const Lanes x2 = x * x;
+        Lanes p = Lanes{} + -2.76076847742355e-16f;
+        p = p * x2 + 2.00018790482477e-13f;
+        p = p * x2 - 8.60467152213735e-11f;
+        p = p * x2 + 5.12229709037114e-08f;
+        p = p * x2 + 1.48572235717979e-05f;
+        p = p * x2 + 6.37261928875436e-04f;
+        p = p * x2 + 4.89352455891786e-03f;
+        p = p * x;
+        Lanes q = Lanes{} + 1.19825839466702e-06f;
+        q = q * x2 + 1.18534705686654e-04f;
+        q = q * x2 + 2.26843463243900e-03f;
+        q = q * x2 + 4.89352518554385e-03f;
+        return p / q;
     }
 };
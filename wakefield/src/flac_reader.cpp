@@ -0,0 +1,451 @@
+#include "flac_reader.h"
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+namespace {
+
+constexpr int kMaxChannels = 8;
+constexpr int kMaxLpcOrder = 32;
+
+struct CrcTables {
+    uint8_t crc8[256];      // Frame header: x^8 + x^2 + x + 1
+    uint16_t crc16[256];    // Whole frame: x^16 + x^15 + x^2 + 1
+
+    CrcTables() {
+        for (int i = 0; i < 256; ++i) {
+            uint8_t c8 = static_cast<uint8_t>(i);
+            uint16_t c16 = static_cast<uint16_t>(i << 8);
+            for (int bit = 0; bit < 8; ++bit) {
+                c8 = static_cast<uint8_t>((c8 & 0x80) ? (c8 << 1) ^ 0x07 : c8 << 1);
+                c16 = static_cast<uint16_t>((c16 & 0x8000) ? (c16 << 1) ^ 0x8005 : c16 << 1);
+            }
+            crc8[i] = c8;
+            crc16[i] = c16;
+        }
+    }
+};
+
+const CrcTables kCrc;
+
+uint8_t crc8(const uint8_t* p, size_t n) {
+    uint8_t crc = 0;
+    while (n--) {
+        crc = kCrc.crc8[crc ^ *p++];
+    }
+    return crc;
+}
+
+uint16_t crc16(const uint8_t* p, size_t n) {
+    uint16_t crc = 0;
+    while (n--) {
+        crc = static_cast<uint16_t>((crc << 8) ^ kCrc.crc16[(crc >> 8) ^ *p++]);
+    }
+    return crc;
+}
+
+// MSB-first reader over the mapped file. The unread bits sit at the top of
+// a 64-bit cache, refilled a byte at a time; reading past the end returns
+// zeros and sets overrun
+class BitReader {
+public:
+    BitReader(const uint8_t* data, size_t size) : data(data), size(size) {}
+
+    void seek(size_t byte) {
+        pos = byte;
+        cache = 0;
+        bits = 0;
+    }
+
+    // Only meaningful at a byte boundary
+    size_t bytePosition() const { return pos - static_cast<size_t>(bits / 8); }
+    bool overrun() const { return over; }
+
+    void alignToByte() { read(bits % 8); }
+
+    // n <= 32
+    uint32_t read(int n) {
+        if (n == 0) {
+            return 0;
+        }
+        if (bits < n) {
+            refill();
+            if (bits < n) {
+                over = true;
+                cache = 0;
+                bits = 0;
+                return 0;
+            }
+        }
+        const uint32_t value = static_cast<uint32_t>(cache >> (64 - n));
+        cache <<= n;
+        bits -= n;
+        return value;
+    }
+
+    int32_t readSigned(int n) {
+        if (n == 0) {
+            return 0;
+        }
+        return static_cast<int32_t>(read(n) << (32 - n)) >> (32 - n);
+    }
+
+    // Zeros before the next one bit (which is consumed)
+    uint32_t readUnary() {
+        uint32_t count = 0;
+        for (;;) {
+            if (bits == 0) {
+                refill();
+                if (bits == 0) {
+                    over = true;
+                    return count;
+                }
+            }
+            if (cache != 0) {
+                const int zeros = __builtin_clzll(cache);
+                if (zeros < bits) {
+                    count += static_cast<uint32_t>(zeros);
+                    cache = zeros == 63 ? 0 : cache << (zeros + 1);
+                    bits -= zeros + 1;
+                    return count;
+                }
+            }
+            count += static_cast<uint32_t>(bits);
+            cache = 0;
+            bits = 0;
+        }
+    }
+
+private:
+    void refill() {
+        while (bits <= 56 && pos < size) {
+            cache |= static_cast<uint64_t>(data[pos++]) << (56 - bits);
+            bits += 8;
+        }
+    }
+
+    const uint8_t* data;
+    size_t size;
+    size_t pos = 0;
+    uint64_t cache = 0;
+    int bits = 0;
+    bool over = false;
+};
+
+// Residuals of samples order .. blockSize - 1 into out
+bool readResidual(BitReader& in, int blockSize, int order, int32_t* out) {
+    const uint32_t method = in.read(2);
+    if (method > 1) {
+        return false;
+    }
+    const int parameterBits = method == 0 ? 4 : 5;
+    const uint32_t escape = method == 0 ? 15 : 31;
+    const int partitionOrder = static_cast<int>(in.read(4));
+    const int partitionSize = blockSize >> partitionOrder;
+    if ((partitionSize << partitionOrder) != blockSize || partitionSize < order) {
+        return false;
+    }
+
+    int i = order;
+    for (int partition = 0; partition < (1 << partitionOrder); ++partition) {
+        const int end = (partition + 1) * partitionSize;
+        const uint32_t parameter = in.read(parameterBits);
+        if (parameter == escape) {
+            const int width = static_cast<int>(in.read(5));
+            for (; i < end; ++i) {
+                out[i] = in.readSigned(width);
+            }
+        } else {
+            for (; i < end; ++i) {
+                const uint32_t high = in.readUnary();
+                const uint32_t folded = (high << parameter) | in.read(static_cast<int>(parameter));
+                out[i] = static_cast<int32_t>(folded >> 1) ^ -static_cast<int32_t>(folded & 1);
+            }
+        }
+        if (in.overrun()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool readSubframe(BitReader& in, int blockSize, int bitsPerSample, int32_t* out, std::string& error) {
+    const uint32_t padding = in.read(1);
+    const uint32_t type = in.read(6);
+    int wasted = 0;
+    if (in.read(1)) {
+        wasted = static_cast<int>(in.readUnary()) + 1;
+    }
+    const int bits = bitsPerSample - wasted;
+    if (padding != 0 || bits <= 0) {
+        error = "Corrupt FLAC subframe";
+        return false;
+    }
+    if (bits > 32) {
+        error = "Unsupported FLAC stereo (33-bit side channel)";
+        return false;
+    }
+
+    if (type == 0) {                            // Constant
+        std::fill(out, out + blockSize, in.readSigned(bits));
+    } else if (type == 1) {                     // Verbatim
+        for (int i = 0; i < blockSize; ++i) {
+            out[i] = in.readSigned(bits);
+        }
+    } else if (type >= 8 && type <= 12) {       // Fixed polynomial predictor
+        const int order = static_cast<int>(type) - 8;
+        if (order > blockSize) {
+            error = "Corrupt FLAC subframe";
+            return false;
+        }
+        for (int i = 0; i < order; ++i) {
+            out[i] = in.readSigned(bits);
+        }
+        if (!readResidual(in, blockSize, order, out)) {
+            error = "Corrupt FLAC residual";
+            return false;
+        }
+        for (int i = order; i < blockSize; ++i) {
+            int64_t prediction = 0;
+            switch (order) {
+                case 1: prediction = out[i - 1]; break;
+                case 2: prediction = 2 * int64_t(out[i - 1]) - out[i - 2]; break;
+                case 3: prediction = 3 * (int64_t(out[i - 1]) - out[i - 2]) + out[i - 3]; break;
+                case 4: prediction = 4 * (int64_t(out[i - 1]) + out[i - 3]) - 6 * int64_t(out[i - 2]) - out[i - 4]; break;
+            }
+            out[i] = static_cast<int32_t>(out[i] + prediction);
+        }
+    } else if (type >= 32) {                    // LPC
+        const int order = static_cast<int>(type) - 31;
+        if (order > blockSize) {
+            error = "Corrupt FLAC subframe";
+            return false;
+        }
+        for (int i = 0; i < order; ++i) {
+            out[i] = in.readSigned(bits);
+        }
+        const int precision = static_cast<int>(in.read(4)) + 1;
+        const int shift = in.readSigned(5);
+        if (precision == 16 || shift < 0) {
+            error = "Corrupt FLAC subframe";
+            return false;
+        }
+        int32_t coefficients[kMaxLpcOrder];
+        for (int j = 0; j < order; ++j) {
+            coefficients[j] = in.readSigned(precision);
+        }
+        if (!readResidual(in, blockSize, order, out)) {
+            error = "Corrupt FLAC residual";
+            return false;
+        }
+        for (int i = order; i < blockSize; ++i) {
+            int64_t sum = 0;
+            for (int j = 0; j < order; ++j) {
+                sum += int64_t(coefficients[j]) * out[i - 1 - j];
+            }
+            out[i] = static_cast<int32_t>(out[i] + (sum >> shift));
+        }
+    } else {
+        error = "Corrupt FLAC subframe (reserved type)";
+        return false;
+    }
+
+    if (wasted > 0) {
+        for (int i = 0; i < blockSize; ++i) {
+            out[i] = static_cast<int32_t>(static_cast<uint32_t>(out[i]) << wasted);
+        }
+    }
+    if (in.overrun()) {
+        error = "Truncated FLAC file";
+        return false;
+    }
+    return true;
+}
+
+// One frame into channels (stride info.maxBlockSize), decorrelated
+bool readFrame(BitReader& in, const uint8_t* data, const FLACInfo& info, int32_t* channels,
+               int& blockSize, int& bitsPerSample, std::string& error) {
+    const size_t start = in.bytePosition();
+    if (in.read(15) != 0x7FFC) {                // 14 sync bits and a reserved zero
+        error = in.overrun() ? "Truncated FLAC file" : "Lost FLAC frame sync";
+        return false;
+    }
+    in.read(1);                                 // Fixed or variable blocking
+    const uint32_t blockCode = in.read(4);
+    const uint32_t rateCode = in.read(4);
+    const uint32_t assignment = in.read(4);
+    const uint32_t sizeCode = in.read(3);
+    const uint32_t reserved = in.read(1);
+
+    // Frame or sample number, UTF-8 style: only its length matters here
+    const uint32_t lead = in.read(8);
+    const int extraBytes = (lead & 0x80) ? __builtin_clz(~(lead << 24)) - 1 : 0;
+    bool valid = reserved == 0 && lead != 0xFF && (lead & 0xC0) != 0x80 &&
+                 rateCode != 15 && sizeCode != 3 && assignment <= 10 && blockCode != 0;
+    for (int i = 0; i < extraBytes; ++i) {
+        valid = valid && (in.read(8) & 0xC0) == 0x80;
+    }
+
+    if (blockCode == 1) {
+        blockSize = 192;
+    } else if (blockCode <= 5) {
+        blockSize = 576 << (blockCode - 2);
+    } else if (blockCode == 6) {
+        blockSize = static_cast<int>(in.read(8)) + 1;
+    } else if (blockCode == 7) {
+        blockSize = static_cast<int>(in.read(16)) + 1;
+    } else {
+        blockSize = 256 << (blockCode - 8);
+    }
+    if (rateCode == 12) {
+        in.read(8);
+    } else if (rateCode == 13 || rateCode == 14) {
+        in.read(16);
+    }
+    static constexpr int kSampleSizes[8] = {0, 8, 12, 0, 16, 20, 24, 32};
+    bitsPerSample = sizeCode == 0 ? info.bitsPerSample : kSampleSizes[sizeCode];
+    const int channelCount = assignment < 8 ? static_cast<int>(assignment) + 1 : 2;
+
+    const size_t headerEnd = in.bytePosition();
+    const uint32_t headerCrc = in.read(8);
+    if (in.overrun()) {
+        error = "Truncated FLAC file";
+        return false;
+    }
+    if (!valid || crc8(data + start, headerEnd - start) != headerCrc) {
+        error = "Corrupt FLAC frame header";
+        return false;
+    }
+    if (channelCount != info.channels || blockSize > info.maxBlockSize) {
+        error = "FLAC frame does not match STREAMINFO";
+        return false;
+    }
+
+    for (int ch = 0; ch < channelCount; ++ch) {
+        // The side channel carries one more bit
+        const bool side = (assignment == 8 && ch == 1) || (assignment == 9 && ch == 0) ||
+                          (assignment == 10 && ch == 1);
+        if (!readSubframe(in, blockSize, bitsPerSample + (side ? 1 : 0),
+                          channels + static_cast<size_t>(ch) * info.maxBlockSize, error)) {
+            return false;
+        }
+    }
+
+    in.alignToByte();
+    const size_t frameEnd = in.bytePosition();
+    const uint32_t frameCrc = in.read(16);
+    if (in.overrun()) {
+        error = "Truncated FLAC file";
+        return false;
+    }
+    if (crc16(data + start, frameEnd - start) != frameCrc) {
+        error = "Corrupt FLAC frame (CRC mismatch)";
+        return false;
+    }
+
+    int32_t* left = channels;
+    int32_t* right = channels + info.maxBlockSize;
+    if (assignment == 8) {                      // Left, side
+        for (int i = 0; i < blockSize; ++i) {
+            right[i] = left[i] - right[i];
+        }
+    } else if (assignment == 9) {               // Side, right
+        for (int i = 0; i < blockSize; ++i) {
+            left[i] += right[i];
+        }
+    } else if (assignment == 10) {              // Mid, side
+        for (int i = 0; i < blockSize; ++i) {
+            const int32_t side = right[i];
+            const int32_t mid = static_cast<int32_t>(static_cast<uint32_t>(left[i]) << 1) | (side & 1);
+            left[i] = (mid + side) >> 1;
+            right[i] = (mid - side) >> 1;
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+bool readFLACStreamInfo(const uint8_t* data, size_t size, FLACInfo& info, std::string& error) {
+    // The block header says STREAMINFO (type 0) of at least its 34 bytes
+    if (size < kFLACStreamInfoBytes || std::memcmp(data, "fLaC", 4) != 0 || (data[4] & 0x7F) != 0 ||
+        ((data[5] << 16) | (data[6] << 8) | data[7]) < 34) {
+        error = "Not a valid FLAC file";
+        return false;
+    }
+    const uint8_t* p = data + 8;
+    info.maxBlockSize = static_cast<uint16_t>((p[2] << 8) | p[3]);
+    info.sampleRate = (static_cast<uint32_t>(p[10]) << 12) | (p[11] << 4) | (p[12] >> 4);
+    info.channels = static_cast<uint16_t>(((p[12] >> 1) & 7) + 1);
+    info.bitsPerSample = static_cast<uint16_t>((((p[12] & 1) << 4) | (p[13] >> 4)) + 1);
+    info.totalFrames = (static_cast<uint64_t>(p[13] & 0x0F) << 32) | (static_cast<uint32_t>(p[14]) << 24) |
+                       (p[15] << 16) | (p[16] << 8) | p[17];
+    info.framesOffset = 0;
+    if (info.maxBlockSize < 16 || info.sampleRate == 0 || info.bitsPerSample < 4) {
+        error = "Not a valid FLAC file";
+        return false;
+    }
+    return true;
+}
+
+bool readFLACHeader(const uint8_t* data, size_t size, FLACInfo& info, std::string& error) {
+    if (!readFLACStreamInfo(data, size, info, error)) {
+        return false;
+    }
+    size_t pos = 4;
+    for (;;) {
+        if (pos + 4 > size) {
+            error = "Truncated FLAC metadata";
+            return false;
+        }
+        const bool last = (data[pos] & 0x80) != 0;
+        pos += 4 + ((static_cast<size_t>(data[pos + 1]) << 16) | (data[pos + 2] << 8) | data[pos + 3]);
+        if (last) {
+            break;
+        }
+    }
+    if (pos >= size) {
+        error = "FLAC file has no audio frames";
+        return false;
+    }
+    info.framesOffset = pos;
+    return true;
+}
+
+bool decodeFLACToQ15Mono(const uint8_t* data, size_t size, const FLACInfo& info,
+                         int16_t* dst, uint32_t frames, std::string& error) {
+    if (info.channels > kMaxChannels || info.framesOffset == 0 || info.framesOffset >= size) {
+        error = "Not a valid FLAC file";
+        return false;
+    }
+    std::vector<int32_t> channels(static_cast<size_t>(info.channels) * info.maxBlockSize);
+    BitReader in(data, size);
+    in.seek(info.framesOffset);
+
+    uint32_t written = 0;
+    while (written < frames) {
+        int blockSize = 0;
+        int bitsPerSample = 0;
+        if (!readFrame(in, data, info, channels.data(), blockSize, bitsPerSample, error)) {
+            return false;
+        }
+
+        // To 16 bits per channel, then the channel average, as for PCM
+        const uint32_t n = std::min(static_cast<uint32_t>(blockSize), frames - written);
+        const int down = bitsPerSample > 16 ? bitsPerSample - 16 : 0;
+        const int up = bitsPerSample < 16 ? 16 - bitsPerSample : 0;
+        for (uint32_t i = 0; i < n; ++i) {
+            int32_t accum = 0;
+            for (int ch = 0; ch < info.channels; ++ch) {
+                const int32_t value = channels[static_cast<size_t>(ch) * info.maxBlockSize + i];
+                accum += (value >> down) * (1 << up);
+            }
+            if (info.channels > 1) {
+                accum /= info.channels;
+            }
+            dst[written + i] = static_cast<int16_t>(std::clamp(accum, -32768, 32767));
+        }
+        written += n;
+    }
+    return true;
+}
@@ -0,0 +1,41 @@
+#ifndef FLAC_READER_H
+#define FLAC_READER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+// FLAC parsing and decoding for SampleBank, which maps the file and decodes
+// it straight to Q15 mono. Handles what the reference encoder writes:
+// constant, verbatim, fixed and LPC subframes, Rice residuals (4- and
+// 5-bit parameters, escaped partitions), wasted bits, the three stereo
+// decorrelation modes and 1 to 8 channels of 4 to 32 bits (side channels
+// of 32-bit audio would need 33 bits and are rejected). Header and frame
+// CRCs are checked; the STREAMINFO MD5 is not.
+struct FLACInfo {
+    uint32_t sampleRate = 0;
+    uint16_t channels = 0;
+    uint16_t bitsPerSample = 0;
+    uint64_t totalFrames = 0;       // 0 if the encoder didn't know
+    uint16_t maxBlockSize = 0;
+    size_t framesOffset = 0;        // First audio frame, after the metadata blocks
+};
+
+// "fLaC", the STREAMINFO block header and STREAMINFO itself, which the
+// format requires to come first
+constexpr size_t kFLACStreamInfoBytes = 42;
+
+// Parse STREAMINFO from the first kFLACStreamInfoBytes of a file
+// (framesOffset is left 0)
+bool readFLACStreamInfo(const uint8_t* data, size_t size, FLACInfo& info, std::string& error);
+
+// Parse STREAMINFO and walk the metadata blocks to the first frame
+bool readFLACHeader(const uint8_t* data, size_t size, FLACInfo& info, std::string& error);
+
+// Decode the first frames frames of the file to Q15 mono, converting and
+// averaging the channels as SampleBank::convertToQ15Mono does for PCM of
+// the same bit depth
+bool decodeFLACToQ15Mono(const uint8_t* data, size_t size, const FLACInfo& info,
+                         int16_t* dst, uint32_t frames, std::string& error);
+
+#endif // FLAC_READER_H
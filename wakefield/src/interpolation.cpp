@@ -0,0 +1,73 @@
+#include "interpolation.h"
+#include <cmath>
+
+namespace interp {
+
+namespace {
+
+constexpr double kSincCutoff = 0.45;    // Of the source rate, at up to 1x
+constexpr double kSincKaiserBeta = 6.0;
+
+double besselI0(double x) {
+    double sum = 1.0;
+    double term = 1.0;
+    for (int k = 1; k < 32; ++k) {
+        term *= (x / (2.0 * k)) * (x / (2.0 * k));
+        sum += term;
+    }
+    return sum;
+}
+
+} // namespace
+
+Tables::Tables() {
+    for (int row = 0; row <= kPhases; ++row) {
+        const float t = static_cast<float>(row) / kPhases;
+        const float t2 = t * t;
+        const float t3 = t2 * t;
+        hermite[row] = Lanes{-0.5f * t3 + t2 - 0.5f * t,
+                             1.5f * t3 - 2.5f * t2 + 1.0f,
+                             -1.5f * t3 + 2.0f * t2 + 0.5f * t,
+                             0.5f * t3 - 0.5f * t2};
+
+        for (int band = 0; band < kSincBands; ++band) {
+            const double cutoff = kSincCutoff / static_cast<double>(1 << band);
+            double w[2 * kSincHalfTaps];
+            double sum = 0.0;
+            for (int k = 0; k < 2 * kSincHalfTaps; ++k) {
+                const double x = (k - (kSincHalfTaps - 1)) - static_cast<double>(t);
+                const double r = x / kSincHalfTaps;
+                const double window = r * r < 1.0 ? besselI0(kSincKaiserBeta * std::sqrt(1.0 - r * r)) /
+                                                    besselI0(kSincKaiserBeta)
+                                                  : 0.0;
+                const double arg = 2.0 * cutoff * x;
+                const double sinc = arg == 0.0 ? 1.0 : std::sin(M_PI * arg) / (M_PI * arg);
+                w[k] = sinc * window;
+                sum += w[k];
+            }
+            for (int k = 0; k < 2 * kSincHalfTaps; ++k) {   // Unity gain at DC
+                sinc[band][row][k / 4][k % 4] = static_cast<float>(w[k] / sum);
+            }
+        }
+    }
+}
+
+const Tables kTables;
+
+void interpolateBlock(const float* src, uint64_t phase, int64_t inc, float* out, uint32_t n, bool sinc) {
+    if (sinc) {
+        const int band = sincBand(inc);
+        for (uint32_t k = 0; k < n; ++k) {
+            const float* taps = src + (phase >> 32) - (kSincHalfTaps - 1);
+            out[k] = sincAt(loadLanes(taps), loadLanes(taps + 4), static_cast<uint32_t>(phase), band);
+            phase += static_cast<uint64_t>(inc);
+        }
+        return;
+    }
+    for (uint32_t k = 0; k < n; ++k) {
+        out[k] = hermiteAt(loadLanes(src + (phase >> 32) - 1), static_cast<uint32_t>(phase));
+        phase += static_cast<uint64_t>(inc);
+    }
+}
+
+} // namespace interp
@@ -0,0 +1,80 @@
+#ifndef INTERPOLATION_H
+#define INTERPOLATION_H
+
+#include <cstdint>
+
+// Hermite / windowed-sinc interpolation kernels, shared by Sampler (16-bit
+// sample data) and Looper (float loop audio).
+//
+// Weights come from polyphase tables of kPhases rows (plus the row for a
+// whole sample, to blend against), blended linearly on the next 16 bits of
+// the Q32.32 phase fraction. Four taps make one vector, so Hermite is one
+// multiply and the 8-tap sinc two. The sinc has one table per octave of
+// playback speed, its cutoff lowered with the speed so pitched-up playback
+// doesn't alias.
+namespace interp {
+
+typedef float Lanes __attribute__((vector_size(4 * sizeof(float))));
+
+constexpr int kPhaseBits = 7;
+constexpr int kPhases = 1 << kPhaseBits;
+constexpr int kSincHalfTaps = 4;        // Taps index - 3 .. index + 4
+constexpr int kSincBands = 4;           // Speed up to 1x, 2x, 4x, above
+
+struct Tables {
+    Lanes hermite[kPhases + 1];                 // Taps index - 1 .. index + 2
+    Lanes sinc[kSincBands][kPhases + 1][2];
+
+    Tables();
+};
+
+extern const Tables kTables;
+
+inline float sumLanes(Lanes v) {
+    return (v[0] + v[1]) + (v[2] + v[3]);
+}
+
+inline Lanes loadLanes(const int16_t* p) {
+    return Lanes{static_cast<float>(p[0]), static_cast<float>(p[1]),
+                 static_cast<float>(p[2]), static_cast<float>(p[3])};
+}
+
+inline Lanes loadLanes(const float* p) {
+    return Lanes{p[0], p[1], p[2], p[3]};
+}
+
+// Sinc table for a phase increment (Q32.32, either direction)
+inline int sincBand(int64_t inc) {
+    const uint64_t step = static_cast<uint64_t>(inc >= 0 ? inc : -inc);
+    if (step <= (1ull << 32)) {
+        return 0;
+    }
+    const int band = 64 - __builtin_clzll(step - 1) - 32;
+    return band < kSincBands ? band : kSincBands - 1;
+}
+
+// taps: index - 1 .. index + 2
+inline float hermiteAt(Lanes taps, uint32_t frac) {
+    const Lanes* w = kTables.hermite + (frac >> (32 - kPhaseBits));
+    const float blend = static_cast<float>((frac << kPhaseBits) >> 16) * (1.0f / 65536.0f);
+    return sumLanes(taps * (w[0] + (w[1] - w[0]) * blend));
+}
+
+// lo, hi: index - 3 .. index + 4
+inline float sincAt(Lanes lo, Lanes hi, uint32_t frac, int band) {
+    const Lanes (*w)[2] = kTables.sinc[band] + (frac >> (32 - kPhaseBits));
+    const float blend = static_cast<float>((frac << kPhaseBits) >> 16) * (1.0f / 65536.0f);
+    const Lanes wLo = w[0][0] + (w[1][0] - w[0][0]) * blend;
+    const Lanes wHi = w[0][1] + (w[1][1] - w[0][1]) * blend;
+    return sumLanes(lo * wLo + hi * wHi);
+}
+
+// out[k] = src read at phase + k * inc (Q32.32 frames into src, inc of
+// either sign), by Hermite or by the sinc band of inc. src must hold the
+// kernel's taps around every position read: kSincHalfTaps - 1 frames
+// before and kSincHalfTaps after (Hermite needs 1 and 2)
+void interpolateBlock(const float* src, uint64_t phase, int64_t inc, float* out, uint32_t n, bool sinc);
+
+} // namespace interp
+
+#endif // INTERPOLATION_H
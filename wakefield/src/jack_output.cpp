@@ -0,0 +1,117 @@
+#include "jack_output.h"
+
+JackOutput::~JackOutput() {
+    close();
+}
+
+bool JackOutput::open(const std::string& clientName, std::string& error) {
+    close();
+    jack_status_t status;
+    client = jack_client_open(clientName.c_str(), JackNoStartServer, &status);
+    if (!client) {
+        error = (status & JackServerFailed) ? "no JACK server running" : "cannot connect to the JACK server";
+        return false;
+    }
+
+    static const char* const kPortNames[2] = {"out_L", "out_R"};
+    for (int i = 0; i < 2; ++i) {
+        ports[i] = jack_port_register(client, kPortNames[i], JACK_DEFAULT_AUDIO_TYPE, JackPortIsOutput, 0);
+        if (!ports[i]) {
+            error = std::string("cannot register port ") + kPortNames[i];
+            close();
+            return false;
+        }
+    }
+
+    sampleRate.store(jack_get_sample_rate(client), std::memory_order_relaxed);
+    bufferFrames.store(jack_get_buffer_size(client), std::memory_order_relaxed);
+    jack_set_process_callback(client, &JackOutput::process, this);
+    jack_set_buffer_size_callback(client, &JackOutput::bufferSizeChanged, this);
+    jack_set_sample_rate_callback(client, &JackOutput::sampleRateChanged, this);
+    jack_set_xrun_callback(client, &JackOutput::xrunReported, this);
+    jack_on_shutdown(client, &JackOutput::shutdown, this);
+    return true;
+}
+
+bool JackOutput::start(RenderFunction renderFunction, bool autoconnect, std::string& error) {
+    if (!client) {
+        error = "not connected";
+        return false;
+    }
+    render = renderFunction;
+    if (jack_activate(client) != 0) {
+        error = "cannot activate the client";
+        return false;
+    }
+    active = true;
+
+    if (autoconnect) {
+        // The first two physical playback ports; a mono system gets out_L only
+        const char** playback = jack_get_ports(client, nullptr, JACK_DEFAULT_AUDIO_TYPE,
+                                               JackPortIsPhysical | JackPortIsInput);
+        if (playback) {
+            for (int i = 0; i < 2 && playback[i]; ++i) {
+                jack_connect(client, jack_port_name(ports[i]), playback[i]);
+            }
+            jack_free(playback);
+        }
+    }
+    return true;
+}
+
+void JackOutput::close() {
+    if (!client) {
+        return;
+    }
+    if (active && !serverGone.load()) {
+        jack_deactivate(client);
+    }
+    jack_client_close(client);
+    client = nullptr;
+    ports[0] = ports[1] = nullptr;
+    active = false;
+}
+
+std::string JackOutput::getClientName() const {
+    return client ? jack_get_client_name(client) : "";
+}
+
+bool JackOutput::isRealtime() const {
+    return client && jack_is_realtime(client);
+}
+
+int JackOutput::getRealtimePriority() const {
+    return isRealtime() ? jack_client_real_time_priority(client) : -1;
+}
+
+int JackOutput::process(jack_nframes_t nFrames, void* arg) {
+    JackOutput& self = *static_cast<JackOutput*>(arg);
+    float* left = static_cast<float*>(jack_port_get_buffer(self.ports[0], nFrames));
+    float* right = static_cast<float*>(jack_port_get_buffer(self.ports[1], nFrames));
+
+    const uint32_t reported = self.xruns.load(std::memory_order_relaxed);
+    const bool xrun = reported != self.xrunsSeen;
+    self.xrunsSeen = reported;
+
+    self.render(left, right, nFrames, xrun);
+    return 0;
+}
+
+int JackOutput::bufferSizeChanged(jack_nframes_t nFrames, void* arg) {
+    static_cast<JackOutput*>(arg)->bufferFrames.store(nFrames, std::memory_order_relaxed);
+    return 0;
+}
+
+int JackOutput::sampleRateChanged(jack_nframes_t rate, void* arg) {
+    static_cast<JackOutput*>(arg)->sampleRate.store(rate, std::memory_order_relaxed);
+    return 0;
+}
+
+int JackOutput::xrunReported(void* arg) {
+    static_cast<JackOutput*>(arg)->xruns.fetch_add(1, std::memory_order_relaxed);
+    return 0;
+}
+
+void JackOutput::shutdown(void* arg) {
+    static_cast<JackOutput*>(arg)->serverGone.store(true, std::memory_order_relaxed);
+}
@@ -0,0 +1,70 @@
+#ifndef JACK_OUTPUT_H
+#define JACK_OUTPUT_H
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <jack/jack.h>
+
+// Native JACK client (--jack, built with -DWAKEFIELD_JACK=ON). Registers
+// two output ports and renders straight into their buffers: JACK ports
+// are planar floats, so the synth and looper write the device buffer
+// with no interleave step and no copy. The engine runs at the server's
+// rate and follows its buffer size, and the process thread runs at the
+// server's realtime priority; our own --realtime settings do not apply.
+//
+// The server can change its buffer size at any time and the render path
+// takes any block size. A sample rate change is reported, not followed:
+// tuning and envelope times stay at the rate the engine was built for.
+class JackOutput {
+public:
+    // Called on JACK's process thread for each period. xrun is set when
+    // the server reported one since the previous call
+    using RenderFunction = void (*)(float* left, float* right, unsigned int nFrames, bool xrun);
+
+    JackOutput() = default;
+    ~JackOutput();
+
+    // Connect to the server as clientName and register out_L and out_R.
+    // Nothing is rendered until start()
+    bool open(const std::string& clientName, std::string& error);
+
+    // Activate, then connect the ports to the first two physical playback
+    // ports when autoconnect is set
+    bool start(RenderFunction render, bool autoconnect, std::string& error);
+
+    // Deactivate and leave the server
+    void close();
+
+    std::string getClientName() const;
+    uint32_t getSampleRate() const { return sampleRate.load(std::memory_order_relaxed); }
+    uint32_t getBufferFrames() const { return bufferFrames.load(std::memory_order_relaxed); }
+    bool isRealtime() const;
+    int getRealtimePriority() const;        // -1 when not realtime
+    uint32_t getXruns() const { return xruns.load(std::memory_order_relaxed); }
+    // The server shut down or dropped the client; no more periods come
+    bool isServerGone() const { return serverGone.load(std::memory_order_relaxed); }
+
+    JackOutput(const JackOutput&) = delete;
+    JackOutput& operator=(const JackOutput&) = delete;
+
+private:
+    static int process(jack_nframes_t nFrames, void* arg);
+    static int bufferSizeChanged(jack_nframes_t nFrames, void* arg);
+    static int sampleRateChanged(jack_nframes_t rate, void* arg);
+    static int xrunReported(void* arg);
+    static void shutdown(void* arg);
+
+    jack_client_t* client = nullptr;
+    jack_port_t* ports[2] = {nullptr, nullptr};
+    RenderFunction render = nullptr;
+    bool active = false;
+
+    std::atomic<uint32_t> sampleRate{0};
+    std::atomic<uint32_t> bufferFrames{0};
+    std::atomic<uint32_t> xruns{0};
+    uint32_t xrunsSeen = 0;                 // Process thread only
+    std::atomic<bool> serverGone{false};
+};
+
+#endif // JACK_OUTPUT_H
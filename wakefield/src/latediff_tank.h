@@ -0,0 +1,614 @@
+#ifndef LATEDIFF_TANK_H
+#define LATEDIFF_TANK_H
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+#include <vector>
+#include "../../shared/dsp/allpass.h"
+
+// Late-diffusion tank ported from crossbow (latediff_tank.hpp, checked there
+// by the crossbow harness). Three frequency-dependent allpass diffusers in
+// series, a shelved output and a delayed feedback path whose gain follows
+// RT60. The port keeps the crossbow signal path, and both trees run their
+// diffusers through the same allpass step (shared/dsp/allpass.h). What
+// changed is that the shelf coefficients, delay targets and loop gain are
+// worked out once per block in setControls() rather than on every sample,
+// from a compile-time table instead of exp/pow.
+namespace latediff {
+
+// ----- Control mappings ------------------------------------------------------
+//
+// Every exponential in the control path (delay times from the size index,
+// loop gain from RT60, shelf gains, the decay knob's RT60) is a power of
+// two of something linear in the knob, so they all read one table of 2^x
+// over [0, 1] generated at compile time: the fraction of x is interpolated
+// and the integer part goes straight into the float exponent. Relative
+// error is a few parts per million, so sweeping size or decay costs
+// lookups rather than exp/pow calls.
+
+namespace detail {
+
+constexpr int kExp2Bits = 8;
+constexpr int kExp2Size = 1 << kExp2Bits;
+
+// e^(x ln 2) by its Taylor series, converged well past float precision on
+// [0, 1]; only evaluated at compile time
+constexpr double exp2Series(double x) {
+    const double y = x * 0.6931471805599453;
+    double term = 1.0;
+    double sum = 1.0;
+    for (int k = 1; k < 24; ++k) {
+        term *= y / k;
+        sum += term;
+    }
+    return sum;
+}
+
+struct Exp2Table {
+    float v[kExp2Size + 1] = {};
+
+    constexpr Exp2Table() {
+        for (int i = 0; i <= kExp2Size; ++i) {
+            v[i] = static_cast<float>(exp2Series(static_cast<double>(i) / kExp2Size));
+        }
+    }
+};
+
+inline constexpr Exp2Table kExp2Table{};
+
+} // namespace detail
+
+// 2^x for x in [-126, 127] (clamped), from the table
+inline float exp2Table(float x) {
+    x = std::clamp(x, -126.0f, 127.0f);
+    const float whole = std::floor(x);
+    const float pos = (x - whole) * static_cast<float>(detail::kExp2Size);
+    const int i = std::min(static_cast<int>(pos), detail::kExp2Size - 1);
+    const float* v = detail::kExp2Table.v + i;
+    const float mantissa = v[0] + (v[1] - v[0]) * (pos - static_cast<float>(i));
+    const uint32_t bits = static_cast<uint32_t>(static_cast<int>(whole) + 127) << 23;
+    float scale;
+    std::memcpy(&scale, &bits, sizeof(scale));
+    return mantissa * scale;
+}
+
+// Size knob [0, 1] -> semitone index [+48 ... -24] (bigger room, lower index)
+inline float sizeToSemitones(float size01) {
+    return 48.0f - 72.0f * std::clamp(size01, 0.0f, 1.0f);
+}
+
+// Semitone index -> delay time: the period of 8.71742 Hz * 2^(p / 12)
+inline float semitonesToSeconds(float semitones) {
+    return 0.114712839349257f * exp2Table(semitones * (-1.0f / 12.0f));
+}
+
+// Loop gain that decays 60 dB in rt60 seconds for one pass of delaySeconds
+// (dB to linear is 2^(dB * log2(10) / 20))
+inline float rt60ToGain(float delaySeconds, float rt60) {
+    float dB = std::max(-60.0f * delaySeconds / std::max(rt60, 1e-12f), -144.0f);
+    return exp2Table(0.1660964047443681f * dB);
+}
+
+// ----- Shelves ---------------------------------------------------------------
+
+struct ShelfCoeffs {
+    float a1 = 0.0f;
+    float b0 = 1.0f;
+    float b1 = 0.0f;
+};
+
+namespace detail {
+
+inline float clipFrequency(float hz, float sampleRate) {
+    return std::clamp(hz, sampleRate / 24576.0f, sampleRate / 2.125f);
+}
+
+inline float warp(float hz, float sampleRate) {
+    float x = hz * 3.14159f / sampleRate;
+    float x2 = x * x;
+    return x * (1.0f + x2 * (0.333333f + x2 * 0.133333f));
+}
+
+// Corner shifted by the gain so the shelf midpoint stays at hz, and the
+// linear gain (r^2 with r = 1.0593^dB)
+inline std::pair<float, float> shelfWarp(float hz, float dB, bool high) {
+    float r = exp2Table(0.08304815803888799f * dB);    // 1.059253692626953^dB
+    return {high ? hz * r : hz / r, r * r};
+}
+
+} // namespace detail
+
+// Bilinear one-pole high shelf (gain dB above hz)
+inline ShelfCoeffs highShelf(float hz, float dB, float sampleRate) {
+    auto [corner, gain] = detail::shelfWarp(hz, dB, true);
+    float w = detail::warp(detail::clipFrequency(corner, sampleRate), sampleRate);
+    float m = w + 1.0f;
+    float a1 = (1.0f - w) / m;
+    float g = (gain - 1.0f) / m;
+    return {a1, g + 1.0f, -(g + a1)};
+}
+
+// Bilinear one-pole low shelf (gain dB below hz)
+inline ShelfCoeffs lowShelf(float hz, float dB, float sampleRate) {
+    auto [corner, gain] = detail::shelfWarp(hz, dB, false);
+    float w = detail::warp(detail::clipFrequency(corner, sampleRate), sampleRate);
+    float a1 = (1.0f - w) / (w + 1.0f);
+    float g = (gain - 1.0f) * w / (w + 1.0f);
+    return {a1, g + 1.0f, g - a1};
+}
+
+// One-pole shelf state; the coefficients are owned by the tank and shared
+// by every shelf of the same kind
+struct OnePoleShelf {
+    float x1 = 0.0f;
+    float y1 = 0.0f;
+
+    void reset() { x1 = 0.0f; y1 = 0.0f; }
+
+    inline float process(float x, const ShelfCoeffs& c) {
+        float y = c.b0 * x + c.b1 * x1 + c.a1 * y1;
+        x1 = x;
+        y1 = y;
+        return y;
+    }
+};
+
+// ----- Building blocks ---------------------------------------------------------
+
+// Eight parabolic "cosine-like" waves in [-depth, +depth], 1/8 cycle apart.
+// The waves only steer slow delay-time modulation, so they are evaluated
+// every kControlInterval samples and linearly interpolated in between,
+// straight into the caller's planes (one per phase). The output runs one
+// interval (0.33 ms at 48 kHz) behind the evaluated phase
+class LFO8Parabolic {
+public:
+    static constexpr int kPhases = 8;
+    static constexpr int kControlInterval = 16;
+
+    void setSampleRate(float sr) { sampleRate = std::max(1.0f, sr); }
+
+    // Restarts at phase p0 with the outputs already at that point
+    void reset(float p0 = 0.0f) {
+        phase = p0 - std::floor(p0);
+        evaluate(current);
+        for (float& s : step) s = 0.0f;
+        countdown = 0;
+    }
+
+    // Takes effect at the next evaluation, so depth changes ramp too
+    void setDepth(float d) { depth = d; }
+
+    // Writes n samples of phase k to out[k][0 .. n-1]
+    void process(float hz, float* const out[kPhases], int n) {
+        int i = 0;
+        while (i < n) {
+            if (countdown == 0) {
+                phase += hz * static_cast<float>(kControlInterval) / sampleRate;
+                phase -= std::floor(phase);
+                float target[kPhases];
+                evaluate(target);
+                for (int k = 0; k < kPhases; ++k) {
+                    step[k] = (target[k] - current[k]) * (1.0f / static_cast<float>(kControlInterval));
+                }
+                countdown = kControlInterval;
+            }
+            const int run = std::min(countdown, n - i);
+            for (int k = 0; k < kPhases; ++k) {
+                float* dst = out[k] + i;
+                const float v = current[k];
+                const float dv = step[k];
+                for (int j = 0; j < run; ++j) {
+                    dst[j] = v + dv * static_cast<float>(j);
+                }
+                current[k] = v + dv * static_cast<float>(run);
+            }
+            countdown -= run;
+            i += run;
+        }
+    }
+
+private:
+    float sampleRate = 48000.0f;
+    float phase = 0.0f;
+    float depth = 1.0f;
+    float current[kPhases] = {};    // Output at the next sample
+    float step[kPhases] = {};       // Per-sample increment to the next evaluation
+    int countdown = 0;              // Samples left before the next evaluation
+
+    void evaluate(float* y) const {
+        for (int k = 0; k < kPhases; ++k) {
+            float p = phase + 0.125f * static_cast<float>(k);
+            float f = p - std::floor(p);
+            float t = f <= 0.5f ? f : 1.0f - f;           // [0, 0.5]
+            float u = t * (8.0f - 16.0f * t);              // [0, 1]
+            y[k] = depth * (2.0f * u - 1.0f);
+        }
+    }
+};
+
+
+// Largest delay modulation the tank is sized for (seconds either way)
+constexpr float kMaxModulationSeconds = 0.002f;
+
+// One contiguous, 64-byte aligned block that a reverb instance carves its
+// delay lines from, so the lines sit next to each other in memory
+class DelayArena {
+public:
+    void allocate(size_t floats) {
+        storage.assign(floats + kAlignFloats, 0.0f);
+        const size_t misalign = (reinterpret_cast<uintptr_t>(storage.data()) / sizeof(float)) % kAlignFloats;
+        base = storage.data() + (misalign ? kAlignFloats - misalign : 0);
+        capacity = floats;
+        used = 0;
+    }
+
+    // Carve from memory owned elsewhere (64-byte aligned, zeroed)
+    void attach(float* memory, size_t floats) {
+        storage.clear();
+        base = memory;
+        capacity = floats;
+        used = 0;
+    }
+
+    // Takes in multiples of 16 floats keep every line 64-byte aligned
+    float* take(int floats) {
+        float* p = base + used;
+        used += static_cast<size_t>(floats);
+        return used <= capacity ? p : nullptr;
+    }
+
+    // Hands the same memory out again from the start (re-carving the
+    // lines for a lower rate)
+    void rewind() { used = 0; }
+
+    size_t bytes() const { return capacity * sizeof(float); }
+
+private:
+    static constexpr size_t kAlignFloats = 64 / sizeof(float);
+    std::vector<float> storage;
+    float* base = nullptr;
+    size_t capacity = 0;
+    size_t used = 0;
+};
+
+// ----- Four-lane stages ----------------------------------------------------------
+
+// The tank advances four delay stages per vector op (GCC vector extensions,
+// as in Ladder8PoleZdfX4 and HalfbandIIR)
+typedef float Lanes __attribute__((vector_size(4 * sizeof(float))));
+typedef int32_t LaneInts __attribute__((vector_size(4 * sizeof(int32_t))));
+
+inline Lanes broadcast(float v) { return Lanes{v, v, v, v}; }
+
+// Four delay lines of one power-of-two length with a shared write index,
+// so every read index wraps with a mask. Each line carries kGuard samples
+// past its end that repeat its start, so the four taps of a cubic read are
+// always contiguous: one unaligned load per lane, then a 4x4 transpose
+// turns them into tap vectors
+class DelayHX4 {
+public:
+    static constexpr int kLanes = 4;
+    static constexpr int kGuard = 16;   // >= 3 taps; 16 keeps lines 64-byte aligned
+
+    // Smallest power of two that holds maxSeconds plus the cubic's taps
+    static int sizeFor(float maxSeconds, float sr) {
+        const int needed = static_cast<int>(std::ceil(maxSeconds * sr)) + 4;
+        int size = 4;
+        while (size < needed) size <<= 1;
+        return size;
+    }
+
+    // Arena floats for four lines of this size
+    static int floatsFor(int size) { return kLanes * (size + kGuard); }
+
+    // memory holds floatsFor(size) floats
+    void attach(float* memory, int size) {
+        buffer = memory;
+        mask = size - 1;
+        stride = size + kGuard;
+        maxDelay = static_cast<float>(size - 3);
+        clear();
+    }
+
+    void clear() {
+        std::fill(buffer, buffer + kLanes * stride, 0.0f);
+        writeIndex = 0;
+    }
+
+    // Cubic (Hermite) read of each lane delaySamples behind the next write,
+    // clamped to [2, size - 3] so the taps never reach the slot about to be
+    // written
+    inline Lanes read(Lanes delaySamples) const {
+        Lanes d = delaySamples < broadcast(2.0f) ? broadcast(2.0f) : delaySamples;
+        d = d > broadcast(maxDelay) ? broadcast(maxDelay) : d;
+        const Lanes r = static_cast<float>(writeIndex + mask + 1) - d;     // Always positive
+        const LaneInts i0 = __builtin_convertvector(r, LaneInts);
+        const Lanes t = r - __builtin_convertvector(i0, Lanes);
+
+        // Row j = taps i0 - 1 .. i0 + 2 of lane j
+        Lanes rows[kLanes];
+        for (int j = 0; j < kLanes; ++j) {
+            std::memcpy(&rows[j], buffer + j * stride + ((i0[j] - 1) & mask), sizeof(Lanes));
+        }
+        typedef int32_t Shuffle __attribute__((vector_size(4 * sizeof(int32_t))));
+        const Lanes lo01 = __builtin_shuffle(rows[0], rows[1], Shuffle{0, 4, 1, 5});
+        const Lanes lo23 = __builtin_shuffle(rows[2], rows[3], Shuffle{0, 4, 1, 5});
+        const Lanes hi01 = __builtin_shuffle(rows[0], rows[1], Shuffle{2, 6, 3, 7});
+        const Lanes hi23 = __builtin_shuffle(rows[2], rows[3], Shuffle{2, 6, 3, 7});
+        const Lanes xm1 = __builtin_shuffle(lo01, lo23, Shuffle{0, 1, 4, 5});
+        const Lanes x0 = __builtin_shuffle(lo01, lo23, Shuffle{2, 3, 6, 7});
+        const Lanes x1 = __builtin_shuffle(hi01, hi23, Shuffle{0, 1, 4, 5});
+        const Lanes x2 = __builtin_shuffle(hi01, hi23, Shuffle{2, 3, 6, 7});
+
+        const Lanes a0 = -0.5f * xm1 + 1.5f * x0 - 1.5f * x1 + 0.5f * x2;
+        const Lanes a1 = xm1 - 2.5f * x0 + 2.0f * x1 - 0.5f * x2;
+        const Lanes a2 = -0.5f * xm1 + 0.5f * x1;
+        return ((a0 * t + a1) * t + a2) * t + x0;
+    }
+
+    inline void write(Lanes in) {
+        for (int j = 0; j < kLanes; ++j) {
+            buffer[j * stride + writeIndex] = in[j];
+        }
+        if (writeIndex < 3) {
+            for (int j = 0; j < kLanes; ++j) {
+                buffer[j * stride + mask + 1 + writeIndex] = in[j];
+            }
+        }
+        writeIndex = (writeIndex + 1) & mask;
+    }
+
+private:
+    float* buffer = nullptr;
+    int mask = 0;
+    int stride = 0;                     // Floats from one line to the next
+    float maxDelay = 2.0f;
+    int writeIndex = 0;
+};
+
+// Shelf coefficients per lane
+struct ShelfLanes {
+    Lanes a1 = {};
+    Lanes b0 = broadcast(1.0f);
+    Lanes b1 = {};
+
+    // Lanes where use[j] is false pass through unchanged
+    void set(const ShelfCoeffs& c, const bool use[4]) {
+        for (int j = 0; j < 4; ++j) {
+            a1[j] = use[j] ? c.a1 : 0.0f;
+            b0[j] = use[j] ? c.b0 : 1.0f;
+            b1[j] = use[j] ? c.b1 : 0.0f;
+        }
+    }
+};
+
+// Four frequency-dependent allpasses side by side: delay -> high shelf ->
+// low shelf, fed back at +g and forward at -g per lane (kernels::allpassStep,
+// as crossbow's Diffuser). A lane with g = 0 and pass-through shelves is a
+// plain delay
+class DiffuserX4 {
+public:
+    void attach(float* memory, int size) { delay.attach(memory, size); clear(); }
+
+    void clear() {
+        delay.clear();
+        hsX1 = hsY1 = lsX1 = lsY1 = Lanes{};
+    }
+
+    inline Lanes process(Lanes in, Lanes delaySamples, Lanes g,
+                         const ShelfLanes& hs, const ShelfLanes& ls) {
+        const Lanes d = delay.read(delaySamples);
+        const Lanes h = hs.b0 * d + hs.b1 * hsX1 + hs.a1 * hsY1;
+        hsX1 = d;
+        hsY1 = h;
+        const Lanes x = ls.b0 * h + ls.b1 * lsX1 + ls.a1 * lsY1;
+        lsX1 = h;
+        lsY1 = x;
+        Lanes feed;
+        const Lanes out = kernels::allpassStep(in, x, g, feed);
+        delay.write(feed);
+        return out;
+    }
+
+private:
+    DelayHX4 delay;
+    Lanes hsX1 = {};
+    Lanes hsY1 = {};
+    Lanes lsX1 = {};
+    Lanes lsY1 = {};
+};
+
+// ----- Tank --------------------------------------------------------------------
+
+// Both sides of the stereo tank. Per side: three shelved allpass diffusers
+// in series, the output shelves, and a feedback delay scaled to the RT60
+// whose output the other side takes as input (the sides swap feedback).
+//
+// The eight delay stages run as two four-lane vectors:
+//   stage A = {diffuser 1 L, diffuser 1 R, diffuser 2 L, diffuser 2 R}
+//   stage B = {diffuser 3 L, diffuser 3 R, feedback L,   feedback R}
+// Series stages cannot share a sample, so each stage takes its input from
+// the previous sample's output of the stage before it. That skew adds one
+// sample between diffusers 1-2, 2-3 and between the output and the
+// feedback delay; the feedback delay is read kPipelineSamples shorter, so
+// the loop length is unchanged and the output arrives 2 samples later.
+class LateDiffTank {
+public:
+    static constexpr float kSmoothingHalfLife = 0.05f;   // Delay time glide
+    static constexpr int kPipelineSamples = 3;
+
+    // Delay line k (diffusers 0-2, feedback 3) at the largest size,
+    // modulated all the way
+    static float maxLineSeconds(int k) {
+        return semitonesToSeconds(sizeToSemitones(1.0f) + 9.0f - 3.0f * static_cast<float>(k))
+             + kMaxModulationSeconds;
+    }
+
+    // Line length of stage A (lines 0, 1) or B (lines 2, 3)
+    static int stageSize(int stage, float sr) {
+        return std::max(DelayHX4::sizeFor(maxLineSeconds(2 * stage), sr),
+                        DelayHX4::sizeFor(maxLineSeconds(2 * stage + 1), sr));
+    }
+
+    // Arena floats the tank takes at this rate
+    static size_t delayFloats(float sr) {
+        return static_cast<size_t>(DelayHX4::floatsFor(stageSize(0, sr)) + DelayHX4::floatsFor(stageSize(1, sr)));
+    }
+
+    // Takes delayFloats(sr) from the arena
+    void setSampleRate(float sr, DelayArena& arena) {
+        sampleRate = std::max(1.0f, sr);
+        const int sizeA = stageSize(0, sampleRate);
+        const int sizeB = stageSize(1, sampleRate);
+        stageA.attach(arena.take(DelayHX4::floatsFor(sizeA)), sizeA);
+        stageB.attach(arena.take(DelayHX4::floatsFor(sizeB)), sizeB);
+        smoothing = 1.0f - std::exp(-0.6931471805599453f / (sampleRate * kSmoothingHalfLife));
+        shelvesValid = false;
+        clear();
+    }
+
+    void clear() {
+        stageA.clear();
+        stageB.clear();
+        for (OnePoleShelf& s : outShelves) s.reset();
+        outA = outB = Lanes{};
+        shelvedL = shelvedR = 0.0f;
+        primed = false;
+    }
+
+    // At most once per block. Size indices from sizeToSemitones(), dffs in
+    // [0, 1], rt60 in seconds, shelves in Hz and dB. The first call after
+    // clear() jumps the delay times to their targets instead of gliding from
+    // zero. Each group of derived values (delay targets, shelf coefficients
+    // shared by every lane, loop gains) is only worked out again when its
+    // own inputs changed, so a smoothed knob costs only its group
+    void setControls(float sizeIndexL, float sizeIndexR, float dffs, float rt60,
+                     float hf, float hbDb, float lf, float lbDb) {
+        const bool sizeChanged = !primed || sizeIndexL != lastSizeIndexL || sizeIndexR != lastSizeIndexR;
+        if (sizeChanged) {
+            // Diffusers at +9, +6, +3 semitones, feedback delay at +0
+            float seconds[2][4];
+            for (int k = 0; k < 4; ++k) {
+                const float offset = 9.0f - 3.0f * static_cast<float>(k);
+                seconds[0][k] = semitonesToSeconds(sizeIndexL + offset);
+                seconds[1][k] = semitonesToSeconds(sizeIndexR + offset);
+            }
+            targetA = Lanes{seconds[0][0], seconds[1][0], seconds[0][1], seconds[1][1]};
+            targetB = Lanes{seconds[0][2], seconds[1][2], seconds[0][3], seconds[1][3]};
+            if (!primed) {
+                timeA = targetA;
+                timeB = targetB;
+            }
+            primed = true;
+            loopSecondsL = seconds[0][0] + seconds[0][1] + seconds[0][2] + seconds[0][3];
+            loopSecondsR = seconds[1][0] + seconds[1][1] + seconds[1][2] + seconds[1][3];
+            lastSizeIndexL = sizeIndexL;
+            lastSizeIndexR = sizeIndexR;
+        }
+
+        diffusionA = broadcast(dffs);
+        diffusionB = Lanes{dffs, dffs, 0.0f, 0.0f};
+
+        if (!shelvesValid || hf != lastShelf[0] || hbDb != lastShelf[1] || lf != lastShelf[2] ||
+            lbDb != lastShelf[3]) {
+            hsCoeffs = highShelf(hf, hbDb, sampleRate);
+            lsCoeffs = lowShelf(lf, lbDb, sampleRate);
+            const bool all[4] = {true, true, true, true};
+            const bool diffusersOnly[4] = {true, true, false, false};
+            hsA.set(hsCoeffs, all);
+            lsA.set(lsCoeffs, all);
+            hsB.set(hsCoeffs, diffusersOnly);
+            lsB.set(lsCoeffs, diffusersOnly);
+            lastShelf[0] = hf;
+            lastShelf[1] = hbDb;
+            lastShelf[2] = lf;
+            lastShelf[3] = lbDb;
+            shelvesValid = true;
+        }
+
+        if (sizeChanged || rt60 != lastRt60) {
+            loopGainL = rt60ToGain(targetB[2], rt60);
+            loopGainR = rt60ToGain(targetB[3], rt60);
+            lastRt60 = rt60;
+        }
+    }
+
+    // Longest round trip through either side at the current targets (seconds)
+    float loopSeconds() const { return std::max(loopSecondsL, loopSecondsR); }
+
+    // n stereo samples. mod[k] holds the modulation in seconds of line k
+    // (0-3) on the left and line k - 4 on the right, as LFO8Parabolic
+    // renders it
+    void process(const float* inL, const float* inR, float* outL, float* outR,
+                 const float* const mod[8], int n) {
+        const Lanes pipeline = Lanes{0.0f, 0.0f, 1.0f, 1.0f} * static_cast<float>(kPipelineSamples);
+        for (int i = 0; i < n; ++i) {
+            timeA += smoothing * (targetA - timeA);
+            timeB += smoothing * (targetB - timeB);
+            const Lanes modA = {mod[0][i], mod[4][i], mod[1][i], mod[5][i]};
+            const Lanes modB = {mod[2][i], mod[6][i], mod[3][i], mod[7][i]};
+            const Lanes delayA = (timeA + modA) * sampleRate;
+            const Lanes delayB = (timeB + modB) * sampleRate - pipeline;
+
+            // Inputs from the previous sample's stage outputs; each side
+            // takes the other's feedback
+            const Lanes inA = {inL[i] + outB[3] * loopGainR, inR[i] + outB[2] * loopGainL,
+                               outA[0], outA[1]};
+            const Lanes inB = {outA[2], outA[3], shelvedL, shelvedR};
+            outA = stageA.process(inA, delayA, diffusionA, hsA, lsA);
+            outB = stageB.process(inB, delayB, diffusionB, hsB, lsB);
+
+            shelvedL = outShelves[2].process(outShelves[0].process(outB[0], hsCoeffs), lsCoeffs);
+            shelvedR = outShelves[3].process(outShelves[1].process(outB[1], hsCoeffs), lsCoeffs);
+            outL[i] = shelvedL;
+            outR[i] = shelvedR;
+        }
+    }
+
+private:
+    float sampleRate = 48000.0f;
+    float smoothing = 0.0f;             // One-pole coefficient of the delay time glide
+    DiffuserX4 stageA;
+    DiffuserX4 stageB;
+    OnePoleShelf outShelves[4];         // High L, high R, low L, low R
+
+    // Block controls from setControls()
+    Lanes targetA = {};
+    Lanes targetB = {};
+    Lanes diffusionA = {};
+    Lanes diffusionB = {};
+    ShelfCoeffs hsCoeffs;
+    ShelfCoeffs lsCoeffs;
+    ShelfLanes hsA;
+    ShelfLanes lsA;
+    ShelfLanes hsB;
+    ShelfLanes lsB;
+    float loopGainL = 0.0f;
+    float loopGainR = 0.0f;
+    float loopSecondsL = 0.0f;
+    float loopSecondsR = 0.0f;
+    bool primed = false;
+
+    // setControls() inputs the groups above were worked out from
+    float lastSizeIndexL = 0.0f;
+    float lastSizeIndexR = 0.0f;
+    float lastShelf[4] = {};            // hf, hbDb, lf, lbDb
+    float lastRt60 = 0.0f;
+    bool shelvesValid = false;          // Cleared by setSampleRate()
+
+    // Per-sample state
+    Lanes timeA = {};                   // Smoothed delay times (seconds)
+    Lanes timeB = {};
+    Lanes outA = {};                    // Stage outputs of the previous sample
+    Lanes outB = {};
+    float shelvedL = 0.0f;              // Tank outputs of the previous sample
+    float shelvedR = 0.0f;
+};
+
+} // namespace latediff
+
+#endif // LATEDIFF_TANK_H
@@ -0,0 +1,111 @@
+#include "latency_probe.h"
+#include "../../shared/dsp/real_fft.h"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+
+// -12 dBFS: loud enough over a line input's noise, clear of clipping
+constexpr float kLevel = 0.25f;
+
+// Peak over off-peak RMS below which there is no loopback to measure
+constexpr float kMinPeakRatio = 10.0f;
+
+// Galois LFSR feedback masks of maximal length, by order
+uint32_t lfsrMask(int order) {
+    switch (order) {
+        case 16: return 0xB400;     // x^16 + x^14 + x^13 + x^11 + 1
+        case 17: return 0x12000;    // x^17 + x^14 + 1
+        default: return 0x6000;     // x^15 + x^14 + 1
+    }
+}
+
+} // namespace
+
+LatencyProbe::LatencyProbe(int order) {
+    order = std::min(std::max(order, 15), 17);
+    const size_t length = (size_t(1) << order) - 1;
+    const uint32_t mask = lfsrMask(order);
+    sequence.resize(length);
+    uint32_t state = 1;
+    for (size_t i = 0; i < length; ++i) {
+        const uint32_t bit = state & 1u;
+        state >>= 1;
+        if (bit) {
+            state ^= mask;
+        }
+        sequence[i] = bit ? kLevel : -kLevel;
+    }
+    recorded.assign(3 * length, 0.0f);
+}
+
+void LatencyProbe::process(const float* input, float* left, float* right, unsigned int nFrames) {
+    const size_t length = sequence.size();
+    for (unsigned int i = 0; i < nFrames; ++i) {
+        float out = 0.0f;
+        if (position < recorded.size()) {
+            out = sequence[position % length];
+            recorded[position] = input ? input[i] : 0.0f;
+            ++position;
+        }
+        if (right) {
+            left[i] = out;
+            right[i] = out;
+        } else {
+            left[2 * i] = out;
+            left[2 * i + 1] = out;
+        }
+    }
+    if (position == recorded.size()) {
+        done.store(true, std::memory_order_release);
+    }
+}
+
+LatencyProbe::Result LatencyProbe::analyse() const {
+    Result result;
+    const size_t length = sequence.size();
+
+    // r[k] = sum over i of sequence[i] * steady[i + k], k < length, where
+    // steady is the last two periods. A zero-padded FFT of at least 2 *
+    // length points keeps every term of those lags clear of wraparound
+    int size = 1;
+    while (static_cast<size_t>(size) < 2 * length) {
+        size <<= 1;
+    }
+    kernels::RealFFT fft(size);
+    const int bins = size / 2 + 1;
+    std::vector<float> block(size, 0.0f);
+    std::vector<float> steadyRe(bins), steadyIm(bins), sequenceRe(bins), sequenceIm(bins);
+
+    std::copy(recorded.begin() + length, recorded.end(), block.begin());
+    fft.forward(block.data(), steadyRe.data(), steadyIm.data());
+    std::fill(block.begin(), block.end(), 0.0f);
+    std::copy(sequence.begin(), sequence.end(), block.begin());
+    fft.forward(block.data(), sequenceRe.data(), sequenceIm.data());
+
+    // Cross-correlation: steady times the conjugate of the sequence
+    for (int k = 0; k < bins; ++k) {
+        const float re = steadyRe[k] * sequenceRe[k] + steadyIm[k] * sequenceIm[k];
+        const float im = steadyIm[k] * sequenceRe[k] - steadyRe[k] * sequenceIm[k];
+        steadyRe[k] = re;
+        steadyIm[k] = im;
+    }
+    fft.inverse(steadyRe.data(), steadyIm.data(), block.data());
+
+    size_t peak = 0;
+    double energy = 0.0;
+    for (size_t k = 0; k < length; ++k) {
+        energy += static_cast<double>(block[k]) * block[k];
+        if (std::fabs(block[k]) > std::fabs(block[peak])) {
+            peak = k;
+        }
+    }
+    const double peakValue = std::fabs(block[peak]);
+    const double others = energy - peakValue * peakValue;
+    const double rms = std::sqrt(std::max(others, 0.0) / static_cast<double>(length - 1));
+    result.peakRatio = rms > 0.0 ? static_cast<float>(peakValue / rms) : 0.0f;
+    result.found = peakValue > 0.0 && (rms == 0.0 || result.peakRatio >= kMinPeakRatio);
+    result.frames = static_cast<unsigned int>(peak);
+    result.inverted = block[peak] < 0.0f;
+    return result;
+}
@@ -0,0 +1,53 @@
+#ifndef LATENCY_PROBE_H
+#define LATENCY_PROBE_H
+
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+// Round-trip latency measurement (--measure-latency): plays a maximum
+// length sequence (MLS) on the outputs, records an input looped back to
+// them, and finds the delay as the peak of the cross-correlation of the two.
+//
+// The sequence plays three periods back to back. Once the first period
+// has passed through, the recording is the periodic sequence delayed by
+// the round trip, so correlating one period against the last two finds
+// the delay without edge effects. It must be shorter than a period:
+// 2^order - 1 frames, 680 ms at 48 kHz for the default order of 15. An
+// MLS's autocorrelation is flat off its peak, so the peak stands out even
+// through noise and the converters' filtering. An inverted input (a
+// polarity-swapping interface or cable) still finds the peak.
+class LatencyProbe {
+public:
+    struct Result {
+        bool found = false;         // The peak stands out: a loopback is connected
+        unsigned int frames = 0;    // Output to input, in frames
+        bool inverted = false;
+        float peakRatio = 0.0f;     // Peak over the RMS of the other lags
+    };
+
+    explicit LatencyProbe(int order = 15);
+
+    // Audio thread: write the next nFrames of the sequence to both outputs
+    // (interleaved stereo when right is null) and record nFrames of input.
+    // Silence once the three periods have played
+    void process(const float* input, float* left, float* right, unsigned int nFrames);
+
+    // All three periods played and recorded
+    bool isDone() const { return done.load(std::memory_order_acquire); }
+    size_t getTotalFrames() const { return recorded.size(); }
+
+    // After isDone(): correlate and find the delay
+    Result analyse() const;
+
+    LatencyProbe(const LatencyProbe&) = delete;
+    LatencyProbe& operator=(const LatencyProbe&) = delete;
+
+private:
+    std::vector<float> sequence;    // +-kLevel, one period
+    std::vector<float> recorded;    // Three periods
+    size_t position = 0;            // Audio thread only
+    std::atomic<bool> done{false};
+};
+
+#endif // LATENCY_PROBE_H
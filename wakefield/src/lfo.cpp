@@ -1,4 +1,5 @@
 #include "lfo.h"
+#include "fastmath.h"
 #include <algorithm>
 #include <cmath>
 
@@ -40,14 +41,13 @@ float LFO::generatePhaseDistorted(float phase, float morph) {
     }
 
     // No vertical inversion - just horizontal mirroring via phase
-    float output = -std::cos(shapedPhase * 2.0f * static_cast<float>(M_PI));
+    float output = -fastmath::cosTurns(shapedPhase);
     return output;
 }
 
 // Tanh-shaped pulse (same as brainwave osc)
 float LFO::generateTanhShaped(float phase, float morph, float duty) {
-    const float twoPi = 2.0f * static_cast<float>(M_PI);
-    float sine = std::sin(twoPi * phase);
+    float sine = fastmath::sinTurns(phase);
 
     float edge = std::min(std::max(morph, 0.0f), 1.0f);
 
@@ -55,10 +55,9 @@ float LFO::generateTanhShaped(float phase, float morph, float duty) {
         return sine;
     }
 
-    float theta = twoPi * (duty - 0.5f);
-    float x = sine - std::sin(theta);
+    float x = sine - fastmath::sinTurns(duty - 0.5f);
     float beta = 1.0f + 80.0f * edge;
-    float tanhPulse = std::tanh(beta * x);
+    float tanhPulse = fastmath::tanh(beta * x);
 
     return (1.0f - edge) * sine + edge * tanhPulse;
 }
@@ -136,24 +135,39 @@ float LFO::generateSample(uint32_t phase) {
     return sample;
 }
 
-float LFO::process(float sampleRate, unsigned int nFrames) {
+uint32_t LFO::phaseIncrement(float sampleRate) {
     // Calculate frequency based on mode
     float frequency = calculateFrequency(sampleRate);
 
     // Calculate phase increment per sample (32-bit unsigned for high precision)
     double phaseIncrementDouble = (frequency / sampleRate) * 4294967296.0;
-    uint32_t phaseIncrement = static_cast<uint32_t>(phaseIncrementDouble);
+    return static_cast<uint32_t>(phaseIncrementDouble);
+}
+
+float LFO::process(float sampleRate, unsigned int nFrames) {
+    const uint32_t increment = phaseIncrement(sampleRate);
 
     // Generate sample at current phase
     currentOutput_ = generateSample(phaseAccumulator_);
 
     // Advance phase by the number of frames that have elapsed
     // This is called once per audio buffer at control rate
-    phaseAccumulator_ += phaseIncrement * nFrames;
+    phaseAccumulator_ += increment * nFrames;
 
     return currentOutput_;
 }
 
+void LFO::processBlock(float sampleRate, float* out, unsigned int nFrames) {
+    const uint32_t increment = phaseIncrement(sampleRate);
+    for (unsigned int i = 0; i < nFrames; ++i) {
+        out[i] = generateSample(phaseAccumulator_);
+        phaseAccumulator_ += increment;
+    }
+    if (nFrames > 0) {
+        currentOutput_ = out[nFrames - 1];
+    }
+}
+
 void LFO::reset() {
     phaseAccumulator_ = 0;
     currentOutput_ = 0.0f;
@@ -162,3 +176,108 @@ void LFO::reset() {
 float LFO::getPhase() const {
     return static_cast<double>(phaseAccumulator_) / 4294967296.0;
 }
+
+namespace {
+
+// Shape settings of one LFO for a block, worked out with the same
+// arithmetic as LFO::generatePhaseDistorted and LFO::generateTanhShaped
+struct BlockShape {
+    bool mirror;
+    float pivot;
+    float denomLow;
+    float denomHigh;
+    float edge;
+    float dutySine;
+    float beta;
+    bool pureSine;
+    bool tanhShape;
+    float polarity;
+};
+
+constexpr int kChunk = 64;
+
+// out[k] = the LFO at phase[k], k < n <= kChunk. Branch-free per frame, so
+// each loop vectorizes across frames
+inline void renderShape(const BlockShape& s, const uint32_t* phase, float* out, int n) {
+    float p[kChunk];
+    for (int k = 0; k < n; ++k) {
+        p[k] = static_cast<float>(phase[k]) / static_cast<float>(0xFFFFFFFF);
+    }
+    if (!s.tanhShape) {
+        for (int k = 0; k < n; ++k) {
+            const float working = s.mirror ? 1.0f - p[k] : p[k];
+            const float shaped = working <= s.pivot ? working / s.denomLow
+                                                    : 0.5f * (1.0f + ((working - s.pivot) / s.denomHigh));
+            out[k] = -fastmath::cosTurns(shaped) * s.polarity;
+        }
+        return;
+    }
+    for (int k = 0; k < n; ++k) {
+        float shifted = p[k] + 0.5f;
+        shifted = shifted >= 1.0f ? shifted - 1.0f : shifted;
+        const float sine = fastmath::sinTurns(shifted);
+        if (s.pureSine) {
+            out[k] = sine * s.polarity;
+        } else {
+            const float tanhPulse = fastmath::tanh(s.beta * (sine - s.dutySine));
+            out[k] = ((1.0f - s.edge) * sine + s.edge * tanhPulse) * s.polarity;
+        }
+    }
+}
+
+} // namespace
+
+void LFOBank::processBlock(float sampleRate, float* const* out, unsigned int stored, unsigned int nFrames) {
+    for (int lane = 0; lane < kLanes; ++lane) {
+        LFO& lfo = lfos[lane];
+        const uint32_t increment = lfo.phaseIncrement(sampleRate);
+
+        BlockShape shape;
+        const float clamped = std::min(std::max(lfo.morphPosition_, 0.0f), 1.0f);
+        float morphAmount = clamped;
+        if (clamped < 0.5f) {
+            morphAmount = 1.0f - clamped * 2.0f;
+            morphAmount = 0.5f + morphAmount * 0.5f;
+        }
+        const float t = (morphAmount - 0.5f) * 2.0f;
+        shape.mirror = clamped < 0.5f;
+        shape.pivot = std::min(std::max(0.5f + 0.4999f * t, 0.0001f), 0.9999f);
+        shape.denomLow = std::max(1e-6f, 2.0f * shape.pivot);
+        shape.denomHigh = std::max(1e-6f, 1.0f - shape.pivot);
+        shape.edge = clamped;
+        shape.dutySine = fastmath::sinTurns(lfo.duty_ - 0.5f);
+        shape.beta = 1.0f + 80.0f * clamped;
+        shape.pureSine = clamped < 1e-3f;
+        shape.tanhShape = lfo.shape_ != 0;
+        shape.polarity = lfo.flipPolarity_ ? -1.0f : 1.0f;
+
+        uint32_t phase = lfo.phaseAccumulator_;
+        uint32_t phases[kChunk];
+        float last = lfo.currentOutput_;
+        for (unsigned int done = 0; done < stored;) {
+            const int n = static_cast<int>(std::min<unsigned int>(stored - done, kChunk));
+            for (int k = 0; k < n; ++k) {
+                phases[k] = phase + increment * static_cast<uint32_t>(k);
+            }
+            renderShape(shape, phases, out[lane] + done, n);
+            phase += increment * static_cast<uint32_t>(n);
+            done += static_cast<unsigned int>(n);
+            last = out[lane][done - 1];
+        }
+        if (nFrames > stored) {
+            // The rest only advances; the cached value is its first frame's
+            renderShape(shape, &phase, &last, 1);
+            phase += increment * (nFrames - stored);
+        }
+        lfo.phaseAccumulator_ = phase;
+        lfo.currentOutput_ = last;
+    }
+}
+
+void LFOBank::noteOn() {
+    for (LFO& lfo : lfos) {
+        if (lfo.resetOnNote_) {
+            lfo.reset();
+        }
+    }
+}
@@ -44,6 +44,10 @@ public:
     // nFrames: number of samples that have elapsed since last call
     float process(float sampleRate, unsigned int nFrames = 1);
 
+    // Renders one value per frame into out, advancing the phase a frame at
+    // a time; the cached value is then the last frame's
+    void processBlock(float sampleRate, float* out, unsigned int nFrames);
+
     // Reset phase (called on note-on if resetOnNote is true)
     void reset();
 
@@ -53,6 +57,8 @@ public:
     float getPhase() const;
 
 private:
+    friend class LFOBank;
+
     float period_;            // Free-running period in seconds
     LFOSyncMode syncMode_;    // Sync mode
     int shape_;               // 0=phase-distorted, 1=tanh-shaped
@@ -70,9 +76,39 @@ private:
 
     // Helper functions
     float calculateFrequency(float sampleRate);
+    uint32_t phaseIncrement(float sampleRate);
     float generateSample(uint32_t phase);
     float generatePhaseDistorted(float phase, float morph);
     float generateTanhShaped(float phase, float morph, float duty);
 };
 
+// The synth's four LFOs rendered in one pass. An LFO's phase at frame k is
+// its start phase plus k increments, so unlike ChaosBank the bank vectorizes
+// across frames rather than across LFOs: each lane's shape settings are
+// worked out once per block, then its frames go in chunks through
+// branch-free loops over the fastmath kernels that GCC vectorizes, and
+// only the lane's own shape is evaluated. Parameters, tempo sync and
+// reset-on-note stay on each lane's LFO (operator[]); the bank reads them
+// once per block and writes the phase and cached value back, so a lane
+// matches LFO::processBlock sample for sample.
+class LFOBank {
+public:
+    static constexpr int kLanes = 4;
+
+    LFO& operator[](int lane) { return lfos[lane]; }
+    const LFO& operator[](int lane) const { return lfos[lane]; }
+
+    // Renders frames [0, stored) of lane i into out[i] and advances every
+    // lane nFrames (>= stored). The cached values end as LFO::processBlock
+    // over the stored frames followed by LFO::process over the rest leaves
+    // them
+    void processBlock(float sampleRate, float* const* out, unsigned int stored, unsigned int nFrames);
+
+    // Restarts the lanes that have reset-on-note set
+    void noteOn();
+
+private:
+    LFO lfos[kLanes];
+};
+
 #endif // LFO_H
@@ -0,0 +1,221 @@
+#include "loop_chunk_pool.h"
+#include <algorithm>
+#include <cstring>
+#include <new>
+
+#if defined(__x86_64__) && defined(__GNUC__)
+#include <immintrin.h>
+#define LOOP_HALF_F16C 1
+#elif defined(__aarch64__)
+#include <arm_neon.h>
+#define LOOP_HALF_NEON 1
+#endif
+
+namespace {
+
+// Chunk header padded to a cache line, samples follow
+constexpr size_t kChunkHeaderBytes = 64;
+static_assert(sizeof(LoopChunkPool::Chunk) <= kChunkHeaderBytes, "chunk header fits its padding");
+
+uint16_t halfFromFloat(float value) {
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    const uint32_t sign = (bits >> 16) & 0x8000u;
+    uint32_t magnitude = bits & 0x7fffffffu;
+
+    if (magnitude >= 0x47800000u) {
+        // Beyond the half range, infinity or NaN
+        return static_cast<uint16_t>(sign | (magnitude > 0x7f800000u ? 0x7e00u : 0x7c00u));
+    }
+    if (magnitude < 0x38800000u) {
+        // Half subnormal or zero: adding 0.5f lines the half ulp (2^-24) up
+        // with the float ulp, so the FPU rounds for us
+        float f;
+        std::memcpy(&f, &magnitude, sizeof(f));
+        f += 0.5f;
+        std::memcpy(&magnitude, &f, sizeof(f));
+        return static_cast<uint16_t>(sign | (magnitude - 0x3f000000u));
+    }
+    // Rebias the exponent and round the 13 dropped bits to nearest even; a
+    // carry out of the mantissa bumps the exponent (up to infinity)
+    const uint32_t odd = (magnitude >> 13) & 1u;
+    magnitude += 0xc8000fffu + odd;
+    return static_cast<uint16_t>(sign | (magnitude >> 13));
+}
+
+float floatFromHalf(uint16_t half) {
+    const uint32_t sign = static_cast<uint32_t>(half & 0x8000u) << 16;
+    const uint32_t magnitude = half & 0x7fffu;
+    uint32_t bits;
+    if (magnitude >= 0x7c00u) {
+        bits = sign | 0x7f800000u | ((magnitude & 0x3ffu) << 13);
+    } else if (magnitude >= 0x0400u) {
+        bits = sign | ((magnitude << 13) + 0x38000000u);
+    } else {
+        // Subnormal: exact as a normal float
+        float f = static_cast<float>(magnitude) * (1.0f / 16777216.0f);
+        std::memcpy(&bits, &f, sizeof(bits));
+        bits |= sign;
+    }
+    float value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+#ifdef LOOP_HALF_F16C
+bool hasF16C() {
+    static const bool supported = __builtin_cpu_supports("f16c");
+    return supported;
+}
+
+__attribute__((target("avx,f16c")))
+uint32_t encodeHalfF16C(const float* src, uint16_t* dst, uint32_t n) {
+    uint32_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m128i half = _mm256_cvtps_ph(_mm256_loadu_ps(src + i), _MM_FROUND_TO_NEAREST_INT);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), half);
+    }
+    return i;
+}
+
+__attribute__((target("avx,f16c")))
+uint32_t decodeHalfF16C(const uint16_t* src, float* dst, uint32_t n) {
+    uint32_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m128i half = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        _mm256_storeu_ps(dst + i, _mm256_cvtph_ps(half));
+    }
+    return i;
+}
+#endif
+
+} // namespace
+
+LoopChunkPool::LoopChunkPool(size_t maxChunks, size_t lowWatermark, Format format)
+    : maxChunks(maxChunks)
+    , lowWatermark(std::min(lowWatermark, maxChunks))
+    , format(format) {
+    allChunks.reserve(maxChunks);
+    refill();
+}
+
+LoopChunkPool::~LoopChunkPool() {
+    for (Chunk* chunk : allChunks) {
+        delete[] reinterpret_cast<unsigned char*>(chunk);
+    }
+}
+
+LoopChunkPool::Chunk* LoopChunkPool::acquire() {
+    Chunk* head = freeHead.load(std::memory_order_acquire);
+    while (head && !freeHead.compare_exchange_weak(head, head->next,
+                                                   std::memory_order_acquire,
+                                                   std::memory_order_acquire)) {
+    }
+    if (!head) {
+        starved.fetch_add(1, std::memory_order_relaxed);
+        return nullptr;
+    }
+    freeCount.fetch_sub(1, std::memory_order_relaxed);
+    head->refs.store(1, std::memory_order_relaxed);
+    return head;
+}
+
+void LoopChunkPool::release(Chunk* chunk) {
+    // acq_rel: whoever drops the last reference sees every write to the
+    // chunk before it is reused
+    if (chunk && chunk->refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        push(chunk);
+    }
+}
+
+void LoopChunkPool::push(Chunk* chunk) {
+    Chunk* head = freeHead.load(std::memory_order_relaxed);
+    do {
+        chunk->next = head;
+    } while (!freeHead.compare_exchange_weak(head, chunk,
+                                             std::memory_order_release,
+                                             std::memory_order_relaxed));
+    freeCount.fetch_add(1, std::memory_order_relaxed);
+}
+
+size_t LoopChunkPool::refill() {
+    std::lock_guard<std::mutex> lock(ownerMutex);
+    size_t added = 0;
+    while (getFreeCount() < lowWatermark) {
+        Chunk* chunk = allocateLocked();
+        if (!chunk) {
+            break;
+        }
+        push(chunk);
+        ++added;
+    }
+    return added;
+}
+
+LoopChunkPool::Chunk* LoopChunkPool::allocate() {
+    std::lock_guard<std::mutex> lock(ownerMutex);
+    Chunk* chunk = allocateLocked();
+    if (chunk) {
+        chunk->refs.store(1, std::memory_order_relaxed);
+    }
+    return chunk;
+}
+
+LoopChunkPool::Chunk* LoopChunkPool::allocateLocked() {
+    if (allChunks.size() >= maxChunks) {
+        return nullptr;
+    }
+    const size_t channelBytes = kChunkFrames * bytesPerSample(format);
+    const size_t blockBytes = kChunkHeaderBytes + 2 * channelBytes;
+    if (!memstats::fits(memstats::LOOPER, blockBytes)) {
+        if (!budgetReached) {
+            memstats::noteEnforced(memstats::LOOPER);
+            budgetReached = true;
+        }
+        return nullptr;
+    }
+    budgetReached = false;
+    unsigned char* block = new (std::nothrow) unsigned char[blockBytes]();
+    if (!block) {
+        return nullptr;
+    }
+    Chunk* chunk = new (block) Chunk();
+    chunk->left = block + kChunkHeaderBytes;
+    chunk->right = block + kChunkHeaderBytes + channelBytes;
+    allChunks.push_back(chunk);
+    allocatedCount.store(allChunks.size(), std::memory_order_relaxed);
+    memory.set(allChunks.size() * blockBytes);
+    return chunk;
+}
+
+void LoopChunkPool::encodeHalf(const float* src, uint16_t* dst, uint32_t n) {
+    uint32_t i = 0;
+#if defined(LOOP_HALF_F16C)
+    if (hasF16C()) {
+        i = encodeHalfF16C(src, dst, n);
+    }
+#elif defined(LOOP_HALF_NEON)
+    for (; i + 4 <= n; i += 4) {
+        vst1_u16(dst + i, vreinterpret_u16_f16(vcvt_f16_f32(vld1q_f32(src + i))));
+    }
+#endif
+    for (; i < n; ++i) {
+        dst[i] = halfFromFloat(src[i]);
+    }
+}
+
+void LoopChunkPool::decodeHalf(const uint16_t* src, float* dst, uint32_t n) {
+    uint32_t i = 0;
+#if defined(LOOP_HALF_F16C)
+    if (hasF16C()) {
+        i = decodeHalfF16C(src, dst, n);
+    }
+#elif defined(LOOP_HALF_NEON)
+    for (; i + 4 <= n; i += 4) {
+        vst1q_f32(dst + i, vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(src + i))));
+    }
+#endif
+    for (; i < n; ++i) {
+        dst[i] = floatFromHalf(src[i]);
+    }
+}
@@ -0,0 +1,116 @@
+#ifndef LOOP_CHUNK_POOL_H
+#define LOOP_CHUNK_POOL_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+#include "memory_stats.h"
+
+// Looper storage in fixed-size stereo chunks, handed out while recording.
+//
+// Memory follows what is recorded instead of loops x MAX_LOOP_SECONDS
+// up front. The audio thread (whichever thread runs LoopManager::processBlock)
+// takes and returns chunks through a lock-free free list; refill() allocates
+// new ones on a normal thread whenever the free list is below the low
+// watermark, so the audio thread never allocates. Chunks are zeroed when
+// allocated, which also faults their pages in off the audio thread.
+//
+// Chunks are reference counted so a loop, its undo layers and a save in
+// progress can share them; a holder that wants to write into a shared
+// chunk copies it first (Looper::prepareWrite). Only the audio thread adds
+// references, any thread may drop them.
+//
+// Chunks count towards the looper's memory budget (memory_stats.h): past
+// it, refill() and allocate() stop allocating as they do at maxChunks.
+//
+// A pool stores either 32-bit float or IEEE half samples. Half keeps an
+// 11-bit mantissa at every level (about -66 dB of noise relative to the
+// signal, no gain to track while overdubbing) in half the memory.
+class LoopChunkPool {
+public:
+    static constexpr uint32_t kChunkShift = 16;
+    static constexpr uint32_t kChunkFrames = 1u << kChunkShift;   // ~1.4 s at 48 kHz
+    static constexpr uint32_t kChunkMask = kChunkFrames - 1;
+
+    enum class Format {
+        Float32,
+        Float16     // IEEE binary16, converted on record and playback
+    };
+
+    struct Chunk {
+        void* left;                 // kChunkFrames samples in the pool's format
+        void* right;
+        Chunk* next;                // Free list link
+        std::atomic<uint32_t> refs{0};
+    };
+
+    // maxChunks caps the total ever allocated (as does the looper budget);
+    // refill() keeps at least lowWatermark chunks free. Allocates the first
+    // lowWatermark chunks
+    LoopChunkPool(size_t maxChunks, size_t lowWatermark, Format format = Format::Float32);
+    ~LoopChunkPool();
+
+    // Audio thread. A chunk with one reference, nullptr when the free list
+    // is empty
+    Chunk* acquire();
+
+    // Add a reference (audio thread only) / drop one (any thread); the last
+    // release puts the chunk back on the free list
+    static void retain(Chunk* chunk) { chunk->refs.fetch_add(1, std::memory_order_relaxed); }
+    void release(Chunk* chunk);
+
+    // More than one holder: copy before writing
+    static bool isShared(const Chunk* chunk) { return chunk->refs.load(std::memory_order_acquire) > 1; }
+
+    // Normal thread (UI loop, offline render loop): top the free list back
+    // up to the low watermark. Returns the number of chunks allocated
+    size_t refill();
+
+    // Normal thread (loop import): a new zeroed chunk with one reference
+    // that bypasses the free list, or nullptr at maxChunks
+    Chunk* allocate();
+
+    Format getFormat() const { return format; }
+    static size_t bytesPerSample(Format format) { return format == Format::Float16 ? 2 : 4; }
+    size_t getChunkBytes() const { return 2 * kChunkFrames * bytesPerSample(format); }
+
+    size_t getFreeCount() const { return freeCount.load(std::memory_order_relaxed); }
+    size_t getAllocatedCount() const { return allocatedCount.load(std::memory_order_relaxed); }
+    size_t getAllocatedBytes() const { return getAllocatedCount() * getChunkBytes(); }
+
+    // acquire() calls that found the free list empty
+    uint64_t getStarvedCount() const { return starved.load(std::memory_order_relaxed); }
+
+    // float <-> half, round to nearest even. F16C or NEON where available
+    static void encodeHalf(const float* src, uint16_t* dst, uint32_t n);
+    static void decodeHalf(const uint16_t* src, float* dst, uint32_t n);
+
+    LoopChunkPool(const LoopChunkPool&) = delete;
+    LoopChunkPool& operator=(const LoopChunkPool&) = delete;
+
+private:
+    void push(Chunk* chunk);
+    Chunk* allocateLocked();
+
+    // Treiber stack: several threads push, only the audio thread pops, so a
+    // popped head cannot come back under a pending CAS (no ABA)
+    std::atomic<Chunk*> freeHead{nullptr};
+    std::atomic<size_t> freeCount{0};
+    std::atomic<size_t> allocatedCount{0};
+    std::atomic<uint64_t> starved{0};
+
+    // Owner list, under ownerMutex (refill() and allocate() may run on
+    // different threads). Each chunk is one allocation: the header, then the
+    // left and right samples
+    std::mutex ownerMutex;
+    std::vector<Chunk*> allChunks;
+    size_t maxChunks;
+    size_t lowWatermark;
+    Format format;
+    memstats::Account memory{memstats::LOOPER};
+    bool budgetReached = false;     // Counted once per stop, not per refill
+};
+
+#endif // LOOP_CHUNK_POOL_H
@@ -0,0 +1,265 @@
+#include "loop_file.h"
+#include "looper.h"
+#include "loop_chunk_pool.h"
+#include "wav_reader.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <vector>
+
+namespace {
+
+// Frames converted per read or write
+constexpr uint32_t kBlockFrames = 4096;
+
+// How long a save waits for the audio thread to capture the loop
+constexpr auto kExportAnswerTimeout = std::chrono::seconds(2);
+constexpr auto kExportPollInterval = std::chrono::milliseconds(1);
+
+void put16(std::ofstream& out, uint16_t v) { out.write(reinterpret_cast<const char*>(&v), 2); }
+void put32(std::ofstream& out, uint32_t v) { out.write(reinterpret_cast<const char*>(&v), 4); }
+
+void writeFloatWAVHeader(std::ofstream& out, uint32_t sampleRate, uint32_t frames) {
+    const uint32_t dataBytes = frames * 2 * sizeof(float);
+    out.write("RIFF", 4);
+    put32(out, 4 + (8 + 16) + (8 + 4) + (8 + dataBytes));
+    out.write("WAVE", 4);
+    out.write("fmt ", 4);
+    put32(out, 16);
+    put16(out, 3);                          // WAVE_FORMAT_IEEE_FLOAT
+    put16(out, 2);
+    put32(out, sampleRate);
+    put32(out, sampleRate * 2 * sizeof(float));
+    put16(out, 2 * sizeof(float));
+    put16(out, 32);
+    out.write("fact", 4);
+    put32(out, 4);
+    put32(out, frames);
+    out.write("data", 4);
+    put32(out, dataBytes);
+}
+
+std::string seconds(uint32_t frames, float sampleRate) {
+    char text[32];
+    snprintf(text, sizeof(text), "%.1f s", frames / sampleRate);
+    return text;
+}
+
+} // namespace
+
+LoopFileWorker::~LoopFileWorker() {
+    stop();
+}
+
+void LoopFileWorker::save(Looper& looper, int index, const std::string& path, float sampleRate) {
+    enqueue(Job{true, &looper, index, path, sampleRate});
+}
+
+void LoopFileWorker::load(Looper& looper, int index, const std::string& path, float sampleRate) {
+    enqueue(Job{false, &looper, index, path, sampleRate});
+}
+
+bool LoopFileWorker::pollMessage(std::string& message) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (messages.empty()) {
+        return false;
+    }
+    message = std::move(messages.front());
+    messages.pop_front();
+    return true;
+}
+
+void LoopFileWorker::stop() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    wake.notify_all();
+    if (thread.joinable()) {
+        thread.join();
+    }
+}
+
+void LoopFileWorker::enqueue(Job job) {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        jobs.push_back(std::move(job));
+        stopping = false;
+        if (!thread.joinable()) {
+            thread = std::thread(&LoopFileWorker::worker, this);
+        }
+    }
+    wake.notify_one();
+}
+
+void LoopFileWorker::worker() {
+    std::unique_lock<std::mutex> lock(mutex);
+    while (true) {
+        wake.wait(lock, [this] { return stopping || !jobs.empty(); });
+        if (jobs.empty()) {
+            return;     // Stopping with nothing left to do
+        }
+        Job job = std::move(jobs.front());
+        jobs.pop_front();
+        lock.unlock();
+        std::string message = job.save ? saveLoop(job) : loadLoop(job);
+        lock.lock();
+        messages.push_back(std::move(message));
+    }
+}
+
+std::string LoopFileWorker::saveLoop(const Job& job) {
+    const std::string name = "Loop " + std::to_string(job.index + 1);
+    Looper& looper = *job.looper;
+    if (!looper.requestExport()) {
+        return name + ": already being saved";
+    }
+
+    // The audio thread captures the chunk table at its next block
+    const auto deadline = std::chrono::steady_clock::now() + kExportAnswerTimeout;
+    while (looper.getExportStatus() == Looper::ExportPending) {
+        if (std::chrono::steady_clock::now() > deadline && looper.cancelExportRequest()) {
+            return name + " not saved: audio is not running";
+        }
+        std::this_thread::sleep_for(kExportPollInterval);
+    }
+    if (looper.getExportStatus() == Looper::ExportRefused) {
+        looper.endExport();
+        return name + " is empty or recording, nothing saved";
+    }
+
+    const uint32_t frames = looper.getExportFrames();
+    const bool half = looper.getPool()->getFormat() == LoopChunkPool::Format::Float16;
+    const size_t chunkCount = (frames + LoopChunkPool::kChunkMask) >> LoopChunkPool::kChunkShift;
+    const uint32_t sampleRate = static_cast<uint32_t>(std::lround(job.sampleRate));
+
+    const std::string tempPath = job.path + ".tmp";
+    std::ofstream out(tempPath, std::ios::binary | std::ios::trunc);
+    writeFloatWAVHeader(out, sampleRate, frames);
+
+    std::vector<float> left(kBlockFrames);
+    std::vector<float> right(kBlockFrames);
+    std::vector<float> interleaved(2 * kBlockFrames);
+    for (size_t c = 0; c < chunkCount; ++c) {
+        // Every captured chunk is finished, even after a write error, so
+        // the looper gets its copied-over chunks back
+        const LoopChunkPool::Chunk* chunk = looper.getExportChunk(c);
+        const uint32_t start = static_cast<uint32_t>(c) << LoopChunkPool::kChunkShift;
+        const uint32_t chunkFrames = std::min(LoopChunkPool::kChunkFrames, frames - start);
+        for (uint32_t offset = 0; out && offset < chunkFrames; offset += kBlockFrames) {
+            const uint32_t n = std::min(kBlockFrames, chunkFrames - offset);
+            const float* l;
+            const float* r;
+            if (half) {
+                LoopChunkPool::decodeHalf(static_cast<const uint16_t*>(chunk->left) + offset, left.data(), n);
+                LoopChunkPool::decodeHalf(static_cast<const uint16_t*>(chunk->right) + offset, right.data(), n);
+                l = left.data();
+                r = right.data();
+            } else {
+                l = static_cast<const float*>(chunk->left) + offset;
+                r = static_cast<const float*>(chunk->right) + offset;
+            }
+            for (uint32_t i = 0; i < n; ++i) {
+                interleaved[2 * i] = l[i];
+                interleaved[2 * i + 1] = r[i];
+            }
+            out.write(reinterpret_cast<const char*>(interleaved.data()), n * 2 * sizeof(float));
+        }
+        looper.finishExportChunk(c);
+    }
+    looper.endExport();
+
+    out.close();
+    if (out.fail() || std::rename(tempPath.c_str(), job.path.c_str()) != 0) {
+        std::remove(tempPath.c_str());
+        return name + ": could not write " + job.path;
+    }
+    return name + " saved to " + job.path + " (" + seconds(frames, job.sampleRate) + ")";
+}
+
+std::string LoopFileWorker::loadLoop(const Job& job) {
+    const std::string name = "Loop " + std::to_string(job.index + 1);
+    Looper& looper = *job.looper;
+
+    std::ifstream in(job.path, std::ios::binary);
+    if (!in) {
+        return name + ": could not open " + job.path;
+    }
+    WAVInfo info;
+    std::string error;
+    if (!readWAVHeader(in, info, error)) {
+        return name + ": " + job.path + ": " + error;
+    }
+    const bool pcm = info.format == 1 &&
+                     (info.bitsPerSample == 16 || info.bitsPerSample == 24 || info.bitsPerSample == 32);
+    const bool ieee = info.format == 3 && info.bitsPerSample == 32;
+    const uint32_t bytesPerSample = info.bitsPerSample / 8;
+    if ((!pcm && !ieee) || info.channels == 0 || info.blockAlign < info.channels * bytesPerSample) {
+        return name + ": " + job.path + ": unsupported sample format";
+    }
+    const uint32_t sampleRate = static_cast<uint32_t>(std::lround(job.sampleRate));
+    if (info.sampleRate != sampleRate) {
+        return name + ": " + job.path + " is " + std::to_string(info.sampleRate) +
+               " Hz, the engine runs at " + std::to_string(sampleRate) + " Hz";
+    }
+
+    uint32_t frames = info.dataBytes / info.blockAlign;
+    const bool truncated = frames > looper.getMaxFrames();
+    frames = std::min(frames, looper.getMaxFrames());
+    if (frames == 0) {
+        return name + ": " + job.path + " has no audio";
+    }
+
+    std::vector<LoopChunkPool::Chunk*>* table = looper.beginImport();
+    if (!table) {
+        return name + ": a loaded loop is still waiting for its loop boundary";
+    }
+
+    LoopChunkPool* pool = looper.getPool();
+    const bool half = pool->getFormat() == LoopChunkPool::Format::Float16;
+    const uint32_t rightChannel = info.channels > 1 ? bytesPerSample : 0;   // Mono plays on both sides
+    std::vector<unsigned char> raw(static_cast<size_t>(kBlockFrames) * info.blockAlign);
+    std::vector<float> left(kBlockFrames);
+    std::vector<float> right(kBlockFrames);
+
+    uint32_t position = 0;
+    while (position < frames) {
+        LoopChunkPool::Chunk*& chunk = (*table)[position >> LoopChunkPool::kChunkShift];
+        if (!chunk && !(chunk = pool->allocate())) {
+            looper.cancelImport();
+            return name + ": not enough loop memory to load " + job.path;
+        }
+        const uint32_t offset = position & LoopChunkPool::kChunkMask;
+        const uint32_t n = std::min(std::min(kBlockFrames, frames - position),
+                                    LoopChunkPool::kChunkFrames - offset);
+        in.read(reinterpret_cast<char*>(raw.data()), static_cast<std::streamsize>(n) * info.blockAlign);
+        const uint32_t got = static_cast<uint32_t>(in.gcount() / info.blockAlign);
+        for (uint32_t i = 0; i < got; ++i) {
+            const unsigned char* frame = raw.data() + static_cast<size_t>(i) * info.blockAlign;
+            left[i] = decodeWAVSample(frame, info);
+            right[i] = decodeWAVSample(frame + rightChannel, info);
+        }
+        if (half) {
+            LoopChunkPool::encodeHalf(left.data(), static_cast<uint16_t*>(chunk->left) + offset, got);
+            LoopChunkPool::encodeHalf(right.data(), static_cast<uint16_t*>(chunk->right) + offset, got);
+        } else {
+            std::copy(left.begin(), left.begin() + got, static_cast<float*>(chunk->left) + offset);
+            std::copy(right.begin(), right.begin() + got, static_cast<float*>(chunk->right) + offset);
+        }
+        position += got;
+        if (got < n) {
+            break;      // File shorter than its header says: keep what was read
+        }
+    }
+    if (position == 0) {
+        looper.cancelImport();
+        return name + ": " + job.path + " has no audio";
+    }
+
+    looper.commitImport(position);
+    return name + " loaded from " + job.path + " (" + seconds(position, job.sampleRate) +
+           (truncated ? ", cut to the loop limit" : "") + ")";
+}
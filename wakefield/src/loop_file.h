@@ -0,0 +1,65 @@
+#ifndef LOOP_FILE_H
+#define LOOP_FILE_H
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+
+class Looper;
+
+// Saves loops to WAV files and loads them back on a background I/O thread
+// (started with the first transfer), so the audio thread never waits on
+// the disk.
+//
+// Saving streams the loop's chunks while it keeps playing (see
+// Looper::requestExport); the file is written as 32-bit float stereo under
+// a temporary name and renamed when complete. Loading accepts 16/24/32-bit
+// PCM or 32-bit float, mono or stereo, at the engine's sample rate, reads
+// it into fresh pool chunks and stages them for the looper to swap in at
+// its next loop boundary.
+class LoopFileWorker {
+public:
+    LoopFileWorker() = default;
+    ~LoopFileWorker();
+
+    // Queue a transfer for loop number index (0-based, used in messages).
+    // Not on the audio thread
+    void save(Looper& looper, int index, const std::string& path, float sampleRate);
+    void load(Looper& looper, int index, const std::string& path, float sampleRate);
+
+    // One finished transfer's console message per call; false if none
+    bool pollMessage(std::string& message);
+
+    // Finish the queued transfers and stop the thread
+    void stop();
+
+    LoopFileWorker(const LoopFileWorker&) = delete;
+    LoopFileWorker& operator=(const LoopFileWorker&) = delete;
+
+private:
+    struct Job {
+        bool save;
+        Looper* looper;
+        int index;
+        std::string path;
+        float sampleRate;
+    };
+
+    void enqueue(Job job);
+    void worker();
+
+    std::string saveLoop(const Job& job);
+    std::string loadLoop(const Job& job);
+
+    std::mutex mutex;               // Guards jobs, messages and stopping
+    std::condition_variable wake;
+    std::deque<Job> jobs;
+    std::deque<std::string> messages;
+    bool stopping = false;
+    std::thread thread;
+};
+
+#endif // LOOP_FILE_H
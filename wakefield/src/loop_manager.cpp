@@ -1,91 +1,196 @@
 #include "loop_manager.h"
 #include <algorithm>
+#include <cmath>
 #include <cstring>
+#include <cstdlib>
+#include <pwd.h>
+#include <sys/stat.h>
+#include <unistd.h>
 
-LoopManager::LoopManager(float sampleRate) 
+namespace {
+
+// Loop length that fits the memory of MAX_LOOP_SECONDS of float storage
+uint32_t maxLoopFrames(float sampleRate, LoopChunkPool::Format format) {
+    const uint32_t scale = static_cast<uint32_t>(sizeof(float) / LoopChunkPool::bytesPerSample(format));
+    return static_cast<uint32_t>(MAX_LOOP_SECONDS * sampleRate) * scale;
+}
+
+size_t chunksPerLoop(uint32_t frames) {
+    return (frames + LoopChunkPool::kChunkMask) >> LoopChunkPool::kChunkShift;
+}
+
+// Free chunks kept ready: several seconds of recording on every loop at
+// once between two refills
+constexpr size_t kChunkLowWatermark = 8;
+
+// Room for one loop being loaded while the loop it replaces still plays
+constexpr size_t kImportLoops = 1;
+
+// Undo layers may hold as much again as the loops themselves
+constexpr size_t kUndoFactor = 2;
+
+}
+
+LoopManager::LoopManager(float sampleRate, LoopChunkPool::Format format, int loopCount)
     : sampleRate(sampleRate)
+    , maxFrames(maxLoopFrames(sampleRate, format))
+    , loopCount(std::clamp(loopCount, 1, MAX_LOOPS))
+    , chunkPool((this->loopCount * kUndoFactor + kImportLoops) * chunksPerLoop(maxFrames),
+                kChunkLowWatermark, format)
     , currentLoop(0)
 {
-    maxFrames = static_cast<uint32_t>(MAX_LOOP_SECONDS * sampleRate);
-    
-    // Allocate buffers for each loop
-    for (int i = 0; i < MAX_LOOPS; ++i) {
-        bufferL[i].resize(maxFrames, 0.0f);
-        bufferR[i].resize(maxFrames, 0.0f);
-        loopers[i].reset(bufferL[i].data(), bufferR[i].data(), maxFrames);
+    loopers.reserve(this->loopCount);
+    for (int i = 0; i < this->loopCount; ++i) {
+        loopers.emplace_back(new Looper());
+        loopers[i]->setActivity(&activeLoops, uint64_t(1) << i);
+        loopers[i]->reset(&chunkPool, maxFrames, &scratch);
     }
-    
-    // Allocate temp buffers for processing
-    tempL.resize(8192, 0.0f);  // Enough for typical buffer sizes
-    tempR.resize(8192, 0.0f);
 }
 
 LoopManager::~LoopManager() {
-    // Vectors auto-cleanup
+    // Finish any save or load before the loopers go
+    fileWorker.stop();
 }
 
 void LoopManager::selectLoop(int index) {
-    if (index >= 0 && index < MAX_LOOPS) {
+    if (index >= 0 && index < loopCount) {
         currentLoop.store(index);
     }
 }
 
 Looper* LoopManager::getCurrentLoop() {
     int index = currentLoop.load();
-    if (index >= 0 && index < MAX_LOOPS) {
-        return &loopers[index];
+    if (index >= 0 && index < loopCount) {
+        return loopers[index].get();
     }
     return nullptr;
 }
 
 Looper* LoopManager::getLoop(int index) {
-    if (index >= 0 && index < MAX_LOOPS) {
-        return &loopers[index];
+    if (index >= 0 && index < loopCount) {
+        return loopers[index].get();
     }
     return nullptr;
 }
 
-void LoopManager::processBlock(const float* inL, const float* inR, float* outL, float* outR, uint32_t nFrames) {
-    // Ensure temp buffers are large enough
-    if (nFrames > tempL.size()) {
-        tempL.resize(nFrames);
-        tempR.resize(nFrames);
-    }
-    
-    // Clear output buffers
-    std::fill(outL, outL + nFrames, 0.0f);
-    std::fill(outR, outR + nFrames, 0.0f);
-    
-    // Process each loop and sum outputs
-    for (int i = 0; i < MAX_LOOPS; ++i) {
-        // Process this loop
-        loopers[i].processBlock(inL, inR, tempL.data(), tempR.data(), nFrames);
-        
-        // Add to output (with soft limiting to prevent clipping)
-        for (uint32_t j = 0; j < nFrames; ++j) {
-            outL[j] = softLimit(outL[j] + tempL[j]);
-            outR[j] = softLimit(outR[j] + tempR[j]);
+void LoopManager::processBlock(const float* inL, const float* inR, float* outL, float* outR, uint32_t nFrames,
+                               const LoopGrid* grid) {
+    // The dry signal once, then each loop adds its own signal on top;
+    // empty and stopped loops add nothing
+    std::copy(inL, inL + nFrames, outL);
+    std::copy(inR, inR + nFrames, outR);
+    const StemTap* tap = stemTap.load(std::memory_order_acquire);
+    if (tap) {
+        processStems(*tap, inL, inR, outL, outR, nFrames, grid);
+    } else {
+        // Lowest index first, as the loops always summed
+        uint64_t active = activeLoops.load();
+        while (active) {
+            const int i = __builtin_ctzll(active);
+            active &= active - 1;
+            loopers[i]->mixBlock(inL, inR, outL, outR, nFrames, grid);
+            retireIfIdle(i);
         }
     }
+    // The sum is limited on its way to the device (OutputStage)
+}
+
+void LoopManager::warmUp(uint32_t nFrames, int blocks) {
+    for (const auto& looper : loopers) {
+        if (looper->getState() != Looper::Empty) {
+            return;
+        }
+    }
+    if (nFrames == 0 || blocks <= 0) {
+        return;
+    }
+    std::vector<float> toneL(nFrames);
+    std::vector<float> toneR(nFrames);
+    std::vector<float> outL(nFrames);
+    std::vector<float> outR(nFrames);
+    for (uint32_t j = 0; j < nFrames; ++j) {
+        toneL[j] = 0.25f * std::sin(6.2831853f * 220.0f * static_cast<float>(j) / sampleRate);
+        toneR[j] = toneL[j];
+    }
+    std::memset(&scratch, 0, sizeof(scratch));
+    std::fill(stemLeft, stemLeft + kStemFrames, 0.0f);
+    std::fill(stemRight, stemRight + kStemFrames, 0.0f);
+
+    // Record a third, play a third, overdub a third
+    Looper& looper = *loopers[0];
+    looper.pressRecPlay();
+    for (int block = 0; block < blocks; ++block) {
+        if (block == blocks / 3) {
+            looper.pressRecPlay();
+        } else if (block == 2 * blocks / 3) {
+            looper.pressOverdub();
+        }
+        processBlock(toneL.data(), toneR.data(), outL.data(), outR.data(), nFrames);
+    }
+
+    looper.reset(&chunkPool, maxFrames, &scratch);
+    activeLoops.store(0);
+}
+
+void LoopManager::processStems(const StemTap& tap, const float* inL, const float* inR, float* outL, float* outR,
+                               uint32_t nFrames, const LoopGrid* grid) {
+    // Stem-sized pieces, the grid moved along with them so pressed changes
+    // land on the same frame as without the tap
+    for (uint32_t pos = 0; pos < nFrames; pos += kStemFrames) {
+        const uint32_t frames = std::min(kStemFrames, nFrames - pos);
+        LoopGrid pieceGrid;
+        if (grid) {
+            pieceGrid = *grid;
+            pieceGrid.position += pos;
+        }
+        const uint64_t active = activeLoops.load();
+        for (int i = 0; i < loopCount; ++i) {
+            std::fill(stemLeft, stemLeft + frames, 0.0f);
+            std::fill(stemRight, stemRight + frames, 0.0f);
+            if (active & (uint64_t(1) << i)) {
+                loopers[i]->mixBlock(inL + pos, inR + pos, stemLeft, stemRight, frames,
+                                     grid ? &pieceGrid : nullptr);
+                retireIfIdle(i);
+                for (uint32_t j = 0; j < frames; ++j) {
+                    outL[pos + j] += stemLeft[j];
+                    outR[pos + j] += stemRight[j];
+                }
+            }
+            tap.write(tap.context, i, stemLeft, stemRight, frames);
+        }
+    }
+}
+
+void LoopManager::retireIfIdle(int index) {
+    // Cleared, then checked again: a request landing in between either
+    // is seen here or sets the bit again after the clear (Looper::wake)
+    if (!loopers[index]->isIdle()) {
+        return;
+    }
+    const uint64_t bit = uint64_t(1) << index;
+    activeLoops.fetch_and(~bit);
+    if (!loopers[index]->isIdle()) {
+        activeLoops.fetch_or(bit);
+    }
 }
 
 Looper::State LoopManager::getLoopState(int index) const {
-    if (index >= 0 && index < MAX_LOOPS) {
-        return loopers[index].getState();
+    if (index >= 0 && index < loopCount) {
+        return loopers[index]->getState();
     }
     return Looper::Empty;
 }
 
 float LoopManager::getLoopLength(int index) const {
-    if (index >= 0 && index < MAX_LOOPS) {
-        return loopers[index].getLoopLengthSeconds(sampleRate);
+    if (index >= 0 && index < loopCount) {
+        return loopers[index]->getLoopLengthSeconds(sampleRate);
     }
     return 0.0f;
 }
 
 float LoopManager::getLoopTime(int index) const {
-    if (index >= 0 && index < MAX_LOOPS) {
-        return loopers[index].getCurrentTimeSeconds(sampleRate);
+    if (index >= 0 && index < loopCount) {
+        return loopers[index]->getCurrentTimeSeconds(sampleRate);
     }
     return 0.0f;
 }
@@ -100,9 +205,39 @@ void LoopManager::setOverdubMix(float wet) {
 
 float LoopManager::getOverdubMix() const {
     int index = currentLoop.load();
-    if (index >= 0 && index < MAX_LOOPS) {
-        return loopers[index].getOverdubWet();
+    if (index >= 0 && index < loopCount) {
+        return loopers[index]->getOverdubWet();
     }
     return 0.6f;
 }
 
+bool LoopManager::saveLoop(int index, const std::string& path) {
+    if (index < 0 || index >= loopCount) {
+        return false;
+    }
+    fileWorker.save(*loopers[index], index, path, sampleRate);
+    return true;
+}
+
+bool LoopManager::loadLoop(int index, const std::string& path) {
+    if (index < 0 || index >= loopCount) {
+        return false;
+    }
+    fileWorker.load(*loopers[index], index, path, sampleRate);
+    return true;
+}
+
+std::string LoopManager::getLoopFilePath(int index) {
+    const char* homeDir = getenv("HOME");
+    if (!homeDir) {
+        struct passwd* pw = getpwuid(getuid());
+        homeDir = pw->pw_dir;
+    }
+    std::string directory = std::string(homeDir) + "/.config";
+    mkdir(directory.c_str(), 0755);
+    directory += "/wakefield";
+    mkdir(directory.c_str(), 0755);
+    directory += "/loops";
+    mkdir(directory.c_str(), 0755);
+    return directory + "/loop" + std::to_string(index + 1) + ".wav";
+}
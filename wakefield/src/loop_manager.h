@@ -1,18 +1,35 @@
 #ifndef LOOP_MANAGER_H
 #define LOOP_MANAGER_H
 
-#include <vector>
+#include <algorithm>
+#include <cmath>
 #include <cstdint>
 #include <atomic>
+#include <memory>
+#include <string>
+#include <vector>
 #include "looper.h"
+#include "loop_chunk_pool.h"
+#include "loop_file.h"
 
-constexpr int MAX_LOOPS = 4;
-constexpr int MAX_LOOP_SECONDS = 120;
+constexpr int DEFAULT_LOOPS = 4;
+constexpr int MAX_LOOPS = 64;           // One bit each in the active set
+constexpr int MAX_LOOP_SECONDS = 120;   // With float storage; half storage doubles it
 
 class LoopManager {
 public:
-    LoopManager(float sampleRate);
+    // Float16 storage halves the memory per second, so loops may run twice
+    // as long within the same pool size. loopCount (1 to MAX_LOOPS) only
+    // sets how many loopers exist: an idle one holds no chunks and no span
+    // buffers, and the mix pass skips it
+    LoopManager(float sampleRate, LoopChunkPool::Format format = LoopChunkPool::Format::Float32,
+                int loopCount = DEFAULT_LOOPS);
     ~LoopManager();
+
+    int getLoopCount() const { return loopCount; }
+    // Loops the mix pass visits: recording, playing or overdubbing, or
+    // with a request to answer
+    int getActiveLoopCount() const { return __builtin_popcountll(activeLoops.load(std::memory_order_relaxed)); }
     
     // Loop selection
     void selectLoop(int index);
@@ -20,9 +37,19 @@ public:
     Looper* getCurrentLoop();
     Looper* getLoop(int index);
     
-    // Process all loops (sum outputs)
-    void processBlock(const float* inL, const float* inR, float* outL, float* outR, uint32_t nFrames);
+    // Input plus every playing loop, unlimited (OutputStage limits it on
+    // the way to the device); the output must not
+    // alias the input. Only loops in the active set are visited. With a grid, loop changes wait for its next line
+    // (see Looper::mixBlock)
+    void processBlock(const float* inL, const float* inR, float* outL, float* outR, uint32_t nFrames,
+                      const LoopGrid* grid = nullptr);
     
+    // Before the stream starts: record, play and overdub a test tone on the
+    // first loop for blocks of nFrames, then empty it again, so the mix
+    // path and the span buffers are warm for the first live block. Does
+    // nothing once a loop holds audio. Call only while no callback runs
+    void warmUp(uint32_t nFrames, int blocks);
+
     // Get loop state for UI
     Looper::State getLoopState(int index) const;
     float getLoopLength(int index) const;
@@ -31,35 +58,69 @@ public:
     // Global parameters
     void setOverdubMix(float wet);
     float getOverdubMix() const;
+
+    // Not on the audio thread (UI loop, offline render loop): allocate
+    // looper chunks when the free list runs low
+    void refillStorage() { chunkPool.refill(); }
+    const LoopChunkPool& getChunkPool() const { return chunkPool; }
+    LoopChunkPool::Format getStorageFormat() const { return chunkPool.getFormat(); }
+    float getMaxLoopSeconds() const { return maxFrames / sampleRate; }
+
+    // Save a loop to a WAV file, or load one into it, on the loop I/O
+    // thread; the audio thread never waits. The loop keeps playing while it
+    // is saved. A loaded loop replaces the old one at its next loop
+    // boundary, or at once if it is empty or stopped. Each transfer ends
+    // with a message for pollFileMessage. Not on the audio thread
+    bool saveLoop(int index, const std::string& path);
+    bool loadLoop(int index, const std::string& path);
+    bool pollFileMessage(std::string& message) { return fileWorker.pollMessage(message); }
+
+    // ~/.config/wakefield/loops/loop<index + 1>.wav (creates the directory)
+    static std::string getLoopFilePath(int index);
+
+    // Each loop's own signal (before the limiter), handed out from
+    // processBlock in order, at most kStemFrames at a time, for stem
+    // recording (silence for idle loops). While a tap is set every active
+    // loop mixes into a scratch buffer first. Set and cleared between blocks (stream stopped, or from the
+    // thread that calls processBlock); nullptr turns it off
+    static constexpr uint32_t kStemFrames = 1024;
+    struct StemTap {
+        void (*write)(void* context, int loop, const float* left, const float* right, uint32_t frames);
+        void* context;
+    };
+    void setStemTap(const StemTap* tap) { stemTap.store(tap, std::memory_order_release); }
     
 private:
     float sampleRate;
     uint32_t maxFrames;
+    int loopCount;
     
-    // Loop instances
-    Looper loopers[MAX_LOOPS];
-    
-    // Buffer storage (pre-allocated)
-    std::vector<float> bufferL[MAX_LOOPS];
-    std::vector<float> bufferR[MAX_LOOPS];
-    
-    // Temp buffers for processing
-    std::vector<float> tempL;
-    std::vector<float> tempR;
+    // Loop storage, taken chunk by chunk while recording. Declared before
+    // the loopers so it outlives them (they return their chunks on destruction)
+    LoopChunkPool chunkPool;
+
+    // Loop instances, and the span buffers they take turns with
+    std::vector<std::unique_ptr<Looper>> loopers;
+    Looper::Scratch scratch;
+
+    // Bit i: loopers[i] is mixed. Requests set bits from any thread
+    // (Looper::wake), the audio thread clears them (retireIfIdle)
+    std::atomic<uint64_t> activeLoops{0};
+
+    // Declared after the loopers so its thread is joined before they go
+    LoopFileWorker fileWorker;
     
     // Current loop selection
     std::atomic<int> currentLoop;
-    
-    // Apply soft limiting to prevent clipping
-    inline float softLimit(float x) {
-        // Soft knee limiter
-        if (x > 0.8f) {
-            return 0.8f + (x - 0.8f) * 0.2f;
-        } else if (x < -0.8f) {
-            return -0.8f + (x + 0.8f) * 0.2f;
-        }
-        return x;
-    }
+
+    // Stem recording
+    std::atomic<const StemTap*> stemTap{nullptr};
+    float stemLeft[kStemFrames];
+    float stemRight[kStemFrames];
+
+    void retireIfIdle(int index);
+    void processStems(const StemTap& tap, const float* inL, const float* inR, float* outL, float* outR,
+                      uint32_t nFrames, const LoopGrid* grid);
 };
 
 #endif // LOOP_MANAGER_H
@@ -3,36 +3,104 @@
 #include <cstdint>
 #include <algorithm>
 #include <atomic>
+#include <cstring>
+#include <memory>
+#include <vector>
+#include "interpolation.h"
+#include "loop_chunk_pool.h"
+
+// Where quantized looper changes may land in the block about to run: on
+// the transport's beat or bar lines, the first frame of line k being
+// ceil(k * period) as for Clock::collectStepTriggers
+struct LoopGrid {
+    uint64_t position = 0;   // Transport sample of the block's first frame
+    double period = 0.0;     // Samples between lines
+
+    // Offset of the first line at or after the block start, n if none
+    // falls inside the block
+    uint32_t nextLine(uint32_t n) const {
+        if (period <= 0.0) {
+            return 0;
+        }
+        uint64_t line = static_cast<uint64_t>(position / period);
+        uint64_t at = static_cast<uint64_t>(std::ceil(line * period));
+        if (at < position) {
+            at = static_cast<uint64_t>(std::ceil(++line * period));
+        }
+        return at - position < n ? static_cast<uint32_t>(at - position) : n;
+    }
+};
 
 class Looper {
 public:
     enum State { Empty, Recording, Playing, Overdubbing, Stopped };
+    struct Scratch;
 
     Looper() 
-        : L(nullptr)
-        , R(nullptr)
+        : pool(nullptr)
+        , compact(false)
         , maxFrames(0)
         , loopLen(0)
         , w(0)
-        , r(0)
+        , readPhase(0)
+        , speed(1.0f)
+        , increment(kUnityIncrement)
         , state(Empty)
         , overdubWet(0.6f)
         , xfade(256)
         , armed(false)
+        , requestedSpeed(1.0f)
         , stateChangeRequested(false)
         , nextState(Empty)
+        , scratch(nullptr)
+        , activity(nullptr)
+        , activityBit(0)
+        , exportState(ExportIdle)
+        , exportFrames(0)
+        , importState(ImportIdle)
+        , importFrames(0)
+        , undoBase(0)
+        , undoCount(0)
+        , redoCount(0)
+        , historyRequest(0)
+        , revision(0)
     {}
 
-    void reset(float* bufL, float* bufR, uint32_t frames) {
-        L = bufL; 
-        R = bufR; 
+    ~Looper() {
+        releaseChunks();
+        clearHistory();
+    }
+
+    // Storage comes from chunkPool as the loop records, up to frames long.
+    // Span buffers come from sharedScratch, or the loop allocates its own.
+    // Not on the audio thread, nor during a file transfer: sizes the chunk
+    // tables
+    void reset(LoopChunkPool* chunkPool, uint32_t frames, Scratch* sharedScratch = nullptr) {
+        releaseChunks();
+        clearHistory();
+        if (!sharedScratch && !ownScratch) {
+            ownScratch.reset(new Scratch());
+        }
+        scratch = sharedScratch ? sharedScratch : ownScratch.get();
+        pool = chunkPool;
+        compact = chunkPool && chunkPool->getFormat() == LoopChunkPool::Format::Float16;
         maxFrames = frames;
-        loopLen = w = r = 0; 
+        const size_t tableSize = (frames + LoopChunkPool::kChunkMask) >> LoopChunkPool::kChunkShift;
+        chunks.assign(tableSize, nullptr);
+        exportChunks.assign(tableSize, nullptr);
+        importChunks.assign(tableSize, nullptr);
+        for (int i = 0; i < kUndoLevels; ++i) {
+            undoTables[i].assign(tableSize, nullptr);
+            redoTables[i].assign(tableSize, nullptr);
+        }
+        exportState.store(ExportIdle);
+        importState.store(ImportIdle);
+        historyRequest.store(0);
+        loopLen = w = 0;
+        readPhase = 0;
         state = Empty; 
         armed = false;
         stateChangeRequested.store(false);
-        std::fill(L, L + maxFrames, 0.0f);
-        std::fill(R, R + maxFrames, 0.0f);
     }
 
     // UI actions (thread-safe via atomics)
@@ -68,18 +136,78 @@ public:
         requestStateChange(Empty);
     }
 
+    // Step back to before the last overdub pass (or load), or forward
+    // again. Applied at the next block, ending an overdub in progress
+    void pressUndo() { historyRequest.fetch_add(1); wake(); }
+    void pressRedo() { historyRequest.fetch_sub(1); wake(); }
+
+    // A pressed change is waiting for its beat or bar line
+    bool isChangePending() const { return stateChangeRequested.load(); }
+    // The state a pending change goes to
+    State getPendingState() const { return nextState; }
+    // Ask for a state directly, as a recorded press did (session replay)
+    void requestState(State newState) { requestStateChange(newState); }
+
+    // Bumped by the audio thread whenever the loop's audio may have changed
+    // (a pass recorded, an overdub ended, undo, redo, a load, a clear), so
+    // a saver can skip loops it already wrote. An overdub in progress
+    // changes the audio without bumping it
+    uint32_t getRevision() const { return revision.load(std::memory_order_relaxed); }
+
+    int getUndoCount() const { return undoCount; }
+    int getRedoCount() const { return redoCount; }
+
     void setOverdubWet(float wet) {
         overdubWet = std::clamp(wet, 0.0f, 1.0f);
     }
 
     float getOverdubWet() const { return overdubWet; }
 
+    // Playback speed: 1 is as recorded, 0.5 half speed (an octave down,
+    // the loop lasting twice as many beats), 2 double, negative reverse;
+    // the magnitude is held to kMinSpeed..kMaxSpeed. Taken up like a press:
+    // at the next block, or on the grid line when quantized, so a loop cut
+    // to the beat stays on it. Off unity the loop is resampled through the
+    // shared Hermite kernel, or the band-limited sinc above unity speed.
+    // Overdubbing always runs at unity speed forward
+    static constexpr float kMinSpeed = 0.25f;
+    static constexpr float kMaxSpeed = 2.0f;
+
+    void setSpeed(float newSpeed) {
+        const float magnitude = std::clamp(std::fabs(newSpeed), kMinSpeed, kMaxSpeed);
+        requestedSpeed.store(newSpeed < 0.0f ? -magnitude : magnitude, std::memory_order_relaxed);
+        wake();
+    }
+    float getSpeed() const { return requestedSpeed.load(std::memory_order_relaxed); }
+
+    // Frames decoded per span when the pool stores half floats
+    static constexpr uint32_t kSpanFrames = 256;
+    // Loop frames a varispeed span reads: kSpanFrames at the top speed
+    // plus the sinc kernel's taps on either side
+    static constexpr uint32_t kVarispeedFrames =
+        kSpanFrames * static_cast<uint32_t>(kMaxSpeed) + 2 * interp::kSincHalfTaps + 1;
+
+    // Span buffers, only used inside mixBlock. Loops that run one after
+    // the other on one thread may share a set (LoopManager does), so an
+    // idle loop costs its struct and chunk tables and no sample memory
+    struct Scratch {
+        float spanL[kSpanFrames];               // Decoded half-float samples of the current span
+        float spanR[kSpanFrames];
+        float sourceL[kVarispeedFrames];        // Varispeed: the loop frames under a span,
+        float sourceR[kVarispeedFrames];
+        float resampledL[kSpanFrames];          // then the resampled span
+        float resampledR[kSpanFrames];
+    };
+
     State getState() const { return state; }
     
     uint32_t getLoopLength() const { return loopLen; }
     uint32_t getWritePosition() const { return w; }
-    uint32_t getReadPosition() const { return r; }
+    uint32_t getReadPosition() const { return static_cast<uint32_t>(readPhase >> 32); }
     
+    uint32_t getMaxFrames() const { return maxFrames; }
+    LoopChunkPool* getPool() const { return pool; }
+
     float getLoopLengthSeconds(float sampleRate) const {
         return loopLen / sampleRate;
     }
@@ -88,74 +216,223 @@ public:
         if (state == Recording) {
             return w / sampleRate;
         } else if (state == Playing || state == Overdubbing) {
-            return r / sampleRate;
+            return getReadPosition() / sampleRate;
         }
         return 0.0f;
     }
 
-    // Process interleaved stereo input/output
-    void processBlock(const float* inL, const float* inR, float* outL, float* outR, uint32_t n) {
-        // Check for state change requests
-        if (stateChangeRequested.load()) {
-            applyStateChange();
+    // File transfers (LoopFileWorker thread)
+    //
+    // Export: requestExport(), then wait for the audio thread to answer.
+    // ExportReady: the loop's chunk table and length have been captured at
+    // a block boundary; read every chunk of getExportFrames() with
+    // getExportChunk(), calling finishExportChunk() on each, then
+    // endExport(). The loop keeps playing meanwhile: the export holds a
+    // reference to each chunk, so one the loop writes into is copied
+    // first and the export keeps the original. ExportRefused (empty or
+    // recording loop) or a timeout: endExport() straight away
+    enum ExportStatus { ExportIdle, ExportPending, ExportReady, ExportRefused };
+
+    bool requestExport() {
+        int expected = ExportIdle;
+        if (!exportState.compare_exchange_strong(expected, ExportPending)) {
+            return false;
+        }
+        wake();
+        return true;
+    }
+
+    ExportStatus getExportStatus() const {
+        return static_cast<ExportStatus>(exportState.load(std::memory_order_acquire));
+    }
+
+    // Give up on a request the audio thread has not answered (stream
+    // stopped). False if it was answered after all
+    bool cancelExportRequest() {
+        int expected = ExportPending;
+        return exportState.compare_exchange_strong(expected, ExportIdle);
+    }
+
+    uint32_t getExportFrames() const { return exportFrames; }
+    const LoopChunkPool::Chunk* getExportChunk(size_t index) const { return exportChunks[index]; }
+
+    void finishExportChunk(size_t index) {
+        pool->release(exportChunks[index]);
+        exportChunks[index] = nullptr;
+    }
+
+    void endExport() { exportState.store(ExportIdle, std::memory_order_release); }
+
+    // Import: beginImport() lends out the staging table (nullptr while an
+    // import is already staged); fill it with chunks from
+    // LoopChunkPool::allocate(), then commitImport() or cancelImport(). The
+    // audio thread swaps the new chunks in at the next loop boundary, or at
+    // once if the loop is empty or stopped, and the loop then plays
+    std::vector<LoopChunkPool::Chunk*>* beginImport() {
+        int expected = ImportIdle;
+        if (!importState.compare_exchange_strong(expected, ImportFilling)) {
+            return nullptr;
         }
+        return &importChunks;
+    }
 
-        if (state == Empty) {
-            // Pass through
-            for (uint32_t i = 0; i < n; ++i) { 
-                outL[i] = inL[i]; 
-                outR[i] = inR[i]; 
+    void commitImport(uint32_t frames) {
+        importFrames = frames;
+        importState.store(ImportReady, std::memory_order_release);
+        wake();
+    }
+
+    void cancelImport() {
+        for (LoopChunkPool::Chunk*& chunk : importChunks) {
+            if (chunk) {
+                pool->release(chunk);
+                chunk = nullptr;
             }
-            return;
         }
+        importState.store(ImportIdle, std::memory_order_release);
+    }
 
-        switch (state) {
-            case Recording:
-                processRecording(inL, inR, outL, outR, n);
-                break;
+    bool isImportPending() const {
+        return importState.load(std::memory_order_acquire) != ImportIdle;
+    }
 
-            case Playing:
-                processPlaying(inL, inR, outL, outR, n);
-                break;
+    // A LoopManager mixes only the loops in its active set: bit of
+    // activeSet, set whenever a request comes in. Before reset()
+    void setActivity(std::atomic<uint64_t>* activeSet, uint64_t bit) {
+        activity = activeSet;
+        activityBit = bit;
+    }
 
-            case Overdubbing:
-                processOverdubbing(inL, inR, outL, outR, n);
-                break;
+    // Audio thread: mixBlock would add nothing and has nothing to answer
+    // (empty or stopped, no request waiting), so the loop may leave the
+    // active set until the next request
+    bool isIdle() const {
+        return (state == Empty || state == Stopped) && !stateChangeRequested.load() &&
+               requestedSpeed.load(std::memory_order_relaxed) == speed &&
+               historyRequest.load() == 0 &&
+               exportState.load() != ExportPending && importState.load() != ImportReady;
+    }
 
-            case Stopped:
-                // Pass input through, loop is stopped
-                for (uint32_t i = 0; i < n; ++i) { 
-                    outL[i] = inL[i]; 
-                    outR[i] = inR[i]; 
-                }
-                break;
+    // Process planar stereo: the input passes through with the loop on top
+    void processBlock(const float* inL, const float* inR, float* outL, float* outR, uint32_t n) {
+        std::copy(inL, inL + n, outL);
+        std::copy(inR, inR + n, outR);
+        mixBlock(inL, inR, outL, outR, n);
+    }
 
-            default:
-                break;
+    // Record from the input and add the loop's own signal (no dry input)
+    // into accL/accR, which must not alias the input. An empty, stopped or
+    // recording loop adds nothing and only handles its pending requests.
+    // With a grid, a pressed change other than clear waits for the next
+    // line and takes effect on that frame, so a loop recorded from line to
+    // line is a whole number of beats or bars long
+    void mixBlock(const float* inL, const float* inR, float* accL, float* accR, uint32_t n,
+                  const LoopGrid* grid = nullptr) {
+        // Check for state and speed change requests: now, or where the
+        // block splits
+        uint32_t split = n;
+        const bool stateChange = stateChangeRequested.load();
+        const bool speedChange = requestedSpeed.load(std::memory_order_relaxed) != speed;
+        if (stateChange || speedChange) {
+            split = (grid && !(stateChange && nextState == Empty)) ? grid->nextLine(n) : 0;
+            if (split == 0) {
+                applyPendingChanges();
+                split = n;
+            }
+        }
+
+        // File transfers: capture an export, adopt an import if nothing
+        // is playing (otherwise at the next wrap)
+        if (exportState.load(std::memory_order_acquire) == ExportPending) {
+            captureExport();
+        }
+        if ((state == Empty || state == Stopped) &&
+            importState.load(std::memory_order_acquire) == ImportReady) {
+            adoptImport();
+            state = Playing;
+        }
+        if (historyRequest.load(std::memory_order_relaxed) != 0) {
+            applyHistoryRequest();
+        }
+
+        processSpan(inL, inR, accL, accR, split);
+        if (split < n) {
+            applyPendingChanges();
+            processSpan(inL + split, inR + split, accL + split, accR + split, n - split);
         }
     }
 
 private:
-    float* L;          // external storage
-    float* R;
+    static constexpr int64_t kUnityIncrement = int64_t(1) << 32;
+
+    LoopChunkPool* pool;
+    std::vector<LoopChunkPool::Chunk*> chunks;  // Frame f lives in chunks[f >> kChunkShift]
+    bool compact;          // chunks hold half floats (LoopChunkPool::Format::Float16)
     uint32_t maxFrames;
     uint32_t loopLen;      // valid frames [0, loopLen)
     uint32_t w;            // write head
-    uint32_t r;            // read head
+    uint64_t readPhase;    // read head, Q32.32 frames
+    float speed;           // applied playback speed
+    int64_t increment;     // read head step per output frame, Q32.32
     State state;
 
     // params
     float overdubWet;      // 0..1 amount of new input mixed in while overdubbing
     uint32_t xfade;        // wrap/punch crossfade length in samples
     bool armed;
+    std::atomic<float> requestedSpeed;
 
     // Thread-safe state change
     std::atomic<bool> stateChangeRequested;
     State nextState;
 
+    // Span buffers: shared by every loop of a LoopManager, or the loop's own
+    Scratch* scratch;
+    std::unique_ptr<Scratch> ownScratch;
+
+    // Active set of the LoopManager, woken by every request
+    std::atomic<uint64_t>* activity;
+    uint64_t activityBit;
+
+    // Export snapshot: the captured chunk table, one reference per chunk
+    std::vector<LoopChunkPool::Chunk*> exportChunks;
+    std::atomic<int> exportState;
+    uint32_t exportFrames;
+
+    // Import staging table, swapped with chunks on adoption
+    enum ImportStatus { ImportIdle, ImportFilling, ImportReady };
+    std::vector<LoopChunkPool::Chunk*> importChunks;
+    std::atomic<int> importState;
+    uint32_t importFrames;
+
+    // Undo history: the chunk table and length from before each overdub
+    // pass or load, oldest first in a ring, and the states undone since.
+    // Layers share every chunk a pass did not touch, so a layer costs the
+    // chunks it overdubbed. Unused tables are all nullptr and every table
+    // has the size of chunks, so undo and redo are vector swaps
+    static constexpr int kUndoLevels = 8;
+    std::vector<LoopChunkPool::Chunk*> undoTables[kUndoLevels];
+    uint32_t undoLengths[kUndoLevels];
+    int undoBase;
+    int undoCount;
+    std::vector<LoopChunkPool::Chunk*> redoTables[kUndoLevels];
+    uint32_t redoLengths[kUndoLevels];
+    int redoCount;
+    std::atomic<int> historyRequest;   // Undo steps asked for, negative for redo
+    std::atomic<uint32_t> revision;
+
     void requestStateChange(State newState) {
         nextState = newState;
         stateChangeRequested.store(true);
+        wake();
+    }
+
+    // Back into the owner's active set after a request (seq_cst, after the
+    // request itself: see LoopManager::retireIfIdle)
+    void wake() {
+        if (activity) {
+            activity->fetch_or(activityBit);
+        }
     }
 
     void applyStateChange() {
@@ -163,110 +440,474 @@ private:
         
         if (targetState == Playing && state == Recording) {
             finalizeFirstPass();
-            r = 0;
+            readPhase = 0;
         } else if (targetState == Empty) {
-            loopLen = w = r = 0;
+            loopLen = w = 0;
+            readPhase = 0;
+            releaseChunks();
+            clearHistory();
+        } else if (targetState == Overdubbing && state == Playing && loopLen > 0) {
+            pushUndoLayer();
         } else if (targetState == Recording && state == Empty) {
             w = 0;
         }
         
         state = targetState;
         stateChangeRequested.store(false);
+        revision.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void applyPendingChanges() {
+        if (stateChangeRequested.load()) {
+            applyStateChange();
+        }
+        speed = requestedSpeed.load(std::memory_order_relaxed);
+        increment = static_cast<int64_t>(std::llround(static_cast<double>(speed) * kUnityIncrement));
+        if (increment == kUnityIncrement) {
+            // Back on the frame grid for the copying path
+            readPhase = (readPhase + (uint64_t(1) << 31)) & ~uint64_t(0xFFFFFFFF);
+            if ((readPhase >> 32) >= loopLen) {
+                readPhase = 0;
+            }
+        }
+    }
+
+    // Frames from frame to the next chunk boundary, loop end or span
+    // limit, whichever is closest
+    inline uint32_t runLength(uint32_t frame, uint32_t end, uint32_t limit) const {
+        uint32_t chunkLeft = LoopChunkPool::kChunkFrames - (frame & LoopChunkPool::kChunkMask);
+        return std::min(std::min(limit, end - frame), chunkLeft);
+    }
+
+    // n frames from frame on (one chunk) as float: pointers into the chunk
+    // for float storage, decoded into the span buffers for half. A span
+    // that must not be written through is copied for float storage as well
+    inline void loadSpan(uint32_t frame, uint32_t n, float*& left, float*& right,
+                         bool writable = true) {
+        LoopChunkPool::Chunk* chunk = chunks[frame >> LoopChunkPool::kChunkShift];
+        uint32_t offset = frame & LoopChunkPool::kChunkMask;
+        if (!compact) {
+            left = static_cast<float*>(chunk->left) + offset;
+            right = static_cast<float*>(chunk->right) + offset;
+            if (!writable) {
+                std::copy(left, left + n, scratch->spanL);
+                std::copy(right, right + n, scratch->spanR);
+                left = scratch->spanL;
+                right = scratch->spanR;
+            }
+            return;
+        }
+        LoopChunkPool::decodeHalf(static_cast<const uint16_t*>(chunk->left) + offset, scratch->spanL, n);
+        LoopChunkPool::decodeHalf(static_cast<const uint16_t*>(chunk->right) + offset, scratch->spanR, n);
+        left = scratch->spanL;
+        right = scratch->spanR;
+    }
+
+    // Write n frames from frame on (one chunk) in the storage format
+    inline void storeSpan(uint32_t frame, const float* left, const float* right, uint32_t n) {
+        LoopChunkPool::Chunk* chunk = chunks[frame >> LoopChunkPool::kChunkShift];
+        uint32_t offset = frame & LoopChunkPool::kChunkMask;
+        if (!compact) {
+            std::copy(left, left + n, static_cast<float*>(chunk->left) + offset);
+            std::copy(right, right + n, static_cast<float*>(chunk->right) + offset);
+            return;
+        }
+        LoopChunkPool::encodeHalf(left, static_cast<uint16_t*>(chunk->left) + offset, n);
+        LoopChunkPool::encodeHalf(right, static_cast<uint16_t*>(chunk->right) + offset, n);
+    }
+
+    // Wrap/punch crossfade gain at a loop position
+    inline float crossfadeGain(uint32_t pos) const {
+        if (pos < xfade) {
+            return float(pos) / float(xfade);  // fade-in at start
+        }
+        if (loopLen - pos < xfade) {
+            return float(loopLen - pos) / float(xfade);  // fade-out near end
+        }
+        return 1.0f;
+    }
+
+    // Drop the loop's reference to every chunk (clear, reset, destruction)
+    void releaseChunks() {
+        releaseTable(chunks);
+    }
+
+    void releaseTable(std::vector<LoopChunkPool::Chunk*>& table) {
+        for (LoopChunkPool::Chunk*& chunk : table) {
+            if (chunk) {
+                pool->release(chunk);
+                chunk = nullptr;
+            }
+        }
+    }
+
+    // A chunk from the pool; when it is dry, the oldest undo layers give
+    // their chunks back first
+    inline LoopChunkPool::Chunk* acquireChunk() {
+        LoopChunkPool::Chunk* chunk = pool->acquire();
+        while (!chunk && undoCount > 0) {
+            dropOldestUndo();
+            chunk = pool->acquire();
+        }
+        return chunk;
+    }
+
+    // Copy-on-write before writing into the chunk holding frame: a chunk an
+    // undo layer or a save also holds is copied, and the loop moves to the
+    // copy. False if the pool has no chunk for the copy: the write must be
+    // dropped
+    inline bool prepareWrite(uint32_t frame) {
+        const size_t c = frame >> LoopChunkPool::kChunkShift;
+        LoopChunkPool::Chunk* chunk = chunks[c];
+        if (!LoopChunkPool::isShared(chunk)) {
+            return true;
+        }
+        LoopChunkPool::Chunk* copy = acquireChunk();
+        if (!copy) {
+            return false;
+        }
+        if (!LoopChunkPool::isShared(chunk)) {
+            pool->release(copy);    // Dropping undo layers freed it up
+            return true;
+        }
+        const size_t channelBytes = pool->getChunkBytes() / 2;
+        std::memcpy(copy->left, chunk->left, channelBytes);
+        std::memcpy(copy->right, chunk->right, channelBytes);
+        pool->release(chunk);
+        chunks[c] = copy;
+        return true;
+    }
+
+    // Audio thread, block start: answer a pending export request
+    void captureExport() {
+        if (loopLen == 0 || state == Recording || state == Empty) {
+            int expected = ExportPending;
+            exportState.compare_exchange_strong(expected, ExportRefused, std::memory_order_acq_rel);
+            return;
+        }
+        const size_t count = (loopLen + LoopChunkPool::kChunkMask) >> LoopChunkPool::kChunkShift;
+        for (size_t c = 0; c < count; ++c) {
+            exportChunks[c] = chunks[c];
+            LoopChunkPool::retain(chunks[c]);
+        }
+        exportFrames = loopLen;
+        int expected = ExportPending;
+        if (!exportState.compare_exchange_strong(expected, ExportReady, std::memory_order_acq_rel)) {
+            // Cancelled meanwhile
+            releaseTable(exportChunks);
+        }
+    }
+
+    // Keep the current table as an undo layer: the loop and the layer now
+    // share every chunk (a pointer copy, no sample data). Clears redo
+    void pushUndoLayer() {
+        clearRedo();
+        if (undoCount == kUndoLevels) {
+            dropOldestUndo();
+        }
+        const int slot = (undoBase + undoCount) % kUndoLevels;
+        std::vector<LoopChunkPool::Chunk*>& layer = undoTables[slot];
+        for (size_t c = 0; c < chunks.size(); ++c) {
+            layer[c] = chunks[c];
+            if (chunks[c]) {
+                LoopChunkPool::retain(chunks[c]);
+            }
+        }
+        undoLengths[slot] = loopLen;
+        ++undoCount;
+    }
+
+    void dropOldestUndo() {
+        releaseTable(undoTables[undoBase]);
+        undoBase = (undoBase + 1) % kUndoLevels;
+        --undoCount;
+    }
+
+    void clearRedo() {
+        while (redoCount > 0) {
+            releaseTable(redoTables[--redoCount]);
+        }
+    }
+
+    void clearHistory() {
+        while (undoCount > 0) {
+            dropOldestUndo();
+        }
+        clearRedo();
+        undoBase = 0;
+    }
+
+    // Audio thread, block start: undo or redo by swapping chunk tables
+    void applyHistoryRequest() {
+        int steps = historyRequest.exchange(0);
+        if (state == Recording || state == Empty) {
+            return;
+        }
+        if (state == Overdubbing) {
+            state = Playing;
+        }
+        for (; steps > 0 && undoCount > 0; --steps) {
+            const int slot = (undoBase + undoCount - 1) % kUndoLevels;
+            redoTables[redoCount].swap(chunks);
+            redoLengths[redoCount++] = loopLen;
+            chunks.swap(undoTables[slot]);
+            loopLen = undoLengths[slot];
+            --undoCount;
+        }
+        for (; steps < 0 && redoCount > 0; ++steps) {
+            const int slot = (undoBase + undoCount) % kUndoLevels;
+            undoTables[slot].swap(chunks);
+            undoLengths[slot] = loopLen;
+            ++undoCount;
+            chunks.swap(redoTables[--redoCount]);
+            loopLen = redoLengths[redoCount];
+        }
+        w = loopLen;
+        if (getReadPosition() >= loopLen) {
+            readPhase = 0;
+        }
+        revision.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    // Audio thread: swap the staged import in for the current loop, which
+    // becomes an undo layer
+    void adoptImport() {
+        if (loopLen > 0) {
+            clearRedo();
+            if (undoCount == kUndoLevels) {
+                dropOldestUndo();
+            }
+            const int slot = (undoBase + undoCount) % kUndoLevels;
+            undoTables[slot].swap(chunks);
+            undoLengths[slot] = loopLen;
+            ++undoCount;
+        } else {
+            releaseChunks();
+        }
+        chunks.swap(importChunks);
+        loopLen = w = importFrames;
+        readPhase = 0;
+        importState.store(ImportIdle, std::memory_order_release);
+        revision.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    // Recording reached a chunk boundary: make sure the chunk exists
+    inline bool ensureChunk(uint32_t frame) {
+        LoopChunkPool::Chunk*& chunk = chunks[frame >> LoopChunkPool::kChunkShift];
+        if (!chunk && pool) {
+            chunk = acquireChunk();
+        }
+        return chunk != nullptr;
     }
 
     inline void finalizeFirstPass() {
         loopLen = std::min(w, maxFrames);
-        if (loopLen == 0) loopLen = 1;
+        if (loopLen == 0 && !chunks.empty() && chunks[0]) {
+            // Recycled chunks hold old audio: a one-frame loop must be silent
+            const float silence = 0.0f;
+            if (prepareWrite(0)) {
+                storeSpan(0, &silence, &silence, 1);
+            }
+            loopLen = 1;
+        }
     }
 
-    void processRecording(const float* inL, const float* inR, float* outL, float* outR, uint32_t n) {
-        for (uint32_t i = 0; i < n; ++i) {
-            if (w >= maxFrames) { 
+    void processSpan(const float* inL, const float* inR, float* accL, float* accR, uint32_t n) {
+        switch (state) {
+            case Recording:
+                processRecording(inL, inR, n);
+                break;
+
+            case Playing:
+                processPlaying(accL, accR, n);
+                break;
+
+            case Overdubbing:
+                processOverdubbing(inL, inR, accL, accR, n);
+                break;
+
+            default:
+                // Empty or stopped: nothing to add
+                break;
+        }
+    }
+
+    void processRecording(const float* inL, const float* inR, uint32_t n) {
+        uint32_t i = 0;
+        while (i < n) {
+            // Out of length or out of pooled chunks: close the loop here
+            if (w >= maxFrames ||
+                ((w & LoopChunkPool::kChunkMask) == 0 && !ensureChunk(w))) { 
                 finalizeFirstPass(); 
                 state = Playing; 
-                r = 0; 
+                readPhase = 0;
+                revision.fetch_add(1, std::memory_order_relaxed);
                 break; 
             }
-            L[w] = inL[i]; 
-            R[w] = inR[i];
-            outL[i] = inL[i]; 
-            outR[i] = inR[i]; // thru while recording
-            ++w;
+            uint32_t len = runLength(w, maxFrames, n - i);
+            if (prepareWrite(w)) {
+                storeSpan(w, inL + i, inR + i, len);
+            }
+            w += len;
+            i += len;
         }
     }
 
-    void processPlaying(const float* inL, const float* inR, float* outL, float* outR, uint32_t n) {
+    void processPlaying(float* accL, float* accR, uint32_t n) {
         if (loopLen == 0) {
-            for (uint32_t i = 0; i < n; ++i) { 
-                outL[i] = inL[i]; 
-                outR[i] = inR[i]; 
-            }
             return;
         }
+        if (increment != kUnityIncrement) {
+            processVarispeed(accL, accR, n);
+            return;
+        }
+
+        uint32_t r = getReadPosition();
+        uint32_t i = 0;
+        while (i < n) {
+            // Read from loop, one chunk-contiguous span at a time
+            uint32_t len = runLength(r, loopLen, std::min(n - i, kSpanFrames));
+            float* sL;
+            float* sR;
+            loadSpan(r, len, sL, sR);
+
+            for (uint32_t k = 0; k < len; ++k) {
+                // Crossfade at wrap points
+                float xmul = crossfadeGain(r + k);
+
+                accL[i + k] += sL[k] * xmul;
+                accR[i + k] += sR[k] * xmul;
+            }
 
-        for (uint32_t i = 0; i < n; ++i) {
-            // Read from loop
-            uint32_t ri = r;
-            float sL = L[ri];
-            float sR = R[ri];
-            
-            if (++r >= loopLen) r = 0;
+            r += len;
+            if (r >= loopLen) {
+                r = 0;
+                if (importState.load(std::memory_order_acquire) == ImportReady) {
+                    adoptImport();
+                }
+            }
+            i += len;
+        }
+        readPhase = uint64_t(r) << 32;
+    }
 
-            // Crossfade at wrap points
-            uint32_t pos = (r == 0) ? loopLen - 1 : r - 1;
-            float xmul = 1.0f;
-            if (pos < xfade) {
-                xmul = float(pos) / float(xfade);  // fade-in at start
+    // Loop frames first .. first + count - 1 (wrapping around the loop, in
+    // either direction) into the scratch sourceL/R
+    void gatherFrames(int64_t first, uint32_t count) {
+        int64_t start = first % static_cast<int64_t>(loopLen);
+        uint32_t frame = static_cast<uint32_t>(start < 0 ? start + loopLen : start);
+        uint32_t done = 0;
+        while (done < count) {
+            const uint32_t len = runLength(frame, loopLen, std::min(count - done, kSpanFrames));
+            float* sL;
+            float* sR;
+            loadSpan(frame, len, sL, sR);
+            std::copy(sL, sL + len, scratch->sourceL + done);
+            std::copy(sR, sR + len, scratch->sourceR + done);
+            done += len;
+            frame += len;
+            if (frame >= loopLen) {
+                frame = 0;
             }
-            else if (loopLen - pos < xfade) {
-                xmul = float(loopLen - pos) / float(xfade);  // fade-out near end
+        }
+    }
+
+    // Playback off unity speed: per span, gather the loop frames the read
+    // head passes over, resample them in one kernel pass per channel, then
+    // apply the wrap crossfade at each read position
+    void processVarispeed(float* accL, float* accR, uint32_t n) {
+        const bool sinc = std::abs(increment) > kUnityIncrement;
+        uint32_t i = 0;
+        while (i < n) {
+            const int64_t loopPhase = static_cast<int64_t>(loopLen) << 32;    // An import may change it
+            const uint32_t len = std::min(n - i, kSpanFrames);
+            const int64_t start = static_cast<int64_t>(readPhase);
+            const int64_t last = start + increment * (len - 1);
+            const int64_t first = (std::min(start, last) >> 32) - (interp::kSincHalfTaps - 1);
+            const uint32_t count = static_cast<uint32_t>((std::max(start, last) >> 32) - first) +
+                                   interp::kSincHalfTaps + 1;
+            gatherFrames(first, count);
+            const uint64_t phase = static_cast<uint64_t>(start - first * kUnityIncrement);
+            interp::interpolateBlock(scratch->sourceL, phase, increment, scratch->resampledL, len, sinc);
+            interp::interpolateBlock(scratch->sourceR, phase, increment, scratch->resampledR, len, sinc);
+
+            int64_t position = start;
+            for (uint32_t k = 0; k < len; ++k) {
+                int64_t frame = (position >> 32) % static_cast<int64_t>(loopLen);
+                if (frame < 0) {
+                    frame += loopLen;
+                }
+                const float xmul = crossfadeGain(static_cast<uint32_t>(frame));
+                accL[i + k] += scratch->resampledL[k] * xmul;
+                accR[i + k] += scratch->resampledR[k] * xmul;
+                position += increment;
             }
-            
-            sL *= xmul; 
-            sR *= xmul;
 
-            // Mix with input (input passes through)
-            outL[i] = sL + inL[i];
-            outR[i] = sR + inR[i];
+            // Past either end of the loop: wrap, and take up a staged import
+            int64_t next = start + increment * len;
+            const bool wrapped = next < 0 || next >= loopPhase;
+            next %= loopPhase;
+            readPhase = static_cast<uint64_t>(next < 0 ? next + loopPhase : next);
+            if (wrapped && importState.load(std::memory_order_acquire) == ImportReady) {
+                adoptImport();
+            }
+            i += len;
         }
     }
 
-    void processOverdubbing(const float* inL, const float* inR, float* outL, float* outR, uint32_t n) {
+    void processOverdubbing(const float* inL, const float* inR, float* accL, float* accR, uint32_t n) {
         if (loopLen == 0) { 
             state = Recording; 
             w = 0; 
-            processRecording(inL, inR, outL, outR, n); 
+            processRecording(inL, inR, n); 
             return; 
         }
 
-        for (uint32_t i = 0; i < n; ++i) {
-            // Read existing
-            float curL = L[r];
-            float curR = R[r];
-            
-            // Mix input into buffer
-            float newL = curL * (1.0f - overdubWet) + inL[i] * overdubWet;
-            float newR = curR * (1.0f - overdubWet) + inR[i] * overdubWet;
-            
-            // Crossfade at wrap
-            uint32_t pos = r;
-            float xmul = 1.0f;
-            if (pos < xfade) {
-                xmul = float(pos) / float(xfade);
+        uint32_t r = getReadPosition();
+        uint32_t i = 0;
+        while (i < n) {
+            uint32_t len = runLength(r, loopLen, std::min(n - i, kSpanFrames));
+            const bool writable = prepareWrite(r);
+            float* sL;
+            float* sR;
+            loadSpan(r, len, sL, sR, writable);
+
+            for (uint32_t k = 0; k < len; ++k) {
+                // Read existing
+                float curL = sL[k];
+                float curR = sR[k];
+
+                // Mix input into buffer
+                float newL = curL * (1.0f - overdubWet) + inL[i + k] * overdubWet;
+                float newR = curR * (1.0f - overdubWet) + inR[i + k] * overdubWet;
+
+                // Crossfade at wrap
+                float xmul = crossfadeGain(r + k);
+
+                sL[k] = newL;
+                sR[k] = newR;
+
+                // Output is the new mixed signal (the input passes through
+                // the caller's accumulator)
+                accL[i + k] += (curL * (1.0f - overdubWet) + newL * overdubWet) * xmul;
+                accR[i + k] += (curR * (1.0f - overdubWet) + newR * overdubWet) * xmul;
             }
-            else if (loopLen - pos < xfade) {
-                xmul = float(loopLen - pos) / float(xfade);
+
+            // Float spans point into the chunk and are already written
+            if (compact && writable) {
+                storeSpan(r, sL, sR, len);
             }
-            
-            L[r] = newL;
-            R[r] = newR;
-            
-            // Output is the new mixed signal plus input pass-through
-            outL[i] = (curL * (1.0f - overdubWet) + newL * overdubWet) * xmul + inL[i];
-            outR[i] = (curR * (1.0f - overdubWet) + newR * overdubWet) * xmul + inR[i];
 
-            if (++r >= loopLen) r = 0;
+            r += len;
+            if (r >= loopLen) {
+                r = 0;
+                if (importState.load(std::memory_order_acquire) == ImportReady) {
+                    adoptImport();
+                }
+            }
+            i += len;
         }
+        readPhase = uint64_t(r) << 32;
     }
 };
 
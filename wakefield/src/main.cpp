@@ -6,27 +6,107 @@
 #include <unistd.h>
 #include <locale.h>
 #include <cmath>
+#include <cstring>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
 #include <sys/stat.h>
 #include <pwd.h>
 #include "synth.h"
 #include "midi.h"
+#include "event_schedule.h"
+#include "midi_file.h"
 #include "ui.h"
 #include "preset.h"
 #include "loop_manager.h"
 #include "parameter_smoother.h"
 #include "sequencer.h"
+#include "automation.h"
 #include "clock.h"
+#include "rt_check.h"
+#include "denormal_guard.h"
+#include "profile.h"
+#include "effects_pipeline.h"
+#include "rt_setup.h"
+#include "cc_dispatch.h"
+#include "midi_clock.h"
+#include "osc_server.h"
+#include "metrics_exporter.h"
+#include "memory_stats.h"
+#include "rt_log.h"
+#include "session_capture.h"
+#include "output_recorder.h"
+#include "session_autosave.h"
+#include "session_file.h"
+#include "startup.h"
+#include "shm_bridge.h"
+#include "part_rack.h"
+#include "latency_probe.h"
+#include "output_stage.h"
+#include "rng.h"
+#ifdef WAKEFIELD_JACK
+#include "jack_output.h"
+#endif
+#ifdef WAKEFIELD_ALSA_MMAP
+#include "alsa_output.h"
+#endif
 
 // Global instances
 static Synth* synth = nullptr;
+static PartRack* partRack = nullptr;  // --part: engines on other MIDI channels
 static MidiHandler* midiHandler = nullptr;
 static SynthParameters* synthParams = nullptr;
-static UI* ui = nullptr;
+static UI* ui = nullptr;                    // Null with --headless
+// The DSP load meter and quality governor: the UI's, or with --headless
+// ones main owns
+static CPUMonitor* loadMonitor = nullptr;
+static QualityGovernor* qualityGovernor = nullptr;
 LoopManager* loopManager = nullptr;  // Non-static so UI can access it
 Sequencer* sequencer = nullptr;  // Non-static so UI can access it
 static Clock* transportClock = nullptr;
 static bool running = true;
 
+// MIDI clock: --midi-clock-in slaves the transport to incoming clock,
+// --midi-clock-out sends the transport's clock
+static bool midiClockIn = false;
+static MidiClockSync midiClockSync;
+static MidiClockOutput* midiClockOutput = nullptr;
+
+// OSC remote control (--osc-port)
+static OscServer* oscServer = nullptr;
+static ShmBridge* shmBridge = nullptr;  // --shm: out-of-process UIs
+
+// Metrics export (--metrics-port, --statsd)
+static MetricsExporter* metricsExporter = nullptr;
+
+// Audio callback diagnostics, drained to ~/.config/wakefield/wakefield.log
+// and the UI console
+static RtLog rtLog;
+
+// --capture logs what the callback acts on; --replay plays a log back
+// offline in its place (session_capture.h)
+static SessionCapture* sessionCapture = nullptr;
+static SessionReplay* sessionReplay = nullptr;
+
+// --measure-latency: the callback plays the probe and records its input
+static LatencyProbe* latencyProbe = nullptr;
+
+// Master output (and loop stem) recording: --record, or E on the looper page
+static OutputRecorder* outputRecorder = nullptr;
+
+// Last --measure-latency result, kept in device_config.txt. It holds for
+// the device, rate and buffer size it was measured with
+struct MeasuredLatency {
+    int audioDevice = -1;
+    unsigned int sampleRate = 0;
+    unsigned int bufferFrames = 0;
+    unsigned int roundTripFrames = 0;   // 0: never measured
+    unsigned int bufferingFrames = 0;   // Of those, the stream's own buffers
+};
+static MeasuredLatency measuredLatency;
+
 void signalHandler(int signum) {
     running = false;
 }
@@ -41,8 +121,48 @@ std::string getConfigDirectory() {
     return std::string(homeDir) + "/.config/wakefield";
 }
 
-// Read device config
-void readDeviceConfig(int& audioDeviceId, int& midiPort) {
+// Helper to get (and create) the preconverted sample cache directory
+std::string getSampleCacheDirectory() {
+    std::string cacheBase;
+    const char* xdgCache = getenv("XDG_CACHE_HOME");
+    if (xdgCache && xdgCache[0] != '\0') {
+        cacheBase = xdgCache;
+    } else {
+        const char* homeDir = getenv("HOME");
+        if (!homeDir) {
+            struct passwd* pw = getpwuid(getuid());
+            homeDir = pw->pw_dir;
+        }
+        cacheBase = std::string(homeDir) + "/.cache";
+    }
+    mkdir(cacheBase.c_str(), 0755);
+    mkdir((cacheBase + "/wakefield").c_str(), 0755);
+    std::string cacheDir = cacheBase + "/wakefield/samples";
+    mkdir(cacheDir.c_str(), 0755);
+    return cacheDir;
+}
+
+// --memory-budget value, and memory_budget_ lines of the device config
+// without the prefix: subsystem=MB (memory_stats.h), 0 for no budget
+static bool parseMemoryBudget(const char* spec) {
+    const char* equals = std::strchr(spec, '=');
+    if (!equals) {
+        return false;
+    }
+    const int subsystem = memstats::findSubsystem(std::string(spec, equals).c_str());
+    char* end = nullptr;
+    const double megabytes = std::strtod(equals + 1, &end);
+    if (subsystem < 0 || end == equals + 1 || *end != '\0' || megabytes < 0.0) {
+        return false;
+    }
+    memstats::setBudget(subsystem, static_cast<uint64_t>(megabytes * 1024.0 * 1024.0));
+    return true;
+}
+
+// Read device config (absent entries keep their defaults)
+void readDeviceConfig(int& audioDeviceId, int& midiPort,
+                      unsigned int& sampleRate, unsigned int& bufferFrames,
+                      rtsetup::Options& realtime) {
     std::string configPath = getConfigDirectory() + "/device_config.txt";
     std::ifstream file(configPath);
     
@@ -53,6 +173,32 @@ void readDeviceConfig(int& audioDeviceId, int& midiPort) {
                 audioDeviceId = std::stoi(line.substr(13));
             } else if (line.find("midi_port=") == 0) {
                 midiPort = std::stoi(line.substr(10));
+            } else if (line.find("sample_rate=") == 0) {
+                sampleRate = static_cast<unsigned int>(std::stoul(line.substr(12)));
+            } else if (line.find("buffer_frames=") == 0) {
+                bufferFrames = static_cast<unsigned int>(std::stoul(line.substr(14)));
+            } else if (line.find("realtime=") == 0) {
+                realtime.realtime = std::stoi(line.substr(9)) != 0;
+            } else if (line.find("rt_priority=") == 0) {
+                realtime.priority = std::stoi(line.substr(12));
+            } else if (line.find("audio_cpu=") == 0) {
+                realtime.audioCpu = std::stoi(line.substr(10));
+            } else if (line.find("ui_cpu=") == 0) {
+                realtime.uiCpu = std::stoi(line.substr(7));
+            } else if (line.find("mlock=") == 0) {
+                realtime.lockMemory = std::stoi(line.substr(6)) != 0;
+            } else if (line.find("latency_device=") == 0) {
+                measuredLatency.audioDevice = std::stoi(line.substr(15));
+            } else if (line.find("latency_rate=") == 0) {
+                measuredLatency.sampleRate = static_cast<unsigned int>(std::stoul(line.substr(13)));
+            } else if (line.find("latency_buffer=") == 0) {
+                measuredLatency.bufferFrames = static_cast<unsigned int>(std::stoul(line.substr(15)));
+            } else if (line.find("latency_frames=") == 0) {
+                measuredLatency.roundTripFrames = static_cast<unsigned int>(std::stoul(line.substr(15)));
+            } else if (line.find("latency_buffering=") == 0) {
+                measuredLatency.bufferingFrames = static_cast<unsigned int>(std::stoul(line.substr(18)));
+            } else if (line.find("memory_budget_") == 0 && !parseMemoryBudget(line.c_str() + 14)) {
+                std::cerr << "Ignoring device config line: " << line << "\n";
             }
         }
         file.close();
@@ -60,7 +206,9 @@ void readDeviceConfig(int& audioDeviceId, int& midiPort) {
 }
 
 // Write device config
-void writeDeviceConfig(int audioDeviceId, int midiPort) {
+void writeDeviceConfig(int audioDeviceId, int midiPort,
+                       unsigned int sampleRate, unsigned int bufferFrames,
+                       const rtsetup::Options& realtime) {
     std::string configDir = getConfigDirectory();
     mkdir(configDir.c_str(), 0755);
     
@@ -70,17 +218,39 @@ void writeDeviceConfig(int audioDeviceId, int midiPort) {
     if (file.is_open()) {
         file << "audio_device=" << audioDeviceId << "\n";
         file << "midi_port=" << midiPort << "\n";
+        file << "sample_rate=" << sampleRate << "\n";
+        file << "buffer_frames=" << bufferFrames << "\n";
+        file << "realtime=" << (realtime.realtime ? 1 : 0) << "\n";
+        file << "rt_priority=" << realtime.priority << "\n";
+        file << "audio_cpu=" << realtime.audioCpu << "\n";
+        file << "ui_cpu=" << realtime.uiCpu << "\n";
+        file << "mlock=" << (realtime.lockMemory ? 1 : 0) << "\n";
+        if (measuredLatency.roundTripFrames > 0) {
+            file << "latency_device=" << measuredLatency.audioDevice << "\n";
+            file << "latency_rate=" << measuredLatency.sampleRate << "\n";
+            file << "latency_buffer=" << measuredLatency.bufferFrames << "\n";
+            file << "latency_frames=" << measuredLatency.roundTripFrames << "\n";
+            file << "latency_buffering=" << measuredLatency.bufferingFrames << "\n";
+        }
+        for (int i = 0; i < memstats::SUBSYSTEM_COUNT; ++i) {
+            if (const uint64_t budget = memstats::getBudget(i)) {
+                file << "memory_budget_" << memstats::subsystemName(i) << "="
+                     << static_cast<double>(budget) / (1024.0 * 1024.0) << "\n";
+            }
+        }
         file.close();
     }
 }
 
 // Restart app with new devices
-void restartWithNewDevices(int audioDeviceId, int midiPort, SynthParameters* params, char** argv) {
+void restartWithNewDevices(int audioDeviceId, int midiPort, unsigned int sampleRate,
+                           unsigned int bufferFrames, const rtsetup::Options& realtime,
+                           SynthParameters* params, char** argv) {
     // Save current state as temp preset
     PresetManager::savePreset("__temp_restart__", params);
     
     // Write new device config
-    writeDeviceConfig(audioDeviceId, midiPort);
+    writeDeviceConfig(audioDeviceId, midiPort, sampleRate, bufferFrames, realtime);
     
     // Restart the application
     execv(argv[0], argv);
@@ -89,10 +259,54 @@ void restartWithNewDevices(int audioDeviceId, int midiPort, SynthParameters* par
     std::cerr << "Failed to restart application\n";
 }
 
-// Helper function to map MIDI CC value (0-127) to parameter range
-float mapCCToParameter(int ccValue, float minVal, float maxVal, bool logarithmic = false) {
-    float normalized = ccValue / 127.0f;  // 0.0 to 1.0
+// Rate to build the engine at: the requested one if the device lists it,
+// otherwise the device's preferred rate, so the stream runs at the rate
+// every module was constructed with
+unsigned int resolveSampleRate(RtAudio& audio, int deviceId, unsigned int requested) {
+    if (deviceId < 0) {
+        return requested;
+    }
+    try {
+        RtAudio::DeviceInfo info = audio.getDeviceInfo(static_cast<unsigned int>(deviceId));
+        if (info.sampleRates.empty() ||
+            std::find(info.sampleRates.begin(), info.sampleRates.end(), requested) != info.sampleRates.end()) {
+            return requested;
+        }
+        if (info.preferredSampleRate > 0) {
+            return info.preferredSampleRate;
+        }
+    } catch (...) {
+    }
+    return requested;
+}
+
+// Format to open the stream in: float where the device takes it natively,
+// else its widest native integer format, so the driver converts nothing
+// (an S16 USB interface then moves half the bytes of a float stream)
+static SampleFormat resolveSampleFormat(RtAudio& audio, unsigned int deviceId) {
+    try {
+        const RtAudioFormat native = audio.getDeviceInfo(deviceId).nativeFormats;
+        if (native & RTAUDIO_FLOAT32) return SampleFormat::FLOAT32;
+        if (native & RTAUDIO_SINT32) return SampleFormat::SINT32;
+        if (native & RTAUDIO_SINT24) return SampleFormat::SINT24;
+        if (native & RTAUDIO_SINT16) return SampleFormat::SINT16;
+    } catch (...) {
+    }
+    return SampleFormat::FLOAT32;
+}
+
+static RtAudioFormat rtAudioFormat(SampleFormat format) {
+    switch (format) {
+        case SampleFormat::SINT32: return RTAUDIO_SINT32;
+        case SampleFormat::SINT24: return RTAUDIO_SINT24;
+        case SampleFormat::SINT16: return RTAUDIO_SINT16;
+        case SampleFormat::FLOAT32: break;
+    }
+    return RTAUDIO_FLOAT32;
+}
 
+// Helper function to map a 0-1 control value to parameter range
+float mapNormalizedToParameter(float normalized, float minVal, float maxVal, bool logarithmic = false) {
     if (logarithmic) {
         // Logarithmic mapping (for frequency-like parameters)
         float logMin = std::log(minVal);
@@ -104,122 +318,128 @@ float mapCCToParameter(int ccValue, float minVal, float maxVal, bool logarithmic
     }
 }
 
-// Helper function to apply MIDI CC to a parameter
-void applyMIDICCToParameter(int paramId, int ccValue) {
+// Helper function to apply a 0-1 control value (MIDI CC / 127, OSC) to a parameter
+void applyNormalizedToParameter(int paramId, float normalized) {
     if (!synthParams) return;
 
     switch (paramId) {
         // Global parameters
         case 1:  // Waveform (ENUM 0-3)
-            synthParams->waveform = static_cast<int>(mapCCToParameter(ccValue, 0, 3));
+            synthParams->waveform = static_cast<int>(mapNormalizedToParameter(normalized, 0, 3));
             break;
         case 2:  // Attack (exponential)
             {
-                float mapped = mapCCToParameter(ccValue, 0.001f, 30.0f, true);
+                float mapped = mapNormalizedToParameter(normalized, 0.001f, 30.0f, true);
                 synthParams->attack = mapped;
                 synthParams->setEnvAttack(0, mapped);
             }
             break;
         case 3:  // Decay (exponential)
             {
-                float mapped = mapCCToParameter(ccValue, 0.001f, 30.0f, true);
+                float mapped = mapNormalizedToParameter(normalized, 0.001f, 30.0f, true);
                 synthParams->decay = mapped;
                 synthParams->setEnvDecay(0, mapped);
             }
             break;
         case 4:  // Sustain (linear)
             {
-                float mapped = mapCCToParameter(ccValue, 0.0f, 1.0f);
+                float mapped = mapNormalizedToParameter(normalized, 0.0f, 1.0f);
                 synthParams->sustain = mapped;
                 synthParams->setEnvSustain(0, mapped);
             }
             break;
         case 5:  // Release (exponential)
             {
-                float mapped = mapCCToParameter(ccValue, 0.001f, 30.0f, true);
+                float mapped = mapNormalizedToParameter(normalized, 0.001f, 30.0f, true);
                 synthParams->release = mapped;
                 synthParams->setEnvRelease(0, mapped);
             }
             break;
         case 6:  // Master Volume (linear)
-            synthParams->masterVolume = mapCCToParameter(ccValue, 0.0f, 1.0f);
+            synthParams->masterVolume = mapNormalizedToParameter(normalized, 0.0f, 1.0f);
             break;
 
         // OSCILLATOR page parameters (Oscillator 1 for now)
         case 10:  // Mode (ENUM 0-1)
-            synthParams->osc1Mode = static_cast<int>(mapCCToParameter(ccValue, 0, 1));
+            synthParams->osc1Mode = static_cast<int>(mapNormalizedToParameter(normalized, 0, 1));
             break;
         case 11:  // Frequency (logarithmic)
-            synthParams->osc1Freq = mapCCToParameter(ccValue, 20.0f, 2000.0f, true);
+            synthParams->osc1Freq = mapNormalizedToParameter(normalized, 20.0f, 2000.0f, true);
             break;
         case 12:  // Morph (linear)
-            synthParams->osc1Morph = mapCCToParameter(ccValue, 0.0001f, 0.9999f);
+            synthParams->osc1Morph = mapNormalizedToParameter(normalized, 0.0001f, 0.9999f);
             break;
         case 13:  // Duty (linear)
-            synthParams->osc1Duty = mapCCToParameter(ccValue, 0.0f, 1.0f);
+            synthParams->osc1Duty = mapNormalizedToParameter(normalized, 0.0f, 1.0f);
             break;
         case 14:  // Ratio (logarithmic, 0.125-16.0)
-            synthParams->osc1Ratio = mapCCToParameter(ccValue, 0.125f, 16.0f, true);
+            synthParams->osc1Ratio = mapNormalizedToParameter(normalized, 0.125f, 16.0f, true);
             break;
         case 15:  // Offset (linear, -1000 to 1000 Hz)
-            synthParams->osc1Offset = mapCCToParameter(ccValue, -1000.0f, 1000.0f);
+            synthParams->osc1Offset = mapNormalizedToParameter(normalized, -1000.0f, 1000.0f);
             break;
         // REVERB page parameters
-        case 20:  // Reverb Type (ENUM 0-4)
-            synthParams->reverbType = static_cast<int>(mapCCToParameter(ccValue, 0, 4));
+        case 20:  // Reverb Type (ENUM 0-5)
+            synthParams->reverbType = static_cast<int>(mapNormalizedToParameter(normalized, 0, 6));
             break;
         case 21:  // Reverb Enabled (BOOL)
-            synthParams->reverbEnabled = (ccValue > 63);
+            synthParams->reverbEnabled = (normalized > 0.5f);
             break;
         case 22:  // Delay Time (linear)
-            synthParams->reverbDelayTime = mapCCToParameter(ccValue, 0.0f, 1.0f);
+            synthParams->reverbDelayTime = mapNormalizedToParameter(normalized, 0.0f, 1.0f);
             break;
         case 23:  // Size (linear)
-            synthParams->reverbSize = mapCCToParameter(ccValue, 0.0f, 1.0f);
+            synthParams->reverbSize = mapNormalizedToParameter(normalized, 0.0f, 1.0f);
             break;
         case 24:  // Damping (linear)
-            synthParams->reverbDamping = mapCCToParameter(ccValue, 0.0f, 0.99f);
+            synthParams->reverbDamping = mapNormalizedToParameter(normalized, 0.0f, 0.99f);
             break;
         case 25:  // Mix (linear)
-            synthParams->reverbMix = mapCCToParameter(ccValue, 0.0f, 1.0f);
+            synthParams->reverbMix = mapNormalizedToParameter(normalized, 0.0f, 1.0f);
             break;
         case 26:  // Decay (linear)
-            synthParams->reverbDecay = mapCCToParameter(ccValue, 0.0f, 1.0f);
+            synthParams->reverbDecay = mapNormalizedToParameter(normalized, 0.0f, 1.0f);
             break;
         case 27:  // Diffusion (linear)
-            synthParams->reverbDiffusion = mapCCToParameter(ccValue, 0.0f, 0.99f);
+            synthParams->reverbDiffusion = mapNormalizedToParameter(normalized, 0.0f, 0.99f);
             break;
         case 28:  // Mod Depth (linear)
-            synthParams->reverbModDepth = mapCCToParameter(ccValue, 0.0f, 1.0f);
+            synthParams->reverbModDepth = mapNormalizedToParameter(normalized, 0.0f, 1.0f);
             break;
         case 29:  // Mod Freq (linear)
-            synthParams->reverbModFreq = mapCCToParameter(ccValue, 0.0f, 10.0f);
+            synthParams->reverbModFreq = mapNormalizedToParameter(normalized, 0.0f, 10.0f);
             break;
 
         // FILTER page parameters
         case 30:  // Filter Type (ENUM 0-3)
-            synthParams->filterType = static_cast<int>(mapCCToParameter(ccValue, 0, 3));
+            synthParams->filterType = static_cast<int>(mapNormalizedToParameter(normalized, 0, 3));
             break;
         case 31:  // Filter Enabled (BOOL)
-            synthParams->filterEnabled = (ccValue > 63);
+            synthParams->filterEnabled = (normalized > 0.5f);
             break;
         case 32:  // Cutoff (logarithmic)
-            synthParams->filterCutoff = mapCCToParameter(ccValue, 20.0f, 20000.0f, true);
+            synthParams->filterCutoff = mapNormalizedToParameter(normalized, 20.0f, 20000.0f, true);
             break;
         case 33:  // Gain (linear)
-            synthParams->filterGain = mapCCToParameter(ccValue, -24.0f, 24.0f);
+            synthParams->filterGain = mapNormalizedToParameter(normalized, -24.0f, 24.0f);
             break;
 
         // LOOPER page parameters
-        case 40:  // Current Loop (INT 0-3)
-            synthParams->currentLoop = static_cast<int>(mapCCToParameter(ccValue, 0, 3));
+        case 40:  // Current Loop (INT 0 to loop count - 1)
+            synthParams->currentLoop = static_cast<int>(mapNormalizedToParameter(
+                normalized, 0, loopManager ? loopManager->getLoopCount() - 1 : DEFAULT_LOOPS - 1));
             break;
         case 41:  // Overdub Mix (linear)
-            synthParams->overdubMix = mapCCToParameter(ccValue, 0.0f, 1.0f);
+            synthParams->overdubMix = mapNormalizedToParameter(normalized, 0.0f, 1.0f);
             break;
     }
 }
 
+// Helper function to apply MIDI CC to a parameter
+void applyMIDICCToParameter(int paramId, int ccValue) {
+    applyNormalizedToParameter(paramId, ccValue / 127.0f);
+}
+
 // Callbacks for MIDI events
 void onNoteOn(int note, int velocity) {
     if (synth) {
@@ -233,6 +453,100 @@ void onNoteOff(int note) {
     }
 }
 
+// MIDI learn happens on the audio thread; the console message is formatted by
+// the UI loop. Targets: 0-49 parameter IDs, then the legacy/looper targets below.
+constexpr int kLearnTargetFilterCutoff = 100;
+constexpr int kLearnTargetLoopBase = 200;
+
+static void reportLearnedCC(int controller, int target) {
+    rtLog.post(RtLog::Event::CC_LEARNED, controller, target);
+}
+
+// A console message: the UI's console, or stdout with --headless
+static void consoleMessage(const std::string& message) {
+    if (ui) {
+        ui->addConsoleMessage(message);
+    } else {
+        std::cout << message << std::endl;
+    }
+}
+
+// A transport or loop button from OSC or an out-of-process UI
+static void runButtonCommand(OscServer::Command command) {
+    Looper* loop = loopManager ? loopManager->getCurrentLoop() : nullptr;
+    switch (command) {
+        case OscServer::Command::PLAY: if (sequencer) sequencer->play(); break;
+        case OscServer::Command::STOP: if (sequencer) sequencer->stop(); break;
+        case OscServer::Command::RESET: if (sequencer) sequencer->reset(); break;
+        case OscServer::Command::LOOP_REC_PLAY: if (loop) loop->pressRecPlay(); break;
+        case OscServer::Command::LOOP_OVERDUB: if (loop) loop->pressOverdub(); break;
+        case OscServer::Command::LOOP_STOP: if (loop) loop->pressStop(); break;
+        case OscServer::Command::LOOP_CLEAR: if (loop) loop->pressClear(); break;
+    }
+}
+
+// The synth's voices with the parts' added at this offset into the
+// buffer, through the one filter and reverb
+static void renderSynthSegment(float* left, float* right, unsigned int offset, unsigned int nFrames) {
+    if (!partRack) {
+        synth->process(left, right, nFrames);
+        return;
+    }
+    synth->renderVoices(left, right, nFrames);
+    partRack->addMix(left, right, offset, nFrames);
+    synth->processEffects(left, right, nFrames, synth->takeEffectSettings());
+}
+
+// Console messages for what the audio thread logged; a run of underflows
+// becomes one message
+static void postRtLogMessages() {
+    static const char* const loopTargets[] = {"Loop Rec/Play", "Loop Overdub", "Loop Stop", "Loop Clear"};
+    unsigned int underflows = 0;
+    RtLog::Record record;
+    while (rtLog.pollRecord(record)) {
+        switch (record.event) {
+            case RtLog::Event::STREAM_UNDERFLOW:
+                ++underflows;
+                break;
+            case RtLog::Event::CC_LEARNED: {
+                const int target = record.b;
+                std::string name;
+                if (target >= kLearnTargetLoopBase && target < kLearnTargetLoopBase + 4) {
+                    name = loopTargets[target - kLearnTargetLoopBase];
+                } else if (target == kLearnTargetFilterCutoff) {
+                    name = "Filter Cutoff";
+                } else {
+                    name = ui ? ui->getParameterName(target) : "parameter " + std::to_string(target);
+                }
+                consoleMessage("Learned CC#" + std::to_string(record.a) + " for " + name);
+                break;
+            }
+            default:
+                consoleMessage(RtLog::describe(record));
+                break;
+        }
+    }
+    if (underflows > 0) {
+        consoleMessage("Stream underflow detected (" + std::to_string(underflows) + "x)");
+    }
+}
+
+// Collect every CC mapping into table, in the order the if-chain it
+// replaces handled them
+static void rebuildCCDispatch(CCDispatchTable& table) {
+    table.clear();
+    for (int paramId = 0; paramId < 50; ++paramId) {
+        table.add(synthParams->parameterCCMap[paramId].load(),
+                  CCTarget{CCTarget::PARAMETER, static_cast<uint8_t>(paramId)});
+    }
+    table.add(synthParams->filterCutoffCC.load(), CCTarget{CCTarget::FILTER_CUTOFF, 0});
+    table.add(synthParams->presetMorphCC.load(), CCTarget{CCTarget::PRESET_MORPH, 0});
+    table.add(synthParams->loopRecPlayCC.load(), CCTarget{CCTarget::LOOP_REC_PLAY, 0});
+    table.add(synthParams->loopOverdubCC.load(), CCTarget{CCTarget::LOOP_OVERDUB, 0});
+    table.add(synthParams->loopStopCC.load(), CCTarget{CCTarget::LOOP_STOP, 0});
+    table.add(synthParams->loopClearCC.load(), CCTarget{CCTarget::LOOP_CLEAR, 0});
+}
+
 // Callback for MIDI CC messages
 void onControlChange(int controller, int value) {
     if (!synthParams) return;
@@ -251,11 +565,9 @@ void onControlChange(int controller, int value) {
             if (paramId == 32) {
                 synthParams->filterCutoffCC = controller;
             }
+            synthParams->ccMappingsChanged();
 
-            if (ui) {
-                std::string paramName = ui->getParameterName(paramId);
-                ui->addConsoleMessage("Learned CC#" + std::to_string(controller) + " for " + paramName);
-            }
+            reportLearnedCC(controller, paramId);
             return;  // Exit early after learning
         }
     }
@@ -266,9 +578,8 @@ void onControlChange(int controller, int value) {
         synthParams->filterCutoffCC = controller;
         synthParams->ccLearnMode = false;
         synthParams->ccLearnTarget = -1;
-        if (ui) {
-            ui->addConsoleMessage("Learned CC#" + std::to_string(controller) + " for Filter Cutoff");
-        }
+        synthParams->ccMappingsChanged();
+        reportLearnedCC(controller, kLearnTargetFilterCutoff);
     }
     
     // Check if we're in looper MIDI learn mode
@@ -276,194 +587,457 @@ void onControlChange(int controller, int value) {
         int target = synthParams->loopMidiLearnTarget.load();
         if (target == 0) {
             synthParams->loopRecPlayCC = controller;
-            if (ui) ui->addConsoleMessage("Learned CC#" + std::to_string(controller) + " for Loop Rec/Play");
+            reportLearnedCC(controller, kLearnTargetLoopBase + 0);
         } else if (target == 1) {
             synthParams->loopOverdubCC = controller;
-            if (ui) ui->addConsoleMessage("Learned CC#" + std::to_string(controller) + " for Loop Overdub");
+            reportLearnedCC(controller, kLearnTargetLoopBase + 1);
         } else if (target == 2) {
             synthParams->loopStopCC = controller;
-            if (ui) ui->addConsoleMessage("Learned CC#" + std::to_string(controller) + " for Loop Stop");
+            reportLearnedCC(controller, kLearnTargetLoopBase + 2);
         } else if (target == 3) {
             synthParams->loopClearCC = controller;
-            if (ui) ui->addConsoleMessage("Learned CC#" + std::to_string(controller) + " for Loop Clear");
+            reportLearnedCC(controller, kLearnTargetLoopBase + 3);
         }
         synthParams->loopMidiLearnMode = false;
         synthParams->loopMidiLearnTarget = -1;
+        synthParams->ccMappingsChanged();
     }
     
-    // Process CC messages - check if any parameter is mapped to this controller
-    // TODO: Add parameter smoothing at control rate (100Hz) to prevent zipper noise
-    // Current implementation: Atomic writes provide thread-safe direct updates
-    for (int paramId = 0; paramId < 50; ++paramId) {
-        int mappedCC = synthParams->parameterCCMap[paramId].load();
-        if (mappedCC >= 0 && mappedCC == controller) {
-            applyMIDICCToParameter(paramId, value);
-        }
+    // Process CC messages through the dispatch table, rebuilt from the
+    // mapping atomics only when a mapping has changed
+    static CCDispatchTable dispatch;
+    const uint32_t mapSerial = synthParams->ccMapSerial.load(std::memory_order_acquire);
+    if (dispatch.serial != mapSerial) {
+        rebuildCCDispatch(dispatch);
+        dispatch.serial = mapSerial;
     }
 
-    // Legacy: Process CC messages if they're mapped to parameters
-    int cutoffCC = synthParams->filterCutoffCC.load();
-    if (cutoffCC >= 0 && controller == cutoffCC) {
-        // Map MIDI CC value (0-127) to frequency range (20-20000 Hz) logarithmically
-        // MIDI 0 = 20 Hz, MIDI 127 = 20000 Hz
-        float normalized = value / 127.0f;  // 0.0 to 1.0
-        // Logarithmic mapping: 20 Hz to 20 kHz
-        float frequency = 20.0f * std::pow(1000.0f, normalized);  // 20 * (1000^norm)
-        synthParams->filterCutoff = frequency;
-    }
-    
-    // Process looper CC mappings (toggle on high values > 64)
-    if (loopManager) {
-        int recPlayCC = synthParams->loopRecPlayCC.load();
-        if (recPlayCC >= 0 && controller == recPlayCC && value > 64) {
-            Looper* loop = loopManager->getCurrentLoop();
-            if (loop) loop->pressRecPlay();
-        }
-        
-        int overdubCC = synthParams->loopOverdubCC.load();
-        if (overdubCC >= 0 && controller == overdubCC && value > 64) {
-            Looper* loop = loopManager->getCurrentLoop();
-            if (loop) loop->pressOverdub();
+    dispatch.dispatch(controller, [value](const CCTarget& target) {
+        Looper* loop = nullptr;
+        if (target.kind >= CCTarget::LOOP_REC_PLAY) {
+            // Loop buttons press on high values
+            if (!loopManager || value <= 64) return;
+            loop = loopManager->getCurrentLoop();
+            if (!loop) return;
         }
-        
-        int stopCC = synthParams->loopStopCC.load();
-        if (stopCC >= 0 && controller == stopCC && value > 64) {
-            Looper* loop = loopManager->getCurrentLoop();
-            if (loop) loop->pressStop();
+        switch (target.kind) {
+            case CCTarget::PARAMETER:
+                applyMIDICCToParameter(target.id, value);
+                break;
+            case CCTarget::FILTER_CUTOFF:
+                // Legacy: MIDI 0 = 20 Hz, MIDI 127 = 20000 Hz, logarithmically
+                synthParams->filterCutoff = 20.0f * std::pow(1000.0f, value / 127.0f);
+                break;
+            case CCTarget::PRESET_MORPH:
+                // Preset morph position, A at 0 to B at 127
+                synthParams->presetMorph = value / 127.0f;
+                break;
+            case CCTarget::LOOP_REC_PLAY: loop->pressRecPlay(); break;
+            case CCTarget::LOOP_OVERDUB: loop->pressOverdub(); break;
+            case CCTarget::LOOP_STOP: loop->pressStop(); break;
+            case CCTarget::LOOP_CLEAR: loop->pressClear(); break;
         }
-        
-        int clearCC = synthParams->loopClearCC.load();
-        if (clearCC >= 0 && controller == clearCC && value > 64) {
-            Looper* loop = loopManager->getCurrentLoop();
-            if (loop) loop->pressClear();
+    });
+}
+
+// Set when a CC handled inside the current callback wrote SynthParameters
+static bool ccWroteParameters = false;
+
+// Automation events dispatched in the current callback: a bit per parameter
+// id and the values, for renderAudio to apply before the next segment. An
+// event also writes SynthParameters like a CC, which the next callback
+// reads back (automationWroteParameters)
+static uint64_t pendingAutomation = 0;
+static float pendingAutomationValues[AutomationClip::kMaxLanes];
+static bool automationWroteParameters = false;
+
+// Audio-thread CC entry point: publish the write before the block is read
+void onControlChangeRT(int controller, int value) {
+    onControlChange(controller, value);
+    if (synthParams) {
+        synthParams->writeEpoch.fetch_add(1);
+        ccWroteParameters = true;
+    }
+}
+
+// Planar scratch for the synth -> looper stage. Sized up front so the callback
+// never allocates; device buffers larger than this are processed in slices.
+constexpr unsigned int kCallbackSliceFrames = 1024;
+static float synthL[kCallbackSliceFrames];
+static float synthR[kCallbackSliceFrames];
+
+// Per-frame master volume while its smoother moves; longer buffers hold the
+// last value past the end, as Synth does for its modulation buffers
+constexpr unsigned int kMasterRampFrames = 4096;
+static float masterVolumeRamp[kMasterRampFrames];
+
+// Limiter, dither and conversion to the stream's format. A planar float
+// stream is rendered into directly; any other renders into the mix planes,
+// sized for the stream's buffer when it opens, and is converted from them
+static OutputStage outputStage;
+static std::vector<float> deviceMixLeft;
+static std::vector<float> deviceMixRight;
+
+// Set the stream's format and size the mix planes for it. Not while the
+// stream runs
+static void prepareOutputStage(SampleFormat format, bool interleaved, unsigned int bufferFrames) {
+    outputStage.setFormat(format, interleaved);
+    const size_t frames = outputStage.isDirect() ? 0 : bufferFrames;
+    deviceMixLeft.assign(frames, 0.0f);
+    deviceMixRight.assign(frames, 0.0f);
+}
+
+#ifdef WAKEFIELD_JACK
+static JackOutput* jackOutput = nullptr;  // --jack: the stream runs on JACK instead of RtAudio
+#endif
+#ifdef WAKEFIELD_ALSA_MMAP
+static AlsaOutput* alsaOutput = nullptr;  // --alsa: direct mmap playback instead of RtAudio
+#endif
+
+// Scheduling, pinning and memory locking asked for in the device config,
+// and what the system granted (shown on the Config page)
+static rtsetup::Options realtimeOptions;
+static rtsetup::Status realtimeStatus;
+
+// Counted on the audio thread for the metrics exporter; each one is also
+// logged through rtLog
+static std::atomic<unsigned int> streamUnderflows{0};
+
+// Note events for the current buffer (audio thread only) and the stream's
+// actual rate, used to turn MIDI arrival times into frame offsets
+static EventSchedule noteSchedule;
+static double streamSampleRate = 48000.0;
+
+// Offline render only: the MIDI file standing in for live input
+static MidiFilePlayer* midiFilePlayer = nullptr;
+
+// --pipeline: filter, reverb and loopers run on their own thread a block behind
+static EffectsPipeline* effectsPipeline = nullptr;
+
+static void dispatchScheduledEvent(const ScheduledEvent& event) {
+    if (event.type == ScheduledEvent::PARAM) {
+        if (synthParams && event.note < AutomationClip::kMaxLanes) {
+            applyNormalizedToParameter(event.note, event.value);
+            synthParams->writeEpoch.fetch_add(1);
+            automationWroteParameters = true;
+            pendingAutomation |= uint64_t(1) << event.note;
+            pendingAutomationValues[event.note] = event.value;
         }
+        return;
+    }
+    if (sessionCapture) {
+        sessionCapture->captureNote(event);
+    }
+    if (event.type == ScheduledEvent::NOTE_ON) {
+        onNoteOn(event.note, event.velocity);
+    } else {
+        onNoteOff(event.note);
     }
 }
 
-// Audio callback function
-int audioCallback(void* outputBuffer, void* /*inputBuffer*/,
-                  unsigned int nFrames,
-                  double /*streamTime*/,
-                  RtAudioStreamStatus status,
-                  void* /*userData*/) {
+// Parameters the callback smooths, as indices into its SmootherBank
+enum SmoothedParam {
+    SMOOTH_ATTACK,
+    SMOOTH_DECAY,
+    SMOOTH_SUSTAIN,
+    SMOOTH_RELEASE,
+    SMOOTH_MASTER_VOLUME,
+    SMOOTH_OSC_FREQ,
+    SMOOTH_OSC_MORPH,
+    SMOOTH_OSC_DUTY,
+    SMOOTH_REVERB_DELAY_TIME,
+    SMOOTH_REVERB_SIZE,
+    SMOOTH_REVERB_DAMPING,
+    SMOOTH_REVERB_MIX,
+    SMOOTH_REVERB_DECAY,
+    SMOOTH_REVERB_DIFFUSION,
+    SMOOTH_REVERB_MOD_DEPTH,
+    SMOOTH_REVERB_MOD_FREQ,
+    SMOOTH_FILTER_CUTOFF,
+    SMOOTH_FILTER_GAIN,
+    SMOOTH_FILTER_RESONANCE,
+    SMOOTH_FILTER_DRIVE,
+    SMOOTH_FILTER_FEEDBACK_HP,
+    SMOOTH_OVERDUB_MIX,
+    SMOOTHED_PARAM_COUNT
+};
+static_assert(SMOOTHED_PARAM_COUNT <= SmootherBank::kMaxParams, "SmootherBank too small");
+
+// Each smoothed parameter's target in the snapshot
+static void smoothedTargets(const SynthParamBlock& params, float* targets) {
+    targets[SMOOTH_ATTACK] = params.attack;
+    targets[SMOOTH_DECAY] = params.decay;
+    targets[SMOOTH_SUSTAIN] = params.sustain;
+    targets[SMOOTH_RELEASE] = params.release;
+    targets[SMOOTH_MASTER_VOLUME] = params.masterVolume;
+    targets[SMOOTH_OSC_FREQ] = params.osc[0].freq;
+    targets[SMOOTH_OSC_MORPH] = params.osc[0].morph;
+    targets[SMOOTH_OSC_DUTY] = params.osc[0].duty;
+    targets[SMOOTH_REVERB_DELAY_TIME] = params.reverbDelayTime;
+    targets[SMOOTH_REVERB_SIZE] = params.reverbSize;
+    targets[SMOOTH_REVERB_DAMPING] = params.reverbDamping;
+    targets[SMOOTH_REVERB_MIX] = params.reverbMix;
+    targets[SMOOTH_REVERB_DECAY] = params.reverbDecay;
+    targets[SMOOTH_REVERB_DIFFUSION] = params.reverbDiffusion;
+    targets[SMOOTH_REVERB_MOD_DEPTH] = params.reverbModDepth;
+    targets[SMOOTH_REVERB_MOD_FREQ] = params.reverbModFreq;
+    targets[SMOOTH_FILTER_CUTOFF] = params.filterCutoff;
+    targets[SMOOTH_FILTER_GAIN] = params.filterGain;
+    targets[SMOOTH_FILTER_RESONANCE] = params.filterResonance;
+    targets[SMOOTH_FILTER_DRIVE] = params.filterDrive;
+    targets[SMOOTH_FILTER_FEEDBACK_HP] = params.filterFeedbackHP;
+    targets[SMOOTH_OVERDUB_MIX] = params.overdubMix;
+}
+
+// Blocks the startup warm-up renders at the device buffer size
+constexpr int kWarmUpBlocks = 256;
+
+// A preset switch fades the voices out, swaps in the whole new parameter
+// block while they are silent (the smoothers jump instead of gliding, so no
+// intermediate mix of the two presets is heard) and fades back in
+constexpr float kPresetFadeSeconds = 0.005f;
+
+struct PresetFade {
+    SynthParamBlock pending;        // Waits for the fade-out to finish
+    bool pendingValid = false;
+    float gain = 1.0f;              // Multiplies the master volume
+    float step = 0.0f;              // Per frame: < 0 fading out, > 0 fading in
+
+    bool active() const { return step != 0.0f; }
+
+    void stage(const SynthParamBlock& block, float sampleRate) {
+        pending = block;
+        pendingValid = true;
+        step = -1.0f / (kPresetFadeSeconds * sampleRate);
+    }
+
+    // Start the fade-in once the pending block has been swapped in
+    void swapped() {
+        pendingValid = false;
+        step = -step;
+    }
+
+    // Scale ramp[0..nFrames) by the fade, advancing it
+    void apply(float* ramp, unsigned int nFrames) {
+        for (unsigned int i = 0; i < nFrames; ++i) {
+            gain = std::clamp(gain + step, 0.0f, 1.0f);
+            ramp[i] *= gain;
+        }
+        if (step > 0.0f && gain >= 1.0f) {
+            step = 0.0f;
+        }
+    }
+};
+static PresetFade presetFade;
+
+// Where a buffer of output goes: two planes (a non-interleaved RtAudio
+// stream, JACK's ports) or one interleaved buffer
+struct AudioOutput {
+    float* left = nullptr;          // Planes the mix is rendered into
+    float* right = nullptr;
+    void* device = nullptr;         // Set when they are not the device buffer: converted into it
+};
+
+// One buffer of audio, from whichever backend runs the stream. A nonzero
+// underflow is the backend's report of a missed buffer
+static void renderAudio(const AudioOutput& output, unsigned int nFrames, int32_t underflow) {
+    // Pin the callback thread and note what scheduling the backend gave it, once
+    static bool audioThreadConfigured = false;
+    if (!audioThreadConfigured) {
+        rtsetup::configureAudioThread(realtimeOptions, realtimeStatus);
+        profile::registerThread("audio");
+        audioThreadConfigured = true;
+    }
+
+    RtCheckScope rtScope;
+    ScopedDenormalGuard denormalGuard;  // FTZ/DAZ for every DSP stage below
+    profile::ScopedTimer callbackTimer(profile::AUDIO_CALLBACK);
 
-    // Temp buffers for synth output (before looper)
-    static std::vector<float> tempBuffer;
-    static std::vector<float> tempL;
-    static std::vector<float> tempR;
+    if (sessionCapture) {
+        sessionCapture->beginBlock(nFrames);
+    }
 
-    // Parameter smoothers (10ms smoothing time at 48kHz = ~100Hz update rate)
+    // Parameter smoothers, advanced once per buffer with a 10 ms time constant
+    static SmootherBank smoothers;
     static bool smoothersInitialized = false;
-    static ParameterSmoother attackSmoother;
-    static ParameterSmoother decaySmoother;
-    static ParameterSmoother sustainSmoother;
-    static ParameterSmoother releaseSmoother;
-    static ParameterSmoother masterVolumeSmoother;
-    static ParameterSmoother oscillatorFreqSmoother;
-    static ParameterSmoother oscillatorMorphSmoother;
-    static ParameterSmoother oscillatorDutySmoother;
-    static ParameterSmoother reverbDelayTimeSmoother;
-    static ParameterSmoother reverbSizeSmoother;
-    static ParameterSmoother reverbDampingSmoother;
-    static ParameterSmoother reverbMixSmoother;
-    static ParameterSmoother reverbDecaySmoother;
-    static ParameterSmoother reverbDiffusionSmoother;
-    static ParameterSmoother reverbModDepthSmoother;
-    static ParameterSmoother reverbModFreqSmoother;
-    static ParameterSmoother filterCutoffSmoother;
-    static ParameterSmoother filterGainSmoother;
-    static ParameterSmoother filterResonanceSmoother;
-    static ParameterSmoother filterDriveSmoother;
-    static ParameterSmoother filterFeedbackHPSmoother;
-    static ParameterSmoother overdubMixSmoother;
-
-    float* buffer = static_cast<float*>(outputBuffer);
-
-    if (status) {
-        std::cout << "Stream underflow detected!" << std::endl;
-    }
-
-    // Process pending MIDI messages first
+    static double smootherSampleRate = 0.0;
+
+    if (underflow) {
+        streamUnderflows.fetch_add(1, std::memory_order_relaxed);
+        rtLog.post(RtLog::Event::STREAM_UNDERFLOW, underflow);
+    }
+
+    // Process pending MIDI messages first: CCs now, notes on their frames
+    ccWroteParameters = false;
+    noteSchedule.clear();
     if (midiHandler) {
-        midiHandler->processMessages(onNoteOn, onNoteOff, onControlChange);
+        midiHandler->collectEvents(noteSchedule, nFrames, streamSampleRate, onControlChangeRT,
+                                   midiClockIn ? &midiClockSync : nullptr);
     }
-    
-    // Update synth parameters from UI (atomic reads are thread-safe)
+    if (midiFilePlayer) {
+        midiFilePlayer->collectEvents(noteSchedule, nFrames, onControlChangeRT);
+    }
+
+    // OSC: the newest value of each address since the last buffer, written
+    // like a CC, then the queued transport and loop buttons
+    if (oscServer && synthParams) {
+        bool oscWroteParameters = false;
+        oscServer->drainValues([&](int slot, float value) {
+            if (slot < OscServer::kParameterSlots) {
+                applyNormalizedToParameter(slot, value);
+                oscWroteParameters = true;
+            } else if (slot == OscServer::kSlotMorph) {
+                synthParams->presetMorph = value;
+                oscWroteParameters = true;
+            } else if (slot == OscServer::kSlotTempo && sequencer && !midiClockIn) {
+                sequencer->setTempo(value);
+            }
+        });
+        if (oscWroteParameters) {
+            synthParams->writeEpoch.fetch_add(1);
+            ccWroteParameters = true;
+        }
+
+        OscServer::Command command;
+        while (oscServer->popCommand(command)) {
+            runButtonCommand(command);
+        }
+    }
+
+    // External MIDI clock: transport messages start and stop the sequencer,
+    // and the filtered clock steers the transport onto the position it
+    // reports for the end of this buffer's window
+    if (midiClockIn && midiHandler && transportClock && sequencer) {
+        const int64_t windowEnd = midiHandler->getWindowEndNs();
+        const int64_t windowStart = windowEnd - static_cast<int64_t>(nFrames * 1e9 / streamSampleRate);
+        switch (midiClockSync.takeTransport()) {
+            case MidiClockSync::Transport::START:
+                sequencer->reset();
+                sequencer->play();
+                break;
+            case MidiClockSync::Transport::CONTINUE:
+                transportClock->locate(midiClockSync.beatAt(windowStart));
+                sequencer->play();
+                break;
+            case MidiClockSync::Transport::STOP:
+                sequencer->stop();
+                break;
+            case MidiClockSync::Transport::NONE:
+                break;
+        }
+        if (midiClockSync.isLocked()) {
+            transportClock->steer(nFrames, midiClockSync.beatAt(windowEnd), midiClockSync.getTempo());
+        }
+    }
+
+    // MIDI clock out, from the transport before the sequencer advances it.
+    // This buffer is heard one buffer from now, and its messages leave then
+    if (midiClockOutput && transportClock) {
+        static bool clockOutPlaying = false;
+        const double nsPerFrame = 1e9 / streamSampleRate;
+        const int64_t bufferTime = MidiHandler::nowNs() + static_cast<int64_t>(nFrames * nsPerFrame);
+        const bool playing = transportClock->isPlaying();
+        if (playing != clockOutPlaying) {
+            const unsigned char status = !playing ? MIDI_STOP :
+                (transportClock->getBeatPosition() == 0.0 ? MIDI_START : MIDI_CONTINUE);
+            midiClockOutput->send(status, bufferTime);
+            clockOutPlaying = playing;
+        }
+        uint32_t tickFrames[64];
+        const int ticks = transportClock->collectTicks(nFrames, MidiClockSync::kTicksPerBeat, tickFrames, 64);
+        for (int i = 0; i < ticks; ++i) {
+            midiClockOutput->send(MIDI_TIMING_CLOCK, bufferTime + static_cast<int64_t>(tickFrames[i] * nsPerFrame));
+        }
+    }
+
+    // One parameter snapshot per buffer. Normally this is the block the UI
+    // thread published; a CC handled above wrote the atomics directly, so then
+    // the block is captured here and older published blocks are skipped.
+    // A block from a preset switch waits in presetFade until the voices are
+    // silent, and so does anything newer that arrives meanwhile.
+    static SynthParamBlock params;
+    static uint32_t paramsVersion = 0;
+    static bool paramsCaptured = false;
+    bool presetSwapped = false;
+    if (synthParams) {
+        SynthParamBlock incoming;
+        bool received = false;
+        if (ccWroteParameters || automationWroteParameters || !paramsCaptured) {
+            synthParams->captureBlock(incoming);
+            automationWroteParameters = false;
+            received = true;
+        } else {
+            const uint32_t newestEpoch = presetFade.pendingValid ? presetFade.pending.epoch : params.epoch;
+            received = synthParams->snapshotChannel.readIfNewer(paramsVersion, incoming) &&
+                       incoming.epoch >= newestEpoch;
+        }
+        if (received) {
+            if (presetFade.pendingValid ||
+                (paramsCaptured && incoming.presetSerial != params.presetSerial)) {
+                presetFade.stage(incoming, static_cast<float>(streamSampleRate));
+            } else {
+                params = incoming;
+            }
+            paramsCaptured = true;
+        }
+        if (presetFade.pendingValid && presetFade.gain <= 0.0f) {
+            params = presetFade.pending;
+            presetFade.swapped();
+            presetSwapped = true;
+        }
+
+        // An active preset morph overrides the fields where A and B differ
+        synthParams->morphChannel.takeFresh();
+        synthParams->morphChannel.front().apply(params.presetMorph, params);
+    }
+    if (sessionReplay) {
+        params = sessionReplay->getParameters();
+    }
+    if (sessionCapture) {
+        sessionCapture->captureParameters(params);
+    }
+    if (synth) {
+        synth->setParameterBlock(synthParams ? &params : nullptr);
+    }
+
+    // Steps the quality governor has taken override the settings they
+    // degrade; it only acts while the load meter runs
+    const QualityGovernor* governor = (loadMonitor && loadMonitor->isEnabled()) ? qualityGovernor : nullptr;
+    auto degraded = [governor](QualityGovernor::Step step) { return governor && governor->applies(step); };
+
+    // Update synth parameters from the snapshot
     // Use smoothers to prevent zipper noise
     if (synth && synthParams) {
-        // Initialize smoothers on first run
-        if (!smoothersInitialized) {
-            attackSmoother.reset(synthParams->attack.load());
-            decaySmoother.reset(synthParams->decay.load());
-            sustainSmoother.reset(synthParams->sustain.load());
-            releaseSmoother.reset(synthParams->release.load());
-            masterVolumeSmoother.reset(synthParams->masterVolume.load());
-            oscillatorFreqSmoother.reset(synthParams->osc1Freq.load());
-            oscillatorMorphSmoother.reset(synthParams->osc1Morph.load());
-            oscillatorDutySmoother.reset(synthParams->osc1Duty.load());
-            reverbDelayTimeSmoother.reset(synthParams->reverbDelayTime.load());
-            reverbSizeSmoother.reset(synthParams->reverbSize.load());
-            reverbDampingSmoother.reset(synthParams->reverbDamping.load());
-            reverbMixSmoother.reset(synthParams->reverbMix.load());
-            reverbDecaySmoother.reset(synthParams->reverbDecay.load());
-            reverbDiffusionSmoother.reset(synthParams->reverbDiffusion.load());
-            reverbModDepthSmoother.reset(synthParams->reverbModDepth.load());
-            reverbModFreqSmoother.reset(synthParams->reverbModFreq.load());
-            filterCutoffSmoother.reset(synthParams->filterCutoff.load());
-            filterGainSmoother.reset(synthParams->filterGain.load());
-            filterResonanceSmoother.reset(synthParams->filterResonance.load());
-            filterDriveSmoother.reset(synthParams->filterDrive.load());
-            filterFeedbackHPSmoother.reset(synthParams->filterFeedbackHP.load());
-            overdubMixSmoother.reset(synthParams->overdubMix.load());
+        profile::ScopedTimer smoothingTimer(profile::PARAM_SMOOTHING);
+
+        float targets[SMOOTHED_PARAM_COUNT];
+        smoothedTargets(params, targets);
+        if (!smoothersInitialized || presetSwapped) {
+            for (int i = 0; i < SMOOTHED_PARAM_COUNT; ++i) {
+                smoothers.reset(i, targets[i]);
+            }
             smoothersInitialized = true;
+        } else {
+            for (int i = 0; i < SMOOTHED_PARAM_COUNT; ++i) {
+                smoothers.setTarget(i, targets[i]);
+            }
+        }
+
+        // The bank steps by the buffer's frame count, so the smoothing time
+        // holds whatever the buffer size
+        if (streamSampleRate != smootherSampleRate) {
+            smoothers.setSmoothTime(0.01f, static_cast<float>(streamSampleRate));
+            smootherSampleRate = streamSampleRate;
         }
+        smoothers.advance(nFrames);
 
-        // Update smoother targets from atomic parameters
-        attackSmoother.setTarget(synthParams->attack.load());
-        decaySmoother.setTarget(synthParams->decay.load());
-        sustainSmoother.setTarget(synthParams->sustain.load());
-        releaseSmoother.setTarget(synthParams->release.load());
-        masterVolumeSmoother.setTarget(synthParams->masterVolume.load());
-        oscillatorFreqSmoother.setTarget(synthParams->osc1Freq.load());
-        oscillatorMorphSmoother.setTarget(synthParams->osc1Morph.load());
-        oscillatorDutySmoother.setTarget(synthParams->osc1Duty.load());
-        reverbDelayTimeSmoother.setTarget(synthParams->reverbDelayTime.load());
-        reverbSizeSmoother.setTarget(synthParams->reverbSize.load());
-        reverbDampingSmoother.setTarget(synthParams->reverbDamping.load());
-        reverbMixSmoother.setTarget(synthParams->reverbMix.load());
-        reverbDecaySmoother.setTarget(synthParams->reverbDecay.load());
-        reverbDiffusionSmoother.setTarget(synthParams->reverbDiffusion.load());
-        reverbModDepthSmoother.setTarget(synthParams->reverbModDepth.load());
-        reverbModFreqSmoother.setTarget(synthParams->reverbModFreq.load());
-        filterCutoffSmoother.setTarget(synthParams->filterCutoff.load());
-        filterGainSmoother.setTarget(synthParams->filterGain.load());
-        filterResonanceSmoother.setTarget(synthParams->filterResonance.load());
-        filterDriveSmoother.setTarget(synthParams->filterDrive.load());
-        filterFeedbackHPSmoother.setTarget(synthParams->filterFeedbackHP.load());
-        overdubMixSmoother.setTarget(synthParams->overdubMix.load());
-
-        // Process smoothers (one step per audio callback)
-        float smoothedAttack = attackSmoother.process();
-        float smoothedDecay = decaySmoother.process();
-        float smoothedSustain = sustainSmoother.process();
-        float smoothedRelease = releaseSmoother.process();
-        float smoothedMasterVolume = masterVolumeSmoother.process();
-        float smoothedOscillatorFreq = oscillatorFreqSmoother.process();
-        float smoothedOscillatorMorph = oscillatorMorphSmoother.process();
-        float smoothedOscillatorDuty = oscillatorDutySmoother.process();
-        float smoothedReverbDelayTime = reverbDelayTimeSmoother.process();
-        float smoothedReverbSize = reverbSizeSmoother.process();
-        float smoothedReverbDamping = reverbDampingSmoother.process();
-        float smoothedReverbMix = reverbMixSmoother.process();
-        float smoothedReverbDecay = reverbDecaySmoother.process();
-        float smoothedReverbDiffusion = reverbDiffusionSmoother.process();
-        float smoothedReverbModDepth = reverbModDepthSmoother.process();
-        float smoothedReverbModFreq = reverbModFreqSmoother.process();
-        float smoothedFilterCutoff = filterCutoffSmoother.process();
-        float smoothedFilterGain = filterGainSmoother.process();
-        float smoothedFilterResonance = filterResonanceSmoother.process();
-        float smoothedFilterDrive = filterDriveSmoother.process();
-        float smoothedFilterFeedbackHP = filterFeedbackHPSmoother.process();
+        const float smoothedAttack = smoothers.value(SMOOTH_ATTACK);
+        const float smoothedDecay = smoothers.value(SMOOTH_DECAY);
+        const float smoothedSustain = smoothers.value(SMOOTH_SUSTAIN);
+        const float smoothedRelease = smoothers.value(SMOOTH_RELEASE);
+        const float smoothedOscillatorFreq = smoothers.value(SMOOTH_OSC_FREQ);
+        const float smoothedOscillatorMorph = smoothers.value(SMOOTH_OSC_MORPH);
+        const float smoothedOscillatorDuty = smoothers.value(SMOOTH_OSC_DUTY);
 
         // Update synth with smoothed values
         synth->updateEnvelopeParameters(
@@ -472,19 +1046,30 @@ int audioCallback(void* outputBuffer, void* /*inputBuffer*/,
             smoothedSustain,
             smoothedRelease
         );
-        synth->setMasterVolume(smoothedMasterVolume);
+        // Master volume scales the voices per frame, so while it moves (or a
+        // preset switch fades) it ramps across the buffer rather than
+        // stepping at its start
+        if (smoothers.moved(SMOOTH_MASTER_VOLUME) || presetFade.active()) {
+            const unsigned int rampFrames = std::min(nFrames, kMasterRampFrames);
+            smoothers.ramp(SMOOTH_MASTER_VOLUME, masterVolumeRamp, rampFrames);
+            presetFade.apply(masterVolumeRamp, rampFrames);
+            synth->setMasterVolumeRamp(masterVolumeRamp, rampFrames);
+        } else {
+            synth->setMasterVolume(smoothers.value(SMOOTH_MASTER_VOLUME));
+        }
 
         // Update per-oscillator parameters (oscillator 1 uses smoothed values)
         for (int oscIndex = 0; oscIndex < OSCILLATORS_PER_VOICE; ++oscIndex) {
-            BrainwaveMode mode = static_cast<BrainwaveMode>(synthParams->getOscMode(oscIndex));
-            int shape = synthParams->getOscShape(oscIndex);
-            float baseFreq = (oscIndex == 0) ? smoothedOscillatorFreq : synthParams->getOscFrequency(oscIndex);
-            float morph = (oscIndex == 0) ? smoothedOscillatorMorph : synthParams->getOscMorph(oscIndex);
-            float duty = (oscIndex == 0) ? smoothedOscillatorDuty : synthParams->getOscDuty(oscIndex);
-            float ratio = synthParams->getOscRatio(oscIndex);
-            float offset = synthParams->getOscOffset(oscIndex);
-            float amp = synthParams->getOscAmp(oscIndex);
-            float level = synthParams->getOscLevel(oscIndex);
+            const SynthParamBlock::Oscillator& osc = params.osc[oscIndex];
+            BrainwaveMode mode = static_cast<BrainwaveMode>(osc.mode);
+            int shape = osc.shape;
+            float baseFreq = (oscIndex == 0) ? smoothedOscillatorFreq : osc.freq;
+            float morph = (oscIndex == 0) ? smoothedOscillatorMorph : osc.morph;
+            float duty = (oscIndex == 0) ? smoothedOscillatorDuty : osc.duty;
+            float ratio = osc.ratio;
+            float offset = osc.offset;
+            float amp = osc.amp;
+            float level = osc.level;
 
             synth->setOscillatorState(
                 oscIndex,
@@ -500,29 +1085,50 @@ int audioCallback(void* outputBuffer, void* /*inputBuffer*/,
             );
         }
 
-        // Update reverb parameters (discrete params not smoothed)
-        synth->setReverbEnabled(synthParams->reverbEnabled.load());
-        synth->updateReverbParameters(
-            smoothedReverbDelayTime,
-            smoothedReverbSize,
-            smoothedReverbDamping,
-            smoothedReverbMix,
-            smoothedReverbDecay,
-            smoothedReverbDiffusion,
-            smoothedReverbModDepth,
-            smoothedReverbModFreq
-        );
+        // Update reverb parameters (discrete params not smoothed). Once every
+        // reverb smoother has settled and its final value was applied, the
+        // update is skipped until a target moves again.
+        static bool reverbParamsApplied = false;
+        bool reverbSettled = true;
+        for (int i = SMOOTH_REVERB_DELAY_TIME; i <= SMOOTH_REVERB_MOD_FREQ; ++i) {
+            reverbSettled = reverbSettled && smoothers.isSettled(i);
+        }
+        synth->setReverbEnabled(params.reverbEnabled);
+        synth->setReverbType(params.reverbType);
+        synth->setReverbHalfRate(params.reverbRate == 1 || degraded(QualityGovernor::Step::REVERB_HALF_RATE));
+        if (!reverbSettled || !reverbParamsApplied || presetSwapped) {
+            synth->updateReverbParameters(
+                smoothers.value(SMOOTH_REVERB_DELAY_TIME),
+                smoothers.value(SMOOTH_REVERB_SIZE),
+                smoothers.value(SMOOTH_REVERB_DAMPING),
+                smoothers.value(SMOOTH_REVERB_MIX),
+                smoothers.value(SMOOTH_REVERB_DECAY),
+                smoothers.value(SMOOTH_REVERB_DIFFUSION),
+                smoothers.value(SMOOTH_REVERB_MOD_DEPTH),
+                smoothers.value(SMOOTH_REVERB_MOD_FREQ)
+            );
+            reverbParamsApplied = reverbSettled;
+        }
 
         // Update filter parameters (discrete params not smoothed)
-        synth->setFilterEnabled(synthParams->filterEnabled.load());
+        synth->setFilterEnabled(params.filterEnabled);
         synth->updateFilterParameters(
-            synthParams->filterType.load(),
-            smoothedFilterCutoff,
-            smoothedFilterGain,
-            smoothedFilterResonance,
-            smoothedFilterDrive,
-            smoothedFilterFeedbackHP
+            params.filterType,
+            smoothers.value(SMOOTH_FILTER_CUTOFF),
+            smoothers.value(SMOOTH_FILTER_GAIN),
+            smoothers.value(SMOOTH_FILTER_RESONANCE),
+            smoothers.value(SMOOTH_FILTER_DRIVE),
+            smoothers.value(SMOOTH_FILTER_FEEDBACK_HP)
         );
+        synth->setFilterPerVoice(params.filterPerVoice, params.filterEnvAmount);
+        const bool noOversampling = degraded(QualityGovernor::Step::NO_OVERSAMPLING);
+        synth->setOversampling(noOversampling ? 1 : 1 << params.filterOversample,
+                               noOversampling ? 1 : 1 << params.fmOversample,
+                               static_cast<OversampleQuality>(params.oversampleQuality));
+        synth->setSamplerInterpolationCap(degraded(QualityGovernor::Step::SAMPLER_LINEAR)
+                                          ? SamplerInterpolation::LINEAR : SamplerInterpolation::SINC);
+        synth->setVoiceLimit(degraded(QualityGovernor::Step::CAP_POLYPHONY)
+                             ? MAX_VOICES / 2 : MAX_VOICES);
 
         // Update LFO parameters
         // Get tempo from sequencer for LFO sync
@@ -534,194 +1140,1240 @@ int audioCallback(void* outputBuffer, void* /*inputBuffer*/,
         for (int i = 0; i < 4; ++i) {
             synth->updateLFOParameters(
                 i,
-                synthParams->getLfoPeriod(i),
-                synthParams->getLfoSyncMode(i),
-                synthParams->getLfoShape(i),
-                synthParams->getLfoMorph(i),
-                synthParams->getLfoDuty(i),
-                synthParams->getLfoFlip(i),
-                synthParams->getLfoResetOnNote(i),
+                params.lfo[i].period,
+                params.lfo[i].syncMode,
+                params.lfo[i].shape,
+                params.lfo[i].morph,
+                params.lfo[i].duty,
+                params.lfo[i].flip,
+                params.lfo[i].resetOnNote,
                 currentTempo
             );
         }
     }
 
-    // Update looper parameters
+    // Effects and loopers on the pipeline thread, unless the block is too big for a slot
+    const bool pipelined = synth && effectsPipeline && effectsPipeline->isRunning() &&
+                           nFrames <= EffectsPipeline::kMaxFrames;
+
+    // Update looper parameters. Pipelined, they travel with the block instead
+    int loopIndex = -1;
+    float smoothedOverdubMix = 0.0f;
     if (loopManager && synthParams) {
-        loopManager->selectLoop(synthParams->currentLoop.load());
-        float smoothedOverdubMix = overdubMixSmoother.process();
-        loopManager->setOverdubMix(smoothedOverdubMix);
+        loopIndex = params.currentLoop;
+        smoothedOverdubMix = smoothers.value(SMOOTH_OVERDUB_MIX);
+        if (!pipelined) {
+            loopManager->selectLoop(loopIndex);
+            loopManager->setOverdubMix(smoothedOverdubMix);
+        }
+    }
+
+    // Beat or bar lines for quantized loop changes, from the transport
+    // position before the sequencer advances it
+    LoopGrid loopGrid;
+    const bool loopSynced = loopManager && transportClock && transportClock->isPlaying() &&
+                            params.loopQuantize > 0;
+    if (loopSynced) {
+        loopGrid.position = transportClock->getGridPosition();
+        loopGrid.period = transportClock->getSamplesPerStep(
+            params.loopQuantize > 1 ? Subdivision::WHOLE : Subdivision::QUARTER);
+    }
+
+    if (sessionCapture && synth) {
+        sessionCapture->captureControls(*synth, loopManager, transportClock);
     }
 
-    // Process sequencer (triggers notes based on patterns)
+    // Process sequencer (schedules notes on their step frames)
     if (sequencer) {
-        sequencer->process(nFrames);
+        if (sessionReplay) {
+            // The clock still advances; the notes it scheduled live are in the log
+            static EventSchedule replayedSequence;
+            replayedSequence.clear();
+            sequencer->process(nFrames, replayedSequence);
+        } else {
+            if (synthParams) {
+                sequencer->recordAutomation(params);
+            }
+            sequencer->process(nFrames, noteSchedule);
+        }
+    }
+    if (sessionReplay) {
+        sessionReplay->scheduleNotes(nFrames, noteSchedule);
+    }
+
+    // Notes on the parts' channels go to their own engines
+    if (partRack) {
+        partRack->takeEvents(noteSchedule);
     }
 
     // Process LFOs (once per buffer, before synthesis)
-    // Note: Sample rate is passed as 48000.0f (hardcoded for now)
     if (synth) {
-        synth->processLFOs(48000.0f, nFrames);
+        synth->processLFOs(synth->getSampleRate(), nFrames);
         synth->processChaos(nFrames);
     }
 
-    // Generate audio from synth (with effects) into temp buffer
-    if (synth && loopManager) {
-        // Resize temp buffers if needed
-        size_t stereoFrames = nFrames * 2;
-        if (tempBuffer.size() < stereoFrames) {
-            tempBuffer.resize(stereoFrames);
-            tempL.resize(nFrames);
-            tempR.resize(nFrames);
+    // Automation events land on their frame: the parameters they set jump
+    // there (recorded automation is already the curve, so the smoothers
+    // would only blur it) and reach the synth before the next segment.
+    // Pipelined, the effect settings still go with the whole block
+    auto applyAutomation = [&]() {
+        if (pendingAutomation == 0 || !synth || !synthParams) {
+            return;
         }
+        float before[SMOOTHED_PARAM_COUNT];
+        float after[SMOOTHED_PARAM_COUNT];
+        smoothedTargets(params, before);
+        const SynthParamBlock previous = params;
+        for (int id = 0; id < AutomationClip::kMaxLanes; ++id) {
+            const AutomationTarget* target = findAutomationTarget(id);
+            if ((pendingAutomation >> id & 1) && target) {
+                target->apply(params, pendingAutomationValues[id]);
+            }
+        }
+        pendingAutomation = 0;
+        smoothedTargets(params, after);
+        auto moved = [&](int first, int last) {
+            bool any = false;
+            for (int i = first; i <= last; ++i) {
+                if (after[i] != before[i]) {
+                    smoothers.reset(i, after[i]);
+                    any = true;
+                }
+            }
+            return any;
+        };
 
-        // Process synth into temp buffer
-        synth->process(tempBuffer.data(), nFrames, 2);
-        
-        // Deinterleave for looper processing
-        for (unsigned int i = 0; i < nFrames; ++i) {
-            tempL[i] = tempBuffer[i * 2];
-            tempR[i] = tempBuffer[i * 2 + 1];
+        if (moved(SMOOTH_ATTACK, SMOOTH_RELEASE)) {
+            synth->updateEnvelopeParameters(smoothers.value(SMOOTH_ATTACK), smoothers.value(SMOOTH_DECAY),
+                                            smoothers.value(SMOOTH_SUSTAIN), smoothers.value(SMOOTH_RELEASE));
         }
-        
-        // Process through loopers (post-effects)
-        std::vector<float> outL(nFrames);
-        std::vector<float> outR(nFrames);
-        loopManager->processBlock(tempL.data(), tempR.data(), outL.data(), outR.data(), nFrames);
-        
-        // Interleave output
-        for (unsigned int i = 0; i < nFrames; ++i) {
-            buffer[i * 2] = outL[i];
-            buffer[i * 2 + 1] = outR[i];
+        if (moved(SMOOTH_MASTER_VOLUME, SMOOTH_MASTER_VOLUME) && !presetFade.active()) {
+            synth->setMasterVolume(smoothers.value(SMOOTH_MASTER_VOLUME));
         }
-    } else if (synth) {
-        // No looper, just process synth directly
-        synth->process(buffer, nFrames, 2);
-    }
-    
-    return 0;
-}
-
-int main(int argc, char** argv) {
-    setlocale(LC_ALL, "");
-    // Set up signal handler for Ctrl+C
-    signal(SIGINT, signalHandler);
-    
-    // Create synth parameters
-    synthParams = new SynthParameters();
-    
-    // Read device preferences
-    int preferredAudioDevice = -1;
-    int preferredMidiPort = -1;
-    readDeviceConfig(preferredAudioDevice, preferredMidiPort);
-    
-    // Initialize MIDI
-    midiHandler = new MidiHandler();
-    if (!midiHandler->initialize()) {
-        std::cerr << "Failed to initialize MIDI\n";
-        delete midiHandler;
-        delete synthParams;
-        return 1;
-    }
-    
-    // Get list of available MIDI devices
-    std::vector<std::pair<int, std::string>> midiDevices;
-    int portCount = midiHandler->getPortCount();
-    for (int i = 0; i < portCount; ++i) {
-        std::string portName = midiHandler->getPortName(i);
-        midiDevices.push_back({i, portName});
-    }
-    
-    // Open MIDI port (use preference or find Arturia)
-    int midiPortToUse = preferredMidiPort;
-    if (midiPortToUse < 0 || midiPortToUse >= portCount) {
-        // Try to find Arturia keyboard
-        int arturiaPort = midiHandler->findPortByName("arturia");
-        if (arturiaPort >= 0) {
-            std::cout << "Found Arturia keyboard at port " << arturiaPort << "\n";
-            midiPortToUse = arturiaPort;
-        } else if (portCount > 0) {
-            std::cout << "Using first available MIDI port...\n";
-            midiPortToUse = 0;
+        const SynthParamBlock::Oscillator& osc = params.osc[0];
+        if (moved(SMOOTH_OSC_FREQ, SMOOTH_OSC_DUTY) || osc.mode != previous.osc[0].mode ||
+            osc.ratio != previous.osc[0].ratio || osc.offset != previous.osc[0].offset) {
+            synth->setOscillatorState(0, static_cast<BrainwaveMode>(osc.mode), osc.shape,
+                                      smoothers.value(SMOOTH_OSC_FREQ), smoothers.value(SMOOTH_OSC_MORPH),
+                                      smoothers.value(SMOOTH_OSC_DUTY), osc.ratio, osc.offset, osc.amp, osc.level);
         }
-    }
-    
-    if (midiPortToUse >= 0) {
-        midiHandler->openPort(midiPortToUse);
-    }
-    
-    // Initialize Audio
-    RtAudio audio;
-    bool audioAvailable = false;
-    
-    unsigned int sampleRate = 48000;
-    unsigned int bufferFrames = 256;
-    
-    // Create synth instance
-    synth = new Synth(static_cast<float>(sampleRate));
+        if (moved(SMOOTH_REVERB_DELAY_TIME, SMOOTH_REVERB_MOD_FREQ) ||
+            params.reverbType != previous.reverbType || params.reverbEnabled != previous.reverbEnabled) {
+            synth->setReverbEnabled(params.reverbEnabled);
+            synth->setReverbType(params.reverbType);
+            synth->updateReverbParameters(
+                smoothers.value(SMOOTH_REVERB_DELAY_TIME), smoothers.value(SMOOTH_REVERB_SIZE),
+                smoothers.value(SMOOTH_REVERB_DAMPING), smoothers.value(SMOOTH_REVERB_MIX),
+                smoothers.value(SMOOTH_REVERB_DECAY), smoothers.value(SMOOTH_REVERB_DIFFUSION),
+                smoothers.value(SMOOTH_REVERB_MOD_DEPTH), smoothers.value(SMOOTH_REVERB_MOD_FREQ));
+        }
+        if (moved(SMOOTH_FILTER_CUTOFF, SMOOTH_FILTER_FEEDBACK_HP) ||
+            params.filterType != previous.filterType || params.filterEnabled != previous.filterEnabled) {
+            synth->setFilterEnabled(params.filterEnabled);
+            synth->updateFilterParameters(
+                params.filterType, smoothers.value(SMOOTH_FILTER_CUTOFF), smoothers.value(SMOOTH_FILTER_GAIN),
+                smoothers.value(SMOOTH_FILTER_RESONANCE), smoothers.value(SMOOTH_FILTER_DRIVE),
+                smoothers.value(SMOOTH_FILTER_FEEDBACK_HP));
+        }
+        if (moved(SMOOTH_OVERDUB_MIX, SMOOTH_OVERDUB_MIX) || params.currentLoop != previous.currentLoop) {
+            if (loopManager && !pipelined) {
+                loopIndex = params.currentLoop;
+                smoothedOverdubMix = smoothers.value(SMOOTH_OVERDUB_MIX);
+                loopManager->selectLoop(loopIndex);
+                loopManager->setOverdubMix(smoothedOverdubMix);
+            }
+        }
+    };
 
-    // Load samples from ../samples directory (relative to project root)
-    std::cout << "Loading samples from ../samples..." << std::endl;
-    int samplesLoaded = synth->getSampleBank()->loadSamplesFromDirectory("../samples");
-    if (samplesLoaded > 0) {
-        std::cout << "Loaded " << samplesLoaded << " samples successfully" << std::endl;
-        // Load first sample into first sampler
-        synth->setSamplerSample(0, 0);
-        std::cout << "Loaded first sample into Sampler 1" << std::endl;
-    } else {
-        std::cout << "Warning: No samples found in ../samples directory" << std::endl;
+    // Generate audio: synth (with effects) -> loopers -> device, all planar.
+    // Each slice is split at scheduled note events so they take effect on
+    // their own frame. The render time is measured against the buffer
+    // period for the DSP load meter
+    CPUMonitor* loadMeter = (loadMonitor && loadMonitor->isEnabled()) ? loadMonitor : nullptr;
+    auto renderStart = loadMeter ? std::chrono::steady_clock::now() : std::chrono::steady_clock::time_point();
+
+    // Every part's voices for the whole buffer, spread over the rack's
+    // threads; the synth mixes them in ahead of its effects
+    if (partRack && synth) {
+        PartRack::Controls partControls;
+        partControls.tempo = sequencer ? static_cast<float>(sequencer->getTempo()) : 120.0f;
+        partControls.voiceLimit = degraded(QualityGovernor::Step::CAP_POLYPHONY) ? MAX_VOICES / 2 : MAX_VOICES;
+        partControls.interpolationCap = degraded(QualityGovernor::Step::SAMPLER_LINEAR)
+                                        ? SamplerInterpolation::LINEAR : SamplerInterpolation::SINC;
+        partRack->render(nFrames, partControls);
     }
 
-    // Create looper manager
-    loopManager = new LoopManager(static_cast<float>(sampleRate));
+    if (pipelined) {
+        // Voices for this block; the device gets the previous block's effects output
+        float* voiceL = effectsPipeline->voiceLeft();
+        float* voiceR = effectsPipeline->voiceRight();
+        for (unsigned int pos = 0; pos < nFrames;) {
+            noteSchedule.dispatchThrough(pos, dispatchScheduledEvent);
+            applyAutomation();
+            unsigned int end = std::min<uint32_t>(nFrames, noteSchedule.nextFrame());
+            synth->renderVoices(voiceL + pos, voiceR + pos, end - pos);
+            pos = end;
+        }
+        if (partRack) {
+            partRack->addMix(voiceL, voiceR, 0, nFrames);
+        }
 
-    // Create shared transport clock
-    transportClock = new Clock(static_cast<float>(sampleRate));
+        const float* fxL;
+        const float* fxR;
+        effectsPipeline->submit(nFrames, synth->takeEffectSettings(), loopIndex, smoothedOverdubMix,
+                                loopSynced ? &loopGrid : nullptr, fxL, fxR);
+        std::copy(fxL, fxL + nFrames, output.left);
+        std::copy(fxR, fxR + nFrames, output.right);
+    } else if (synth) {
+        profile::Accumulator looperTimer;
+        for (unsigned int start = 0; start < nFrames; start += kCallbackSliceFrames) {
+            unsigned int frames = std::min(kCallbackSliceFrames, nFrames - start);
 
-    // Provide clock to synth and sequencer
-    synth->setClock(transportClock);
+            for (unsigned int pos = start; pos < start + frames;) {
+                noteSchedule.dispatchThrough(pos, dispatchScheduledEvent);
+                applyAutomation();
+                unsigned int end = std::min<uint32_t>(start + frames, noteSchedule.nextFrame());
+                unsigned int segment = end - pos;
 
-    // Create sequencer
-    sequencer = new Sequencer(transportClock, synth);
+                float* outL = output.left + pos;
+                float* outR = output.right + pos;
 
-    // Initialize UI first (before audio)
-    ui = new UI(synth, synthParams);
-    if (!ui->initialize()) {
-        std::cerr << "Failed to initialize UI\n";
-        delete ui;
-        delete synth;
-        delete loopManager;
-        delete midiHandler;
+                if (loopManager) {
+                    renderSynthSegment(synthL, synthR, pos, segment);
+                    looperTimer.begin();
+                    LoopGrid segmentGrid = loopGrid;
+                    segmentGrid.position += pos;
+                    loopManager->processBlock(synthL, synthR, outL, outR, segment,
+                                              loopSynced ? &segmentGrid : nullptr);
+                    looperTimer.end();
+                } else {
+                    renderSynthSegment(outL, outR, pos, segment);
+                }
+                pos = end;
+            }
+        }
+        if (loopManager) {
+            looperTimer.commit(profile::LOOPER);
+        }
+    }
+
+    // Limited, and into the device's format when it is not the planes
+    // rendered into; then the finished block into the recorder's ring
+    outputStage.process(output.left, output.right, nFrames, output.device, nFrames);
+    if (outputRecorder) {
+        outputRecorder->writeBlock(output.left, output.right, nFrames);
+    }
+
+    // Loopers that wanted a chunk and found none recorded silence. Read
+    // here rather than logged by the looper: with pipelined effects the
+    // loopers run on the effects thread, and the log has one producer
+    if (loopManager) {
+        static uint64_t starvedSeen = 0;
+        const uint64_t starved = loopManager->getChunkPool().getStarvedCount();
+        if (starved != starvedSeen) {
+            starvedSeen = starved;
+            rtLog.post(RtLog::Event::LOOP_STORAGE_STARVED, static_cast<int32_t>(starved));
+        }
+    }
+
+    // Voice, LFO and chaos state for the UI, once per callback
+    if (synth) {
+        synth->publishTelemetry();
+    }
+
+    if (loadMeter) {
+        auto busy = std::chrono::steady_clock::now() - renderStart;
+        loadMeter->recordCallback(
+            static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(busy).count()),
+            static_cast<uint64_t>(nFrames * 1e9 / streamSampleRate));
+        // Settings it changes now take effect from the next buffer
+        qualityGovernor->update(*loadMeter);
+    }
+}
+
+// RtAudio callback, for a stream in outputStage's format. The input is
+// opened only by --measure-latency, one channel, with planar float output
+int audioCallback(void* outputBuffer, void* inputBuffer,
+                  unsigned int nFrames,
+                  double /*streamTime*/,
+                  RtAudioStreamStatus status,
+                  void* /*userData*/) {
+    if (latencyProbe) {
+        float* buffer = static_cast<float*>(outputBuffer);
+        latencyProbe->process(static_cast<const float*>(inputBuffer), buffer, buffer + nFrames, nFrames);
+        return 0;
+    }
+    AudioOutput output;
+    if (outputStage.isDirect()) {
+        output.left = static_cast<float*>(outputBuffer);
+        output.right = output.left + nFrames;
+    } else if (nFrames <= deviceMixLeft.size()) {
+        output.left = deviceMixLeft.data();
+        output.right = deviceMixRight.data();
+        output.device = outputBuffer;
+    } else {
+        // Longer than the buffer the stream opened with: RtAudio never asks
+        std::memset(outputBuffer, 0, nFrames * 2 * sampleFormatBytes(outputStage.getFormat()));
+        return 0;
+    }
+    renderAudio(output, nFrames, static_cast<int32_t>(status));
+    return 0;
+}
+
+#ifdef WAKEFIELD_JACK
+// JACK process thread: the port buffers are the output planes. The
+// server's rate is followed for timing only (see JackOutput)
+static void renderJackPeriod(float* left, float* right, unsigned int nFrames, bool xrun) {
+    streamSampleRate = jackOutput->getSampleRate();
+    AudioOutput output;
+    output.left = left;
+    output.right = right;
+    renderAudio(output, nFrames, xrun ? 1 : 0);
+}
+#endif
+
+#ifdef WAKEFIELD_ALSA_MMAP
+// ALSA render thread: planes in the mmap ring, or conversion scratch
+static void renderAlsaPeriod(float* left, float* right, unsigned int nFrames, bool xrun) {
+    AudioOutput output;
+    output.left = left;
+    output.right = right;
+    renderAudio(output, nFrames, xrun ? 1 : 0);
+}
+#endif
+
+// Write a 32-bit float stereo WAV header; sizes are patched by finishFloatWAV
+static void writeFloatWAVHeader(std::ofstream& out, unsigned int sampleRate, uint32_t frames) {
+    auto put32 = [&](uint32_t v) { out.write(reinterpret_cast<const char*>(&v), 4); };
+    auto put16 = [&](uint16_t v) { out.write(reinterpret_cast<const char*>(&v), 2); };
+    const uint32_t dataBytes = frames * 2 * sizeof(float);
+    out.write("RIFF", 4);
+    put32(4 + (8 + 16) + (8 + 4) + (8 + dataBytes));
+    out.write("WAVE", 4);
+    out.write("fmt ", 4);
+    put32(16);
+    put16(3);                               // WAVE_FORMAT_IEEE_FLOAT
+    put16(2);
+    put32(sampleRate);
+    put32(sampleRate * 2 * sizeof(float));
+    put16(2 * sizeof(float));
+    put16(32);
+    out.write("fact", 4);
+    put32(4);
+    put32(frames);
+    out.write("data", 4);
+    put32(dataBytes);
+}
+
+static void finishFloatWAV(std::ofstream& out, unsigned int sampleRate, uint32_t frames) {
+    out.seekp(0);
+    writeFloatWAVHeader(out, sampleRate, frames);
+}
+
+// --loop-format value: "float" or "half" (LoopChunkPool::Format)
+static bool parseLoopFormat(const char* value, LoopChunkPool::Format& format) {
+    if (std::strcmp(value, "float") == 0) {
+        format = LoopChunkPool::Format::Float32;
+        return true;
+    }
+    if (std::strcmp(value, "half") == 0) {
+        format = LoopChunkPool::Format::Float16;
+        return true;
+    }
+    return false;
+}
+
+// --part CH:PRESET (repeatable): the rack of extra engines, one per spec,
+// rendering on threads helpers (-1: one per part beyond the first, as far
+// as the cores allow). Needs the transport clock
+static bool setupParts(const std::vector<std::string>& specs, unsigned int sampleRate, int threads,
+                       std::string& error) {
+    partRack = new PartRack(static_cast<float>(sampleRate), transportClock);
+    for (const std::string& spec : specs) {
+        const size_t colon = spec.find(':');
+        if (colon == std::string::npos || colon == 0 || colon + 1 == spec.size()) {
+            error = "--part takes CHANNEL:PRESET, got " + spec;
+            return false;
+        }
+        if (!partRack->addPart(std::atoi(spec.c_str()) - 1, spec.substr(colon + 1), error)) {
+            error = "--part " + spec + ": " + error;
+            return false;
+        }
+    }
+    if (threads < 0) {
+        const int cores = static_cast<int>(std::thread::hardware_concurrency());
+        threads = std::min(partRack->getPartCount() - 1, std::max(cores - 1, 0));
+    }
+    threads = std::min(threads, VoiceThreadPool::kMaxHelpers);
+    if (threads > 0 && !partRack->setThreads(threads)) {
+        std::cerr << "Could only start " << partRack->getThreads() << " part threads\n";
+    }
+    return true;
+}
+
+// Headless render: synth --render out.wav [options]. Drives audioCallback
+// (and so Synth::process and LoopManager::processBlock) as fast as the CPU
+// allows, without RtAudio, MIDI input or curses
+static int runOfflineRender(int argc, char** argv) {
+    std::string outputPath;
+    std::string presetName;
+    std::string midiPath;
+    std::string impulsePath;
+    std::string replayPath;
+    double seconds = -1.0;
+    double tailSeconds = 2.0;
+    unsigned int sampleRate = 48000;
+    unsigned int bufferFrames = 256;
+    unsigned int seed = 1;
+    bool soaVoices = false;
+    bool pipeline = false;
+    int voiceThreads = 0;
+    int modBlock = 0;
+    bool resampleSamples = false;
+    bool sampleMips = false;
+    LoopChunkPool::Format loopFormat = LoopChunkPool::Format::Float32;
+    int loopCount = DEFAULT_LOOPS;
+    std::vector<std::string> partSpecs;
+    int partThreads = -1;
+
+    for (int i = 1; i < argc; ++i) {
+        const bool hasValue = i + 1 < argc;
+        if (std::strcmp(argv[i], "--render") == 0 && hasValue) {
+            outputPath = argv[++i];
+        } else if (std::strcmp(argv[i], "--preset") == 0 && hasValue) {
+            presetName = argv[++i];
+        } else if (std::strcmp(argv[i], "--midi") == 0 && hasValue) {
+            midiPath = argv[++i];
+        } else if (std::strcmp(argv[i], "--ir") == 0 && hasValue) {
+            impulsePath = argv[++i];
+        } else if (std::strcmp(argv[i], "--replay") == 0 && hasValue) {
+            replayPath = argv[++i];
+        } else if (std::strcmp(argv[i], "--seconds") == 0 && hasValue) {
+            seconds = std::atof(argv[++i]);
+        } else if (std::strcmp(argv[i], "--tail") == 0 && hasValue) {
+            tailSeconds = std::atof(argv[++i]);
+        } else if (std::strcmp(argv[i], "--rate") == 0 && hasValue) {
+            sampleRate = static_cast<unsigned int>(std::atoi(argv[++i]));
+        } else if (std::strcmp(argv[i], "--buffer") == 0 && hasValue) {
+            bufferFrames = static_cast<unsigned int>(std::atoi(argv[++i]));
+        } else if (std::strcmp(argv[i], "--seed") == 0 && hasValue) {
+            seed = static_cast<unsigned int>(std::atoi(argv[++i]));
+        } else if (std::strcmp(argv[i], "--soa-voices") == 0) {
+            soaVoices = true;
+        } else if (std::strcmp(argv[i], "--resample-samples") == 0) {
+            resampleSamples = true;
+        } else if (std::strcmp(argv[i], "--sample-mips") == 0) {
+            sampleMips = true;
+        } else if (std::strcmp(argv[i], "--pipeline") == 0) {
+            pipeline = true;
+        } else if (std::strcmp(argv[i], "--voice-threads") == 0 && hasValue) {
+            voiceThreads = std::atoi(argv[++i]);
+        } else if (std::strcmp(argv[i], "--mod-block") == 0 && hasValue) {
+            modBlock = std::atoi(argv[++i]);
+        } else if (std::strcmp(argv[i], "--part") == 0 && hasValue) {
+            partSpecs.push_back(argv[++i]);
+        } else if (std::strcmp(argv[i], "--part-threads") == 0 && hasValue) {
+            partThreads = std::atoi(argv[++i]);
+        } else if (std::strcmp(argv[i], "--loop-format") == 0 && hasValue &&
+                   parseLoopFormat(argv[i + 1], loopFormat)) {
+            ++i;
+        } else if (std::strcmp(argv[i], "--loops") == 0 && hasValue) {
+            loopCount = std::atoi(argv[++i]);
+        } else if (std::strcmp(argv[i], "--memory-budget") == 0 && hasValue &&
+                   parseMemoryBudget(argv[i + 1])) {
+            ++i;
+        } else {
+            std::cerr << "Unknown or incomplete render option: " << argv[i] << "\n"
+                      << "Usage: synth --render out.wav [--preset name] [--midi file.mid]\n"
+                      << "             [--seconds s] [--tail s] [--rate hz] [--buffer frames]\n"
+                      << "             [--seed n] [--soa-voices] [--pipeline] [--voice-threads n]\n"
+                      << "             [--mod-block frames] [--loop-format float|half] [--loops n]\n"
+                      << "             [--ir impulse.wav] [--resample-samples] [--sample-mips]\n"
+                      << "             [--replay session.wfs] [--memory-budget subsystem=MB ...]\n"
+                      << "             [--part channel:preset ...] [--part-threads n]\n";
+            return 1;
+        }
+    }
+    // A capture plays at the rate and buffer size it was made with
+    if (!replayPath.empty()) {
+        if (!midiPath.empty()) {
+            std::cerr << "--replay and --midi both supply the notes; give one\n";
+            return 1;
+        }
+        sessionReplay = new SessionReplay();
+        std::string error;
+        if (!sessionReplay->load(replayPath, error)) {
+            std::cerr << "Failed to read session capture: " << error << "\n";
+            delete sessionReplay;
+            sessionReplay = nullptr;
+            return 1;
+        }
+        sampleRate = sessionReplay->getSampleRate();
+        bufferFrames = sessionReplay->getBufferFrames();
+    }
+    if (outputPath.empty() || sampleRate == 0 || bufferFrames == 0) {
+        std::cerr << "--render needs an output path, a sample rate and a buffer size\n";
+        return 1;
+    }
+
+    // Pattern generation and step probability draw from streams seeded
+    // here (rng.h); a replay takes the seed its session was captured with
+    rng::setSessionSeed(sessionReplay ? sessionReplay->getSeed() : seed);
+
+    synthParams = new SynthParameters();
+    if (!presetName.empty() && !PresetManager::loadPreset(presetName, synthParams)) {
+        std::cerr << "Failed to load preset: " << presetName << "\n";
         delete synthParams;
         return 1;
     }
-    
-    // Link synth to UI for oscilloscope
-    synth->setUI(ui);
 
-    // Link synth to parameters for FM matrix access
+    MidiFile midiFile;
+    if (!midiPath.empty()) {
+        std::string error;
+        if (!midiFile.load(midiPath, error)) {
+            std::cerr << "Failed to read MIDI file: " << error << "\n";
+            delete synthParams;
+            return 1;
+        }
+    }
+
+    synth = new Synth(static_cast<float>(sampleRate));
+    if (!impulsePath.empty()) {
+        std::string error;
+        if (!synth->loadReverbImpulse(impulsePath, error)) {
+            std::cerr << "Failed to load impulse response: " << error << "\n";
+            return 1;
+        }
+    }
+    if (soaVoices) {
+        synth->setVoiceBankEnabled(true);
+    }
+    if (voiceThreads > 0 && !synth->setVoiceThreads(voiceThreads)) {
+        std::cerr << "Could only start " << synth->getVoiceThreads() << " voice threads\n";
+    }
+    if (modBlock > 0) {
+        synth->setModulationControlFrames(static_cast<unsigned int>(modBlock));
+    }
     synth->setParams(synthParams);
+    synth->getSampleBank()->setCacheDirectory(getSampleCacheDirectory());
+    if (resampleSamples) {
+        synth->getSampleBank()->setResampleRate(sampleRate);
+    }
+    synth->getSampleBank()->setMipLevels(sampleMips);
+    if (synth->getSampleBank()->loadSamplesFromDirectory("../samples") > 0) {
+        synth->setSamplerSample(0, 0);
+    }
 
-    // Set UI pointer for MIDI error messages
-    midiHandler->setUI(ui);
+    loopManager = new LoopManager(static_cast<float>(sampleRate), loopFormat, loopCount);
+    transportClock = new Clock(static_cast<float>(sampleRate));
+    synth->setClock(transportClock);
+    sequencer = new Sequencer(transportClock, synth);
+    streamSampleRate = sampleRate;
+    if (!partSpecs.empty()) {
+        std::string error;
+        if (!setupParts(partSpecs, sampleRate, partThreads, error)) {
+            std::cerr << error << "\n";
+            return 1;
+        }
+    }
+    if (pipeline) {
+        effectsPipeline = new EffectsPipeline(synth, loopManager);
+        if (!effectsPipeline->start()) {
+            std::cerr << "Could not start the effects thread; rendering serially\n";
+        }
+    }
+
+    // A capture or a MIDI file plays instead of the sequencer; without one
+    // the current track gets a generated pattern. A capture starts the
+    // transport itself, with the session's own pattern from the preset
+    if (sessionReplay) {
+        synth->setModulationSlots(sessionReplay->getModulationSlots());
+        if (seconds < 0.0) {
+            seconds = static_cast<double>(sessionReplay->getLengthFrames()) / sampleRate + tailSeconds;
+        }
+    } else if (!midiPath.empty()) {
+        midiFilePlayer = new MidiFilePlayer(midiFile, sampleRate);
+        if (seconds < 0.0) {
+            seconds = midiFile.getDuration() + tailSeconds;
+        }
+    } else {
+        sequencer->generatePattern();
+        sequencer->finishPatternJobs();
+        sequencer->play();
+        if (seconds < 0.0) {
+            seconds = 10.0;
+        }
+    }
+
+    const uint64_t totalFrames = static_cast<uint64_t>(seconds * sampleRate);
+    std::ofstream out(outputPath, std::ios::binary);
+    if (!out) {
+        std::cerr << "Cannot write " << outputPath << "\n";
+        return 1;
+    }
+    writeFloatWAVHeader(out, sampleRate, 0);
+
+    // The output stage interleaves for the file, as it would for a device
+    prepareOutputStage(SampleFormat::FLOAT32, true, bufferFrames);
+    std::vector<float> interleaved(bufferFrames * 2);
+    double renderSeconds = 0.0;
+    double peakBufferSeconds = 0.0;
+    uint64_t buffers = 0;
+    for (uint64_t done = 0; done < totalFrames; ) {
+        unsigned int blockFrames = bufferFrames;
+        if (sessionReplay) {
+            // Buffer for buffer as captured, with its controls applied first
+            blockFrames = std::max(1u, std::min(sessionReplay->blockFramesAt(done), bufferFrames));
+            sessionReplay->applyControls(done, *synth, loopManager, sequencer);
+        }
+        const unsigned int frames = static_cast<unsigned int>(std::min<uint64_t>(blockFrames, totalFrames - done));
+
+        auto start = std::chrono::steady_clock::now();
+        audioCallback(interleaved.data(), nullptr, frames, 0.0, 0, nullptr);
+        double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        renderSeconds += elapsed;
+        peakBufferSeconds = std::max(peakBufferSeconds, elapsed);
+        ++buffers;
+
+        // Looper storage grows and samples are evicted here, as the UI loop
+        // does live (untimed)
+        loopManager->refillStorage();
+        synth->trimSamples();
+        out.write(reinterpret_cast<const char*>(interleaved.data()), frames * 2 * sizeof(float));
+        done += frames;
+    }
+    finishFloatWAV(out, sampleRate, static_cast<uint32_t>(totalFrames));
+    out.close();
+
+    const double audioSeconds = static_cast<double>(totalFrames) / sampleRate;
+    const double bufferPeriod = static_cast<double>(bufferFrames) / sampleRate;
+    std::cout << "Rendered " << outputPath << ": " << audioSeconds << " s in "
+              << renderSeconds << " s (" << (renderSeconds > 0.0 ? audioSeconds / renderSeconds : 0.0)
+              << "x realtime)\n";
+    if (buffers > 0) {
+        std::cout << "Per " << bufferFrames << "-frame buffer: mean "
+                  << renderSeconds / buffers * 1e6 << " us, peak " << peakBufferSeconds * 1e6
+                  << " us (" << 100.0 * peakBufferSeconds / bufferPeriod << "% of the deadline)\n";
+    }
+
+    // Stage breakdown when built with WAKEFIELD_PROFILE
+    if (profile::enabled()) {
+        const double ticksPerUs = profile::ticksPerMicrosecond();
+        for (int stage = 0; stage < profile::STAGE_COUNT; ++stage) {
+            profile::StageSnapshot snapshot;
+            profile::read(stage, snapshot);
+            if (snapshot.count > 0) {
+                std::cout << "  " << profile::stageName(stage) << ": " << snapshot.count << " calls, mean "
+                          << snapshot.totalTicks / ticksPerUs / snapshot.count << " us\n";
+            }
+        }
+    }
+
+    delete effectsPipeline;
+    effectsPipeline = nullptr;
+    delete partRack;
+    partRack = nullptr;
+    delete midiFilePlayer;
+    midiFilePlayer = nullptr;
+    delete sessionReplay;
+    sessionReplay = nullptr;
+    delete sequencer;
+    delete transportClock;
+    delete loopManager;
+    delete synth;
+    delete synthParams;
+    return 0;
+}
+
+// --jack or --alsa opened its device: RtAudio is not used
+static bool usingNativeBackend() {
+#ifdef WAKEFIELD_JACK
+    if (jackOutput) {
+        return true;
+    }
+#endif
+#ifdef WAKEFIELD_ALSA_MMAP
+    if (alsaOutput) {
+        return true;
+    }
+#endif
+    return false;
+}
+
+#ifdef WAKEFIELD_JACK
+// Main loop, with --jack: follow the server's buffer size in the device
+// info and report what the engine cannot follow
+static void pollJackOutput(unsigned int sampleRate, unsigned int& bufferFrames,
+                           const std::string& deviceName, const std::string& midiDeviceName, int midiPort) {
+    static bool rateReported = false;
+    static bool goneReported = false;
+    const unsigned int frames = jackOutput->getBufferFrames();
+    if (frames != bufferFrames) {
+        bufferFrames = frames;
+        consoleMessage("JACK buffer size now " + std::to_string(frames) + " frames");
+        if (ui) {
+            ui->setDeviceInfo(deviceName, sampleRate, bufferFrames, midiDeviceName, midiPort);
+        }
+    }
+    if (!rateReported && jackOutput->getSampleRate() != sampleRate) {
+        rateReported = true;
+        consoleMessage("WARNING: JACK now runs at " + std::to_string(jackOutput->getSampleRate()) +
+                       " Hz, engine runs at " + std::to_string(sampleRate) + " Hz");
+    }
+    if (!goneReported && jackOutput->isServerGone()) {
+        goneReported = true;
+        consoleMessage("WARNING: JACK server shut down - no more audio");
+    }
+}
+#endif
+
+// Leave the JACK server or close the ALSA device before shutdown or a
+// device restart
+static void closeNativeBackend() {
+#ifdef WAKEFIELD_JACK
+    if (jackOutput) {
+        jackOutput->close();
+        delete jackOutput;
+        jackOutput = nullptr;
+    }
+#endif
+#ifdef WAKEFIELD_ALSA_MMAP
+    if (alsaOutput) {
+        alsaOutput->close();
+        delete alsaOutput;
+        alsaOutput = nullptr;
+    }
+#endif
+}
+
+// Start the --capture log before the stream starts
+static void startSessionCapture(const std::string& path, unsigned int sampleRate, unsigned int bufferFrames) {
+    sessionCapture = new SessionCapture();
+    std::string error;
+    if (sessionCapture->start(path, sampleRate, bufferFrames, error)) {
+        consoleMessage("Capturing session to " + path);
+    } else {
+        consoleMessage("Session capture failed: " + error);
+        delete sessionCapture;
+        sessionCapture = nullptr;
+    }
+}
+
+// Finish the --capture log once the stream has stopped
+static void stopSessionCapture() {
+    if (!sessionCapture) {
+        return;
+    }
+    sessionCapture->stop();
+    if (sessionCapture->getDroppedCount() > 0) {
+        std::cerr << "Session capture dropped " << sessionCapture->getDroppedCount()
+                  << " records; it will not replay exactly" << std::endl;
+    }
+    delete sessionCapture;
+    sessionCapture = nullptr;
+}
+
+// Start recording the output to path (a timestamped file in the
+// recordings directory if empty). Stems need the loopers on the audio
+// thread, so --pipeline records the master only
+static void startRecording(const std::string& path, bool stems, float ringSeconds) {
+    const bool pipelined = effectsPipeline && effectsPipeline->isRunning();
+    OutputRecorder::Config config;
+    config.path = path.empty() ? OutputRecorder::getDefaultPath() : path;
+    config.sampleRate = static_cast<unsigned int>(streamSampleRate);
+    config.stems = stems && loopManager && !pipelined ? loopManager->getLoopCount() : 0;
+    config.ringSeconds = ringSeconds;
+    if (stems && pipelined) {
+        consoleMessage("Recorder: no loop stems with --pipeline, master only");
+    }
+    std::string error;
+    if (!outputRecorder->start(config, error)) {
+        consoleMessage(error);
+        return;
+    }
+    if (config.stems > 0) {
+        loopManager->setStemTap(outputRecorder->getStemTap());
+    }
+    consoleMessage("Recording to " + config.path + (config.stems > 0 ? " with loop stems" : ""));
+}
+
+static void stopRecording() {
+    if (!outputRecorder->isRecording()) {
+        return;
+    }
+    if (loopManager) {
+        loopManager->setStemTap(nullptr);
+    }
+    std::string summary;
+    outputRecorder->stop(summary);
+    consoleMessage(summary);
+}
+
+// Recorder messages, and a warning each time the ring's high-water mark
+// passes another quarter: the disk is falling behind
+static void pollRecorder() {
+    static uint32_t warnedQuarter = 0;
+    std::string message;
+    while (outputRecorder->pollMessage(message)) {
+        consoleMessage(message);
+    }
+    if (!outputRecorder->isRecording()) {
+        warnedQuarter = 0;
+        return;
+    }
+    const OutputRecorder::Stats stats = outputRecorder->getStats();
+    const uint32_t quarter = stats.ringFrames ? stats.highWaterFrames * 4 / stats.ringFrames : 0;
+    if (quarter > warnedQuarter && quarter >= 2) {
+        warnedQuarter = quarter;
+        char text[128];
+        std::snprintf(text, sizeof(text), "Recorder: ring reached %u%% (%.1f s), disk is slow",
+                      stats.highWaterFrames * 100 / stats.ringFrames,
+                      stats.highWaterFrames / streamSampleRate);
+        consoleMessage(text);
+    }
+}
+
+// Hand the exporter what the UI loop already reads; xruns is the total
+// since start
+static void publishMetrics(uint64_t xruns) {
+    MetricsSnapshot snapshot;
+    const CPUMonitor& meter = *loadMonitor;
+    snapshot.loadMean = meter.getMeanLoad();
+    snapshot.loadPeak = meter.getPeakLoad();
+    snapshot.loadP99 = meter.getP99Load();
+    snapshot.loadHistogram = meter.getLoadHistogram();
+    snapshot.overloads = meter.getOverloadCount();
+    snapshot.xruns = xruns;
+    snapshot.activeVoices = ui ? ui->getTelemetry().activeVoices : synth->readTelemetry().activeVoices;
+    snapshot.maxVoices = MAX_VOICES;
+    const LoopChunkPool& pool = loopManager->getChunkPool();
+    snapshot.loopBytes = pool.getAllocatedBytes();
+    snapshot.loopFreeChunks = pool.getFreeCount();
+    snapshot.loopStarved = pool.getStarvedCount();
+    SampleBank* bank = synth->getSampleBank();
+    snapshot.sampleCacheHits = bank->getCacheHits();
+    snapshot.sampleCacheMisses = bank->getCacheMisses();
+    snapshot.streamUnderruns = bank->getStreamUnderruns();
+    for (int i = 0; i < memstats::SUBSYSTEM_COUNT; ++i) {
+        snapshot.memory[i] = memstats::read(i);
+    }
+    metricsExporter->publish(snapshot);
+}
+
+// Main loop, with --shm: apply what the attached UIs sent, as the
+// in-process UI would from this thread, then publish the state and the
+// newest scope frames for them to draw
+static void serveShmBridge(uint64_t xruns) {
+    shmBridge->drainCommands([](const ShmCommand& command) {
+        if (command.type == ShmCommand::Type::BUTTON) {
+            if (command.slot <= static_cast<uint8_t>(OscServer::Command::LOOP_CLEAR)) {
+                runButtonCommand(static_cast<OscServer::Command>(command.slot));
+            }
+        } else if (command.slot < OscServer::kParameterSlots) {
+            applyNormalizedToParameter(command.slot, std::min(std::max(command.value, 0.0f), 1.0f));
+        } else if (command.slot == OscServer::kSlotMorph) {
+            synthParams->presetMorph = std::min(std::max(command.value, 0.0f), 1.0f);
+        } else if (command.slot == OscServer::kSlotTempo && sequencer && !midiClockIn) {
+            sequencer->setTempo(command.value);
+        }
+    });
+
+    static ShmEngineState state;
+    synthParams->captureBlock(state.params);
+    const SynthTelemetry& telemetry = synth->readTelemetry();
+    state.callbacks = telemetry.callbacks;
+    state.activeVoices = telemetry.activeVoices;
+    state.maxVoices = std::min(MAX_VOICES, ShmEngineState::kMaxVoices);
+    for (int v = 0; v < state.maxVoices; ++v) {
+        state.voiceNote[v] = static_cast<int8_t>(telemetry.voiceActive[v] ? telemetry.voiceNote[v] : -1);
+        state.voiceEnvelope[v] = telemetry.voiceEnvelope[v];
+    }
+    for (int i = 0; i < 4; ++i) {
+        state.lfoValue[i] = telemetry.lfoValue[i];
+        state.chaosX[i] = telemetry.chaosX[i];
+        state.chaosY[i] = telemetry.chaosY[i];
+        Looper* loop = loopManager->getLoop(i);
+        state.loopState[i] = loop ? static_cast<int>(loop->getState()) : 0;
+    }
+    state.loadMean = loadMonitor->getMeanLoad();
+    state.loadP99 = loadMonitor->getP99Load();
+    state.loadPeak = loadMonitor->getPeakLoad();
+    state.overloads = loadMonitor->getOverloadCount();
+    state.xruns = xruns;
+    state.qualityLevel = qualityGovernor->getLevel();
+    state.playing = sequencer->isPlaying();
+    state.tempo = static_cast<float>(sequencer->getTempo());
+    shmBridge->publishState(state);
+
+    static float scope[ShmSegment::kScopeFrames];
+    shmBridge->publishScope(scope, synth->getScope().readLatest(scope, ShmSegment::kScopeFrames));
+}
+
+// --measure-latency: play an MLS on the configured output device, record
+// it on an input channel looped back to it (--latency-input, 1-based) and
+// store the round trip in device_config.txt. The input is the output
+// device's own when it has one, otherwise the default input
+static int runLatencyMeasurement(int argc, char** argv) {
+    signal(SIGINT, signalHandler);
+
+    int audioDevice = -1;
+    int midiPort = -1;
+    unsigned int configRate = 48000;
+    unsigned int configBuffer = 256;
+    rtsetup::Options realtime;
+    readDeviceConfig(audioDevice, midiPort, configRate, configBuffer, realtime);
+    unsigned int sampleRate = configRate;
+    unsigned int bufferFrames = configBuffer;
+    int inputChannel = 1;
+    for (int i = 1; i < argc; ++i) {
+        const bool hasValue = i + 1 < argc;
+        if (std::strcmp(argv[i], "--rate") == 0 && hasValue) {
+            sampleRate = static_cast<unsigned int>(std::atoi(argv[++i]));
+        } else if (std::strcmp(argv[i], "--buffer") == 0 && hasValue) {
+            bufferFrames = static_cast<unsigned int>(std::atoi(argv[++i]));
+        } else if (std::strcmp(argv[i], "--latency-input") == 0 && hasValue) {
+            inputChannel = std::max(std::atoi(argv[++i]), 1);
+        }
+    }
+
+    RtAudio audio;
+    const unsigned int deviceCount = audio.getDeviceCount();
+    if (deviceCount == 0) {
+        std::cerr << "No audio devices found\n";
+        return 1;
+    }
+    const int outputDevice = audioDevice >= 0 && audioDevice < static_cast<int>(deviceCount)
+                           ? audioDevice : static_cast<int>(audio.getDefaultOutputDevice());
+    int inputDevice = static_cast<int>(audio.getDefaultInputDevice());
+    std::string outputName;
+    try {
+        RtAudio::DeviceInfo info = audio.getDeviceInfo(outputDevice);
+        outputName = info.name;
+        if (info.inputChannels >= static_cast<unsigned int>(inputChannel)) {
+            inputDevice = outputDevice;
+        }
+    } catch (...) {
+    }
+    sampleRate = resolveSampleRate(audio, outputDevice, sampleRate);
+
+    RtAudio::StreamParameters outputParameters;
+    outputParameters.deviceId = outputDevice;
+    outputParameters.nChannels = 2;
+    outputParameters.firstChannel = 0;
+    RtAudio::StreamParameters inputParameters;
+    inputParameters.deviceId = inputDevice;
+    inputParameters.nChannels = 1;
+    inputParameters.firstChannel = inputChannel - 1;
+
+    // The same stream setup as a live run, so the buffering matches
+    RtAudio::StreamOptions streamOptions;
+    streamOptions.flags = RTAUDIO_NONINTERLEAVED;
+    prepareOutputStage(SampleFormat::FLOAT32, false, bufferFrames);
+    if (realtime.realtime) {
+        streamOptions.flags |= RTAUDIO_SCHEDULE_REALTIME;
+        streamOptions.priority = realtime.priority;
+    }
+
+    LatencyProbe probe;
+    std::cout << "Measuring " << outputName << " at " << sampleRate << " Hz, " << bufferFrames
+              << "-frame buffers: loop output 1 back to input " << inputChannel << std::endl;
+    long streamLatency = 0;
+    try {
+        audio.openStream(&outputParameters, &inputParameters, RTAUDIO_FLOAT32, sampleRate, &bufferFrames,
+                         &audioCallback, nullptr, &streamOptions);
+        latencyProbe = &probe;
+        audio.startStream();
+        // The probe's length plus a second of slack for the stream to start
+        const double limit = static_cast<double>(probe.getTotalFrames()) / sampleRate + 1.0;
+        for (double waited = 0.0; running && !probe.isDone() && waited < limit; waited += 0.02) {
+            usleep(20000);
+        }
+        streamLatency = audio.getStreamLatency();
+        audio.stopStream();
+        audio.closeStream();
+    } catch (std::exception& e) {
+        std::cerr << "Audio error: " << e.what() << '\n';
+        latencyProbe = nullptr;
+        return 1;
+    }
+    latencyProbe = nullptr;
+    if (!probe.isDone()) {
+        std::cerr << "Measurement did not complete\n";
+        return 1;
+    }
+
+    const LatencyProbe::Result result = probe.analyse();
+    if (!result.found) {
+        std::cerr << "No loopback found on input " << inputChannel << " (peak ratio "
+                  << result.peakRatio << ")\n";
+        return 1;
+    }
+    // The stream's own buffers (RtAudio's figure, input plus output); the
+    // rest is the converters, driver and hardware
+    const unsigned int buffering = streamLatency > 0 ? static_cast<unsigned int>(streamLatency) : 2 * bufferFrames;
+    const unsigned int device = result.frames > buffering ? result.frames - buffering : 0;
+    auto ms = [sampleRate](unsigned int frames) { return 1000.0 * frames / sampleRate; };
+    std::cout << "Round trip: " << result.frames << " frames (" << ms(result.frames) << " ms)\n"
+              << "  buffers:  " << buffering << " frames (" << ms(buffering) << " ms)\n"
+              << "  device:   " << device << " frames (" << ms(device) << " ms)\n";
+    if (result.inverted) {
+        std::cout << "The input is polarity-inverted\n";
+    }
+
+    measuredLatency.audioDevice = outputDevice;
+    measuredLatency.sampleRate = sampleRate;
+    measuredLatency.bufferFrames = bufferFrames;
+    measuredLatency.roundTripFrames = result.frames;
+    measuredLatency.bufferingFrames = buffering;
+    writeDeviceConfig(audioDevice, midiPort, configRate, configBuffer, realtime);
+    std::cout << "Saved to " << getConfigDirectory() << "/device_config.txt" << std::endl;
+    return 0;
+}
+
+int main(int argc, char** argv) {
+    setlocale(LC_ALL, "");
+
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--render") == 0) {
+            return runOfflineRender(argc, argv);
+        }
+        if (std::strcmp(argv[i], "--measure-latency") == 0) {
+            return runLatencyMeasurement(argc, argv);
+        }
+    }
+
+    // Per-phase startup times, shown once the UI is up
+    StartupTimeline startup;
+
+    // Set up signal handler for Ctrl+C
+    signal(SIGINT, signalHandler);
+    signal(SIGTERM, signalHandler);             // How a service manager stops --headless
     
-    // Get list of available audio devices
-    std::vector<std::pair<int, std::string>> audioDevices;
-    unsigned int deviceCount = audio.getDeviceCount();
-    int audioDeviceIdToUse = -1;
+    // Create synth parameters
+    synthParams = new SynthParameters();
     
-    for (unsigned int i = 0; i < deviceCount; ++i) {
-        try {
-            RtAudio::DeviceInfo info = audio.getDeviceInfo(i);
-            if (info.outputChannels > 0) {  // Only list output devices
-                audioDevices.push_back({static_cast<int>(i), info.name});
+    // Read device preferences; the command line overrides the stored ones
+    int preferredAudioDevice = -1;
+    int preferredMidiPort = -1;
+    unsigned int sampleRate = 48000;
+    unsigned int bufferFrames = 256;
+    LoopChunkPool::Format loopFormat = LoopChunkPool::Format::Float32;
+    int loopCount = DEFAULT_LOOPS;
+    MetricsExporter::Config metricsConfig;
+    bool headless = false;
+    bool useJack = false;
+    std::string alsaDevice;
+    unsigned int alsaPeriods = 2;
+    std::string shmName;
+    std::vector<std::string> partSpecs;
+    int partThreads = -1;
+    std::string presetName;
+    std::string sessionName;
+    int autosaveSeconds = SessionAutosave::kDefaultIntervalSeconds;
+    std::string recordPath;
+    bool recordStems = false;
+    float recordRingSeconds = OutputRecorder::kDefaultRingSeconds;
+    bool forceSampleFormat = false;
+    SampleFormat requestedSampleFormat = SampleFormat::FLOAT32;
+    bool dither = true;
+    std::string governorSteps;
+    std::string capturePath;                    // --capture: the log for --render --replay
+    readDeviceConfig(preferredAudioDevice, preferredMidiPort, sampleRate, bufferFrames, realtimeOptions);
+    for (int i = 1; i < argc; ++i) {
+        const bool hasValue = i + 1 < argc;
+        if (std::strcmp(argv[i], "--rate") == 0 && hasValue) {
+            sampleRate = static_cast<unsigned int>(std::atoi(argv[++i]));
+        } else if (std::strcmp(argv[i], "--buffer") == 0 && hasValue) {
+            bufferFrames = static_cast<unsigned int>(std::atoi(argv[++i]));
+        } else if (std::strcmp(argv[i], "--realtime") == 0) {
+            realtimeOptions.realtime = true;
+        } else if (std::strcmp(argv[i], "--rt-priority") == 0 && hasValue) {
+            realtimeOptions.realtime = true;
+            realtimeOptions.priority = std::atoi(argv[++i]);
+        } else if (std::strcmp(argv[i], "--audio-cpu") == 0 && hasValue) {
+            realtimeOptions.audioCpu = std::atoi(argv[++i]);
+        } else if (std::strcmp(argv[i], "--ui-cpu") == 0 && hasValue) {
+            realtimeOptions.uiCpu = std::atoi(argv[++i]);
+        } else if (std::strcmp(argv[i], "--mlock") == 0) {
+            realtimeOptions.lockMemory = true;
+        } else if (std::strcmp(argv[i], "--headless") == 0) {
+            headless = true;
+        } else if (std::strcmp(argv[i], "--jack") == 0) {
+            useJack = true;
+        } else if (std::strcmp(argv[i], "--alsa") == 0 && hasValue) {
+            alsaDevice = argv[++i];
+        } else if (std::strcmp(argv[i], "--alsa-periods") == 0 && hasValue) {
+            alsaPeriods = static_cast<unsigned int>(std::max(std::atoi(argv[++i]), 2));
+        } else if (std::strcmp(argv[i], "--sample-format") == 0 && hasValue) {
+            if (!parseSampleFormat(argv[++i], requestedSampleFormat)) {
+                std::cerr << "--sample-format takes float, s32, s24 or s16\n";
+                delete synthParams;
+                return 1;
+            }
+            forceSampleFormat = true;
+        } else if (std::strcmp(argv[i], "--no-dither") == 0) {
+            dither = false;
+        } else if (std::strcmp(argv[i], "--governor") == 0 && hasValue) {
+            governorSteps = argv[++i];
+        } else if (std::strcmp(argv[i], "--capture") == 0 && hasValue) {
+            capturePath = argv[++i];
+        } else if (std::strcmp(argv[i], "--shm") == 0 && hasValue) {
+            shmName = argv[++i];
+            headless = true;
+        } else if (std::strcmp(argv[i], "--preset") == 0 && hasValue) {
+            presetName = argv[++i];
+        } else if (std::strcmp(argv[i], "--session") == 0 && hasValue) {
+            sessionName = argv[++i];
+        } else if (std::strcmp(argv[i], "--autosave") == 0 && hasValue) {
+            autosaveSeconds = std::max(std::atoi(argv[++i]), 0);
+        } else if (std::strcmp(argv[i], "--record") == 0 && hasValue) {
+            recordPath = argv[++i];
+        } else if (std::strcmp(argv[i], "--record-stems") == 0) {
+            recordStems = true;
+        } else if (std::strcmp(argv[i], "--record-ring") == 0 && hasValue) {
+            recordRingSeconds = static_cast<float>(std::atof(argv[++i]));
+        } else if (std::strcmp(argv[i], "--part") == 0 && hasValue) {
+            partSpecs.push_back(argv[++i]);
+        } else if (std::strcmp(argv[i], "--part-threads") == 0 && hasValue) {
+            partThreads = std::atoi(argv[++i]);
+        } else if (std::strcmp(argv[i], "--osc-port") == 0 && hasValue) {
+            oscServer = new OscServer();
+            if (!oscServer->start(std::atoi(argv[++i]))) {
+                delete oscServer;
+                oscServer = nullptr;
+            }
+        } else if (std::strcmp(argv[i], "--metrics-port") == 0 && hasValue) {
+            metricsConfig.prometheusPort = std::atoi(argv[++i]);
+        } else if (std::strcmp(argv[i], "--statsd") == 0 && hasValue) {
+            // host or host:port
+            std::string target = argv[++i];
+            const size_t colon = target.rfind(':');
+            if (colon != std::string::npos) {
+                metricsConfig.statsdPort = std::atoi(target.c_str() + colon + 1);
+                target.resize(colon);
+            }
+            metricsConfig.statsdHost = target;
+        } else if (std::strcmp(argv[i], "--midi-clock-in") == 0) {
+            midiClockIn = true;
+        } else if (std::strcmp(argv[i], "--midi-clock-out") == 0 && hasValue) {
+            const char* port = argv[++i];
+            midiClockOutput = new MidiClockOutput();
+            if (!midiClockOutput->open(std::strcmp(port, "virtual") == 0 ? -1 : std::atoi(port))) {
+                delete midiClockOutput;
+                midiClockOutput = nullptr;
+            }
+        } else if (std::strcmp(argv[i], "--loop-format") == 0 && hasValue) {
+            if (!parseLoopFormat(argv[++i], loopFormat)) {
+                std::cerr << "--loop-format takes float or half\n";
+                delete synthParams;
+                return 1;
+            }
+        } else if (std::strcmp(argv[i], "--loops") == 0 && hasValue) {
+            loopCount = std::atoi(argv[++i]);
+        } else if (std::strcmp(argv[i], "--memory-budget") == 0 && hasValue) {
+            if (!parseMemoryBudget(argv[++i])) {
+                std::cerr << "--memory-budget takes subsystem=MB; subsystems are looper, samples, voices, "
+                             "reverb, sequencer and scope\n";
+                delete synthParams;
+                return 1;
             }
-        } catch (...) {
-            continue;
         }
     }
+    realtimeOptions.priority = std::min(std::max(realtimeOptions.priority, 1), 99);
+    if (realtimeOptions.realtime) {
+        realtimeStatus.schedule.store(rtsetup::Result::PENDING);
+    }
+    if (realtimeOptions.audioCpu >= 0) {
+        realtimeStatus.audioAffinity.store(rtsetup::Result::PENDING);
+    }
+    if (sampleRate == 0 || bufferFrames == 0) {
+        std::cerr << "Sample rate and buffer size must be positive\n";
+        delete synthParams;
+        return 1;
+    }
+    if (!metricsConfig.statsdHost.empty() || metricsConfig.prometheusPort > 0) {
+        metricsConfig.cpu = realtimeOptions.uiCpu;
+        metricsExporter = new MetricsExporter();
+        if (!metricsExporter->start(metricsConfig)) {
+            delete metricsExporter;
+            metricsExporter = nullptr;
+        }
+    }
+    mkdir(getConfigDirectory().c_str(), 0755);
+    rtLog.start(getConfigDirectory() + "/wakefield.log");
+    startup.mark("config");
     
-    // Determine which audio device to use
+    // Initialize MIDI. Only the client here: the port scan waits until
+    // the audio stream is running
+    midiHandler = new MidiHandler();
+    if (!midiHandler->initialize()) {
+        std::cerr << "Failed to initialize MIDI\n";
+        delete midiHandler;
+        delete synthParams;
+        return 1;
+    }
+    
+    // No-op unless built with WAKEFIELD_RT_CHECK
+    rtcheck::install();
+
+    // Initialize Audio
+    RtAudio audio;
+    bool audioAvailable = false;
+
+    // --jack: the server sets the rate, buffer size and process thread
+    // priority; without a server, fall back to RtAudio
+    if (useJack) {
+#ifdef WAKEFIELD_JACK
+        jackOutput = new JackOutput();
+        std::string error;
+        if (jackOutput->open("wakefield", error)) {
+            sampleRate = jackOutput->getSampleRate();
+            bufferFrames = jackOutput->getBufferFrames();
+            realtimeOptions.realtime = jackOutput->isRealtime();
+            if (realtimeOptions.realtime) {
+                realtimeOptions.priority = jackOutput->getRealtimePriority();
+                realtimeStatus.schedule.store(rtsetup::Result::PENDING);
+            } else {
+                realtimeStatus.schedule.store(rtsetup::Result::OFF);
+            }
+            std::cout << "JACK: connected as " << jackOutput->getClientName() << "\n";
+        } else {
+            std::cout << "JACK: " << error << ", using RtAudio\n";
+            delete jackOutput;
+            jackOutput = nullptr;
+        }
+#else
+        std::cout << "--jack needs a build with -DWAKEFIELD_JACK=ON, using RtAudio\n";
+#endif
+    }
+
+    // --alsa: the device's ring directly, at --rate and with --buffer-frame
+    // periods as far as the device allows
+    if (!alsaDevice.empty() && !usingNativeBackend()) {
+#ifdef WAKEFIELD_ALSA_MMAP
+        alsaOutput = new AlsaOutput();
+        std::string error;
+        if (alsaOutput->open(alsaDevice, sampleRate, bufferFrames, alsaPeriods, error)) {
+            sampleRate = alsaOutput->getSampleRate();
+            bufferFrames = alsaOutput->getPeriodFrames();
+            const double latencyMs = 1000.0 * bufferFrames * alsaOutput->getPeriods() / sampleRate;
+            std::cout << "ALSA: " << alsaDevice << ", " << alsaOutput->getFormatName() << ", "
+                      << alsaOutput->getPeriods() << " x " << bufferFrames << " frames ("
+                      << latencyMs << " ms)" << (alsaOutput->isDirect() ? "" : ", converted") << "\n";
+        } else {
+            std::cout << "ALSA: " << error << ", using RtAudio\n";
+            delete alsaOutput;
+            alsaOutput = nullptr;
+        }
+#else
+        std::cout << "--alsa needs a build with -DWAKEFIELD_ALSA_MMAP=ON, using RtAudio\n";
+        (void)alsaPeriods;
+#endif
+    }
+
+    // Pick the audio device now: the engine is built at a rate it supports
+    unsigned int deviceCount = audio.getDeviceCount();
+    int audioDeviceIdToUse = -1;
     if (preferredAudioDevice >= 0 && preferredAudioDevice < static_cast<int>(deviceCount)) {
         audioDeviceIdToUse = preferredAudioDevice;
         std::cout << "Using preferred audio device: " << preferredAudioDevice << "\n";
@@ -729,10 +2381,192 @@ int main(int argc, char** argv) {
         audioDeviceIdToUse = audio.getDefaultOutputDevice();
         std::cout << "Using default audio device: " << audioDeviceIdToUse << "\n";
     }
+    if (deviceCount > 0 && !usingNativeBackend()) {
+        unsigned int supportedRate = resolveSampleRate(audio, audioDeviceIdToUse, sampleRate);
+        if (supportedRate != sampleRate) {
+            std::cout << "Device does not support " << sampleRate << " Hz, using "
+                      << supportedRate << " Hz" << std::endl;
+            sampleRate = supportedRate;
+        }
+    }
+    std::cout << "Engine: " << sampleRate << " Hz, " << bufferFrames << "-frame buffers" << std::endl;
+    startup.mark("audio device");
     
-    // Try to initialize audio
+    // Create synth instance
+    synth = new Synth(static_cast<float>(sampleRate));
+
+    // --soa-voices renders oscillators through the SIMD voice bank; --ir
+    // gives the Convolution reverb type its impulse response; --mod-block
+    // sets the modulation control block; --resample-samples converts
+    // samples to the engine rate as they load; --sample-mips gives them
+    // decimated copies for pitched-up playback; --seed sets the session
+    // seed of the sequencer's random streams (before it is built below)
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--ir") == 0 && i + 1 < argc) {
+            std::string error;
+            if (synth->loadReverbImpulse(argv[++i], error)) {
+                std::cout << "Impulse response: " << argv[i] << std::endl;
+            } else {
+                std::cerr << "Failed to load impulse response: " << error << std::endl;
+            }
+        } else if (std::strcmp(argv[i], "--soa-voices") == 0) {
+            synth->setVoiceBankEnabled(true);
+            std::cout << "SoA voice bank enabled (" << VoiceBank::backendName() << ")" << std::endl;
+        } else if (std::strcmp(argv[i], "--mod-block") == 0 && i + 1 < argc) {
+            // Frames between modulation matrix evaluations (1 = every sample)
+            synth->setModulationControlFrames(static_cast<unsigned int>(std::max(1, std::atoi(argv[++i]))));
+            std::cout << "Modulation control block: " << synth->getModulationControlFrames() << " frames" << std::endl;
+        } else if (std::strcmp(argv[i], "--resample-samples") == 0) {
+            synth->getSampleBank()->setResampleRate(sampleRate);
+            std::cout << "Resampling samples to " << sampleRate << " Hz" << std::endl;
+        } else if (std::strcmp(argv[i], "--sample-mips") == 0) {
+            synth->getSampleBank()->setMipLevels(true);
+            std::cout << "Sample mip levels enabled" << std::endl;
+        } else if (std::strcmp(argv[i], "--seed") == 0 && i + 1 < argc) {
+            rng::setSessionSeed(std::strtoull(argv[++i], nullptr, 10));
+            std::cout << "Session seed: " << rng::sessionSeed() << std::endl;
+        }
+    }
+
+    // --voice-threads N renders voices on N helper threads plus the audio thread
+    for (int i = 1; i + 1 < argc; ++i) {
+        if (std::strcmp(argv[i], "--voice-threads") == 0) {
+            int helpers = std::atoi(argv[i + 1]);
+            if (!synth->setVoiceThreads(helpers)) {
+                std::cerr << "Could only start " << synth->getVoiceThreads() << " voice threads" << std::endl;
+            }
+            if (synth->getVoiceThreads() > 0) {
+                std::cout << "Parallel voices: " << synth->getVoiceThreads() << " helper threads, "
+                          << MAX_VOICES << " voices" << std::endl;
+            }
+            break;
+        }
+    }
+
+    // Create looper manager
+    loopManager = new LoopManager(static_cast<float>(sampleRate), loopFormat, loopCount);
+
+    // --pipeline runs the filter, reverb and loopers on a second thread,
+    // one block behind the voices
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--pipeline") == 0) {
+            effectsPipeline = new EffectsPipeline(synth, loopManager);
+            if (effectsPipeline->start()) {
+                std::cout << "Pipelined effects enabled (+" << bufferFrames << " frames latency)" << std::endl;
+            } else {
+                std::cerr << "Could not start the effects thread; rendering serially" << std::endl;
+            }
+            break;
+        }
+    }
+
+    // Create shared transport clock
+    transportClock = new Clock(static_cast<float>(sampleRate));
+
+    // Provide clock to synth and sequencer
+    synth->setClock(transportClock);
+
+    // Create sequencer
+    sequencer = new Sequencer(transportClock, synth);
+    transportClock->enableExternalSync(midiClockIn);
+
+    if (!partSpecs.empty()) {
+        std::string error;
+        if (!setupParts(partSpecs, sampleRate, partThreads, error)) {
+            std::cerr << error << std::endl;
+            return 1;
+        }
+        std::cout << "Parts: " << partRack->getPartCount() << " on their MIDI channels, "
+                  << partRack->getThreads() << " helper threads" << std::endl;
+    }
+
+    // Link synth to parameters for FM matrix access
+    synth->setParams(synthParams);
+    startup.mark("engine");
+
+    // Samples from ../samples (relative to project root) load in the
+    // background while the oscillators play; the UI loop adds them to the
+    // bank when they are ready
+    synth->getSampleBank()->setCacheDirectory(getSampleCacheDirectory());
+    BackgroundSampleLoad sampleLoad;
+    sampleLoad.start(*synth->getSampleBank(), "../samples");
+    std::cout << "Loading samples from ../samples in the background" << std::endl;
+
+    // Lock memory now (samples mapped and looper chunks allocated later are
+    // locked too, through MCL_FUTURE)
+    rtsetup::lockMemory(realtimeOptions, realtimeStatus);
+    if (realtimeStatus.memoryLock == rtsetup::Result::FAILED) {
+        std::cerr << "mlockall failed: " << std::strerror(realtimeStatus.memoryLockError)
+                  << " (raise the memlock limit)" << std::endl;
+    }
+
+    // Render a few hundred blocks through the voices, filters, reverbs and
+    // a loop before the stream starts, so the first notes don't pay for
+    // cold caches and first-touch page faults
+    synth->warmUp(bufferFrames, kWarmUpBlocks);
+    loopManager->warmUp(bufferFrames, kWarmUpBlocks);
+    startup.mark("warm-up");
+
+    // Create the UI before audio starts, for the load meter and governor
+    // the callback reads; the terminal is set up once audio runs.
+    // --headless runs without one, driven by MIDI, OSC and presets: no
+    // curses, no drawing, no scope feed
+    CPUMonitor headlessLoadMonitor;
+    QualityGovernor headlessGovernor;
+    if (headless) {
+        loadMonitor = &headlessLoadMonitor;
+        qualityGovernor = &headlessGovernor;
+        synth->setScopeEnabled(!shmName.empty());
+    } else {
+        ui = new UI(synth, synthParams);
+        loadMonitor = &ui->getCPUMonitor();
+        qualityGovernor = &ui->getQualityGovernor();
+    }
+
+    // --governor lists the quality steps the load governor may take, in
+    // order (reverb, sampler, oversampling, voices), or off
+    if (!governorSteps.empty() && !qualityGovernor->configure(governorSteps.c_str())) {
+        std::cerr << "Unknown --governor step in " << governorSteps
+                  << " (reverb, sampler, oversampling, voices or off)" << std::endl;
+    }
+
+    // Start audio: the oscillators sound from here on
     std::string audioDeviceName = "No Audio Device";
     
+#ifdef WAKEFIELD_JACK
+    if (jackOutput) {
+        streamSampleRate = sampleRate;
+        if (!capturePath.empty()) {
+            startSessionCapture(capturePath, sampleRate, bufferFrames);
+        }
+        std::string error;
+        if (jackOutput->start(renderJackPeriod, true, error)) {
+            audioAvailable = true;
+            audioDeviceName = "JACK (" + jackOutput->getClientName() + ")";
+            consoleMessage("Audio initialized: " + audioDeviceName);
+        } else {
+            consoleMessage("WARNING: JACK " + error + " - running without audio");
+            stopSessionCapture();
+        }
+    } else
+#endif
+#ifdef WAKEFIELD_ALSA_MMAP
+    if (alsaOutput) {
+        streamSampleRate = sampleRate;
+        if (!capturePath.empty()) {
+            startSessionCapture(capturePath, sampleRate, bufferFrames);
+        }
+        std::string error;
+        if (alsaOutput->start(renderAlsaPeriod, realtimeOptions.realtime ? realtimeOptions.priority : 0, error)) {
+            audioAvailable = true;
+            audioDeviceName = "ALSA mmap (" + alsaDevice + ")";
+            consoleMessage("Audio initialized: " + audioDeviceName);
+        } else {
+            consoleMessage("WARNING: ALSA " + error + " - running without audio");
+            stopSessionCapture();
+        }
+    } else
+#endif
     if (deviceCount > 0) {
         // Set up stream parameters
         RtAudio::StreamParameters parameters;
@@ -740,10 +2574,36 @@ int main(int argc, char** argv) {
         parameters.nChannels = 2;  // Stereo
         parameters.firstChannel = 0;
         
+        // Planar device buffers in the device's own format (or --sample-format):
+        // a float device has the looper output written straight in, any
+        // other has it converted by the output stage
+        RtAudio::StreamOptions streamOptions;
+        streamOptions.flags = RTAUDIO_NONINTERLEAVED;
+        if (realtimeOptions.realtime) {
+            streamOptions.flags |= RTAUDIO_SCHEDULE_REALTIME;
+            streamOptions.priority = realtimeOptions.priority;
+        }
+        const SampleFormat streamFormat = forceSampleFormat ? requestedSampleFormat
+                                          : resolveSampleFormat(audio, parameters.deviceId);
+        outputStage.setDither(dither);
+
         try {
-            audio.openStream(&parameters, nullptr, RTAUDIO_FLOAT32,
-                            sampleRate, &bufferFrames, &audioCallback);
-            
+            audio.openStream(&parameters, nullptr, rtAudioFormat(streamFormat),
+                            sampleRate, &bufferFrames, &audioCallback,
+                            nullptr, &streamOptions);
+            prepareOutputStage(streamFormat, false, bufferFrames);
+            unsigned int openedRate = audio.getStreamSampleRate();
+            streamSampleRate = openedRate > 0 ? openedRate : sampleRate;
+            if (streamSampleRate != sampleRate) {
+                // Tuning and envelope times follow the engine rate, not the stream's
+                consoleMessage("WARNING: stream opened at " + std::to_string(openedRate) +
+                               " Hz, engine runs at " + std::to_string(sampleRate) + " Hz");
+            }
+
+            if (!capturePath.empty()) {
+                startSessionCapture(capturePath, sampleRate, bufferFrames);
+            }
+
             audio.startStream();
             audioAvailable = true;
             
@@ -755,23 +2615,128 @@ int main(int argc, char** argv) {
                 audioDeviceName = "Default Audio Device";
             }
             
-            ui->addConsoleMessage("Audio initialized: " + audioDeviceName);
+            std::string formatNote = sampleFormatName(streamFormat);
+            if (outputStage.isDithered()) {
+                formatNote += ", dithered";
+            }
+            consoleMessage("Audio initialized: " + audioDeviceName + " (" + formatNote + ")");
+            if (measuredLatency.roundTripFrames > 0 && measuredLatency.audioDevice == audioDeviceIdToUse &&
+                measuredLatency.sampleRate == sampleRate && measuredLatency.bufferFrames == bufferFrames) {
+                consoleMessage("Round trip (measured): " +
+                               std::to_string(1000 * measuredLatency.roundTripFrames / sampleRate) + " ms");
+            }
             
         } catch (std::exception& e) {
             std::cerr << "Audio error: " << e.what() << '\n';
-            ui->addConsoleMessage("WARNING: Audio failed - running without audio");
+            consoleMessage("WARNING: Audio failed - running without audio");
             audioAvailable = false;
         }
     } else {
-        ui->addConsoleMessage("WARNING: No audio devices found - running without audio");
+        consoleMessage("WARNING: No audio devices found - running without audio");
+    }
+    startup.mark("audio start");
+
+    // Stop whichever backend runs, before the engine goes
+    auto stopAudio = [&]() {
+        closeNativeBackend();
+        if (audioAvailable) {
+            if (audio.isStreamRunning()) {
+                audio.stopStream();
+            }
+            if (audio.isStreamOpen()) {
+                audio.closeStream();
+            }
+        }
+        stopSessionCapture();
+    };
+
+    if (ui && !ui->initialize()) {
+        std::cerr << "Failed to initialize UI\n";
+        stopAudio();
+        sampleLoad.finish();
+        delete effectsPipeline;
+        delete partRack;
+        delete ui;
+        delete sequencer;
+        delete synth;
+        delete loopManager;
+        delete midiHandler;
+        delete synthParams;
+        return 1;
+    }
+    startup.mark("ui");
+
+    // Set UI pointer for MIDI error messages (stderr with --headless)
+    midiHandler->setUI(ui);
+
+    // Get list of available MIDI devices
+    std::vector<std::pair<int, std::string>> midiDevices;
+    int portCount = midiHandler->getPortCount();
+    for (int i = 0; i < portCount; ++i) {
+        std::string portName = midiHandler->getPortName(i);
+        midiDevices.push_back({i, portName});
+    }
+
+    // Open MIDI port (use preference or find Arturia)
+    int midiPortToUse = preferredMidiPort;
+    if (midiPortToUse < 0 || midiPortToUse >= portCount) {
+        // Try to find Arturia keyboard
+        int arturiaPort = midiHandler->findPortByName("arturia");
+        if (arturiaPort >= 0) {
+            consoleMessage("Found Arturia keyboard at port " + std::to_string(arturiaPort));
+            midiPortToUse = arturiaPort;
+        } else if (portCount > 0) {
+            consoleMessage("Using first available MIDI port");
+            midiPortToUse = 0;
+        }
+    }
+
+    if (midiPortToUse >= 0) {
+        midiHandler->openPort(midiPortToUse);
+    }
+    startup.mark("midi");
+
+    // Get list of available audio devices (probing each one can be slow)
+    std::vector<std::pair<int, std::string>> audioDevices;
+    for (unsigned int i = 0; i < deviceCount; ++i) {
+        try {
+            RtAudio::DeviceInfo info = audio.getDeviceInfo(i);
+            if (info.outputChannels > 0) {  // Only list output devices
+                audioDevices.push_back({static_cast<int>(i), info.name});
+            }
+        } catch (...) {
+            continue;
+        }
     }
+    startup.mark("device list");
     
+    // Pin the UI and sample streaming threads last, so the audio and helper
+    // threads started above do not inherit the UI core
+    rtsetup::configureUiThread(realtimeOptions, realtimeStatus);
+    synth->getSampleBank()->setStreamThreadCpu(realtimeOptions.uiCpu);
+
     // Set device information and available devices
     std::string midiDeviceName = midiHandler->getCurrentPortName();
     int midiPort = midiHandler->getCurrentPortNumber();
-    ui->setDeviceInfo(audioDeviceName, sampleRate, bufferFrames, midiDeviceName, midiPort);
-    ui->setAvailableAudioDevices(audioDevices, audioDeviceIdToUse);
-    ui->setAvailableMidiDevices(midiDevices, midiPortToUse);
+    if (ui) {
+        ui->setRealtimeStatus(&realtimeOptions, &realtimeStatus);
+        ui->setDeviceInfo(audioDeviceName, sampleRate, bufferFrames, midiDeviceName, midiPort);
+        ui->setAvailableAudioDevices(audioDevices, audioDeviceIdToUse);
+        ui->setAvailableMidiDevices(midiDevices, midiPortToUse);
+    } else {
+        consoleMessage("MIDI: " + midiDeviceName);
+    }
+    if (!shmName.empty()) {
+        shmBridge = new ShmBridge();
+        std::string error;
+        if (shmBridge->open(shmName, sampleRate, bufferFrames, error)) {
+            consoleMessage("UI segment: attach with synth_remote " + shmName);
+        } else {
+            consoleMessage("Could not create the UI segment: " + error);
+            delete shmBridge;
+            shmBridge = nullptr;
+        }
+    }
     
     // Load temp preset if it exists (from previous restart)
     std::string tempPresetPath = PresetManager::getPresetPath("__temp_restart__");
@@ -779,42 +2744,141 @@ int main(int argc, char** argv) {
     if (tempCheck.good()) {
         tempCheck.close();
         PresetManager::loadPreset("__temp_restart__", synthParams);
-        ui->addConsoleMessage("Restored previous state");
+        consoleMessage("Restored previous state");
         // Delete temp preset after loading
         unlink(tempPresetPath.c_str());
     }
+    if (!presetName.empty()) {
+        if (PresetManager::loadPreset(presetName, synthParams)) {
+            consoleMessage("Loaded preset " + presetName);
+        } else {
+            consoleMessage("Failed to load preset: " + presetName);
+        }
+    }
+    consoleMessage("Startup: " + startup.report("audio start"));
+
+    // Periodic session saves (--autosave SECONDS, 0 = off)
+    SessionAutosave autosave;
+    if (autosaveSeconds > 0) {
+        autosave.start(autosaveSeconds);
+    }
+
+    outputRecorder = new OutputRecorder();
+    if (!recordPath.empty()) {
+        startRecording(recordPath, recordStems, recordRingSeconds);
+    }
     
     // Main UI loop
+    profile::registerThread("ui");
     float deltaTime = 0.05f;  // 50ms default (20 FPS)
     while (running) {
         // Update UI and handle input
-        if (!ui->update()) {
+        profile::ScopedTimer updateTimer(profile::UI_UPDATE);
+        if (ui && !ui->update()) {
             running = false;  // User pressed 'q'
             break;
         }
+        updateTimer.stop();
+
+        if (shmBridge) {
+            serveShmBridge(streamUnderflows.load(std::memory_order_relaxed));
+        }
+#ifdef WAKEFIELD_JACK
+        if (jackOutput) {
+            pollJackOutput(sampleRate, bufferFrames, audioDeviceName, midiDeviceName, midiPort);
+        }
+#endif
+#ifdef WAKEFIELD_ALSA_MMAP
+        if (alsaOutput && alsaOutput->isFailed()) {
+            consoleMessage("WARNING: ALSA device failed - no more audio");
+            closeNativeBackend();
+        }
+#endif
+
+        // Samples from the background load join the bank
+        int samplesLoaded = 0;
+        std::string sampleSummary;
+        if (sampleLoad.poll(samplesLoaded, sampleSummary)) {
+            consoleMessage(sampleSummary);
+            if (samplesLoaded == 0) {
+                consoleMessage("Warning: No samples found in ../samples directory");
+            } else if (synth->getSamplerSampleIndex(0) < 0) {
+                // First sample into the first sampler, unless one was picked meanwhile
+                synth->setSamplerSample(0, 0);
+            }
+            startup.markBackground("samples", sampleLoad.getSeconds());
+            char ready[64];
+            std::snprintf(ready, sizeof(ready), "Samples ready at %.0f ms", startup.elapsedMs());
+            consoleMessage(ready);
+        }
+
+        // --session once the samples it names can be found in the bank
+        if (!sessionName.empty() && !sampleLoad.isPending()) {
+            std::string message;
+            if (ui) {
+                ui->loadSession(sessionName, message);
+            } else {
+                SessionFile session;
+                if (session.open(SessionFile::getSessionPath(sessionName), message)) {
+                    session.apply(*synthParams, *synth, *sequencer, loopManager, message);
+                }
+            }
+            consoleMessage(message);
+            sessionName.clear();
+        }
+
+        // Hand this frame's parameter and pattern edits to the audio thread
+        synthParams->publishSnapshot();
+        sequencer->updatePatterns();
+
+        if (ui && ui->isRecordToggleRequested()) {
+            ui->clearRecordToggleRequest();
+            if (outputRecorder->isRecording()) {
+                stopRecording();
+            } else {
+                startRecording("", recordStems, recordRingSeconds);
+            }
+        }
+        pollRecorder();
+
+        autosave.update(*synthParams, *synth, *sequencer, loopManager);
+        std::string autosaveMessage;
+        while (autosave.pollMessage(autosaveMessage)) {
+            consoleMessage(autosaveMessage);
+        }
+
+        // Keep free looper chunks ready for the audio thread, and the
+        // sample bank within its memory budget
+        loopManager->refillStorage();
+        synth->trimSamples();
+        std::string loopMessage;
+        while (loopManager->pollFileMessage(loopMessage)) {
+            consoleMessage(loopMessage);
+        }
+
+        // Report what the audio thread could not print itself
+        postRtLogMessages();
+        if (metricsExporter) {
+            publishMetrics(streamUnderflows.load(std::memory_order_relaxed));
+        }
         
         // Check for device change request
-        if (ui->isDeviceChangeRequested()) {
+        if (ui && ui->isDeviceChangeRequested()) {
             int newAudioDevice = ui->getRequestedAudioDevice();
             int newMidiPort = ui->getRequestedMidiDevice();
             
             ui->addConsoleMessage("Restarting with new devices...");
-            ui->draw(synth->getActiveVoiceCount());
+            ui->draw(ui->getTelemetry().activeVoices);
             refresh();
             usleep(500000);  // Show message for 0.5 seconds
             
             // Clean shutdown before restart
-            if (audioAvailable) {
-                if (audio.isStreamRunning()) {
-                    audio.stopStream();
-                }
-                if (audio.isStreamOpen()) {
-                    audio.closeStream();
-                }
-            }
+            stopAudio();
+            stopRecording();
             
             // Restart with new devices
-            restartWithNewDevices(newAudioDevice, newMidiPort, synthParams, argv);
+            restartWithNewDevices(newAudioDevice, newMidiPort, sampleRate, bufferFrames, realtimeOptions,
+                                  synthParams, argv);
             
             // If restart failed, continue running
             ui->clearDeviceChangeRequest();
@@ -823,36 +2887,41 @@ int main(int argc, char** argv) {
         
         // Oscilloscopes removed for simplified UI
         
-        // Draw UI
-        int activeVoices = synth->getActiveVoiceCount();
-        ui->draw(activeVoices);
+        // Draw UI when a frame is due: straight after input, otherwise at
+        // the rate the terminal keeps up with (at most ~20 FPS)
+        if (ui && ui->isFrameDue()) {
+            profile::ScopedTimer drawTimer(profile::UI_DRAW);
+            ui->draw(ui->getTelemetry().activeVoices);
+        }
         
-        // Sleep to control refresh rate (~20 FPS)
+        // The loop itself keeps a 50 ms tick for input and the hand-offs above
         usleep(50000);  // 50ms
     }
     
     // Clean shutdown
-    if (audioAvailable) {
-        if (audio.isStreamRunning()) {
-            audio.stopStream();
-        }
-        if (audio.isStreamOpen()) {
-            audio.closeStream();
-        }
-    }
+    stopAudio();
+    stopRecording();
+    sampleLoad.finish();
+    autosave.stop();
 
     // Nullify pointers before cleanup to prevent dangling pointer access
-    synth->setUI(nullptr);
     if (midiHandler) {
         midiHandler->setUI(nullptr);
     }
 
-    // Clean up
+    // Clean up (the effects thread goes first: it renders into synth and loopManager)
+    delete effectsPipeline;
+    delete partRack;
+    delete shmBridge;
     delete ui;
     delete sequencer;
     delete synth;
     delete loopManager;
     delete midiHandler;
+    delete midiClockOutput;
+    delete oscServer;
+    delete metricsExporter;
+    delete outputRecorder;
     delete synthParams;
 
     return 0;
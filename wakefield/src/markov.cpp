@@ -16,17 +16,28 @@ void MarkovChain::initialize(const std::vector<int>& notes) {
     int n = states.size();
 
     // Initialize transition matrix with equal probabilities
-    transitionMatrix.clear();
-    transitionMatrix.resize(n, std::vector<float>(n, 1.0f / n));
+    transitionMatrix.assign(static_cast<size_t>(n) * n, 1.0f / n);
+    aliasProb.assign(static_cast<size_t>(n) * n, 1.0f);
+    aliasIndex.assign(static_cast<size_t>(n) * n, 0);
+    aliasDirty.assign(n, 1);
+    aliasWork.resize(n);
 
     currentState = 0;
     lastState = 0;
 }
 
+void MarkovChain::assign(const int* notes, int count, const float* matrix, int currentIndex) {
+    initialize(std::vector<int>(notes, notes + count));
+    std::copy(matrix, matrix + static_cast<size_t>(count) * count, transitionMatrix.begin());
+    currentState = (currentIndex >= 0 && currentIndex < count) ? currentIndex : 0;
+    lastState = currentState;
+}
+
 void MarkovChain::setTransition(int fromStateIndex, int toStateIndex, float probability) {
     if (fromStateIndex >= 0 && fromStateIndex < static_cast<int>(states.size()) &&
         toStateIndex >= 0 && toStateIndex < static_cast<int>(states.size())) {
-        transitionMatrix[fromStateIndex][toStateIndex] = probability;
+        row(fromStateIndex)[toStateIndex] = probability;
+        aliasDirty[fromStateIndex] = 1;
     }
 }
 
@@ -56,34 +67,81 @@ int MarkovChain::getStateNote(int index) const {
     return 60;
 }
 
-int MarkovChain::weightedRandomChoice(const std::vector<float>& probabilities) const {
-    if (probabilities.empty()) return 0;
+void MarkovChain::rebuildAliasRow(int stateIndex) {
+    const int n = states.size();
+    const float* probs = row(stateIndex);
+    float* keep = &aliasProb[stateIndex * n];
+    int* alias = &aliasIndex[stateIndex * n];
+
+    float sum = 0.0f;
+    for (int j = 0; j < n; ++j) {
+        sum += std::max(probs[j], 0.0f);
+    }
+
+    if (sum <= 0.0f) {
+        for (int j = 0; j < n; ++j) {
+            keep[j] = 1.0f;
+            alias[j] = j;
+        }
+        aliasDirty[stateIndex] = 0;
+        return;
+    }
 
-    // Generate random value [0, 1)
-    float r = static_cast<float>(rand()) / RAND_MAX;
+    // Scale so the average column is 1, then pair each underfull column with
+    // an overfull one. Small columns fill aliasWork from the front, large ones
+    // from the back
+    const float scale = n / sum;
+    int small = 0;
+    int large = n;
+    for (int j = 0; j < n; ++j) {
+        keep[j] = std::max(probs[j], 0.0f) * scale;
+        alias[j] = j;
+        if (keep[j] < 1.0f) {
+            aliasWork[small++] = j;
+        } else {
+            aliasWork[--large] = j;
+        }
+    }
 
-    // Accumulate probabilities until we exceed r
-    float cumulative = 0.0f;
-    for (size_t i = 0; i < probabilities.size(); ++i) {
-        cumulative += probabilities[i];
-        if (r < cumulative) {
-            return i;
+    while (small > 0 && large < n) {
+        int s = aliasWork[--small];
+        int l = aliasWork[large];
+        alias[s] = l;
+        keep[l] -= 1.0f - keep[s];
+        if (keep[l] < 1.0f) {
+            ++large;
+            aliasWork[small++] = l;
         }
     }
 
-    return probabilities.size() - 1;  // Fallback to last state
+    // Whatever is left is 1 up to rounding
+    while (small > 0) {
+        keep[aliasWork[--small]] = 1.0f;
+    }
+    while (large < n) {
+        keep[aliasWork[large++]] = 1.0f;
+    }
+
+    aliasDirty[stateIndex] = 0;
 }
 
-int MarkovChain::getNextState() {
+int MarkovChain::getNextState(rng::Stream& rng) {
     if (states.empty()) return 0;
 
     lastState = currentState;
 
-    // Get probabilities for current state
-    const std::vector<float>& probs = transitionMatrix[currentState];
+    if (aliasDirty[currentState]) {
+        rebuildAliasRow(currentState);
+    }
+
+    // One draw picks both the column and the coin for keep vs. alias
+    const int n = states.size();
+    double u = rng.uniformDouble() * n;
+    int column = std::min(static_cast<int>(u), n - 1);
+    float coin = static_cast<float>(u - column);
 
-    // Choose next state weighted by probabilities
-    currentState = weightedRandomChoice(probs);
+    const int cell = currentState * n + column;
+    currentState = coin < aliasProb[cell] ? column : aliasIndex[cell];
 
     return currentState;
 }
@@ -91,20 +149,22 @@ int MarkovChain::getNextState() {
 void MarkovChain::normalizeRow(int stateIndex) {
     if (stateIndex < 0 || stateIndex >= static_cast<int>(states.size())) return;
 
-    float sum = std::accumulate(transitionMatrix[stateIndex].begin(),
-                                 transitionMatrix[stateIndex].end(), 0.0f);
+    float* probs = row(stateIndex);
+    const int n = states.size();
+    float sum = std::accumulate(probs, probs + n, 0.0f);
 
     if (sum > 0.0001f) {
-        for (float& prob : transitionMatrix[stateIndex]) {
-            prob /= sum;
+        for (int j = 0; j < n; ++j) {
+            probs[j] /= sum;
         }
     } else {
         // If sum is zero, reset to uniform distribution
-        float uniform = 1.0f / states.size();
-        for (float& prob : transitionMatrix[stateIndex]) {
-            prob = uniform;
+        float uniform = 1.0f / n;
+        for (int j = 0; j < n; ++j) {
+            probs[j] = uniform;
         }
     }
+    aliasDirty[stateIndex] = 1;
 }
 
 void MarkovChain::setRandomWalk() {
@@ -116,11 +176,11 @@ void MarkovChain::setRandomWalk() {
         for (int j = 0; j < n; ++j) {
             int distance = std::abs(i - j);
             if (distance == 0) {
-                transitionMatrix[i][j] = 0.3f;  // 30% stay
+                row(i)[j] = 0.3f;  // 30% stay
             } else if (distance <= 3) {
-                transitionMatrix[i][j] = 0.7f / std::min(6, n - 1);  // Distribute to neighbors
+                row(i)[j] = 0.7f / std::min(6, n - 1);  // Distribute to neighbors
             } else {
-                transitionMatrix[i][j] = 0.0f;  // Can't jump far
+                row(i)[j] = 0.0f;  // Can't jump far
             }
         }
         normalizeRow(i);
@@ -141,16 +201,16 @@ void MarkovChain::setOrbitingPattern(int centerNote) {
 
             // Prefer moving toward center
             if (distanceFromCenter < currentDistance) {
-                transitionMatrix[i][j] = 0.4f;
+                row(i)[j] = 0.4f;
             } else if (distanceFromCenter == currentDistance) {
-                transitionMatrix[i][j] = 0.3f;  // Stay at same distance
+                row(i)[j] = 0.3f;  // Stay at same distance
             } else {
-                transitionMatrix[i][j] = 0.1f;  // Moving away is rare
+                row(i)[j] = 0.1f;  // Moving away is rare
             }
 
             // Boost probability for center note itself
             if (j == centerIndex) {
-                transitionMatrix[i][j] *= 1.5f;
+                row(i)[j] *= 1.5f;
             }
         }
         normalizeRow(i);
@@ -166,13 +226,13 @@ void MarkovChain::setAscending(float bias) {
         for (int j = 0; j < n; ++j) {
             if (j > i) {
                 // Moving up
-                transitionMatrix[i][j] = bias / std::max(1, n - i - 1);
+                row(i)[j] = bias / std::max(1, n - i - 1);
             } else if (j == i) {
                 // Staying
-                transitionMatrix[i][j] = (1.0f - bias) * 0.5f;
+                row(i)[j] = (1.0f - bias) * 0.5f;
             } else {
                 // Moving down
-                transitionMatrix[i][j] = (1.0f - bias) * 0.5f / std::max(1, i);
+                row(i)[j] = (1.0f - bias) * 0.5f / std::max(1, i);
             }
         }
         normalizeRow(i);
@@ -188,13 +248,13 @@ void MarkovChain::setDescending(float bias) {
         for (int j = 0; j < n; ++j) {
             if (j < i) {
                 // Moving down
-                transitionMatrix[i][j] = bias / std::max(1, i);
+                row(i)[j] = bias / std::max(1, i);
             } else if (j == i) {
                 // Staying
-                transitionMatrix[i][j] = (1.0f - bias) * 0.5f;
+                row(i)[j] = (1.0f - bias) * 0.5f;
             } else {
                 // Moving up
-                transitionMatrix[i][j] = (1.0f - bias) * 0.5f / std::max(1, n - i - 1);
+                row(i)[j] = (1.0f - bias) * 0.5f / std::max(1, n - i - 1);
             }
         }
         normalizeRow(i);
@@ -209,14 +269,14 @@ void MarkovChain::setDronePattern(float repeatProb) {
     for (int i = 0; i < n; ++i) {
         for (int j = 0; j < n; ++j) {
             if (i == j) {
-                transitionMatrix[i][j] = repeatProb;
+                row(i)[j] = repeatProb;
             } else {
                 // Distribute remaining probability to neighbors
                 int distance = std::abs(i - j);
                 if (distance <= 2) {
-                    transitionMatrix[i][j] = (1.0f - repeatProb) / std::min(4, n - 1);
+                    row(i)[j] = (1.0f - repeatProb) / std::min(4, n - 1);
                 } else {
-                    transitionMatrix[i][j] = 0.0f;
+                    row(i)[j] = 0.0f;
                 }
             }
         }
@@ -228,7 +288,7 @@ void MarkovChain::reinforceLastTransition(float amount) {
     if (lastState >= 0 && lastState < static_cast<int>(states.size()) &&
         currentState >= 0 && currentState < static_cast<int>(states.size())) {
 
-        transitionMatrix[lastState][currentState] += amount;
+        row(lastState)[currentState] += amount;
         normalizeRow(lastState);
     }
 }
@@ -237,7 +297,7 @@ void MarkovChain::decayUnusedTransitions(float rate) {
     // Multiply all probabilities by (1 - rate), then normalize
     for (int i = 0; i < static_cast<int>(states.size()); ++i) {
         for (int j = 0; j < static_cast<int>(states.size()); ++j) {
-            transitionMatrix[i][j] *= (1.0f - rate);
+            row(i)[j] *= (1.0f - rate);
         }
         normalizeRow(i);
     }
@@ -251,10 +311,10 @@ void MarkovChain::printMatrix() const {
     }
     std::cout << "\n";
 
-    for (size_t i = 0; i < transitionMatrix.size(); ++i) {
+    for (int i = 0; i < static_cast<int>(states.size()); ++i) {
         std::cout << "From " << states[i] << ": ";
-        for (float prob : transitionMatrix[i]) {
-            std::cout << prob << " ";
+        for (int j = 0; j < static_cast<int>(states.size()); ++j) {
+            std::cout << row(i)[j] << " ";
         }
         std::cout << "\n";
     }
@@ -3,6 +3,7 @@
 
 #include <vector>
 #include <string>
+#include "rng.h"
 
 class MarkovChain {
 public:
@@ -14,8 +15,10 @@ public:
     // Set transition probability from one state to another
     void setTransition(int fromStateIndex, int toStateIndex, float probability);
 
-    // Get next state using weighted random selection
-    int getNextState();
+    // Get next state using weighted random selection, one draw from rng;
+    // O(1) per call via the row's alias table, which is rebuilt only after
+    // the row has changed
+    int getNextState(rng::Stream& rng);
 
     // Get current MIDI note
     int getCurrentNote() const;
@@ -45,20 +48,37 @@ public:
     std::string serializeToJson() const;
     void deserializeFromJson(const std::string& json);
 
+    // Raw state for session files: the n × n matrix, row-major, and the
+    // current state. assign() replaces states, matrix and current state at
+    // once; the alias tables rebuild on the next draws
+    const std::vector<float>& getTransitionMatrix() const { return transitionMatrix; }
+    int getCurrentStateIndex() const { return currentState; }
+    void assign(const int* notes, int count, const float* matrix, int currentIndex);
+
     // Debug
     void printMatrix() const;
 
 private:
-    std::vector<int> states;                           // MIDI note values
-    std::vector<std::vector<float>> transitionMatrix;  // [from][to] probabilities
-    int currentState;                                   // Current state index
-    int lastState;                                      // Previous state (for reinforcement)
+    std::vector<int> states;               // MIDI note values
+    std::vector<float> transitionMatrix;   // [from * n + to] probabilities
+    int currentState;                      // Current state index
+    int lastState;                         // Previous state (for reinforcement)
+
+    // Vose alias tables, one row per state, laid out like transitionMatrix.
+    // A row is rebuilt lazily on the next draw after its probabilities change
+    std::vector<float> aliasProb;          // Chance of keeping column j
+    std::vector<int> aliasIndex;           // Column taken otherwise
+    std::vector<unsigned char> aliasDirty; // Per row
+    std::vector<int> aliasWork;            // Scratch for rebuildAliasRow
+
+    float* row(int stateIndex) { return &transitionMatrix[stateIndex * states.size()]; }
+    const float* row(int stateIndex) const { return &transitionMatrix[stateIndex * states.size()]; }
 
     // Helper: find state index for a MIDI note
     int findStateIndex(int midiNote) const;
 
-    // Helper: weighted random selection
-    int weightedRandomChoice(const std::vector<float>& probabilities) const;
+    // Helper: build the alias table for one row
+    void rebuildAliasRow(int stateIndex);
 };
 
 #endif // MARKOV_H
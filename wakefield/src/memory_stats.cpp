@@ -0,0 +1,94 @@
+#include "memory_stats.h"
+#include <atomic>
+#include <cstring>
+
+namespace memstats {
+
+namespace {
+
+struct Totals {
+    std::atomic<uint64_t> current{0};
+    std::atomic<uint64_t> peak{0};
+    std::atomic<uint64_t> budget{0};
+    std::atomic<uint64_t> enforced{0};
+};
+
+Totals totals[SUBSYSTEM_COUNT];
+
+const char* const kNames[SUBSYSTEM_COUNT] = {
+    "looper", "samples", "voices", "reverb", "sequencer", "scope"
+};
+
+bool valid(int subsystem) { return subsystem >= 0 && subsystem < SUBSYSTEM_COUNT; }
+
+} // namespace
+
+const char* subsystemName(int subsystem) {
+    return valid(subsystem) ? kNames[subsystem] : "?";
+}
+
+int findSubsystem(const char* name) {
+    for (int i = 0; i < SUBSYSTEM_COUNT; ++i) {
+        if (std::strcmp(name, kNames[i]) == 0) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+Usage read(int subsystem) {
+    Usage usage;
+    if (valid(subsystem)) {
+        const Totals& t = totals[subsystem];
+        usage.current = t.current.load(std::memory_order_relaxed);
+        usage.peak = t.peak.load(std::memory_order_relaxed);
+        usage.budget = t.budget.load(std::memory_order_relaxed);
+        usage.enforced = t.enforced.load(std::memory_order_relaxed);
+    }
+    return usage;
+}
+
+void setBudget(int subsystem, uint64_t bytes) {
+    if (valid(subsystem)) {
+        totals[subsystem].budget.store(bytes, std::memory_order_relaxed);
+    }
+}
+
+uint64_t getBudget(int subsystem) {
+    return valid(subsystem) ? totals[subsystem].budget.load(std::memory_order_relaxed) : 0;
+}
+
+bool fits(int subsystem, uint64_t bytes) {
+    const uint64_t budget = getBudget(subsystem);
+    return budget == 0 || totals[subsystem].current.load(std::memory_order_relaxed) + bytes <= budget;
+}
+
+uint64_t excess(int subsystem) {
+    const uint64_t budget = getBudget(subsystem);
+    const uint64_t current = valid(subsystem) ? totals[subsystem].current.load(std::memory_order_relaxed) : 0;
+    return budget != 0 && current > budget ? current - budget : 0;
+}
+
+void noteEnforced(int subsystem, uint64_t count) {
+    if (valid(subsystem)) {
+        totals[subsystem].enforced.fetch_add(count, std::memory_order_relaxed);
+    }
+}
+
+void Account::set(uint64_t bytes) {
+    if (bytes == held || !valid(subsystem)) {
+        return;
+    }
+    Totals& t = totals[subsystem];
+    if (bytes < held) {
+        t.current.fetch_sub(held - bytes, std::memory_order_relaxed);
+    } else {
+        const uint64_t current = t.current.fetch_add(bytes - held, std::memory_order_relaxed) + (bytes - held);
+        uint64_t peak = t.peak.load(std::memory_order_relaxed);
+        while (current > peak && !t.peak.compare_exchange_weak(peak, current, std::memory_order_relaxed)) {
+        }
+    }
+    held = bytes;
+}
+
+} // namespace memstats
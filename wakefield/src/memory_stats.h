@@ -0,0 +1,78 @@
+#ifndef MEMORY_STATS_H
+#define MEMORY_STATS_H
+
+#include <cstdint>
+
+// Memory accounting by subsystem: current and peak bytes held by the large
+// owners (looper chunks, sample audio, voices, reverb lines, sequencer,
+// scope rings), and an optional budget for each. An owner holds an Account
+// and sets it to what it holds whenever that changes, off the audio
+// thread; the totals are atomics, so the CONFIG page and the metrics
+// exporter read them from any thread. Small and transient allocations are
+// not counted.
+//
+// Budgets are enforced where memory can be refused or given back: the
+// looper's chunk pool stops growing at its budget (recording then runs out
+// of chunks as at the pool's chunk cap), and the sample bank evicts the
+// least recently used samples no sampler holds. The other subsystems are
+// sized when the engine is built; over budget, they are only flagged.
+namespace memstats {
+
+enum Subsystem : int {
+    LOOPER = 0,     // Loop chunk pools
+    SAMPLES,        // Sample bank audio, overviews, mip levels, streams
+    VOICES,         // Engine arenas: voices, their buffers, modulation buffers
+    REVERB,         // Greyhole and late-diffusion lines, convolution kernels
+    SEQUENCER,      // Tracks, playing pattern copies, lookahead rings
+    SCOPE,          // Scope and spectrum rings the UI reads
+    SUBSYSTEM_COUNT
+};
+
+// "looper", "samples", ... as used by --memory-budget and the exporters
+const char* subsystemName(int subsystem);
+// -1 for an unknown name
+int findSubsystem(const char* name);
+
+struct Usage {
+    uint64_t current = 0;
+    uint64_t peak = 0;
+    uint64_t budget = 0;        // 0: none
+    uint64_t enforced = 0;      // Growth refused or entries evicted to keep to it
+};
+
+Usage read(int subsystem);
+
+// 0 removes the budget
+void setBudget(int subsystem, uint64_t bytes);
+uint64_t getBudget(int subsystem);
+
+// Whether bytes more stay within the budget (always, without one), and
+// how far over it the subsystem is now
+bool fits(int subsystem, uint64_t bytes);
+uint64_t excess(int subsystem);
+
+// An owner kept to the budget: refused growth, or evicted count entries
+void noteEnforced(int subsystem, uint64_t count = 1);
+
+// What one owner holds in a subsystem. set() moves the subsystem's total
+// by the change; the destructor takes it all back. Set from one thread at
+// a time
+class Account {
+public:
+    explicit Account(int subsystem) : subsystem(subsystem) {}
+    ~Account() { set(0); }
+
+    void set(uint64_t bytes);
+    uint64_t get() const { return held; }
+
+    Account(const Account&) = delete;
+    Account& operator=(const Account&) = delete;
+
+private:
+    int subsystem;
+    uint64_t held = 0;
+};
+
+} // namespace memstats
+
+#endif // MEMORY_STATS_H
@@ -0,0 +1,334 @@
+#include "metrics_exporter.h"
+#include "profile.h"
+#include "rt_setup.h"
+#include <arpa/inet.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <pthread.h>
+#include <sched.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstdarg>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+
+namespace {
+
+void appendf(std::string& out, const char* format, ...) __attribute__((format(printf, 2, 3)));
+
+void appendf(std::string& out, const char* format, ...) {
+    char line[256];
+    va_list args;
+    va_start(args, format);
+    const int length = std::vsnprintf(line, sizeof(line), format, args);
+    va_end(args);
+    if (length > 0) {
+        out.append(line, std::min<size_t>(static_cast<size_t>(length), sizeof(line) - 1));
+    }
+}
+
+void appendFamily(std::string& out, const char* name, const char* type, const char* help) {
+    appendf(out, "# HELP %s %s\n# TYPE %s %s\n", name, help, name, type);
+}
+
+// Hits over lookups, or -1 before the first lookup
+double hitRatio(const MetricsSnapshot& s) {
+    const uint64_t lookups = s.sampleCacheHits + s.sampleCacheMisses;
+    return lookups ? static_cast<double>(s.sampleCacheHits) / static_cast<double>(lookups) : -1.0;
+}
+
+unsigned long long delta(uint64_t now, uint64_t before) {
+    return now >= before ? now - before : now;
+}
+
+} // namespace
+
+MetricsExporter::~MetricsExporter() {
+    stop();
+}
+
+bool MetricsExporter::start(const Config& newConfig) {
+    stop();
+    config = newConfig;
+
+    if (!config.statsdHost.empty()) {
+        addrinfo hints{};
+        hints.ai_family = AF_UNSPEC;
+        hints.ai_socktype = SOCK_DGRAM;
+        addrinfo* result = nullptr;
+        const std::string port = std::to_string(config.statsdPort);
+        const int error = getaddrinfo(config.statsdHost.c_str(), port.c_str(), &hints, &result);
+        if (error != 0) {
+            std::cerr << "Metrics: cannot resolve " << config.statsdHost << ": " << gai_strerror(error) << std::endl;
+            return false;
+        }
+        for (addrinfo* a = result; a && statsdFd < 0; a = a->ai_next) {
+            statsdFd = socket(a->ai_family, a->ai_socktype, a->ai_protocol);
+            if (statsdFd >= 0 && connect(statsdFd, a->ai_addr, a->ai_addrlen) != 0) {
+                close(statsdFd);
+                statsdFd = -1;
+            }
+        }
+        freeaddrinfo(result);
+        if (statsdFd < 0) {
+            std::cerr << "Metrics: cannot reach statsd at " << config.statsdHost << ":" << port << std::endl;
+            return false;
+        }
+    }
+
+    if (config.prometheusPort > 0) {
+        listenFd = socket(AF_INET, SOCK_STREAM, 0);
+        const int reuse = 1;
+        sockaddr_in address{};
+        address.sin_family = AF_INET;
+        address.sin_addr.s_addr = htonl(INADDR_ANY);
+        address.sin_port = htons(static_cast<uint16_t>(config.prometheusPort));
+        if (listenFd < 0
+            || setsockopt(listenFd, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse)) != 0
+            || bind(listenFd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0
+            || listen(listenFd, 4) != 0) {
+            std::cerr << "Metrics: cannot listen on TCP port " << config.prometheusPort << ": "
+                      << std::strerror(errno) << std::endl;
+            stop();
+            return false;
+        }
+    }
+
+    if (statsdFd < 0 && listenFd < 0) {
+        return false;
+    }
+    running = true;
+    thread = std::thread(&MetricsExporter::run, this);
+    return true;
+}
+
+void MetricsExporter::stop() {
+    running = false;
+    if (thread.joinable()) {
+        thread.join();
+    }
+    if (statsdFd >= 0) {
+        close(statsdFd);
+        statsdFd = -1;
+    }
+    if (listenFd >= 0) {
+        close(listenFd);
+        listenFd = -1;
+    }
+}
+
+void MetricsExporter::publish(const MetricsSnapshot& newSnapshot) {
+    std::lock_guard<std::mutex> lock(mutex);
+    snapshot = newSnapshot;
+}
+
+MetricsSnapshot MetricsExporter::latest() {
+    std::lock_guard<std::mutex> lock(mutex);
+    return snapshot;
+}
+
+void MetricsExporter::run() {
+    // Only runs when nothing else wants the core
+#ifdef SCHED_IDLE
+    sched_param param{};
+    pthread_setschedparam(pthread_self(), SCHED_IDLE, &param);
+#endif
+    if (config.cpu >= 0) {
+        rtsetup::pinThread(pthread_self(), config.cpu);
+    }
+    profile::registerThread("metrics");
+
+    using Clock = std::chrono::steady_clock;
+    MetricsSnapshot previous = latest();
+    Clock::time_point nextSend = Clock::now() + std::chrono::milliseconds(kStatsdIntervalMs);
+    pollfd fd{listenFd, POLLIN, 0};
+    while (running.load()) {
+        // Polled in 100 ms steps so stop() is noticed promptly
+        if (listenFd >= 0 && poll(&fd, 1, 100) > 0) {
+            profile::ScopedTimer scrapeTimer(profile::METRICS_SCRAPE);
+            serveScrape();
+        } else if (listenFd < 0) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        }
+        if (statsdFd >= 0 && Clock::now() >= nextSend) {
+            profile::ScopedTimer statsdTimer(profile::METRICS_STATSD);
+            sendStatsd(previous);
+            nextSend += std::chrono::milliseconds(kStatsdIntervalMs);
+        }
+    }
+}
+
+void MetricsExporter::sendStatsd(MetricsSnapshot& previous) {
+    const MetricsSnapshot now = latest();
+    const std::string payload = formatStatsd(now, previous);
+    // A lost datagram costs one interval; counters resume from the next
+    if (send(statsdFd, payload.data(), payload.size(), MSG_DONTWAIT) >= 0) {
+        previous = now;
+    }
+}
+
+void MetricsExporter::serveScrape() {
+    const int client = accept(listenFd, nullptr, nullptr);
+    if (client < 0) {
+        return;
+    }
+    // The request line is all that matters; a slow client gets 200 ms
+    timeval timeout{0, 200000};
+    setsockopt(client, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+    char request[1024];
+    size_t received = 0;
+    while (received < sizeof(request) - 1) {
+        const ssize_t n = recv(client, request + received, sizeof(request) - 1 - received, 0);
+        if (n <= 0) {
+            break;
+        }
+        received += static_cast<size_t>(n);
+        request[received] = '\0';
+        if (std::strstr(request, "\r\n\r\n") || std::strstr(request, "\n\n")) {
+            break;
+        }
+    }
+    request[received] = '\0';
+
+    std::string response;
+    if (std::strncmp(request, "GET /metrics", 12) == 0 || std::strncmp(request, "GET / ", 6) == 0) {
+        const std::string body = formatPrometheus(latest());
+        appendf(response, "HTTP/1.0 200 OK\r\nContent-Type: text/plain; version=0.0.4\r\n"
+                          "Content-Length: %zu\r\nConnection: close\r\n\r\n", body.size());
+        response += body;
+    } else {
+        response = "HTTP/1.0 404 Not Found\r\nContent-Length: 0\r\nConnection: close\r\n\r\n";
+    }
+    for (size_t sent = 0; sent < response.size();) {
+        const ssize_t n = send(client, response.data() + sent, response.size() - sent, MSG_NOSIGNAL);
+        if (n <= 0) {
+            break;
+        }
+        sent += static_cast<size_t>(n);
+    }
+    close(client);
+}
+
+std::string MetricsExporter::formatPrometheus(const MetricsSnapshot& s) {
+    std::string out;
+    out.reserve(4096);
+
+    // Bucket reads may straddle a publish window; keep them monotonic and
+    // within the count as the format requires
+    const CPUMonitor::LoadHistogram& h = s.loadHistogram;
+    uint64_t count = h.count;
+    for (int i = 0; i < CPUMonitor::kExportBuckets; ++i) {
+        count = std::max(count, h.buckets[i]);
+    }
+    appendFamily(out, "wakefield_dsp_load", "histogram",
+                 "Audio callback render time as a fraction of the buffer period");
+    uint64_t cumulative = 0;
+    for (int i = 0; i < CPUMonitor::kExportBuckets; ++i) {
+        cumulative = std::max(cumulative, h.buckets[i]);
+        appendf(out, "wakefield_dsp_load_bucket{le=\"%g\"} %llu\n",
+                CPUMonitor::kExportBoundsPercent[i] / 100.0, static_cast<unsigned long long>(cumulative));
+    }
+    appendf(out, "wakefield_dsp_load_bucket{le=\"+Inf\"} %llu\n", static_cast<unsigned long long>(count));
+    appendf(out, "wakefield_dsp_load_sum %.6f\n", h.sum);
+    appendf(out, "wakefield_dsp_load_count %llu\n", static_cast<unsigned long long>(count));
+
+    appendFamily(out, "wakefield_dsp_load_window", "gauge",
+                 "DSP load over the last 0.5 s meter window");
+    appendf(out, "wakefield_dsp_load_window{stat=\"mean\"} %.4f\n", s.loadMean);
+    appendf(out, "wakefield_dsp_load_window{stat=\"p99\"} %.4f\n", s.loadP99);
+    appendf(out, "wakefield_dsp_load_window{stat=\"peak\"} %.4f\n", s.loadPeak);
+
+    appendFamily(out, "wakefield_dsp_overloads_total", "counter", "Callbacks above 80% of the buffer period");
+    appendf(out, "wakefield_dsp_overloads_total %llu\n", static_cast<unsigned long long>(s.overloads));
+    appendFamily(out, "wakefield_xruns_total", "counter", "Output underflows reported by the audio device");
+    appendf(out, "wakefield_xruns_total %llu\n", static_cast<unsigned long long>(s.xruns));
+
+    appendFamily(out, "wakefield_voices_active", "gauge", "Sounding voices");
+    appendf(out, "wakefield_voices_active %d\n", s.activeVoices);
+    appendFamily(out, "wakefield_voices_max", "gauge", "Voice pool size");
+    appendf(out, "wakefield_voices_max %d\n", s.maxVoices);
+
+    appendFamily(out, "wakefield_looper_memory_bytes", "gauge", "Looper chunk storage allocated");
+    appendf(out, "wakefield_looper_memory_bytes %llu\n", static_cast<unsigned long long>(s.loopBytes));
+    appendFamily(out, "wakefield_looper_free_chunks", "gauge", "Looper chunks ready for recording");
+    appendf(out, "wakefield_looper_free_chunks %llu\n", static_cast<unsigned long long>(s.loopFreeChunks));
+    appendFamily(out, "wakefield_looper_starved_total", "counter", "Chunk requests that found no free chunk");
+    appendf(out, "wakefield_looper_starved_total %llu\n", static_cast<unsigned long long>(s.loopStarved));
+
+    appendFamily(out, "wakefield_sample_cache_hits_total", "counter", "Sample loads served from the Q15 cache");
+    appendf(out, "wakefield_sample_cache_hits_total %llu\n", static_cast<unsigned long long>(s.sampleCacheHits));
+    appendFamily(out, "wakefield_sample_cache_misses_total", "counter", "Sample loads that decoded the WAV file");
+    appendf(out, "wakefield_sample_cache_misses_total %llu\n", static_cast<unsigned long long>(s.sampleCacheMisses));
+    const double ratio = hitRatio(s);
+    if (ratio >= 0.0) {
+        appendFamily(out, "wakefield_sample_cache_hit_ratio", "gauge", "Sample cache hits over lookups");
+        appendf(out, "wakefield_sample_cache_hit_ratio %.4f\n", ratio);
+    }
+    appendFamily(out, "wakefield_sample_stream_underruns_total", "counter",
+                 "Streamed sample frames that were not resident in time");
+    appendf(out, "wakefield_sample_stream_underruns_total %llu\n", static_cast<unsigned long long>(s.streamUnderruns));
+
+    appendFamily(out, "wakefield_memory_bytes", "gauge", "Memory held by subsystem");
+    for (int i = 0; i < memstats::SUBSYSTEM_COUNT; ++i) {
+        appendf(out, "wakefield_memory_bytes{subsystem=\"%s\"} %llu\n", memstats::subsystemName(i),
+                static_cast<unsigned long long>(s.memory[i].current));
+    }
+    appendFamily(out, "wakefield_memory_peak_bytes", "gauge", "Most memory held by subsystem since start");
+    for (int i = 0; i < memstats::SUBSYSTEM_COUNT; ++i) {
+        appendf(out, "wakefield_memory_peak_bytes{subsystem=\"%s\"} %llu\n", memstats::subsystemName(i),
+                static_cast<unsigned long long>(s.memory[i].peak));
+    }
+    appendFamily(out, "wakefield_memory_budget_bytes", "gauge", "Memory budget by subsystem, where one is set");
+    for (int i = 0; i < memstats::SUBSYSTEM_COUNT; ++i) {
+        if (s.memory[i].budget > 0) {
+            appendf(out, "wakefield_memory_budget_bytes{subsystem=\"%s\"} %llu\n", memstats::subsystemName(i),
+                    static_cast<unsigned long long>(s.memory[i].budget));
+        }
+    }
+    appendFamily(out, "wakefield_memory_budget_enforced_total", "counter",
+                 "Growth refused or entries evicted to keep to the budget");
+    for (int i = 0; i < memstats::SUBSYSTEM_COUNT; ++i) {
+        appendf(out, "wakefield_memory_budget_enforced_total{subsystem=\"%s\"} %llu\n", memstats::subsystemName(i),
+                static_cast<unsigned long long>(s.memory[i].enforced));
+    }
+    return out;
+}
+
+std::string MetricsExporter::formatStatsd(const MetricsSnapshot& s, const MetricsSnapshot& previous) {
+    // One datagram, under a 1500-byte MTU
+    std::string out;
+    out.reserve(1536);
+    appendf(out, "wakefield.dsp_load.mean:%.4f|g\n", s.loadMean);
+    appendf(out, "wakefield.dsp_load.p99:%.4f|g\n", s.loadP99);
+    appendf(out, "wakefield.dsp_load.peak:%.4f|g\n", s.loadPeak);
+    for (int i = 0; i < CPUMonitor::kExportBuckets; ++i) {
+        appendf(out, "wakefield.dsp_load.le_%d:%llu|c\n", CPUMonitor::kExportBoundsPercent[i],
+                delta(s.loadHistogram.buckets[i], previous.loadHistogram.buckets[i]));
+    }
+    appendf(out, "wakefield.dsp_load.callbacks:%llu|c\n", delta(s.loadHistogram.count, previous.loadHistogram.count));
+    appendf(out, "wakefield.dsp_load.overloads:%llu|c\n", delta(s.overloads, previous.overloads));
+    appendf(out, "wakefield.xruns:%llu|c\n", delta(s.xruns, previous.xruns));
+    appendf(out, "wakefield.voices.active:%d|g\n", s.activeVoices);
+    appendf(out, "wakefield.voices.max:%d|g\n", s.maxVoices);
+    appendf(out, "wakefield.looper.bytes:%llu|g\n", static_cast<unsigned long long>(s.loopBytes));
+    appendf(out, "wakefield.looper.free_chunks:%llu|g\n", static_cast<unsigned long long>(s.loopFreeChunks));
+    appendf(out, "wakefield.looper.starved:%llu|c\n", delta(s.loopStarved, previous.loopStarved));
+    appendf(out, "wakefield.sample_cache.hits:%llu|c\n", delta(s.sampleCacheHits, previous.sampleCacheHits));
+    appendf(out, "wakefield.sample_cache.misses:%llu|c\n", delta(s.sampleCacheMisses, previous.sampleCacheMisses));
+    const double ratio = hitRatio(s);
+    if (ratio >= 0.0) {
+        appendf(out, "wakefield.sample_cache.hit_ratio:%.4f|g\n", ratio);
+    }
+    appendf(out, "wakefield.sample_stream.underruns:%llu|c\n", delta(s.streamUnderruns, previous.streamUnderruns));
+    for (int i = 0; i < memstats::SUBSYSTEM_COUNT; ++i) {
+        const char* name = memstats::subsystemName(i);
+        appendf(out, "wakefield.memory.%s.bytes:%llu|g\n", name, static_cast<unsigned long long>(s.memory[i].current));
+        appendf(out, "wakefield.memory.%s.peak:%llu|g\n", name, static_cast<unsigned long long>(s.memory[i].peak));
+    }
+    return out;
+}
@@ -0,0 +1,90 @@
+#ifndef METRICS_EXPORTER_H
+#define METRICS_EXPORTER_H
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include "cpu_monitor.h"
+#include "memory_stats.h"
+
+// Health figures for the exporter, gathered by the UI loop from what it
+// already reads each frame (the telemetry snapshot, the load meter's
+// atomics, the xrun counter), so the audio callback does no extra work.
+// Counters are totals since start.
+struct MetricsSnapshot {
+    float loadMean = 0.0f;
+    float loadPeak = 0.0f;
+    float loadP99 = 0.0f;
+    CPUMonitor::LoadHistogram loadHistogram = {};
+    uint64_t overloads = 0;
+    uint64_t xruns = 0;                 // Stream underflows reported by RtAudio
+    int activeVoices = 0;
+    int maxVoices = 0;
+    uint64_t loopBytes = 0;             // Looper chunk storage allocated
+    uint64_t loopFreeChunks = 0;
+    uint64_t loopStarved = 0;           // Chunk requests that found the free list empty
+    uint64_t sampleCacheHits = 0;
+    uint64_t sampleCacheMisses = 0;
+    uint64_t streamUnderruns = 0;
+    memstats::Usage memory[memstats::SUBSYSTEM_COUNT];  // By memstats::Subsystem
+};
+
+// Exports MetricsSnapshot from a low-priority thread (SCHED_IDLE where
+// available), as either or both of:
+//
+//   statsd      UDP datagrams to host:port every kStatsdIntervalMs;
+//               gauges for levels, counter deltas for totals
+//   Prometheus  text exposition format over HTTP on a TCP port, answered
+//               on each scrape with the newest snapshot
+//
+// The UI thread publishes a copy under a mutex; nothing here touches the
+// audio thread.
+class MetricsExporter {
+public:
+    static constexpr int kStatsdIntervalMs = 1000;
+
+    struct Config {
+        std::string statsdHost;         // Empty: no statsd
+        int statsdPort = 8125;
+        int prometheusPort = 0;         // 0: no HTTP endpoint
+        int cpu = -1;                   // Core for the thread, -1 = any
+    };
+
+    MetricsExporter() = default;
+    ~MetricsExporter();
+
+    // Open the sockets and start the thread. False (with a message on
+    // stderr) if a requested endpoint cannot be set up
+    bool start(const Config& config);
+    void stop();
+
+    // UI thread: the newest figures
+    void publish(const MetricsSnapshot& snapshot);
+
+    // Payloads, public so they can be checked without sockets. Statsd
+    // counters are the change since previous
+    static std::string formatPrometheus(const MetricsSnapshot& snapshot);
+    static std::string formatStatsd(const MetricsSnapshot& snapshot, const MetricsSnapshot& previous);
+
+    MetricsExporter(const MetricsExporter&) = delete;
+    MetricsExporter& operator=(const MetricsExporter&) = delete;
+
+private:
+    void run();
+    void sendStatsd(MetricsSnapshot& previous);
+    void serveScrape();
+    MetricsSnapshot latest();
+
+    Config config;
+    std::mutex mutex;                   // Guards snapshot
+    MetricsSnapshot snapshot;
+
+    int statsdFd = -1;
+    int listenFd = -1;
+    std::atomic<bool> running{false};
+    std::thread thread;
+};
+
+#endif // METRICS_EXPORTER_H
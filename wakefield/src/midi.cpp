@@ -1,13 +1,15 @@
 #include "midi.h"
+#include "midi_clock.h"
 #include "ui.h"
 #include <iostream>
 #include <algorithm>
 #include <cctype>
+#include <chrono>
 
 // Initialize static UI pointer
 void* MidiHandler::uiPointer = nullptr;
 
-MidiHandler::MidiHandler() : midiIn(nullptr), currentPort(-1) {
+MidiHandler::MidiHandler() : currentPort(-1), midiIn(nullptr) {
 }
 
 MidiHandler::~MidiHandler() {
@@ -16,49 +18,49 @@ MidiHandler::~MidiHandler() {
     }
 }
 
-// Static error callback to route MIDI messages to console
+// Static error callback to route MIDI messages to console (stderr without a UI)
 void MidiHandler::midiErrorCallback(RtMidiError::Type type, const std::string& errorText, void* userData) {
+    std::string prefix;
+    switch (type) {
+        case RtMidiError::WARNING:
+            prefix = "MIDI Warning: ";
+            break;
+        case RtMidiError::DEBUG_WARNING:
+            prefix = "MIDI Debug: ";
+            break;
+        case RtMidiError::UNSPECIFIED:
+            prefix = "MIDI: ";
+            break;
+        case RtMidiError::NO_DEVICES_FOUND:
+            prefix = "MIDI Error: ";
+            break;
+        case RtMidiError::INVALID_DEVICE:
+            prefix = "MIDI Error: ";
+            break;
+        case RtMidiError::MEMORY_ERROR:
+            prefix = "MIDI Error: ";
+            break;
+        case RtMidiError::INVALID_PARAMETER:
+            prefix = "MIDI Error: ";
+            break;
+        case RtMidiError::INVALID_USE:
+            prefix = "MIDI Error: ";
+            break;
+        case RtMidiError::DRIVER_ERROR:
+            prefix = "MIDI Error: ";
+            break;
+        case RtMidiError::SYSTEM_ERROR:
+            prefix = "MIDI Error: ";
+            break;
+        case RtMidiError::THREAD_ERROR:
+            prefix = "MIDI Error: ";
+            break;
+    }
+    
     if (uiPointer) {
-        UI* ui = static_cast<UI*>(uiPointer);
-        
-        std::string prefix;
-        switch (type) {
-            case RtMidiError::WARNING:
-                prefix = "MIDI Warning: ";
-                break;
-            case RtMidiError::DEBUG_WARNING:
-                prefix = "MIDI Debug: ";
-                break;
-            case RtMidiError::UNSPECIFIED:
-                prefix = "MIDI: ";
-                break;
-            case RtMidiError::NO_DEVICES_FOUND:
-                prefix = "MIDI Error: ";
-                break;
-            case RtMidiError::INVALID_DEVICE:
-                prefix = "MIDI Error: ";
-                break;
-            case RtMidiError::MEMORY_ERROR:
-                prefix = "MIDI Error: ";
-                break;
-            case RtMidiError::INVALID_PARAMETER:
-                prefix = "MIDI Error: ";
-                break;
-            case RtMidiError::INVALID_USE:
-                prefix = "MIDI Error: ";
-                break;
-            case RtMidiError::DRIVER_ERROR:
-                prefix = "MIDI Error: ";
-                break;
-            case RtMidiError::SYSTEM_ERROR:
-                prefix = "MIDI Error: ";
-                break;
-            case RtMidiError::THREAD_ERROR:
-                prefix = "MIDI Error: ";
-                break;
-        }
-        
-        ui->addConsoleMessage(prefix + errorText);
+        static_cast<UI*>(uiPointer)->addConsoleMessage(prefix + errorText);
+    } else {
+        std::cerr << prefix << errorText << std::endl;
     }
 }
 
@@ -116,7 +118,11 @@ bool MidiHandler::openPort(unsigned int portNumber) {
         }
         
         midiIn->openPort(portNumber);
-        
+
+        // Callback mode: messages are stamped on arrival and queued for the
+        // audio thread, instead of polled from RtMidi's internal queue
+        midiIn->setCallback(&MidiHandler::midiInputCallback, this);
+
         // Don't ignore any message types
         midiIn->ignoreTypes(false, false, false);
         
@@ -134,66 +140,89 @@ bool MidiHandler::openPort(unsigned int portNumber) {
     }
 }
 
-void MidiHandler::parseMessage(const std::vector<unsigned char>& message,
-                               void (*noteOnCallback)(int note, int velocity),
-                               void (*noteOffCallback)(int note),
-                               void (*ccCallback)(int controller, int value)) {
-    
-    if (message.size() < 1) return;
-    
-    unsigned char status = message[0] & 0xF0;  // Upper nibble is message type
-    unsigned char channel = message[0] & 0x0F;  // Lower nibble is channel
-    
-    // Note On
-    if (status == MIDI_NOTE_ON && message.size() >= 3) {
-        unsigned char note = message[1];
-        unsigned char velocity = message[2];
-        
-        // Note: MIDI Note On with velocity 0 is actually a Note Off
-        if (velocity == 0) {
-            if (noteOffCallback) {
-                noteOffCallback(note);
-            }
-        } else {
-            if (noteOnCallback) {
-                noteOnCallback(note, velocity);
-            }
-        }
+int64_t MidiHandler::nowNs() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void MidiHandler::midiInputCallback(double /*deltaTime*/, std::vector<unsigned char>* message,
+                                    void* userData) {
+    MidiHandler* handler = static_cast<MidiHandler*>(userData);
+    if (!handler || !message || message->empty()) {
+        return;
     }
-    // Note Off
-    else if (status == MIDI_NOTE_OFF && message.size() >= 3) {
-        unsigned char note = message[1];
-        if (noteOffCallback) {
-            noteOffCallback(note);
-        }
+
+    // Channel messages by type; of the system messages only clock,
+    // transport and song position (keeps active sensing out of the queue)
+    const unsigned char first = (*message)[0];
+    const unsigned char status = first >= 0xF0 ? first : (first & 0xF0);
+    size_t length = 3;
+    if (status == MIDI_TIMING_CLOCK || status == MIDI_START ||
+        status == MIDI_CONTINUE || status == MIDI_STOP) {
+        length = 1;
+    } else if (status != MIDI_NOTE_ON && status != MIDI_NOTE_OFF &&
+               status != MIDI_CONTROL_CHANGE && status != MIDI_SONG_POSITION) {
+        return;
     }
-    // Control Change
-    else if (status == MIDI_CONTROL_CHANGE && message.size() >= 3) {
-        unsigned char controller = message[1];
-        unsigned char value = message[2];
-        if (ccCallback) {
-            ccCallback(controller, value);
-        }
+    if (message->size() < length) {
+        return;
+    }
+
+    MidiEvent event;
+    event.timeNs = nowNs();
+    event.status = status;
+    event.channel = first < 0xF0 ? (first & 0x0F) : 0;
+    event.data1 = length > 1 ? (*message)[1] : 0;
+    event.data2 = length > 1 ? (*message)[2] : 0;
+    if (!handler->inputQueue.push(event)) {
+        handler->droppedMessages.fetch_add(1, std::memory_order_relaxed);
     }
 }
 
-void MidiHandler::processMessages(void (*noteOnCallback)(int note, int velocity),
-                                 void (*noteOffCallback)(int note),
-                                 void (*ccCallback)(int controller, int value)) {
-    if (!midiIn) return;
-    
-    std::vector<unsigned char> message;
-    double stamp;
-    
-    // Process all pending MIDI messages
-    while (true) {
-        stamp = midiIn->getMessage(&message);
-        
-        if (message.empty()) {
-            break;  // No more messages
+void MidiHandler::collectEvents(EventSchedule& schedule, unsigned int nFrames, double sampleRate,
+                                void (*ccCallback)(int controller, int value),
+                                MidiClockSync* clockSync) {
+    if (!midiIn || nFrames == 0) return;
+
+    // The window this buffer represents is the period that just ended
+    const int64_t windowEnd = nowNs();
+    windowEndNs = windowEnd;
+    const double framesPerNs = sampleRate * 1e-9;
+    const double windowFrames = static_cast<double>(nFrames);
+    const int64_t windowStart = windowEnd - static_cast<int64_t>(windowFrames / framesPerNs);
+
+    MidiEvent event;
+    while (inputQueue.pop(event)) {
+        if (event.status == MIDI_CONTROL_CHANGE) {
+            if (ccCallback) {
+                ccCallback(event.data1, event.data2);
+            }
+            continue;
+        }
+        if (event.status >= 0xF0) {
+            if (clockSync) {
+                switch (event.status) {
+                    case MIDI_TIMING_CLOCK: clockSync->tick(event.timeNs); break;
+                    case MIDI_START: clockSync->start(); break;
+                    case MIDI_CONTINUE: clockSync->resume(); break;
+                    case MIDI_STOP: clockSync->stop(); break;
+                    case MIDI_SONG_POSITION: clockSync->songPosition(event.data1 | (event.data2 << 7)); break;
+                }
+            }
+            continue;
+        }
+
+        // Late arrivals (a slow callback) land on frame 0
+        double offset = static_cast<double>(event.timeNs - windowStart) * framesPerNs;
+        offset = std::min(std::max(offset, 0.0), windowFrames - 1.0);
+        const uint32_t frame = static_cast<uint32_t>(offset);
+
+        // Note: MIDI Note On with velocity 0 is actually a Note Off
+        if (event.status == MIDI_NOTE_ON && event.data2 > 0) {
+            schedule.add(frame, ScheduledEvent::NOTE_ON, event.data1, event.data2, event.channel);
+        } else {
+            schedule.add(frame, ScheduledEvent::NOTE_OFF, event.data1, 0, event.channel);
         }
-        
-        parseMessage(message, noteOnCallback, noteOffCallback, ccCallback);
     }
 }
 
@@ -255,4 +284,76 @@ std::string MidiHandler::getPortName(int port) {
     } catch (RtMidiError& error) {
         return "Error reading port";
     }
-}
\ No newline at end of file
+}
+MidiClockOutput::~MidiClockOutput() {
+    close();
+}
+
+bool MidiClockOutput::open(int port) {
+    close();
+    try {
+        midiOut = new RtMidiOut(RtMidi::UNSPECIFIED, "WakefieldSynth");
+        if (port < 0) {
+            midiOut->openVirtualPort("WakefieldSynth Clock");
+        } else {
+            midiOut->openPort(static_cast<unsigned int>(port));
+        }
+    } catch (RtMidiError& error) {
+        std::cerr << "Error opening MIDI clock output: " << error.getMessage() << std::endl;
+        delete midiOut;
+        midiOut = nullptr;
+        return false;
+    }
+    running = true;
+    sender = std::thread(&MidiClockOutput::run, this);
+    return true;
+}
+
+void MidiClockOutput::close() {
+    running = false;
+    if (sender.joinable()) {
+        sender.join();
+    }
+    delete midiOut;
+    midiOut = nullptr;
+}
+
+void MidiClockOutput::send(unsigned char status, int64_t timeNs) {
+    MidiEvent event;
+    event.timeNs = timeNs;
+    event.status = status;
+    event.data1 = 0;
+    event.data2 = 0;
+    event.channel = 0;
+    if (!outputQueue.push(event)) {
+        droppedMessages.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+void MidiClockOutput::run() {
+    using namespace std::chrono;
+    std::vector<unsigned char> message(1);
+    while (running.load()) {
+        const MidiEvent* next = outputQueue.peek();
+        if (!next) {
+            std::this_thread::sleep_for(milliseconds(1));
+            continue;
+        }
+        const int64_t due = next->timeNs;
+        if (due > MidiHandler::nowNs()) {
+            // Short sleeps, so close() never waits long
+            const nanoseconds wake(std::min(due, MidiHandler::nowNs() + 1000000));
+            std::this_thread::sleep_until(steady_clock::time_point(duration_cast<steady_clock::duration>(wake)));
+            continue;
+        }
+        MidiEvent event{};
+        if (!outputQueue.pop(event)) {
+            continue;
+        }
+        message[0] = event.status;
+        try {
+            midiOut->sendMessage(&message);
+        } catch (RtMidiError&) {
+        }
+    }
+}
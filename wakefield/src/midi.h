@@ -2,14 +2,37 @@
 #define MIDI_H
 
 #include <RtMidi.h>
+#include <atomic>
+#include <cstdint>
+#include <thread>
 #include <vector>
 #include <string>
+#include "event_schedule.h"
+#include "spsc_queue.h"
+
+class MidiClockSync;
 
 // MIDI message status bytes
 constexpr unsigned char MIDI_NOTE_OFF = 0x80;
 constexpr unsigned char MIDI_NOTE_ON = 0x90;
 constexpr unsigned char MIDI_CONTROL_CHANGE = 0xB0;
 
+// System messages used for clock sync
+constexpr unsigned char MIDI_SONG_POSITION = 0xF2;
+constexpr unsigned char MIDI_TIMING_CLOCK = 0xF8;
+constexpr unsigned char MIDI_START = 0xFA;
+constexpr unsigned char MIDI_CONTINUE = 0xFB;
+constexpr unsigned char MIDI_STOP = 0xFC;
+
+// A channel message as received, stamped on RtMidi's input thread
+struct MidiEvent {
+    int64_t timeNs;         // steady_clock time of arrival
+    uint8_t status;
+    uint8_t data1;
+    uint8_t data2;
+    uint8_t channel;        // 0-15; status has it stripped
+};
+
 // MIDI helper functions
 class MidiHandler {
 public:
@@ -25,10 +48,25 @@ public:
     // Open a specific port (or default)
     bool openPort(unsigned int portNumber = 1);
     
-    // Get pending messages (call this from audio thread)
-    void processMessages(void (*noteOnCallback)(int note, int velocity),
-                        void (*noteOffCallback)(int note),
-                        void (*ccCallback)(int controller, int value) = nullptr);
+    // Audio thread, once per buffer: drain the input queue. Notes go into
+    // schedule at the frame matching their arrival time relative to the
+    // previous buffer period (one buffer of constant latency instead of up
+    // to one buffer of jitter); CCs are handled immediately. Clock and
+    // transport messages go to clockSync, if given, with their arrival
+    // times, so tempo tracking sees no buffer-boundary jitter.
+    void collectEvents(EventSchedule& schedule, unsigned int nFrames, double sampleRate,
+                       void (*ccCallback)(int controller, int value) = nullptr,
+                       MidiClockSync* clockSync = nullptr);
+
+    // End of the window the last collectEvents mapped onto its buffer:
+    // frame nFrames of that buffer in MidiEvent::timeNs time
+    int64_t getWindowEndNs() const { return windowEndNs; }
+
+    // Messages dropped because the input queue was full (RtMidi thread counter)
+    uint32_t getDroppedMessages() const { return droppedMessages.load(std::memory_order_relaxed); }
+
+    // steady_clock in nanoseconds, the time base of MidiEvent::timeNs
+    static int64_t nowNs();
 
     // Add this to the public section of MidiHandler class
     int findPortByName(const std::string& searchString);
@@ -48,15 +86,52 @@ private:
     int currentPort;
     RtMidiIn* midiIn;
     static void* uiPointer;  // Static pointer to UI for error callback
-    
-    // Parse a MIDI message
-    void parseMessage(const std::vector<unsigned char>& message,
-                     void (*noteOnCallback)(int note, int velocity),
-                     void (*noteOffCallback)(int note),
-                     void (*ccCallback)(int controller, int value));
+
+    // RtMidi input thread -> audio thread. 512 events covers a dense
+    // controller sweep across one long buffer
+    SpscQueue<MidiEvent, 512> inputQueue;
+    std::atomic<uint32_t> droppedMessages{0};
+    int64_t windowEndNs = 0;
+
+    // RtMidi callback mode: runs on RtMidi's input thread
+    static void midiInputCallback(double deltaTime, std::vector<unsigned char>* message, void* userData);
     
     // Static error callback for RtMidi - routes to console
     static void midiErrorCallback(RtMidiError::Type type, const std::string& errorText, void* userData);
 };
 
+// MIDI clock and transport output. The audio thread queues each message
+// with the time it should leave, from the frame it falls on; a sender
+// thread sleeps until then, so ticks keep their place within the buffer
+// instead of leaving in a burst per callback.
+class MidiClockOutput {
+public:
+    MidiClockOutput() = default;
+    ~MidiClockOutput();
+
+    // Open an output port (a virtual port named "WakefieldSynth Clock" if
+    // port is negative) and start the sender thread
+    bool open(int port);
+    void close();
+    bool isOpen() const { return midiOut != nullptr; }
+
+    // Audio thread: send status at timeNs (steady_clock, as MidiHandler::nowNs)
+    void send(unsigned char status, int64_t timeNs);
+
+    // Messages dropped because the queue was full
+    uint32_t getDroppedMessages() const { return droppedMessages.load(std::memory_order_relaxed); }
+
+    MidiClockOutput(const MidiClockOutput&) = delete;
+    MidiClockOutput& operator=(const MidiClockOutput&) = delete;
+
+private:
+    void run();
+
+    RtMidiOut* midiOut = nullptr;
+    SpscQueue<MidiEvent, 256> outputQueue;
+    std::atomic<uint32_t> droppedMessages{0};
+    std::atomic<bool> running{false};
+    std::thread sender;
+};
+
 #endif // MIDI_H
\ No newline at end of file
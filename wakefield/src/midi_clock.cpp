@@ -0,0 +1,89 @@
+#include "midi_clock.h"
+#include <cmath>
+
+void MidiClockSync::tick(int64_t timeNs) {
+    if (pendingStart != Transport::NONE) {
+        // The first tick after Start / Continue is where playback begins
+        tickCount = pendingStart == Transport::START ? 0 : resumeTick;
+        transport = pendingStart;
+        pendingStart = Transport::NONE;
+        running = true;
+    } else if (running) {
+        ++tickCount;
+    }
+
+    if (!primed) {
+        restartLoop(timeNs);
+        return;
+    }
+    if (!locked) {
+        // Second tick: the raw interval seeds the period
+        period = static_cast<double>(timeNs - lastTickNs);
+        tickTime = static_cast<double>(timeNs);
+        nextTime = tickTime + period;
+        lastTickNs = timeNs;
+        locked = period > 0.0;
+        if (!locked) {
+            restartLoop(timeNs);
+        }
+        return;
+    }
+
+    // A tick more than a period from its prediction (lost ticks, a tempo
+    // jump, the sender pausing) restarts the loop instead of dragging it
+    const double error = static_cast<double>(timeNs) - nextTime;
+    if (std::abs(error) > period) {
+        restartLoop(timeNs);
+        return;
+    }
+    const double omega = 2.0 * M_PI * kBandwidthHz * period * 1e-9;
+    tickTime = nextTime;
+    nextTime += std::sqrt(2.0) * omega * error + period;
+    period += omega * omega * error;
+    lastTickNs = timeNs;
+}
+
+void MidiClockSync::restartLoop(int64_t timeNs) {
+    primed = true;
+    locked = false;
+    lastTickNs = timeNs;
+    tickTime = static_cast<double>(timeNs);
+}
+
+void MidiClockSync::start() {
+    resumeTick = 0;
+    pendingStart = Transport::START;
+}
+
+void MidiClockSync::resume() {
+    pendingStart = Transport::CONTINUE;
+}
+
+void MidiClockSync::stop() {
+    running = false;
+    pendingStart = Transport::NONE;
+    transport = Transport::STOP;
+    resumeTick = tickCount + 1;
+}
+
+void MidiClockSync::songPosition(int sixteenths) {
+    resumeTick = static_cast<int64_t>(sixteenths) * (kTicksPerBeat / 4);
+}
+
+MidiClockSync::Transport MidiClockSync::takeTransport() {
+    const Transport result = transport;
+    transport = Transport::NONE;
+    return result;
+}
+
+double MidiClockSync::getTempo() const {
+    return locked ? 60e9 / (period * kTicksPerBeat) : 0.0;
+}
+
+double MidiClockSync::beatAt(int64_t timeNs) const {
+    if (!locked) {
+        return static_cast<double>(tickCount) / kTicksPerBeat;
+    }
+    const double ticks = static_cast<double>(tickCount) + (static_cast<double>(timeNs) - tickTime) / period;
+    return ticks / kTicksPerBeat;
+}
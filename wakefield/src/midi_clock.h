@@ -0,0 +1,62 @@
+#ifndef MIDI_CLOCK_H
+#define MIDI_CLOCK_H
+
+#include <cstdint>
+
+// MIDI clock follower. Incoming ticks (24 to the quarter note), stamped on
+// the MIDI input thread, drive a second-order delay-locked loop that
+// filters their jitter: it predicts when the next tick is due, and pulls
+// that prediction and the tick period towards what actually arrives, by a
+// fraction set by the loop bandwidth. The filtered tick times give a tempo
+// and a beat position at any time, which the transport Clock is steered to.
+//
+// Start is latched until the first tick after it, which is beat 0; Song
+// Position Pointer sets where Continue resumes. Audio thread only.
+class MidiClockSync {
+public:
+    static constexpr int kTicksPerBeat = 24;
+    static constexpr double kBandwidthHz = 1.0;
+
+    enum class Transport { NONE, START, CONTINUE, STOP };
+
+    // Messages in arrival order, with their input timestamps
+    void tick(int64_t timeNs);
+    void start();
+    void resume();
+    void stop();
+    void songPosition(int sixteenths);
+
+    // Transport change received since the last call, NONE if none; START
+    // and CONTINUE are reported with the tick that begins playback
+    Transport takeTransport();
+
+    // Two ticks seen since the last start: tempo and position are valid
+    bool isLocked() const { return locked; }
+
+    // Tempo from the filtered tick period
+    double getTempo() const;
+
+    // Filtered beat position at timeNs, extrapolated from the last tick
+    double beatAt(int64_t timeNs) const;
+
+private:
+    void restartLoop(int64_t timeNs);
+
+    bool running = false;
+    bool locked = false;
+    bool primed = false;                // One tick seen: the next sets the period
+    Transport pendingStart = Transport::NONE;   // Waits for the first tick
+    Transport transport = Transport::NONE;
+
+    int64_t tickCount = 0;              // Tick number of the latest tick
+    int64_t resumeTick = 0;             // From Song Position Pointer
+    int64_t lastTickNs = 0;
+
+    // Loop state: filtered time of the latest tick, predicted time of the
+    // next, and the filtered period, all in nanoseconds
+    double tickTime = 0.0;
+    double nextTime = 0.0;
+    double period = 0.0;
+};
+
+#endif // MIDI_CLOCK_H
@@ -0,0 +1,282 @@
+#include "midi_file.h"
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iterator>
+
+static constexpr uint8_t kNoteOff = 0x80;
+static constexpr uint8_t kNoteOn = 0x90;
+static constexpr uint8_t kControlChange = 0xB0;
+
+namespace {
+
+// One event as stored in a track, before ticks are turned into seconds
+struct RawEvent {
+    uint64_t tick;
+    bool tempo;                 // Set tempo meta event; usPerQuarter is valid
+    uint32_t usPerQuarter;
+    uint8_t status, data1, data2;
+    uint8_t channel;
+};
+
+class Reader {
+public:
+    Reader(const uint8_t* data, size_t size) : data(data), size(size) {}
+
+    bool atEnd() const { return pos >= size; }
+    size_t remaining() const { return size - pos; }
+    size_t position() const { return pos; }
+
+    bool byte(uint8_t& out) {
+        if (pos >= size) return false;
+        out = data[pos++];
+        return true;
+    }
+
+    bool bigEndian(int bytes, uint32_t& out) {
+        if (remaining() < static_cast<size_t>(bytes)) return false;
+        out = 0;
+        for (int i = 0; i < bytes; ++i) {
+            out = (out << 8) | data[pos++];
+        }
+        return true;
+    }
+
+    // Variable-length quantity, at most 4 bytes
+    bool varLen(uint32_t& out) {
+        out = 0;
+        for (int i = 0; i < 4; ++i) {
+            uint8_t b;
+            if (!byte(b)) return false;
+            out = (out << 7) | (b & 0x7F);
+            if (!(b & 0x80)) return true;
+        }
+        return false;
+    }
+
+    bool skip(size_t bytes) {
+        if (remaining() < bytes) return false;
+        pos += bytes;
+        return true;
+    }
+
+private:
+    const uint8_t* data;
+    size_t size;
+    size_t pos = 0;
+};
+
+bool parseTrack(Reader& track, std::vector<RawEvent>& out, std::string& error) {
+    uint64_t tick = 0;
+    uint8_t runningStatus = 0;
+
+    while (!track.atEnd()) {
+        uint32_t delta;
+        if (!track.varLen(delta)) {
+            error = "truncated delta time";
+            return false;
+        }
+        tick += delta;
+
+        uint8_t status;
+        if (!track.byte(status)) {
+            error = "truncated event";
+            return false;
+        }
+
+        if (status == 0xFF) {
+            // Meta event: only End of Track and Set Tempo matter
+            uint8_t type;
+            uint32_t length;
+            if (!track.byte(type) || !track.varLen(length) || track.remaining() < length) {
+                error = "truncated meta event";
+                return false;
+            }
+            if (type == 0x2F) {
+                return true;
+            }
+            if (type == 0x51 && length == 3) {
+                uint32_t usPerQuarter;
+                if (!track.bigEndian(3, usPerQuarter)) {
+                    error = "truncated tempo event";
+                    return false;
+                }
+                out.push_back(RawEvent{tick, true, usPerQuarter, 0, 0, 0, 0});
+            } else {
+                track.skip(length);
+            }
+            continue;
+        }
+
+        if (status == 0xF0 || status == 0xF7) {
+            uint32_t length;
+            if (!track.varLen(length) || !track.skip(length)) {
+                error = "truncated sysex";
+                return false;
+            }
+            continue;
+        }
+
+        uint8_t data1;
+        if (status & 0x80) {
+            runningStatus = status;
+            if (!track.byte(data1)) {
+                error = "truncated channel message";
+                return false;
+            }
+        } else {
+            if (!runningStatus) {
+                error = "data byte without a status";
+                return false;
+            }
+            data1 = status;
+            status = runningStatus;
+        }
+
+        // Program change and channel pressure carry one data byte
+        const uint8_t type = status & 0xF0;
+        uint8_t data2 = 0;
+        if (type != 0xC0 && type != 0xD0 && !track.byte(data2)) {
+            error = "truncated channel message";
+            return false;
+        }
+
+        if (type == kNoteOn || type == kNoteOff || type == kControlChange) {
+            out.push_back(RawEvent{tick, false, 0, type, data1, data2, static_cast<uint8_t>(status & 0x0F)});
+        }
+    }
+    return true;  // Missing End of Track is tolerated
+}
+
+}
+
+bool MidiFile::load(const std::string& path, std::string& error) {
+    events.clear();
+
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+        error = "cannot open " + path;
+        return false;
+    }
+    std::vector<uint8_t> bytes((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    Reader reader(bytes.data(), bytes.size());
+
+    uint32_t id, length, format, trackCount, division;
+    if (!reader.bigEndian(4, id) || id != 0x4D546864 ||  // "MThd"
+        !reader.bigEndian(4, length) || length < 6 ||
+        !reader.bigEndian(2, format) || !reader.bigEndian(2, trackCount) ||
+        !reader.bigEndian(2, division) || !reader.skip(length - 6)) {
+        error = "not a Standard MIDI File";
+        return false;
+    }
+    if (format > 1) {
+        error = "format 2 MIDI files are not supported";
+        return false;
+    }
+    // SMPTE division: the high byte is minus the frame rate (24, 25, 29 for
+    // 29.97 drop-frame, or 30) and the low byte is ticks per frame
+    const bool smpte = (division & 0x8000) != 0;
+    const int framesPerSecond = smpte ? -static_cast<int8_t>(division >> 8) : 0;
+    const int ticksPerFrame = division & 0xFF;
+    if (smpte ? (ticksPerFrame == 0 || (framesPerSecond != 24 && framesPerSecond != 25 &&
+                                        framesPerSecond != 29 && framesPerSecond != 30))
+              : division == 0) {
+        error = "invalid time division";
+        return false;
+    }
+
+    std::vector<RawEvent> raw;
+    uint32_t tracksRead = 0;
+    while (tracksRead < trackCount && reader.remaining() >= 8) {
+        uint32_t chunkId, chunkLength;
+        if (!reader.bigEndian(4, chunkId) || !reader.bigEndian(4, chunkLength) ||
+            reader.remaining() < chunkLength) {
+            error = "truncated chunk";
+            return false;
+        }
+        const size_t start = reader.position();
+        reader.skip(chunkLength);
+        if (chunkId != 0x4D54726B) {  // "MTrk"; other chunks are skipped
+            continue;
+        }
+        Reader track(bytes.data() + start, chunkLength);
+        if (!parseTrack(track, raw, error)) {
+            error = "track " + std::to_string(tracksRead + 1) + ": " + error;
+            return false;
+        }
+        ++tracksRead;
+    }
+
+    // Merge tracks; at equal ticks tempo changes apply first
+    std::stable_sort(raw.begin(), raw.end(), [](const RawEvent& a, const RawEvent& b) {
+        if (a.tick != b.tick) return a.tick < b.tick;
+        return a.tempo && !b.tempo;
+    });
+
+    // SMPTE division: fixed seconds per tick. Otherwise ticks per quarter
+    // note, following the tempo map (default 120 BPM)
+    double secondsPerTick;
+    double ticksPerQuarter = 0.0;
+    if (smpte) {
+        const double frameRate = framesPerSecond == 29 ? 30000.0 / 1001.0 : framesPerSecond;
+        secondsPerTick = 1.0 / (frameRate * ticksPerFrame);
+    } else {
+        ticksPerQuarter = static_cast<double>(division);
+        secondsPerTick = 0.5 / ticksPerQuarter;
+    }
+
+    uint64_t lastTick = 0;
+    double seconds = 0.0;
+    events.reserve(raw.size());
+    for (const RawEvent& e : raw) {
+        seconds += static_cast<double>(e.tick - lastTick) * secondsPerTick;
+        lastTick = e.tick;
+        if (e.tempo) {
+            if (!smpte && e.usPerQuarter > 0) {
+                secondsPerTick = e.usPerQuarter * 1e-6 / ticksPerQuarter;
+            }
+            continue;
+        }
+        events.push_back(Event{seconds, e.status, e.data1, e.data2, e.channel});
+    }
+    return true;
+}
+
+MidiFilePlayer::MidiFilePlayer(const MidiFile& file, double sampleRate)
+    : file(file)
+    , sampleRate(sampleRate) {
+}
+
+void MidiFilePlayer::collectEvents(EventSchedule& schedule, unsigned int nFrames,
+                                   void (*ccCallback)(int controller, int value)) {
+    const std::vector<MidiFile::Event>& events = file.getEvents();
+    const uint64_t bufferEnd = framePosition + nFrames;
+
+    while (nextEvent < events.size()) {
+        const MidiFile::Event& event = events[nextEvent];
+        const uint64_t eventFrame = static_cast<uint64_t>(std::llround(event.seconds * sampleRate));
+        if (eventFrame >= bufferEnd) {
+            break;
+        }
+        ++nextEvent;
+
+        if (event.status == kControlChange) {
+            if (ccCallback) {
+                ccCallback(event.data1, event.data2);
+            }
+            continue;
+        }
+
+        const uint32_t frame = eventFrame > framePosition
+                                   ? static_cast<uint32_t>(eventFrame - framePosition)
+                                   : 0;
+        // Note On with velocity 0 is a Note Off
+        if (event.status == kNoteOn && event.data2 > 0) {
+            schedule.add(frame, ScheduledEvent::NOTE_ON, event.data1, event.data2, event.channel);
+        } else {
+            schedule.add(frame, ScheduledEvent::NOTE_OFF, event.data1, 0, event.channel);
+        }
+    }
+
+    framePosition = bufferEnd;
+}
@@ -0,0 +1,55 @@
+#ifndef MIDI_FILE_H
+#define MIDI_FILE_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "event_schedule.h"
+
+// Standard MIDI File (format 0 or 1) reader for offline rendering. All
+// tracks are merged and tempo changes applied, so each channel message
+// ends up with an absolute time in seconds. Only note on/off and control
+// change are kept, the same messages the live input handles.
+class MidiFile {
+public:
+    struct Event {
+        double seconds;
+        uint8_t status;     // Channel stripped: 0x80, 0x90 or 0xB0
+        uint8_t data1;
+        uint8_t data2;
+        uint8_t channel;    // 0-15
+    };
+
+    // Returns false and sets error if the file can't be read or parsed
+    bool load(const std::string& path, std::string& error);
+
+    const std::vector<Event>& getEvents() const { return events; }
+
+    // Time of the last event
+    double getDuration() const { return events.empty() ? 0.0 : events.back().seconds; }
+
+private:
+    std::vector<Event> events;
+};
+
+// Feeds a MidiFile to the audio callback buffer by buffer, the way
+// MidiHandler::collectEvents feeds live input: notes go into the schedule
+// on their exact frame, CCs are handled at the start of the buffer.
+class MidiFilePlayer {
+public:
+    MidiFilePlayer(const MidiFile& file, double sampleRate);
+
+    void collectEvents(EventSchedule& schedule, unsigned int nFrames,
+                       void (*ccCallback)(int controller, int value) = nullptr);
+
+    // True once every event has been handed out
+    bool isFinished() const { return nextEvent >= file.getEvents().size(); }
+
+private:
+    const MidiFile& file;
+    double sampleRate;
+    size_t nextEvent = 0;
+    uint64_t framePosition = 0;   // Frames rendered before the current buffer
+};
+
+#endif // MIDI_FILE_H
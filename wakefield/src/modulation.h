@@ -7,6 +7,8 @@ constexpr int kModulationSlotCount = 16;
 constexpr int kClockModSourceIndex = 12;
 constexpr int kClockTargetSequencerBase = 69;
 constexpr int kClockTargetSamplerBase = 73;
+constexpr int kModulationDestinationCount = 77;
+constexpr int kEnvelopeModSourceIndex = 4;  // ENV 1 follows the voice being rendered
 
 // Modulation slot for the modulation matrix
 struct ModulationSlot {
@@ -36,4 +38,23 @@ struct ModulationSlot {
     }
 };
 
+// One complete slot, pre-decoded for the audio thread
+struct ModulationRoute {
+    int8_t source;
+    int8_t curve;
+    bool unidirectional;
+    float amount;             // Slot amount / 99
+    uint16_t destination;     // Float offset into Synth::ModulationOutputs
+};
+
+// Flat routing program compiled from the slot table whenever it changes.
+// Routes whose source reads the current voice are kept apart so the
+// voice-independent ones are evaluated once per buffer.
+struct ModulationProgram {
+    ModulationRoute globalRoutes[kModulationSlotCount];
+    ModulationRoute voiceRoutes[kModulationSlotCount];
+    int globalCount = 0;
+    int voiceCount = 0;
+};
+
 #endif // MODULATION_H
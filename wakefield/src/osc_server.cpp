@@ -0,0 +1,219 @@
+#include "osc_server.h"
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+
+namespace {
+
+// OSC strings are NUL-terminated and padded to a multiple of 4 bytes.
+// Returns the string and advances offset past its padding, or nullptr
+const char* readString(const char* data, size_t size, size_t& offset) {
+    const char* start = data + offset;
+    const void* end = std::memchr(start, '\0', size - offset);
+    if (!end) {
+        return nullptr;
+    }
+    const size_t length = static_cast<const char*>(end) - start;
+    offset += (length + 4) & ~size_t(3);
+    return offset <= size ? start : nullptr;
+}
+
+bool readInt32(const char* data, size_t size, size_t& offset, uint32_t& value) {
+    if (offset + 4 > size) {
+        return false;
+    }
+    std::memcpy(&value, data + offset, 4);
+    value = ntohl(value);
+    offset += 4;
+    return true;
+}
+
+// The first argument as a float: f, i, d, T and F are accepted
+bool readNumber(const char* data, size_t size, size_t& offset, char tag, float& value) {
+    uint32_t word = 0;
+    switch (tag) {
+        case 'f':
+            if (!readInt32(data, size, offset, word)) return false;
+            std::memcpy(&value, &word, 4);
+            return true;
+        case 'i':
+            if (!readInt32(data, size, offset, word)) return false;
+            value = static_cast<float>(static_cast<int32_t>(word));
+            return true;
+        case 'd': {
+            uint32_t low = 0;
+            if (!readInt32(data, size, offset, word) || !readInt32(data, size, offset, low)) return false;
+            const uint64_t bits = (static_cast<uint64_t>(word) << 32) | low;
+            double d;
+            std::memcpy(&d, &bits, 8);
+            value = static_cast<float>(d);
+            return true;
+        }
+        case 'T': value = 1.0f; return true;
+        case 'F': value = 0.0f; return true;
+    }
+    return false;
+}
+
+// Address below prefix, or nullptr
+const char* under(const char* address, const char* prefix) {
+    const size_t length = std::strlen(prefix);
+    return std::strncmp(address, prefix, length) == 0 ? address + length : nullptr;
+}
+
+} // namespace
+
+OscServer::~OscServer() {
+    stop();
+}
+
+bool OscServer::start(int port) {
+    stop();
+    socketFd = socket(AF_INET, SOCK_DGRAM, 0);
+    if (socketFd < 0) {
+        std::cerr << "OSC: cannot create socket: " << std::strerror(errno) << std::endl;
+        return false;
+    }
+    // Room for a burst of small packets while the thread is descheduled
+    const int receiveBuffer = 1 << 20;
+    setsockopt(socketFd, SOL_SOCKET, SO_RCVBUF, &receiveBuffer, sizeof(receiveBuffer));
+
+    sockaddr_in address{};
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_ANY);
+    address.sin_port = htons(static_cast<uint16_t>(port));
+    if (bind(socketFd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0) {
+        std::cerr << "OSC: cannot bind UDP port " << port << ": " << std::strerror(errno) << std::endl;
+        close(socketFd);
+        socketFd = -1;
+        return false;
+    }
+    running = true;
+    thread = std::thread(&OscServer::run, this);
+    return true;
+}
+
+void OscServer::stop() {
+    running = false;
+    if (thread.joinable()) {
+        thread.join();
+    }
+    if (socketFd >= 0) {
+        close(socketFd);
+        socketFd = -1;
+    }
+}
+
+void OscServer::run() {
+    // Largest UDP payload; polled so stop() is noticed within 100 ms
+    static constexpr size_t kMaxPacket = 65536;
+    char* packet = static_cast<char*>(std::malloc(kMaxPacket));
+    pollfd fd{socketFd, POLLIN, 0};
+    while (packet && running.load()) {
+        if (poll(&fd, 1, 100) <= 0) {
+            continue;
+        }
+        const ssize_t received = recv(socketFd, packet, kMaxPacket, 0);
+        if (received > 0) {
+            handlePacket(packet, static_cast<size_t>(received));
+        }
+    }
+    std::free(packet);
+}
+
+void OscServer::handlePacket(const char* data, size_t size) {
+    if (size < 4 || (size & 3) != 0) {
+        malformedPackets.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    if (size >= 16 && std::memcmp(data, "#bundle", 8) == 0) {
+        // Skip the time tag; each element is a size-prefixed packet
+        size_t offset = 16;
+        while (offset < size) {
+            uint32_t length = 0;
+            if (!readInt32(data, size, offset, length) || length > size - offset) {
+                malformedPackets.fetch_add(1, std::memory_order_relaxed);
+                return;
+            }
+            handlePacket(data + offset, length);
+            offset += length;
+        }
+        return;
+    }
+    if (!handleMessage(data, size)) {
+        malformedPackets.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+bool OscServer::handleMessage(const char* data, size_t size) {
+    size_t offset = 0;
+    const char* address = readString(data, size, offset);
+    if (!address || address[0] != '/') {
+        return false;
+    }
+    const char* tags = offset < size ? readString(data, size, offset) : ",";
+    if (!tags || tags[0] != ',') {
+        return false;
+    }
+    float value = 0.0f;
+    const bool hasValue = tags[1] != '\0' && readNumber(data, size, offset, tags[1], value);
+
+    const char* path = under(address, "/wakefield/");
+    if (!path) {
+        return true;    // Someone else's address: ignored
+    }
+    if (const char* id = under(path, "param/")) {
+        char* end = nullptr;
+        const long parameter = std::strtol(id, &end, 10);
+        if (!hasValue || end == id || *end != '\0' || parameter < 0 || parameter >= kParameterSlots) {
+            return false;
+        }
+        setValue(static_cast<int>(parameter), std::min(std::max(value, 0.0f), 1.0f));
+    } else if (std::strcmp(path, "tempo") == 0) {
+        if (!hasValue) return false;
+        setValue(kSlotTempo, value);
+    } else if (std::strcmp(path, "morph") == 0) {
+        if (!hasValue) return false;
+        setValue(kSlotMorph, std::min(std::max(value, 0.0f), 1.0f));
+    } else {
+        // Buttons fire on press: no argument or a value above 0.5 (a
+        // controller's release message is ignored)
+        static const struct { const char* path; Command command; } kButtons[] = {
+            {"transport/play", Command::PLAY},
+            {"transport/stop", Command::STOP},
+            {"transport/reset", Command::RESET},
+            {"loop/recplay", Command::LOOP_REC_PLAY},
+            {"loop/overdub", Command::LOOP_OVERDUB},
+            {"loop/stop", Command::LOOP_STOP},
+            {"loop/clear", Command::LOOP_CLEAR},
+        };
+        for (const auto& button : kButtons) {
+            if (std::strcmp(path, button.path) == 0) {
+                if (!hasValue || value > 0.5f) {
+                    pushCommand(button.command);
+                }
+                return true;
+            }
+        }
+        return false;
+    }
+    return true;
+}
+
+void OscServer::setValue(int slot, float value) {
+    values[slot].store(value, std::memory_order_relaxed);
+    dirty.fetch_or(uint64_t(1) << slot, std::memory_order_release);
+}
+
+void OscServer::pushCommand(Command command) {
+    if (!commands.push(command)) {
+        droppedCommands.fetch_add(1, std::memory_order_relaxed);
+    }
+}
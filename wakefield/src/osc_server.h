@@ -0,0 +1,89 @@
+#ifndef OSC_SERVER_H
+#define OSC_SERVER_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include "spsc_queue.h"
+
+// OSC over UDP for remote control. A server thread receives and parses
+// packets (messages and bundles; bundle time tags are ignored, everything
+// applies on the next buffer). Addresses:
+//
+//   /wakefield/param/<id> f     parameter id 0-49 (as MIDI learn), 0-1 over its range
+//   /wakefield/tempo f          sequencer tempo in BPM
+//   /wakefield/morph f          preset morph position, 0-1
+//   /wakefield/transport/play, /stop, /reset
+//   /wakefield/loop/recplay, /overdub, /stop, /clear   (current loop)
+//
+// Values are coalesced on the way in: each slot keeps only its newest
+// value and a dirty bit, so a fader flood of any rate costs the audio
+// thread at most one write per slot per buffer. Transport and loop
+// buttons are events and go through a bounded queue instead; when it is
+// full they are dropped and counted.
+class OscServer {
+public:
+    static constexpr int kParameterSlots = 50;
+    static constexpr int kSlotTempo = 50;
+    static constexpr int kSlotMorph = 51;
+    static constexpr int kSlots = 52;
+
+    enum class Command : uint8_t {
+        PLAY, STOP, RESET,
+        LOOP_REC_PLAY, LOOP_OVERDUB, LOOP_STOP, LOOP_CLEAR
+    };
+
+    OscServer() = default;
+    ~OscServer();
+
+    // Bind UDP port on all interfaces and start the server thread
+    bool start(int port);
+    void stop();
+
+    // Audio thread, once per buffer: apply(slot, value) for each slot
+    // written since the last call, with its newest value
+    template <typename Apply>
+    void drainValues(Apply&& apply) {
+        uint64_t pending = dirty.exchange(0, std::memory_order_acquire);
+        while (pending) {
+            const int slot = __builtin_ctzll(pending);
+            pending &= pending - 1;
+            apply(slot, values[slot].load(std::memory_order_relaxed));
+        }
+    }
+
+    // Audio thread: the next queued command, in arrival order
+    bool popCommand(Command& command) { return commands.pop(command); }
+
+    // Server thread counters
+    uint32_t getDroppedCommands() const { return droppedCommands.load(std::memory_order_relaxed); }
+    uint32_t getMalformedPackets() const { return malformedPackets.load(std::memory_order_relaxed); }
+
+    OscServer(const OscServer&) = delete;
+    OscServer& operator=(const OscServer&) = delete;
+
+    // Parse and apply one packet (the server thread's entry point, public
+    // so packets can be fed without a socket)
+    void handlePacket(const char* data, size_t size);
+
+private:
+    static_assert(kSlots <= 64, "dirty mask is 64 bits");
+
+    void run();
+    bool handleMessage(const char* data, size_t size);
+    void setValue(int slot, float value);
+    void pushCommand(Command command);
+
+    std::atomic<float> values[kSlots] = {};
+    std::atomic<uint64_t> dirty{0};
+    SpscQueue<Command, 64> commands;
+    std::atomic<uint32_t> droppedCommands{0};
+    std::atomic<uint32_t> malformedPackets{0};
+
+    int socketFd = -1;
+    std::atomic<bool> running{false};
+    std::thread thread;
+};
+
+#endif // OSC_SERVER_H
@@ -0,0 +1,411 @@
+#include "output_recorder.h"
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <fcntl.h>
+#include <pwd.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace {
+
+// Sample data starts at this offset, so O_DIRECT writes stay aligned
+constexpr size_t kHeaderBytes = 4096;
+constexpr size_t kAlignment = 4096;
+constexpr size_t kFrameBytes = 2 * sizeof(float);
+
+// Headers are brought up to date this often while recording
+constexpr auto kHeaderInterval = std::chrono::seconds(5);
+// The writer looks at the ring this often when it has less than a piece
+constexpr auto kWriterPoll = std::chrono::milliseconds(20);
+
+void put16(uint8_t* at, uint16_t v) { std::memcpy(at, &v, 2); }
+void put32(uint8_t* at, uint32_t v) { std::memcpy(at, &v, 4); }
+void put64(uint8_t* at, uint64_t v) { std::memcpy(at, &v, 8); }
+
+// RIFF (or RF64 once past 4 GiB) WAVE, 32-bit float stereo:
+//   0  RIFF/RF64 size WAVE
+//   12 JUNK/ds64, 28 bytes: RIFF size, data size, frames (64-bit), table 0
+//   48 fmt, 72 fact, 84 JUNK padding, 4088 data size, 4096 samples
+void buildHeader(uint8_t* page, unsigned int sampleRate, uint64_t dataBytes) {
+    std::memset(page, 0, kHeaderBytes);
+    const uint64_t riffBytes = kHeaderBytes - 8 + dataBytes;
+    const uint64_t frames = dataBytes / kFrameBytes;
+    const bool rf64 = riffBytes > 0xFFFFFFFFull;
+
+    std::memcpy(page, rf64 ? "RF64" : "RIFF", 4);
+    put32(page + 4, rf64 ? 0xFFFFFFFFu : static_cast<uint32_t>(riffBytes));
+    std::memcpy(page + 8, "WAVE", 4);
+
+    std::memcpy(page + 12, rf64 ? "ds64" : "JUNK", 4);
+    put32(page + 16, 28);
+    if (rf64) {
+        put64(page + 20, riffBytes);
+        put64(page + 28, dataBytes);
+        put64(page + 36, frames);
+    }
+
+    std::memcpy(page + 48, "fmt ", 4);
+    put32(page + 52, 16);
+    put16(page + 56, 3);                            // WAVE_FORMAT_IEEE_FLOAT
+    put16(page + 58, 2);
+    put32(page + 60, sampleRate);
+    put32(page + 64, sampleRate * static_cast<uint32_t>(kFrameBytes));
+    put16(page + 68, static_cast<uint16_t>(kFrameBytes));
+    put16(page + 70, 32);
+
+    std::memcpy(page + 72, "fact", 4);
+    put32(page + 76, 4);
+    put32(page + 80, static_cast<uint32_t>(std::min<uint64_t>(frames, 0xFFFFFFFFull)));
+
+    std::memcpy(page + 84, "JUNK", 4);
+    put32(page + 88, static_cast<uint32_t>(kHeaderBytes - 8 - 92));
+
+    std::memcpy(page + kHeaderBytes - 8, "data", 4);
+    put32(page + kHeaderBytes - 4, rf64 ? 0xFFFFFFFFu : static_cast<uint32_t>(dataBytes));
+}
+
+std::string stemPath(const std::string& path, int loop) {
+    std::string base = path;
+    const size_t dot = base.rfind('.');
+    if (dot != std::string::npos && base.find('/', dot) == std::string::npos) {
+        base.resize(dot);
+    }
+    return base + ".loop" + std::to_string(loop + 1) + ".wav";
+}
+
+bool writeAll(int fd, const void* data, size_t bytes, uint64_t offset) {
+    const uint8_t* at = static_cast<const uint8_t*>(data);
+    while (bytes > 0) {
+        const ssize_t n = pwrite(fd, at, bytes, static_cast<off_t>(offset));
+        if (n < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return false;
+        }
+        at += n;
+        bytes -= static_cast<size_t>(n);
+        offset += static_cast<uint64_t>(n);
+    }
+    return true;
+}
+
+} // namespace
+
+OutputRecorder::~OutputRecorder() {
+    std::string summary;
+    stop(summary);
+    std::free(writeBuffer);
+    std::free(headerPage);
+}
+
+std::string OutputRecorder::getDefaultPath() {
+    const char* homeDir = getenv("HOME");
+    if (!homeDir) {
+        struct passwd* pw = getpwuid(getuid());
+        homeDir = pw->pw_dir;
+    }
+    std::string directory = std::string(homeDir) + "/.config";
+    mkdir(directory.c_str(), 0755);
+    directory += "/wakefield";
+    mkdir(directory.c_str(), 0755);
+    directory += "/recordings";
+    mkdir(directory.c_str(), 0755);
+
+    char name[64];
+    const std::time_t now = std::time(nullptr);
+    std::tm local;
+    localtime_r(&now, &local);
+    std::strftime(name, sizeof(name), "/wakefield-%Y%m%d-%H%M%S.wav", &local);
+    return directory + name;
+}
+
+bool OutputRecorder::start(const Config& newConfig, std::string& error) {
+    std::string summary;
+    stop(summary);
+    config = newConfig;
+
+    if (!writeBuffer && posix_memalign(reinterpret_cast<void**>(&writeBuffer), kAlignment,
+                                       kWriteFrames * kFrameBytes) != 0) {
+        writeBuffer = nullptr;
+        error = "Recorder: out of memory";
+        return false;
+    }
+    if (!headerPage && posix_memalign(reinterpret_cast<void**>(&headerPage), kAlignment, kHeaderBytes) != 0) {
+        headerPage = nullptr;
+        error = "Recorder: out of memory";
+        return false;
+    }
+
+    // The ring, rounded up to a power of two and touched now so the audio
+    // thread never takes a page fault on it
+    const double wanted = std::max(1.0, static_cast<double>(config.ringSeconds)) * config.sampleRate;
+    ringFrames = kWriteFrames;
+    while (ringFrames < wanted && ringFrames < (1u << 30)) {
+        ringFrames <<= 1;
+    }
+    ringMask = ringFrames - 1;
+
+    const int count = 1 + std::max(config.stems, 0);
+    streams.clear();
+    streams.resize(count);
+    for (int i = 0; i < count; ++i) {
+        Stream& stream = streams[i];
+        stream.path = i == 0 ? config.path : stemPath(config.path, i - 1);
+        stream.left.assign(ringFrames, 0.0f);
+        stream.right.assign(ringFrames, 0.0f);
+
+        const int flags = O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC;
+        stream.fd = -1;
+        if (config.direct) {
+            stream.fd = ::open(stream.path.c_str(), flags | O_DIRECT, 0644);
+            stream.direct = stream.fd >= 0;
+        }
+        if (stream.fd < 0) {
+            // No O_DIRECT on this filesystem (tmpfs, some FUSE mounts)
+            stream.fd = ::open(stream.path.c_str(), flags, 0644);
+        }
+        if (stream.fd < 0 || !writeHeader(stream)) {
+            error = "Recorder: cannot write " + stream.path + ": " + std::strerror(errno);
+            closeFiles();
+            streams.clear();
+            return false;
+        }
+    }
+
+    head.store(0);
+    tail.store(0);
+    highWater.store(0);
+    dropped.store(0);
+    bytesWritten.store(0);
+    blockDropped = false;
+    stopping.store(false);
+    writer = std::thread(&OutputRecorder::run, this);
+    accepting.store(true);
+    return true;
+}
+
+void OutputRecorder::stop(std::string& summary) {
+    if (!writer.joinable()) {
+        return;
+    }
+    accepting.store(false);
+    while (inBlock.load()) {
+        std::this_thread::yield();
+    }
+    stopping.store(true);
+    writer.join();
+
+    const Stats stats = getStats();
+    char text[512];
+    std::snprintf(text, sizeof(text),
+                  "Recorded %.1f s to %s (ring high-water %.1f of %.1f s, %llu frames dropped)",
+                  stats.seconds, config.path.c_str(), stats.highWaterFrames / double(config.sampleRate),
+                  stats.ringFrames / double(config.sampleRate),
+                  static_cast<unsigned long long>(stats.droppedFrames));
+    summary = text;
+    if (streams.size() > 1) {
+        summary += ", " + std::to_string(streams.size() - 1) + " stems";
+    }
+    closeFiles();
+    streams.clear();
+}
+
+OutputRecorder::Stats OutputRecorder::getStats() const {
+    Stats stats;
+    stats.recording = accepting.load();
+    stats.seconds = config.sampleRate > 0 ? tail.load() / double(config.sampleRate) : 0.0;
+    stats.bytesWritten = bytesWritten.load();
+    stats.ringFrames = ringFrames;
+    stats.highWaterFrames = highWater.load();
+    stats.droppedFrames = dropped.load();
+    return stats;
+}
+
+bool OutputRecorder::pollMessage(std::string& message) {
+    std::lock_guard<std::mutex> lock(messageMutex);
+    if (messages.empty()) {
+        return false;
+    }
+    message = std::move(messages.front());
+    messages.pop_front();
+    return true;
+}
+
+void OutputRecorder::postMessage(const std::string& message) {
+    std::lock_guard<std::mutex> lock(messageMutex);
+    messages.push_back(message);
+}
+
+bool OutputRecorder::reserve(uint64_t at, uint32_t frames) {
+    const uint64_t used = at - head.load(std::memory_order_acquire);
+    return used + frames <= ringFrames;
+}
+
+void OutputRecorder::writeStem(void* context, int loop, const float* left, const float* right,
+                               uint32_t frames) {
+    OutputRecorder* self = static_cast<OutputRecorder*>(context);
+    self->inBlock.store(true);
+    if (!self->accepting.load() || loop + 1 >= static_cast<int>(self->streams.size())) {
+        self->inBlock.store(false);
+        return;
+    }
+    Stream& stream = self->streams[loop + 1];
+    const uint64_t at = self->tail.load(std::memory_order_relaxed) + stream.staged;
+    if (self->blockDropped || !self->reserve(at, frames)) {
+        self->blockDropped = true;
+        self->inBlock.store(false);
+        return;
+    }
+    for (uint32_t i = 0; i < frames; ++i) {
+        const uint32_t slot = static_cast<uint32_t>(at + i) & self->ringMask;
+        stream.left[slot] = left[i];
+        stream.right[slot] = right[i];
+    }
+    stream.staged += frames;
+    self->inBlock.store(false);
+}
+
+void OutputRecorder::writeBlock(const float* left, const float* right, uint32_t frames) {
+    inBlock.store(true);
+    if (!accepting.load()) {
+        inBlock.store(false);
+        return;
+    }
+    const uint64_t at = tail.load(std::memory_order_relaxed);
+    if (!blockDropped && reserve(at, frames)) {
+        Stream& master = streams[0];
+        for (uint32_t i = 0; i < frames; ++i) {
+            const uint32_t slot = static_cast<uint32_t>(at + i) & ringMask;
+            master.left[slot] = left[i];
+            master.right[slot] = right[i];
+        }
+    }
+    commit(at, frames);
+    inBlock.store(false);
+}
+
+void OutputRecorder::writeInterleaved(const float* samples, uint32_t frames) {
+    inBlock.store(true);
+    if (!accepting.load()) {
+        inBlock.store(false);
+        return;
+    }
+    const uint64_t at = tail.load(std::memory_order_relaxed);
+    if (!blockDropped && reserve(at, frames)) {
+        Stream& master = streams[0];
+        for (uint32_t i = 0; i < frames; ++i) {
+            const uint32_t slot = static_cast<uint32_t>(at + i) & ringMask;
+            master.left[slot] = samples[i * 2];
+            master.right[slot] = samples[i * 2 + 1];
+        }
+    }
+    commit(at, frames);
+    inBlock.store(false);
+}
+
+void OutputRecorder::commit(uint64_t at, uint32_t frames) {
+    if (blockDropped || !reserve(at, frames)) {
+        dropped.fetch_add(frames, std::memory_order_relaxed);
+    } else {
+        // A stem the loops did not cover this block (none running) is silent
+        for (size_t s = 1; s < streams.size(); ++s) {
+            Stream& stream = streams[s];
+            for (uint32_t i = std::min(stream.staged, frames); i < frames; ++i) {
+                const uint32_t slot = static_cast<uint32_t>(at + i) & ringMask;
+                stream.left[slot] = 0.0f;
+                stream.right[slot] = 0.0f;
+            }
+        }
+        tail.store(at + frames, std::memory_order_release);
+        const uint32_t used = static_cast<uint32_t>(at + frames - head.load(std::memory_order_acquire));
+        if (used > highWater.load(std::memory_order_relaxed)) {
+            highWater.store(used, std::memory_order_relaxed);
+        }
+    }
+    for (size_t s = 1; s < streams.size(); ++s) {
+        streams[s].staged = 0;
+    }
+    blockDropped = false;
+}
+
+void OutputRecorder::run() {
+    using Clock = std::chrono::steady_clock;
+    Clock::time_point nextHeader = Clock::now() + kHeaderInterval;
+    bool failed = false;
+    while (true) {
+        const bool last = stopping.load();
+        const uint64_t from = head.load(std::memory_order_relaxed);
+        const uint64_t available = tail.load(std::memory_order_acquire) - from;
+        if (available >= kWriteFrames || (last && available > 0)) {
+            const uint32_t frames = static_cast<uint32_t>(std::min<uint64_t>(available, kWriteFrames));
+            // After a failure the ring is still drained, so the audio
+            // thread is not left dropping blocks against a full ring
+            if (!failed && !writeFrames(from, frames)) {
+                failed = true;
+                postMessage("Recorder: write failed, the rest of the take is lost: " +
+                            std::string(std::strerror(errno)));
+            }
+            head.store(from + frames, std::memory_order_release);
+            continue;
+        }
+        if (last) {
+            break;
+        }
+        if (!failed && Clock::now() >= nextHeader) {
+            for (Stream& stream : streams) {
+                writeHeader(stream);
+            }
+            nextHeader = Clock::now() + kHeaderInterval;
+        }
+        std::this_thread::sleep_for(kWriterPoll);
+    }
+    for (Stream& stream : streams) {
+        if (!failed) {
+            writeHeader(stream);
+        }
+        fsync(stream.fd);
+    }
+}
+
+bool OutputRecorder::writeFrames(uint64_t from, uint32_t frames) {
+    const size_t bytes = frames * kFrameBytes;
+    for (Stream& stream : streams) {
+        for (uint32_t i = 0; i < frames; ++i) {
+            const uint32_t slot = static_cast<uint32_t>(from + i) & ringMask;
+            writeBuffer[i * 2] = stream.left[slot];
+            writeBuffer[i * 2 + 1] = stream.right[slot];
+        }
+        if (stream.direct && bytes % kAlignment != 0) {
+            // The last, partial piece: O_DIRECT takes whole blocks only
+            fcntl(stream.fd, F_SETFL, fcntl(stream.fd, F_GETFL) & ~O_DIRECT);
+            stream.direct = false;
+        }
+        if (!writeAll(stream.fd, writeBuffer, bytes, kHeaderBytes + stream.dataBytes)) {
+            return false;
+        }
+        stream.dataBytes += bytes;
+        bytesWritten.fetch_add(bytes, std::memory_order_relaxed);
+    }
+    return true;
+}
+
+bool OutputRecorder::writeHeader(Stream& stream) {
+    buildHeader(headerPage, config.sampleRate, stream.dataBytes);
+    return writeAll(stream.fd, headerPage, kHeaderBytes, 0);
+}
+
+void OutputRecorder::closeFiles() {
+    for (Stream& stream : streams) {
+        if (stream.fd >= 0) {
+            ::close(stream.fd);
+            stream.fd = -1;
+        }
+    }
+}
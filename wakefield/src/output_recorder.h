@@ -0,0 +1,136 @@
+#ifndef OUTPUT_RECORDER_H
+#define OUTPUT_RECORDER_H
+
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "loop_manager.h"
+
+// Records the master output, and optionally each loop as a stem, to 32-bit
+// float stereo WAV files while the synth plays.
+//
+// The audio thread copies each block into a preallocated ring (a pair of
+// planes per file, all sharing one write position) and never blocks or
+// allocates: a block that finds the ring full is dropped and counted. A
+// writer thread streams the ring to disk in kWriteFrames pieces from a
+// 4 KiB-aligned buffer, with O_DIRECT where the filesystem allows it, so a
+// slow SD card stalls the writer, which the ring (20 s by default) absorbs,
+// rather than a page cache writeback burst. The header is rewritten every
+// few seconds, so a crash leaves a playable file; a file that outgrows
+// 4 GiB becomes RF64 (the header keeps room for the ds64 chunk as JUNK).
+// The ring's high-water mark shows how close the disk came to losing audio.
+class OutputRecorder {
+public:
+    static constexpr float kDefaultRingSeconds = 20.0f;
+    static constexpr uint32_t kWriteFrames = 8192;      // 64 KiB per file and write
+
+    struct Config {
+        std::string path;               // Master file; stems go next to it as <base>.loopN.wav
+        unsigned int sampleRate = 48000;
+        int stems = 0;                  // Loop stems through getStemTap() as well, one per loop
+        float ringSeconds = kDefaultRingSeconds;
+        bool direct = true;             // O_DIRECT where the filesystem supports it
+    };
+
+    struct Stats {
+        bool recording = false;
+        double seconds = 0.0;           // Audio taken from the audio thread
+        uint64_t bytesWritten = 0;      // Sample data on disk, every file
+        uint32_t ringFrames = 0;
+        uint32_t highWaterFrames = 0;   // Most the ring held since start
+        uint64_t droppedFrames = 0;     // Found the ring full
+    };
+
+    OutputRecorder() = default;
+    ~OutputRecorder();
+
+    // ~/.config/wakefield/recordings/wakefield-<date>-<time>.wav (creates
+    // the directory)
+    static std::string getDefaultPath();
+
+    // Open the files, allocate and touch the ring, start the writer. Not
+    // on the audio thread
+    bool start(const Config& config, std::string& error);
+
+    // Stop taking blocks, write what the ring holds and finish the headers.
+    // summary reports the length and the ring's high-water mark. Not on the
+    // audio thread
+    void stop(std::string& summary);
+
+    bool isRecording() const { return accepting.load(); }
+    Stats getStats() const;
+    const std::string& getPath() const { return config.path; }
+
+    // One console message per call (write errors); false if none
+    bool pollMessage(std::string& message);
+
+    // Audio thread, once per block, after the output is complete: planar or
+    // interleaved stereo. Stems handed over during the block go with it
+    void writeBlock(const float* left, const float* right, uint32_t frames);
+    void writeInterleaved(const float* frames, uint32_t count);
+
+    // For LoopManager::setStemTap while recording stems. The loops must run
+    // on the thread that calls writeBlock (not with --pipeline)
+    const LoopManager::StemTap* getStemTap() const { return &stemTap; }
+
+    OutputRecorder(const OutputRecorder&) = delete;
+    OutputRecorder& operator=(const OutputRecorder&) = delete;
+
+private:
+    struct Stream {
+        std::string path;
+        std::vector<float> left;        // Ring planes, ringFrames each
+        std::vector<float> right;
+        int fd = -1;
+        bool direct = false;
+        uint64_t dataBytes = 0;
+        uint32_t staged = 0;            // Audio thread: stem frames handed over this block
+    };
+
+    static void writeStem(void* context, int loop, const float* left, const float* right, uint32_t frames);
+
+    // Audio thread: room for frames more past the block staged so far
+    bool reserve(uint64_t tail, uint32_t frames);
+    void commit(uint64_t tail, uint32_t frames);
+
+    void run();
+    // Writer: frames from the ring at head into every file; false on error
+    bool writeFrames(uint64_t head, uint32_t frames);
+    bool writeHeader(Stream& stream);
+    void closeFiles();
+    void postMessage(const std::string& message);
+
+    Config config;
+    std::vector<Stream> streams;        // Master first, then the stems
+    uint32_t ringFrames = 0;            // Power of two
+    uint32_t ringMask = 0;
+
+    // Ring positions in frames since start: the audio thread publishes
+    // tail, the writer publishes head
+    alignas(64) std::atomic<uint64_t> head{0};
+    alignas(64) std::atomic<uint64_t> tail{0};
+    std::atomic<uint32_t> highWater{0};
+    std::atomic<uint64_t> dropped{0};
+    std::atomic<uint64_t> bytesWritten{0};
+    bool blockDropped = false;          // Audio thread: a stem found the ring full
+
+    // stop() clears accepting, then waits for a block in flight to leave
+    std::atomic<bool> accepting{false};
+    std::atomic<bool> inBlock{false};
+    std::atomic<bool> stopping{false};
+    std::thread writer;
+
+    float* writeBuffer = nullptr;       // kWriteFrames interleaved, 4 KiB aligned
+    uint8_t* headerPage = nullptr;      // The first 4 KiB of a file
+
+    LoopManager::StemTap stemTap{&OutputRecorder::writeStem, this};
+
+    std::mutex messageMutex;
+    std::deque<std::string> messages;
+};
+
+#endif // OUTPUT_RECORDER_H
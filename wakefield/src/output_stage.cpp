@@ -0,0 +1,177 @@
+#include "output_stage.h"
+
+#include <cstring>
+
+namespace {
+
+// Round to nearest, half away from zero, with a truncating conversion
+// (lrintf only vectorizes without errno)
+inline int32_t roundToInt(float v) {
+    return static_cast<int32_t>(v + std::copysign(0.5f, v));
+}
+
+// Limit, scale to full scale (2^(bits-1)), dither, clamp to what converts
+// in range and round. top is the largest value below full scale, as a float
+template <bool Dither>
+inline int32_t quantize(float x, float noise, float scale, float top) {
+    float v = x * scale;
+    if (Dither) {
+        v += noise;
+    }
+    return roundToInt(std::min(std::max(v, -scale), top));
+}
+
+// Stride is 1 for a plane, 2 interleaved: a constant, so the interleaved
+// stores vectorize as shuffles
+template <typename T, bool Dither, unsigned int Stride>
+void storeIntegers(float* plane, const float* noise, unsigned int frames, T* dest, float scale, float top) {
+    for (unsigned int i = 0; i < frames; ++i) {
+        const float x = OutputStage::softLimit(plane[i]);
+        plane[i] = x;
+        dest[i * Stride] = static_cast<T>(quantize<Dither>(x, noise[i], scale, top));
+    }
+}
+
+// Three bytes a sample: stored a byte at a time, so this one stays scalar
+template <bool Dither, unsigned int Stride>
+void storePacked24(float* plane, const float* noise, unsigned int frames, uint8_t* dest) {
+    for (unsigned int i = 0; i < frames; ++i) {
+        const float x = OutputStage::softLimit(plane[i]);
+        plane[i] = x;
+        const int32_t s = quantize<Dither>(x, noise[i], 8388608.0f, 8388607.0f);
+        uint8_t* out = dest + i * Stride * 3;
+        out[0] = static_cast<uint8_t>(s);
+        out[1] = static_cast<uint8_t>(s >> 8);
+        out[2] = static_cast<uint8_t>(s >> 16);
+    }
+}
+
+template <bool Dither, unsigned int Stride>
+void storeChannel(SampleFormat format, float* plane, const float* noise, unsigned int frames, char* dest) {
+    switch (format) {
+        case SampleFormat::SINT32:
+            storeIntegers<int32_t, Dither, Stride>(plane, noise, frames, reinterpret_cast<int32_t*>(dest),
+                                                   2147483648.0f, 2147483520.0f);
+            break;
+        case SampleFormat::SINT24:
+            storePacked24<Dither, Stride>(plane, noise, frames, reinterpret_cast<uint8_t*>(dest));
+            break;
+        case SampleFormat::SINT16:
+            storeIntegers<int16_t, Dither, Stride>(plane, noise, frames, reinterpret_cast<int16_t*>(dest),
+                                                   32768.0f, 32767.0f);
+            break;
+        case SampleFormat::FLOAT32: {
+            float* out = reinterpret_cast<float*>(dest);
+            for (unsigned int i = 0; i < frames; ++i) {
+                const float x = OutputStage::softLimit(plane[i]);
+                plane[i] = x;
+                out[i * Stride] = x;
+            }
+            break;
+        }
+    }
+}
+
+template <unsigned int Stride>
+void storeChannel(SampleFormat format, bool dither, float* plane, const float* noise, unsigned int frames,
+                  char* dest) {
+    if (dither) {
+        storeChannel<true, Stride>(format, plane, noise, frames, dest);
+    } else {
+        storeChannel<false, Stride>(format, plane, noise, frames, dest);
+    }
+}
+
+} // namespace
+
+const char* sampleFormatName(SampleFormat format) {
+    switch (format) {
+        case SampleFormat::SINT32: return "S32";
+        case SampleFormat::SINT24: return "S24";
+        case SampleFormat::SINT16: return "S16";
+        case SampleFormat::FLOAT32: break;
+    }
+    return "float";
+}
+
+unsigned int sampleFormatBytes(SampleFormat format) {
+    switch (format) {
+        case SampleFormat::SINT24: return 3;
+        case SampleFormat::SINT16: return 2;
+        case SampleFormat::SINT32:
+        case SampleFormat::FLOAT32: break;
+    }
+    return 4;
+}
+
+bool parseSampleFormat(const char* text, SampleFormat& format) {
+    const struct {
+        const char* name;
+        SampleFormat format;
+    } names[] = {
+        {"float", SampleFormat::FLOAT32},
+        {"s32", SampleFormat::SINT32},
+        {"s24", SampleFormat::SINT24},
+        {"s16", SampleFormat::SINT16},
+    };
+    for (const auto& entry : names) {
+        if (std::strcmp(text, entry.name) == 0) {
+            format = entry.format;
+            return true;
+        }
+    }
+    return false;
+}
+
+OutputStage::OutputStage()
+    : ditherNoise(2 * kDitherFrames)
+    , ditherStream(0x6f75747075747374ull) {
+    // Triangular: the difference of two uniforms, -1 .. 1 LSB
+    for (unsigned int i = 0; i < kDitherFrames; ++i) {
+        ditherNoise[i] = ditherStream.uniform() - ditherStream.uniform();
+    }
+    std::copy(ditherNoise.begin(), ditherNoise.begin() + kDitherFrames, ditherNoise.begin() + kDitherFrames);
+}
+
+void OutputStage::setFormat(SampleFormat newFormat, bool newInterleaved) {
+    format = newFormat;
+    interleaved = newInterleaved;
+}
+
+void OutputStage::process(float* left, float* right, unsigned int frames, void* device,
+                          unsigned int bufferFrames) {
+    if (!device) {
+        for (unsigned int i = 0; i < frames; ++i) {
+            left[i] = softLimit(left[i]);
+        }
+        for (unsigned int i = 0; i < frames; ++i) {
+            right[i] = softLimit(right[i]);
+        }
+        return;
+    }
+    const unsigned int bytes = sampleFormatBytes(format);
+    char* base = static_cast<char*>(device);
+    if (interleaved) {
+        processChannel(left, frames, base, 2);
+        processChannel(right, frames, base + bytes, 2);
+    } else {
+        processChannel(left, frames, base, 1);
+        processChannel(right, frames, base + static_cast<size_t>(bufferFrames) * bytes, 1);
+    }
+}
+
+void OutputStage::processChannel(float* plane, unsigned int frames, char* dest, unsigned int stride) {
+    const unsigned int bytes = sampleFormatBytes(format);
+    for (unsigned int done = 0; done < frames;) {
+        const unsigned int run = std::min(frames - done, kDitherFrames);
+        char* out = dest + static_cast<size_t>(done) * stride * bytes;
+        const bool dithered = isDithered();
+        const float* noise = ditherNoise.data() + (dithered ? ditherStream.below(kDitherFrames) : 0);
+        if (stride == 2) {
+            storeChannel<2>(format, dithered, plane + done, noise, run, out);
+        } else {
+            storeChannel<1>(format, dithered, plane + done, noise, run, out);
+        }
+        done += run;
+    }
+}
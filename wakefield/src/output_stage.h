@@ -0,0 +1,79 @@
+#ifndef OUTPUT_STAGE_H
+#define OUTPUT_STAGE_H
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+#include "rng.h"
+
+// Sample formats a device stream can be opened in
+enum class SampleFormat : uint8_t {
+    FLOAT32,
+    SINT32,
+    SINT24,     // Packed, three bytes a sample (RtAudio's SINT24)
+    SINT16,
+};
+
+const char* sampleFormatName(SampleFormat format);
+unsigned int sampleFormatBytes(SampleFormat format);
+// "float", "s32", "s24" or "s16"; false for anything else
+bool parseSampleFormat(const char* text, SampleFormat& format);
+
+// The last pass over each buffer on its way to the device: the soft
+// limiter over the finished mix and, unless the device takes planar float
+// and the mix was rendered into it, TPDF dither and conversion to the
+// device's format, planar or interleaved, in the same loop. Each channel
+// is one branch-free loop per format, so it vectorizes.
+//
+// The float planes are limited in place, so what reads them afterwards
+// (the output recorder) has what the device plays, less the dither.
+class OutputStage {
+public:
+    OutputStage();
+
+    // Not while a buffer is being processed
+    void setFormat(SampleFormat format, bool interleaved);
+    // Triangular dither of one LSB ahead of rounding to an integer format
+    void setDither(bool enabled) { dither = enabled; }
+
+    SampleFormat getFormat() const { return format; }
+    bool isInterleaved() const { return interleaved; }
+    // The mix can be rendered straight into the device buffer
+    bool isDirect() const { return format == SampleFormat::FLOAT32 && !interleaved; }
+    bool isDithered() const { return dither && format != SampleFormat::FLOAT32; }
+
+    // Audio thread: limit left and right in place, then, when device is
+    // set, write them as frames 0 .. frames - 1 of that buffer, whose
+    // planes (if planar) are bufferFrames apart
+    void process(float* left, float* right, unsigned int frames, void* device, unsigned int bufferFrames);
+
+    // Soft knee limiter: unity gain below 0.7, slope easing linearly to
+    // 0.2 across the knee, 0.2 above 0.9 (the asymptote of the old hard
+    // knee at 0.8). Branch-free, so the loop over a block vectorizes
+    static inline float softLimit(float x) {
+        constexpr float kKneeStart = 0.7f;
+        constexpr float kKneeWidth = 0.2f;
+        constexpr float kGainDrop = 0.8f;   // 1 - slope above the knee
+        const float a = std::fabs(x);
+        const float over = std::max(a - kKneeStart, 0.0f);
+        const float inKnee = std::min(over, kKneeWidth);
+        const float reduction = kGainDrop * (inKnee * inKnee * (0.5f / kKneeWidth) + (over - inKnee));
+        return std::copysign(a - reduction, x);
+    }
+
+private:
+    // Noise read a run at a time from a random start, so it does not
+    // repeat with the table; stored twice over so a run never wraps
+    static constexpr unsigned int kDitherFrames = 4096;
+
+    void processChannel(float* plane, unsigned int frames, char* dest, unsigned int stride);
+
+    SampleFormat format = SampleFormat::FLOAT32;
+    bool interleaved = false;
+    bool dither = true;
+    std::vector<float> ditherNoise;     // 2 * kDitherFrames, in LSBs
+    rng::Stream ditherStream;           // Audio thread: run starts
+};
+
+#endif // OUTPUT_STAGE_H
@@ -0,0 +1,228 @@
+#include "oversampler.h"
+#include <cmath>
+
+namespace {
+
+// Coefficient count and transition band (fraction of the 2x rate) per
+// stage. The 2x <-> 4x stage only has to keep images off the audio band,
+// so its transition is wide and a few sections reach the same stopband
+struct HalfbandSpec {
+    int coefficients;
+    double transition;
+};
+
+constexpr HalfbandSpec kSpecs[3][2] = {
+    {{4, 0.10}, {2, 0.30}},   // Draft:  ~70 dB, passband to 19.2 kHz
+    {{6, 0.06}, {4, 0.30}},   // Normal: ~85 dB, passband to 21.1 kHz
+    {{8, 0.04}, {4, 0.30}},   // High:   ~100 dB, passband to 22.1 kHz
+};
+
+double integerPower(double x, int n) {
+    double r = 1.0;
+    while (n-- > 0) r *= x;
+    return r;
+}
+
+// Allpass coefficients of an elliptic half-band filter with the given
+// number of coefficients and transition band (Valenzuela & Constantinides,
+// as in de Soras' HIIR). Even coefficients form path 0, odd ones path 1
+void designHalfband(int count, double transition, double* coeffs) {
+    double k = std::tan((1.0 - transition * 2.0) * M_PI / 4.0);
+    k *= k;
+    const double kk = std::pow(1.0 - k * k, 0.25);
+    const double e = 0.5 * (1.0 - kk) / (1.0 + kk);
+    const double e4 = e * e * e * e;
+    const double q = e * (1.0 + e4 * (2.0 + e4 * (15.0 + 150.0 * e4)));
+    const int order = count * 2 + 1;
+
+    for (int index = 0; index < count; ++index) {
+        const int c = index + 1;
+        double num = 0.0;
+        double term;
+        int i = 0;
+        double sign = 1.0;
+        do {
+            term = integerPower(q, i * (i + 1)) * std::sin((i * 2 + 1) * c * M_PI / order) * sign;
+            num += term;
+            sign = -sign;
+            ++i;
+        } while (std::fabs(term) > 1e-100);
+        num *= std::pow(q, 0.25);
+
+        double den = 0.5;
+        i = 1;
+        sign = -1.0;
+        do {
+            term = integerPower(q, i * i) * std::cos(i * 2 * c * M_PI / order) * sign;
+            den += term;
+            sign = -sign;
+            ++i;
+        } while (std::fabs(term) > 1e-100);
+
+        const double ww = num / den;
+        const double ww2 = ww * ww;
+        const double x = std::sqrt((1.0 - ww2 * k) * (1.0 - ww2 / k)) / (1.0 + ww2);
+        coeffs[index] = (1.0 - x) / (1.0 + x);
+    }
+}
+
+// Designed once at startup, so configure() only copies
+struct HalfbandTable {
+    float coeffs[3][2][2 * HalfbandIIR::kMaxSections] = {};
+
+    HalfbandTable() {
+        for (int quality = 0; quality < 3; ++quality) {
+            for (int stage = 0; stage < 2; ++stage) {
+                double designed[2 * HalfbandIIR::kMaxSections];
+                designHalfband(kSpecs[quality][stage].coefficients,
+                               kSpecs[quality][stage].transition, designed);
+                for (int i = 0; i < kSpecs[quality][stage].coefficients; ++i) {
+                    coeffs[quality][stage][i] = static_cast<float>(designed[i]);
+                }
+            }
+        }
+    }
+};
+
+const HalfbandTable kHalfbandTable;
+
+}
+
+void HalfbandIIR::configure(OversampleQuality quality, int stage) {
+    const int q = static_cast<int>(quality);
+    const float* c = kHalfbandTable.coeffs[q][stage];
+    sections = kSpecs[q][stage].coefficients / 2;
+    for (int s = 0; s < kMaxSections; ++s) {
+        coeffs[s] = s < sections ? Lanes{c[2 * s], c[2 * s + 1], c[2 * s], c[2 * s + 1]} : Lanes{};
+    }
+    reset();
+}
+
+void HalfbandIIR::reset() {
+    for (int s = 0; s < kMaxSections; ++s) {
+        xState[s] = Lanes{};
+        yState[s] = Lanes{};
+    }
+}
+
+void HalfbandIIR::upsample(const float* inL, const float* inR, float* outL, float* outR, int n) {
+    for (int i = 0; i < n; ++i) {
+        const Lanes y = allpasses(Lanes{inL[i], inL[i], inR[i], inR[i]});
+        outL[2 * i] = y[0];
+        outL[2 * i + 1] = y[1];
+        outR[2 * i] = y[2];
+        outR[2 * i + 1] = y[3];
+    }
+}
+
+void HalfbandIIR::downsample(const float* inL, const float* inR, float* outL, float* outR, int n) {
+    for (int i = 0; i < n; ++i) {
+        const Lanes y = allpasses(Lanes{inL[2 * i + 1], inL[2 * i], inR[2 * i + 1], inR[2 * i]});
+        outL[i] = 0.5f * (y[0] + y[1]);
+        outR[i] = 0.5f * (y[2] + y[3]);
+    }
+}
+
+void HalfbandIIR::downsample(const float* in, float* out, int n) {
+    for (int i = 0; i < n; ++i) {
+        const Lanes y = allpasses(Lanes{in[2 * i + 1], in[2 * i], 0.0f, 0.0f});
+        out[i] = 0.5f * (y[0] + y[1]);
+    }
+}
+
+void Oversampler::configure(int factor, OversampleQuality quality) {
+    factor = factor >= 4 ? 4 : (factor >= 2 ? 2 : 1);
+    if (factor == factor_ && quality == quality_) {
+        return;
+    }
+    factor_ = factor;
+    quality_ = quality;
+    for (int stage = 0; stage < 2; ++stage) {
+        up[stage].configure(quality, stage);
+        down[stage].configure(quality, stage);
+    }
+}
+
+void Oversampler::reset() {
+    for (int stage = 0; stage < 2; ++stage) {
+        up[stage].reset();
+        down[stage].reset();
+    }
+}
+
+void Oversampler::upsample(const float* left, const float* right, int n) {
+    if (factor_ == 2) {
+        up[0].upsample(left, right, wideL, wideR, n);
+        return;
+    }
+    up[0].upsample(left, right, midL, midR, n);
+    up[1].upsample(midL, midR, wideL, wideR, 2 * n);
+}
+
+void Oversampler::downsample(float* left, float* right, int n) {
+    if (factor_ == 2) {
+        down[0].downsample(wideL, wideR, left, right, n);
+        return;
+    }
+    down[1].downsample(wideL, wideR, midL, midR, 2 * n);
+    down[0].downsample(midL, midR, left, right, n);
+}
+
+void Decimator::configure(int factor, OversampleQuality quality) {
+    factor = factor >= 4 ? 4 : (factor >= 2 ? 2 : 1);
+    if (factor == factor_ && quality == quality_) {
+        return;
+    }
+    factor_ = factor;
+    quality_ = quality;
+    stages[0].configure(quality, 0);
+    stages[1].configure(quality, 1);
+}
+
+void Decimator::reset() {
+    stages[0].reset();
+    stages[1].reset();
+}
+
+void Decimator::process(const float* in, float* out, int n) {
+    if (factor_ == 1) {
+        std::copy(in, in + n, out);
+        return;
+    }
+    if (factor_ == 2) {
+        stages[0].downsample(in, out, n);
+        return;
+    }
+    for (int offset = 0; offset < n; offset += kChunk) {
+        const int m = std::min(kChunk, n - offset);
+        stages[1].downsample(in + 4 * offset, mid, 2 * m);
+        stages[0].downsample(mid, out + offset, m);
+    }
+}
+
+Undersampler::Undersampler() {
+    down.configure(OversampleQuality::Draft, 0);
+    up.configure(OversampleQuality::Draft, 0);
+}
+
+void Undersampler::reset() {
+    down.reset();
+    up.reset();
+    pendingL = pendingR = 0.0f;
+    hasPending = false;
+    carryL = carryR = 0.0f;
+    hasCarry = true;
+}
+
+void Undersampler::emit(float* wetL, float* wetR, int& written, int n, int frames) {
+    const int direct = std::min(frames, n - written);
+    std::copy(fullL, fullL + direct, wetL + written);
+    std::copy(fullR, fullR + direct, wetR + written);
+    written += direct;
+    if (direct < frames) {
+        // Only the last pass of a block can overrun, by one frame
+        carryL = fullL[direct];
+        carryR = fullR[direct];
+        hasCarry = true;
+    }
+}
@@ -0,0 +1,208 @@
+#ifndef OVERSAMPLER_H
+#define OVERSAMPLER_H
+
+#include <algorithm>
+
+// Stopband of each 2x stage: Draft ~70 dB, Normal ~85 dB, High ~100 dB,
+// with the passband flat to 19-22 kHz at 48 kHz
+enum class OversampleQuality {
+    Draft = 0,
+    Normal = 1,
+    High = 2
+};
+
+// One 2x polyphase IIR half-band filter: two chains of first-order allpasses
+// in z^2 whose average is an elliptic lowpass at fs/4, run at the low rate.
+// The lanes of one 16-byte vector hold {left path 0, left path 1, right path
+// 0, right path 1}, so a stereo sample costs one vector op per allpass
+// section; mono uses lanes 0 and 1.
+class HalfbandIIR {
+public:
+    static constexpr int kMaxSections = 4;   // Allpasses per path
+    typedef float Lanes __attribute__((vector_size(4 * sizeof(float))));
+
+    // Stage 0 is the base <-> 2x filter; stage 1 the wider 2x <-> 4x one
+    void configure(OversampleQuality quality, int stage);
+    void reset();
+
+    // n input frames -> 2n output frames
+    void upsample(const float* inL, const float* inR, float* outL, float* outR, int n);
+
+    // 2n input frames -> n output frames
+    void downsample(const float* inL, const float* inR, float* outL, float* outR, int n);
+    void downsample(const float* in, float* out, int n);
+
+private:
+    int sections = 0;
+    Lanes coeffs[kMaxSections] = {};
+    Lanes xState[kMaxSections] = {};
+    Lanes yState[kMaxSections] = {};
+
+    // y = c * (x - y[n-1]) + x[n-1] for every section in turn
+    inline Lanes allpasses(Lanes x) {
+        for (int s = 0; s < sections; ++s) {
+            const Lanes y = (x - yState[s]) * coeffs[s] + xState[s];
+            xState[s] = x;
+            yState[s] = y;
+            x = y;
+        }
+        return x;
+    }
+};
+
+// Runs a stereo block processor at 2x or 4x the engine rate: the block is
+// upsampled a chunk at a time into internal buffers, handed to the
+// processor, and decimated back in place. Factor 1 calls the processor on
+// the block directly. The processor must be set up for rate * factor().
+class Oversampler {
+public:
+    static constexpr int kMaxFactor = 4;
+    static constexpr int kChunk = 64;   // Engine-rate frames per pass
+
+    // Factor 1, 2 or 4. Resets the filters when anything changes
+    void configure(int factor, OversampleQuality quality);
+    int factor() const { return factor_; }
+    OversampleQuality quality() const { return quality_; }
+    void reset();
+
+    // process(float* left, float* right, int frames) at the oversampled rate
+    template <typename Process>
+    void processStereo(float* left, float* right, int n, Process&& process) {
+        if (factor_ == 1) {
+            process(left, right, n);
+            return;
+        }
+        for (int offset = 0; offset < n; offset += kChunk) {
+            const int m = std::min(kChunk, n - offset);
+            upsample(left + offset, right + offset, m);
+            process(wideL, wideR, m * factor_);
+            downsample(left + offset, right + offset, m);
+        }
+    }
+
+private:
+    int factor_ = 1;
+    OversampleQuality quality_ = OversampleQuality::Normal;
+    HalfbandIIR up[2];
+    HalfbandIIR down[2];
+    alignas(16) float wideL[kChunk * kMaxFactor];
+    alignas(16) float wideR[kChunk * kMaxFactor];
+    alignas(16) float midL[kChunk * 2];
+    alignas(16) float midR[kChunk * 2];
+
+    void upsample(const float* left, const float* right, int n);
+    void downsample(float* left, float* right, int n);
+};
+
+// Decimation half of Oversampler for a mono source rendered at
+// rate * factor() (the voice FM path): n * factor() in, n out
+class Decimator {
+public:
+    static constexpr int kMaxFactor = Oversampler::kMaxFactor;
+
+    void configure(int factor, OversampleQuality quality);
+    int factor() const { return factor_; }
+    OversampleQuality quality() const { return quality_; }
+    void reset();
+
+    void process(const float* in, float* out, int n);
+
+private:
+    static constexpr int kChunk = Oversampler::kChunk;
+    int factor_ = 1;
+    OversampleQuality quality_ = OversampleQuality::Normal;
+    HalfbandIIR stages[2];
+    alignas(16) float mid[kChunk * 2];
+};
+
+// The inverse of Oversampler for a wet-only processor (the reverbs): the
+// dry block is decimated to half the engine rate, processed there, and the
+// result interpolated back into a separate wet block. Pairs of input frames
+// map to one processor frame, so an odd frame left over waits for the next
+// block; one frame of fixed latency keeps every call able to fill n wet
+// frames. Stage 0 Draft filters: the wet signal is flat to ~9.6 kHz at
+// 48 kHz and the filters cost a few ns per frame. The processor must be
+// set up for rate / 2.
+class Undersampler {
+public:
+    static constexpr int kChunk = 64;   // Half-rate frames per pass
+
+    Undersampler();
+    void reset();
+
+    // process(float* inL, float* inR, float* outL, float* outR, int frames)
+    // at half the rate, at most kChunk frames per call
+    template <typename Process>
+    void processWet(const float* left, const float* right, float* wetL, float* wetR, int n,
+                    Process&& process) {
+        if (n <= 0) {
+            return;
+        }
+        int written = 0;
+        if (hasCarry) {
+            wetL[written] = carryL;
+            wetR[written] = carryR;
+            ++written;
+            hasCarry = false;
+        }
+        int consumed = 0;
+        while (consumed < n) {
+            int fill = 0;
+            if (hasPending) {
+                fullL[0] = pendingL;
+                fullR[0] = pendingR;
+                fill = 1;
+                hasPending = false;
+            }
+            const int take = std::min(2 * kChunk - fill, n - consumed);
+            for (int i = 0; i < take; ++i) {
+                fullL[fill + i] = left[consumed + i] + kDenormalOffset;
+                fullR[fill + i] = right[consumed + i] + kDenormalOffset;
+            }
+            fill += take;
+            consumed += take;
+            if (fill & 1) {
+                pendingL = fullL[fill - 1];
+                pendingR = fullR[fill - 1];
+                hasPending = true;
+            }
+            const int pairs = fill / 2;
+            if (pairs == 0) {
+                break;
+            }
+            down.downsample(fullL, fullR, halfL, halfR, pairs);
+            process(halfL, halfR, halfWetL, halfWetR, pairs);
+            up.upsample(halfWetL, halfWetR, fullL, fullR, pairs);
+            emit(wetL, wetR, written, n, 2 * pairs);
+        }
+    }
+
+private:
+    // Added to the input so the decimator's allpass states cannot decay
+    // into subnormals on silence when FTZ is off (the benches); far below
+    // the reverbs' -120 dBFS gate threshold
+    static constexpr float kDenormalOffset = 1e-20f;
+
+    HalfbandIIR down;
+    HalfbandIIR up;
+    alignas(16) float fullL[kChunk * 2];
+    alignas(16) float fullR[kChunk * 2];
+    alignas(16) float halfL[kChunk];
+    alignas(16) float halfR[kChunk];
+    alignas(16) float halfWetL[kChunk];
+    alignas(16) float halfWetR[kChunk];
+
+    // Input frame waiting for its partner, and the wet frame produced
+    // beyond the end of the last block. hasCarry == !hasPending between
+    // calls, so the output never runs short
+    float pendingL = 0.0f;
+    float pendingR = 0.0f;
+    bool hasPending = false;
+    float carryL = 0.0f;
+    float carryR = 0.0f;
+    bool hasCarry = true;
+
+    void emit(float* wetL, float* wetR, int& written, int n, int frames);
+};
+
+#endif // OVERSAMPLER_H
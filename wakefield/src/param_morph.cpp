@@ -0,0 +1,85 @@
+#include "param_morph.h"
+#include <algorithm>
+#include <cstring>
+#include <type_traits>
+
+bool ParamMorph::prepare(const SynthParamBlock& a, const SynthParamBlock& b) {
+    clear();
+    std::memset(from, 0, sizeof(from));
+    std::memset(delta, 0, sizeof(delta));
+
+    // Walk a; the same offset in b is the matching field
+    const char* base = reinterpret_cast<const char*>(&a);
+    const char* other = reinterpret_cast<const char*>(&b);
+    bool fits = true;
+    forEachParam(a, [&](const auto& field) {
+        using Field = std::decay_t<decltype(field)>;
+        const size_t offset = reinterpret_cast<const char*>(&field) - base;
+        Field target;
+        std::memcpy(&target, other + offset, sizeof(Field));
+        if (target == field) {
+            return;
+        }
+        if constexpr (std::is_same_v<Field, float>) {
+            if (floatCount == kMaxFloats) {
+                fits = false;
+                return;
+            }
+            from[floatCount / kLanes][floatCount % kLanes] = field;
+            delta[floatCount / kLanes][floatCount % kLanes] = target - field;
+            floatOffsets[floatCount++] = static_cast<uint16_t>(offset);
+        } else {
+            if (discreteCount == kMaxDiscrete) {
+                fits = false;
+                return;
+            }
+            Discrete& d = discrete[discreteCount++];
+            d.offset = static_cast<uint16_t>(offset);
+            d.size = sizeof(Field);
+            d.value[0] = 0;
+            d.value[1] = 0;
+            std::memcpy(&d.value[0], &field, sizeof(Field));
+            std::memcpy(&d.value[1], &target, sizeof(Field));
+        }
+    });
+    static_assert(sizeof(SynthParamBlock) <= 65535, "offsets are 16 bit");
+
+    if (!fits) {
+        clear();
+        return false;
+    }
+    active = true;
+    return true;
+}
+
+void ParamMorph::apply(float position, SynthParamBlock& block) const {
+    if (!active) {
+        return;
+    }
+    position = std::clamp(position, 0.0f, 1.0f);
+    char* base = reinterpret_cast<char*>(&block);
+
+    // Blend every differing float four at a time, then scatter to the block
+    // (counts are read once: the stores below may alias anything)
+    const int floats = floatCount;
+    const int discretes = discreteCount;
+    Lanes blended[kGroups];
+    const int groups = (floats + kLanes - 1) / kLanes;
+    for (int g = 0; g < groups; ++g) {
+        blended[g] = from[g] + delta[g] * position;
+    }
+    const float* values = reinterpret_cast<const float*>(blended);
+    for (int i = 0; i < floats; ++i) {
+        std::memcpy(base + floatOffsets[i], &values[i], sizeof(float));
+    }
+
+    const int side = position < 0.5f ? 0 : 1;
+    for (int i = 0; i < discretes; ++i) {
+        const Discrete& d = discrete[i];
+        if (d.size == sizeof(int)) {
+            std::memcpy(base + d.offset, &d.value[side], sizeof(int));
+        } else {
+            std::memcpy(base + d.offset, &d.value[side], sizeof(bool));
+        }
+    }
+}
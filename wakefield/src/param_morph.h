@@ -0,0 +1,52 @@
+#ifndef PARAM_MORPH_H
+#define PARAM_MORPH_H
+
+#include <cstdint>
+#include "param_snapshot.h"
+
+// Morph between two parameter blocks A and B at control rate. prepare()
+// runs once per pair on the UI thread and keeps only the fields that
+// differ: the float fields packed into from/delta lanes, the discrete ones
+// (modes, shapes, flags) as their two raw values. apply() then costs one
+// multiply-add per four differing floats plus a store per field, however
+// large the block is; discrete fields take A's value below the midpoint
+// and B's from it on. Fields equal in A and B are left as the block has them.
+class ParamMorph {
+public:
+    static constexpr int kMaxFloats = 192;
+    static constexpr int kMaxDiscrete = 96;
+
+    // Record the fields that differ between a and b. False (and inactive)
+    // if the block has outgrown the tables
+    bool prepare(const SynthParamBlock& a, const SynthParamBlock& b);
+
+    void clear() { floatCount = 0; discreteCount = 0; active = false; }
+    bool isActive() const { return active; }
+    int differingFloats() const { return floatCount; }
+    int differingDiscrete() const { return discreteCount; }
+
+    // Write the morph at position (0 = A, 1 = B, clamped) into block
+    void apply(float position, SynthParamBlock& block) const;
+
+private:
+    static constexpr int kLanes = 4;
+    static constexpr int kGroups = (kMaxFloats + kLanes - 1) / kLanes;
+    typedef float Lanes __attribute__((vector_size(kLanes * sizeof(float))));
+
+    Lanes from[kGroups] = {};
+    Lanes delta[kGroups] = {};      // B - A; zero in the padding lanes
+    uint16_t floatOffsets[kMaxFloats] = {};
+    int floatCount = 0;
+
+    struct Discrete {
+        uint16_t offset;
+        uint8_t size;               // sizeof(int) or sizeof(bool)
+        uint32_t value[2];          // Raw bytes of A's and B's value
+    };
+    Discrete discrete[kMaxDiscrete] = {};
+    int discreteCount = 0;
+
+    bool active = false;
+};
+
+#endif // PARAM_MORPH_H
@@ -0,0 +1,213 @@
+#ifndef PARAM_SNAPSHOT_H
+#define PARAM_SNAPSHOT_H
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+
+// Plain copy of every SynthParameters field the audio thread consumes.
+// The UI thread captures one from the atomics and publishes it; the audio
+// callback copies the latest one once per buffer and reads nothing else.
+struct SynthParamBlock {
+    uint32_t epoch = 0;  // SynthParameters::writeEpoch observed before capture
+    uint32_t presetSerial = 0;  // SynthParameters::presetSerial: changes on a preset switch
+    float presetMorph = 0.0f;   // Position of a ParamMorph from preset A (0) to B (1)
+
+    // Global envelope / master
+    float attack = 0.01f;
+    float decay = 0.1f;
+    float sustain = 0.7f;
+    float release = 0.2f;
+    float masterVolume = 0.5f;
+
+    struct Oscillator {
+        int mode = 1;
+        float freq = 440.0f;
+        float morph = 0.5f;
+        int shape = 0;
+        float duty = 0.5f;
+        float ratio = 1.0f;
+        float offset = 0.0f;
+        float amp = 1.0f;
+        float level = 0.0f;
+    } osc[4];
+
+    // Mixer mute/solo (4 OSC + 4 SAMP)
+    bool oscMuted[4] = {false, false, false, false};
+    bool oscSolo[4] = {false, false, false, false};
+    bool samplerMuted[4] = {false, false, false, false};
+    bool samplerSolo[4] = {false, false, false, false};
+
+    struct Lfo {
+        float period = 1.0f;
+        int syncMode = 0;
+        float morph = 0.5f;
+        float duty = 0.5f;
+        bool flip = false;
+        bool resetOnNote = false;
+        int shape = 0;
+    } lfo[4];
+
+    bool chaosRunning[4] = {true, true, true, true};
+
+    // Reverb
+    bool reverbEnabled = true;
+    int reverbType = 0;
+    float reverbDelayTime = 0.5f;
+    float reverbSize = 0.5f;
+    float reverbDamping = 0.5f;
+    float reverbMix = 0.3f;
+    float reverbDecay = 0.5f;
+    float reverbDiffusion = 0.5f;
+    float reverbModDepth = 0.1f;
+    float reverbModFreq = 2.0f;
+
+    // Filter
+    bool filterEnabled = false;
+    int filterType = 0;
+    float filterCutoff = 1000.0f;
+    float filterGain = 0.0f;
+    float filterResonance = 0.4f;
+    float filterDrive = 1.0f;
+    float filterFeedbackHP = 200.0f;
+    bool filterPerVoice = false;
+    float filterEnvAmount = 0.0f;
+    int filterOversample = 0;
+    int fmOversample = 0;
+    int oversampleQuality = 1;
+    int reverbRate = 0;
+
+    // Looper
+    int currentLoop = 0;
+    float overdubMix = 0.6f;
+    int loopQuantize = 0;
+
+    // FM matrix [target][source], OSC1-4 then SAMP1-4
+    float fmMatrix[8][8] = {};
+};
+
+// Calls visit(field) with a float&, int& or bool& for every parameter field
+// of block, in declaration order; the bookkeeping fields above (epoch,
+// presetSerial, presetMorph) are left out. Keep in step with the struct.
+template <typename Block, typename Visit>
+void forEachParam(Block& block, Visit&& visit) {
+    visit(block.attack);
+    visit(block.decay);
+    visit(block.sustain);
+    visit(block.release);
+    visit(block.masterVolume);
+    for (auto& o : block.osc) {
+        visit(o.mode);
+        visit(o.freq);
+        visit(o.morph);
+        visit(o.shape);
+        visit(o.duty);
+        visit(o.ratio);
+        visit(o.offset);
+        visit(o.amp);
+        visit(o.level);
+    }
+    for (int i = 0; i < 4; ++i) {
+        visit(block.oscMuted[i]);
+        visit(block.oscSolo[i]);
+        visit(block.samplerMuted[i]);
+        visit(block.samplerSolo[i]);
+    }
+    for (auto& l : block.lfo) {
+        visit(l.period);
+        visit(l.syncMode);
+        visit(l.morph);
+        visit(l.duty);
+        visit(l.flip);
+        visit(l.resetOnNote);
+        visit(l.shape);
+    }
+    for (auto& running : block.chaosRunning) {
+        visit(running);
+    }
+    visit(block.reverbEnabled);
+    visit(block.reverbType);
+    visit(block.reverbDelayTime);
+    visit(block.reverbSize);
+    visit(block.reverbDamping);
+    visit(block.reverbMix);
+    visit(block.reverbDecay);
+    visit(block.reverbDiffusion);
+    visit(block.reverbModDepth);
+    visit(block.reverbModFreq);
+    visit(block.filterEnabled);
+    visit(block.filterType);
+    visit(block.filterCutoff);
+    visit(block.filterGain);
+    visit(block.filterResonance);
+    visit(block.filterDrive);
+    visit(block.filterFeedbackHP);
+    visit(block.filterPerVoice);
+    visit(block.filterEnvAmount);
+    visit(block.filterOversample);
+    visit(block.fmOversample);
+    visit(block.oversampleQuality);
+    visit(block.reverbRate);
+    visit(block.currentLoop);
+    visit(block.overdubMix);
+    visit(block.loopQuantize);
+    for (auto& row : block.fmMatrix) {
+        for (auto& depth : row) {
+            visit(depth);
+        }
+    }
+}
+
+// Double-buffered seqlock for one writer (the UI thread) and one reader
+// (the audio thread). The writer always fills the slot the reader was not
+// pointed at, so a read only retries if two publishes land during one copy.
+class ParamSnapshotChannel {
+public:
+    void publish(const SynthParamBlock& block) {
+        const uint32_t slot = 1u - latest_.load(std::memory_order_relaxed);
+        Slot& s = slots_[slot];
+        s.sequence.fetch_add(1, std::memory_order_relaxed);  // odd: write in progress
+        std::atomic_thread_fence(std::memory_order_release);
+        std::memcpy(&s.block, &block, sizeof(SynthParamBlock));
+        s.sequence.fetch_add(1, std::memory_order_release);  // even: stable
+        latest_.store(slot, std::memory_order_release);
+        version_.fetch_add(1, std::memory_order_release);
+    }
+
+    // Copy the newest block if one was published since lastVersion.
+    // Gives up after a few torn reads instead of spinning (RT safe).
+    bool readIfNewer(uint32_t& lastVersion, SynthParamBlock& out) const {
+        const uint32_t version = version_.load(std::memory_order_acquire);
+        if (version == lastVersion) {
+            return false;
+        }
+        for (int attempt = 0; attempt < 4; ++attempt) {
+            const Slot& s = slots_[latest_.load(std::memory_order_acquire)];
+            const uint32_t before = s.sequence.load(std::memory_order_acquire);
+            if (before & 1u) {
+                continue;
+            }
+            std::memcpy(&out, &s.block, sizeof(SynthParamBlock));
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (s.sequence.load(std::memory_order_relaxed) == before) {
+                lastVersion = version;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    uint32_t version() const { return version_.load(std::memory_order_acquire); }
+
+private:
+    struct alignas(64) Slot {
+        std::atomic<uint32_t> sequence{0};
+        SynthParamBlock block;
+    };
+
+    Slot slots_[2];
+    std::atomic<uint32_t> latest_{0};
+    std::atomic<uint32_t> version_{0};
+};
+
+#endif // PARAM_SNAPSHOT_H
@@ -1,26 +1,30 @@
 #ifndef PARAMETER_SMOOTHER_H
 #define PARAMETER_SMOOTHER_H
 
+#include <algorithm>
 #include <cmath>
+#include <cstdint>
 
 // Simple one-pole lowpass filter for parameter smoothing
 // Provides smooth transitions without zipper noise
+//
+// updateRate is how often process() is called, in Hz: the sample rate for
+// per-sample use, sampleRate / bufferFrames when called once per buffer.
+// The default only fits a 100 Hz caller; set the real rate with setSmoothTime.
 class ParameterSmoother {
 public:
-    ParameterSmoother(float smoothTime = 0.01f, float sampleRate = 100.0f)
+    ParameterSmoother(float smoothTime = 0.01f, float updateRate = 100.0f)
         : currentValue(0.0f)
         , targetValue(0.0f) {
-        setSmoothTime(smoothTime, sampleRate);
+        setSmoothTime(smoothTime, updateRate);
     }
 
     // Set the smoothing time constant (in seconds)
     // Typical values: 0.005 - 0.02 seconds (5-20ms)
-    void setSmoothTime(float timeSeconds, float sampleRate) {
-        // Calculate one-pole filter coefficient
-        // coefficient = 1 - exp(-2π * cutoff_freq * dt)
-        // For smoothTime, we use cutoff = 1/(2π * smoothTime)
-        float dt = 1.0f / sampleRate;
-        coefficient = 1.0f - std::exp(-1.0f / (timeSeconds * sampleRate));
+    void setSmoothTime(float timeSeconds, float updateRate) {
+        // One-pole coefficient for a time constant of timeSeconds
+        // coefficient = 1 - exp(-1 / (timeSeconds * updateRate))
+        coefficient = 1.0f - std::exp(-1.0f / (timeSeconds * updateRate));
     }
 
     // Set target value (what the parameter should move towards)
@@ -35,8 +39,13 @@ public:
     }
 
     // Process one sample - returns smoothed value
+    // Snaps onto the target once settled, so a settled smoother returns the
+    // exact same value every call and downstream change checks can skip it
     float process() {
         currentValue += coefficient * (targetValue - currentValue);
+        if (isSettled()) {
+            currentValue = targetValue;
+        }
         return currentValue;
     }
 
@@ -45,9 +54,9 @@ public:
         return currentValue;
     }
 
-    // Check if we're close enough to target (within 0.1%)
+    // Check if we're close enough to target (within 0.1%, or 1e-6 near zero)
     bool isSettled() const {
-        return std::abs(targetValue - currentValue) < 0.001f * std::abs(targetValue);
+        return std::abs(targetValue - currentValue) <= 0.001f * std::abs(targetValue) + 1e-6f;
     }
 
 private:
@@ -56,4 +65,112 @@ private:
     float coefficient;
 };
 
+// Every smoothed parameter of the audio callback in one bank, stored as
+// structure-of-arrays in groups of four so one vector op steps four
+// parameters. advance() moves the whole bank once per buffer by that
+// buffer's frame count, so the time constant is in samples and does not
+// depend on the buffer size. Groups whose parameters have all settled are
+// skipped until a target moves.
+//
+// A parameter that feeds an audio-rate stage can read its move across the
+// buffer with ramp(): a straight line from the value at the previous
+// buffer's end to this one's, instead of a step at the first frame.
+class SmootherBank {
+public:
+    static constexpr int kMaxParams = 32;
+
+    SmootherBank() {
+        setSmoothTime(0.01f, 48000.0f);
+    }
+
+    // Time constant for every parameter, in seconds
+    void setSmoothTime(float timeSeconds, float sampleRate) {
+        timeFrames = timeSeconds * sampleRate;
+        stepFrames = 0;  // Recompute the coefficient on the next advance
+    }
+
+    // Jump to a value (no smoothing, no ramp)
+    void reset(int index, float value) {
+        current[index / kLanes][index % kLanes] = value;
+        previous[index / kLanes][index % kLanes] = value;
+        target[index / kLanes][index % kLanes] = value;
+    }
+
+    void setTarget(int index, float value) {
+        if (target[index / kLanes][index % kLanes] != value) {
+            target[index / kLanes][index % kLanes] = value;
+            activeGroups |= 1u << (index / kLanes);
+        }
+    }
+
+    // Step every unsettled parameter by nFrames of smoothing. A parameter
+    // snaps onto its target once within ParameterSmoother's settle bound
+    void advance(unsigned int nFrames) {
+        if (nFrames != stepFrames) {
+            coefficient = Lanes{} + (1.0f - std::exp(-static_cast<float>(nFrames) / timeFrames));
+            stepFrames = nFrames;
+        }
+
+        // Groups that moved last buffer end their ramps at this buffer's start
+        for (uint32_t moved = movedGroups & ~activeGroups; moved; moved &= moved - 1) {
+            const int g = __builtin_ctz(moved);
+            previous[g] = current[g];
+        }
+
+        movedGroups = activeGroups;
+        for (uint32_t active = activeGroups; active; active &= active - 1) {
+            const int g = __builtin_ctz(active);
+            previous[g] = current[g];
+            Lanes value = current[g] + coefficient * (target[g] - current[g]);
+            const LaneMask settled = magnitude(target[g] - value) <= 0.001f * magnitude(target[g]) + 1e-6f;
+            value = settled ? target[g] : value;
+            current[g] = value;
+            if (settled[0] & settled[1] & settled[2] & settled[3]) {
+                activeGroups &= ~(1u << g);
+            }
+        }
+    }
+
+    float value(int index) const { return current[index / kLanes][index % kLanes]; }
+
+    // Settled parameters sit exactly on their target
+    bool isSettled(int index) const {
+        return current[index / kLanes][index % kLanes] == target[index / kLanes][index % kLanes];
+    }
+
+    // True if the value changed on the last advance
+    bool moved(int index) const { return current[index / kLanes][index % kLanes] != previous[index / kLanes][index % kLanes]; }
+
+    // The last advance as a per-frame linear ramp: out[i] for i < nFrames
+    // runs from the previous value to the current one, ending on it exactly
+    void ramp(int index, float* out, unsigned int nFrames) const {
+        const float from = previous[index / kLanes][index % kLanes];
+        const float to = current[index / kLanes][index % kLanes];
+        const float step = (to - from) / static_cast<float>(nFrames);
+        for (unsigned int i = 0; i + 1 < nFrames; ++i) {
+            out[i] = from + step * static_cast<float>(i + 1);
+        }
+        if (nFrames > 0) {
+            out[nFrames - 1] = to;
+        }
+    }
+
+private:
+    static constexpr int kLanes = 4;
+    static constexpr int kGroups = kMaxParams / kLanes;
+    typedef float Lanes __attribute__((vector_size(kLanes * sizeof(float))));
+    typedef int32_t LaneMask __attribute__((vector_size(kLanes * sizeof(int32_t))));
+
+    static Lanes magnitude(Lanes v) { return v < 0.0f ? -v : v; }
+
+    Lanes current[kGroups] = {};
+    Lanes previous[kGroups] = {};
+    Lanes target[kGroups] = {};
+    Lanes coefficient = {};
+    float timeFrames = 480.0f;
+    unsigned int stepFrames = 0;
+    uint32_t activeGroups = 0;   // Bit g: group g has a parameter still moving
+    uint32_t movedGroups = 0;    // Bit g: group g stepped on the last advance
+};
+
 #endif // PARAMETER_SMOOTHER_H
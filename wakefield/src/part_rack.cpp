@@ -0,0 +1,135 @@
+#include "part_rack.h"
+
+#include <algorithm>
+#include "preset.h"
+#include "synth.h"
+#include "ui.h"
+
+PartRack::PartRack(float sampleRate, Clock* clock)
+    : sampleRate(sampleRate)
+    , clock(clock) {
+    std::fill(std::begin(channelPart), std::end(channelPart), -1);
+}
+
+PartRack::~PartRack() {
+    pool.stop();
+}
+
+bool PartRack::addPart(int channel, const std::string& preset, std::string& error) {
+    if (channel < 0 || channel > 15) {
+        error = "MIDI channel must be 1-16";
+        return false;
+    }
+    if (channelPart[channel] >= 0) {
+        error = "channel " + std::to_string(channel + 1) + " already has a part";
+        return false;
+    }
+    if (getPartCount() == kMaxParts) {
+        error = "at most " + std::to_string(kMaxParts) + " parts";
+        return false;
+    }
+
+    // The preset over the defaults, as the UI would hold it after loading it
+    std::unique_ptr<SynthParameters> loaded(new SynthParameters());
+    if (!PresetManager::loadPreset(preset, loaded.get())) {
+        error = "cannot read preset " + preset;
+        return false;
+    }
+
+    std::unique_ptr<Part> part(new Part());
+    loaded->captureBlock(part->params);
+    part->channel = channel;
+    part->left.assign(kMaxFrames, 0.0f);
+    part->right.assign(kMaxFrames, 0.0f);
+
+    const SynthParamBlock& p = part->params;
+    part->synth.reset(new Synth(sampleRate));
+    Synth& synth = *part->synth;
+    synth.setClock(clock);
+    synth.setParameterBlock(&part->params);
+    synth.setScopeEnabled(false);
+    synth.updateEnvelopeParameters(p.attack, p.decay, p.sustain, p.release);
+    synth.setMasterVolume(p.masterVolume);
+    for (int i = 0; i < OSCILLATORS_PER_VOICE; ++i) {
+        const SynthParamBlock::Oscillator& osc = p.osc[i];
+        synth.setOscillatorState(i, static_cast<BrainwaveMode>(osc.mode), osc.shape, osc.freq, osc.morph,
+                                 osc.duty, osc.ratio, osc.offset, osc.amp, osc.level);
+    }
+    synth.setFilterEnabled(p.filterEnabled);
+    synth.updateFilterParameters(p.filterType, p.filterCutoff, p.filterGain, p.filterResonance,
+                                 p.filterDrive, p.filterFeedbackHP);
+    synth.setFilterPerVoice(p.filterPerVoice, p.filterEnvAmount);
+    synth.setOversampling(1 << p.filterOversample, 1 << p.fmOversample,
+                          static_cast<OversampleQuality>(p.oversampleQuality));
+
+    channelPart[channel] = getPartCount();
+    parts.push_back(std::move(part));
+    return true;
+}
+
+void PartRack::takeEvents(EventSchedule& schedule) {
+    for (auto& part : parts) {
+        part->events.clear();
+    }
+    schedule.extract([this](const ScheduledEvent& event) {
+        if (event.channel >= 16 || channelPart[event.channel] < 0) {
+            return false;
+        }
+        parts[channelPart[event.channel]]->events.add(event.frame, event.type, event.note,
+                                                      event.velocity, event.channel);
+        return true;
+    });
+}
+
+void PartRack::render(unsigned int nFrames, const Controls& controls) {
+    renderedFrames = std::min(nFrames, kMaxFrames);
+    for (auto& part : parts) {
+        Synth& synth = *part->synth;
+        for (int i = 0; i < 4; ++i) {
+            const SynthParamBlock::Lfo& lfo = part->params.lfo[i];
+            synth.updateLFOParameters(i, lfo.period, lfo.syncMode, lfo.shape, lfo.morph, lfo.duty,
+                                      lfo.flip, lfo.resetOnNote, controls.tempo);
+        }
+        synth.setVoiceLimit(controls.voiceLimit);
+        synth.setSamplerInterpolationCap(controls.interpolationCap);
+    }
+    pool.run(renderPartTask, this, getPartCount());
+}
+
+void PartRack::renderPartTask(void* context, int task) {
+    PartRack& rack = *static_cast<PartRack*>(context);
+    Part& part = *rack.parts[task];
+    Synth& synth = *part.synth;
+    const unsigned int nFrames = rack.renderedFrames;
+
+    synth.processLFOs(rack.sampleRate, nFrames);
+    synth.processChaos(nFrames);
+    // Split at the part's notes so each lands on its frame
+    for (unsigned int pos = 0; pos < nFrames;) {
+        part.events.dispatchThrough(pos, [&synth](const ScheduledEvent& event) {
+            if (event.type == ScheduledEvent::NOTE_ON) {
+                synth.noteOn(event.note, event.velocity);
+            } else {
+                synth.noteOff(event.note);
+            }
+        });
+        const unsigned int end = std::min<uint32_t>(nFrames, part.events.nextFrame());
+        synth.renderVoices(part.left.data() + pos, part.right.data() + pos, end - pos);
+        pos = end;
+    }
+}
+
+void PartRack::addMix(float* left, float* right, unsigned int offset, unsigned int nFrames) const {
+    if (offset >= renderedFrames) {
+        return;
+    }
+    nFrames = std::min(nFrames, renderedFrames - offset);
+    for (const auto& part : parts) {
+        const float* partLeft = part->left.data() + offset;
+        const float* partRight = part->right.data() + offset;
+        for (unsigned int i = 0; i < nFrames; ++i) {
+            left[i] += partLeft[i];
+            right[i] += partRight[i];
+        }
+    }
+}
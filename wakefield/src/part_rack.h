@@ -0,0 +1,88 @@
+#ifndef PART_RACK_H
+#define PART_RACK_H
+
+#include <memory>
+#include <string>
+#include <vector>
+#include "event_schedule.h"
+#include "param_snapshot.h"
+#include "sampler.h"
+#include "voice_pool.h"
+
+class Synth;
+class Clock;
+
+// Multi-timbral play (--part CH:PRESET): each part is a Synth of its own,
+// set up from a preset and playing the notes of one MIDI channel, in the
+// same process and on the same stream. The main synth, the one the UI
+// edits, keeps every channel no part claims and the sequencer.
+//
+// Parts render only their voices: every part for the whole buffer, in
+// parallel on the rack's helper threads with the audio thread taking a
+// share, before the main synth renders. Their sum is added to the main
+// synth's voices ahead of its filter and reverb, so all parts share one
+// effects bus (one reverb, however many parts play). A preset's per-voice
+// filter still runs in the part's voices; its mix filter and reverb
+// settings are not used.
+class PartRack {
+public:
+    static constexpr int kMaxParts = 16;
+    // Largest buffer the parts render; past it they are silent
+    static constexpr unsigned int kMaxFrames = 8192;
+
+    // What the callback applies to every part each buffer
+    struct Controls {
+        float tempo = 120.0f;           // For synced LFOs
+        int voiceLimit = 64;            // Quality governor polyphony cap
+        SamplerInterpolation interpolationCap = SamplerInterpolation::SINC;
+    };
+
+    PartRack(float sampleRate, Clock* clock);
+    ~PartRack();
+
+    // Add a part on MIDI channel (0-15) with a preset's parameters. Call
+    // before the stream starts
+    bool addPart(int channel, const std::string& preset, std::string& error);
+    int getPartCount() const { return static_cast<int>(parts.size()); }
+
+    // Render parts on this many helper threads plus the audio thread (at
+    // most one per part beyond the first). Call only while no callback runs
+    bool setThreads(int helpers) { return pool.start(helpers); }
+    int getThreads() const { return pool.getHelperCount(); }
+
+    // Audio thread, once the buffer's notes are scheduled: move the notes on
+    // the parts' channels out of schedule and into the parts' own
+    void takeEvents(EventSchedule& schedule);
+
+    // Audio thread: render every part's voices for the buffer
+    void render(unsigned int nFrames, const Controls& controls);
+
+    // Audio thread: add frames [offset, offset + nFrames) of the rendered
+    // parts into left and right
+    void addMix(float* left, float* right, unsigned int offset, unsigned int nFrames) const;
+
+    PartRack(const PartRack&) = delete;
+    PartRack& operator=(const PartRack&) = delete;
+
+private:
+    struct Part {
+        std::unique_ptr<Synth> synth;
+        SynthParamBlock params;
+        int channel = 0;
+        EventSchedule events;
+        std::vector<float> left;
+        std::vector<float> right;
+    };
+
+    static void renderPartTask(void* context, int task);
+
+    float sampleRate;
+    Clock* clock;
+    std::vector<std::unique_ptr<Part>> parts;
+    int channelPart[16];                // Part index per MIDI channel, -1 for the main synth
+    unsigned int renderedFrames = 0;
+
+    VoiceThreadPool pool;   // Last member: helpers stop before the parts go away
+};
+
+#endif // PART_RACK_H
@@ -30,7 +30,7 @@ const PatternStep& Pattern::getStep(int index) const {
 }
 
 void Pattern::generateStep(int stepIndex, MusicalConstraints& constraints,
-                           MarkovChain& markov, bool euclideanTrigger) {
+                           MarkovChain& markov, bool euclideanTrigger, rng::Stream& rng) {
     PatternStep& s = steps[stepIndex];
 
     // Set active state from Euclidean pattern
@@ -38,22 +38,22 @@ void Pattern::generateStep(int stepIndex, MusicalConstraints& constraints,
 
     if (s.active) {
         // Get next note from Markov chain
-        markov.getNextState();
+        markov.getNextState(rng);
         s.midiNote = markov.getCurrentNote();
 
         // Quantize to scale (in case Markov drifted)
         s.midiNote = constraints.quantizeToScale(s.midiNote);
 
         // Generate velocity with variation (70-100)
-        s.velocity = 70 + (rand() % 31);
+        s.velocity = 70 + static_cast<int>(rng.below(31));
 
         // Default gate length (80% of step)
-        s.gateLength = 0.7f + (rand() % 30) / 100.0f;  // 0.7-1.0
+        s.gateLength = 0.7f + rng.below(30) / 100.0f;  // 0.7-1.0
 
         // Default probability (usually 100%, but add some variation)
         float densityFactor = constraints.getDensity();
         if (densityFactor < 0.8f) {
-            s.probability = 0.8f + (rand() % 21) / 100.0f;  // 0.8-1.0
+            s.probability = 0.8f + rng.below(21) / 100.0f;  // 0.8-1.0
         } else {
             s.probability = 1.0f;
         }
@@ -68,7 +68,8 @@ void Pattern::generateStep(int stepIndex, MusicalConstraints& constraints,
 void Pattern::generateFromConstraints(
     MusicalConstraints& constraints,
     MarkovChain& markov,
-    const EuclideanPattern& rhythm)
+    const EuclideanPattern& rhythm,
+    rng::Stream& rng)
 {
     // Generate pattern from scratch
     for (int step = 0; step < length; ++step) {
@@ -76,25 +77,26 @@ void Pattern::generateFromConstraints(
         if (steps[step].locked) continue;
 
         bool trigger = rhythm.getTrigger(step);
-        generateStep(step, constraints, markov, trigger);
+        generateStep(step, constraints, markov, trigger, rng);
     }
 }
 
 void Pattern::regenerateUnlocked(
     MusicalConstraints& constraints,
     MarkovChain& markov,
-    const EuclideanPattern& rhythm)
+    const EuclideanPattern& rhythm,
+    rng::Stream& rng)
 {
     // Only regenerate unlocked steps
     for (int step = 0; step < length; ++step) {
         if (steps[step].locked) continue;
 
         bool trigger = rhythm.getTrigger(step);
-        generateStep(step, constraints, markov, trigger);
+        generateStep(step, constraints, markov, trigger, rng);
     }
 }
 
-void Pattern::mutate(float amount) {
+void Pattern::mutate(float amount, rng::Stream& rng) {
     // Mutate unlocked steps slightly
     amount = std::clamp(amount, 0.0f, 1.0f);
 
@@ -102,26 +104,44 @@ void Pattern::mutate(float amount) {
         if (steps[step].locked || !steps[step].active) continue;
 
         // Randomly mutate based on amount
-        if ((rand() % 100) / 100.0f < amount) {
+        if (rng.below(100) / 100.0f < amount) {
             // Mutate note (move by small interval)
-            int shift = (rand() % 5) - 2;  // -2 to +2 semitones
+            int shift = static_cast<int>(rng.below(5)) - 2;  // -2 to +2 semitones
             steps[step].midiNote = std::clamp(steps[step].midiNote + shift, 0, 127);
         }
 
-        if ((rand() % 100) / 100.0f < amount * 0.5f) {
+        if (rng.below(100) / 100.0f < amount * 0.5f) {
             // Mutate velocity slightly
-            int shift = (rand() % 21) - 10;  // -10 to +10
+            int shift = static_cast<int>(rng.below(21)) - 10;  // -10 to +10
             steps[step].velocity = std::clamp(steps[step].velocity + shift, 1, 127);
         }
 
-        if ((rand() % 100) / 100.0f < amount * 0.3f) {
+        if (rng.below(100) / 100.0f < amount * 0.3f) {
             // Mutate probability
-            float shift = ((rand() % 21) - 10) / 100.0f;  // -0.1 to +0.1
+            float shift = (static_cast<int>(rng.below(21)) - 10) / 100.0f;  // -0.1 to +0.1
             steps[step].probability = std::clamp(steps[step].probability + shift, 0.0f, 1.0f);
         }
     }
 }
 
+bool Pattern::sameAs(const Pattern& other) const {
+    if (length != other.length || resolution != other.resolution || rotation != other.rotation ||
+        steps.size() != other.steps.size()) {
+        return false;
+    }
+    for (size_t i = 0; i < steps.size(); ++i) {
+        const PatternStep& a = steps[i];
+        const PatternStep& b = other.steps[i];
+        if (a.active != b.active || a.locked != b.locked || a.midiNote != b.midiNote ||
+            a.velocity != b.velocity || a.gateLength != b.gateLength || a.probability != b.probability ||
+            a.filterCutoff != b.filterCutoff || a.reverbMix != b.reverbMix ||
+            a.brainwaveMorph != b.brainwaveMorph) {
+            return false;
+        }
+    }
+    return true;
+}
+
 void Pattern::rotate(int steps) {
     rotation = (rotation + steps) % length;
     if (rotation < 0) rotation += length;
@@ -190,19 +210,26 @@ void Pattern::clear() {
     }
 }
 
-void Pattern::randomizeVelocities(int minVel, int maxVel) {
-    for (auto& step : steps) {
+void Pattern::randomizeVelocities(rng::Stream& rng, int minVel, int maxVel) {
+    std::vector<uint32_t> draws(steps.size());
+    rng.fill(draws.data(), static_cast<int>(draws.size()));
+    const uint32_t span = static_cast<uint32_t>(std::max(maxVel - minVel + 1, 1));
+    for (size_t i = 0; i < steps.size(); ++i) {
+        PatternStep& step = steps[i];
         if (step.active && !step.locked) {
-            step.velocity = minVel + (rand() % (maxVel - minVel + 1));
+            step.velocity = minVel + static_cast<int>(rng::Stream::scale(draws[i], span));
         }
     }
 }
 
-void Pattern::randomizeProbabilities(float minProb, float maxProb) {
-    for (auto& step : steps) {
+void Pattern::randomizeProbabilities(rng::Stream& rng, float minProb, float maxProb) {
+    std::vector<uint32_t> draws(steps.size());
+    rng.fill(draws.data(), static_cast<int>(draws.size()));
+    const float range = maxProb - minProb;
+    for (size_t i = 0; i < steps.size(); ++i) {
+        PatternStep& step = steps[i];
         if (step.active && !step.locked) {
-            float range = maxProb - minProb;
-            step.probability = minProb + (rand() % 101) / 100.0f * range;
+            step.probability = minProb + rng::Stream::scale(draws[i], 101) / 100.0f * range;
         }
     }
 }
@@ -7,6 +7,7 @@
 #include "constraint.h"
 #include "markov.h"
 #include "euclidean.h"
+#include "rng.h"
 
 // A single step in the pattern
 struct PatternStep {
@@ -50,22 +51,25 @@ public:
     PatternStep& getStep(int index);
     const PatternStep& getStep(int index) const;
 
-    // Generation
+    // Generation; every random choice (the Markov steps included) is drawn
+    // from rng
     void generateFromConstraints(
         MusicalConstraints& constraints,
         MarkovChain& markov,
-        const EuclideanPattern& rhythm
+        const EuclideanPattern& rhythm,
+        rng::Stream& rng
     );
 
     // Regenerate only unlocked steps
     void regenerateUnlocked(
         MusicalConstraints& constraints,
         MarkovChain& markov,
-        const EuclideanPattern& rhythm
+        const EuclideanPattern& rhythm,
+        rng::Stream& rng
     );
 
     // Mutation (slight variation of existing pattern)
-    void mutate(float amount);  // 0.0-1.0 (how much to change)
+    void mutate(float amount, rng::Stream& rng);  // 0.0-1.0 (how much to change)
 
     // Pattern rotation (phase shift)
     void rotate(int steps);  // Positive = forward, negative = backward
@@ -83,12 +87,16 @@ public:
     void setGateLength(int step, float gate);
     void setProbability(int step, float prob);
 
+    // Same length, resolution, rotation and steps
+    bool sameAs(const Pattern& other) const;
+
     // Clear pattern
     void clear();
 
-    // Randomization
-    void randomizeVelocities(int minVel = 60, int maxVel = 100);
-    void randomizeProbabilities(float minProb = 0.6f, float maxProb = 1.0f);
+    // Randomization. One draw per step, taken as a block, so a step gets
+    // the same value whichever other steps are active or locked
+    void randomizeVelocities(rng::Stream& rng, int minVel = 60, int maxVel = 100);
+    void randomizeProbabilities(rng::Stream& rng, float minProb = 0.6f, float maxProb = 1.0f);
 
     // Serialization
     void saveToFile(const std::string& path) const;
@@ -107,7 +115,7 @@ private:
 
     // Helper for generation
     void generateStep(int stepIndex, MusicalConstraints& constraints,
-                      MarkovChain& markov, bool euclideanTrigger);
+                      MarkovChain& markov, bool euclideanTrigger, rng::Stream& rng);
 };
 
 #endif // PATTERN_H
@@ -0,0 +1,77 @@
+#include "pattern_worker.h"
+
+PatternWorker::~PatternWorker() {
+    stop();
+}
+
+void PatternWorker::submit(JobType type, int trackIndex, const Track& track, float amount) {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        jobs.push_back(Job{type, trackIndex, track, amount});
+        stopping = false;
+        if (!thread.joinable()) {
+            thread = std::thread(&PatternWorker::worker, this);
+        }
+    }
+    wake.notify_one();
+}
+
+bool PatternWorker::pollResult(int& trackIndex, Track& track) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (results.empty()) {
+        return false;
+    }
+    trackIndex = results.front().trackIndex;
+    track = std::move(results.front().track);
+    results.pop_front();
+    return true;
+}
+
+void PatternWorker::waitIdle() {
+    std::unique_lock<std::mutex> lock(mutex);
+    idle.wait(lock, [this] { return jobs.empty() && !busy; });
+}
+
+void PatternWorker::stop() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    wake.notify_all();
+    if (thread.joinable()) {
+        thread.join();
+    }
+}
+
+void PatternWorker::worker() {
+    std::unique_lock<std::mutex> lock(mutex);
+    while (true) {
+        wake.wait(lock, [this] { return stopping || !jobs.empty(); });
+        if (jobs.empty()) {
+            return;     // Stopping with nothing left to do
+        }
+        Job job = std::move(jobs.front());
+        jobs.pop_front();
+        busy = true;
+        lock.unlock();
+
+        switch (job.type) {
+            case JobType::GENERATE:
+                job.track.generatePattern();
+                break;
+            case JobType::REGENERATE_UNLOCKED:
+                job.track.regenerateUnlocked();
+                break;
+            case JobType::MUTATE:
+                job.track.mutate(job.amount);
+                break;
+        }
+
+        lock.lock();
+        results.push_back(Result{job.trackIndex, std::move(job.track)});
+        busy = false;
+        if (jobs.empty()) {
+            idle.notify_all();
+        }
+    }
+}
@@ -0,0 +1,67 @@
+#ifndef PATTERN_WORKER_H
+#define PATTERN_WORKER_H
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include "track.h"
+
+// Runs pattern generation (Markov, constraint and Euclidean passes) on a
+// background thread (started with the first job), so neither the UI key
+// handler nor the audio thread waits on it. Each job works on its own copy
+// of a track; the finished copy is handed back through pollResult for the
+// UI thread to adopt.
+class PatternWorker {
+public:
+    enum class JobType {
+        GENERATE,
+        REGENERATE_UNLOCKED,
+        MUTATE
+    };
+
+    PatternWorker() = default;
+    ~PatternWorker();
+
+    // Queue a job on a copy of track. Not on the audio thread
+    void submit(JobType type, int trackIndex, const Track& track, float amount = 0.0f);
+
+    // One finished job per call, in submission order: the track index it was
+    // submitted with and the track copy after the job. False if none
+    bool pollResult(int& trackIndex, Track& track);
+
+    // Block until every queued job has finished
+    void waitIdle();
+
+    // Finish the queued jobs and stop the thread
+    void stop();
+
+    PatternWorker(const PatternWorker&) = delete;
+    PatternWorker& operator=(const PatternWorker&) = delete;
+
+private:
+    struct Job {
+        JobType type;
+        int trackIndex;
+        Track track;
+        float amount;
+    };
+
+    struct Result {
+        int trackIndex;
+        Track track;
+    };
+
+    void worker();
+
+    std::mutex mutex;               // Guards jobs, results, busy and stopping
+    std::condition_variable wake;
+    std::condition_variable idle;
+    std::deque<Job> jobs;
+    std::deque<Result> results;
+    bool busy = false;              // A job is running outside the lock
+    bool stopping = false;
+    std::thread thread;
+};
+
+#endif // PATTERN_WORKER_H
@@ -0,0 +1,387 @@
+#include "plugin_engine.h"
+
+#include <algorithm>
+#include <sstream>
+#include <type_traits>
+#include "automation.h"
+#include "clock.h"
+#include "denormal_guard.h"
+#include "loop_manager.h"
+#include "output_stage.h"
+#include "sequencer.h"
+#include "synth.h"
+#include "ui.h"
+
+namespace {
+
+// Largest stretch rendered in one go, so the looper input planes stay small
+constexpr uint32_t kSliceFrames = 1024;
+
+// Same ids and ranges as applyNormalizedToParameter() in main.cpp, as
+// plain values
+const PluginEngine::Param kParams[] = {
+    {2,  "Attack",        "Envelope", 0.001, 30.0,   false,
+     [](const SynthParamBlock& b) { return double(b.attack); },  [](SynthParamBlock& b, double v) { b.attack = float(v); }},
+    {3,  "Decay",         "Envelope", 0.001, 30.0,   false,
+     [](const SynthParamBlock& b) { return double(b.decay); },   [](SynthParamBlock& b, double v) { b.decay = float(v); }},
+    {4,  "Sustain",       "Envelope", 0.0,   1.0,    false,
+     [](const SynthParamBlock& b) { return double(b.sustain); }, [](SynthParamBlock& b, double v) { b.sustain = float(v); }},
+    {5,  "Release",       "Envelope", 0.001, 30.0,   false,
+     [](const SynthParamBlock& b) { return double(b.release); }, [](SynthParamBlock& b, double v) { b.release = float(v); }},
+    {6,  "Master Volume", "Global",   0.0,   1.0,    false,
+     [](const SynthParamBlock& b) { return double(b.masterVolume); }, [](SynthParamBlock& b, double v) { b.masterVolume = float(v); }},
+    {10, "OSC1 Mode",     "Oscillator", 0.0, 1.0,    true,
+     [](const SynthParamBlock& b) { return double(b.osc[0].mode); }, [](SynthParamBlock& b, double v) { b.osc[0].mode = int(v + 0.5); }},
+    {11, "OSC1 Freq",     "Oscillator", 20.0, 2000.0, false,
+     [](const SynthParamBlock& b) { return double(b.osc[0].freq); }, [](SynthParamBlock& b, double v) { b.osc[0].freq = float(v); }},
+    {12, "OSC1 Morph",    "Oscillator", 0.0001, 0.9999, false,
+     [](const SynthParamBlock& b) { return double(b.osc[0].morph); }, [](SynthParamBlock& b, double v) { b.osc[0].morph = float(v); }},
+    {13, "OSC1 Duty",     "Oscillator", 0.0, 1.0,    false,
+     [](const SynthParamBlock& b) { return double(b.osc[0].duty); }, [](SynthParamBlock& b, double v) { b.osc[0].duty = float(v); }},
+    {14, "OSC1 Ratio",    "Oscillator", 0.125, 16.0, false,
+     [](const SynthParamBlock& b) { return double(b.osc[0].ratio); }, [](SynthParamBlock& b, double v) { b.osc[0].ratio = float(v); }},
+    {15, "OSC1 Offset",   "Oscillator", -1000.0, 1000.0, false,
+     [](const SynthParamBlock& b) { return double(b.osc[0].offset); }, [](SynthParamBlock& b, double v) { b.osc[0].offset = float(v); }},
+    {20, "Reverb Type",   "Reverb",   0.0,   6.0,    true,
+     [](const SynthParamBlock& b) { return double(b.reverbType); }, [](SynthParamBlock& b, double v) { b.reverbType = int(v + 0.5); }},
+    {21, "Reverb",        "Reverb",   0.0,   1.0,    true,
+     [](const SynthParamBlock& b) { return b.reverbEnabled ? 1.0 : 0.0; }, [](SynthParamBlock& b, double v) { b.reverbEnabled = v > 0.5; }},
+    {22, "Delay Time",    "Reverb",   0.0,   1.0,    false,
+     [](const SynthParamBlock& b) { return double(b.reverbDelayTime); }, [](SynthParamBlock& b, double v) { b.reverbDelayTime = float(v); }},
+    {23, "Size",          "Reverb",   0.0,   1.0,    false,
+     [](const SynthParamBlock& b) { return double(b.reverbSize); }, [](SynthParamBlock& b, double v) { b.reverbSize = float(v); }},
+    {24, "Damping",       "Reverb",   0.0,   0.99,   false,
+     [](const SynthParamBlock& b) { return double(b.reverbDamping); }, [](SynthParamBlock& b, double v) { b.reverbDamping = float(v); }},
+    {25, "Reverb Mix",    "Reverb",   0.0,   1.0,    false,
+     [](const SynthParamBlock& b) { return double(b.reverbMix); }, [](SynthParamBlock& b, double v) { b.reverbMix = float(v); }},
+    {26, "Reverb Decay",  "Reverb",   0.0,   1.0,    false,
+     [](const SynthParamBlock& b) { return double(b.reverbDecay); }, [](SynthParamBlock& b, double v) { b.reverbDecay = float(v); }},
+    {27, "Diffusion",     "Reverb",   0.0,   0.99,   false,
+     [](const SynthParamBlock& b) { return double(b.reverbDiffusion); }, [](SynthParamBlock& b, double v) { b.reverbDiffusion = float(v); }},
+    {28, "Mod Depth",     "Reverb",   0.0,   1.0,    false,
+     [](const SynthParamBlock& b) { return double(b.reverbModDepth); }, [](SynthParamBlock& b, double v) { b.reverbModDepth = float(v); }},
+    {29, "Mod Freq",      "Reverb",   0.0,   10.0,   false,
+     [](const SynthParamBlock& b) { return double(b.reverbModFreq); }, [](SynthParamBlock& b, double v) { b.reverbModFreq = float(v); }},
+    {30, "Filter Type",   "Filter",   0.0,   3.0,    true,
+     [](const SynthParamBlock& b) { return double(b.filterType); }, [](SynthParamBlock& b, double v) { b.filterType = int(v + 0.5); }},
+    {31, "Filter",        "Filter",   0.0,   1.0,    true,
+     [](const SynthParamBlock& b) { return b.filterEnabled ? 1.0 : 0.0; }, [](SynthParamBlock& b, double v) { b.filterEnabled = v > 0.5; }},
+    {32, "Cutoff",        "Filter",   20.0,  20000.0, false,
+     [](const SynthParamBlock& b) { return double(b.filterCutoff); }, [](SynthParamBlock& b, double v) { b.filterCutoff = float(v); }},
+    {33, "Filter Gain",   "Filter",   -24.0, 24.0,   false,
+     [](const SynthParamBlock& b) { return double(b.filterGain); }, [](SynthParamBlock& b, double v) { b.filterGain = float(v); }},
+    {40, "Current Loop",  "Looper",   0.0,   3.0,    true,
+     [](const SynthParamBlock& b) { return double(b.currentLoop); }, [](SynthParamBlock& b, double v) { b.currentLoop = int(v + 0.5); }},
+    {41, "Overdub Mix",   "Looper",   0.0,   1.0,    false,
+     [](const SynthParamBlock& b) { return double(b.overdubMix); }, [](SynthParamBlock& b, double v) { b.overdubMix = float(v); }},
+    {PluginEngine::kLoopRecPlay, "Loop Rec/Play", "Looper", 0.0, 1.0, true, nullptr, nullptr},
+    {PluginEngine::kLoopOverdub, "Loop Overdub",  "Looper", 0.0, 1.0, true, nullptr, nullptr},
+    {PluginEngine::kLoopStop,    "Loop Stop",     "Looper", 0.0, 1.0, true, nullptr, nullptr},
+    {PluginEngine::kLoopClear,   "Loop Clear",    "Looper", 0.0, 1.0, true, nullptr, nullptr},
+    {PluginEngine::kSequencer,   "Sequencer",     "Sequencer", 0.0, 1.0, true, nullptr, nullptr},
+};
+constexpr int kParamCount = sizeof(kParams) / sizeof(kParams[0]);
+
+const char kStateHeader[] = "wakefield-plugin 1";
+
+} // namespace
+
+int PluginEngine::getParamCount() {
+    return kParamCount;
+}
+
+const PluginEngine::Param& PluginEngine::getParam(int index) {
+    return kParams[index];
+}
+
+const PluginEngine::Param* PluginEngine::findParam(uint32_t id) {
+    for (const Param& param : kParams) {
+        if (param.id == id) {
+            return &param;
+        }
+    }
+    return nullptr;
+}
+
+PluginEngine::PluginEngine() {
+    // The defaults a fresh standalone synth starts with
+    SynthParameters defaults;
+    defaults.captureBlock(settings.block);
+    mainView = settings;
+}
+
+PluginEngine::~PluginEngine() {
+    deactivate();
+}
+
+bool PluginEngine::activate(double rate, uint32_t maxFrames) {
+    deactivate();
+    sampleRate = static_cast<float>(rate);
+    synth.reset(new Synth(sampleRate));
+    synth->setParameterBlock(&settings.block);
+    synth->setScopeEnabled(false);
+    clock.reset(new Clock(sampleRate));
+    synth->setClock(clock.get());
+    sequencer.reset(new Sequencer(clock.get(), synth.get()));
+    sequencer->generatePattern();
+    sequencer->finishPatternJobs();
+    loopManager.reset(new LoopManager(sampleRate));
+    output.reset(new OutputStage());
+    output->setDither(false);
+
+    const uint32_t slice = std::min(std::max(maxFrames, 1u), kSliceFrames);
+    synthLeft.assign(slice, 0.0f);
+    synthRight.assign(slice, 0.0f);
+    settingsDirty = true;
+    return true;
+}
+
+void PluginEngine::deactivate() {
+    // A state load the audio thread did not get to
+    if (loaded.takeFresh()) {
+        settings = loaded.front();
+    }
+    sequencer.reset();
+    loopManager.reset();
+    output.reset();
+    synth.reset();
+    clock.reset();
+}
+
+void PluginEngine::applyEvent(const Event& event) {
+    switch (event.type) {
+        case Event::NOTE_ON:
+            synth->noteOn(event.note, event.velocity);
+            return;
+        case Event::NOTE_OFF:
+            synth->noteOff(event.note);
+            return;
+        case Event::PARAM:
+            break;
+    }
+
+    if (event.param == kSequencer) {
+        settings.sequencer = event.value > 0.5;
+        return;
+    }
+    if (event.param >= kLoopRecPlay && event.param <= kLoopClear) {
+        float& last = buttons[event.param - kLoopRecPlay];
+        const bool pressed = event.value > 0.5 && last <= 0.5f;
+        last = static_cast<float>(event.value);
+        Looper* loop = (pressed && loopManager) ? loopManager->getCurrentLoop() : nullptr;
+        if (loop) {
+            switch (event.param) {
+                case kLoopRecPlay: loop->pressRecPlay(); break;
+                case kLoopOverdub: loop->pressOverdub(); break;
+                case kLoopStop: loop->pressStop(); break;
+                default: loop->pressClear(); break;
+            }
+        }
+        return;
+    }
+    const Param* param = findParam(event.param);
+    if (param && param->set) {
+        param->set(settings.block, std::min(std::max(event.value, param->min), param->max));
+        settingsDirty = true;
+    }
+}
+
+void PluginEngine::applySettings() {
+    const SynthParamBlock& p = settings.block;
+    synth->updateEnvelopeParameters(p.attack, p.decay, p.sustain, p.release);
+    synth->setMasterVolume(p.masterVolume);
+    for (int i = 0; i < OSCILLATORS_PER_VOICE; ++i) {
+        const SynthParamBlock::Oscillator& osc = p.osc[i];
+        synth->setOscillatorState(i, static_cast<BrainwaveMode>(osc.mode), osc.shape, osc.freq, osc.morph,
+                                  osc.duty, osc.ratio, osc.offset, osc.amp, osc.level);
+    }
+    synth->setReverbEnabled(p.reverbEnabled);
+    synth->setReverbType(p.reverbType);
+    synth->setReverbHalfRate(p.reverbRate == 1);
+    synth->updateReverbParameters(p.reverbDelayTime, p.reverbSize, p.reverbDamping, p.reverbMix,
+                                  p.reverbDecay, p.reverbDiffusion, p.reverbModDepth, p.reverbModFreq);
+    synth->setFilterEnabled(p.filterEnabled);
+    synth->updateFilterParameters(p.filterType, p.filterCutoff, p.filterGain, p.filterResonance,
+                                  p.filterDrive, p.filterFeedbackHP);
+    synth->setFilterPerVoice(p.filterPerVoice, p.filterEnvAmount);
+    synth->setOversampling(1 << p.filterOversample, 1 << p.fmOversample,
+                           static_cast<OversampleQuality>(p.oversampleQuality));
+    loopManager->selectLoop(p.currentLoop);
+    loopManager->setOverdubMix(p.overdubMix);
+    settingsDirty = false;
+}
+
+void PluginEngine::followTransport(const Transport& transport, uint32_t nFrames) {
+    const bool follow = settings.sequencer && transport.valid;
+    if (follow) {
+        clock->setTempo(transport.tempo);
+    }
+    if (follow && transport.playing && !clock->isPlaying()) {
+        clock->locate(transport.beat);
+        sequencer->play();
+    } else if ((!follow || !transport.playing) && clock->isPlaying()) {
+        sequencer->stop();
+    }
+    schedule.clear();
+    sequencer->process(nFrames, schedule);
+}
+
+void PluginEngine::process(const Event* events, int count, const Transport& transport,
+                           float* left, float* right, uint32_t nFrames) {
+    ScopedDenormalGuard denormalGuard;
+
+    if (loaded.takeFresh()) {
+        settings = loaded.front();
+        settingsDirty = true;
+    }
+
+    // Loop grid lines from the transport before the sequencer advances it
+    LoopGrid loopGrid;
+    const bool loopSynced = clock->isPlaying() && settings.block.loopQuantize > 0;
+    if (loopSynced) {
+        loopGrid.position = clock->getGridPosition();
+        loopGrid.period = clock->getSamplesPerStep(
+            settings.block.loopQuantize > 1 ? Subdivision::WHOLE : Subdivision::QUARTER);
+    }
+    followTransport(transport, nFrames);
+
+    // LFOs and chaos once per block, before synthesis
+    for (int i = 0; i < 4; ++i) {
+        const SynthParamBlock::Lfo& lfo = settings.block.lfo[i];
+        synth->updateLFOParameters(i, lfo.period, lfo.syncMode, lfo.shape, lfo.morph, lfo.duty,
+                                   lfo.flip, lfo.resetOnNote, static_cast<float>(clock->getTempo()));
+    }
+    synth->processLFOs(sampleRate, nFrames);
+    synth->processChaos(nFrames);
+
+    // Split at every host event and sequencer note or automation event
+    auto dispatchNote = [this](const ScheduledEvent& event) {
+        if (event.type == ScheduledEvent::PARAM) {
+            if (const AutomationTarget* target = findAutomationTarget(event.note)) {
+                target->apply(settings.block, event.value);
+                settingsDirty = true;
+            }
+        } else if (event.type == ScheduledEvent::NOTE_ON) {
+            synth->noteOn(event.note, event.velocity);
+        } else {
+            synth->noteOff(event.note);
+        }
+    };
+    int next = 0;
+    const uint32_t slice = static_cast<uint32_t>(synthLeft.size());
+    for (uint32_t pos = 0; pos < nFrames;) {
+        while (next < count && events[next].frame <= pos) {
+            applyEvent(events[next++]);
+        }
+        schedule.dispatchThrough(pos, dispatchNote);
+        if (settingsDirty) {
+            applySettings();
+        }
+
+        uint32_t end = std::min(nFrames, pos + slice);
+        end = std::min(end, schedule.nextFrame());
+        if (next < count) {
+            end = std::min(end, events[next].frame);
+        }
+        const uint32_t frames = end - pos;
+        synth->process(synthLeft.data(), synthRight.data(), frames);
+        LoopGrid segmentGrid = loopGrid;
+        segmentGrid.position += pos;
+        loopManager->processBlock(synthLeft.data(), synthRight.data(), left + pos, right + pos, frames,
+                                  loopSynced ? &segmentGrid : nullptr);
+        pos = end;
+    }
+    // Events stamped past the block (a host bug) still land
+    while (next < count) {
+        applyEvent(events[next++]);
+    }
+    // The standalone's limiter, with no conversion or dither
+    output->process(left, right, nFrames, nullptr, 0);
+
+    published.back() = settings;
+    published.publish();
+}
+
+void PluginEngine::applyEvents(const Event* events, int count) {
+    for (int i = 0; i < count; ++i) {
+        if (events[i].type == Event::PARAM) {
+            applyEvent(events[i]);
+        }
+    }
+    if (!isActive()) {
+        mainView = settings;
+        return;
+    }
+    published.back() = settings;
+    published.publish();
+}
+
+double PluginEngine::getValue(uint32_t id) {
+    if (isActive()) {
+        if (published.takeFresh()) {
+            mainView = published.front();
+        }
+    } else {
+        mainView = settings;
+    }
+    if (id == kSequencer) {
+        return mainView.sequencer ? 1.0 : 0.0;
+    }
+    if (id >= kLoopRecPlay && id <= kLoopClear) {
+        return 0.0;
+    }
+    const Param* param = findParam(id);
+    return (param && param->get) ? param->get(mainView.block) : 0.0;
+}
+
+std::string PluginEngine::saveState() {
+    getValue(kSequencer);   // Brings mainView up to date
+    Settings copy = mainView;
+    std::ostringstream out;
+    out.precision(9);
+    out << kStateHeader << "\n" << (copy.sequencer ? 1 : 0) << "\n";
+    forEachParam(copy.block, [&out](auto& field) {
+        out << +field << "\n";
+    });
+    return out.str();
+}
+
+bool PluginEngine::loadState(const std::string& text) {
+    std::istringstream in(text);
+    std::string header;
+    int sequencerOn = 0;
+    if (!std::getline(in, header) || header != kStateHeader || !(in >> sequencerOn)) {
+        return false;
+    }
+    Settings next;
+    next.block = mainView.block;
+    next.sequencer = sequencerOn != 0;
+    bool complete = true;
+    forEachParam(next.block, [&](auto& field) {
+        double value = 0.0;
+        if (!(in >> value)) {
+            complete = false;
+            return;
+        }
+        field = static_cast<std::remove_reference_t<decltype(field)>>(value);
+    });
+    if (!complete) {
+        return false;
+    }
+
+    mainView = next;
+    if (isActive()) {
+        loaded.back() = next;
+        loaded.publish();
+    } else {
+        settings = next;
+        settingsDirty = true;
+    }
+    return true;
+}
+
+void PluginEngine::refillStorage() {
+    if (loopManager) {
+        loopManager->refillStorage();
+    }
+}
@@ -0,0 +1,135 @@
+#ifndef PLUGIN_ENGINE_H
+#define PLUGIN_ENGINE_H
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+#include "event_schedule.h"
+#include "param_snapshot.h"
+#include "triple_buffer.h"
+
+class Synth;
+class Clock;
+class Sequencer;
+class LoopManager;
+class OutputStage;
+
+// The synth as a plugin (wakefield.clap, built with -DWAKEFIELD_CLAP=ON):
+// Synth, LoopManager and Sequencer driven by a host instead of RtAudio,
+// RtMidi and the curses UI, none of which start. Host-agnostic; the CLAP
+// glue in clap_plugin.cpp only translates events and buffers.
+//
+// The host sets the block size and hands over its planar output buffers,
+// which are rendered into directly. Each block is split at every host
+// event and sequencer note so notes, parameter changes and loop buttons
+// take effect on their own frame. The engine owns its parameter block;
+// parameters are plain values (seconds, Hz, ...) with the ids the OSC and
+// MIDI CC mappings use. The sequencer follows the host transport while
+// the Sequencer parameter is on.
+//
+// Threads: construction, activate(), deactivate(), getValue(), state and
+// refillStorage() on the host's main thread; process() on its audio
+// thread; applyEvents() on whichever owns the engine (audio while active).
+class PluginEngine {
+public:
+    struct Param {
+        uint32_t id;
+        const char* name;
+        const char* module;
+        double min;
+        double max;
+        bool stepped;
+        double (*get)(const SynthParamBlock&);     // Null for the controls below
+        void (*set)(SynthParamBlock&, double);
+    };
+
+    // Controls outside the parameter block
+    enum ControlId : uint32_t {
+        kLoopRecPlay = 60,  // Loop buttons: a press on each rise through 0.5
+        kLoopOverdub = 61,
+        kLoopStop = 62,
+        kLoopClear = 63,
+        kSequencer = 70     // Sequencer follows the host transport
+    };
+
+    struct Event {
+        enum Type : uint8_t { NOTE_ON, NOTE_OFF, PARAM };
+        uint32_t frame;
+        Type type;
+        uint8_t note;
+        uint8_t velocity;   // 1-127
+        uint32_t param;
+        double value;
+    };
+
+    struct Transport {
+        bool valid = false;     // The host sent one
+        bool playing = false;
+        double tempo = 120.0;
+        double beat = 0.0;      // Song position at the block start
+    };
+
+    static int getParamCount();
+    static const Param& getParam(int index);
+    static const Param* findParam(uint32_t id);
+
+    PluginEngine();
+    ~PluginEngine();
+
+    // Build the engine for sampleRate and blocks of up to maxFrames
+    bool activate(double sampleRate, uint32_t maxFrames);
+    void deactivate();
+    bool isActive() const { return synth != nullptr; }
+
+    // events in frame order; left and right take nFrames
+    void process(const Event* events, int count, const Transport& transport,
+                 float* left, float* right, uint32_t nFrames);
+
+    // Parameter changes without audio (a host's flush)
+    void applyEvents(const Event* events, int count);
+
+    // Main thread: value as of the last processed block
+    double getValue(uint32_t id);
+
+    // Main thread: every parameter, as text
+    std::string saveState();
+    bool loadState(const std::string& text);
+
+    // Main thread, every ~50 ms while active: keep the loopers' free chunks
+    // topped up, as the UI loop does for the standalone synth
+    void refillStorage();
+
+    PluginEngine(const PluginEngine&) = delete;
+    PluginEngine& operator=(const PluginEngine&) = delete;
+
+private:
+    // The audio side's parameters and controls, published to the main thread
+    struct Settings {
+        SynthParamBlock block;
+        bool sequencer = false;
+    };
+
+    void applyEvent(const Event& event);
+    void applySettings();
+    void followTransport(const Transport& transport, uint32_t nFrames);
+
+    Settings settings;                  // Owned by the audio thread while active
+    bool settingsDirty = true;
+    float buttons[4] = {};
+    TripleBuffer<Settings> published;   // Audio -> main, once per block
+    TripleBuffer<Settings> loaded;      // Main -> audio, a state load while active
+    Settings mainView;                  // Main thread's copy of the newest published
+
+    float sampleRate = 48000.0f;
+    std::unique_ptr<Synth> synth;
+    std::unique_ptr<Clock> clock;
+    std::unique_ptr<Sequencer> sequencer;
+    std::unique_ptr<LoopManager> loopManager;
+    std::unique_ptr<OutputStage> output;   // Limiter only: the host takes float
+    EventSchedule schedule;             // Sequencer notes for the block
+    std::vector<float> synthLeft;       // Synth output ahead of the loopers
+    std::vector<float> synthRight;
+};
+
+#endif // PLUGIN_ENGINE_H
@@ -10,6 +10,7 @@
 #include <pwd.h>
 #include <algorithm>
 #include <cctype>
+#include <cstdlib>
 
 std::string PresetManager::getPresetDirectory() {
     const char* homeDir = getenv("HOME");
@@ -81,18 +82,117 @@ std::string PresetManager::trim(const std::string& str) {
     return str.substr(first, (last - first + 1));
 }
 
-bool PresetManager::parseBool(const std::string& str) {
-    std::string lower = str;
-    std::transform(lower.begin(), lower.end(), lower.begin(), ::tolower);
-    return (lower == "true" || lower == "1" || lower == "yes");
+namespace {
+
+// How a preset value is spelled in the file
+enum class PresetValueKind {
+    FLOAT,
+    INT,
+    BOOL,
+    WAVEFORM,       // SINE, SQUARE, ...
+    FILTER_TYPE,    // LOWPASS, HIGHPASS, ...
+    REVERB_TYPE     // GREYHOLE, PLATE, ...
+};
+
+struct PresetKey {
+    const char* section;
+    const char* key;
+    PresetBlock::Field field;
+    PresetValueKind kind;
+};
+
+const PresetKey kPresetKeys[] = {
+    {"waveform", "type", PresetBlock::WAVEFORM, PresetValueKind::WAVEFORM},
+    {"envelope", "attack", PresetBlock::ATTACK, PresetValueKind::FLOAT},
+    {"envelope", "decay", PresetBlock::DECAY, PresetValueKind::FLOAT},
+    {"envelope", "sustain", PresetBlock::SUSTAIN, PresetValueKind::FLOAT},
+    {"envelope", "release", PresetBlock::RELEASE, PresetValueKind::FLOAT},
+    {"master", "volume", PresetBlock::MASTER_VOLUME, PresetValueKind::FLOAT},
+    {"master", "fm_oversample", PresetBlock::FM_OVERSAMPLE, PresetValueKind::INT},
+    {"master", "oversample_quality", PresetBlock::OVERSAMPLE_QUALITY, PresetValueKind::INT},
+    {"master", "reverb_rate", PresetBlock::REVERB_RATE, PresetValueKind::INT},
+    {"filter", "enabled", PresetBlock::FILTER_ENABLED, PresetValueKind::BOOL},
+    {"filter", "type", PresetBlock::FILTER_TYPE, PresetValueKind::FILTER_TYPE},
+    {"filter", "cutoff", PresetBlock::FILTER_CUTOFF, PresetValueKind::FLOAT},
+    {"filter", "gain", PresetBlock::FILTER_GAIN, PresetValueKind::FLOAT},
+    {"filter", "per_voice", PresetBlock::FILTER_PER_VOICE, PresetValueKind::BOOL},
+    {"filter", "env_amount", PresetBlock::FILTER_ENV_AMOUNT, PresetValueKind::FLOAT},
+    {"filter", "oversample", PresetBlock::FILTER_OVERSAMPLE, PresetValueKind::INT},
+    {"reverb", "enabled", PresetBlock::REVERB_ENABLED, PresetValueKind::BOOL},
+    {"reverb", "type", PresetBlock::REVERB_TYPE, PresetValueKind::REVERB_TYPE},
+    {"reverb", "size", PresetBlock::REVERB_SIZE, PresetValueKind::FLOAT},
+    {"reverb", "damping", PresetBlock::REVERB_DAMPING, PresetValueKind::FLOAT},
+    {"reverb", "mix", PresetBlock::REVERB_MIX, PresetValueKind::FLOAT},
+    {"reverb", "decay", PresetBlock::REVERB_DECAY, PresetValueKind::FLOAT},
+    {"reverb", "diffusion", PresetBlock::REVERB_DIFFUSION, PresetValueKind::FLOAT},
+    {"reverb", "modDepth", PresetBlock::REVERB_MOD_DEPTH, PresetValueKind::FLOAT},
+    {"reverb", "modFreq", PresetBlock::REVERB_MOD_FREQ, PresetValueKind::FLOAT},
+    {"looper", "current_loop", PresetBlock::CURRENT_LOOP, PresetValueKind::INT},
+    {"looper", "overdub_mix", PresetBlock::OVERDUB_MIX, PresetValueKind::FLOAT},
+    {"looper", "quantize", PresetBlock::LOOP_QUANTIZE, PresetValueKind::INT},
+    {"looper", "rec_play_cc", PresetBlock::LOOP_REC_PLAY_CC, PresetValueKind::INT},
+    {"looper", "overdub_cc", PresetBlock::LOOP_OVERDUB_CC, PresetValueKind::INT},
+    {"looper", "stop_cc", PresetBlock::LOOP_STOP_CC, PresetValueKind::INT},
+    {"looper", "clear_cc", PresetBlock::LOOP_CLEAR_CC, PresetValueKind::INT},
+};
+
+// Index of name in names, or -1
+int findName(const char* const* names, int count, const std::string& name) {
+    for (int i = 0; i < count; ++i) {
+        if (name == names[i]) {
+            return i;
+        }
+    }
+    return -1;
 }
 
-bool PresetManager::parsePresetFile(const std::string& filepath, SynthParameters* params) {
+const char* const kWaveformNames[] = {"SINE", "SQUARE", "SAWTOOTH", "TRIANGLE"};
+const char* const kFilterTypeNames[] = {"LOWPASS", "HIGHPASS", "HIGHSHELF", "LOWSHELF"};
+const char* const kReverbTypeNames[] = {"GREYHOLE", "PLATE", "ROOM", "HALL", "SPRING", "LATEDIFF", "CONVOLUTION"};
+
+// The file's value as stored in a PresetBlock; false if it doesn't parse
+bool parsePresetValue(PresetValueKind kind, const std::string& value, float& out) {
+    int index = -1;
+    switch (kind) {
+        case PresetValueKind::FLOAT: {
+            char* end = nullptr;
+            out = std::strtof(value.c_str(), &end);
+            return end != value.c_str();
+        }
+        case PresetValueKind::INT: {
+            char* end = nullptr;
+            out = static_cast<float>(std::strtol(value.c_str(), &end, 10));
+            return end != value.c_str();
+        }
+        case PresetValueKind::BOOL: {
+            std::string lower = value;
+            std::transform(lower.begin(), lower.end(), lower.begin(), ::tolower);
+            out = (lower == "true" || lower == "1" || lower == "yes") ? 1.0f : 0.0f;
+            return true;
+        }
+        case PresetValueKind::WAVEFORM:
+            index = findName(kWaveformNames, 4, value);
+            break;
+        case PresetValueKind::FILTER_TYPE:
+            index = findName(kFilterTypeNames, 4, value);
+            break;
+        case PresetValueKind::REVERB_TYPE:
+            index = findName(kReverbTypeNames, 7, value);
+            break;
+    }
+    out = static_cast<float>(index);
+    return index >= 0;
+}
+
+}  // namespace
+
+bool PresetManager::readPresetBlock(const std::string& filepath, PresetBlock& block) {
     std::ifstream file(filepath);
     if (!file.is_open()) {
         return false;
     }
-    
+
+    block = PresetBlock();
     std::string line;
     std::string currentSection;
     
@@ -118,78 +218,116 @@ bool PresetManager::parsePresetFile(const std::string& filepath, SynthParameters
         
         std::string key = trim(line.substr(0, equalPos));
         std::string value = trim(line.substr(equalPos + 1));
-        
-        // Apply values based on section
-        if (currentSection == "waveform") {
-            if (key == "type") {
-                if (value == "SINE") params->waveform = static_cast<int>(Waveform::SINE);
-                else if (value == "SQUARE") params->waveform = static_cast<int>(Waveform::SQUARE);
-                else if (value == "SAWTOOTH") params->waveform = static_cast<int>(Waveform::SAWTOOTH);
-                else if (value == "TRIANGLE") params->waveform = static_cast<int>(Waveform::TRIANGLE);
-            }
-        } else if (currentSection == "envelope") {
-            if (key == "attack") {
-                float mapped = std::stof(value);
-                params->attack = mapped;
-                params->setEnvAttack(0, mapped);
-            }
-            else if (key == "decay") {
-                float mapped = std::stof(value);
-                params->decay = mapped;
-                params->setEnvDecay(0, mapped);
-            }
-            else if (key == "sustain") {
-                float mapped = std::stof(value);
-                params->sustain = mapped;
-                params->setEnvSustain(0, mapped);
-            }
-            else if (key == "release") {
-                float mapped = std::stof(value);
-                params->release = mapped;
-                params->setEnvRelease(0, mapped);
-            }
-        } else if (currentSection == "master") {
-            if (key == "volume") params->masterVolume = std::stof(value);
-        } else if (currentSection == "filter") {
-            if (key == "enabled") params->filterEnabled = parseBool(value);
-            else if (key == "type") {
-                if (value == "LOWPASS") params->filterType = 0;
-                else if (value == "HIGHPASS") params->filterType = 1;
-                else if (value == "HIGHSHELF") params->filterType = 2;
-                else if (value == "LOWSHELF") params->filterType = 3;
-            }
-            else if (key == "cutoff") params->filterCutoff = std::stof(value);
-            else if (key == "gain") params->filterGain = std::stof(value);
-        } else if (currentSection == "reverb") {
-            if (key == "enabled") params->reverbEnabled = parseBool(value);
-            else if (key == "type") {
-                if (value == "GREYHOLE") params->reverbType = static_cast<int>(ReverbType::GREYHOLE);
-                else if (value == "PLATE") params->reverbType = static_cast<int>(ReverbType::PLATE);
-                else if (value == "ROOM") params->reverbType = static_cast<int>(ReverbType::ROOM);
-                else if (value == "HALL") params->reverbType = static_cast<int>(ReverbType::HALL);
-                else if (value == "SPRING") params->reverbType = static_cast<int>(ReverbType::SPRING);
+
+        // Unknown keys and unparsable values leave the parameter as it is
+        for (const PresetKey& presetKey : kPresetKeys) {
+            if (currentSection == presetKey.section && key == presetKey.key) {
+                float parsed = 0.0f;
+                if (parsePresetValue(presetKey.kind, value, parsed)) {
+                    block.set(presetKey.field, parsed);
+                }
+                break;
             }
-            else if (key == "size") params->reverbSize = std::stof(value);
-            else if (key == "damping") params->reverbDamping = std::stof(value);
-            else if (key == "mix") params->reverbMix = std::stof(value);
-            else if (key == "decay") params->reverbDecay = std::stof(value);
-            else if (key == "diffusion") params->reverbDiffusion = std::stof(value);
-            else if (key == "modDepth") params->reverbModDepth = std::stof(value);
-            else if (key == "modFreq") params->reverbModFreq = std::stof(value);
-        } else if (currentSection == "looper") {
-            if (key == "current_loop") params->currentLoop = std::stoi(value);
-            else if (key == "overdub_mix") params->overdubMix = std::stof(value);
-            else if (key == "rec_play_cc") params->loopRecPlayCC = std::stoi(value);
-            else if (key == "overdub_cc") params->loopOverdubCC = std::stoi(value);
-            else if (key == "stop_cc") params->loopStopCC = std::stoi(value);
-            else if (key == "clear_cc") params->loopClearCC = std::stoi(value);
         }
     }
     
-    file.close();
     return true;
 }
 
+void PresetManager::applyPresetBlock(const PresetBlock& block, SynthParameters* params) {
+    for (int f = 0; f < PresetBlock::FIELD_COUNT; ++f) {
+        const PresetBlock::Field field = static_cast<PresetBlock::Field>(f);
+        if (!block.has(field)) {
+            continue;
+        }
+        const float value = block.values[f];
+        const int number = static_cast<int>(value);
+        const bool flag = value != 0.0f;
+        switch (field) {
+            case PresetBlock::WAVEFORM: params->waveform = number; break;
+            case PresetBlock::ATTACK: params->attack = value; params->setEnvAttack(0, value); break;
+            case PresetBlock::DECAY: params->decay = value; params->setEnvDecay(0, value); break;
+            case PresetBlock::SUSTAIN: params->sustain = value; params->setEnvSustain(0, value); break;
+            case PresetBlock::RELEASE: params->release = value; params->setEnvRelease(0, value); break;
+            case PresetBlock::MASTER_VOLUME: params->masterVolume = value; break;
+            case PresetBlock::FM_OVERSAMPLE: params->fmOversample = std::clamp(number, 0, 2); break;
+            case PresetBlock::OVERSAMPLE_QUALITY: params->oversampleQuality = std::clamp(number, 0, 2); break;
+            case PresetBlock::REVERB_RATE: params->reverbRate = std::clamp(number, 0, 1); break;
+            case PresetBlock::FILTER_ENABLED: params->filterEnabled = flag; break;
+            case PresetBlock::FILTER_TYPE: params->filterType = number; break;
+            case PresetBlock::FILTER_CUTOFF: params->filterCutoff = value; break;
+            case PresetBlock::FILTER_GAIN: params->filterGain = value; break;
+            case PresetBlock::FILTER_PER_VOICE: params->filterPerVoice = flag; break;
+            case PresetBlock::FILTER_ENV_AMOUNT: params->filterEnvAmount = value; break;
+            case PresetBlock::FILTER_OVERSAMPLE: params->filterOversample = std::clamp(number, 0, 2); break;
+            case PresetBlock::REVERB_ENABLED: params->reverbEnabled = flag; break;
+            case PresetBlock::REVERB_TYPE: params->reverbType = number; break;
+            case PresetBlock::REVERB_SIZE: params->reverbSize = value; break;
+            case PresetBlock::REVERB_DAMPING: params->reverbDamping = value; break;
+            case PresetBlock::REVERB_MIX: params->reverbMix = value; break;
+            case PresetBlock::REVERB_DECAY: params->reverbDecay = value; break;
+            case PresetBlock::REVERB_DIFFUSION: params->reverbDiffusion = value; break;
+            case PresetBlock::REVERB_MOD_DEPTH: params->reverbModDepth = value; break;
+            case PresetBlock::REVERB_MOD_FREQ: params->reverbModFreq = value; break;
+            case PresetBlock::CURRENT_LOOP: params->currentLoop = number; break;
+            case PresetBlock::OVERDUB_MIX: params->overdubMix = value; break;
+            case PresetBlock::LOOP_QUANTIZE: params->loopQuantize = number; break;
+            case PresetBlock::LOOP_REC_PLAY_CC: params->loopRecPlayCC = number; break;
+            case PresetBlock::LOOP_OVERDUB_CC: params->loopOverdubCC = number; break;
+            case PresetBlock::LOOP_STOP_CC: params->loopStopCC = number; break;
+            case PresetBlock::LOOP_CLEAR_CC: params->loopClearCC = number; break;
+            case PresetBlock::FIELD_COUNT: break;
+        }
+    }
+    params->ccMappingsChanged();
+
+    // The serial goes last: a block captured with it holds the whole preset
+    params->presetSerial.fetch_add(1, std::memory_order_release);
+    params->publishSnapshot();
+}
+
+void PresetManager::applyToBlock(const PresetBlock& preset, SynthParamBlock& block) {
+    for (int f = 0; f < PresetBlock::FIELD_COUNT; ++f) {
+        const PresetBlock::Field field = static_cast<PresetBlock::Field>(f);
+        if (!preset.has(field)) {
+            continue;
+        }
+        const float value = preset.values[f];
+        const int number = static_cast<int>(value);
+        const bool flag = value != 0.0f;
+        switch (field) {
+            case PresetBlock::ATTACK: block.attack = value; break;
+            case PresetBlock::DECAY: block.decay = value; break;
+            case PresetBlock::SUSTAIN: block.sustain = value; break;
+            case PresetBlock::RELEASE: block.release = value; break;
+            case PresetBlock::MASTER_VOLUME: block.masterVolume = value; break;
+            case PresetBlock::FM_OVERSAMPLE: block.fmOversample = std::clamp(number, 0, 2); break;
+            case PresetBlock::OVERSAMPLE_QUALITY: block.oversampleQuality = std::clamp(number, 0, 2); break;
+            case PresetBlock::REVERB_RATE: block.reverbRate = std::clamp(number, 0, 1); break;
+            case PresetBlock::FILTER_ENABLED: block.filterEnabled = flag; break;
+            case PresetBlock::FILTER_TYPE: block.filterType = number; break;
+            case PresetBlock::FILTER_CUTOFF: block.filterCutoff = value; break;
+            case PresetBlock::FILTER_GAIN: block.filterGain = value; break;
+            case PresetBlock::FILTER_PER_VOICE: block.filterPerVoice = flag; break;
+            case PresetBlock::FILTER_ENV_AMOUNT: block.filterEnvAmount = value; break;
+            case PresetBlock::FILTER_OVERSAMPLE: block.filterOversample = std::clamp(number, 0, 2); break;
+            case PresetBlock::REVERB_ENABLED: block.reverbEnabled = flag; break;
+            case PresetBlock::REVERB_TYPE: block.reverbType = number; break;
+            case PresetBlock::REVERB_SIZE: block.reverbSize = value; break;
+            case PresetBlock::REVERB_DAMPING: block.reverbDamping = value; break;
+            case PresetBlock::REVERB_MIX: block.reverbMix = value; break;
+            case PresetBlock::REVERB_DECAY: block.reverbDecay = value; break;
+            case PresetBlock::REVERB_DIFFUSION: block.reverbDiffusion = value; break;
+            case PresetBlock::REVERB_MOD_DEPTH: block.reverbModDepth = value; break;
+            case PresetBlock::REVERB_MOD_FREQ: block.reverbModFreq = value; break;
+            case PresetBlock::CURRENT_LOOP: block.currentLoop = number; break;
+            case PresetBlock::OVERDUB_MIX: block.overdubMix = value; break;
+            case PresetBlock::LOOP_QUANTIZE: block.loopQuantize = number; break;
+            default: break;
+        }
+    }
+}
+
 bool PresetManager::writePresetFile(const std::string& filepath, SynthParameters* params) {
     std::ofstream file(filepath);
     if (!file.is_open()) {
@@ -216,6 +354,9 @@ bool PresetManager::writePresetFile(const std::string& filepath, SynthParameters
     // Master section
     file << "[master]\n";
     file << "volume=" << params->masterVolume.load() << "\n";
+    file << "fm_oversample=" << params->fmOversample.load() << "\n";
+    file << "oversample_quality=" << params->oversampleQuality.load() << "\n";
+    file << "reverb_rate=" << params->reverbRate.load() << "\n";
     file << "\n";
     
     // Filter section
@@ -228,6 +369,9 @@ bool PresetManager::writePresetFile(const std::string& filepath, SynthParameters
     else if (filterType == 3) file << "type=LOWSHELF\n";
     file << "cutoff=" << params->filterCutoff.load() << "\n";
     file << "gain=" << params->filterGain.load() << "\n";
+    file << "per_voice=" << (params->filterPerVoice.load() ? "true" : "false") << "\n";
+    file << "env_amount=" << params->filterEnvAmount.load() << "\n";
+    file << "oversample=" << params->filterOversample.load() << "\n";
     file << "\n";
     
     // Reverb section
@@ -239,6 +383,8 @@ bool PresetManager::writePresetFile(const std::string& filepath, SynthParameters
     else if (reverbType == static_cast<int>(ReverbType::ROOM)) file << "type=ROOM\n";
     else if (reverbType == static_cast<int>(ReverbType::HALL)) file << "type=HALL\n";
     else if (reverbType == static_cast<int>(ReverbType::SPRING)) file << "type=SPRING\n";
+    else if (reverbType == static_cast<int>(ReverbType::LATEDIFF)) file << "type=LATEDIFF\n";
+    else if (reverbType == static_cast<int>(ReverbType::CONVOLUTION)) file << "type=CONVOLUTION\n";
     file << "size=" << params->reverbSize.load() << "\n";
     file << "damping=" << params->reverbDamping.load() << "\n";
     file << "mix=" << params->reverbMix.load() << "\n";
@@ -252,6 +398,7 @@ bool PresetManager::writePresetFile(const std::string& filepath, SynthParameters
     file << "[looper]\n";
     file << "current_loop=" << params->currentLoop.load() << "\n";
     file << "overdub_mix=" << params->overdubMix.load() << "\n";
+    file << "quantize=" << params->loopQuantize.load() << "\n";
     file << "rec_play_cc=" << params->loopRecPlayCC.load() << "\n";
     file << "overdub_cc=" << params->loopOverdubCC.load() << "\n";
     file << "stop_cc=" << params->loopStopCC.load() << "\n";
@@ -268,6 +415,10 @@ bool PresetManager::savePreset(const std::string& name, SynthParameters* params)
 }
 
 bool PresetManager::loadPreset(const std::string& name, SynthParameters* params) {
-    std::string filepath = getPresetPath(name);
-    return parsePresetFile(filepath, params);
+    PresetBlock block;
+    if (!readPresetBlock(getPresetPath(name), block)) {
+        return false;
+    }
+    applyPresetBlock(block, params);
+    return true;
 }
@@ -1,12 +1,40 @@
 #ifndef PRESET_H
 #define PRESET_H
 
+#include <cstdint>
 #include <string>
 #include <vector>
-#include "ui.h"
 
 // Forward declaration
 struct SynthParameters;
+struct SynthParamBlock;
+
+// A preset file parsed into plain values, so applying it is a run of stores
+// instead of text parsing. Only the fields the file set are applied; the
+// rest of the parameters keep their current values
+struct PresetBlock {
+    enum Field {
+        WAVEFORM,
+        ATTACK, DECAY, SUSTAIN, RELEASE,
+        MASTER_VOLUME, FM_OVERSAMPLE, OVERSAMPLE_QUALITY, REVERB_RATE,
+        FILTER_ENABLED, FILTER_TYPE, FILTER_CUTOFF, FILTER_GAIN, FILTER_PER_VOICE,
+        FILTER_ENV_AMOUNT, FILTER_OVERSAMPLE,
+        REVERB_ENABLED, REVERB_TYPE, REVERB_SIZE, REVERB_DAMPING, REVERB_MIX,
+        REVERB_DECAY, REVERB_DIFFUSION, REVERB_MOD_DEPTH, REVERB_MOD_FREQ,
+        CURRENT_LOOP, OVERDUB_MIX, LOOP_QUANTIZE,
+        LOOP_REC_PLAY_CC, LOOP_OVERDUB_CC, LOOP_STOP_CC, LOOP_CLEAR_CC,
+        FIELD_COUNT
+    };
+
+    uint64_t present = 0;           // Bit per Field the file set
+    float values[FIELD_COUNT] = {}; // Enums, flags and integers stored exactly
+
+    void set(Field field, float value) {
+        values[field] = value;
+        present |= uint64_t(1) << field;
+    }
+    bool has(Field field) const { return (present >> field) & 1; }
+};
 
 class PresetManager {
 public:
@@ -24,22 +52,27 @@ public:
     
     // Load preset file into parameters
     static bool loadPreset(const std::string& name, SynthParameters* params);
+
+    // Parse a preset file; false if it can't be read
+    static bool readPresetBlock(const std::string& filepath, PresetBlock& block);
+
+    // Store a parsed preset into params and publish it to the audio thread
+    // as one snapshot, marked as a preset switch so it fades over
+    static void applyPresetBlock(const PresetBlock& block, SynthParameters* params);
+
+    // Store a parsed preset's audio parameters into a snapshot block (the
+    // waveform and looper CC assignments have no field there)
+    static void applyToBlock(const PresetBlock& preset, SynthParamBlock& block);
     
     // Get full path for a preset name
     static std::string getPresetPath(const std::string& name);
     
 private:
-    // Parse INI-style config file
-    static bool parsePresetFile(const std::string& filepath, SynthParameters* params);
-    
     // Write INI-style config file
     static bool writePresetFile(const std::string& filepath, SynthParameters* params);
     
     // Helper to trim whitespace
     static std::string trim(const std::string& str);
-    
-    // Helper to parse boolean
-    static bool parseBool(const std::string& str);
 };
 
 #endif // PRESET_H
@@ -0,0 +1,105 @@
+#include "preset_library.h"
+#include <sys/stat.h>
+
+PresetLibrary::~PresetLibrary() {
+    stop();
+}
+
+void PresetLibrary::refresh() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        refreshRequested = true;
+        stopping = false;
+        if (!thread.joinable()) {
+            thread = std::thread(&PresetLibrary::worker, this);
+        }
+    }
+    wake.notify_one();
+}
+
+bool PresetLibrary::pollChanged() {
+    std::lock_guard<std::mutex> lock(mutex);
+    bool result = changed;
+    changed = false;
+    return result;
+}
+
+std::vector<std::string> PresetLibrary::names() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    std::vector<std::string> result;
+    result.reserve(presets.size());
+    for (const auto& preset : presets) {
+        result.push_back(preset.first);
+    }
+    return result;
+}
+
+bool PresetLibrary::find(const std::string& name, PresetBlock& block) const {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = presets.find(name);
+    if (it == presets.end()) {
+        return false;
+    }
+    block = it->second.block;
+    return true;
+}
+
+void PresetLibrary::stop() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    wake.notify_all();
+    if (thread.joinable()) {
+        thread.join();
+    }
+}
+
+void PresetLibrary::worker() {
+    std::unique_lock<std::mutex> lock(mutex);
+    while (true) {
+        wake.wait(lock, [this] { return stopping || refreshRequested; });
+        if (stopping) {
+            return;
+        }
+        refreshRequested = false;
+        lock.unlock();
+        scan();
+        lock.lock();
+    }
+}
+
+void PresetLibrary::scan() {
+    std::map<std::string, Entry> previous;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        previous = presets;
+    }
+
+    // Unchanged files keep their parsed block
+    std::map<std::string, Entry> scanned;
+    bool different = false;
+    for (const std::string& name : PresetManager::listPresets()) {
+        struct stat st;
+        const std::string path = PresetManager::getPresetPath(name);
+        if (stat(path.c_str(), &st) != 0) {
+            continue;
+        }
+        const int64_t mtime = static_cast<int64_t>(st.st_mtim.tv_sec) * 1000000000 + st.st_mtim.tv_nsec;
+        auto known = previous.find(name);
+        if (known != previous.end() && known->second.mtime == mtime) {
+            scanned.emplace(name, known->second);
+            continue;
+        }
+        Entry entry{mtime, PresetBlock()};
+        if (PresetManager::readPresetBlock(path, entry.block)) {
+            scanned.emplace(name, entry);
+            different = true;
+        }
+    }
+    different = different || scanned.size() != previous.size();
+
+    std::lock_guard<std::mutex> lock(mutex);
+    presets = std::move(scanned);
+    changed = changed || different;
+}
@@ -0,0 +1,59 @@
+#ifndef PRESET_LIBRARY_H
+#define PRESET_LIBRARY_H
+
+#include <condition_variable>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "preset.h"
+
+// Every preset in the preset directory, parsed into a PresetBlock on a
+// background thread (started with the first refresh), so listing and
+// switching presets never read or parse files on the UI thread. A refresh
+// re-parses only the files whose mtime changed.
+class PresetLibrary {
+public:
+    PresetLibrary() = default;
+    ~PresetLibrary();
+
+    // Rescan the preset directory
+    void refresh();
+
+    // True once per finished scan that changed the set of presets or any
+    // preset's contents
+    bool pollChanged();
+
+    // Names of the indexed presets, sorted
+    std::vector<std::string> names() const;
+
+    // Copy out a parsed preset; false if it isn't indexed (yet)
+    bool find(const std::string& name, PresetBlock& block) const;
+
+    // Stop the thread
+    void stop();
+
+    PresetLibrary(const PresetLibrary&) = delete;
+    PresetLibrary& operator=(const PresetLibrary&) = delete;
+
+private:
+    struct Entry {
+        int64_t mtime;              // Nanoseconds since the epoch
+        PresetBlock block;
+    };
+
+    void worker();
+    void scan();
+
+    mutable std::mutex mutex;       // Guards presets down to stopping
+    std::condition_variable wake;
+    std::map<std::string, Entry> presets;
+    bool refreshRequested = false;
+    bool changed = false;
+    bool stopping = false;
+    std::thread thread;
+};
+
+#endif // PRESET_LIBRARY_H
@@ -0,0 +1,321 @@
+#include "profile.h"
+#include <cstdlib>
+#include <ctime>
+#include <pwd.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace profile {
+
+const char* stageName(int stage) {
+    static const char* const kVoiceNames[kMaxVoices] = {
+        "Voice 1", "Voice 2", "Voice 3", "Voice 4",
+        "Voice 5", "Voice 6", "Voice 7", "Voice 8"
+    };
+    if (stage >= VOICE_RENDER && stage < VOICE_RENDER + kMaxVoices) {
+        return kVoiceNames[stage - VOICE_RENDER];
+    }
+    switch (stage) {
+        case PARAM_SMOOTHING: return "Param smoothing";
+        case MOD_MATRIX: return "Mod matrix";
+        case FILTER: return "Filter";
+        case REVERB: return "Reverb";
+        case LOOPER: return "Looper";
+        case WAVEFORM_WRITE: return "UI waveform write";
+        case AUDIO_CALLBACK: return "Audio callback";
+        case UI_UPDATE: return "UI update";
+        case UI_DRAW: return "UI draw";
+        case SAMPLE_LOAD: return "Sample load";
+        case SAMPLE_STREAM: return "Sample stream";
+        case METRICS_SCRAPE: return "Metrics scrape";
+        case METRICS_STATSD: return "Metrics statsd";
+    }
+    return "?";
+}
+
+std::string defaultTracePath() {
+    const char* homeDir = getenv("HOME");
+    if (!homeDir) {
+        struct passwd* pw = getpwuid(getuid());
+        homeDir = pw->pw_dir;
+    }
+    std::string directory = std::string(homeDir) + "/.config";
+    mkdir(directory.c_str(), 0755);
+    directory += "/wakefield";
+    mkdir(directory.c_str(), 0755);
+    directory += "/traces";
+    mkdir(directory.c_str(), 0755);
+
+    char name[64];
+    const std::time_t now = std::time(nullptr);
+    std::tm local;
+    localtime_r(&now, &local);
+    std::strftime(name, sizeof(name), "/wakefield-trace-%Y%m%d-%H%M%S.json", &local);
+    return directory + name;
+}
+
+} // namespace profile
+
+#ifdef WAKEFIELD_PROFILE
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace profile {
+
+namespace {
+
+// One writer (the audio thread), so counters are bumped with a relaxed load
+// and store rather than a locked read-modify-write
+struct alignas(64) StageHistogram {
+    std::atomic<uint64_t> count{0};
+    std::atomic<uint64_t> totalTicks{0};
+    std::atomic<uint32_t> buckets[kBuckets] = {};
+};
+
+StageHistogram histograms[STAGE_COUNT];
+
+inline void bump(std::atomic<uint64_t>& counter, uint64_t amount) {
+    counter.store(counter.load(std::memory_order_relaxed) + amount, std::memory_order_relaxed);
+}
+
+constexpr int kTraceThreads = 16;
+constexpr uint64_t kTraceEvents = 1 << 14;     // A few seconds of a busy audio thread
+
+// Fields are relaxed atomics so a dump can copy them while the owner
+// writes; the head's release store publishes a finished event
+struct TraceEvent {
+    std::atomic<uint64_t> begin{0};
+    std::atomic<uint64_t> end{0};
+    std::atomic<int> stage{0};
+};
+
+// Single writer (the owning thread)
+struct TraceBuffer {
+    alignas(64) std::atomic<uint64_t> head{0};  // Events ever written
+    TraceEvent events[kTraceEvents];
+};
+
+struct TraceSlot {
+    char name[32] = {};
+    bool owned = false;
+    std::unique_ptr<TraceBuffer> buffer;
+};
+
+// Guards the slot table: registration, thread exit and dumps. Never taken
+// by trace() itself.
+std::mutex traceMutex;
+TraceSlot traceSlots[kTraceThreads];
+int traceSlotCount = 0;
+
+std::atomic<bool> tracingOn{false};
+std::atomic<uint64_t> tracingSince{0};          // Dumps skip events that began earlier
+
+// trace() reads the plain pointer; the registration's destructor hands the
+// slot back when the thread exits
+thread_local TraceBuffer* ownBuffer = nullptr;
+
+struct ThreadRegistration {
+    int slot = -1;
+    ~ThreadRegistration() {
+        if (slot >= 0) {
+            std::lock_guard<std::mutex> lock(traceMutex);
+            traceSlots[slot].owned = false;
+        }
+    }
+};
+
+thread_local ThreadRegistration registration;
+
+struct CopiedEvent {
+    uint64_t begin;
+    uint64_t end;
+    int stage;
+    int thread;
+};
+
+} // namespace
+
+uint64_t steadyNowNs() {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+void record(int stage, uint64_t ticks) {
+    if (stage < 0 || stage >= STAGE_COUNT) {
+        return;
+    }
+    StageHistogram& h = histograms[stage];
+    int bucket = ticks > 0 ? 63 - __builtin_clzll(ticks) : 0;
+    if (bucket >= kBuckets) {
+        bucket = kBuckets - 1;
+    }
+    std::atomic<uint32_t>& b = h.buckets[bucket];
+    b.store(b.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    bump(h.totalTicks, ticks);
+    bump(h.count, 1);
+}
+
+void read(int stage, StageSnapshot& out) {
+    out = StageSnapshot();
+    if (stage < 0 || stage >= STAGE_COUNT) {
+        return;
+    }
+    const StageHistogram& h = histograms[stage];
+    out.count = h.count.load(std::memory_order_relaxed);
+    out.totalTicks = h.totalTicks.load(std::memory_order_relaxed);
+    for (int b = 0; b < kBuckets; ++b) {
+        out.buckets[b] = h.buckets[b].load(std::memory_order_relaxed);
+    }
+}
+
+double ticksPerMicrosecond() {
+    static const double rate = [] {
+#if defined(__aarch64__)
+        uint64_t frequency;
+        asm volatile("mrs %0, cntfrq_el0" : "=r"(frequency));
+        return static_cast<double>(frequency) / 1e6;
+#elif defined(__x86_64__) || defined(__i386__)
+        // Measure the TSC against steady_clock over a short sleep
+        uint64_t ns0 = steadyNowNs();
+        uint64_t t0 = now();
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        uint64_t ns1 = steadyNowNs();
+        uint64_t t1 = now();
+        return static_cast<double>(t1 - t0) * 1e3 / static_cast<double>(ns1 - ns0);
+#else
+        return 1e3;  // steady_clock ticks are nanoseconds
+#endif
+    }();
+    return rate;
+}
+
+void registerThread(const char* name) {
+    if (ownBuffer) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(traceMutex);
+    int slot = -1;
+    for (int i = 0; i < traceSlotCount; ++i) {
+        if (!traceSlots[i].owned && std::strncmp(traceSlots[i].name, name, sizeof(traceSlots[i].name) - 1) == 0) {
+            slot = i;
+            break;
+        }
+    }
+    if (slot < 0) {
+        if (traceSlotCount == kTraceThreads) {
+            return;
+        }
+        slot = traceSlotCount++;
+        std::strncpy(traceSlots[slot].name, name, sizeof(traceSlots[slot].name) - 1);
+        traceSlots[slot].buffer.reset(new TraceBuffer());
+    }
+    traceSlots[slot].owned = true;
+    registration.slot = slot;
+    ownBuffer = traceSlots[slot].buffer.get();
+}
+
+void setTracing(bool on) {
+    if (on && !tracingOn.load(std::memory_order_relaxed)) {
+        tracingSince.store(now(), std::memory_order_relaxed);
+    }
+    tracingOn.store(on, std::memory_order_relaxed);
+}
+
+bool tracing() {
+    return tracingOn.load(std::memory_order_relaxed);
+}
+
+void trace(int stage, uint64_t beginTicks, uint64_t endTicks) {
+    TraceBuffer* buffer = ownBuffer;
+    if (!buffer || !tracingOn.load(std::memory_order_relaxed)) {
+        return;
+    }
+    const uint64_t head = buffer->head.load(std::memory_order_relaxed);
+    TraceEvent& event = buffer->events[head & (kTraceEvents - 1)];
+    event.begin.store(beginTicks, std::memory_order_relaxed);
+    event.end.store(endTicks, std::memory_order_relaxed);
+    event.stage.store(stage, std::memory_order_relaxed);
+    buffer->head.store(head + 1, std::memory_order_release);
+}
+
+bool writeChromeTrace(const std::string& path, size_t& eventCount, std::string& error) {
+    eventCount = 0;
+    const double ticksPerUs = ticksPerMicrosecond();
+    const uint64_t since = tracingSince.load(std::memory_order_relaxed);
+
+    std::vector<CopiedEvent> events;
+    std::vector<std::string> names;
+    {
+        std::lock_guard<std::mutex> lock(traceMutex);
+        for (int t = 0; t < traceSlotCount; ++t) {
+            names.emplace_back(traceSlots[t].name);
+            const TraceBuffer& buffer = *traceSlots[t].buffer;
+            const uint64_t head = buffer.head.load(std::memory_order_acquire);
+            const uint64_t first = head > kTraceEvents ? head - kTraceEvents : 0;
+            const size_t start = events.size();
+            for (uint64_t i = first; i < head; ++i) {
+                const TraceEvent& event = buffer.events[i & (kTraceEvents - 1)];
+                events.push_back({event.begin.load(std::memory_order_relaxed),
+                                  event.end.load(std::memory_order_relaxed),
+                                  event.stage.load(std::memory_order_relaxed), t});
+            }
+            // The owner may have lapped the copy: anything at or below the
+            // slot it is writing now could be torn
+            std::atomic_thread_fence(std::memory_order_acquire);
+            const uint64_t after = buffer.head.load(std::memory_order_relaxed);
+            const uint64_t valid = after >= kTraceEvents ? after - kTraceEvents + 1 : 0;
+            if (valid > first) {
+                const size_t drop = static_cast<size_t>(std::min(valid, head) - first);
+                events.erase(events.begin() + start, events.begin() + start + drop);
+            }
+        }
+    }
+    events.erase(std::remove_if(events.begin(), events.end(),
+                                [since](const CopiedEvent& e) { return e.begin < since; }),
+                 events.end());
+    std::sort(events.begin(), events.end(),
+              [](const CopiedEvent& a, const CopiedEvent& b) { return a.begin < b.begin; });
+
+    FILE* file = std::fopen(path.c_str(), "w");
+    if (!file) {
+        error = path + ": " + std::strerror(errno);
+        return false;
+    }
+    const uint64_t origin = events.empty() ? 0 : events.front().begin;
+    std::fprintf(file, "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n");
+    std::fprintf(file, "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"args\":{\"name\":\"wakefield\"}}");
+    for (size_t t = 0; t < names.size(); ++t) {
+        // Thread names are ours (no quotes or backslashes to escape)
+        std::fprintf(file, ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%zu,"
+                           "\"args\":{\"name\":\"%s\"}}", t + 1, names[t].c_str());
+        std::fprintf(file, ",\n{\"name\":\"thread_sort_index\",\"ph\":\"M\",\"pid\":1,\"tid\":%zu,"
+                           "\"args\":{\"sort_index\":%zu}}", t + 1, t);
+    }
+    for (const CopiedEvent& e : events) {
+        const double ts = static_cast<double>(e.begin - origin) / ticksPerUs;
+        const double dur = static_cast<double>(e.end - e.begin) / ticksPerUs;
+        std::fprintf(file, ",\n{\"name\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":%d,"
+                           "\"ts\":%.3f,\"dur\":%.3f}",
+                     stageName(e.stage), e.thread + 1, ts, dur);
+    }
+    std::fprintf(file, "\n]}\n");
+    if (std::fclose(file) != 0) {
+        error = path + ": " + std::strerror(errno);
+        return false;
+    }
+    eventCount = events.size();
+    return true;
+}
+
+} // namespace profile
+
+#endif
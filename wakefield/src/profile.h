@@ -0,0 +1,172 @@
+#ifndef PROFILE_H
+#define PROFILE_H
+
+#include <cstdint>
+#include <string>
+
+// Per-stage hot-path profiler for the audio thread.
+//
+// Configure with -DWAKEFIELD_PROFILE=ON to time the DSP stages below with
+// the CPU's cycle counter (rdtsc on x86, cntvct_el0 on AArch64, steady_clock
+// elsewhere). Each stage has a histogram of log2-sized tick buckets that only
+// the audio thread writes, with plain relaxed stores, so recording never
+// waits. The PROFILE page reads them. In a normal build the timers are empty
+// objects and nothing is recorded.
+//
+// While tracing is switched on, every ScopedTimer also leaves a begin/end
+// event in a ring buffer owned by its thread (audio, UI, sample loaders,
+// metrics exporter; each calls registerThread once). writeChromeTrace()
+// dumps the last few seconds of every thread as Chrome trace JSON, which
+// chrome://tracing and ui.perfetto.dev open as one timeline.
+namespace profile {
+
+constexpr int kMaxVoices = 8;
+constexpr int kBuckets = 32;    // Bucket b holds durations in [2^b, 2^(b+1)) ticks
+
+enum Stage : int {
+    PARAM_SMOOTHING = 0,
+    MOD_MATRIX,
+    VOICE_RENDER,                           // One stage per voice
+    FILTER = VOICE_RENDER + kMaxVoices,
+    REVERB,
+    LOOPER,
+    WAVEFORM_WRITE,
+    STAGE_COUNT,
+
+    // Traced but not histogrammed: they run on other threads, or (the
+    // callback) would only duplicate the CONFIG page's load meter
+    AUDIO_CALLBACK = STAGE_COUNT,
+    UI_UPDATE,
+    UI_DRAW,
+    SAMPLE_LOAD,
+    SAMPLE_STREAM,
+    METRICS_SCRAPE,
+    METRICS_STATSD,
+    TRACE_STAGE_COUNT
+};
+
+const char* stageName(int stage);
+
+// ~/.config/wakefield/traces/wakefield-trace-<date>-<time>.json
+std::string defaultTracePath();
+
+// A consistent-enough copy of one stage's histogram (fields are read one
+// at a time while the audio thread may be writing)
+struct StageSnapshot {
+    uint64_t count = 0;
+    uint64_t totalTicks = 0;
+    uint32_t buckets[kBuckets] = {};
+};
+
+#ifdef WAKEFIELD_PROFILE
+
+uint64_t steadyNowNs();
+
+inline uint64_t now() {
+#if defined(__x86_64__) || defined(__i386__)
+    return __builtin_ia32_rdtsc();
+#elif defined(__aarch64__)
+    uint64_t ticks;
+    asm volatile("mrs %0, cntvct_el0" : "=r"(ticks));
+    return ticks;
+#else
+    return steadyNowNs();
+#endif
+}
+
+void record(int stage, uint64_t ticks);   // Audio thread only
+void read(int stage, StageSnapshot& out);
+double ticksPerMicrosecond();             // Calibrated on first call (UI thread)
+constexpr bool enabled() { return true; }
+
+// Give the calling thread a trace buffer under this name (copied). A name
+// that was used before by a thread that has since exited gets that buffer
+// back, so short-lived workers don't use up the slots. Calling it again
+// from a registered thread does nothing. Threads that aren't registered,
+// or that find every slot taken, are simply not traced.
+void registerThread(const char* name);
+
+void setTracing(bool on);
+bool tracing();
+
+// Append one event to the calling thread's buffer, if tracing
+void trace(int stage, uint64_t beginTicks, uint64_t endTicks);
+
+// Write every registered thread's buffered events, oldest first. Safe while
+// the threads keep tracing; events overwritten during the copy are dropped.
+bool writeChromeTrace(const std::string& path, size_t& eventCount, std::string& error);
+
+// Times the enclosing scope, or until stop()
+class ScopedTimer {
+public:
+    explicit ScopedTimer(int stage) : stage(stage), start(now()) {}
+    ~ScopedTimer() { stop(); }
+    void stop() {
+        if (stage >= 0) {
+            const uint64_t end = now();
+            record(stage, end - start);
+            trace(stage, start, end);
+            stage = -1;
+        }
+    }
+    ScopedTimer(const ScopedTimer&) = delete;
+    ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+private:
+    int stage;
+    uint64_t start;
+};
+
+// Sums several timed sections (e.g. one voice's chunks in a buffer) and
+// records them as a single sample. Not traced: the sections are too short
+// and too many to be worth a slice each.
+class Accumulator {
+public:
+    void begin() { start = now(); }
+    void end() { total += now() - start; }
+    void commit(int stage) {
+        record(stage, total);
+        total = 0;
+    }
+
+private:
+    uint64_t start = 0;
+    uint64_t total = 0;
+};
+
+#else
+
+inline void read(int, StageSnapshot& out) { out = StageSnapshot(); }
+inline double ticksPerMicrosecond() { return 1.0; }
+constexpr bool enabled() { return false; }
+
+inline uint64_t now() { return 0; }
+inline void registerThread(const char*) {}
+inline void setTracing(bool) {}
+inline bool tracing() { return false; }
+inline void trace(int, uint64_t, uint64_t) {}
+
+inline bool writeChromeTrace(const std::string&, size_t& eventCount, std::string& error) {
+    eventCount = 0;
+    error = "profiling is compiled out of this build";
+    return false;
+}
+
+class ScopedTimer {
+public:
+    explicit ScopedTimer(int) {}
+    void stop() {}
+};
+
+class Accumulator {
+public:
+    void begin() {}
+    void end() {}
+    void commit(int) {}
+};
+
+#endif
+
+} // namespace profile
+
+#endif // PROFILE_H
@@ -0,0 +1,97 @@
+#include "quality_governor.h"
+#include "cpu_monitor.h"
+#include <algorithm>
+#include <string>
+
+QualityGovernor::QualityGovernor()
+    : steps{Step::REVERB_HALF_RATE, Step::SAMPLER_LINEAR, Step::NO_OVERSAMPLING, Step::CAP_POLYPHONY}
+    , stepCount(kStepCount)
+    , level(0)
+    , lastWindow(0)
+    , calmWindows(0) {
+}
+
+const char* QualityGovernor::stepName(Step step) {
+    switch (step) {
+        case Step::REVERB_HALF_RATE: return "reverb";
+        case Step::SAMPLER_LINEAR: return "sampler";
+        case Step::NO_OVERSAMPLING: return "oversampling";
+        case Step::CAP_POLYPHONY: return "voices";
+        default: return "?";
+    }
+}
+
+bool QualityGovernor::configure(const char* commaSeparatedSteps) {
+    Step parsed[kStepCount];
+    int count = 0;
+    const std::string list = commaSeparatedSteps;
+    if (list != "off") {
+        size_t start = 0;
+        while (start <= list.size()) {
+            const size_t end = std::min(list.find(',', start), list.size());
+            const std::string name = list.substr(start, end - start);
+            bool known = false;
+            for (int s = 0; s < kStepCount; ++s) {
+                const Step step = static_cast<Step>(s);
+                if (name == stepName(step)) {
+                    bool repeated = false;
+                    for (int i = 0; i < count; ++i) {
+                        repeated = repeated || parsed[i] == step;
+                    }
+                    if (!repeated) {
+                        parsed[count++] = step;
+                    }
+                    known = true;
+                }
+            }
+            if (!known) {
+                return false;
+            }
+            start = end + 1;
+        }
+    }
+    std::copy(parsed, parsed + count, steps);
+    stepCount = count;
+    level.store(0, std::memory_order_relaxed);
+    return true;
+}
+
+void QualityGovernor::update(const CPUMonitor& meter) {
+    const uint32_t window = meter.getWindowCount();
+    if (window == lastWindow || stepCount == 0) {
+        return;
+    }
+    lastWindow = window;
+
+    const float p99 = meter.getP99Load();
+    int current = level.load(std::memory_order_relaxed);
+    if (p99 >= kDegradeLoad) {
+        calmWindows = 0;
+        if (current < stepCount) {
+            ++current;
+        }
+    } else if (p99 <= kRestoreLoad) {
+        if (++calmWindows >= kRestoreWindows && current > 0) {
+            --current;
+            calmWindows = 0;
+        }
+    } else {
+        calmWindows = 0;
+    }
+    level.store(current, std::memory_order_relaxed);
+}
+
+bool QualityGovernor::applies(Step step) const {
+    const int applied = level.load(std::memory_order_relaxed);
+    for (int i = 0; i < applied; ++i) {
+        if (steps[i] == step) {
+            return true;
+        }
+    }
+    return false;
+}
+
+const char* QualityGovernor::getLevelName() const {
+    const int applied = level.load(std::memory_order_relaxed);
+    return applied > 0 ? stepName(steps[applied - 1]) : nullptr;
+}
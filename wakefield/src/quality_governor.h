@@ -0,0 +1,61 @@
+#ifndef QUALITY_GOVERNOR_H
+#define QUALITY_GOVERNOR_H
+
+#include <atomic>
+#include <cstdint>
+
+class CPUMonitor;
+
+// Trades quality for headroom when the DSP load nears the deadline. Each
+// time the load meter publishes a window the audio thread calls update():
+// a p99 load at or above kDegradeLoad applies the next degradation step,
+// and kRestoreWindows windows in a row at or below kRestoreLoad lift the
+// last one again. Steps apply cumulatively, in the configured order; the
+// audio callback reads applies() when it pushes settings to the synth, so
+// every switch lands on a block boundary.
+class QualityGovernor {
+public:
+    enum class Step : uint8_t {
+        REVERB_HALF_RATE = 0,   // Greyhole and the tank at half the sample rate
+        SAMPLER_LINEAR,         // Sampler interpolation capped at Linear
+        NO_OVERSAMPLING,        // Mix ladder and FM path at the engine rate
+        CAP_POLYPHONY,          // New notes on half the voices only
+        COUNT
+    };
+    static constexpr int kStepCount = static_cast<int>(Step::COUNT);
+
+    static constexpr float kDegradeLoad = 0.8f;     // CPUMonitor::kOverloadThreshold
+    static constexpr float kRestoreLoad = 0.5f;
+    static constexpr int kRestoreWindows = 4;       // 2 s of CPUMonitor windows
+
+    QualityGovernor();
+
+    // Steps to use, in order (all four by default; none disables the
+    // governor). Set before audio starts. False on an unknown name
+    bool configure(const char* commaSeparatedSteps);
+
+    // Audio thread, after CPUMonitor::recordCallback
+    void update(const CPUMonitor& meter);
+
+    // Audio thread: step is currently applied
+    bool applies(Step step) const;
+
+    // Steps applied (0 = full quality) out of getStepCount()
+    int getLevel() const { return level.load(std::memory_order_relaxed); }
+    int getStepCount() const { return stepCount; }
+    // Short name of the most recently applied step, or nullptr at full quality
+    const char* getLevelName() const;
+
+    static const char* stepName(Step step);
+
+private:
+    Step steps[kStepCount];
+    int stepCount;
+    std::atomic<int> level;
+
+    // Audio thread only
+    uint32_t lastWindow;
+    int calmWindows;
+};
+
+#endif // QUALITY_GOVERNOR_H
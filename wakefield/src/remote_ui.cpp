@@ -0,0 +1,357 @@
+// synth_remote: a terminal UI in its own process, attached to an engine
+// started with --shm name. It reads the parameters, load and transport
+// the engine publishes in the shared segment and sends edits back as
+// normalized parameter values and button presses (see shm_bridge.h).
+//
+//   synth_remote wakefield
+//
+// Several can attach to one engine at once. Quitting, or a crash, leaves
+// the engine running.
+
+#include <algorithm>
+#include <chrono>
+#include <clocale>
+#include <cmath>
+#include <csignal>
+#include <cstdio>
+#include <ncurses.h>
+#include <string>
+#include "osc_server.h"
+#include "shm_bridge.h"
+
+namespace {
+
+enum class Kind { FLOAT, LOG, INT, BOOL, TEMPO };
+
+// A row of the parameter list; slot and ranges follow
+// applyNormalizedToParameter() in main.cpp
+struct Row {
+    const char* name;
+    uint8_t slot;
+    Kind kind;
+    float min;
+    float max;
+    const char* unit;
+    float (*read)(const ShmEngineState&);
+};
+
+const Row kRows[] = {
+    {"Attack",        2, Kind::LOG,   0.001f, 30.0f,    "s",  [](const ShmEngineState& s) { return s.params.attack; }},
+    {"Decay",         3, Kind::LOG,   0.001f, 30.0f,    "s",  [](const ShmEngineState& s) { return s.params.decay; }},
+    {"Sustain",       4, Kind::FLOAT, 0.0f,   1.0f,     "",   [](const ShmEngineState& s) { return s.params.sustain; }},
+    {"Release",       5, Kind::LOG,   0.001f, 30.0f,    "s",  [](const ShmEngineState& s) { return s.params.release; }},
+    {"Master Volume", 6, Kind::FLOAT, 0.0f,   1.0f,     "",   [](const ShmEngineState& s) { return s.params.masterVolume; }},
+    {"OSC1 Mode",     10, Kind::INT,  0.0f,   1.0f,     "",   [](const ShmEngineState& s) { return float(s.params.osc[0].mode); }},
+    {"OSC1 Freq",     11, Kind::LOG,  20.0f,  2000.0f,  "Hz", [](const ShmEngineState& s) { return s.params.osc[0].freq; }},
+    {"OSC1 Morph",    12, Kind::FLOAT, 0.0001f, 0.9999f, "",  [](const ShmEngineState& s) { return s.params.osc[0].morph; }},
+    {"OSC1 Duty",     13, Kind::FLOAT, 0.0f,  1.0f,     "",   [](const ShmEngineState& s) { return s.params.osc[0].duty; }},
+    {"OSC1 Ratio",    14, Kind::LOG,  0.125f, 16.0f,    "",   [](const ShmEngineState& s) { return s.params.osc[0].ratio; }},
+    {"OSC1 Offset",   15, Kind::FLOAT, -1000.0f, 1000.0f, "Hz", [](const ShmEngineState& s) { return s.params.osc[0].offset; }},
+    {"Reverb Type",   20, Kind::INT,  0.0f,   6.0f,     "",   [](const ShmEngineState& s) { return float(s.params.reverbType); }},
+    {"Reverb",        21, Kind::BOOL, 0.0f,   1.0f,     "",   [](const ShmEngineState& s) { return s.params.reverbEnabled ? 1.0f : 0.0f; }},
+    {"Delay Time",    22, Kind::FLOAT, 0.0f,  1.0f,     "",   [](const ShmEngineState& s) { return s.params.reverbDelayTime; }},
+    {"Size",          23, Kind::FLOAT, 0.0f,  1.0f,     "",   [](const ShmEngineState& s) { return s.params.reverbSize; }},
+    {"Damping",       24, Kind::FLOAT, 0.0f,  0.99f,    "",   [](const ShmEngineState& s) { return s.params.reverbDamping; }},
+    {"Reverb Mix",    25, Kind::FLOAT, 0.0f,  1.0f,     "",   [](const ShmEngineState& s) { return s.params.reverbMix; }},
+    {"Reverb Decay",  26, Kind::FLOAT, 0.0f,  1.0f,     "",   [](const ShmEngineState& s) { return s.params.reverbDecay; }},
+    {"Diffusion",     27, Kind::FLOAT, 0.0f,  0.99f,    "",   [](const ShmEngineState& s) { return s.params.reverbDiffusion; }},
+    {"Mod Depth",     28, Kind::FLOAT, 0.0f,  1.0f,     "",   [](const ShmEngineState& s) { return s.params.reverbModDepth; }},
+    {"Mod Freq",      29, Kind::FLOAT, 0.0f,  10.0f,    "Hz", [](const ShmEngineState& s) { return s.params.reverbModFreq; }},
+    {"Filter Type",   30, Kind::INT,  0.0f,   3.0f,     "",   [](const ShmEngineState& s) { return float(s.params.filterType); }},
+    {"Filter",        31, Kind::BOOL, 0.0f,   1.0f,     "",   [](const ShmEngineState& s) { return s.params.filterEnabled ? 1.0f : 0.0f; }},
+    {"Cutoff",        32, Kind::LOG,  20.0f,  20000.0f, "Hz", [](const ShmEngineState& s) { return s.params.filterCutoff; }},
+    {"Filter Gain",   33, Kind::FLOAT, -24.0f, 24.0f,   "dB", [](const ShmEngineState& s) { return s.params.filterGain; }},
+    {"Current Loop",  40, Kind::INT,  0.0f,   3.0f,     "",   [](const ShmEngineState& s) { return float(s.params.currentLoop); }},
+    {"Overdub Mix",   41, Kind::FLOAT, 0.0f,  1.0f,     "",   [](const ShmEngineState& s) { return s.params.overdubMix; }},
+    {"Preset Morph",  OscServer::kSlotMorph, Kind::FLOAT, 0.0f, 1.0f, "", [](const ShmEngineState& s) { return s.params.presetMorph; }},
+    {"Tempo",         OscServer::kSlotTempo, Kind::TEMPO, 20.0f, 300.0f, "BPM", [](const ShmEngineState& s) { return s.tempo; }},
+};
+constexpr int kRowCount = sizeof(kRows) / sizeof(kRows[0]);
+
+const char* const kLoopStateNames[] = {"empty", "REC", "play", "ODUB", "stop"};
+
+volatile std::sig_atomic_t quitRequested = 0;
+
+void handleSignal(int) {
+    quitRequested = 1;
+}
+
+float toNormalized(const Row& row, float value) {
+    float n;
+    if (row.kind == Kind::LOG) {
+        n = std::log(std::max(value, row.min) / row.min) / std::log(row.max / row.min);
+    } else {
+        n = (value - row.min) / (row.max - row.min);
+    }
+    return std::min(std::max(n, 0.0f), 1.0f);
+}
+
+// The value a step of 'steps' sends for row: normalized for a parameter,
+// BPM for tempo. Enums and toggles move a whole step
+float stepValue(const Row& row, float current, int steps, bool fine) {
+    switch (row.kind) {
+        case Kind::TEMPO:
+            return std::min(std::max(current + steps * (fine ? 0.1f : 1.0f), row.min), row.max);
+        case Kind::BOOL:
+            return steps > 0 ? 1.0f : 0.0f;
+        case Kind::INT: {
+            // The engine truncates, so aim half a step past the target
+            const float target = std::min(std::max(std::round(current) + steps, row.min), row.max);
+            return std::min((target - row.min + 0.5f) / (row.max - row.min), 1.0f);
+        }
+        default:
+            return std::min(std::max(toNormalized(row, current) + steps * (fine ? 0.001f : 0.01f), 0.0f), 1.0f);
+    }
+}
+
+void formatValue(const Row& row, float value, char* out, size_t size) {
+    switch (row.kind) {
+        case Kind::BOOL:
+            std::snprintf(out, size, "%s", value > 0.5f ? "on" : "off");
+            break;
+        case Kind::INT:
+            std::snprintf(out, size, "%d", static_cast<int>(std::lround(value)));
+            break;
+        default:
+            if (std::fabs(value) >= 100.0f) {
+                std::snprintf(out, size, "%.1f %s", value, row.unit);
+            } else {
+                std::snprintf(out, size, "%.3f %s", value, row.unit);
+            }
+            break;
+    }
+}
+
+void drawStatus(const ShmBridgeClient& bridge, const ShmEngineState& state, bool stalled, int maxX) {
+    move(0, 0);
+    clrtoeol();
+    attron(COLOR_PAIR(5) | A_BOLD);
+    mvprintw(0, 0, " wakefield remote ");
+    attroff(COLOR_PAIR(5) | A_BOLD);
+    printw(" %u Hz / %u  ", bridge.getSampleRate(), bridge.getBufferFrames());
+
+    const int loadColor = state.loadP99 < 0.5f ? 2 : (state.loadP99 < 0.8f ? 3 : 4);
+    attron(COLOR_PAIR(1));
+    printw("DSP:");
+    attroff(COLOR_PAIR(1));
+    attron(COLOR_PAIR(loadColor));
+    printw(" %2.0f%% p99 %2.0f%% pk %2.0f%%", state.loadMean * 100.0f, state.loadP99 * 100.0f,
+           state.loadPeak * 100.0f);
+    attroff(COLOR_PAIR(loadColor));
+    if (state.overloads > 0 || state.xruns > 0) {
+        attron(COLOR_PAIR(4));
+        printw(" !%llu xrun %llu", static_cast<unsigned long long>(state.overloads),
+               static_cast<unsigned long long>(state.xruns));
+        attroff(COLOR_PAIR(4));
+    }
+    if (state.qualityLevel > 0) {
+        attron(COLOR_PAIR(3));
+        printw(" Q-%d", state.qualityLevel);
+        attroff(COLOR_PAIR(3));
+    }
+
+    move(1, 0);
+    clrtoeol();
+    mvprintw(1, 1, "%s %.1f BPM   voices %d/%d   loops:", state.playing ? "PLAY" : "stop", state.tempo,
+             state.activeVoices, state.maxVoices);
+    for (int i = 0; i < 4; ++i) {
+        const int s = std::min(std::max(state.loopState[i], 0), 4);
+        const bool current = i == state.params.currentLoop;
+        if (current) attron(A_REVERSE);
+        printw(" %d:%s", i + 1, kLoopStateNames[s]);
+        if (current) attroff(A_REVERSE);
+    }
+    if (stalled) {
+        attron(COLOR_PAIR(4) | A_BOLD);
+        mvprintw(1, std::max(0, maxX - 24), "ENGINE NOT RESPONDING");
+        attroff(COLOR_PAIR(4) | A_BOLD);
+    }
+}
+
+void drawParameters(const ShmEngineState& state, int selected, int top, int rows) {
+    const int first = std::max(0, std::min(selected - rows / 2, kRowCount - rows));
+    for (int r = 0; r < rows; ++r) {
+        move(top + r, 0);
+        clrtoeol();
+        const int i = first + r;
+        if (i < 0 || i >= kRowCount) {
+            continue;
+        }
+        const Row& row = kRows[i];
+        const float value = row.read(state);
+        char text[32];
+        formatValue(row, value, text, sizeof(text));
+        if (i == selected) attron(A_REVERSE);
+        mvprintw(top + r, 1, "%-14s %12s", row.name, text);
+        if (i == selected) attroff(A_REVERSE);
+
+        // Position within the range
+        if (row.kind == Kind::FLOAT || row.kind == Kind::LOG) {
+            const int width = 20;
+            const int filled = static_cast<int>(toNormalized(row, value) * width + 0.5f);
+            attron(COLOR_PAIR(2));
+            mvprintw(top + r, 30, "[");
+            for (int x = 0; x < width; ++x) {
+                addch(x < filled ? '=' : ' ');
+            }
+            addch(']');
+            attroff(COLOR_PAIR(2));
+        }
+    }
+}
+
+// Rising zero crossing in the first half, so the trace holds still
+int findTrigger(const float* frames, uint32_t count) {
+    for (uint32_t i = 1; i < count / 2; ++i) {
+        if (frames[i - 1] <= 0.0f && frames[i] > 0.0f) {
+            return static_cast<int>(i);
+        }
+    }
+    return 0;
+}
+
+void drawScope(const float* frames, uint32_t count, int top, int left, int height, int width) {
+    for (int y = 0; y < height; ++y) {
+        move(top + y, left);
+        for (int x = 0; x < width; ++x) {
+            addch(' ');
+        }
+    }
+    if (count == 0 || width < 2 || height < 2) {
+        return;
+    }
+    const int trigger = findTrigger(frames, count);
+    const uint32_t span = std::min<uint32_t>(count - trigger, static_cast<uint32_t>(width) * 2);
+    attron(COLOR_PAIR(1));
+    for (int x = 0; x < width; ++x) {
+        const uint32_t i = trigger + static_cast<uint32_t>(x) * span / width;
+        if (i >= count) {
+            break;
+        }
+        const float v = std::min(std::max(frames[i], -1.0f), 1.0f);
+        const int y = static_cast<int>((1.0f - v) * 0.5f * (height - 1) + 0.5f);
+        mvaddch(top + y, left + x, '*');
+    }
+    attroff(COLOR_PAIR(1));
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    if (argc != 2 || argv[1][0] == '-') {
+        std::fprintf(stderr, "usage: synth_remote NAME  (the engine runs with --shm NAME)\n");
+        return 2;
+    }
+
+    ShmBridgeClient bridge;
+    std::string error;
+    if (!bridge.attach(argv[1], error)) {
+        std::fprintf(stderr, "synth_remote: %s\n", error.c_str());
+        return 1;
+    }
+
+    std::signal(SIGINT, handleSignal);
+    std::signal(SIGTERM, handleSignal);
+
+    setlocale(LC_ALL, "");
+    initscr();
+    cbreak();
+    noecho();
+    keypad(stdscr, TRUE);
+    curs_set(0);
+    timeout(33);
+    if (has_colors()) {
+        start_color();
+        init_pair(1, COLOR_CYAN, COLOR_BLACK);
+        init_pair(2, COLOR_GREEN, COLOR_BLACK);
+        init_pair(3, COLOR_YELLOW, COLOR_BLACK);
+        init_pair(4, COLOR_RED, COLOR_BLACK);
+        init_pair(5, COLOR_WHITE, COLOR_BLUE);
+    }
+
+    ShmEngineState state;
+    static float scope[ShmSegment::kScopeFrames];
+    uint32_t scopeCount = 0;
+    int selected = 0;
+    uint32_t lastHeartbeat = bridge.getHeartbeat();
+    auto lastBeat = std::chrono::steady_clock::now();
+
+    while (!quitRequested) {
+        bridge.readState(state);
+        scopeCount = bridge.readScope(scope, ShmSegment::kScopeFrames);
+
+        const auto now = std::chrono::steady_clock::now();
+        const uint32_t heartbeat = bridge.getHeartbeat();
+        if (heartbeat != lastHeartbeat) {
+            lastHeartbeat = heartbeat;
+            lastBeat = now;
+        }
+        const bool stalled = now - lastBeat > std::chrono::seconds(1);
+
+        int maxY, maxX;
+        getmaxyx(stdscr, maxY, maxX);
+        const int listRows = std::max(1, maxY - 5);
+        drawStatus(bridge, state, stalled, maxX);
+        drawParameters(state, selected, 3, listRows);
+        if (maxX > 60) {
+            drawScope(scope, scopeCount, 3, 56, std::min(listRows, 16), maxX - 57);
+        }
+        move(maxY - 1, 0);
+        clrtoeol();
+        attron(A_DIM);
+        mvprintw(maxY - 1, 1, "up/down select  left/right adjust (shift fine)  space play/stop  "
+                 "l rec/play  o overdub  s stop  c clear  q quit");
+        attroff(A_DIM);
+        refresh();
+
+        const int key = getch();
+        if (key == ERR) {
+            continue;
+        }
+        const Row& row = kRows[selected];
+        switch (key) {
+            case 'q':
+            case 'Q':
+                quitRequested = 1;
+                break;
+            case KEY_UP:
+                selected = std::max(selected - 1, 0);
+                break;
+            case KEY_DOWN:
+                selected = std::min(selected + 1, kRowCount - 1);
+                break;
+            case KEY_LEFT:
+            case KEY_RIGHT:
+            case KEY_SLEFT:
+            case KEY_SRIGHT: {
+                const int steps = (key == KEY_LEFT || key == KEY_SLEFT) ? -1 : 1;
+                const bool fine = key == KEY_SLEFT || key == KEY_SRIGHT;
+                bridge.send({ShmCommand::Type::PARAM, row.slot, stepValue(row, row.read(state), steps, fine)});
+                break;
+            }
+            case ' ':
+                bridge.send({ShmCommand::Type::BUTTON,
+                             static_cast<uint8_t>(state.playing ? OscServer::Command::STOP : OscServer::Command::PLAY),
+                             0.0f});
+                break;
+            case 'l':
+                bridge.send({ShmCommand::Type::BUTTON, static_cast<uint8_t>(OscServer::Command::LOOP_REC_PLAY), 0.0f});
+                break;
+            case 'o':
+                bridge.send({ShmCommand::Type::BUTTON, static_cast<uint8_t>(OscServer::Command::LOOP_OVERDUB), 0.0f});
+                break;
+            case 's':
+                bridge.send({ShmCommand::Type::BUTTON, static_cast<uint8_t>(OscServer::Command::LOOP_STOP), 0.0f});
+                break;
+            case 'c':
+                bridge.send({ShmCommand::Type::BUTTON, static_cast<uint8_t>(OscServer::Command::LOOP_CLEAR), 0.0f});
+                break;
+            default:
+                break;
+        }
+    }
+
+    endwin();
+    bridge.detach();
+    return 0;
+}
@@ -1,17 +1,94 @@
 #include "reverb.h"
+#include "dsp_arena.h"
 
 // The Faust DSP generates a global class named UI. Our application defines its own
 // UI class, so we temporarily rename the Faust one to avoid an ODR clash.
 #define UI GreyholeDSPUI
 #include "../reverb/greyhole.cpp"
+#ifdef WAKEFIELD_REVERB_VEC
+#include "../reverb/greyhole_vec.cpp"
+#endif
 #undef UI
 #include <algorithm>
 #include <cmath>
 #include <cstring>
 
-GreyholeReverb::GreyholeReverb(float sampleRate)
+namespace {
+
+// Collects the Faust hslider zones (as defined in greyhole.cpp buildUserInterface)
+// fHslider4 = delayTime (0.001 - 1.45, default 0.2)
+// fHslider0 = damping (0.0 - 0.99, default 0.0)
+// fHslider6 = size (0.5 - 3.0, default 1.0)
+// fHslider5 = diffusion (0.0 - 0.99, default 0.5)
+// fHslider1 = feedback (0.0 - 1.0, default 0.9)
+// fHslider3 = modDepth (0.0 - 1.0, default 0.1)
+// fHslider2 = modFreq (0.0 - 10.0, default 2.0)
+class ZoneCollector : public GreyholeDSPUI {
+public:
+    explicit ZoneCollector(GreyholeReverb::Zones& zones) : zones(zones) {}
+
+    void openVerticalBox(const char*) override {}
+    void openHorizontalBox(const char*) override {}
+    void closeBox() override {}
+    void declare(void*, const char*, const char*) override {}
+
+    void addHorizontalSlider(const char* label, float* zone, float, float, float, float) override {
+        if (strcmp(label, "damping") == 0) zones.damping = zone;
+        else if (strcmp(label, "diffusion") == 0) zones.diffusion = zone;
+        else if (strcmp(label, "feedback") == 0) zones.feedback = zone;
+        else if (strcmp(label, "modDepth") == 0) zones.modDepth = zone;
+        else if (strcmp(label, "modFreq") == 0) zones.modFreq = zone;
+        else if (strcmp(label, "delayTime") == 0) zones.delayTime = zone;
+        else if (strcmp(label, "size") == 0) zones.size = zone;
+    }
+
+private:
+    GreyholeReverb::Zones& zones;
+};
+
+// Write a zone only when the value moved; returns true if it was written
+inline bool writeZone(float* zone, float value) {
+    if (!zone || *zone == value) {
+        return false;
+    }
+    *zone = value;
+    return true;
+}
+
+} // namespace
+
+bool GreyholeReverb::isVariantAvailable(Variant variant) {
+#ifdef WAKEFIELD_REVERB_VEC
+    return true;
+#else
+    return variant == Variant::Scalar;
+#endif
+}
+
+GreyholeReverb::Variant GreyholeReverb::defaultVariant() {
+    return isVariantAvailable(Variant::Vector) ? Variant::Vector : Variant::Scalar;
+}
+
+const char* GreyholeReverb::variantName(Variant variant) {
+    return variant == Variant::Vector ? "vector" : "scalar";
+}
+
+size_t GreyholeReverb::arenaBytes(Variant variant) {
+    size_t faustBytes = sizeof(mydsp);
+#ifdef WAKEFIELD_REVERB_VEC
+    if (variant == Variant::Vector) {
+        faustBytes = sizeof(mydsp_vec);
+    }
+#else
+    (void)variant;
+#endif
+    return DspArena::round(faustBytes) + DspArena::round(2 * kOutputFrames * sizeof(float));
+}
+
+GreyholeReverb::GreyholeReverb(float sampleRate, Variant requested, DspArena* arena)
     : sampleRate(sampleRate)
-    , dsp(nullptr)
+    , variant(isVariantAvailable(requested) ? requested : Variant::Scalar)
+    , faust(nullptr)
     , feedback(0.9f)
     , modDepth(0.1f)
     , modFreq(2.0f)
@@ -20,108 +97,97 @@ GreyholeReverb::GreyholeReverb(float sampleRate)
     , size(1.0f)
     , damping(0.0f)
     , mix(0.3f)
-    , leftInput(512, 0.0f)
-    , rightInput(512, 0.0f)
-    , leftOutput(512, 0.0f)
-    , rightOutput(512, 0.0f) {
+    , halfRate(false)
+    , gateEnabled(true)
+    , idle(false)
+    , silentSamples(0) {
     
     // Create and initialize the Faust DSP
-    dsp = new mydsp();
-    dsp->init(static_cast<int>(sampleRate));
+    inArena = arena != nullptr;
+#ifdef WAKEFIELD_REVERB_VEC
+    if (variant == Variant::Vector) {
+        faust = inArena ? static_cast<dsp*>(arena->create<mydsp_vec>()) : new mydsp_vec();
+    }
+#endif
+    if (!faust) {
+        faust = inArena ? static_cast<dsp*>(arena->create<mydsp>()) : new mydsp();
+    }
+    faust->init(static_cast<int>(sampleRate));
     
-    // Set up input/output pointers
-    inputs[0] = leftInput.data();
-    inputs[1] = rightInput.data();
-    outputs[0] = leftOutput.data();
-    outputs[1] = rightOutput.data();
+    // Resolve the parameter zones once; setters write them directly
+    ZoneCollector collector(zones);
+    faust->buildUserInterface(&collector);
+    
+    // Set up output pointers
+    float* wet = inArena ? arena->takeArray<float>(2 * kOutputFrames) : nullptr;
+    if (!wet) {
+        outputStorage.assign(2 * kOutputFrames, 0.0f);
+        wet = outputStorage.data();
+    }
+    outputs[0] = wet;
+    outputs[1] = wet + kOutputFrames;
     
     // Initialize parameters
     updateParameters();
 }
 
 GreyholeReverb::~GreyholeReverb() {
-    delete dsp;
+    if (inArena) {
+        faust->~dsp();
+    } else {
+        delete faust;
+    }
 }
 
 void GreyholeReverb::updateParameters() {
-    if (!dsp) return;
-    
-    // Access the Faust hslider parameters directly (as defined in greyhole.cpp buildUserInterface)
-    // fHslider4 = delayTime (0.001 - 1.45, default 0.2)
-    // fHslider0 = damping (0.0 - 0.99, default 0.0)
-    // fHslider6 = size (0.5 - 3.0, default 1.0)
-    // fHslider5 = diffusion (0.0 - 0.99, default 0.5)
-    // fHslider1 = feedback (0.0 - 1.0, default 0.9)
-    // fHslider3 = modDepth (0.0 - 1.0, default 0.1)
-    // fHslider2 = modFreq (0.0 - 10.0, default 2.0)
-    
-    // Note: We need to access these through a setter method or directly
-    // For now, we'll create a simple UI class to set parameters
-    
-    class SimpleUI : public GreyholeDSPUI {
-    public:
-        float* damping;
-        float* diffusion;
-        float* feedback;
-        float* modDepth;
-        float* modFreq;
-        float* delayTime;
-        float* size;
-        
-        SimpleUI() : damping(nullptr), diffusion(nullptr), feedback(nullptr), 
-                     modDepth(nullptr), modFreq(nullptr), delayTime(nullptr), size(nullptr) {}
-        
-        virtual ~SimpleUI() {}
-        
-        virtual void openVerticalBox(const char*) override {}
-        virtual void openHorizontalBox(const char*) override {}
-        virtual void closeBox() override {}
-        virtual void declare(void*, const char*, const char*) override {}
-        
-        virtual void addHorizontalSlider(const char* label, float* zone, float init, float min, float max, float step) override {
-            if (strcmp(label, "damping") == 0) damping = zone;
-            else if (strcmp(label, "diffusion") == 0) diffusion = zone;
-            else if (strcmp(label, "feedback") == 0) feedback = zone;
-            else if (strcmp(label, "modDepth") == 0) modDepth = zone;
-            else if (strcmp(label, "modFreq") == 0) modFreq = zone;
-            else if (strcmp(label, "delayTime") == 0) delayTime = zone;
-            else if (strcmp(label, "size") == 0) size = zone;
-        }
-    };
-    
-    static SimpleUI* ui = nullptr;
-    if (!ui) {
-        ui = new SimpleUI();
-        dsp->buildUserInterface(ui);
-    }
-    
-    // Set the parameters
-    *ui->damping = damping;
-    *ui->diffusion = diffusion;
-    *ui->feedback = feedback;
-    *ui->modDepth = modDepth;
-    *ui->modFreq = modFreq;
-    *ui->delayTime = delayTime;
-    *ui->size = size;
+    writeZone(zones.damping, damping);
+    writeZone(zones.diffusion, diffusion);
+    writeZone(zones.feedback, feedback);
+    writeZone(zones.modDepth, modDepth);
+    writeZone(zones.modFreq, modFreq);
+    writeZone(zones.delayTime, delayTime);
+    writeZone(zones.size, sizeZone());
+}
+
+int GreyholeReverb::setParameters(const Parameters& p) {
+    // Same mappings as the individual setters
+    delayTime = 0.001f + std::clamp(p.delayTime, 0.0f, 1.0f) * 1.449f;
+    size = 0.5f + std::clamp(p.size, 0.0f, 1.0f) * 2.5f;
+    damping = std::clamp(p.damping, 0.0f, 0.99f);
+    mix = std::clamp(p.mix, 0.0f, 1.0f);
+    feedback = std::clamp(p.decay, 0.0f, 1.0f);
+    diffusion = std::clamp(p.diffusion, 0.0f, 0.99f);
+    modDepth = std::clamp(p.modDepth, 0.0f, 1.0f);
+    modFreq = std::clamp(p.modFreq, 0.0f, 10.0f);
+
+    int written = 0;
+    written += writeZone(zones.delayTime, delayTime);
+    written += writeZone(zones.size, sizeZone());
+    written += writeZone(zones.damping, damping);
+    written += writeZone(zones.feedback, feedback);
+    written += writeZone(zones.diffusion, diffusion);
+    written += writeZone(zones.modDepth, modDepth);
+    written += writeZone(zones.modFreq, modFreq);
+    return written;
 }
 
 void GreyholeReverb::setDelayTime(float t) {
     // Map delay time (0-1) to Greyhole delayTime (0.001-1.45s)
     t = std::clamp(t, 0.0f, 1.0f);
     delayTime = 0.001f + t * 1.449f;
-    updateParameters();
+    writeZone(zones.delayTime, delayTime);
 }
 
 void GreyholeReverb::setSize(float s) {
     // Map size (0-1) to Greyhole size (0.5-3.0)
     s = std::clamp(s, 0.0f, 1.0f);
     size = 0.5f + s * 2.5f;
-    updateParameters();
+    writeZone(zones.size, sizeZone());
 }
 
 void GreyholeReverb::setDamping(float d) {
     damping = std::clamp(d, 0.0f, 0.99f);
-    updateParameters();
+    writeZone(zones.damping, damping);
 }
 
 void GreyholeReverb::setMix(float m) {
@@ -131,54 +197,290 @@ void GreyholeReverb::setMix(float m) {
 
 void GreyholeReverb::setDecay(float d) {
     feedback = std::clamp(d, 0.0f, 1.0f);
-    updateParameters();
+    writeZone(zones.feedback, feedback);
 }
 
 void GreyholeReverb::setDiffusion(float d) {
     diffusion = std::clamp(d, 0.0f, 0.99f);
-    updateParameters();
+    writeZone(zones.diffusion, diffusion);
 }
 
 void GreyholeReverb::setModDepth(float d) {
     modDepth = std::clamp(d, 0.0f, 1.0f);
-    updateParameters();
+    writeZone(zones.modDepth, modDepth);
 }
 
 void GreyholeReverb::setModFreq(float f) {
     modFreq = std::clamp(f, 0.0f, 10.0f);
-    updateParameters();
+    writeZone(zones.modFreq, modFreq);
+}
+
+void GreyholeReverb::setHalfRate(bool enabled) {
+    if (!faust || enabled == halfRate) {
+        return;
+    }
+    halfRate = enabled;
+    // Only the rate constants change; the slider zones keep their values
+    // and the per-block slider math picks up the new rate
+    faust->instanceConstants(static_cast<int>(enabled ? sampleRate * 0.5f : sampleRate));
+    writeZone(zones.size, sizeZone());
+    clear();
+}
+
+void GreyholeReverb::setTailGateEnabled(bool enabled) {
+    gateEnabled = enabled;
+    if (!enabled) {
+        idle = false;
+        silentSamples = 0;
+    }
+}
+
+int GreyholeReverb::tailHoldSamples() const {
+    // Energy can sit in the delay lines for up to delayTime * size before it
+    // reappears at the output: wait twice that (at least 0.5 s) of silence
+    float seconds = std::max(0.5f, 2.0f * delayTime * size);
+    return static_cast<int>(seconds * sampleRate);
 }
 
 void GreyholeReverb::process(float* left, float* right, int numSamples) {
-    if (!dsp) return;
+    if (!faust) return;
     
-    // Resize buffers if necessary
-    if (numSamples > static_cast<int>(leftInput.size())) {
-        leftInput.resize(numSamples);
-        rightInput.resize(numSamples);
-        leftOutput.resize(numSamples);
-        rightOutput.resize(numSamples);
-        inputs[0] = leftInput.data();
-        inputs[1] = rightInput.data();
-        outputs[0] = leftOutput.data();
-        outputs[1] = rightOutput.data();
+    // The Faust I/O buffers are allocated once in the constructor; longer
+    // blocks are processed in slices instead of resizing on the audio thread
+    const int slice = kOutputFrames;
+    if (numSamples > slice) {
+        for (int start = 0; start < numSamples; start += slice) {
+            process(left + start, right + start, std::min(slice, numSamples - start));
+        }
+        return;
     }
     
-    // Copy input data and store dry signal
-    for (int i = 0; i < numSamples; ++i) {
-        leftInput[i] = left[i];
-        rightInput[i] = right[i];
+    float dryGain = 1.0f - mix;
+    float wetGain = mix;
+    
+    float inputPeak = 0.0f;
+    if (gateEnabled) {
+        for (int i = 0; i < numSamples; ++i) {
+            inputPeak = std::max(inputPeak, std::max(std::abs(left[i]), std::abs(right[i])));
+        }
+        
+        if (idle) {
+            if (inputPeak < kSilenceThreshold) {
+                // Tail has died out: the wet signal is zero
+                for (int i = 0; i < numSamples; ++i) {
+                    left[i] *= dryGain;
+                    right[i] *= dryGain;
+                }
+                return;
+            }
+            // Non-silent input: resume on this block
+            idle = false;
+            silentSamples = 0;
+        }
     }
     
-    // Process through Faust DSP
-    dsp->compute(numSamples, inputs, outputs);
+    // The caller's planes are the Faust inputs (read only) and stay the dry
+    // signal; the wet signal lands in the output scratch
+    if (halfRate) {
+        undersampler.processWet(left, right, outputs[0], outputs[1], numSamples,
+                                [this](float* inL, float* inR, float* outL, float* outR, int n) {
+                                    float* in[2] = {inL, inR};
+                                    float* out[2] = {outL, outR};
+                                    faust->compute(n, in, out);
+                                });
+    } else {
+        float* planes[2] = {left, right};
+        faust->compute(numSamples, planes, outputs);
+    }
     
     // Mix dry and wet signals
-    float dryGain = 1.0f - mix;
-    float wetGain = mix;
-    
+    float wetPeak = 0.0f;
     for (int i = 0; i < numSamples; ++i) {
-        left[i] = leftInput[i] * dryGain + leftOutput[i] * wetGain;
-        right[i] = rightInput[i] * dryGain + rightOutput[i] * wetGain;
+        wetPeak = std::max(wetPeak, std::max(std::abs(outputs[0][i]), std::abs(outputs[1][i])));
+        left[i] = left[i] * dryGain + outputs[0][i] * wetGain;
+        right[i] = right[i] * dryGain + outputs[1][i] * wetGain;
+    }
+    
+    if (gateEnabled) {
+        if (inputPeak < kSilenceThreshold && wetPeak < kSilenceThreshold) {
+            silentSamples += numSamples;
+            if (silentSamples >= tailHoldSamples()) {
+                // Drop the sub-threshold residue so it cannot go denormal
+                // while idle or resurface when processing resumes
+                faust->instanceClear();
+                undersampler.reset();
+                idle = true;
+            }
+        } else {
+            silentSamples = 0;
+        }
+    }
+}
+
+void GreyholeReverb::clear() {
+    if (faust) {
+        faust->instanceClear();
+    }
+    undersampler.reset();
+    idle = false;
+    silentSamples = 0;
+}
+
+// ----- LateDiffReverb -----
+
+namespace {
+
+// Fixed shelf corners of the late-diffusion loop; damping sets the high
+// shelf gain, the low shelf keeps rumble from piling up in long tails
+constexpr float kLateDiffHighShelfHz = 4185.0f;
+constexpr float kLateDiffMaxDampingDb = -12.0f;
+constexpr float kLateDiffLowShelfHz = 65.0f;
+constexpr float kLateDiffLowShelfDb = -3.0f;
+constexpr float kLateDiffMaxSkew = 0.25f;       // Size knob units at delayTime 1
+
+} // namespace
+
+size_t LateDiffReverb::arenaBytes(float sampleRate) {
+    return DspArena::round(latediff::LateDiffTank::delayFloats(sampleRate) * sizeof(float));
+}
+
+LateDiffReverb::LateDiffReverb(float sampleRate, DspArena* dspArena)
+    : sampleRate(sampleRate)
+    , params{0.2f, 0.2f, 0.0f, 0.3f, 0.9f, 0.5f, 0.1f, 2.0f} {
+    const size_t floats = latediff::LateDiffTank::delayFloats(sampleRate);
+    float* memory = dspArena ? dspArena->takeArray<float>(floats) : nullptr;
+    if (memory) {
+        arena.attach(memory, floats);
+    } else {
+        arena.allocate(floats);
+    }
+    tank.setSampleRate(sampleRate, arena);
+    lfo.setSampleRate(sampleRate);
+    setParameters(params);
+}
+
+void LateDiffReverb::setParameters(const Parameters& p) {
+    params.delayTime = std::clamp(p.delayTime, 0.0f, 1.0f);
+    params.size = std::clamp(p.size, 0.0f, 1.0f);
+    params.damping = std::clamp(p.damping, 0.0f, 0.99f);
+    params.mix = std::clamp(p.mix, 0.0f, 1.0f);
+    params.decay = std::clamp(p.decay, 0.0f, 1.0f);
+    params.diffusion = std::clamp(p.diffusion, 0.0f, 0.99f);
+    params.modDepth = std::clamp(p.modDepth, 0.0f, 1.0f);
+    params.modFreq = std::clamp(p.modFreq, 0.0f, 10.0f);
+
+    mix = params.mix;
+    lfo.setDepth(params.modDepth * latediff::kMaxModulationSeconds);
+    modFreq = params.modFreq;
+
+    const float skew = params.delayTime * kLateDiffMaxSkew;
+    const float rt60 = 0.3f * latediff::exp2Table(6.643856189774724f * params.decay);   // 0.3 * 100^decay
+    const float highShelfDb = params.damping * kLateDiffMaxDampingDb;
+    tank.setControls(latediff::sizeToSemitones(params.size + skew),
+                     latediff::sizeToSemitones(params.size - skew), params.diffusion, rt60,
+                     kLateDiffHighShelfHz, highShelfDb, kLateDiffLowShelfHz, kLateDiffLowShelfDb);
+}
+
+void LateDiffReverb::setTailGateEnabled(bool enabled) {
+    gateEnabled = enabled;
+    if (!enabled) {
+        idle = false;
+        silentSamples = 0;
+    }
+}
+
+void LateDiffReverb::setHalfRate(bool enabled) {
+    if (enabled == halfRate) {
+        return;
+    }
+    halfRate = enabled;
+    // The arena holds the full-rate lines, so the half-length ones fit
+    // in its front
+    const float rate = enabled ? sampleRate * 0.5f : sampleRate;
+    arena.rewind();
+    tank.setSampleRate(rate, arena);
+    lfo.setSampleRate(rate);
+    clear();
+}
+
+void LateDiffReverb::clear() {
+    tank.clear();
+    lfo.reset(0.0f);
+    undersampler.reset();
+    idle = false;
+    silentSamples = 0;
+    // Re-prime the tanks so the delay times start at their targets
+    setParameters(params);
+}
+
+int LateDiffReverb::tailHoldSamples() const {
+    // As for Greyhole: twice the longest round trip, at least 0.5 s
+    float seconds = std::max(0.5f, 2.0f * tank.loopSeconds());
+    return static_cast<int>(seconds * sampleRate);
+}
+
+void LateDiffReverb::runTank(const float* inL, const float* inR, float* outL, float* outR, int n) {
+    // Delay modulation in seconds, one plane per LFO phase
+    float* const m[latediff::LFO8Parabolic::kPhases] = {
+        modulation[0], modulation[1], modulation[2], modulation[3],
+        modulation[4], modulation[5], modulation[6], modulation[7]};
+    lfo.process(modFreq, m, n);
+    tank.process(inL, inR, outL, outR, m, n);
+}
+
+void LateDiffReverb::process(float* left, float* right, int numSamples) {
+    const float dryGain = 1.0f - mix;
+    const float wetGain = mix;
+
+    float inputPeak = 0.0f;
+    if (gateEnabled) {
+        for (int i = 0; i < numSamples; ++i) {
+            inputPeak = std::max(inputPeak, std::max(std::abs(left[i]), std::abs(right[i])));
+        }
+        if (idle) {
+            if (inputPeak < GreyholeReverb::kSilenceThreshold) {
+                for (int i = 0; i < numSamples; ++i) {
+                    left[i] *= dryGain;
+                    right[i] *= dryGain;
+                }
+                return;
+            }
+            idle = false;
+            silentSamples = 0;
+        }
+    }
+
+    float wetPeak = 0.0f;
+    for (int start = 0; start < numSamples; start += kChunk) {
+        const int n = std::min(kChunk, numSamples - start);
+        float* l = left + start;
+        float* r = right + start;
+
+        if (halfRate) {
+            undersampler.processWet(l, r, wetL, wetR, n,
+                                    [this](float* inL, float* inR, float* outL, float* outR, int m) {
+                                        runTank(inL, inR, outL, outR, m);
+                                    });
+        } else {
+            runTank(l, r, wetL, wetR, n);
+        }
+
+        for (int i = 0; i < n; ++i) {
+            wetPeak = std::max(wetPeak, std::max(std::abs(wetL[i]), std::abs(wetR[i])));
+            l[i] = l[i] * dryGain + wetL[i] * wetGain;
+            r[i] = r[i] * dryGain + wetR[i] * wetGain;
+        }
+    }
+
+    if (gateEnabled) {
+        if (inputPeak < GreyholeReverb::kSilenceThreshold && wetPeak < GreyholeReverb::kSilenceThreshold) {
+            silentSamples += numSamples;
+            if (silentSamples >= tailHoldSamples()) {
+                clear();
+                idle = true;
+            }
+        } else {
+            silentSamples = 0;
+        }
     }
 }
@@ -2,14 +2,52 @@
 #define REVERB_H
 
 #include <vector>
+#include "latediff_tank.h"
+#include "oversampler.h"
 
-// Forward declaration of Faust-generated class
-class mydsp;
+// Forward declaration of the Faust base class (reverb/faust_base.h)
+class dsp;
+class DspArena;
 
 class GreyholeReverb {
+public:
+    // Generated Faust builds of the same Greyhole patch
+    enum class Variant {
+        Scalar,  // reverb/greyhole.cpp: per-sample loop, no FTZ
+        Vector   // reverb/greyhole_vec.cpp: -vec -vs 32 -ftz 2 (WAKEFIELD_REVERB_VEC builds)
+    };
+
+    static bool isVariantAvailable(Variant variant);
+    static Variant defaultVariant();  // Vector when compiled in, otherwise Scalar
+    static const char* variantName(Variant variant);
+
+    // Faust slider zones, resolved once at construction
+    struct Zones {
+        float* delayTime = nullptr;
+        float* size = nullptr;
+        float* damping = nullptr;
+        float* feedback = nullptr;
+        float* diffusion = nullptr;
+        float* modDepth = nullptr;
+        float* modFreq = nullptr;
+    };
+
+    // Normalized control values, same ranges as the individual setters
+    struct Parameters {
+        float delayTime;
+        float size;
+        float damping;
+        float mix;
+        float decay;
+        float diffusion;
+        float modDepth;
+        float modFreq;
+    };
+
 private:
     float sampleRate;
-    mydsp* dsp;
+    Variant variant;
+    dsp* faust;
     
     // Parameter values
     float feedback;
@@ -21,17 +59,32 @@ private:
     float damping;
     float mix;
     
-    // Buffers for stereo processing
-    std::vector<float> leftInput;
-    std::vector<float> rightInput;
-    std::vector<float> leftOutput;
-    std::vector<float> rightOutput;
-    float* inputs[2];
+    // Wet output of the Faust DSP (inputs are the caller's planes), in
+    // the arena or else in outputStorage
+    static constexpr int kOutputFrames = 512;
+    std::vector<float> outputStorage;
     float* outputs[2];
+    bool inArena = false;           // faust and outputs live in an arena
+    
+    Zones zones;
+    
+    // Half-rate mode: the Faust DSP runs at sampleRate / 2 between the
+    // undersampler's half-band filters
+    bool halfRate;
+    Undersampler undersampler;
+    
+    // Tail gate: compute is skipped once input and tail are both silent
+    bool gateEnabled;
+    bool idle;
+    int silentSamples;   // Consecutive samples of silent input and wet output
     
 public:
-    GreyholeReverb(float sampleRate);
+    // Unavailable variants fall back to Scalar. With an arena, the Faust
+    // DSP and its output buffers are taken from it (arenaBytes(variant))
+    explicit GreyholeReverb(float sampleRate, Variant variant = defaultVariant(), DspArena* arena = nullptr);
     ~GreyholeReverb();
+
+    static size_t arenaBytes(Variant variant);
     
     // Parameter setters
     void setDelayTime(float t);     // Delay time 0-1 (maps to 0.001-1.45s)
@@ -43,11 +96,109 @@ public:
     void setModDepth(float d);      // Modulation depth (0-1)
     void setModFreq(float f);       // Modulation frequency (0-10 Hz)
     
-    // Process stereo audio
+    // Apply all parameters at once, writing only the zones whose value
+    // changed. Returns the number of zones written.
+    int setParameters(const Parameters& p);
+    
+    Variant getVariant() const { return variant; }
+    
+    // Run the Faust DSP at half the sample rate (off by default): roughly
+    // half the CPU, wet signal band-limited to ~10 kHz at 48 kHz, dry and
+    // mix still at the full rate. Switching empties the delay lines
+    void setHalfRate(bool enabled);
+    bool isHalfRate() const { return halfRate; }
+    
+    // Silence below which the gate counts a block as idle (-120 dBFS)
+    static constexpr float kSilenceThreshold = 1e-6f;
+    
+    // Skip the Faust DSP while input and tail are silent (on by default)
+    void setTailGateEnabled(bool enabled);
+    bool isIdle() const { return idle; }
+    
+    // Process stereo audio in place (planar left/right)
     void process(float* left, float* right, int numSamples);
     
+    // Empty the delay lines (the next block starts from silence)
+    void clear();
+    
 private:
     void updateParameters();
+    int tailHoldSamples() const;
+    
+    // The patch's diffuser delays are prime sample counts picked by size,
+    // so half rate halves size to keep them about as long in time
+    float sizeZone() const { return halfRate ? 0.5f * size : size; }
+};
+
+// Second engine: crossbow's late-diffusion tank (latediff_tank.h), one tank
+// per side and an 8-phase LFO on the delay times. The sides swap their
+// feedback paths (a figure-eight), so the cross-coupling decays with the
+// RT60 gain; crossbow's demo added each output to the other input at unity
+// on top of the tanks' own feedback, which grows without bound. Both sides
+// run as one four-lane LateDiffTank. Takes the same normalized parameters
+// as GreyholeReverb:
+//   size       -> tank size (diffuser delays ~4 ms at 0 up to ~0.46 s at 1)
+//   delayTime  -> L/R size skew (0 = both tanks alike)
+//   decay      -> RT60 0.3-30 s
+//   damping    -> high shelf cut in the loop, 0 to -12 dB above 4.2 kHz
+//   diffusion  -> allpass coefficient
+//   modDepth   -> delay modulation, up to +-2 ms
+//   modFreq    -> LFO rate in Hz
+class LateDiffReverb {
+public:
+    using Parameters = GreyholeReverb::Parameters;
+    
+    // With an arena, the delay lines are taken from it (arenaBytes(sampleRate))
+    explicit LateDiffReverb(float sampleRate, DspArena* arena = nullptr);
+
+    static size_t arenaBytes(float sampleRate);
+    
+    // Clamps to the GreyholeReverb ranges and recomputes the tank controls
+    void setParameters(const Parameters& p);
+    
+    // Same tail gate as GreyholeReverb (on by default)
+    void setTailGateEnabled(bool enabled);
+    bool isIdle() const { return idle; }
+    
+    // As GreyholeReverb::setHalfRate: the tank and LFO run at half rate
+    void setHalfRate(bool enabled);
+    bool isHalfRate() const { return halfRate; }
+    
+    // Process stereo audio in place (planar left/right), any block length
+    void process(float* left, float* right, int numSamples);
+    
+    void clear();
+    
+    size_t delayMemoryBytes() const { return arena.bytes(); }
+    
+private:
+    float sampleRate;
+    latediff::DelayArena arena;         // Every delay line of both tanks
+    latediff::LateDiffTank tank;
+    latediff::LFO8Parabolic lfo;
+    
+    bool halfRate = false;
+    Undersampler undersampler;
+    
+    // Frames per LFO and tank pass; modulation holds one chunk of every
+    // phase, wetL/wetR the full-rate wet output
+    static constexpr int kChunk = 64;
+    float modulation[latediff::LFO8Parabolic::kPhases][kChunk];
+    float wetL[kChunk];
+    float wetR[kChunk];
+    
+    Parameters params;
+    float mix = 0.3f;
+    float modFreq = 2.0f;
+    
+    bool gateEnabled = true;
+    bool idle = false;
+    int silentSamples = 0;
+    
+    int tailHoldSamples() const;
+    
+    // LFO and tank over n frames at the tank rate (n <= kChunk)
+    void runTank(const float* inL, const float* inR, float* outL, float* outR, int n);
 };
 
 #endif // REVERB_H
@@ -0,0 +1,113 @@
+#ifndef RNG_H
+#define RNG_H
+
+#include <atomic>
+#include <cstdint>
+
+// Seeded random streams for generative playback. Every track or subsystem
+// draws from its own xoshiro128** stream, seeded with SplitMix64 from the
+// session seed and a stream id, so what it produces depends only on the
+// seed and on its own earlier draws: not on which thread ran first, not on
+// another track's activity, and the same on every run with the same seed
+// (--seed for renders; captures record the seed for --replay). A stream is
+// a few words of plain state: copy it with the object that owns it, and
+// don't share one between threads.
+namespace rng {
+
+// Stream ids: the subsystem above a per-track (or other) index
+enum class Subsystem : uint32_t {
+    TRACK_PATTERN = 1,      // A track's pattern generation and mutation
+    STEP_PROBABILITY = 2,   // A track's step probability rolls (keyed by step)
+};
+
+inline uint64_t splitMix64(uint64_t& state) {
+    uint64_t z = (state += 0x9e3779b97f4a7c15ull);
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+    return z ^ (z >> 31);
+}
+
+class Stream {
+public:
+    Stream() { seed(0); }
+    explicit Stream(uint64_t value) { seed(value); }
+
+    void seed(uint64_t value) {
+        const uint64_t a = splitMix64(value);
+        const uint64_t b = splitMix64(value);
+        s[0] = static_cast<uint32_t>(a);
+        s[1] = static_cast<uint32_t>(a >> 32);
+        s[2] = static_cast<uint32_t>(b);
+        s[3] = static_cast<uint32_t>(b >> 32);
+    }
+
+    uint32_t next() {
+        const uint32_t result = rotl(s[1] * 5u, 7) * 9u;
+        const uint32_t t = s[1] << 9;
+        s[2] ^= s[0];
+        s[3] ^= s[1];
+        s[1] ^= s[2];
+        s[0] ^= s[3];
+        s[2] ^= t;
+        s[3] = rotl(s[3], 11);
+        return result;
+    }
+
+    // A raw word mapped to 0 .. n - 1 (multiply-shift, no division), and
+    // to [0, 1) with 24 bits, as below() and uniform() map next()
+    static uint32_t scale(uint32_t word, uint32_t n) {
+        return static_cast<uint32_t>((static_cast<uint64_t>(word) * n) >> 32);
+    }
+    static float unit(uint32_t word) { return static_cast<float>(word >> 8) * (1.0f / 16777216.0f); }
+
+    uint32_t below(uint32_t n) { return scale(next(), n); }
+    float uniform() { return unit(next()); }
+    double uniformDouble() { return next() * (1.0 / 4294967296.0); }
+
+    // n draws at once, the same values n next() / uniform() calls give
+    void fill(uint32_t* out, int n) {
+        for (int i = 0; i < n; ++i) {
+            out[i] = next();
+        }
+    }
+    void fillUniform(float* out, int n) {
+        for (int i = 0; i < n; ++i) {
+            out[i] = uniform();
+        }
+    }
+
+private:
+    uint32_t s[4];
+
+    static uint32_t rotl(uint32_t x, int k) { return (x << k) | (x >> (32 - k)); }
+};
+
+// The session seed new streams start from. Set it before the objects that
+// own streams are built (the sequencer's tracks)
+inline std::atomic<uint64_t>& sessionSeedStorage() {
+    static std::atomic<uint64_t> seed{1};
+    return seed;
+}
+inline void setSessionSeed(uint64_t seed) { sessionSeedStorage().store(seed, std::memory_order_relaxed); }
+inline uint64_t sessionSeed() { return sessionSeedStorage().load(std::memory_order_relaxed); }
+
+// The key of a subsystem and index under the session seed, and the stream
+// it seeds
+inline uint64_t key(Subsystem subsystem, uint32_t index) {
+    uint64_t mix = sessionSeed() ^ ((static_cast<uint64_t>(subsystem) << 32) | index);
+    return splitMix64(mix);
+}
+inline Stream stream(Subsystem subsystem, uint32_t index) { return Stream(key(subsystem, index)); }
+
+// Counter-based draws: the word at position n of the sequence named by
+// key, computed rather than stepped to, so it is the same whichever thread
+// asks, in whatever order and however often. For rolls that must come out
+// the same whether they are made ahead of time or when they fall due
+inline uint32_t at(uint64_t key, uint64_t n) {
+    uint64_t mix = key ^ (n * 0xd1342543de82ef95ull);
+    return static_cast<uint32_t>(splitMix64(mix) >> 32);
+}
+
+} // namespace rng
+
+#endif // RNG_H
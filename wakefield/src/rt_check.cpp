@@ -0,0 +1,155 @@
+#include "rt_check.h"
+
+#ifdef WAKEFIELD_RT_CHECK
+
+#include <atomic>
+#include <cerrno>
+#include <cstddef>
+#include <cstdio>
+#include <dlfcn.h>
+#include <execinfo.h>
+#include <pthread.h>
+#include <unistd.h>
+
+// glibc's underlying allocator entry points; the interposed versions below
+// forward to these so no dlsym lookup is needed on the allocation path
+extern "C" {
+void* __libc_malloc(size_t size);
+void* __libc_calloc(size_t count, size_t size);
+void* __libc_realloc(void* ptr, size_t size);
+void* __libc_memalign(size_t alignment, size_t size);
+void __libc_free(void* ptr);
+}
+
+namespace {
+
+typedef int (*MutexFn)(pthread_mutex_t*);
+
+// initial-exec TLS never allocates on first access
+__thread int scopeDepth __attribute__((tls_model("initial-exec"))) = 0;
+__thread bool reporting __attribute__((tls_model("initial-exec"))) = false;
+
+std::atomic<unsigned long> violations{0};
+std::atomic<MutexFn> realMutexLock{nullptr};
+std::atomic<MutexFn> realMutexTrylock{nullptr};
+
+constexpr unsigned long kMaxReports = 64;  // Later violations are only counted
+constexpr int kMaxFrames = 32;
+
+MutexFn resolve(std::atomic<MutexFn>& slot, const char* name) {
+    MutexFn fn = slot.load(std::memory_order_acquire);
+    if (!fn) {
+        fn = reinterpret_cast<MutexFn>(dlsym(RTLD_NEXT, name));
+        slot.store(fn, std::memory_order_release);
+    }
+    return fn;
+}
+
+void report(const char* call) {
+    if (scopeDepth == 0 || reporting) {
+        return;
+    }
+    reporting = true;  // backtrace() and stderr may allocate or lock themselves
+
+    unsigned long count = violations.fetch_add(1, std::memory_order_relaxed) + 1;
+    if (count <= kMaxReports) {
+        char line[128];
+        int len = std::snprintf(line, sizeof(line),
+                                "[rt-check] %s in audio callback (violation %lu)\n", call, count);
+        if (len > 0) {
+            ssize_t ignored = write(STDERR_FILENO, line, static_cast<size_t>(len));
+            (void)ignored;
+        }
+        void* frames[kMaxFrames];
+        int depth = backtrace(frames, kMaxFrames);
+        // Skip report() itself
+        backtrace_symbols_fd(frames + 1, depth - 1, STDERR_FILENO);
+    }
+
+    reporting = false;
+}
+
+} // namespace
+
+namespace rtcheck {
+
+void install() {
+    resolve(realMutexLock, "pthread_mutex_lock");
+    resolve(realMutexTrylock, "pthread_mutex_trylock");
+
+    // The first backtrace() dlopens the unwinder; do that outside the callback
+    void* frames[1];
+    backtrace(frames, 1);
+}
+
+void enter() {
+    ++scopeDepth;
+}
+
+void leave() {
+    --scopeDepth;
+}
+
+unsigned long violationCount() {
+    return violations.load(std::memory_order_relaxed);
+}
+
+} // namespace rtcheck
+
+extern "C" {
+
+void* malloc(size_t size) {
+    report("malloc");
+    return __libc_malloc(size);
+}
+
+void* calloc(size_t count, size_t size) {
+    report("calloc");
+    return __libc_calloc(count, size);
+}
+
+void* realloc(void* ptr, size_t size) {
+    report("realloc");
+    return __libc_realloc(ptr, size);
+}
+
+void free(void* ptr) {
+    if (ptr) {
+        report("free");
+    }
+    __libc_free(ptr);
+}
+
+void* memalign(size_t alignment, size_t size) {
+    report("memalign");
+    return __libc_memalign(alignment, size);
+}
+
+void* aligned_alloc(size_t alignment, size_t size) {
+    report("aligned_alloc");
+    return __libc_memalign(alignment, size);
+}
+
+int posix_memalign(void** out, size_t alignment, size_t size) {
+    report("posix_memalign");
+    void* ptr = __libc_memalign(alignment, size);
+    if (!ptr) {
+        return ENOMEM;
+    }
+    *out = ptr;
+    return 0;
+}
+
+int pthread_mutex_lock(pthread_mutex_t* mutex) {
+    report("pthread_mutex_lock");
+    return resolve(realMutexLock, "pthread_mutex_lock")(mutex);
+}
+
+int pthread_mutex_trylock(pthread_mutex_t* mutex) {
+    report("pthread_mutex_trylock");
+    return resolve(realMutexTrylock, "pthread_mutex_trylock")(mutex);
+}
+
+} // extern "C"
+
+#endif // WAKEFIELD_RT_CHECK
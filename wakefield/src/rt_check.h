@@ -0,0 +1,40 @@
+#ifndef RT_CHECK_H
+#define RT_CHECK_H
+
+// Real-time safety checker for the audio callback.
+//
+// Configure with -DWAKEFIELD_RT_CHECK=ON to interpose malloc/free and the
+// pthread mutex lock calls. Any of them made while the audio thread is inside
+// an RtCheckScope prints the call and its stack to stderr, so run the
+// instrumented build as `./synth 2> rt_check.log`. In a normal build the scope
+// is an empty object and install() does nothing.
+#ifdef WAKEFIELD_RT_CHECK
+
+namespace rtcheck {
+void install();                 // Resolve interposed symbols; call before the stream opens
+void enter();                   // Mark the calling thread as real-time
+void leave();
+unsigned long violationCount(); // Total offending calls seen so far
+}
+
+struct RtCheckScope {
+    RtCheckScope() { rtcheck::enter(); }
+    ~RtCheckScope() { rtcheck::leave(); }
+    RtCheckScope(const RtCheckScope&) = delete;
+    RtCheckScope& operator=(const RtCheckScope&) = delete;
+};
+
+#else
+
+namespace rtcheck {
+inline void install() {}
+inline unsigned long violationCount() { return 0; }
+}
+
+struct RtCheckScope {
+    RtCheckScope() {}
+};
+
+#endif
+
+#endif // RT_CHECK_H
@@ -0,0 +1,106 @@
+#include "rt_log.h"
+#include <ctime>
+
+RtLog::~RtLog() {
+    stop();
+}
+
+void RtLog::start(const std::string& logPath) {
+    stop();
+    std::lock_guard<std::mutex> lock(mutex);
+    path = logPath;
+    stopping = false;
+    thread = std::thread(&RtLog::worker, this);
+}
+
+void RtLog::stop() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    wake.notify_all();
+    if (thread.joinable()) {
+        thread.join();
+    }
+}
+
+bool RtLog::pollRecord(Record& record) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (pending.empty()) {
+        return false;
+    }
+    record = pending.front();
+    pending.pop_front();
+    return true;
+}
+
+std::string RtLog::describe(const Record& record) {
+    char text[96];
+    switch (record.event) {
+        case Event::STREAM_UNDERFLOW:
+            std::snprintf(text, sizeof(text), "stream underflow (status 0x%x)", static_cast<unsigned>(record.a));
+            break;
+        case Event::CC_LEARNED:
+            std::snprintf(text, sizeof(text), "learned CC#%d for target %d", record.a, record.b);
+            break;
+        case Event::LOOP_STORAGE_STARVED:
+            std::snprintf(text, sizeof(text), "loop storage starved (%d chunk requests unmet)", record.a);
+            break;
+        default:
+            std::snprintf(text, sizeof(text), "event %u (%d, %d)", static_cast<unsigned>(record.event),
+                          record.a, record.b);
+            break;
+    }
+    return text;
+}
+
+void RtLog::worker() {
+    // The audio thread cannot signal without a syscall, so the ring is polled
+    FILE* file = path.empty() ? nullptr : std::fopen(path.c_str(), "a");
+    std::unique_lock<std::mutex> lock(mutex);
+    while (!stopping) {
+        wake.wait_for(lock, std::chrono::milliseconds(kDrainIntervalMs), [this] { return stopping; });
+        lock.unlock();
+        drain(file);
+        lock.lock();
+    }
+    lock.unlock();
+    drain(file);
+    if (file) {
+        std::fclose(file);
+    }
+}
+
+void RtLog::drain(FILE* file) {
+    // Steady time is printed as wall time: map it through one pair of readings
+    const auto steadyNow = std::chrono::steady_clock::now().time_since_epoch();
+    const auto wallNow = std::chrono::system_clock::now().time_since_epoch();
+    const int64_t steadyToWallNs = std::chrono::duration_cast<std::chrono::nanoseconds>(wallNow - steadyNow).count();
+
+    Record record;
+    while (ring.pop(record)) {
+        if (file) {
+            const int64_t wallNs = static_cast<int64_t>(record.timeNs) + steadyToWallNs;
+            const time_t seconds = static_cast<time_t>(wallNs / 1000000000);
+            struct tm local;
+            localtime_r(&seconds, &local);
+            char stamp[32];
+            std::strftime(stamp, sizeof(stamp), "%Y-%m-%d %H:%M:%S", &local);
+            std::fprintf(file, "%s.%03d %s\n", stamp, static_cast<int>(wallNs / 1000000 % 1000),
+                         describe(record).c_str());
+        }
+        std::lock_guard<std::mutex> lock(mutex);
+        if (pending.size() == kMaxPendingRecords) {
+            pending.pop_front();
+        }
+        pending.push_back(record);
+    }
+    const uint32_t drops = dropped.load(std::memory_order_relaxed);
+    if (file && drops != reportedDrops) {
+        std::fprintf(file, "(%u records dropped: log ring full)\n", drops - reportedDrops);
+    }
+    reportedDrops = drops;
+    if (file) {
+        std::fflush(file);
+    }
+}
@@ -0,0 +1,89 @@
+#ifndef RT_LOG_H
+#define RT_LOG_H
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include "spsc_queue.h"
+
+// Diagnostics from the audio callback without printing on it. The callback
+// posts fixed-size records (an event code and two integers, nothing to
+// format or allocate) into a lock-free ring; a background thread drains it
+// every kDrainIntervalMs, appends a text line per record to the log file
+// and keeps the records for the UI loop, which turns them into console
+// messages. A full ring drops the record and counts it, so a cascade of
+// xruns cannot feed back into the callback.
+//
+// One producer: post only from the audio callback thread.
+class RtLog {
+public:
+    enum class Event : uint16_t {
+        STREAM_UNDERFLOW,       // a: RtAudio stream status bits
+        CC_LEARNED,             // a: controller, b: learn target
+        LOOP_STORAGE_STARVED,   // a: chunk requests that found the free list empty, in total
+        COUNT
+    };
+
+    struct Record {
+        uint64_t timeNs;        // steady_clock
+        Event event;
+        int32_t a;
+        int32_t b;
+    };
+
+    static constexpr int kDrainIntervalMs = 50;
+    static constexpr size_t kMaxPendingRecords = 64;    // Kept for the UI; older ones are dropped
+
+    RtLog() = default;
+    ~RtLog();
+
+    // Start the drain thread, appending to path (empty: no file)
+    void start(const std::string& path);
+    void stop();
+
+    // Audio thread: false if the ring was full
+    bool post(Event event, int32_t a = 0, int32_t b = 0) {
+        const uint64_t now = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count());
+        if (ring.push(Record{now, event, a, b})) {
+            return true;
+        }
+        dropped.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    // UI thread: the next drained record, oldest first
+    bool pollRecord(Record& record);
+
+    // Records lost to a full ring since start
+    uint32_t getDroppedCount() const { return dropped.load(std::memory_order_relaxed); }
+
+    // The log file's text for a record, without timestamp or newline
+    static std::string describe(const Record& record);
+
+    RtLog(const RtLog&) = delete;
+    RtLog& operator=(const RtLog&) = delete;
+
+private:
+    void worker();
+    void drain(FILE* file);
+
+    SpscQueue<Record, 256> ring;
+    std::atomic<uint32_t> dropped{0};
+
+    std::mutex mutex;                   // Guards pending and stopping
+    std::condition_variable wake;
+    std::deque<Record> pending;
+    bool stopping = false;
+    std::string path;
+    uint32_t reportedDrops = 0;         // Worker only
+    std::thread thread;
+};
+
+#endif // RT_LOG_H
@@ -0,0 +1,44 @@
+#ifndef RT_SEMAPHORE_H
+#define RT_SEMAPHORE_H
+
+#ifdef __APPLE__
+#include <dispatch/dispatch.h>
+#else
+#include <semaphore.h>
+#endif
+
+// Counting semaphore for waking the audio helper threads. post() is a
+// single atomic plus, when someone sleeps, a futex wake: no lock is taken,
+// so it is safe on the audio thread. tryWait() never blocks.
+class RtSemaphore {
+public:
+#ifdef __APPLE__
+    RtSemaphore() : sem(dispatch_semaphore_create(0)) {}
+    ~RtSemaphore() { dispatch_release(sem); }
+    void post() { dispatch_semaphore_signal(sem); }
+    void wait() { dispatch_semaphore_wait(sem, DISPATCH_TIME_FOREVER); }
+    bool tryWait() { return dispatch_semaphore_wait(sem, DISPATCH_TIME_NOW) == 0; }
+#else
+    RtSemaphore() { sem_init(&sem, 0, 0); }
+    ~RtSemaphore() { sem_destroy(&sem); }
+    void post() { sem_post(&sem); }
+    void wait() {
+        while (sem_wait(&sem) != 0) {
+            // EINTR: a signal arrived while sleeping
+        }
+    }
+    bool tryWait() { return sem_trywait(&sem) == 0; }
+#endif
+
+    RtSemaphore(const RtSemaphore&) = delete;
+    RtSemaphore& operator=(const RtSemaphore&) = delete;
+
+private:
+#ifdef __APPLE__
+    dispatch_semaphore_t sem;
+#else
+    sem_t sem;
+#endif
+};
+
+#endif // RT_SEMAPHORE_H
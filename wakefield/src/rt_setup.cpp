@@ -0,0 +1,73 @@
+#include "rt_setup.h"
+#include <cerrno>
+#include <sched.h>
+#include <sys/mman.h>
+
+namespace rtsetup {
+
+bool pinThread(pthread_t thread, int cpu) {
+#ifdef __linux__
+    if (cpu < 0 || cpu >= CPU_SETSIZE) {
+        return false;
+    }
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    return pthread_setaffinity_np(thread, sizeof(set), &set) == 0;
+#else
+    (void)thread;
+    (void)cpu;
+    return false;
+#endif
+}
+
+void configureAudioThread(const Options& options, Status& status) {
+    if (options.audioCpu >= 0) {
+        bool pinned = pinThread(pthread_self(), options.audioCpu);
+        status.audioAffinity.store(pinned ? Result::ACTIVE : Result::FAILED, std::memory_order_relaxed);
+    }
+
+    int policy = -1;
+    sched_param param{};
+    if (pthread_getschedparam(pthread_self(), &policy, &param) == 0) {
+        status.schedulePolicy.store(policy, std::memory_order_relaxed);
+        status.schedulePriority.store(param.sched_priority, std::memory_order_relaxed);
+    }
+    if (options.realtime) {
+        bool granted = policy == SCHED_FIFO || policy == SCHED_RR;
+        status.schedule.store(granted ? Result::ACTIVE : Result::FAILED, std::memory_order_relaxed);
+    }
+}
+
+void configureUiThread(const Options& options, Status& status) {
+    if (options.uiCpu < 0) {
+        status.uiAffinity = Result::OFF;
+        return;
+    }
+    status.uiAffinity = pinThread(pthread_self(), options.uiCpu) ? Result::ACTIVE : Result::FAILED;
+}
+
+void lockMemory(const Options& options, Status& status) {
+    if (!options.lockMemory) {
+        status.memoryLock = Result::OFF;
+        return;
+    }
+    if (mlockall(MCL_CURRENT | MCL_FUTURE) == 0) {
+        status.memoryLock = Result::ACTIVE;
+        status.memoryLockError = 0;
+    } else {
+        status.memoryLock = Result::FAILED;
+        status.memoryLockError = errno;
+    }
+}
+
+const char* policyName(int policy) {
+    switch (policy) {
+        case SCHED_OTHER: return "SCHED_OTHER";
+        case SCHED_FIFO: return "SCHED_FIFO";
+        case SCHED_RR: return "SCHED_RR";
+        default: return "unknown";
+    }
+}
+
+} // namespace rtsetup
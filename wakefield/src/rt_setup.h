@@ -0,0 +1,60 @@
+#ifndef RT_SETUP_H
+#define RT_SETUP_H
+
+#include <atomic>
+#include <pthread.h>
+
+// Real-time setup of the process: SCHED_FIFO for the audio thread, CPU
+// pinning for the audio and UI threads, and locked memory. Options come from
+// device_config.txt or the command line; Status records what actually took
+// effect for the Config page.
+namespace rtsetup {
+
+struct Options {
+    bool realtime = false;      // Ask RtAudio for SCHED_FIFO (RTAUDIO_SCHEDULE_REALTIME)
+    int priority = 70;          // SCHED_FIFO priority, 1-99
+    int audioCpu = -1;          // Core for the audio callback, -1 = any
+    int uiCpu = -1;             // Core for the UI and sample streaming threads, -1 = any
+    bool lockMemory = false;    // mlockall once the sample bank is loaded
+};
+
+enum class Result : int {
+    OFF = 0,        // Not requested
+    PENDING,        // Requested, not applied yet (audio thread not started)
+    ACTIVE,
+    FAILED
+};
+
+struct Status {
+    // Written once by the audio thread, read by the UI
+    std::atomic<Result> schedule{Result::OFF};
+    std::atomic<int> schedulePolicy{-1};
+    std::atomic<int> schedulePriority{0};
+    std::atomic<Result> audioAffinity{Result::OFF};
+
+    // UI thread only
+    Result uiAffinity = Result::OFF;
+    Result memoryLock = Result::OFF;
+    int memoryLockError = 0;    // errno of a failed mlockall
+};
+
+// Pin a thread to one core. False if the core does not exist or the
+// platform has no affinity API (everything but Linux)
+bool pinThread(pthread_t thread, int cpu);
+
+// Audio thread, first callback: pin it, then record the scheduling class
+// and priority RtAudio really gave it
+void configureAudioThread(const Options& options, Status& status);
+
+// UI thread, after the audio and helper threads exist (so they do not
+// inherit the UI core): pin the calling thread
+void configureUiThread(const Options& options, Status& status);
+
+// mlockall(MCL_CURRENT | MCL_FUTURE) once the samples are loaded
+void lockMemory(const Options& options, Status& status);
+
+const char* policyName(int policy);
+
+} // namespace rtsetup
+
+#endif // RT_SETUP_H
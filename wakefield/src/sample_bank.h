@@ -1,30 +1,163 @@
 #ifndef SAMPLE_BANK_H
 #define SAMPLE_BANK_H
 
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
 #include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
 #include <vector>
 #include <string>
+#include "memory_stats.h"
+
+class SampleStream;
+
+// Memory behind the audio of samples with the same content: the decoded
+// buffer and overview, or the file or cache blob mapping they point into.
+// Freed with the last SampleData that references it
+struct SharedAudio {
+    const int16_t* samples = nullptr;
+    const int16_t* overview = nullptr;
+    bool ownsSamples = false;
+    bool ownsOverview = false;
+    const uint8_t* mappedFile = nullptr;
+    size_t mappedSize = 0;
+
+    ~SharedAudio();
+};
+
+// Decimated copies of a resident sample for pitched-up playback. Level k
+// is the level below it (samples[] for level 0) through a half-band
+// lowpass, keeping every other frame, so its frame j sits at frame
+// j << (k + 1) of samples[]. Like samples[], before gain
+struct SampleMips {
+    static constexpr int kLevels = 3;
+
+    // A frame of level k draws on fewer than kReach << (k + 1) frames of
+    // samples[] either side of its own
+    static constexpr uint32_t kReach = 24;
+
+    std::vector<int16_t> level[kLevels];
+
+    size_t bytes() const {
+        size_t total = 0;
+        for (const auto& l : level) {
+            total += l.size() * sizeof(int16_t);
+        }
+        return total;
+    }
+};
 
 // Audio sample data in Q15 format (16-bit signed PCM)
+//
+// The WAV file stays memory-mapped after loading and audio is prepared on
+// first use (SampleBank::acquireSample). 16-bit mono files are played
+// straight from the mapped pages; other formats are decoded into an owned
+// buffer and the mapping is released. Preparing also builds a min/max
+// overview pyramid so waveform views cost O(width) at any zoom.
+//
+// With a cache directory set, prepared audio is also written there as a
+// .q15 blob (normalized mono Q15 plus a min/max overview) and later loads
+// map the blob instead of the WAV, arriving already prepared.
+//
+// FLAC files load like WAV files but are always decoded (flac_reader.h):
+// never played from the mapping, and never streamed, since the stream
+// reads PCM straight from the file. Directory loads decode them on their
+// workers, straight into the cache when one is set.
+//
+// Samples over the bank's streaming threshold are prepared as a
+// SampleStream instead: samples points at the resident preroll and every
+// other frame must be read through stream->frame().
+//
+// Resident samples also get a loop-point analysis when they are prepared:
+// where the signal rises through zero and a coarse RMS envelope, which
+// SamplerConfig::loopBoundaries uses to snap loops to clean splice points.
+//
+// Resident samples with identical audio (the same WAV under another name
+// or folder) share one copy: the bank hashes prepared audio and points a
+// duplicate's samples and overview at the first copy's memory, which then
+// lives in a SharedAudio until no entry uses it.
+//
+// With a resample rate set, resident samples recorded at another rate are
+// converted to it while they are prepared, and sampleRate reports the new
+// rate; streamed samples keep their own.
+//
+// With mip levels on, resident samples also get decimated copies at 1/2,
+// 1/4 and 1/8 of their rate (SampleMips), which the sampler reads instead
+// when it plays them pitched up.
+//
+// What the bank holds counts towards the samples memory budget
+// (memory_stats.h). Over it, evictOverBudget() releases the least recently
+// acquired samples no sampler holds; an evicted entry keeps its name and
+// path, and the next acquireSample() maps and prepares it again.
 struct SampleData {
-    int16_t* samples;           // Q15 sample data (mono)
+    // Overview level 0 holds one (min, max) pair per kOverviewBaseFrames
+    // frames; each further level halves the resolution, down to one pair
+    static constexpr uint32_t kOverviewBaseFrames = 64;
+
+    // One rmsEnvelope entry per kRmsFrames frames
+    static constexpr uint32_t kRmsFrames = 256;
+
+    const int16_t* samples;     // Q15 sample data (mono), nullptr until prepared
     uint32_t sampleCount;       // Number of samples
-    uint32_t sampleRate;        // Original sample rate (Hz)
+    uint32_t sampleRate;        // Sample rate of samples[] (Hz)
+    float gain;                 // Playback gain (-3 dB normalization for mapped data)
     std::string name;           // Sample name (filename without extension)
     std::string path;           // Full file path
+    uint64_t sourceSize;        // Source file size and mtime (cache key)
+    int64_t sourceMtime;        // Nanoseconds since the epoch
+    const int16_t* overview;    // Min/max pyramid (resident samples only)
+    uint32_t overviewLevels;
+    SampleStream* stream;       // Disk-streaming backend, or nullptr if resident
+
+    // Loop-point analysis (resident samples; empty until prepared)
+    std::vector<uint32_t> zeroCrossings;    // Frames i with samples[i - 1] < 0 <= samples[i], ascending
+    std::vector<uint16_t> rmsEnvelope;      // RMS of samples[] (before gain) per kRmsFrames frames
+    uint64_t contentHash;                   // Of samples[], gain and rate; 0 until analyzed
+    std::shared_ptr<SharedAudio> shared;    // Owns samples/overview when shared with duplicates
+    std::shared_ptr<const SampleMips> mips; // Decimated copies (SampleBank::setMipLevels), or null
+    uint64_t lastUse;                       // The bank's acquire count when last acquired
+
+    // Source file mapping and format, kept until the audio is prepared
+    const uint8_t* mappedFile;
+    size_t mappedSize;
+    uint32_t dataOffset;        // Byte offset of the data chunk payload (FLAC: the first frame)
+    uint32_t dataSize;          // Data chunk payload size in bytes (FLAC: the frames)
+    uint16_t channels;
+    uint16_t bitsPerSample;
+    bool flac;                  // Source is FLAC, decoded when prepared
+    bool ownsSamples;           // samples was allocated with new[]
+    bool ownsOverview;          // overview was allocated with new[]
 
     SampleData()
         : samples(nullptr)
         , sampleCount(0)
         , sampleRate(48000)
+        , gain(1.0f)
         , name("")
-        , path("") {}
+        , path("")
+        , sourceSize(0)
+        , sourceMtime(0)
+        , overview(nullptr)
+        , overviewLevels(0)
+        , stream(nullptr)
+        , contentHash(0)
+        , lastUse(0)
+        , mappedFile(nullptr)
+        , mappedSize(0)
+        , dataOffset(0)
+        , dataSize(0)
+        , channels(1)
+        , bitsPerSample(16)
+        , flac(false)
+        , ownsSamples(false)
+        , ownsOverview(false) {}
 
     ~SampleData() {
-        if (samples) {
-            delete[] samples;
-            samples = nullptr;
-        }
+        release();
     }
 
     // Prevent copying (to avoid double-free)
@@ -32,29 +165,75 @@ struct SampleData {
     SampleData& operator=(const SampleData&) = delete;
 
     // Allow moving
-    SampleData(SampleData&& other) noexcept
-        : samples(other.samples)
-        , sampleCount(other.sampleCount)
-        , sampleRate(other.sampleRate)
-        , name(std::move(other.name))
-        , path(std::move(other.path)) {
-        other.samples = nullptr;
-        other.sampleCount = 0;
+    SampleData(SampleData&& other) noexcept {
+        takeFrom(other);
     }
 
     SampleData& operator=(SampleData&& other) noexcept {
         if (this != &other) {
-            if (samples) delete[] samples;
-            samples = other.samples;
-            sampleCount = other.sampleCount;
-            sampleRate = other.sampleRate;
-            name = std::move(other.name);
-            path = std::move(other.path);
-            other.samples = nullptr;
-            other.sampleCount = 0;
+            release();
+            takeFrom(other);
         }
         return *this;
     }
+
+    // Drop the decoded buffer, the overview and/or the file mapping
+    void release();
+
+    bool isPrepared() const { return samples != nullptr; }
+    bool isAnalyzed() const { return !rmsEnvelope.empty(); }
+
+    // RMS (before gain) around a frame, from the envelope; 0 if not analyzed
+    uint16_t rmsAt(uint32_t frame) const {
+        if (rmsEnvelope.empty()) {
+            return 0;
+        }
+        const size_t bucket = std::min<size_t>(frame / kRmsFrames, rmsEnvelope.size() - 1);
+        return rmsEnvelope[bucket];
+    }
+
+    // (min, max) pairs of one overview level, or nullptr if the level
+    // doesn't exist; buckets receives the number of pairs
+    const int16_t* overviewLevel(uint32_t level, uint32_t& buckets) const;
+
+private:
+    void takeFrom(SampleData& other) {
+        samples = other.samples;
+        sampleCount = other.sampleCount;
+        sampleRate = other.sampleRate;
+        gain = other.gain;
+        name = std::move(other.name);
+        path = std::move(other.path);
+        sourceSize = other.sourceSize;
+        sourceMtime = other.sourceMtime;
+        overview = other.overview;
+        overviewLevels = other.overviewLevels;
+        stream = other.stream;
+        zeroCrossings = std::move(other.zeroCrossings);
+        rmsEnvelope = std::move(other.rmsEnvelope);
+        contentHash = other.contentHash;
+        shared = std::move(other.shared);
+        mips = std::move(other.mips);
+        lastUse = other.lastUse;
+        mappedFile = other.mappedFile;
+        mappedSize = other.mappedSize;
+        dataOffset = other.dataOffset;
+        dataSize = other.dataSize;
+        channels = other.channels;
+        bitsPerSample = other.bitsPerSample;
+        flac = other.flac;
+        ownsSamples = other.ownsSamples;
+        ownsOverview = other.ownsOverview;
+        other.samples = nullptr;
+        other.sampleCount = 0;
+        other.overview = nullptr;
+        other.overviewLevels = 0;
+        other.stream = nullptr;
+        other.mappedFile = nullptr;
+        other.mappedSize = 0;
+        other.ownsSamples = false;
+        other.ownsOverview = false;
+    }
 };
 
 class SampleBank {
@@ -62,13 +241,56 @@ public:
     SampleBank();
     ~SampleBank();
 
-    // Load all WAV files from a directory
+    // Load all WAV and FLAC files from a directory, in sorted filename
+    // order, parsing them (and decoding FLAC) on a small worker pool.
     // Returns number of samples loaded
     int loadSamplesFromDirectory(const char* directory);
 
-    // Get sample by index (nullptr if out of range)
+    // loadSamplesFromDirectory in two steps, so a directory can load while
+    // the engine runs (startup.h). parseDirectory maps, parses and prepares
+    // the files on its worker pool without touching the bank, and may run
+    // on another thread while the owner uses the bank; adoptDirectory adds
+    // the samples, on the owner's thread
+    struct DirectoryLoad {
+        struct File {
+            std::string name;
+            std::string path;
+            SampleData* sample = nullptr;   // nullptr and error set if it failed
+            std::string error;
+            double seconds = 0.0;
+            size_t bytes = 0;               // Mapped file size, read before resampling unmaps it
+            bool resampled = false;
+            bool decoded = false;           // FLAC decoded on the worker
+            bool mipped = false;            // Prepared on the worker for its mip levels
+        };
+        std::string directory;
+        bool opened = false;
+        std::vector<File> files;            // Sorted by name
+        double seconds = 0.0;
+        size_t workers = 0;
+        std::string summary;                // Set by adoptDirectory: count, throughput, failures
+    };
+    DirectoryLoad parseDirectory(const char* directory);
+
+    // Returns the number of samples added. logEachFile prints a line per
+    // file to stdout, as loadSamplesFromDirectory does
+    int adoptDirectory(DirectoryLoad& load, bool logEachFile);
+
+    // Get sample by index (nullptr if out of range); its audio may not be
+    // prepared yet (samples == nullptr)
     const SampleData* getSample(int index) const;
 
+    // Get sample by index with its audio ready, mapping or decoding it on
+    // first use. Call from a non-audio thread
+    const SampleData* acquireSample(int index);
+
+    // Ask the kernel to start reading the mapped files of several samples
+    // about to be acquired (a session's samplers), so their reads overlap
+    // instead of each acquireSample() waiting on its own in turn. Returns
+    // at once; samples over the streaming threshold are left to their
+    // streams. Call from a non-audio thread
+    void prefetchSamples(const int* indices, int count) const;
+
     // Get number of loaded samples
     int getSampleCount() const { return static_cast<int>(samples.size()); }
 
@@ -81,16 +303,171 @@ public:
     // Clear all loaded samples
     void clear();
 
-    // Load a single WAV file dynamically and return its index (-1 on error)
+    // Load a single WAV or FLAC file dynamically and return its index (-1
+    // on error). If the path is already loaded but the file changed on
+    // disk, the new audio replaces it at the same index and the old
+    // SampleData is retired (samplers may still be playing it). Call from a
+    // non-audio thread
     int loadSingleFile(const char* filepath);
 
+    // The slow half of loadSingleFile for a background loader: map, parse
+    // and prepare a WAV or FLAC file without touching the bank. Safe to
+    // call from one other thread while the owner uses the bank. Returns
+    // nullptr and sets error on failure
+    SampleData* loadDetached(const char* filepath, std::string& error);
+
+    // Add a sample from loadDetached and return its index. An entry for the
+    // same path is replaced and retired as in loadSingleFile
+    int adoptSample(SampleData* sample);
+
+    // Drop a sample from loadDetached that will not be adopted
+    void discardDetached(SampleData* sample);
+
+    // Index of the prepared sample loaded from filepath while it had this
+    // size and mtime (nanoseconds), or -1 if it needs loading
+    int findPreparedFile(const std::string& filepath, uint64_t size, int64_t mtime) const;
+
+    // True if sample was replaced by a reload and awaits reclaimRetired
+    bool isRetired(const SampleData* sample) const;
+
+    // Delete retired samples that no sampler can reach any more. The caller
+    // guarantees the audio thread only references the samples in inUse
+    void reclaimRetired(const SampleData* const* inUse, int count);
+
+    // While the samples budget is exceeded, release the audio of the least
+    // recently acquired samples outside inUse (same guarantee as
+    // reclaimRetired). Returns the number evicted
+    int evictOverBudget(const SampleData* const* inUse, int count);
+
+    // Bytes the bank holds: owned audio, overviews and mip levels, file and
+    // cache mappings of prepared samples, streams. Audio shared between
+    // duplicates counts once
+    uint64_t getMemoryBytes() const { return memory.get(); }
+
+    // Directory for preconverted .q15 blobs (must exist; empty disables
+    // the cache). Set before loading
+    void setCacheDirectory(const std::string& directory) { cacheDirectory = directory; }
+    const std::string& getCacheDirectory() const { return cacheDirectory; }
+
+    // Samples whose decoded Q15 data would exceed this many bytes are
+    // streamed from disk instead of being held in memory
+    void setStreamingThreshold(size_t bytes) { streamingThresholdBytes = bytes; }
+    size_t getStreamingThreshold() const { return streamingThresholdBytes; }
+
+    // Convert resident samples to this rate (Hz) when they are prepared, so
+    // unity-speed playback reads them without interpolating (0 = keep each
+    // sample's own rate). Directory loads do the conversion on their
+    // workers. Set before loading
+    void setResampleRate(uint32_t rate) { resampleRate = rate; }
+    uint32_t getResampleRate() const { return resampleRate; }
+
+    // Build SampleMips for resident samples when they are prepared, so
+    // pitched-up playback reads a level that has no content above its
+    // Nyquist rate. Directory loads prepare resident samples on their
+    // workers to do it there. Costs 7/8 of the sample's memory again.
+    // Set before loading
+    void setMipLevels(bool enabled) { mipLevels = enabled; }
+    bool getMipLevels() const { return mipLevels; }
+
+    // Keep the disk streaming thread on one core (-1 = any), now and
+    // whenever it is restarted
+    void setStreamThreadCpu(int cpu);
+
+    // Sample loads since start that found a valid cache blob / had to decode
+    // (only counted while a cache directory is set)
+    uint64_t getCacheHits() const { return cacheHits.load(std::memory_order_relaxed); }
+    uint64_t getCacheMisses() const { return cacheMisses.load(std::memory_order_relaxed); }
+
+    // Frames the audio thread found missing, summed over the current streams
+    uint64_t getStreamUnderruns();
+
+    // Convert various bit depths to Q15 mono (also used by SampleStream)
+    static void convertToQ15Mono(const uint8_t* srcData, uint32_t srcBytes,
+                                 int16_t* dst, uint32_t dstSamples,
+                                 int channels, int bitsPerSample);
+
 private:
+    // The audio thread holds SampleData pointers, never indices, so this
+    // vector may reallocate while samples play
     std::vector<SampleData*> samples;
+    std::vector<SampleData*> retiredSamples;
+    std::string cacheDirectory;
+    size_t streamingThresholdBytes;
+    uint32_t resampleRate;
+    bool mipLevels;
+    mutable std::atomic<uint64_t> cacheHits{0};
+    mutable std::atomic<uint64_t> cacheMisses{0};
+    memstats::Account memory{memstats::SAMPLES};
+    uint64_t useClock = 0;      // acquireSample() calls, for SampleData::lastUse
+
+    // Streams and the I/O thread that fills them (started with the first
+    // stream, stopped by clear())
+    std::vector<SampleStream*> streams;
+    std::mutex streamsMutex;
+    std::thread streamThread;
+    std::atomic<bool> streamThreadRunning;
+    std::atomic<int> streamThreadCpu{-1};
 
-    // Load a single WAV file
+    void startStream(SampleStream* stream);
+    // Take a stream off the I/O thread's list before it is deleted
+    void dropStream(SampleStream* stream);
+    void stopStreamThread();
+    void streamWorker();
+
+    // Recount what the bank holds into memory, after anything that changes it
+    void account();
+
+    // Map and parse an evicted sample's file again, in place
+    bool reopenSample(SampleData* sample);
+
+    // Map a WAV file and parse its headers (audio is prepared on first use)
     // Returns true on success
     bool loadWAVFile(const char* filepath);
 
+    // Map and parse one WAV or FLAC file without touching the bank (safe to
+    // call from several threads). Returns nullptr and sets error on failure
+    SampleData* parseWAVFile(const char* filepath, std::string& error) const;
+
+    // Point samples at the mapped data (16-bit mono WAV) or decode it
+    bool prepareSample(SampleData* sample);
+
+    // Build the loop-point analysis and content hash of a prepared
+    // resident sample (once), and its mip levels if they are on
+    void analyzeSample(SampleData* sample) const;
+
+    // Half-band decimation of a prepared sample into SampleMips
+    static std::shared_ptr<const SampleMips> buildMips(const int16_t* src, uint32_t count);
+
+    // Bank samples by contentHash, for deduplication. Only the owning
+    // thread touches it
+    std::unordered_multimap<uint64_t, SampleData*> contentIndex;
+
+    // A bank entry just became prepared: share the audio of an earlier
+    // entry with the same content, or index it for later ones. Returns the
+    // bytes freed
+    size_t shareDuplicate(SampleData* sample);
+
+    // A bank entry is leaving samples (retired or cleared)
+    void forgetContent(SampleData* sample);
+
+    // True if prepareSample will convert this sample to resampleRate
+    bool needsResample(const SampleData* sample) const;
+
+    // Windowed-sinc conversion of Q15 audio from one rate to another
+    static std::vector<int16_t> resampleQ15(const int16_t* src, uint32_t count,
+                                            uint32_t fromRate, uint32_t toRate);
+
+    // Cache blob for a source path ("<cache>/<hash>.q15")
+    std::string cacheBlobPath(const std::string& sourcePath) const;
+
+    // Map a cache blob if it matches the source's size and mtime; the
+    // result is already prepared. Returns nullptr on a miss
+    SampleData* openCacheBlob(const std::string& sourcePath,
+                              uint64_t sourceSize, int64_t sourceMtime) const;
+
+    // Write normalized audio and its overview for a sample to the cache
+    bool writeCacheBlob(const SampleData& sample, const int16_t* normalized) const;
+
     // WAV file header structures
     struct WAVHeader {
         char riff[4];           // "RIFF"
@@ -114,11 +491,6 @@ private:
         uint32_t dataSize;      // Data chunk size
     };
 
-    // Convert various bit depths to Q15 mono
-    void convertToQ15Mono(const uint8_t* srcData, uint32_t srcBytes,
-                         int16_t* dst, uint32_t dstSamples,
-                         int channels, int bitsPerSample);
-
     // Normalize samples to -3dB peak
     void normalizeSamples(int16_t* samples, uint32_t count);
 
@@ -0,0 +1,425 @@
+#include "sample_browser_worker.h"
+#include "sample_bank.h"
+#include "flac_reader.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <dirent.h>
+#include <fcntl.h>
+#include <fstream>
+#include <sstream>
+#include <strings.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace {
+
+const char* const kIndexHeader = "wakefield-browser-index 1";
+
+// Chunks walked before the header probe gives up on finding fmt and data
+constexpr int kMaxProbeChunks = 64;
+
+int64_t mtimeNanoseconds(const struct stat& st) {
+    return static_cast<int64_t>(st.st_mtim.tv_sec) * 1000000000 + st.st_mtim.tv_nsec;
+}
+
+bool hasSampleExtension(const char* name) {
+    size_t len = strlen(name);
+    return (len > 4 && strcasecmp(name + len - 4, ".wav") == 0) ||
+           (len > 5 && strcasecmp(name + len - 5, ".flac") == 0);
+}
+
+uint16_t readLE16(const uint8_t* p) {
+    return static_cast<uint16_t>(p[0] | (p[1] << 8));
+}
+
+uint32_t readLE32(const uint8_t* p) {
+    return static_cast<uint32_t>(p[0]) | (static_cast<uint32_t>(p[1]) << 8) |
+           (static_cast<uint32_t>(p[2]) << 16) | (static_cast<uint32_t>(p[3]) << 24);
+}
+
+}  // namespace
+
+SampleBrowserWorker::~SampleBrowserWorker() {
+    stop();
+}
+
+void SampleBrowserWorker::scan(const std::string& directory) {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        scanRequest = directory;
+        scanRequested = true;
+        scanGeneration.fetch_add(1, std::memory_order_relaxed);
+        scanEntries.clear();
+        scanDone = false;
+        scanFailed = false;
+        scanReported = false;
+        stopping = false;
+        if (!thread.joinable()) {
+            thread = std::thread(&SampleBrowserWorker::worker, this);
+        }
+    }
+    wake.notify_one();
+}
+
+bool SampleBrowserWorker::pollScan(std::vector<SampleBrowserEntry>& entries, bool& done, bool& failed) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (scanEntries.empty() && scanReported) {
+        return false;
+    }
+    entries.insert(entries.end(), std::make_move_iterator(scanEntries.begin()),
+                   std::make_move_iterator(scanEntries.end()));
+    scanEntries.clear();
+    done = scanDone;
+    failed = scanFailed;
+    scanReported = scanDone;
+    return true;
+}
+
+void SampleBrowserWorker::load(SampleBank& bank, const std::string& path, int tag) {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        loads.push_back(LoadJob{&bank, path, tag});
+        stopping = false;
+        if (!thread.joinable()) {
+            thread = std::thread(&SampleBrowserWorker::worker, this);
+        }
+    }
+    wake.notify_one();
+}
+
+bool SampleBrowserWorker::pollLoad(std::string& path, int& tag, SampleData*& sample, std::string& error) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (loadResults.empty()) {
+        return false;
+    }
+    LoadResult& result = loadResults.front();
+    path = std::move(result.path);
+    tag = result.tag;
+    sample = result.sample;
+    error = std::move(result.error);
+    loadResults.pop_front();
+    return true;
+}
+
+void SampleBrowserWorker::stop() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+        scanRequested = false;
+        scanGeneration.fetch_add(1, std::memory_order_relaxed);
+    }
+    wake.notify_all();
+    if (thread.joinable()) {
+        thread.join();
+    }
+}
+
+void SampleBrowserWorker::worker() {
+    std::unique_lock<std::mutex> lock(mutex);
+    while (true) {
+        wake.wait(lock, [this] { return stopping || scanRequested || !loads.empty(); });
+        if (scanRequested) {
+            std::string directory = std::move(scanRequest);
+            scanRequested = false;
+            const uint32_t generation = scanGeneration.load(std::memory_order_relaxed);
+            lock.unlock();
+            runScan(directory, generation);
+            lock.lock();
+        } else if (!loads.empty()) {
+            lock.unlock();
+            runPendingLoads();
+            lock.lock();
+        } else {
+            return;     // Stopping with nothing left to do
+        }
+    }
+}
+
+void SampleBrowserWorker::runPendingLoads() {
+    while (true) {
+        LoadJob job;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (loads.empty()) {
+                return;
+            }
+            job = std::move(loads.front());
+            loads.pop_front();
+        }
+
+        LoadResult result{job.path, job.tag, nullptr, std::string()};
+        result.sample = job.bank->loadDetached(job.path.c_str(), result.error);
+
+        std::lock_guard<std::mutex> lock(mutex);
+        loadResults.push_back(std::move(result));
+    }
+}
+
+void SampleBrowserWorker::publishEntries(const SampleBrowserEntry* entries, size_t count, uint32_t generation) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (scanGeneration.load(std::memory_order_relaxed) == generation) {
+        scanEntries.insert(scanEntries.end(), entries, entries + count);
+    }
+}
+
+void SampleBrowserWorker::finishScan(uint32_t generation, bool failed) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (scanGeneration.load(std::memory_order_relaxed) == generation) {
+        scanDone = true;
+        scanFailed = failed;
+        scanReported = false;
+    }
+}
+
+void SampleBrowserWorker::runScan(const std::string& directory, uint32_t generation) {
+    if (!indexRead) {
+        readIndex();
+        indexRead = true;
+    }
+    const uint64_t use = ++scanCounter;
+
+    struct stat dirStat;
+    if (stat(directory.c_str(), &dirStat) != 0 || !S_ISDIR(dirStat.st_mode)) {
+        finishScan(generation, true);
+        return;
+    }
+    const int64_t dirMtime = mtimeNanoseconds(dirStat);
+
+    // Unchanged since it was last listed: the index is the listing
+    auto indexed = index.find(directory);
+    if (indexed != index.end() && indexed->second.mtime == dirMtime) {
+        indexed->second.lastUsed = use;
+        const std::vector<SampleBrowserEntry>& entries = indexed->second.entries;
+        publishEntries(entries.data(), entries.size(), generation);
+        finishScan(generation, false);
+        return;
+    }
+
+    // Files the stale listing already probed keep their headers if their
+    // size and mtime still match
+    std::unordered_map<std::string, const SampleBrowserEntry*> previous;
+    if (indexed != index.end()) {
+        for (const SampleBrowserEntry& entry : indexed->second.entries) {
+            if (!entry.directory) {
+                previous[entry.name] = &entry;
+            }
+        }
+    }
+
+    DIR* dir = opendir(directory.c_str());
+    if (!dir) {
+        finishScan(generation, true);
+        return;
+    }
+
+    DirectoryIndex listing;
+    listing.mtime = dirMtime;
+    listing.lastUsed = use;
+    struct dirent* dirEntry;
+    while ((dirEntry = readdir(dir)) != nullptr) {
+        if (scanGeneration.load(std::memory_order_relaxed) != generation) {
+            closedir(dir);
+            return;     // Superseded; the listing is incomplete, so not indexed
+        }
+
+        // A load the user asked for goes ahead of the rest of the listing
+        runPendingLoads();
+
+        const char* name = dirEntry->d_name;
+
+        // Skip hidden files and current directory
+        if (name[0] == '.' && strcmp(name, "..") != 0) continue;
+
+        SampleBrowserEntry entry;
+        entry.name = name;
+        if (dirEntry->d_type == DT_DIR) {
+            entry.directory = true;
+        } else {
+            // Only names that may be a directory or a sample file are worth a stat
+            if (dirEntry->d_type != DT_UNKNOWN && dirEntry->d_type != DT_LNK &&
+                (dirEntry->d_type != DT_REG || !hasSampleExtension(name))) {
+                continue;
+            }
+            const std::string fullPath = directory + "/" + name;
+            struct stat st;
+            if (stat(fullPath.c_str(), &st) != 0) continue;
+            if (S_ISDIR(st.st_mode)) {
+                entry.directory = true;
+            } else if (S_ISREG(st.st_mode) && hasSampleExtension(name)) {
+                entry.size = static_cast<uint64_t>(st.st_size);
+                entry.mtime = mtimeNanoseconds(st);
+                auto known = previous.find(entry.name);
+                if (known != previous.end() && known->second->size == entry.size &&
+                    known->second->mtime == entry.mtime) {
+                    entry = *known->second;
+                } else {
+                    probeHeader(fullPath, entry);
+                }
+            } else {
+                continue;
+            }
+        }
+        publishEntries(&entry, 1, generation);
+        listing.entries.push_back(std::move(entry));
+    }
+    closedir(dir);
+
+    index[directory] = std::move(listing);
+    if (index.size() > kMaxIndexedDirectories) {
+        auto oldest = std::min_element(index.begin(), index.end(), [](const auto& a, const auto& b) {
+            return a.second.lastUsed < b.second.lastUsed;
+        });
+        index.erase(oldest);
+    }
+    writeIndex();
+    finishScan(generation, false);
+}
+
+bool SampleBrowserWorker::probeHeader(const std::string& path, SampleBrowserEntry& entry) {
+    int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return false;
+    }
+
+    // FLAC: STREAMINFO has it all
+    uint8_t streamInfo[kFLACStreamInfoBytes];
+    FLACInfo flac;
+    std::string error;
+    if (pread(fd, streamInfo, sizeof(streamInfo), 0) == static_cast<ssize_t>(sizeof(streamInfo)) &&
+        memcmp(streamInfo, "fLaC", 4) == 0) {
+        close(fd);
+        if (!readFLACStreamInfo(streamInfo, sizeof(streamInfo), flac, error)) {
+            return false;
+        }
+        entry.sampleRate = flac.sampleRate;
+        entry.channels = flac.channels;
+        entry.bitsPerSample = flac.bitsPerSample;
+        entry.frames = static_cast<uint32_t>(std::min<uint64_t>(flac.totalFrames, UINT32_MAX));
+        return true;
+    }
+
+    uint8_t riff[12];
+    if (pread(fd, riff, sizeof(riff), 0) != static_cast<ssize_t>(sizeof(riff)) ||
+        memcmp(riff, "RIFF", 4) != 0 || memcmp(riff + 8, "WAVE", 4) != 0) {
+        close(fd);
+        return false;
+    }
+
+    // Walk the chunk headers; only fmt and data are read
+    uint64_t offset = sizeof(riff);
+    bool haveFormat = false;
+    bool haveData = false;
+    uint64_t dataSize = 0;
+    for (int chunk = 0; chunk < kMaxProbeChunks && !(haveFormat && haveData); ++chunk) {
+        uint8_t header[8];
+        if (offset + sizeof(header) > entry.size ||
+            pread(fd, header, sizeof(header), static_cast<off_t>(offset)) != static_cast<ssize_t>(sizeof(header))) {
+            break;
+        }
+        const uint32_t chunkSize = readLE32(header + 4);
+        if (memcmp(header, "fmt ", 4) == 0 && chunkSize >= 16) {
+            uint8_t format[16];
+            if (pread(fd, format, sizeof(format), static_cast<off_t>(offset + 8)) == static_cast<ssize_t>(sizeof(format))) {
+                entry.channels = readLE16(format + 2);
+                entry.sampleRate = readLE32(format + 4);
+                entry.bitsPerSample = readLE16(format + 14);
+                haveFormat = true;
+            }
+        } else if (memcmp(header, "data", 4) == 0) {
+            // Streams written without a final size leave it short or huge
+            dataSize = std::min<uint64_t>(chunkSize, entry.size - (offset + 8));
+            haveData = true;
+        }
+        offset += 8 + static_cast<uint64_t>(chunkSize) + (chunkSize & 1);
+    }
+    close(fd);
+
+    if (!haveFormat || entry.channels == 0 || entry.bitsPerSample == 0) {
+        entry.sampleRate = 0;
+        return false;
+    }
+    const uint32_t frameBytes = entry.channels * ((entry.bitsPerSample + 7u) / 8u);
+    entry.frames = static_cast<uint32_t>(dataSize / frameBytes);
+    return true;
+}
+
+void SampleBrowserWorker::readIndex() {
+    if (indexPath.empty()) {
+        return;
+    }
+    std::ifstream file(indexPath);
+    std::string line;
+    if (!std::getline(file, line) || line != kIndexHeader) {
+        return;     // Missing or from another version: rebuilt as directories are listed
+    }
+
+    // "D <mtime> <path>" starts a directory; its entries follow as
+    // "d <name>" or "f <size> <mtime> <rate> <channels> <bits> <frames> <name>"
+    DirectoryIndex* current = nullptr;
+    while (std::getline(file, line)) {
+        if (line.size() < 2) continue;
+        std::istringstream fields(line.substr(2));
+        if (line[0] == 'D') {
+            int64_t mtime = 0;
+            std::string path;
+            if (fields >> mtime && fields.get() == ' ' && std::getline(fields, path)) {
+                current = &index[path];
+                current->mtime = mtime;
+            } else {
+                current = nullptr;
+            }
+        } else if (current && line[0] == 'd') {
+            SampleBrowserEntry entry;
+            entry.name = line.substr(2);
+            entry.directory = true;
+            current->entries.push_back(std::move(entry));
+        } else if (current && line[0] == 'f') {
+            SampleBrowserEntry entry;
+            uint32_t channels = 0;
+            uint32_t bits = 0;
+            if (fields >> entry.size >> entry.mtime >> entry.sampleRate >> channels >> bits >> entry.frames &&
+                fields.get() == ' ' && std::getline(fields, entry.name)) {
+                entry.channels = static_cast<uint16_t>(channels);
+                entry.bitsPerSample = static_cast<uint16_t>(bits);
+                current->entries.push_back(std::move(entry));
+            }
+        }
+    }
+}
+
+void SampleBrowserWorker::writeIndex() const {
+    if (indexPath.empty()) {
+        return;
+    }
+    const std::string tempPath = indexPath + ".tmp";
+    std::ofstream file(tempPath, std::ios::trunc);
+    if (!file) {
+        return;
+    }
+    file << kIndexHeader << "\n";
+    for (const auto& [path, listing] : index) {
+        // Names are stored one per line; a listing with a newline in a
+        // name is simply rescanned next time
+        bool storable = path.find('\n') == std::string::npos;
+        for (const SampleBrowserEntry& entry : listing.entries) {
+            storable = storable && entry.name.find('\n') == std::string::npos;
+        }
+        if (!storable) continue;
+
+        file << "D " << listing.mtime << " " << path << "\n";
+        for (const SampleBrowserEntry& entry : listing.entries) {
+            if (entry.directory) {
+                file << "d " << entry.name << "\n";
+            } else {
+                file << "f " << entry.size << " " << entry.mtime << " " << entry.sampleRate << " "
+                     << entry.channels << " " << entry.bitsPerSample << " " << entry.frames << " "
+                     << entry.name << "\n";
+            }
+        }
+    }
+    file.close();
+    if (file.fail() || std::rename(tempPath.c_str(), indexPath.c_str()) != 0) {
+        std::remove(tempPath.c_str());
+    }
+}
@@ -0,0 +1,132 @@
+#ifndef SAMPLE_BROWSER_WORKER_H
+#define SAMPLE_BROWSER_WORKER_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+class SampleBank;
+struct SampleData;
+
+// One row of the sample browser: a subdirectory or a .wav or .flac file
+struct SampleBrowserEntry {
+    std::string name;
+    bool directory = false;
+
+    // Files only: stat and WAV or FLAC header as probed on the worker
+    uint64_t size = 0;
+    int64_t mtime = 0;              // Nanoseconds since the epoch
+    uint32_t sampleRate = 0;        // 0 if the header could not be read
+    uint16_t channels = 0;
+    uint16_t bitsPerSample = 0;
+    uint32_t frames = 0;
+};
+
+// Lists directories and loads samples for the sample browser on a
+// background thread (started with the first request), so a slow disk or
+// network share never stalls the UI.
+//
+// A scan streams its entries back as it finds them and probes each WAV or
+// FLAC header for the format column. Finished listings are kept in an index
+// keyed on the directory's mtime, written to the index file if one is set,
+// so reopening an unchanged directory is a single stat. Editing a file in
+// place does not change its directory's mtime; such a file shows its old
+// header until the directory itself changes, but always loads as it is now.
+//
+// Loads map, parse and prepare the file with SampleBank::loadDetached; the
+// UI thread adopts the finished sample into the bank.
+class SampleBrowserWorker {
+public:
+    SampleBrowserWorker() = default;
+    ~SampleBrowserWorker();
+
+    // Where to keep the directory index between runs (empty keeps it in
+    // memory only). Set before the first scan
+    void setIndexPath(const std::string& path) { indexPath = path; }
+
+    // List directory, abandoning any scan still running
+    void scan(const std::string& directory);
+
+    // Append the entries the latest scan found since the last call, in
+    // directory order. done is set once it has finished, failed if the
+    // directory could not be read. False if there was nothing new
+    bool pollScan(std::vector<SampleBrowserEntry>& entries, bool& done, bool& failed);
+
+    // Load and prepare path off the UI thread. tag comes back with the result
+    void load(SampleBank& bank, const std::string& path, int tag);
+
+    // One finished load per call, in request order: sample is nullptr and
+    // error set if it failed. The caller adopts or discards the sample
+    bool pollLoad(std::string& path, int& tag, SampleData*& sample, std::string& error);
+
+    // Abandon the scan, finish the queued loads and stop the thread
+    void stop();
+
+    SampleBrowserWorker(const SampleBrowserWorker&) = delete;
+    SampleBrowserWorker& operator=(const SampleBrowserWorker&) = delete;
+
+private:
+    struct LoadJob {
+        SampleBank* bank;
+        std::string path;
+        int tag;
+    };
+
+    struct LoadResult {
+        std::string path;
+        int tag;
+        SampleData* sample;
+        std::string error;
+    };
+
+    struct DirectoryIndex {
+        int64_t mtime = 0;
+        uint64_t lastUsed = 0;      // Scan counter, for eviction
+        std::vector<SampleBrowserEntry> entries;
+    };
+
+    static constexpr size_t kMaxIndexedDirectories = 256;
+
+    void worker();
+    void runScan(const std::string& directory, uint32_t generation);
+    void runPendingLoads();
+    void publishEntries(const SampleBrowserEntry* entries, size_t count, uint32_t generation);
+    void finishScan(uint32_t generation, bool failed);
+
+    void readIndex();
+    void writeIndex() const;
+
+    // Read the fmt and data chunks of the WAV file at path, or the FLAC
+    // STREAMINFO, into entry
+    static bool probeHeader(const std::string& path, SampleBrowserEntry& entry);
+
+    std::mutex mutex;               // Guards everything down to stopping
+    std::condition_variable wake;
+    std::string scanRequest;
+    bool scanRequested = false;
+    std::vector<SampleBrowserEntry> scanEntries;
+    bool scanDone = false;
+    bool scanFailed = false;
+    bool scanReported = true;       // pollScan has returned the latest state
+    std::deque<LoadJob> loads;
+    std::deque<LoadResult> loadResults;
+    bool stopping = false;
+    std::thread thread;
+
+    // Bumped by every scan request; a scan stops when it is superseded
+    std::atomic<uint32_t> scanGeneration{0};
+
+    // Worker thread only
+    std::string indexPath;
+    std::unordered_map<std::string, DirectoryIndex> index;
+    bool indexRead = false;
+    uint64_t scanCounter = 0;
+};
+
+#endif // SAMPLE_BROWSER_WORKER_H
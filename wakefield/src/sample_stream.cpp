@@ -0,0 +1,266 @@
+#include "sample_stream.h"
+#include "sample_bank.h"
+#include <algorithm>
+#include <fcntl.h>
+#include <unistd.h>
+
+// Pages read per service() call, so cursor updates are picked up often
+static constexpr int kPagesPerService = 8;
+
+// Pages that may be held for loop regions; the rest of the pool is kept
+// free for lookahead
+static constexpr uint32_t kPinnedPageBudget =
+    SampleStream::kCachePages - SampleStream::kMaxCursors * SampleStream::kLookaheadPages;
+
+// Read frames [first, first + count) from the data chunk and decode them
+static bool readFrames(int fd, uint32_t dataOffset, uint16_t channels, uint16_t bitsPerSample,
+                       uint32_t first, uint32_t count, std::vector<uint8_t>& buffer, int16_t* dst) {
+    const size_t bytesPerFrame = static_cast<size_t>(channels) * (bitsPerSample / 8);
+    const size_t bytes = bytesPerFrame * count;
+    buffer.resize(bytes);
+    const off_t offset = static_cast<off_t>(dataOffset) + static_cast<off_t>(bytesPerFrame) * first;
+    size_t done = 0;
+    while (done < bytes) {
+        ssize_t n = pread(fd, buffer.data() + done, bytes - done, offset + static_cast<off_t>(done));
+        if (n <= 0) {
+            return false;
+        }
+        done += static_cast<size_t>(n);
+    }
+    SampleBank::convertToQ15Mono(buffer.data(), static_cast<uint32_t>(bytes), dst, count,
+                                 channels, bitsPerSample);
+    return true;
+}
+
+SampleStream* SampleStream::open(const std::string& path, uint32_t dataOffset,
+                                 uint32_t frames, uint16_t channels, uint16_t bitsPerSample) {
+    int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return nullptr;
+    }
+
+    SampleStream* stream = new SampleStream();
+    stream->fd = fd;
+    stream->dataOffset = dataOffset;
+    stream->frames = frames;
+    stream->channels = channels;
+    stream->bitsPerSample = bitsPerSample;
+
+    const uint32_t prerollFrames = std::min(frames, kPrerollFrames);
+    stream->preroll.resize(prerollFrames);
+    if (!readFrames(fd, dataOffset, channels, bitsPerSample, 0, prerollFrames,
+                    stream->ioBuffer, stream->preroll.data())) {
+        delete stream;
+        return nullptr;
+    }
+
+    stream->pageData.reset(new int16_t[static_cast<size_t>(kCachePages) * kPageFrames]());
+    stream->slots.reset(new Slot[kCachePages]);
+    const uint32_t pages = stream->pageCount();
+    stream->pageSlot.reset(new std::atomic<int32_t>[pages]);
+    for (uint32_t p = 0; p < pages; ++p) {
+        stream->pageSlot[p].store(-1, std::memory_order_relaxed);
+    }
+    return stream;
+}
+
+SampleStream::~SampleStream() {
+    if (fd >= 0) {
+        close(fd);
+    }
+}
+
+int16_t SampleStream::frame(uint32_t index) const {
+    if (index < preroll.size()) {
+        return preroll[index];
+    }
+    if (index >= frames) {
+        return 0;
+    }
+    const uint32_t page = index / kPageFrames;
+    const int32_t s = pageSlot[page].load(std::memory_order_acquire);
+    if (s >= 0) {
+        const Slot& slot = slots[s];
+        const uint32_t before = slot.sequence.load(std::memory_order_acquire);
+        if (!(before & 1u) && slot.page.load(std::memory_order_relaxed) == static_cast<int32_t>(page)) {
+            const int16_t value = pageData[static_cast<size_t>(s) * kPageFrames + index % kPageFrames];
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (slot.sequence.load(std::memory_order_relaxed) == before) {
+                return value;
+            }
+        }
+    }
+    underruns.fetch_add(1, std::memory_order_relaxed);
+    return 0;
+}
+
+int SampleStream::acquireCursor() {
+    for (int c = 0; c < kMaxCursors; ++c) {
+        bool expected = false;
+        if (cursors[c].inUse.compare_exchange_strong(expected, true)) {
+            cursors[c].active.store(false, std::memory_order_relaxed);
+            return c;
+        }
+    }
+    return -1;
+}
+
+void SampleStream::releaseCursor(int cursor) {
+    if (cursor < 0 || cursor >= kMaxCursors) {
+        return;
+    }
+    cursors[cursor].active.store(false, std::memory_order_relaxed);
+    cursors[cursor].inUse.store(false, std::memory_order_release);
+}
+
+void SampleStream::updateCursor(int cursor, uint32_t playhead, bool reverse, bool pingPong,
+                                uint32_t loopStart, uint32_t loopEnd) {
+    if (cursor < 0 || cursor >= kMaxCursors) {
+        return;
+    }
+    Cursor& c = cursors[cursor];
+    c.playhead.store(playhead, std::memory_order_relaxed);
+    c.reverse.store(reverse, std::memory_order_relaxed);
+    c.pingPong.store(pingPong, std::memory_order_relaxed);
+    c.loopStart.store(loopStart, std::memory_order_relaxed);
+    c.loopEnd.store(loopEnd, std::memory_order_relaxed);
+    c.active.store(true, std::memory_order_release);
+}
+
+bool SampleStream::isResident(uint32_t page) const {
+    const int32_t s = pageSlot[page].load(std::memory_order_relaxed);
+    return s >= 0 && slots[s].page.load(std::memory_order_relaxed) == static_cast<int32_t>(page);
+}
+
+bool SampleStream::service() {
+    const uint32_t firstStreamedPage = static_cast<uint32_t>(preroll.size()) / kPageFrames;
+    const uint32_t pages = pageCount();
+    wanted.clear();
+
+    struct CursorView {
+        uint32_t playhead, loopStart, loopLength;
+        bool reverse, pingPong;
+    };
+    CursorView views[kMaxCursors];
+    int numViews = 0;
+    for (const Cursor& c : cursors) {
+        if (!c.inUse.load(std::memory_order_acquire) || !c.active.load(std::memory_order_acquire)) {
+            continue;
+        }
+        CursorView v;
+        v.loopStart = std::min(c.loopStart.load(std::memory_order_relaxed), frames - 1);
+        uint32_t loopEnd = std::min(c.loopEnd.load(std::memory_order_relaxed), frames);
+        if (loopEnd <= v.loopStart) {
+            v.loopStart = 0;
+            loopEnd = frames;
+        }
+        v.loopLength = loopEnd - v.loopStart;
+        v.playhead = std::clamp(c.playhead.load(std::memory_order_relaxed), v.loopStart, loopEnd - 1);
+        v.reverse = c.reverse.load(std::memory_order_relaxed);
+        v.pingPong = c.pingPong.load(std::memory_order_relaxed);
+        views[numViews++] = v;
+    }
+    if (numViews == 0) {
+        return false;
+    }
+
+    // Lookahead first, nearest pages of every cursor before farther ones.
+    // Positions follow the loop: wrap for FORWARD/REVERSE, reflect for
+    // ping-pong (unfold the loop into a 2 * length cycle)
+    for (uint32_t d = 0; d < kLookaheadPages; ++d) {
+        for (int i = 0; i < numViews; ++i) {
+            const CursorView& v = views[i];
+            const uint64_t len = v.loopLength;
+            const uint64_t distance = static_cast<uint64_t>(d) * kPageFrames;
+            const uint64_t offset = v.playhead - v.loopStart;
+            uint64_t position;
+            if (v.pingPong) {
+                const uint64_t cycle = 2 * len;
+                uint64_t unfolded = v.reverse ? (cycle - 1 - offset) : offset;
+                unfolded = (unfolded + distance) % cycle;
+                position = unfolded < len ? unfolded : (cycle - 1 - unfolded);
+            } else if (v.reverse) {
+                position = (offset + len - distance % len) % len;
+            } else {
+                position = (offset + distance) % len;
+            }
+            wanted.push_back(static_cast<uint32_t>((v.loopStart + position) / kPageFrames));
+        }
+    }
+
+    // Then whole loop regions, while they fit in the pinned budget
+    uint32_t pinned = 0;
+    for (int i = 0; i < numViews; ++i) {
+        const CursorView& v = views[i];
+        const uint32_t first = v.loopStart / kPageFrames;
+        const uint32_t last = (v.loopStart + v.loopLength - 1) / kPageFrames;
+        if (pinned + (last - first + 1) > kPinnedPageBudget) {
+            continue;
+        }
+        pinned += last - first + 1;
+        for (uint32_t p = first; p <= last; ++p) {
+            wanted.push_back(p);
+        }
+    }
+
+    // Mark resident wanted pages so they are not chosen as victims
+    ++stamp;
+    for (uint32_t page : wanted) {
+        if (page >= firstStreamedPage && page < pages && isResident(page)) {
+            slots[pageSlot[page].load(std::memory_order_relaxed)].wantedStamp = stamp;
+        }
+    }
+
+    int loaded = 0;
+    for (uint32_t page : wanted) {
+        if (loaded == kPagesPerService) {
+            break;
+        }
+        if (page < firstStreamedPage || page >= pages || isResident(page)) {
+            continue;
+        }
+        if (!loadPage(page, stamp)) {
+            break;  // Pool full of wanted pages (or a read error)
+        }
+        ++loaded;
+    }
+    return loaded > 0;
+}
+
+bool SampleStream::loadPage(uint32_t page, uint32_t currentStamp) {
+    // Victim: an empty slot, else any slot not wanted this pass
+    int victim = -1;
+    for (uint32_t s = 0; s < kCachePages; ++s) {
+        if (slots[s].page.load(std::memory_order_relaxed) < 0) {
+            victim = static_cast<int>(s);
+            break;
+        }
+        if (victim < 0 && slots[s].wantedStamp != currentStamp) {
+            victim = static_cast<int>(s);
+        }
+    }
+    if (victim < 0) {
+        return false;
+    }
+
+    const uint32_t first = page * kPageFrames;
+    const uint32_t count = std::min(kPageFrames, frames - first);
+    int16_t decoded[kPageFrames];
+    if (!readFrames(fd, dataOffset, channels, bitsPerSample, first, count, ioBuffer, decoded)) {
+        return false;
+    }
+
+    Slot& slot = slots[victim];
+    const int32_t oldPage = slot.page.load(std::memory_order_relaxed);
+    if (oldPage >= 0) {
+        pageSlot[oldPage].store(-1, std::memory_order_release);
+    }
+    slot.sequence.fetch_add(1, std::memory_order_relaxed);  // odd: replacing
+    std::atomic_thread_fence(std::memory_order_release);
+    slot.page.store(static_cast<int32_t>(page), std::memory_order_relaxed);
+    std::copy(decoded, decoded + count, &pageData[static_cast<size_t>(victim) * kPageFrames]);
+    slot.sequence.fetch_add(1, std::memory_order_release);  // even: stable
+    slot.wantedStamp = currentStamp;
+    pageSlot[page].store(victim, std::memory_order_release);
+    return true;
+}
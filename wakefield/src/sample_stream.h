@@ -0,0 +1,113 @@
+#ifndef SAMPLE_STREAM_H
+#define SAMPLE_STREAM_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+// Disk-streaming backend for samples too large to keep resident.
+//
+// The first kPrerollFrames frames are decoded up front. The rest of the
+// file lives in a fixed pool of pages that SampleBank's I/O thread fills
+// with pread. Each sampler playing the stream holds a cursor and publishes
+// its playhead, direction and loop region once per block. The I/O thread
+// keeps each cursor's loop region resident (when it fits in the pool) and
+// prefetches the pages that playback will reach next, following REVERSE
+// and ALTERNATE (ping-pong) motion.
+//
+// The audio thread never blocks. A page is read under a per-slot sequence
+// counter, the same protocol ParamSnapshotChannel uses. A frame that isn't
+// resident plays as silence and counts as an underrun.
+//
+// Streamed audio is not normalized, because that would need a full read
+// of the file. The owning SampleData keeps gain = 1.
+class SampleStream {
+public:
+    static constexpr uint32_t kPageFrames = 4096;
+    static constexpr uint32_t kCachePages = 512;        // 4 MB of Q15
+    static constexpr uint32_t kPrerollFrames = 8 * kPageFrames;
+    static constexpr uint32_t kLookaheadPages = 24;     // ~2 s at 48 kHz, 1x speed
+    static constexpr int kMaxCursors = 8;
+
+    // Open the WAV at path and decode the preroll. Returns nullptr on failure
+    static SampleStream* open(const std::string& path, uint32_t dataOffset,
+                              uint32_t frames, uint16_t channels, uint16_t bitsPerSample);
+    ~SampleStream();
+
+    SampleStream(const SampleStream&) = delete;
+    SampleStream& operator=(const SampleStream&) = delete;
+
+    // Decoded frames [0, kPrerollFrames), always resident
+    const int16_t* prerollData() const { return preroll.data(); }
+
+    // Audio thread: one frame, or 0 (and an underrun) if its page is absent
+    int16_t frame(uint32_t index) const;
+
+    // Cursors are claimed from the UI thread when a sampler takes the
+    // sample; -1 if all are in use (that sampler then gets no prefetch)
+    int acquireCursor();
+    void releaseCursor(int cursor);
+
+    // Audio thread, once per block: where this cursor is and where it is going
+    void updateCursor(int cursor, uint32_t playhead, bool reverse, bool pingPong,
+                      uint32_t loopStart, uint32_t loopEnd);
+
+    // I/O thread: load the most urgent missing pages. Returns true if any
+    // page was read, false when everything wanted is resident
+    bool service();
+
+    uint32_t getUnderruns() const { return underruns.load(std::memory_order_relaxed); }
+
+    // Memory held: the preroll, the page cache and its tables
+    size_t bytes() const {
+        return preroll.size() * sizeof(int16_t) +
+               static_cast<size_t>(kCachePages) * (kPageFrames * sizeof(int16_t) + sizeof(Slot)) +
+               pageCount() * sizeof(std::atomic<int32_t>) + ioBuffer.capacity();
+    }
+
+private:
+    SampleStream() = default;
+
+    struct alignas(64) Slot {
+        std::atomic<uint32_t> sequence{0};   // Odd while the page is being replaced
+        std::atomic<int32_t> page{-1};
+        uint32_t wantedStamp = 0;            // I/O thread only
+    };
+
+    struct alignas(64) Cursor {
+        std::atomic<bool> inUse{false};
+        std::atomic<bool> active{false};     // Set by the first updateCursor
+        std::atomic<uint32_t> playhead{0};
+        std::atomic<uint32_t> loopStart{0};
+        std::atomic<uint32_t> loopEnd{0};
+        std::atomic<bool> reverse{false};
+        std::atomic<bool> pingPong{false};
+    };
+
+    bool isResident(uint32_t page) const;
+    bool loadPage(uint32_t page, uint32_t stamp);
+    uint32_t pageCount() const { return (frames + kPageFrames - 1) / kPageFrames; }
+
+    int fd = -1;
+    uint32_t dataOffset = 0;
+    uint32_t frames = 0;
+    uint16_t channels = 1;
+    uint16_t bitsPerSample = 16;
+
+    std::vector<int16_t> preroll;
+    std::unique_ptr<int16_t[]> pageData;                    // kCachePages * kPageFrames
+    std::unique_ptr<Slot[]> slots;
+    std::unique_ptr<std::atomic<int32_t>[]> pageSlot;       // Page -> slot, -1 if absent
+    Cursor cursors[kMaxCursors];
+    mutable std::atomic<uint32_t> underruns{0};
+
+    // I/O thread state
+    uint32_t stamp = 0;
+    std::vector<uint32_t> wanted;
+    std::vector<uint8_t> ioBuffer;
+};
+
+#endif // SAMPLE_STREAM_H
@@ -1,27 +1,136 @@
 #include "sampler.h"
 #include "sample_bank.h"
+#include "sample_stream.h"
+#include "interpolation.h"
 #include <algorithm>
+#include <cmath>
 #include <cstring>
 #include <limits>
 
 // Minimum loop length in samples (to prevent glitches)
 static constexpr uint32_t MIN_LOOP_LENGTH = 2048;
 
+// Loop snapping: how far a loop point may move to reach a zero crossing
+// (and at most 1/16 of the loop), and the RMS below which the audio counts
+// as silent and the point stays where it is (about -54 dBFS)
+static constexpr uint32_t SNAP_WINDOW = 1024;
+static constexpr uint16_t SNAP_SILENCE_RMS = 64;
+
+// Until Synth hands out its slot configs
+static const SamplerConfig kDefaultConfig;
+
+// Hermite and sinc kernels: interpolation.h (shared with Looper)
+namespace {
+
+using interp::kSincHalfTaps;
+using interp::hermiteAt;
+using interp::loadLanes;
+using interp::sincAt;
+using interp::sincBand;
+
+inline int16_t toSample16(float v) {
+    return static_cast<int16_t>(std::clamp(v, -32768.0f, 32767.0f));
+}
+
+// Loop crossfade gains: the Q15 quarter sine of lung's render
+// (audio_engine_render.cpp), entry i = sin(pi/2 * i/256), read the same
+// way, so both engines fade loops identically
+struct QuarterSineTable {
+    uint16_t q15[257];
+
+    QuarterSineTable() {
+        for (uint32_t i = 0; i <= 256; ++i) {
+            q15[i] = static_cast<uint16_t>(std::lrint(32768.0f * std::sin(static_cast<float>(M_PI_2) *
+                                                                          static_cast<float>(i) / 256.0f)));
+        }
+    }
+};
+
+const QuarterSineTable kQuarterSine;
+
+// Index 0..255 plus a weight 0..256
+inline float quarterSine(uint32_t idx, uint32_t w8) {
+    const int32_t a = kQuarterSine.q15[idx];
+    const int32_t b = kQuarterSine.q15[idx + 1];
+    return static_cast<float>(a + (((b - a) * static_cast<int32_t>(w8)) >> 8)) * (1.0f / 32768.0f);
+}
+
+} // namespace
+
+void SamplerConfig::prepare(SamplerInterpolation cap) {
+    renderInterpolation = std::min(interpolation, cap);
+    loopValid = loopBoundaries(sample, 0.0f, 0.0f, loopStart, loopEnd);
+}
+
+bool SamplerConfig::loopBoundaries(const SampleData* data, float startMod, float lengthMod,
+                                   uint32_t& start, uint32_t& end) const {
+    if (!data || data->sampleCount < MIN_LOOP_LENGTH) {
+        start = 0;
+        end = 0;
+        return false;
+    }
+
+    const uint32_t totalSamples = data->sampleCount;
+    const uint32_t availableSpan = totalSamples > MIN_LOOP_LENGTH ?
+                                   totalSamples - MIN_LOOP_LENGTH : 0;
+
+    // Apply modulation to loop start (clamped to 0-1)
+    float modulatedStart = std::clamp(loopStartNorm + startMod, 0.0f, 1.0f);
+    start = availableSpan > 0 ?
+            static_cast<uint32_t>(modulatedStart * availableSpan) : 0;
+
+    // Apply modulation to loop length (clamped to 0-1)
+    float modulatedLength = std::clamp(loopLengthNorm + lengthMod, 0.0f, 1.0f);
+    uint32_t loopLen = MIN_LOOP_LENGTH +
+                      (availableSpan > 0 ?
+                       static_cast<uint32_t>(modulatedLength * availableSpan) : 0);
+
+    end = start + loopLen;
+    if (end > totalSamples) {
+        end = totalSamples;
+    }
+
+    if (snapLoop && !data->zeroCrossings.empty()) {
+        const std::vector<uint32_t>& crossings = data->zeroCrossings;
+        const uint32_t window = std::min(SNAP_WINDOW, (end - start) / 16);
+        // Nearest crossing to frame within the window, or frame itself
+        auto snap = [&](uint32_t frame) {
+            if (data->rmsAt(frame) < SNAP_SILENCE_RMS) {
+                return frame;
+            }
+            auto it = std::lower_bound(crossings.begin(), crossings.end(), frame);
+            uint32_t best = frame;
+            uint32_t bestDistance = window + 1;
+            if (it != crossings.end() && *it - frame < bestDistance) {
+                best = *it;
+                bestDistance = *it - frame;
+            }
+            if (it != crossings.begin() && frame - *(it - 1) < bestDistance) {
+                best = *(it - 1);
+            }
+            return best;
+        };
+        const uint32_t snappedStart = snap(start);
+        const uint32_t snappedEnd = snap(end);
+        if (snappedEnd <= totalSamples && snappedEnd >= snappedStart + MIN_LOOP_LENGTH) {
+            start = snappedStart;
+            end = snappedEnd;
+        }
+    }
+    return true;
+}
+
 Sampler::Sampler()
     : currentSample(nullptr)
-    , loopStartNorm(0.0f)
-    , loopLengthNorm(1.0f)
-    , crossfadeLengthNorm(0.1f)
-    , playbackSpeed(1.0f)
-    , tzfmDepth(0.0f)
-    , level(1.0f)
-    , mode(PlaybackMode::FORWARD)
+    , streamCursor(-1)
+    , config(&kDefaultConfig)
     , keyMode(true)
     , primaryVoice(&voiceA)
     , secondaryVoice(&voiceB)
     , crossfading(false)
-    , crossfadeSamplesTotal(0)
     , crossfadeSamplesRemaining(0)
+    , crossfadeProgressQ32(0)
+    , crossfadeStepQ32(0)
     , pendingStart(0)
     , pendingEnd(0)
     , pendingLoopValid(false)
@@ -29,7 +138,10 @@ Sampler::Sampler()
     , wasInZoneLastSample(false)
     , playingReverse(false)
     , modulatorSmoothed(0.0f)
-    , lastPhaseDriver(-1.0f) {
+    , lastPhaseDriver(-1.0f)
+    , swapStage(SwapStage::NONE)
+    , swapFramesRemaining(0)
+    , swapTarget(nullptr) {
 
     // Initialize voice A as active
     voiceA.phase_q32_32 = 0;
@@ -47,38 +159,79 @@ Sampler::Sampler()
 }
 
 void Sampler::setSample(const SampleData* sample) {
+    if (currentSample && currentSample->stream) {
+        currentSample->stream->releaseCursor(streamCursor);
+    }
+    streamCursor = (sample && sample->stream) ? sample->stream->acquireCursor() : -1;
     currentSample = sample;
     pendingLoopValid = false;
     restartRequested = true;
     reset();
-}
-
-void Sampler::setLoopStart(float normalized) {
-    loopStartNorm = std::clamp(normalized, 0.0f, 1.0f);
-}
-
-void Sampler::setLoopLength(float normalized) {
-    loopLengthNorm = std::clamp(normalized, 0.0f, 1.0f);
-}
 
-void Sampler::setCrossfadeLength(float normalized) {
-    crossfadeLengthNorm = std::clamp(normalized, 0.0f, 1.0f);
+    // Point the I/O thread at the unmodulated loop now, so its pages are
+    // resident before the first note
+    if (streamCursor >= 0) {
+        calculateLoopBoundaries(0.0f, 0.0f);
+        const bool isReverse = (config->mode == PlaybackMode::REVERSE);
+        sample->stream->updateCursor(streamCursor, isReverse ? pendingEnd - 1 : pendingStart,
+                                     isReverse, config->mode == PlaybackMode::ALTERNATE,
+                                     pendingStart, pendingEnd);
+        pendingLoopValid = false;
+    }
 }
 
-void Sampler::setPlaybackSpeed(float speed) {
-    playbackSpeed = speed;
+void Sampler::queueSample(const SampleData* sample) {
+    swapTarget = sample;
+    if (swapStage == SwapStage::FADE_OUT) {
+        return;  // Already leaving; just retarget
+    }
+    if (swapStage == SwapStage::FADE_IN) {
+        // Turn around from the current fade-in gain
+        swapFramesRemaining = SWAP_FADE_FRAMES - swapFramesRemaining;
+    } else if (sample == currentSample) {
+        return;
+    } else {
+        swapFramesRemaining = SWAP_FADE_FRAMES;
+    }
+    swapStage = SwapStage::FADE_OUT;
+    if (swapFramesRemaining <= 0) {
+        finishSwap();
+    }
 }
 
-void Sampler::setTZFMDepth(float depth) {
-    tzfmDepth = std::clamp(depth, 0.0f, 1.0f);
+void Sampler::finishSwap() {
+    if (swapStage == SwapStage::FADE_OUT) {
+        setSample(swapTarget);
+    }
+    swapStage = SwapStage::NONE;
+    swapFramesRemaining = 0;
 }
 
-void Sampler::setPlaybackMode(PlaybackMode newMode) {
-    mode = newMode;
+// Gain for the current frame of a hot-swap fade; switches samples at the
+// bottom of the fade
+float Sampler::advanceSwapGain() {
+    const float step = 1.0f / static_cast<float>(SWAP_FADE_FRAMES);
+    if (swapStage == SwapStage::FADE_OUT) {
+        const float gain = static_cast<float>(swapFramesRemaining) * step;
+        if (--swapFramesRemaining <= 0) {
+            setSample(swapTarget);
+            swapStage = SwapStage::FADE_IN;
+            swapFramesRemaining = SWAP_FADE_FRAMES;
+        }
+        return gain;
+    }
+    if (swapStage == SwapStage::FADE_IN) {
+        const float gain = 1.0f - static_cast<float>(swapFramesRemaining) * step;
+        if (--swapFramesRemaining <= 0) {
+            swapStage = SwapStage::NONE;
+        }
+        return gain;
+    }
+    return 1.0f;
 }
 
-void Sampler::setLevel(float newLevel) {
-    level = std::clamp(newLevel, 0.0f, 1.0f);
+void Sampler::setConfig(const SamplerConfig* newConfig) {
+    config = newConfig;
 }
 
 void Sampler::setKeyMode(bool enabled) {
@@ -133,7 +286,6 @@ void Sampler::stopPlayback() {
     secondaryVoice->active = false;
     secondaryVoice->amplitude = 0.0f;
     crossfadeSamplesRemaining = 0;
-    crossfadeSamplesTotal = 0;
     wasInZoneLastSample = false;
     restartRequested = false;
 }
@@ -146,33 +298,15 @@ const char* Sampler::getSampleName() const {
 }
 
 void Sampler::calculateLoopBoundaries(float startMod, float lengthMod) {
-    if (!currentSample || currentSample->sampleCount < MIN_LOOP_LENGTH) {
-        pendingStart = 0;
-        pendingEnd = 0;
-        pendingLoopValid = false;
+    // The unmodulated loop of the slot's sample is worked out once per
+    // buffer for all of its samplers
+    if (startMod == 0.0f && lengthMod == 0.0f && currentSample && currentSample == config->sample) {
+        pendingStart = config->loopStart;
+        pendingEnd = config->loopEnd;
+        pendingLoopValid = config->loopValid;
         return;
     }
-
-    const uint32_t totalSamples = currentSample->sampleCount;
-    const uint32_t availableSpan = totalSamples > MIN_LOOP_LENGTH ?
-                                   totalSamples - MIN_LOOP_LENGTH : 0;
-
-    // Apply modulation to loop start (clamped to 0-1)
-    float modulatedStart = std::clamp(loopStartNorm + startMod, 0.0f, 1.0f);
-    pendingStart = availableSpan > 0 ?
-                   static_cast<uint32_t>(modulatedStart * availableSpan) : 0;
-
-    // Apply modulation to loop length (clamped to 0-1)
-    float modulatedLength = std::clamp(loopLengthNorm + lengthMod, 0.0f, 1.0f);
-    uint32_t loopLen = MIN_LOOP_LENGTH +
-                      (availableSpan > 0 ?
-                       static_cast<uint32_t>(modulatedLength * availableSpan) : 0);
-
-    pendingEnd = pendingStart + loopLen;
-    if (pendingEnd > totalSamples) {
-        pendingEnd = totalSamples;
-    }
-    pendingLoopValid = true;
+    pendingLoopValid = config->loopBoundaries(currentSample, startMod, lengthMod, pendingStart, pendingEnd);
 }
 
 void Sampler::ensurePendingLoop(float startMod, float lengthMod) {
@@ -187,7 +321,7 @@ void Sampler::applyPendingLoopToVoice(SamplerVoice* voice) {
     voice->loop_start = pendingStart;
     voice->loop_end = pendingEnd;
     uint32_t startSample = pendingStart;
-    if (mode == PlaybackMode::REVERSE && pendingEnd > pendingStart) {
+    if (config->mode == PlaybackMode::REVERSE && pendingEnd > pendingStart) {
         startSample = pendingEnd - 1;
     }
     voice->phase_q32_32 = static_cast<uint64_t>(startSample) << 32;
@@ -220,7 +354,7 @@ bool Sampler::wrapPhase(SamplerVoice* voice) const {
     return wrapped;
 }
 
-int16_t Sampler::getSample(const SamplerVoice* voice, bool isReverse) const {
+int16_t Sampler::getSample(const SamplerVoice* voice, bool isReverse, int64_t inc) const {
     if (!voice->active || voice->amplitude <= 0.0f || !currentSample) {
         return 0;
     }
@@ -255,6 +389,21 @@ int16_t Sampler::getSample(const SamplerVoice* voice, bool isReverse) const {
         additionalFade = std::clamp(additionalFade, 0.0f, 1.0f);
     }
 
+    const uint32_t frac32 = static_cast<uint32_t>(voice->phase_q32_32 & 0xFFFFFFFFull);
+    if (config->renderInterpolation != SamplerInterpolation::LINEAR) {
+        return static_cast<int16_t>(interpolateWindow(voice, i, frac32, inc) * additionalFade);
+    }
+
+    // Pitched up: the mip levels, away from the loop ends they would blur
+    int level;
+    uint8_t blend;
+    if (pickMip(inc, level, blend)) {
+        const uint32_t margin = mipMargin(level, blend);
+        if (i >= voice->loop_start + margin && i + margin < voice->loop_end) {
+            return static_cast<int16_t>(mipSample(voice->phase_q32_32, level, blend) * additionalFade);
+        }
+    }
+
     // Get second sample for interpolation (handle loop boundaries)
     uint32_t i2;
     if (isReverse) {
@@ -264,13 +413,10 @@ int16_t Sampler::getSample(const SamplerVoice* voice, bool isReverse) const {
     }
 
     // Extract 8-bit fractional part for interpolation
-    const uint32_t frac32 = static_cast<uint32_t>(voice->phase_q32_32 & 0xFFFFFFFFull);
     const uint8_t mu8 = static_cast<uint8_t>(frac32 >> 24);
 
     // Perform interpolation
-    int16_t sample = interpolate(currentSample->samples[i],
-                                currentSample->samples[i2],
-                                mu8);
+    int16_t sample = interpolate(frameAt(i), frameAt(i2), mu8);
 
     // Apply additional fade if needed
     sample = static_cast<int16_t>(sample * additionalFade);
@@ -278,8 +424,98 @@ int16_t Sampler::getSample(const SamplerVoice* voice, bool isReverse) const {
     return sample;
 }
 
-int64_t Sampler::calculateIncrement(float sampleRate, float fmInput,
-                                    float pitchMod, bool isReverse, int midiNote) {
+// Hermite or sinc at index + frac. Inside the voice's loop the taps wrap
+// around it, as playback does; outside it (a crossfade running past the
+// loop end) they stop at the ends of the sample
+int16_t Sampler::interpolateWindow(const SamplerVoice* voice, uint32_t index, uint32_t frac,
+                                   int64_t inc) const {
+    const bool sinc = config->renderInterpolation == SamplerInterpolation::SINC;
+    const int first = sinc ? -(kSincHalfTaps - 1) : -1;
+    const int count = sinc ? 2 * kSincHalfTaps : 4;
+    const bool inLoop = index >= voice->loop_start && index < voice->loop_end;
+    const int64_t loopLen = static_cast<int64_t>(voice->loop_end) - voice->loop_start;
+    const int64_t last = static_cast<int64_t>(currentSample->sampleCount) - 1;
+
+    int16_t taps[2 * kSincHalfTaps];
+    for (int k = 0; k < count; ++k) {
+        int64_t j = static_cast<int64_t>(index) + first + k;
+        if (inLoop) {
+            if (j < voice->loop_start) {
+                j += loopLen;
+            } else if (j >= voice->loop_end) {
+                j -= loopLen;
+            }
+        } else {
+            j = std::clamp<int64_t>(j, 0, last);
+        }
+        taps[k] = frameAt(static_cast<uint32_t>(j));
+    }
+    return toSample16(sinc ? sincAt(loadLanes(taps), loadLanes(taps + 4), frac, sincBand(inc))
+                           : hermiteAt(loadLanes(taps), frac));
+}
+
+int16_t Sampler::frameAt(uint32_t index) const {
+    // Streamed samples only keep the preroll in samples[]
+    return currentSample->stream ? currentSample->stream->frame(index)
+                                 : currentSample->samples[index];
+}
+
+// Mip levels for a linear read at this increment: level (0 = samples[])
+// is the octave the ratio falls in, blended toward the next level (Q8)
+// over the upper half of the octave, where a linear read of it would
+// start to fold its top band down; from 8x up, level 3 alone. False when
+// the sample itself serves
+bool Sampler::pickMip(int64_t inc, int& level, uint8_t& blend) const {
+    const uint64_t ratio = static_cast<uint64_t>(inc < 0 ? -inc : inc);
+    if (!currentSample->mips || currentSample->stream) {
+        return false;
+    }
+    level = 0;
+    while (level < SampleMips::kLevels && (ratio >> level) >= (2ull << 32)) {
+        ++level;
+    }
+    // How far into the octave, Q9
+    const uint32_t into = level < SampleMips::kLevels && (ratio >> level) > (1ull << 32) ?
+        static_cast<uint32_t>(((ratio >> level) - (1ull << 32)) >> 23) : 0;
+    blend = static_cast<uint8_t>(into > 256 ? into - 256 : 0);
+    return level > 0 || blend > 0;
+}
+
+// Linear read of a level at a phase in samples[] frames (for level 0 the
+// frame after, not the loop's next, so callers keep mipMargin away from
+// the loop ends)
+int16_t Sampler::mipSample(uint64_t phase, int level, uint8_t blend) const {
+    auto read = [&](int l) {
+        const int16_t* data = l == 0 ? currentSample->samples : currentSample->mips->level[l - 1].data();
+        const uint32_t last = l == 0 ? currentSample->sampleCount - 1 :
+            static_cast<uint32_t>(currentSample->mips->level[l - 1].size()) - 1;
+        const uint64_t p = phase >> l;
+        const uint32_t idx = std::min(static_cast<uint32_t>(p >> 32), last);
+        const uint8_t mu8 = static_cast<uint8_t>(static_cast<uint32_t>(p) >> 24);
+        return interpolate(data[idx], data[std::min(idx + 1, last)], mu8);
+    };
+    const int16_t s = read(level);
+    return blend ? interpolate(s, read(level + 1), blend) : s;
+}
+
+// Frames from either loop end within which a mipSample read would take in
+// audio from across the loop seam
+uint32_t Sampler::mipMargin(int level, uint8_t blend) {
+    const int top = blend ? level + 1 : level;
+    return (SampleMips::kReach + 2) << top;
+}
+
+// Tell the stream's I/O thread where the primary voice is heading
+void Sampler::publishStreamCursor() {
+    const bool isReverse = (config->mode == PlaybackMode::REVERSE) ||
+                           (config->mode == PlaybackMode::ALTERNATE && playingReverse);
+    currentSample->stream->updateCursor(streamCursor,
+                                        static_cast<uint32_t>(primaryVoice->phase_q32_32 >> 32),
+                                        isReverse, config->mode == PlaybackMode::ALTERNATE,
+                                        primaryVoice->loop_start, primaryVoice->loop_end);
+}
+
+int64_t Sampler::calculateBaseIncrement(float sampleRate, float pitchMod, int midiNote) const {
     if (!currentSample) {
         return 0;
     }
@@ -287,7 +523,7 @@ int64_t Sampler::calculateIncrement(float sampleRate, float fmInput,
     // Calculate base increment from sample rate ratio and playback speed
     // Q32.32 format: (source_rate / output_rate) * playbackSpeed
     double baseRatio = (static_cast<double>(currentSample->sampleRate) /
-                       static_cast<double>(sampleRate)) * playbackSpeed;
+                       static_cast<double>(sampleRate)) * config->playbackSpeed;
 
     // KEY mode: apply exponential pitch tracking based on MIDI note
     // C4 (note 60) = 1.0, each semitone = 2^(1/12)
@@ -299,13 +535,10 @@ int64_t Sampler::calculateIncrement(float sampleRate, float fmInput,
     // Apply pitch modulation (in octaves)
     baseRatio *= std::pow(2.0, pitchMod);
 
-    int64_t baseInc = static_cast<int64_t>(baseRatio * (1ULL << 32));
-
-    // Apply direction
-    if (isReverse) {
-        baseInc = -baseInc;
-    }
+    return static_cast<int64_t>(baseRatio * (1ULL << 32));
+}
 
+int64_t Sampler::applyTZFM(int64_t baseInc, float fmInput) {
     // Apply TZFM from FM matrix routing
     // FM input is already scaled by FM matrix depth (0-1 range from matrix)
     // One-pole smoothing to prevent clicks
@@ -362,8 +595,9 @@ void Sampler::setupCrossfade(uint32_t xfadeLen, uint32_t xfadeSamples,
 
     // Start crossfade
     crossfading = true;
-    crossfadeSamplesTotal = xfadeSamples;
     crossfadeSamplesRemaining = xfadeSamples;
+    crossfadeProgressQ32 = 0;
+    crossfadeStepQ32 = 0xFFFFFFFFu / xfadeSamples;
 }
 
 void Sampler::applyPhaseDriver(float normalized) {
@@ -392,21 +626,22 @@ void Sampler::applyPhaseDriver(float normalized) {
     }
 }
 
-float Sampler::process(float sampleRate, float fmInput, float pitchMod,
-                      float loopStartMod, float loopLengthMod,
-                      float crossfadeMod, float levelMod, float levelOffset,
-                      float phaseDriver, int midiNote) {
+bool Sampler::hasSample() const {
+    return swapStage != SwapStage::NONE ||
+           (currentSample && currentSample->samples && currentSample->sampleCount >= 2);
+}
+
+bool Sampler::beginProcess(const SamplerModulation& mod) {
     // Early exit if no sample loaded
     if (!currentSample || !currentSample->samples ||
         currentSample->sampleCount < 2) {
-        return 0.0f;
+        return false;
     }
 
     if (restartRequested) {
-        ensurePendingLoop(loopStartMod, loopLengthMod);
+        ensurePendingLoop(mod.loopStartMod, mod.loopLengthMod);
         crossfading = false;
         crossfadeSamplesRemaining = 0;
-        crossfadeSamplesTotal = 0;
         applyPendingLoopToVoice(primaryVoice);
         secondaryVoice->active = false;
         secondaryVoice->amplitude = 0.0f;
@@ -415,8 +650,8 @@ float Sampler::process(float sampleRate, float fmInput, float pitchMod,
         restartRequested = false;
     }
 
-    if (phaseDriver >= 0.0f && std::isfinite(phaseDriver)) {
-        float normalized = std::clamp(phaseDriver, 0.0f, 1.0f);
+    if (mod.phaseDriver >= 0.0f && std::isfinite(mod.phaseDriver)) {
+        float normalized = std::clamp(mod.phaseDriver, 0.0f, 1.0f);
         if (std::fabs(normalized - lastPhaseDriver) > 0.001f) {
             applyPhaseDriver(normalized);
             lastPhaseDriver = normalized;
@@ -425,26 +660,78 @@ float Sampler::process(float sampleRate, float fmInput, float pitchMod,
         lastPhaseDriver = -1.0f;
     }
 
+    if (currentSample->stream) {
+        publishStreamCursor();
+    }
+    return true;
+}
+
+uint32_t Sampler::crossfadeLength(float crossfadeMod) const {
     // Calculate crossfade length (in source samples)
     // Ping-pong (ALTERNATE) mode disables crossfading - uses phase reflection instead
     uint32_t xfadeLen = 0;
-    if (mode != PlaybackMode::ALTERNATE && primaryVoice->loop_end > primaryVoice->loop_start) {
+    if (config->mode != PlaybackMode::ALTERNATE && primaryVoice->loop_end > primaryVoice->loop_start) {
         uint32_t loopLen = primaryVoice->loop_end - primaryVoice->loop_start;
         uint32_t maxXfade = loopLen / 2;
 
         // Apply crossfade modulation
-        float modulatedXfade = std::clamp(crossfadeLengthNorm + crossfadeMod,
+        float modulatedXfade = std::clamp(config->crossfadeLengthNorm + crossfadeMod,
                                          0.0f, 1.0f);
         xfadeLen = static_cast<uint32_t>(maxXfade * modulatedXfade);
         xfadeLen = std::clamp(xfadeLen, 8u, maxXfade);
     }
+    return xfadeLen;
+}
+
+float Sampler::outputGain(const SamplerModulation& mod) const {
+    // Samplers use simplified amplitude model compared to oscillators
+    // Oscillators have: (baseAmp + ampMod) × level, where baseAmp defaults to 0.0
+    // Samplers use: (0.0 + levelMod) × level
+    // This gives the same behavior: envelope modulation (0.5-1.0 from unidirectional)
+    // added to base amp of 0.0, then multiplied by static mix level
+    float modulatedAmp = std::clamp(0.0f + mod.levelMod, 0.0f, 1.0f);
+    float modulatedLevel = std::clamp(config->level + mod.levelOffset, 0.0f, 1.0f);
+    // Mapped samples carry their -3 dB normalization as a gain
+    return modulatedAmp * modulatedLevel * currentSample->gain;
+}
+
+float Sampler::process(float sampleRate, float fmInput, float pitchMod,
+                      float loopStartMod, float loopLengthMod,
+                      float crossfadeMod, float levelMod, float levelOffset,
+                      float phaseDriver, int midiNote) {
+    SamplerModulation mod;
+    mod.sampleRate = sampleRate;
+    mod.pitchMod = pitchMod;
+    mod.loopStartMod = loopStartMod;
+    mod.loopLengthMod = loopLengthMod;
+    mod.crossfadeMod = crossfadeMod;
+    mod.levelMod = levelMod;
+    mod.levelOffset = levelOffset;
+    mod.phaseDriver = phaseDriver;
+    mod.midiNote = midiNote;
+
+    float output = beginProcess(mod) ?
+                   renderFrame(mod, fmInput, calculateBaseIncrement(sampleRate, pitchMod, midiNote)) : 0.0f;
+    if (swapStage != SwapStage::NONE) {
+        output *= advanceSwapGain();
+    }
+    return output;
+}
+
+// One sample of the full state machine: crossfade trigger, advance, wrap,
+// crossfade step and mix
+float Sampler::renderFrame(const SamplerModulation& mod, float fmInput, int64_t baseIncrement) {
+    const float loopStartMod = mod.loopStartMod;
+    const float loopLengthMod = mod.loopLengthMod;
+
+    uint32_t xfadeLen = crossfadeLength(mod.crossfadeMod);
 
     // Determine playback direction
-    bool isReverse = (mode == PlaybackMode::REVERSE) ||
-                     (mode == PlaybackMode::ALTERNATE && playingReverse);
+    bool isReverse = (config->mode == PlaybackMode::REVERSE) ||
+                     (config->mode == PlaybackMode::ALTERNATE && playingReverse);
 
     // Calculate phase increment
-    int64_t inc = calculateIncrement(sampleRate, fmInput, pitchMod, isReverse, midiNote);
+    int64_t inc = applyTZFM(isReverse ? -baseIncrement : baseIncrement, fmInput);
 
     // Convert crossfade length to output samples using actual increment
     uint32_t xfadeSamples = 16u;
@@ -484,7 +771,7 @@ float Sampler::process(float sampleRate, float fmInput, float pitchMod,
         bool wrappedPrimary = wrapPhase(primaryVoice);
         if (wrappedPrimary) {
             // Toggle direction for ping-pong mode
-            if (mode == PlaybackMode::ALTERNATE) {
+            if (config->mode == PlaybackMode::ALTERNATE) {
                 playingReverse = !playingReverse;
             }
 
@@ -501,12 +788,13 @@ float Sampler::process(float sampleRate, float fmInput, float pitchMod,
         secondaryVoice->phase_q32_32 += inc;
         wrapPhase(secondaryVoice);
 
-        // Calculate constant-power crossfade amplitudes
-        float t = static_cast<float>(crossfadeSamplesTotal -
-                                    crossfadeSamplesRemaining) /
-                 static_cast<float>(crossfadeSamplesTotal);
-        primaryVoice->amplitude = std::cos(M_PI_2 * t);
-        secondaryVoice->amplitude = std::sin(M_PI_2 * t);
+        // Constant-power crossfade amplitudes, as lung computes them:
+        // top 8 bits of the progress index the table, next 8 interpolate
+        const uint32_t idx = crossfadeProgressQ32 >> 24;
+        const uint32_t w8 = (crossfadeProgressQ32 >> 16) & 0xFFu;
+        primaryVoice->amplitude = quarterSine(255u - idx, 256u - w8);   // Fade out: 1.0 -> 0.0
+        secondaryVoice->amplitude = quarterSine(idx, w8);               // Fade in: 0.0 -> 1.0
+        crossfadeProgressQ32 += crossfadeStepQ32;
 
         if (--crossfadeSamplesRemaining == 0) {
             // Crossfade complete - swap voices
@@ -525,12 +813,12 @@ float Sampler::process(float sampleRate, float fmInput, float pitchMod,
     bool isRevNow = (inc < 0);
 
     if (primaryVoice->active && primaryVoice->amplitude > 0.0f) {
-        int16_t s = getSample(primaryVoice, isRevNow);
+        int16_t s = getSample(primaryVoice, isRevNow, inc);
         mixedSample += static_cast<int32_t>(s * primaryVoice->amplitude);
     }
 
     if (secondaryVoice->active && secondaryVoice->amplitude > 0.0f) {
-        int16_t s = getSample(secondaryVoice, isRevNow);
+        int16_t s = getSample(secondaryVoice, isRevNow, inc);
         mixedSample += static_cast<int32_t>(s * secondaryVoice->amplitude);
     }
 
@@ -541,16 +829,203 @@ float Sampler::process(float sampleRate, float fmInput, float pitchMod,
     float output = static_cast<float>(mixedSample) / 32768.0f;
 
     // Apply amplitude modulation
-    // Samplers use simplified amplitude model compared to oscillators
-    // Oscillators have: (baseAmp + ampMod) × level, where baseAmp defaults to 0.0
-    // Samplers use: (0.0 + levelMod) × level
-    // This gives the same behavior: envelope modulation (0.5-1.0 from unidirectional)
-    // added to base amp of 0.0, then multiplied by static mix level
-    float modulatedAmp = std::clamp(0.0f + levelMod, 0.0f, 1.0f);
-    float modulatedLevel = std::clamp(level + levelOffset, 0.0f, 1.0f);
-    float finalGain = modulatedAmp * modulatedLevel;
+    return output * outputGain(mod);
+}
 
-    return output * finalGain;
+// Frames the primary voice can advance by a constant inc from its current
+// phase with no crossfade trigger and no wrap; 0 means the next frame is an
+// event and must go through renderFrame
+int Sampler::steadyFrames(int64_t inc, uint32_t xfadeLen, int maxFrames) const {
+    const SamplerVoice* voice = primaryVoice;
+    if (voice->loop_end <= voice->loop_start) {
+        return 0;
+    }
+    const int64_t startQ = static_cast<int64_t>(voice->loop_start) << 32;
+    const int64_t endQ = static_cast<int64_t>(voice->loop_end) << 32;
+    const int64_t phase = static_cast<int64_t>(voice->phase_q32_32);
+    if (phase < startQ || phase >= endQ) {
+        return 0;
+    }
+    if (inc == 0) {
+        // Frozen playhead: only a zone entry could change anything
+        bool inZone = xfadeLen > 0 &&
+                      isInCrossfadeZone(voice->phase_q32_32, voice->loop_start,
+                                        voice->loop_end, xfadeLen, config->mode == PlaybackMode::REVERSE);
+        return inZone ? 0 : maxFrames;
+    }
+
+    const int64_t step = inc > 0 ? inc : -inc;
+    int64_t frames = maxFrames;
+
+    // Frame k advances phase + k*inc to phase + (k+1)*inc; stop before the
+    // first frame that would leave [start, end)
+    int64_t untilWrap = inc > 0 ? (endQ - phase + step - 1) / step - 1
+                                : (phase - startQ) / step;
+    frames = std::min(frames, untilWrap);
+
+    if (xfadeLen > 0) {
+        // Frame k checks the zone at phase + k*inc before advancing
+        const bool isReverse = (config->mode == PlaybackMode::REVERSE);
+        if (isInCrossfadeZone(voice->phase_q32_32, voice->loop_start, voice->loop_end,
+                              xfadeLen, isReverse)) {
+            return 0;
+        }
+        uint32_t zoneStart;
+        uint32_t zoneEnd;
+        if (isReverse) {
+            zoneStart = voice->loop_start;
+            zoneEnd = (voice->loop_start + xfadeLen < voice->loop_end) ?
+                      (voice->loop_start + xfadeLen) : voice->loop_end;
+        } else {
+            zoneStart = (voice->loop_end > xfadeLen) ? (voice->loop_end - xfadeLen) : voice->loop_start;
+            zoneEnd = voice->loop_end;
+        }
+        const int64_t zoneStartQ = static_cast<int64_t>(zoneStart) << 32;
+        const int64_t zoneEndQ = static_cast<int64_t>(zoneEnd) << 32;
+        if (inc > 0 && phase < zoneStartQ) {
+            frames = std::min(frames, (zoneStartQ - phase + step - 1) / step);
+        } else if (inc < 0 && phase >= zoneEndQ) {
+            frames = std::min(frames, (phase - zoneEndQ) / step + 1);
+        }
+    }
+
+    return static_cast<int>(std::max<int64_t>(frames, 0));
+}
+
+void Sampler::processBlock(const SamplerModulation& mod, float* out, int n) {
+    if (n <= 0) {
+        return;
+    }
+
+    // A hot-swap fade runs frame by frame (the sample changes inside it)
+    if (swapStage != SwapStage::NONE) {
+        int k = 0;
+        for (; k < n && swapStage != SwapStage::NONE; ++k) {
+            float output = beginProcess(mod) ?
+                           renderFrame(mod, 0.0f, calculateBaseIncrement(mod.sampleRate, mod.pitchMod, mod.midiNote)) :
+                           0.0f;
+            out[k] = output * advanceSwapGain();
+        }
+        if (k < n) {
+            processBlock(mod, out + k, n - k);
+        }
+        return;
+    }
+
+    if (!beginProcess(mod)) {
+        std::fill(out, out + n, 0.0f);
+        return;
+    }
+
+    // Control-rate terms, fixed for the block
+    const int64_t baseIncrement = calculateBaseIncrement(mod.sampleRate, mod.pitchMod, mod.midiNote);
+    const float gain = outputGain(mod);
+    const int16_t* data = currentSample->samples;
+
+    int i = 0;
+    while (i < n) {
+        // Steady state needs a settled TZFM smoother, so inc is constant
+        int run = 0;
+        int64_t inc = 0;
+        uint32_t xfadeLen = 0;
+        // (streamed samples always take the per-frame path through frameAt)
+        if (!crossfading && modulatorSmoothed == 0.0f && !currentSample->stream) {
+            xfadeLen = crossfadeLength(mod.crossfadeMod);
+            bool isReverse = (config->mode == PlaybackMode::REVERSE) ||
+                             (config->mode == PlaybackMode::ALTERNATE && playingReverse);
+            // Same rounding as applyTZFM with a zero modulator
+            inc = static_cast<int64_t>(static_cast<float>(isReverse ? -baseIncrement : baseIncrement));
+            inc = std::clamp<int64_t>(inc, -(1LL << 37), 1LL << 37);
+            run = steadyFrames(inc, xfadeLen, n - i);
+        }
+
+        if (run == 0) {
+            out[i++] = renderFrame(mod, 0.0f, baseIncrement);
+            continue;
+        }
+
+        SamplerVoice* voice = primaryVoice;
+        if (xfadeLen > 0) {
+            wasInZoneLastSample = false;
+        }
+        if (!voice->active || voice->amplitude <= 0.0f) {
+            voice->phase_q32_32 += static_cast<uint64_t>(inc * run);
+            std::fill(out + i, out + i + run, 0.0f);
+            i += run;
+            continue;
+        }
+
+        // Tight loop: the phase stays inside [loop_start, loop_end)
+        const float amplitude = voice->amplitude;
+        const uint32_t loopStart = voice->loop_start;
+        const uint32_t loopLast = voice->loop_end - 1;
+        const bool isRevNow = inc < 0;
+        uint64_t phase = voice->phase_q32_32;
+        if ((inc == (1LL << 32) || inc == -(1LL << 32)) && static_cast<uint32_t>(phase) == 0) {
+            // Unity speed on the sample grid (a sample at the engine rate,
+            // see SampleBank::setResampleRate): every mode reads it as is
+            for (int k = 0; k < run; ++k) {
+                phase += static_cast<uint64_t>(inc);
+                const int16_t s = data[static_cast<uint32_t>(phase >> 32)];
+                int32_t mixed = std::clamp(static_cast<int32_t>(s * amplitude), -32768, 32767);
+                out[i + k] = (static_cast<float>(mixed) / 32768.0f) * gain;
+            }
+            voice->phase_q32_32 = phase;
+            i += run;
+            continue;
+        }
+        if (config->renderInterpolation != SamplerInterpolation::LINEAR) {
+            // Taps straight from the data while the window fits inside the loop
+            const bool sinc = config->renderInterpolation == SamplerInterpolation::SINC;
+            const uint32_t before = sinc ? kSincHalfTaps - 1 : 1;
+            const uint32_t after = sinc ? kSincHalfTaps : 2;
+            const int band = sincBand(inc);
+            for (int k = 0; k < run; ++k) {
+                phase += static_cast<uint64_t>(inc);
+                const uint32_t idx = static_cast<uint32_t>(phase >> 32);
+                const uint32_t frac = static_cast<uint32_t>(phase);
+                int16_t s;
+                if (idx >= loopStart + before && idx + after <= loopLast) {
+                    const int16_t* taps = data + idx - before;
+                    s = toSample16(sinc ? sincAt(loadLanes(taps), loadLanes(taps + 4), frac, band)
+                                        : hermiteAt(loadLanes(taps), frac));
+                } else {
+                    s = interpolateWindow(voice, idx, frac, inc);
+                }
+                int32_t mixed = std::clamp(static_cast<int32_t>(s * amplitude), -32768, 32767);
+                out[i + k] = (static_cast<float>(mixed) / 32768.0f) * gain;
+            }
+            voice->phase_q32_32 = phase;
+            i += run;
+            continue;
+        }
+        int level;
+        uint8_t blend;
+        const bool mipped = pickMip(inc, level, blend);
+        const uint32_t margin = mipped ? mipMargin(level, blend) : 0;
+        for (int k = 0; k < run; ++k) {
+            phase += static_cast<uint64_t>(inc);
+            const uint32_t idx = static_cast<uint32_t>(phase >> 32);
+            if (mipped && idx >= loopStart + margin && idx + margin <= loopLast) {
+                int32_t mixed = static_cast<int32_t>(mipSample(phase, level, blend) * amplitude);
+                mixed = std::clamp(mixed, -32768, 32767);
+                out[i + k] = (static_cast<float>(mixed) / 32768.0f) * gain;
+                continue;
+            }
+            uint32_t idx2;
+            if (isRevNow) {
+                idx2 = (idx > loopStart) ? (idx - 1) : loopLast;
+            } else {
+                idx2 = (idx < loopLast) ? (idx + 1) : loopStart;
+            }
+            const uint8_t mu8 = static_cast<uint8_t>(static_cast<uint32_t>(phase) >> 24);
+            int32_t mixed = static_cast<int32_t>(interpolate(data[idx], data[idx2], mu8) * amplitude);
+            mixed = std::clamp(mixed, -32768, 32767);
+            out[i + k] = (static_cast<float>(mixed) / 32768.0f) * gain;
+        }
+        voice->phase_q32_32 = phase;
+        i += run;
+    }
 }
 
 // Linear interpolation between two int16_t values using 8-bit fractional weight
@@ -11,6 +11,16 @@ enum class PlaybackMode {
     ALTERNATE = 2  // Ping-pong
 };
 
+// Resampling quality, per sampler slot. Linear is the cheapest; Hermite
+// (4-point Catmull-Rom) removes most of its noise at low speeds; Sinc
+// (8-tap Kaiser-windowed, band-limited to the playback speed) also keeps
+// pitched-up playback from aliasing
+enum class SamplerInterpolation : uint8_t {
+    LINEAR = 0,
+    HERMITE = 1,
+    SINC = 2
+};
+
 // Forward declaration for sample data
 struct SampleData;
 
@@ -23,6 +33,53 @@ struct SamplerVoice {
     bool active;                // Is this voice currently playing?
 };
 
+// Modulation inputs for one block, held constant across processBlock
+struct SamplerModulation {
+    float sampleRate = 48000.0f;
+    float pitchMod = 0.0f;        // Octaves
+    float loopStartMod = 0.0f;
+    float loopLengthMod = 0.0f;
+    float crossfadeMod = 0.0f;
+    float levelMod = 0.0f;
+    float levelOffset = 0.0f;
+    float phaseDriver = -1.0f;    // < 0 = not driven
+    int midiNote = 60;
+};
+
+// Settings of one sampler slot, shared by every Sampler playing it (the
+// slot in each voice and the free-running one). Synth owns one per slot and
+// writes the settings; samplers only read them. prepare() runs on the audio
+// thread once per buffer, ahead of the voices, and works out the
+// unmodulated loop of the slot's current sample for all of them.
+struct SamplerConfig {
+    float loopStartNorm = 0.0f;        // 0.0 to 1.0
+    float loopLengthNorm = 1.0f;       // 0.0 to 1.0 (of available range)
+    float crossfadeLengthNorm = 0.1f;  // 0.0 to 1.0 (of loop length)
+    float playbackSpeed = 1.0f;        // Speed multiplier
+    float tzfmDepth = 0.0f;            // 0.0 to 1.0
+    float level = 1.0f;                // Output level (0.0 to 1.0)
+    PlaybackMode mode = PlaybackMode::FORWARD;
+    SamplerInterpolation interpolation = SamplerInterpolation::LINEAR;
+    bool snapLoop = true;              // Move loop points to nearby zero crossings
+
+    // Audio thread: the slot's current sample and its unmodulated loop
+    const SampleData* sample = nullptr;
+    uint32_t loopStart = 0;
+    uint32_t loopEnd = 0;
+    bool loopValid = false;
+    SamplerInterpolation renderInterpolation = SamplerInterpolation::LINEAR;  // interpolation, capped
+
+    // cap: the best interpolation the engine can afford this buffer
+    void prepare(SamplerInterpolation cap = SamplerInterpolation::SINC);
+
+    // Loop of sample in samples with the settings plus modulation; false
+    // when the sample is too short to loop. With snapLoop, each end moves to
+    // the nearest rising zero crossing of the sample's analysis if one is
+    // close, unless the audio there is near silence
+    bool loopBoundaries(const SampleData* sample, float startMod, float lengthMod,
+                        uint32_t& start, uint32_t& end) const;
+};
+
 class Sampler {
 public:
     Sampler();
@@ -43,25 +100,31 @@ public:
                   float crossfadeMod, float levelMod, float levelOffset,
                   float phaseDriver, int midiNote = 60);
 
+    // Render n samples with no FM input; equivalent to n process() calls.
+    // Loop, crossfade and wrap bookkeeping only runs at the samples where an
+    // event (zone entry, wrap, crossfade step) can happen; the frames between
+    // events are rendered in a tight interpolation loop.
+    void processBlock(const SamplerModulation& mod, float* out, int n);
+
     // Parameter setters
+    // setSample switches immediately; call it only while the sampler isn't
+    // being processed (or from the audio thread on a silent sampler)
     void setSample(const SampleData* sample);
-    void setLoopStart(float normalized);    // 0.0 to 1.0
-    void setLoopLength(float normalized);   // 0.0 to 1.0 (of available range)
-    void setCrossfadeLength(float normalized); // 0.0 to 1.0 (of loop length)
-    void setPlaybackSpeed(float speed);     // 0.5 = half speed, 2.0 = double speed
-    void setTZFMDepth(float depth);         // 0.0 to 1.0
-    void setPlaybackMode(PlaybackMode mode);
-    void setLevel(float level);             // 0.0 to 1.0
-    void setKeyMode(bool enabled);
 
-    // Parameter getters
-    float getLoopStart() const { return loopStartNorm; }
-    float getLoopLength() const { return loopLengthNorm; }
-    float getCrossfadeLength() const { return crossfadeLengthNorm; }
-    float getPlaybackSpeed() const { return playbackSpeed; }
-    float getTZFMDepth() const { return tzfmDepth; }
-    PlaybackMode getPlaybackMode() const { return mode; }
-    float getLevel() const { return level; }
+    // Audio thread: switch samples with a short fade out of the old one and
+    // fade in of the new one, completed inside process()/processBlock()
+    void queueSample(const SampleData* sample);
+    // The old sample is still referenced until the fade out finishes
+    bool hasPendingSwap() const { return swapStage == SwapStage::FADE_OUT; }
+    // Complete a pending swap at once (for samplers that aren't processed)
+    void finishSwap();
+    // Anything to play: a usable sample, or a swap fade still running
+    bool hasSample() const;
+
+    // Slot settings; config must outlive the sampler
+    void setConfig(const SamplerConfig* config);
+    const SamplerConfig& getConfig() const { return *config; }
+    void setKeyMode(bool enabled);
     bool isKeyMode() const { return keyMode; }
 
     // Get current playback position (0.0 to 1.0)
@@ -82,15 +145,10 @@ public:
 private:
     // Sample data
     const SampleData* currentSample;
+    int streamCursor;           // Prefetch cursor on a streamed sample, or -1
 
     // Playback parameters
-    float loopStartNorm;        // 0.0 to 1.0
-    float loopLengthNorm;       // 0.0 to 1.0
-    float crossfadeLengthNorm;  // 0.0 to 1.0
-    float playbackSpeed;        // Speed multiplier
-    float tzfmDepth;            // TZFM depth (0.0 to 1.0)
-    float level;                // Output level (0.0 to 1.0)
-    PlaybackMode mode;          // Playback direction (Forward/Reverse/Alternate)
+    const SamplerConfig* config;
     bool keyMode;               // true = respond to MIDI notes, false = free-run
 
     // Dual-voice crossfading state
@@ -101,8 +159,9 @@ private:
 
     // Crossfade state
     bool crossfading;
-    uint32_t crossfadeSamplesTotal;
     uint32_t crossfadeSamplesRemaining;
+    uint32_t crossfadeProgressQ32;      // Progress 0..1 as a Q0.32 fraction
+    uint32_t crossfadeStepQ32;          // Progress per sample: 2^32 / total
 
     // Pending loop parameters (calculated once per process call)
     uint32_t pendingStart;
@@ -122,13 +181,33 @@ private:
 
     float lastPhaseDriver;
 
+    // Sample hot-swap fade (queueSample)
+    enum class SwapStage : uint8_t { NONE, FADE_OUT, FADE_IN };
+    static constexpr int SWAP_FADE_FRAMES = 64;
+    SwapStage swapStage;
+    int swapFramesRemaining;
+    const SampleData* swapTarget;
+    float advanceSwapGain();
+
     // Helper functions
+    bool beginProcess(const SamplerModulation& mod);
+    float renderFrame(const SamplerModulation& mod, float fmInput, int64_t baseIncrement);
+    int steadyFrames(int64_t inc, uint32_t xfadeLen, int maxFrames) const;
+    uint32_t crossfadeLength(float crossfadeMod) const;
+    float outputGain(const SamplerModulation& mod) const;
     void calculateLoopBoundaries(float startMod, float lengthMod);
     void ensurePendingLoop(float startMod, float lengthMod);
     void applyPendingLoopToVoice(SamplerVoice* voice);
     bool wrapPhase(SamplerVoice* voice) const;
-    int16_t getSample(const SamplerVoice* voice, bool isReverse) const;
-    int64_t calculateIncrement(float sampleRate, float fmInput, float pitchMod, bool isReverse, int midiNote);
+    int16_t getSample(const SamplerVoice* voice, bool isReverse, int64_t inc) const;
+    int16_t interpolateWindow(const SamplerVoice* voice, uint32_t index, uint32_t frac, int64_t inc) const;
+    int16_t frameAt(uint32_t index) const;
+    bool pickMip(int64_t inc, int& level, uint8_t& blend) const;
+    int16_t mipSample(uint64_t phase, int level, uint8_t blend) const;
+    static uint32_t mipMargin(int level, uint8_t blend);
+    void publishStreamCursor();
+    int64_t calculateBaseIncrement(float sampleRate, float pitchMod, int midiNote) const;
+    int64_t applyTZFM(int64_t baseInc, float fmInput);
     bool isInCrossfadeZone(uint64_t phase, uint32_t loopStart, uint32_t loopEnd,
                           uint32_t xfadeLen, bool isReverse) const;
     void setupCrossfade(uint32_t xfadeLen, uint32_t xfadeSamples, bool isReverse);
@@ -0,0 +1,123 @@
+#ifndef SCOPE_RING_H
+#define SCOPE_RING_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+
+// Oscilloscope feed from the audio thread to the UI. The audio thread
+// copies each rendered block in whole and keeps a min/max pair per
+// kDecimation frames for zoomed-out views; the UI reads the newest frames
+// and finds its own trigger. One writer, one reader, no locks: a reader
+// that falls a whole ring behind loses the overwritten frames, never
+// blocks the writer.
+class ScopeRing {
+public:
+    static constexpr uint32_t kFrames = 8192;          // Power of two
+    static constexpr uint32_t kDecimation = 64;        // Frames per min/max pair
+    static constexpr uint32_t kPeaks = 1024;           // Pairs kept, power of two
+
+    // Audio thread
+    void write(const float* in, uint32_t n) {
+        uint32_t pos = writePos.load(std::memory_order_relaxed);
+
+        // Only the newest kFrames of an oversized block can be kept
+        const float* src = in;
+        uint32_t count = n;
+        if (count > kFrames) {
+            src += count - kFrames;
+            pos += count - kFrames;
+            count = kFrames;
+        }
+        const uint32_t start = pos & (kFrames - 1);
+        const uint32_t first = std::min(count, kFrames - start);
+        std::memcpy(frames + start, src, first * sizeof(float));
+        std::memcpy(frames, src + first, (count - first) * sizeof(float));
+        writePos.store(pos + count, std::memory_order_release);
+
+        uint32_t peak = peakPos.load(std::memory_order_relaxed);
+        for (uint32_t i = 0; i < n; ++i) {
+            pendingMin = std::min(pendingMin, in[i]);
+            pendingMax = std::max(pendingMax, in[i]);
+            if (++pendingCount == kDecimation) {
+                peakMin[peak & (kPeaks - 1)] = pendingMin;
+                peakMax[peak & (kPeaks - 1)] = pendingMax;
+                ++peak;
+                pendingMin = 1e30f;
+                pendingMax = -1e30f;
+                pendingCount = 0;
+            }
+        }
+        peakPos.store(peak, std::memory_order_release);
+    }
+
+    // UI thread: copy the newest frames (at most 3/4 of kFrames) into out,
+    // oldest first. Returns how many were copied; frames the writer may have
+    // overwritten during the copy are dropped from the front
+    uint32_t readLatest(float* out, uint32_t n) const {
+        return readRing(frames, nullptr, writePos, kFrames, out, nullptr, n);
+    }
+
+    // UI thread: the newest min/max pairs, oldest first, as readLatest
+    uint32_t readPeaks(float* mins, float* maxs, uint32_t n) const {
+        return readRing(peakMin, peakMax, peakPos, kPeaks, mins, maxs, n);
+    }
+
+    // Latest rising zero crossing in in[0, count - window], so a window of
+    // that many frames starting there is complete; -1 if there is none and
+    // the view should free-run
+    static int findTrigger(const float* in, int count, int window) {
+        for (int i = count - window; i > 0; --i) {
+            if (in[i - 1] < 0.0f && in[i] >= 0.0f) {
+                return i;
+            }
+        }
+        return -1;
+    }
+
+private:
+    static uint32_t readRing(const float* a, const float* b, const std::atomic<uint32_t>& position,
+                             uint32_t size, float* outA, float* outB, uint32_t n) {
+        // The last quarter of the ring is left to a write in flight, which
+        // overwrites slots before it publishes them
+        const uint32_t usable = size - size / 4;
+        n = std::min(n, usable);
+        const uint32_t end = position.load(std::memory_order_acquire);
+        n = std::min(n, end);
+        const uint32_t start = end - n;
+        for (uint32_t i = 0; i < n; ++i) {
+            outA[i] = a[(start + i) & (size - 1)];
+            if (b) {
+                outB[i] = b[(start + i) & (size - 1)];
+            }
+        }
+
+        // Anything the writer reached while we copied is stale
+        std::atomic_thread_fence(std::memory_order_acquire);
+        const uint32_t lapped = position.load(std::memory_order_relaxed) - start;
+        if (lapped <= usable) {
+            return n;
+        }
+        const uint32_t stale = std::min(n, lapped - usable);
+        std::memmove(outA, outA + stale, (n - stale) * sizeof(float));
+        if (b) {
+            std::memmove(outB, outB + stale, (n - stale) * sizeof(float));
+        }
+        return n - stale;
+    }
+
+    float frames[kFrames] = {};
+    std::atomic<uint32_t> writePos{0};
+
+    float peakMin[kPeaks] = {};
+    float peakMax[kPeaks] = {};
+    std::atomic<uint32_t> peakPos{0};
+
+    // Audio thread only: the pair being accumulated
+    float pendingMin = 1e30f;
+    float pendingMax = -1e30f;
+    uint32_t pendingCount = 0;
+};
+
+#endif // SCOPE_RING_H
@@ -3,11 +3,13 @@
 #include <cstdlib>
 #include <stdexcept>
 #include <algorithm>
+#include <cmath>
 
 Sequencer::Sequencer(Clock* clockSource, Synth* synth)
     : clock(clockSource)
     , currentTrackIndex(0)
     , synth(synth)
+    , jobResult(0)
 {
     if (!clock) {
         throw std::runtime_error("Sequencer requires a valid Clock pointer");
@@ -16,11 +18,25 @@ Sequencer::Sequencer(Clock* clockSource, Synth* synth)
     // Create 4 tracks by default
     for (int i = 0; i < 4; ++i) {
         tracks.emplace_back(i, 16, Subdivision::SIXTEENTH);
-        lastTriggeredStep.push_back(-1);
-        currentSteps.push_back(0);
-        trackPhaseDrivers.push_back(PhaseDriver::CLOCK);
+        playback.emplace_back();
+        playback.back().probabilityKey = rng::key(rng::Subsystem::STEP_PROBABILITY, static_cast<uint32_t>(i));
+        playingPatterns.push_back(std::make_unique<PatternSlots>(tracks.back().getPattern()));
+        playingAutomation.push_back(std::make_unique<AutomationSlots>(tracks.back().getAutomation()));
+        lookahead.push_back(std::make_unique<TrackLookahead>());
     }
 
+    // Notes and step boundaries are tracked from the audio thread; never
+    // grow past these
+    activeNotes.reserve(kMaxActiveNotes);
+    stepQueue.reserve(tracks.size());
+
+    // The sequencer and its per-track state; step lists and automation
+    // points are small next to the lookahead rings and slot copies
+    memory.set(sizeof(Sequencer) +
+               tracks.size() * (sizeof(Track) + sizeof(PatternSlots) + sizeof(AutomationSlots) +
+                                sizeof(TrackLookahead) + sizeof(TrackPlayback)) +
+               activeNotes.capacity() * sizeof(ActiveNote) + stepQueue.capacity() * sizeof(StepEvent));
+
     // Set default tempo
     clock->setTempo(90.0);  // Slow, ambient tempo
 }
@@ -42,12 +58,12 @@ void Sequencer::reset() {
     if (clock) {
         clock->reset();
     }
-    for (size_t i = 0; i < lastTriggeredStep.size(); ++i) {
-        lastTriggeredStep[i] = -1;
-    }
-    for (size_t i = 0; i < currentSteps.size(); ++i) {
-        currentSteps[i] = 0;
+    for (auto& state : playback) {
+        state.currentStep = 0;
+        state.lastTriggeredStep = -1;
+        state.automationTick = -1.0;
     }
+    stepQueueValid = false;
     allNotesOff();
 }
 
@@ -96,15 +112,117 @@ void Sequencer::setMarkovMode(int mode) {
 }
 
 void Sequencer::generatePattern() {
-    getCurrentTrack().generatePattern();
+    patternWorker.submit(PatternWorker::JobType::GENERATE, currentTrackIndex, getCurrentTrack());
 }
 
 void Sequencer::regenerateUnlocked() {
-    getCurrentTrack().regenerateUnlocked();
+    patternWorker.submit(PatternWorker::JobType::REGENERATE_UNLOCKED, currentTrackIndex, getCurrentTrack());
 }
 
 void Sequencer::mutatePattern(float amount) {
-    getCurrentTrack().mutate(amount);
+    patternWorker.submit(PatternWorker::JobType::MUTATE, currentTrackIndex, getCurrentTrack(), amount);
+}
+
+void Sequencer::updatePatterns() {
+    // A job's copy of the track carries the new pattern and the Markov
+    // chain state generation moved on; constraints and rhythm stay as edited
+    int trackIndex = 0;
+    while (patternWorker.pollResult(trackIndex, jobResult)) {
+        if (trackIndex >= 0 && trackIndex < static_cast<int>(tracks.size())) {
+            tracks[trackIndex].getPattern() = jobResult.getPattern();
+            tracks[trackIndex].getMarkovChain() = jobResult.getMarkovChain();
+            tracks[trackIndex].getRng() = jobResult.getRng();
+        }
+    }
+
+    mergeRecordedMoves();
+
+    for (size_t i = 0; i < tracks.size(); ++i) {
+        playingPatterns[i]->update(tracks[i].getPattern());
+        playingAutomation[i]->update(tracks[i].getAutomation());
+        resolveAhead(static_cast<int>(i));
+    }
+}
+
+Sequencer::ResolvedStep Sequencer::resolveStep(const Pattern& pattern, int patternStep, uint64_t step,
+                                               uint64_t probabilityKey) const {
+    const PatternStep& source = pattern.getStep(patternStep);
+    ResolvedStep resolved{};
+    resolved.step = step;
+    resolved.patternStep = static_cast<int16_t>(patternStep);
+    resolved.fire = source.active &&
+                    rng::Stream::unit(rng::at(probabilityKey, step)) <= source.probability;
+    resolved.midiNote = static_cast<uint8_t>(source.midiNote);
+    resolved.velocity = static_cast<uint8_t>(source.velocity);
+    resolved.gateLength = source.gateLength;
+    return resolved;
+}
+
+void Sequencer::resolveAhead(int trackIdx) {
+    // Modulation-driven tracks only know their step when it falls due
+    if (playback[trackIdx].phaseDriver != PhaseDriver::CLOCK) {
+        return;
+    }
+    const PatternSlots& slots = *playingPatterns[trackIdx];
+    const Pattern& pattern = slots.getPublished();
+    const int patternLength = pattern.getLength();
+    if (patternLength <= 0) {
+        return;
+    }
+
+    // The epoch before the playhead: the audio thread stores them the
+    // other way round, so a playhead is never older than its epoch
+    TrackLookahead& ahead = *lookahead[trackIdx];
+    const uint32_t epoch = lookaheadEpoch.load(std::memory_order_acquire);
+    const uint64_t playhead = ahead.playhead.load(std::memory_order_acquire);
+    const uint32_t serial = slots.getPublishedSerial();
+    if (epoch != ahead.epoch || serial != ahead.serial || ahead.nextStep < playhead) {
+        // Entries already queued for an old pattern or epoch are skipped by
+        // the audio thread; start again from the playhead
+        ahead.epoch = epoch;
+        ahead.serial = serial;
+        ahead.nextStep = playhead;
+    }
+
+    // A bar of the pattern's subdivision, less one slot so the ring never
+    // holds more than the audio thread can skip through in a step
+    const uint64_t horizon = std::min(static_cast<int>(pattern.getResolution()), kLookaheadSteps - 1);
+    const uint64_t probabilityKey = playback[trackIdx].probabilityKey;
+    while (ahead.nextStep < playhead + horizon) {
+        const int patternStep = clock->wrapStepIndex(ahead.nextStep, pattern.getResolution()) % patternLength;
+        ResolvedStep resolved = resolveStep(pattern, patternStep, ahead.nextStep, probabilityKey);
+        resolved.serial = serial;
+        resolved.epoch = epoch;
+        if (!ahead.ring.push(resolved)) {
+            break;
+        }
+        ++ahead.nextStep;
+    }
+}
+
+bool Sequencer::takeResolved(int trackIdx, uint64_t step, uint32_t serial, ResolvedStep& resolved) {
+    // Skip entries for steps already played, for an older pattern or from
+    // before a jump; stop at the first one that is not stale
+    TrackLookahead& ahead = *lookahead[trackIdx];
+    const uint32_t epoch = lookaheadEpoch.load(std::memory_order_relaxed);
+    while (const ResolvedStep* next = ahead.ring.peek()) {
+        const int32_t age = static_cast<int32_t>(serial - next->serial);
+        const bool stale = next->epoch != epoch || age > 0 || (age == 0 && next->step < step);
+        if (!stale) {
+            break;
+        }
+        ahead.ring.pop(resolved);
+    }
+    const ResolvedStep* next = ahead.ring.peek();
+    if (!next || next->serial != serial || next->step != step) {
+        return false;  // Resolved ahead for a newer pattern, or not yet
+    }
+    return ahead.ring.pop(resolved);
+}
+
+void Sequencer::finishPatternJobs() {
+    patternWorker.waitIdle();
+    updatePatterns();
 }
 
 void Sequencer::clearPattern() {
@@ -126,57 +244,58 @@ void Sequencer::allNotesOff() {
     activeNotes.clear();
 }
 
-void Sequencer::triggerTrackStep(size_t trackIndex, int step) {
-    if (!synth || trackIndex >= tracks.size()) {
+void Sequencer::triggerTrackStep(const ResolvedStep& resolved, Subdivision resolution,
+                                 uint32_t frame, EventSchedule& schedule) {
+    if (!synth) {
         return;
     }
 
-    Track& track = tracks[trackIndex];
-    Pattern& pattern = track.getPattern();
-    PatternStep& patternStep = pattern.getStep(step);
-
-    if (!patternStep.active) {
+    // Inactive or lost its probability roll; muted / solo logic handled by
+    // caller
+    if (!resolved.fire) {
         return;
     }
 
-    // Skip muted / solo logic handled by caller
+    if (activeNotes.size() >= kMaxActiveNotes) {
+        return;  // Gate list full; skip rather than allocate on the audio thread
+    }
 
-    // Probability check
-    float r = static_cast<float>(rand()) / RAND_MAX;
-    if (r > patternStep.probability) {
-        return;  // Skip this trigger
+    if (!schedule.add(frame, ScheduledEvent::NOTE_ON, resolved.midiNote, resolved.velocity)) {
+        return;  // Schedule full; don't track a note that never started
     }
 
-    synth->noteOn(patternStep.midiNote, patternStep.velocity);
+    // Gate runs from the exact trigger sample; at least one frame long so
+    // the note-off always follows its note-on
+    double samplesPerStep = clock->getSamplesPerStep(resolution);
+    uint64_t gateSamples = static_cast<uint64_t>(samplesPerStep * resolved.gateLength);
 
     ActiveNote activeNote{};
-    activeNote.midiNote = patternStep.midiNote;
-    if (clock) {
-        activeNote.startSample = clock->getCurrentStep(pattern.getResolution()) *
-                                 clock->getSamplesPerStep(pattern.getResolution());
-    } else {
-        activeNote.startSample = 0;
-    }
-    activeNote.gateLength = patternStep.gateLength;
-    activeNote.subdivision = pattern.getResolution();
+    activeNote.midiNote = resolved.midiNote;
+    activeNote.startSample = clock->getSamplePosition() + frame;
+    activeNote.endSample = activeNote.startSample + std::max<uint64_t>(gateSamples, 1);
     activeNotes.push_back(activeNote);
 }
 
-void Sequencer::updateGates() {
+void Sequencer::updateGates(unsigned int nFrames, EventSchedule& schedule) {
     if (!synth || activeNotes.empty() || !clock) return;
 
+    uint64_t bufferStart = clock->getSamplePosition();
+    uint64_t bufferEnd = bufferStart + nFrames;
+
     // Check each active note
     auto it = activeNotes.begin();
     while (it != activeNotes.end()) {
-        uint64_t currentSample = clock->getCurrentStep(it->subdivision) *
-                                 clock->getSamplesPerStep(it->subdivision);
-        double samplesPerStep = clock->getSamplesPerStep(it->subdivision);
-        uint64_t elapsed = currentSample - it->startSample;
-        double gateTimeInSamples = samplesPerStep * it->gateLength;
-
-        if (elapsed >= static_cast<uint64_t>(gateTimeInSamples)) {
-            // Gate time expired, send note-off
-            synth->noteOff(it->midiNote);
+        if (it->endSample < bufferEnd) {
+            // Gate ends in this buffer; a note whose end already passed
+            // (e.g. after a tempo change) is released at frame 0
+            uint32_t frame = it->endSample > bufferStart
+                                 ? static_cast<uint32_t>(it->endSample - bufferStart)
+                                 : 0;
+            if (!schedule.add(frame, ScheduledEvent::NOTE_OFF,
+                              static_cast<uint8_t>(it->midiNote), 0)) {
+                ++it;  // Schedule full; retry next buffer
+                continue;
+            }
             it = activeNotes.erase(it);
         } else {
             ++it;
@@ -185,91 +304,373 @@ void Sequencer::updateGates() {
 }
 
 void Sequencer::setTrackPhaseDriver(int trackIndex, PhaseDriver driver) {
-    if (trackIndex < 0 || trackIndex >= static_cast<int>(trackPhaseDrivers.size())) {
+    if (trackIndex < 0 || trackIndex >= static_cast<int>(playback.size())) {
         return;
     }
-    trackPhaseDrivers[trackIndex] = driver;
+    playback[trackIndex].phaseDriver = driver;
 }
 
 Sequencer::PhaseDriver Sequencer::getTrackPhaseDriver(int trackIndex) const {
-    if (trackIndex < 0 || trackIndex >= static_cast<int>(trackPhaseDrivers.size())) {
+    if (trackIndex < 0 || trackIndex >= static_cast<int>(playback.size())) {
         return PhaseDriver::CLOCK;
     }
-    return trackPhaseDrivers[trackIndex];
+    return playback[trackIndex].phaseDriver;
 }
 
-void Sequencer::process(unsigned int nFrames) {
-    if (!clock || !clock->isPlaying()) {
-        return;
+namespace {
+
+// Heap order for the step queue: earliest sample on top, lower track first
+// on the same sample
+template <typename Event>
+bool laterStep(const Event& a, const Event& b) {
+    return a.sample != b.sample ? a.sample > b.sample : a.track > b.track;
+}
+
+}  // namespace
+
+void Sequencer::pushStepEvent(int track, uint64_t step, Subdivision resolution) {
+    stepQueue.push_back({clock->getStepSample(step, resolution), step, track, resolution});
+    std::push_heap(stepQueue.begin(), stepQueue.end(), laterStep<StepEvent>);
+}
+
+void Sequencer::rebuildStepQueue(uint64_t bufferStart) {
+    stepQueue.clear();
+    for (size_t trackIdx = 0; trackIdx < tracks.size(); ++trackIdx) {
+        Subdivision resolution = playingPatterns[trackIdx]->front().getResolution();
+        uint64_t step = clock->getStepAtOrAfter(bufferStart, resolution);
+        stepQueue.push_back({clock->getStepSample(step, resolution), step,
+                             static_cast<int>(trackIdx), resolution});
     }
+    std::make_heap(stepQueue.begin(), stepQueue.end(), laterStep<StepEvent>);
 
-    bool needsModPhase = false;
-    for (const auto& driver : trackPhaseDrivers) {
-        if (driver == PhaseDriver::MODULATION) {
-            needsModPhase = true;
-            break;
+    // After a jump or a stop the lookahead's entries are for steps that may
+    // come round again from a different pattern; a tempo change keeps them
+    if (!stepQueueValid || stepQueueSample != bufferStart) {
+        for (const StepEvent& event : stepQueue) {
+            lookahead[event.track]->playhead.store(event.step, std::memory_order_relaxed);
         }
+        lookaheadEpoch.fetch_add(1, std::memory_order_release);
     }
 
-    Synth::ModulationOutputs modOutputs;
-    if (needsModPhase && synth) {
-        modOutputs = synth->processModulationMatrix();
-    }
+    stepQueueSample = bufferStart;
+    stepQueueTempo = clock->getTempo();
+    stepQueueValid = true;
+}
 
-    bool anySolo = false;
-    for (const auto& track : tracks) {
-        if (track.isSolo()) {
-            anySolo = true;
-            break;
+void Sequencer::process(unsigned int nFrames, EventSchedule& schedule) {
+    if (!clock || !clock->isPlaying()) {
+        // Nothing is playing, so published patterns take over right away
+        for (auto& slots : playingPatterns) {
+            slots->takeFresh();
+        }
+        for (auto& slots : playingAutomation) {
+            slots->takeFresh();
         }
+        for (auto& state : playback) {
+            state.automationTick = -1.0;
+        }
+        stepQueueValid = false;
+        return;
     }
 
-    // Process each track with its own subdivision
+    uint64_t bufferStart = clock->getSamplePosition();
+    uint64_t bufferEnd = bufferStart + nFrames;
+    if (!stepQueueValid || stepQueueSample != bufferStart || stepQueueTempo != clock->getTempo()) {
+        rebuildStepQueue(bufferStart);
+    }
+
+    // Automation first, so a note starting on the frame of a parameter
+    // change starts with the new value
     for (size_t trackIdx = 0; trackIdx < tracks.size(); ++trackIdx) {
+        playAutomation(static_cast<int>(trackIdx), nFrames, schedule);
+    }
+
+    // Release gates from earlier buffers first, so a note that ends on the
+    // same frame a step retriggers it is turned off before it restarts
+    updateGates(nFrames, schedule);
+
+    // Every step boundary in this buffer, in frame order across tracks.
+    // Solo state and modulation phases are only read once a boundary needs
+    // them
+    bool soloChecked = false;
+    bool anySolo = false;
+    bool modChecked = false;
+    Synth::ModulationOutputs modOutputs;
+
+    while (!stepQueue.empty() && stepQueue.front().sample < bufferEnd) {
+        std::pop_heap(stepQueue.begin(), stepQueue.end(), laterStep<StepEvent>);
+        StepEvent event = stepQueue.back();
+        stepQueue.pop_back();
+
+        const int trackIdx = event.track;
         Track& track = tracks[trackIdx];
-        Pattern& pattern = track.getPattern();
-        Subdivision subdiv = pattern.getResolution();
+        PatternSlots& slots = *playingPatterns[trackIdx];
+        TrackPlayback& state = playback[trackIdx];
+
+        // A newly published pattern takes over at the track's next step
+        // boundary; with a new resolution the boundaries are found again
+        if (slots.takeFresh() && slots.front().getResolution() != event.resolution) {
+            Subdivision resolution = slots.front().getResolution();
+            uint64_t step = clock->getStepAtOrAfter(event.sample, resolution);
+            pushStepEvent(trackIdx, step, resolution);
+            lookahead[trackIdx]->playhead.store(step, std::memory_order_release);
+            continue;
+        }
+        pushStepEvent(trackIdx, event.step + 1, event.resolution);
+        lookahead[trackIdx]->playhead.store(event.step + 1, std::memory_order_release);
 
-        int stepIndex;
-        if (clock->checkStepTrigger(nFrames, subdiv, stepIndex)) {
-            int patternLength = pattern.getLength();
-            if (patternLength <= 0) {
-                continue;
-            }
+        const Pattern& pattern = slots.front();
+        int patternLength = pattern.getLength();
+        if (patternLength <= 0) {
+            continue;
+        }
 
-            int trackStep = 0;
-            if (trackPhaseDrivers[trackIdx] == PhaseDriver::CLOCK) {
-                trackStep = stepIndex % patternLength;
-            } else {
-                float driverValue = modOutputs.sequencerPhase[trackIdx];
-                float normalized = std::clamp((driverValue + 1.0f) * 0.5f, 0.0f, 1.0f);
-                trackStep = static_cast<int>(normalized * patternLength);
-                if (trackStep >= patternLength) {
-                    trackStep = patternLength - 1;
-                }
-                if (trackStep < 0) {
-                    trackStep = 0;
+        int trackStep = 0;
+        if (state.phaseDriver == PhaseDriver::CLOCK) {
+            trackStep = clock->wrapStepIndex(event.step, event.resolution) % patternLength;
+        } else {
+            if (!modChecked) {
+                modChecked = true;
+                if (synth) {
+                    modOutputs = synth->processModulationMatrix();
                 }
             }
+            constexpr int kPhaseOutputs = sizeof(modOutputs.sequencerPhase) / sizeof(modOutputs.sequencerPhase[0]);
+            float driverValue = trackIdx < kPhaseOutputs ? modOutputs.sequencerPhase[trackIdx] : 0.0f;
+            float normalized = std::clamp((driverValue + 1.0f) * 0.5f, 0.0f, 1.0f);
+            trackStep = static_cast<int>(normalized * patternLength);
+            if (trackStep >= patternLength) {
+                trackStep = patternLength - 1;
+            }
+            if (trackStep < 0) {
+                trackStep = 0;
+            }
+        }
 
-            currentSteps[trackIdx] = trackStep;
+        state.currentStep = trackStep;
 
-            if (trackStep != lastTriggeredStep[trackIdx]) {
-                lastTriggeredStep[trackIdx] = trackStep;
+        if (trackStep != state.lastTriggeredStep) {
+            state.lastTriggeredStep = trackStep;
 
-                bool muted = track.isMuted();
-                bool skipForSolo = anySolo && !track.isSolo();
-                if (!muted && !skipForSolo) {
-                    triggerTrackStep(trackIdx, trackStep);
+            if (!soloChecked) {
+                soloChecked = true;
+                for (const auto& other : tracks) {
+                    if (other.isSolo()) {
+                        anySolo = true;
+                        break;
+                    }
                 }
             }
+
+            bool muted = track.isMuted();
+            bool skipForSolo = anySolo && !track.isSolo();
+
+            // The lookahead's entry when it was resolved for this pattern and
+            // position; otherwise resolve the step here, the same way
+            ResolvedStep resolved;
+            if (state.phaseDriver != PhaseDriver::CLOCK ||
+                !takeResolved(trackIdx, event.step, slots.frontSerial(), resolved) ||
+                resolved.patternStep != trackStep) {
+                resolved = resolveStep(pattern, trackStep, event.step, state.probabilityKey);
+            }
+            if (!muted && !skipForSolo) {
+                triggerTrackStep(resolved, event.resolution,
+                                 static_cast<uint32_t>(event.sample - bufferStart), schedule);
+            }
         }
     }
+    stepQueueSample = bufferEnd;
 
-    updateGates();
+    // Short gates started above may already end inside this buffer
+    updateGates(nFrames, schedule);
 
     // Advance clock
     if (clock) {
         clock->advance(nFrames);
     }
 }
+
+bool Sequencer::getLoopTick(const Pattern& pattern, double& tick, double& loopTicks) const {
+    const int length = pattern.getLength();
+    if (length <= 0) {
+        return false;
+    }
+    const double stepsPerBeat = static_cast<int>(pattern.getResolution()) / 4.0;
+    loopTicks = static_cast<double>(length) * AutomationClip::kTicksPerStep;
+    tick = std::fmod(clock->getBeatPosition() * stepsPerBeat * AutomationClip::kTicksPerStep, loopTicks);
+    if (tick < 0.0) {
+        tick += loopTicks;
+    }
+    return true;
+}
+
+void Sequencer::seekAutomation(const AutomationClip& clip, double tick, LaneCursor* cursors) {
+    const uint32_t* deltas = clip.getDeltas();
+    for (int i = 0; i < clip.getLaneCount(); ++i) {
+        const AutomationClip::Lane& lane = clip.getLane(i);
+        LaneCursor& cursor = cursors[i];
+        cursor.index = 0;
+        cursor.tick = lane.count > 0 ? deltas[lane.first] : 0;
+        while (cursor.index < lane.count && cursor.tick < tick) {
+            if (++cursor.index < lane.count) {
+                cursor.tick += deltas[lane.first + cursor.index];
+            }
+        }
+    }
+}
+
+void Sequencer::playAutomation(int trackIdx, unsigned int nFrames, EventSchedule& schedule) {
+    AutomationSlots& slots = *playingAutomation[trackIdx];
+    TrackPlayback& state = playback[trackIdx];
+    const bool fresh = slots.takeFresh();
+    const AutomationClip& clip = slots.front();
+    const Pattern& pattern = playingPatterns[trackIdx]->front();
+
+    double start = 0.0;
+    double loopTicks = 0.0;
+    if (clip.empty() || !getLoopTick(pattern, start, loopTicks)) {
+        state.automationTick = -1.0;
+        return;
+    }
+    const double ticksPerFrame = AutomationClip::kTicksPerStep / clock->getSamplesPerStep(pattern.getResolution());
+    const double end = start + nFrames * ticksPerFrame;
+
+    // The cursors carry on from the last buffer unless the position jumped
+    // (a locate, a new pattern length or resolution) or the clip changed
+    if (fresh || std::fabs(start - state.automationTick) > 0.5) {
+        seekAutomation(clip, start, state.cursors);
+    }
+    state.automationTick = end < loopTicks ? end : end - loopTicks;
+
+    // Lanes being recorded on this track are left to the recording
+    const uint64_t skipped = trackIdx == recordedTrack ? recordedLanes : 0;
+    const uint32_t* deltas = clip.getDeltas();
+    const uint16_t* values = clip.getValues();
+
+    // Events up to `until` in the loop; offset is the loop tick of frame 0
+    // relative to the part of the loop being played
+    auto emit = [&](double until, double offset) {
+        for (int i = 0; i < clip.getLaneCount(); ++i) {
+            const AutomationClip::Lane& lane = clip.getLane(i);
+            LaneCursor& cursor = state.cursors[i];
+            while (cursor.index < lane.count && cursor.tick < until) {
+                if ((skipped >> lane.param & 1) == 0) {
+                    // The first frame at or after the tick, give or take
+                    // the rounding in the beat position
+                    const double frame = std::ceil((cursor.tick - offset) / ticksPerFrame - 1e-4);
+                    const uint32_t at = static_cast<uint32_t>(std::clamp(frame, 0.0, nFrames - 1.0));
+                    const float value = AutomationClip::toValue(values[lane.first + cursor.index]);
+                    schedule.addParam(at, lane.param, value);
+                    // What recordAutomation() will read back, so playback
+                    // isn't taken for a move
+                    if (const AutomationTarget* target = findAutomationTarget(lane.param)) {
+                        automationValues[lane.param] = target->settle(value);
+                    }
+                }
+                if (++cursor.index < lane.count) {
+                    cursor.tick += deltas[lane.first + cursor.index];
+                }
+            }
+        }
+    };
+
+    emit(std::min(end, loopTicks), start);
+    if (end >= loopTicks) {
+        seekAutomation(clip, 0.0, state.cursors);
+        emit(end - loopTicks, start - loopTicks);
+    }
+}
+
+void Sequencer::setAutomationRecording(bool recording) {
+    if (recording) {
+        automationArmed.store(currentTrackIndex, std::memory_order_relaxed);
+    } else {
+        automationArmed.store(-1, std::memory_order_relaxed);
+        mergeRecordedMoves();
+    }
+}
+
+void Sequencer::clearAutomation() {
+    getCurrentTrack().getAutomation().clear();
+}
+
+void Sequencer::recordAutomation(const SynthParamBlock& block) {
+    const int track = automationArmed.load(std::memory_order_relaxed);
+    if (track < 0 || track >= static_cast<int>(tracks.size()) || !clock->isPlaying()) {
+        automationValuesValid = false;
+        recordedLanes = 0;
+        recordedTrack = -1;
+        return;
+    }
+    if (track != recordedTrack) {
+        recordedLanes = 0;
+        recordedTrack = track;
+    }
+
+    double tick = 0.0;
+    double loopTicks = 0.0;
+    if (!getLoopTick(playingPatterns[track]->front(), tick, loopTicks)) {
+        return;
+    }
+
+    // A move is a change of at least one step of the stored resolution; the
+    // first buffer after arming only takes the starting values
+    int count = 0;
+    const AutomationTarget* targets = getAutomationTargets(count);
+    for (int i = 0; i < count; ++i) {
+        const AutomationTarget& target = targets[i];
+        const float value = target.normalize(block);
+        float& last = automationValues[target.param];
+        if (automationValuesValid && std::fabs(value - last) * 65535.0f < 1.0f) {
+            continue;
+        }
+        last = value;
+        if (!automationValuesValid) {
+            continue;
+        }
+        const uint64_t bit = uint64_t(1) << target.param;
+        if (recordedMoves.push({static_cast<uint32_t>(tick), AutomationClip::quantize(value),
+                                static_cast<uint8_t>(track), target.param, (recordedLanes & bit) == 0})) {
+            recordedLanes |= bit;
+        }
+    }
+    automationValuesValid = true;
+}
+
+void Sequencer::mergeRecordedMoves() {
+    drainedMoves.clear();
+    RecordedMove move;
+    while (recordedMoves.pop(move)) {
+        if (move.track < tracks.size()) {
+            drainedMoves.push_back(move);
+        }
+    }
+
+    // One overwrite per lane and pass, continuing from the lane's last
+    // batch unless a new pass starts with it
+    for (size_t i = 0; i < drainedMoves.size(); ++i) {
+        const RecordedMove& head = drainedMoves[i];
+        if (head.param >= AutomationClip::kMaxLanes) {
+            continue;   // Already merged with an earlier move of its lane
+        }
+        recordedPoints.clear();
+        for (size_t j = i; j < drainedMoves.size(); ++j) {
+            RecordedMove& other = drainedMoves[j];
+            if (other.param != head.param || other.track != head.track) {
+                continue;
+            }
+            if (j > i && other.firstOfPass) {
+                break;      // Left for its own overwrite
+            }
+            recordedPoints.push_back({other.tick, AutomationClip::toValue(other.value)});
+            if (j > i) {
+                other.param = AutomationClip::kMaxLanes;
+            }
+        }
+        uint32_t& last = lastRecordedTick[head.param];
+        const uint32_t from = head.firstOfPass ? recordedPoints.front().tick : last;
+        tracks[head.track].getAutomation().overwrite(head.param, from, !head.firstOfPass, recordedPoints.data(),
+                                                     static_cast<int>(recordedPoints.size()));
+        last = recordedPoints.back().tick;
+    }
+}
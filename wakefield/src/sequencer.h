@@ -1,15 +1,21 @@
 #ifndef SEQUENCER_H
 #define SEQUENCER_H
 
+#include <atomic>
 #include <vector>
-#include <map>
+#include <memory>
 #include "clock.h"
 #include "pattern.h"
 #include "constraint.h"
 #include "markov.h"
 #include "euclidean.h"
 #include "track.h"
+#include "pattern_worker.h"
+#include "triple_buffer.h"
 #include "synth.h"
+#include "event_schedule.h"
+#include "memory_stats.h"
+#include "spsc_queue.h"
 
 class Sequencer {
 public:
@@ -42,12 +48,23 @@ public:
     void nextTrack();
     void prevTrack();
 
-    // Pattern generation (operates on current track)
+    // Pattern generation (operates on current track). Generation runs on
+    // the pattern worker on a copy of the track; the result replaces the
+    // track's pattern on a later updatePatterns()
     void generatePattern();
     void regenerateUnlocked();
     void mutatePattern(float amount);
     void clearPattern();
 
+    // UI thread, once per frame: adopt finished generation jobs, then hand
+    // every pattern edited since the last call to the audio thread, which
+    // switches to it at that track's next step boundary, and resolve each
+    // clock-driven track's steps up to a bar ahead of its playhead
+    void updatePatterns();
+
+    // Wait for queued generation jobs, then updatePatterns()
+    void finishPatternJobs();
+
     // Pattern rotation (synchronized)
     void rotatePattern(int steps);
 
@@ -61,20 +78,36 @@ public:
     void setMarkovMode(int mode);  // 0=random, 1=orbit, 2=ascend, 3=descend, 4=drone
     void setEuclideanPattern(int hits, int steps, int rotation);
 
-    int getCurrentStep() const {
-        return (!currentSteps.empty() && currentTrackIndex >= 0 && currentTrackIndex < static_cast<int>(currentSteps.size()))
-                   ? currentSteps[currentTrackIndex]
-                   : 0;
-    }
+    int getCurrentStep() const { return getCurrentStep(currentTrackIndex); }
     int getCurrentStep(int trackIndex) const {
-        if (trackIndex >= 0 && trackIndex < static_cast<int>(currentSteps.size())) {
-            return currentSteps[trackIndex];
+        if (trackIndex >= 0 && trackIndex < static_cast<int>(playback.size())) {
+            return playback[trackIndex].currentStep;
         }
         return 0;
     }
 
-    // Process audio (called from audio callback)
-    void process(unsigned int nFrames);
+    // Process audio (called from audio callback). Note on/off events are
+    // added to schedule at the frame their step or gate boundary falls on,
+    // and automation events (ScheduledEvent::PARAM) at the frame of their
+    // tick. Costs one queue pop per step boundary in the buffer, not one
+    // pass over every track, and one comparison per automation lane
+    void process(unsigned int nFrames, EventSchedule& schedule);
+
+    // Automation recording: while armed and playing, every automatable
+    // parameter that moves (from the UI, MIDI CC or OSC) is written into
+    // the armed track's lanes, replacing what they held over the span it
+    // moved through. Arming takes the current track. A lane being recorded
+    // stops playing back until recording is disarmed
+    void setAutomationRecording(bool recording);
+    bool isAutomationRecording() const { return automationArmed.load(std::memory_order_relaxed) >= 0; }
+    int getAutomationRecordTrack() const { return automationArmed.load(std::memory_order_relaxed); }
+    void clearAutomation();  // Current track
+
+    // Audio thread, once per buffer before process(): compare the buffer's
+    // parameter block with the last one and queue the moves while armed.
+    // Moves reach the audio thread once per buffer, so they are stamped
+    // with the buffer's first tick
+    void recordAutomation(const SynthParamBlock& block);
 
     // Note management
     void allNotesOff();
@@ -85,29 +118,188 @@ public:
     bool currentTrackUsesModulation() const { return getCurrentTrackPhaseDriver() == PhaseDriver::MODULATION; }
 
 private:
+    // One track's pattern (or automation) on its way to the audio thread:
+    // the UI thread fills back() and publishes it, the audio thread plays
+    // front(). The audio thread never copies, allocates or reads a value
+    // being written. Each publish is numbered, so work done ahead for one
+    // value can be told from work for another
+    template <typename T>
+    class PlayingSlots {
+    public:
+        explicit PlayingSlots(const T& value)
+            : buffer(Slot{value, 0})
+            , published(value) {}
+
+        // UI thread: publish value if it differs from the last one
+        void update(const T& value) {
+            if (!value.sameAs(published)) {
+                buffer.back().value = value;
+                buffer.back().serial = ++publishedSerial;
+                published = value;
+                buffer.publish();
+            }
+        }
+        const T& getPublished() const { return published; }
+        uint32_t getPublishedSerial() const { return publishedSerial; }
+
+        // Audio thread: switch to the newest published value, if any
+        bool takeFresh() { return buffer.takeFresh(); }
+        const T& front() const { return buffer.front().value; }
+        uint32_t frontSerial() const { return buffer.front().serial; }
+
+    private:
+        struct Slot {
+            T value;
+            uint32_t serial;
+        };
+        TripleBuffer<Slot> buffer;
+        T published;        // UI thread's copy of what it last published
+        uint32_t publishedSerial = 0;
+    };
+    using PatternSlots = PlayingSlots<Pattern>;
+    using AutomationSlots = PlayingSlots<AutomationClip>;
+
     Clock* clock;
     std::vector<Track> tracks;
     int currentTrackIndex;
+    std::vector<std::unique_ptr<PatternSlots>> playingPatterns;  // Per track
+    std::vector<std::unique_ptr<AutomationSlots>> playingAutomation;
+    memstats::Account memory{memstats::SEQUENCER};     // Set once the tracks are built
 
     Synth* synth;
-    std::vector<int> currentSteps;  // Per-track playback position
-    std::vector<int> lastTriggeredStep;  // Per-track
-    std::vector<PhaseDriver> trackPhaseDrivers;
+
+    // Automation playback: the next event of a lane, as its index in the
+    // lane and its tick
+    struct LaneCursor {
+        uint32_t index = 0;
+        uint32_t tick = 0;
+    };
+
+    // Per-track playback state, indexed like tracks
+    struct TrackPlayback {
+        int currentStep = 0;
+        int lastTriggeredStep = -1;
+        PhaseDriver phaseDriver = PhaseDriver::CLOCK;
+        // Step probability rolls: the roll for step number n is
+        // rng::at(probabilityKey, n), so a step resolved ahead rolls the
+        // same as one resolved when it falls due
+        uint64_t probabilityKey = 0;
+        // Automation: the loop tick the last buffer ended on (-1 after a
+        // jump), and a cursor per lane of the playing clip
+        double automationTick = -1.0;
+        LaneCursor cursors[AutomationClip::kMaxLanes];
+    };
+    std::vector<TrackPlayback> playback;
+
+    // Each track's next step boundary, in a min-heap on sample (then track
+    // index). Rebuilt when the clock jumps, the tempo changes or the
+    // transport stops; otherwise a popped boundary pushes the track's next
+    struct StepEvent {
+        uint64_t sample;     // Clock sample the step starts on
+        uint64_t step;       // Step number on the track's subdivision
+        int track;
+        Subdivision resolution;
+    };
+    std::vector<StepEvent> stepQueue;
+    uint64_t stepQueueSample = 0;   // Buffer start the queue is valid for
+    double stepQueueTempo = 0.0;
+    bool stepQueueValid = false;
+
+    void rebuildStepQueue(uint64_t bufferStart);
+    void pushStepEvent(int track, uint64_t step, Subdivision resolution);
+
+    // Step lookahead. For each clock-driven track the UI thread resolves
+    // the steps from the track's playhead up to a bar ahead (pattern
+    // lookup, probability roll, note, velocity and gate) into a ring; the
+    // audio thread pops the entry for a step as it falls due and resolves
+    // the step itself only when there is no matching entry. An entry is
+    // keyed by step number, pattern publish and epoch (bumped by the audio
+    // thread when the clock jumps or stops), so a pattern edit invalidates
+    // only the entries resolved from the old pattern, and they are skipped
+    // as they come up. Solo and mute are still read when a step fires
+    struct ResolvedStep {
+        uint64_t step;          // Step number on the pattern's subdivision
+        uint32_t serial;        // Pattern publish it was resolved from
+        uint32_t epoch;
+        int16_t patternStep;    // Loop-wrapped index into the pattern
+        bool fire;              // Active and past its probability roll
+        uint8_t midiNote;
+        uint8_t velocity;
+        float gateLength;
+    };
+    static constexpr int kLookaheadSteps = 64;       // Ring size; a bar of 64ths
+    struct TrackLookahead {
+        SpscQueue<ResolvedStep, kLookaheadSteps> ring;
+        // Audio thread -> UI thread: the next step number to fire
+        std::atomic<uint64_t> playhead{0};
+        // UI thread: the next step to resolve, and what it was resolved for
+        uint64_t nextStep = 0;
+        uint32_t serial = 0;
+        uint32_t epoch = 0;
+    };
+    std::vector<std::unique_ptr<TrackLookahead>> lookahead;  // Per track
+    std::atomic<uint32_t> lookaheadEpoch{0};
+
+    void resolveAhead(int trackIdx);
+    // A step's resolution, as the lookahead and the audio thread make it
+    ResolvedStep resolveStep(const Pattern& pattern, int patternStep, uint64_t step,
+                             uint64_t probabilityKey) const;
+    // Audio thread: the lookahead's entry for a step, if it has one
+    bool takeResolved(int trackIdx, uint64_t step, uint32_t serial, ResolvedStep& resolved);
 
     // Track active notes for gate length management
     struct ActiveNote {
         int midiNote;
-        uint64_t startSample;
-        float gateLength;  // In steps
-        Subdivision subdivision;  // Track subdivision for gate timing
+        uint64_t startSample;    // Clock sample of the note-on
+        uint64_t endSample;      // Clock sample of the note-off
     };
+    static constexpr size_t kMaxActiveNotes = 64;  // Reserved up front
     std::vector<ActiveNote> activeNotes;
 
-    // Trigger a step
-    void triggerTrackStep(size_t trackIndex, int step);
+    // Trigger a resolved step at frame offset `frame` in the current buffer
+    void triggerTrackStep(const ResolvedStep& resolved, Subdivision resolution,
+                          uint32_t frame, EventSchedule& schedule);
+
+    // Schedule note-offs for gates that end inside the current buffer
+    void updateGates(unsigned int nFrames, EventSchedule& schedule);
+
+    // A track's position in its pattern loop at the start of the buffer,
+    // in automation ticks, and the loop's length; false for an empty pattern
+    bool getLoopTick(const Pattern& pattern, double& tick, double& loopTicks) const;
+
+    // Schedule a track's automation events inside the current buffer
+    void playAutomation(int trackIdx, unsigned int nFrames, EventSchedule& schedule);
+    // Point each lane's cursor at its first event at or after tick
+    static void seekAutomation(const AutomationClip& clip, double tick, LaneCursor* cursors);
+
+    // Automation recording. The audio thread queues each move; the UI
+    // thread merges them into the armed track's clip in updatePatterns()
+    struct RecordedMove {
+        uint32_t tick;
+        uint16_t value;     // AutomationClip::quantize
+        uint8_t track;
+        uint8_t param;
+        bool firstOfPass;   // The lane's first move since recording (re)started
+    };
+    std::atomic<int> automationArmed{-1};       // Track, -1 when not armed
+    SpscQueue<RecordedMove, 4096> recordedMoves;
+    // Audio thread: each parameter's value as last seen or played back,
+    // the lanes recorded this pass (a bit per parameter) and their track
+    float automationValues[AutomationClip::kMaxLanes] = {};
+    bool automationValuesValid = false;
+    uint64_t recordedLanes = 0;
+    int recordedTrack = -1;
+    // UI thread: each parameter's last recorded tick
+    uint32_t lastRecordedTick[AutomationClip::kMaxLanes] = {};
+    std::vector<RecordedMove> drainedMoves;
+    std::vector<AutomationClip::Point> recordedPoints;
+
+    void mergeRecordedMoves();
 
-    // Check and release notes based on gate length
-    void updateGates();
+    // Generation jobs and the track a finished one is read back into.
+    // Last, so the worker stops before the tracks go away
+    Track jobResult;
+    PatternWorker patternWorker;
 };
 
 #endif // SEQUENCER_H
@@ -0,0 +1,119 @@
+#include "session_autosave.h"
+#include "loop_manager.h"
+#include <pthread.h>
+#include <sched.h>
+
+SessionAutosave::~SessionAutosave() {
+    stop();
+}
+
+void SessionAutosave::start(int intervalSeconds) {
+    path = SessionFile::getSessionPath(kSessionName);
+    interval = std::chrono::seconds(intervalSeconds);
+    nextSave = Clock::now();
+    loopRevisions.assign(MAX_LOOPS, 0);
+    loopsWritten.assign(MAX_LOOPS, false);
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = false;
+    }
+    if (!thread.joinable()) {
+        thread = std::thread(&SessionAutosave::worker, this);
+    }
+}
+
+void SessionAutosave::stop() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    wake.notify_all();
+    if (thread.joinable()) {
+        thread.join();
+    }
+}
+
+void SessionAutosave::update(const SynthParameters& params, const Synth& synth,
+                             const Sequencer& sequencer, LoopManager* loops) {
+    if (!thread.joinable() || Clock::now() < nextSave) {
+        return;
+    }
+    nextSave = Clock::now() + interval;
+
+    auto snapshot = std::make_unique<SessionFile::Snapshot>();
+    SessionFile::capture(*snapshot, params, synth, sequencer);
+    captureLoops(*snapshot, loops);
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        pending = std::move(snapshot);
+    }
+    wake.notify_one();
+}
+
+void SessionAutosave::captureLoops(SessionFile::Snapshot& snapshot, LoopManager* loops) {
+    for (int i = 0; loops && i < loops->getLoopCount(); ++i) {
+        Looper* looper = loops->getLoop(i);
+        const Looper::State state = looper->getState();
+        const uint32_t revision = looper->getRevision();
+        if (state == Looper::Empty) {
+            loopsWritten[i] = false;
+            continue;
+        }
+        // A first pass still recording keeps the last file, if any
+        const bool changed = !loopsWritten[i] || revision != loopRevisions[i] ||
+                             state == Looper::Overdubbing;
+        if (changed && state != Looper::Recording) {
+            const std::string wav = SessionFile::getLoopPath(path, i);
+            if (loops->saveLoop(i, wav)) {
+                loopRevisions[i] = revision;
+                loopsWritten[i] = true;
+            }
+        }
+        if (loopsWritten[i]) {
+            snapshot.loops[i] = SessionFile::getLoopPath(path, i);
+        }
+    }
+}
+
+bool SessionAutosave::pollMessage(std::string& message) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (messages.empty()) {
+        return false;
+    }
+    message = std::move(messages.front());
+    messages.pop_front();
+    return true;
+}
+
+void SessionAutosave::worker() {
+    // Only runs when nothing else wants the core
+#ifdef SCHED_IDLE
+    sched_param param{};
+    pthread_setschedparam(pthread_self(), SCHED_IDLE, &param);
+#endif
+
+    std::unique_lock<std::mutex> lock(mutex);
+    while (true) {
+        wake.wait(lock, [this] { return stopping || pending; });
+        if (!pending) {
+            return;     // Stopping with nothing left to write
+        }
+        std::unique_ptr<SessionFile::Snapshot> snapshot = std::move(pending);
+        lock.unlock();
+
+        std::vector<uint8_t> bytes = SessionFile::serialize(*snapshot);
+        std::string error;
+        if (lastBytes.empty()) {
+            lastBytes = std::move(bytes);   // The launch state
+        } else if (bytes != lastBytes) {
+            if (SessionFile::writeFile(path, bytes, error)) {
+                lastBytes = std::move(bytes);
+            }
+        }
+
+        lock.lock();
+        if (!error.empty()) {
+            messages.push_back("Autosave failed: " + error);
+        }
+    }
+}
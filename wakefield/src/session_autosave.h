@@ -0,0 +1,76 @@
+#ifndef SESSION_AUTOSAVE_H
+#define SESSION_AUTOSAVE_H
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "session_file.h"
+
+// Saves the whole session every so often to autosave.session in the
+// session directory (load it back with --session autosave).
+//
+// The UI thread only takes a SessionFile::Snapshot: the parameter block,
+// the slots and a copy of each track, a few kilobytes. Loops whose audio
+// changed since they were last written (Looper::getRevision, or an overdub
+// in progress) are queued on the loop I/O thread, which streams them from
+// the chunks the audio thread pinned for it (Looper::requestExport), so
+// the audio thread does nothing but bump reference counts. A low-priority
+// thread (SCHED_IDLE where available) serializes the snapshot and writes
+// the file. Nothing is written while the session is unchanged, including
+// the state at launch, so starting up never replaces the last autosave
+// until something has been edited.
+class SessionAutosave {
+public:
+    static constexpr int kDefaultIntervalSeconds = 60;
+    static constexpr const char* kSessionName = "autosave";
+
+    SessionAutosave() = default;
+    ~SessionAutosave();
+
+    // Start the thread; the first update() takes the launch state
+    void start(int intervalSeconds);
+    // Write the snapshot handed over last, if any, and stop the thread
+    void stop();
+
+    // UI thread, every frame: snapshot the session when a save is due. A
+    // snapshot not yet written when the next is taken is replaced
+    void update(const SynthParameters& params, const Synth& synth, const Sequencer& sequencer,
+                LoopManager* loops);
+
+    // One console message per call (failed writes); false if none
+    bool pollMessage(std::string& message);
+
+    SessionAutosave(const SessionAutosave&) = delete;
+    SessionAutosave& operator=(const SessionAutosave&) = delete;
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    void captureLoops(SessionFile::Snapshot& snapshot, LoopManager* loops);
+    void worker();
+
+    // UI thread
+    std::string path;
+    Clock::duration interval{};
+    Clock::time_point nextSave{};
+    std::vector<uint32_t> loopRevisions;    // Revision each loop was last saved at
+    std::vector<bool> loopsWritten;         // The loop's WAV holds its audio
+
+    std::mutex mutex;                       // Guards pending, messages and stopping
+    std::condition_variable wake;
+    std::unique_ptr<SessionFile::Snapshot> pending;
+    std::deque<std::string> messages;
+    bool stopping = false;
+    std::thread thread;
+
+    // Worker thread: the bytes last written, or taken at launch
+    std::vector<uint8_t> lastBytes;
+};
+
+#endif // SESSION_AUTOSAVE_H
@@ -0,0 +1,504 @@
+#include "session_capture.h"
+#include "clock.h"
+#include "loop_manager.h"
+#include "rng.h"
+#include "sequencer.h"
+#include "synth.h"
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+
+namespace {
+
+// Byte offset and size of every SynthParamBlock field, in forEachParam order
+struct ParamField {
+    uint16_t offset;
+    uint8_t size;
+};
+
+std::vector<ParamField> buildParamFields() {
+    SynthParamBlock block;
+    std::vector<ParamField> fields;
+    const char* base = reinterpret_cast<const char*>(&block);
+    forEachParam(block, [&](auto& field) {
+        fields.push_back({static_cast<uint16_t>(reinterpret_cast<const char*>(&field) - base),
+                          static_cast<uint8_t>(sizeof(field))});
+    });
+    return fields;
+}
+
+const std::vector<ParamField> kParamFields = buildParamFields();
+
+uint32_t fieldBits(const SynthParamBlock& block, const ParamField& field) {
+    uint32_t bits = 0;
+    std::memcpy(&bits, reinterpret_cast<const char*>(&block) + field.offset, field.size);
+    return bits;
+}
+
+uint32_t floatBits(float value) {
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+float bitsFloat(uint32_t bits) {
+    float value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+uint32_t packSlot(const ModulationSlot& slot) {
+    return static_cast<uint8_t>(slot.source) | (static_cast<uint8_t>(slot.curve) << 8) |
+           (static_cast<uint8_t>(slot.amount) << 16) | (static_cast<uint32_t>(static_cast<uint8_t>(slot.destination)) << 24);
+}
+
+bool sameSlot(const ModulationSlot& a, const ModulationSlot& b) {
+    return a.source == b.source && a.curve == b.curve && a.amount == b.amount &&
+           a.destination == b.destination && a.type == b.type;
+}
+
+void putVarint(std::vector<uint8_t>& out, uint64_t value) {
+    while (value >= 0x80) {
+        out.push_back(static_cast<uint8_t>(value | 0x80));
+        value >>= 7;
+    }
+    out.push_back(static_cast<uint8_t>(value));
+}
+
+void putLe(std::vector<uint8_t>& out, uint32_t value, int bytes) {
+    for (int i = 0; i < bytes; ++i) {
+        out.push_back(static_cast<uint8_t>(value >> (8 * i)));
+    }
+}
+
+// Reads a capture back; every get fails once the data runs out
+struct Reader {
+    const std::vector<uint8_t>& data;
+    size_t pos = 0;
+    bool ok = true;
+
+    uint32_t le(int bytes) {
+        if (pos + bytes > data.size()) {
+            ok = false;
+            return 0;
+        }
+        uint32_t value = 0;
+        for (int i = 0; i < bytes; ++i) {
+            value |= static_cast<uint32_t>(data[pos++]) << (8 * i);
+        }
+        return value;
+    }
+
+    uint64_t varint() {
+        uint64_t value = 0;
+        for (int shift = 0; shift < 64; shift += 7) {
+            if (pos >= data.size()) {
+                ok = false;
+                return 0;
+            }
+            const uint8_t byte = data[pos++];
+            value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+            if (!(byte & 0x80)) {
+                return value;
+            }
+        }
+        ok = false;
+        return 0;
+    }
+};
+
+} // namespace
+
+float SessionCapture::getSamplerField(const Synth& synth, int slot, int field) {
+    switch (field) {
+        case SessionCapture::SAMPLER_SAMPLE: return static_cast<float>(synth.getSamplerSampleIndex(slot));
+        case SessionCapture::SAMPLER_KEY_MODE: return synth.getSamplerKeyMode(slot) ? 1.0f : 0.0f;
+        case SessionCapture::SAMPLER_LOOP_START: return synth.getSamplerLoopStart(slot);
+        case SessionCapture::SAMPLER_LOOP_LENGTH: return synth.getSamplerLoopLength(slot);
+        case SessionCapture::SAMPLER_CROSSFADE: return synth.getSamplerCrossfadeLength(slot);
+        case SessionCapture::SAMPLER_LOOP_SNAP: return synth.getSamplerLoopSnap(slot) ? 1.0f : 0.0f;
+        case SessionCapture::SAMPLER_OCTAVE: return static_cast<float>(synth.getSamplerOctave(slot));
+        case SessionCapture::SAMPLER_TUNE: return synth.getSamplerTune(slot);
+        case SessionCapture::SAMPLER_SPEED: return synth.getSamplerPlaybackSpeed(slot);
+        case SessionCapture::SAMPLER_TZFM: return synth.getSamplerTZFMDepth(slot);
+        case SessionCapture::SAMPLER_MODE: return static_cast<float>(synth.getSamplerPlaybackMode(slot));
+        case SessionCapture::SAMPLER_INTERPOLATION:
+            return static_cast<float>(synth.getSamplerInterpolation(slot));
+        case SessionCapture::SAMPLER_LEVEL: return synth.getSamplerLevel(slot);
+        case SessionCapture::SAMPLER_SYNC_MODE: return static_cast<float>(synth.getSamplerSyncMode(slot));
+        case SessionCapture::SAMPLER_NOTE_RESET: return synth.getSamplerNoteReset(slot) ? 1.0f : 0.0f;
+        default: return 0.0f;
+    }
+}
+
+void SessionCapture::setSamplerField(Synth& synth, int slot, int field, float value) {
+    const int asInt = static_cast<int>(value);
+    switch (field) {
+        case SessionCapture::SAMPLER_SAMPLE:
+            if (asInt >= 0) {
+                synth.setSamplerSample(slot, asInt);
+            }
+            break;
+        case SessionCapture::SAMPLER_KEY_MODE: synth.setSamplerKeyMode(slot, value > 0.5f); break;
+        case SessionCapture::SAMPLER_LOOP_START: synth.setSamplerLoopStart(slot, value); break;
+        case SessionCapture::SAMPLER_LOOP_LENGTH: synth.setSamplerLoopLength(slot, value); break;
+        case SessionCapture::SAMPLER_CROSSFADE: synth.setSamplerCrossfadeLength(slot, value); break;
+        case SessionCapture::SAMPLER_LOOP_SNAP: synth.setSamplerLoopSnap(slot, value > 0.5f); break;
+        case SessionCapture::SAMPLER_OCTAVE: synth.setSamplerOctave(slot, asInt); break;
+        case SessionCapture::SAMPLER_TUNE: synth.setSamplerTune(slot, value); break;
+        case SessionCapture::SAMPLER_SPEED: synth.setSamplerPlaybackSpeed(slot, value); break;
+        case SessionCapture::SAMPLER_TZFM: synth.setSamplerTZFMDepth(slot, value); break;
+        case SessionCapture::SAMPLER_MODE: synth.setSamplerPlaybackMode(slot, static_cast<PlaybackMode>(asInt)); break;
+        case SessionCapture::SAMPLER_INTERPOLATION:
+            synth.setSamplerInterpolation(slot, static_cast<SamplerInterpolation>(asInt));
+            break;
+        case SessionCapture::SAMPLER_LEVEL: synth.setSamplerLevel(slot, value); break;
+        case SessionCapture::SAMPLER_SYNC_MODE: synth.setSamplerSyncMode(slot, asInt); break;
+        case SessionCapture::SAMPLER_NOTE_RESET: synth.setSamplerNoteReset(slot, value > 0.5f); break;
+        default: break;
+    }
+}
+
+// ───────────────────────── Capture ─────────────────────────────────────────
+
+SessionCapture::~SessionCapture() {
+    stop();
+}
+
+bool SessionCapture::start(const std::string& path, uint32_t sampleRate, uint32_t bufferFrames,
+                           std::string& error) {
+    stop();
+    file = std::fopen(path.c_str(), "wb");
+    if (!file) {
+        error = "cannot write " + path;
+        return false;
+    }
+    std::vector<uint8_t> header(kMagic, kMagic + 4);
+    putLe(header, kVersion, 2);
+    putLe(header, sampleRate, 4);
+    putLe(header, bufferFrames, 4);
+    const uint64_t seed = rng::sessionSeed();
+    putLe(header, static_cast<uint32_t>(seed), 4);
+    putLe(header, static_cast<uint32_t>(seed >> 32), 4);
+    std::fwrite(header.data(), 1, header.size(), file);
+
+    blockFrames = bufferFrames;
+    encoded.reserve(65536);
+    stopping = false;
+    thread = std::thread(&SessionCapture::worker, this);
+    return true;
+}
+
+void SessionCapture::stop() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    wake.notify_all();
+    if (thread.joinable()) {
+        thread.join();
+    }
+    if (file) {
+        std::fclose(file);
+        file = nullptr;
+    }
+}
+
+void SessionCapture::post(Type type, uint8_t a, uint16_t b, uint32_t value, uint32_t frameOffset) {
+    if (!ring.push(Record{blockStart + frameOffset, type, a, b, value})) {
+        dropped.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+void SessionCapture::beginBlock(uint32_t nFrames) {
+    blockStart = frames.load(std::memory_order_relaxed);
+    frames.store(blockStart + nFrames, std::memory_order_relaxed);
+    if (nFrames != blockFrames) {
+        blockFrames = nFrames;
+        post(Type::BLOCK, 0, 0, nFrames);
+    }
+}
+
+void SessionCapture::captureParameters(const SynthParamBlock& block) {
+    for (size_t i = 0; i < kParamFields.size(); ++i) {
+        const uint32_t bits = fieldBits(block, kParamFields[i]);
+        if (bits != fieldBits(lastParams, kParamFields[i])) {
+            post(Type::PARAM, 0, static_cast<uint16_t>(i), bits);
+        }
+    }
+    lastParams = block;
+}
+
+void SessionCapture::captureControls(const Synth& synth, LoopManager* loops, const Clock* clock) {
+    for (int i = 0; i < kModulationSlotCount; ++i) {
+        const ModulationSlot* slot = synth.getModulationSlot(i);
+        if (slot && !sameSlot(*slot, lastSlots[i])) {
+            lastSlots[i] = *slot;
+            post(Type::MOD_SLOT, static_cast<uint8_t>(i), static_cast<uint8_t>(slot->type), packSlot(*slot));
+        }
+    }
+
+    for (int s = 0; s < SAMPLERS_PER_VOICE && s < 4; ++s) {
+        for (int f = 0; f < SAMPLER_FIELD_COUNT; ++f) {
+            const float value = getSamplerField(synth, s, f);
+            if (!captured || value != lastSampler[s][f]) {
+                lastSampler[s][f] = value;
+                post(Type::SAMPLER, static_cast<uint8_t>(s), static_cast<uint16_t>(f), floatBits(value));
+            }
+        }
+    }
+
+    for (int l = 0; loops && l < loops->getLoopCount(); ++l) {
+        Looper* loop = loops->getLoop(l);
+        const bool pending = loop && loop->isChangePending();
+        const uint8_t state = pending ? static_cast<uint8_t>(loop->getPendingState()) : 0;
+        if (pending && (!loopPending[l] || state != loopPendingState[l])) {
+            post(Type::LOOP, static_cast<uint8_t>(l), state, 0);
+        }
+        loopPending[l] = pending;
+        loopPendingState[l] = state;
+    }
+
+    if (clock && (!captured || clock->isPlaying() != lastPlaying || clock->getTempo() != lastTempo)) {
+        lastPlaying = clock->isPlaying();
+        lastTempo = clock->getTempo();
+        post(Type::TRANSPORT, lastPlaying ? 1 : 0, 0, floatBits(static_cast<float>(lastTempo)));
+    }
+    captured = true;
+}
+
+void SessionCapture::captureNote(const ScheduledEvent& event) {
+    post(event.type == ScheduledEvent::NOTE_ON ? Type::NOTE_ON : Type::NOTE_OFF, event.note, event.velocity, 0,
+         event.frame);
+}
+
+void SessionCapture::worker() {
+    // The audio thread cannot signal without a syscall, so the ring is polled
+    std::unique_lock<std::mutex> lock(mutex);
+    while (!stopping) {
+        wake.wait_for(lock, std::chrono::milliseconds(kDrainIntervalMs), [this] { return stopping; });
+        lock.unlock();
+        drain();
+        lock.lock();
+    }
+    lock.unlock();
+    drain();
+}
+
+void SessionCapture::drain() {
+    encoded.clear();
+    Record record;
+    while (ring.pop(record)) {
+        // Notes of a buffer are posted after its state records but may
+        // fall later in it; deltas are kept non-negative regardless
+        const uint64_t frame = std::max(record.frame, writtenFrame);
+        putVarint(encoded, frame - writtenFrame);
+        writtenFrame = frame;
+        encoded.push_back(static_cast<uint8_t>(record.type));
+        switch (record.type) {
+            case Type::BLOCK:
+                putVarint(encoded, record.value);
+                break;
+            case Type::NOTE_ON:
+                encoded.push_back(record.a);
+                encoded.push_back(static_cast<uint8_t>(record.b));
+                break;
+            case Type::NOTE_OFF:
+                encoded.push_back(record.a);
+                break;
+            case Type::PARAM:
+                putVarint(encoded, record.b);
+                putLe(encoded, record.value, 4);
+                break;
+            case Type::MOD_SLOT:
+                encoded.push_back(record.a);
+                putLe(encoded, record.value, 4);
+                encoded.push_back(static_cast<uint8_t>(record.b));
+                break;
+            case Type::SAMPLER:
+                encoded.push_back(record.a);
+                encoded.push_back(static_cast<uint8_t>(record.b));
+                putLe(encoded, record.value, 4);
+                break;
+            case Type::LOOP:
+                encoded.push_back(record.a);
+                encoded.push_back(static_cast<uint8_t>(record.b));
+                break;
+            case Type::TRANSPORT:
+                encoded.push_back(record.a);
+                putLe(encoded, record.value, 4);
+                break;
+            default:
+                break;
+        }
+    }
+    if (file && !encoded.empty()) {
+        std::fwrite(encoded.data(), 1, encoded.size(), file);
+        std::fflush(file);
+    }
+}
+
+// ───────────────────────── Replay ──────────────────────────────────────────
+
+bool SessionReplay::load(const std::string& path, std::string& error) {
+    FILE* in = std::fopen(path.c_str(), "rb");
+    if (!in) {
+        error = "cannot open " + path;
+        return false;
+    }
+    std::vector<uint8_t> data;
+    uint8_t buf[65536];
+    size_t n;
+    while ((n = std::fread(buf, 1, sizeof(buf), in)) > 0) {
+        data.insert(data.end(), buf, buf + n);
+    }
+    std::fclose(in);
+
+    if (data.size() < 14 || std::memcmp(data.data(), SessionCapture::kMagic, 4) != 0) {
+        error = path + " is not a session capture";
+        return false;
+    }
+    Reader reader{data, 4};
+    const uint32_t version = reader.le(2);
+    if (version < 1 || version > SessionCapture::kVersion) {
+        error = path + ": unsupported capture version";
+        return false;
+    }
+    sampleRate = reader.le(4);
+    bufferFrames = reader.le(4);
+    seed = 1;
+    if (version >= 2) {
+        seed = reader.le(4);
+        seed |= static_cast<uint64_t>(reader.le(4)) << 32;
+    }
+    currentBlockFrames = bufferFrames;
+
+    typedef SessionCapture::Type Type;
+    uint64_t frame = 0;
+    records.clear();
+    while (reader.pos < data.size()) {
+        SessionCapture::Record record{};
+        frame += reader.varint();
+        record.frame = frame;
+        record.type = static_cast<Type>(reader.le(1));
+        switch (record.type) {
+            case Type::BLOCK:
+                record.value = static_cast<uint32_t>(reader.varint());
+                break;
+            case Type::NOTE_ON:
+                record.a = static_cast<uint8_t>(reader.le(1));
+                record.b = static_cast<uint16_t>(reader.le(1));
+                break;
+            case Type::NOTE_OFF:
+                record.a = static_cast<uint8_t>(reader.le(1));
+                break;
+            case Type::PARAM:
+                record.b = static_cast<uint16_t>(reader.varint());
+                record.value = reader.le(4);
+                reader.ok = reader.ok && record.b < kParamFields.size();
+                break;
+            case Type::MOD_SLOT:
+                record.a = static_cast<uint8_t>(reader.le(1));
+                record.value = reader.le(4);
+                record.b = static_cast<uint16_t>(reader.le(1));
+                reader.ok = reader.ok && record.a < kModulationSlotCount;
+                break;
+            case Type::SAMPLER:
+            case Type::LOOP:
+                record.a = static_cast<uint8_t>(reader.le(1));
+                record.b = static_cast<uint16_t>(reader.le(1));
+                if (record.type == Type::SAMPLER) {
+                    record.value = reader.le(4);
+                }
+                break;
+            case Type::TRANSPORT:
+                record.a = static_cast<uint8_t>(reader.le(1));
+                record.value = reader.le(4);
+                break;
+            default:
+                reader.ok = false;
+                break;
+        }
+        if (!reader.ok) {
+            // A capture cut short (the session crashed) replays up to here
+            break;
+        }
+        records.push_back(record);
+    }
+    lengthFrames = frame;
+    nextControl = nextNote = nextBlock = 0;
+    params = SynthParamBlock();
+    for (ModulationSlot& slot : slots) {
+        slot.clear();
+    }
+    return true;
+}
+
+uint32_t SessionReplay::blockFramesAt(uint64_t frame) {
+    while (nextBlock < records.size() && records[nextBlock].frame <= frame) {
+        if (records[nextBlock].type == SessionCapture::Type::BLOCK) {
+            currentBlockFrames = records[nextBlock].value;
+        }
+        ++nextBlock;
+    }
+    return currentBlockFrames;
+}
+
+void SessionReplay::applyControls(uint64_t frame, Synth& synth, LoopManager* loops, Sequencer* sequencer) {
+    typedef SessionCapture::Type Type;
+    blockFrame = frame;
+    for (; nextControl < records.size() && records[nextControl].frame <= frame; ++nextControl) {
+        const SessionCapture::Record& record = records[nextControl];
+        switch (record.type) {
+            case Type::PARAM: {
+                const ParamField& field = kParamFields[record.b];
+                std::memcpy(reinterpret_cast<char*>(&params) + field.offset, &record.value, field.size);
+                break;
+            }
+            case Type::MOD_SLOT: {
+                ModulationSlot& slot = slots[record.a];
+                slot.source = static_cast<int8_t>(record.value);
+                slot.curve = static_cast<int8_t>(record.value >> 8);
+                slot.amount = static_cast<int8_t>(record.value >> 16);
+                slot.destination = static_cast<int8_t>(record.value >> 24);
+                slot.type = static_cast<int8_t>(record.b);
+                break;
+            }
+            case Type::SAMPLER:
+                SessionCapture::setSamplerField(synth, record.a, record.b, bitsFloat(record.value));
+                break;
+            case Type::LOOP:
+                if (loops && loops->getLoop(record.a)) {
+                    loops->getLoop(record.a)->requestState(static_cast<Looper::State>(record.b));
+                }
+                break;
+            case Type::TRANSPORT:
+                if (sequencer) {
+                    sequencer->setTempo(bitsFloat(record.value));
+                    if (record.a && !sequencer->isPlaying()) {
+                        sequencer->play();
+                    } else if (!record.a && sequencer->isPlaying()) {
+                        sequencer->stop();
+                    }
+                }
+                break;
+            default:
+                break;
+        }
+    }
+}
+
+void SessionReplay::scheduleNotes(uint32_t nFrames, EventSchedule& schedule) {
+    typedef SessionCapture::Type Type;
+    const uint64_t frame = blockFrame;
+    // Skip records that are not notes; they are applied by applyControls
+    for (; nextNote < records.size() && records[nextNote].frame < frame + nFrames; ++nextNote) {
+        const SessionCapture::Record& record = records[nextNote];
+        if (record.type != Type::NOTE_ON && record.type != Type::NOTE_OFF) {
+            continue;
+        }
+        const uint32_t offset = record.frame > frame ? static_cast<uint32_t>(record.frame - frame) : 0;
+        schedule.add(offset, record.type == Type::NOTE_ON ? ScheduledEvent::NOTE_ON : ScheduledEvent::NOTE_OFF,
+                     record.a, static_cast<uint8_t>(record.b));
+    }
+}
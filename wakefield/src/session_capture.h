@@ -0,0 +1,203 @@
+#ifndef SESSION_CAPTURE_H
+#define SESSION_CAPTURE_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "event_schedule.h"
+#include "loop_manager.h"
+#include "modulation.h"
+#include "param_snapshot.h"
+#include "spsc_queue.h"
+
+class Synth;
+class LoopManager;
+class Clock;
+class Sequencer;
+
+// What the audio callback acts on during a live session, stamped with the
+// frame it took effect on, so the offline renderer can play the session
+// back block for block (--capture live, --replay with --render).
+//
+// Captured:
+//   - every note the callback dispatched (MIDI input, MIDI file and the
+//     sequencer), on its frame
+//   - parameter block fields that changed since the last buffer (UI edits,
+//     CCs, OSC, preset switches and morphs alike)
+//   - modulation slot edits and sampler slot settings
+//   - looper state requests and transport play/stop and tempo
+//   - the size of each buffer, when it changes
+// Settings that reach the engine outside these (chaos generator settings,
+// envelope bends) come from the preset given to the replay, and the
+// replay loads the same sample directory, so sample indices must match.
+// The header also keeps the session's random seed (rng.h), so the replay's
+// sequencer generates and rolls as the live one did.
+//
+// Log format: "WFSC", u16 version, u32 sample rate, u32 buffer frames,
+// u64 seed (version 2 on; version 1 logs replay with seed 1), then one
+// record each: varint frame delta, u8 type, payload
+//   BLOCK      varint frames
+//   NOTE_ON    u8 note, u8 velocity
+//   NOTE_OFF   u8 note
+//   PARAM      varint field (forEachParam order), u32 raw bits
+//   MOD_SLOT   u8 slot, i8 source, curve, amount, destination, type
+//   SAMPLER    u8 slot, u8 field, f32 value
+//   LOOP       u8 loop, u8 state
+//   TRANSPORT  u8 playing, f32 tempo
+// All little-endian.
+class SessionCapture {
+public:
+    enum class Type : uint8_t {
+        BLOCK = 0,
+        NOTE_ON,
+        NOTE_OFF,
+        PARAM,
+        MOD_SLOT,
+        SAMPLER,
+        LOOP,
+        TRANSPORT,
+        COUNT
+    };
+
+    // Sampler slot settings, in the order a replay applies them (speed
+    // after octave and tune, which recompute it)
+    enum SamplerField : uint8_t {
+        SAMPLER_SAMPLE = 0,
+        SAMPLER_KEY_MODE,
+        SAMPLER_LOOP_START,
+        SAMPLER_LOOP_LENGTH,
+        SAMPLER_CROSSFADE,
+        SAMPLER_LOOP_SNAP,
+        SAMPLER_OCTAVE,
+        SAMPLER_TUNE,
+        SAMPLER_SPEED,
+        SAMPLER_TZFM,
+        SAMPLER_MODE,
+        SAMPLER_INTERPOLATION,
+        SAMPLER_LEVEL,
+        SAMPLER_SYNC_MODE,
+        SAMPLER_NOTE_RESET,
+        SAMPLER_FIELD_COUNT
+    };
+
+    struct Record {
+        uint64_t frame;
+        Type type;
+        uint8_t a;          // Note, slot, loop, playing
+        uint16_t b;         // Velocity, field, state
+        uint32_t value;     // Raw bits of a value
+    };
+
+    static constexpr char kMagic[4] = {'W', 'F', 'S', 'C'};
+    static constexpr uint16_t kVersion = 2;
+    static constexpr int kDrainIntervalMs = 50;
+
+    // One sampler slot setting as a float (the sample as its bank index)
+    // and back; SAMPLER_SAMPLE below 0 is ignored. Also used by session files
+    static float getSamplerField(const Synth& synth, int slot, int field);
+    static void setSamplerField(Synth& synth, int slot, int field, float value);
+
+    SessionCapture() = default;
+    ~SessionCapture();
+
+    // Open path and start the writer thread. Call before the stream opens
+    bool start(const std::string& path, uint32_t sampleRate, uint32_t bufferFrames, std::string& error);
+    // Drain, close the file and stop the writer
+    void stop();
+
+    // Audio thread, each callback: beginBlock first, then the state
+    // captures before the sequencer runs, notes as they are dispatched
+    void beginBlock(uint32_t nFrames);
+    void captureParameters(const SynthParamBlock& block);
+    void captureControls(const Synth& synth, LoopManager* loops, const Clock* clock);
+    void captureNote(const ScheduledEvent& event);
+
+    uint64_t getFrames() const { return frames.load(std::memory_order_relaxed); }
+    // Records lost to a full ring: the log no longer replays the session
+    uint32_t getDroppedCount() const { return dropped.load(std::memory_order_relaxed); }
+
+    SessionCapture(const SessionCapture&) = delete;
+    SessionCapture& operator=(const SessionCapture&) = delete;
+
+private:
+    void post(Type type, uint8_t a, uint16_t b, uint32_t value, uint32_t frameOffset = 0);
+    void worker();
+    void drain();
+
+    SpscQueue<Record, 8192> ring;
+    std::atomic<uint32_t> dropped{0};
+    std::atomic<uint64_t> frames{0};
+
+    // Audio thread: what the log holds so far
+    uint64_t blockStart = 0;
+    uint32_t blockFrames = 0;
+    bool captured = false;
+    SynthParamBlock lastParams;
+    ModulationSlot lastSlots[kModulationSlotCount];
+    float lastSampler[4][SAMPLER_FIELD_COUNT] = {};
+    bool loopPending[MAX_LOOPS] = {};
+    uint8_t loopPendingState[MAX_LOOPS] = {};
+    bool lastPlaying = false;
+    double lastTempo = 0.0;
+
+    // Writer thread
+    FILE* file = nullptr;
+    uint64_t writtenFrame = 0;
+    std::vector<uint8_t> encoded;
+
+    std::mutex mutex;                   // Guards stopping
+    std::condition_variable wake;
+    bool stopping = false;
+    std::thread thread;
+};
+
+// A capture read back for the offline renderer. The render loop applies
+// each buffer's state records before calling the audio callback, which
+// takes the parameter block and the buffer's notes from here.
+class SessionReplay {
+public:
+    bool load(const std::string& path, std::string& error);
+
+    uint32_t getSampleRate() const { return sampleRate; }
+    uint32_t getBufferFrames() const { return bufferFrames; }
+    // rng::sessionSeed() of the captured session
+    uint64_t getSeed() const { return seed; }
+    // Frame of the last record
+    uint64_t getLengthFrames() const { return lengthFrames; }
+
+    // Render loop: the size of the buffer starting at frame
+    uint32_t blockFramesAt(uint64_t frame);
+
+    // Render loop, before the callback for the buffer at frame: apply its
+    // parameter, modulation slot, sampler, looper and transport records
+    void applyControls(uint64_t frame, Synth& synth, LoopManager* loops, Sequencer* sequencer);
+
+    // Audio callback: the parameter block as of the last applyControls(),
+    // and the notes of its buffer (nFrames from that frame)
+    const SynthParamBlock& getParameters() const { return params; }
+    const ModulationSlot* getModulationSlots() const { return slots; }
+    void scheduleNotes(uint32_t nFrames, EventSchedule& schedule);
+
+private:
+    std::vector<SessionCapture::Record> records;
+    uint32_t sampleRate = 0;
+    uint32_t bufferFrames = 0;
+    uint64_t seed = 1;
+    uint64_t lengthFrames = 0;
+
+    size_t nextControl = 0;             // First record not yet applied
+    size_t nextNote = 0;                // First note not yet scheduled
+    size_t nextBlock = 0;               // Block size records, for blockFramesAt
+    uint32_t currentBlockFrames = 0;
+    uint64_t blockFrame = 0;            // Buffer of the last applyControls()
+
+    SynthParamBlock params;
+    ModulationSlot slots[kModulationSlotCount];
+};
+
+#endif // SESSION_CAPTURE_H
@@ -0,0 +1,689 @@
+#include "session_file.h"
+#include "loop_manager.h"
+#include "sequencer.h"
+#include "session_capture.h"
+#include "synth.h"
+#include "ui.h"
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <dirent.h>
+#include <fcntl.h>
+#include <pwd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <type_traits>
+#include <unistd.h>
+
+namespace {
+
+constexpr uint32_t kNoString = 0xFFFFFFFFu;
+constexpr size_t kHeaderBytes = 12;
+constexpr size_t kTableEntryBytes = 16;
+constexpr int kSamplerSlots = 4;
+
+struct SamplerRecord {
+    uint32_t path;              // STRINGS, the sample's source file
+    uint32_t name;              // STRINGS, looked up if the path is gone
+    float fields[SessionCapture::SAMPLER_FIELD_COUNT];  // SAMPLER_SAMPLE unused
+    uint32_t reserved;
+};
+
+struct TrackRecord {
+    uint32_t name;              // STRINGS
+    int32_t resolution;         // Subdivision
+    int32_t length;
+    int32_t rotation;
+    uint32_t firstStep;         // STEPS, length steps in storage order
+    int32_t scale;
+    int32_t rootNote;
+    int32_t octaveMin;
+    int32_t octaveMax;
+    float density;
+    int32_t maxInterval;
+    int32_t contour;
+    int32_t gravityNote;
+    uint32_t customScale;       // Bit per semitone
+    int32_t euclidHits;
+    int32_t euclidSteps;
+    int32_t euclidRotation;
+    uint8_t muted;
+    uint8_t solo;
+    uint8_t phaseDriver;
+    uint8_t reserved;
+    uint32_t markovStates;      // n
+    uint32_t markovWord;        // MARKOV: n notes, then n × n probabilities
+    int32_t markovCurrent;      // State index
+};
+
+struct StepRecord {
+    uint8_t active;
+    uint8_t locked;
+    uint8_t midiNote;
+    uint8_t velocity;
+    float gateLength;
+    float probability;
+    float filterCutoff;
+    float reverbMix;
+    float brainwaveMorph;
+};
+
+struct GlobalsRecord {
+    double tempo;
+    int32_t currentTrack;
+    uint32_t reserved;
+};
+
+static_assert(sizeof(SamplerRecord) == 72, "SamplerRecord layout");
+static_assert(sizeof(TrackRecord) == 84, "TrackRecord layout");
+static_assert(sizeof(StepRecord) == 24, "StepRecord layout");
+static_assert(sizeof(GlobalsRecord) == 16, "GlobalsRecord layout");
+
+size_t align8(size_t bytes) {
+    return (bytes + 7) & ~size_t(7);
+}
+
+// Sections as they are built, then laid out behind the header and table
+class Writer {
+public:
+    template <typename T>
+    void add(uint32_t id, const std::vector<T>& records) {
+        Built section{id, static_cast<uint32_t>(records.size()), sizeof(T), {}};
+        section.bytes.resize(records.size() * sizeof(T));
+        if (!records.empty()) {
+            std::memcpy(section.bytes.data(), records.data(), section.bytes.size());
+        }
+        sections.push_back(std::move(section));
+    }
+
+    uint32_t intern(const std::string& text) {
+        const uint32_t offset = static_cast<uint32_t>(strings.size());
+        strings.insert(strings.end(), text.begin(), text.end());
+        strings.push_back('\0');
+        return offset;
+    }
+    const std::vector<char>& getStrings() const { return strings; }
+
+    std::vector<uint8_t> finish() const {
+        size_t offset = align8(kHeaderBytes + sections.size() * kTableEntryBytes);
+        std::vector<uint32_t> offsets;
+        for (const Built& section : sections) {
+            offsets.push_back(static_cast<uint32_t>(offset));
+            offset = align8(offset + section.bytes.size());
+        }
+        std::vector<uint8_t> out(offset, 0);
+        std::memcpy(out.data(), SessionFile::kMagic, 4);
+        const uint16_t version = SessionFile::kVersion;
+        const uint16_t count = static_cast<uint16_t>(sections.size());
+        const uint32_t total = static_cast<uint32_t>(out.size());
+        std::memcpy(&out[4], &version, 2);
+        std::memcpy(&out[6], &count, 2);
+        std::memcpy(&out[8], &total, 4);
+        for (size_t i = 0; i < sections.size(); ++i) {
+            const Built& section = sections[i];
+            const uint32_t entry[4] = {section.id, offsets[i], section.count, section.stride};
+            std::memcpy(&out[kHeaderBytes + i * kTableEntryBytes], entry, sizeof(entry));
+            if (!section.bytes.empty()) {
+                std::memcpy(&out[offsets[i]], section.bytes.data(), section.bytes.size());
+            }
+        }
+        return out;
+    }
+
+private:
+    struct Built {
+        uint32_t id;
+        uint32_t count;
+        uint32_t stride;
+        std::vector<uint8_t> bytes;
+    };
+    std::vector<Built> sections;
+    std::vector<char> strings;
+};
+
+// A record of stride bytes into a T: fields a shorter record lacks keep
+// their defaults (zero for the records above), fields a longer one adds
+// are skipped
+template <typename T>
+T readRecord(const uint8_t* data, uint32_t stride) {
+    T value{};
+    std::memcpy(&value, data, std::min<size_t>(stride, sizeof(T)));
+    return value;
+}
+
+bool validSubdivision(int value) {
+    switch (static_cast<Subdivision>(value)) {
+        case Subdivision::WHOLE:
+        case Subdivision::HALF:
+        case Subdivision::QUARTER:
+        case Subdivision::EIGHTH:
+        case Subdivision::SIXTEENTH:
+        case Subdivision::THIRTYSECOND:
+        case Subdivision::SIXTYFOURTH:
+            return true;
+    }
+    return false;
+}
+
+} // namespace
+
+std::string SessionFile::getSessionDirectory() {
+    const char* homeDir = getenv("HOME");
+    if (!homeDir) {
+        struct passwd* pw = getpwuid(getuid());
+        homeDir = pw->pw_dir;
+    }
+    std::string directory = std::string(homeDir) + "/.config";
+    mkdir(directory.c_str(), 0755);
+    directory += "/wakefield";
+    mkdir(directory.c_str(), 0755);
+    directory += "/sessions";
+    mkdir(directory.c_str(), 0755);
+    return directory;
+}
+
+std::string SessionFile::getSessionPath(const std::string& name) {
+    if (name.find('/') != std::string::npos) {
+        return name;
+    }
+    return getSessionDirectory() + "/" + name + ".session";
+}
+
+std::vector<std::string> SessionFile::listSessions() {
+    std::vector<std::string> names;
+    DIR* dir = opendir(getSessionDirectory().c_str());
+    if (!dir) {
+        return names;
+    }
+    const std::string extension = ".session";
+    while (struct dirent* entry = readdir(dir)) {
+        const std::string file = entry->d_name;
+        if (file.size() > extension.size() &&
+            file.compare(file.size() - extension.size(), extension.size(), extension) == 0) {
+            names.push_back(file.substr(0, file.size() - extension.size()));
+        }
+    }
+    closedir(dir);
+    std::sort(names.begin(), names.end());
+    return names;
+}
+
+std::string SessionFile::getLoopPath(const std::string& sessionPath, int index) {
+    std::string base = sessionPath;
+    const std::string extension = ".session";
+    if (base.size() > extension.size() &&
+        base.compare(base.size() - extension.size(), extension.size(), extension) == 0) {
+        base.resize(base.size() - extension.size());
+    }
+    return base + ".loop" + std::to_string(index + 1) + ".wav";
+}
+
+void SessionFile::capture(Snapshot& snapshot, const SynthParameters& params, const Synth& synth,
+                          const Sequencer& sequencer) {
+    SynthParamBlock block;
+    params.captureBlock(block);
+    snapshot.params.clear();
+    forEachParam(block, [&](auto& field) {
+        uint32_t bits = 0;
+        std::memcpy(&bits, &field, sizeof(field));
+        snapshot.params.push_back(bits);
+    });
+
+    snapshot.modSlots.clear();
+    for (int i = 0; i < kModulationSlotCount; ++i) {
+        snapshot.modSlots.push_back(*synth.getModulationSlot(i));
+    }
+
+    snapshot.samplers.assign(kSamplerSlots, Snapshot::Sampler());
+    for (int s = 0; s < kSamplerSlots; ++s) {
+        Snapshot::Sampler& sampler = snapshot.samplers[s];
+        const SampleData* sample = synth.getSampleBank()->getSample(synth.getSamplerSampleIndex(s));
+        if (sample) {
+            sampler.hasSample = true;
+            sampler.path = sample->path;
+            sampler.name = sample->name;
+        }
+        for (int f = 0; f < SessionCapture::SAMPLER_FIELD_COUNT; ++f) {
+            sampler.fields.push_back(SessionCapture::getSamplerField(synth, s, f));
+        }
+    }
+
+    snapshot.tracks.clear();
+    snapshot.phaseDrivers.clear();
+    for (int t = 0; t < sequencer.getTrackCount(); ++t) {
+        snapshot.tracks.push_back(sequencer.getTrack(t));
+        snapshot.phaseDrivers.push_back(static_cast<int>(sequencer.getTrackPhaseDriver(t)));
+    }
+
+    snapshot.loops.assign(MAX_LOOPS, std::string());
+    snapshot.tempo = sequencer.getTempo();
+    snapshot.currentTrack = sequencer.getCurrentTrackIndex();
+}
+
+std::vector<uint8_t> SessionFile::serialize(const Snapshot& snapshot) {
+    Writer writer;
+    writer.add(PARAMS, snapshot.params);
+    writer.add(MOD_SLOTS, snapshot.modSlots);
+
+    std::vector<SamplerRecord> samplers;
+    for (const Snapshot::Sampler& sampler : snapshot.samplers) {
+        SamplerRecord record;
+        std::memset(&record, 0, sizeof(record));
+        record.path = kNoString;
+        record.name = kNoString;
+        if (sampler.hasSample) {
+            record.path = writer.intern(sampler.path);
+            record.name = writer.intern(sampler.name);
+        }
+        for (size_t f = 0; f < sampler.fields.size() && f < SessionCapture::SAMPLER_FIELD_COUNT; ++f) {
+            record.fields[f] = sampler.fields[f];
+        }
+        samplers.push_back(record);
+    }
+    writer.add(SAMPLERS, samplers);
+
+    std::vector<TrackRecord> tracks;
+    std::vector<StepRecord> steps;
+    std::vector<uint32_t> markov;
+    for (size_t t = 0; t < snapshot.tracks.size(); ++t) {
+        const Track& track = snapshot.tracks[t];
+        const Pattern& pattern = track.getPattern();
+        const MusicalConstraints& constraints = track.getConstraints();
+        const EuclideanPattern& rhythm = track.getEuclideanPattern();
+        const MarkovChain& chain = track.getMarkovChain();
+
+        TrackRecord record;
+        std::memset(&record, 0, sizeof(record));
+        record.name = writer.intern(track.getName());
+        record.resolution = static_cast<int32_t>(pattern.getResolution());
+        record.length = pattern.getLength();
+        record.rotation = pattern.getRotation();
+        record.firstStep = static_cast<uint32_t>(steps.size());
+        // Storage order: getStep(i) reads storage step i + rotation
+        for (int i = 0; i < pattern.getLength(); ++i) {
+            const PatternStep& step = pattern.getStep(i - pattern.getRotation());
+            steps.push_back({static_cast<uint8_t>(step.active), static_cast<uint8_t>(step.locked),
+                             static_cast<uint8_t>(step.midiNote), static_cast<uint8_t>(step.velocity),
+                             step.gateLength, step.probability, step.filterCutoff, step.reverbMix,
+                             step.brainwaveMorph});
+        }
+        record.scale = static_cast<int32_t>(constraints.getScale());
+        record.rootNote = constraints.getRootNote();
+        record.octaveMin = constraints.getOctaveMin();
+        record.octaveMax = constraints.getOctaveMax();
+        record.density = constraints.getDensity();
+        record.maxInterval = constraints.getMaxInterval();
+        record.contour = static_cast<int32_t>(constraints.getContour());
+        record.gravityNote = constraints.getGravityNote();
+        const std::vector<bool>& custom = constraints.getCustomScale();
+        for (size_t i = 0; i < custom.size() && i < 12; ++i) {
+            record.customScale |= custom[i] ? (1u << i) : 0u;
+        }
+        record.euclidHits = rhythm.getHits();
+        record.euclidSteps = rhythm.getSteps();
+        record.euclidRotation = rhythm.getRotation();
+        record.muted = track.isMuted();
+        record.solo = track.isSolo();
+        record.phaseDriver = t < snapshot.phaseDrivers.size()
+            ? static_cast<uint8_t>(snapshot.phaseDrivers[t]) : 0;
+        record.markovStates = static_cast<uint32_t>(chain.getStateCount());
+        record.markovWord = static_cast<uint32_t>(markov.size());
+        record.markovCurrent = chain.getCurrentStateIndex();
+        for (int i = 0; i < chain.getStateCount(); ++i) {
+            markov.push_back(static_cast<uint32_t>(chain.getStateNote(i)));
+        }
+        for (float probability : chain.getTransitionMatrix()) {
+            uint32_t bits;
+            std::memcpy(&bits, &probability, sizeof(bits));
+            markov.push_back(bits);
+        }
+        tracks.push_back(record);
+    }
+    writer.add(TRACKS, tracks);
+    writer.add(STEPS, steps);
+    writer.add(MARKOV, markov);
+
+    std::vector<uint32_t> loopRefs(MAX_LOOPS, kNoString);
+    for (size_t i = 0; i < snapshot.loops.size() && i < loopRefs.size(); ++i) {
+        if (!snapshot.loops[i].empty()) {
+            loopRefs[i] = writer.intern(snapshot.loops[i]);
+        }
+    }
+    writer.add(LOOPS, loopRefs);
+
+    GlobalsRecord globals;
+    std::memset(&globals, 0, sizeof(globals));
+    globals.tempo = snapshot.tempo;
+    globals.currentTrack = snapshot.currentTrack;
+    writer.add(GLOBALS, std::vector<GlobalsRecord>{globals});
+    writer.add(STRINGS, writer.getStrings());
+    return writer.finish();
+}
+
+bool SessionFile::writeFile(const std::string& path, const std::vector<uint8_t>& bytes,
+                            std::string& message) {
+    const std::string temporary = path + ".tmp";
+    FILE* file = std::fopen(temporary.c_str(), "wb");
+    bool written = file && std::fwrite(bytes.data(), 1, bytes.size(), file) == bytes.size();
+    if (file) {
+        written = std::fclose(file) == 0 && written;
+    }
+    if (!written || std::rename(temporary.c_str(), path.c_str()) != 0) {
+        message = "Could not write session " + path + ": " + std::strerror(errno);
+        std::remove(temporary.c_str());
+        return false;
+    }
+    return true;
+}
+
+bool SessionFile::save(const std::string& path, const SynthParameters& params, const Synth& synth,
+                       const Sequencer& sequencer, LoopManager* loops, std::string& message) {
+    Snapshot snapshot;
+    capture(snapshot, params, synth, sequencer);
+
+    int loopsSaved = 0;
+    for (int i = 0; loops && i < loops->getLoopCount(); ++i) {
+        const Looper::State state = loops->getLoopState(i);
+        if (state == Looper::Empty || state == Looper::Recording) {
+            continue;
+        }
+        const std::string wav = getLoopPath(path, i);
+        if (loops->saveLoop(i, wav)) {
+            snapshot.loops[i] = wav;
+            ++loopsSaved;
+        }
+    }
+
+    const std::vector<uint8_t> bytes = serialize(snapshot);
+    if (!writeFile(path, bytes, message)) {
+        return false;
+    }
+    message = "Saved session " + path + " (" + std::to_string(bytes.size()) + " bytes";
+    if (loopsSaved > 0) {
+        message += ", " + std::to_string(loopsSaved) + " loop" + (loopsSaved == 1 ? "" : "s") + " writing";
+    }
+    message += ")";
+    return true;
+}
+
+SessionFile::~SessionFile() {
+    close();
+}
+
+void SessionFile::close() {
+    if (mapping) {
+        munmap(mapping, mappedBytes);
+    }
+    mapping = nullptr;
+    mappedBytes = 0;
+    for (Section& section : sections) {
+        section = Section();
+    }
+    path.clear();
+}
+
+bool SessionFile::open(const std::string& filePath, std::string& error) {
+    close();
+    const int fd = ::open(filePath.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        error = "Could not open session " + filePath + ": " + std::strerror(errno);
+        return false;
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size < static_cast<off_t>(kHeaderBytes)) {
+        ::close(fd);
+        error = "Not a session file: " + filePath;
+        return false;
+    }
+    const size_t bytes = static_cast<size_t>(st.st_size);
+    void* mapped = mmap(nullptr, bytes, PROT_READ, MAP_PRIVATE | MAP_POPULATE, fd, 0);
+    ::close(fd);
+    if (mapped == MAP_FAILED) {
+        error = "Could not map session " + filePath + ": " + std::strerror(errno);
+        return false;
+    }
+    mapping = static_cast<uint8_t*>(mapped);
+    mappedBytes = bytes;
+
+    uint16_t version = 0;
+    uint16_t count = 0;
+    uint32_t total = 0;
+    std::memcpy(&version, mapping + 4, 2);
+    std::memcpy(&count, mapping + 6, 2);
+    std::memcpy(&total, mapping + 8, 4);
+    if (std::memcmp(mapping, kMagic, 4) != 0 || total != bytes ||
+        kHeaderBytes + size_t(count) * kTableEntryBytes > bytes) {
+        close();
+        error = "Not a session file: " + filePath;
+        return false;
+    }
+    if (version > kVersion) {
+        close();
+        error = "Session " + filePath + " is version " + std::to_string(version) + ", newer than this build";
+        return false;
+    }
+
+    // Minimum record sizes; unknown sections are skipped
+    const uint32_t minStride[SECTION_COUNT] = {
+        0, 4, sizeof(ModulationSlot), sizeof(SamplerRecord), sizeof(TrackRecord),
+        sizeof(StepRecord), 4, 4, sizeof(GlobalsRecord), 1
+    };
+    for (uint16_t i = 0; i < count; ++i) {
+        uint32_t entry[4];
+        std::memcpy(entry, mapping + kHeaderBytes + i * kTableEntryBytes, sizeof(entry));
+        const uint32_t id = entry[0];
+        const uint64_t offset = entry[1];
+        const uint64_t sectionBytes = uint64_t(entry[2]) * entry[3];
+        if (offset + sectionBytes > bytes) {
+            close();
+            error = "Session " + filePath + " is truncated";
+            return false;
+        }
+        if (id == 0 || id >= SECTION_COUNT) {
+            continue;
+        }
+        if (entry[2] > 0 && entry[3] < minStride[id]) {
+            close();
+            error = "Session " + filePath + " has a malformed section";
+            return false;
+        }
+        sections[id].data = mapping + offset;
+        sections[id].count = entry[2];
+        sections[id].stride = entry[3];
+    }
+    path = filePath;
+    return true;
+}
+
+const uint8_t* SessionFile::record(SectionId id, uint32_t index) const {
+    const Section& section = sections[id];
+    return index < section.count ? section.data + size_t(index) * section.stride : nullptr;
+}
+
+const char* SessionFile::string(uint32_t offset) const {
+    const Section& strings = sections[STRINGS];
+    if (offset >= strings.count) {
+        return nullptr;
+    }
+    const char* start = reinterpret_cast<const char*>(strings.data) + offset;
+    return std::memchr(start, '\0', strings.count - offset) ? start : nullptr;
+}
+
+void SessionFile::apply(SynthParameters& params, Synth& synth, Sequencer& sequencer, LoopManager* loops,
+                        std::string& message) const {
+    std::vector<std::string> missing;
+
+    // Parameters over the current values, so fields a shorter block lacks
+    // keep theirs
+    SynthParamBlock block;
+    params.captureBlock(block);
+    uint32_t index = 0;
+    forEachParam(block, [&](auto& field) {
+        if (const uint8_t* data = record(PARAMS, index++)) {
+            uint32_t bits;
+            std::memcpy(&bits, data, sizeof(bits));
+            if constexpr (std::is_same<std::decay_t<decltype(field)>, bool>::value) {
+                field = bits != 0;
+            } else {
+                std::memcpy(&field, &bits, sizeof(field));
+            }
+        }
+    });
+    params.storeBlock(block);
+    params.presetSerial.fetch_add(1, std::memory_order_release);
+    params.publishSnapshot();
+
+    ModulationSlot* slots = synth.getModulationSlots();
+    for (int i = 0; i < kModulationSlotCount; ++i) {
+        if (const uint8_t* data = record(MOD_SLOTS, i)) {
+            slots[i] = readRecord<ModulationSlot>(data, sections[MOD_SLOTS].stride);
+        }
+    }
+
+    // Find every sampler's sample first, so their files are read ahead
+    // together before each is prepared and handed to the audio thread
+    SampleBank& bank = *synth.getSampleBank();
+    int sampleIndices[kSamplerSlots];
+    for (int s = 0; s < kSamplerSlots; ++s) {
+        sampleIndices[s] = -1;
+        const uint8_t* data = record(SAMPLERS, s);
+        if (!data) {
+            continue;
+        }
+        const SamplerRecord sampler = readRecord<SamplerRecord>(data, sections[SAMPLERS].stride);
+        const char* samplePath = string(sampler.path);
+        const char* sampleName = string(sampler.name);
+        struct stat st;
+        if (samplePath && stat(samplePath, &st) == 0) {
+            sampleIndices[s] = bank.loadSingleFile(samplePath);
+        }
+        if (sampleIndices[s] < 0 && sampleName) {
+            sampleIndices[s] = bank.findSampleByName(sampleName);
+        }
+        if (sampleIndices[s] < 0 && samplePath) {
+            missing.push_back(samplePath);
+        }
+    }
+    static_assert(kSamplerSlots == SAMPLERS_PER_VOICE, "one record per sampler");
+    synth.setSamplerSamples(sampleIndices);
+    for (int s = 0; s < kSamplerSlots; ++s) {
+        const uint8_t* data = record(SAMPLERS, s);
+        if (!data) {
+            continue;
+        }
+        const SamplerRecord sampler = readRecord<SamplerRecord>(data, sections[SAMPLERS].stride);
+        for (int f = SessionCapture::SAMPLER_SAMPLE + 1; f < SessionCapture::SAMPLER_FIELD_COUNT; ++f) {
+            SessionCapture::setSamplerField(synth, s, f, sampler.fields[f]);
+        }
+    }
+
+    // Queued generation would land on the loaded tracks
+    sequencer.finishPatternJobs();
+    const uint32_t trackStride = sections[TRACKS].stride;
+    int tracksLoaded = 0;
+    for (int t = 0; t < sequencer.getTrackCount(); ++t) {
+        const uint8_t* data = record(TRACKS, t);
+        if (!data) {
+            break;
+        }
+        const TrackRecord saved = readRecord<TrackRecord>(data, trackStride);
+        Track& track = sequencer.getTrack(t);
+        if (const char* name = string(saved.name)) {
+            track.setName(name);
+        }
+
+        Pattern& pattern = track.getPattern();
+        pattern.setRotation(0);
+        pattern.setLength(saved.length);
+        pattern.setResolution(validSubdivision(saved.resolution) ? static_cast<Subdivision>(saved.resolution)
+                                                                 : Subdivision::SIXTEENTH);
+        for (int i = 0; i < pattern.getLength(); ++i) {
+            const uint8_t* stepData = record(STEPS, saved.firstStep + i);
+            if (!stepData) {
+                break;
+            }
+            const StepRecord step = readRecord<StepRecord>(stepData, sections[STEPS].stride);
+            PatternStep& out = pattern.getStep(i);
+            out.active = step.active != 0;
+            out.locked = step.locked != 0;
+            out.midiNote = std::min<int>(step.midiNote, 127);
+            out.velocity = std::min<int>(step.velocity, 127);
+            out.gateLength = step.gateLength;
+            out.probability = step.probability;
+            out.filterCutoff = step.filterCutoff;
+            out.reverbMix = step.reverbMix;
+            out.brainwaveMorph = step.brainwaveMorph;
+        }
+        pattern.setRotation(pattern.getLength() > 0 ? ((saved.rotation % pattern.getLength()) +
+                                                       pattern.getLength()) % pattern.getLength() : 0);
+
+        MusicalConstraints& constraints = track.getConstraints();
+        std::vector<bool> custom(12);
+        for (int i = 0; i < 12; ++i) {
+            custom[i] = (saved.customScale >> i) & 1u;
+        }
+        constraints.setCustomScale(custom);
+        constraints.setScale(static_cast<Scale>(std::clamp(saved.scale, 0, static_cast<int>(Scale::CUSTOM))));
+        constraints.setRootNote(std::clamp(saved.rootNote, 0, 11));
+        constraints.setOctaveRange(saved.octaveMin, saved.octaveMax);
+        constraints.setDensity(saved.density);
+        constraints.setMaxInterval(saved.maxInterval);
+        constraints.setContour(static_cast<Contour>(std::clamp(saved.contour, 0, static_cast<int>(Contour::DRONE))));
+        constraints.setGravityNote(std::clamp(saved.gravityNote, 0, 127));
+
+        track.getEuclideanPattern() = EuclideanPattern(saved.euclidHits, saved.euclidSteps, saved.euclidRotation);
+        track.setMuted(saved.muted != 0);
+        track.setSolo(saved.solo != 0);
+        sequencer.setTrackPhaseDriver(t, saved.phaseDriver ? Sequencer::PhaseDriver::MODULATION
+                                                           : Sequencer::PhaseDriver::CLOCK);
+
+        // States, then the matrix, as whole words of MARKOV
+        const uint64_t n = saved.markovStates;
+        const Section& words = sections[MARKOV];
+        if (n > 0 && n <= 128 && uint64_t(saved.markovWord) + n + n * n <= words.count) {
+            std::vector<int> notes(n);
+            std::vector<float> matrix(n * n);
+            const uint8_t* base = words.data + size_t(saved.markovWord) * words.stride;
+            for (size_t i = 0; i < n; ++i) {
+                int32_t note;
+                std::memcpy(&note, base + i * words.stride, sizeof(note));
+                notes[i] = note;
+            }
+            for (size_t i = 0; i < n * n; ++i) {
+                std::memcpy(&matrix[i], base + (n + i) * words.stride, sizeof(float));
+            }
+            track.getMarkovChain().assign(notes.data(), static_cast<int>(n), matrix.data(), saved.markovCurrent);
+        }
+        ++tracksLoaded;
+    }
+    sequencer.updatePatterns();
+
+    int loopsLoading = 0;
+    for (int i = 0; loops && i < loops->getLoopCount(); ++i) {
+        const uint8_t* data = record(LOOPS, i);
+        const char* wav = data ? string(readRecord<uint32_t>(data, sections[LOOPS].stride)) : nullptr;
+        if (wav) {
+            loops->loadLoop(i, wav);
+            ++loopsLoading;
+        } else if (Looper* loop = loops->getLoop(i)) {
+            loop->pressClear();
+        }
+    }
+
+    if (const uint8_t* data = record(GLOBALS, 0)) {
+        const GlobalsRecord globals = readRecord<GlobalsRecord>(data, sections[GLOBALS].stride);
+        if (globals.tempo > 0.0) {
+            sequencer.setTempo(globals.tempo);
+        }
+        sequencer.setCurrentTrack(globals.currentTrack);
+    }
+
+    message = "Loaded session " + path + ": " + std::to_string(tracksLoaded) + " tracks";
+    if (loopsLoading > 0) {
+        message += ", " + std::to_string(loopsLoading) + " loop" + (loopsLoading == 1 ? "" : "s") + " loading";
+    }
+    for (const std::string& sample : missing) {
+        message += "; sample not found: " + sample;
+    }
+}
@@ -0,0 +1,146 @@
+#ifndef SESSION_FILE_H
+#define SESSION_FILE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "modulation.h"
+#include "track.h"
+
+struct SynthParameters;
+class Synth;
+class Sequencer;
+class LoopManager;
+
+// A whole performance in one file, so switching songs between sets is one
+// map and a run of stores rather than a preset, four patterns and their
+// Markov chains parsed one by one. Holds:
+//   - the parameter block (every forEachParam field)
+//   - the 16 modulation slots and the four sampler slots' settings
+//   - every sequencer track: pattern steps, Markov states and matrix,
+//     scale constraints, Euclidean rhythm, mute/solo, phase driver
+//   - tempo and the selected track
+//   - references to the audio: each sampler slot's sample by source path
+//     and name (a sample with a .q15 cache blob maps straight from it) and
+//     each loop's WAV
+//
+// Audio stays in its own files: save() writes every loop that holds audio
+// next to the session as <session>.loop<N>.wav on the loop I/O thread, and
+// apply() loads them back the same way (LoopManager::loadLoop).
+//
+// Layout, in host byte order (little-endian on every target):
+//   header    "WFSS", u16 version, u16 section count, u32 file bytes
+//   table     section count × {u32 id, u32 offset, u32 count, u32 stride}
+//   sections  count records of stride bytes each, 8-byte aligned
+// Sections are PARAMS (u32 raw bits per field), MOD_SLOTS, SAMPLERS,
+// TRACKS, STEPS (every track's steps back to back), MARKOV (each track's
+// states as i32, then its matrix as f32), LOOPS, GLOBALS and STRINGS
+// (NUL-terminated paths and names). A newer version may lengthen records;
+// a reader takes the part it knows. open() checks the sections against
+// the file size and apply() reads records from the mapping in place,
+// checking each reference from one section into another.
+class SessionFile {
+public:
+    static constexpr char kMagic[4] = {'W', 'F', 'S', 'S'};
+    static constexpr uint16_t kVersion = 1;
+
+    // ~/.config/wakefield/sessions (created on first use)
+    static std::string getSessionDirectory();
+    // A name in the session directory, or name itself if it holds a '/'
+    static std::string getSessionPath(const std::string& name);
+    // Names of the sessions in the directory, sorted
+    static std::vector<std::string> listSessions();
+
+    // Everything a session file holds, copied out of the engine so it can
+    // be written on another thread while the engine moves on. Capturing is
+    // a parameter block read, the slots and a copy of each track (its
+    // pattern, constraints and Markov chain are held by value); the loops
+    // are only named here, their audio is written by LoopManager::saveLoop
+    struct Snapshot {
+        struct Sampler {
+            bool hasSample = false;
+            std::string path;
+            std::string name;
+            std::vector<float> fields;      // SessionCapture sampler fields
+        };
+
+        std::vector<uint32_t> params;       // Raw bits of each forEachParam field
+        std::vector<ModulationSlot> modSlots;
+        std::vector<Sampler> samplers;
+        std::vector<Track> tracks;
+        std::vector<int> phaseDrivers;      // Sequencer::PhaseDriver per track
+        std::vector<std::string> loops;     // WAV per loop, empty for none
+        double tempo = 0.0;
+        int currentTrack = 0;
+    };
+
+    // UI thread: everything but the loops
+    static void capture(Snapshot& snapshot, const SynthParameters& params, const Synth& synth,
+                        const Sequencer& sequencer);
+    // Any thread: the file's bytes for a snapshot
+    static std::vector<uint8_t> serialize(const Snapshot& snapshot);
+    // Write bytes to path under a temporary name, renamed when complete
+    static bool writeFile(const std::string& path, const std::vector<uint8_t>& bytes,
+                          std::string& message);
+    // Where save() puts loop index's WAV for a session file
+    static std::string getLoopPath(const std::string& sessionPath, int index);
+
+    // Write the current state to path and queue the loop saves: capture(),
+    // serialize() and writeFile() in one go. Not on the audio thread
+    static bool save(const std::string& path, const SynthParameters& params, const Synth& synth,
+                     const Sequencer& sequencer, LoopManager* loops, std::string& message);
+
+    SessionFile() = default;
+    ~SessionFile();
+
+    // Map path and check its layout
+    bool open(const std::string& path, std::string& error);
+    void close();
+
+    // Store the session into the engine, from the UI thread: parameters
+    // (published as a preset switch, so the voices fade over), modulation
+    // and sampler slots, tracks (after waiting for queued pattern jobs),
+    // tempo, and the loops, which load on the loop I/O thread. Samples
+    // missing from the bank are loaded from their paths; message lists
+    // what could not be found
+    void apply(SynthParameters& params, Synth& synth, Sequencer& sequencer, LoopManager* loops,
+               std::string& message) const;
+
+    size_t getBytes() const { return mappedBytes; }
+
+    SessionFile(const SessionFile&) = delete;
+    SessionFile& operator=(const SessionFile&) = delete;
+
+private:
+    struct Section {
+        const uint8_t* data = nullptr;
+        uint32_t count = 0;
+        uint32_t stride = 0;
+    };
+
+    enum SectionId : uint32_t {
+        PARAMS = 1,
+        MOD_SLOTS,
+        SAMPLERS,
+        TRACKS,
+        STEPS,
+        MARKOV,
+        LOOPS,
+        GLOBALS,
+        STRINGS,
+        SECTION_COUNT
+    };
+
+    // Record index of a section, or nullptr past its end
+    const uint8_t* record(SectionId id, uint32_t index) const;
+    // A string in STRINGS, or nullptr for an offset that doesn't name one
+    const char* string(uint32_t offset) const;
+
+    std::string path;
+    uint8_t* mapping = nullptr;
+    size_t mappedBytes = 0;
+    Section sections[SECTION_COUNT];
+};
+
+#endif // SESSION_FILE_H
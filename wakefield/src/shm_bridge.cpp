@@ -0,0 +1,195 @@
+#include "shm_bridge.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <new>
+#include <signal.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+namespace {
+
+constexpr int kReadAttempts = 64;
+
+// Seqlock write: odd while the data changes
+template <typename Fill>
+void seqlockWrite(std::atomic<uint32_t>& sequence, Fill&& fill) {
+    const uint32_t s = sequence.load(std::memory_order_relaxed);
+    sequence.store(s + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    fill();
+    sequence.store(s + 2, std::memory_order_release);
+}
+
+// Seqlock read: copy, then retry if a write began or was under way
+template <typename Copy>
+bool seqlockRead(const std::atomic<uint32_t>& sequence, Copy&& copy) {
+    for (int attempt = 0; attempt < kReadAttempts; ++attempt) {
+        const uint32_t before = sequence.load(std::memory_order_acquire);
+        if (before & 1) {
+            continue;
+        }
+        copy();
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (sequence.load(std::memory_order_relaxed) == before) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool processAlive(int32_t pid) {
+    return pid > 0 && (kill(pid, 0) == 0 || errno != ESRCH);
+}
+
+std::string objectName(const std::string& name) {
+    return name[0] == '/' ? name : "/" + name;
+}
+
+} // namespace
+
+ShmBridge::~ShmBridge() {
+    close();
+}
+
+bool ShmBridge::open(const std::string& name, uint32_t sampleRate, uint32_t bufferFrames, std::string& error) {
+    close();
+    if (name.empty()) {
+        error = "empty segment name";
+        return false;
+    }
+    path = objectName(name);
+    const int fd = shm_open(path.c_str(), O_CREAT | O_RDWR, 0600);
+    if (fd < 0) {
+        error = path + ": " + std::strerror(errno);
+        return false;
+    }
+    if (ftruncate(fd, sizeof(ShmSegment)) != 0) {
+        error = path + ": " + std::strerror(errno);
+        ::close(fd);
+        shm_unlink(path.c_str());
+        return false;
+    }
+    void* memory = mmap(nullptr, sizeof(ShmSegment), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (memory == MAP_FAILED) {
+        error = path + ": " + std::strerror(errno);
+        shm_unlink(path.c_str());
+        return false;
+    }
+
+    // A segment left by an engine that died is started over; UIs still
+    // mapping it see the magic vanish and the heartbeat stop
+    segment = new (memory) ShmSegment();
+    segment->version = ShmSegment::kVersion;
+    segment->segmentBytes = sizeof(ShmSegment);
+    segment->sampleRate = sampleRate;
+    segment->bufferFrames = bufferFrames;
+    std::atomic_thread_fence(std::memory_order_release);
+    std::memcpy(segment->magic, ShmSegment::kMagic, sizeof(segment->magic));
+    return true;
+}
+
+void ShmBridge::close() {
+    if (!segment) {
+        return;
+    }
+    std::memset(segment->magic, 0, sizeof(segment->magic));
+    munmap(segment, sizeof(ShmSegment));
+    shm_unlink(path.c_str());
+    segment = nullptr;
+}
+
+void ShmBridge::publishState(const ShmEngineState& state) {
+    seqlockWrite(segment->stateSequence, [&] { segment->state = state; });
+    segment->heartbeat.fetch_add(1, std::memory_order_release);
+}
+
+void ShmBridge::publishScope(const float* frames, uint32_t count) {
+    count = std::min(count, ShmSegment::kScopeFrames);
+    seqlockWrite(segment->scopeSequence, [&] {
+        std::memcpy(segment->scope, frames, count * sizeof(float));
+        segment->scopeCount = count;
+    });
+}
+
+int ShmBridge::getClientCount() const {
+    int count = 0;
+    for (const ShmSegment::Client& client : segment->clients) {
+        if (processAlive(client.pid.load(std::memory_order_relaxed))) {
+            ++count;
+        }
+    }
+    return count;
+}
+
+ShmBridgeClient::~ShmBridgeClient() {
+    detach();
+}
+
+bool ShmBridgeClient::attach(const std::string& name, std::string& error) {
+    detach();
+    const std::string path = objectName(name);
+    const int fd = shm_open(path.c_str(), O_RDWR, 0);
+    if (fd < 0) {
+        error = path + ": " + std::strerror(errno) + " (is the engine running with --shm?)";
+        return false;
+    }
+    void* memory = mmap(nullptr, sizeof(ShmSegment), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (memory == MAP_FAILED) {
+        error = path + ": " + std::strerror(errno);
+        return false;
+    }
+    segment = static_cast<ShmSegment*>(memory);
+    if (std::memcmp(segment->magic, ShmSegment::kMagic, sizeof(segment->magic)) != 0 ||
+        segment->version != ShmSegment::kVersion || segment->segmentBytes != sizeof(ShmSegment)) {
+        error = path + ": not a segment of this build (version or voice count differs)";
+        detach();
+        return false;
+    }
+
+    // A free slot, or one whose UI died without detaching
+    const int32_t self = static_cast<int32_t>(getpid());
+    for (ShmSegment::Client& slot : segment->clients) {
+        int32_t holder = slot.pid.load(std::memory_order_relaxed);
+        if ((holder == 0 || !processAlive(holder)) &&
+            slot.pid.compare_exchange_strong(holder, self, std::memory_order_acq_rel)) {
+            client = &slot;
+            return true;
+        }
+    }
+    error = "all " + std::to_string(ShmSegment::kMaxClients) + " UI slots are taken";
+    detach();
+    return false;
+}
+
+void ShmBridgeClient::detach() {
+    if (client) {
+        client->pid.store(0, std::memory_order_release);
+        client = nullptr;
+    }
+    if (segment) {
+        munmap(segment, sizeof(ShmSegment));
+        segment = nullptr;
+    }
+}
+
+bool ShmBridgeClient::readState(ShmEngineState& out) const {
+    return seqlockRead(segment->stateSequence, [&] { out = segment->state; });
+}
+
+uint32_t ShmBridgeClient::readScope(float* out, uint32_t capacity) const {
+    uint32_t count = 0;
+    const bool ok = seqlockRead(segment->scopeSequence, [&] {
+        count = std::min(segment->scopeCount, std::min(capacity, ShmSegment::kScopeFrames));
+        std::memcpy(out, segment->scope, count * sizeof(float));
+    });
+    return ok ? count : 0;
+}
+
+bool ShmBridgeClient::send(const ShmCommand& command) {
+    return client && client->commands.push(command);
+}
@@ -0,0 +1,165 @@
+#ifndef SHM_BRIDGE_H
+#define SHM_BRIDGE_H
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include "param_snapshot.h"
+#include "spsc_queue.h"
+
+// Shared-memory link between a headless engine (synth --headless --shm
+// name) and UI processes (synth_remote name), so a UI crash, a stalled
+// terminal or a heavy redraw never reaches the engine process, and
+// several UIs (a local one, one over SSH) can attach at once.
+//
+// The engine's main loop serves the segment, never the audio thread: it
+// publishes the state and the newest scope frames each tick and drains
+// what the UIs sent, applying it the way the in-process UI does. Attached
+// UIs cost the audio thread nothing.
+//
+//   state      seqlock (odd while written): the parameter block the audio
+//              thread was last handed, telemetry, load and transport. Any
+//              number of readers copy it and retry on a torn read
+//   scope      seqlock: the newest first-voice frames from the ScopeRing
+//   clients    kMaxClients slots, each a pid and its own command ring
+//              (one producer per ring); a UI claims a free slot, or one
+//              whose process is gone
+//
+// The segment is a named POSIX shared memory object (/dev/shm/<name>),
+// created by the engine and removed when it stops.
+
+struct ShmCommand {
+    enum class Type : uint8_t {
+        PARAM = 0,      // slot as OscServer: parameter id 0-49, tempo, morph
+        BUTTON,         // slot: OscServer::Command (transport, current loop)
+    };
+    Type type;
+    uint8_t slot;
+    float value;        // PARAM: 0-1 over the range (BPM for tempo)
+};
+
+// What a UI shows, as the engine's main loop last saw it
+struct ShmEngineState {
+    static constexpr int kMaxVoices = 64;
+
+    SynthParamBlock params;
+    uint32_t callbacks = 0;             // Audio callbacks so far
+    int activeVoices = 0;
+    int maxVoices = 0;
+    int8_t voiceNote[kMaxVoices] = {};
+    float voiceEnvelope[kMaxVoices] = {};
+    float lfoValue[4] = {};
+    float chaosX[4] = {};
+    float chaosY[4] = {};
+
+    float loadMean = 0.0f;              // DSP load, 0-1 of the buffer period
+    float loadP99 = 0.0f;
+    float loadPeak = 0.0f;
+    uint64_t overloads = 0;
+    uint64_t xruns = 0;
+    int qualityLevel = 0;               // Steps the quality governor has taken
+
+    bool playing = false;
+    float tempo = 120.0f;
+    int loopState[4] = {};              // Looper::State of each loop
+};
+
+struct ShmSegment {
+    static constexpr char kMagic[4] = {'W', 'F', 'S', 'M'};
+    static constexpr uint32_t kVersion = 1;
+    static constexpr int kMaxClients = 4;
+    static constexpr uint32_t kScopeFrames = 2048;
+
+    struct Client {
+        std::atomic<int32_t> pid{0};    // 0: free
+        SpscQueue<ShmCommand, 256> commands;
+    };
+
+    char magic[4];
+    uint32_t version;
+    uint32_t segmentBytes;              // sizeof(ShmSegment) of the engine's build
+    uint32_t sampleRate;
+    uint32_t bufferFrames;
+    std::atomic<uint32_t> heartbeat{0}; // Bumped each engine tick
+
+    std::atomic<uint32_t> stateSequence{0};
+    ShmEngineState state;
+
+    std::atomic<uint32_t> scopeSequence{0};
+    uint32_t scopeCount = 0;
+    float scope[kScopeFrames] = {};
+
+    Client clients[kMaxClients];
+};
+
+static_assert(std::atomic<uint32_t>::is_always_lock_free && std::atomic<int32_t>::is_always_lock_free &&
+              std::atomic<size_t>::is_always_lock_free,
+              "shared-memory atomics must be lock-free to work across processes");
+
+// Engine side
+class ShmBridge {
+public:
+    ShmBridge() = default;
+    ~ShmBridge();
+
+    // Create (or take over a stale) segment /name and map it
+    bool open(const std::string& name, uint32_t sampleRate, uint32_t bufferFrames, std::string& error);
+    // Unmap and remove the segment
+    void close();
+
+    // Engine main loop, each tick
+    void publishState(const ShmEngineState& state);
+    void publishScope(const float* frames, uint32_t count);
+    template <typename Apply>
+    void drainCommands(Apply&& apply) {
+        ShmCommand command;
+        for (ShmSegment::Client& client : segment->clients) {
+            while (client.commands.pop(command)) {
+                apply(command);
+            }
+        }
+    }
+
+    // Slots a live UI holds
+    int getClientCount() const;
+
+    ShmBridge(const ShmBridge&) = delete;
+    ShmBridge& operator=(const ShmBridge&) = delete;
+
+private:
+    ShmSegment* segment = nullptr;
+    std::string path;
+};
+
+// UI side
+class ShmBridgeClient {
+public:
+    ShmBridgeClient() = default;
+    ~ShmBridgeClient();
+
+    // Map the engine's segment /name and claim a client slot
+    bool attach(const std::string& name, std::string& error);
+    // Release the slot and unmap
+    void detach();
+
+    uint32_t getSampleRate() const { return segment->sampleRate; }
+    uint32_t getBufferFrames() const { return segment->bufferFrames; }
+    uint32_t getHeartbeat() const { return segment->heartbeat.load(std::memory_order_acquire); }
+
+    // Copy the newest state / scope; false if the engine kept writing
+    // through every attempt
+    bool readState(ShmEngineState& out) const;
+    uint32_t readScope(float* out, uint32_t capacity) const;
+
+    // False when the ring is full (the engine is not draining it)
+    bool send(const ShmCommand& command);
+
+    ShmBridgeClient(const ShmBridgeClient&) = delete;
+    ShmBridgeClient& operator=(const ShmBridgeClient&) = delete;
+
+private:
+    ShmSegment* segment = nullptr;
+    ShmSegment::Client* client = nullptr;
+};
+
+#endif // SHM_BRIDGE_H
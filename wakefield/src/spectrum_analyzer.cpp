@@ -0,0 +1,56 @@
+#include "spectrum_analyzer.h"
+#include <algorithm>
+#include <cmath>
+
+SpectrumAnalyzer::SpectrumAnalyzer()
+    : fft(kFFTSize), window(kFFTSize), frames(kFFTSize), re(kBins), im(kBins),
+      binsDb(kBins, kFloorDb) {
+    // Hann window, scaled so a full-scale sine on a bin reads 0 dB (the
+    // window's coherent gain is 1/2, a real sine puts half its energy in
+    // the positive bins)
+    const float scale = 4.0f / kFFTSize;
+    for (int i = 0; i < kFFTSize; ++i) {
+        window[i] = scale * 0.5f * (1.0f - std::cos(2.0f * static_cast<float>(M_PI) * i / kFFTSize));
+    }
+}
+
+bool SpectrumAnalyzer::update(const ScopeRing& ring, float releaseDb) {
+    if (ring.readLatest(frames.data(), kFFTSize) < static_cast<uint32_t>(kFFTSize)) {
+        return false;
+    }
+    for (int i = 0; i < kFFTSize; ++i) {
+        frames[i] *= window[i];
+    }
+    fft.forward(frames.data(), re.data(), im.data());
+
+    // Power to dB as 10 log10, without the sqrt; the floor keeps silence
+    // (and denormals) off the bottom of the scale
+    const float floorPower = std::pow(10.0f, kFloorDb / 10.0f);
+    for (int k = 0; k < kBins; ++k) {
+        const float power = std::max(re[k] * re[k] + im[k] * im[k], floorPower);
+        const float db = 10.0f * std::log10(power);
+        binsDb[k] = std::max(db, binsDb[k] - releaseDb);
+    }
+    return true;
+}
+
+void SpectrumAnalyzer::getBands(float* db, int columns, float minHz, float maxHz,
+                                float sampleRate) const {
+    const float binsPerHz = kFFTSize / sampleRate;
+    const float ratio = std::log(maxHz / minHz) / columns;
+    for (int c = 0; c < columns; ++c) {
+        const float low = minHz * std::exp(ratio * c) * binsPerHz;
+        const float high = minHz * std::exp(ratio * (c + 1)) * binsPerHz;
+        const int first = static_cast<int>(std::ceil(low));
+        const int last = std::min(static_cast<int>(std::floor(high)), kBins - 1);
+
+        if (first <= last) {
+            db[c] = *std::max_element(binsDb.begin() + first, binsDb.begin() + last + 1);
+        } else {
+            const float centre = std::sqrt(low * high);
+            const int bin = std::min(static_cast<int>(centre), kBins - 2);
+            const float t = centre - bin;
+            db[c] = binsDb[bin] + t * (binsDb[bin + 1] - binsDb[bin]);
+        }
+    }
+}
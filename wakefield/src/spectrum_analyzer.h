@@ -0,0 +1,42 @@
+#ifndef SPECTRUM_ANALYZER_H
+#define SPECTRUM_ANALYZER_H
+
+#include <vector>
+#include "scope_ring.h"
+#include "../../shared/dsp/real_fft.h"
+
+// Power spectrum of the newest kFFTSize frames of a ScopeRing, for the UI's
+// SPECTRUM page. Runs entirely on the UI thread: the audio thread's share
+// is the block copy into the ring. Each update reads the ring, applies a
+// Hann window, takes a RealFFT and converts the bins to dB relative to a
+// full-scale sine, with an instant attack and a falling release so the
+// display does not flicker at the frame rate.
+class SpectrumAnalyzer {
+public:
+    static constexpr int kFFTSize = 4096;               // ~11.7 Hz bins at 48 kHz
+    static constexpr int kBins = kFFTSize / 2 + 1;
+    static constexpr float kFloorDb = -120.0f;
+
+    SpectrumAnalyzer();
+
+    // Analyze the ring's newest frames. False (the last spectrum kept) if
+    // the ring does not hold kFFTSize frames yet
+    bool update(const ScopeRing& ring, float releaseDb);
+
+    // Level of each of columns log-spaced bands between minHz and maxHz, in
+    // dB: the loudest bin in a band, or the level interpolated at the
+    // band's centre where bands are narrower than a bin
+    void getBands(float* db, int columns, float minHz, float maxHz, float sampleRate) const;
+
+    const std::vector<float>& getBinsDb() const { return binsDb; }
+
+private:
+    kernels::RealFFT fft;
+    std::vector<float> window;
+    std::vector<float> frames;
+    std::vector<float> re;
+    std::vector<float> im;
+    std::vector<float> binsDb;          // Smoothed
+};
+
+#endif // SPECTRUM_ANALYZER_H
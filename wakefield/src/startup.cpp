@@ -0,0 +1,81 @@
+#include "startup.h"
+#include <cstdio>
+
+void StartupTimeline::mark(const char* phase) {
+    const Clock::time_point now = Clock::now();
+    phases.push_back({phase, std::chrono::duration<double, std::milli>(now - last).count(),
+                      std::chrono::duration<double, std::milli>(now - start).count(), false});
+    last = now;
+}
+
+void StartupTimeline::markBackground(const char* phase, double seconds) {
+    phases.push_back({phase, seconds * 1000.0, elapsedMs(), true});
+}
+
+double StartupTimeline::elapsedMs() const {
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+std::string StartupTimeline::report(const char* firstSound) const {
+    std::string text;
+    double soundMs = -1.0;
+    char item[96];
+    for (const Phase& phase : phases) {
+        std::snprintf(item, sizeof(item), "%s%s %.0f ms%s", text.empty() ? "" : ", ", phase.name.c_str(),
+                      phase.ms, phase.background ? " (background)" : "");
+        text += item;
+        if (firstSound && phase.name == firstSound) {
+            soundMs = phase.endMs;
+        }
+    }
+    if (soundMs >= 0.0) {
+        std::snprintf(item, sizeof(item), "; first sound at %.0f ms", soundMs);
+        text += item;
+    }
+    return text;
+}
+
+BackgroundSampleLoad::~BackgroundSampleLoad() {
+    finish();
+}
+
+void BackgroundSampleLoad::start(SampleBank& target, const std::string& directory) {
+    finish();
+    bank = &target;
+    done.store(false, std::memory_order_relaxed);
+    thread = std::thread([this, directory] {
+        const auto begin = std::chrono::steady_clock::now();
+        load = bank->parseDirectory(directory.c_str());
+        seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+        done.store(true, std::memory_order_release);
+    });
+}
+
+bool BackgroundSampleLoad::poll(int& loaded, std::string& summary) {
+    if (!thread.joinable() || !done.load(std::memory_order_acquire)) {
+        return false;
+    }
+    thread.join();
+    adopt(loaded, summary);
+    return true;
+}
+
+void BackgroundSampleLoad::finish() {
+    if (thread.joinable()) {
+        thread.join();
+        int loaded;
+        std::string summary;
+        adopt(loaded, summary);
+    }
+}
+
+void BackgroundSampleLoad::adopt(int& loaded, std::string& summary) {
+    if (!load.opened) {
+        loaded = 0;
+        summary = "Failed to open samples directory: " + load.directory;
+    } else {
+        loaded = bank->adoptDirectory(load, false);
+        summary = load.summary;
+    }
+    load = SampleBank::DirectoryLoad();
+}
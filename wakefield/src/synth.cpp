@@ -1,74 +1,157 @@
 #include "synth.h"
 #include "clock.h"
+#include "fastmath.h"
 #include "ui.h"
+#include "profile.h"
 #include <algorithm>
+#include <cstddef>
+#include <type_traits>
 #include <iostream>
 
+size_t Synth::arenaBytes(float sampleRate) {
+    return DspArena::round(static_cast<size_t>(kModBuffers) * kModBufferFrames * sizeof(float))
+         + DspArena::round(MAX_VOICES * sizeof(Voice))
+         + DspArena::round(static_cast<size_t>(MAX_VOICES) * kVoiceBufferFrames * sizeof(float))
+         + reverbArenaBytes(sampleRate);
+}
+
+size_t Synth::reverbArenaBytes(float sampleRate) {
+    return GreyholeReverb::arenaBytes(GreyholeReverb::defaultVariant()) + LateDiffReverb::arenaBytes(sampleRate);
+}
+
 Synth::Synth(float sampleRate)
     : sampleRate(sampleRate)
     , masterVolume(0.5f)
-    , reverbEnabled(false)
-    , filterEnabled(false)
     , currentFilterType(0)
-    , ui(nullptr)
     , params(nullptr)
     , clock(nullptr)
-    , reverb(sampleRate)
-    , filterL(sampleRate)
-    , filterR(sampleRate) {
+    , arena(arenaBytes(sampleRate))
+    , modSourceBuffers(arena.takeArray<float>(static_cast<size_t>(kModBuffers) * kModBufferFrames))
+    , voices(arena.createArray<Voice>(MAX_VOICES, sampleRate))
+    , envelopeParams(sampleRate)
+    , voiceBuffers(arena.takeArray<float>(static_cast<size_t>(MAX_VOICES) * kVoiceBufferFrames))
+    , reverb(sampleRate, GreyholeReverb::defaultVariant(), &arena)
+    , lateDiffReverb(sampleRate, &arena)
+    , convolutionReverb(sampleRate)
+    , filter(sampleRate)
+    , ladderFilter(sampleRate) {
     
-    // Initialize shelf filters
-    highShelfL.setSampleRate(sampleRate);
-    highShelfR.setSampleRate(sampleRate);
-    lowShelfL.setSampleRate(sampleRate);
-    lowShelfR.setSampleRate(sampleRate);
+    reverbMemory.set(reverbArenaBytes(sampleRate));
+    voiceMemory.set(arena.getCapacity() - reverbArenaBytes(sampleRate));
+    scopeMemory.set(sizeof(scope) + sizeof(spectrumInput) + sizeof(spectrumOutput));
 
-    ladderFilterL.setSampleRate(sampleRate);
-    ladderFilterR.setSampleRate(sampleRate);
+    // Initialize shelf filters
+    highShelf.setSampleRate(sampleRate);
+    lowShelf.setSampleRate(sampleRate);
     
-    // Initialize voices with sample rate
-    for (int i = 0; i < MAX_VOICES; ++i) {
-        voices.emplace_back(sampleRate);
+    // Voices are constructed in place in the arena and never relocated: a
+    // Sampler points into itself (primaryVoice/secondaryVoice)
+    for (auto& voice : voices) {
+        voice.synth = this;     // Levels and gates; set here so an engine without SynthParameters sounds
+        voice.envelope.setShared(&envelopeParams);
+    }
+    for (auto& bank : voiceFilters) {
+        bank.setSampleRate(sampleRate);
     }
 
     for (int i = 0; i < SAMPLERS_PER_VOICE; ++i) {
+        for (auto& voice : voices) {
+            voice.samplers[i].setConfig(&samplerConfigs[i]);
+        }
+        freeSamplers[i].setConfig(&samplerConfigs[i]);
         freeSamplers[i].setKeyMode(false);
     }
 
     // Initialize chaos generators with sample rate
+    chaos.setSampleRate(sampleRate);
+
+    // Default modulation routing: ENV 1 -> OSC 1-4 Amp (slots 0-3), for
+    // amplitude envelopes separate from the mix levels, and ENV 1 -> SAMP
+    // 1-4 Amp (slots 4-7) for the samplers in KEY mode. The sampler slots
+    // are bidirectional so the envelope's 0-1 maps to levelMod 0-1
     for (int i = 0; i < 4; ++i) {
-        chaos[i].setSampleRate(sampleRate);
+        modulationSlots[i].source = 4;              // ENV 1
+        modulationSlots[i].curve = 0;               // Linear
+        modulationSlots[i].amount = 100;
+        modulationSlots[i].destination = i * 6 + 5;     // OSC (i+1) Amp: 5, 11, 17, 23
+        modulationSlots[i].type = 0;                // Unidirectional
+
+        modulationSlots[4 + i].source = 4;
+        modulationSlots[4 + i].curve = 0;
+        modulationSlots[4 + i].amount = 100;
+        modulationSlots[4 + i].destination = 32 + i * 5;    // SAMP (i+1) Amp: 32, 37, 42, 47
+        modulationSlots[4 + i].type = 1;            // Bidirectional
     }
 }
 
+Synth::~Synth() {
+    DspArena::destroy(voices);
+}
+
 float Synth::midiNoteToFrequency(int midiNote) {
     // MIDI note 69 = A4 = 440 Hz
     // Formula: f = 440 * 2^((n-69)/12)
     return 440.0f * std::pow(2.0f, (midiNote - 69) / 12.0f);
 }
 
-int Synth::findFreeVoice() {
-    // Find first inactive voice
-    for (int i = 0; i < MAX_VOICES; ++i) {
-        if (!voices[i].active) {
-            return i;
+int Synth::findFreeVoice() const {
+    // Lowest inactive voice
+    const uint64_t free = ~activeVoiceMask & voiceLimitMask;
+    return free ? __builtin_ctzll(free) : -1;
+}
+
+int Synth::findVoiceToSteal() const {
+    // Quietest voice already in release, else the oldest held note; a voice
+    // fading out for an earlier steal only when nothing else is left (its
+    // waiting note is then replaced)
+    int best = -1;
+    int bestRank = 0;
+    for (uint64_t active = activeVoiceMask & voiceLimitMask; active; active &= active - 1) {
+        const int v = __builtin_ctzll(active);
+        const bool stealing = (stealingVoiceMask >> v) & 1;
+        const bool releasing = voices[v].envelope.getStage() == EnvelopeStage::RELEASE;
+        const int rank = stealing ? 2 : releasing ? 0 : 1;
+        bool better = best < 0 || rank < bestRank;
+        if (!better && rank == bestRank) {
+            better = rank == 0
+                ? voices[v].getEnvelopeValue() < voices[best].getEnvelopeValue()
+                : static_cast<int32_t>(voiceStartOrder[v] - voiceStartOrder[best]) < 0;
+        }
+        if (better) {
+            best = v;
+            bestRank = rank;
         }
     }
-    
-    // No free voice found
-    return -1;
+    return best;
 }
 
-void Synth::updateEnvelopeParameters(float attack, float decay, float sustain, float release) {
-    // Update all voice envelopes with new parameters
-    for (auto& voice : voices) {
-        voice.envelope.setAttack(attack);
-        voice.envelope.setDecay(decay);
-        voice.envelope.setSustain(sustain);
-        voice.envelope.setRelease(release);
+void Synth::syncVoiceAllocation() {
+    for (uint64_t active = activeVoiceMask; active; active &= active - 1) {
+        const int v = __builtin_ctzll(active);
+        if (voices[v].active) {
+            continue;
+        }
+        const uint64_t bit = 1ull << v;
+        activeVoiceMask &= ~bit;
+
+        // A stolen voice has faded out: its waiting note starts now
+        if (stealingVoiceMask & bit) {
+            stealingVoiceMask &= ~bit;
+            const PendingNote pending = pendingNotes[v];
+            pendingNotes[v] = PendingNote{};
+            startVoice(v, pending.note, pending.velocity);
+            if (pending.released) {
+                voices[v].envelope.noteOff();
+            }
+        }
     }
 }
 
+void Synth::updateEnvelopeParameters(float attack, float decay, float sustain, float release) {
+    // Recomputes the rates only when a value changed; voices compare versions
+    envelopeParams.set(attack, decay, sustain, release);
+}
+
 void Synth::setOscillatorState(int index, BrainwaveMode mode, int shape,
                                float baseFreq, float morph, float duty,
                                float ratio, float offsetHz, float amp, float level) {
@@ -98,56 +181,125 @@ void Synth::setOscillatorState(int index, BrainwaveMode mode, int shape,
 
 void Synth::updateReverbParameters(float delayTime, float size, float damping, float mix, float decay,
                                    float diffusion, float modDepth, float modFreq) {
-    reverb.setDelayTime(delayTime);
-    reverb.setSize(size);
-    reverb.setDamping(damping);
-    reverb.setMix(mix);
-    reverb.setDecay(decay);
-    reverb.setDiffusion(diffusion);
-    reverb.setModDepth(modDepth);
-    reverb.setModFreq(modFreq);
+    effectSettings.reverbParams = {delayTime, size, damping, mix, decay, diffusion, modDepth, modFreq};
+    effectSettings.reverbChanged = true;
 }
 
 void Synth::updateFilterParameters(int type, float cutoff, float gain,
                                    float resonance, float drive, float feedbackHP) {
-    currentFilterType = type;
-    
-    // Update all filter types (the active one will be used during processing)
-    filterL.setCutoff(cutoff);
-    filterR.setCutoff(cutoff);
-    
-    highShelfL.setCutoff(cutoff);
-    highShelfR.setCutoff(cutoff);
-    highShelfL.setGainDb(gain);
-    highShelfR.setGainDb(gain);
-    
-    lowShelfL.setCutoff(cutoff);
-    lowShelfR.setCutoff(cutoff);
-    lowShelfL.setGainDb(gain);
-    lowShelfR.setGainDb(gain);
+    effectSettings.filterType = type;
+    effectSettings.filterCutoff = cutoff;
+    effectSettings.filterGain = gain;
+    effectSettings.filterResonance = resonance;
+    effectSettings.filterDrive = drive;
+    effectSettings.filterFeedbackHP = feedbackHP;
+    effectSettings.filterChanged = true;
+}
+
+void Synth::setFilterPerVoice(bool perVoice, float envAmount) {
+    effectSettings.filterPerVoice = perVoice;
+    effectSettings.filterEnvAmount = envAmount;
+}
+
+void Synth::setVoiceLimit(int count) {
+    count = std::clamp(count, 1, MAX_VOICES);
+    voiceLimitMask = ~0ull >> (64 - count);
+}
 
-    ladderFilterL.setCutoff(cutoff);
-    ladderFilterR.setCutoff(cutoff);
-    ladderFilterL.setResonance(resonance);
-    ladderFilterR.setResonance(resonance);
-    ladderFilterL.setDrive(drive);
-    ladderFilterR.setDrive(drive);
-    ladderFilterL.setFeedbackHighpass(feedbackHP);
-    ladderFilterR.setFeedbackHighpass(feedbackHP);
+void Synth::setOversampling(int filterFactor, int fmFactor, OversampleQuality quality) {
+    if (filterFactor != effectSettings.filterOversample || quality != effectSettings.oversampleQuality) {
+        effectSettings.filterOversample = filterFactor;
+        effectSettings.oversampleQuality = quality;
+        effectSettings.filterChanged = true;
+    }
+    fmOversample = fmFactor;
+    oversampleQuality = quality;
+}
+
+Synth::EffectSettings Synth::takeEffectSettings() {
+    EffectSettings taken = effectSettings;
+    effectSettings.filterChanged = false;
+    effectSettings.reverbChanged = false;
+    return taken;
+}
+
+void Synth::applyEffectSettings(const EffectSettings& settings) {
+    if (settings.reverbChanged) {
+        reverb.setParameters(settings.reverbParams);
+        lateDiffReverb.setParameters(settings.reverbParams);
+        convolutionReverb.setParameters(settings.reverbParams);
+    }
+    // No-ops unless the mode changed
+    reverb.setHalfRate(settings.reverbHalfRate);
+    lateDiffReverb.setHalfRate(settings.reverbHalfRate);
+    if (settings.reverbType != currentReverbType) {
+        // Start the incoming engine empty rather than from the tail it was
+        // holding when it was last switched away
+        const bool wasGreyhole = currentReverbType != static_cast<int>(ReverbType::LATEDIFF) &&
+                                 currentReverbType != static_cast<int>(ReverbType::CONVOLUTION);
+        if (settings.reverbType == static_cast<int>(ReverbType::LATEDIFF)) {
+            lateDiffReverb.clear();
+        } else if (settings.reverbType == static_cast<int>(ReverbType::CONVOLUTION)) {
+            convolutionReverb.clear();
+        } else if (!wasGreyhole) {
+            reverb.clear();
+        }
+        currentReverbType = settings.reverbType;
+    }
+    if (!settings.filterChanged) {
+        return;
+    }
+
+    if (settings.filterType != currentFilterType) {
+        mixFilterRunning = false;   // The new filter starts at the cutoff, not its old one
+    }
+    currentFilterType = settings.filterType;
+    const float cutoff = settings.filterCutoff;
+
+    // Update all filter types (the active one will be used during
+    // processing). Lowpass, highpass and the shelves glide to the cutoff
+    // across the block, so they only take the target here; the filters skip
+    // the coefficient update when nothing changed
+    currentFilterCutoff = cutoff;
+
+    highShelf.setGainDb(settings.filterGain);
+    lowShelf.setGainDb(settings.filterGain);
+
+    if (settings.filterOversample != ladderOversampler.factor() ||
+        settings.oversampleQuality != ladderOversampler.quality()) {
+        ladderOversampler.configure(settings.filterOversample, settings.oversampleQuality);
+        ladderFilter.setSampleRate(sampleRate * static_cast<float>(ladderOversampler.factor()));
+    }
+    ladderFilter.setCutoff(cutoff);
+    ladderFilter.setResonance(settings.filterResonance);
+    ladderFilter.setDrive(settings.filterDrive);
+    ladderFilter.setFeedbackHighpass(settings.filterFeedbackHP);
 }
 
 void Synth::noteOn(int midiNote, int velocity) {
-    // Find a free voice
+    lfos.noteOn();
     int voiceIndex = findFreeVoice();
-
-    if (voiceIndex == -1) {
-        // No free voices - drop the note for now
+    if (voiceIndex >= 0) {
+        startVoice(voiceIndex, midiNote, velocity);
         return;
     }
 
-    // Activate the voice
+    // Every voice is busy: steal one and start the note once it has faded
+    voiceIndex = findVoiceToSteal();
+    const uint64_t bit = 1ull << voiceIndex;
+    if (!(stealingVoiceMask & bit)) {
+        voices[voiceIndex].envelope.fastRelease(kStealReleaseSeconds);
+        stealingVoiceMask |= bit;
+    }
+    pendingNotes[voiceIndex] = PendingNote{midiNote, velocity, false};
+    voiceStartOrder[voiceIndex] = ++noteOnCounter;
+}
+
+void Synth::startVoice(int voiceIndex, int midiNote, int velocity) {
     Voice& voice = voices[voiceIndex];
     voice.active = true;
+    activeVoiceMask |= 1ull << voiceIndex;
+    voiceStartOrder[voiceIndex] = ++noteOnCounter;
     voice.note = midiNote;
     voice.velocity = velocity;
 
@@ -189,22 +341,22 @@ void Synth::noteOn(int midiNote, int velocity) {
 }
 
 void Synth::noteOff(int midiNote) {
-    // Find all voices playing this note and trigger their release
-    for (int i = 0; i < MAX_VOICES; ++i) {
-        if (voices[i].active && voices[i].note == midiNote) {
+    // Release every voice playing this note; a stolen voice keeps its fast
+    // fade, and a note still waiting for one is released as soon as it starts
+    for (uint64_t active = activeVoiceMask; active; active &= active - 1) {
+        const int i = __builtin_ctzll(active);
+        const bool stealing = (stealingVoiceMask >> i) & 1;
+        if (voices[i].note == midiNote && !stealing) {
             voices[i].envelope.noteOff();  // Trigger release
         }
+        if (stealing && pendingNotes[i].note == midiNote) {
+            pendingNotes[i].released = true;
+        }
     }
 }
 
 int Synth::getActiveVoiceCount() const {
-    int count = 0;
-    for (int i = 0; i < MAX_VOICES; ++i) {
-        if (voices[i].active) {
-            count++;
-        }
-    }
-    return count;
+    return __builtin_popcountll(activeVoiceMask);
 }
 
 bool Synth::isVoiceActive(int voiceIndex) const {
@@ -228,27 +380,415 @@ int Synth::getVoiceNote(int voiceIndex) const {
     return voices[voiceIndex].note;
 }
 
-void Synth::process(float* output, unsigned int nFrames, unsigned int nChannels) {
-    // Clear the output buffer first
-    for (unsigned int i = 0; i < nFrames * nChannels; ++i) {
-        output[i] = 0.0f;
+void Synth::publishTelemetry() {
+    // Every field is written: the back slot holds a snapshot from two
+    // publishes ago
+    SynthTelemetry& t = telemetry.back();
+    t.callbacks = ++telemetryCallbacks;
+    t.activeVoices = 0;
+    for (int v = 0; v < MAX_VOICES; ++v) {
+        t.voiceActive[v] = voices[v].active;
+        t.voiceNote[v] = voices[v].note;
+        t.voiceEnvelope[v] = voices[v].getEnvelopeValue();
+        t.activeVoices += voices[v].active ? 1 : 0;
+    }
+    for (int i = 0; i < 4; ++i) {
+        t.lfoValue[i] = lfos[i].getCurrentValue();
+        t.lfoPhase[i] = lfos[i].getPhase();
+        t.chaosX[i] = chaos.getX(i);
+        t.chaosY[i] = chaos.getY(i);
     }
+    telemetry.publish();
+}
 
-    // Process modulation matrix once per buffer for global (voice-agnostic) targets
-    ModulationOutputs globalModOutputs = processModulationMatrix();
-    lastGlobalModOutputs = globalModOutputs;
+void Synth::refreshBufferState() {
+    bool oscMuted[OSCILLATORS_PER_VOICE] = {};
+    bool oscSolo[OSCILLATORS_PER_VOICE] = {};
+    bool samplerMuted[SAMPLERS_PER_VOICE] = {};
+    bool samplerSolo[SAMPLERS_PER_VOICE] = {};
+
+    if (paramBlock) {
+        fmRoutes.snapshot(paramBlock->fmMatrix);
+        for (int i = 0; i < 4; ++i) {
+            oscMuted[i] = paramBlock->oscMuted[i];
+            oscSolo[i] = paramBlock->oscSolo[i];
+            samplerMuted[i] = paramBlock->samplerMuted[i];
+            samplerSolo[i] = paramBlock->samplerSolo[i];
+        }
+    } else if (params) {
+        float depths[FM_NODES][FM_NODES];
+        for (int target = 0; target < FM_NODES; ++target) {
+            for (int source = 0; source < FM_NODES; ++source) {
+                depths[target][source] = params->getFMDepth(target, source);
+            }
+        }
+        fmRoutes.snapshot(depths);
+        for (int i = 0; i < 4; ++i) {
+            oscMuted[i] = params->oscMuted[i].load();
+            oscSolo[i] = params->oscSolo[i].load();
+            samplerMuted[i] = params->samplerMuted[i].load();
+            samplerSolo[i] = params->samplerSolo[i].load();
+        }
+    } else {
+        fmRoutes.count = 0;
+    }
+
+    // If any channel is solo'd only solo'd channels play, otherwise mutes apply
+    bool anySolo = false;
+    for (int i = 0; i < 4; ++i) {
+        anySolo = anySolo || oscSolo[i] || samplerSolo[i];
+    }
+    for (int i = 0; i < OSCILLATORS_PER_VOICE; ++i) {
+        oscGates[i] = (anySolo ? oscSolo[i] : !oscMuted[i]) ? 1.0f : 0.0f;
+    }
+    for (int i = 0; i < SAMPLERS_PER_VOICE; ++i) {
+        samplerGates[i] = (anySolo ? samplerSolo[i] : !samplerMuted[i]) ? 1.0f : 0.0f;
+    }
+}
+
+void Synth::process(float* left, float* right, unsigned int nFrames) {
+    renderVoices(left, right, nFrames);
+    processEffects(left, right, nFrames, takeEffectSettings());
+}
+
+void Synth::warmUp(unsigned int nFrames, int blocks) {
+    if (nFrames == 0 || blocks <= 0) {
+        return;
+    }
+    std::vector<float> left(nFrames);
+    std::vector<float> right(nFrames);
+    const EffectSettings saved = effectSettings;
+
+    // Every filter type, mix and per voice, under each reverb engine (the
+    // Greyhole types share one)
+    static constexpr int kFilterTypes = 5;
+    static constexpr int kReverbEngines[] = {static_cast<int>(ReverbType::GREYHOLE),
+                                             static_cast<int>(ReverbType::LATEDIFF),
+                                             static_cast<int>(ReverbType::CONVOLUTION)};
+    for (int block = 0; block < blocks; ++block) {
+        if (block == blocks / 2) {
+            for (int n = 0; n < __builtin_popcountll(voiceLimitMask); ++n) {
+                noteOn(48 + n % 24, 100);
+            }
+        }
+        effectSettings.filterEnabled = true;
+        effectSettings.filterType = block % kFilterTypes;
+        effectSettings.filterPerVoice = (block / kFilterTypes) % 2 != 0;
+        effectSettings.reverbEnabled = true;
+        effectSettings.reverbType = kReverbEngines[(block / (2 * kFilterTypes)) % 3];
+        effectSettings.filterChanged = true;     // The type only switches with the coefficients
+        process(left.data(), right.data(), nFrames);
+    }
+
+    // Fade the voices out the way a stolen voice goes; they clear their
+    // own flags when silent
+    for (uint64_t active = activeVoiceMask; active; active &= active - 1) {
+        voices[__builtin_ctzll(active)].envelope.fastRelease(kStealReleaseSeconds);
+    }
+    effectSettings.filterEnabled = false;
+    effectSettings.reverbEnabled = false;
+    for (int block = 0; block < blocks && activeVoiceMask; ++block) {
+        process(left.data(), right.data(), nFrames);
+    }
+
+    // Back to a cold start's state, with the real filter settings applied
+    // at the first live block (the reverb parameters never changed)
+    filter.reset();
+    highShelf.reset();
+    lowShelf.reset();
+    ladderFilter.reset();
+    ladderOversampler.reset();
+    for (auto& bank : voiceFilters) {
+        bank.reset();
+    }
+    voiceFiltersRunning = false;
+    mixFilterRunning = false;
+    std::fill(std::begin(voiceFilterTail), std::end(voiceFilterTail), 0);
+    reverb.clear();
+    lateDiffReverb.clear();
+    convolutionReverb.clear();
+    std::fill(std::begin(voiceStartOrder), std::end(voiceStartOrder), 0u);
+    noteOnCounter = 0;
+    effectSettings = saved;
+    effectSettings.filterChanged = true;
+}
+
+void Synth::renderVoiceTask(void* context, int task) {
+    VoiceRenderJob& job = *static_cast<VoiceRenderJob*>(context);
+    Synth& synth = *job.synth;
+    const int index = job.tasks[task];
+    const int first = job.useBank ? index * VoiceBank::kLanes : index;
+    const int count = job.useBank ? std::min(VoiceBank::kLanes, MAX_VOICES - first) : 1;
+
+    // Same VOICE_BLOCK_SIZE chunks as a single-threaded render
+    for (unsigned int start = 0; start < job.frames; start += VOICE_BLOCK_SIZE) {
+        const int chunk = static_cast<int>(std::min<unsigned int>(job.frames - start, VOICE_BLOCK_SIZE));
+        if (job.useBank) {
+            synth.voiceBanks[index].render(&synth.voices[first], count, synth.sampleRate, chunk);
+        }
+
+        for (int v = first; v < first + count; ++v) {
+            if (!job.wasActive[v]) {
+                continue;
+            }
+
+            Voice& voice = synth.voices[v];
+            float* out = synth.voiceBuffers + v * kVoiceBufferFrames + start;
+            job.chunkEnvelope[v][start / VOICE_BLOCK_SIZE] = voice.getEnvelopeValue();
+            job.voiceTimers[v].begin();
+            if (job.useBank) {
+                Voice::ExternalOscBlock oscBlock = synth.voiceBanks[index].blockForVoice(v - first);
+                voice.renderBlock(out, chunk, &oscBlock);
+            } else {
+                voice.renderBlock(out, chunk);
+            }
+            job.voiceTimers[v].end();
+
+            if (!voice.active && job.endFrame[v] < 0) {
+                job.endFrame[v] = static_cast<int>(job.base + start);
+            }
+        }
+    }
+}
+
+void Synth::filterVoices(const VoiceRenderJob& job) {
+    const EffectSettings& settings = effectSettings;
+    if (!settings.filtersVoices()) {
+        voiceFiltersRunning = false;
+        return;
+    }
+
+    profile::ScopedTimer filterTimer(profile::FILTER);
+    const VoiceFilterBank::Mode mode = settings.filterType == 4 ? VoiceFilterBank::Mode::Ladder
+        : settings.filterType == 1 ? VoiceFilterBank::Mode::Highpass
+        : VoiceFilterBank::Mode::Lowpass;
+    for (auto& bank : voiceFilters) {
+        if (!voiceFiltersRunning) {
+            bank.reset();   // Nothing left over from the last time the mode was on
+        }
+        bank.setMode(mode);
+        bank.setResonance(settings.filterResonance);
+        bank.setDrive(settings.filterDrive);
+        bank.setFeedbackHighpass(settings.filterFeedbackHP);
+    }
+    voiceFiltersRunning = true;
+
+    // Each voice's cutoff follows its envelope at chunk rate; a ringing
+    // voice keeps its last cutoff and filters silence
+    for (int g = 0; g < kVoiceGroups; ++g) {
+        const int first = g * VoiceFilterBank::kLanes;
+        const int count = std::min(VoiceFilterBank::kLanes, MAX_VOICES - first);
+        bool live[VoiceFilterBank::kLanes];
+        bool any = false;
+        for (int l = 0; l < count; ++l) {
+            live[l] = job.wasActive[first + l] || job.ringing[first + l];
+            any = any || live[l];
+            if (job.ringing[first + l]) {
+                float* out = voiceBuffers + (first + l) * kVoiceBufferFrames;
+                std::fill(out, out + job.frames, 0.0f);
+            }
+        }
+        if (!any) {
+            continue;
+        }
+        for (unsigned int start = 0; start < job.frames; start += VOICE_BLOCK_SIZE) {
+            const int chunk = static_cast<int>(std::min<unsigned int>(job.frames - start, VOICE_BLOCK_SIZE));
+            for (int l = 0; l < count; ++l) {
+                if (!job.wasActive[first + l]) {
+                    continue;
+                }
+                const float env = job.chunkEnvelope[first + l][start / VOICE_BLOCK_SIZE];
+                voiceFilters[g].setCutoff(l, settings.filterCutoff * fastmath::exp2(settings.filterEnvAmount * env));
+            }
+            voiceFilters[g].process(voiceBuffers + first * kVoiceBufferFrames + start,
+                                    kVoiceBufferFrames, count, live, chunk);
+        }
+    }
+}
+
+void Synth::renderVoices(float* left, float* right, unsigned int nFrames) {
+    // Voices and free samplers are mono: mix them into the left plane, then
+    // copy it to the right plane ahead of the stereo stages
+    std::fill(left, left + nFrames, 0.0f);
+
+    // One coherent view of FM routing and mute/solo for every voice in this buffer
+    refreshBufferState();
+    applySampleSwaps();
+
+    // The compiled program and the sampler phase drivers hold for the whole call
+    profile::Accumulator modTimer;
+    modTimer.begin();
+    refreshModulationProgram();
     refreshSamplerPhaseDrivers();
-    float masterGain = std::clamp(masterVolume + lastGlobalModOutputs.mixerMasterVolume, 0.0f, 1.0f);
+    modTimer.end();
+
+    // Render each active voice into its own buffer, then mix in voice order
+    VoiceRenderJob& job = renderJob;
+    job.synth = this;
+    job.useBank = voiceBankEnabled && fmRoutes.empty();
+    int activeVoices = 0;
+    const bool voiceFiltering = effectSettings.filtersVoices();
+    const int filterTail = static_cast<int>(kVoiceFilterTailSeconds * sampleRate);
+    for (int v = 0; v < MAX_VOICES; ++v) {
+        job.wasActive[v] = (activeVoiceMask >> v) & 1;
+        job.endFrame[v] = -1;
+        activeVoices += job.wasActive[v] ? 1 : 0;
+
+        // The voice stops at full level, so its filter rings out for a while
+        job.ringing[v] = voiceFiltering && !job.wasActive[v] && voiceFilterTail[v] > 0;
+        if (!voiceFiltering) {
+            voiceFilterTail[v] = 0;
+        } else if (job.wasActive[v]) {
+            voiceFilterTail[v] = filterTail;
+        } else {
+            voiceFilterTail[v] = std::max(0, voiceFilterTail[v] - static_cast<int>(nFrames));
+        }
+    }
 
-    // Copy modulation values to active voices (re-evaluated per voice for voice-specific sources)
+    // A task is one voice, or one bank group so its SoA oscillators render together
+    job.taskCount = 0;
+    if (job.useBank) {
+        for (int g = 0; g < kVoiceGroups; ++g) {
+            const int first = g * VoiceBank::kLanes;
+            const int last = std::min(first + VoiceBank::kLanes, MAX_VOICES);
+            if (std::find(job.wasActive + first, job.wasActive + last, true) != job.wasActive + last) {
+                job.tasks[job.taskCount++] = g;
+            }
+        }
+    } else {
+        for (uint64_t active = activeVoiceMask; active; active &= active - 1) {
+            job.tasks[job.taskCount++] = __builtin_ctzll(active);
+        }
+    }
+
+    // Waking the helpers costs more than a handful of voices
+    const bool parallel = activeVoices >= kParallelVoiceThreshold;
+
+    bool anyFreeSamplers = false;
+    for (int i = 0; i < SAMPLERS_PER_VOICE; ++i) {
+        if (!samplerKeyModes[i]) {
+            anyFreeSamplers = true;
+            break;
+        }
+    }
+
+    // One control block at a time: the matrix reads the modulation sources
+    // at the block's first frame, then the voices and free samplers render
+    // it. Blocks sit on a grid of the running frame count, so where the
+    // matrix is evaluated does not depend on the buffer size
+    profile::Accumulator waveformTimer;
+    for (unsigned int block = 0, blockEnd = 0; block < nFrames; block = blockEnd) {
+        const unsigned int gridOffset = static_cast<unsigned int>((modFramePosition + block) % modControlFrames);
+        blockEnd = std::min(nFrames, block + modControlFrames - gridOffset);
+
+        modTimer.begin();
+        modReadFrame = modBufferCursor + block;
+        const ModulationOutputs globalModOutputs = applyVoiceModulation();
+        modTimer.end();
+
+        const float* masterRamp = modSourceBuffer(kMasterVolumeBuffer);
+        const float blockVolume = masterRampFrames > 0 ? masterRamp[std::min(modReadFrame, masterRampFrames - 1)]
+                                                       : masterVolume;
+        const float masterGain = std::clamp(blockVolume + globalModOutputs.mixerMasterVolume, 0.0f, 1.0f);
+
+        // Scale by 0.5 to prevent clipping when multiple voices play
+        const float voiceGain = 0.5f * masterGain;
+        for (unsigned int base = block; base < blockEnd; base += kVoiceBufferFrames) {
+            job.base = base;
+            job.frames = std::min(blockEnd - base, kVoiceBufferFrames);
+            if (parallel) {
+                voicePool.run(&Synth::renderVoiceTask, &job, job.taskCount);
+            } else {
+                for (int t = 0; t < job.taskCount; ++t) {
+                    renderVoiceTask(&job, t);
+                }
+            }
+            filterVoices(job);
+
+            // Feed the oscilloscope if this is the first active voice
+            if (job.wasActive[0] && scopeEnabled) {
+                waveformTimer.begin();
+                scope.write(voiceBuffers, job.frames);
+                waveformTimer.end();
+            }
+
+            // While the master volume ramps, the voice gain follows it per frame
+            float rampGains[kVoiceBufferFrames];
+            if (masterRampFrames > 0) {
+                for (unsigned int i = 0; i < job.frames; ++i) {
+                    const unsigned int frame = std::min(modBufferCursor + base + i, masterRampFrames - 1);
+                    rampGains[i] = 0.5f * std::clamp(masterRamp[frame] + globalModOutputs.mixerMasterVolume, 0.0f, 1.0f);
+                }
+            }
+
+            float* mix = left + base;
+            for (int v = 0; v < MAX_VOICES; ++v) {
+                if (!job.wasActive[v] && !job.ringing[v]) {
+                    continue;
+                }
+                const float* voiceOut = voiceBuffers + v * kVoiceBufferFrames;
+                if (masterRampFrames > 0) {
+                    for (unsigned int i = 0; i < job.frames; ++i) {
+                        mix[i] += voiceOut[i] * rampGains[i];
+                    }
+                } else {
+                    for (unsigned int i = 0; i < job.frames; ++i) {
+                        mix[i] += voiceOut[i] * voiceGain;
+                    }
+                }
+            }
+        }
+
+        if (anyFreeSamplers) {
+            renderFreeSamplers(left + block, blockEnd - block, globalModOutputs, masterGain);
+        }
+    }
+    modBufferCursor += nFrames;
+    modFramePosition += nFrames;
+    modTimer.commit(profile::MOD_MATRIX);
+    for (int v = 0; v < std::min(MAX_VOICES, profile::kMaxVoices); ++v) {
+        if (job.wasActive[v]) {
+            job.voiceTimers[v].commit(profile::VOICE_RENDER + v);
+        }
+    }
+    if (job.wasActive[0] && scopeEnabled) {
+        waveformTimer.commit(profile::WAVEFORM_WRITE);
+    }
+
+    // Note Reset OFF carries on from the samplers of the last voice to finish
+    int lastEnded = -1;
     for (int v = 0; v < MAX_VOICES; ++v) {
-        if (!voices[v].active) {
-            continue;
+        if (job.endFrame[v] >= 0 && (lastEnded < 0 || job.endFrame[v] >= job.endFrame[lastEnded])) {
+            lastEnded = v;
         }
+    }
+    if (lastEnded >= 0) {
+        for (int i = 0; i < SAMPLERS_PER_VOICE; ++i) {
+            saveSamplerPhase(i, voices[lastEnded].samplers[i].getCurrentPhase());
+        }
+    }
+    syncVoiceAllocation();
 
-        Voice& voice = voices[v];
+    std::copy(left, left + nFrames, right);
+}
 
-        ModulationOutputs modOutputs = processModulationMatrix(&voice);
+// Evaluates the compiled matrix at modReadFrame: global (voice-agnostic)
+// targets once, and each active voice's targets with its own sources.
+// Voice-independent routes are shared by the global pass and every voice.
+Synth::ModulationOutputs Synth::applyVoiceModulation() {
+    ModulationOutputs sharedModOutputs;
+    evaluateModulationRoutes(modProgram.globalRoutes, modProgram.globalCount, nullptr, sharedModOutputs);
+
+    ModulationOutputs globalModOutputs = sharedModOutputs;
+    evaluateModulationRoutes(modProgram.voiceRoutes, modProgram.voiceCount, nullptr, globalModOutputs);
+    lastGlobalModOutputs = globalModOutputs;
+
+    // Copy modulation values to active voices (re-evaluated per voice for voice-specific sources)
+    for (uint64_t active = activeVoiceMask; active; active &= active - 1) {
+        Voice& voice = voices[__builtin_ctzll(active)];
+
+        ModulationOutputs modOutputs = sharedModOutputs;
+        evaluateModulationRoutes(modProgram.voiceRoutes, modProgram.voiceCount, &voice, modOutputs);
 
         // Set modulation values for all oscillators (in octaves for pitch)
         voice.pitchMod[0] = modOutputs.osc1Pitch;
@@ -314,150 +854,189 @@ void Synth::process(float* output, unsigned int nFrames, unsigned int nChannels)
             }
         }
     }
+    return globalModOutputs;
+}
 
-    // Process each active voice and mix into output
-    for (int v = 0; v < MAX_VOICES; ++v) {
-        if (!voices[v].active) {
-            continue;
-        }
-
-        // Generate samples for this voice
-        for (unsigned int i = 0; i < nFrames; ++i) {
-            float sample = voices[v].generateSample();
-            
-            // Write to UI oscilloscope buffer if this is the first active voice
-            if (v == 0 && ui) {
-                ui->writeToWaveformBuffer(sample);
+// Free (non key-mode) samplers, mixed into left with the global modulation
+void Synth::renderFreeSamplers(float* left, unsigned int nFrames, const ModulationOutputs& globalModOutputs,
+                               float masterGain) {
+    float samplerPitchMods[SAMPLERS_PER_VOICE] = {
+        globalModOutputs.samp1Pitch, globalModOutputs.samp2Pitch,
+        globalModOutputs.samp3Pitch, globalModOutputs.samp4Pitch
+    };
+    float samplerLoopStartMods[SAMPLERS_PER_VOICE] = {
+        globalModOutputs.samp1LoopStart, globalModOutputs.samp2LoopStart,
+        globalModOutputs.samp3LoopStart, globalModOutputs.samp4LoopStart
+    };
+    float samplerLoopLengthMods[SAMPLERS_PER_VOICE] = {
+        globalModOutputs.samp1LoopLength, globalModOutputs.samp2LoopLength,
+        globalModOutputs.samp3LoopLength, globalModOutputs.samp4LoopLength
+    };
+    float samplerCrossfadeMods[SAMPLERS_PER_VOICE] = {
+        globalModOutputs.samp1Crossfade, globalModOutputs.samp2Crossfade,
+        globalModOutputs.samp3Crossfade, globalModOutputs.samp4Crossfade
+    };
+    float samplerLevelMods[SAMPLERS_PER_VOICE] = {
+        globalModOutputs.samp1Amp, globalModOutputs.samp2Amp,
+        globalModOutputs.samp3Amp, globalModOutputs.samp4Amp
+    };
+    float samplerLevelOffsets[SAMPLERS_PER_VOICE] = {
+        globalModOutputs.mixerSamplerLevel[0], globalModOutputs.mixerSamplerLevel[1],
+        globalModOutputs.mixerSamplerLevel[2], globalModOutputs.mixerSamplerLevel[3]
+    };
+    float samplerPhaseDrivers[SAMPLERS_PER_VOICE] = {
+        samplerPhaseSource[0] != kClockModSourceIndex ? normalizePhaseForDriver(globalModOutputs.samplerPhase[0], samplerPhaseType[0]) : -1.0f,
+        samplerPhaseSource[1] != kClockModSourceIndex ? normalizePhaseForDriver(globalModOutputs.samplerPhase[1], samplerPhaseType[1]) : -1.0f,
+        samplerPhaseSource[2] != kClockModSourceIndex ? normalizePhaseForDriver(globalModOutputs.samplerPhase[2], samplerPhaseType[2]) : -1.0f,
+        samplerPhaseSource[3] != kClockModSourceIndex ? normalizePhaseForDriver(globalModOutputs.samplerPhase[3], samplerPhaseType[3]) : -1.0f
+    };
+
+    SamplerModulation samplerMods[SAMPLERS_PER_VOICE];
+    for (int s = 0; s < SAMPLERS_PER_VOICE; ++s) {
+        samplerMods[s].sampleRate = sampleRate;
+        samplerMods[s].pitchMod = samplerPitchMods[s];
+        samplerMods[s].loopStartMod = samplerLoopStartMods[s];
+        samplerMods[s].loopLengthMod = samplerLoopLengthMods[s];
+        samplerMods[s].crossfadeMod = samplerCrossfadeMods[s];
+        samplerMods[s].levelMod = samplerLevelMods[s];
+        samplerMods[s].levelOffset = samplerLevelOffsets[s];
+        samplerMods[s].phaseDriver = samplerPhaseDrivers[s];
+        samplerMods[s].midiNote = 60;  // Reference note (ignored in FREE mode)
+    }
+
+    // Render each free sampler a chunk at a time (no FM input)
+    float freeMix[VOICE_BLOCK_SIZE];
+    float samplerOut[VOICE_BLOCK_SIZE];
+    for (unsigned int offset = 0; offset < nFrames; offset += VOICE_BLOCK_SIZE) {
+        const int chunk = static_cast<int>(std::min<unsigned int>(VOICE_BLOCK_SIZE, nFrames - offset));
+        std::fill(freeMix, freeMix + chunk, 0.0f);
+        for (int s = 0; s < SAMPLERS_PER_VOICE; ++s) {
+            if (samplerKeyModes[s]) {
+                continue;
             }
-
-            // Mix into all channels with master volume
-            // Scale by 0.5 to prevent clipping when multiple voices play
-            for (unsigned int ch = 0; ch < nChannels; ++ch) {
-                output[i * nChannels + ch] += sample * 0.5f * masterGain;
+            freeSamplers[s].processBlock(samplerMods[s], samplerOut, chunk);
+            for (int i = 0; i < chunk; ++i) {
+                freeMix[i] += samplerOut[i];
             }
         }
-    }
-    
-    bool anyFreeSamplers = false;
-    for (int i = 0; i < SAMPLERS_PER_VOICE; ++i) {
-        if (!samplerKeyModes[i]) {
-            anyFreeSamplers = true;
-            break;
+        for (int i = 0; i < chunk; ++i) {
+            left[offset + i] += freeMix[i] * 0.5f * masterGain;
         }
     }
+}
 
-    if (anyFreeSamplers) {
-        float samplerPitchMods[SAMPLERS_PER_VOICE] = {
-            globalModOutputs.samp1Pitch, globalModOutputs.samp2Pitch,
-            globalModOutputs.samp3Pitch, globalModOutputs.samp4Pitch
-        };
-        float samplerLoopStartMods[SAMPLERS_PER_VOICE] = {
-            globalModOutputs.samp1LoopStart, globalModOutputs.samp2LoopStart,
-            globalModOutputs.samp3LoopStart, globalModOutputs.samp4LoopStart
-        };
-        float samplerLoopLengthMods[SAMPLERS_PER_VOICE] = {
-            globalModOutputs.samp1LoopLength, globalModOutputs.samp2LoopLength,
-            globalModOutputs.samp3LoopLength, globalModOutputs.samp4LoopLength
-        };
-        float samplerCrossfadeMods[SAMPLERS_PER_VOICE] = {
-            globalModOutputs.samp1Crossfade, globalModOutputs.samp2Crossfade,
-            globalModOutputs.samp3Crossfade, globalModOutputs.samp4Crossfade
-        };
-        float samplerLevelMods[SAMPLERS_PER_VOICE] = {
-            globalModOutputs.samp1Amp, globalModOutputs.samp2Amp,
-            globalModOutputs.samp3Amp, globalModOutputs.samp4Amp
-        };
-        float samplerLevelOffsets[SAMPLERS_PER_VOICE] = {
-            lastGlobalModOutputs.mixerSamplerLevel[0], lastGlobalModOutputs.mixerSamplerLevel[1],
-            lastGlobalModOutputs.mixerSamplerLevel[2], lastGlobalModOutputs.mixerSamplerLevel[3]
-        };
-        float samplerPhaseDrivers[SAMPLERS_PER_VOICE] = {
-            samplerPhaseSource[0] != kClockModSourceIndex ? normalizePhaseForDriver(globalModOutputs.samplerPhase[0], samplerPhaseType[0]) : -1.0f,
-            samplerPhaseSource[1] != kClockModSourceIndex ? normalizePhaseForDriver(globalModOutputs.samplerPhase[1], samplerPhaseType[1]) : -1.0f,
-            samplerPhaseSource[2] != kClockModSourceIndex ? normalizePhaseForDriver(globalModOutputs.samplerPhase[2], samplerPhaseType[2]) : -1.0f,
-            samplerPhaseSource[3] != kClockModSourceIndex ? normalizePhaseForDriver(globalModOutputs.samplerPhase[3], samplerPhaseType[3]) : -1.0f
-        };
-
-        for (unsigned int i = 0; i < nFrames; ++i) {
-            float freeMix = 0.0f;
-            for (int s = 0; s < SAMPLERS_PER_VOICE; ++s) {
-                if (samplerKeyModes[s]) {
-                    continue;
-                }
-                float samplerOut = freeSamplers[s].process(
-                    sampleRate,
-                    0.0f,                            // No FM input
-                    samplerPitchMods[s],
-                    samplerLoopStartMods[s],
-                    samplerLoopLengthMods[s],
-                    samplerCrossfadeMods[s],
-                    samplerLevelMods[s],
-                    samplerLevelOffsets[s],
-                    samplerPhaseDrivers[s],
-                    60                                // Reference MIDI note (ignored in FREE mode)
-                );
-                freeMix += samplerOut;
-            }
+void Synth::processEffects(float* left, float* right, unsigned int nFrames,
+                           const EffectSettings& settings) {
+    applyEffectSettings(settings);
+    const bool spectrum = spectrumEnabled.load(std::memory_order_relaxed);
+    if (spectrum) {
+        spectrumInput.write(left, nFrames);
+    }
 
-            if (freeMix != 0.0f) {
-                for (unsigned int ch = 0; ch < nChannels; ++ch) {
-                    output[i * nChannels + ch] += freeMix * 0.5f * masterGain;
-                }
-            }
-        }
+    EffectProcess chain[kEffectStages];
+    const int stages = buildEffectChain(settings, chain);
+    for (int i = 0; i < stages; ++i) {
+        (this->*chain[i])(left, right, static_cast<int>(nFrames));
     }
-    
-    // Apply filter if enabled (stereo processing)
-    if (filterEnabled && nChannels == 2) {
-        for (unsigned int i = 0; i < nFrames; ++i) {
-            float left = output[i * 2];
-            float right = output[i * 2 + 1];
-            
-            // Apply selected filter type
-            if (currentFilterType == 0) {  // Lowpass
-                auto [lp_l, hp_l] = filterL.process(left);
-                auto [lp_r, hp_r] = filterR.process(right);
-                output[i * 2] = lp_l;
-                output[i * 2 + 1] = lp_r;
-            } else if (currentFilterType == 1) {  // Highpass
-                auto [lp_l, hp_l] = filterL.process(left);
-                auto [lp_r, hp_r] = filterR.process(right);
-                output[i * 2] = hp_l;
-                output[i * 2 + 1] = hp_r;
-            } else if (currentFilterType == 2) {  // High shelf
-                output[i * 2] = highShelfL.process(left);
-                output[i * 2 + 1] = highShelfR.process(right);
-            } else if (currentFilterType == 3) {  // Low shelf
-                output[i * 2] = lowShelfL.process(left);
-                output[i * 2 + 1] = lowShelfR.process(right);
-            } else if (currentFilterType == 4) {  // Ladder LP (8-pole)
-                output[i * 2] = ladderFilterL.process(left);
-                output[i * 2 + 1] = ladderFilterR.process(right);
-            }
+
+    if (spectrum) {
+        spectrumOutput.write(left, nFrames);
+    }
+}
+
+bool Synth::setEffectOrder(const EffectStage* order) {
+    bool seen[kEffectStages] = {};
+    for (int i = 0; i < kEffectStages; ++i) {
+        const int stage = static_cast<int>(order[i]);
+        if (stage < 0 || stage >= kEffectStages || seen[stage]) {
+            return false;
         }
+        seen[stage] = true;
     }
-    
-    // Apply reverb if enabled (stereo processing)
-    if (reverbEnabled && nChannels == 2) {
-        // Create temporary buffers for left and right channels
-        std::vector<float> leftChannel(nFrames);
-        std::vector<float> rightChannel(nFrames);
-        
-        // De-interleave
-        for (unsigned int i = 0; i < nFrames; ++i) {
-            leftChannel[i] = output[i * 2];
-            rightChannel[i] = output[i * 2 + 1];
+    std::copy(order, order + kEffectStages, effectSettings.order);
+    return true;
+}
+
+int Synth::buildEffectChain(const EffectSettings& settings, EffectProcess* chain) {
+    // The mix filter, unless it is off or the voices ran it
+    EffectProcess filterStage = nullptr;
+    if (settings.filterEnabled && !settings.filtersVoices()) {
+        static constexpr EffectProcess kFilterTypes[] = {
+            &Synth::processLowpass, &Synth::processHighpass, &Synth::processHighShelf,
+            &Synth::processLowShelf, &Synth::processLadder};
+        if (currentFilterType >= 0 && currentFilterType < 5) {
+            filterStage = kFilterTypes[currentFilterType];
         }
-        
-        // Process reverb
-        reverb.process(leftChannel.data(), rightChannel.data(), nFrames);
-        
-        // Re-interleave
-        for (unsigned int i = 0; i < nFrames; ++i) {
-            output[i * 2] = leftChannel[i];
-            output[i * 2 + 1] = rightChannel[i];
+        if (!mixFilterRunning) {
+            filter.setCutoff(currentFilterCutoff);
+            highShelf.setCutoff(currentFilterCutoff);
+            lowShelf.setCutoff(currentFilterCutoff);
+            mixFilterRunning = true;
         }
+    } else {
+        mixFilterRunning = false;
+    }
+
+    EffectProcess reverbStage = nullptr;
+    if (settings.reverbEnabled) {
+        reverbStage = settings.reverbType == static_cast<int>(ReverbType::LATEDIFF) ? &Synth::processLateDiff
+                    : settings.reverbType == static_cast<int>(ReverbType::CONVOLUTION) ? &Synth::processConvolution
+                    : &Synth::processGreyhole;
     }
+
+    int stages = 0;
+    for (EffectStage stage : settings.order) {
+        const EffectProcess process = stage == EffectStage::FILTER ? filterStage : reverbStage;
+        if (process) {
+            chain[stages++] = process;
+        }
+    }
+    return stages;
+}
+
+// Filters and reverbs process in place, stereo
+
+void Synth::processLowpass(float* left, float* right, int n) {
+    profile::ScopedTimer filterTimer(profile::FILTER);
+    filter.processStereoGlide(left, right, n, false, currentFilterCutoff);
+}
+
+void Synth::processHighpass(float* left, float* right, int n) {
+    profile::ScopedTimer filterTimer(profile::FILTER);
+    filter.processStereoGlide(left, right, n, true, currentFilterCutoff);
+}
+
+void Synth::processHighShelf(float* left, float* right, int n) {
+    profile::ScopedTimer filterTimer(profile::FILTER);
+    highShelf.processStereoGlide(left, right, n, currentFilterCutoff);
+}
+
+void Synth::processLowShelf(float* left, float* right, int n) {
+    profile::ScopedTimer filterTimer(profile::FILTER);
+    lowShelf.processStereoGlide(left, right, n, currentFilterCutoff);
+}
+
+void Synth::processLadder(float* left, float* right, int n) {
+    // 8-pole, at the oversampler's rate
+    profile::ScopedTimer filterTimer(profile::FILTER);
+    ladderOversampler.processStereo(left, right, n, [this](float* l, float* r, int m) {
+        ladderFilter.processStereo(l, r, m);
+    });
+}
+
+void Synth::processGreyhole(float* left, float* right, int n) {
+    profile::ScopedTimer reverbTimer(profile::REVERB);
+    reverb.process(left, right, n);
+}
+
+void Synth::processLateDiff(float* left, float* right, int n) {
+    profile::ScopedTimer reverbTimer(profile::REVERB);
+    lateDiffReverb.process(left, right, n);
+}
+
+void Synth::processConvolution(float* left, float* right, int n) {
+    profile::ScopedTimer reverbTimer(profile::REVERB);
+    convolutionReverb.process(left, right, n);
 }
 
 void Synth::updateLFOParameters(int lfoIndex, float period, int syncMode, int shape, float morph,
@@ -475,12 +1054,26 @@ void Synth::updateLFOParameters(int lfoIndex, float period, int syncMode, int sh
 }
 
 void Synth::processLFOs(float sampleRate, unsigned int nFrames) {
-    // Process all 4 LFOs once per audio buffer
+    // Render all 4 LFOs together, a frame at a time, for this buffer; the
+    // rate, morph and duty modulation hold for the buffer
+    const unsigned int stored = std::min(nFrames, kModBufferFrames);
+    lfoBufferFrames = stored;
+    modBufferCursor = 0;
+    float* out[LFOBank::kLanes];
     for (int i = 0; i < 4; ++i) {
         // Apply modulation to LFO parameters (uses last buffer's outputs)
-        float periodBase = params ? params->getLfoPeriod(i) : lfos[i].getPeriod();
-        float morphBase = params ? params->getLfoMorph(i) : lfos[i].getMorph();
-        float dutyBase = params ? params->getLfoDuty(i) : lfos[i].getDuty();
+        float periodBase = lfos[i].getPeriod();
+        float morphBase = lfos[i].getMorph();
+        float dutyBase = lfos[i].getDuty();
+        if (paramBlock) {
+            periodBase = paramBlock->lfo[i].period;
+            morphBase = paramBlock->lfo[i].morph;
+            dutyBase = paramBlock->lfo[i].duty;
+        } else if (params) {
+            periodBase = params->getLfoPeriod(i);
+            morphBase = params->getLfoMorph(i);
+            dutyBase = params->getLfoDuty(i);
+        }
 
         float periodMod = lastGlobalModOutputs.lfoPeriod[i];
         float morphMod = lastGlobalModOutputs.lfoMorph[i];
@@ -493,41 +1086,55 @@ void Synth::processLFOs(float sampleRate, unsigned int nFrames) {
         lfos[i].setPeriod(modulatedPeriod);
         lfos[i].setMorph(modulatedMorph);
         lfos[i].setDuty(modulatedDuty);
-
-        float value = lfos[i].process(sampleRate, nFrames);
-        if (params) {
-            params->setLfoVisualState(i, value, lfos[i].getPhase());
-        }
-        // Write to UI's LFO history buffer for rolling scope view
-        if (ui) {
-            ui->writeToLFOHistory(i, value);
-        }
+        out[i] = modSourceBuffer(kLfoModBuffer + i);
     }
+    // Past the buffers the LFOs only advance; reads hold the last stored frame
+    lfos.processBlock(sampleRate, out, stored, nFrames);
 }
 
 void Synth::processChaos(unsigned int nFrames) {
-    // Process all 4 chaos generators once per buffer to advance their state
-    for (unsigned int frame = 0; frame < nFrames; ++frame) {
-        for (int i = 0; i < 4; ++i) {
-            // Only process if running
-            bool running = params ? params->getChaosRunning(i) : true;
-            if (running) {
-                chaosOutputs[i] = chaos[i].process();  // Advance and cache output
-            }
-        }
+    // Run/stop state is read once per buffer
+    bool running[4];
+    for (int i = 0; i < 4; ++i) {
+        running[i] = paramBlock ? paramBlock->chaosRunning[i]
+                                : (params ? params->getChaosRunning(i) : true);
+    }
+
+    // Render all 4 chaos generators together, a frame at a time; a stopped
+    // generator holds its last output
+    const unsigned int stored = std::min(nFrames, kModBufferFrames);
+    chaosBufferFrames = stored;
+    modBufferCursor = 0;
+    float* xs[4];
+    float* ys[4];
+    for (int i = 0; i < 4; ++i) {
+        xs[i] = modSourceBuffer(kChaosXModBuffer + i);
+        ys[i] = modSourceBuffer(kChaosYModBuffer + i);
+    }
+    chaos.processBlock(xs, ys, running, stored);
+    chaos.processBlock(nullptr, nullptr, running, nFrames - stored);   // Past the buffers: advance only
+    for (int i = 0; i < 4; ++i) {
+        chaosOutputs[i] = chaos.getX(i);
     }
+}
+
+void Synth::setMasterVolumeRamp(const float* perFrame, unsigned int nFrames) {
+    if (nFrames == 0) {
+        return;
+    }
+    masterRampFrames = std::min(nFrames, kModBufferFrames);
+    std::copy(perFrame, perFrame + masterRampFrames, modSourceBuffer(kMasterVolumeBuffer));
+    masterVolume = perFrame[nFrames - 1];
+}
 
-    // Update visual state for UI (once per buffer, using last frame's values)
-    if (params) {
-        params->chaos1VisualX.store(chaosOutputs[0]);
-        params->chaos1VisualY.store(chaos[0].getY());
-        params->chaos2VisualX.store(chaosOutputs[1]);
-        params->chaos2VisualY.store(chaos[1].getY());
-        params->chaos3VisualX.store(chaosOutputs[2]);
-        params->chaos3VisualY.store(chaos[2].getY());
-        params->chaos4VisualX.store(chaosOutputs[3]);
-        params->chaos4VisualY.store(chaos[3].getY());
+// A source buffer at modReadFrame; current is the source's cached value,
+// used until the buffer has been rendered
+float Synth::readModSource(int index, unsigned int storedFrames, float current) const {
+    if (storedFrames == 0) {
+        return current;
     }
+    const unsigned int frame = std::min(modReadFrame, storedFrames - 1);
+    return modSourceBuffers[static_cast<size_t>(index) * kModBufferFrames + frame];
 }
 
 float Synth::getLFOOutput(int lfoIndex) const {
@@ -542,14 +1149,22 @@ float Synth::getChaosOutput(int chaosIndex) const {
 
 float Synth::getChaosOutputY(int chaosIndex) const {
     if (chaosIndex < 0 || chaosIndex >= 4) return 0.0f;
-    return chaos[chaosIndex].getY();
+    return chaos.getY(chaosIndex);
+}
+
+const ModulationSlot* Synth::slotTable() const {
+    if (slotOverride) {
+        return slotOverride;
+    }
+    return modulationSlots;
 }
 
 const ModulationSlot* Synth::getModulationSlot(int index) const {
-    if (!ui || index < 0 || index >= kModulationSlotCount) {
+    const ModulationSlot* slots = slotTable();
+    if (!slots || index < 0 || index >= kModulationSlotCount) {
         return nullptr;
     }
-    return &ui->modulationSlots[index];
+    return &slots[index];
 }
 
 void Synth::refreshSamplerPhaseDrivers() {
@@ -587,7 +1202,7 @@ float Synth::getModulationSource(int sourceIndex, const Voice* voiceContext) {
 
     if (sourceIndex >= 0 && sourceIndex <= 3) {
         // LFO 1-4
-        return getLFOOutput(sourceIndex);
+        return readModSource(kLfoModBuffer + sourceIndex, lfoBufferFrames, getLFOOutput(sourceIndex));
     } else if (sourceIndex >= 4 && sourceIndex <= 7) {
         // ENV 1-4
         // For now, only ENV 1 (index 4) is implemented using per-voice envelopes
@@ -598,13 +1213,8 @@ float Synth::getModulationSource(int sourceIndex, const Voice* voiceContext) {
                 return voiceContext->getEnvelopeValue();
             }
             float maxEnv = 0.0f;
-            for (int i = MAX_VOICES - 1; i >= 0; --i) {
-                if (voices[i].active) {
-                    float env = voices[i].getEnvelopeValue();
-                    if (env > maxEnv) {
-                        maxEnv = env;
-                    }
-                }
+            for (uint64_t active = activeVoiceMask; active; active &= active - 1) {
+                maxEnv = std::max(maxEnv, voices[__builtin_ctzll(active)].getEnvelopeValue());
             }
             return maxEnv;
         }
@@ -633,9 +1243,9 @@ float Synth::getModulationSource(int sourceIndex, const Voice* voiceContext) {
         int chaosIndex = (sourceIndex - 13) / 2;  // 13,14->0, 15,16->1, 17,18->2, 19,20->3
         bool isY = ((sourceIndex - 13) % 2) == 1;  // Odd indices are Y
         if (isY) {
-            return getChaosOutputY(chaosIndex);
+            return readModSource(kChaosYModBuffer + chaosIndex, chaosBufferFrames, getChaosOutputY(chaosIndex));
         } else {
-            return getChaosOutput(chaosIndex);
+            return readModSource(kChaosXModBuffer + chaosIndex, chaosBufferFrames, getChaosOutput(chaosIndex));
         }
     }
 
@@ -652,181 +1262,194 @@ float Synth::applyModCurve(float input, int curveType) {
 
         case 1: // Exponential
             if (input >= 0.0f) {
-                return (std::exp(input) - 1.0f) / (std::exp(1.0f) - 1.0f);
+                return (fastmath::exp(input) - 1.0f) / (std::exp(1.0f) - 1.0f);
             } else {
-                return -(std::exp(-input) - 1.0f) / (std::exp(1.0f) - 1.0f);
+                return -(fastmath::exp(-input) - 1.0f) / (std::exp(1.0f) - 1.0f);
             }
 
         case 2: // Logarithmic
             if (input >= 0.0f) {
-                return std::log(1.0f + input) / std::log(2.0f);
+                return fastmath::log2(1.0f + input);
             } else {
-                return -std::log(1.0f - input) / std::log(2.0f);
+                return -fastmath::log2(1.0f - input);
             }
 
         case 3: // S-Curve (tanh)
-            return std::tanh(input * 2.0f);
+            return fastmath::tanh(input * 2.0f);
 
         default:
             return input;
     }
 }
 
-Synth::ModulationOutputs Synth::processModulationMatrix(const Voice* voiceContext) {
-    ModulationOutputs outputs;
+namespace {
 
-    if (!ui) return outputs;
+using ModOut = Synth::ModulationOutputs;
 
-    // Process all 16 modulation slots
-    for (int i = 0; i < 16; ++i) {
-        const ModulationSlot& slot = ui->modulationSlots[i];
+static_assert(std::is_standard_layout<ModOut>::value &&
+              sizeof(ModOut) % sizeof(float) == 0,
+              "ModulationOutputs must be a flat block of floats");
 
-        // Skip empty or incomplete slots
-        if (!slot.isComplete()) continue;
+constexpr uint16_t modField(size_t byteOffset, int element = 0) {
+    return static_cast<uint16_t>(byteOffset / sizeof(float) + element);
+}
 
-        // Get source value (-1 to +1)
-        float sourceValue = getModulationSource(slot.source, voiceContext);
+// Destination index (see ui_mod_data) -> float offset into ModulationOutputs
+// 0-5: OSC 1 Pitch/Morph/Duty/Ratio/Offset/Amp
+// 6-11: OSC 2 Pitch/Morph/Duty/Ratio/Offset/Amp
+// 12-17: OSC 3 Pitch/Morph/Duty/Ratio/Offset/Amp
+// 18-23: OSC 4 Pitch/Morph/Duty/Ratio/Offset/Amp
+// 24-25: Filter Cutoff/Resonance
+// 26-27: Reverb Mix/Size
+// 28-32: SAMP 1 Pitch/LoopStart/LoopLength/Crossfade/Level
+// 33-37: SAMP 2 Pitch/LoopStart/LoopLength/Crossfade/Level
+// 38-42: SAMP 3 Pitch/LoopStart/LoopLength/Crossfade/Level
+// 43-47: SAMP 4 Pitch/LoopStart/LoopLength/Crossfade/Level
+// 48-59: LFO 1-4 Rate/Morph/Duty
+// 60: Mixer Master Volume
+// 61-64: Mixer Oscillator Levels
+// 65-68: Mixer Sampler Levels
+// 69-72: Sequencer Track 1-4 Phase Drivers
+// 73-76: Sampler 1-4 Phase Drivers
+const uint16_t kModDestinationOffsets[kModulationDestinationCount] = {
+    modField(offsetof(ModOut, osc1Pitch)), modField(offsetof(ModOut, osc1Morph)),
+    modField(offsetof(ModOut, osc1Duty)), modField(offsetof(ModOut, osc1Ratio)),
+    modField(offsetof(ModOut, osc1Offset)), modField(offsetof(ModOut, osc1Amp)),
+    modField(offsetof(ModOut, osc2Pitch)), modField(offsetof(ModOut, osc2Morph)),
+    modField(offsetof(ModOut, osc2Duty)), modField(offsetof(ModOut, osc2Ratio)),
+    modField(offsetof(ModOut, osc2Offset)), modField(offsetof(ModOut, osc2Amp)),
+    modField(offsetof(ModOut, osc3Pitch)), modField(offsetof(ModOut, osc3Morph)),
+    modField(offsetof(ModOut, osc3Duty)), modField(offsetof(ModOut, osc3Ratio)),
+    modField(offsetof(ModOut, osc3Offset)), modField(offsetof(ModOut, osc3Amp)),
+    modField(offsetof(ModOut, osc4Pitch)), modField(offsetof(ModOut, osc4Morph)),
+    modField(offsetof(ModOut, osc4Duty)), modField(offsetof(ModOut, osc4Ratio)),
+    modField(offsetof(ModOut, osc4Offset)), modField(offsetof(ModOut, osc4Amp)),
+    modField(offsetof(ModOut, filterCutoff)), modField(offsetof(ModOut, filterResonance)),
+    modField(offsetof(ModOut, reverbMix)), modField(offsetof(ModOut, reverbSize)),
+    modField(offsetof(ModOut, samp1Pitch)), modField(offsetof(ModOut, samp1LoopStart)),
+    modField(offsetof(ModOut, samp1LoopLength)), modField(offsetof(ModOut, samp1Crossfade)),
+    modField(offsetof(ModOut, samp1Amp)),
+    modField(offsetof(ModOut, samp2Pitch)), modField(offsetof(ModOut, samp2LoopStart)),
+    modField(offsetof(ModOut, samp2LoopLength)), modField(offsetof(ModOut, samp2Crossfade)),
+    modField(offsetof(ModOut, samp2Amp)),
+    modField(offsetof(ModOut, samp3Pitch)), modField(offsetof(ModOut, samp3LoopStart)),
+    modField(offsetof(ModOut, samp3LoopLength)), modField(offsetof(ModOut, samp3Crossfade)),
+    modField(offsetof(ModOut, samp3Amp)),
+    modField(offsetof(ModOut, samp4Pitch)), modField(offsetof(ModOut, samp4LoopStart)),
+    modField(offsetof(ModOut, samp4LoopLength)), modField(offsetof(ModOut, samp4Crossfade)),
+    modField(offsetof(ModOut, samp4Amp)),
+    modField(offsetof(ModOut, lfoPeriod), 0), modField(offsetof(ModOut, lfoMorph), 0),
+    modField(offsetof(ModOut, lfoDuty), 0),
+    modField(offsetof(ModOut, lfoPeriod), 1), modField(offsetof(ModOut, lfoMorph), 1),
+    modField(offsetof(ModOut, lfoDuty), 1),
+    modField(offsetof(ModOut, lfoPeriod), 2), modField(offsetof(ModOut, lfoMorph), 2),
+    modField(offsetof(ModOut, lfoDuty), 2),
+    modField(offsetof(ModOut, lfoPeriod), 3), modField(offsetof(ModOut, lfoMorph), 3),
+    modField(offsetof(ModOut, lfoDuty), 3),
+    modField(offsetof(ModOut, mixerMasterVolume)),
+    modField(offsetof(ModOut, mixerOscLevel), 0), modField(offsetof(ModOut, mixerOscLevel), 1),
+    modField(offsetof(ModOut, mixerOscLevel), 2), modField(offsetof(ModOut, mixerOscLevel), 3),
+    modField(offsetof(ModOut, mixerSamplerLevel), 0), modField(offsetof(ModOut, mixerSamplerLevel), 1),
+    modField(offsetof(ModOut, mixerSamplerLevel), 2), modField(offsetof(ModOut, mixerSamplerLevel), 3),
+    modField(offsetof(ModOut, sequencerPhase), 0), modField(offsetof(ModOut, sequencerPhase), 1),
+    modField(offsetof(ModOut, sequencerPhase), 2), modField(offsetof(ModOut, sequencerPhase), 3),
+    modField(offsetof(ModOut, samplerPhase), 0), modField(offsetof(ModOut, samplerPhase), 1),
+    modField(offsetof(ModOut, samplerPhase), 2), modField(offsetof(ModOut, samplerPhase), 3),
+};
+
+static_assert(kClockTargetSequencerBase + 4 == kClockTargetSamplerBase &&
+              kClockTargetSamplerBase + 4 == kModulationDestinationCount,
+              "destination table must end with the clock targets");
+
+bool sameSlot(const ModulationSlot& a, const ModulationSlot& b) {
+    return a.source == b.source && a.curve == b.curve && a.amount == b.amount &&
+           a.destination == b.destination && a.type == b.type;
+}
 
-        // Apply curve shaping
-        float shapedValue = applyModCurve(sourceValue, slot.curve);
+} // namespace
 
-        // Apply amount scaling (-99 to +99 maps to a reasonable modulation range)
-        float amount = static_cast<float>(slot.amount) / 99.0f;
-        float modValue = shapedValue * amount;
+void Synth::refreshModulationProgram() {
+    const ModulationSlot* slots = slotTable();
+    if (!slots) {
+        modProgram.globalCount = 0;
+        modProgram.voiceCount = 0;
+        modProgramValid = false;
+        return;
+    }
 
-        // Handle bidirectional vs unidirectional
+    // Recompile only when the slot table differs from the last compiled copy
+    if (modProgramValid) {
+        bool changed = false;
+        for (int i = 0; i < kModulationSlotCount && !changed; ++i) {
+            changed = !sameSlot(slots[i], compiledSlots[i]);
+        }
+        if (!changed) {
+            return;
+        }
+    }
+
+    modProgram.globalCount = 0;
+    modProgram.voiceCount = 0;
+    for (int i = 0; i < kModulationSlotCount; ++i) {
+        const ModulationSlot slot = slots[i];
+        compiledSlots[i] = slot;
+
+        // Skip empty or incomplete slots, and destinations with nothing behind them
+        if (!slot.isComplete() || slot.destination >= kModulationDestinationCount) {
+            continue;
+        }
+
+        ModulationRoute route;
+        route.source = slot.source;
+        route.curve = slot.curve;
         // Type 0 = Unidirectional (-->), Type 1 = Bidirectional (<->)
-        if (slot.type == 0) {
-            // Unidirectional: map -1..+1 to 0..+1
-            modValue = (modValue + 1.0f) * 0.5f * amount;
+        route.unidirectional = (slot.type == 0);
+        // Amount -99 to +99 maps to a reasonable modulation range
+        route.amount = static_cast<float>(slot.amount) / 99.0f;
+        route.destination = kModDestinationOffsets[slot.destination];
+
+        if (slot.source == kEnvelopeModSourceIndex) {
+            modProgram.voiceRoutes[modProgram.voiceCount++] = route;
+        } else {
+            modProgram.globalRoutes[modProgram.globalCount++] = route;
         }
+    }
+    modProgramValid = true;
+}
 
-        // Apply to destination
-        // Destination indices from ui_mod_data:
-        // 0-5: OSC 1 Pitch/Morph/Duty/Ratio/Offset/Amp
-        // 6-11: OSC 2 Pitch/Morph/Duty/Ratio/Offset/Amp
-        // 12-17: OSC 3 Pitch/Morph/Duty/Ratio/Offset/Amp
-        // 18-23: OSC 4 Pitch/Morph/Duty/Ratio/Offset/Amp
-        // 24-25: Filter Cutoff/Resonance
-        // 26-27: Reverb Mix/Size
-        // 28-32: SAMP 1 Pitch/LoopStart/LoopLength/Crossfade/Level
-        // 33-37: SAMP 2 Pitch/LoopStart/LoopLength/Crossfade/Level
-        // 38-42: SAMP 3 Pitch/LoopStart/LoopLength/Crossfade/Level
-        // 43-47: SAMP 4 Pitch/LoopStart/LoopLength/Crossfade/Level
-        // 48-59: LFO 1-4 Rate/Morph/Duty
-        // 60: Mixer Master Volume
-        // 61-64: Mixer Oscillator Levels
-        // 65-68: Mixer Sampler Levels
-        // 69-72: Sequencer Track 1-4 Phase Drivers
-        // 73-76: Sampler 1-4 Phase Drivers
-
-        switch (slot.destination) {
-            // OSC 1
-            case 0: outputs.osc1Pitch += modValue; break;
-            case 1: outputs.osc1Morph += modValue; break;
-            case 2: outputs.osc1Duty += modValue; break;
-            case 3: outputs.osc1Ratio += modValue; break;
-            case 4: outputs.osc1Offset += modValue; break;
-            case 5: outputs.osc1Amp += modValue; break;  // Changed from Level to Amp
-            // OSC 2
-            case 6: outputs.osc2Pitch += modValue; break;
-            case 7: outputs.osc2Morph += modValue; break;
-            case 8: outputs.osc2Duty += modValue; break;
-            case 9: outputs.osc2Ratio += modValue; break;
-            case 10: outputs.osc2Offset += modValue; break;
-            case 11: outputs.osc2Amp += modValue; break;  // Changed from Level to Amp
-            // OSC 3
-            case 12: outputs.osc3Pitch += modValue; break;
-            case 13: outputs.osc3Morph += modValue; break;
-            case 14: outputs.osc3Duty += modValue; break;
-            case 15: outputs.osc3Ratio += modValue; break;
-            case 16: outputs.osc3Offset += modValue; break;
-            case 17: outputs.osc3Amp += modValue; break;  // Changed from Level to Amp
-            // OSC 4
-            case 18: outputs.osc4Pitch += modValue; break;
-            case 19: outputs.osc4Morph += modValue; break;
-            case 20: outputs.osc4Duty += modValue; break;
-            case 21: outputs.osc4Ratio += modValue; break;
-            case 22: outputs.osc4Offset += modValue; break;
-            case 23: outputs.osc4Amp += modValue; break;  // Changed from Level to Amp
-            // Filter
-            case 24: outputs.filterCutoff += modValue; break;
-            case 25: outputs.filterResonance += modValue; break;
-            // Reverb
-            case 26: outputs.reverbMix += modValue; break;
-            case 27: outputs.reverbSize += modValue; break;
-            // SAMP 1
-            case 28: outputs.samp1Pitch += modValue; break;
-            case 29: outputs.samp1LoopStart += modValue; break;
-            case 30: outputs.samp1LoopLength += modValue; break;
-            case 31: outputs.samp1Crossfade += modValue; break;
-            case 32: outputs.samp1Amp += modValue; break;
-            // SAMP 2
-            case 33: outputs.samp2Pitch += modValue; break;
-            case 34: outputs.samp2LoopStart += modValue; break;
-            case 35: outputs.samp2LoopLength += modValue; break;
-            case 36: outputs.samp2Crossfade += modValue; break;
-            case 37: outputs.samp2Amp += modValue; break;
-            // SAMP 3
-            case 38: outputs.samp3Pitch += modValue; break;
-            case 39: outputs.samp3LoopStart += modValue; break;
-            case 40: outputs.samp3LoopLength += modValue; break;
-            case 41: outputs.samp3Crossfade += modValue; break;
-            case 42: outputs.samp3Amp += modValue; break;
-            // SAMP 4
-            case 43: outputs.samp4Pitch += modValue; break;
-            case 44: outputs.samp4LoopStart += modValue; break;
-            case 45: outputs.samp4LoopLength += modValue; break;
-            case 46: outputs.samp4Crossfade += modValue; break;
-            case 47: outputs.samp4Amp += modValue; break;
-            // LFO 1
-            case 48: outputs.lfoPeriod[0] += modValue; break;
-            case 49: outputs.lfoMorph[0] += modValue; break;
-            case 50: outputs.lfoDuty[0] += modValue; break;
-            // LFO 2
-            case 51: outputs.lfoPeriod[1] += modValue; break;
-            case 52: outputs.lfoMorph[1] += modValue; break;
-            case 53: outputs.lfoDuty[1] += modValue; break;
-            // LFO 3
-            case 54: outputs.lfoPeriod[2] += modValue; break;
-            case 55: outputs.lfoMorph[2] += modValue; break;
-            case 56: outputs.lfoDuty[2] += modValue; break;
-            // LFO 4
-            case 57: outputs.lfoPeriod[3] += modValue; break;
-            case 58: outputs.lfoMorph[3] += modValue; break;
-            case 59: outputs.lfoDuty[3] += modValue; break;
-            // Mixer
-            case 60: outputs.mixerMasterVolume += modValue; break;
-            case 61: outputs.mixerOscLevel[0] += modValue; break;
-            case 62: outputs.mixerOscLevel[1] += modValue; break;
-            case 63: outputs.mixerOscLevel[2] += modValue; break;
-            case 64: outputs.mixerOscLevel[3] += modValue; break;
-            case 65: outputs.mixerSamplerLevel[0] += modValue; break;
-            case 66: outputs.mixerSamplerLevel[1] += modValue; break;
-            case 67: outputs.mixerSamplerLevel[2] += modValue; break;
-            case 68: outputs.mixerSamplerLevel[3] += modValue; break;
-            // Sequencer phase drivers
-            case 69: outputs.sequencerPhase[0] += modValue; break;
-            case 70: outputs.sequencerPhase[1] += modValue; break;
-            case 71: outputs.sequencerPhase[2] += modValue; break;
-            case 72: outputs.sequencerPhase[3] += modValue; break;
-            // Sampler phase drivers
-            case 73: outputs.samplerPhase[0] += modValue; break;
-            case 74: outputs.samplerPhase[1] += modValue; break;
-            case 75: outputs.samplerPhase[2] += modValue; break;
-            case 76: outputs.samplerPhase[3] += modValue; break;
+void Synth::evaluateModulationRoutes(const ModulationRoute* routes, int count,
+                                     const Voice* voiceContext, ModulationOutputs& outputs) {
+    float* dest = reinterpret_cast<float*>(&outputs);
+    for (int i = 0; i < count; ++i) {
+        const ModulationRoute& route = routes[i];
+
+        // Source value (-1 to +1), curve shaping, then amount scaling
+        float sourceValue = getModulationSource(route.source, voiceContext);
+        float modValue = applyModCurve(sourceValue, route.curve) * route.amount;
+
+        if (route.unidirectional) {
+            // Unidirectional: map -1..+1 to 0..+1
+            modValue = (modValue + 1.0f) * 0.5f * route.amount;
         }
+
+        dest[route.destination] += modValue;
     }
+}
+
+Synth::ModulationOutputs Synth::processModulationMatrix(const Voice* voiceContext) {
+    ModulationOutputs outputs;
 
+    refreshModulationProgram();
+    evaluateModulationRoutes(modProgram.globalRoutes, modProgram.globalCount, voiceContext, outputs);
+    evaluateModulationRoutes(modProgram.voiceRoutes, modProgram.voiceCount, voiceContext, outputs);
     return outputs;
 }
 
 void Synth::setParams(SynthParameters* params_ptr) {
     params = params_ptr;
-    // Update all voice pointers for FM matrix access and base levels
+    // Update all voice pointers for FM matrix access
     for (auto& voice : voices) {
         voice.params = params_ptr;
-        voice.synth = this;
     }
 }
 
@@ -837,14 +1460,115 @@ void Synth::setSamplerSample(int samplerIndex, int sampleIndex) {
         return;
     }
 
-    const SampleData* sample = sampleBank.getSample(sampleIndex);
+    reclaimRetiredSamples();
+
+    // Maps or decodes the sample's audio on first use, off the audio thread
+    const SampleData* sample = sampleBank.acquireSample(sampleIndex);
     currentSampleIndices[samplerIndex] = sampleIndex;
+    publishSamplerSample(samplerIndex, sample);
 
-    // Apply to all voices
-    for (auto& voice : voices) {
-        voice.samplers[samplerIndex].setSample(sample);
+    // A reload replaces the bank entry; move every sampler still on the old
+    // data of this index to the new one so the old data can be reclaimed
+    for (int s = 0; s < SAMPLERS_PER_VOICE; ++s) {
+        if (s != samplerIndex && currentSampleIndices[s] == sampleIndex && publishedSamples[s] != sample) {
+            publishSamplerSample(s, sample);
+        }
+    }
+}
+
+void Synth::setSamplerSamples(const int* sampleIndices) {
+    sampleBank.prefetchSamples(sampleIndices, SAMPLERS_PER_VOICE);
+    for (int s = 0; s < SAMPLERS_PER_VOICE; ++s) {
+        if (sampleIndices[s] >= 0) {
+            setSamplerSample(s, sampleIndices[s]);
+        }
+    }
+}
+
+void Synth::publishSamplerSample(int samplerIndex, const SampleData* sample) {
+    SampleSwapSlot& slot = sampleSwaps[samplerIndex];
+    publishedSamples[samplerIndex] = sample;
+    slot.pending.store(sample, std::memory_order_relaxed);
+    slot.requested.fetch_add(1, std::memory_order_release);
+}
+
+bool Synth::sampleSwapsSettled() const {
+    // Until every swap is acknowledged a sampler may still hold older data
+    for (const SampleSwapSlot& slot : sampleSwaps) {
+        if (slot.acknowledged.load(std::memory_order_acquire) !=
+            slot.requested.load(std::memory_order_relaxed)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void Synth::reclaimRetiredSamples() {
+    if (sampleSwapsSettled()) {
+        sampleBank.reclaimRetired(publishedSamples, SAMPLERS_PER_VOICE);
+    }
+}
+
+void Synth::trimSamples() {
+    if (sampleSwapsSettled()) {
+        sampleBank.reclaimRetired(publishedSamples, SAMPLERS_PER_VOICE);
+        sampleBank.evictOverBudget(publishedSamples, SAMPLERS_PER_VOICE);
+    }
+}
+
+// Audio thread, once per buffer: hand newly published samples to the
+// samplers and acknowledge swaps whose fades have finished. Samplers that
+// aren't being rendered switch at once, since nobody hears them. Also
+// brings each slot's shared loop up to date before the voices render
+void Synth::applySampleSwaps() {
+    for (int s = 0; s < SAMPLERS_PER_VOICE; ++s) {
+        SampleSwapSlot& slot = sampleSwaps[s];
+        const uint32_t requested = slot.requested.load(std::memory_order_acquire);
+        if (requested != slot.applied) {
+            const SampleData* sample = slot.pending.load(std::memory_order_relaxed);
+            for (auto& voice : voices) {
+                if (voice.active && samplerKeyModes[s]) {
+                    voice.samplers[s].queueSample(sample);
+                } else {
+                    voice.samplers[s].setSample(sample);
+                }
+            }
+            if (!samplerKeyModes[s]) {
+                freeSamplers[s].queueSample(sample);
+            } else {
+                freeSamplers[s].setSample(sample);
+            }
+            samplerConfigs[s].sample = sample;
+            slot.applied = requested;
+        }
+        samplerConfigs[s].prepare(samplerInterpolationCap);
+
+        if (slot.acknowledged.load(std::memory_order_relaxed) == slot.applied) {
+            continue;
+        }
+        bool fading = false;
+        for (auto& voice : voices) {
+            Sampler& sampler = voice.samplers[s];
+            if (!sampler.hasPendingSwap()) {
+                continue;
+            }
+            if (voice.active && samplerKeyModes[s]) {
+                fading = true;
+            } else {
+                sampler.finishSwap();
+            }
+        }
+        if (freeSamplers[s].hasPendingSwap()) {
+            if (!samplerKeyModes[s]) {
+                fading = true;
+            } else {
+                freeSamplers[s].finishSwap();
+            }
+        }
+        if (!fading) {
+            slot.acknowledged.store(slot.applied, std::memory_order_release);
+        }
     }
-    freeSamplers[samplerIndex].setSample(sample);
 }
 
 void Synth::setSamplerLoopStart(int samplerIndex, float normalized) {
@@ -852,10 +1576,7 @@ void Synth::setSamplerLoopStart(int samplerIndex, float normalized) {
         return;
     }
 
-    for (auto& voice : voices) {
-        voice.samplers[samplerIndex].setLoopStart(normalized);
-    }
-    freeSamplers[samplerIndex].setLoopStart(normalized);
+    samplerConfigs[samplerIndex].loopStartNorm = std::clamp(normalized, 0.0f, 1.0f);
 }
 
 void Synth::setSamplerLoopLength(int samplerIndex, float normalized) {
@@ -863,10 +1584,7 @@ void Synth::setSamplerLoopLength(int samplerIndex, float normalized) {
         return;
     }
 
-    for (auto& voice : voices) {
-        voice.samplers[samplerIndex].setLoopLength(normalized);
-    }
-    freeSamplers[samplerIndex].setLoopLength(normalized);
+    samplerConfigs[samplerIndex].loopLengthNorm = std::clamp(normalized, 0.0f, 1.0f);
 }
 
 void Synth::setSamplerCrossfadeLength(int samplerIndex, float normalized) {
@@ -874,10 +1592,15 @@ void Synth::setSamplerCrossfadeLength(int samplerIndex, float normalized) {
         return;
     }
 
-    for (auto& voice : voices) {
-        voice.samplers[samplerIndex].setCrossfadeLength(normalized);
+    samplerConfigs[samplerIndex].crossfadeLengthNorm = std::clamp(normalized, 0.0f, 1.0f);
+}
+
+void Synth::setSamplerLoopSnap(int samplerIndex, bool enabled) {
+    if (samplerIndex < 0 || samplerIndex >= SAMPLERS_PER_VOICE) {
+        return;
     }
-    freeSamplers[samplerIndex].setCrossfadeLength(normalized);
+
+    samplerConfigs[samplerIndex].snapLoop = enabled;
 }
 
 void Synth::setSamplerPlaybackSpeed(int samplerIndex, float speed) {
@@ -885,10 +1608,7 @@ void Synth::setSamplerPlaybackSpeed(int samplerIndex, float speed) {
         return;
     }
 
-    for (auto& voice : voices) {
-        voice.samplers[samplerIndex].setPlaybackSpeed(speed);
-    }
-    freeSamplers[samplerIndex].setPlaybackSpeed(speed);
+    samplerConfigs[samplerIndex].playbackSpeed = speed;
 }
 
 void Synth::setSamplerOctave(int samplerIndex, int octave) {
@@ -945,10 +1665,7 @@ void Synth::setSamplerTZFMDepth(int samplerIndex, float depth) {
         return;
     }
 
-    for (auto& voice : voices) {
-        voice.samplers[samplerIndex].setTZFMDepth(depth);
-    }
-    freeSamplers[samplerIndex].setTZFMDepth(depth);
+    samplerConfigs[samplerIndex].tzfmDepth = std::clamp(depth, 0.0f, 1.0f);
 }
 
 void Synth::setSamplerPlaybackMode(int samplerIndex, PlaybackMode mode) {
@@ -956,10 +1673,15 @@ void Synth::setSamplerPlaybackMode(int samplerIndex, PlaybackMode mode) {
         return;
     }
 
-    for (auto& voice : voices) {
-        voice.samplers[samplerIndex].setPlaybackMode(mode);
+    samplerConfigs[samplerIndex].mode = mode;
+}
+
+void Synth::setSamplerInterpolation(int samplerIndex, SamplerInterpolation interpolation) {
+    if (samplerIndex < 0 || samplerIndex >= SAMPLERS_PER_VOICE) {
+        return;
     }
-    freeSamplers[samplerIndex].setPlaybackMode(mode);
+
+    samplerConfigs[samplerIndex].interpolation = interpolation;
 }
 
 void Synth::setSamplerLevel(int samplerIndex, float level) {
@@ -967,10 +1689,7 @@ void Synth::setSamplerLevel(int samplerIndex, float level) {
         return;
     }
 
-    for (auto& voice : voices) {
-        voice.samplers[samplerIndex].setLevel(level);
-    }
-    freeSamplers[samplerIndex].setLevel(level);
+    samplerConfigs[samplerIndex].level = std::clamp(level, 0.0f, 1.0f);
 }
 
 void Synth::setSamplerKeyMode(int samplerIndex, bool enabled) {
@@ -1004,7 +1723,7 @@ void Synth::saveSamplerPhase(int samplerIndex, uint64_t phase) {
     }
 }
 
-// Get sampler state (from first voice as they're all synced)
+// Get sampler state
 int Synth::getSamplerSampleIndex(int samplerIndex) const {
     if (samplerIndex < 0 || samplerIndex >= SAMPLERS_PER_VOICE) {
         return -1;
@@ -1013,52 +1732,66 @@ int Synth::getSamplerSampleIndex(int samplerIndex) const {
 }
 
 float Synth::getSamplerLoopStart(int samplerIndex) const {
-    if (samplerIndex < 0 || samplerIndex >= SAMPLERS_PER_VOICE || voices.empty()) {
+    if (samplerIndex < 0 || samplerIndex >= SAMPLERS_PER_VOICE) {
         return 0.0f;
     }
-    return voices[0].samplers[samplerIndex].getLoopStart();
+    return samplerConfigs[samplerIndex].loopStartNorm;
 }
 
 float Synth::getSamplerLoopLength(int samplerIndex) const {
-    if (samplerIndex < 0 || samplerIndex >= SAMPLERS_PER_VOICE || voices.empty()) {
+    if (samplerIndex < 0 || samplerIndex >= SAMPLERS_PER_VOICE) {
         return 1.0f;
     }
-    return voices[0].samplers[samplerIndex].getLoopLength();
+    return samplerConfigs[samplerIndex].loopLengthNorm;
 }
 
 float Synth::getSamplerCrossfadeLength(int samplerIndex) const {
-    if (samplerIndex < 0 || samplerIndex >= SAMPLERS_PER_VOICE || voices.empty()) {
+    if (samplerIndex < 0 || samplerIndex >= SAMPLERS_PER_VOICE) {
         return 0.1f;
     }
-    return voices[0].samplers[samplerIndex].getCrossfadeLength();
+    return samplerConfigs[samplerIndex].crossfadeLengthNorm;
+}
+
+bool Synth::getSamplerLoopSnap(int samplerIndex) const {
+    if (samplerIndex < 0 || samplerIndex >= SAMPLERS_PER_VOICE) {
+        return true;
+    }
+    return samplerConfigs[samplerIndex].snapLoop;
 }
 
 float Synth::getSamplerPlaybackSpeed(int samplerIndex) const {
-    if (samplerIndex < 0 || samplerIndex >= SAMPLERS_PER_VOICE || voices.empty()) {
+    if (samplerIndex < 0 || samplerIndex >= SAMPLERS_PER_VOICE) {
         return 1.0f;
     }
-    return voices[0].samplers[samplerIndex].getPlaybackSpeed();
+    return samplerConfigs[samplerIndex].playbackSpeed;
 }
 
 float Synth::getSamplerTZFMDepth(int samplerIndex) const {
-    if (samplerIndex < 0 || samplerIndex >= SAMPLERS_PER_VOICE || voices.empty()) {
+    if (samplerIndex < 0 || samplerIndex >= SAMPLERS_PER_VOICE) {
         return 0.0f;
     }
-    return voices[0].samplers[samplerIndex].getTZFMDepth();
+    return samplerConfigs[samplerIndex].tzfmDepth;
 }
 
 PlaybackMode Synth::getSamplerPlaybackMode(int samplerIndex) const {
-    if (samplerIndex < 0 || samplerIndex >= SAMPLERS_PER_VOICE || voices.empty()) {
+    if (samplerIndex < 0 || samplerIndex >= SAMPLERS_PER_VOICE) {
         return PlaybackMode::FORWARD;
     }
-    return voices[0].samplers[samplerIndex].getPlaybackMode();
+    return samplerConfigs[samplerIndex].mode;
+}
+
+SamplerInterpolation Synth::getSamplerInterpolation(int samplerIndex) const {
+    if (samplerIndex < 0 || samplerIndex >= SAMPLERS_PER_VOICE) {
+        return SamplerInterpolation::LINEAR;
+    }
+    return samplerConfigs[samplerIndex].interpolation;
 }
 
 float Synth::getSamplerLevel(int samplerIndex) const {
-    if (samplerIndex < 0 || samplerIndex >= SAMPLERS_PER_VOICE || voices.empty()) {
+    if (samplerIndex < 0 || samplerIndex >= SAMPLERS_PER_VOICE) {
         return 1.0f;
     }
-    return voices[0].samplers[samplerIndex].getLevel();
+    return samplerConfigs[samplerIndex].level;
 }
 
 bool Synth::getSamplerKeyMode(int samplerIndex) const {
@@ -1122,25 +1855,25 @@ float Synth::getMixerOscLevelMod(int index) const {
 // Chaos generator control methods
 void Synth::setChaosParameter(int chaosIndex, float value) {
     if (chaosIndex < 0 || chaosIndex >= 4) return;
-    chaos[chaosIndex].setChaosParameter(value);
+    chaos.setChaosParameter(chaosIndex, value);
 }
 
 void Synth::setChaosClockFreq(int chaosIndex, float freq) {
     if (chaosIndex < 0 || chaosIndex >= 4) return;
-    chaos[chaosIndex].setClockFrequency(freq);
+    chaos.setClockFrequency(chaosIndex, freq);
 }
 
 void Synth::setChaosFastMode(int chaosIndex, bool fast) {
     if (chaosIndex < 0 || chaosIndex >= 4) return;
-    chaos[chaosIndex].setFastMode(fast);
+    chaos.setFastMode(chaosIndex, fast);
 }
 
 void Synth::setChaosInterpMode(int chaosIndex, int mode) {
     if (chaosIndex < 0 || chaosIndex >= 4) return;
-    chaos[chaosIndex].setInterpMode(mode);
+    chaos.setInterpMode(chaosIndex, mode);
 }
 
 void Synth::resetChaosGenerator(int chaosIndex) {
     if (chaosIndex < 0 || chaosIndex >= 4) return;
-    chaos[chaosIndex].reset();
+    chaos.reset(chaosIndex);
 }
@@ -1,74 +1,242 @@
 #ifndef SYNTH_H
 #define SYNTH_H
 
+#include <algorithm>
+#include <atomic>
 #include <cmath>
 #include <vector>
 #include "voice.h"
+#include "voice_bank.h"
+#include "voice_filter_bank.h"
+#include "oversampler.h"
 #include "brainwave_osc.h"
+#include "dsp_arena.h"
 #include "lfo.h"
 #include "chaos.h"
 #include "reverb.h"
+#include "convolution.h"
 #include "filters.hpp"
+#include "memory_stats.h"
 #include "sample_bank.h"
 #include "modulation.h"
+#include "param_snapshot.h"
+#include "profile.h"
+#include "scope_ring.h"
+#include "triple_buffer.h"
+#include "voice_pool.h"
 
-class UI; // Forward declaration
 struct SynthParameters;  // Forward declaration
 class Clock; // Forward declaration
 
-constexpr int MAX_VOICES = 8;
+// Polyphony; configure with -DWAKEFIELD_MAX_VOICES=N (CMake cache variable)
+#ifndef WAKEFIELD_MAX_VOICES
+#define WAKEFIELD_MAX_VOICES 8
+#endif
+constexpr int MAX_VOICES = WAKEFIELD_MAX_VOICES;
+static_assert(MAX_VOICES >= 1 && MAX_VOICES <= 64, "WAKEFIELD_MAX_VOICES must be 1-64");
 // Note: OSCILLATORS_PER_VOICE and SAMPLERS_PER_VOICE are defined in voice.h
 
+// What the UI shows of the audio thread's state, captured once per audio
+// callback by Synth::publishTelemetry
+struct SynthTelemetry {
+    uint32_t callbacks = 0;            // Published snapshots so far
+    int activeVoices = 0;
+    bool voiceActive[MAX_VOICES] = {};
+    int voiceNote[MAX_VOICES] = {};
+    float voiceEnvelope[MAX_VOICES] = {};
+    float lfoValue[4] = {};
+    float lfoPhase[4] = {};
+    float chaosX[4] = {};
+    float chaosY[4] = {};
+};
+
 class Synth {
 public:
     Synth(float sampleRate);
+    ~Synth();
+    float getSampleRate() const { return sampleRate; }
     
-    void process(float* output, unsigned int nFrames, unsigned int nChannels);
-    
+    // Render nFrames into separate left/right planes (voices, filter, reverb)
+    void process(float* left, float* right, unsigned int nFrames);
+
+    // Post-mix stages. processEffects resolves them into a chain once per
+    // block: a bypassed stage drops out and each remaining one runs its
+    // current type's block process, in the order the settings give
+    enum class EffectStage : uint8_t { FILTER, REVERB };
+    static constexpr int kEffectStages = 2;
+
+    // Filter and reverb settings as last set through the setters below. The
+    // effects read them only through processEffects, so the voice and effect
+    // stages can run on different threads a block apart.
+    struct EffectSettings {
+        bool filterEnabled = false;
+        int filterType = 0;
+        float filterCutoff = 1000.0f;
+        float filterGain = 0.0f;
+        float filterResonance = 0.0f;
+        float filterDrive = 0.0f;
+        float filterFeedbackHP = 0.0f;
+        bool filterPerVoice = false;    // Voice stage filters Lowpass, Highpass and Ladder
+        float filterEnvAmount = 0.0f;   // Per-voice cutoff offset at full envelope (octaves)
+        int filterOversample = 1;       // Mix ladder rate factor (1, 2 or 4)
+        OversampleQuality oversampleQuality = OversampleQuality::Normal;
+        bool filterChanged = false;     // Coefficients need recomputing
+
+        // The voice stage runs this filter, so the effects stage skips it
+        bool filtersVoices() const {
+            return filterEnabled && filterPerVoice
+                && (filterType == 0 || filterType == 1 || filterType == 4);
+        }
+        bool reverbEnabled = false;
+        int reverbType = 0;             // ReverbType: LATEDIFF runs the tank, the rest Greyhole
+        bool reverbHalfRate = false;    // Both engines run at half the sample rate
+        GreyholeReverb::Parameters reverbParams{};
+        bool reverbChanged = false;     // Faust sliders need writing
+        EffectStage order[kEffectStages] = {EffectStage::FILTER, EffectStage::REVERB};
+    };
+
+    // process() is renderVoices() followed by processEffects() with the
+    // settings taken from takeEffectSettings()
+    void renderVoices(float* left, float* right, unsigned int nFrames);
+    void processEffects(float* left, float* right, unsigned int nFrames,
+                        const EffectSettings& settings);
+
+    // Current settings; clears the changed flags so each change is applied once
+    EffectSettings takeEffectSettings();
+
+    // Before the stream starts: render blocks of nFrames into a scratch
+    // buffer, silent for the first half and then with every voice held,
+    // cycling the filter types (mix and per voice) and reverb engines, so
+    // the first live block finds its code and state warm. Voices, filters
+    // and reverbs are reset afterwards and the effect settings reapplied.
+    // Call only while no callback runs
+    void warmUp(unsigned int nFrames, int blocks);
+
     void noteOn(int midiNote, int velocity);
     void noteOff(int midiNote);
-    
+
+    // ADSR for every voice (seconds, sustain 0-1); cheap to call each
+    // buffer, as nothing is recomputed unless a value changed
     void updateEnvelopeParameters(float attack, float decay, float sustain, float release);
-    void setMasterVolume(float volume) { masterVolume = volume; }
+
+    // Render oscillators through the SoA voice bank when no FM routing is active
+    void setVoiceBankEnabled(bool enabled) { voiceBankEnabled = enabled; }
+    bool isVoiceBankEnabled() const { return voiceBankEnabled; }
+
+    // Render voices on this many helper threads plus the audio thread
+    // (0 = all on the audio thread). Call only while no callback runs.
+    // Buffers with few active voices still render inline.
+    bool setVoiceThreads(int helpers) { return voicePool.start(helpers); }
+    int getVoiceThreads() const { return voicePool.getHelperCount(); }
+    uint64_t getStolenVoiceTasks() const { return voicePool.getStolenTasks(); }
+    void setMasterVolume(float volume) {
+        masterVolume = volume;
+        masterRampFrames = 0;
+    }
+    // Master volume for each frame of the coming buffer, so a smoothed move
+    // glides instead of stepping at the buffer start. Frames past
+    // kModBufferFrames hold the last value; setMasterVolume ends the ramp
+    void setMasterVolumeRamp(const float* perFrame, unsigned int nFrames);
     
-    // Link to UI for oscilloscope
-    void setUI(UI* ui_ptr) { ui = ui_ptr; }
+    // The modulation matrix slots. The engine owns them so it runs without
+    // a UI; the UI edits them in place and the audio thread recompiles the
+    // matrix when they change
+    ModulationSlot* getModulationSlots() { return modulationSlots; }
+
+    // Modulation slots to read instead of the engine's (session replay);
+    // nullptr goes back to the engine's table
+    void setModulationSlots(const ModulationSlot* slots) { slotOverride = slots; }
+
+    // Oscilloscope feed on or off (off when nothing draws it: --headless)
+    void setScopeEnabled(bool enabled) { scopeEnabled = enabled; }
 
     // Link to SynthParameters for FM matrix access
     void setParams(SynthParameters* params_ptr);
 
+    // Per-buffer parameter snapshot published by the UI thread. When set, the
+    // audio path reads FM depths, mute/solo and LFO/chaos state from it instead
+    // of the SynthParameters atomics.
+    void setParameterBlock(const SynthParamBlock* block) { paramBlock = block; }
+
     // Link global clock for modulation sources and synced modules
     void setClock(Clock* clockPtr) { clock = clockPtr; }
     Clock* getClock() const { return clock; }
 
     // Brainwave oscillator control
     // Reverb control
-    void setReverbEnabled(bool enabled) { reverbEnabled = enabled; }
+    void setReverbEnabled(bool enabled) { effectSettings.reverbEnabled = enabled; }
+    void setReverbType(int type) { effectSettings.reverbType = type; }
+    void setReverbHalfRate(bool enabled) { effectSettings.reverbHalfRate = enabled; }
+
+    // Impulse response for the Convolution type (WAV). Not on the audio
+    // thread: the spectra are built here and picked up at the next block
+    bool loadReverbImpulse(const std::string& path, std::string& error) {
+        return convolutionReverb.loadImpulseFile(path, error);
+    }
     void updateReverbParameters(float delayTime, float size, float damping, float mix, float decay, 
                                 float diffusion, float modDepth, float modFreq);
     
+    // Post-mix stage order, every stage once (false and unchanged otherwise)
+    bool setEffectOrder(const EffectStage* order);
+
     // Filter control
-    void setFilterEnabled(bool enabled) { filterEnabled = enabled; }
+    void setFilterEnabled(bool enabled) { effectSettings.filterEnabled = enabled; }
     void updateFilterParameters(int type, float cutoff, float gain,
                                 float resonance, float drive, float feedbackHP);
 
+    // Filter each voice before the mix instead of the mix itself, with the
+    // cutoff following the voice's envelope by envAmount octaves. Shelves
+    // stay on the mix
+    void setFilterPerVoice(bool perVoice, float envAmount);
+
+    // Run the mix ladder at filterFactor and the voices' FM path at fmFactor
+    // times the engine rate (1, 2 or 4), through half-band filters of this
+    // quality. The other stages stay at the engine rate
+    void setOversampling(int filterFactor, int fmFactor, OversampleQuality quality);
+
+    // Start new notes only on the first count voices (stealing among them);
+    // voices above keep sounding until they end. Audio thread
+    void setVoiceLimit(int count);
+    int getFMOversample() const { return fmOversample; }
+    OversampleQuality getOversampleQuality() const { return oversampleQuality; }
+
     // LFO control
     void updateLFOParameters(int lfoIndex, float period, int syncMode, int shape, float morph,
                              float duty, bool flip, bool resetOnNote, float tempo);
 
-    // LFO processing (called per audio buffer)
+    // LFO processing (called per audio buffer, before renderVoices): each
+    // LFO renders one value per frame of the buffer
     void processLFOs(float sampleRate, unsigned int nFrames);
 
-    // Get LFO outputs (for modulation matrix)
+    // Get LFO outputs (last rendered frame, for the UI)
     float getLFOOutput(int lfoIndex) const;
 
-    // Chaos processing (called per audio buffer)
+    // Chaos processing (called per audio buffer, before renderVoices): each
+    // generator renders its X and Y outputs one value per frame
     void processChaos(unsigned int nFrames);
 
-    // Get chaos outputs (for modulation matrix and FM)
+    // Get chaos outputs (last rendered frame, for the UI)
     float getChaosOutput(int chaosIndex) const;
     float getChaosOutputY(int chaosIndex) const;
 
+    // Oscilloscope feed: the first voice's output, filled a block at a time
+    const ScopeRing& getScope() const { return scope; }
+
+    // Spectrum analyzer feeds: the left channel as it enters the mix
+    // filter and as it leaves the effects, a block at a time. Filled only
+    // while enabled (the UI's SPECTRUM page is showing)
+    void setSpectrumEnabled(bool enabled) { spectrumEnabled.store(enabled, std::memory_order_relaxed); }
+    const ScopeRing& getSpectrumInput() const { return spectrumInput; }
+    const ScopeRing& getSpectrumOutput() const { return spectrumOutput; }
+
+    // The modulation matrix is evaluated every this many frames, reading
+    // the LFO and chaos buffers at the first frame of each block (1 =
+    // every sample). Call only while no callback runs.
+    void setModulationControlFrames(unsigned int frames) {
+        modControlFrames = std::clamp(frames, 1u, kVoiceBufferFrames);
+    }
+    unsigned int getModulationControlFrames() const { return modControlFrames; }
+
     // Access modulation slot definitions (read-only)
     const ModulationSlot* getModulationSlot(int index) const;
 
@@ -145,7 +313,18 @@ public:
 
     int getActiveVoiceCount() const;
 
-    // Voice envelope debugging
+    // Audio thread, once per callback after rendering: publish voice, LFO
+    // and chaos state for the UI
+    void publishTelemetry();
+
+    // UI thread: the newest published telemetry. The reference stays valid
+    // and unchanged until the next call
+    const SynthTelemetry& readTelemetry() {
+        telemetry.takeFresh();
+        return telemetry.front();
+    }
+
+    // Voice envelope debugging (audio thread; the UI reads telemetry)
     bool isVoiceActive(int voiceIndex) const;
     float getVoiceEnvelopeValue(int voiceIndex) const;
     int getVoiceNote(int voiceIndex) const;
@@ -154,6 +333,13 @@ public:
                             float baseFreq, float morph, float duty,
                             float ratio, float offsetHz, float amp, float level);
 
+    // Active FM routes for the current buffer (snapshotted at the top of process)
+    const FMRoutingTable& getFMRoutes() const { return fmRoutes; }
+
+    // Mute/solo result for the current buffer: 1 = audible, 0 = silenced
+    float getOscGate(int index) const { return oscGates[index]; }
+    float getSamplerGate(int index) const { return samplerGates[index]; }
+
     // Get oscillator base amp (for voice mixing with modulation)
     float getOscillatorBaseAmp(int index) const {
         if (index < 0 || index >= OSCILLATORS_PER_VOICE) return 0.0f;
@@ -168,16 +354,32 @@ public:
 
     // Sample bank management
     SampleBank* getSampleBank() { return &sampleBank; }
+    // Voices, their buffers, modulation buffers and reverb state
+    const DspArena& getArena() const { return arena; }
     const SampleBank* getSampleBank() const { return &sampleBank; }
 
     // Sampler control
+    // Prepares the sample on the calling (UI) thread and hands it to the
+    // audio thread, which swaps it in at the next buffer with a short fade
     void setSamplerSample(int samplerIndex, int sampleIndex);
+    // The same for every sampler at once (-1 leaves one as it is), with
+    // all their files read ahead together first
+    void setSamplerSamples(const int* sampleIndices);
+    // Free samples retired by reloads once the audio thread has let go
+    void reclaimRetiredSamples();
+    // The same, then hold the bank to the samples memory budget by evicting
+    // samples no sampler holds. UI thread, each frame
+    void trimSamples();
     void setSamplerLoopStart(int samplerIndex, float normalized);
     void setSamplerLoopLength(int samplerIndex, float normalized);
     void setSamplerCrossfadeLength(int samplerIndex, float normalized);
+    void setSamplerLoopSnap(int samplerIndex, bool enabled);
     void setSamplerPlaybackSpeed(int samplerIndex, float speed);
     void setSamplerTZFMDepth(int samplerIndex, float depth);
     void setSamplerPlaybackMode(int samplerIndex, PlaybackMode mode);
+    void setSamplerInterpolation(int samplerIndex, SamplerInterpolation interpolation);
+    // Best interpolation any slot renders with, whatever it is set to. Audio thread
+    void setSamplerInterpolationCap(SamplerInterpolation cap) { samplerInterpolationCap = cap; }
     void setSamplerOctave(int samplerIndex, int octave);
     void setSamplerTune(int samplerIndex, float tune);
     void setSamplerSyncMode(int samplerIndex, int mode);
@@ -191,9 +393,11 @@ public:
     float getSamplerLoopStart(int samplerIndex) const;
     float getSamplerLoopLength(int samplerIndex) const;
     float getSamplerCrossfadeLength(int samplerIndex) const;
+    bool getSamplerLoopSnap(int samplerIndex) const;
     float getSamplerPlaybackSpeed(int samplerIndex) const;
     float getSamplerTZFMDepth(int samplerIndex) const;
     PlaybackMode getSamplerPlaybackMode(int samplerIndex) const;
+    SamplerInterpolation getSamplerInterpolation(int samplerIndex) const;
     float getSamplerLevel(int samplerIndex) const;
     bool getSamplerKeyMode(int samplerIndex) const;
     int getSamplerOctave(int samplerIndex) const;
@@ -214,39 +418,154 @@ public:
 private:
     float sampleRate;
     float masterVolume;
-    bool reverbEnabled;
-    bool filterEnabled;
-    int currentFilterType;
-    UI* ui;
+    EffectSettings effectSettings;   // Written by the setters, read by takeEffectSettings
+    int currentFilterType;           // Effects stage only
+    float currentFilterCutoff = 1000.0f;    // Effects stage only; the mix filter glides to it
+    bool mixFilterRunning = false;          // Effects stage only; false starts the next glide at the target
     SynthParameters* params;  // Pointer to parameters (for FM matrix)
     Clock* clock;
 
-    std::vector<Voice> voices;
+    // Audio-thread state in processing order: modulation buffers, voices,
+    // voice buffers, reverbs. Declared before everything carved from it
+    DspArena arena;
+    static size_t arenaBytes(float sampleRate);
+    static size_t reverbArenaBytes(float sampleRate);
+    // The arena split between voices and reverb lines, and the scope rings
+    memstats::Account voiceMemory{memstats::VOICES};
+    memstats::Account reverbMemory{memstats::REVERB};
+    memstats::Account scopeMemory{memstats::SCOPE};
+    float* modSourceBuffers = nullptr;      // kModBuffers x kModBufferFrames, see below
+
+    DspArena::Array<Voice> voices;
+
+    // ADSR of every voice's envelope: updateEnvelopeParameters writes it,
+    // the envelopes take up a new version when they next run
+    EnvelopeParams envelopeParams;
+
+    // Voice allocation. Bit v of activeVoiceMask is set while voices[v] is
+    // active; a voice clears its own flag when its envelope ends, and
+    // syncVoiceAllocation() catches up after each render. With every voice
+    // busy a note steals one: the voice fades out over kStealReleaseSeconds
+    // (so it does not click) and the note starts on it once it is silent
+    static constexpr uint64_t kAllVoicesMask = ~0ull >> (64 - MAX_VOICES);
+    static constexpr float kStealReleaseSeconds = 0.005f;
+    struct PendingNote {
+        int note = -1;
+        int velocity = 0;
+        bool released = false;                  // Note off arrived while waiting
+    };
+    uint64_t activeVoiceMask = 0;
+    uint64_t voiceLimitMask = kAllVoicesMask;   // Voices new notes may start on
+    uint64_t stealingVoiceMask = 0;             // Fading out for pendingNotes[v]
+    PendingNote pendingNotes[MAX_VOICES];
+    uint32_t voiceStartOrder[MAX_VOICES] = {};  // noteOnCounter when the voice last started or was stolen
+    uint32_t noteOnCounter = 0;
+
+    // One SoA bank per group of kLanes voices
+    static constexpr int kVoiceGroups = (MAX_VOICES + VoiceBank::kLanes - 1) / VoiceBank::kLanes;
+    VoiceBank voiceBanks[kVoiceGroups];
+
+    // Voices render into their own buffer, then mix in voice order, so the
+    // result does not depend on which thread rendered which voice
+    static constexpr unsigned int kVoiceBufferFrames = 1024;
+    float* voiceBuffers = nullptr;              // MAX_VOICES x kVoiceBufferFrames
+    struct VoiceRenderJob {
+        Synth* synth;
+        bool useBank;
+        unsigned int frames;
+        int taskCount;
+        int tasks[MAX_VOICES];                  // Voice index, or group index with the bank
+        bool wasActive[MAX_VOICES];
+        int endFrame[MAX_VOICES];               // Where a voice went silent in this buffer, or -1
+        bool ringing[MAX_VOICES];               // Ended, per-voice filter still ringing out
+        float chunkEnvelope[MAX_VOICES][kVoiceBufferFrames / VOICE_BLOCK_SIZE];  // At each chunk start
+        unsigned int base;                      // Buffer offset of the current piece
+        profile::Accumulator voiceTimers[MAX_VOICES];
+    };
+    VoiceRenderJob renderJob;
+    static void renderVoiceTask(void* context, int task);
+
+    // Per-voice filter mode: one SoA filter bank per voice group, run over
+    // the voice buffers a chunk at a time after the voices render. Lanes
+    // are not cleared on a new note, so a reused voice carries on through
+    // its filter as it would through the mix filter
+    static constexpr float kVoiceFilterTailSeconds = 0.25f;
+    VoiceFilterBank voiceFilters[kVoiceGroups];
+    int voiceFilterTail[MAX_VOICES] = {};       // Frames left to ring out after the voice ended
+    bool voiceFiltersRunning = false;
+    void filterVoices(const VoiceRenderJob& job);
+    FMRoutingTable fmRoutes;
+    const SynthParamBlock* paramBlock = nullptr;
+    float oscGates[OSCILLATORS_PER_VOICE] = {1.0f, 1.0f, 1.0f, 1.0f};
+    float samplerGates[SAMPLERS_PER_VOICE] = {1.0f, 1.0f, 1.0f, 1.0f};
+    bool voiceBankEnabled = false;
+    int fmOversample = 1;
+    OversampleQuality oversampleQuality = OversampleQuality::Normal;
     GreyholeReverb reverb;
+    LateDiffReverb lateDiffReverb;
+    ConvolutionReverb convolutionReverb;
+    int currentReverbType = 0;          // Type that ran last; the incoming engine is cleared on a switch
 
     // 4 global LFOs for modulation
-    LFO lfos[4];
+    LFOBank lfos;
 
-    // 4 global chaos generators for modulation
-    ChaosGenerator chaos[4];
+    // 4 global chaos generators for modulation, one per lane of the bank
+    ChaosBank chaos;
     float chaosOutputs[4] = {0.0f, 0.0f, 0.0f, 0.0f};  // Cached chaos outputs
     ModulationOutputs lastGlobalModOutputs;
 
+    ScopeRing scope;
+    bool scopeEnabled = true;
+    ScopeRing spectrumInput;
+    ScopeRing spectrumOutput;
+    std::atomic<bool> spectrumEnabled{false};
+    TripleBuffer<SynthTelemetry> telemetry;
+    uint32_t telemetryCallbacks = 0;
+
+    // Per-frame source buffers: LFO 1-4, then chaos 1-4 X, then chaos 1-4 Y,
+    // then the master volume ramp, kModBufferFrames each. Frames past the end of a longer audio buffer
+    // read the last stored value. renderVoices may be called several times
+    // per buffer (split at note events); the cursor is where the next call
+    // starts within the buffers
+    static constexpr unsigned int kModBufferFrames = 4096;
+    static constexpr int kLfoModBuffer = 0;
+    static constexpr int kChaosXModBuffer = 4;
+    static constexpr int kChaosYModBuffer = 8;
+    static constexpr int kMasterVolumeBuffer = 12;
+    static constexpr int kModBuffers = kMasterVolumeBuffer + 1;
+    unsigned int lfoBufferFrames = 0;       // Stored this buffer; 0 until processLFOs runs
+    unsigned int chaosBufferFrames = 0;     // Same for processChaos
+    unsigned int masterRampFrames = 0;      // Stored by setMasterVolumeRamp; 0 = constant masterVolume
+    unsigned int modBufferCursor = 0;
+    unsigned int modReadFrame = 0;          // Frame the matrix reads sources at
+    unsigned int modControlFrames = VOICE_BLOCK_SIZE;
+    uint64_t modFramePosition = 0;         // Frames rendered so far, for the control grid
+    float* modSourceBuffer(int index) {
+        return modSourceBuffers + static_cast<size_t>(index) * kModBufferFrames;
+    }
+    float readModSource(int index, unsigned int storedFrames, float current) const;
+
+    // Compiled modulation matrix (rebuilt when the slot table changes)
+    ModulationSlot modulationSlots[kModulationSlotCount];
+    ModulationProgram modProgram;
+    ModulationSlot compiledSlots[kModulationSlotCount];
+    bool modProgramValid = false;
+    const ModulationSlot* slotOverride = nullptr;
+    const ModulationSlot* slotTable() const;
+
     int samplerPhaseSource[SAMPLERS_PER_VOICE] = {
         kClockModSourceIndex, kClockModSourceIndex,
         kClockModSourceIndex, kClockModSourceIndex
     };
     int samplerPhaseType[SAMPLERS_PER_VOICE] = {0, 0, 0, 0};
 
-    // Stereo filters (left and right channel)
-    OnePoleTPT filterL;
-    OnePoleTPT filterR;
-    Ladder8PoleZdf ladderFilterL;
-    Ladder8PoleZdf ladderFilterR;
-    OnePoleHighShelfBLT highShelfL;
-    OnePoleHighShelfBLT highShelfR;
-    OnePoleLowShelfBLT lowShelfL;
-    OnePoleLowShelfBLT lowShelfR;
+    // Stereo filters: one set of coefficients, both channels' state
+    // (the ladder solves L and R in lanes 0 and 1 of one vector)
+    OnePoleTPT filter;
+    Ladder8PoleZdfX4 ladderFilter;
+    Oversampler ladderOversampler;      // The ladder runs at its factor x sampleRate
+    OnePoleHighShelfBLT highShelf;
+    OnePoleLowShelfBLT lowShelf;
 
     // Per-oscillator base amps (control-rate, modulation target)
     // Combined with ampMod, then multiplied by mix levels
@@ -261,7 +580,28 @@ private:
 
     // Current sample index for each sampler (shared across all voices)
     int currentSampleIndices[SAMPLERS_PER_VOICE] = {-1, -1, -1, -1};
+
+    // Sample hot-swap, one slot per sampler index. The UI thread publishes a
+    // prepared sample and bumps requested; the audio thread hands it to the
+    // samplers at the next buffer and sets acknowledged once none of them
+    // is still fading out the previous sample
+    struct SampleSwapSlot {
+        std::atomic<const SampleData*> pending{nullptr};
+        std::atomic<uint32_t> requested{0};
+        std::atomic<uint32_t> acknowledged{0};
+        uint32_t applied = 0;  // Audio thread only
+    };
+    SampleSwapSlot sampleSwaps[SAMPLERS_PER_VOICE];
+    const SampleData* publishedSamples[SAMPLERS_PER_VOICE] = {nullptr, nullptr, nullptr, nullptr};  // UI thread
+    void publishSamplerSample(int samplerIndex, const SampleData* sample);
+    // Every published sample has reached the samplers
+    bool sampleSwapsSettled() const;
+    void applySampleSwaps();
     bool samplerKeyModes[SAMPLERS_PER_VOICE] = {true, true, true, true};
+    // Settings of each sampler slot, read by its samplers in every voice and
+    // by the free one
+    SamplerConfig samplerConfigs[SAMPLERS_PER_VOICE];
+    SamplerInterpolation samplerInterpolationCap = SamplerInterpolation::SINC;
     Sampler freeSamplers[SAMPLERS_PER_VOICE];
 
     // Sampler pitch parameters (octave and tune)
@@ -275,10 +615,36 @@ private:
     // Last phase position for Note Reset (persists across voices)
     uint64_t samplerLastPhases[SAMPLERS_PER_VOICE] = {0, 0, 0, 0};
 
-    int findFreeVoice();
+    static constexpr int kParallelVoiceThreshold = 4;   // Fewer active voices render inline
+    VoiceThreadPool voicePool;   // Last member: helpers stop before anything they touch goes away
+
+    int findFreeVoice() const;
+    int findVoiceToSteal() const;
+    void startVoice(int voiceIndex, int midiNote, int velocity);
+    void syncVoiceAllocation();
+    void refreshModulationProgram();
+    void refreshBufferState();
+    void applyEffectSettings(const EffectSettings& settings);
+
+    // One post-mix stage's block process for its current type
+    using EffectProcess = void (Synth::*)(float* left, float* right, int n);
+    int buildEffectChain(const EffectSettings& settings, EffectProcess* chain);
+    void processLowpass(float* left, float* right, int n);
+    void processHighpass(float* left, float* right, int n);
+    void processHighShelf(float* left, float* right, int n);
+    void processLowShelf(float* left, float* right, int n);
+    void processLadder(float* left, float* right, int n);
+    void processGreyhole(float* left, float* right, int n);
+    void processLateDiff(float* left, float* right, int n);
+    void processConvolution(float* left, float* right, int n);
+    void evaluateModulationRoutes(const ModulationRoute* routes, int count,
+                                  const Voice* voiceContext, ModulationOutputs& outputs);
     float midiNoteToFrequency(int midiNote);
     void refreshSamplerPhaseDrivers();
     float normalizePhaseForDriver(float value, int type) const;
+    ModulationOutputs applyVoiceModulation();
+    void renderFreeSamplers(float* left, unsigned int nFrames, const ModulationOutputs& globalModOutputs,
+                            float masterGain);
 };
 
 #endif // SYNTH_H
@@ -7,6 +7,7 @@ Track::Track(int trackId, int patternLength, Subdivision subdivision)
     , constraints()
     , markovChain()
     , euclideanPattern(7, 16, 0)
+    , rng(rng::stream(rng::Subsystem::TRACK_PATTERN, static_cast<uint32_t>(trackId)))
     , muted(false)
     , solo(false)
 {
@@ -52,15 +53,15 @@ void Track::generatePattern() {
         }
     }
 
-    pattern.generateFromConstraints(constraints, markovChain, euclideanPattern);
+    pattern.generateFromConstraints(constraints, markovChain, euclideanPattern, rng);
 }
 
 void Track::regenerateUnlocked() {
-    pattern.regenerateUnlocked(constraints, markovChain, euclideanPattern);
+    pattern.regenerateUnlocked(constraints, markovChain, euclideanPattern, rng);
 }
 
 void Track::mutate(float amount) {
-    pattern.mutate(amount);
+    pattern.mutate(amount, rng);
 }
 
 void Track::setSubdivision(Subdivision subdiv) {
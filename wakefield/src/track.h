@@ -5,6 +5,8 @@
 #include "constraint.h"
 #include "markov.h"
 #include "euclidean.h"
+#include "automation.h"
+#include "rng.h"
 #include <string>
 
 // A single track in the sequencer (independent pattern + constraints)
@@ -33,6 +35,16 @@ public:
     EuclideanPattern& getEuclideanPattern() { return euclideanPattern; }
     const EuclideanPattern& getEuclideanPattern() const { return euclideanPattern; }
 
+    // Parameter automation over the pattern loop
+    AutomationClip& getAutomation() { return automation; }
+    const AutomationClip& getAutomation() const { return automation; }
+
+    // Random stream for generation and mutation, seeded from the session
+    // seed and the track id when the track is built; it travels with the
+    // track's copy through the pattern worker like the Markov state
+    rng::Stream& getRng() { return rng; }
+    const rng::Stream& getRng() const { return rng; }
+
     // Generation
     void generatePattern();
     void regenerateUnlocked();
@@ -56,6 +68,8 @@ private:
     MusicalConstraints constraints;
     MarkovChain markovChain;
     EuclideanPattern euclideanPattern;
+    AutomationClip automation;
+    rng::Stream rng;
     bool muted;
     bool solo;
 };
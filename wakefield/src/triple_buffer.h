@@ -0,0 +1,46 @@
+#ifndef TRIPLE_BUFFER_H
+#define TRIPLE_BUFFER_H
+
+#include <atomic>
+
+// Latest-value hand-off from one writer thread to one reader thread. The
+// writer fills back() and publishes it; the reader switches to the newest
+// published value with takeFresh() and reads front(). Only slot indices
+// change hands, so neither side waits, allocates or copies, and the reader
+// never sees a value being written. A value published over an unread one
+// replaces it.
+template <typename T>
+class TripleBuffer {
+public:
+    TripleBuffer() = default;
+    explicit TripleBuffer(const T& initial)
+        : slots{initial, initial, initial} {}
+
+    // Writer. back() still holds whatever that slot last carried, so a
+    // writer fills every field it publishes
+    T& back() { return slots[backIndex]; }
+    void publish() {
+        backIndex = middle.exchange(backIndex | kFresh, std::memory_order_acq_rel) & kIndexMask;
+    }
+
+    // Reader: switch to the newest published value, if any
+    bool takeFresh() {
+        if ((middle.load(std::memory_order_relaxed) & kFresh) == 0) {
+            return false;
+        }
+        frontIndex = middle.exchange(frontIndex, std::memory_order_acq_rel) & kIndexMask;
+        return true;
+    }
+    const T& front() const { return slots[frontIndex]; }
+
+private:
+    static constexpr int kIndexMask = 3;
+    static constexpr int kFresh = 4;    // Set while the middle slot is unread
+
+    T slots[3];
+    int frontIndex = 0;
+    int backIndex = 1;
+    std::atomic<int> middle{2};
+};
+
+#endif // TRIPLE_BUFFER_H
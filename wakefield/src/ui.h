@@ -9,9 +9,19 @@
 #include <functional>
 #include "oscillator.h"
 #include "cpu_monitor.h"
+#include "quality_governor.h"
+#include "profile.h"
 #include "modulation.h"
+#include "param_snapshot.h"
+#include "param_morph.h"
+#include "triple_buffer.h"
+#include "rt_setup.h"
+#include "sample_browser_worker.h"
+#include "preset_library.h"
+#include "spectrum_analyzer.h"
 
 class Synth;  // Forward declaration
+struct SynthTelemetry;  // Forward declaration
 struct SampleData;  // Forward declaration
 
 // Filter types
@@ -28,7 +38,10 @@ enum class ReverbType {
     PLATE = 1,
     ROOM = 2,
     HALL = 3,
-    SPRING = 4
+    SPRING = 4,
+    LATEDIFF = 5,   // crossbow late-diffusion tank (LateDiffReverb)
+    CONVOLUTION = 6 // Partitioned convolution with an impulse response (ConvolutionReverb);
+                    // the others run Greyhole
 };
 
 // Parameter types for inline editing
@@ -83,6 +96,15 @@ struct SynthParameters {
     std::atomic<float> filterResonance{0.4f};
     std::atomic<float> filterDrive{1.0f};
     std::atomic<float> filterFeedbackHP{200.0f};
+    std::atomic<bool> filterPerVoice{false};    // Filter each voice (LP, HP, Ladder) instead of the mix
+    std::atomic<float> filterEnvAmount{0.0f};   // Per-voice cutoff offset at full envelope (octaves)
+    std::atomic<int> filterOversample{0};       // Mix ladder: 0=off, 1=2x, 2=4x
+
+    // Oversampling of the voice FM path, and the half-band quality used by
+    // every oversampled stage
+    std::atomic<int> fmOversample{0};           // 0=off, 1=2x, 2=4x
+    std::atomic<int> oversampleQuality{1};      // 0=draft, 1=normal, 2=high
+    std::atomic<int> reverbRate{0};             // 0=full, 1=half sample rate
     
     // Generic MIDI CC Learn for new parameter system
     std::atomic<bool> midiLearnActive{false};
@@ -100,8 +122,9 @@ struct SynthParameters {
     std::atomic<int> ccLearnTarget{-1};  // Which parameter to learn (-1 = none)
     
     // Looper parameters
-    std::atomic<int> currentLoop{0};       // 0-3
+    std::atomic<int> currentLoop{0};       // 0 to loop count - 1
     std::atomic<float> overdubMix{0.6f};   // global overdub wet amount
+    std::atomic<int> loopQuantize{0};      // 0=off, 1=beat, 2=bar (while the clock runs)
     
     // MIDI Learn for loop controls
     std::atomic<int> loopRecPlayCC{-1};
@@ -110,6 +133,11 @@ struct SynthParameters {
     std::atomic<int> loopClearCC{-1};
     std::atomic<bool> loopMidiLearnMode{false};
     std::atomic<int> loopMidiLearnTarget{-1};  // 0=rec, 1=overdub, 2=stop, 3=clear
+
+    // Bumped after any CC mapping above (or presetMorphCC) is written; the
+    // audio thread rebuilds its CC dispatch table when it moves
+    std::atomic<uint32_t> ccMapSerial{0};
+    void ccMappingsChanged() { ccMapSerial.fetch_add(1, std::memory_order_release); }
     
     // Oscillator parameters - 4 independent oscillators per voice
     // Oscillator 1 (index 0)
@@ -195,25 +223,6 @@ struct SynthParameters {
     std::atomic<bool> lfo4ResetOnNote{false};
     std::atomic<int> lfo4Shape{0}; // 0=PD, 1=Pulse
 
-    std::atomic<float> lfoVisualValue[4] = {0.0f, 0.0f, 0.0f, 0.0f};
-    std::atomic<float> lfoVisualPhase[4] = {0.0f, 0.0f, 0.0f, 0.0f};
-
-    float getLfoVisualValue(int index) const {
-        if (index < 0 || index >= 4) return 0.0f;
-        return lfoVisualValue[index].load();
-    }
-
-    float getLfoVisualPhase(int index) const {
-        if (index < 0 || index >= 4) return 0.0f;
-        return lfoVisualPhase[index].load();
-    }
-
-    void setLfoVisualState(int index, float value, float phase) {
-        if (index < 0 || index >= 4) return;
-        lfoVisualValue[index].store(value);
-        lfoVisualPhase[index].store(phase);
-    }
-
     // Envelope parameters - 4 independent modulation envelopes
     std::atomic<float> env1Attack{0.01f};
     std::atomic<float> env1Decay{0.1f};
@@ -249,32 +258,24 @@ struct SynthParameters {
     std::atomic<int> chaos1InterpMode{0};          // 0=LINEAR, 1=CUBIC, 2=HOLD
     std::atomic<bool> chaos1FastMode{false};       // Fast (audio rate) vs slow (low rate)
     std::atomic<bool> chaos1Running{true};         // Run/stop state
-    std::atomic<float> chaos1VisualX{0.0f};        // Current X for visualization
-    std::atomic<float> chaos1VisualY{0.0f};        // Current Y for visualization
 
     std::atomic<float> chaos2Parameter{0.918f};
     std::atomic<float> chaos2ClockFreq{1.0f};
     std::atomic<int> chaos2InterpMode{0};
     std::atomic<bool> chaos2FastMode{false};
     std::atomic<bool> chaos2Running{true};
-    std::atomic<float> chaos2VisualX{0.0f};
-    std::atomic<float> chaos2VisualY{0.0f};
 
     std::atomic<float> chaos3Parameter{0.918f};
     std::atomic<float> chaos3ClockFreq{1.0f};
     std::atomic<int> chaos3InterpMode{0};
     std::atomic<bool> chaos3FastMode{false};
     std::atomic<bool> chaos3Running{true};
-    std::atomic<float> chaos3VisualX{0.0f};
-    std::atomic<float> chaos3VisualY{0.0f};
 
     std::atomic<float> chaos4Parameter{0.918f};
     std::atomic<float> chaos4ClockFreq{1.0f};
     std::atomic<int> chaos4InterpMode{0};
     std::atomic<bool> chaos4FastMode{false};
     std::atomic<bool> chaos4Running{true};
-    std::atomic<float> chaos4VisualX{0.0f};
-    std::atomic<float> chaos4VisualY{0.0f};
 
     // FM Matrix - audio-rate frequency modulation routing
     // fmMatrix[target][source] = depth (0.0 to 1.0)
@@ -849,6 +850,179 @@ struct SynthParameters {
         const float clamped = std::max(-0.99f, std::min(0.99f, depth));
         fmMatrix[target][source] = clamped;
     }
+
+    // ── Snapshot publishing ─────────────────────────────────────────────
+    // Bumped by writers on the audio thread (MIDI CC) so a snapshot captured
+    // before their write is never applied over it.
+    std::atomic<uint32_t> writeEpoch{0};
+    ParamSnapshotChannel snapshotChannel;
+
+    // Bumped after a preset's values are stored; the audio thread fades
+    // over a block whose serial differs from the one it is playing
+    std::atomic<uint32_t> presetSerial{0};
+
+    // Preset morph: position from A (0) to B (1), and the CC that drives it
+    std::atomic<float> presetMorph{0.0f};
+    std::atomic<int> presetMorphCC{-1};
+
+    // Morph from UI thread to audio thread; the audio thread applies the
+    // newest one to every block while it is active
+    TripleBuffer<ParamMorph> morphChannel;
+
+    // UI thread: morph between a and b, or stop morphing
+    bool startPresetMorph(const SynthParamBlock& a, const SynthParamBlock& b) {
+        const bool prepared = morphChannel.back().prepare(a, b);
+        morphChannel.publish();
+        return prepared;
+    }
+    void stopPresetMorph() {
+        morphChannel.back().clear();
+        morphChannel.publish();
+    }
+
+    void captureBlock(SynthParamBlock& out) const {
+        out.epoch = writeEpoch.load();
+        out.presetSerial = presetSerial.load(std::memory_order_acquire);
+        out.presetMorph = presetMorph.load();
+        out.attack = attack.load();
+        out.decay = decay.load();
+        out.sustain = sustain.load();
+        out.release = release.load();
+        out.masterVolume = masterVolume.load();
+        for (int i = 0; i < 4; ++i) {
+            SynthParamBlock::Oscillator& o = out.osc[i];
+            o.mode = getOscMode(i);
+            o.freq = getOscFrequency(i);
+            o.morph = getOscMorph(i);
+            o.shape = getOscShape(i);
+            o.duty = getOscDuty(i);
+            o.ratio = getOscRatio(i);
+            o.offset = getOscOffset(i);
+            o.amp = getOscAmp(i);
+            o.level = getOscLevel(i);
+            out.oscMuted[i] = oscMuted[i].load();
+            out.oscSolo[i] = oscSolo[i].load();
+            out.samplerMuted[i] = samplerMuted[i].load();
+            out.samplerSolo[i] = samplerSolo[i].load();
+
+            SynthParamBlock::Lfo& l = out.lfo[i];
+            l.period = getLfoPeriod(i);
+            l.syncMode = getLfoSyncMode(i);
+            l.morph = getLfoMorph(i);
+            l.duty = getLfoDuty(i);
+            l.flip = getLfoFlip(i);
+            l.resetOnNote = getLfoResetOnNote(i);
+            l.shape = getLfoShape(i);
+
+            out.chaosRunning[i] = getChaosRunning(i);
+        }
+        out.reverbEnabled = reverbEnabled.load();
+        out.reverbType = reverbType.load();
+        out.reverbDelayTime = reverbDelayTime.load();
+        out.reverbSize = reverbSize.load();
+        out.reverbDamping = reverbDamping.load();
+        out.reverbMix = reverbMix.load();
+        out.reverbDecay = reverbDecay.load();
+        out.reverbDiffusion = reverbDiffusion.load();
+        out.reverbModDepth = reverbModDepth.load();
+        out.reverbModFreq = reverbModFreq.load();
+        out.filterEnabled = filterEnabled.load();
+        out.filterType = filterType.load();
+        out.filterCutoff = filterCutoff.load();
+        out.filterGain = filterGain.load();
+        out.filterResonance = filterResonance.load();
+        out.filterDrive = filterDrive.load();
+        out.filterFeedbackHP = filterFeedbackHP.load();
+        out.filterPerVoice = filterPerVoice.load();
+        out.filterEnvAmount = filterEnvAmount.load();
+        out.filterOversample = filterOversample.load();
+        out.fmOversample = fmOversample.load();
+        out.oversampleQuality = oversampleQuality.load();
+        out.reverbRate = reverbRate.load();
+        out.currentLoop = currentLoop.load();
+        out.overdubMix = overdubMix.load();
+        out.loopQuantize = loopQuantize.load();
+        for (int target = 0; target < 8; ++target) {
+            for (int source = 0; source < 8; ++source) {
+                out.fmMatrix[target][source] = fmMatrix[target][source].load();
+            }
+        }
+    }
+
+    // The reverse of captureBlock for the parameter fields (session files);
+    // the bookkeeping fields are left alone
+    void storeBlock(const SynthParamBlock& in) {
+        attack = in.attack;
+        decay = in.decay;
+        sustain = in.sustain;
+        release = in.release;
+        masterVolume = in.masterVolume;
+        for (int i = 0; i < 4; ++i) {
+            const SynthParamBlock::Oscillator& o = in.osc[i];
+            setOscMode(i, o.mode);
+            setOscFrequency(i, o.freq);
+            setOscMorph(i, o.morph);
+            setOscShape(i, o.shape);
+            setOscDuty(i, o.duty);
+            setOscRatio(i, o.ratio);
+            setOscOffset(i, o.offset);
+            setOscAmp(i, o.amp);
+            setOscLevel(i, o.level);
+            oscMuted[i] = in.oscMuted[i];
+            oscSolo[i] = in.oscSolo[i];
+            samplerMuted[i] = in.samplerMuted[i];
+            samplerSolo[i] = in.samplerSolo[i];
+
+            const SynthParamBlock::Lfo& l = in.lfo[i];
+            setLfoPeriod(i, l.period);
+            setLfoSyncMode(i, l.syncMode);
+            setLfoMorph(i, l.morph);
+            setLfoDuty(i, l.duty);
+            setLfoFlip(i, l.flip);
+            setLfoResetOnNote(i, l.resetOnNote);
+            setLfoShape(i, l.shape);
+
+            setChaosRunning(i, in.chaosRunning[i]);
+        }
+        reverbEnabled = in.reverbEnabled;
+        reverbType = in.reverbType;
+        reverbDelayTime = in.reverbDelayTime;
+        reverbSize = in.reverbSize;
+        reverbDamping = in.reverbDamping;
+        reverbMix = in.reverbMix;
+        reverbDecay = in.reverbDecay;
+        reverbDiffusion = in.reverbDiffusion;
+        reverbModDepth = in.reverbModDepth;
+        reverbModFreq = in.reverbModFreq;
+        filterEnabled = in.filterEnabled;
+        filterType = in.filterType;
+        filterCutoff = in.filterCutoff;
+        filterGain = in.filterGain;
+        filterResonance = in.filterResonance;
+        filterDrive = in.filterDrive;
+        filterFeedbackHP = in.filterFeedbackHP;
+        filterPerVoice = in.filterPerVoice;
+        filterEnvAmount = in.filterEnvAmount;
+        filterOversample = in.filterOversample;
+        fmOversample = in.fmOversample;
+        oversampleQuality = in.oversampleQuality;
+        reverbRate = in.reverbRate;
+        currentLoop = in.currentLoop;
+        overdubMix = in.overdubMix;
+        loopQuantize = in.loopQuantize;
+        for (int target = 0; target < 8; ++target) {
+            for (int source = 0; source < 8; ++source) {
+                fmMatrix[target][source] = in.fmMatrix[target][source];
+            }
+        }
+    }
+
+    // UI thread: capture the current values and hand them to the audio thread
+    void publishSnapshot() {
+        SynthParamBlock block;
+        captureBlock(block);
+        snapshotChannel.publish(block);
+    }
 };
 
 enum class UIPage {
@@ -864,7 +1038,9 @@ enum class UIPage {
     LOOPER,
     SEQUENCER,
     CHAOS,
-    CONFIG
+    CONFIG,
+    PROFILE,
+    SPECTRUM
 };
 
 class UI {
@@ -882,6 +1058,16 @@ public:
     // Draw the UI
     void draw(int activeVoices);
 
+    // Audio-thread state as of the start of the last draw()
+    const SynthTelemetry& getTelemetry() const { return *telemetry; }
+
+    // Redraw pacing. A frame is due right after a key press, or once the
+    // frame interval has passed; the interval stretches so drawing and
+    // writing a frame take at most kFrameBudget of it, which keeps slow
+    // serial and SSH terminals from saturating
+    bool isFrameDue() const;
+    double getFrameInterval() const { return frameInterval; }
+
     // Sequencer info field identifiers (exposed for shared lookup tables)
     enum class SequencerInfoField {
         TEMPO = 0,
@@ -902,6 +1088,12 @@ public:
     void setDeviceInfo(const std::string& audioDevice, int sampleRate, int bufferSize,
                        const std::string& midiDevice, int midiPort);
     
+    // Realtime options and what took effect, for the Config page
+    void setRealtimeStatus(const rtsetup::Options* options, const rtsetup::Status* status) {
+        realtimeOptions = options;
+        realtimeStatus = status;
+    }
+
     // Set available devices
     void setAvailableAudioDevices(const std::vector<std::pair<int, std::string>>& devices, int currentDeviceId);
     void setAvailableMidiDevices(const std::vector<std::pair<int, std::string>>& devices, int currentPort);
@@ -911,18 +1103,28 @@ public:
     // Get parameter name by ID (public for MIDI handler)
     std::string getParameterName(int id);
 
-    // Waveform buffer for oscilloscope
-    void writeToWaveformBuffer(float sample);
-
-    // LFO amplitude history for rolling scope view
-    void writeToLFOHistory(int lfoIndex, float amplitude);
-
-    // CPU monitor access
+    // DSP load meter access (the audio callback reports into it)
     CPUMonitor& getCPUMonitor() { return cpuMonitor; }
+    QualityGovernor& getQualityGovernor() { return qualityGovernor; }
 
     // Preset management
     void loadPreset(const std::string& filename);
     void savePreset(const std::string& filename);
+
+    // Morph between two presets, laid over the current parameters, by
+    // SynthParameters::presetMorph (or its CC). False if either preset
+    // can't be read. stopPresetMorph returns control to the parameters
+    bool morphPresets(const std::string& presetA, const std::string& presetB);
+    void stopPresetMorph() { params->stopPresetMorph(); }
+
+    // Sessions (session_file.h). saveSession writes the whole state under
+    // the current session name; loadSession applies one and makes it
+    // current; stepSession loads the session before (-1) or after (+1)
+    // the current one in name order
+    void saveSession();
+    bool loadSession(const std::string& name, std::string& message);
+    void stepSession(int direction);
+    const std::string& getSessionName() const { return currentSessionName; }
     
     // Device change request (returns true if restart requested)
     bool isDeviceChangeRequested() const { return deviceChangeRequested; }
@@ -930,8 +1132,13 @@ public:
     int getRequestedMidiDevice() const { return requestedMidiPortNum; }
     void clearDeviceChangeRequest() { deviceChangeRequested = false; }
 
-    // MOD matrix data (16 modulation slots) - public for Synth access
-    ModulationSlot modulationSlots[16];
+    // Master output recording toggled from the looper page (E); main
+    // starts or stops the recorder
+    bool isRecordToggleRequested() const { return recordToggleRequested; }
+    void clearRecordToggleRequest() { recordToggleRequested = false; }
+
+    // MOD matrix data: the engine's 16 modulation slots, edited in place
+    ModulationSlot* modulationSlots;
 
 private:
     Synth* synth;
@@ -941,6 +1148,8 @@ private:
     
     // Device information
     std::string audioDeviceName;
+    const rtsetup::Options* realtimeOptions = nullptr;
+    const rtsetup::Status* realtimeStatus = nullptr;
     int audioSampleRate;
     int audioBufferSize;
     std::string midiDeviceName;
@@ -960,23 +1169,17 @@ private:
     
     // Preset management
     std::string currentPresetName;
+    std::string currentSessionName = "default";
     std::vector<std::string> availablePresets;
+    PresetLibrary presetLibrary;    // Parsed presets, indexed off the UI thread
     bool textInputActive;
     std::string textInputBuffer;
     
-    static const int WAVEFORM_BUFFER_SIZE = 8192;
-    std::vector<float> waveformBuffer;
-    std::atomic<int> waveformBufferWritePos;
-
-    // LFO amplitude history (no longer used for display, kept for potential future use)
-    static const int LFO_HISTORY_SIZE = 2048;
-    std::vector<float> lfoHistoryBuffer[4];  // One per LFO
-    int lfoHistoryWritePos[4];
-
     // Device change request
     bool deviceChangeRequested;
     int requestedAudioDeviceId;
     int requestedMidiPortNum;
+    bool recordToggleRequested = false;
 
     // Help system
     bool helpActive;
@@ -995,8 +1198,34 @@ private:
 private:
     int midiKeyboardOctave;  // Current octave (0-10, default 4 = middle C)
 
-    // CPU monitor
+    // DSP load meter, and the governor that acts on it
     CPUMonitor cpuMonitor;
+    QualityGovernor qualityGovernor;
+
+    // Newest synth telemetry, taken at the start of each draw()
+    const SynthTelemetry* telemetry;
+
+    // Redraw pacing (see isFrameDue)
+    static constexpr double kMinFrameInterval = 0.05;  // 20 FPS
+    static constexpr double kMaxFrameInterval = 1.0;
+    static constexpr double kFrameBudget = 0.25;       // Share of the interval spent on a frame
+    double frameCost = 0.0;                // Smoothed seconds per frame, terminal output included
+    double frameInterval = kMinFrameInterval;
+    double lastFrameTime = -1.0;           // steady_clock seconds
+    bool inputPending = true;
+    static double frameClock();
+    void finishFrame(double frameStart);
+
+    // PROFILE page: histograms are shown relative to this snapshot (R resets)
+    profile::StageSnapshot profileBaseline[profile::STAGE_COUNT];
+    void resetProfileBaseline();
+    void dumpProfileTrace();
+
+    // SPECTRUM page: analyzers for the synth's output and pre-filter feeds
+    SpectrumAnalyzer spectrumOutput;
+    SpectrumAnalyzer spectrumInput;
+    int spectrumView = 0;                  // 0 output, 1 pre-filter, 2 both (V cycles)
+    bool spectrumFrozen = false;           // F holds the current spectrum
     void drawCPUOverlay();
 
     // Text input for preset names
@@ -1023,6 +1252,8 @@ private:
     void drawSequencerPage();
     void drawChaosPage();
     void drawConfigPage();
+    void drawProfilePage();
+    void drawSpectrumPage();
     void drawBar(int y, int x, const char* label, float value, float min, float max, int width);
     void drawHotkeyLine();
     void drawOscillatorWavePreview(int topRow, int leftCol, int plotHeight, int plotWidth);
@@ -1149,20 +1380,50 @@ private:
     int modMatrixDestinationParamIndex;
     int modMatrixDestinationFocusColumn;
 
+    // Formatted tracker rows and mod matrix cells, kept between frames. A
+    // row or slot is formatted again only when one of the fields it shows
+    // differs from the copy it was formatted from
+    struct TrackerRowCache {
+        bool valid = false;
+        bool active = false;
+        int midiNote = 0;
+        int velocity = 0;
+        float gateLength = 0.0f;
+        float probability = 0.0f;
+        char note[8] = {};
+        char velocityText[8] = {};
+        char gateText[8] = {};
+        char probabilityText[8] = {};
+    };
+    static constexpr int kTrackerRows = 16;
+    TrackerRowCache trackerRowCache[kTrackerRows];
+
+    struct ModSlotCache {
+        bool valid = false;
+        ModulationSlot slot;
+        const char* cells[5] = {};   // Source, Curve, Amount, Destination, Type
+        char amount[8] = {};
+    };
+    static constexpr int kModSlots = 16;
+    ModSlotCache modSlotCache[kModSlots];
+
     // Sample browser state
     bool sampleBrowserActive;
     std::string sampleBrowserCurrentDir;
-    std::vector<std::string> sampleBrowserFiles;
+    std::vector<SampleBrowserEntry> sampleBrowserFiles;
     std::vector<std::string> sampleBrowserDirs;
     int sampleBrowserSelectedIndex;
     int sampleBrowserScrollOffset;
+    bool sampleBrowserScanning;
+    SampleBrowserWorker sampleBrowserWorker;
 
     // Sample browser helpers
     void startSampleBrowser();
     void handleSampleBrowserInput(int ch);
     void finishSampleBrowser(bool applySelection);
     void refreshSampleBrowserFiles();
-    void loadSampleForCurrentSampler(const std::string& filepath);
+    void pollSampleBrowser();
+    void loadSampleForCurrentSampler(const std::string& filepath, const SampleBrowserEntry& file);
 };
 
 #endif // UI_H
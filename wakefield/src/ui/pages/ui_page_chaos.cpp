@@ -1,4 +1,5 @@
 #include "../../ui.h"
+#include "../../synth.h"
 #include "../../chaos.h"
 #include <algorithm>
 #include <cmath>
@@ -24,23 +25,23 @@ void UI::drawChaosVisualization(int topRow, int leftCol, int plotHeight, int plo
 
     switch (chaosIndex) {
         case 0:
-            currentX = params->chaos1VisualX.load();
-            currentY = params->chaos1VisualY.load();
+            currentX = telemetry->chaosX[0];
+            currentY = telemetry->chaosY[0];
             running = params->chaos1Running.load();
             break;
         case 1:
-            currentX = params->chaos2VisualX.load();
-            currentY = params->chaos2VisualY.load();
+            currentX = telemetry->chaosX[1];
+            currentY = telemetry->chaosY[1];
             running = params->chaos2Running.load();
             break;
         case 2:
-            currentX = params->chaos3VisualX.load();
-            currentY = params->chaos3VisualY.load();
+            currentX = telemetry->chaosX[2];
+            currentY = telemetry->chaosY[2];
             running = params->chaos3Running.load();
             break;
         case 3:
-            currentX = params->chaos4VisualX.load();
-            currentY = params->chaos4VisualY.load();
+            currentX = telemetry->chaosX[3];
+            currentY = telemetry->chaosY[3];
             running = params->chaos4Running.load();
             break;
     }
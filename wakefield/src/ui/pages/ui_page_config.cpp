@@ -1,4 +1,69 @@
 #include "../../ui.h"
+#include "../../synth.h"
+#include "../../memory_stats.h"
+#include <cstring>
+
+namespace {
+
+// One realtime option: what was asked for, then whether it took effect
+void drawRealtimeRow(int row, const char* label, const std::string& requested, rtsetup::Result result,
+                     const std::string& detail = std::string()) {
+    mvprintw(row, 2, "%-14s %s", label, requested.c_str());
+    switch (result) {
+        case rtsetup::Result::OFF:
+            return;
+        case rtsetup::Result::PENDING:
+            printw("  (waiting for audio)");
+            return;
+        case rtsetup::Result::ACTIVE:
+            attron(COLOR_PAIR(2));
+            printw("  active");
+            attroff(COLOR_PAIR(2));
+            break;
+        case rtsetup::Result::FAILED:
+            attron(COLOR_PAIR(4));
+            printw("  NOT APPLIED");
+            attroff(COLOR_PAIR(4));
+            break;
+    }
+    if (!detail.empty()) {
+        printw(" (%s)", detail.c_str());
+    }
+}
+
+double megabytes(uint64_t bytes) {
+    return bytes / (1024.0 * 1024.0);
+}
+
+// Current and peak bytes of each subsystem, and its budget if it has one:
+// red while over it, with how often it was kept to it
+void drawMemoryRows(int& row) {
+    mvprintw(row++, 2, "%-14s %10s %10s %10s", "", "Current", "Peak", "Budget");
+    for (int i = 0; i < memstats::SUBSYSTEM_COUNT; ++i) {
+        const memstats::Usage usage = memstats::read(i);
+        const bool over = usage.budget > 0 && usage.current > usage.budget;
+        if (over) {
+            attron(COLOR_PAIR(4));
+        }
+        mvprintw(row, 2, "%-14s %7.1f MB %7.1f MB", memstats::subsystemName(i),
+                 megabytes(usage.current), megabytes(usage.peak));
+        if (usage.budget > 0) {
+            printw(" %7.1f MB", megabytes(usage.budget));
+        } else {
+            printw(" %10s", "-");
+        }
+        if (over) {
+            attroff(COLOR_PAIR(4));
+        }
+        if (usage.enforced > 0) {
+            printw("  (%s %llu)", i == memstats::SAMPLES ? "evicted" : "refused",
+                   static_cast<unsigned long long>(usage.enforced));
+        }
+        row++;
+    }
+}
+
+}
 
 void UI::drawConfigPage() {
     int row = 3;
@@ -29,6 +94,49 @@ void UI::drawConfigPage() {
 
     row += 2;
 
+    // Realtime options from device_config.txt / the command line
+    if (realtimeOptions && realtimeStatus) {
+        attron(A_BOLD);
+        mvprintw(row++, 1, "REALTIME");
+        attroff(A_BOLD);
+
+        const rtsetup::Options& options = *realtimeOptions;
+        const rtsetup::Status& status = *realtimeStatus;
+        const int policy = status.schedulePolicy.load(std::memory_order_relaxed);
+        const std::string granted = policy >= 0
+            ? std::string(rtsetup::policyName(policy)) + " " +
+              std::to_string(status.schedulePriority.load(std::memory_order_relaxed))
+            : std::string();
+        drawRealtimeRow(row++, "Scheduling:",
+                        options.realtime ? "SCHED_FIFO " + std::to_string(options.priority) : "default",
+                        status.schedule.load(std::memory_order_relaxed),
+                        status.schedule.load(std::memory_order_relaxed) == rtsetup::Result::FAILED
+                            ? "got " + granted + ", check rtprio limit" : std::string());
+        drawRealtimeRow(row++, "Audio core:",
+                        options.audioCpu >= 0 ? std::to_string(options.audioCpu) : "any",
+                        status.audioAffinity.load(std::memory_order_relaxed));
+        drawRealtimeRow(row++, "UI core:",
+                        options.uiCpu >= 0 ? std::to_string(options.uiCpu) : "any",
+                        status.uiAffinity);
+        drawRealtimeRow(row++, "Memory lock:", options.lockMemory ? "mlockall" : "off",
+                        status.memoryLock,
+                        status.memoryLock == rtsetup::Result::FAILED
+                            ? std::strerror(status.memoryLockError) : std::string());
+        if (synth) {
+            const DspArena& arena = synth->getArena();
+            mvprintw(row++, 2, "%-14s %.1f MB, %s", "DSP arena:",
+                     arena.getCapacity() / (1024.0 * 1024.0), DspArena::backingName(arena.getBacking()));
+        }
+        row += 2;
+    }
+
+    // Memory by subsystem (memory_stats.h)
+    attron(A_BOLD);
+    mvprintw(row++, 1, "MEMORY");
+    attroff(A_BOLD);
+    drawMemoryRows(row);
+    row += 2;
+
     // MIDI device info
     attron(A_BOLD);
     mvprintw(row++, 1, "MIDI DEVICE");
@@ -200,9 +200,9 @@ void UI::drawEnvelopePage() {
 
     // Draw 8 voice meters (showing envelope level for each voice)
     for (int v = 0; v < 8; ++v) {
-        bool active = synth->isVoiceActive(v);
-        float envValue = synth->getVoiceEnvelopeValue(v);
-        int note = synth->getVoiceNote(v);
+        bool active = v < MAX_VOICES && telemetry->voiceActive[v];
+        float envValue = v < MAX_VOICES ? telemetry->voiceEnvelope[v] : 0.0f;
+        int note = v < MAX_VOICES ? telemetry->voiceNote[v] : -1;
 
         // Voice label
         if (active) {
@@ -1,4 +1,5 @@
 #include "../../ui.h"
+#include "../../synth.h"
 #include <algorithm>
 #include <cmath>
 #include <vector>
@@ -148,7 +149,7 @@ void UI::drawLFOWavePreview(int topRow, int leftCol, int plotHeight, int plotWid
 
     // Draw LED bar indicator for current LFO output level
     int ledRow = topRow + 2 + height;
-    float currentValue = params->getLfoVisualValue(lfoIndex);
+    float currentValue = lfoIndex >= 0 && lfoIndex < 4 ? telemetry->lfoValue[lfoIndex] : 0.0f;
     currentValue = std::min(std::max(currentValue, -1.0f), 1.0f);
 
     // Bar width is same as waveform width
@@ -209,7 +210,7 @@ void UI::drawLFOPage() {
     int previewLeft = 2;
     int previewTop = row;
 
-    float currentPhase = params->getLfoVisualPhase(currentLFOIndex);
+    float currentPhase = currentLFOIndex >= 0 && currentLFOIndex < 4 ? telemetry->lfoPhase[currentLFOIndex] : 0.0f;
     drawLFOWavePreview(previewTop, previewLeft, plotHeight, plotWidth, currentLFOIndex, currentPhase);
 
     int parameterCol = previewLeft + plotWidth + 6;
@@ -1,6 +1,7 @@
 #include "../../ui.h"
 #include "../../looper.h"
 #include "../../loop_manager.h"
+#include <algorithm>
 #include <string>
 
 // External reference to global object from main.cpp
@@ -26,7 +27,8 @@ void UI::drawLooperPage() {
     attron(COLOR_PAIR(5) | A_BOLD);
     printw("%d", currentLoop + 1);
     attroff(COLOR_PAIR(5) | A_BOLD);
-    printw("  (Press 1-4 to select)");
+    printw(" of %d  (1-9 or ,/. to select), %d mixing", loopManager->getLoopCount(),
+           loopManager->getActiveLoopCount());
     row++;
 
     // Loop state grid
@@ -38,7 +40,12 @@ void UI::drawLooperPage() {
     const char* stateNames[] = {"Empty", "Recording", "Playing", "Overdubbing", "Stopped"};
     int stateColors[] = {1, 3, 2, 4, 6};  // gray, yellow, green, red, cyan
 
-    for (int i = 0; i < 4; ++i) {
+    // Up to kShownLoops rows, scrolled to keep the current loop in view
+    constexpr int kShownLoops = 8;
+    const int loopCount = loopManager->getLoopCount();
+    const int first = std::clamp(currentLoop - kShownLoops / 2, 0, std::max(loopCount - kShownLoops, 0));
+    const int last = std::min(first + kShownLoops, loopCount);
+    for (int i = first; i < last; ++i) {
         Looper::State state = loopManager->getLoopState(i);
         float loopLen = loopManager->getLoopLength(i);
         float loopTime = loopManager->getLoopTime(i);
@@ -52,7 +59,7 @@ void UI::drawLooperPage() {
             mvprintw(row, 2, " ");
         }
 
-        mvprintw(row, 3, "Loop %d: ", i + 1);
+        mvprintw(row, 3, "Loop %*d: ", loopCount > 9 ? 2 : 1, i + 1);
 
         // State with color
         attron(COLOR_PAIR(stateColors[static_cast<int>(state)]) | A_BOLD);
@@ -76,6 +83,18 @@ void UI::drawLooperPage() {
             printw("  --:--:-- / --:--:--");
         }
 
+        // Off unity speed, and a pressed change waiting for its beat or
+        // bar line
+        Looper* loop = loopManager->getLoop(i);
+        if (loop && loop->getSpeed() != 1.0f) {
+            printw("  %s%gx", loop->getSpeed() < 0.0f ? "rev " : "", std::fabs(loop->getSpeed()));
+        }
+        if (loop && loop->isChangePending()) {
+            attron(COLOR_PAIR(3));
+            printw("  (waiting)");
+            attroff(COLOR_PAIR(3));
+        }
+
         row++;
     }
 
@@ -89,6 +108,23 @@ void UI::drawLooperPage() {
 
     drawBar(row++, 2, "Overdub Mix ([/])", params->overdubMix.load(), 0.0f, 1.0f, 20);
 
+    const char* quantizeNames[] = {"Off", "Beat", "Bar"};
+    int quantize = std::clamp(params->loopQuantize.load(), 0, 2);
+    mvprintw(row++, 2, "Quantize (B): %s%s", quantizeNames[quantize],
+             quantize > 0 ? "  (changes land on the clock while it runs)" : "");
+
+    // Storage format, per-loop limit and chunk memory in use
+    const bool halfStorage = loopManager->getStorageFormat() == LoopChunkPool::Format::Float16;
+    mvprintw(row++, 2, "Storage: %s, up to %.0f s per loop, %.1f MB allocated",
+             halfStorage ? "half float" : "float",
+             loopManager->getMaxLoopSeconds(),
+             loopManager->getChunkPool().getAllocatedBytes() / (1024.0 * 1024.0));
+
+    // Overdub history of the selected loop
+    if (Looper* loop = loopManager->getCurrentLoop()) {
+        mvprintw(row++, 2, "History: %d undo, %d redo", loop->getUndoCount(), loop->getRedoCount());
+    }
+
     row += 2;
 
     // Controls section
@@ -101,8 +137,13 @@ void UI::drawLooperPage() {
     mvprintw(row++, 2, "O     - Overdub toggle");
     mvprintw(row++, 2, "S     - Stop current loop");
     mvprintw(row++, 2, "C     - Clear current loop");
-    mvprintw(row++, 2, "1-4   - Select loop");
+    mvprintw(row++, 2, "1-9   - Select loop (,/. previous/next)");
     mvprintw(row++, 2, "[/]   - Adjust overdub mix");
+    mvprintw(row++, 2, "W     - Save current loop to WAV");
+    mvprintw(row++, 2, "R     - Load current loop from WAV (shift)");
+    mvprintw(row++, 2, "U/Y   - Undo/redo overdub pass");
+    mvprintw(row++, 2, "V     - Speed: 1x/2x/0.5x, then reversed");
+    mvprintw(row++, 2, "B     - Quantize changes: off/beat/bar");
 
     row += 2;
 
@@ -149,6 +190,6 @@ void UI::drawLooperPage() {
     mvprintw(row++, 2, "1. Press Space to start recording on selected loop");
     mvprintw(row++, 2, "2. Press Space again to start playback");
     mvprintw(row++, 2, "3. Press O to overdub additional layers");
-    mvprintw(row++, 2, "4. Use 1-4 to switch between loops and layer sounds");
+    mvprintw(row++, 2, "4. Use 1-9 or ,/. to switch between loops and layer sounds");
     mvprintw(row++, 2, "5. Adjust [/] to control overdub mix (prevents clipping)");
 }
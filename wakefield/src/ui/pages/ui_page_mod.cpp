@@ -1,6 +1,7 @@
 #include "../../ui.h"
 #include "../ui_mod_data.h"
 #include <algorithm>
+#include <cstdio>
 #include <string>
 #include <vector>
 
@@ -250,7 +251,7 @@ void UI::drawModPage() {
     static const char* headers[] = {"Slot", "Source", "Curve", "Amount", "Destination", "Type"};
     static const int headerCols[] = {2, 10, 28, 40, 56, 74};
     static const int colWidths[] = {4, 16, 10, 12, 18, 8};
-    constexpr int slotCount = 16;
+    constexpr int slotCount = kModSlots;
     constexpr int columnCount = 5;  // Source..Type
 
     const auto& sources = getModSourceOptions();
@@ -279,26 +280,37 @@ void UI::drawModPage() {
         mvprintw(row, headerCols[0], "%02d", slot + 1);
 
         const ModulationSlot& modSlot = modulationSlots[slot];
-        std::string cellValues[columnCount];
-
-        // Format cell values based on stored data
-        cellValues[0] = (modSlot.source >= 0 && modSlot.source < static_cast<int>(sources.size()))
-                        ? sources[modSlot.source].symbol : "--";
-        cellValues[1] = (modSlot.curve >= 0 && modSlot.curve < static_cast<int>(curves.size()))
-                        ? curves[modSlot.curve].symbol : "--";
-        cellValues[2] = (modSlot.amount != 0 || modSlot.isComplete())
-                        ? std::to_string(static_cast<int>(modSlot.amount)) : "--";
-        cellValues[3] = (modSlot.destination >= 0 && modSlot.destination < static_cast<int>(destinations.size()))
-                        ? destinations[modSlot.destination].symbol : "--";
-        cellValues[4] = (modSlot.type >= 0 && modSlot.type < static_cast<int>(types.size()))
-                        ? types[modSlot.type].symbol : "--";
+        ModSlotCache& cached = modSlotCache[slot];
+
+        // Format cell values based on stored data, again only when the slot
+        // has changed; names point into the static option tables
+        if (!cached.valid || cached.slot.source != modSlot.source || cached.slot.curve != modSlot.curve ||
+            cached.slot.amount != modSlot.amount || cached.slot.destination != modSlot.destination ||
+            cached.slot.type != modSlot.type) {
+            cached.valid = true;
+            cached.slot = modSlot;
+            cached.cells[0] = (modSlot.source >= 0 && modSlot.source < static_cast<int>(sources.size()))
+                              ? sources[modSlot.source].symbol : "--";
+            cached.cells[1] = (modSlot.curve >= 0 && modSlot.curve < static_cast<int>(curves.size()))
+                              ? curves[modSlot.curve].symbol : "--";
+            if (modSlot.amount != 0 || modSlot.isComplete()) {
+                std::snprintf(cached.amount, sizeof(cached.amount), "%d", static_cast<int>(modSlot.amount));
+                cached.cells[2] = cached.amount;
+            } else {
+                cached.cells[2] = "--";
+            }
+            cached.cells[3] = (modSlot.destination >= 0 && modSlot.destination < static_cast<int>(destinations.size()))
+                              ? destinations[modSlot.destination].symbol : "--";
+            cached.cells[4] = (modSlot.type >= 0 && modSlot.type < static_cast<int>(types.size()))
+                              ? types[modSlot.type].symbol : "--";
+        }
 
         for (int col = 0; col < columnCount; ++col) {
             bool selected = (slot == modMatrixCursorRow && col == modMatrixCursorCol);
             if (selected) {
                 attron(A_REVERSE);
             }
-            mvprintw(row, headerCols[col + 1], "%-*s", colWidths[col + 1], cellValues[col].c_str());
+            mvprintw(row, headerCols[col + 1], "%-*s", colWidths[col + 1], cached.cells[col]);
             if (selected) {
                 attroff(A_REVERSE);
             }
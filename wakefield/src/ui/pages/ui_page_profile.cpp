@@ -0,0 +1,151 @@
+#include "../../ui.h"
+
+namespace {
+
+// Bucket index below which at least `fraction` of the samples fall
+int percentileBucket(const uint32_t* buckets, uint64_t count, double fraction) {
+    uint64_t target = static_cast<uint64_t>(count * fraction + 0.5);
+    uint64_t cumulative = 0;
+    for (int b = 0; b < profile::kBuckets; ++b) {
+        cumulative += buckets[b];
+        if (cumulative >= target && cumulative > 0) {
+            return b;
+        }
+    }
+    return profile::kBuckets - 1;
+}
+
+// Upper edge of a bucket, in microseconds
+double bucketEdgeUs(int bucket, double ticksPerUs) {
+    return static_cast<double>(2ULL << bucket) / ticksPerUs;
+}
+
+}
+
+void UI::resetProfileBaseline() {
+    for (int stage = 0; stage < profile::STAGE_COUNT; ++stage) {
+        profile::read(stage, profileBaseline[stage]);
+    }
+}
+
+void UI::dumpProfileTrace() {
+    if (!profile::enabled()) {
+        addConsoleMessage("Profiling is compiled out of this build");
+        return;
+    }
+    const std::string path = profile::defaultTracePath();
+    size_t events = 0;
+    std::string error;
+    if (profile::writeChromeTrace(path, events, error)) {
+        addConsoleMessage("Trace: " + std::to_string(events) + " events to " + path);
+    } else {
+        addConsoleMessage("Trace failed: " + error);
+    }
+}
+
+void UI::drawProfilePage() {
+    int row = 3;
+
+    attron(A_BOLD);
+    mvprintw(row++, 1, "AUDIO THREAD PROFILE");
+    attroff(A_BOLD);
+    row++;
+
+    if (!profile::enabled()) {
+        attron(COLOR_PAIR(3));
+        mvprintw(row++, 2, "Profiling is compiled out of this build.");
+        mvprintw(row++, 2, "Reconfigure with -DWAKEFIELD_PROFILE=ON to time each audio stage.");
+        attroff(COLOR_PAIR(3));
+        return;
+    }
+
+    const double ticksPerUs = profile::ticksPerMicrosecond();
+
+    // Histogram columns start near 0.1 us; 16 log2 buckets reach ~4 ms
+    constexpr int kHistColumns = 16;
+    int firstBucket = 0;
+    while (firstBucket < profile::kBuckets - kHistColumns &&
+           bucketEdgeUs(firstBucket, ticksPerUs) < 0.125) {
+        ++firstBucket;
+    }
+
+    profile::StageSnapshot window[profile::STAGE_COUNT];
+    uint64_t allTicks = 0;
+    for (int stage = 0; stage < profile::STAGE_COUNT; ++stage) {
+        profile::StageSnapshot current;
+        profile::read(stage, current);
+        const profile::StageSnapshot& base = profileBaseline[stage];
+        window[stage].count = current.count - base.count;
+        window[stage].totalTicks = current.totalTicks - base.totalTicks;
+        for (int b = 0; b < profile::kBuckets; ++b) {
+            window[stage].buckets[b] = current.buckets[b] - base.buckets[b];
+        }
+        allTicks += window[stage].totalTicks;
+    }
+
+    attron(A_BOLD);
+    mvprintw(row, 2, "%-18s %9s %9s %9s %9s %9s %6s  %s",
+             "Stage", "Calls", "Mean us", "p50 us", "p99 us", "Max us", "Share", "Histogram");
+    attroff(A_BOLD);
+    row++;
+
+    static const char kLevels[] = " .:-=+*#";
+    for (int stage = 0; stage < profile::STAGE_COUNT; ++stage) {
+        const profile::StageSnapshot& w = window[stage];
+        if (w.count == 0) {
+            attron(A_DIM);
+            mvprintw(row++, 2, "%-18s %9s", profile::stageName(stage), "-");
+            attroff(A_DIM);
+            continue;
+        }
+
+        double mean = static_cast<double>(w.totalTicks) / w.count / ticksPerUs;
+        double p50 = bucketEdgeUs(percentileBucket(w.buckets, w.count, 0.50), ticksPerUs);
+        int p99Bucket = percentileBucket(w.buckets, w.count, 0.99);
+        double p99 = bucketEdgeUs(p99Bucket, ticksPerUs);
+        int maxBucket = 0;
+        uint32_t peakCount = 0;
+        for (int b = 0; b < profile::kBuckets; ++b) {
+            if (w.buckets[b] > 0) {
+                maxBucket = b;
+            }
+            peakCount = std::max(peakCount, w.buckets[b]);
+        }
+        double maxUs = bucketEdgeUs(maxBucket, ticksPerUs);
+        double share = allTicks > 0 ? 100.0 * w.totalTicks / allTicks : 0.0;
+
+        // Highlight the stages that dominate the budget
+        int colorPair = share >= 30.0 ? 4 : (share >= 10.0 ? 3 : 2);
+        mvprintw(row, 2, "%-18s %9llu %9.2f %9.2f %9.2f %9.2f ",
+                 profile::stageName(stage), static_cast<unsigned long long>(w.count),
+                 mean, p50, p99, maxUs);
+        attron(COLOR_PAIR(colorPair));
+        printw("%5.1f%%", share);
+        attroff(COLOR_PAIR(colorPair));
+        printw("  ");
+
+        for (int c = 0; c < kHistColumns; ++c) {
+            int b = firstBucket + c;
+            uint32_t n = w.buckets[b];
+            int level = n == 0 ? 0 : 1 + static_cast<int>(6.0 * n / peakCount);
+            if (b == p99Bucket) {
+                attron(A_BOLD);
+            }
+            addch(kLevels[level]);
+            if (b == p99Bucket) {
+                attroff(A_BOLD);
+            }
+        }
+        row++;
+    }
+
+    row++;
+    attron(COLOR_PAIR(3));
+    mvprintw(row++, 2, "Histogram: %.2f us .. %.0f us per column doubling; bold column = p99",
+             bucketEdgeUs(firstBucket, ticksPerUs) / 2.0,
+             bucketEdgeUs(firstBucket + kHistColumns - 1, ticksPerUs));
+    mvprintw(row++, 2, "Shift+R resets the window. Timer: %.0f ticks/us", ticksPerUs);
+    mvprintw(row++, 2, "Trace %s: Shift+T %s, Shift+D writes the timeline",
+             profile::tracing() ? "on" : "off", profile::tracing() ? "stops" : "starts");
+    attroff(COLOR_PAIR(3));
+}
@@ -2,6 +2,7 @@
 #include "../../synth.h"
 #include "../../sampler.h"
 #include "../../sample_bank.h"
+#include "../../sample_stream.h"
 #include <algorithm>
 #include <cmath>
 #include <string>
@@ -22,6 +23,22 @@ void drawSamplerWaveform(int topRow, int leftCol, int height, int width, const S
     int loopStartCol = static_cast<int>(loopStart * width);
     int loopEndCol = static_cast<int>((loopStart + loopLength) * width);
 
+    // Prepared samples carry a min/max pyramid; use the coarsest level that
+    // still resolves one column instead of scanning every frame. Only when a
+    // column spans fewer frames than the finest level are frames read directly
+    const int16_t* overview = nullptr;
+    uint32_t bucketFrames = SampleData::kOverviewBaseFrames;
+    uint32_t buckets = 0;
+    for (uint32_t level = 0; level < sample->overviewLevels; ++level) {
+        uint32_t levelBuckets = 0;
+        const int16_t* levelData = sample->overviewLevel(level, levelBuckets);
+        const uint32_t levelFrames = SampleData::kOverviewBaseFrames << level;
+        if (!levelData || levelFrames > static_cast<uint32_t>(samplesPerColumn)) break;
+        overview = levelData;
+        bucketFrames = levelFrames;
+        buckets = levelBuckets;
+    }
+
     // For each column, find the peak amplitude
     for (int col = 0; col < width; ++col) {
         int startSample = col * samplesPerColumn;
@@ -29,10 +46,21 @@ void drawSamplerWaveform(int topRow, int leftCol, int height, int width, const S
 
         // Find peak amplitude in this column
         float peakAmplitude = 0.0f;
-        for (int i = startSample; i < endSample; ++i) {
-            float sampleValue = std::abs(sample->samples[i]) / 32768.0f; // Convert Q15 to float
-            if (sampleValue > peakAmplitude) {
-                peakAmplitude = sampleValue;
+        if (overview) {
+            uint32_t firstBucket = startSample / bucketFrames;
+            uint32_t lastBucket = std::min((endSample - 1) / bucketFrames + 1, buckets);
+            int peak = 0;
+            for (uint32_t b = firstBucket; b < lastBucket; ++b) {
+                peak = std::max({peak, std::abs(static_cast<int>(overview[2 * b])),
+                                 std::abs(static_cast<int>(overview[2 * b + 1]))});
+            }
+            peakAmplitude = peak * sample->gain / 32768.0f;
+        } else {
+            for (int i = startSample; i < endSample; ++i) {
+                float sampleValue = std::abs(sample->samples[i]) * sample->gain / 32768.0f; // Convert Q15 to float
+                if (sampleValue > peakAmplitude) {
+                    peakAmplitude = sampleValue;
+                }
             }
         }
 
@@ -99,6 +127,9 @@ void UI::drawSamplerPage() {
     mvprintw(row, sampleCol + 2, "Sample: ");
     if (sample && sample->name.length() > 0) {
         printw("%s", sample->name.c_str());
+        if (sample->stream) {
+            printw("  [disk stream, %u underruns]", sample->stream->getUnderruns());
+        }
     } else {
         printw("No sample loaded");
     }
@@ -132,7 +163,8 @@ void UI::drawSamplerPage() {
     float loopStart = synth->getSamplerLoopStart(currentSamplerIndex);
     float loopLength = synth->getSamplerLoopLength(currentSamplerIndex);
 
-    if (sample && sample->sampleCount > 0) {
+    // Streamed samples aren't resident, so there is nothing to scan
+    if (sample && sample->sampleCount > 0 && !sample->stream) {
         drawSamplerWaveform(row, leftCol, waveformHeight, waveformWidth, sample, loopStart, loopLength);
     } else {
         // Draw empty waveform with just centerline
@@ -157,10 +189,12 @@ void UI::drawSamplerPage() {
     PlaybackMode direction = synth->getSamplerPlaybackMode(currentSamplerIndex);
     // loopStart and loopLength already declared above for loop indicator
     float crossfade = synth->getSamplerCrossfadeLength(currentSamplerIndex);
+    bool loopSnap = synth->getSamplerLoopSnap(currentSamplerIndex);
     int octave = synth->getSamplerOctave(currentSamplerIndex);
     float tune = synth->getSamplerTune(currentSamplerIndex);
     int syncMode = synth->getSamplerSyncMode(currentSamplerIndex);
     bool noteReset = synth->getSamplerNoteReset(currentSamplerIndex);
+    SamplerInterpolation interpolation = synth->getSamplerInterpolation(currentSamplerIndex);
 
     const char* keyModeStr = keyMode ? "KEY" : "FREE";
     const char* directionStr = "Forward";
@@ -175,16 +209,21 @@ void UI::drawSamplerPage() {
     else if (syncMode == 2) syncStr = "Trip";
     else if (syncMode == 3) syncStr = "Dot";
 
+    const char* interpStr = "Linear";
+    if (interpolation == SamplerInterpolation::HERMITE) interpStr = "Hermite";
+    else if (interpolation == SamplerInterpolation::SINC) interpStr = "Sinc";
+
     // Two columns layout with highlighting
     const int col1 = leftCol + 2;
     const int col2 = leftCol + 40;
     int paramRow = row;
 
     // Column 1 parameters
-    const int paramIds1[] = {60, 68, 61, 62, 63};
-    const char* labels1[] = {"Key Mode:   ", "Direction:  ", "Loop Start: ", "Loop Length:", "Xfade:      "};
+    const int paramIds1[] = {60, 68, 61, 62, 63, 71};
+    const char* labels1[] = {"Key Mode:   ", "Direction:  ", "Loop Start: ", "Loop Length:", "Xfade:      ",
+                             "Snap:       "};
 
-    for (int i = 0; i < 5; ++i) {
+    for (int i = 0; i < 6; ++i) {
         if (paramIds1[i] == selectedParameterId) {
             attron(COLOR_PAIR(5) | A_BOLD);
             mvprintw(paramRow, col1, ">");
@@ -204,6 +243,8 @@ void UI::drawSamplerPage() {
             printw("%.1f%%", loopLength * 100.0f);
         } else if (i == 4) {
             printw("%.1f%%", crossfade * 100.0f);
+        } else if (i == 5) {
+            printw("%s", loopSnap ? "On" : "Off");
         }
 
         if (paramIds1[i] == selectedParameterId) {
@@ -212,12 +253,12 @@ void UI::drawSamplerPage() {
         paramRow++;
     }
 
-    // Column 2 parameters (IDs 64-67)
+    // Column 2 parameters (IDs 64-67, 70)
     paramRow = row;
-    const int paramIds2[] = {64, 65, 66, 67};
-    const char* labels2[] = {"Octave:     ", "Tune:       ", "Sync:       ", "Note Reset: "};
+    const int paramIds2[] = {64, 65, 66, 67, 70};
+    const char* labels2[] = {"Octave:     ", "Tune:       ", "Sync:       ", "Note Reset: ", "Interp:     "};
 
-    for (int i = 0; i < 4; ++i) {
+    for (int i = 0; i < 5; ++i) {
         if (paramIds2[i] == selectedParameterId) {
             attron(COLOR_PAIR(5) | A_BOLD);
             mvprintw(paramRow, col2, ">");
@@ -235,6 +276,8 @@ void UI::drawSamplerPage() {
             printw("%s", syncStr);
         } else if (i == 3) {
             printw("%s", noteReset ? "On" : "Off");
+        } else if (i == 4) {
+            printw("%s", interpStr);
         }
 
         if (paramIds2[i] == selectedParameterId) {
@@ -0,0 +1,144 @@
+#include "../../ui.h"
+#include "../../synth.h"
+#include <cmath>
+
+namespace {
+
+constexpr float kMinHz = 20.0f;
+constexpr float kMaxHz = 20000.0f;
+constexpr float kTopDb = 0.0f;
+constexpr float kRangeDb = 90.0f;
+constexpr float kReleaseDbPerSecond = 30.0f;
+
+const char* const kViewNames[] = {"Output", "Pre-filter", "Output + pre-filter"};
+const char* const kFilterNames[] = {"LP", "HP", "High shelf", "Low shelf", "Ladder"};
+
+// Plot row (0 at the top) of the cell a level reaches into
+int levelRow(float db, int plotHeight) {
+    const float fraction = (kTopDb - db) / kRangeDb;
+    return static_cast<int>(std::floor(fraction * plotHeight));
+}
+
+}
+
+void UI::drawSpectrumPage() {
+    const int maxY = getmaxy(stdscr);
+    const int maxX = getmaxx(stdscr);
+    int row = 3;
+
+    attron(A_BOLD);
+    mvprintw(row, 1, "SPECTRUM ANALYZER");
+    attroff(A_BOLD);
+    mvprintw(row, 20, "[%s]", kViewNames[spectrumView]);
+    if (spectrumFrozen) {
+        attron(COLOR_PAIR(3) | A_BOLD);
+        printw("  FROZEN");
+        attroff(COLOR_PAIR(3) | A_BOLD);
+    }
+    row++;
+
+    const float sampleRate = synth->getSampleRate();
+    const int filterType = params->filterType.load();
+    if (params->filterEnabled.load() && filterType >= 0 && filterType < 5) {
+        mvprintw(row, 2, "%d-point FFT, %.1f Hz bins  |  Filter: %s %.0f Hz (^)",
+                 SpectrumAnalyzer::kFFTSize, sampleRate / SpectrumAnalyzer::kFFTSize,
+                 kFilterNames[filterType], params->filterCutoff.load());
+    } else {
+        mvprintw(row, 2, "%d-point FFT, %.1f Hz bins  |  Filter: off",
+                 SpectrumAnalyzer::kFFTSize, sampleRate / SpectrumAnalyzer::kFFTSize);
+    }
+    row += 2;
+
+    const int labelWidth = 6;
+    const int plotTop = row;
+    const int plotHeight = maxY - plotTop - 5;
+    const int plotWidth = maxX - labelWidth - 2;
+    if (plotHeight < 4 || plotWidth < 16) {
+        mvprintw(plotTop, 2, "Terminal too small for the spectrum");
+        return;
+    }
+
+    const bool showOutput = spectrumView != 1;
+    const bool showInput = spectrumView != 0;
+    if (!spectrumFrozen) {
+        const float release = kReleaseDbPerSecond * static_cast<float>(frameInterval);
+        if (showOutput) {
+            spectrumOutput.update(synth->getSpectrumOutput(), release);
+        }
+        if (showInput) {
+            spectrumInput.update(synth->getSpectrumInput(), release);
+        }
+    }
+
+    const float maxHz = std::min(kMaxHz, sampleRate * 0.5f);
+    std::vector<float> outputBands(plotWidth);
+    std::vector<float> inputBands(plotWidth);
+    spectrumOutput.getBands(outputBands.data(), plotWidth, kMinHz, maxHz, sampleRate);
+    spectrumInput.getBands(inputBands.data(), plotWidth, kMinHz, maxHz, sampleRate);
+
+    // dB scale down the left, a line every 10 dB where the rows allow it
+    const int dbStep = plotHeight >= 18 ? 10 : (plotHeight >= 9 ? 20 : 30);
+    attron(COLOR_PAIR(1));
+    for (int db = 0; db <= static_cast<int>(kRangeDb); db += dbStep) {
+        const int y = std::min(levelRow(kTopDb - db, plotHeight), plotHeight - 1);
+        mvprintw(plotTop + y, 0, "%4d", -db);
+        mvhline(plotTop + y, labelWidth, ACS_HLINE, plotWidth);
+    }
+    attroff(COLOR_PAIR(1));
+
+    // Bars for the main trace; with both, the output is the bar and the
+    // pre-filter level a dot above it (or inside it, where the filter boosts)
+    const float* bars = showOutput ? outputBands.data() : inputBands.data();
+    for (int c = 0; c < plotWidth; ++c) {
+        const int x = labelWidth + c;
+        const int top = std::max(0, levelRow(bars[c], plotHeight));
+        attron(COLOR_PAIR(2));
+        for (int y = top; y < plotHeight; ++y) {
+            mvaddch(plotTop + y, x, '#');
+        }
+        attroff(COLOR_PAIR(2));
+
+        if (showOutput && showInput) {
+            const int dot = levelRow(inputBands[c], plotHeight);
+            if (dot >= 0 && dot < plotHeight) {
+                attron(COLOR_PAIR(3) | A_BOLD);
+                mvaddch(plotTop + dot, x, dot < top ? '.' : 'o');
+                attroff(COLOR_PAIR(3) | A_BOLD);
+            }
+        }
+    }
+
+    // Frequency axis, log spaced as the bands are
+    const int axisRow = plotTop + plotHeight;
+    const float columnsPerOctave = plotWidth / std::log2(maxHz / kMinHz);
+    auto columnOf = [&](float hz) {
+        return static_cast<int>(std::log2(hz / kMinHz) * columnsPerOctave);
+    };
+    static const float kMarks[] = {50, 100, 200, 500, 1000, 2000, 5000, 10000, 20000};
+    attron(COLOR_PAIR(1));
+    mvhline(axisRow, labelWidth, '-', plotWidth);
+    for (float hz : kMarks) {
+        const int c = columnOf(hz);
+        if (hz > maxHz || c >= plotWidth - 2) {
+            continue;
+        }
+        mvaddch(axisRow, labelWidth + c, '+');
+        if (hz >= 1000) {
+            mvprintw(axisRow + 1, labelWidth + c - 1, "%gk", hz / 1000);
+        } else {
+            mvprintw(axisRow + 1, labelWidth + c - 1, "%g", hz);
+        }
+    }
+    attroff(COLOR_PAIR(1));
+
+    if (params->filterEnabled.load()) {
+        const float cutoff = params->filterCutoff.load();
+        if (cutoff >= kMinHz && cutoff <= maxHz) {
+            attron(COLOR_PAIR(4) | A_BOLD);
+            mvaddch(axisRow, labelWidth + std::min(columnOf(cutoff), plotWidth - 1), '^');
+            attroff(COLOR_PAIR(4) | A_BOLD);
+        }
+    }
+
+    mvprintw(axisRow + 2, 2, "V: view  |  F: freeze  |  dB relative to a full-scale sine");
+}
@@ -68,6 +68,15 @@ void UI::drawSequencerPage() {
     attron(A_BOLD);
     mvprintw(row, leftCol, "SEQUENCER - Track %d", trackIdx + 1);
     attroff(A_BOLD);
+    // Automation: armed on this track, or how many lanes it holds
+    if (sequencer->getAutomationRecordTrack() == trackIdx) {
+        attron(COLOR_PAIR(4) | A_BOLD);
+        mvprintw(row, leftCol + 21, "[AUTO REC]");
+        attroff(COLOR_PAIR(4) | A_BOLD);
+    } else if (!track.getAutomation().empty()) {
+        mvprintw(row, leftCol + 21, "Auto: %d lane%s", track.getAutomation().getLaneCount(),
+                 track.getAutomation().getLaneCount() == 1 ? "" : "s");
+    }
     row += 2;
 
     // Draw actions section FIRST at top of right pane
@@ -232,7 +241,7 @@ void UI::drawSequencerPage() {
     }
 
     // Simple tracker display - cap at 16 steps
-    int displayRows = std::min(16, patternLength);
+    int displayRows = std::min(kTrackerRows, patternLength);
 
     // Draw header
     attron(A_BOLD);
@@ -250,6 +259,33 @@ void UI::drawSequencerPage() {
         bool rowSelected = (!sequencerFocusRightPane && !sequencerFocusActionsPane && sequencerSelectedRow == i);
         bool isCurrentStep = (currentStep == i);
 
+        // The row's text, formatted again only when the step has changed
+        TrackerRowCache& cells = trackerRowCache[i];
+        if (!cells.valid || cells.active != step.active || cells.midiNote != step.midiNote ||
+            cells.velocity != step.velocity || cells.gateLength != step.gateLength ||
+            cells.probability != step.probability) {
+            cells.valid = true;
+            cells.active = step.active;
+            cells.midiNote = step.midiNote;
+            cells.velocity = step.velocity;
+            cells.gateLength = step.gateLength;
+            cells.probability = step.probability;
+            if (step.active) {
+                std::snprintf(cells.note, sizeof(cells.note), "%-6s",
+                              UIUtils::midiNoteToString(step.midiNote).c_str());
+                std::snprintf(cells.velocityText, sizeof(cells.velocityText), "%3d", step.velocity);
+                std::snprintf(cells.gateText, sizeof(cells.gateText), "%3d%%",
+                              static_cast<int>(step.gateLength * 100.0f));
+                std::snprintf(cells.probabilityText, sizeof(cells.probabilityText), "%3d%%",
+                              static_cast<int>(step.probability * 100.0f));
+            } else {
+                std::snprintf(cells.note, sizeof(cells.note), "---   ");
+                std::snprintf(cells.velocityText, sizeof(cells.velocityText), "---");
+                std::snprintf(cells.gateText, sizeof(cells.gateText), "--- ");
+                std::snprintf(cells.probabilityText, sizeof(cells.probabilityText), "--- ");
+            }
+        }
+
         // Reset attributes and clear the line
         attrset(A_NORMAL);
         mvhline(row, leftCol, ' ', 30);  // Clear 30 chars for the row
@@ -285,11 +321,7 @@ void UI::drawSequencerPage() {
             attroff(COLOR_PAIR(1) | A_BOLD);
             attron(COLOR_PAIR(5) | A_BOLD);
         }
-        if (step.active) {
-            mvprintw(row, leftCol + 5, "%-6s", UIUtils::midiNoteToString(step.midiNote).c_str());
-        } else {
-            mvprintw(row, leftCol + 5, "---   ");
-        }
+        mvaddstr(row, leftCol + 5, cells.note);
         if (!isCurrentStep && noteSelected) {
             attroff(COLOR_PAIR(5) | A_BOLD);
             attron(COLOR_PAIR(1) | A_BOLD);
@@ -301,11 +333,7 @@ void UI::drawSequencerPage() {
             attroff(COLOR_PAIR(1) | A_BOLD);
             attron(COLOR_PAIR(5) | A_BOLD);
         }
-        if (step.active) {
-            mvprintw(row, leftCol + 12, "%3d", step.velocity);
-        } else {
-            mvprintw(row, leftCol + 12, "---");
-        }
+        mvaddstr(row, leftCol + 12, cells.velocityText);
         if (!isCurrentStep && velSelected) {
             attroff(COLOR_PAIR(5) | A_BOLD);
             attron(COLOR_PAIR(1) | A_BOLD);
@@ -317,11 +345,7 @@ void UI::drawSequencerPage() {
             attroff(COLOR_PAIR(1) | A_BOLD);
             attron(COLOR_PAIR(5) | A_BOLD);
         }
-        if (step.active) {
-            mvprintw(row, leftCol + 16, "%3d%%", static_cast<int>(step.gateLength * 100.0f));
-        } else {
-            mvprintw(row, leftCol + 16, "--- ");
-        }
+        mvaddstr(row, leftCol + 16, cells.gateText);
         if (!isCurrentStep && gateSelected) {
             attroff(COLOR_PAIR(5) | A_BOLD);
             attron(COLOR_PAIR(1) | A_BOLD);
@@ -333,11 +357,7 @@ void UI::drawSequencerPage() {
             attroff(COLOR_PAIR(1) | A_BOLD);
             attron(COLOR_PAIR(5) | A_BOLD);
         }
-        if (step.active) {
-            mvprintw(row, leftCol + 21, "%3d%%", static_cast<int>(step.probability * 100.0f));
-        } else {
-            mvprintw(row, leftCol + 21, "--- ");
-        }
+        mvaddstr(row, leftCol + 21, cells.probabilityText);
         if (!isCurrentStep && probSelected) {
             attroff(COLOR_PAIR(5) | A_BOLD);
             attron(COLOR_PAIR(1) | A_BOLD);
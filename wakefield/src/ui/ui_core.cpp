@@ -3,6 +3,9 @@
 #include "../preset.h"
 #include <chrono>
 
+// Shown until the first draw() takes a published snapshot
+static const SynthTelemetry kNoTelemetry;
+
 UI::UI(Synth* synth, SynthParameters* params)
     : synth(synth)
     , params(params)
@@ -25,6 +28,9 @@ UI::UI(Synth* synth, SynthParameters* params)
     , requestedMidiPortNum(-1)
     , helpActive(false)
     , helpScrollOffset(0)
+    , midiKeyboardMode(false)
+    , midiKeyboardOctave(4)
+    , telemetry(&kNoTelemetry)
     , currentOscillatorIndex(0)
     , currentSamplerIndex(0)
     , currentLFOIndex(0)
@@ -34,8 +40,6 @@ UI::UI(Synth* synth, SynthParameters* params)
     , fmMatrixCursorCol(1)  // Start at 0→1 (first valid FM routing)
     , modMatrixCursorRow(0)
     , modMatrixCursorCol(0)
-    , waveformBuffer(WAVEFORM_BUFFER_SIZE, 0.0f)
-    , waveformBufferWritePos(0)
     , sequencerSelectedRow(0)
     , sequencerSelectedColumn(static_cast<int>(SequencerTrackerColumn::NOTE))
     , sequencerFocusRightPane(false)
@@ -57,13 +61,13 @@ UI::UI(Synth* synth, SynthParameters* params)
     , sampleBrowserCurrentDir("../samples")
     , sampleBrowserSelectedIndex(0)
     , sampleBrowserScrollOffset(0)
-    , midiKeyboardMode(false)
-    , midiKeyboardOctave(4) {
+    , sampleBrowserScanning(false) {
+    // The modulation slots live in the engine (default routing in Synth::Synth)
+    modulationSlots = synth->getModulationSlots();
 
-    // Initialize LFO history buffers
-    for (int i = 0; i < 4; ++i) {
-        lfoHistoryBuffer[i].resize(LFO_HISTORY_SIZE, 0.0f);
-        lfoHistoryWritePos[i] = 0;
+    // Keep the sample browser's directory index next to the sample cache
+    if (synth && !synth->getSampleBank()->getCacheDirectory().empty()) {
+        sampleBrowserWorker.setIndexPath(synth->getSampleBank()->getCacheDirectory() + "/browser.index");
     }
 
     // Load available presets
@@ -78,30 +82,21 @@ UI::UI(Synth* synth, SynthParameters* params)
         selectedParameterId = initialParams[0];  // Start with first parameter
     }
 
-    // Initialize default modulation routing: ENV 1 → OSC 1-4 Amp (slots 0-3)
-    // This provides amplitude envelope control separate from mix levels
-    for (int i = 0; i < 4; ++i) {
-        modulationSlots[i].source = 4;           // ENV 1 (index 4)
-        modulationSlots[i].curve = 0;            // Linear curve
-        modulationSlots[i].amount = 100;         // 100% modulation
-        modulationSlots[i].destination = i * 6 + 5;  // OSC (i+1) Amp (indices 5, 11, 17, 23)
-        modulationSlots[i].type = 0;             // Unidirectional
-    }
-
-    // Initialize default modulation routing: ENV 1 → SAMP 1-4 Amp (slots 4-7)
-    // This provides amplitude envelope control for samplers in KEY mode
-    // Using bidirectional so envelope 0-1 maps to levelMod 0-1 (not 0.5-1.0)
-    for (int i = 0; i < 4; ++i) {
-        modulationSlots[4 + i].source = 4;       // ENV 1 (index 4)
-        modulationSlots[4 + i].curve = 0;        // Linear curve
-        modulationSlots[4 + i].amount = 100;     // 100% modulation
-        modulationSlots[4 + i].destination = 32 + (i * 5);  // SAMP (i+1) Amp (indices 32, 37, 42, 47)
-        modulationSlots[4 + i].type = 1;         // Bidirectional (gives full 0-1 range)
-    }
-
 }
 
 UI::~UI() {
+    // Loads still in flight were never handed to a sampler
+    sampleBrowserWorker.stop();
+    std::string path;
+    std::string error;
+    int samplerIndex;
+    SampleData* sample;
+    while (sampleBrowserWorker.pollLoad(path, samplerIndex, sample, error)) {
+        if (sample) {
+            synth->getSampleBank()->discardDetached(sample);
+        }
+    }
+
     if (initialized) {
         endwin();
     }
@@ -144,9 +139,6 @@ bool UI::initialize() {
         }
     }
 
-    // Start CPU monitoring
-    cpuMonitor.start();
-
     initialized = true;
     return true;
 }
@@ -161,8 +153,15 @@ bool UI::update() {
         lastValidKey = ch;
     }
 
+    // Take in directory entries and loaded samples from the browser worker
+    pollSampleBrowser();
+    if (presetLibrary.pollChanged()) {
+        availablePresets = presetLibrary.names();
+    }
+
     // Process only the most recent key if any were detected
     if (lastValidKey != ERR) {
+        inputPending = true;
         handleInput(lastValidKey);
 
         if (lastValidKey == 'q' || lastValidKey == 'Q') {
@@ -204,18 +203,3 @@ void UI::setAvailableMidiDevices(const std::vector<std::pair<int, std::string>>&
     availableMidiDevices = devices;
     currentMidiPortNum = currentPort;
 }
-
-void UI::writeToWaveformBuffer(float sample) {
-    int pos = waveformBufferWritePos.load(std::memory_order_relaxed);
-    waveformBuffer[pos] = sample;
-    waveformBufferWritePos.store((pos + 1) % WAVEFORM_BUFFER_SIZE, std::memory_order_relaxed);
-}
-
-void UI::writeToLFOHistory(int lfoIndex, float amplitude) {
-    if (lfoIndex < 0 || lfoIndex >= 4) return;
-    if (lfoHistoryBuffer[lfoIndex].empty()) return;  // Safety check during shutdown
-
-    int pos = lfoHistoryWritePos[lfoIndex];
-    lfoHistoryBuffer[lfoIndex][pos] = amplitude;
-    lfoHistoryWritePos[lfoIndex] = (pos + 1) % LFO_HISTORY_SIZE;
-}
@@ -1,7 +1,11 @@
 #include "../ui.h"
 #include "../sequencer.h"
+#include "../synth.h"
 #include "ui_utils.h"
 #include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
 #include <string>
 
 void UI::drawTabs() {
@@ -25,7 +29,9 @@ void UI::drawTabs() {
         {"LOOPER", UIPage::LOOPER},
         {"SEQUENCER", UIPage::SEQUENCER},
         {"CHAOS", UIPage::CHAOS},
-        {"CONFIG", UIPage::CONFIG}
+        {"CONFIG", UIPage::CONFIG},
+        {"PROF", UIPage::PROFILE},
+        {"SPEC", UIPage::SPECTRUM}
     };
 
     int x = 0;
@@ -94,33 +100,50 @@ void UI::drawCPUOverlay() {
     }
 
     int maxX = getmaxx(stdscr);
-    float cpuUsage = cpuMonitor.getCPUUsage();
+    float mean = cpuMonitor.getMeanLoad() * 100.0f;
+    float p99 = cpuMonitor.getP99Load() * 100.0f;
+    float peak = cpuMonitor.getPeakLoad() * 100.0f;
+    unsigned long long overloads = cpuMonitor.getOverloadCount();
 
     // Draw in top-right corner, right after the tabs
-    int x = maxX - 15;  // Reserve 15 chars for "CPU: 100.0%"
+    // Format: "DSP: XX% p99 XX% pk XX% !N" (N = callbacks over 80% of the deadline)
+    int x = maxX - 33;  // Reserve 33 chars
 
     if (x < 0) {
         return;  // Terminal too narrow
     }
 
-    // Format: "CPU: XX.X%"
     attron(COLOR_PAIR(1));
-    mvprintw(0, x, "CPU:");
+    mvprintw(0, x, "DSP:");
     attroff(COLOR_PAIR(1));
 
-    // Color code based on usage
+    // Color code based on the tail, which is what misses deadlines
     int colorPair;
-    if (cpuUsage < 50.0f) {
-        colorPair = 2;  // Green - low usage
-    } else if (cpuUsage < 80.0f) {
-        colorPair = 3;  // Yellow - medium usage
+    if (p99 < 50.0f) {
+        colorPair = 2;  // Green - low load
+    } else if (p99 < CPUMonitor::kOverloadThreshold * 100.0f) {
+        colorPair = 3;  // Yellow - medium load
     } else {
-        colorPair = 4;  // Red - high usage
+        colorPair = 4;  // Red - near the deadline
     }
 
     attron(COLOR_PAIR(colorPair) | A_BOLD);
-    mvprintw(0, x + 5, "%5.1f%%", cpuUsage);
+    mvprintw(0, x + 5, "%3.0f%% p99 %3.0f%% pk %3.0f%%", mean, p99, peak);
     attroff(COLOR_PAIR(colorPair) | A_BOLD);
+
+    if (overloads > 0) {
+        attron(COLOR_PAIR(4) | A_BOLD);
+        mvprintw(0, x + 28, "!%llu", std::min(overloads, 9999ULL));
+        attroff(COLOR_PAIR(4) | A_BOLD);
+    }
+
+    // Quality governor steps in effect, left of the meter: "Q-N"
+    int level = qualityGovernor.getLevel();
+    if (level > 0 && x >= 5) {
+        attron(COLOR_PAIR(3) | A_BOLD);
+        mvprintw(0, x - 5, "Q-%d", level);
+        attroff(COLOR_PAIR(3) | A_BOLD);
+    }
 }
 
 void UI::drawHotkeyLine() {
@@ -145,13 +168,45 @@ void UI::drawHotkeyLine() {
     }
 }
 
+double UI::frameClock() {
+    auto now = std::chrono::steady_clock::now();
+    return std::chrono::duration<double>(now.time_since_epoch()).count();
+}
+
+bool UI::isFrameDue() const {
+    if (inputPending || lastFrameTime < 0.0) {
+        return true;
+    }
+    // A little early rather than a whole UI tick late
+    return frameClock() - lastFrameTime + 0.01 >= frameInterval;
+}
+
+void UI::finishFrame(double frameStart) {
+    // curses sends only the cells that differ from what is on screen, so a
+    // frame that changed little is cheap to write; the time this takes is
+    // the measure of how much the terminal can take
+    refresh();
+
+    double now = frameClock();
+    frameCost += 0.25 * ((now - frameStart) - frameCost);
+    frameInterval = std::clamp(frameCost / kFrameBudget, kMinFrameInterval, kMaxFrameInterval);
+    lastFrameTime = now;
+    inputPending = false;
+}
+
 void UI::draw(int activeVoices) {
+    const double frameStart = frameClock();
+    if (synth) {
+        telemetry = &synth->readTelemetry();
+        // The audio thread fills the spectrum rings only while they are shown
+        synth->setSpectrumEnabled(currentPage == UIPage::SPECTRUM && !helpActive);
+    }
     erase();  // Use erase() instead of clear() - doesn't cause flicker
 
     // If help is active, show help instead of normal UI
     if (helpActive) {
         drawHelpPage();
-        refresh();
+        finishFrame(frameStart);
         return;
     }
 
@@ -210,6 +265,12 @@ void UI::draw(int activeVoices) {
         case UIPage::CONFIG:
             drawConfigPage();
             break;
+        case UIPage::PROFILE:
+            drawProfilePage();
+            break;
+        case UIPage::SPECTRUM:
+            drawSpectrumPage();
+            break;
     }
 
     drawHotkeyLine();  // Always draw hotkey line at bottom
@@ -395,6 +456,12 @@ void UI::draw(int activeVoices) {
         mvprintw(startY + 1, startX + 2, "Load Sample - %s", sampleBrowserCurrentDir.c_str());
         attroff(COLOR_PAIR(5) | A_BOLD);
 
+        if (sampleBrowserScanning) {
+            attron(COLOR_PAIR(3));
+            mvprintw(startY + 2, startX + 2, "Scanning... %d samples", static_cast<int>(sampleBrowserFiles.size()));
+            attroff(COLOR_PAIR(3));
+        }
+
         // Draw items
         int displayRow = startY + 3;
         int endIndex = std::min(sampleBrowserScrollOffset + maxVisible, totalItems);
@@ -408,7 +475,31 @@ void UI::draw(int activeVoices) {
                 displayName = "[" + sampleBrowserDirs[i] + "]";
             } else {
                 int fileIndex = i - sampleBrowserDirs.size();
-                displayName = sampleBrowserFiles[fileIndex];
+                const SampleBrowserEntry& file = sampleBrowserFiles[fileIndex];
+                displayName = file.name;
+
+                // Format column from the probed header, e.g. "44.1k 2ch 24b 3.2s"
+                if (file.sampleRate > 0) {
+                    char format[32];
+                    int len = (file.sampleRate % 1000 == 0)
+                        ? snprintf(format, sizeof(format), "%uk", file.sampleRate / 1000)
+                        : snprintf(format, sizeof(format), "%.1fk", file.sampleRate / 1000.0f);
+                    float seconds = static_cast<float>(file.frames) / file.sampleRate;
+                    if (seconds < 60.0f) {
+                        snprintf(format + len, sizeof(format) - len, " %uch %ub %.1fs",
+                                 static_cast<unsigned>(file.channels), static_cast<unsigned>(file.bitsPerSample), seconds);
+                    } else {
+                        snprintf(format + len, sizeof(format) - len, " %uch %ub %d:%02d",
+                                 static_cast<unsigned>(file.channels), static_cast<unsigned>(file.bitsPerSample),
+                                 static_cast<int>(seconds) / 60, static_cast<int>(seconds) % 60);
+                    }
+                    int nameWidth = 53 - static_cast<int>(strlen(format));
+                    if (static_cast<int>(displayName.length()) > nameWidth) {
+                        displayName = displayName.substr(0, nameWidth - 3) + "...";
+                    }
+                    displayName.append(nameWidth - displayName.length() + 1, ' ');
+                    displayName += format;
+                }
             }
 
             // Truncate if too long
@@ -433,5 +524,5 @@ void UI::draw(int activeVoices) {
         attroff(COLOR_PAIR(3));
     }
 
-    refresh();
+    finishFrame(frameStart);
 }
@@ -144,7 +144,8 @@ CONTROLS:
   L              - MIDI Learn (assign MIDI CC)
 
 PARAMETERS:
-  Type       - Reverb algorithm (Greyhole, Plate, Room, Hall, Spring)
+  Type       - Reverb algorithm (Greyhole, Plate, Room, Hall, Spring,
+               LateDiff, Convolution)
   Enabled    - Bypass reverb processing
   Delay Time - Pre-delay before reverb (0-1)
   Size       - Reverb room size (0.5-3.0)
@@ -163,6 +164,24 @@ spaces with infinitely long decay times.
 
 The Modulation parameters add subtle pitch shifting and movement to the
 reverb tail, creating shimmering, ethereal textures that never sound static.
+
+LATEDIFF:
+The LateDiff type swaps Greyhole for a late-diffusion tank: three shelved
+allpass diffusers and a feedback delay per side, the two sides trading
+their feedback. The same controls apply with their own meaning:
+  Delay Time - Skews the size between left and right (0 = alike)
+  Size       - Room size, ~4 ms to ~0.5 s per stage
+  Decay      - RT60, 0.3 to 30 seconds
+  Damping    - Treble loss per pass, 0 to -12 dB above 4.2 kHz
+  Mod Depth  - Delay wobble, up to +-2 ms
+Switching type starts the new engine from silence.
+
+CONVOLUTION:
+The Convolution type plays a captured room: the impulse response given
+with --ir <file.wav> (mono or stereo, up to 10 s), or a built-in 2.5 s
+decaying noise tail without one. Only Mix applies; the wet signal is
+256 frames (~5 ms) late. IRs are normalized, so any file mixes at a
+similar level.
 )";
             break;
 
@@ -182,6 +201,9 @@ PARAMETERS:
   Enabled - Bypass filter processing
   Cutoff  - Filter cutoff frequency (20-20000 Hz)
   Gain    - Shelf gain in dB (for shelf filters only)
+  Placement  - Mix, or Per Voice (Lowpass, Highpass and Ladder)
+  Env Amount - Per Voice: cutoff offset at full envelope (octaves)
+  Oversample - Run the mix Ladder at 2x or 4x the rate (Off, 2x, 4x)
 
 ABOUT:
 The filter section provides tone shaping capabilities. Lowpass and highpass
@@ -191,6 +213,13 @@ smooth, artifact-free cutoff modulation.
 The shelf filters allow you to boost or cut high or low frequencies,
 useful for brightening dull sounds or removing muddiness. All filter types
 support MIDI learn for real-time modulation.
+
+Per Voice filters every voice on its own before the mix, so each note gets
+its own filter sweep from its envelope. The shelves always filter the mix.
+
+At high Drive the Ladder's saturators create harmonics above Nyquist that
+fold back as inharmonic tones. Oversample runs the mix Ladder at 2x or 4x
+the rate and filters them out first, at 2x or 4x its CPU cost.
 )";
             break;
 
@@ -203,27 +232,39 @@ CONTROLS:
   O          - Toggle Overdub mode
   S          - Stop loop
   C          - Clear loop
-  1-4        - Select loop (4 independent loops)
+  1-9        - Select loop (4 by default, --loops n for up to 64)
+  , / .      - Previous / next loop
   [/]        - Adjust overdub mix
+  W          - Save loop to ~/.config/wakefield/loops/loopN.wav
+  Shift+R    - Load loop from that file (swaps in at the loop boundary)
+  U / Y      - Undo / redo the last overdub pass (8 levels)
+  V          - Playback speed: 1x, 2x, 1/2x, then the same in reverse
+  B          - Quantize changes to the clock: off / beat / bar
+  E          - Record the master output to ~/.config/wakefield/recordings
   H          - Show this help
 
 PARAMETERS:
-  Current Loop - Active loop (1-4)
+  Current Loop - Active loop
   Overdub Mix  - Wet amount for overdubbing (0-100%)
 
 ABOUT:
-Wakefield includes 4 independent guitar-pedal-style loopers. Each loop can
-record, playback, overdub, stop, and clear independently.
+Wakefield includes independent guitar-pedal-style loopers (4, or as many as
+--loops asks for). Each loop can record, playback, overdub, stop, and clear
+independently. An empty or stopped loop costs no audio processing.
 
 WORKFLOW:
 1. Press Space to start recording
 2. Press Space again to start playback
 3. Press O to enter overdub mode (layers on top)
 4. Use [/] to control how much new audio mixes with existing loop
-5. Switch between loops with 1-4 keys to layer different parts
+5. Switch between loops with 1-9 or ,/. to layer different parts
 
 The overdub mix control is crucial - keeping it around 60% prevents the loop
 from getting too loud when layering multiple passes.
+
+With quantize on and the sequencer clock running, a press waits for the next
+beat or bar and takes effect on that exact sample, so loops recorded this way
+are a whole number of beats or bars long. Clear is always immediate.
 )";
             break;
 
@@ -240,6 +281,10 @@ CONTROLS:
   h/j        - Euclidean hits -/+ 1
   1-4        - Switch track (4 tracks)
   [/]        - Rotate pattern left/right
+  A          - Arm/disarm automation recording on the current track
+  X          - Clear the current track's automation
+  W          - Save the session (parameters, tracks, loops; see README)
+  ,/.        - Load the previous/next saved session
   H          - Show this help
   Arrow keys - Navigate tracker rows/columns (Left pane) and info entries (Right pane)
   Shift+Up/Down - Fine adjust selected tracker cell or info field while playing
@@ -254,6 +299,13 @@ LAYOUT:
     Euclidean data, subdivision, mute/solo state, and quick statistics for the
     active track. Use Arrow Right from the tracker to focus the info pane.
 
+AUTOMATION:
+  While armed ([AUTO REC] next to the title) and playing, every knob move
+  (UI, MIDI CC, OSC) is written into the track's automation at its position
+  in the pattern loop, replacing what the lanes it touches held there. Each
+  pass of the loop plays the lanes back on the exact sample, alongside the
+  notes. A lane being recorded does not play back until recording stops.
+
 ABOUT:
 The sequencer is a generative MIDI pattern generator that combines three
 powerful algorithmic composition techniques:
@@ -364,10 +416,12 @@ PARAMETERS:
   Loop Start - Start position of loop region (0-100%)
   Loop Length- Length of loop region (0-100%)
   Xfade      - Crossfade length at loop boundaries (0-100%)
+  Snap       - Move loop points to nearby zero crossings
   Octave     - Coarse pitch shift (-5 to +5 octaves)
   Tune       - Fine pitch control (-1.0 to +1.0 = ±6 semitones)
   Sync       - Tempo sync mode (off/on/trip/dot)
   Note Reset - Restart playback on note-on
+  Interp     - Resampling quality (Linear, Hermite, Sinc)
 
 ABOUT:
 Wakefield features 4 independent samplers with advanced loop control.
@@ -444,6 +498,8 @@ TIPS:
   - Combine FM with the morph parameter for evolving sounds
   - Higher depth values create more aggressive, harmonically dense sounds
   - Self-modulation (diagonal cells) creates feedback FM
+  - Deep FM on high notes aliases; set FM Oversample on the CONFIG page
+    to 2x or 4x to render the FM voices at that multiple of the rate
 
 CLASSIC FM ALGORITHMS:
   - 2-Operator: OSC1→OSC2 (simple, bell-like tones)
@@ -549,6 +605,15 @@ SYSTEM INFO:
 To change devices, select them from the list and press Enter. The application
 will restart with the new configuration.
 
+OVERSAMPLING:
+  FM Oversample - Render voices with FM routes at 2x or 4x the rate
+  OS Quality    - Half-band filters of every oversampled stage (FM and
+                  the Filter page's Ladder): Draft ~70 dB, Normal ~85 dB,
+                  High ~100 dB of alias rejection
+  Reverb Rate   - Half runs the reverb (Greyhole or LateDiff) at half the
+                  sample rate for about half its CPU; the wet signal
+                  rolls off above ~10 kHz, dry and mix stay full rate
+
 MIDI KEYBOARD MODE:
 Press Ctrl+K from any page to toggle MIDI Keyboard Mode. When active, your
 typing keyboard becomes a musical keyboard that triggers MIDI notes:
@@ -573,6 +638,74 @@ Notes:
 - Notes sustain until you release the mode (no key-release detection)
 - All normal UI navigation is disabled while in MIDI keyboard mode
 - Use ESC or Ctrl+K to exit the mode and return to normal operation
+)";
+            break;
+
+        case UIPage::PROFILE:
+            content = R"(
+=== PROFILE ===
+
+CONTROLS:
+  Shift+R    - Reset the histograms (start a new measurement window)
+  Shift+T    - Start/stop the timeline trace
+  Shift+D    - Write the trace to ~/.config/wakefield/traces/
+  H          - Show this help
+  Q          - Quit
+
+ABOUT:
+Per-stage timings of the audio thread, measured with the CPU cycle counter.
+Each row is one stage of the render: parameter smoothing, the modulation
+matrix, each voice, the filter, the reverb, the looper and the oscilloscope
+(waveform) write. A sample is one call of that stage: once per audio
+callback for smoothing and the looper, once per synth render call for the
+rest (a callback is split into several calls at note events).
+
+COLUMNS:
+  Calls  - Samples since the last reset
+  Mean   - Average time per call
+  p50    - Median (upper edge of its histogram bucket)
+  p99    - 99th percentile (upper edge of its bucket)
+  Max    - Upper edge of the slowest bucket seen
+  Share  - This stage's part of the total time of all stages
+  Histogram - Log2 buckets from ~0.1 us (left) up to ~4 ms (right)
+
+TIMELINE TRACE:
+While the trace is on, each timed stage above, and the work of the UI,
+sample loader, sample streaming, effects and metrics threads, is logged
+as a begin/end event per thread. Shift+D writes the last few seconds as
+Chrome trace JSON: open it in ui.perfetto.dev or chrome://tracing to see
+what every thread was doing around a glitch.
+
+The profiler is compiled out by default. Configure with
+  cmake -DWAKEFIELD_PROFILE=ON ..
+to enable it. The CONFIG page's DSP Load Meter shows overall deadline use.
+)";
+            break;
+
+        case UIPage::SPECTRUM:
+            content = R"(
+=== SPECTRUM ===
+
+CONTROLS:
+  V          - Cycle the view: output, pre-filter, or both
+  F          - Freeze / unfreeze the display
+  H          - Show this help
+  Q          - Quit
+
+ABOUT:
+A live spectrum of the synth's left channel, from 20 Hz to 20 kHz on a log
+scale. The output view is the signal after the mix filter and the reverb;
+the pre-filter view is the voice mix going into the filter. With both
+shown, the output is drawn as bars and the pre-filter level as dots (o
+where the filter boosts above its input), which shows the filter's
+response on the material actually playing. The ^ on the frequency axis
+marks the filter cutoff.
+
+Each frame takes the newest 4096 samples (a Hann-windowed FFT, about
+12 Hz per bin at 48 kHz) and shows the loudest bin under each column. The
+level falls back at 30 dB per second so short peaks stay readable; 0 dB
+is a full-scale sine. The audio thread only copies its blocks into the
+analyzer's rings, and only while this page is open.
 )";
             break;
 
@@ -225,13 +225,15 @@ void UI::handleInput(int ch) {
         else if (currentPage == UIPage::LOOPER) setPage(UIPage::SEQUENCER);
         else if (currentPage == UIPage::SEQUENCER) setPage(UIPage::CHAOS);
         else if (currentPage == UIPage::CHAOS) setPage(UIPage::CONFIG);
+        else if (currentPage == UIPage::CONFIG) setPage(UIPage::PROFILE);
+        else if (currentPage == UIPage::PROFILE) setPage(UIPage::SPECTRUM);
         else setPage(UIPage::OSCILLATOR);
         return;
     }
 
     // Ctrl+Tab (KEY_BTAB or Shift+Tab) cycles backward through pages
     if (ch == KEY_BTAB || ch == 353) {  // KEY_BTAB = Shift+Tab, 353 = some terminals
-        if (currentPage == UIPage::OSCILLATOR) setPage(UIPage::CONFIG);
+        if (currentPage == UIPage::OSCILLATOR) setPage(UIPage::SPECTRUM);
         else if (currentPage == UIPage::SAMPLER) setPage(UIPage::OSCILLATOR);
         else if (currentPage == UIPage::MIXER) setPage(UIPage::SAMPLER);
         else if (currentPage == UIPage::LFO) setPage(UIPage::MIXER);
@@ -244,6 +246,8 @@ void UI::handleInput(int ch) {
         else if (currentPage == UIPage::SEQUENCER) setPage(UIPage::LOOPER);
         else if (currentPage == UIPage::CHAOS) setPage(UIPage::SEQUENCER);
         else if (currentPage == UIPage::CONFIG) setPage(UIPage::CHAOS);
+        else if (currentPage == UIPage::PROFILE) setPage(UIPage::CONFIG);
+        else if (currentPage == UIPage::SPECTRUM) setPage(UIPage::PROFILE);
         return;
     }
 
@@ -512,6 +516,55 @@ void UI::handleInput(int ch) {
         return;
     }
 
+    // Profile window reset (shift+r when on PROFILE page)
+    if (currentPage == UIPage::PROFILE && ch == 'R') {
+        resetProfileBaseline();
+        addConsoleMessage("Profile histograms reset");
+        return;
+    }
+
+    // Timeline trace (shift+t starts/stops, shift+d writes the last few seconds)
+    if (currentPage == UIPage::PROFILE && ch == 'T') {
+        if (!profile::enabled()) {
+            addConsoleMessage("Profiling is compiled out of this build");
+        } else {
+            profile::setTracing(!profile::tracing());
+            addConsoleMessage(profile::tracing() ? "Trace started" : "Trace stopped");
+        }
+        return;
+    }
+    if (currentPage == UIPage::PROFILE && ch == 'D') {
+        dumpProfileTrace();
+        return;
+    }
+
+    // Spectrum view and freeze (SPECTRUM page)
+    if (currentPage == UIPage::SPECTRUM && (ch == 'v' || ch == 'V')) {
+        spectrumView = (spectrumView + 1) % 3;
+        return;
+    }
+    if (currentPage == UIPage::SPECTRUM && (ch == 'f' || ch == 'F')) {
+        spectrumFrozen = !spectrumFrozen;
+        addConsoleMessage(spectrumFrozen ? "Spectrum frozen" : "Spectrum running");
+        return;
+    }
+
+    // Automation record and clear (SEQUENCER page, current track)
+    if (currentPage == UIPage::SEQUENCER && sequencer && (ch == 'a' || ch == 'A')) {
+        const bool recording = !sequencer->isAutomationRecording();
+        sequencer->setAutomationRecording(recording);
+        addConsoleMessage(recording ? "Automation recording on track " +
+                                          std::to_string(sequencer->getCurrentTrackIndex() + 1)
+                                    : "Automation recording off");
+        return;
+    }
+    if (currentPage == UIPage::SEQUENCER && sequencer && (ch == 'x' || ch == 'X')) {
+        sequencer->clearAutomation();
+        addConsoleMessage("Automation cleared on track " +
+                          std::to_string(sequencer->getCurrentTrackIndex() + 1));
+        return;
+    }
+
     // FM Matrix navigation and editing
     if (currentPage == UIPage::FM) {
         auto adjustFMDepth = [&](float delta) {
@@ -565,11 +618,19 @@ void UI::handleInput(int ch) {
     // Looper-specific hotkeys (only active on looper page)
     if (currentPage == UIPage::LOOPER) {
         switch (ch) {
-            // Loop selection (1-4)
-            case '1': params->currentLoop = 0; break;
-            case '2': params->currentLoop = 1; break;
-            case '3': params->currentLoop = 2; break;
-            case '4': params->currentLoop = 3; break;
+            // Loop selection: 1-9 directly, ,/. step through every loop
+            case '1': case '2': case '3': case '4': case '5': case '6': case '7': case '8': case '9':
+                if (loopManager && ch - '1' < loopManager->getLoopCount()) {
+                    params->currentLoop = ch - '1';
+                }
+                break;
+            case ',':
+            case '.':
+                if (loopManager) {
+                    const int count = loopManager->getLoopCount();
+                    params->currentLoop = (params->currentLoop.load() + (ch == '.' ? 1 : count - 1)) % count;
+                }
+                break;
 
             // Overdub toggle (O/o)
             case 'O':
@@ -598,6 +659,88 @@ void UI::handleInput(int ch) {
                 }
                 break;
 
+            // Save the current loop to its WAV file (W/w)
+            case 'W':
+            case 'w':
+                if (loopManager) {
+                    int index = loopManager->getCurrentLoopIndex();
+                    loopManager->saveLoop(index, LoopManager::getLoopFilePath(index));
+                    addConsoleMessage("Saving loop " + std::to_string(index + 1) + "...");
+                }
+                break;
+
+            // Load the current loop back from its WAV file (shift+r)
+            case 'R':
+                if (loopManager) {
+                    int index = loopManager->getCurrentLoopIndex();
+                    loopManager->loadLoop(index, LoopManager::getLoopFilePath(index));
+                    addConsoleMessage("Loading loop " + std::to_string(index + 1) + "...");
+                }
+                break;
+
+            // Start or stop recording the master output (E/e)
+            case 'E':
+            case 'e':
+                recordToggleRequested = true;
+                break;
+
+            // Quantize loop changes to the clock: off, beat, bar (B/b)
+            case 'B':
+            case 'b': {
+                const char* modes[] = {"off", "beat", "bar"};
+                int mode = (params->loopQuantize.load() + 1) % 3;
+                params->loopQuantize = mode;
+                addConsoleMessage(std::string("Loop quantize: ") + modes[mode]);
+                break;
+            }
+
+            // Loop playback speed: 1x, 2x, 1/2x, then the same reversed (V/v)
+            case 'V':
+            case 'v':
+                if (loopManager) {
+                    Looper* loop = loopManager->getCurrentLoop();
+                    if (loop) {
+                        const float speeds[] = {1.0f, 2.0f, 0.5f, -1.0f, -2.0f, -0.5f};
+                        int next = 0;
+                        for (int k = 0; k < 6; ++k) {
+                            if (speeds[k] == loop->getSpeed()) {
+                                next = (k + 1) % 6;
+                            }
+                        }
+                        loop->setSpeed(speeds[next]);
+                        char label[16];
+                        std::snprintf(label, sizeof(label), "%s%gx", speeds[next] < 0.0f ? "reverse " : "",
+                                      std::fabs(speeds[next]));
+                        addConsoleMessage("Loop " + std::to_string(loopManager->getCurrentLoopIndex() + 1) +
+                                          " speed: " + label);
+                    }
+                }
+                break;
+
+            // Undo the last overdub pass (U/u)
+            case 'U':
+            case 'u':
+                if (loopManager) {
+                    Looper* loop = loopManager->getCurrentLoop();
+                    if (loop) {
+                        loop->pressUndo();
+                        addConsoleMessage("Undo loop " + std::to_string(loopManager->getCurrentLoopIndex() + 1));
+                    }
+                }
+                break;
+
+            // Redo an undone overdub pass (Y/y)
+            case 'Y':
+            case 'y':
+                if (loopManager) {
+                    Looper* loop = loopManager->getCurrentLoop();
+                    if (loop) {
+                        loop->pressRedo();
+                        addConsoleMessage("Redo loop " + std::to_string(loopManager->getCurrentLoopIndex() + 1));
+                    }
+                }
+                break;
+
             // Overdub mix ([/])
             case '[':
                 params->overdubMix = std::max(0.0f, params->overdubMix.load() - 0.05f);
@@ -737,6 +880,18 @@ void UI::handleInput(int ch) {
                 sequencer->rotatePattern(1);
                 addConsoleMessage("Sequencer: Rotated pattern right");
                 break;
+
+            // Save the session (W/w); load the previous/next one (,/.)
+            case 'W':
+            case 'w':
+                saveSession();
+                break;
+            case ',':
+                stepSession(-1);
+                break;
+            case '.':
+                stepSession(1);
+                break;
         }
     }
 }
@@ -1,10 +1,14 @@
 #include "../ui.h"
 #include "../synth.h"
+#include "../loop_manager.h"
 #include <algorithm>
 #include <cmath>
 #include <chrono>
 #include <string>
 
+// External reference to global object from main.cpp
+extern LoopManager* loopManager;
+
 void UI::initializeParameters() {
     parameters.clear();
 
@@ -31,7 +35,7 @@ void UI::initializeParameters() {
     parameters.push_back({205, ParamType::BOOL, "Reset On Note", "", 0, 1, {}, true, static_cast<int>(UIPage::LFO)});
 
     // REVERB page parameters - ALL support MIDI learn
-    parameters.push_back({20, ParamType::ENUM, "Reverb Type", "", 0, 4, {"Greyhole", "Plate", "Room", "Hall", "Spring"}, true, static_cast<int>(UIPage::REVERB)});
+    parameters.push_back({20, ParamType::ENUM, "Reverb Type", "", 0, 6, {"Greyhole", "Plate", "Room", "Hall", "Spring", "LateDiff", "Convolution"}, true, static_cast<int>(UIPage::REVERB)});
     parameters.push_back({21, ParamType::BOOL, "Reverb Enabled", "", 0, 1, {}, true, static_cast<int>(UIPage::REVERB)});
     parameters.push_back({22, ParamType::FLOAT, "Delay Time", "", 0.0f, 1.0f, {}, true, static_cast<int>(UIPage::REVERB)});
     parameters.push_back({23, ParamType::FLOAT, "Size", "", 0.0f, 1.0f, {}, true, static_cast<int>(UIPage::REVERB)});
@@ -50,9 +54,13 @@ void UI::initializeParameters() {
     parameters.push_back({34, ParamType::FLOAT, "Resonance", "", 0.0f, 1.2f, {}, true, static_cast<int>(UIPage::FILTER)});
     parameters.push_back({35, ParamType::FLOAT, "Drive", "", 0.1f, 15.0f, {}, true, static_cast<int>(UIPage::FILTER)});
     parameters.push_back({36, ParamType::FLOAT, "FB HP", "Hz", 10.0f, 6000.0f, {}, true, static_cast<int>(UIPage::FILTER)});
+    parameters.push_back({37, ParamType::ENUM, "Placement", "", 0, 1, {"Mix", "Per Voice"}, true, static_cast<int>(UIPage::FILTER)});
+    parameters.push_back({38, ParamType::FLOAT, "Env Amount", "oct", -8.0f, 8.0f, {}, true, static_cast<int>(UIPage::FILTER)});
+    parameters.push_back({39, ParamType::ENUM, "Oversample", "", 0, 2, {"Off", "2x", "4x"}, true, static_cast<int>(UIPage::FILTER)});
 
     // LOOPER page parameters - ALL support MIDI learn
-    parameters.push_back({40, ParamType::INT, "Current Loop", "", 0, 3, {}, true, static_cast<int>(UIPage::LOOPER)});
+    const int loopCount = loopManager ? loopManager->getLoopCount() : DEFAULT_LOOPS;
+    parameters.push_back({40, ParamType::INT, "Current Loop", "", 0, static_cast<float>(loopCount - 1), {}, true, static_cast<int>(UIPage::LOOPER)});
     parameters.push_back({41, ParamType::FLOAT, "Overdub Mix", "", 0.0f, 1.0f, {}, true, static_cast<int>(UIPage::LOOPER)});
 
     // MIXER page parameters - oscillator and sampler mix levels (50-57)
@@ -65,20 +73,25 @@ void UI::initializeParameters() {
     parameters.push_back({56, ParamType::FLOAT, "SAMP 3 Level", "", 0.0f, 1.0f, {}, true, static_cast<int>(UIPage::MIXER)});
     parameters.push_back({57, ParamType::FLOAT, "SAMP 4 Level", "", 0.0f, 1.0f, {}, true, static_cast<int>(UIPage::MIXER)});
 
-    // SAMPLER page parameters - control the currently selected sampler (60-69)
+    // SAMPLER page parameters - control the currently selected sampler (60-71)
     parameters.push_back({69, ParamType::ENUM, "Sample", "", 0, 0, {}, false, static_cast<int>(UIPage::SAMPLER)});  // Special: opens sample browser
     parameters.push_back({60, ParamType::ENUM, "Key Mode", "", 0, 1, {"KEY", "FREE"}, true, static_cast<int>(UIPage::SAMPLER)});
     parameters.push_back({68, ParamType::ENUM, "Direction", "", 0, 2, {"Forward", "Reverse", "Ping-Pong"}, true, static_cast<int>(UIPage::SAMPLER)});
     parameters.push_back({61, ParamType::FLOAT, "Loop Start", "%", 0.0f, 100.0f, {}, true, static_cast<int>(UIPage::SAMPLER)});
     parameters.push_back({62, ParamType::FLOAT, "Loop Length", "%", 0.0f, 100.0f, {}, true, static_cast<int>(UIPage::SAMPLER)});
     parameters.push_back({63, ParamType::FLOAT, "Xfade", "%", 0.0f, 100.0f, {}, true, static_cast<int>(UIPage::SAMPLER)});
+    parameters.push_back({71, ParamType::BOOL, "Snap", "", 0, 1, {}, true, static_cast<int>(UIPage::SAMPLER)});
     parameters.push_back({64, ParamType::INT, "Octave", "", -5, 5, {}, true, static_cast<int>(UIPage::SAMPLER)});
     parameters.push_back({65, ParamType::FLOAT, "Tune", "", -1.0f, 1.0f, {}, true, static_cast<int>(UIPage::SAMPLER)});
     parameters.push_back({66, ParamType::ENUM, "Sync", "", 0, 3, {"Off", "On", "Trip", "Dot"}, true, static_cast<int>(UIPage::SAMPLER)});
     parameters.push_back({67, ParamType::BOOL, "Note Reset", "", 0, 1, {}, true, static_cast<int>(UIPage::SAMPLER)});
+    parameters.push_back({70, ParamType::ENUM, "Interp", "", 0, 2, {"Linear", "Hermite", "Sinc"}, true, static_cast<int>(UIPage::SAMPLER)});
 
     // CONFIG page parameters
-    parameters.push_back({400, ParamType::BOOL, "CPU Monitor", "", 0, 1, {}, false, static_cast<int>(UIPage::CONFIG)});
+    parameters.push_back({400, ParamType::BOOL, "DSP Load Meter", "", 0, 1, {}, false, static_cast<int>(UIPage::CONFIG)});
+    parameters.push_back({401, ParamType::ENUM, "FM Oversample", "", 0, 2, {"Off", "2x", "4x"}, false, static_cast<int>(UIPage::CONFIG)});
+    parameters.push_back({402, ParamType::ENUM, "OS Quality", "", 0, 2, {"Draft", "Normal", "High"}, false, static_cast<int>(UIPage::CONFIG)});
+    parameters.push_back({403, ParamType::ENUM, "Reverb Rate", "", 0, 1, {"Full", "Half"}, false, static_cast<int>(UIPage::CONFIG)});
 
     // ENV page parameters - control the currently selected envelope (300-323)
     // Envelope 1: 300-305
@@ -162,7 +175,7 @@ float UI::getParameterValue(int id) {
         case 55: return synth->getSamplerLevel(1);  // SAMP 2 Level (mixer)
         case 56: return synth->getSamplerLevel(2);  // SAMP 3 Level (mixer)
         case 57: return synth->getSamplerLevel(3);  // SAMP 4 Level (mixer)
-        // SAMPLER page parameters (60-69)
+        // SAMPLER page parameters (60-71)
         case 69: return 0.0f;  // Sample name selector (special: no value)
         case 60: return synth->getSamplerKeyMode(samplerIndex) ? 0.0f : 1.0f;
         case 68: return static_cast<float>(synth->getSamplerPlaybackMode(samplerIndex));
@@ -173,6 +186,8 @@ float UI::getParameterValue(int id) {
         case 65: return synth->getSamplerTune(samplerIndex);
         case 66: return static_cast<float>(synth->getSamplerSyncMode(samplerIndex));
         case 67: return synth->getSamplerNoteReset(samplerIndex) ? 1.0f : 0.0f;
+        case 70: return static_cast<float>(synth->getSamplerInterpolation(samplerIndex));
+        case 71: return synth->getSamplerLoopSnap(samplerIndex) ? 1.0f : 0.0f;
         case 200: return params->getLfoPeriod(lfoIndex);
         case 201: return static_cast<float>(params->getLfoSyncMode(lfoIndex));
         case 202: return params->getLfoMorph(lfoIndex);
@@ -197,10 +212,16 @@ float UI::getParameterValue(int id) {
         case 34: return params->filterResonance.load();
         case 35: return params->filterDrive.load();
         case 36: return params->filterFeedbackHP.load();
+        case 37: return params->filterPerVoice.load() ? 1.0f : 0.0f;
+        case 38: return params->filterEnvAmount.load();
+        case 39: return static_cast<float>(params->filterOversample.load());
         case 40: return static_cast<float>(params->currentLoop.load());
         case 41: return params->overdubMix.load();
         // CONFIG page parameters
         case 400: return cpuMonitor.isEnabled() ? 1.0f : 0.0f;
+        case 401: return static_cast<float>(params->fmOversample.load());
+        case 402: return static_cast<float>(params->oversampleQuality.load());
+        case 403: return static_cast<float>(params->reverbRate.load());
         // ENV page parameters (300-323)
         case 300: return params->getEnvAttack(0);
         case 301: return params->getEnvDecay(0);
@@ -260,7 +281,7 @@ void UI::setParameterValue(int id, float value) {
         case 55: synth->setSamplerLevel(1, value); break;  // SAMP 2 Level (mixer)
         case 56: synth->setSamplerLevel(2, value); break;  // SAMP 3 Level (mixer)
         case 57: synth->setSamplerLevel(3, value); break;  // SAMP 4 Level (mixer)
-        // SAMPLER page parameters (60-69)
+        // SAMPLER page parameters (60-71)
         case 69: break;  // Sample name selector (special: no-op, handled by Enter key)
         case 60: synth->setSamplerKeyMode(samplerIndex, value < 0.5f); break;
         case 68: synth->setSamplerPlaybackMode(samplerIndex, static_cast<PlaybackMode>(static_cast<int>(value))); break;
@@ -271,6 +292,8 @@ void UI::setParameterValue(int id, float value) {
         case 65: synth->setSamplerTune(samplerIndex, value); break;
         case 66: synth->setSamplerSyncMode(samplerIndex, static_cast<int>(value)); break;
         case 67: synth->setSamplerNoteReset(samplerIndex, value > 0.5f); break;
+        case 70: synth->setSamplerInterpolation(samplerIndex, static_cast<SamplerInterpolation>(static_cast<int>(value))); break;
+        case 71: synth->setSamplerLoopSnap(samplerIndex, value > 0.5f); break;
         case 200: params->setLfoPeriod(lfoIndex, value); break;
         case 201: params->setLfoSyncMode(lfoIndex, static_cast<int>(value)); break;
         case 202: params->setLfoMorph(lfoIndex, value); break;
@@ -295,10 +318,16 @@ void UI::setParameterValue(int id, float value) {
         case 34: params->filterResonance = value; break;
         case 35: params->filterDrive = value; break;
         case 36: params->filterFeedbackHP = value; break;
+        case 37: params->filterPerVoice = (value > 0.5f); break;
+        case 38: params->filterEnvAmount = value; break;
+        case 39: params->filterOversample = static_cast<int>(value); break;
         case 40: params->currentLoop = static_cast<int>(value); break;
         case 41: params->overdubMix = value; break;
         // CONFIG page parameters
         case 400: cpuMonitor.setEnabled(value > 0.5f); break;
+        case 401: params->fmOversample = static_cast<int>(value); break;
+        case 402: params->oversampleQuality = static_cast<int>(value); break;
+        case 403: params->reverbRate = static_cast<int>(value); break;
         // ENV page parameters (300-323)
         case 300: params->setEnvAttack(0, value); params->attack = value; break;
         case 301: params->setEnvDecay(0, value); params->decay = value; break;
@@ -1,16 +1,45 @@
 #include "../ui.h"
+#include "../loop_manager.h"
 #include "../preset.h"
+#include "../sequencer.h"
+#include "../session_file.h"
+#include <algorithm>
+
+// External references to global objects from main.cpp
+extern LoopManager* loopManager;
+extern Sequencer* sequencer;
 
 void UI::refreshPresetList() {
-    availablePresets = PresetManager::listPresets();
+    // update() takes the new list once the library has rescanned
+    presetLibrary.refresh();
 }
 
 void UI::loadPreset(const std::string& filename) {
-    if (PresetManager::loadPreset(filename, params)) {
+    // Indexed presets switch without touching the disk
+    PresetBlock block;
+    if (presetLibrary.find(filename, block)) {
+        PresetManager::applyPresetBlock(block, params);
+        currentPresetName = filename;
+    } else if (PresetManager::loadPreset(filename, params)) {
         currentPresetName = filename;
     }
 }
 
+bool UI::morphPresets(const std::string& presetA, const std::string& presetB) {
+    SynthParamBlock blocks[2];
+    const std::string* names[2] = {&presetA, &presetB};
+    for (int i = 0; i < 2; ++i) {
+        PresetBlock preset;
+        if (!presetLibrary.find(*names[i], preset) &&
+            !PresetManager::readPresetBlock(PresetManager::getPresetPath(*names[i]), preset)) {
+            return false;
+        }
+        params->captureBlock(blocks[i]);
+        PresetManager::applyToBlock(preset, blocks[i]);
+    }
+    return params->startPresetMorph(blocks[0], blocks[1]);
+}
+
 void UI::savePreset(const std::string& filename) {
     if (PresetManager::savePreset(filename, params)) {
         currentPresetName = filename;
@@ -18,6 +47,51 @@ void UI::savePreset(const std::string& filename) {
     }
 }
 
+void UI::saveSession() {
+    if (!sequencer) {
+        return;
+    }
+    std::string message;
+    SessionFile::save(SessionFile::getSessionPath(currentSessionName), *params, *synth, *sequencer,
+                      loopManager, message);
+    addConsoleMessage(message);
+}
+
+bool UI::loadSession(const std::string& name, std::string& message) {
+    if (!sequencer) {
+        message = "No sequencer to load a session into";
+        return false;
+    }
+    SessionFile session;
+    if (!session.open(SessionFile::getSessionPath(name), message)) {
+        return false;
+    }
+    session.apply(*params, *synth, *sequencer, loopManager, message);
+    currentSessionName = name;
+    return true;
+}
+
+void UI::stepSession(int direction) {
+    const std::vector<std::string> names = SessionFile::listSessions();
+    if (names.empty()) {
+        addConsoleMessage("No sessions in " + SessionFile::getSessionDirectory());
+        return;
+    }
+    // From the current name's place in the list, or the ends if it has none
+    auto it = std::lower_bound(names.begin(), names.end(), currentSessionName);
+    int index = static_cast<int>(it - names.begin());
+    if (direction < 0) {
+        index = (index + static_cast<int>(names.size()) - 1) % static_cast<int>(names.size());
+    } else if (it != names.end() && *it == currentSessionName) {
+        index = (index + 1) % static_cast<int>(names.size());
+    } else {
+        index %= static_cast<int>(names.size());
+    }
+    std::string message;
+    loadSession(names[index], message);
+    addConsoleMessage(message);
+}
+
 void UI::startTextInput() {
     textInputActive = true;
     textInputBuffer.clear();
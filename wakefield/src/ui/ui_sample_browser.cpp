@@ -1,7 +1,6 @@
 #include "../ui.h"
 #include "../synth.h"
 #include "../sample_bank.h"
-#include <dirent.h>
 #include <sys/stat.h>
 #include <algorithm>
 #include <cstring>
@@ -13,8 +12,13 @@ void UI::startSampleBrowser() {
     sampleBrowserSelectedIndex = 0;
     sampleBrowserScrollOffset = 0;
 
-    // Convert current directory to absolute path for proper navigation
+    // Create the default samples directory on first use
     char resolved[PATH_MAX];
+    if (realpath("../samples", resolved) == nullptr) {
+        mkdir("../samples", 0755);
+    }
+
+    // Convert current directory to absolute path for proper navigation
     if (realpath(sampleBrowserCurrentDir.c_str(), resolved) != nullptr) {
         sampleBrowserCurrentDir = resolved;
     }
@@ -26,52 +30,89 @@ void UI::refreshSampleBrowserFiles() {
     sampleBrowserFiles.clear();
     sampleBrowserDirs.clear();
 
-    DIR* dir = opendir(sampleBrowserCurrentDir.c_str());
-    if (!dir) {
-        // If directory doesn't exist, try to create ../samples directory
-        char resolved[PATH_MAX];
-        if (realpath("../samples", resolved) == nullptr) {
-            // Path doesn't exist, try to create it
-            mkdir("../samples", 0755);
+    // The worker lists the directory; pollSampleBrowser takes the entries in
+    sampleBrowserScanning = true;
+    sampleBrowserWorker.scan(sampleBrowserCurrentDir);
+}
+
+void UI::pollSampleBrowser() {
+    std::vector<SampleBrowserEntry> found;
+    bool done = false;
+    bool failed = false;
+    if (sampleBrowserWorker.pollScan(found, done, failed)) {
+        // Keep the cursor on the same item while entries stream in
+        int totalDirs = sampleBrowserDirs.size();
+        int totalItems = totalDirs + sampleBrowserFiles.size();
+        bool selectedIsDir = sampleBrowserSelectedIndex < totalDirs;
+        std::string selectedName;
+        if (sampleBrowserSelectedIndex < totalItems) {
+            selectedName = selectedIsDir ? sampleBrowserDirs[sampleBrowserSelectedIndex]
+                                         : sampleBrowserFiles[sampleBrowserSelectedIndex - totalDirs].name;
         }
-        dir = opendir(sampleBrowserCurrentDir.c_str());
-        if (!dir) return;
-    }
 
-    struct dirent* entry;
-    while ((entry = readdir(dir)) != nullptr) {
-        std::string name = entry->d_name;
-
-        // Skip hidden files and current directory
-        if (name[0] == '.' && name != "..") continue;
-
-        std::string fullPath = sampleBrowserCurrentDir + "/" + name;
-        struct stat st;
-        if (stat(fullPath.c_str(), &st) == 0) {
-            if (S_ISDIR(st.st_mode)) {
-                sampleBrowserDirs.push_back(name);
-            } else if (S_ISREG(st.st_mode)) {
-                // Check if it's a .wav file
-                if (name.length() > 4) {
-                    std::string ext = name.substr(name.length() - 4);
-                    std::transform(ext.begin(), ext.end(), ext.begin(), ::tolower);
-                    if (ext == ".wav") {
-                        sampleBrowserFiles.push_back(name);
-                    }
-                }
+        for (SampleBrowserEntry& entry : found) {
+            if (entry.directory) {
+                sampleBrowserDirs.push_back(std::move(entry.name));
+            } else {
+                sampleBrowserFiles.push_back(std::move(entry));
             }
         }
+
+        // Sort directories and files
+        std::sort(sampleBrowserDirs.begin(), sampleBrowserDirs.end());
+        std::sort(sampleBrowserFiles.begin(), sampleBrowserFiles.end(),
+                  [](const SampleBrowserEntry& a, const SampleBrowserEntry& b) { return a.name < b.name; });
+
+        if (!selectedName.empty()) {
+            if (selectedIsDir) {
+                auto it = std::lower_bound(sampleBrowserDirs.begin(), sampleBrowserDirs.end(), selectedName);
+                sampleBrowserSelectedIndex = it - sampleBrowserDirs.begin();
+            } else {
+                auto it = std::lower_bound(sampleBrowserFiles.begin(), sampleBrowserFiles.end(), selectedName,
+                                           [](const SampleBrowserEntry& entry, const std::string& name) {
+                                               return entry.name < name;
+                                           });
+                sampleBrowserSelectedIndex = sampleBrowserDirs.size() + (it - sampleBrowserFiles.begin());
+            }
+
+            // Adjust scroll offset so the selection stays visible (max 20 items)
+            const int maxVisible = 20;
+            if (sampleBrowserSelectedIndex < sampleBrowserScrollOffset) {
+                sampleBrowserScrollOffset = sampleBrowserSelectedIndex;
+            } else if (sampleBrowserSelectedIndex >= sampleBrowserScrollOffset + maxVisible) {
+                sampleBrowserScrollOffset = sampleBrowserSelectedIndex - maxVisible + 1;
+            }
+        }
+
+        sampleBrowserScanning = !done;
+        if (failed) {
+            addConsoleMessage("Cannot read directory: " + sampleBrowserCurrentDir);
+        }
+        inputPending = true;    // Redraw with the new entries
     }
-    closedir(dir);
 
-    // Sort directories and files
-    std::sort(sampleBrowserDirs.begin(), sampleBrowserDirs.end());
-    std::sort(sampleBrowserFiles.begin(), sampleBrowserFiles.end());
+    std::string path;
+    std::string error;
+    int samplerIndex;
+    SampleData* sample;
+    while (sampleBrowserWorker.pollLoad(path, samplerIndex, sample, error)) {
+        inputPending = true;
+        if (!sample) {
+            addConsoleMessage(error.empty() ? "Failed to load: " + path : error);
+            continue;
+        }
 
-    // Reset selection if out of range
-    int totalItems = sampleBrowserDirs.size() + sampleBrowserFiles.size();
-    if (sampleBrowserSelectedIndex >= totalItems) {
-        sampleBrowserSelectedIndex = std::max(0, totalItems - 1);
+        int sampleIndex = synth->getSampleBank()->adoptSample(sample);
+
+        // Set the sample on the sampler it was chosen for (all voices)
+        synth->setSamplerSample(samplerIndex, sampleIndex);
+
+        // Extract filename for console message
+        size_t lastSlash = path.find_last_of("/\\");
+        std::string filename = (lastSlash != std::string::npos) ?
+                              path.substr(lastSlash + 1) : path;
+
+        addConsoleMessage("Loaded: " + filename);
     }
 }
 
@@ -153,16 +194,16 @@ void UI::finishSampleBrowser(bool applySelection) {
         // Selection is a file
         int fileIndex = sampleBrowserSelectedIndex - totalDirs;
         if (fileIndex >= 0 && fileIndex < static_cast<int>(sampleBrowserFiles.size())) {
-            std::string selectedFile = sampleBrowserFiles[fileIndex];
-            std::string fullPath = sampleBrowserCurrentDir + "/" + selectedFile;
-            loadSampleForCurrentSampler(fullPath);
+            const SampleBrowserEntry& selectedFile = sampleBrowserFiles[fileIndex];
+            std::string fullPath = sampleBrowserCurrentDir + "/" + selectedFile.name;
+            loadSampleForCurrentSampler(fullPath, selectedFile);
         }
     }
 
     sampleBrowserActive = false;
 }
 
-void UI::loadSampleForCurrentSampler(const std::string& filepath) {
+void UI::loadSampleForCurrentSampler(const std::string& filepath, const SampleBrowserEntry& file) {
     if (!synth) {
         addConsoleMessage("Error: Synth not initialized");
         return;
@@ -175,19 +216,16 @@ void UI::loadSampleForCurrentSampler(const std::string& filepath) {
         return;
     }
 
-    int sampleIndex = sampleBank->loadSingleFile(filepath.c_str());
-    if (sampleIndex < 0) {
-        addConsoleMessage("Failed to load: " + filepath);
+    // Already loaded and prepared as the file is now: nothing to read
+    int sampleIndex = sampleBank->findPreparedFile(filepath, file.size, file.mtime);
+    if (sampleIndex >= 0) {
+        synth->setSamplerSample(currentSamplerIndex, sampleIndex);
+        addConsoleMessage("Loaded: " + file.name);
         return;
     }
 
-    // Set the sample on the current sampler (all voices)
-    synth->setSamplerSample(currentSamplerIndex, sampleIndex);
-
-    // Extract filename for console message
-    size_t lastSlash = filepath.find_last_of("/\\");
-    std::string filename = (lastSlash != std::string::npos) ?
-                          filepath.substr(lastSlash + 1) : filepath;
-
-    addConsoleMessage("Loaded: " + filename);
+    // Parsing and decoding happen on the worker; pollSampleBrowser hands the
+    // sample to this sampler when it is ready
+    sampleBrowserWorker.load(*sampleBank, filepath, currentSamplerIndex);
+    addConsoleMessage("Loading: " + file.name);
 }
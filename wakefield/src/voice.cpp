@@ -1,6 +1,6 @@
 #include "voice.h"
 #include "synth.h"  // For Synth::getOscillatorBaseLevel()
-#include "ui.h"    // For SynthParameters definition
+#include <algorithm>
 
 void Voice::resetFMHistory() {
     for (int i = 0; i < OSCILLATORS_PER_VOICE; ++i) {
@@ -9,188 +9,481 @@ void Voice::resetFMHistory() {
     for (int i = 0; i < SAMPLERS_PER_VOICE; ++i) {
         lastSamplerOutputs[i] = 0.0f;
     }
+    fmDecimator.reset();
 }
 
-float Voice::generateSample() {
-    if (!active) {
-        envelopeValue = 0.0f;
-        return 0.0f;
+void FMRoutingTable::snapshot(const float depths[FM_NODES][FM_NODES]) {
+    count = 0;
+    unsigned sources[FM_NODES];     // Bit s: s feeds the node directly
+    for (int target = 0; target < FM_NODES; ++target) {
+        routeStart[target] = static_cast<uint8_t>(count);
+        sources[target] = 0;
+        for (int source = 0; source < FM_NODES; ++source) {
+            float depth = depths[target][source];
+            if (depth != 0.0f) {
+                routes[count++] = {static_cast<uint8_t>(target), static_cast<uint8_t>(source),
+                                   depth * 100.0f};
+                sources[target] |= 1u << source;
+            }
+        }
     }
+    routeStart[FM_NODES] = static_cast<uint8_t>(count);
 
-    // Get envelope level and cache for modulation routing
-    envelopeValue = envelope.process();
-
-    // If envelope finished, deactivate voice and clear FM history
-    if (!envelope.isActive()) {
-        // Save sampler phases before deactivating (for Note Reset OFF)
-        if (synth) {
-            for (int i = 0; i < SAMPLERS_PER_VOICE; ++i) {
-                synth->saveSamplerPhase(i, samplers[i].getCurrentPhase());
+    // Everything each node depends on, directly or not
+    unsigned upstream[FM_NODES];
+    for (int n = 0; n < FM_NODES; ++n) {
+        upstream[n] = sources[n];
+    }
+    for (bool grew = true; grew;) {
+        grew = false;
+        for (int n = 0; n < FM_NODES; ++n) {
+            unsigned reach = upstream[n];
+            for (unsigned m = upstream[n]; m; m &= m - 1) {
+                reach |= upstream[__builtin_ctz(m)];
+            }
+            if (reach != upstream[n]) {
+                upstream[n] = reach;
+                grew = true;
             }
         }
-        active = false;
-        envelopeValue = 0.0f;
-        resetFMHistory();
-        return 0.0f;
-    }
-
-    // Determine FM input for each oscillator using previous outputs (1-sample delay)
-    // FM matrix is 8x8: OSC1-4 are indices 0-3, SAMP1-4 are indices 4-7
-    float fmInputs[OSCILLATORS_PER_VOICE] = {0.0f};
-    if (params) {
-        for (int target = 0; target < OSCILLATORS_PER_VOICE; ++target) {
-            float totalFM = 0.0f;
-            // Oscillator sources (0-3)
-            for (int source = 0; source < OSCILLATORS_PER_VOICE; ++source) {
-                float fmDepth = params->getFMDepth(target, source);
-                if (fmDepth != 0.0f) {
-                    totalFM += lastOscOutputs[source] * (fmDepth * 100.0f);
-                }
+    }
+
+    // A node's group is itself plus everything on a cycle through it. Take
+    // a group once all its outside sources are placed
+    groupCount = 0;
+    int placed = 0;
+    unsigned done = 0;
+    const unsigned all = (1u << FM_NODES) - 1;
+    while (done != all) {
+        for (int n = 0; n < FM_NODES; ++n) {
+            if ((done >> n) & 1u) {
+                continue;
             }
-            // Sampler sources (4-7)
-            for (int source = 0; source < SAMPLERS_PER_VOICE; ++source) {
-                float fmDepth = params->getFMDepth(target, 4 + source);
-                if (fmDepth != 0.0f) {
-                    totalFM += lastSamplerOutputs[source] * (fmDepth * 100.0f);
+            unsigned members = 1u << n;
+            for (int m = 0; m < FM_NODES; ++m) {
+                if (((upstream[n] >> m) & 1u) && ((upstream[m] >> n) & 1u)) {
+                    members |= 1u << m;
                 }
             }
-            fmInputs[target] = totalFM;
+            unsigned needs = 0;
+            for (unsigned m = members; m; m &= m - 1) {
+                needs |= sources[__builtin_ctz(m)];
+            }
+            if (needs & ~members & ~done) {
+                continue;
+            }
+            Group& group = groups[groupCount++];
+            group.first = static_cast<uint8_t>(placed);
+            group.count = static_cast<uint8_t>(__builtin_popcount(members));
+            group.cyclic = (upstream[n] >> n) & 1u;
+            for (unsigned m = members; m; m &= m - 1) {
+                order[placed++] = static_cast<uint8_t>(__builtin_ctz(m));
+            }
+            done |= members;
         }
     }
+}
 
-    // Generate current oscillator outputs with FM and modulation applied
-    float currentOutputs[OSCILLATORS_PER_VOICE];
-    for (int i = 0; i < OSCILLATORS_PER_VOICE; ++i) {
-        currentOutputs[i] = oscillators[i].process(sampleRate, fmInputs[i],
-                                                    pitchMod[i], morphMod[i], dutyMod[i],
-                                                    ratioMod[i], offsetMod[i]);
-    }
+float Voice::oscillatorGain(int k) const {
+    // Amp is the modulation target, Level is the static mixer
+    float baseAmp = synth ? synth->getOscillatorBaseAmp(k) : 1.0f;
+    float baseLevel = synth ? synth->getModulatedOscLevel(k) : 0.0f;
+    float modulatedAmp = std::min(std::max(baseAmp + ampMod[k], 0.0f), 1.0f);
+    float gate = synth ? synth->getOscGate(k) : 1.0f;
+    return modulatedAmp * baseLevel * gate;
+}
 
-    // Check if any oscillators or samplers are solo'd
-    bool anySolo = false;
-    if (params) {
-        for (int i = 0; i < OSCILLATORS_PER_VOICE; ++i) {
-            if (params->oscSolo[i].load()) {
-                anySolo = true;
-                break;
-            }
+unsigned Voice::planRender(const FMRoutingTable* fm) const {
+    unsigned plan = 0;
+    for (int k = 0; k < OSCILLATORS_PER_VOICE; ++k) {
+        if (oscillatorGain(k) != 0.0f) {
+            plan |= 1u << k;
         }
-        if (!anySolo) {
-            for (int i = 0; i < SAMPLERS_PER_VOICE; ++i) {
-                if (params->samplerSolo[i].load()) {
-                    anySolo = true;
-                    break;
-                }
+    }
+    for (int k = 0; k < SAMPLERS_PER_VOICE; ++k) {
+        if (samplers[k].isKeyMode() && samplers[k].hasSample()) {
+            plan |= 1u << (OSCILLATORS_PER_VOICE + k);
+        }
+    }
+
+    // Sources of anything rendered are rendered too, until nothing is added
+    for (bool grew = fm != nullptr; grew;) {
+        grew = false;
+        for (int r = 0; r < fm->count; ++r) {
+            const FMRoute& route = fm->routes[r];
+            if (((plan >> route.target) & 1u) && !((plan >> route.source) & 1u)) {
+                plan |= 1u << route.source;
+                grew = true;
             }
         }
     }
+    return plan;
+}
 
-    // Mix all oscillators with (amp + ampMod) × level × mute/solo
-    // Amp is the modulation target, Level is the static mixer
-    float mixedSample = 0.0f;
-    for (int i = 0; i < OSCILLATORS_PER_VOICE; ++i) {
-        // Get base amp and level from synth (control-rate)
-        float baseAmp = synth ? synth->getOscillatorBaseAmp(i) : 1.0f;
-        float baseLevel = synth ? synth->getModulatedOscLevel(i) : 0.0f;
+// ---- Render kernels ----
+//
+// The mix is instantiated per number of mixed generators, so its
+// per-sample loop has fixed trip counts and no checks for which generators
+// are on; renderChunk picks one per chunk from the table. Generators
+// render a block at a time through renderNode, except inside FM feedback
+// cycles (renderFMGraph).
 
-        // Calculate modulated amplitude (clamped 0-1)
-        float modulatedAmp = std::min(std::max(baseAmp + ampMod[i], 0.0f), 1.0f);
+struct Voice::ChunkPlan {
+    int osc[OSCILLATORS_PER_VOICE];         // Rendered oscillators
+    int oscCount = 0;
+    int sampler[SAMPLERS_PER_VOICE];        // Rendered samplers
+    int samplerCount = 0;
+    float samplerLevelOffset[SAMPLERS_PER_VOICE];  // Mixer level mod, by sampler
+    const float* mixSource[FM_NODES];       // Scratch blocks of the mixed generators
+    float mixGain[FM_NODES];
+    int mixCount = 0;
+};
 
-        // Final gain is amp × level
-        float finalGain = modulatedAmp * baseLevel;
+namespace {
 
-        // Apply mute/solo logic
-        if (params) {
-            bool isSolo = params->oscSolo[i].load();
-            bool isMuted = params->oscMuted[i].load();
+typedef void (*MixKernel)(float* out, int n, const float* const* source, const float* gain);
 
-            if (anySolo) {
-                // If any channel is solo'd, only play solo'd channels
-                if (!isSolo) {
-                    finalGain = 0.0f;
-                }
-            } else if (isMuted) {
-                // If no solo and this channel is muted, silence it
-                finalGain = 0.0f;
+// out[i] = sum of source[m][i] x gain[m], oscillators first, in plan order
+template <int Count>
+void mixKernel(float* out, int n, const float* const* source, const float* gain) {
+    const float* src[Count > 0 ? Count : 1];
+    float g[Count > 0 ? Count : 1];
+    for (int m = 0; m < Count; ++m) {
+        src[m] = source[m];
+        g[m] = gain[m];
+    }
+    for (int i = 0; i < n; ++i) {
+        float mixed = 0.0f;
+        for (int m = 0; m < Count; ++m) {
+            mixed += src[m][i] * g[m];
+        }
+        out[i] = mixed;
+    }
+}
+
+const MixKernel kMixKernels[FM_NODES + 1] = {
+    mixKernel<0>, mixKernel<1>, mixKernel<2>, mixKernel<3>, mixKernel<4>,
+    mixKernel<5>, mixKernel<6>, mixKernel<7>, mixKernel<8>,
+};
+
+} // namespace
+
+void Voice::renderNode(int node, const ChunkPlan& plan, float rate, const float* fmInput, int steps) {
+    float* dst = nodeBlock(node);
+    if (node < OSCILLATORS_PER_VOICE) {
+        const int k = node;
+        BrainwaveOscillator& osc = oscillators[k];
+        if (fmInput) {
+            for (int i = 0; i < steps; ++i) {
+                dst[i] = osc.process(rate, fmInput[i],
+                                     pitchMod[k], morphMod[k], dutyMod[k],
+                                     ratioMod[k], offsetMod[k]);
+            }
+        } else {
+            for (int i = 0; i < steps; ++i) {
+                dst[i] = osc.process(rate, 0.0f,
+                                     pitchMod[k], morphMod[k], dutyMod[k],
+                                     ratioMod[k], offsetMod[k]);
             }
         }
+    } else if (!fmInput) {
+        const int k = node - OSCILLATORS_PER_VOICE;
+        SamplerModulation mod;
+        mod.sampleRate = rate;
+        mod.pitchMod = samplerPitchMod[k];
+        mod.loopStartMod = samplerLoopStartMod[k];
+        mod.loopLengthMod = samplerLoopLengthMod[k];
+        mod.crossfadeMod = samplerCrossfadeMod[k];
+        mod.levelMod = samplerLevelMod[k];
+        mod.levelOffset = plan.samplerLevelOffset[k];
+        mod.phaseDriver = samplerPhaseDriver[k];
+        mod.midiNote = note;
+        samplers[k].processBlock(mod, dst, steps);
+    } else {
+        for (int i = 0; i < steps; ++i) {
+            dst[i] = stepNode(node, plan, rate, fmInput[i]);
+        }
+    }
+}
 
-        // Mix with final gain
-        mixedSample += currentOutputs[i] * finalGain;
+float Voice::stepNode(int node, const ChunkPlan& plan, float rate, float fmInput) {
+    if (node < OSCILLATORS_PER_VOICE) {
+        const int k = node;
+        return oscillators[k].process(rate, fmInput,
+                                      pitchMod[k], morphMod[k], dutyMod[k],
+                                      ratioMod[k], offsetMod[k]);
     }
+    const int k = node - OSCILLATORS_PER_VOICE;
+    return samplers[k].process(rate, fmInput,
+                               samplerPitchMod[k],
+                               samplerLoopStartMod[k],
+                               samplerLoopLengthMod[k],
+                               samplerCrossfadeMod[k],
+                               samplerLevelMod[k],
+                               plan.samplerLevelOffset[k],
+                               samplerPhaseDriver[k],
+                               note);
+}
 
-    // Determine FM input for each sampler using previous outputs (1-sample delay)
-    float samplerFMInputs[SAMPLERS_PER_VOICE] = {0.0f};
-    if (params) {
-        for (int target = 0; target < SAMPLERS_PER_VOICE; ++target) {
-            float totalFM = 0.0f;
-            // Oscillator sources (0-3)
-            for (int source = 0; source < OSCILLATORS_PER_VOICE; ++source) {
-                float fmDepth = params->getFMDepth(4 + target, source);
-                if (fmDepth != 0.0f) {
-                    totalFM += lastOscOutputs[source] * (fmDepth * 100.0f);
+void Voice::renderFMGraph(const FMRoutingTable& fm, const ChunkPlan& plan, unsigned planMask,
+                          float rate, int steps) {
+    // Input from nodes outside the group being rendered, whose blocks are done
+    float input[FM_NODES][VOICE_BLOCK_SIZE];
+    for (int g = 0; g < fm.groupCount; ++g) {
+        const FMRoutingTable::Group& group = fm.groups[g];
+        const uint8_t* members = fm.order + group.first;
+        unsigned inGroup = 0;
+        for (int m = 0; m < group.count; ++m) {
+            inGroup |= 1u << members[m];
+        }
+        if (!(inGroup & planMask)) {
+            continue;
+        }
+
+        // Planned targets have planned sources, so every source block used
+        // here has been rendered
+        bool hasInput[FM_NODES];
+        for (int m = 0; m < group.count; ++m) {
+            const int t = members[m];
+            hasInput[m] = false;
+            for (int r = fm.routeStart[t]; r < fm.routeStart[t + 1]; ++r) {
+                const FMRoute& route = fm.routes[r];
+                if ((inGroup >> route.source) & 1u) {
+                    continue;
                 }
-            }
-            // Sampler sources (4-7)
-            for (int source = 0; source < SAMPLERS_PER_VOICE; ++source) {
-                float fmDepth = params->getFMDepth(4 + target, 4 + source);
-                if (fmDepth != 0.0f) {
-                    totalFM += lastSamplerOutputs[source] * (fmDepth * 100.0f);
+                const float* src = nodeBlock(route.source);
+                float* in = input[m];
+                if (!hasInput[m]) {
+                    for (int i = 0; i < steps; ++i) {
+                        in[i] = src[i] * route.depth;
+                    }
+                    hasInput[m] = true;
+                } else {
+                    for (int i = 0; i < steps; ++i) {
+                        in[i] += src[i] * route.depth;
+                    }
                 }
             }
-            samplerFMInputs[target] = totalFM;
         }
-    }
 
-    // Process all samplers and mix
-    float currentSamplerOutputs[SAMPLERS_PER_VOICE] = {0.0f};
-    for (int i = 0; i < SAMPLERS_PER_VOICE; ++i) {
-        if (!samplers[i].isKeyMode()) {
-            currentSamplerOutputs[i] = 0.0f;
+        if (!group.cyclic) {
+            const int t = members[0];
+            renderNode(t, plan, rate, hasInput[0] ? input[0] : nullptr, steps);
+            if (steps > 0) {
+                lastNodeOutput(t) = nodeBlock(t)[steps - 1];
+            }
             continue;
         }
 
-        // Process sampler with FM and modulation (pass MIDI note for KEY mode tracking)
-        float samplerLevelOffset = synth ? synth->getMixerSamplerLevelMod(i) : 0.0f;
-        float samplerOut = samplers[i].process(sampleRate, samplerFMInputs[i],
-                                              samplerPitchMod[i],
-                                              samplerLoopStartMod[i],
-                                              samplerLoopLengthMod[i],
-                                              samplerCrossfadeMod[i],
-                                              samplerLevelMod[i],
-                                              samplerLevelOffset,
-                                              samplerPhaseDriver[i],
-                                              note);
-        currentSamplerOutputs[i] = samplerOut;
-
-        // Apply mute/solo logic to samplers
-        if (params) {
-            bool isSolo = params->samplerSolo[i].load();
-            bool isMuted = params->samplerMuted[i].load();
-
-            if (anySolo) {
-                // If any channel is solo'd, only play solo'd channels
-                if (!isSolo) {
-                    samplerOut = 0.0f;
+        // Feedback: the members read each other's previous step
+        for (int i = 0; i < steps; ++i) {
+            float previous[FM_NODES];
+            for (int m = 0; m < group.count; ++m) {
+                previous[members[m]] = lastNodeOutput(members[m]);
+            }
+            for (int m = 0; m < group.count; ++m) {
+                const int t = members[m];
+                float fmInput = hasInput[m] ? input[m][i] : 0.0f;
+                for (int r = fm.routeStart[t]; r < fm.routeStart[t + 1]; ++r) {
+                    const FMRoute& route = fm.routes[r];
+                    if ((inGroup >> route.source) & 1u) {
+                        fmInput += previous[route.source] * route.depth;
+                    }
                 }
-            } else if (isMuted) {
-                // If no solo and this channel is muted, silence it
-                samplerOut = 0.0f;
+                const float y = stepNode(t, plan, rate, fmInput);
+                lastNodeOutput(t) = y;
+                nodeBlock(t)[i] = y;
             }
         }
+    }
+}
 
-        mixedSample += samplerOut;
+void Voice::renderBlock(float* out, int n, const ExternalOscBlock* oscSource) {
+    int offset = 0;
+    while (offset < n) {
+        int chunk = std::min(n - offset, VOICE_BLOCK_SIZE);
+        ExternalOscBlock source;
+        if (oscSource) {
+            source = *oscSource;
+            for (int k = 0; k < OSCILLATORS_PER_VOICE; ++k) {
+                source.osc[k] += offset * source.stride;
+            }
+        }
+        if (!renderChunk(out + offset, chunk, oscSource ? &source : nullptr)) {
+            // Voice finished (or was idle) - the rest of the block is silent
+            for (int i = offset + chunk; i < n; ++i) {
+                out[i] = 0.0f;
+            }
+            return;
+        }
+        offset += chunk;
     }
+}
+
+bool Voice::renderChunk(float* out, int n, const ExternalOscBlock* oscSource) {
+    if (!active) {
+        envelopeValue = 0.0f;
+        for (int i = 0; i < n; ++i) {
+            out[i] = 0.0f;
+        }
+        return false;
+    }
+
+    // Run the envelope first so we know how many frames the voice stays alive.
+    // The envelope is routed through the modulation matrix, so only its final
+    // value (cached for modulation) and its end point matter here.
+    float envelopeBlock[VOICE_BLOCK_SIZE];
+    const int activeFrames = envelope.processBlock(envelopeBlock, n);
+    envelopeValue = (activeFrames == n && n > 0) ? envelopeBlock[n - 1] : 0.0f;
 
-    // Cache outputs for next sample's FM routing
+    // ---- Control-rate state, read once per chunk ----
+
+    // FM routes are snapshotted by the synth once per buffer.
+    // Oscillators from the voice bank were rendered without FM input.
+    const FMRoutingTable* fm = (synth && !oscSource) ? &synth->getFMRoutes() : nullptr;
+    const bool anyFM = fm && !fm->empty();
+
+    // Oscillator gain is (amp + ampMod) × level × mute/solo
+    float oscGain[OSCILLATORS_PER_VOICE];
     for (int i = 0; i < OSCILLATORS_PER_VOICE; ++i) {
-        lastOscOutputs[i] = currentOutputs[i];
+        oscGain[i] = oscillatorGain(i);
     }
+
+    // Sampler level is applied inside Sampler::process; only mute/solo gates here
+    ChunkPlan plan;
+    float samplerGain[SAMPLERS_PER_VOICE];
     for (int i = 0; i < SAMPLERS_PER_VOICE; ++i) {
-        lastSamplerOutputs[i] = currentSamplerOutputs[i];
+        plan.samplerLevelOffset[i] = synth ? synth->getMixerSamplerLevelMod(i) : 0.0f;
+        samplerGain[i] = synth ? synth->getSamplerGate(i) : 1.0f;
+    }
+
+    // Only generators that are heard, or feed one that is, render; the mix
+    // takes those with a non-zero gain
+    const unsigned planMask = planRender(fm);
+    for (int k = 0; k < OSCILLATORS_PER_VOICE; ++k) {
+        if ((planMask >> k) & 1u) {
+            plan.osc[plan.oscCount++] = k;
+            if (oscGain[k] != 0.0f) {
+                plan.mixSource[plan.mixCount] = oscBlock[k];
+                plan.mixGain[plan.mixCount++] = oscGain[k];
+            }
+        }
+    }
+    for (int k = 0; k < SAMPLERS_PER_VOICE; ++k) {
+        if ((planMask >> (OSCILLATORS_PER_VOICE + k)) & 1u) {
+            plan.sampler[plan.samplerCount++] = k;
+            if (samplerGain[k] != 0.0f) {
+                plan.mixSource[plan.mixCount] = samplerBlock[k];
+                plan.mixGain[plan.mixCount++] = samplerGain[k];
+            }
+        }
+    }
+    const MixKernel mix = kMixKernels[plan.mixCount];
+
+    // Skipped oscillators only move their phase on; the voice bank has
+    // already done that for its own
+    auto advanceSkipped = [&](float rate, int steps) {
+        if (oscSource) {
+            return;
+        }
+        for (int k = 0; k < OSCILLATORS_PER_VOICE; ++k) {
+            if (!((planMask >> k) & 1u)) {
+                oscillators[k].advance(rate, steps, pitchMod[k], ratioMod[k], offsetMod[k]);
+            }
+        }
+    };
+
+    // ---- Audio-rate rendering into per-generator scratch buffers ----
+
+    if (!anyFM) {
+        // No cross-modulation: every generator is independent, so render each
+        // one over the whole chunk in its own tight loop.
+        for (int m = 0; m < plan.oscCount; ++m) {
+            const int k = plan.osc[m];
+            if (oscSource) {
+                const float* src = oscSource->osc[k];
+                for (int i = 0; i < activeFrames; ++i) {
+                    oscBlock[k][i] = src[i * oscSource->stride];
+                }
+            } else {
+                renderNode(k, plan, sampleRate, nullptr, activeFrames);
+            }
+        }
+        advanceSkipped(sampleRate, activeFrames);
+        for (int m = 0; m < plan.samplerCount; ++m) {
+            renderNode(OSCILLATORS_PER_VOICE + plan.sampler[m], plan, sampleRate, nullptr, activeFrames);
+        }
+        // Mix WITHOUT envelope multiplication - the envelope reaches the
+        // oscillator levels through the modulation matrix
+        mix(out, activeFrames, plan.mixSource, plan.mixGain);
+    } else {
+        // Routes run in the table's schedule: outside feedback cycles a
+        // target hears its sources' current samples, so it renders a block
+        // at a time; inside one the 1-sample delay stays. Skipped
+        // generators feed nothing that renders and stay at 0
+        for (int k = 0; k < OSCILLATORS_PER_VOICE; ++k) {
+            if (!((planMask >> k) & 1u)) {
+                lastOscOutputs[k] = 0.0f;
+            }
+        }
+        for (int k = 0; k < SAMPLERS_PER_VOICE; ++k) {
+            if (!((planMask >> (OSCILLATORS_PER_VOICE + k)) & 1u)) {
+                lastSamplerOutputs[k] = 0.0f;
+            }
+        }
+
+        const int factor = synth ? synth->getFMOversample() : 1;
+        if (factor == 1) {
+            renderFMGraph(*fm, plan, planMask, sampleRate, activeFrames);
+            advanceSkipped(sampleRate, activeFrames);
+            mix(out, activeFrames, plan.mixSource, plan.mixGain);
+        } else {
+            // Oversampled: every generator takes factor steps per output
+            // sample at factor x the rate, a scratch block at a time, and
+            // the mix is decimated. The gains are constant over the chunk,
+            // so mixing before the decimator gives the same result as
+            // decimating each generator
+            const OversampleQuality quality = synth->getOversampleQuality();
+            if (fmDecimator.factor() != factor || fmDecimator.quality() != quality) {
+                fmDecimator.configure(factor, quality);
+            }
+            const float wideRate = sampleRate * static_cast<float>(factor);
+            const int wideSteps = activeFrames * factor;
+            float wide[VOICE_BLOCK_SIZE * Decimator::kMaxFactor];
+            for (int done = 0; done < wideSteps; done += VOICE_BLOCK_SIZE) {
+                const int steps = std::min(wideSteps - done, VOICE_BLOCK_SIZE);
+                renderFMGraph(*fm, plan, planMask, wideRate, steps);
+                mix(wide + done, steps, plan.mixSource, plan.mixGain);
+            }
+            advanceSkipped(wideRate, wideSteps);
+            fmDecimator.process(wide, out, activeFrames);
+        }
+    }
+
+    // Cache outputs for the next chunk's FM routing (pre-mute, as before);
+    // the FM path has already left them there
+    if (activeFrames > 0 && !anyFM) {
+        for (int k = 0; k < OSCILLATORS_PER_VOICE; ++k) {
+            lastOscOutputs[k] = ((planMask >> k) & 1u) ? oscBlock[k][activeFrames - 1] : 0.0f;
+        }
+        for (int k = 0; k < SAMPLERS_PER_VOICE; ++k) {
+            lastSamplerOutputs[k] = ((planMask >> (OSCILLATORS_PER_VOICE + k)) & 1u)
+                                        ? samplerBlock[k][activeFrames - 1] : 0.0f;
+        }
+    }
+
+    if (activeFrames < n) {
+        // Envelope finished inside this chunk: deactivate and clear FM history
+        for (int i = activeFrames; i < n; ++i) {
+            out[i] = 0.0f;
+        }
+        // The samplers keep their phase: Synth saves it for Note Reset OFF
+        // once the buffer is rendered, so voices never write shared state
+        active = false;
+        envelopeValue = 0.0f;
+        resetFMHistory();
+        return false;
     }
 
-    // Return mixed sample WITHOUT envelope multiplication
-    // Envelope is now routed through modulation matrix to oscillator levels
-    return mixedSample;
+    return true;
 }
@@ -4,6 +4,8 @@
 #include "envelope.h"
 #include "brainwave_osc.h"
 #include "sampler.h"
+#include "oversampler.h"
+#include <cstdint>
 
 // Forward declarations
 struct SynthParameters;
@@ -11,6 +13,42 @@ class Synth;
 
 constexpr int OSCILLATORS_PER_VOICE = 4;
 constexpr int SAMPLERS_PER_VOICE = 4;
+constexpr int VOICE_BLOCK_SIZE = 64;  // Max frames rendered per internal chunk
+constexpr int FM_NODES = OSCILLATORS_PER_VOICE + SAMPLERS_PER_VOICE;  // OSC1-4, SAMP1-4
+
+// One non-zero FM matrix entry; depth already includes the x100 scaling
+struct FMRoute {
+    uint8_t target;
+    uint8_t source;
+    float depth;
+};
+
+// Compact list of the active FM routes, snapshotted once per audio buffer.
+//
+// snapshot() also schedules the routing graph: nodes are grouped into
+// strongly connected components, and the groups ordered so every group's
+// sources come before it. A group is either one node outside any cycle,
+// which renders a whole block from its sources' finished blocks with no
+// delay, or a feedback cycle, whose members step together sample by sample
+// with a 1-sample delay on the routes between them.
+struct FMRoutingTable {
+    struct Group {
+        uint8_t first;      // Index into order
+        uint8_t count;
+        bool cyclic;
+    };
+
+    FMRoute routes[FM_NODES * FM_NODES];   // Sorted by target
+    int count = 0;
+    uint8_t routeStart[FM_NODES + 1] = {};  // Routes into node t: [routeStart[t], routeStart[t + 1])
+
+    uint8_t order[FM_NODES] = {};           // Nodes in evaluation order
+    Group groups[FM_NODES] = {};
+    int groupCount = 0;
+
+    void snapshot(const float depths[FM_NODES][FM_NODES]);  // implemented in voice.cpp
+    bool empty() const { return count == 0; }
+};
 
 struct Voice {
     bool active;           // Is this voice currently playing?
@@ -67,22 +105,69 @@ struct Voice {
         }
     }
 
-    // Generate one sample for this voice (implemented in voice.cpp)
-    float generateSample();
+    // Oscillator outputs rendered outside the voice (SoA voice bank).
+    // Sample i of oscillator k is osc[k][i * stride].
+    struct ExternalOscBlock {
+        const float* osc[OSCILLATORS_PER_VOICE];
+        int stride;
+    };
+
+    // Render n samples of this voice into out (implemented in voice.cpp).
+    // Control-rate state (FM depths, gains, mute/solo) is read once per chunk.
+    // With oscSource set, oscillators are taken from it and FM is not applied.
+    void renderBlock(float* out, int n, const ExternalOscBlock* oscSource = nullptr);
 
     // Clear cached oscillator outputs (used when voice retriggers)
     void resetFMHistory();
 
+    // Generators a chunk has to render, as a mask of FM nodes (bit k: OSC
+    // k + 1, bit OSCILLATORS_PER_VOICE + k: SAMP k + 1): oscillators with a
+    // non-zero gain, key-mode samplers with a sample, and, through fm, every
+    // generator feeding one of those. Skipped oscillators only advance their
+    // phase. A sampler with a sample is never skipped, since it keeps its own
+    // playback position
+    unsigned planRender(const FMRoutingTable* fm) const;
+
+    // (amp + ampMod) x level x mute/solo of oscillator k
+    float oscillatorGain(int k) const;
+
     // Get current envelope value (for modulation routing)
     float getEnvelopeValue() const {
         return envelopeValue;
     }
 
 private:
+    bool renderChunk(float* out, int n, const ExternalOscBlock* oscSource);
+
+    // Generators of one chunk, as lists, and the scratch blocks it mixes
+    struct ChunkPlan;
+
+    // Render the planned generators through fm's schedule, steps samples
+    // at rate, into oscBlock / samplerBlock [0, steps)
+    void renderFMGraph(const FMRoutingTable& fm, const ChunkPlan& plan, unsigned planMask,
+                       float rate, int steps);
+    // One FM node (OSC1-4, SAMP1-4) over a block, fmInput null for none
+    void renderNode(int node, const ChunkPlan& plan, float rate, const float* fmInput, int steps);
+    float stepNode(int node, const ChunkPlan& plan, float rate, float fmInput);
+    float* nodeBlock(int node) {
+        return node < OSCILLATORS_PER_VOICE ? oscBlock[node] : samplerBlock[node - OSCILLATORS_PER_VOICE];
+    }
+    float& lastNodeOutput(int node) {
+        return node < OSCILLATORS_PER_VOICE ? lastOscOutputs[node]
+                                            : lastSamplerOutputs[node - OSCILLATORS_PER_VOICE];
+    }
+
     float sampleRate;
     float lastOscOutputs[OSCILLATORS_PER_VOICE];
     float lastSamplerOutputs[SAMPLERS_PER_VOICE];
     float envelopeValue;  // Current envelope output (cached for modulation)
+
+    // Per-generator scratch buffers for block rendering
+    float oscBlock[OSCILLATORS_PER_VOICE][VOICE_BLOCK_SIZE];
+    float samplerBlock[SAMPLERS_PER_VOICE][VOICE_BLOCK_SIZE];
+
+    // Brings the FM path back from Synth::getFMOversample() x sampleRate
+    Decimator fmDecimator;
 };
 
 #endif // VOICE_H
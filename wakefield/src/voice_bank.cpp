@@ -0,0 +1,244 @@
+#include "voice_bank.h"
+#include "fastmath.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+// The kernel helpers return 32-byte vectors by value; they are all inlined, so
+// the ABI warning GCC emits for non-AVX builds does not apply.
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wpsabi"
+#endif
+
+namespace {
+
+typedef float VecF __attribute__((vector_size(32)));
+typedef int32_t VecI __attribute__((vector_size(32)));
+typedef uint32_t VecU __attribute__((vector_size(32)));
+
+static_assert(sizeof(VecF) == VoiceBank::kLanes * sizeof(float), "one vector per voice pool");
+
+#if defined(__x86_64__) && defined(__GNUC__) && !defined(__clang__)
+#define VOICE_BANK_CLONES __attribute__((target_clones("avx2", "default")))
+#else
+#define VOICE_BANK_CLONES
+#endif
+
+template <typename V, typename T>
+inline V loadVec(const T* src) {
+    V v;
+    std::memcpy(&v, src, sizeof(V));
+    return v;
+}
+
+template <typename V, typename T>
+inline void storeVec(T* dst, const V& v) {
+    std::memcpy(dst, &v, sizeof(V));
+}
+
+inline VecF splat(float x) {
+    return VecF{} + x;
+}
+
+// sin(2*pi*x) for x in [-0.5, 1.5], folded to a quarter period and evaluated
+// with an odd Taylor polynomial (error ~4e-8)
+inline VecF sinTurns(const VecF& x) {
+    VecF shifted = x + 0.5f;
+    VecF whole = __builtin_convertvector(__builtin_convertvector(shifted, VecI), VecF);
+    VecF r = x - whole;                                   // [-0.5, 0.5)
+    r = (r > 0.25f) ? (splat(0.5f) - r) : r;
+    r = (r < -0.25f) ? (splat(-0.5f) - r) : r;            // [-0.25, 0.25]
+
+    const float twoPi = 2.0f * static_cast<float>(M_PI);
+    VecF z = r * twoPi;
+    VecF z2 = z * z;
+    VecF p = splat(-1.0f / 39916800.0f);
+    p = p * z2 + (1.0f / 362880.0f);
+    p = p * z2 + (-1.0f / 5040.0f);
+    p = p * z2 + (1.0f / 120.0f);
+    p = p * z2 + (-1.0f / 6.0f);
+    p = p * z2 + 1.0f;
+    return z * p;
+}
+
+inline VecF cosTurns(const VecF& x) {
+    return sinTurns(x + 0.25f);
+}
+
+// [7/6] Pade approximant of tanh, saturated to +-1 (error < 1e-4)
+inline VecF tanhApprox(const VecF& in) {
+    VecF x = (in > 4.97f) ? splat(4.97f) : in;
+    x = (x < -4.97f) ? splat(-4.97f) : x;
+    VecF x2 = x * x;
+    VecF num = x * (135135.0f + x2 * (17325.0f + x2 * (378.0f + x2)));
+    VecF den = 135135.0f + x2 * (62370.0f + x2 * (3150.0f + x2 * 28.0f));
+    VecF y = num / den;
+    y = (y > 1.0f) ? splat(1.0f) : y;
+    y = (y < -1.0f) ? splat(-1.0f) : y;
+    return y;
+}
+
+// Render one oscillator slot for all lanes. Mirrors generatePhaseDistorted /
+// generateTanhShaped in brainwave_osc.cpp with the per-block terms precomputed.
+VOICE_BANK_CLONES
+void renderLanes(const VoiceBank::LaneParams& p, uint32_t* phaseState, float* out, int n) {
+    const VecU inc = loadVec<VecU>(p.increment);
+    const VecI isSaw = loadVec<VecI>(p.isSaw);
+    const VecI mirror = loadVec<VecI>(p.mirror);
+    const VecF pivot = loadVec<VecF>(p.pivot);
+    const VecF invRise = loadVec<VecF>(p.invRise);
+    const VecF invFall = loadVec<VecF>(p.invFall);
+    const VecF edge = loadVec<VecF>(p.edge);
+    const VecF beta = loadVec<VecF>(p.beta);
+    const VecF sinTheta = loadVec<VecF>(p.sinTheta);
+
+    bool anySaw = false;
+    bool anyPulse = false;
+    for (int l = 0; l < VoiceBank::kLanes; ++l) {
+        anySaw |= (p.isSaw[l] != 0);
+        anyPulse |= (p.isSaw[l] == 0);
+    }
+
+    VecU ph = loadVec<VecU>(phaseState);
+    for (int i = 0; i < n; ++i) {
+        // Top 24 bits of the accumulator give an exact float phase in [0, 1)
+        VecF phase = __builtin_convertvector(__builtin_convertvector(ph >> 8, VecI), VecF)
+                     * (1.0f / 16777216.0f);
+
+        VecF saw = VecF{};
+        if (anySaw) {
+            VecF wp = mirror ? (splat(1.0f) - phase) : phase;
+            VecF shaped = (wp <= pivot) ? (wp * invRise)
+                                        : (0.5f * (1.0f + (wp - pivot) * invFall));
+            saw = -cosTurns(shaped);
+        }
+
+        VecF pulse = VecF{};
+        if (anyPulse) {
+            VecF shifted = phase + 0.5f;
+            shifted = (shifted >= 1.0f) ? (shifted - 1.0f) : shifted;
+            VecF sine = sinTurns(shifted);
+            VecF shapedPulse = tanhApprox(beta * (sine - sinTheta));
+            pulse = (1.0f - edge) * sine + edge * shapedPulse;
+        }
+
+        storeVec(out + i * VoiceBank::kLanes, isSaw ? saw : pulse);
+        ph += inc;
+    }
+    storeVec(phaseState, ph);
+}
+
+} // namespace
+
+VoiceBank::VoiceBank()
+    : lane{}
+    , phase{}
+    , out{} {
+}
+
+const char* VoiceBank::backendName() {
+#if defined(__aarch64__) || defined(__ARM_NEON)
+    return "neon";
+#elif defined(__x86_64__) && defined(__GNUC__) && !defined(__clang__)
+    return __builtin_cpu_supports("avx2") ? "avx2" : "sse2";
+#elif defined(__AVX2__)
+    return "avx2";
+#elif defined(__SSE2__)
+    return "sse2";
+#else
+    return "generic";
+#endif
+}
+
+void VoiceBank::gather(Voice* voices, int numVoices, float sampleRate, int osc) {
+    for (int v = 0; v < kLanes; ++v) {
+        if (v >= numVoices || !voices[v].active) {
+            // Idle lane: hold phase, output discarded
+            phase[v] = 0;
+            lane.increment[v] = 0;
+            lane.isSaw[v] = -1;
+            lane.mirror[v] = 0;
+            lane.pivot[v] = 0.5f;
+            lane.invRise[v] = 1.0f;
+            lane.invFall[v] = 2.0f;
+            lane.edge[v] = 0.0f;
+            lane.beta[v] = 1.0f;
+            lane.sinTheta[v] = 0.0f;
+            continue;
+        }
+
+        const Voice& voice = voices[v];
+        const BrainwaveOscillator& o = voice.oscillators[osc];
+        phase[v] = o.getPhase();
+
+        // Frequency path of BrainwaveOscillator::process with zero FM input
+        float freq = (o.getMode() == BrainwaveMode::FREE) ? o.getFrequency() : o.getNoteFrequency();
+        freq *= fastmath::exp2(voice.pitchMod[osc]);
+        freq = freq * (o.getRatio() + voice.ratioMod[osc]) + (o.getOffset() + voice.offsetMod[osc]);
+        freq = std::max(freq, 0.01f);
+        float absFreq = std::min(freq, sampleRate * 0.45f);
+        lane.increment[v] = static_cast<uint32_t>(
+            (static_cast<double>(absFreq) * 4294967296.0) / static_cast<double>(sampleRate));
+
+        float morph = std::min(std::max(o.getMorph() + voice.morphMod[osc], 0.0f), 1.0f);
+        float duty = std::min(std::max(o.getDuty() + voice.dutyMod[osc], 0.0f), 1.0f);
+
+        // Phase-distortion saw: pivot and mirroring depend only on morph
+        bool mirror = morph < 0.5f;
+        float morphAmount = mirror ? 0.5f + (1.0f - morph * 2.0f) * 0.5f : morph;
+        float pivot = 0.5f + 0.4999f * ((morphAmount - 0.5f) * 2.0f);
+        pivot = std::min(std::max(pivot, 0.0001f), 0.9999f);
+
+        lane.isSaw[v] = (o.getShape() == BrainwaveShape::SAW) ? -1 : 0;
+        lane.mirror[v] = mirror ? -1 : 0;
+        lane.pivot[v] = pivot;
+        lane.invRise[v] = 1.0f / std::max(1e-6f, 2.0f * pivot);
+        lane.invFall[v] = 1.0f / std::max(1e-6f, 1.0f - pivot);
+
+        // Tanh pulse: edge = 0 collapses to a pure sine
+        float edge = (morph < 1e-3f) ? 0.0f : morph;
+        lane.edge[v] = edge;
+        lane.beta[v] = 1.0f + 80.0f * edge;
+        lane.sinTheta[v] = fastmath::sinTurns(duty - 0.5f);
+    }
+}
+
+void VoiceBank::render(Voice* voices, int numVoices, float sampleRate, int n) {
+    n = std::min(std::max(n, 0), VOICE_BLOCK_SIZE);
+    numVoices = std::min(numVoices, kLanes);
+
+    // A slot no voice renders (Voice::planRender) only moves its phases on;
+    // its output is not read
+    unsigned plan = 0;
+    for (int v = 0; v < numVoices; ++v) {
+        if (voices[v].active) {
+            plan |= voices[v].planRender(nullptr);
+        }
+    }
+
+    for (int osc = 0; osc < OSCILLATORS_PER_VOICE; ++osc) {
+        gather(voices, numVoices, sampleRate, osc);
+        if ((plan >> osc) & 1u) {
+            renderLanes(lane, phase, out[osc], n);
+        } else {
+            for (int v = 0; v < kLanes; ++v) {
+                phase[v] += lane.increment[v] * static_cast<uint32_t>(n);
+            }
+        }
+
+        for (int v = 0; v < numVoices; ++v) {
+            if (voices[v].active) {
+                voices[v].oscillators[osc].setPhase(phase[v]);
+            }
+        }
+    }
+}
+
+Voice::ExternalOscBlock VoiceBank::blockForVoice(int voice) const {
+    Voice::ExternalOscBlock block;
+    for (int osc = 0; osc < OSCILLATORS_PER_VOICE; ++osc) {
+        block.osc[osc] = out[osc] + voice;
+    }
+    block.stride = kLanes;
+    return block;
+}
@@ -0,0 +1,59 @@
+#ifndef VOICE_BANK_H
+#define VOICE_BANK_H
+
+#include <cstdint>
+#include "voice.h"
+
+// Structure-of-arrays oscillator engine for the whole voice pool.
+//
+// Each oscillator slot (OSC1-4) keeps the phase accumulators and per-block
+// shape coefficients of every voice side by side in aligned arrays, so one
+// SIMD pass renders that oscillator for all voices at once. The kernel is
+// written with GCC/Clang vector extensions: it compiles to NEON on ARM and is
+// cloned for AVX2 and baseline SSE2 on x86-64, with the best clone picked at
+// load time.
+//
+// The bank only covers oscillators without FM input. FM feedback is a
+// per-sample loop inside each voice, so Synth falls back to the per-voice path
+// whenever any FM depth is non-zero.
+class VoiceBank {
+public:
+    static constexpr int kLanes = 8;  // Voices rendered per SIMD pass
+
+    VoiceBank();
+
+    // Render the oscillators of the first numVoices voices for n frames
+    // (n <= VOICE_BLOCK_SIZE); a slot no voice needs only advances. Phases are read from and written back to the
+    // voices' BrainwaveOscillators, so both paths can be mixed freely.
+    void render(Voice* voices, int numVoices, float sampleRate, int n);
+
+    // Describe the rendered block of one voice in the form Voice::renderBlock expects
+    Voice::ExternalOscBlock blockForVoice(int voice) const;
+
+    // Name of the kernel variant selected for this CPU ("avx2", "sse2", "neon", "generic")
+    static const char* backendName();
+
+    // Per-lane coefficients, refreshed once per block (public for the kernel)
+    struct alignas(32) LaneParams {
+        uint32_t increment[kLanes];
+        int32_t isSaw[kLanes];      // -1 = SAW lane, 0 = PULSE lane
+        int32_t mirror[kLanes];     // -1 = mirror phase (morph < 0.5)
+        float pivot[kLanes];
+        float invRise[kLanes];      // 1 / (2 * pivot)
+        float invFall[kLanes];      // 1 / (1 - pivot)
+        float edge[kLanes];
+        float beta[kLanes];
+        float sinTheta[kLanes];     // Comparator bias from duty
+    };
+
+private:
+    void gather(Voice* voices, int numVoices, float sampleRate, int osc);
+
+    LaneParams lane;
+    alignas(32) uint32_t phase[kLanes];
+
+    // Output is frame-major: sample i of voice v is out[osc][i * kLanes + v]
+    alignas(32) float out[OSCILLATORS_PER_VOICE][VOICE_BLOCK_SIZE * kLanes];
+};
+
+#endif // VOICE_BANK_H
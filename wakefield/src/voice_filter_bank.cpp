@@ -0,0 +1,191 @@
+#include "voice_filter_bank.h"
+#include "filters.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+// The kernel helpers return 32-byte vectors by value; they are all inlined, so
+// the ABI warning GCC emits for non-AVX builds does not apply.
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wpsabi"
+#endif
+
+namespace {
+
+typedef float VecF __attribute__((vector_size(32)));
+
+static_assert(sizeof(VecF) == VoiceFilterBank::kLanes * sizeof(float), "one vector per voice group");
+
+#if defined(__x86_64__) && defined(__GNUC__) && !defined(__clang__)
+#define VOICE_FILTER_CLONES __attribute__((target_clones("avx2", "default")))
+#else
+#define VOICE_FILTER_CLONES
+#endif
+
+inline VecF loadVec(const float* src) {
+    VecF v;
+    std::memcpy(&v, src, sizeof(VecF));
+    return v;
+}
+
+inline void storeVec(float* dst, const VecF& v) {
+    std::memcpy(dst, &v, sizeof(VecF));
+}
+
+inline VecF splat(float x) {
+    return VecF{} + x;
+}
+
+// fastmath::tanh, one lane per element
+inline VecF tanhLanes(const VecF& in) {
+    const float limit = 7.90531111f;
+    VecF x = (in < -limit) ? splat(-limit) : in;
+    x = (limit < x) ? splat(limit) : x;
+    const VecF x2 = x * x;
+    VecF p = splat(-2.76076847742355e-16f);
+    p = p * x2 + 2.00018790482477e-13f;
+    p = p * x2 - 8.60467152213735e-11f;
+    p = p * x2 + 5.12229709037114e-08f;
+    p = p * x2 + 1.48572235717979e-05f;
+    p = p * x2 + 6.37261928875436e-04f;
+    p = p * x2 + 4.89352455891786e-03f;
+    p = p * x;
+    VecF q = splat(1.19825839466702e-06f);
+    q = q * x2 + 1.18534705686654e-04f;
+    q = q * x2 + 2.26843463243900e-03f;
+    q = q * x2 + 4.89352518554385e-03f;
+    return p / q;
+}
+
+// One OnePoleTPT stage per lane: lowpass, or the complementary highpass
+VOICE_FILTER_CLONES
+void onePoleLanes(VoiceFilterBank::Lanes& lane, float* frames, int n, bool highpass) {
+    const VecF gain = loadVec(lane.gain);
+    VecF s = loadVec(lane.stage[0]);
+    for (int i = 0; i < n; ++i) {
+        float* frame = frames + i * VoiceFilterBank::kLanes;
+        const VecF x = loadVec(frame);
+        const VecF v = (x - s) * gain;
+        const VecF lp = v + s;
+        s = lp + v;
+        storeVec(frame, highpass ? x - lp : lp);
+    }
+    storeVec(lane.stage[0], s);
+}
+
+// Ladder8PoleZdf::process per lane
+VOICE_FILTER_CLONES
+void ladderLanes(VoiceFilterBank::Lanes& lane, const VoiceFilterBank::Shared& shared,
+                 float* frames, int n) {
+    const VecF gain = loadVec(lane.gain);
+    VecF stage[8];
+    for (int k = 0; k < 8; ++k) {
+        stage[k] = loadVec(lane.stage[k]);
+    }
+    VecF feedback = loadVec(lane.feedback);
+    VecF lastFeedbackHP = loadVec(lane.lastFeedbackHP);
+
+    for (int i = 0; i < n; ++i) {
+        float* frame = frames + i * VoiceFilterBank::kLanes;
+        VecF x = tanhLanes(loadVec(frame) * shared.inputDrive - lastFeedbackHP * shared.resonanceGain);
+        for (int k = 0; k < 8; ++k) {
+            const VecF v = (x - stage[k]) * gain;
+            const VecF lp = v + stage[k];
+            stage[k] = lp + v;
+            x = tanhLanes(lp * shared.stageDrive);
+        }
+
+        const VecF v = (x - feedback) * shared.feedbackGain;
+        const VecF lp = v + feedback;
+        feedback = lp + v;
+        lastFeedbackHP = x - lp;
+        storeVec(frame, x);
+    }
+
+    for (int k = 0; k < 8; ++k) {
+        storeVec(lane.stage[k], stage[k]);
+    }
+    storeVec(lane.feedback, feedback);
+    storeVec(lane.lastFeedbackHP, lastFeedbackHP);
+}
+
+// OnePoleTPT's integrator gain g / (1 + g) for a cutoff
+float integratorGain(float hz, float sampleRate) {
+    return OnePoleTPT::integratorGainAt(hz / sampleRate);
+}
+
+} // namespace
+
+VoiceFilterBank::VoiceFilterBank(float sampleRate)
+    : lane{}
+    , frames{} {
+    setSampleRate(sampleRate);
+}
+
+void VoiceFilterBank::setSampleRate(float sr) {
+    sampleRate = std::max(1.0f, sr);
+    for (int l = 0; l < kLanes; ++l) {
+        setCutoff(l, 1000.0f);
+    }
+    setFeedbackHighpass(feedbackHpHz);
+}
+
+void VoiceFilterBank::setResonance(float amount) {
+    shared.resonanceGain = 0.2f + std::clamp(amount, 0.0f, 1.2f) * 3.5f;
+}
+
+void VoiceFilterBank::setDrive(float driveAmount) {
+    const float drv = std::clamp(driveAmount, 0.1f, 15.0f);
+    shared.inputDrive = drv;
+    shared.stageDrive = drv <= 1.0f ? 1.0f : 1.0f + (drv - 1.0f) * 0.5f;
+}
+
+void VoiceFilterBank::setFeedbackHighpass(float hz) {
+    feedbackHpHz = std::clamp(hz, 10.0f, std::min(6000.0f, 0.45f * sampleRate));
+    shared.feedbackGain = integratorGain(feedbackHpHz, sampleRate);
+}
+
+void VoiceFilterBank::setCutoff(int laneIndex, float hz) {
+    if (laneIndex < 0 || laneIndex >= kLanes) {
+        return;
+    }
+    lane.gain[laneIndex] = integratorGain(std::clamp(hz, 20.0f, 0.45f * sampleRate), sampleRate);
+}
+
+void VoiceFilterBank::reset() {
+    for (auto& stage : lane.stage) {
+        std::fill(stage, stage + kLanes, 0.0f);
+    }
+    std::fill(lane.feedback, lane.feedback + kLanes, 0.0f);
+    std::fill(lane.lastFeedbackHP, lane.lastFeedbackHP + kLanes, 0.0f);
+}
+
+void VoiceFilterBank::process(float* buffers, int stride, int count, const bool* active, int n) {
+    n = std::min(std::max(n, 0), VOICE_BLOCK_SIZE);
+    count = std::min(count, kLanes);
+
+    // Voice-major buffers to frame-major lanes and back
+    for (int l = 0; l < kLanes; ++l) {
+        const float* src = buffers + l * stride;
+        const bool live = l < count && active[l];
+        for (int i = 0; i < n; ++i) {
+            frames[i * kLanes + l] = live ? src[i] : 0.0f;
+        }
+    }
+
+    if (mode == Mode::Ladder) {
+        ladderLanes(lane, shared, frames, n);
+    } else {
+        onePoleLanes(lane, frames, n, mode == Mode::Highpass);
+    }
+
+    for (int l = 0; l < count; ++l) {
+        if (!active[l]) {
+            continue;
+        }
+        float* dst = buffers + l * stride;
+        for (int i = 0; i < n; ++i) {
+            dst[i] = frames[i * kLanes + l];
+        }
+    }
+}
@@ -0,0 +1,68 @@
+#ifndef VOICE_FILTER_BANK_H
+#define VOICE_FILTER_BANK_H
+
+#include "voice_bank.h"
+
+// Per-voice filters for one group of VoiceBank::kLanes voices.
+//
+// Like VoiceBank, the filter state of every voice in the group sits side by
+// side in lane arrays, so one SIMD pass (cloned for AVX2 on x86-64) filters
+// all of them. Each voice has its own cutoff, normally set once
+// per chunk from its envelope, and its own state; resonance, drive and the
+// ladder's feedback highpass are shared. Lowpass and highpass are a single
+// OnePoleTPT stage, Ladder is Ladder8PoleZdf; every lane does the same
+// arithmetic as those filters.
+class VoiceFilterBank {
+public:
+    static constexpr int kLanes = VoiceBank::kLanes;
+
+    enum class Mode { Lowpass, Highpass, Ladder };
+
+    explicit VoiceFilterBank(float sampleRate = 48000.0f);
+
+    void setSampleRate(float sr);
+    void setMode(Mode m) { mode = m; }
+
+    // Same ranges and mappings as Ladder8PoleZdf
+    void setResonance(float amount);
+    void setDrive(float driveAmount);
+    void setFeedbackHighpass(float hz);
+
+    // Cutoff of one lane from the next process() on
+    void setCutoff(int laneIndex, float hz);
+
+    void reset();
+
+    // Filter n frames (n <= VOICE_BLOCK_SIZE) of count voice buffers in
+    // place; lane l reads and writes buffers + l * stride. Lanes whose
+    // active flag is false are fed silence and left unwritten
+    void process(float* buffers, int stride, int count, const bool* active, int n);
+
+    // Per-lane coefficients and state (public for the kernel)
+    struct alignas(32) Lanes {
+        float gain[kLanes];             // g / (1 + g) of each lane's cutoff
+        float stage[8][kLanes];         // Ladder stages; stage[0] is the one-pole
+        float feedback[kLanes];         // Ladder feedback highpass integrator
+        float lastFeedbackHP[kLanes];
+    };
+
+    // Settings shared by every lane (public for the kernel)
+    struct Shared {
+        float resonanceGain = 0.2f;
+        float inputDrive = 1.0f;
+        float stageDrive = 1.0f;
+        float feedbackGain = 0.0f;      // g / (1 + g) of the feedback highpass
+    };
+
+private:
+    float sampleRate = 48000.0f;
+    Mode mode = Mode::Lowpass;
+    float feedbackHpHz = 200.0f;
+    Shared shared;
+    Lanes lane;
+
+    // Frame-major scratch: sample i of lane l is frames[i * kLanes + l]
+    alignas(32) float frames[VOICE_BLOCK_SIZE * kLanes];
+};
+
+#endif // VOICE_FILTER_BANK_H
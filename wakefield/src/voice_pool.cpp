@@ -0,0 +1,193 @@
+#include "voice_pool.h"
+#include "denormal_guard.h"
+#include "rt_check.h"
+#include <algorithm>
+#include <pthread.h>
+#include <system_error>
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#endif
+
+namespace {
+
+inline uint64_t packRange(uint32_t begin, uint32_t end) {
+    return (static_cast<uint64_t>(begin) << 32) | end;
+}
+
+constexpr int kSpinsBeforeYield = 4096;
+
+inline void spinPause() {
+#if defined(__x86_64__) || defined(__i386__)
+    _mm_pause();
+#elif defined(__aarch64__)
+    asm volatile("yield");
+#endif
+}
+
+}
+
+VoiceThreadPool::~VoiceThreadPool() {
+    stop();
+}
+
+bool VoiceThreadPool::start(int helperCount) {
+    stop();
+    // More threads than cores would only leave the callback waiting on a preempted helper
+    const int cores = static_cast<int>(std::thread::hardware_concurrency());
+    helperCount = std::min(std::max(helperCount, 0), kMaxHelpers);
+    if (cores > 0) {
+        helperCount = std::min(helperCount, cores - 1);
+    }
+    running.store(true);
+    priorityCopied = false;
+    for (int i = 0; i < helperCount; ++i) {
+        try {
+            threads[i] = std::thread(&VoiceThreadPool::helperLoop, this, i);
+        } catch (const std::system_error&) {
+            break;
+        }
+        helpers = i + 1;
+    }
+    return helpers == helperCount;
+}
+
+void VoiceThreadPool::stop() {
+    if (!running.load()) {
+        return;
+    }
+    running.store(false);
+    for (int i = 0; i < helpers; ++i) {
+        wake[i].post();
+    }
+    for (int i = 0; i < helpers; ++i) {
+        threads[i].join();
+    }
+    helpers = 0;
+}
+
+void VoiceThreadPool::run(TaskFunction fn, void* context, int taskCount) {
+    if (helpers == 0 || taskCount <= 1) {
+        for (int t = 0; t < taskCount; ++t) {
+            fn(context, t);
+        }
+        return;
+    }
+
+    // Helpers run what the callback would have: same scheduling class and
+    // priority as the audio thread, copied once
+    if (!priorityCopied) {
+        int policy;
+        sched_param param;
+        if (pthread_getschedparam(pthread_self(), &policy, &param) == 0) {
+            for (int i = 0; i < helpers; ++i) {
+                pthread_setschedparam(threads[i].native_handle(), policy, &param);
+            }
+        }
+        priorityCopied = true;
+    }
+
+    // Deal contiguous shares; only wake as many helpers as there are tasks
+    participants = std::min(helpers + 1, taskCount);
+    const int base = taskCount / participants;
+    const int extra = taskCount % participants;
+    int begin = 0;
+    for (int p = 0; p < participants; ++p) {
+        int end = begin + base + (p < extra ? 1 : 0);
+        shares[p].range.store(packRange(begin, end), std::memory_order_relaxed);
+        begin = end;
+    }
+    taskFunction = fn;
+    taskContext = context;
+    remainingTasks.store(taskCount, std::memory_order_relaxed);
+    busyHelpers.store(participants - 1, std::memory_order_relaxed);
+    for (int i = 0; i < participants - 1; ++i) {
+        wake[i].post();
+    }
+
+    work(0);
+
+    // Only the tasks already claimed by helpers can still be running. Spin,
+    // but give the core away if a helper got preempted
+    for (int spins = 0; remainingTasks.load(std::memory_order_acquire) > 0 ||
+                        busyHelpers.load(std::memory_order_acquire) > 0; ++spins) {
+        if (spins < kSpinsBeforeYield) {
+            spinPause();
+        } else {
+            std::this_thread::yield();
+        }
+    }
+}
+
+bool VoiceThreadPool::takeFront(int share, int& task) {
+    uint64_t range = shares[share].range.load(std::memory_order_relaxed);
+    for (;;) {
+        uint32_t begin = static_cast<uint32_t>(range >> 32);
+        uint32_t end = static_cast<uint32_t>(range);
+        if (begin >= end) {
+            return false;
+        }
+        if (shares[share].range.compare_exchange_weak(range, packRange(begin + 1, end),
+                                                      std::memory_order_relaxed)) {
+            task = static_cast<int>(begin);
+            return true;
+        }
+    }
+}
+
+bool VoiceThreadPool::stealBack(int share, int& task) {
+    uint64_t range = shares[share].range.load(std::memory_order_relaxed);
+    for (;;) {
+        uint32_t begin = static_cast<uint32_t>(range >> 32);
+        uint32_t end = static_cast<uint32_t>(range);
+        if (begin >= end) {
+            return false;
+        }
+        if (shares[share].range.compare_exchange_weak(range, packRange(begin, end - 1),
+                                                      std::memory_order_relaxed)) {
+            task = static_cast<int>(end - 1);
+            return true;
+        }
+    }
+}
+
+void VoiceThreadPool::work(int self) {
+    int task;
+    while (takeFront(self, task)) {
+        taskFunction(taskContext, task);
+        remainingTasks.fetch_sub(1, std::memory_order_release);
+    }
+    for (int k = 1; k < participants; ++k) {
+        const int victim = (self + k) % participants;
+        while (stealBack(victim, task)) {
+            taskFunction(taskContext, task);
+            remainingTasks.fetch_sub(1, std::memory_order_release);
+            stolenTasks.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+}
+
+void VoiceThreadPool::helperLoop(int index) {
+#ifdef __linux__
+    // Keep each helper on its own core, away from core 0
+    const unsigned int cores = std::thread::hardware_concurrency();
+    if (cores > 1) {
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        CPU_SET((index + 1) % cores, &set);
+        pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+    }
+#endif
+
+    for (;;) {
+        wake[index].wait();
+        if (!running.load()) {
+            break;
+        }
+        {
+            RtCheckScope rtScope;
+            ScopedDenormalGuard denormalGuard;
+            work(index + 1);
+        }
+        busyHelpers.fetch_sub(1, std::memory_order_release);
+    }
+}
@@ -0,0 +1,70 @@
+#ifndef VOICE_POOL_H
+#define VOICE_POOL_H
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include "rt_semaphore.h"
+
+// Helper threads for rendering voices in parallel (--voice-threads N).
+//
+// run() splits the tasks of one buffer into contiguous shares, one per
+// helper plus the calling audio thread. Each participant takes tasks from
+// the front of its own share; once that is empty it steals from the back of
+// the others', so a few heavy voices (FM feedback, streamed samplers) do not
+// leave the rest of the pool idle. A share is a single atomic word, so
+// claiming a task is one CAS and nothing is allocated or locked per buffer.
+class VoiceThreadPool {
+public:
+    static constexpr int kMaxHelpers = 7;
+
+    using TaskFunction = void (*)(void* context, int task);
+
+    VoiceThreadPool() = default;
+    ~VoiceThreadPool();
+
+    // Start or stop the helpers, at most one per core besides the audio
+    // thread. Returns false if fewer than asked for started. Call only while
+    // no callback runs
+    bool start(int helperCount);
+    void stop();
+    int getHelperCount() const { return helpers; }
+
+    // Audio thread: run fn(context, t) for every t in [0, taskCount) on the
+    // helpers and the calling thread; returns when all of them are done.
+    // Without helpers, or with a single task, everything runs inline.
+    void run(TaskFunction fn, void* context, int taskCount);
+
+    // Tasks executed by a participant other than the one they were dealt to
+    uint64_t getStolenTasks() const { return stolenTasks.load(std::memory_order_relaxed); }
+
+    VoiceThreadPool(const VoiceThreadPool&) = delete;
+    VoiceThreadPool& operator=(const VoiceThreadPool&) = delete;
+
+private:
+    // [begin, end) packed as begin << 32 | end
+    struct alignas(64) Share {
+        std::atomic<uint64_t> range{0};
+    };
+
+    bool takeFront(int share, int& task);
+    bool stealBack(int share, int& task);
+    void work(int self);
+    void helperLoop(int index);
+
+    Share shares[kMaxHelpers + 1];      // Share 0 belongs to the audio thread
+    int participants = 1;
+    TaskFunction taskFunction = nullptr;
+    void* taskContext = nullptr;
+    std::atomic<int> remainingTasks{0};
+    std::atomic<int> busyHelpers{0};
+
+    int helpers = 0;
+    std::thread threads[kMaxHelpers];
+    RtSemaphore wake[kMaxHelpers];
+    std::atomic<bool> running{false};
+    bool priorityCopied = false;
+    std::atomic<uint64_t> stolenTasks{0};
+};
+
+#endif // VOICE_POOL_H
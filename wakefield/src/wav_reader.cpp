@@ -0,0 +1,74 @@
+#include "wav_reader.h"
+#include <algorithm>
+#include <cstring>
+
+namespace {
+
+uint16_t get16(const unsigned char* p) { return static_cast<uint16_t>(p[0] | (p[1] << 8)); }
+uint32_t get32(const unsigned char* p) {
+    return static_cast<uint32_t>(p[0]) | (static_cast<uint32_t>(p[1]) << 8) |
+           (static_cast<uint32_t>(p[2]) << 16) | (static_cast<uint32_t>(p[3]) << 24);
+}
+
+} // namespace
+
+bool readWAVHeader(std::ifstream& in, WAVInfo& info, std::string& error) {
+    unsigned char riff[12];
+    if (!in.read(reinterpret_cast<char*>(riff), sizeof(riff)) ||
+        std::memcmp(riff, "RIFF", 4) != 0 || std::memcmp(riff + 8, "WAVE", 4) != 0) {
+        error = "not a WAV file";
+        return false;
+    }
+    bool haveFormat = false;
+    unsigned char header[8];
+    while (in.read(reinterpret_cast<char*>(header), sizeof(header))) {
+        const uint32_t size = get32(header + 4);
+        if (std::memcmp(header, "fmt ", 4) == 0 && size >= 16) {
+            unsigned char fmt[40] = {};
+            const uint32_t keep = std::min<uint32_t>(size, sizeof(fmt));
+            if (!in.read(reinterpret_cast<char*>(fmt), keep)) {
+                break;
+            }
+            in.seekg(size - keep + (size & 1), std::ios::cur);
+            info.format = get16(fmt);
+            info.channels = get16(fmt + 2);
+            info.sampleRate = get32(fmt + 4);
+            info.blockAlign = get16(fmt + 12);
+            info.bitsPerSample = get16(fmt + 14);
+            if (info.format == 0xfffe && keep >= 26) {
+                info.format = get16(fmt + 24);      // WAVE_FORMAT_EXTENSIBLE sub-format
+            }
+            haveFormat = true;
+        } else if (std::memcmp(header, "data", 4) == 0) {
+            if (!haveFormat) {
+                error = "data before the format chunk";
+                return false;
+            }
+            info.dataBytes = size;
+            return true;
+        } else {
+            in.seekg(size + (size & 1), std::ios::cur);
+        }
+    }
+    error = haveFormat ? "no data chunk" : "no format chunk";
+    return false;
+}
+
+float decodeWAVSample(const unsigned char* p, const WAVInfo& info) {
+    if (info.format == 3) {
+        float value;
+        std::memcpy(&value, p, sizeof(value));
+        return value;
+    }
+    switch (info.bitsPerSample) {
+        case 16:
+            return static_cast<int16_t>(get16(p)) * (1.0f / 32768.0f);
+        case 24: {
+            uint32_t bits = (static_cast<uint32_t>(p[0]) << 8) | (static_cast<uint32_t>(p[1]) << 16) |
+                            (static_cast<uint32_t>(p[2]) << 24);
+            return (static_cast<int32_t>(bits) >> 8) * (1.0f / 8388608.0f);
+        }
+        default:
+            return static_cast<int32_t>(get32(p)) * (1.0f / 2147483648.0f);
+    }
+}
@@ -0,0 +1,26 @@
+#ifndef WAV_READER_H
+#define WAV_READER_H
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+
+// RIFF/WAVE parsing shared by the loop loader (loop_file.cpp) and the
+// convolution reverb's impulse loader. Handles PCM and IEEE float,
+// including WAVE_FORMAT_EXTENSIBLE headers; callers check the format.
+struct WAVInfo {
+    uint16_t format = 0;            // 1 = PCM, 3 = IEEE float
+    uint16_t channels = 0;
+    uint32_t sampleRate = 0;
+    uint16_t blockAlign = 0;
+    uint16_t bitsPerSample = 0;
+    uint32_t dataBytes = 0;
+};
+
+// Read the RIFF headers up to the start of the data chunk payload
+bool readWAVHeader(std::ifstream& in, WAVInfo& info, std::string& error);
+
+// 16/24/32-bit PCM or 32-bit float sample at p as a float in [-1, 1)
+float decodeWAVSample(const unsigned char* p, const WAVInfo& info);
+
+#endif // WAV_READER_H